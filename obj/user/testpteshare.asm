@@ -0,0 +1,8469 @@
+
+obj/user/testpteshare.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 63 01 00 00       	call   800194 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <childofspawn>:
+	breakpoint();
+}
+
+void
+childofspawn(void)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	83 ec 10             	sub    $0x10,%esp
+	strcpy(VA, msg2);
+  800039:	ff 35 00 50 80 00    	push   0x805000
+  80003f:	68 00 00 00 a0       	push   $0xa0000000
+  800044:	e8 77 08 00 00       	call   8008c0 <strcpy>
+	exit();
+  800049:	e8 8f 01 00 00       	call   8001dd <exit>
+}
+  80004e:	83 c4 10             	add    $0x10,%esp
+  800051:	c9                   	leave
+  800052:	c3                   	ret
+
+00800053 <umain>:
+{
+  800053:	55                   	push   %ebp
+  800054:	89 e5                	mov    %esp,%ebp
+  800056:	53                   	push   %ebx
+  800057:	83 ec 04             	sub    $0x4,%esp
+	if (argc != 0)
+  80005a:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+  80005e:	0f 85 d0 00 00 00    	jne    800134 <umain+0xe1>
+	if ((r = sys_page_alloc(0, VA, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  800064:	83 ec 04             	sub    $0x4,%esp
+  800067:	68 07 04 00 00       	push   $0x407
+  80006c:	68 00 00 00 a0       	push   $0xa0000000
+  800071:	6a 00                	push   $0x0
+  800073:	e8 54 0c 00 00       	call   800ccc <sys_page_alloc>
+  800078:	83 c4 10             	add    $0x10,%esp
+  80007b:	85 c0                	test   %eax,%eax
+  80007d:	0f 88 bb 00 00 00    	js     80013e <umain+0xeb>
+	if ((r = fork()) < 0)
+  800083:	e8 9f 11 00 00       	call   801227 <fork>
+  800088:	89 c3                	mov    %eax,%ebx
+  80008a:	85 c0                	test   %eax,%eax
+  80008c:	0f 88 be 00 00 00    	js     800150 <umain+0xfd>
+	if (r == 0) {
+  800092:	0f 84 ca 00 00 00    	je     800162 <umain+0x10f>
+	wait(r);
+  800098:	83 ec 0c             	sub    $0xc,%esp
+  80009b:	53                   	push   %ebx
+  80009c:	e8 9f 38 00 00       	call   803940 <wait>
+	cprintf("fork handles PTE_SHARE %s\n", strcmp(VA, msg) == 0 ? "right" : "wrong");
+  8000a1:	83 c4 08             	add    $0x8,%esp
+  8000a4:	ff 35 04 50 80 00    	push   0x805004
+  8000aa:	68 00 00 00 a0       	push   $0xa0000000
+  8000af:	e8 bd 08 00 00       	call   800971 <strcmp>
+  8000b4:	83 c4 08             	add    $0x8,%esp
+  8000b7:	85 c0                	test   %eax,%eax
+  8000b9:	b8 06 40 80 00       	mov    $0x804006,%eax
+  8000be:	ba 00 40 80 00       	mov    $0x804000,%edx
+  8000c3:	0f 44 c2             	cmove  %edx,%eax
+  8000c6:	50                   	push   %eax
+  8000c7:	68 3c 40 80 00       	push   $0x80403c
+  8000cc:	e8 01 02 00 00       	call   8002d2 <cprintf>
+	if ((r = spawnl("/testpteshare", "testpteshare", "arg", 0)) < 0)
+  8000d1:	6a 00                	push   $0x0
+  8000d3:	68 57 40 80 00       	push   $0x804057
+  8000d8:	68 5c 40 80 00       	push   $0x80405c
+  8000dd:	68 5b 40 80 00       	push   $0x80405b
+  8000e2:	e8 33 30 00 00       	call   80311a <spawnl>
+  8000e7:	83 c4 20             	add    $0x20,%esp
+  8000ea:	85 c0                	test   %eax,%eax
+  8000ec:	0f 88 90 00 00 00    	js     800182 <umain+0x12f>
+	wait(r);
+  8000f2:	83 ec 0c             	sub    $0xc,%esp
+  8000f5:	50                   	push   %eax
+  8000f6:	e8 45 38 00 00       	call   803940 <wait>
+	cprintf("spawn handles PTE_SHARE %s\n", strcmp(VA, msg2) == 0 ? "right" : "wrong");
+  8000fb:	83 c4 08             	add    $0x8,%esp
+  8000fe:	ff 35 00 50 80 00    	push   0x805000
+  800104:	68 00 00 00 a0       	push   $0xa0000000
+  800109:	e8 63 08 00 00       	call   800971 <strcmp>
+  80010e:	83 c4 08             	add    $0x8,%esp
+  800111:	85 c0                	test   %eax,%eax
+  800113:	b8 06 40 80 00       	mov    $0x804006,%eax
+  800118:	ba 00 40 80 00       	mov    $0x804000,%edx
+  80011d:	0f 44 c2             	cmove  %edx,%eax
+  800120:	50                   	push   %eax
+  800121:	68 73 40 80 00       	push   $0x804073
+  800126:	e8 a7 01 00 00       	call   8002d2 <cprintf>
+#include <inc/types.h>
+
+static inline void
+breakpoint(void)
+{
+	asm volatile("int3");
+  80012b:	cc                   	int3
+}
+  80012c:	83 c4 10             	add    $0x10,%esp
+  80012f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800132:	c9                   	leave
+  800133:	c3                   	ret
+		childofspawn();
+  800134:	e8 fa fe ff ff       	call   800033 <childofspawn>
+  800139:	e9 26 ff ff ff       	jmp    800064 <umain+0x11>
+		panic("sys_page_alloc: %e", r);
+  80013e:	50                   	push   %eax
+  80013f:	68 0c 40 80 00       	push   $0x80400c
+  800144:	6a 13                	push   $0x13
+  800146:	68 1f 40 80 00       	push   $0x80401f
+  80014b:	e8 a7 00 00 00       	call   8001f7 <_panic>
+		panic("fork: %e", r);
+  800150:	50                   	push   %eax
+  800151:	68 33 40 80 00       	push   $0x804033
+  800156:	6a 17                	push   $0x17
+  800158:	68 1f 40 80 00       	push   $0x80401f
+  80015d:	e8 95 00 00 00       	call   8001f7 <_panic>
+		strcpy(VA, msg);
+  800162:	83 ec 08             	sub    $0x8,%esp
+  800165:	ff 35 04 50 80 00    	push   0x805004
+  80016b:	68 00 00 00 a0       	push   $0xa0000000
+  800170:	e8 4b 07 00 00       	call   8008c0 <strcpy>
+		exit();
+  800175:	e8 63 00 00 00       	call   8001dd <exit>
+  80017a:	83 c4 10             	add    $0x10,%esp
+  80017d:	e9 16 ff ff ff       	jmp    800098 <umain+0x45>
+		panic("spawn: %e", r);
+  800182:	50                   	push   %eax
+  800183:	68 69 40 80 00       	push   $0x804069
+  800188:	6a 21                	push   $0x21
+  80018a:	68 1f 40 80 00       	push   $0x80401f
+  80018f:	e8 63 00 00 00       	call   8001f7 <_panic>
+
+00800194 <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  800194:	55                   	push   %ebp
+  800195:	89 e5                	mov    %esp,%ebp
+  800197:	56                   	push   %esi
+  800198:	53                   	push   %ebx
+  800199:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80019c:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = &envs[ENVX(sys_getenvid())];
+  80019f:	e8 e2 0a 00 00       	call   800c86 <sys_getenvid>
+  8001a4:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8001a9:	69 c0 8c 00 00 00    	imul   $0x8c,%eax,%eax
+  8001af:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8001b4:	a3 00 60 80 00       	mov    %eax,0x806000
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  8001b9:	85 db                	test   %ebx,%ebx
+  8001bb:	7e 07                	jle    8001c4 <libmain+0x30>
+		binaryname = argv[0];
+  8001bd:	8b 06                	mov    (%esi),%eax
+  8001bf:	a3 08 50 80 00       	mov    %eax,0x805008
+
+	// call user main routine
+	umain(argc, argv);
+  8001c4:	83 ec 08             	sub    $0x8,%esp
+  8001c7:	56                   	push   %esi
+  8001c8:	53                   	push   %ebx
+  8001c9:	e8 85 fe ff ff       	call   800053 <umain>
+
+	// exit gracefully
+	exit();
+  8001ce:	e8 0a 00 00 00       	call   8001dd <exit>
+}
+  8001d3:	83 c4 10             	add    $0x10,%esp
+  8001d6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8001d9:	5b                   	pop    %ebx
+  8001da:	5e                   	pop    %esi
+  8001db:	5d                   	pop    %ebp
+  8001dc:	c3                   	ret
+
+008001dd <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  8001dd:	55                   	push   %ebp
+  8001de:	89 e5                	mov    %esp,%ebp
+  8001e0:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  8001e3:	e8 ce 13 00 00       	call   8015b6 <close_all>
+	sys_env_destroy(0);
+  8001e8:	83 ec 0c             	sub    $0xc,%esp
+  8001eb:	6a 00                	push   $0x0
+  8001ed:	e8 4b 0a 00 00       	call   800c3d <sys_env_destroy>
+}
+  8001f2:	83 c4 10             	add    $0x10,%esp
+  8001f5:	c9                   	leave
+  8001f6:	c3                   	ret
+
+008001f7 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  8001f7:	55                   	push   %ebp
+  8001f8:	89 e5                	mov    %esp,%ebp
+  8001fa:	56                   	push   %esi
+  8001fb:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  8001fc:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  8001ff:	8b 35 08 50 80 00    	mov    0x805008,%esi
+  800205:	e8 7c 0a 00 00       	call   800c86 <sys_getenvid>
+  80020a:	83 ec 0c             	sub    $0xc,%esp
+  80020d:	ff 75 0c             	push   0xc(%ebp)
+  800210:	ff 75 08             	push   0x8(%ebp)
+  800213:	56                   	push   %esi
+  800214:	50                   	push   %eax
+  800215:	68 b8 40 80 00       	push   $0x8040b8
+  80021a:	e8 b3 00 00 00       	call   8002d2 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  80021f:	83 c4 18             	add    $0x18,%esp
+  800222:	53                   	push   %ebx
+  800223:	ff 75 10             	push   0x10(%ebp)
+  800226:	e8 56 00 00 00       	call   800281 <vcprintf>
+	cprintf("\n");
+  80022b:	c7 04 24 d3 46 80 00 	movl   $0x8046d3,(%esp)
+  800232:	e8 9b 00 00 00       	call   8002d2 <cprintf>
+  800237:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  80023a:	cc                   	int3
+	while (1)
+  80023b:	eb fd                	jmp    80023a <_panic+0x43>
+
+0080023d <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  80023d:	55                   	push   %ebp
+  80023e:	89 e5                	mov    %esp,%ebp
+  800240:	53                   	push   %ebx
+  800241:	83 ec 04             	sub    $0x4,%esp
+  800244:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  800247:	8b 13                	mov    (%ebx),%edx
+  800249:	8d 42 01             	lea    0x1(%edx),%eax
+  80024c:	89 03                	mov    %eax,(%ebx)
+  80024e:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800251:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  800255:	3d ff 00 00 00       	cmp    $0xff,%eax
+  80025a:	74 09                	je     800265 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  80025c:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  800260:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800263:	c9                   	leave
+  800264:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  800265:	83 ec 08             	sub    $0x8,%esp
+  800268:	68 ff 00 00 00       	push   $0xff
+  80026d:	8d 43 08             	lea    0x8(%ebx),%eax
+  800270:	50                   	push   %eax
+  800271:	e8 7a 09 00 00       	call   800bf0 <sys_cputs>
+		b->idx = 0;
+  800276:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  80027c:	83 c4 10             	add    $0x10,%esp
+  80027f:	eb db                	jmp    80025c <putch+0x1f>
+
+00800281 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  800281:	55                   	push   %ebp
+  800282:	89 e5                	mov    %esp,%ebp
+  800284:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  80028a:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  800291:	00 00 00 
+	b.cnt = 0;
+  800294:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  80029b:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  80029e:	ff 75 0c             	push   0xc(%ebp)
+  8002a1:	ff 75 08             	push   0x8(%ebp)
+  8002a4:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8002aa:	50                   	push   %eax
+  8002ab:	68 3d 02 80 00       	push   $0x80023d
+  8002b0:	e8 14 01 00 00       	call   8003c9 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  8002b5:	83 c4 08             	add    $0x8,%esp
+  8002b8:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  8002be:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  8002c4:	50                   	push   %eax
+  8002c5:	e8 26 09 00 00       	call   800bf0 <sys_cputs>
+
+	return b.cnt;
+}
+  8002ca:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  8002d0:	c9                   	leave
+  8002d1:	c3                   	ret
+
+008002d2 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  8002d2:	55                   	push   %ebp
+  8002d3:	89 e5                	mov    %esp,%ebp
+  8002d5:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  8002d8:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  8002db:	50                   	push   %eax
+  8002dc:	ff 75 08             	push   0x8(%ebp)
+  8002df:	e8 9d ff ff ff       	call   800281 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  8002e4:	c9                   	leave
+  8002e5:	c3                   	ret
+
+008002e6 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  8002e6:	55                   	push   %ebp
+  8002e7:	89 e5                	mov    %esp,%ebp
+  8002e9:	57                   	push   %edi
+  8002ea:	56                   	push   %esi
+  8002eb:	53                   	push   %ebx
+  8002ec:	83 ec 1c             	sub    $0x1c,%esp
+  8002ef:	89 c7                	mov    %eax,%edi
+  8002f1:	89 d6                	mov    %edx,%esi
+  8002f3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8002f6:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8002f9:	89 d1                	mov    %edx,%ecx
+  8002fb:	89 c2                	mov    %eax,%edx
+  8002fd:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800300:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800303:	8b 45 10             	mov    0x10(%ebp),%eax
+  800306:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  800309:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80030c:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800313:	39 c2                	cmp    %eax,%edx
+  800315:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  800318:	72 3e                	jb     800358 <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  80031a:	83 ec 0c             	sub    $0xc,%esp
+  80031d:	ff 75 18             	push   0x18(%ebp)
+  800320:	83 eb 01             	sub    $0x1,%ebx
+  800323:	53                   	push   %ebx
+  800324:	50                   	push   %eax
+  800325:	83 ec 08             	sub    $0x8,%esp
+  800328:	ff 75 e4             	push   -0x1c(%ebp)
+  80032b:	ff 75 e0             	push   -0x20(%ebp)
+  80032e:	ff 75 dc             	push   -0x24(%ebp)
+  800331:	ff 75 d8             	push   -0x28(%ebp)
+  800334:	e8 5a 3b 00 00       	call   803e93 <__udivdi3>
+  800339:	83 c4 18             	add    $0x18,%esp
+  80033c:	52                   	push   %edx
+  80033d:	50                   	push   %eax
+  80033e:	89 f2                	mov    %esi,%edx
+  800340:	89 f8                	mov    %edi,%eax
+  800342:	e8 9f ff ff ff       	call   8002e6 <printnum>
+  800347:	83 c4 20             	add    $0x20,%esp
+  80034a:	eb 13                	jmp    80035f <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  80034c:	83 ec 08             	sub    $0x8,%esp
+  80034f:	56                   	push   %esi
+  800350:	ff 75 18             	push   0x18(%ebp)
+  800353:	ff d7                	call   *%edi
+  800355:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  800358:	83 eb 01             	sub    $0x1,%ebx
+  80035b:	85 db                	test   %ebx,%ebx
+  80035d:	7f ed                	jg     80034c <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  80035f:	83 ec 08             	sub    $0x8,%esp
+  800362:	56                   	push   %esi
+  800363:	83 ec 04             	sub    $0x4,%esp
+  800366:	ff 75 e4             	push   -0x1c(%ebp)
+  800369:	ff 75 e0             	push   -0x20(%ebp)
+  80036c:	ff 75 dc             	push   -0x24(%ebp)
+  80036f:	ff 75 d8             	push   -0x28(%ebp)
+  800372:	e8 3a 3b 00 00       	call   803eb1 <__umoddi3>
+  800377:	83 c4 14             	add    $0x14,%esp
+  80037a:	0f be 80 db 40 80 00 	movsbl 0x8040db(%eax),%eax
+  800381:	50                   	push   %eax
+  800382:	ff d7                	call   *%edi
+}
+  800384:	83 c4 10             	add    $0x10,%esp
+  800387:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80038a:	5b                   	pop    %ebx
+  80038b:	5e                   	pop    %esi
+  80038c:	5f                   	pop    %edi
+  80038d:	5d                   	pop    %ebp
+  80038e:	c3                   	ret
+
+0080038f <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  80038f:	55                   	push   %ebp
+  800390:	89 e5                	mov    %esp,%ebp
+  800392:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  800395:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  800399:	8b 10                	mov    (%eax),%edx
+  80039b:	3b 50 04             	cmp    0x4(%eax),%edx
+  80039e:	73 0a                	jae    8003aa <sprintputch+0x1b>
+		*b->buf++ = ch;
+  8003a0:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8003a3:	89 08                	mov    %ecx,(%eax)
+  8003a5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8003a8:	88 02                	mov    %al,(%edx)
+}
+  8003aa:	5d                   	pop    %ebp
+  8003ab:	c3                   	ret
+
+008003ac <printfmt>:
+{
+  8003ac:	55                   	push   %ebp
+  8003ad:	89 e5                	mov    %esp,%ebp
+  8003af:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  8003b2:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  8003b5:	50                   	push   %eax
+  8003b6:	ff 75 10             	push   0x10(%ebp)
+  8003b9:	ff 75 0c             	push   0xc(%ebp)
+  8003bc:	ff 75 08             	push   0x8(%ebp)
+  8003bf:	e8 05 00 00 00       	call   8003c9 <vprintfmt>
+}
+  8003c4:	83 c4 10             	add    $0x10,%esp
+  8003c7:	c9                   	leave
+  8003c8:	c3                   	ret
+
+008003c9 <vprintfmt>:
+{
+  8003c9:	55                   	push   %ebp
+  8003ca:	89 e5                	mov    %esp,%ebp
+  8003cc:	57                   	push   %edi
+  8003cd:	56                   	push   %esi
+  8003ce:	53                   	push   %ebx
+  8003cf:	83 ec 2c             	sub    $0x2c,%esp
+  8003d2:	8b 75 08             	mov    0x8(%ebp),%esi
+  8003d5:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8003d8:	8b 7d 10             	mov    0x10(%ebp),%edi
+  8003db:	eb 0a                	jmp    8003e7 <vprintfmt+0x1e>
+			putch(ch, putdat);
+  8003dd:	83 ec 08             	sub    $0x8,%esp
+  8003e0:	53                   	push   %ebx
+  8003e1:	50                   	push   %eax
+  8003e2:	ff d6                	call   *%esi
+  8003e4:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8003e7:	83 c7 01             	add    $0x1,%edi
+  8003ea:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  8003ee:	83 f8 25             	cmp    $0x25,%eax
+  8003f1:	74 0c                	je     8003ff <vprintfmt+0x36>
+			if (ch == '\0')
+  8003f3:	85 c0                	test   %eax,%eax
+  8003f5:	75 e6                	jne    8003dd <vprintfmt+0x14>
+}
+  8003f7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8003fa:	5b                   	pop    %ebx
+  8003fb:	5e                   	pop    %esi
+  8003fc:	5f                   	pop    %edi
+  8003fd:	5d                   	pop    %ebp
+  8003fe:	c3                   	ret
+		padc = ' ';
+  8003ff:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  800403:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  80040a:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  800411:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  800418:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  80041d:	8d 47 01             	lea    0x1(%edi),%eax
+  800420:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800423:	0f b6 17             	movzbl (%edi),%edx
+  800426:	8d 42 dd             	lea    -0x23(%edx),%eax
+  800429:	3c 55                	cmp    $0x55,%al
+  80042b:	0f 87 cf 03 00 00    	ja     800800 <vprintfmt+0x437>
+  800431:	0f b6 c0             	movzbl %al,%eax
+  800434:	ff 24 85 40 42 80 00 	jmp    *0x804240(,%eax,4)
+  80043b:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  80043e:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  800442:	eb d9                	jmp    80041d <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  800444:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800447:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  80044b:	eb d0                	jmp    80041d <vprintfmt+0x54>
+  80044d:	0f b6 d2             	movzbl %dl,%edx
+  800450:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  800453:	b8 00 00 00 00       	mov    $0x0,%eax
+  800458:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  80045b:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  80045e:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  800462:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  800465:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  800468:	83 f9 09             	cmp    $0x9,%ecx
+  80046b:	77 55                	ja     8004c2 <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  80046d:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  800470:	eb e9                	jmp    80045b <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  800472:	8b 45 14             	mov    0x14(%ebp),%eax
+  800475:	8b 00                	mov    (%eax),%eax
+  800477:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80047a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80047d:	8d 40 04             	lea    0x4(%eax),%eax
+  800480:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800483:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  800486:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  80048a:	79 91                	jns    80041d <vprintfmt+0x54>
+				width = precision, precision = -1;
+  80048c:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  80048f:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800492:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  800499:	eb 82                	jmp    80041d <vprintfmt+0x54>
+			if (width < 0)
+  80049b:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  80049e:	85 d2                	test   %edx,%edx
+  8004a0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004a5:	0f 49 c2             	cmovns %edx,%eax
+  8004a8:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8004ab:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8004ae:	e9 6a ff ff ff       	jmp    80041d <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  8004b3:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  8004b6:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  8004bd:	e9 5b ff ff ff       	jmp    80041d <vprintfmt+0x54>
+  8004c2:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8004c5:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8004c8:	eb bc                	jmp    800486 <vprintfmt+0xbd>
+			lflag++;
+  8004ca:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  8004cd:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8004d0:	e9 48 ff ff ff       	jmp    80041d <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  8004d5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004d8:	8d 78 04             	lea    0x4(%eax),%edi
+  8004db:	83 ec 08             	sub    $0x8,%esp
+  8004de:	53                   	push   %ebx
+  8004df:	ff 30                	push   (%eax)
+  8004e1:	ff d6                	call   *%esi
+			break;
+  8004e3:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  8004e6:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  8004e9:	e9 b1 02 00 00       	jmp    80079f <vprintfmt+0x3d6>
+			err = va_arg(ap, int);
+  8004ee:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004f1:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  8004f4:	8b 10                	mov    (%eax),%edx
+  8004f6:	89 d0                	mov    %edx,%eax
+  8004f8:	f7 d8                	neg    %eax
+  8004fa:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  8004fd:	83 f8 11             	cmp    $0x11,%eax
+  800500:	7f 23                	jg     800525 <vprintfmt+0x15c>
+  800502:	8b 14 85 a0 43 80 00 	mov    0x8043a0(,%eax,4),%edx
+  800509:	85 d2                	test   %edx,%edx
+  80050b:	74 18                	je     800525 <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  80050d:	52                   	push   %edx
+  80050e:	68 be 44 80 00       	push   $0x8044be
+  800513:	53                   	push   %ebx
+  800514:	56                   	push   %esi
+  800515:	e8 92 fe ff ff       	call   8003ac <printfmt>
+  80051a:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  80051d:	89 7d 14             	mov    %edi,0x14(%ebp)
+  800520:	e9 7a 02 00 00       	jmp    80079f <vprintfmt+0x3d6>
+				printfmt(putch, putdat, "error %d", err);
+  800525:	50                   	push   %eax
+  800526:	68 f3 40 80 00       	push   $0x8040f3
+  80052b:	53                   	push   %ebx
+  80052c:	56                   	push   %esi
+  80052d:	e8 7a fe ff ff       	call   8003ac <printfmt>
+  800532:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800535:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  800538:	e9 62 02 00 00       	jmp    80079f <vprintfmt+0x3d6>
+			if ((p = va_arg(ap, char *)) == NULL)
+  80053d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800540:	83 c0 04             	add    $0x4,%eax
+  800543:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  800546:	8b 45 14             	mov    0x14(%ebp),%eax
+  800549:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  80054b:	85 c9                	test   %ecx,%ecx
+  80054d:	b8 ec 40 80 00       	mov    $0x8040ec,%eax
+  800552:	0f 45 c1             	cmovne %ecx,%eax
+  800555:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  800558:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  80055c:	7e 06                	jle    800564 <vprintfmt+0x19b>
+  80055e:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  800562:	75 0b                	jne    80056f <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800564:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  800567:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  80056a:	89 75 08             	mov    %esi,0x8(%ebp)
+  80056d:	eb 5c                	jmp    8005cb <vprintfmt+0x202>
+  80056f:	83 ec 08             	sub    $0x8,%esp
+  800572:	ff 75 d0             	push   -0x30(%ebp)
+  800575:	ff 75 cc             	push   -0x34(%ebp)
+  800578:	e8 20 03 00 00       	call   80089d <strnlen>
+  80057d:	89 c2                	mov    %eax,%edx
+  80057f:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800582:	29 d0                	sub    %edx,%eax
+  800584:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  800587:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  80058b:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80058e:	89 75 08             	mov    %esi,0x8(%ebp)
+  800591:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800593:	eb 0e                	jmp    8005a3 <vprintfmt+0x1da>
+					putch(padc, putdat);
+  800595:	83 ec 08             	sub    $0x8,%esp
+  800598:	53                   	push   %ebx
+  800599:	57                   	push   %edi
+  80059a:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80059d:	83 ee 01             	sub    $0x1,%esi
+  8005a0:	83 c4 10             	add    $0x10,%esp
+  8005a3:	85 f6                	test   %esi,%esi
+  8005a5:	7f ee                	jg     800595 <vprintfmt+0x1cc>
+  8005a7:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8005aa:	8b 75 08             	mov    0x8(%ebp),%esi
+  8005ad:	85 c0                	test   %eax,%eax
+  8005af:	ba 00 00 00 00       	mov    $0x0,%edx
+  8005b4:	0f 49 d0             	cmovns %eax,%edx
+  8005b7:	29 d0                	sub    %edx,%eax
+  8005b9:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8005bc:	eb a6                	jmp    800564 <vprintfmt+0x19b>
+					putch(ch, putdat);
+  8005be:	83 ec 08             	sub    $0x8,%esp
+  8005c1:	53                   	push   %ebx
+  8005c2:	52                   	push   %edx
+  8005c3:	ff 55 08             	call   *0x8(%ebp)
+  8005c6:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8005c9:	89 f1                	mov    %esi,%ecx
+  8005cb:	8d 71 01             	lea    0x1(%ecx),%esi
+  8005ce:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  8005d2:	0f be d0             	movsbl %al,%edx
+  8005d5:	85 d2                	test   %edx,%edx
+  8005d7:	74 28                	je     800601 <vprintfmt+0x238>
+  8005d9:	85 ff                	test   %edi,%edi
+  8005db:	78 05                	js     8005e2 <vprintfmt+0x219>
+  8005dd:	83 ef 01             	sub    $0x1,%edi
+  8005e0:	78 30                	js     800612 <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  8005e2:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  8005e6:	74 d6                	je     8005be <vprintfmt+0x1f5>
+  8005e8:	0f be c0             	movsbl %al,%eax
+  8005eb:	83 e8 20             	sub    $0x20,%eax
+  8005ee:	83 f8 5e             	cmp    $0x5e,%eax
+  8005f1:	76 cb                	jbe    8005be <vprintfmt+0x1f5>
+					putch('?', putdat);
+  8005f3:	83 ec 08             	sub    $0x8,%esp
+  8005f6:	53                   	push   %ebx
+  8005f7:	6a 3f                	push   $0x3f
+  8005f9:	ff 55 08             	call   *0x8(%ebp)
+  8005fc:	83 c4 10             	add    $0x10,%esp
+  8005ff:	eb c8                	jmp    8005c9 <vprintfmt+0x200>
+  800601:	8b 75 08             	mov    0x8(%ebp),%esi
+  800604:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800607:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  80060a:	01 d0                	add    %edx,%eax
+  80060c:	29 c8                	sub    %ecx,%eax
+  80060e:	89 c7                	mov    %eax,%edi
+  800610:	eb 13                	jmp    800625 <vprintfmt+0x25c>
+  800612:	8b 75 08             	mov    0x8(%ebp),%esi
+  800615:	eb ed                	jmp    800604 <vprintfmt+0x23b>
+				putch(' ', putdat);
+  800617:	83 ec 08             	sub    $0x8,%esp
+  80061a:	53                   	push   %ebx
+  80061b:	6a 20                	push   $0x20
+  80061d:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  80061f:	83 ef 01             	sub    $0x1,%edi
+  800622:	83 c4 10             	add    $0x10,%esp
+  800625:	85 ff                	test   %edi,%edi
+  800627:	7f ee                	jg     800617 <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800629:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  80062c:	89 45 14             	mov    %eax,0x14(%ebp)
+  80062f:	e9 6b 01 00 00       	jmp    80079f <vprintfmt+0x3d6>
+	if (lflag >= 2)
+  800634:	83 f9 01             	cmp    $0x1,%ecx
+  800637:	7f 1f                	jg     800658 <vprintfmt+0x28f>
+	else if (lflag)
+  800639:	85 c9                	test   %ecx,%ecx
+  80063b:	74 67                	je     8006a4 <vprintfmt+0x2db>
+		return va_arg(*ap, long);
+  80063d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800640:	8b 00                	mov    (%eax),%eax
+  800642:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800645:	89 c1                	mov    %eax,%ecx
+  800647:	c1 f9 1f             	sar    $0x1f,%ecx
+  80064a:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80064d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800650:	8d 40 04             	lea    0x4(%eax),%eax
+  800653:	89 45 14             	mov    %eax,0x14(%ebp)
+  800656:	eb 17                	jmp    80066f <vprintfmt+0x2a6>
+		return va_arg(*ap, long long);
+  800658:	8b 45 14             	mov    0x14(%ebp),%eax
+  80065b:	8b 50 04             	mov    0x4(%eax),%edx
+  80065e:	8b 00                	mov    (%eax),%eax
+  800660:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800663:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800666:	8b 45 14             	mov    0x14(%ebp),%eax
+  800669:	8d 40 08             	lea    0x8(%eax),%eax
+  80066c:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  80066f:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800672:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  800675:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  80067a:	85 c9                	test   %ecx,%ecx
+  80067c:	0f 89 03 01 00 00    	jns    800785 <vprintfmt+0x3bc>
+				putch('-', putdat);
+  800682:	83 ec 08             	sub    $0x8,%esp
+  800685:	53                   	push   %ebx
+  800686:	6a 2d                	push   $0x2d
+  800688:	ff d6                	call   *%esi
+				num = -(long long) num;
+  80068a:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  80068d:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800690:	f7 da                	neg    %edx
+  800692:	83 d1 00             	adc    $0x0,%ecx
+  800695:	f7 d9                	neg    %ecx
+  800697:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  80069a:	bf 0a 00 00 00       	mov    $0xa,%edi
+  80069f:	e9 e1 00 00 00       	jmp    800785 <vprintfmt+0x3bc>
+		return va_arg(*ap, int);
+  8006a4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006a7:	8b 00                	mov    (%eax),%eax
+  8006a9:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8006ac:	89 c1                	mov    %eax,%ecx
+  8006ae:	c1 f9 1f             	sar    $0x1f,%ecx
+  8006b1:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8006b4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006b7:	8d 40 04             	lea    0x4(%eax),%eax
+  8006ba:	89 45 14             	mov    %eax,0x14(%ebp)
+  8006bd:	eb b0                	jmp    80066f <vprintfmt+0x2a6>
+	if (lflag >= 2)
+  8006bf:	83 f9 01             	cmp    $0x1,%ecx
+  8006c2:	7f 1e                	jg     8006e2 <vprintfmt+0x319>
+	else if (lflag)
+  8006c4:	85 c9                	test   %ecx,%ecx
+  8006c6:	74 32                	je     8006fa <vprintfmt+0x331>
+		return va_arg(*ap, unsigned long);
+  8006c8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006cb:	8b 10                	mov    (%eax),%edx
+  8006cd:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006d2:	8d 40 04             	lea    0x4(%eax),%eax
+  8006d5:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8006d8:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  8006dd:	e9 a3 00 00 00       	jmp    800785 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  8006e2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006e5:	8b 10                	mov    (%eax),%edx
+  8006e7:	8b 48 04             	mov    0x4(%eax),%ecx
+  8006ea:	8d 40 08             	lea    0x8(%eax),%eax
+  8006ed:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8006f0:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  8006f5:	e9 8b 00 00 00       	jmp    800785 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  8006fa:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006fd:	8b 10                	mov    (%eax),%edx
+  8006ff:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800704:	8d 40 04             	lea    0x4(%eax),%eax
+  800707:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80070a:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  80070f:	eb 74                	jmp    800785 <vprintfmt+0x3bc>
+	if (lflag >= 2)
+  800711:	83 f9 01             	cmp    $0x1,%ecx
+  800714:	7f 1b                	jg     800731 <vprintfmt+0x368>
+	else if (lflag)
+  800716:	85 c9                	test   %ecx,%ecx
+  800718:	74 2c                	je     800746 <vprintfmt+0x37d>
+		return va_arg(*ap, unsigned long);
+  80071a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80071d:	8b 10                	mov    (%eax),%edx
+  80071f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800724:	8d 40 04             	lea    0x4(%eax),%eax
+  800727:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  80072a:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long);
+  80072f:	eb 54                	jmp    800785 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  800731:	8b 45 14             	mov    0x14(%ebp),%eax
+  800734:	8b 10                	mov    (%eax),%edx
+  800736:	8b 48 04             	mov    0x4(%eax),%ecx
+  800739:	8d 40 08             	lea    0x8(%eax),%eax
+  80073c:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  80073f:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long long);
+  800744:	eb 3f                	jmp    800785 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  800746:	8b 45 14             	mov    0x14(%ebp),%eax
+  800749:	8b 10                	mov    (%eax),%edx
+  80074b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800750:	8d 40 04             	lea    0x4(%eax),%eax
+  800753:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800756:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned int);
+  80075b:	eb 28                	jmp    800785 <vprintfmt+0x3bc>
+			putch('0', putdat);
+  80075d:	83 ec 08             	sub    $0x8,%esp
+  800760:	53                   	push   %ebx
+  800761:	6a 30                	push   $0x30
+  800763:	ff d6                	call   *%esi
+			putch('x', putdat);
+  800765:	83 c4 08             	add    $0x8,%esp
+  800768:	53                   	push   %ebx
+  800769:	6a 78                	push   $0x78
+  80076b:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  80076d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800770:	8b 10                	mov    (%eax),%edx
+  800772:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  800777:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  80077a:	8d 40 04             	lea    0x4(%eax),%eax
+  80077d:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800780:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  800785:	83 ec 0c             	sub    $0xc,%esp
+  800788:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  80078c:	50                   	push   %eax
+  80078d:	ff 75 e0             	push   -0x20(%ebp)
+  800790:	57                   	push   %edi
+  800791:	51                   	push   %ecx
+  800792:	52                   	push   %edx
+  800793:	89 da                	mov    %ebx,%edx
+  800795:	89 f0                	mov    %esi,%eax
+  800797:	e8 4a fb ff ff       	call   8002e6 <printnum>
+			break;
+  80079c:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  80079f:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8007a2:	e9 40 fc ff ff       	jmp    8003e7 <vprintfmt+0x1e>
+	if (lflag >= 2)
+  8007a7:	83 f9 01             	cmp    $0x1,%ecx
+  8007aa:	7f 1b                	jg     8007c7 <vprintfmt+0x3fe>
+	else if (lflag)
+  8007ac:	85 c9                	test   %ecx,%ecx
+  8007ae:	74 2c                	je     8007dc <vprintfmt+0x413>
+		return va_arg(*ap, unsigned long);
+  8007b0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007b3:	8b 10                	mov    (%eax),%edx
+  8007b5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8007ba:	8d 40 04             	lea    0x4(%eax),%eax
+  8007bd:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8007c0:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  8007c5:	eb be                	jmp    800785 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  8007c7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007ca:	8b 10                	mov    (%eax),%edx
+  8007cc:	8b 48 04             	mov    0x4(%eax),%ecx
+  8007cf:	8d 40 08             	lea    0x8(%eax),%eax
+  8007d2:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8007d5:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  8007da:	eb a9                	jmp    800785 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  8007dc:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007df:	8b 10                	mov    (%eax),%edx
+  8007e1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8007e6:	8d 40 04             	lea    0x4(%eax),%eax
+  8007e9:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8007ec:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  8007f1:	eb 92                	jmp    800785 <vprintfmt+0x3bc>
+			putch(ch, putdat);
+  8007f3:	83 ec 08             	sub    $0x8,%esp
+  8007f6:	53                   	push   %ebx
+  8007f7:	6a 25                	push   $0x25
+  8007f9:	ff d6                	call   *%esi
+			break;
+  8007fb:	83 c4 10             	add    $0x10,%esp
+  8007fe:	eb 9f                	jmp    80079f <vprintfmt+0x3d6>
+			putch('%', putdat);
+  800800:	83 ec 08             	sub    $0x8,%esp
+  800803:	53                   	push   %ebx
+  800804:	6a 25                	push   $0x25
+  800806:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800808:	83 c4 10             	add    $0x10,%esp
+  80080b:	89 f8                	mov    %edi,%eax
+  80080d:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800811:	74 05                	je     800818 <vprintfmt+0x44f>
+  800813:	83 e8 01             	sub    $0x1,%eax
+  800816:	eb f5                	jmp    80080d <vprintfmt+0x444>
+  800818:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80081b:	eb 82                	jmp    80079f <vprintfmt+0x3d6>
+
+0080081d <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  80081d:	55                   	push   %ebp
+  80081e:	89 e5                	mov    %esp,%ebp
+  800820:	83 ec 18             	sub    $0x18,%esp
+  800823:	8b 45 08             	mov    0x8(%ebp),%eax
+  800826:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800829:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  80082c:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800830:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800833:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  80083a:	85 c0                	test   %eax,%eax
+  80083c:	74 26                	je     800864 <vsnprintf+0x47>
+  80083e:	85 d2                	test   %edx,%edx
+  800840:	7e 22                	jle    800864 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800842:	ff 75 14             	push   0x14(%ebp)
+  800845:	ff 75 10             	push   0x10(%ebp)
+  800848:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  80084b:	50                   	push   %eax
+  80084c:	68 8f 03 80 00       	push   $0x80038f
+  800851:	e8 73 fb ff ff       	call   8003c9 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  800856:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800859:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  80085c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80085f:	83 c4 10             	add    $0x10,%esp
+}
+  800862:	c9                   	leave
+  800863:	c3                   	ret
+		return -E_INVAL;
+  800864:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800869:	eb f7                	jmp    800862 <vsnprintf+0x45>
+
+0080086b <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  80086b:	55                   	push   %ebp
+  80086c:	89 e5                	mov    %esp,%ebp
+  80086e:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  800871:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  800874:	50                   	push   %eax
+  800875:	ff 75 10             	push   0x10(%ebp)
+  800878:	ff 75 0c             	push   0xc(%ebp)
+  80087b:	ff 75 08             	push   0x8(%ebp)
+  80087e:	e8 9a ff ff ff       	call   80081d <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  800883:	c9                   	leave
+  800884:	c3                   	ret
+
+00800885 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800885:	55                   	push   %ebp
+  800886:	89 e5                	mov    %esp,%ebp
+  800888:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  80088b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800890:	eb 03                	jmp    800895 <strlen+0x10>
+		n++;
+  800892:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  800895:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800899:	75 f7                	jne    800892 <strlen+0xd>
+	return n;
+}
+  80089b:	5d                   	pop    %ebp
+  80089c:	c3                   	ret
+
+0080089d <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  80089d:	55                   	push   %ebp
+  80089e:	89 e5                	mov    %esp,%ebp
+  8008a0:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8008a3:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8008a6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008ab:	eb 03                	jmp    8008b0 <strnlen+0x13>
+		n++;
+  8008ad:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8008b0:	39 d0                	cmp    %edx,%eax
+  8008b2:	74 08                	je     8008bc <strnlen+0x1f>
+  8008b4:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  8008b8:	75 f3                	jne    8008ad <strnlen+0x10>
+  8008ba:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  8008bc:	89 d0                	mov    %edx,%eax
+  8008be:	5d                   	pop    %ebp
+  8008bf:	c3                   	ret
+
+008008c0 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  8008c0:	55                   	push   %ebp
+  8008c1:	89 e5                	mov    %esp,%ebp
+  8008c3:	53                   	push   %ebx
+  8008c4:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8008c7:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  8008ca:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008cf:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  8008d3:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  8008d6:	83 c0 01             	add    $0x1,%eax
+  8008d9:	84 d2                	test   %dl,%dl
+  8008db:	75 f2                	jne    8008cf <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  8008dd:	89 c8                	mov    %ecx,%eax
+  8008df:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8008e2:	c9                   	leave
+  8008e3:	c3                   	ret
+
+008008e4 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  8008e4:	55                   	push   %ebp
+  8008e5:	89 e5                	mov    %esp,%ebp
+  8008e7:	53                   	push   %ebx
+  8008e8:	83 ec 10             	sub    $0x10,%esp
+  8008eb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  8008ee:	53                   	push   %ebx
+  8008ef:	e8 91 ff ff ff       	call   800885 <strlen>
+  8008f4:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  8008f7:	ff 75 0c             	push   0xc(%ebp)
+  8008fa:	01 d8                	add    %ebx,%eax
+  8008fc:	50                   	push   %eax
+  8008fd:	e8 be ff ff ff       	call   8008c0 <strcpy>
+	return dst;
+}
+  800902:	89 d8                	mov    %ebx,%eax
+  800904:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800907:	c9                   	leave
+  800908:	c3                   	ret
+
+00800909 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800909:	55                   	push   %ebp
+  80090a:	89 e5                	mov    %esp,%ebp
+  80090c:	56                   	push   %esi
+  80090d:	53                   	push   %ebx
+  80090e:	8b 75 08             	mov    0x8(%ebp),%esi
+  800911:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800914:	89 f3                	mov    %esi,%ebx
+  800916:	03 5d 10             	add    0x10(%ebp),%ebx
+  800919:	89 f0                	mov    %esi,%eax
+  80091b:	eb 0f                	jmp    80092c <strncpy+0x23>
+		*dst++ = *src;
+  80091d:	83 c0 01             	add    $0x1,%eax
+  800920:	0f b6 0a             	movzbl (%edx),%ecx
+  800923:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800926:	80 f9 01             	cmp    $0x1,%cl
+  800929:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  80092c:	39 d8                	cmp    %ebx,%eax
+  80092e:	75 ed                	jne    80091d <strncpy+0x14>
+	}
+	return ret;
+}
+  800930:	89 f0                	mov    %esi,%eax
+  800932:	5b                   	pop    %ebx
+  800933:	5e                   	pop    %esi
+  800934:	5d                   	pop    %ebp
+  800935:	c3                   	ret
+
+00800936 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800936:	55                   	push   %ebp
+  800937:	89 e5                	mov    %esp,%ebp
+  800939:	56                   	push   %esi
+  80093a:	53                   	push   %ebx
+  80093b:	8b 75 08             	mov    0x8(%ebp),%esi
+  80093e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800941:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800944:	89 f0                	mov    %esi,%eax
+  800946:	85 d2                	test   %edx,%edx
+  800948:	74 21                	je     80096b <strlcpy+0x35>
+  80094a:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  80094e:	89 f2                	mov    %esi,%edx
+  800950:	eb 09                	jmp    80095b <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  800952:	83 c1 01             	add    $0x1,%ecx
+  800955:	83 c2 01             	add    $0x1,%edx
+  800958:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  80095b:	39 c2                	cmp    %eax,%edx
+  80095d:	74 09                	je     800968 <strlcpy+0x32>
+  80095f:	0f b6 19             	movzbl (%ecx),%ebx
+  800962:	84 db                	test   %bl,%bl
+  800964:	75 ec                	jne    800952 <strlcpy+0x1c>
+  800966:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  800968:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  80096b:	29 f0                	sub    %esi,%eax
+}
+  80096d:	5b                   	pop    %ebx
+  80096e:	5e                   	pop    %esi
+  80096f:	5d                   	pop    %ebp
+  800970:	c3                   	ret
+
+00800971 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800971:	55                   	push   %ebp
+  800972:	89 e5                	mov    %esp,%ebp
+  800974:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800977:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  80097a:	eb 06                	jmp    800982 <strcmp+0x11>
+		p++, q++;
+  80097c:	83 c1 01             	add    $0x1,%ecx
+  80097f:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800982:	0f b6 01             	movzbl (%ecx),%eax
+  800985:	84 c0                	test   %al,%al
+  800987:	74 04                	je     80098d <strcmp+0x1c>
+  800989:	3a 02                	cmp    (%edx),%al
+  80098b:	74 ef                	je     80097c <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  80098d:	0f b6 c0             	movzbl %al,%eax
+  800990:	0f b6 12             	movzbl (%edx),%edx
+  800993:	29 d0                	sub    %edx,%eax
+}
+  800995:	5d                   	pop    %ebp
+  800996:	c3                   	ret
+
+00800997 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800997:	55                   	push   %ebp
+  800998:	89 e5                	mov    %esp,%ebp
+  80099a:	53                   	push   %ebx
+  80099b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80099e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8009a1:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  8009a4:	eb 09                	jmp    8009af <strncmp+0x18>
+		n--, p++, q++;
+  8009a6:	83 ea 01             	sub    $0x1,%edx
+  8009a9:	83 c0 01             	add    $0x1,%eax
+  8009ac:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  8009af:	85 d2                	test   %edx,%edx
+  8009b1:	74 18                	je     8009cb <strncmp+0x34>
+  8009b3:	0f b6 18             	movzbl (%eax),%ebx
+  8009b6:	84 db                	test   %bl,%bl
+  8009b8:	74 04                	je     8009be <strncmp+0x27>
+  8009ba:	3a 19                	cmp    (%ecx),%bl
+  8009bc:	74 e8                	je     8009a6 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  8009be:	0f b6 00             	movzbl (%eax),%eax
+  8009c1:	0f b6 11             	movzbl (%ecx),%edx
+  8009c4:	29 d0                	sub    %edx,%eax
+}
+  8009c6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8009c9:	c9                   	leave
+  8009ca:	c3                   	ret
+		return 0;
+  8009cb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009d0:	eb f4                	jmp    8009c6 <strncmp+0x2f>
+
+008009d2 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  8009d2:	55                   	push   %ebp
+  8009d3:	89 e5                	mov    %esp,%ebp
+  8009d5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009d8:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  8009dc:	eb 03                	jmp    8009e1 <strchr+0xf>
+  8009de:	83 c0 01             	add    $0x1,%eax
+  8009e1:	0f b6 10             	movzbl (%eax),%edx
+  8009e4:	84 d2                	test   %dl,%dl
+  8009e6:	74 06                	je     8009ee <strchr+0x1c>
+		if (*s == c)
+  8009e8:	38 ca                	cmp    %cl,%dl
+  8009ea:	75 f2                	jne    8009de <strchr+0xc>
+  8009ec:	eb 05                	jmp    8009f3 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  8009ee:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8009f3:	5d                   	pop    %ebp
+  8009f4:	c3                   	ret
+
+008009f5 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  8009f5:	55                   	push   %ebp
+  8009f6:	89 e5                	mov    %esp,%ebp
+  8009f8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009fb:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  8009ff:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800a02:	38 ca                	cmp    %cl,%dl
+  800a04:	74 09                	je     800a0f <strfind+0x1a>
+  800a06:	84 d2                	test   %dl,%dl
+  800a08:	74 05                	je     800a0f <strfind+0x1a>
+	for (; *s; s++)
+  800a0a:	83 c0 01             	add    $0x1,%eax
+  800a0d:	eb f0                	jmp    8009ff <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  800a0f:	5d                   	pop    %ebp
+  800a10:	c3                   	ret
+
+00800a11 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800a11:	55                   	push   %ebp
+  800a12:	89 e5                	mov    %esp,%ebp
+  800a14:	57                   	push   %edi
+  800a15:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800a18:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800a1b:	85 c9                	test   %ecx,%ecx
+  800a1d:	74 20                	je     800a3f <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800a1f:	89 f8                	mov    %edi,%eax
+  800a21:	09 c8                	or     %ecx,%eax
+  800a23:	a8 03                	test   $0x3,%al
+  800a25:	75 12                	jne    800a39 <memset+0x28>
+		c &= 0xFF;
+  800a27:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800a2b:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800a31:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800a34:	fc                   	cld
+  800a35:	f3 ab                	rep stos %eax,%es:(%edi)
+  800a37:	eb 06                	jmp    800a3f <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800a39:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800a3c:	fc                   	cld
+  800a3d:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800a3f:	89 f8                	mov    %edi,%eax
+  800a41:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800a44:	c9                   	leave
+  800a45:	c3                   	ret
+
+00800a46 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800a46:	55                   	push   %ebp
+  800a47:	89 e5                	mov    %esp,%ebp
+  800a49:	57                   	push   %edi
+  800a4a:	56                   	push   %esi
+  800a4b:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a4e:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800a51:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800a54:	39 c6                	cmp    %eax,%esi
+  800a56:	73 32                	jae    800a8a <memmove+0x44>
+  800a58:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800a5b:	39 d0                	cmp    %edx,%eax
+  800a5d:	73 2b                	jae    800a8a <memmove+0x44>
+		s += n;
+		d += n;
+  800a5f:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800a62:	89 d6                	mov    %edx,%esi
+  800a64:	09 fe                	or     %edi,%esi
+  800a66:	09 ce                	or     %ecx,%esi
+  800a68:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800a6e:	75 0e                	jne    800a7e <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800a70:	83 ef 04             	sub    $0x4,%edi
+  800a73:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800a76:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800a79:	fd                   	std
+  800a7a:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800a7c:	eb 09                	jmp    800a87 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800a7e:	83 ef 01             	sub    $0x1,%edi
+  800a81:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800a84:	fd                   	std
+  800a85:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800a87:	fc                   	cld
+  800a88:	eb 1a                	jmp    800aa4 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800a8a:	89 f2                	mov    %esi,%edx
+  800a8c:	09 c2                	or     %eax,%edx
+  800a8e:	09 ca                	or     %ecx,%edx
+  800a90:	f6 c2 03             	test   $0x3,%dl
+  800a93:	75 0a                	jne    800a9f <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800a95:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800a98:	89 c7                	mov    %eax,%edi
+  800a9a:	fc                   	cld
+  800a9b:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800a9d:	eb 05                	jmp    800aa4 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800a9f:	89 c7                	mov    %eax,%edi
+  800aa1:	fc                   	cld
+  800aa2:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800aa4:	5e                   	pop    %esi
+  800aa5:	5f                   	pop    %edi
+  800aa6:	5d                   	pop    %ebp
+  800aa7:	c3                   	ret
+
+00800aa8 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800aa8:	55                   	push   %ebp
+  800aa9:	89 e5                	mov    %esp,%ebp
+  800aab:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800aae:	ff 75 10             	push   0x10(%ebp)
+  800ab1:	ff 75 0c             	push   0xc(%ebp)
+  800ab4:	ff 75 08             	push   0x8(%ebp)
+  800ab7:	e8 8a ff ff ff       	call   800a46 <memmove>
+}
+  800abc:	c9                   	leave
+  800abd:	c3                   	ret
+
+00800abe <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800abe:	55                   	push   %ebp
+  800abf:	89 e5                	mov    %esp,%ebp
+  800ac1:	56                   	push   %esi
+  800ac2:	53                   	push   %ebx
+  800ac3:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ac6:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800ac9:	89 c6                	mov    %eax,%esi
+  800acb:	03 75 10             	add    0x10(%ebp),%esi
+  800ace:	eb 06                	jmp    800ad6 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800ad0:	83 c0 01             	add    $0x1,%eax
+  800ad3:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800ad6:	39 f0                	cmp    %esi,%eax
+  800ad8:	74 14                	je     800aee <memcmp+0x30>
+		if (*s1 != *s2)
+  800ada:	0f b6 08             	movzbl (%eax),%ecx
+  800add:	0f b6 1a             	movzbl (%edx),%ebx
+  800ae0:	38 d9                	cmp    %bl,%cl
+  800ae2:	74 ec                	je     800ad0 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800ae4:	0f b6 c1             	movzbl %cl,%eax
+  800ae7:	0f b6 db             	movzbl %bl,%ebx
+  800aea:	29 d8                	sub    %ebx,%eax
+  800aec:	eb 05                	jmp    800af3 <memcmp+0x35>
+	}
+
+	return 0;
+  800aee:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800af3:	5b                   	pop    %ebx
+  800af4:	5e                   	pop    %esi
+  800af5:	5d                   	pop    %ebp
+  800af6:	c3                   	ret
+
+00800af7 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800af7:	55                   	push   %ebp
+  800af8:	89 e5                	mov    %esp,%ebp
+  800afa:	8b 45 08             	mov    0x8(%ebp),%eax
+  800afd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800b00:	89 c2                	mov    %eax,%edx
+  800b02:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800b05:	eb 03                	jmp    800b0a <memfind+0x13>
+  800b07:	83 c0 01             	add    $0x1,%eax
+  800b0a:	39 d0                	cmp    %edx,%eax
+  800b0c:	73 04                	jae    800b12 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800b0e:	38 08                	cmp    %cl,(%eax)
+  800b10:	75 f5                	jne    800b07 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800b12:	5d                   	pop    %ebp
+  800b13:	c3                   	ret
+
+00800b14 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800b14:	55                   	push   %ebp
+  800b15:	89 e5                	mov    %esp,%ebp
+  800b17:	57                   	push   %edi
+  800b18:	56                   	push   %esi
+  800b19:	53                   	push   %ebx
+  800b1a:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b1d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800b20:	eb 03                	jmp    800b25 <strtol+0x11>
+		s++;
+  800b22:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800b25:	0f b6 02             	movzbl (%edx),%eax
+  800b28:	3c 20                	cmp    $0x20,%al
+  800b2a:	74 f6                	je     800b22 <strtol+0xe>
+  800b2c:	3c 09                	cmp    $0x9,%al
+  800b2e:	74 f2                	je     800b22 <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  800b30:	3c 2b                	cmp    $0x2b,%al
+  800b32:	74 2a                	je     800b5e <strtol+0x4a>
+	int neg = 0;
+  800b34:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800b39:	3c 2d                	cmp    $0x2d,%al
+  800b3b:	74 2b                	je     800b68 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800b3d:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800b43:	75 0f                	jne    800b54 <strtol+0x40>
+  800b45:	80 3a 30             	cmpb   $0x30,(%edx)
+  800b48:	74 28                	je     800b72 <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800b4a:	85 db                	test   %ebx,%ebx
+  800b4c:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800b51:	0f 44 d8             	cmove  %eax,%ebx
+  800b54:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b59:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800b5c:	eb 46                	jmp    800ba4 <strtol+0x90>
+		s++;
+  800b5e:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800b61:	bf 00 00 00 00       	mov    $0x0,%edi
+  800b66:	eb d5                	jmp    800b3d <strtol+0x29>
+		s++, neg = 1;
+  800b68:	83 c2 01             	add    $0x1,%edx
+  800b6b:	bf 01 00 00 00       	mov    $0x1,%edi
+  800b70:	eb cb                	jmp    800b3d <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800b72:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800b76:	74 0e                	je     800b86 <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800b78:	85 db                	test   %ebx,%ebx
+  800b7a:	75 d8                	jne    800b54 <strtol+0x40>
+		s++, base = 8;
+  800b7c:	83 c2 01             	add    $0x1,%edx
+  800b7f:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800b84:	eb ce                	jmp    800b54 <strtol+0x40>
+		s += 2, base = 16;
+  800b86:	83 c2 02             	add    $0x2,%edx
+  800b89:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800b8e:	eb c4                	jmp    800b54 <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800b90:	0f be c0             	movsbl %al,%eax
+  800b93:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800b96:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800b99:	7d 3a                	jge    800bd5 <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800b9b:	83 c2 01             	add    $0x1,%edx
+  800b9e:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800ba2:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800ba4:	0f b6 02             	movzbl (%edx),%eax
+  800ba7:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800baa:	89 f3                	mov    %esi,%ebx
+  800bac:	80 fb 09             	cmp    $0x9,%bl
+  800baf:	76 df                	jbe    800b90 <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800bb1:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800bb4:	89 f3                	mov    %esi,%ebx
+  800bb6:	80 fb 19             	cmp    $0x19,%bl
+  800bb9:	77 08                	ja     800bc3 <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800bbb:	0f be c0             	movsbl %al,%eax
+  800bbe:	83 e8 57             	sub    $0x57,%eax
+  800bc1:	eb d3                	jmp    800b96 <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800bc3:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800bc6:	89 f3                	mov    %esi,%ebx
+  800bc8:	80 fb 19             	cmp    $0x19,%bl
+  800bcb:	77 08                	ja     800bd5 <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800bcd:	0f be c0             	movsbl %al,%eax
+  800bd0:	83 e8 37             	sub    $0x37,%eax
+  800bd3:	eb c1                	jmp    800b96 <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800bd5:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800bd9:	74 05                	je     800be0 <strtol+0xcc>
+		*endptr = (char *) s;
+  800bdb:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800bde:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800be0:	89 c8                	mov    %ecx,%eax
+  800be2:	f7 d8                	neg    %eax
+  800be4:	85 ff                	test   %edi,%edi
+  800be6:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800be9:	89 c8                	mov    %ecx,%eax
+  800beb:	5b                   	pop    %ebx
+  800bec:	5e                   	pop    %esi
+  800bed:	5f                   	pop    %edi
+  800bee:	5d                   	pop    %ebp
+  800bef:	c3                   	ret
+
+00800bf0 <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800bf0:	55                   	push   %ebp
+  800bf1:	89 e5                	mov    %esp,%ebp
+  800bf3:	57                   	push   %edi
+  800bf4:	56                   	push   %esi
+  800bf5:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800bf6:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bfb:	8b 55 08             	mov    0x8(%ebp),%edx
+  800bfe:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c01:	89 c3                	mov    %eax,%ebx
+  800c03:	89 c7                	mov    %eax,%edi
+  800c05:	55                   	push   %ebp
+  800c06:	89 e5                	mov    %esp,%ebp
+  800c08:	8d 35 10 0c 80 00    	lea    0x800c10,%esi
+  800c0e:	0f 34                	sysenter
+  800c10:	5d                   	pop    %ebp
+	syscall2(SYS_cputs, 0, (uint32_t)s, len, 0, 0);
+}
+  800c11:	5b                   	pop    %ebx
+  800c12:	5e                   	pop    %esi
+  800c13:	5f                   	pop    %edi
+  800c14:	5d                   	pop    %ebp
+  800c15:	c3                   	ret
+
+00800c16 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800c16:	55                   	push   %ebp
+  800c17:	89 e5                	mov    %esp,%ebp
+  800c19:	57                   	push   %edi
+  800c1a:	56                   	push   %esi
+  800c1b:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800c1c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c21:	b8 01 00 00 00       	mov    $0x1,%eax
+  800c26:	89 d1                	mov    %edx,%ecx
+  800c28:	89 d3                	mov    %edx,%ebx
+  800c2a:	89 d7                	mov    %edx,%edi
+  800c2c:	55                   	push   %ebp
+  800c2d:	89 e5                	mov    %esp,%ebp
+  800c2f:	8d 35 37 0c 80 00    	lea    0x800c37,%esi
+  800c35:	0f 34                	sysenter
+  800c37:	5d                   	pop    %ebp
+	return syscall2(SYS_cgetc, 0, 0, 0, 0, 0);
+}
+  800c38:	5b                   	pop    %ebx
+  800c39:	5e                   	pop    %esi
+  800c3a:	5f                   	pop    %edi
+  800c3b:	5d                   	pop    %ebp
+  800c3c:	c3                   	ret
+
+00800c3d <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800c3d:	55                   	push   %ebp
+  800c3e:	89 e5                	mov    %esp,%ebp
+  800c40:	57                   	push   %edi
+  800c41:	56                   	push   %esi
+  800c42:	53                   	push   %ebx
+  800c43:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800c46:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800c4b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c4e:	b8 03 00 00 00       	mov    $0x3,%eax
+  800c53:	89 cb                	mov    %ecx,%ebx
+  800c55:	89 cf                	mov    %ecx,%edi
+  800c57:	55                   	push   %ebp
+  800c58:	89 e5                	mov    %esp,%ebp
+  800c5a:	8d 35 62 0c 80 00    	lea    0x800c62,%esi
+  800c60:	0f 34                	sysenter
+  800c62:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800c63:	85 c0                	test   %eax,%eax
+  800c65:	7f 08                	jg     800c6f <sys_env_destroy+0x32>
+	return syscall2(SYS_env_destroy, 1, envid, 0, 0, 0);
+}
+  800c67:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c6a:	5b                   	pop    %ebx
+  800c6b:	5e                   	pop    %esi
+  800c6c:	5f                   	pop    %edi
+  800c6d:	5d                   	pop    %ebp
+  800c6e:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800c6f:	83 ec 0c             	sub    $0xc,%esp
+  800c72:	50                   	push   %eax
+  800c73:	6a 03                	push   $0x3
+  800c75:	68 07 44 80 00       	push   $0x804407
+  800c7a:	6a 3d                	push   $0x3d
+  800c7c:	68 24 44 80 00       	push   $0x804424
+  800c81:	e8 71 f5 ff ff       	call   8001f7 <_panic>
+
+00800c86 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800c86:	55                   	push   %ebp
+  800c87:	89 e5                	mov    %esp,%ebp
+  800c89:	57                   	push   %edi
+  800c8a:	56                   	push   %esi
+  800c8b:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800c8c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c91:	b8 02 00 00 00       	mov    $0x2,%eax
+  800c96:	89 d1                	mov    %edx,%ecx
+  800c98:	89 d3                	mov    %edx,%ebx
+  800c9a:	89 d7                	mov    %edx,%edi
+  800c9c:	55                   	push   %ebp
+  800c9d:	89 e5                	mov    %esp,%ebp
+  800c9f:	8d 35 a7 0c 80 00    	lea    0x800ca7,%esi
+  800ca5:	0f 34                	sysenter
+  800ca7:	5d                   	pop    %ebp
+	 return syscall2(SYS_getenvid, 0, 0, 0, 0, 0);
+}
+  800ca8:	5b                   	pop    %ebx
+  800ca9:	5e                   	pop    %esi
+  800caa:	5f                   	pop    %edi
+  800cab:	5d                   	pop    %ebp
+  800cac:	c3                   	ret
+
+00800cad <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800cad:	55                   	push   %ebp
+  800cae:	89 e5                	mov    %esp,%ebp
+  800cb0:	57                   	push   %edi
+  800cb1:	56                   	push   %esi
+  800cb2:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800cb3:	ba 00 00 00 00       	mov    $0x0,%edx
+  800cb8:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800cbd:	89 d1                	mov    %edx,%ecx
+  800cbf:	89 d3                	mov    %edx,%ebx
+  800cc1:	89 d7                	mov    %edx,%edi
+  800cc3:	89 d6                	mov    %edx,%esi
+  800cc5:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800cc7:	5b                   	pop    %ebx
+  800cc8:	5e                   	pop    %esi
+  800cc9:	5f                   	pop    %edi
+  800cca:	5d                   	pop    %ebp
+  800ccb:	c3                   	ret
+
+00800ccc <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800ccc:	55                   	push   %ebp
+  800ccd:	89 e5                	mov    %esp,%ebp
+  800ccf:	57                   	push   %edi
+  800cd0:	56                   	push   %esi
+  800cd1:	53                   	push   %ebx
+  800cd2:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800cd5:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cd8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800cdb:	b8 04 00 00 00       	mov    $0x4,%eax
+  800ce0:	bf 00 00 00 00       	mov    $0x0,%edi
+  800ce5:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800ce8:	55                   	push   %ebp
+  800ce9:	89 e5                	mov    %esp,%ebp
+  800ceb:	8d 35 f3 0c 80 00    	lea    0x800cf3,%esi
+  800cf1:	0f 34                	sysenter
+  800cf3:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800cf4:	85 c0                	test   %eax,%eax
+  800cf6:	7f 08                	jg     800d00 <sys_page_alloc+0x34>
+	return syscall2(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0);
+}
+  800cf8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800cfb:	5b                   	pop    %ebx
+  800cfc:	5e                   	pop    %esi
+  800cfd:	5f                   	pop    %edi
+  800cfe:	5d                   	pop    %ebp
+  800cff:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d00:	83 ec 0c             	sub    $0xc,%esp
+  800d03:	50                   	push   %eax
+  800d04:	6a 04                	push   $0x4
+  800d06:	68 07 44 80 00       	push   $0x804407
+  800d0b:	6a 3d                	push   $0x3d
+  800d0d:	68 24 44 80 00       	push   $0x804424
+  800d12:	e8 e0 f4 ff ff       	call   8001f7 <_panic>
+
+00800d17 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800d17:	55                   	push   %ebp
+  800d18:	89 e5                	mov    %esp,%ebp
+  800d1a:	57                   	push   %edi
+  800d1b:	56                   	push   %esi
+  800d1c:	53                   	push   %ebx
+  800d1d:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800d20:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d23:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d26:	b8 05 00 00 00       	mov    $0x5,%eax
+  800d2b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d2e:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800d31:	8b 75 18             	mov    0x18(%ebp),%esi
+  800d34:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800d36:	85 c0                	test   %eax,%eax
+  800d38:	7f 08                	jg     800d42 <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800d3a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d3d:	5b                   	pop    %ebx
+  800d3e:	5e                   	pop    %esi
+  800d3f:	5f                   	pop    %edi
+  800d40:	5d                   	pop    %ebp
+  800d41:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d42:	83 ec 0c             	sub    $0xc,%esp
+  800d45:	50                   	push   %eax
+  800d46:	6a 05                	push   $0x5
+  800d48:	68 07 44 80 00       	push   $0x804407
+  800d4d:	6a 23                	push   $0x23
+  800d4f:	68 24 44 80 00       	push   $0x804424
+  800d54:	e8 9e f4 ff ff       	call   8001f7 <_panic>
+
+00800d59 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800d59:	55                   	push   %ebp
+  800d5a:	89 e5                	mov    %esp,%ebp
+  800d5c:	57                   	push   %edi
+  800d5d:	56                   	push   %esi
+  800d5e:	53                   	push   %ebx
+  800d5f:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800d62:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800d67:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d6a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d6d:	b8 06 00 00 00       	mov    $0x6,%eax
+  800d72:	89 df                	mov    %ebx,%edi
+  800d74:	55                   	push   %ebp
+  800d75:	89 e5                	mov    %esp,%ebp
+  800d77:	8d 35 7f 0d 80 00    	lea    0x800d7f,%esi
+  800d7d:	0f 34                	sysenter
+  800d7f:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800d80:	85 c0                	test   %eax,%eax
+  800d82:	7f 08                	jg     800d8c <sys_page_unmap+0x33>
+	return syscall2(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0);
+}
+  800d84:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d87:	5b                   	pop    %ebx
+  800d88:	5e                   	pop    %esi
+  800d89:	5f                   	pop    %edi
+  800d8a:	5d                   	pop    %ebp
+  800d8b:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d8c:	83 ec 0c             	sub    $0xc,%esp
+  800d8f:	50                   	push   %eax
+  800d90:	6a 06                	push   $0x6
+  800d92:	68 07 44 80 00       	push   $0x804407
+  800d97:	6a 3d                	push   $0x3d
+  800d99:	68 24 44 80 00       	push   $0x804424
+  800d9e:	e8 54 f4 ff ff       	call   8001f7 <_panic>
+
+00800da3 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800da3:	55                   	push   %ebp
+  800da4:	89 e5                	mov    %esp,%ebp
+  800da6:	57                   	push   %edi
+  800da7:	56                   	push   %esi
+  800da8:	53                   	push   %ebx
+  800da9:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800dac:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800db1:	8b 55 08             	mov    0x8(%ebp),%edx
+  800db4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800db7:	b8 08 00 00 00       	mov    $0x8,%eax
+  800dbc:	89 df                	mov    %ebx,%edi
+  800dbe:	55                   	push   %ebp
+  800dbf:	89 e5                	mov    %esp,%ebp
+  800dc1:	8d 35 c9 0d 80 00    	lea    0x800dc9,%esi
+  800dc7:	0f 34                	sysenter
+  800dc9:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800dca:	85 c0                	test   %eax,%eax
+  800dcc:	7f 08                	jg     800dd6 <sys_env_set_status+0x33>
+	return syscall2(SYS_env_set_status, 1, envid, status, 0, 0);
+}
+  800dce:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800dd1:	5b                   	pop    %ebx
+  800dd2:	5e                   	pop    %esi
+  800dd3:	5f                   	pop    %edi
+  800dd4:	5d                   	pop    %ebp
+  800dd5:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800dd6:	83 ec 0c             	sub    $0xc,%esp
+  800dd9:	50                   	push   %eax
+  800dda:	6a 08                	push   $0x8
+  800ddc:	68 07 44 80 00       	push   $0x804407
+  800de1:	6a 3d                	push   $0x3d
+  800de3:	68 24 44 80 00       	push   $0x804424
+  800de8:	e8 0a f4 ff ff       	call   8001f7 <_panic>
+
+00800ded <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  800ded:	55                   	push   %ebp
+  800dee:	89 e5                	mov    %esp,%ebp
+  800df0:	57                   	push   %edi
+  800df1:	56                   	push   %esi
+  800df2:	53                   	push   %ebx
+  800df3:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800df6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800dfb:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dfe:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e01:	b8 09 00 00 00       	mov    $0x9,%eax
+  800e06:	89 df                	mov    %ebx,%edi
+  800e08:	55                   	push   %ebp
+  800e09:	89 e5                	mov    %esp,%ebp
+  800e0b:	8d 35 13 0e 80 00    	lea    0x800e13,%esi
+  800e11:	0f 34                	sysenter
+  800e13:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800e14:	85 c0                	test   %eax,%eax
+  800e16:	7f 08                	jg     800e20 <sys_env_set_trapframe+0x33>
+	return syscall2(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0);
+}
+  800e18:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e1b:	5b                   	pop    %ebx
+  800e1c:	5e                   	pop    %esi
+  800e1d:	5f                   	pop    %edi
+  800e1e:	5d                   	pop    %ebp
+  800e1f:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e20:	83 ec 0c             	sub    $0xc,%esp
+  800e23:	50                   	push   %eax
+  800e24:	6a 09                	push   $0x9
+  800e26:	68 07 44 80 00       	push   $0x804407
+  800e2b:	6a 3d                	push   $0x3d
+  800e2d:	68 24 44 80 00       	push   $0x804424
+  800e32:	e8 c0 f3 ff ff       	call   8001f7 <_panic>
+
+00800e37 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  800e37:	55                   	push   %ebp
+  800e38:	89 e5                	mov    %esp,%ebp
+  800e3a:	57                   	push   %edi
+  800e3b:	56                   	push   %esi
+  800e3c:	53                   	push   %ebx
+  800e3d:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800e40:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e45:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e48:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e4b:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800e50:	89 df                	mov    %ebx,%edi
+  800e52:	55                   	push   %ebp
+  800e53:	89 e5                	mov    %esp,%ebp
+  800e55:	8d 35 5d 0e 80 00    	lea    0x800e5d,%esi
+  800e5b:	0f 34                	sysenter
+  800e5d:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800e5e:	85 c0                	test   %eax,%eax
+  800e60:	7f 08                	jg     800e6a <sys_env_set_pgfault_upcall+0x33>
+	return syscall2(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0);
+}
+  800e62:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e65:	5b                   	pop    %ebx
+  800e66:	5e                   	pop    %esi
+  800e67:	5f                   	pop    %edi
+  800e68:	5d                   	pop    %ebp
+  800e69:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e6a:	83 ec 0c             	sub    $0xc,%esp
+  800e6d:	50                   	push   %eax
+  800e6e:	6a 0a                	push   $0xa
+  800e70:	68 07 44 80 00       	push   $0x804407
+  800e75:	6a 3d                	push   $0x3d
+  800e77:	68 24 44 80 00       	push   $0x804424
+  800e7c:	e8 76 f3 ff ff       	call   8001f7 <_panic>
+
+00800e81 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  800e81:	55                   	push   %ebp
+  800e82:	89 e5                	mov    %esp,%ebp
+  800e84:	57                   	push   %edi
+  800e85:	56                   	push   %esi
+  800e86:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800e87:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e8a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e8d:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800e92:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e95:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800e98:	55                   	push   %ebp
+  800e99:	89 e5                	mov    %esp,%ebp
+  800e9b:	8d 35 a3 0e 80 00    	lea    0x800ea3,%esi
+  800ea1:	0f 34                	sysenter
+  800ea3:	5d                   	pop    %ebp
+	return syscall2(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm);
+}
+  800ea4:	5b                   	pop    %ebx
+  800ea5:	5e                   	pop    %esi
+  800ea6:	5f                   	pop    %edi
+  800ea7:	5d                   	pop    %ebp
+  800ea8:	c3                   	ret
+
+00800ea9 <sys_ipc_try_sendv>:
+
+int
+sys_ipc_try_sendv(envid_t envid, uint32_t value, const uintptr_t *pages, int npages)
+{
+  800ea9:	55                   	push   %ebp
+  800eaa:	89 e5                	mov    %esp,%ebp
+  800eac:	57                   	push   %edi
+  800ead:	56                   	push   %esi
+  800eae:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800eaf:	8b 55 08             	mov    0x8(%ebp),%edx
+  800eb2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800eb5:	b8 17 00 00 00       	mov    $0x17,%eax
+  800eba:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800ebd:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800ec0:	55                   	push   %ebp
+  800ec1:	89 e5                	mov    %esp,%ebp
+  800ec3:	8d 35 cb 0e 80 00    	lea    0x800ecb,%esi
+  800ec9:	0f 34                	sysenter
+  800ecb:	5d                   	pop    %ebp
+	return syscall2(SYS_ipc_try_sendv, 0, envid, value, (uint32_t) pages, npages);
+}
+  800ecc:	5b                   	pop    %ebx
+  800ecd:	5e                   	pop    %esi
+  800ece:	5f                   	pop    %edi
+  800ecf:	5d                   	pop    %ebp
+  800ed0:	c3                   	ret
+
+00800ed1 <sys_ipc_recvv>:
+	return sys_ipc_recvv(dstva, 1, 0);
+}
+
+int
+sys_ipc_recvv(void *dstva, int npages, int flags)
+{
+  800ed1:	55                   	push   %ebp
+  800ed2:	89 e5                	mov    %esp,%ebp
+  800ed4:	57                   	push   %edi
+  800ed5:	56                   	push   %esi
+  800ed6:	53                   	push   %ebx
+  800ed7:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800eda:	be 00 00 00 00       	mov    $0x0,%esi
+  800edf:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ee2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ee5:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800eea:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800eed:	89 f7                	mov    %esi,%edi
+  800eef:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800ef1:	85 c0                	test   %eax,%eax
+  800ef3:	7f 08                	jg     800efd <sys_ipc_recvv+0x2c>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npages, flags, 0, 0);
+}
+  800ef5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ef8:	5b                   	pop    %ebx
+  800ef9:	5e                   	pop    %esi
+  800efa:	5f                   	pop    %edi
+  800efb:	5d                   	pop    %ebp
+  800efc:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800efd:	83 ec 0c             	sub    $0xc,%esp
+  800f00:	50                   	push   %eax
+  800f01:	6a 0d                	push   $0xd
+  800f03:	68 07 44 80 00       	push   $0x804407
+  800f08:	6a 23                	push   $0x23
+  800f0a:	68 24 44 80 00       	push   $0x804424
+  800f0f:	e8 e3 f2 ff ff       	call   8001f7 <_panic>
+
+00800f14 <sys_ipc_recv>:
+{
+  800f14:	55                   	push   %ebp
+  800f15:	89 e5                	mov    %esp,%ebp
+  800f17:	83 ec 0c             	sub    $0xc,%esp
+	return sys_ipc_recvv(dstva, 1, 0);
+  800f1a:	6a 00                	push   $0x0
+  800f1c:	6a 01                	push   $0x1
+  800f1e:	ff 75 08             	push   0x8(%ebp)
+  800f21:	e8 ab ff ff ff       	call   800ed1 <sys_ipc_recvv>
+}
+  800f26:	c9                   	leave
+  800f27:	c3                   	ret
+
+00800f28 <sys_ipc_recv_until>:
+
+int
+sys_ipc_recv_until(void *dstva, int npages, unsigned int deadline)
+{
+  800f28:	55                   	push   %ebp
+  800f29:	89 e5                	mov    %esp,%ebp
+  800f2b:	57                   	push   %edi
+  800f2c:	56                   	push   %esi
+  800f2d:	53                   	push   %ebx
+  800f2e:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800f31:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f36:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f39:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f3c:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800f41:	8b 7d 10             	mov    0x10(%ebp),%edi
+  800f44:	89 de                	mov    %ebx,%esi
+  800f46:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800f48:	85 c0                	test   %eax,%eax
+  800f4a:	7f 08                	jg     800f54 <sys_ipc_recv_until+0x2c>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npages, 0, deadline, 0);
+}
+  800f4c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f4f:	5b                   	pop    %ebx
+  800f50:	5e                   	pop    %esi
+  800f51:	5f                   	pop    %edi
+  800f52:	5d                   	pop    %ebp
+  800f53:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f54:	83 ec 0c             	sub    $0xc,%esp
+  800f57:	50                   	push   %eax
+  800f58:	6a 0d                	push   $0xd
+  800f5a:	68 07 44 80 00       	push   $0x804407
+  800f5f:	6a 23                	push   $0x23
+  800f61:	68 24 44 80 00       	push   $0x804424
+  800f66:	e8 8c f2 ff ff       	call   8001f7 <_panic>
+
+00800f6b <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  800f6b:	55                   	push   %ebp
+  800f6c:	89 e5                	mov    %esp,%ebp
+  800f6e:	57                   	push   %edi
+  800f6f:	56                   	push   %esi
+  800f70:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800f71:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f76:	b8 0e 00 00 00       	mov    $0xe,%eax
+  800f7b:	89 d1                	mov    %edx,%ecx
+  800f7d:	89 d3                	mov    %edx,%ebx
+  800f7f:	89 d7                	mov    %edx,%edi
+  800f81:	55                   	push   %ebp
+  800f82:	89 e5                	mov    %esp,%ebp
+  800f84:	8d 35 8c 0f 80 00    	lea    0x800f8c,%esi
+  800f8a:	0f 34                	sysenter
+  800f8c:	5d                   	pop    %ebp
+	return (unsigned int) syscall2(SYS_time_msec, 0, 0, 0, 0, 0);
+}
+  800f8d:	5b                   	pop    %ebx
+  800f8e:	5e                   	pop    %esi
+  800f8f:	5f                   	pop    %edi
+  800f90:	5d                   	pop    %ebp
+  800f91:	c3                   	ret
+
+00800f92 <sys_net_try_send>:
+
+size_t
+sys_net_try_send(void *packet, size_t length)
+{
+  800f92:	55                   	push   %ebp
+  800f93:	89 e5                	mov    %esp,%ebp
+  800f95:	57                   	push   %edi
+  800f96:	56                   	push   %esi
+  800f97:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800f98:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f9d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fa0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fa3:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800fa8:	89 df                	mov    %ebx,%edi
+  800faa:	55                   	push   %ebp
+  800fab:	89 e5                	mov    %esp,%ebp
+  800fad:	8d 35 b5 0f 80 00    	lea    0x800fb5,%esi
+  800fb3:	0f 34                	sysenter
+  800fb5:	5d                   	pop    %ebp
+	return syscall2(SYS_net_try_send, 0, (uint32_t) packet, length, 0, 0);
+}
+  800fb6:	5b                   	pop    %ebx
+  800fb7:	5e                   	pop    %esi
+  800fb8:	5f                   	pop    %edi
+  800fb9:	5d                   	pop    %ebp
+  800fba:	c3                   	ret
+
+00800fbb <sys_net_try_recv>:
+
+size_t
+sys_net_try_recv(uint8_t *buffer)
+{
+  800fbb:	55                   	push   %ebp
+  800fbc:	89 e5                	mov    %esp,%ebp
+  800fbe:	57                   	push   %edi
+  800fbf:	56                   	push   %esi
+  800fc0:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800fc1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800fc6:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fc9:	b8 10 00 00 00       	mov    $0x10,%eax
+  800fce:	89 cb                	mov    %ecx,%ebx
+  800fd0:	89 cf                	mov    %ecx,%edi
+  800fd2:	55                   	push   %ebp
+  800fd3:	89 e5                	mov    %esp,%ebp
+  800fd5:	8d 35 dd 0f 80 00    	lea    0x800fdd,%esi
+  800fdb:	0f 34                	sysenter
+  800fdd:	5d                   	pop    %ebp
+	return syscall2(SYS_net_try_recv, 0, (uint32_t) buffer, 0, 0, 0);
+}
+  800fde:	5b                   	pop    %ebx
+  800fdf:	5e                   	pop    %esi
+  800fe0:	5f                   	pop    %edi
+  800fe1:	5d                   	pop    %ebp
+  800fe2:	c3                   	ret
+
+00800fe3 <sys_net_recv_pages>:
+
+int
+sys_net_recv_pages(void *dstva, int npages)
+{
+  800fe3:	55                   	push   %ebp
+  800fe4:	89 e5                	mov    %esp,%ebp
+  800fe6:	57                   	push   %edi
+  800fe7:	56                   	push   %esi
+  800fe8:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800fe9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fee:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ff1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ff4:	b8 12 00 00 00       	mov    $0x12,%eax
+  800ff9:	89 df                	mov    %ebx,%edi
+  800ffb:	55                   	push   %ebp
+  800ffc:	89 e5                	mov    %esp,%ebp
+  800ffe:	8d 35 06 10 80 00    	lea    0x801006,%esi
+  801004:	0f 34                	sysenter
+  801006:	5d                   	pop    %ebp
+	return syscall2(SYS_net_recv_pages, 0, (uint32_t) dstva, npages, 0, 0);
+}
+  801007:	5b                   	pop    %ebx
+  801008:	5e                   	pop    %esi
+  801009:	5f                   	pop    %edi
+  80100a:	5d                   	pop    %ebp
+  80100b:	c3                   	ret
+
+0080100c <sys_net_send_batch>:
+
+int
+sys_net_send_batch(const struct net_sg *pkts, int n)
+{
+  80100c:	55                   	push   %ebp
+  80100d:	89 e5                	mov    %esp,%ebp
+  80100f:	57                   	push   %edi
+  801010:	56                   	push   %esi
+  801011:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  801012:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801017:	8b 55 08             	mov    0x8(%ebp),%edx
+  80101a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80101d:	b8 14 00 00 00       	mov    $0x14,%eax
+  801022:	89 df                	mov    %ebx,%edi
+  801024:	55                   	push   %ebp
+  801025:	89 e5                	mov    %esp,%ebp
+  801027:	8d 35 2f 10 80 00    	lea    0x80102f,%esi
+  80102d:	0f 34                	sysenter
+  80102f:	5d                   	pop    %ebp
+	return syscall2(SYS_net_send_batch, 0, (uint32_t) pkts, n, 0, 0);
+}
+  801030:	5b                   	pop    %ebx
+  801031:	5e                   	pop    %esi
+  801032:	5f                   	pop    %edi
+  801033:	5d                   	pop    %ebp
+  801034:	c3                   	ret
+
+00801035 <sys_net_send_sg>:
+
+int
+sys_net_send_sg(const struct net_sg *sg, int nsg,
+		const struct net_offload *off, struct net_txinfo *info)
+{
+  801035:	55                   	push   %ebp
+  801036:	89 e5                	mov    %esp,%ebp
+  801038:	57                   	push   %edi
+  801039:	56                   	push   %esi
+  80103a:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  80103b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80103e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801041:	b8 13 00 00 00       	mov    $0x13,%eax
+  801046:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801049:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80104c:	55                   	push   %ebp
+  80104d:	89 e5                	mov    %esp,%ebp
+  80104f:	8d 35 57 10 80 00    	lea    0x801057,%esi
+  801055:	0f 34                	sysenter
+  801057:	5d                   	pop    %ebp
+	return syscall2(SYS_net_send_sg, 0, (uint32_t) sg, nsg, (uint32_t) off,
+			(uint32_t) info);
+}
+  801058:	5b                   	pop    %ebx
+  801059:	5e                   	pop    %esi
+  80105a:	5f                   	pop    %edi
+  80105b:	5d                   	pop    %ebp
+  80105c:	c3                   	ret
+
+0080105d <sys_net_wait>:
+
+int
+sys_net_wait(uint32_t events)
+{
+  80105d:	55                   	push   %ebp
+  80105e:	89 e5                	mov    %esp,%ebp
+  801060:	57                   	push   %edi
+  801061:	56                   	push   %esi
+  801062:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801063:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801068:	8b 55 08             	mov    0x8(%ebp),%edx
+  80106b:	b8 11 00 00 00       	mov    $0x11,%eax
+  801070:	89 cb                	mov    %ecx,%ebx
+  801072:	89 cf                	mov    %ecx,%edi
+  801074:	89 ce                	mov    %ecx,%esi
+  801076:	cd 30                	int    $0x30
+	// Blocks, so it has to go through the trap gate.
+	return syscall(SYS_net_wait, 0, events, 0, 0, 0, 0);
+}
+  801078:	5b                   	pop    %ebx
+  801079:	5e                   	pop    %esi
+  80107a:	5f                   	pop    %edi
+  80107b:	5d                   	pop    %ebp
+  80107c:	c3                   	ret
+
+0080107d <sys_net_map>:
+
+int
+sys_net_map(void *va)
+{
+  80107d:	55                   	push   %ebp
+  80107e:	89 e5                	mov    %esp,%ebp
+  801080:	57                   	push   %edi
+  801081:	56                   	push   %esi
+  801082:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  801083:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801088:	8b 55 08             	mov    0x8(%ebp),%edx
+  80108b:	b8 15 00 00 00       	mov    $0x15,%eax
+  801090:	89 cb                	mov    %ecx,%ebx
+  801092:	89 cf                	mov    %ecx,%edi
+  801094:	55                   	push   %ebp
+  801095:	89 e5                	mov    %esp,%ebp
+  801097:	8d 35 9f 10 80 00    	lea    0x80109f,%esi
+  80109d:	0f 34                	sysenter
+  80109f:	5d                   	pop    %ebp
+	return syscall2(SYS_net_map, 0, (uint32_t) va, 0, 0, 0);
+}
+  8010a0:	5b                   	pop    %ebx
+  8010a1:	5e                   	pop    %esi
+  8010a2:	5f                   	pop    %edi
+  8010a3:	5d                   	pop    %ebp
+  8010a4:	c3                   	ret
+
+008010a5 <sys_net_sync>:
+
+int
+sys_net_sync(uint32_t rings)
+{
+  8010a5:	55                   	push   %ebp
+  8010a6:	89 e5                	mov    %esp,%ebp
+  8010a8:	57                   	push   %edi
+  8010a9:	56                   	push   %esi
+  8010aa:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  8010ab:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8010b0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010b3:	b8 16 00 00 00       	mov    $0x16,%eax
+  8010b8:	89 cb                	mov    %ecx,%ebx
+  8010ba:	89 cf                	mov    %ecx,%edi
+  8010bc:	55                   	push   %ebp
+  8010bd:	89 e5                	mov    %esp,%ebp
+  8010bf:	8d 35 c7 10 80 00    	lea    0x8010c7,%esi
+  8010c5:	0f 34                	sysenter
+  8010c7:	5d                   	pop    %ebp
+	return syscall2(SYS_net_sync, 0, rings, 0, 0, 0);
+}
+  8010c8:	5b                   	pop    %ebx
+  8010c9:	5e                   	pop    %esi
+  8010ca:	5f                   	pop    %edi
+  8010cb:	5d                   	pop    %ebp
+  8010cc:	c3                   	ret
+
+008010cd <copy_page_to>:
+// The handler cowpage found installed, which gets the faults that are
+// not copy-on-write faults.
+static void (*pgfault_next)(struct UTrapframe *utf);
+
+static int copy_page_to(envid_t envid, void *va, int perm)
+{
+  8010cd:	55                   	push   %ebp
+  8010ce:	89 e5                	mov    %esp,%ebp
+  8010d0:	57                   	push   %edi
+  8010d1:	56                   	push   %esi
+  8010d2:	53                   	push   %ebx
+  8010d3:	83 ec 20             	sub    $0x20,%esp
+  8010d6:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8010d9:	89 d7                	mov    %edx,%edi
+  8010db:	89 ce                	mov    %ecx,%esi
+	int r;
+
+	r = sys_page_alloc(0, (void *) PFTEMP, perm);
+  8010dd:	51                   	push   %ecx
+  8010de:	68 00 f0 7f 00       	push   $0x7ff000
+  8010e3:	6a 00                	push   $0x0
+  8010e5:	e8 e2 fb ff ff       	call   800ccc <sys_page_alloc>
+  8010ea:	89 c3                	mov    %eax,%ebx
+	if (r < 0)
+  8010ec:	83 c4 10             	add    $0x10,%esp
+  8010ef:	85 c0                	test   %eax,%eax
+  8010f1:	78 45                	js     801138 <copy_page_to+0x6b>
+		goto exit;
+	memmove((void *) PFTEMP, va, PGSIZE);
+  8010f3:	83 ec 04             	sub    $0x4,%esp
+  8010f6:	68 00 10 00 00       	push   $0x1000
+  8010fb:	57                   	push   %edi
+  8010fc:	68 00 f0 7f 00       	push   $0x7ff000
+  801101:	e8 40 f9 ff ff       	call   800a46 <memmove>
+	r = sys_page_map(0, (void *) PFTEMP, envid, va, perm);
+  801106:	89 34 24             	mov    %esi,(%esp)
+  801109:	57                   	push   %edi
+  80110a:	ff 75 e4             	push   -0x1c(%ebp)
+  80110d:	68 00 f0 7f 00       	push   $0x7ff000
+  801112:	6a 00                	push   $0x0
+  801114:	e8 fe fb ff ff       	call   800d17 <sys_page_map>
+  801119:	89 c3                	mov    %eax,%ebx
+	if (r < 0)
+  80111b:	83 c4 20             	add    $0x20,%esp
+  80111e:	85 c0                	test   %eax,%eax
+  801120:	78 16                	js     801138 <copy_page_to+0x6b>
+		goto exit;
+	assert(!sys_page_unmap(0, (void *) PFTEMP));
+  801122:	83 ec 08             	sub    $0x8,%esp
+  801125:	68 00 f0 7f 00       	push   $0x7ff000
+  80112a:	6a 00                	push   $0x0
+  80112c:	e8 28 fc ff ff       	call   800d59 <sys_page_unmap>
+  801131:	83 c4 10             	add    $0x10,%esp
+  801134:	85 c0                	test   %eax,%eax
+  801136:	75 0a                	jne    801142 <copy_page_to+0x75>
+exit:
+	return r;
+}
+  801138:	89 d8                	mov    %ebx,%eax
+  80113a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80113d:	5b                   	pop    %ebx
+  80113e:	5e                   	pop    %esi
+  80113f:	5f                   	pop    %edi
+  801140:	5d                   	pop    %ebp
+  801141:	c3                   	ret
+	assert(!sys_page_unmap(0, (void *) PFTEMP));
+  801142:	68 34 44 80 00       	push   $0x804434
+  801147:	68 ac 44 80 00       	push   $0x8044ac
+  80114c:	6a 1b                	push   $0x1b
+  80114e:	68 c1 44 80 00       	push   $0x8044c1
+  801153:	e8 9f f0 ff ff       	call   8001f7 <_panic>
+
+00801158 <pgfault>:
+// map in our own private writable copy.  Other faults go to the handler
+// cowpage replaced, if any.
+//
+static void
+pgfault(struct UTrapframe *utf)
+{
+  801158:	55                   	push   %ebp
+  801159:	89 e5                	mov    %esp,%ebp
+  80115b:	53                   	push   %ebx
+  80115c:	83 ec 04             	sub    $0x4,%esp
+  80115f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	void *addr = (void *) utf->utf_fault_va;
+  801162:	8b 13                	mov    (%ebx),%edx
+	// Hint:
+	//   Use the read-only page table mappings at uvpt
+	//   (see <inc/memlayout.h>).
+
+	// LAB 4: Your code here.
+	if (!(err & FEC_WR) || !(uvpd[PDX(addr)] & PTE_P)
+  801164:	f6 43 04 02          	testb  $0x2,0x4(%ebx)
+  801168:	74 21                	je     80118b <pgfault+0x33>
+  80116a:	89 d0                	mov    %edx,%eax
+  80116c:	c1 e8 16             	shr    $0x16,%eax
+  80116f:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801176:	a8 01                	test   $0x1,%al
+  801178:	74 11                	je     80118b <pgfault+0x33>
+	    || !(uvpt[PGNUM(addr)] & PTE_COW)) {
+  80117a:	89 d0                	mov    %edx,%eax
+  80117c:	c1 e8 0c             	shr    $0xc,%eax
+  80117f:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801186:	f6 c4 08             	test   $0x8,%ah
+  801189:	75 17                	jne    8011a2 <pgfault+0x4a>
+		if (pgfault_next) {
+  80118b:	a1 04 60 80 00       	mov    0x806004,%eax
+  801190:	85 c0                	test   %eax,%eax
+  801192:	74 27                	je     8011bb <pgfault+0x63>
+			pgfault_next(utf);
+  801194:	83 ec 0c             	sub    $0xc,%esp
+  801197:	53                   	push   %ebx
+  801198:	ff d0                	call   *%eax
+			return;
+  80119a:	83 c4 10             	add    $0x10,%esp
+exit:
+	cprintf("[%08x] pgfault: Can't handle page fault happened at"
+		"0x%08x, eip: 0x%08x. Exiting...\n", thisenv->env_id,
+		utf->utf_fault_va, utf->utf_eip);
+	sys_env_destroy(0);
+}
+  80119d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8011a0:	c9                   	leave
+  8011a1:	c3                   	ret
+	if (copy_page_to(0, ROUNDDOWN(addr, PGSIZE), PTE_U | PTE_W | PTE_P) < 0)
+  8011a2:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+  8011a8:	b9 07 00 00 00       	mov    $0x7,%ecx
+  8011ad:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011b2:	e8 16 ff ff ff       	call   8010cd <copy_page_to>
+  8011b7:	85 c0                	test   %eax,%eax
+  8011b9:	79 e2                	jns    80119d <pgfault+0x45>
+		"0x%08x, eip: 0x%08x. Exiting...\n", thisenv->env_id,
+  8011bb:	a1 00 60 80 00       	mov    0x806000,%eax
+  8011c0:	8b 40 48             	mov    0x48(%eax),%eax
+	cprintf("[%08x] pgfault: Can't handle page fault happened at"
+  8011c3:	ff 73 28             	push   0x28(%ebx)
+  8011c6:	ff 33                	push   (%ebx)
+  8011c8:	50                   	push   %eax
+  8011c9:	68 58 44 80 00       	push   $0x804458
+  8011ce:	e8 ff f0 ff ff       	call   8002d2 <cprintf>
+	sys_env_destroy(0);
+  8011d3:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  8011da:	e8 5e fa ff ff       	call   800c3d <sys_env_destroy>
+  8011df:	83 c4 10             	add    $0x10,%esp
+  8011e2:	eb b9                	jmp    80119d <pgfault+0x45>
+
+008011e4 <cowpage>:
+//
+// Returns: 0 on success, < 0 on error.
+//
+int
+cowpage(void *va)
+{
+  8011e4:	55                   	push   %ebp
+  8011e5:	89 e5                	mov    %esp,%ebp
+  8011e7:	53                   	push   %ebx
+  8011e8:	83 ec 04             	sub    $0x4,%esp
+  8011eb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (_pgfault_handler != pgfault) {
+  8011ee:	a1 04 a0 80 00       	mov    0x80a004,%eax
+  8011f3:	3d 58 11 80 00       	cmp    $0x801158,%eax
+  8011f8:	74 15                	je     80120f <cowpage+0x2b>
+		pgfault_next = _pgfault_handler;
+  8011fa:	a3 04 60 80 00       	mov    %eax,0x806004
+		set_pgfault_handler(pgfault);
+  8011ff:	83 ec 0c             	sub    $0xc,%esp
+  801202:	68 58 11 80 00       	push   $0x801158
+  801207:	e8 fa 28 00 00       	call   803b06 <set_pgfault_handler>
+  80120c:	83 c4 10             	add    $0x10,%esp
+	}
+	return sys_page_map(0, va, 0, va, PTE_COW | PTE_U | PTE_P);
+  80120f:	83 ec 0c             	sub    $0xc,%esp
+  801212:	68 05 08 00 00       	push   $0x805
+  801217:	53                   	push   %ebx
+  801218:	6a 00                	push   $0x0
+  80121a:	53                   	push   %ebx
+  80121b:	6a 00                	push   $0x0
+  80121d:	e8 f5 fa ff ff       	call   800d17 <sys_page_map>
+}
+  801222:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801225:	c9                   	leave
+  801226:	c3                   	ret
+
+00801227 <fork>:
+//   Neither user exception stack should ever be marked copy-on-write,
+//   so you must allocate a new page for the child's user exception stack.
+//
+envid_t
+fork(void)
+{
+  801227:	55                   	push   %ebp
+  801228:	89 e5                	mov    %esp,%ebp
+  80122a:	57                   	push   %edi
+  80122b:	56                   	push   %esi
+  80122c:	53                   	push   %ebx
+  80122d:	83 ec 28             	sub    $0x28,%esp
+	// LAB 4: Your code here.
+	envid_t envid;
+	int r;
+
+	set_pgfault_handler(pgfault);
+  801230:	68 58 11 80 00       	push   $0x801158
+  801235:	e8 cc 28 00 00       	call   803b06 <set_pgfault_handler>
+// child pointing to the trashed stack frame.
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	asm volatile("int %2"
+  80123a:	b8 07 00 00 00       	mov    $0x7,%eax
+  80123f:	cd 30                	int    $0x30
+  801241:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  801244:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	envid = sys_exofork();
+	if (envid < 0)
+  801247:	83 c4 10             	add    $0x10,%esp
+  80124a:	85 c0                	test   %eax,%eax
+  80124c:	0f 88 6b 01 00 00    	js     8013bd <fork+0x196>
+	else if (envid == 0) {
+		thisenv = &envs[ENVX(sys_getenvid())];
+		return 0;
+	}
+
+	for (uintptr_t addr = 0; addr < UTOP; addr += PGSIZE) {
+  801252:	bb 00 00 00 00       	mov    $0x0,%ebx
+	else if (envid == 0) {
+  801257:	75 37                	jne    801290 <fork+0x69>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  801259:	e8 28 fa ff ff       	call   800c86 <sys_getenvid>
+  80125e:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801263:	69 c0 8c 00 00 00    	imul   $0x8c,%eax,%eax
+  801269:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80126e:	a3 00 60 80 00       	mov    %eax,0x806000
+		return 0;
+  801273:	e9 45 01 00 00       	jmp    8013bd <fork+0x196>
+		if (!(uvpd[PDX(addr)] & PTE_P)) {
+			addr += PTSIZE - PGSIZE;
+  801278:	81 c3 00 f0 3f 00    	add    $0x3ff000,%ebx
+	for (uintptr_t addr = 0; addr < UTOP; addr += PGSIZE) {
+  80127e:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801284:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  80128a:	0f 87 ba 00 00 00    	ja     80134a <fork+0x123>
+		if (!(uvpd[PDX(addr)] & PTE_P)) {
+  801290:	89 d8                	mov    %ebx,%eax
+  801292:	c1 e8 16             	shr    $0x16,%eax
+  801295:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  80129c:	a8 01                	test   $0x1,%al
+  80129e:	74 d8                	je     801278 <fork+0x51>
+			continue;
+		}
+		if (!(uvpt[PGNUM(addr)] & PTE_P))
+  8012a0:	89 d8                	mov    %ebx,%eax
+  8012a2:	c1 e8 0c             	shr    $0xc,%eax
+  8012a5:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8012ac:	f6 c2 01             	test   $0x1,%dl
+  8012af:	74 cd                	je     80127e <fork+0x57>
+			continue;
+		if (addr == USTACKTOP - PGSIZE || addr == UXSTACKTOP - PGSIZE)
+  8012b1:	89 da                	mov    %ebx,%edx
+  8012b3:	80 e6 df             	and    $0xdf,%dh
+  8012b6:	81 fa 00 d0 bf ee    	cmp    $0xeebfd000,%edx
+  8012bc:	74 c0                	je     80127e <fork+0x57>
+	void *va = (void *) (pn << PGSHIFT);
+  8012be:	89 df                	mov    %ebx,%edi
+	if ((uvpt[pn] & PTE_SHARE) ||
+  8012c0:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8012c7:	f6 c6 04             	test   $0x4,%dh
+  8012ca:	75 53                	jne    80131f <fork+0xf8>
+	    (!(uvpt[pn] & PTE_COW) && !(uvpt[pn] & PTE_W)))
+  8012cc:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+	if ((uvpt[pn] & PTE_SHARE) ||
+  8012d3:	f6 c6 08             	test   $0x8,%dh
+  8012d6:	75 0c                	jne    8012e4 <fork+0xbd>
+	    (!(uvpt[pn] & PTE_COW) && !(uvpt[pn] & PTE_W)))
+  8012d8:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8012df:	f6 c2 02             	test   $0x2,%dl
+  8012e2:	74 3b                	je     80131f <fork+0xf8>
+	r = sys_page_map(0, va, envid, va, PTE_COW | PTE_U | PTE_P);
+  8012e4:	83 ec 0c             	sub    $0xc,%esp
+  8012e7:	68 05 08 00 00       	push   $0x805
+  8012ec:	57                   	push   %edi
+  8012ed:	ff 75 e4             	push   -0x1c(%ebp)
+  8012f0:	57                   	push   %edi
+  8012f1:	6a 00                	push   $0x0
+  8012f3:	e8 1f fa ff ff       	call   800d17 <sys_page_map>
+  8012f8:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  8012fa:	83 c4 20             	add    $0x20,%esp
+  8012fd:	85 c0                	test   %eax,%eax
+  8012ff:	0f 88 a7 00 00 00    	js     8013ac <fork+0x185>
+	r = sys_page_map(0, va, 0, va, PTE_COW | PTE_U | PTE_P);
+  801305:	83 ec 0c             	sub    $0xc,%esp
+  801308:	68 05 08 00 00       	push   $0x805
+  80130d:	57                   	push   %edi
+  80130e:	6a 00                	push   $0x0
+  801310:	57                   	push   %edi
+  801311:	6a 00                	push   $0x0
+  801313:	e8 ff f9 ff ff       	call   800d17 <sys_page_map>
+  801318:	89 c6                	mov    %eax,%esi
+	return r;
+  80131a:	83 c4 20             	add    $0x20,%esp
+  80131d:	eb 21                	jmp    801340 <fork+0x119>
+		return sys_page_map(0, va, envid, va, uvpt[pn] & PTE_SYSCALL);
+  80131f:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801326:	83 ec 0c             	sub    $0xc,%esp
+  801329:	25 07 0e 00 00       	and    $0xe07,%eax
+  80132e:	50                   	push   %eax
+  80132f:	57                   	push   %edi
+  801330:	ff 75 e4             	push   -0x1c(%ebp)
+  801333:	57                   	push   %edi
+  801334:	6a 00                	push   $0x0
+  801336:	e8 dc f9 ff ff       	call   800d17 <sys_page_map>
+  80133b:	89 c6                	mov    %eax,%esi
+  80133d:	83 c4 20             	add    $0x20,%esp
+			continue;
+		r = duppage(envid, PGNUM(addr));
+		if (r < 0)
+  801340:	85 f6                	test   %esi,%esi
+  801342:	0f 89 36 ff ff ff    	jns    80127e <fork+0x57>
+  801348:	eb 62                	jmp    8013ac <fork+0x185>
+			goto exit;
+	}
+
+	r = copy_page_to(envid, (void *) USTACKTOP - PGSIZE, PTE_U | PTE_W | PTE_P);
+  80134a:	b9 07 00 00 00       	mov    $0x7,%ecx
+  80134f:	ba 00 d0 bf ee       	mov    $0xeebfd000,%edx
+  801354:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  801357:	89 f8                	mov    %edi,%eax
+  801359:	e8 6f fd ff ff       	call   8010cd <copy_page_to>
+  80135e:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  801360:	85 c0                	test   %eax,%eax
+  801362:	78 48                	js     8013ac <fork+0x185>
+		goto exit;
+	r = sys_page_alloc(envid, (void *) UXSTACKTOP - PGSIZE, PTE_U | PTE_W | PTE_P);
+  801364:	83 ec 04             	sub    $0x4,%esp
+  801367:	6a 07                	push   $0x7
+  801369:	68 00 f0 bf ee       	push   $0xeebff000
+  80136e:	57                   	push   %edi
+  80136f:	e8 58 f9 ff ff       	call   800ccc <sys_page_alloc>
+  801374:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  801376:	83 c4 10             	add    $0x10,%esp
+  801379:	85 c0                	test   %eax,%eax
+  80137b:	78 2f                	js     8013ac <fork+0x185>
+		goto exit;
+	r = sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall);
+  80137d:	a1 00 60 80 00       	mov    0x806000,%eax
+  801382:	8b 40 64             	mov    0x64(%eax),%eax
+  801385:	83 ec 08             	sub    $0x8,%esp
+  801388:	50                   	push   %eax
+  801389:	57                   	push   %edi
+  80138a:	e8 a8 fa ff ff       	call   800e37 <sys_env_set_pgfault_upcall>
+  80138f:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  801391:	83 c4 10             	add    $0x10,%esp
+  801394:	85 c0                	test   %eax,%eax
+  801396:	78 14                	js     8013ac <fork+0x185>
+		goto exit;
+	r = sys_env_set_status(envid, ENV_RUNNABLE);
+  801398:	83 ec 08             	sub    $0x8,%esp
+  80139b:	6a 02                	push   $0x2
+  80139d:	57                   	push   %edi
+  80139e:	e8 00 fa ff ff       	call   800da3 <sys_env_set_status>
+  8013a3:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  8013a5:	83 c4 10             	add    $0x10,%esp
+  8013a8:	85 c0                	test   %eax,%eax
+  8013aa:	79 11                	jns    8013bd <fork+0x196>
+		goto exit;
+	return envid;
+exit:
+	sys_env_destroy(envid);
+  8013ac:	83 ec 0c             	sub    $0xc,%esp
+  8013af:	ff 75 e0             	push   -0x20(%ebp)
+  8013b2:	e8 86 f8 ff ff       	call   800c3d <sys_env_destroy>
+	return r;
+  8013b7:	83 c4 10             	add    $0x10,%esp
+  8013ba:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+}
+  8013bd:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8013c0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8013c3:	5b                   	pop    %ebx
+  8013c4:	5e                   	pop    %esi
+  8013c5:	5f                   	pop    %edi
+  8013c6:	5d                   	pop    %ebp
+  8013c7:	c3                   	ret
+
+008013c8 <sfork>:
+
+// Challenge!
+int
+sfork(void)
+{
+  8013c8:	55                   	push   %ebp
+  8013c9:	89 e5                	mov    %esp,%ebp
+  8013cb:	83 ec 0c             	sub    $0xc,%esp
+	panic("sfork not implemented");
+  8013ce:	68 cc 44 80 00       	push   $0x8044cc
+  8013d3:	68 bf 00 00 00       	push   $0xbf
+  8013d8:	68 c1 44 80 00       	push   $0x8044c1
+  8013dd:	e8 15 ee ff ff       	call   8001f7 <_panic>
+
+008013e2 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  8013e2:	55                   	push   %ebp
+  8013e3:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8013e5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8013e8:	05 00 00 00 30       	add    $0x30000000,%eax
+  8013ed:	c1 e8 0c             	shr    $0xc,%eax
+}
+  8013f0:	5d                   	pop    %ebp
+  8013f1:	c3                   	ret
+
+008013f2 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  8013f2:	55                   	push   %ebp
+  8013f3:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8013f5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8013f8:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  8013fd:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801402:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  801407:	5d                   	pop    %ebp
+  801408:	c3                   	ret
+
+00801409 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  801409:	55                   	push   %ebp
+  80140a:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  80140c:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  801411:	eb 02                	jmp    801415 <fd_alloc+0xc>
+  801413:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  801415:	89 c2                	mov    %eax,%edx
+  801417:	c1 ea 16             	shr    $0x16,%edx
+  80141a:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801421:	f6 c2 01             	test   $0x1,%dl
+  801424:	74 2b                	je     801451 <fd_alloc+0x48>
+  801426:	89 c2                	mov    %eax,%edx
+  801428:	c1 ea 0c             	shr    $0xc,%edx
+  80142b:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  801432:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  801438:	f6 c1 01             	test   $0x1,%cl
+  80143b:	74 14                	je     801451 <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  80143d:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  801443:	75 ce                	jne    801413 <fd_alloc+0xa>
+  801445:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  80144a:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  80144f:	eb 05                	jmp    801456 <fd_alloc+0x4d>
+			return 0;
+  801451:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  801456:	8b 55 08             	mov    0x8(%ebp),%edx
+  801459:	89 02                	mov    %eax,(%edx)
+}
+  80145b:	89 c8                	mov    %ecx,%eax
+  80145d:	5d                   	pop    %ebp
+  80145e:	c3                   	ret
+
+0080145f <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  80145f:	55                   	push   %ebp
+  801460:	89 e5                	mov    %esp,%ebp
+  801462:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  801465:	83 f8 1f             	cmp    $0x1f,%eax
+  801468:	77 30                	ja     80149a <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  80146a:	c1 e0 0c             	shl    $0xc,%eax
+  80146d:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  801472:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  801478:	f6 c2 01             	test   $0x1,%dl
+  80147b:	74 24                	je     8014a1 <fd_lookup+0x42>
+  80147d:	89 c2                	mov    %eax,%edx
+  80147f:	c1 ea 0c             	shr    $0xc,%edx
+  801482:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801489:	f6 c2 01             	test   $0x1,%dl
+  80148c:	74 1a                	je     8014a8 <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  80148e:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801491:	89 02                	mov    %eax,(%edx)
+	return 0;
+  801493:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801498:	5d                   	pop    %ebp
+  801499:	c3                   	ret
+		return -E_INVAL;
+  80149a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80149f:	eb f7                	jmp    801498 <fd_lookup+0x39>
+		return -E_INVAL;
+  8014a1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8014a6:	eb f0                	jmp    801498 <fd_lookup+0x39>
+  8014a8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8014ad:	eb e9                	jmp    801498 <fd_lookup+0x39>
+
+008014af <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  8014af:	55                   	push   %ebp
+  8014b0:	89 e5                	mov    %esp,%ebp
+  8014b2:	53                   	push   %ebx
+  8014b3:	83 ec 04             	sub    $0x4,%esp
+  8014b6:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  8014b9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014be:	eb 03                	jmp    8014c3 <dev_lookup+0x14>
+  8014c0:	83 c0 01             	add    $0x1,%eax
+  8014c3:	8b 1c 85 60 45 80 00 	mov    0x804560(,%eax,4),%ebx
+  8014ca:	85 db                	test   %ebx,%ebx
+  8014cc:	74 0b                	je     8014d9 <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  8014ce:	39 13                	cmp    %edx,(%ebx)
+  8014d0:	75 ee                	jne    8014c0 <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  8014d2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014d7:	eb 1f                	jmp    8014f8 <dev_lookup+0x49>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8014d9:	a1 00 60 80 00       	mov    0x806000,%eax
+  8014de:	8b 40 48             	mov    0x48(%eax),%eax
+  8014e1:	83 ec 04             	sub    $0x4,%esp
+  8014e4:	52                   	push   %edx
+  8014e5:	50                   	push   %eax
+  8014e6:	68 e4 44 80 00       	push   $0x8044e4
+  8014eb:	e8 e2 ed ff ff       	call   8002d2 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  8014f0:	83 c4 10             	add    $0x10,%esp
+  8014f3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  8014f8:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8014fb:	89 1a                	mov    %ebx,(%edx)
+}
+  8014fd:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801500:	c9                   	leave
+  801501:	c3                   	ret
+
+00801502 <fd_close>:
+{
+  801502:	55                   	push   %ebp
+  801503:	89 e5                	mov    %esp,%ebp
+  801505:	57                   	push   %edi
+  801506:	56                   	push   %esi
+  801507:	53                   	push   %ebx
+  801508:	83 ec 24             	sub    $0x24,%esp
+  80150b:	8b 75 08             	mov    0x8(%ebp),%esi
+  80150e:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801511:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801514:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801515:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  80151b:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  80151e:	50                   	push   %eax
+  80151f:	e8 3b ff ff ff       	call   80145f <fd_lookup>
+  801524:	89 c3                	mov    %eax,%ebx
+  801526:	83 c4 10             	add    $0x10,%esp
+  801529:	85 c0                	test   %eax,%eax
+  80152b:	78 05                	js     801532 <fd_close+0x30>
+	    || fd != fd2)
+  80152d:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801530:	74 16                	je     801548 <fd_close+0x46>
+		return (must_exist ? r : 0);
+  801532:	89 f8                	mov    %edi,%eax
+  801534:	84 c0                	test   %al,%al
+  801536:	b8 00 00 00 00       	mov    $0x0,%eax
+  80153b:	0f 44 d8             	cmove  %eax,%ebx
+}
+  80153e:	89 d8                	mov    %ebx,%eax
+  801540:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801543:	5b                   	pop    %ebx
+  801544:	5e                   	pop    %esi
+  801545:	5f                   	pop    %edi
+  801546:	5d                   	pop    %ebp
+  801547:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801548:	83 ec 08             	sub    $0x8,%esp
+  80154b:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  80154e:	50                   	push   %eax
+  80154f:	ff 36                	push   (%esi)
+  801551:	e8 59 ff ff ff       	call   8014af <dev_lookup>
+  801556:	89 c3                	mov    %eax,%ebx
+  801558:	83 c4 10             	add    $0x10,%esp
+  80155b:	85 c0                	test   %eax,%eax
+  80155d:	78 1a                	js     801579 <fd_close+0x77>
+		if (dev->dev_close)
+  80155f:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801562:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  801565:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  80156a:	85 c0                	test   %eax,%eax
+  80156c:	74 0b                	je     801579 <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  80156e:	83 ec 0c             	sub    $0xc,%esp
+  801571:	56                   	push   %esi
+  801572:	ff d0                	call   *%eax
+  801574:	89 c3                	mov    %eax,%ebx
+  801576:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  801579:	83 ec 08             	sub    $0x8,%esp
+  80157c:	56                   	push   %esi
+  80157d:	6a 00                	push   $0x0
+  80157f:	e8 d5 f7 ff ff       	call   800d59 <sys_page_unmap>
+	return r;
+  801584:	83 c4 10             	add    $0x10,%esp
+  801587:	eb b5                	jmp    80153e <fd_close+0x3c>
+
+00801589 <close>:
+
+int
+close(int fdnum)
+{
+  801589:	55                   	push   %ebp
+  80158a:	89 e5                	mov    %esp,%ebp
+  80158c:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80158f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801592:	50                   	push   %eax
+  801593:	ff 75 08             	push   0x8(%ebp)
+  801596:	e8 c4 fe ff ff       	call   80145f <fd_lookup>
+  80159b:	83 c4 10             	add    $0x10,%esp
+  80159e:	85 c0                	test   %eax,%eax
+  8015a0:	79 02                	jns    8015a4 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  8015a2:	c9                   	leave
+  8015a3:	c3                   	ret
+		return fd_close(fd, 1);
+  8015a4:	83 ec 08             	sub    $0x8,%esp
+  8015a7:	6a 01                	push   $0x1
+  8015a9:	ff 75 f4             	push   -0xc(%ebp)
+  8015ac:	e8 51 ff ff ff       	call   801502 <fd_close>
+  8015b1:	83 c4 10             	add    $0x10,%esp
+  8015b4:	eb ec                	jmp    8015a2 <close+0x19>
+
+008015b6 <close_all>:
+
+void
+close_all(void)
+{
+  8015b6:	55                   	push   %ebp
+  8015b7:	89 e5                	mov    %esp,%ebp
+  8015b9:	53                   	push   %ebx
+  8015ba:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  8015bd:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  8015c2:	83 ec 0c             	sub    $0xc,%esp
+  8015c5:	53                   	push   %ebx
+  8015c6:	e8 be ff ff ff       	call   801589 <close>
+	for (i = 0; i < MAXFD; i++)
+  8015cb:	83 c3 01             	add    $0x1,%ebx
+  8015ce:	83 c4 10             	add    $0x10,%esp
+  8015d1:	83 fb 20             	cmp    $0x20,%ebx
+  8015d4:	75 ec                	jne    8015c2 <close_all+0xc>
+}
+  8015d6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8015d9:	c9                   	leave
+  8015da:	c3                   	ret
+
+008015db <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  8015db:	55                   	push   %ebp
+  8015dc:	89 e5                	mov    %esp,%ebp
+  8015de:	57                   	push   %edi
+  8015df:	56                   	push   %esi
+  8015e0:	53                   	push   %ebx
+  8015e1:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  8015e4:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8015e7:	50                   	push   %eax
+  8015e8:	ff 75 08             	push   0x8(%ebp)
+  8015eb:	e8 6f fe ff ff       	call   80145f <fd_lookup>
+  8015f0:	89 c3                	mov    %eax,%ebx
+  8015f2:	83 c4 10             	add    $0x10,%esp
+  8015f5:	85 c0                	test   %eax,%eax
+  8015f7:	78 7f                	js     801678 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  8015f9:	83 ec 0c             	sub    $0xc,%esp
+  8015fc:	ff 75 0c             	push   0xc(%ebp)
+  8015ff:	e8 85 ff ff ff       	call   801589 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  801604:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801607:	c1 e6 0c             	shl    $0xc,%esi
+  80160a:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  801610:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801613:	89 3c 24             	mov    %edi,(%esp)
+  801616:	e8 d7 fd ff ff       	call   8013f2 <fd2data>
+  80161b:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  80161d:	89 34 24             	mov    %esi,(%esp)
+  801620:	e8 cd fd ff ff       	call   8013f2 <fd2data>
+  801625:	83 c4 10             	add    $0x10,%esp
+  801628:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  80162b:	89 d8                	mov    %ebx,%eax
+  80162d:	c1 e8 16             	shr    $0x16,%eax
+  801630:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801637:	a8 01                	test   $0x1,%al
+  801639:	74 11                	je     80164c <dup+0x71>
+  80163b:	89 d8                	mov    %ebx,%eax
+  80163d:	c1 e8 0c             	shr    $0xc,%eax
+  801640:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801647:	f6 c2 01             	test   $0x1,%dl
+  80164a:	75 36                	jne    801682 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  80164c:	89 f8                	mov    %edi,%eax
+  80164e:	c1 e8 0c             	shr    $0xc,%eax
+  801651:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801658:	83 ec 0c             	sub    $0xc,%esp
+  80165b:	25 07 0e 00 00       	and    $0xe07,%eax
+  801660:	50                   	push   %eax
+  801661:	56                   	push   %esi
+  801662:	6a 00                	push   $0x0
+  801664:	57                   	push   %edi
+  801665:	6a 00                	push   $0x0
+  801667:	e8 ab f6 ff ff       	call   800d17 <sys_page_map>
+  80166c:	89 c3                	mov    %eax,%ebx
+  80166e:	83 c4 20             	add    $0x20,%esp
+  801671:	85 c0                	test   %eax,%eax
+  801673:	78 33                	js     8016a8 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  801675:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  801678:	89 d8                	mov    %ebx,%eax
+  80167a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80167d:	5b                   	pop    %ebx
+  80167e:	5e                   	pop    %esi
+  80167f:	5f                   	pop    %edi
+  801680:	5d                   	pop    %ebp
+  801681:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  801682:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801689:	83 ec 0c             	sub    $0xc,%esp
+  80168c:	25 07 0e 00 00       	and    $0xe07,%eax
+  801691:	50                   	push   %eax
+  801692:	ff 75 d4             	push   -0x2c(%ebp)
+  801695:	6a 00                	push   $0x0
+  801697:	53                   	push   %ebx
+  801698:	6a 00                	push   $0x0
+  80169a:	e8 78 f6 ff ff       	call   800d17 <sys_page_map>
+  80169f:	89 c3                	mov    %eax,%ebx
+  8016a1:	83 c4 20             	add    $0x20,%esp
+  8016a4:	85 c0                	test   %eax,%eax
+  8016a6:	79 a4                	jns    80164c <dup+0x71>
+	sys_page_unmap(0, newfd);
+  8016a8:	83 ec 08             	sub    $0x8,%esp
+  8016ab:	56                   	push   %esi
+  8016ac:	6a 00                	push   $0x0
+  8016ae:	e8 a6 f6 ff ff       	call   800d59 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  8016b3:	83 c4 08             	add    $0x8,%esp
+  8016b6:	ff 75 d4             	push   -0x2c(%ebp)
+  8016b9:	6a 00                	push   $0x0
+  8016bb:	e8 99 f6 ff ff       	call   800d59 <sys_page_unmap>
+	return r;
+  8016c0:	83 c4 10             	add    $0x10,%esp
+  8016c3:	eb b3                	jmp    801678 <dup+0x9d>
+
+008016c5 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  8016c5:	55                   	push   %ebp
+  8016c6:	89 e5                	mov    %esp,%ebp
+  8016c8:	56                   	push   %esi
+  8016c9:	53                   	push   %ebx
+  8016ca:	83 ec 18             	sub    $0x18,%esp
+  8016cd:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8016d0:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8016d3:	50                   	push   %eax
+  8016d4:	56                   	push   %esi
+  8016d5:	e8 85 fd ff ff       	call   80145f <fd_lookup>
+  8016da:	83 c4 10             	add    $0x10,%esp
+  8016dd:	85 c0                	test   %eax,%eax
+  8016df:	78 3c                	js     80171d <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8016e1:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  8016e4:	83 ec 08             	sub    $0x8,%esp
+  8016e7:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8016ea:	50                   	push   %eax
+  8016eb:	ff 33                	push   (%ebx)
+  8016ed:	e8 bd fd ff ff       	call   8014af <dev_lookup>
+  8016f2:	83 c4 10             	add    $0x10,%esp
+  8016f5:	85 c0                	test   %eax,%eax
+  8016f7:	78 24                	js     80171d <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  8016f9:	8b 43 08             	mov    0x8(%ebx),%eax
+  8016fc:	83 e0 03             	and    $0x3,%eax
+  8016ff:	83 f8 01             	cmp    $0x1,%eax
+  801702:	74 20                	je     801724 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  801704:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801707:	8b 40 08             	mov    0x8(%eax),%eax
+  80170a:	85 c0                	test   %eax,%eax
+  80170c:	74 37                	je     801745 <read+0x80>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  80170e:	83 ec 04             	sub    $0x4,%esp
+  801711:	ff 75 10             	push   0x10(%ebp)
+  801714:	ff 75 0c             	push   0xc(%ebp)
+  801717:	53                   	push   %ebx
+  801718:	ff d0                	call   *%eax
+  80171a:	83 c4 10             	add    $0x10,%esp
+}
+  80171d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801720:	5b                   	pop    %ebx
+  801721:	5e                   	pop    %esi
+  801722:	5d                   	pop    %ebp
+  801723:	c3                   	ret
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801724:	a1 00 60 80 00       	mov    0x806000,%eax
+  801729:	8b 40 48             	mov    0x48(%eax),%eax
+  80172c:	83 ec 04             	sub    $0x4,%esp
+  80172f:	56                   	push   %esi
+  801730:	50                   	push   %eax
+  801731:	68 25 45 80 00       	push   $0x804525
+  801736:	e8 97 eb ff ff       	call   8002d2 <cprintf>
+		return -E_INVAL;
+  80173b:	83 c4 10             	add    $0x10,%esp
+  80173e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801743:	eb d8                	jmp    80171d <read+0x58>
+		return -E_NOT_SUPP;
+  801745:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80174a:	eb d1                	jmp    80171d <read+0x58>
+
+0080174c <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  80174c:	55                   	push   %ebp
+  80174d:	89 e5                	mov    %esp,%ebp
+  80174f:	57                   	push   %edi
+  801750:	56                   	push   %esi
+  801751:	53                   	push   %ebx
+  801752:	83 ec 0c             	sub    $0xc,%esp
+  801755:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801758:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  80175b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801760:	eb 02                	jmp    801764 <readn+0x18>
+  801762:	01 c3                	add    %eax,%ebx
+  801764:	39 f3                	cmp    %esi,%ebx
+  801766:	73 21                	jae    801789 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801768:	83 ec 04             	sub    $0x4,%esp
+  80176b:	89 f0                	mov    %esi,%eax
+  80176d:	29 d8                	sub    %ebx,%eax
+  80176f:	50                   	push   %eax
+  801770:	89 d8                	mov    %ebx,%eax
+  801772:	03 45 0c             	add    0xc(%ebp),%eax
+  801775:	50                   	push   %eax
+  801776:	57                   	push   %edi
+  801777:	e8 49 ff ff ff       	call   8016c5 <read>
+		if (m < 0)
+  80177c:	83 c4 10             	add    $0x10,%esp
+  80177f:	85 c0                	test   %eax,%eax
+  801781:	78 04                	js     801787 <readn+0x3b>
+			return m;
+		if (m == 0)
+  801783:	75 dd                	jne    801762 <readn+0x16>
+  801785:	eb 02                	jmp    801789 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801787:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  801789:	89 d8                	mov    %ebx,%eax
+  80178b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80178e:	5b                   	pop    %ebx
+  80178f:	5e                   	pop    %esi
+  801790:	5f                   	pop    %edi
+  801791:	5d                   	pop    %ebp
+  801792:	c3                   	ret
+
+00801793 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  801793:	55                   	push   %ebp
+  801794:	89 e5                	mov    %esp,%ebp
+  801796:	56                   	push   %esi
+  801797:	53                   	push   %ebx
+  801798:	83 ec 18             	sub    $0x18,%esp
+  80179b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80179e:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8017a1:	50                   	push   %eax
+  8017a2:	53                   	push   %ebx
+  8017a3:	e8 b7 fc ff ff       	call   80145f <fd_lookup>
+  8017a8:	83 c4 10             	add    $0x10,%esp
+  8017ab:	85 c0                	test   %eax,%eax
+  8017ad:	78 37                	js     8017e6 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8017af:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8017b2:	83 ec 08             	sub    $0x8,%esp
+  8017b5:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8017b8:	50                   	push   %eax
+  8017b9:	ff 36                	push   (%esi)
+  8017bb:	e8 ef fc ff ff       	call   8014af <dev_lookup>
+  8017c0:	83 c4 10             	add    $0x10,%esp
+  8017c3:	85 c0                	test   %eax,%eax
+  8017c5:	78 1f                	js     8017e6 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8017c7:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8017cb:	74 20                	je     8017ed <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  8017cd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8017d0:	8b 40 0c             	mov    0xc(%eax),%eax
+  8017d3:	85 c0                	test   %eax,%eax
+  8017d5:	74 37                	je     80180e <write+0x7b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  8017d7:	83 ec 04             	sub    $0x4,%esp
+  8017da:	ff 75 10             	push   0x10(%ebp)
+  8017dd:	ff 75 0c             	push   0xc(%ebp)
+  8017e0:	56                   	push   %esi
+  8017e1:	ff d0                	call   *%eax
+  8017e3:	83 c4 10             	add    $0x10,%esp
+}
+  8017e6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8017e9:	5b                   	pop    %ebx
+  8017ea:	5e                   	pop    %esi
+  8017eb:	5d                   	pop    %ebp
+  8017ec:	c3                   	ret
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  8017ed:	a1 00 60 80 00       	mov    0x806000,%eax
+  8017f2:	8b 40 48             	mov    0x48(%eax),%eax
+  8017f5:	83 ec 04             	sub    $0x4,%esp
+  8017f8:	53                   	push   %ebx
+  8017f9:	50                   	push   %eax
+  8017fa:	68 41 45 80 00       	push   $0x804541
+  8017ff:	e8 ce ea ff ff       	call   8002d2 <cprintf>
+		return -E_INVAL;
+  801804:	83 c4 10             	add    $0x10,%esp
+  801807:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80180c:	eb d8                	jmp    8017e6 <write+0x53>
+		return -E_NOT_SUPP;
+  80180e:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801813:	eb d1                	jmp    8017e6 <write+0x53>
+
+00801815 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  801815:	55                   	push   %ebp
+  801816:	89 e5                	mov    %esp,%ebp
+  801818:	53                   	push   %ebx
+  801819:	83 ec 1c             	sub    $0x1c,%esp
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80181c:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80181f:	50                   	push   %eax
+  801820:	ff 75 08             	push   0x8(%ebp)
+  801823:	e8 37 fc ff ff       	call   80145f <fd_lookup>
+  801828:	83 c4 10             	add    $0x10,%esp
+  80182b:	85 c0                	test   %eax,%eax
+  80182d:	78 3a                	js     801869 <seek+0x54>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80182f:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  801832:	83 ec 08             	sub    $0x8,%esp
+  801835:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801838:	50                   	push   %eax
+  801839:	ff 33                	push   (%ebx)
+  80183b:	e8 6f fc ff ff       	call   8014af <dev_lookup>
+  801840:	83 c4 10             	add    $0x10,%esp
+  801843:	85 c0                	test   %eax,%eax
+  801845:	78 22                	js     801869 <seek+0x54>
+		return r;
+	// Anything buffered for the old position goes out first.
+	if (dev->dev_sync && (r = (*dev->dev_sync)(fd)) < 0)
+  801847:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80184a:	8b 40 1c             	mov    0x1c(%eax),%eax
+  80184d:	85 c0                	test   %eax,%eax
+  80184f:	74 0d                	je     80185e <seek+0x49>
+  801851:	83 ec 0c             	sub    $0xc,%esp
+  801854:	53                   	push   %ebx
+  801855:	ff d0                	call   *%eax
+  801857:	83 c4 10             	add    $0x10,%esp
+  80185a:	85 c0                	test   %eax,%eax
+  80185c:	78 0b                	js     801869 <seek+0x54>
+		return r;
+	fd->fd_offset = offset;
+  80185e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801861:	89 43 04             	mov    %eax,0x4(%ebx)
+	return 0;
+  801864:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801869:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80186c:	c9                   	leave
+  80186d:	c3                   	ret
+
+0080186e <fsync>:
+
+// Push out anything the library has buffered for fdnum.
+int
+fsync(int fdnum)
+{
+  80186e:	55                   	push   %ebp
+  80186f:	89 e5                	mov    %esp,%ebp
+  801871:	53                   	push   %ebx
+  801872:	83 ec 1c             	sub    $0x1c,%esp
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801875:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801878:	50                   	push   %eax
+  801879:	ff 75 08             	push   0x8(%ebp)
+  80187c:	e8 de fb ff ff       	call   80145f <fd_lookup>
+  801881:	83 c4 10             	add    $0x10,%esp
+  801884:	85 c0                	test   %eax,%eax
+  801886:	78 2b                	js     8018b3 <fsync+0x45>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801888:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  80188b:	83 ec 08             	sub    $0x8,%esp
+  80188e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801891:	50                   	push   %eax
+  801892:	ff 33                	push   (%ebx)
+  801894:	e8 16 fc ff ff       	call   8014af <dev_lookup>
+  801899:	83 c4 10             	add    $0x10,%esp
+  80189c:	85 c0                	test   %eax,%eax
+  80189e:	78 13                	js     8018b3 <fsync+0x45>
+		return r;
+	if (!dev->dev_sync)
+  8018a0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8018a3:	8b 40 1c             	mov    0x1c(%eax),%eax
+  8018a6:	85 c0                	test   %eax,%eax
+  8018a8:	74 0e                	je     8018b8 <fsync+0x4a>
+		return 0;
+	return (*dev->dev_sync)(fd);
+  8018aa:	83 ec 0c             	sub    $0xc,%esp
+  8018ad:	53                   	push   %ebx
+  8018ae:	ff d0                	call   *%eax
+  8018b0:	83 c4 10             	add    $0x10,%esp
+}
+  8018b3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8018b6:	c9                   	leave
+  8018b7:	c3                   	ret
+		return 0;
+  8018b8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018bd:	eb f4                	jmp    8018b3 <fsync+0x45>
+
+008018bf <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  8018bf:	55                   	push   %ebp
+  8018c0:	89 e5                	mov    %esp,%ebp
+  8018c2:	56                   	push   %esi
+  8018c3:	53                   	push   %ebx
+  8018c4:	83 ec 18             	sub    $0x18,%esp
+  8018c7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8018ca:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8018cd:	50                   	push   %eax
+  8018ce:	53                   	push   %ebx
+  8018cf:	e8 8b fb ff ff       	call   80145f <fd_lookup>
+  8018d4:	83 c4 10             	add    $0x10,%esp
+  8018d7:	85 c0                	test   %eax,%eax
+  8018d9:	78 34                	js     80190f <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8018db:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8018de:	83 ec 08             	sub    $0x8,%esp
+  8018e1:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8018e4:	50                   	push   %eax
+  8018e5:	ff 36                	push   (%esi)
+  8018e7:	e8 c3 fb ff ff       	call   8014af <dev_lookup>
+  8018ec:	83 c4 10             	add    $0x10,%esp
+  8018ef:	85 c0                	test   %eax,%eax
+  8018f1:	78 1c                	js     80190f <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8018f3:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8018f7:	74 1d                	je     801916 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  8018f9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8018fc:	8b 40 18             	mov    0x18(%eax),%eax
+  8018ff:	85 c0                	test   %eax,%eax
+  801901:	74 34                	je     801937 <ftruncate+0x78>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  801903:	83 ec 08             	sub    $0x8,%esp
+  801906:	ff 75 0c             	push   0xc(%ebp)
+  801909:	56                   	push   %esi
+  80190a:	ff d0                	call   *%eax
+  80190c:	83 c4 10             	add    $0x10,%esp
+}
+  80190f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801912:	5b                   	pop    %ebx
+  801913:	5e                   	pop    %esi
+  801914:	5d                   	pop    %ebp
+  801915:	c3                   	ret
+			thisenv->env_id, fdnum);
+  801916:	a1 00 60 80 00       	mov    0x806000,%eax
+  80191b:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  80191e:	83 ec 04             	sub    $0x4,%esp
+  801921:	53                   	push   %ebx
+  801922:	50                   	push   %eax
+  801923:	68 04 45 80 00       	push   $0x804504
+  801928:	e8 a5 e9 ff ff       	call   8002d2 <cprintf>
+		return -E_INVAL;
+  80192d:	83 c4 10             	add    $0x10,%esp
+  801930:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801935:	eb d8                	jmp    80190f <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  801937:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80193c:	eb d1                	jmp    80190f <ftruncate+0x50>
+
+0080193e <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  80193e:	55                   	push   %ebp
+  80193f:	89 e5                	mov    %esp,%ebp
+  801941:	56                   	push   %esi
+  801942:	53                   	push   %ebx
+  801943:	83 ec 18             	sub    $0x18,%esp
+  801946:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801949:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80194c:	50                   	push   %eax
+  80194d:	ff 75 08             	push   0x8(%ebp)
+  801950:	e8 0a fb ff ff       	call   80145f <fd_lookup>
+  801955:	83 c4 10             	add    $0x10,%esp
+  801958:	85 c0                	test   %eax,%eax
+  80195a:	78 49                	js     8019a5 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80195c:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80195f:	83 ec 08             	sub    $0x8,%esp
+  801962:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801965:	50                   	push   %eax
+  801966:	ff 36                	push   (%esi)
+  801968:	e8 42 fb ff ff       	call   8014af <dev_lookup>
+  80196d:	83 c4 10             	add    $0x10,%esp
+  801970:	85 c0                	test   %eax,%eax
+  801972:	78 31                	js     8019a5 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  801974:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801977:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  80197b:	74 2f                	je     8019ac <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  80197d:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  801980:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801987:	00 00 00 
+	stat->st_isdir = 0;
+  80198a:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801991:	00 00 00 
+	stat->st_dev = dev;
+  801994:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  80199a:	83 ec 08             	sub    $0x8,%esp
+  80199d:	53                   	push   %ebx
+  80199e:	56                   	push   %esi
+  80199f:	ff 50 14             	call   *0x14(%eax)
+  8019a2:	83 c4 10             	add    $0x10,%esp
+}
+  8019a5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8019a8:	5b                   	pop    %ebx
+  8019a9:	5e                   	pop    %esi
+  8019aa:	5d                   	pop    %ebp
+  8019ab:	c3                   	ret
+		return -E_NOT_SUPP;
+  8019ac:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8019b1:	eb f2                	jmp    8019a5 <fstat+0x67>
+
+008019b3 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  8019b3:	55                   	push   %ebp
+  8019b4:	89 e5                	mov    %esp,%ebp
+  8019b6:	56                   	push   %esi
+  8019b7:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY | O_NOBUF)) < 0)
+  8019b8:	83 ec 08             	sub    $0x8,%esp
+  8019bb:	68 00 10 00 00       	push   $0x1000
+  8019c0:	ff 75 08             	push   0x8(%ebp)
+  8019c3:	e8 b3 07 00 00       	call   80217b <open>
+  8019c8:	89 c3                	mov    %eax,%ebx
+  8019ca:	83 c4 10             	add    $0x10,%esp
+  8019cd:	85 c0                	test   %eax,%eax
+  8019cf:	78 1b                	js     8019ec <stat+0x39>
+		return fd;
+	r = fstat(fd, stat);
+  8019d1:	83 ec 08             	sub    $0x8,%esp
+  8019d4:	ff 75 0c             	push   0xc(%ebp)
+  8019d7:	50                   	push   %eax
+  8019d8:	e8 61 ff ff ff       	call   80193e <fstat>
+  8019dd:	89 c6                	mov    %eax,%esi
+	close(fd);
+  8019df:	89 1c 24             	mov    %ebx,(%esp)
+  8019e2:	e8 a2 fb ff ff       	call   801589 <close>
+	return r;
+  8019e7:	83 c4 10             	add    $0x10,%esp
+  8019ea:	89 f3                	mov    %esi,%ebx
+}
+  8019ec:	89 d8                	mov    %ebx,%eax
+  8019ee:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8019f1:	5b                   	pop    %ebx
+  8019f2:	5e                   	pop    %esi
+  8019f3:	5d                   	pop    %ebp
+  8019f4:	c3                   	ret
+
+008019f5 <fsipc_pages>:
+// need not be copied through fsipcbuf.  n must fit in FSBULK_MAXPAGES
+// pages.
+// Returns result from the file server.
+static int
+fsipc_pages(unsigned type, const void *buf, size_t n, int perm)
+{
+  8019f5:	55                   	push   %ebp
+  8019f6:	89 e5                	mov    %esp,%ebp
+  8019f8:	57                   	push   %edi
+  8019f9:	56                   	push   %esi
+  8019fa:	53                   	push   %ebx
+  8019fb:	81 ec 2c 01 00 00    	sub    $0x12c,%esp
+  801a01:	89 85 d4 fe ff ff    	mov    %eax,-0x12c(%ebp)
+  801a07:	89 d6                	mov    %edx,%esi
+  801a09:	89 8d d0 fe ff ff    	mov    %ecx,-0x130(%ebp)
+  801a0f:	8b 7d 08             	mov    0x8(%ebp),%edi
+	uintptr_t pages[1 + FSBULK_MAXPAGES];
+	uintptr_t va, start = ROUNDDOWN((uintptr_t) buf, PGSIZE);
+  801a12:	89 d3                	mov    %edx,%ebx
+  801a14:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+	int npages;
+
+	if (fsenv == 0)
+  801a1a:	83 3d c8 80 80 00 00 	cmpl   $0x0,0x8080c8
+  801a21:	74 1d                	je     801a40 <fsipc_pages+0x4b>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+
+	pages[0] = (uintptr_t) &fsipcbuf | PTE_P | PTE_W | PTE_U;
+  801a23:	b8 00 70 80 00       	mov    $0x807000,%eax
+  801a28:	83 c8 07             	or     $0x7,%eax
+  801a2b:	89 85 e4 fe ff ff    	mov    %eax,-0x11c(%ebp)
+	npages = 1;
+  801a31:	b8 01 00 00 00       	mov    $0x1,%eax
+	for (va = start; va < (uintptr_t) buf + n; va += PGSIZE)
+  801a36:	8b 8d d0 fe ff ff    	mov    -0x130(%ebp),%ecx
+  801a3c:	01 ce                	add    %ecx,%esi
+  801a3e:	eb 28                	jmp    801a68 <fsipc_pages+0x73>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801a40:	83 ec 0c             	sub    $0xc,%esp
+  801a43:	6a 01                	push   $0x1
+  801a45:	e8 f9 22 00 00       	call   803d43 <ipc_find_env>
+  801a4a:	a3 c8 80 80 00       	mov    %eax,0x8080c8
+  801a4f:	83 c4 10             	add    $0x10,%esp
+  801a52:	eb cf                	jmp    801a23 <fsipc_pages+0x2e>
+		pages[npages++] = va | perm;
+  801a54:	83 c0 01             	add    $0x1,%eax
+  801a57:	89 fa                	mov    %edi,%edx
+  801a59:	09 da                	or     %ebx,%edx
+  801a5b:	89 94 85 e0 fe ff ff 	mov    %edx,-0x120(%ebp,%eax,4)
+	for (va = start; va < (uintptr_t) buf + n; va += PGSIZE)
+  801a62:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801a68:	39 f3                	cmp    %esi,%ebx
+  801a6a:	72 e8                	jb     801a54 <fsipc_pages+0x5f>
+	assert(npages <= ARRAY_SIZE(pages));
+  801a6c:	83 f8 41             	cmp    $0x41,%eax
+  801a6f:	77 2f                	ja     801aa0 <fsipc_pages+0xab>
+
+	if (debug)
+		cprintf("[%08x] fsipc_pages %d %08x %d pages\n",
+			thisenv->env_id, type, buf, npages - 1);
+
+	ipc_sendv(fsenv, type, pages, npages);
+  801a71:	50                   	push   %eax
+  801a72:	8d 85 e4 fe ff ff    	lea    -0x11c(%ebp),%eax
+  801a78:	50                   	push   %eax
+  801a79:	ff b5 d4 fe ff ff    	push   -0x12c(%ebp)
+  801a7f:	ff 35 c8 80 80 00    	push   0x8080c8
+  801a85:	e8 6b 22 00 00       	call   803cf5 <ipc_sendv>
+	return ipc_recv(NULL, NULL, NULL);
+  801a8a:	83 c4 0c             	add    $0xc,%esp
+  801a8d:	6a 00                	push   $0x0
+  801a8f:	6a 00                	push   $0x0
+  801a91:	6a 00                	push   $0x0
+  801a93:	e8 07 21 00 00       	call   803b9f <ipc_recv>
+}
+  801a98:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801a9b:	5b                   	pop    %ebx
+  801a9c:	5e                   	pop    %esi
+  801a9d:	5f                   	pop    %edi
+  801a9e:	5d                   	pop    %ebp
+  801a9f:	c3                   	ret
+	assert(npages <= ARRAY_SIZE(pages));
+  801aa0:	68 74 45 80 00       	push   $0x804574
+  801aa5:	68 ac 44 80 00       	push   $0x8044ac
+  801aaa:	6a 40                	push   $0x40
+  801aac:	68 90 45 80 00       	push   $0x804590
+  801ab1:	e8 41 e7 ff ff       	call   8001f7 <_panic>
+
+00801ab6 <fsring_post>:
+
+// Post a request of the given type for n bytes at 'offset' of fdnum,
+// with data page 'slot' already filled in as needed.
+static int
+fsring_post(uint32_t type, struct Fd *fd, off_t offset, size_t n, int slot)
+{
+  801ab6:	55                   	push   %ebp
+  801ab7:	89 e5                	mov    %esp,%ebp
+  801ab9:	57                   	push   %edi
+  801aba:	56                   	push   %esi
+  801abb:	53                   	push   %ebx
+  801abc:	83 ec 1c             	sub    $0x1c,%esp
+  801abf:	89 c3                	mov    %eax,%ebx
+  801ac1:	89 d6                	mov    %edx,%esi
+  801ac3:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+	struct Fsring_sqe *sqe;
+	uint32_t tail = fsring->r_sqtail;
+  801ac6:	8b 0d 04 00 00 cf    	mov    0xcf000004,%ecx
+
+	sqe = &fsring->r_sq[tail % FSRING_NSLOTS];
+  801acc:	89 ca                	mov    %ecx,%edx
+  801ace:	83 e2 0f             	and    $0xf,%edx
+	sqe->sqe_type = type;
+  801ad1:	8d 04 95 00 00 00 00 	lea    0x0(,%edx,4),%eax
+  801ad8:	8d 3c 10             	lea    (%eax,%edx,1),%edi
+  801adb:	89 1c bd 10 00 00 cf 	mov    %ebx,-0x30fffff0(,%edi,4)
+	sqe->sqe_fileid = fd->fd_file.id;
+  801ae2:	8b 76 0c             	mov    0xc(%esi),%esi
+  801ae5:	89 fb                	mov    %edi,%ebx
+  801ae7:	89 34 bd 14 00 00 cf 	mov    %esi,-0x30ffffec(,%edi,4)
+	sqe->sqe_offset = offset;
+  801aee:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801af1:	89 3c 9d 18 00 00 cf 	mov    %edi,-0x30ffffe8(,%ebx,4)
+	sqe->sqe_n = n;
+  801af8:	8b 75 08             	mov    0x8(%ebp),%esi
+  801afb:	89 34 9d 1c 00 00 cf 	mov    %esi,-0x30ffffe4(,%ebx,4)
+	sqe->sqe_slot = slot;
+  801b02:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801b05:	89 14 9d 20 00 00 cf 	mov    %edx,-0x30ffffe0(,%ebx,4)
+	// waking when the ring was empty before this request.  The kick
+	// gets no reply, and the server does not look at its request page.
+	// Publishing the tail with xchg, a full barrier, keeps the load of
+	// r_sqhead below from passing it; serve_ring_kick does the same the
+	// other way around, so one of the two sees the other's update.
+	xchg(&fsring->r_sqtail, tail + 1);
+  801b0c:	8d 41 01             	lea    0x1(%ecx),%eax
+xchg(volatile uint32_t *addr, uint32_t newval)
+{
+	uint32_t result;
+
+	// The + in "+m" denotes a read-modify-write operand.
+	asm volatile("lock; xchgl %0, %1"
+  801b0f:	f0 87 05 04 00 00 cf 	lock xchg %eax,0xcf000004
+	if (fsring->r_sqhead == tail)
+  801b16:	a1 00 00 00 cf       	mov    0xcf000000,%eax
+  801b1b:	39 c8                	cmp    %ecx,%eax
+  801b1d:	74 0d                	je     801b2c <fsring_post+0x76>
+		ipc_send(fsenv, FSREQ_RING_KICK, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+	return 0;
+}
+  801b1f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b24:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801b27:	5b                   	pop    %ebx
+  801b28:	5e                   	pop    %esi
+  801b29:	5f                   	pop    %edi
+  801b2a:	5d                   	pop    %ebp
+  801b2b:	c3                   	ret
+		ipc_send(fsenv, FSREQ_RING_KICK, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801b2c:	6a 07                	push   $0x7
+  801b2e:	68 00 70 80 00       	push   $0x807000
+  801b33:	6a 0d                	push   $0xd
+  801b35:	ff 35 c8 80 80 00    	push   0x8080c8
+  801b3b:	e8 ca 20 00 00       	call   803c0a <ipc_send>
+  801b40:	83 c4 10             	add    $0x10,%esp
+  801b43:	eb da                	jmp    801b1f <fsring_post+0x69>
+
+00801b45 <fsipcv>:
+{
+  801b45:	55                   	push   %ebp
+  801b46:	89 e5                	mov    %esp,%ebp
+  801b48:	57                   	push   %edi
+  801b49:	56                   	push   %esi
+  801b4a:	53                   	push   %ebx
+  801b4b:	83 ec 0c             	sub    $0xc,%esp
+  801b4e:	89 c7                	mov    %eax,%edi
+  801b50:	89 d3                	mov    %edx,%ebx
+  801b52:	89 ce                	mov    %ecx,%esi
+	if (fsenv == 0)
+  801b54:	83 3d c8 80 80 00 00 	cmpl   $0x0,0x8080c8
+  801b5b:	74 26                	je     801b83 <fsipcv+0x3e>
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801b5d:	6a 07                	push   $0x7
+  801b5f:	68 00 70 80 00       	push   $0x807000
+  801b64:	57                   	push   %edi
+  801b65:	ff 35 c8 80 80 00    	push   0x8080c8
+  801b6b:	e8 9a 20 00 00       	call   803c0a <ipc_send>
+	return ipc_recvv(NULL, dstva, npages, NULL);
+  801b70:	6a 00                	push   $0x0
+  801b72:	56                   	push   %esi
+  801b73:	53                   	push   %ebx
+  801b74:	6a 00                	push   $0x0
+  801b76:	e8 e7 20 00 00       	call   803c62 <ipc_recvv>
+}
+  801b7b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801b7e:	5b                   	pop    %ebx
+  801b7f:	5e                   	pop    %esi
+  801b80:	5f                   	pop    %edi
+  801b81:	5d                   	pop    %ebp
+  801b82:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801b83:	83 ec 0c             	sub    $0xc,%esp
+  801b86:	6a 01                	push   $0x1
+  801b88:	e8 b6 21 00 00       	call   803d43 <ipc_find_env>
+  801b8d:	a3 c8 80 80 00       	mov    %eax,0x8080c8
+  801b92:	83 c4 10             	add    $0x10,%esp
+  801b95:	eb c6                	jmp    801b5d <fsipcv+0x18>
+
+00801b97 <fsipc>:
+{
+  801b97:	55                   	push   %ebp
+  801b98:	89 e5                	mov    %esp,%ebp
+  801b9a:	83 ec 18             	sub    $0x18,%esp
+	int npages = 1;
+  801b9d:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+	return fsipcv(type, dstva, &npages);
+  801ba4:	8d 4d f4             	lea    -0xc(%ebp),%ecx
+  801ba7:	e8 99 ff ff ff       	call   801b45 <fsipcv>
+}
+  801bac:	c9                   	leave
+  801bad:	c3                   	ret
+
+00801bae <file_write_direct>:
+{
+  801bae:	55                   	push   %ebp
+  801baf:	89 e5                	mov    %esp,%ebp
+  801bb1:	56                   	push   %esi
+  801bb2:	53                   	push   %ebx
+  801bb3:	89 c3                	mov    %eax,%ebx
+  801bb5:	89 c8                	mov    %ecx,%eax
+	if (n > sizeof(fsipcbuf.write.req_buf)) {
+  801bb7:	81 f9 f8 0f 00 00    	cmp    $0xff8,%ecx
+  801bbd:	77 40                	ja     801bff <file_write_direct+0x51>
+	n = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  801bbf:	b9 f8 0f 00 00       	mov    $0xff8,%ecx
+  801bc4:	39 c8                	cmp    %ecx,%eax
+  801bc6:	0f 47 c1             	cmova  %ecx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801bc9:	8b 4b 0c             	mov    0xc(%ebx),%ecx
+  801bcc:	89 0d 00 70 80 00    	mov    %ecx,0x807000
+	fsipcbuf.write.req_n = n;
+  801bd2:	a3 04 70 80 00       	mov    %eax,0x807004
+	memmove(fsipcbuf.write.req_buf, buf, n);
+  801bd7:	83 ec 04             	sub    $0x4,%esp
+  801bda:	50                   	push   %eax
+  801bdb:	52                   	push   %edx
+  801bdc:	68 08 70 80 00       	push   $0x807008
+  801be1:	e8 60 ee ff ff       	call   800a46 <memmove>
+	return fsipc(FSREQ_WRITE, NULL);
+  801be6:	ba 00 00 00 00       	mov    $0x0,%edx
+  801beb:	b8 04 00 00 00       	mov    $0x4,%eax
+  801bf0:	e8 a2 ff ff ff       	call   801b97 <fsipc>
+  801bf5:	83 c4 10             	add    $0x10,%esp
+}
+  801bf8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801bfb:	5b                   	pop    %ebx
+  801bfc:	5e                   	pop    %esi
+  801bfd:	5d                   	pop    %ebp
+  801bfe:	c3                   	ret
+		n = MIN(n, FSBULK_MAXPAGES * PGSIZE - PGOFF(buf));
+  801bff:	89 d6                	mov    %edx,%esi
+  801c01:	81 e6 ff 0f 00 00    	and    $0xfff,%esi
+  801c07:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  801c0c:	29 f1                	sub    %esi,%ecx
+  801c0e:	39 c1                	cmp    %eax,%ecx
+  801c10:	0f 47 c8             	cmova  %eax,%ecx
+	fsipcbuf.bulk.req_fileid = fileid;
+  801c13:	8b 43 0c             	mov    0xc(%ebx),%eax
+  801c16:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.bulk.req_n = n;
+  801c1b:	89 0d 04 70 80 00    	mov    %ecx,0x807004
+	fsipcbuf.bulk.req_off = PGOFF(buf);
+  801c21:	89 35 08 70 80 00    	mov    %esi,0x807008
+	return fsipc_pages(type, buf, n, perm);
+  801c27:	83 ec 0c             	sub    $0xc,%esp
+  801c2a:	6a 05                	push   $0x5
+  801c2c:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801c31:	e8 bf fd ff ff       	call   8019f5 <fsipc_pages>
+		return fsipc_bulk(FSREQ_WRITE_BULK, fd->fd_file.id, buf, n,
+  801c36:	83 c4 10             	add    $0x10,%esp
+  801c39:	eb bd                	jmp    801bf8 <file_write_direct+0x4a>
+
+00801c3b <devfile_sync>:
+{
+  801c3b:	55                   	push   %ebp
+  801c3c:	89 e5                	mov    %esp,%ebp
+  801c3e:	57                   	push   %edi
+  801c3f:	56                   	push   %esi
+  801c40:	53                   	push   %ebx
+  801c41:	83 ec 28             	sub    $0x28,%esp
+  801c44:	8b 75 08             	mov    0x8(%ebp),%esi
+	char *p = fd2data(fd);
+  801c47:	56                   	push   %esi
+  801c48:	e8 a5 f7 ff ff       	call   8013f2 <fd2data>
+  801c4d:	89 c7                	mov    %eax,%edi
+	off_t pos = fd->fd_offset;
+  801c4f:	8b 4e 04             	mov    0x4(%esi),%ecx
+	ff->buf_rlen = 0;
+  801c52:	c7 46 18 00 00 00 00 	movl   $0x0,0x18(%esi)
+	if (ff->buf_wlen == 0)
+  801c59:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  801c5c:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (ff->buf_wlen == 0)
+  801c61:	83 7e 1c 00          	cmpl   $0x0,0x1c(%esi)
+  801c65:	74 45                	je     801cac <devfile_sync+0x71>
+	fd->fd_offset = ff->buf_base;
+  801c67:	8b 46 14             	mov    0x14(%esi),%eax
+  801c6a:	89 46 04             	mov    %eax,0x4(%esi)
+	for (done = 0, r = 0; done < ff->buf_wlen; done += r)
+  801c6d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c72:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801c77:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  801c7a:	8b 4e 1c             	mov    0x1c(%esi),%ecx
+  801c7d:	39 cb                	cmp    %ecx,%ebx
+  801c7f:	73 14                	jae    801c95 <devfile_sync+0x5a>
+		if ((r = file_write_direct(fd, p + done, ff->buf_wlen - done)) <= 0)
+  801c81:	29 d9                	sub    %ebx,%ecx
+  801c83:	8d 14 1f             	lea    (%edi,%ebx,1),%edx
+  801c86:	89 f0                	mov    %esi,%eax
+  801c88:	e8 21 ff ff ff       	call   801bae <file_write_direct>
+  801c8d:	85 c0                	test   %eax,%eax
+  801c8f:	7e 04                	jle    801c95 <devfile_sync+0x5a>
+	for (done = 0, r = 0; done < ff->buf_wlen; done += r)
+  801c91:	01 c3                	add    %eax,%ebx
+  801c93:	eb e5                	jmp    801c7a <devfile_sync+0x3f>
+	ff->buf_wlen = 0;
+  801c95:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  801c98:	c7 46 1c 00 00 00 00 	movl   $0x0,0x1c(%esi)
+	fd->fd_offset = pos;
+  801c9f:	89 4e 04             	mov    %ecx,0x4(%esi)
+	return r < 0 ? r : 0;
+  801ca2:	85 c0                	test   %eax,%eax
+  801ca4:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ca9:	0f 4f c2             	cmovg  %edx,%eax
+}
+  801cac:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801caf:	5b                   	pop    %ebx
+  801cb0:	5e                   	pop    %esi
+  801cb1:	5f                   	pop    %edi
+  801cb2:	5d                   	pop    %ebp
+  801cb3:	c3                   	ret
+
+00801cb4 <devfile_write>:
+{
+  801cb4:	55                   	push   %ebp
+  801cb5:	89 e5                	mov    %esp,%ebp
+  801cb7:	57                   	push   %edi
+  801cb8:	56                   	push   %esi
+  801cb9:	53                   	push   %ebx
+  801cba:	83 ec 28             	sub    $0x28,%esp
+  801cbd:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801cc0:	8b 75 10             	mov    0x10(%ebp),%esi
+	char *p = fd2data(fd);
+  801cc3:	53                   	push   %ebx
+  801cc4:	e8 29 f7 ff ff       	call   8013f2 <fd2data>
+  801cc9:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	off_t pos = fd->fd_offset;
+  801ccc:	8b 7b 04             	mov    0x4(%ebx),%edi
+	if (!ff->buffered)
+  801ccf:	83 c4 10             	add    $0x10,%esp
+  801cd2:	80 7b 10 00          	cmpb   $0x0,0x10(%ebx)
+  801cd6:	74 43                	je     801d1b <devfile_write+0x67>
+	ff->buf_rlen = 0;
+  801cd8:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+	if (ff->buf_wlen > 0
+  801cdf:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  801ce2:	85 c0                	test   %eax,%eax
+  801ce4:	74 43                	je     801d29 <devfile_write+0x75>
+	    && (pos != ff->buf_base + ff->buf_wlen
+  801ce6:	89 c2                	mov    %eax,%edx
+  801ce8:	03 53 14             	add    0x14(%ebx),%edx
+  801ceb:	39 fa                	cmp    %edi,%edx
+  801ced:	75 0b                	jne    801cfa <devfile_write+0x46>
+		|| ff->buf_wlen + n > FILEBUF_SIZE)
+  801cef:	8d 14 30             	lea    (%eax,%esi,1),%edx
+  801cf2:	81 fa 00 10 00 00    	cmp    $0x1000,%edx
+  801cf8:	76 66                	jbe    801d60 <devfile_write+0xac>
+	    && (r = devfile_sync(fd)) < 0)
+  801cfa:	83 ec 0c             	sub    $0xc,%esp
+  801cfd:	53                   	push   %ebx
+  801cfe:	e8 38 ff ff ff       	call   801c3b <devfile_sync>
+  801d03:	83 c4 10             	add    $0x10,%esp
+  801d06:	85 c0                	test   %eax,%eax
+  801d08:	78 4e                	js     801d58 <devfile_write+0xa4>
+	if (n >= FILEBUF_SIZE)
+  801d0a:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  801d10:	77 56                	ja     801d68 <devfile_write+0xb4>
+	if (ff->buf_wlen == 0)
+  801d12:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  801d15:	85 c0                	test   %eax,%eax
+  801d17:	75 20                	jne    801d39 <devfile_write+0x85>
+  801d19:	eb 16                	jmp    801d31 <devfile_write+0x7d>
+		return file_write_direct(fd, buf, n);
+  801d1b:	89 f1                	mov    %esi,%ecx
+  801d1d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801d20:	89 d8                	mov    %ebx,%eax
+  801d22:	e8 87 fe ff ff       	call   801bae <file_write_direct>
+  801d27:	eb 2f                	jmp    801d58 <devfile_write+0xa4>
+	if (n >= FILEBUF_SIZE)
+  801d29:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  801d2f:	77 37                	ja     801d68 <devfile_write+0xb4>
+		ff->buf_base = pos;
+  801d31:	89 7b 14             	mov    %edi,0x14(%ebx)
+  801d34:	b8 00 00 00 00       	mov    $0x0,%eax
+	memmove(p + ff->buf_wlen, buf, n);
+  801d39:	83 ec 04             	sub    $0x4,%esp
+  801d3c:	56                   	push   %esi
+  801d3d:	ff 75 0c             	push   0xc(%ebp)
+  801d40:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  801d43:	01 c1                	add    %eax,%ecx
+  801d45:	51                   	push   %ecx
+  801d46:	e8 fb ec ff ff       	call   800a46 <memmove>
+	ff->buf_wlen += n;
+  801d4b:	01 73 1c             	add    %esi,0x1c(%ebx)
+	fd->fd_offset = pos + n;
+  801d4e:	01 f7                	add    %esi,%edi
+  801d50:	89 7b 04             	mov    %edi,0x4(%ebx)
+	return n;
+  801d53:	89 f0                	mov    %esi,%eax
+  801d55:	83 c4 10             	add    $0x10,%esp
+}
+  801d58:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801d5b:	5b                   	pop    %ebx
+  801d5c:	5e                   	pop    %esi
+  801d5d:	5f                   	pop    %edi
+  801d5e:	5d                   	pop    %ebp
+  801d5f:	c3                   	ret
+	if (n >= FILEBUF_SIZE)
+  801d60:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  801d66:	76 d1                	jbe    801d39 <devfile_write+0x85>
+		return file_write_direct(fd, buf, n);
+  801d68:	89 f1                	mov    %esi,%ecx
+  801d6a:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801d6d:	89 d8                	mov    %ebx,%eax
+  801d6f:	e8 3a fe ff ff       	call   801bae <file_write_direct>
+  801d74:	eb e2                	jmp    801d58 <devfile_write+0xa4>
+
+00801d76 <devfile_trunc>:
+{
+  801d76:	55                   	push   %ebp
+  801d77:	89 e5                	mov    %esp,%ebp
+  801d79:	53                   	push   %ebx
+  801d7a:	83 ec 10             	sub    $0x10,%esp
+  801d7d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if ((r = devfile_sync(fd)) < 0)
+  801d80:	53                   	push   %ebx
+  801d81:	e8 b5 fe ff ff       	call   801c3b <devfile_sync>
+  801d86:	83 c4 10             	add    $0x10,%esp
+  801d89:	85 c0                	test   %eax,%eax
+  801d8b:	78 1f                	js     801dac <devfile_trunc+0x36>
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801d8d:	8b 43 0c             	mov    0xc(%ebx),%eax
+  801d90:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.set_size.req_size = newsize;
+  801d95:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801d98:	a3 04 70 80 00       	mov    %eax,0x807004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  801d9d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801da2:	b8 02 00 00 00       	mov    $0x2,%eax
+  801da7:	e8 eb fd ff ff       	call   801b97 <fsipc>
+}
+  801dac:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801daf:	c9                   	leave
+  801db0:	c3                   	ret
+
+00801db1 <devfile_stat>:
+{
+  801db1:	55                   	push   %ebp
+  801db2:	89 e5                	mov    %esp,%ebp
+  801db4:	56                   	push   %esi
+  801db5:	53                   	push   %ebx
+  801db6:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801db9:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if ((r = devfile_sync(fd)) < 0)
+  801dbc:	83 ec 0c             	sub    $0xc,%esp
+  801dbf:	53                   	push   %ebx
+  801dc0:	e8 76 fe ff ff       	call   801c3b <devfile_sync>
+  801dc5:	83 c4 10             	add    $0x10,%esp
+  801dc8:	85 c0                	test   %eax,%eax
+  801dca:	78 47                	js     801e13 <devfile_stat+0x62>
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801dcc:	8b 43 0c             	mov    0xc(%ebx),%eax
+  801dcf:	a3 00 70 80 00       	mov    %eax,0x807000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  801dd4:	ba 00 00 00 00       	mov    $0x0,%edx
+  801dd9:	b8 05 00 00 00       	mov    $0x5,%eax
+  801dde:	e8 b4 fd ff ff       	call   801b97 <fsipc>
+  801de3:	85 c0                	test   %eax,%eax
+  801de5:	78 2c                	js     801e13 <devfile_stat+0x62>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801de7:	83 ec 08             	sub    $0x8,%esp
+  801dea:	68 00 70 80 00       	push   $0x807000
+  801def:	56                   	push   %esi
+  801df0:	e8 cb ea ff ff       	call   8008c0 <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  801df5:	a1 80 70 80 00       	mov    0x807080,%eax
+  801dfa:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801e00:	a1 84 70 80 00       	mov    0x807084,%eax
+  801e05:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+	return 0;
+  801e0b:	83 c4 10             	add    $0x10,%esp
+  801e0e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801e13:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801e16:	5b                   	pop    %ebx
+  801e17:	5e                   	pop    %esi
+  801e18:	5d                   	pop    %ebp
+  801e19:	c3                   	ret
+
+00801e1a <devfile_flush>:
+{
+  801e1a:	55                   	push   %ebp
+  801e1b:	89 e5                	mov    %esp,%ebp
+  801e1d:	56                   	push   %esi
+  801e1e:	53                   	push   %ebx
+  801e1f:	8b 75 08             	mov    0x8(%ebp),%esi
+	r = devfile_sync(fd);
+  801e22:	83 ec 0c             	sub    $0xc,%esp
+  801e25:	56                   	push   %esi
+  801e26:	e8 10 fe ff ff       	call   801c3b <devfile_sync>
+  801e2b:	89 c3                	mov    %eax,%ebx
+	if (fd->fd_file.buffered)
+  801e2d:	83 c4 10             	add    $0x10,%esp
+  801e30:	80 7e 10 00          	cmpb   $0x0,0x10(%esi)
+  801e34:	75 25                	jne    801e5b <devfile_flush+0x41>
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801e36:	8b 46 0c             	mov    0xc(%esi),%eax
+  801e39:	a3 00 70 80 00       	mov    %eax,0x807000
+	return fsipc(FSREQ_FLUSH, NULL) ?: r;
+  801e3e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e43:	b8 06 00 00 00       	mov    $0x6,%eax
+  801e48:	e8 4a fd ff ff       	call   801b97 <fsipc>
+  801e4d:	85 c0                	test   %eax,%eax
+  801e4f:	0f 45 d8             	cmovne %eax,%ebx
+}
+  801e52:	89 d8                	mov    %ebx,%eax
+  801e54:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801e57:	5b                   	pop    %ebx
+  801e58:	5e                   	pop    %esi
+  801e59:	5d                   	pop    %ebp
+  801e5a:	c3                   	ret
+		sys_page_unmap(0, fd2data(fd));
+  801e5b:	83 ec 0c             	sub    $0xc,%esp
+  801e5e:	56                   	push   %esi
+  801e5f:	e8 8e f5 ff ff       	call   8013f2 <fd2data>
+  801e64:	83 c4 08             	add    $0x8,%esp
+  801e67:	50                   	push   %eax
+  801e68:	6a 00                	push   $0x0
+  801e6a:	e8 ea ee ff ff       	call   800d59 <sys_page_unmap>
+  801e6f:	83 c4 10             	add    $0x10,%esp
+  801e72:	eb c2                	jmp    801e36 <devfile_flush+0x1c>
+
+00801e74 <fsring_slot>:
+
+// Find a free data page and get fdnum ready for a request on it.
+// Returns the slot number, or < 0 on error.
+static int
+fsring_slot(int fdnum, struct Fd **fd_store)
+{
+  801e74:	55                   	push   %ebp
+  801e75:	89 e5                	mov    %esp,%ebp
+  801e77:	57                   	push   %edi
+  801e78:	56                   	push   %esi
+  801e79:	53                   	push   %ebx
+  801e7a:	83 ec 64             	sub    $0x64,%esp
+  801e7d:	89 d7                	mov    %edx,%edi
+	int r, slot;
+
+	if ((r = fd_lookup(fdnum, fd_store)) < 0)
+  801e7f:	52                   	push   %edx
+  801e80:	50                   	push   %eax
+  801e81:	e8 d9 f5 ff ff       	call   80145f <fd_lookup>
+  801e86:	89 c1                	mov    %eax,%ecx
+  801e88:	83 c4 10             	add    $0x10,%esp
+  801e8b:	85 c0                	test   %eax,%eax
+  801e8d:	0f 88 f2 00 00 00    	js     801f85 <fsring_slot+0x111>
+		return r;
+	if ((*fd_store)->fd_dev_id != devfile.dev_id)
+  801e93:	8b 07                	mov    (%edi),%eax
+  801e95:	8b 15 20 50 80 00    	mov    0x805020,%edx
+  801e9b:	39 10                	cmp    %edx,(%eax)
+  801e9d:	0f 85 03 01 00 00    	jne    801fa6 <fsring_slot+0x132>
+	if (fsring_env == thisenv->env_id)
+  801ea3:	a1 00 60 80 00       	mov    0x806000,%eax
+  801ea8:	8b 40 48             	mov    0x48(%eax),%eax
+  801eab:	3b 05 c4 80 80 00    	cmp    0x8080c4,%eax
+  801eb1:	0f 84 96 00 00 00    	je     801f4d <fsring_slot+0xd9>
+	if (fsenv == 0)
+  801eb7:	83 3d c8 80 80 00 00 	cmpl   $0x0,0x8080c8
+  801ebe:	0f 84 cb 00 00 00    	je     801f8f <fsring_slot+0x11b>
+	pages[0] = (uintptr_t) &fsipcbuf | PTE_P | PTE_W | PTE_U;
+  801ec4:	b8 00 70 80 00       	mov    $0x807000,%eax
+  801ec9:	83 c8 07             	or     $0x7,%eax
+  801ecc:	89 45 a0             	mov    %eax,-0x60(%ebp)
+	for (i = 0; i < FSRING_NPAGES; i++) {
+  801ecf:	8d 75 a4             	lea    -0x5c(%ebp),%esi
+	pages[0] = (uintptr_t) &fsipcbuf | PTE_P | PTE_W | PTE_U;
+  801ed2:	bb 00 00 00 cf       	mov    $0xcf000000,%ebx
+		if ((r = sys_page_alloc(0, (char *) fsring + i * PGSIZE,
+  801ed7:	83 ec 04             	sub    $0x4,%esp
+  801eda:	68 07 04 00 00       	push   $0x407
+  801edf:	53                   	push   %ebx
+  801ee0:	6a 00                	push   $0x0
+  801ee2:	e8 e5 ed ff ff       	call   800ccc <sys_page_alloc>
+  801ee7:	89 c1                	mov    %eax,%ecx
+  801ee9:	83 c4 10             	add    $0x10,%esp
+  801eec:	85 c0                	test   %eax,%eax
+  801eee:	0f 88 91 00 00 00    	js     801f85 <fsring_slot+0x111>
+		pages[1 + i] = ((uintptr_t) fsring + i * PGSIZE) | PTE_P | PTE_W | PTE_U;
+  801ef4:	89 d8                	mov    %ebx,%eax
+  801ef6:	83 c8 07             	or     $0x7,%eax
+  801ef9:	89 06                	mov    %eax,(%esi)
+	for (i = 0; i < FSRING_NPAGES; i++) {
+  801efb:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801f01:	83 c6 04             	add    $0x4,%esi
+  801f04:	81 fb 00 10 01 cf    	cmp    $0xcf011000,%ebx
+  801f0a:	75 cb                	jne    801ed7 <fsring_slot+0x63>
+	ipc_sendv(fsenv, FSREQ_RING_SETUP, pages, ARRAY_SIZE(pages));
+  801f0c:	6a 12                	push   $0x12
+  801f0e:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  801f11:	50                   	push   %eax
+  801f12:	6a 0c                	push   $0xc
+  801f14:	ff 35 c8 80 80 00    	push   0x8080c8
+  801f1a:	e8 d6 1d 00 00       	call   803cf5 <ipc_sendv>
+	if ((r = ipc_recv(NULL, NULL, NULL)) < 0)
+  801f1f:	83 c4 0c             	add    $0xc,%esp
+  801f22:	6a 00                	push   $0x0
+  801f24:	6a 00                	push   $0x0
+  801f26:	6a 00                	push   $0x0
+  801f28:	e8 72 1c 00 00       	call   803b9f <ipc_recv>
+  801f2d:	89 c1                	mov    %eax,%ecx
+  801f2f:	83 c4 10             	add    $0x10,%esp
+  801f32:	85 c0                	test   %eax,%eax
+  801f34:	78 4f                	js     801f85 <fsring_slot+0x111>
+	fsring_env = thisenv->env_id;
+  801f36:	a1 00 60 80 00       	mov    0x806000,%eax
+  801f3b:	8b 40 48             	mov    0x48(%eax),%eax
+  801f3e:	a3 c4 80 80 00       	mov    %eax,0x8080c4
+	fsring_busy = 0;
+  801f43:	c7 05 c0 80 80 00 00 	movl   $0x0,0x8080c0
+  801f4a:	00 00 00 
+		return -E_NOT_SUPP;
+	if ((r = fsring_setup()) < 0)
+		return r;
+	// Buffered writes must reach the server ahead of anything posted.
+	if ((r = devfile_sync(*fd_store)) < 0)
+  801f4d:	83 ec 0c             	sub    $0xc,%esp
+  801f50:	ff 37                	push   (%edi)
+  801f52:	e8 e4 fc ff ff       	call   801c3b <devfile_sync>
+  801f57:	89 c1                	mov    %eax,%ecx
+  801f59:	83 c4 10             	add    $0x10,%esp
+  801f5c:	85 c0                	test   %eax,%eax
+  801f5e:	78 25                	js     801f85 <fsring_slot+0x111>
+		return r;
+	for (slot = 0; slot < FSRING_NSLOTS; slot++)
+		if (!(fsring_busy & (1 << slot)))
+  801f60:	8b 1d c0 80 80 00    	mov    0x8080c0,%ebx
+	for (slot = 0; slot < FSRING_NSLOTS; slot++)
+  801f66:	b9 00 00 00 00       	mov    $0x0,%ecx
+		if (!(fsring_busy & (1 << slot)))
+  801f6b:	ba 01 00 00 00       	mov    $0x1,%edx
+  801f70:	89 d0                	mov    %edx,%eax
+  801f72:	d3 e0                	shl    %cl,%eax
+  801f74:	85 d8                	test   %ebx,%eax
+  801f76:	74 0d                	je     801f85 <fsring_slot+0x111>
+	for (slot = 0; slot < FSRING_NSLOTS; slot++)
+  801f78:	83 c1 01             	add    $0x1,%ecx
+  801f7b:	83 f9 10             	cmp    $0x10,%ecx
+  801f7e:	75 f0                	jne    801f70 <fsring_slot+0xfc>
+			return slot;
+	return -E_NO_MEM;
+  801f80:	b9 fc ff ff ff       	mov    $0xfffffffc,%ecx
+}
+  801f85:	89 c8                	mov    %ecx,%eax
+  801f87:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801f8a:	5b                   	pop    %ebx
+  801f8b:	5e                   	pop    %esi
+  801f8c:	5f                   	pop    %edi
+  801f8d:	5d                   	pop    %ebp
+  801f8e:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801f8f:	83 ec 0c             	sub    $0xc,%esp
+  801f92:	6a 01                	push   $0x1
+  801f94:	e8 aa 1d 00 00       	call   803d43 <ipc_find_env>
+  801f99:	a3 c8 80 80 00       	mov    %eax,0x8080c8
+  801f9e:	83 c4 10             	add    $0x10,%esp
+  801fa1:	e9 1e ff ff ff       	jmp    801ec4 <fsring_slot+0x50>
+		return -E_NOT_SUPP;
+  801fa6:	b9 f1 ff ff ff       	mov    $0xfffffff1,%ecx
+  801fab:	eb d8                	jmp    801f85 <fsring_slot+0x111>
+
+00801fad <file_read_direct>:
+{
+  801fad:	55                   	push   %ebp
+  801fae:	89 e5                	mov    %esp,%ebp
+  801fb0:	57                   	push   %edi
+  801fb1:	56                   	push   %esi
+  801fb2:	53                   	push   %ebx
+  801fb3:	83 ec 1c             	sub    $0x1c,%esp
+  801fb6:	89 c7                	mov    %eax,%edi
+  801fb8:	89 d6                	mov    %edx,%esi
+  801fba:	89 cb                	mov    %ecx,%ebx
+	if (n > PGSIZE) {
+  801fbc:	81 f9 00 10 00 00    	cmp    $0x1000,%ecx
+  801fc2:	77 52                	ja     802016 <file_read_direct+0x69>
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801fc4:	8b 40 0c             	mov    0xc(%eax),%eax
+  801fc7:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.read.req_n = n;
+  801fcc:	89 0d 04 70 80 00    	mov    %ecx,0x807004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  801fd2:	ba 00 00 00 00       	mov    $0x0,%edx
+  801fd7:	b8 03 00 00 00       	mov    $0x3,%eax
+  801fdc:	e8 b6 fb ff ff       	call   801b97 <fsipc>
+  801fe1:	89 c7                	mov    %eax,%edi
+  801fe3:	85 c0                	test   %eax,%eax
+  801fe5:	78 25                	js     80200c <file_read_direct+0x5f>
+	assert(r <= n);
+  801fe7:	39 c3                	cmp    %eax,%ebx
+  801fe9:	0f 82 87 00 00 00    	jb     802076 <file_read_direct+0xc9>
+	assert(r <= PGSIZE);
+  801fef:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  801ff4:	0f 8f 95 00 00 00    	jg     80208f <file_read_direct+0xe2>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  801ffa:	83 ec 04             	sub    $0x4,%esp
+  801ffd:	50                   	push   %eax
+  801ffe:	68 00 70 80 00       	push   $0x807000
+  802003:	56                   	push   %esi
+  802004:	e8 3d ea ff ff       	call   800a46 <memmove>
+	return r;
+  802009:	83 c4 10             	add    $0x10,%esp
+}
+  80200c:	89 f8                	mov    %edi,%eax
+  80200e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802011:	5b                   	pop    %ebx
+  802012:	5e                   	pop    %esi
+  802013:	5f                   	pop    %edi
+  802014:	5d                   	pop    %ebp
+  802015:	c3                   	ret
+		n = MIN(n, FSBULK_MAXPAGES * PGSIZE - PGOFF(buf));
+  802016:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  80201c:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  802021:	29 d1                	sub    %edx,%ecx
+  802023:	39 d9                	cmp    %ebx,%ecx
+  802025:	0f 46 d9             	cmovbe %ecx,%ebx
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  802028:	89 f0                	mov    %esi,%eax
+  80202a:	8d 0c 1e             	lea    (%esi,%ebx,1),%ecx
+  80202d:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  802030:	eb 0f                	jmp    802041 <file_read_direct+0x94>
+		*(volatile char *) p = *(volatile char *) p;
+  802032:	0f b6 10             	movzbl (%eax),%edx
+  802035:	88 10                	mov    %dl,(%eax)
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  802037:	05 00 10 00 00       	add    $0x1000,%eax
+  80203c:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  802041:	39 c8                	cmp    %ecx,%eax
+  802043:	72 ed                	jb     802032 <file_read_direct+0x85>
+	fsipcbuf.bulk.req_fileid = fileid;
+  802045:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802048:	8b 47 0c             	mov    0xc(%edi),%eax
+  80204b:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.bulk.req_n = n;
+  802050:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+	fsipcbuf.bulk.req_off = PGOFF(buf);
+  802056:	89 15 08 70 80 00    	mov    %edx,0x807008
+	return fsipc_pages(type, buf, n, perm);
+  80205c:	83 ec 0c             	sub    $0xc,%esp
+  80205f:	6a 07                	push   $0x7
+  802061:	89 d9                	mov    %ebx,%ecx
+  802063:	89 f2                	mov    %esi,%edx
+  802065:	b8 09 00 00 00       	mov    $0x9,%eax
+  80206a:	e8 86 f9 ff ff       	call   8019f5 <fsipc_pages>
+  80206f:	89 c7                	mov    %eax,%edi
+		return fsipc_bulk(FSREQ_READ_BULK, fd->fd_file.id, buf, n,
+  802071:	83 c4 10             	add    $0x10,%esp
+  802074:	eb 96                	jmp    80200c <file_read_direct+0x5f>
+	assert(r <= n);
+  802076:	68 9b 45 80 00       	push   $0x80459b
+  80207b:	68 ac 44 80 00       	push   $0x8044ac
+  802080:	68 dc 00 00 00       	push   $0xdc
+  802085:	68 90 45 80 00       	push   $0x804590
+  80208a:	e8 68 e1 ff ff       	call   8001f7 <_panic>
+	assert(r <= PGSIZE);
+  80208f:	68 ac 45 80 00       	push   $0x8045ac
+  802094:	68 ac 44 80 00       	push   $0x8044ac
+  802099:	68 dd 00 00 00       	push   $0xdd
+  80209e:	68 90 45 80 00       	push   $0x804590
+  8020a3:	e8 4f e1 ff ff       	call   8001f7 <_panic>
+
+008020a8 <devfile_read>:
+{
+  8020a8:	55                   	push   %ebp
+  8020a9:	89 e5                	mov    %esp,%ebp
+  8020ab:	57                   	push   %edi
+  8020ac:	56                   	push   %esi
+  8020ad:	53                   	push   %ebx
+  8020ae:	83 ec 28             	sub    $0x28,%esp
+  8020b1:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8020b4:	8b 75 10             	mov    0x10(%ebp),%esi
+	char *p = fd2data(fd);
+  8020b7:	53                   	push   %ebx
+  8020b8:	e8 35 f3 ff ff       	call   8013f2 <fd2data>
+  8020bd:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	off_t pos = fd->fd_offset;
+  8020c0:	8b 7b 04             	mov    0x4(%ebx),%edi
+	if (!ff->buffered)
+  8020c3:	83 c4 10             	add    $0x10,%esp
+  8020c6:	80 7b 10 00          	cmpb   $0x0,0x10(%ebx)
+  8020ca:	74 7d                	je     802149 <devfile_read+0xa1>
+	if (ff->buf_wlen > 0 && (r = devfile_sync(fd)) < 0)
+  8020cc:	83 7b 1c 00          	cmpl   $0x0,0x1c(%ebx)
+  8020d0:	0f 85 81 00 00 00    	jne    802157 <devfile_read+0xaf>
+	if (ff->buf_rlen == 0 || pos < ff->buf_base
+  8020d6:	8b 43 18             	mov    0x18(%ebx),%eax
+  8020d9:	85 c0                	test   %eax,%eax
+  8020db:	74 0d                	je     8020ea <devfile_read+0x42>
+  8020dd:	8b 53 14             	mov    0x14(%ebx),%edx
+  8020e0:	39 fa                	cmp    %edi,%edx
+  8020e2:	7f 06                	jg     8020ea <devfile_read+0x42>
+	    || pos >= ff->buf_base + ff->buf_rlen) {
+  8020e4:	01 c2                	add    %eax,%edx
+  8020e6:	39 d7                	cmp    %edx,%edi
+  8020e8:	72 28                	jb     802112 <devfile_read+0x6a>
+		ff->buf_rlen = 0;
+  8020ea:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+		if (n >= FILEBUF_SIZE)
+  8020f1:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  8020f7:	77 74                	ja     80216d <devfile_read+0xc5>
+		if ((r = file_read_direct(fd, p, FILEBUF_SIZE)) <= 0)
+  8020f9:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8020fe:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802101:	89 d8                	mov    %ebx,%eax
+  802103:	e8 a5 fe ff ff       	call   801fad <file_read_direct>
+  802108:	85 c0                	test   %eax,%eax
+  80210a:	7e 35                	jle    802141 <devfile_read+0x99>
+		ff->buf_base = pos;
+  80210c:	89 7b 14             	mov    %edi,0x14(%ebx)
+		ff->buf_rlen = r;
+  80210f:	89 43 18             	mov    %eax,0x18(%ebx)
+	n = MIN(n, ff->buf_base + ff->buf_rlen - pos);
+  802112:	8b 53 14             	mov    0x14(%ebx),%edx
+  802115:	89 d0                	mov    %edx,%eax
+  802117:	03 43 18             	add    0x18(%ebx),%eax
+  80211a:	29 f8                	sub    %edi,%eax
+  80211c:	39 f0                	cmp    %esi,%eax
+  80211e:	0f 46 f0             	cmovbe %eax,%esi
+	memmove(buf, p + (pos - ff->buf_base), n);
+  802121:	83 ec 04             	sub    $0x4,%esp
+  802124:	56                   	push   %esi
+  802125:	89 f8                	mov    %edi,%eax
+  802127:	29 d0                	sub    %edx,%eax
+  802129:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  80212c:	01 c1                	add    %eax,%ecx
+  80212e:	51                   	push   %ecx
+  80212f:	ff 75 0c             	push   0xc(%ebp)
+  802132:	e8 0f e9 ff ff       	call   800a46 <memmove>
+	fd->fd_offset = pos + n;
+  802137:	01 f7                	add    %esi,%edi
+  802139:	89 7b 04             	mov    %edi,0x4(%ebx)
+	return n;
+  80213c:	89 f0                	mov    %esi,%eax
+  80213e:	83 c4 10             	add    $0x10,%esp
+}
+  802141:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802144:	5b                   	pop    %ebx
+  802145:	5e                   	pop    %esi
+  802146:	5f                   	pop    %edi
+  802147:	5d                   	pop    %ebp
+  802148:	c3                   	ret
+		return file_read_direct(fd, buf, n);
+  802149:	89 f1                	mov    %esi,%ecx
+  80214b:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80214e:	89 d8                	mov    %ebx,%eax
+  802150:	e8 58 fe ff ff       	call   801fad <file_read_direct>
+  802155:	eb ea                	jmp    802141 <devfile_read+0x99>
+	if (ff->buf_wlen > 0 && (r = devfile_sync(fd)) < 0)
+  802157:	83 ec 0c             	sub    $0xc,%esp
+  80215a:	53                   	push   %ebx
+  80215b:	e8 db fa ff ff       	call   801c3b <devfile_sync>
+  802160:	83 c4 10             	add    $0x10,%esp
+  802163:	85 c0                	test   %eax,%eax
+  802165:	0f 89 6b ff ff ff    	jns    8020d6 <devfile_read+0x2e>
+  80216b:	eb d4                	jmp    802141 <devfile_read+0x99>
+			return file_read_direct(fd, buf, n);
+  80216d:	89 f1                	mov    %esi,%ecx
+  80216f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802172:	89 d8                	mov    %ebx,%eax
+  802174:	e8 34 fe ff ff       	call   801fad <file_read_direct>
+  802179:	eb c6                	jmp    802141 <devfile_read+0x99>
+
+0080217b <open>:
+{
+  80217b:	55                   	push   %ebp
+  80217c:	89 e5                	mov    %esp,%ebp
+  80217e:	56                   	push   %esi
+  80217f:	53                   	push   %ebx
+  802180:	83 ec 1c             	sub    $0x1c,%esp
+  802183:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  802186:	56                   	push   %esi
+  802187:	e8 f9 e6 ff ff       	call   800885 <strlen>
+  80218c:	83 c4 10             	add    $0x10,%esp
+  80218f:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802194:	0f 8f a0 00 00 00    	jg     80223a <open+0xbf>
+	if ((r = fd_alloc(&fd)) < 0)
+  80219a:	83 ec 0c             	sub    $0xc,%esp
+  80219d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8021a0:	50                   	push   %eax
+  8021a1:	e8 63 f2 ff ff       	call   801409 <fd_alloc>
+  8021a6:	89 c3                	mov    %eax,%ebx
+  8021a8:	83 c4 10             	add    $0x10,%esp
+  8021ab:	85 c0                	test   %eax,%eax
+  8021ad:	78 45                	js     8021f4 <open+0x79>
+	strcpy(fsipcbuf.open.req_path, path);
+  8021af:	83 ec 08             	sub    $0x8,%esp
+  8021b2:	56                   	push   %esi
+  8021b3:	68 00 70 80 00       	push   $0x807000
+  8021b8:	e8 03 e7 ff ff       	call   8008c0 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  8021bd:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8021c0:	a3 00 74 80 00       	mov    %eax,0x807400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  8021c5:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8021c8:	b8 01 00 00 00       	mov    $0x1,%eax
+  8021cd:	e8 c5 f9 ff ff       	call   801b97 <fsipc>
+  8021d2:	89 c3                	mov    %eax,%ebx
+  8021d4:	83 c4 10             	add    $0x10,%esp
+  8021d7:	85 c0                	test   %eax,%eax
+  8021d9:	78 22                	js     8021fd <open+0x82>
+	if (!(mode & O_NOBUF)
+  8021db:	f7 45 0c 00 10 00 00 	testl  $0x1000,0xc(%ebp)
+  8021e2:	74 2b                	je     80220f <open+0x94>
+	return fd2num(fd);
+  8021e4:	83 ec 0c             	sub    $0xc,%esp
+  8021e7:	ff 75 f4             	push   -0xc(%ebp)
+  8021ea:	e8 f3 f1 ff ff       	call   8013e2 <fd2num>
+  8021ef:	89 c3                	mov    %eax,%ebx
+  8021f1:	83 c4 10             	add    $0x10,%esp
+}
+  8021f4:	89 d8                	mov    %ebx,%eax
+  8021f6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8021f9:	5b                   	pop    %ebx
+  8021fa:	5e                   	pop    %esi
+  8021fb:	5d                   	pop    %ebp
+  8021fc:	c3                   	ret
+		fd_close(fd, 0);
+  8021fd:	83 ec 08             	sub    $0x8,%esp
+  802200:	6a 00                	push   $0x0
+  802202:	ff 75 f4             	push   -0xc(%ebp)
+  802205:	e8 f8 f2 ff ff       	call   801502 <fd_close>
+		return r;
+  80220a:	83 c4 10             	add    $0x10,%esp
+  80220d:	eb e5                	jmp    8021f4 <open+0x79>
+	    && sys_page_alloc(0, fd2data(fd), PTE_P|PTE_U|PTE_W|PTE_SHARE) == 0)
+  80220f:	83 ec 0c             	sub    $0xc,%esp
+  802212:	ff 75 f4             	push   -0xc(%ebp)
+  802215:	e8 d8 f1 ff ff       	call   8013f2 <fd2data>
+  80221a:	83 c4 0c             	add    $0xc,%esp
+  80221d:	68 07 04 00 00       	push   $0x407
+  802222:	50                   	push   %eax
+  802223:	6a 00                	push   $0x0
+  802225:	e8 a2 ea ff ff       	call   800ccc <sys_page_alloc>
+  80222a:	83 c4 10             	add    $0x10,%esp
+  80222d:	85 c0                	test   %eax,%eax
+  80222f:	75 b3                	jne    8021e4 <open+0x69>
+		fd->fd_file.buffered = 1;
+  802231:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802234:	c6 40 10 01          	movb   $0x1,0x10(%eax)
+  802238:	eb aa                	jmp    8021e4 <open+0x69>
+		return -E_BAD_PATH;
+  80223a:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  80223f:	eb b3                	jmp    8021f4 <open+0x79>
+
+00802241 <readdir>:
+{
+  802241:	55                   	push   %ebp
+  802242:	89 e5                	mov    %esp,%ebp
+  802244:	53                   	push   %ebx
+  802245:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802248:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80224b:	50                   	push   %eax
+  80224c:	ff 75 08             	push   0x8(%ebp)
+  80224f:	e8 0b f2 ff ff       	call   80145f <fd_lookup>
+  802254:	89 c3                	mov    %eax,%ebx
+  802256:	83 c4 10             	add    $0x10,%esp
+  802259:	85 c0                	test   %eax,%eax
+  80225b:	78 73                	js     8022d0 <readdir+0x8f>
+	if (fd->fd_dev_id != devfile.dev_id)
+  80225d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802260:	8b 0d 20 50 80 00    	mov    0x805020,%ecx
+  802266:	39 08                	cmp    %ecx,(%eax)
+  802268:	0f 85 82 00 00 00    	jne    8022f0 <readdir+0xaf>
+	if ((r = devfile_sync(fd)) < 0)
+  80226e:	83 ec 0c             	sub    $0xc,%esp
+  802271:	50                   	push   %eax
+  802272:	e8 c4 f9 ff ff       	call   801c3b <devfile_sync>
+  802277:	89 c3                	mov    %eax,%ebx
+  802279:	83 c4 10             	add    $0x10,%esp
+  80227c:	85 c0                	test   %eax,%eax
+  80227e:	78 50                	js     8022d0 <readdir+0x8f>
+	fsipcbuf.readdir.req_fileid = fd->fd_file.id;
+  802280:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802283:	8b 40 0c             	mov    0xc(%eax),%eax
+  802286:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.readdir.req_n = n;
+  80228b:	8b 45 10             	mov    0x10(%ebp),%eax
+  80228e:	a3 04 70 80 00       	mov    %eax,0x807004
+	fsipcbuf.readdir.req_flags = flags;
+  802293:	8b 45 14             	mov    0x14(%ebp),%eax
+  802296:	a3 08 70 80 00       	mov    %eax,0x807008
+	if ((r = fsipc(FSREQ_READDIR, NULL)) <= 0)
+  80229b:	ba 00 00 00 00       	mov    $0x0,%edx
+  8022a0:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8022a5:	e8 ed f8 ff ff       	call   801b97 <fsipc>
+  8022aa:	89 c3                	mov    %eax,%ebx
+  8022ac:	85 c0                	test   %eax,%eax
+  8022ae:	7e 20                	jle    8022d0 <readdir+0x8f>
+	assert(r <= n && r <= PGSIZE);
+  8022b0:	39 45 10             	cmp    %eax,0x10(%ebp)
+  8022b3:	72 22                	jb     8022d7 <readdir+0x96>
+  8022b5:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  8022ba:	7f 1b                	jg     8022d7 <readdir+0x96>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  8022bc:	83 ec 04             	sub    $0x4,%esp
+  8022bf:	50                   	push   %eax
+  8022c0:	68 00 70 80 00       	push   $0x807000
+  8022c5:	ff 75 0c             	push   0xc(%ebp)
+  8022c8:	e8 79 e7 ff ff       	call   800a46 <memmove>
+	return r;
+  8022cd:	83 c4 10             	add    $0x10,%esp
+}
+  8022d0:	89 d8                	mov    %ebx,%eax
+  8022d2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8022d5:	c9                   	leave
+  8022d6:	c3                   	ret
+	assert(r <= n && r <= PGSIZE);
+  8022d7:	68 a2 45 80 00       	push   $0x8045a2
+  8022dc:	68 ac 44 80 00       	push   $0x8044ac
+  8022e1:	68 86 01 00 00       	push   $0x186
+  8022e6:	68 90 45 80 00       	push   $0x804590
+  8022eb:	e8 07 df ff ff       	call   8001f7 <_panic>
+		return -E_NOT_SUPP;
+  8022f0:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  8022f5:	eb d9                	jmp    8022d0 <readdir+0x8f>
+
+008022f7 <munmap>:
+{
+  8022f7:	55                   	push   %ebp
+  8022f8:	89 e5                	mov    %esp,%ebp
+  8022fa:	56                   	push   %esi
+  8022fb:	53                   	push   %ebx
+  8022fc:	8b 75 08             	mov    0x8(%ebp),%esi
+  8022ff:	8b 55 0c             	mov    0xc(%ebp),%edx
+	if (PGOFF(addr) || (uintptr_t) addr >= UTOP || len > UTOP - (uintptr_t) addr)
+  802302:	f7 c6 ff 0f 00 00    	test   $0xfff,%esi
+  802308:	75 41                	jne    80234b <munmap+0x54>
+  80230a:	81 fe ff ff bf ee    	cmp    $0xeebfffff,%esi
+  802310:	77 39                	ja     80234b <munmap+0x54>
+  802312:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  802317:	29 f0                	sub    %esi,%eax
+  802319:	39 d0                	cmp    %edx,%eax
+  80231b:	72 35                	jb     802352 <munmap+0x5b>
+	for (va = (uintptr_t) addr; va < (uintptr_t) addr + len; va += PGSIZE)
+  80231d:	89 f3                	mov    %esi,%ebx
+  80231f:	01 d6                	add    %edx,%esi
+  802321:	39 f3                	cmp    %esi,%ebx
+  802323:	73 1a                	jae    80233f <munmap+0x48>
+		if ((r = sys_page_unmap(0, (void *) va)) < 0)
+  802325:	83 ec 08             	sub    $0x8,%esp
+  802328:	53                   	push   %ebx
+  802329:	6a 00                	push   $0x0
+  80232b:	e8 29 ea ff ff       	call   800d59 <sys_page_unmap>
+  802330:	83 c4 10             	add    $0x10,%esp
+  802333:	85 c0                	test   %eax,%eax
+  802335:	78 0d                	js     802344 <munmap+0x4d>
+	for (va = (uintptr_t) addr; va < (uintptr_t) addr + len; va += PGSIZE)
+  802337:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  80233d:	eb e2                	jmp    802321 <munmap+0x2a>
+	return 0;
+  80233f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802344:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802347:	5b                   	pop    %ebx
+  802348:	5e                   	pop    %esi
+  802349:	5d                   	pop    %ebp
+  80234a:	c3                   	ret
+		return -E_INVAL;
+  80234b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802350:	eb f2                	jmp    802344 <munmap+0x4d>
+  802352:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802357:	eb eb                	jmp    802344 <munmap+0x4d>
+
+00802359 <mmap>:
+{
+  802359:	55                   	push   %ebp
+  80235a:	89 e5                	mov    %esp,%ebp
+  80235c:	57                   	push   %edi
+  80235d:	56                   	push   %esi
+  80235e:	53                   	push   %ebx
+  80235f:	83 ec 34             	sub    $0x34,%esp
+  802362:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802365:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  802368:	50                   	push   %eax
+  802369:	ff 75 18             	push   0x18(%ebp)
+  80236c:	e8 ee f0 ff ff       	call   80145f <fd_lookup>
+  802371:	89 c3                	mov    %eax,%ebx
+  802373:	83 c4 10             	add    $0x10,%esp
+  802376:	85 c0                	test   %eax,%eax
+  802378:	0f 88 0e 01 00 00    	js     80248c <mmap+0x133>
+	if (fd->fd_dev_id != devfile.dev_id)
+  80237e:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802381:	a1 20 50 80 00       	mov    0x805020,%eax
+  802386:	39 02                	cmp    %eax,(%edx)
+  802388:	0f 85 50 01 00 00    	jne    8024de <mmap+0x185>
+	if ((prot & PROT_WRITE) && !(flags & MAP_PRIVATE))
+  80238e:	8b 45 10             	mov    0x10(%ebp),%eax
+  802391:	83 e0 02             	and    $0x2,%eax
+  802394:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  802397:	74 0a                	je     8023a3 <mmap+0x4a>
+  802399:	f6 45 14 02          	testb  $0x2,0x14(%ebp)
+  80239d:	0f 84 42 01 00 00    	je     8024e5 <mmap+0x18c>
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY
+  8023a3:	8b 42 08             	mov    0x8(%edx),%eax
+  8023a6:	83 e0 03             	and    $0x3,%eax
+  8023a9:	83 f8 01             	cmp    $0x1,%eax
+  8023ac:	0f 84 3a 01 00 00    	je     8024ec <mmap+0x193>
+	    || PGOFF(addr) || PGOFF(offset) || offset < 0
+  8023b2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8023b5:	0b 45 1c             	or     0x1c(%ebp),%eax
+  8023b8:	25 ff 0f 00 00       	and    $0xfff,%eax
+  8023bd:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8023c0:	0f 85 2d 01 00 00    	jne    8024f3 <mmap+0x19a>
+	    || (uintptr_t) addr >= UTOP || len > UTOP - (uintptr_t) addr)
+  8023c6:	83 7d 1c 00          	cmpl   $0x0,0x1c(%ebp)
+  8023ca:	0f 88 2a 01 00 00    	js     8024fa <mmap+0x1a1>
+  8023d0:	81 7d 08 ff ff bf ee 	cmpl   $0xeebfffff,0x8(%ebp)
+  8023d7:	0f 87 1d 01 00 00    	ja     8024fa <mmap+0x1a1>
+  8023dd:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  8023e2:	2b 45 08             	sub    0x8(%ebp),%eax
+  8023e5:	39 f8                	cmp    %edi,%eax
+  8023e7:	0f 82 14 01 00 00    	jb     802501 <mmap+0x1a8>
+	if ((r = devfile_sync(fd)) < 0)
+  8023ed:	83 ec 0c             	sub    $0xc,%esp
+  8023f0:	52                   	push   %edx
+  8023f1:	e8 45 f8 ff ff       	call   801c3b <devfile_sync>
+  8023f6:	89 c3                	mov    %eax,%ebx
+  8023f8:	83 c4 10             	add    $0x10,%esp
+  8023fb:	85 c0                	test   %eax,%eax
+  8023fd:	0f 88 89 00 00 00    	js     80248c <mmap+0x133>
+	len = ROUNDUP(len, PGSIZE);
+  802403:	81 c7 ff 0f 00 00    	add    $0xfff,%edi
+  802409:	81 e7 00 f0 ff ff    	and    $0xfffff000,%edi
+	for (done = 0; done < len; done += n * PGSIZE) {
+  80240f:	be 00 00 00 00       	mov    $0x0,%esi
+  802414:	8b 5d 1c             	mov    0x1c(%ebp),%ebx
+  802417:	39 fe                	cmp    %edi,%esi
+  802419:	73 7b                	jae    802496 <mmap+0x13d>
+		n = MIN((len - done) / PGSIZE, FSBULK_MAXPAGES);
+  80241b:	89 f8                	mov    %edi,%eax
+  80241d:	29 f0                	sub    %esi,%eax
+  80241f:	c1 e8 0c             	shr    $0xc,%eax
+  802422:	ba 40 00 00 00       	mov    $0x40,%edx
+  802427:	39 d0                	cmp    %edx,%eax
+  802429:	0f 47 c2             	cmova  %edx,%eax
+  80242c:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		fsipcbuf.map.req_fileid = fd->fd_file.id;
+  80242f:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802432:	8b 52 0c             	mov    0xc(%edx),%edx
+  802435:	89 15 00 70 80 00    	mov    %edx,0x807000
+		fsipcbuf.map.req_offset = offset + done;
+  80243b:	8d 14 33             	lea    (%ebx,%esi,1),%edx
+  80243e:	89 15 04 70 80 00    	mov    %edx,0x807004
+		fsipcbuf.map.req_npages = n;
+  802444:	a3 08 70 80 00       	mov    %eax,0x807008
+		if ((r = fsipcv(FSREQ_MAP, addr + done, &n)) <= 0 || n == 0) {
+  802449:	89 f2                	mov    %esi,%edx
+  80244b:	03 55 08             	add    0x8(%ebp),%edx
+  80244e:	8d 4d e0             	lea    -0x20(%ebp),%ecx
+  802451:	b8 0b 00 00 00       	mov    $0xb,%eax
+  802456:	e8 ea f6 ff ff       	call   801b45 <fsipcv>
+  80245b:	85 c0                	test   %eax,%eax
+  80245d:	7e 12                	jle    802471 <mmap+0x118>
+  80245f:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802462:	85 c0                	test   %eax,%eax
+  802464:	0f 84 9e 00 00 00    	je     802508 <mmap+0x1af>
+	for (done = 0; done < len; done += n * PGSIZE) {
+  80246a:	c1 e0 0c             	shl    $0xc,%eax
+  80246d:	01 c6                	add    %eax,%esi
+  80246f:	eb a6                	jmp    802417 <mmap+0xbe>
+			munmap(addr, done);
+  802471:	89 c3                	mov    %eax,%ebx
+  802473:	83 ec 08             	sub    $0x8,%esp
+  802476:	56                   	push   %esi
+  802477:	ff 75 08             	push   0x8(%ebp)
+  80247a:	e8 78 fe ff ff       	call   8022f7 <munmap>
+			return r < 0 ? r : -E_INVAL;
+  80247f:	83 c4 10             	add    $0x10,%esp
+  802482:	85 db                	test   %ebx,%ebx
+  802484:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802489:	0f 49 d8             	cmovns %eax,%ebx
+}
+  80248c:	89 d8                	mov    %ebx,%eax
+  80248e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802491:	5b                   	pop    %ebx
+  802492:	5e                   	pop    %esi
+  802493:	5f                   	pop    %edi
+  802494:	5d                   	pop    %ebp
+  802495:	c3                   	ret
+	if (prot & PROT_WRITE)
+  802496:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+	return 0;
+  802499:	89 c3                	mov    %eax,%ebx
+	if (prot & PROT_WRITE)
+  80249b:	85 c0                	test   %eax,%eax
+  80249d:	74 ed                	je     80248c <mmap+0x133>
+		for (done = 0; done < len; done += PGSIZE)
+  80249f:	be 00 00 00 00       	mov    $0x0,%esi
+  8024a4:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8024a7:	39 fe                	cmp    %edi,%esi
+  8024a9:	73 2e                	jae    8024d9 <mmap+0x180>
+			if ((r = cowpage(addr + done)) < 0) {
+  8024ab:	83 ec 0c             	sub    $0xc,%esp
+  8024ae:	8d 04 33             	lea    (%ebx,%esi,1),%eax
+  8024b1:	50                   	push   %eax
+  8024b2:	e8 2d ed ff ff       	call   8011e4 <cowpage>
+  8024b7:	83 c4 10             	add    $0x10,%esp
+  8024ba:	85 c0                	test   %eax,%eax
+  8024bc:	78 08                	js     8024c6 <mmap+0x16d>
+		for (done = 0; done < len; done += PGSIZE)
+  8024be:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  8024c4:	eb e1                	jmp    8024a7 <mmap+0x14e>
+				munmap(addr, len);
+  8024c6:	89 c3                	mov    %eax,%ebx
+  8024c8:	83 ec 08             	sub    $0x8,%esp
+  8024cb:	57                   	push   %edi
+  8024cc:	ff 75 08             	push   0x8(%ebp)
+  8024cf:	e8 23 fe ff ff       	call   8022f7 <munmap>
+				return r;
+  8024d4:	83 c4 10             	add    $0x10,%esp
+  8024d7:	eb b3                	jmp    80248c <mmap+0x133>
+	return 0;
+  8024d9:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  8024dc:	eb ae                	jmp    80248c <mmap+0x133>
+		return -E_NOT_SUPP;
+  8024de:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  8024e3:	eb a7                	jmp    80248c <mmap+0x133>
+		return -E_NOT_SUPP;
+  8024e5:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  8024ea:	eb a0                	jmp    80248c <mmap+0x133>
+		return -E_INVAL;
+  8024ec:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  8024f1:	eb 99                	jmp    80248c <mmap+0x133>
+  8024f3:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  8024f8:	eb 92                	jmp    80248c <mmap+0x133>
+  8024fa:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  8024ff:	eb 8b                	jmp    80248c <mmap+0x133>
+  802501:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  802506:	eb 84                	jmp    80248c <mmap+0x133>
+			munmap(addr, done);
+  802508:	83 ec 08             	sub    $0x8,%esp
+  80250b:	56                   	push   %esi
+  80250c:	ff 75 08             	push   0x8(%ebp)
+  80250f:	e8 e3 fd ff ff       	call   8022f7 <munmap>
+  802514:	83 c4 10             	add    $0x10,%esp
+			return r < 0 ? r : -E_INVAL;
+  802517:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  80251c:	e9 6b ff ff ff       	jmp    80248c <mmap+0x133>
+
+00802521 <fsring_read>:
+// buf.  fsring_reap returns 'tag' with the result once done.
+// Returns 0 on success, < 0 on error; -E_NO_MEM means too many requests
+// are outstanding, and some must be reaped first.
+int
+fsring_read(int fdnum, void *buf, size_t n, off_t offset, uint32_t tag)
+{
+  802521:	55                   	push   %ebp
+  802522:	89 e5                	mov    %esp,%ebp
+  802524:	56                   	push   %esi
+  802525:	53                   	push   %ebx
+  802526:	83 ec 10             	sub    $0x10,%esp
+  802529:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	struct Fd *fd;
+	int slot;
+
+	if ((slot = fsring_slot(fdnum, &fd)) < 0)
+  80252c:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  80252f:	8b 45 08             	mov    0x8(%ebp),%eax
+  802532:	e8 3d f9 ff ff       	call   801e74 <fsring_slot>
+  802537:	85 c0                	test   %eax,%eax
+  802539:	78 60                	js     80259b <fsring_read+0x7a>
+		return slot;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY)
+  80253b:	8b 75 f4             	mov    -0xc(%ebp),%esi
+  80253e:	8b 56 08             	mov    0x8(%esi),%edx
+  802541:	83 e2 03             	and    $0x3,%edx
+  802544:	83 fa 01             	cmp    $0x1,%edx
+  802547:	74 59                	je     8025a2 <fsring_read+0x81>
+		return -E_INVAL;
+	fsring_busy |= 1 << slot;
+  802549:	ba 01 00 00 00       	mov    $0x1,%edx
+  80254e:	89 c1                	mov    %eax,%ecx
+  802550:	d3 e2                	shl    %cl,%edx
+  802552:	09 15 c0 80 80 00    	or     %edx,0x8080c0
+	fsring_slots[slot].s_type = FSREQ_READ;
+  802558:	8d 14 40             	lea    (%eax,%eax,2),%edx
+  80255b:	c1 e2 02             	shl    $0x2,%edx
+  80255e:	8d 8a 00 80 80 00    	lea    0x808000(%edx),%ecx
+  802564:	c7 82 00 80 80 00 03 	movl   $0x3,0x808000(%edx)
+  80256b:	00 00 00 
+	fsring_slots[slot].s_tag = tag;
+  80256e:	8b 55 18             	mov    0x18(%ebp),%edx
+  802571:	89 51 04             	mov    %edx,0x4(%ecx)
+	fsring_slots[slot].s_buf = buf;
+  802574:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802577:	89 51 08             	mov    %edx,0x8(%ecx)
+	return fsring_post(FSREQ_READ, fd, offset, MIN(n, PGSIZE), slot);
+  80257a:	83 ec 08             	sub    $0x8,%esp
+  80257d:	50                   	push   %eax
+  80257e:	b8 00 10 00 00       	mov    $0x1000,%eax
+  802583:	39 c3                	cmp    %eax,%ebx
+  802585:	0f 47 d8             	cmova  %eax,%ebx
+  802588:	53                   	push   %ebx
+  802589:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  80258c:	89 f2                	mov    %esi,%edx
+  80258e:	b8 03 00 00 00       	mov    $0x3,%eax
+  802593:	e8 1e f5 ff ff       	call   801ab6 <fsring_post>
+  802598:	83 c4 10             	add    $0x10,%esp
+}
+  80259b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80259e:	5b                   	pop    %ebx
+  80259f:	5e                   	pop    %esi
+  8025a0:	5d                   	pop    %ebp
+  8025a1:	c3                   	ret
+		return -E_INVAL;
+  8025a2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8025a7:	eb f2                	jmp    80259b <fsring_read+0x7a>
+
+008025a9 <fsring_write>:
+// Start writing up to n bytes (at most a page) from buf at 'offset' of
+// fdnum.  buf may be reused as soon as this returns.
+// Returns as fsring_read.
+int
+fsring_write(int fdnum, const void *buf, size_t n, off_t offset, uint32_t tag)
+{
+  8025a9:	55                   	push   %ebp
+  8025aa:	89 e5                	mov    %esp,%ebp
+  8025ac:	56                   	push   %esi
+  8025ad:	53                   	push   %ebx
+  8025ae:	83 ec 10             	sub    $0x10,%esp
+  8025b1:	8b 75 10             	mov    0x10(%ebp),%esi
+	struct Fd *fd;
+	int slot;
+
+	if ((slot = fsring_slot(fdnum, &fd)) < 0)
+  8025b4:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8025b7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8025ba:	e8 b5 f8 ff ff       	call   801e74 <fsring_slot>
+  8025bf:	89 c3                	mov    %eax,%ebx
+  8025c1:	85 c0                	test   %eax,%eax
+  8025c3:	78 77                	js     80263c <fsring_write+0x93>
+		return slot;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY)
+  8025c5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8025c8:	f6 40 08 03          	testb  $0x3,0x8(%eax)
+  8025cc:	74 77                	je     802645 <fsring_write+0x9c>
+		return -E_INVAL;
+	n = MIN(n, PGSIZE);
+  8025ce:	b8 00 10 00 00       	mov    $0x1000,%eax
+  8025d3:	39 c6                	cmp    %eax,%esi
+  8025d5:	0f 47 f0             	cmova  %eax,%esi
+	memmove((char *) fsring + (1 + slot) * PGSIZE, buf, n);
+  8025d8:	83 ec 04             	sub    $0x4,%esp
+  8025db:	56                   	push   %esi
+  8025dc:	ff 75 0c             	push   0xc(%ebp)
+  8025df:	89 d8                	mov    %ebx,%eax
+  8025e1:	c1 e0 0c             	shl    $0xc,%eax
+  8025e4:	8d 80 00 10 00 cf    	lea    -0x30fff000(%eax),%eax
+  8025ea:	50                   	push   %eax
+  8025eb:	e8 56 e4 ff ff       	call   800a46 <memmove>
+	fsring_busy |= 1 << slot;
+  8025f0:	b8 01 00 00 00       	mov    $0x1,%eax
+  8025f5:	89 d9                	mov    %ebx,%ecx
+  8025f7:	d3 e0                	shl    %cl,%eax
+  8025f9:	09 05 c0 80 80 00    	or     %eax,0x8080c0
+	fsring_slots[slot].s_type = FSREQ_WRITE;
+  8025ff:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  802602:	c1 e0 02             	shl    $0x2,%eax
+  802605:	8d 90 00 80 80 00    	lea    0x808000(%eax),%edx
+  80260b:	c7 80 00 80 80 00 04 	movl   $0x4,0x808000(%eax)
+  802612:	00 00 00 
+	fsring_slots[slot].s_tag = tag;
+  802615:	8b 45 18             	mov    0x18(%ebp),%eax
+  802618:	89 42 04             	mov    %eax,0x4(%edx)
+	fsring_slots[slot].s_buf = NULL;
+  80261b:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	return fsring_post(FSREQ_WRITE, fd, offset, n, slot);
+  802622:	83 c4 08             	add    $0x8,%esp
+  802625:	53                   	push   %ebx
+  802626:	56                   	push   %esi
+  802627:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  80262a:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80262d:	b8 04 00 00 00       	mov    $0x4,%eax
+  802632:	e8 7f f4 ff ff       	call   801ab6 <fsring_post>
+  802637:	89 c3                	mov    %eax,%ebx
+  802639:	83 c4 10             	add    $0x10,%esp
+}
+  80263c:	89 d8                	mov    %ebx,%eax
+  80263e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802641:	5b                   	pop    %ebx
+  802642:	5e                   	pop    %esi
+  802643:	5d                   	pop    %ebp
+  802644:	c3                   	ret
+		return -E_INVAL;
+  802645:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  80264a:	eb f0                	jmp    80263c <fsring_write+0x93>
+
+0080264c <fsring_stat>:
+
+// Start a stat of fdnum into *st.  Returns as fsring_read.
+int
+fsring_stat(int fdnum, struct Stat *st, uint32_t tag)
+{
+  80264c:	55                   	push   %ebp
+  80264d:	89 e5                	mov    %esp,%ebp
+  80264f:	83 ec 18             	sub    $0x18,%esp
+	struct Fd *fd;
+	int slot;
+
+	if ((slot = fsring_slot(fdnum, &fd)) < 0)
+  802652:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802655:	8b 45 08             	mov    0x8(%ebp),%eax
+  802658:	e8 17 f8 ff ff       	call   801e74 <fsring_slot>
+  80265d:	85 c0                	test   %eax,%eax
+  80265f:	78 4c                	js     8026ad <fsring_stat+0x61>
+		return slot;
+	fsring_busy |= 1 << slot;
+  802661:	ba 01 00 00 00       	mov    $0x1,%edx
+  802666:	89 c1                	mov    %eax,%ecx
+  802668:	d3 e2                	shl    %cl,%edx
+  80266a:	09 15 c0 80 80 00    	or     %edx,0x8080c0
+	fsring_slots[slot].s_type = FSREQ_STAT;
+  802670:	8d 14 40             	lea    (%eax,%eax,2),%edx
+  802673:	c1 e2 02             	shl    $0x2,%edx
+  802676:	8d 8a 00 80 80 00    	lea    0x808000(%edx),%ecx
+  80267c:	c7 82 00 80 80 00 05 	movl   $0x5,0x808000(%edx)
+  802683:	00 00 00 
+	fsring_slots[slot].s_tag = tag;
+  802686:	8b 55 10             	mov    0x10(%ebp),%edx
+  802689:	89 51 04             	mov    %edx,0x4(%ecx)
+	fsring_slots[slot].s_buf = st;
+  80268c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80268f:	89 51 08             	mov    %edx,0x8(%ecx)
+	return fsring_post(FSREQ_STAT, fd, 0, 0, slot);
+  802692:	83 ec 08             	sub    $0x8,%esp
+  802695:	50                   	push   %eax
+  802696:	6a 00                	push   $0x0
+  802698:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80269d:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8026a0:	b8 05 00 00 00       	mov    $0x5,%eax
+  8026a5:	e8 0c f4 ff ff       	call   801ab6 <fsring_post>
+  8026aa:	83 c4 10             	add    $0x10,%esp
+}
+  8026ad:	c9                   	leave
+  8026ae:	c3                   	ret
+
+008026af <fsring_reap>:
+// If none has finished, wait for one if 'wait' is set and any are
+// outstanding.
+// Returns 1 if a result was collected, 0 if not.
+int
+fsring_reap(uint32_t *tag_store, int *result_store, bool wait)
+{
+  8026af:	55                   	push   %ebp
+  8026b0:	89 e5                	mov    %esp,%ebp
+  8026b2:	57                   	push   %edi
+  8026b3:	56                   	push   %esi
+  8026b4:	53                   	push   %ebx
+  8026b5:	83 ec 1c             	sub    $0x1c,%esp
+  8026b8:	0f b6 5d 10          	movzbl 0x10(%ebp),%ebx
+	struct Fsring_cqe cqe;
+	struct Fsret_stat *ret;
+	struct Stat *st;
+	char *data;
+
+	if (fsring_env != thisenv->env_id)
+  8026bc:	a1 00 60 80 00       	mov    0x806000,%eax
+  8026c1:	8b 40 48             	mov    0x48(%eax),%eax
+  8026c4:	3b 05 c4 80 80 00    	cmp    0x8080c4,%eax
+  8026ca:	74 12                	je     8026de <fsring_reap+0x2f>
+		return 0;
+  8026cc:	b8 00 00 00 00       	mov    $0x0,%eax
+	}
+	fsring_busy &= ~(1 << cqe.cqe_slot);
+	*tag_store = fsring_slots[cqe.cqe_slot].s_tag;
+	*result_store = cqe.cqe_result;
+	return 1;
+}
+  8026d1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8026d4:	5b                   	pop    %ebx
+  8026d5:	5e                   	pop    %esi
+  8026d6:	5f                   	pop    %edi
+  8026d7:	5d                   	pop    %ebp
+  8026d8:	c3                   	ret
+		sys_yield();
+  8026d9:	e8 cf e5 ff ff       	call   800cad <sys_yield>
+	while (fsring->r_cqhead == fsring->r_cqtail) {
+  8026de:	8b 15 08 00 00 cf    	mov    0xcf000008,%edx
+  8026e4:	a1 0c 00 00 cf       	mov    0xcf00000c,%eax
+  8026e9:	39 c2                	cmp    %eax,%edx
+  8026eb:	75 18                	jne    802705 <fsring_reap+0x56>
+		if (!wait || fsring_busy == 0)
+  8026ed:	84 db                	test   %bl,%bl
+  8026ef:	0f 84 21 01 00 00    	je     802816 <fsring_reap+0x167>
+  8026f5:	83 3d c0 80 80 00 00 	cmpl   $0x0,0x8080c0
+  8026fc:	75 db                	jne    8026d9 <fsring_reap+0x2a>
+			return 0;
+  8026fe:	b8 00 00 00 00       	mov    $0x0,%eax
+  802703:	eb cc                	jmp    8026d1 <fsring_reap+0x22>
+	cqe = fsring->r_cq[fsring->r_cqhead % FSRING_NSLOTS];
+  802705:	a1 08 00 00 cf       	mov    0xcf000008,%eax
+  80270a:	83 e0 0f             	and    $0xf,%eax
+  80270d:	83 c0 2a             	add    $0x2a,%eax
+  802710:	8b 1c c5 00 00 00 cf 	mov    -0x31000000(,%eax,8),%ebx
+  802717:	8b 3c c5 04 00 00 cf 	mov    -0x30fffffc(,%eax,8),%edi
+	fsring->r_cqhead++;
+  80271e:	a1 08 00 00 cf       	mov    0xcf000008,%eax
+  802723:	83 c0 01             	add    $0x1,%eax
+  802726:	a3 08 00 00 cf       	mov    %eax,0xcf000008
+	if (cqe.cqe_slot >= FSRING_NSLOTS || !(fsring_busy & (1 << cqe.cqe_slot)))
+  80272b:	83 fb 0f             	cmp    $0xf,%ebx
+  80272e:	77 5b                	ja     80278b <fsring_reap+0xdc>
+  802730:	be 01 00 00 00       	mov    $0x1,%esi
+  802735:	89 d9                	mov    %ebx,%ecx
+  802737:	d3 e6                	shl    %cl,%esi
+  802739:	89 f0                	mov    %esi,%eax
+  80273b:	23 05 c0 80 80 00    	and    0x8080c0,%eax
+  802741:	74 48                	je     80278b <fsring_reap+0xdc>
+	data = (char *) fsring + (1 + cqe.cqe_slot) * PGSIZE;
+  802743:	89 d8                	mov    %ebx,%eax
+  802745:	c1 e0 0c             	shl    $0xc,%eax
+  802748:	8d 80 00 10 00 cf    	lea    -0x30fff000(%eax),%eax
+  80274e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	switch (fsring_slots[cqe.cqe_slot].s_type) {
+  802751:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  802754:	8b 04 85 00 80 80 00 	mov    0x808000(,%eax,4),%eax
+  80275b:	83 f8 03             	cmp    $0x3,%eax
+  80275e:	74 40                	je     8027a0 <fsring_reap+0xf1>
+  802760:	83 f8 05             	cmp    $0x5,%eax
+  802763:	74 64                	je     8027c9 <fsring_reap+0x11a>
+	fsring_busy &= ~(1 << cqe.cqe_slot);
+  802765:	f7 d6                	not    %esi
+  802767:	21 35 c0 80 80 00    	and    %esi,0x8080c0
+	*tag_store = fsring_slots[cqe.cqe_slot].s_tag;
+  80276d:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  802770:	8b 14 85 04 80 80 00 	mov    0x808004(,%eax,4),%edx
+  802777:	8b 45 08             	mov    0x8(%ebp),%eax
+  80277a:	89 10                	mov    %edx,(%eax)
+	*result_store = cqe.cqe_result;
+  80277c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80277f:	89 38                	mov    %edi,(%eax)
+	return 1;
+  802781:	b8 01 00 00 00       	mov    $0x1,%eax
+  802786:	e9 46 ff ff ff       	jmp    8026d1 <fsring_reap+0x22>
+		panic("fsring_reap: bad slot %u", cqe.cqe_slot);
+  80278b:	53                   	push   %ebx
+  80278c:	68 b8 45 80 00       	push   $0x8045b8
+  802791:	68 8f 02 00 00       	push   $0x28f
+  802796:	68 90 45 80 00       	push   $0x804590
+  80279b:	e8 57 da ff ff       	call   8001f7 <_panic>
+		if (cqe.cqe_result > 0)
+  8027a0:	85 ff                	test   %edi,%edi
+  8027a2:	7e c1                	jle    802765 <fsring_reap+0xb6>
+			memmove(fsring_slots[cqe.cqe_slot].s_buf, data,
+  8027a4:	83 ec 04             	sub    $0x4,%esp
+				MIN(cqe.cqe_result, PGSIZE));
+  8027a7:	b8 00 10 00 00       	mov    $0x1000,%eax
+  8027ac:	39 c7                	cmp    %eax,%edi
+  8027ae:	0f 4e c7             	cmovle %edi,%eax
+			memmove(fsring_slots[cqe.cqe_slot].s_buf, data,
+  8027b1:	50                   	push   %eax
+  8027b2:	ff 75 e4             	push   -0x1c(%ebp)
+  8027b5:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  8027b8:	ff 34 85 08 80 80 00 	push   0x808008(,%eax,4)
+  8027bf:	e8 82 e2 ff ff       	call   800a46 <memmove>
+  8027c4:	83 c4 10             	add    $0x10,%esp
+  8027c7:	eb 9c                	jmp    802765 <fsring_reap+0xb6>
+		if (cqe.cqe_result == 0) {
+  8027c9:	85 ff                	test   %edi,%edi
+  8027cb:	75 98                	jne    802765 <fsring_reap+0xb6>
+			st = fsring_slots[cqe.cqe_slot].s_buf;
+  8027cd:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  8027d0:	8b 0c 85 08 80 80 00 	mov    0x808008(,%eax,4),%ecx
+			strcpy(st->st_name, ret->ret_name);
+  8027d7:	83 ec 08             	sub    $0x8,%esp
+  8027da:	ff 75 e4             	push   -0x1c(%ebp)
+  8027dd:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  8027e0:	51                   	push   %ecx
+  8027e1:	e8 da e0 ff ff       	call   8008c0 <strcpy>
+			st->st_size = ret->ret_size;
+  8027e6:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8027e9:	8b 82 80 00 00 00    	mov    0x80(%edx),%eax
+  8027ef:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  8027f2:	89 81 80 00 00 00    	mov    %eax,0x80(%ecx)
+			st->st_isdir = ret->ret_isdir;
+  8027f8:	8b 82 84 00 00 00    	mov    0x84(%edx),%eax
+  8027fe:	89 81 84 00 00 00    	mov    %eax,0x84(%ecx)
+			st->st_dev = &devfile;
+  802804:	c7 81 88 00 00 00 20 	movl   $0x805020,0x88(%ecx)
+  80280b:	50 80 00 
+  80280e:	83 c4 10             	add    $0x10,%esp
+  802811:	e9 4f ff ff ff       	jmp    802765 <fsring_reap+0xb6>
+			return 0;
+  802816:	b8 00 00 00 00       	mov    $0x0,%eax
+  80281b:	e9 b1 fe ff ff       	jmp    8026d1 <fsring_reap+0x22>
+
+00802820 <file_slurp>:
+// page are copied through fsipcbuf; larger ones go straight into buf's
+// pages, and stop at FSBULK_MAXPAGES of them.
+// Returns the number of bytes read, 0 for directories, or < 0 on error.
+ssize_t
+file_slurp(const char *path, void *buf, size_t n, struct Stat *st)
+{
+  802820:	55                   	push   %ebp
+  802821:	89 e5                	mov    %esp,%ebp
+  802823:	57                   	push   %edi
+  802824:	56                   	push   %esi
+  802825:	53                   	push   %ebx
+  802826:	83 ec 28             	sub    $0x28,%esp
+  802829:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80282c:	8b 7d 10             	mov    0x10(%ebp),%edi
+  80282f:	8b 75 14             	mov    0x14(%ebp),%esi
+	const char *name;
+	int r;
+
+	if (strlen(path) >= MAXPATHLEN)
+  802832:	53                   	push   %ebx
+  802833:	e8 4d e0 ff ff       	call   800885 <strlen>
+  802838:	83 c4 10             	add    $0x10,%esp
+  80283b:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802840:	0f 8f 02 01 00 00    	jg     802948 <file_slurp+0x128>
+		return -E_BAD_PATH;
+
+	strcpy(fsipcbuf.slurp.req_path, path);
+  802846:	83 ec 08             	sub    $0x8,%esp
+  802849:	53                   	push   %ebx
+  80284a:	68 00 70 80 00       	push   $0x807000
+  80284f:	e8 6c e0 ff ff       	call   8008c0 <strcpy>
+	if (n > sizeof(fsipcbuf.slurpRet.ret_buf)) {
+  802854:	83 c4 10             	add    $0x10,%esp
+  802857:	81 ff f8 0f 00 00    	cmp    $0xff8,%edi
+  80285d:	76 69                	jbe    8028c8 <file_slurp+0xa8>
+		n = MIN(n, FSBULK_MAXPAGES * PGSIZE - PGOFF(buf));
+  80285f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802862:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  802868:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  80286d:	29 d1                	sub    %edx,%ecx
+  80286f:	39 f9                	cmp    %edi,%ecx
+  802871:	0f 46 f9             	cmovbe %ecx,%edi
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  802874:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802877:	89 f9                	mov    %edi,%ecx
+  802879:	01 c1                	add    %eax,%ecx
+  80287b:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  80287e:	eb 0f                	jmp    80288f <file_slurp+0x6f>
+		*(volatile char *) p = *(volatile char *) p;
+  802880:	0f b6 10             	movzbl (%eax),%edx
+  802883:	88 10                	mov    %dl,(%eax)
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  802885:	05 00 10 00 00       	add    $0x1000,%eax
+  80288a:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  80288f:	39 c8                	cmp    %ecx,%eax
+  802891:	72 ed                	jb     802880 <file_slurp+0x60>
+		fsipc_touch(buf, n);
+		fsipcbuf.slurp.req_n = n;
+  802893:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802896:	89 3d 00 74 80 00    	mov    %edi,0x807400
+		fsipcbuf.slurp.req_off = PGOFF(buf);
+  80289c:	89 15 04 74 80 00    	mov    %edx,0x807404
+		r = fsipc_pages(FSREQ_SLURP, buf, n, PTE_P | PTE_W | PTE_U);
+  8028a2:	83 ec 0c             	sub    $0xc,%esp
+  8028a5:	6a 07                	push   $0x7
+  8028a7:	89 f9                	mov    %edi,%ecx
+  8028a9:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8028ac:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8028b1:	e8 3f f1 ff ff       	call   8019f5 <fsipc_pages>
+  8028b6:	89 c7                	mov    %eax,%edi
+  8028b8:	83 c4 10             	add    $0x10,%esp
+			memmove(buf, fsipcbuf.slurpRet.ret_buf, r);
+	}
+	if (r < 0)
+		return r;
+
+	if (st) {
+  8028bb:	85 f6                	test   %esi,%esi
+  8028bd:	74 7f                	je     80293e <file_slurp+0x11e>
+  8028bf:	8d 43 01             	lea    0x1(%ebx),%eax
+  8028c2:	85 ff                	test   %edi,%edi
+  8028c4:	79 3c                	jns    802902 <file_slurp+0xe2>
+  8028c6:	eb 76                	jmp    80293e <file_slurp+0x11e>
+		fsipcbuf.slurp.req_n = n;
+  8028c8:	89 3d 00 74 80 00    	mov    %edi,0x807400
+		if ((r = fsipc(FSREQ_SLURP, NULL)) > 0)
+  8028ce:	ba 00 00 00 00       	mov    $0x0,%edx
+  8028d3:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8028d8:	e8 ba f2 ff ff       	call   801b97 <fsipc>
+  8028dd:	89 c7                	mov    %eax,%edi
+  8028df:	85 c0                	test   %eax,%eax
+  8028e1:	7e d8                	jle    8028bb <file_slurp+0x9b>
+			memmove(buf, fsipcbuf.slurpRet.ret_buf, r);
+  8028e3:	83 ec 04             	sub    $0x4,%esp
+  8028e6:	50                   	push   %eax
+  8028e7:	68 08 70 80 00       	push   $0x807008
+  8028ec:	ff 75 0c             	push   0xc(%ebp)
+  8028ef:	e8 52 e1 ff ff       	call   800a46 <memmove>
+  8028f4:	83 c4 10             	add    $0x10,%esp
+  8028f7:	eb c2                	jmp    8028bb <file_slurp+0x9b>
+		for (name = path; *path; path++)
+			if (*path == '/')
+				name = path + 1;
+  8028f9:	80 fa 2f             	cmp    $0x2f,%dl
+  8028fc:	0f 44 d9             	cmove  %ecx,%ebx
+		for (name = path; *path; path++)
+  8028ff:	83 c0 01             	add    $0x1,%eax
+  802902:	89 c1                	mov    %eax,%ecx
+  802904:	0f b6 50 ff          	movzbl -0x1(%eax),%edx
+  802908:	84 d2                	test   %dl,%dl
+  80290a:	75 ed                	jne    8028f9 <file_slurp+0xd9>
+		strlcpy(st->st_name, name, sizeof(st->st_name));
+  80290c:	83 ec 04             	sub    $0x4,%esp
+  80290f:	68 80 00 00 00       	push   $0x80
+  802914:	53                   	push   %ebx
+  802915:	56                   	push   %esi
+  802916:	e8 1b e0 ff ff       	call   800936 <strlcpy>
+		st->st_size = fsipcbuf.slurpRet.ret_size;
+  80291b:	a1 00 70 80 00       	mov    0x807000,%eax
+  802920:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+		st->st_isdir = fsipcbuf.slurpRet.ret_isdir;
+  802926:	a1 04 70 80 00       	mov    0x807004,%eax
+  80292b:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+		st->st_dev = &devfile;
+  802931:	c7 86 88 00 00 00 20 	movl   $0x805020,0x88(%esi)
+  802938:	50 80 00 
+  80293b:	83 c4 10             	add    $0x10,%esp
+	}
+	return r;
+}
+  80293e:	89 f8                	mov    %edi,%eax
+  802940:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802943:	5b                   	pop    %ebx
+  802944:	5e                   	pop    %esi
+  802945:	5f                   	pop    %edi
+  802946:	5d                   	pop    %ebp
+  802947:	c3                   	ret
+		return -E_BAD_PATH;
+  802948:	bf f4 ff ff ff       	mov    $0xfffffff4,%edi
+  80294d:	eb ef                	jmp    80293e <file_slurp+0x11e>
+
+0080294f <remove>:
+
+// Delete a file
+int
+remove(const char *path)
+{
+  80294f:	55                   	push   %ebp
+  802950:	89 e5                	mov    %esp,%ebp
+  802952:	53                   	push   %ebx
+  802953:	83 ec 10             	sub    $0x10,%esp
+  802956:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (strlen(path) >= MAXPATHLEN)
+  802959:	53                   	push   %ebx
+  80295a:	e8 26 df ff ff       	call   800885 <strlen>
+  80295f:	83 c4 10             	add    $0x10,%esp
+  802962:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802967:	7f 25                	jg     80298e <remove+0x3f>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.remove.req_path, path);
+  802969:	83 ec 08             	sub    $0x8,%esp
+  80296c:	53                   	push   %ebx
+  80296d:	68 00 70 80 00       	push   $0x807000
+  802972:	e8 49 df ff ff       	call   8008c0 <strcpy>
+	return fsipc(FSREQ_REMOVE, NULL);
+  802977:	ba 00 00 00 00       	mov    $0x0,%edx
+  80297c:	b8 07 00 00 00       	mov    $0x7,%eax
+  802981:	e8 11 f2 ff ff       	call   801b97 <fsipc>
+  802986:	83 c4 10             	add    $0x10,%esp
+}
+  802989:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80298c:	c9                   	leave
+  80298d:	c3                   	ret
+		return -E_BAD_PATH;
+  80298e:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  802993:	eb f4                	jmp    802989 <remove+0x3a>
+
+00802995 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  802995:	55                   	push   %ebp
+  802996:	89 e5                	mov    %esp,%ebp
+  802998:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  80299b:	ba 00 00 00 00       	mov    $0x0,%edx
+  8029a0:	b8 08 00 00 00       	mov    $0x8,%eax
+  8029a5:	e8 ed f1 ff ff       	call   801b97 <fsipc>
+}
+  8029aa:	c9                   	leave
+  8029ab:	c3                   	ret
+
+008029ac <defrag>:
+// Have the file server lay out the blocks of 'path' contiguously on
+// disk.  Stores the number of extents the file had before and has
+// after in *before and *after, if they are not null.
+int
+defrag(const char *path, uint32_t *before, uint32_t *after)
+{
+  8029ac:	55                   	push   %ebp
+  8029ad:	89 e5                	mov    %esp,%ebp
+  8029af:	57                   	push   %edi
+  8029b0:	56                   	push   %esi
+  8029b1:	53                   	push   %ebx
+  8029b2:	83 ec 18             	sub    $0x18,%esp
+  8029b5:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8029b8:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8029bb:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int r;
+
+	if (strlen(path) >= MAXPATHLEN)
+  8029be:	57                   	push   %edi
+  8029bf:	e8 c1 de ff ff       	call   800885 <strlen>
+  8029c4:	83 c4 10             	add    $0x10,%esp
+  8029c7:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8029cc:	7f 4c                	jg     802a1a <defrag+0x6e>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.defrag.req_path, path);
+  8029ce:	83 ec 08             	sub    $0x8,%esp
+  8029d1:	57                   	push   %edi
+  8029d2:	68 00 70 80 00       	push   $0x807000
+  8029d7:	e8 e4 de ff ff       	call   8008c0 <strcpy>
+	if ((r = fsipc(FSREQ_DEFRAG, NULL)) < 0)
+  8029dc:	ba 00 00 00 00       	mov    $0x0,%edx
+  8029e1:	b8 10 00 00 00       	mov    $0x10,%eax
+  8029e6:	e8 ac f1 ff ff       	call   801b97 <fsipc>
+  8029eb:	83 c4 10             	add    $0x10,%esp
+  8029ee:	85 c0                	test   %eax,%eax
+  8029f0:	78 20                	js     802a12 <defrag+0x66>
+		return r;
+	if (before)
+  8029f2:	85 f6                	test   %esi,%esi
+  8029f4:	74 07                	je     8029fd <defrag+0x51>
+		*before = fsipcbuf.defragRet.ret_before;
+  8029f6:	a1 00 70 80 00       	mov    0x807000,%eax
+  8029fb:	89 06                	mov    %eax,(%esi)
+	if (after)
+		*after = fsipcbuf.defragRet.ret_after;
+	return 0;
+  8029fd:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (after)
+  802a02:	85 db                	test   %ebx,%ebx
+  802a04:	74 0c                	je     802a12 <defrag+0x66>
+		*after = fsipcbuf.defragRet.ret_after;
+  802a06:	a1 04 70 80 00       	mov    0x807004,%eax
+  802a0b:	89 03                	mov    %eax,(%ebx)
+	return 0;
+  802a0d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802a12:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802a15:	5b                   	pop    %ebx
+  802a16:	5e                   	pop    %esi
+  802a17:	5f                   	pop    %edi
+  802a18:	5d                   	pop    %ebp
+  802a19:	c3                   	ret
+		return -E_BAD_PATH;
+  802a1a:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  802a1f:	eb f1                	jmp    802a12 <defrag+0x66>
+
+00802a21 <fs_bcstats>:
+
+// Copy the file server's block cache statistics into *st.
+int
+fs_bcstats(struct BcStats *st)
+{
+  802a21:	55                   	push   %ebp
+  802a22:	89 e5                	mov    %esp,%ebp
+  802a24:	53                   	push   %ebx
+  802a25:	83 ec 04             	sub    $0x4,%esp
+  802a28:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if ((r = fsipc(FSREQ_BCSTATS, NULL)) < 0)
+  802a2b:	ba 00 00 00 00       	mov    $0x0,%edx
+  802a30:	b8 11 00 00 00       	mov    $0x11,%eax
+  802a35:	e8 5d f1 ff ff       	call   801b97 <fsipc>
+  802a3a:	85 c0                	test   %eax,%eax
+  802a3c:	78 34                	js     802a72 <fs_bcstats+0x51>
+		return r;
+	*st = fsipcbuf.bcstatsRet;
+  802a3e:	a1 00 70 80 00       	mov    0x807000,%eax
+  802a43:	89 03                	mov    %eax,(%ebx)
+  802a45:	a1 04 70 80 00       	mov    0x807004,%eax
+  802a4a:	89 43 04             	mov    %eax,0x4(%ebx)
+  802a4d:	a1 08 70 80 00       	mov    0x807008,%eax
+  802a52:	89 43 08             	mov    %eax,0x8(%ebx)
+  802a55:	a1 0c 70 80 00       	mov    0x80700c,%eax
+  802a5a:	89 43 0c             	mov    %eax,0xc(%ebx)
+  802a5d:	a1 10 70 80 00       	mov    0x807010,%eax
+  802a62:	89 43 10             	mov    %eax,0x10(%ebx)
+  802a65:	a1 14 70 80 00       	mov    0x807014,%eax
+  802a6a:	89 43 14             	mov    %eax,0x14(%ebx)
+	return 0;
+  802a6d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802a72:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802a75:	c9                   	leave
+  802a76:	c3                   	ret
+
+00802a77 <spawn>:
+// argv: pointer to null-terminated array of pointers to strings,
+// 	 which will be passed to the child as its command-line arguments.
+// Returns child envid on success, < 0 on failure.
+int
+spawn(const char *prog, const char **argv)
+{
+  802a77:	55                   	push   %ebp
+  802a78:	89 e5                	mov    %esp,%ebp
+  802a7a:	57                   	push   %edi
+  802a7b:	56                   	push   %esi
+  802a7c:	53                   	push   %ebx
+  802a7d:	81 ec a4 02 00 00    	sub    $0x2a4,%esp
+	//   - Call sys_env_set_trapframe(child, &child_tf) to set up the
+	//     correct initial eip and esp values in the child.
+	//
+	//   - Start the child process running with sys_env_set_status().
+
+	if ((r = open(prog, O_RDONLY)) < 0)
+  802a83:	6a 00                	push   $0x0
+  802a85:	ff 75 08             	push   0x8(%ebp)
+  802a88:	e8 ee f6 ff ff       	call   80217b <open>
+  802a8d:	89 85 7c fd ff ff    	mov    %eax,-0x284(%ebp)
+  802a93:	83 c4 10             	add    $0x10,%esp
+  802a96:	85 c0                	test   %eax,%eax
+  802a98:	0f 88 39 06 00 00    	js     8030d7 <spawn+0x660>
+  802a9e:	89 c1                	mov    %eax,%ecx
+		return r;
+	fd = r;
+
+	// Read elf header
+	elf = (struct Elf*) elf_buf;
+	if (readn(fd, elf_buf, sizeof(elf_buf)) != sizeof(elf_buf)
+  802aa0:	83 ec 04             	sub    $0x4,%esp
+  802aa3:	68 00 02 00 00       	push   $0x200
+  802aa8:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+  802aae:	50                   	push   %eax
+  802aaf:	51                   	push   %ecx
+  802ab0:	e8 97 ec ff ff       	call   80174c <readn>
+  802ab5:	83 c4 10             	add    $0x10,%esp
+  802ab8:	3d 00 02 00 00       	cmp    $0x200,%eax
+  802abd:	75 5a                	jne    802b19 <spawn+0xa2>
+	    || elf->e_magic != ELF_MAGIC) {
+  802abf:	81 bd e8 fd ff ff 7f 	cmpl   $0x464c457f,-0x218(%ebp)
+  802ac6:	45 4c 46 
+  802ac9:	75 4e                	jne    802b19 <spawn+0xa2>
+  802acb:	b8 07 00 00 00       	mov    $0x7,%eax
+  802ad0:	cd 30                	int    $0x30
+  802ad2:	89 85 8c fd ff ff    	mov    %eax,-0x274(%ebp)
+		cprintf("elf magic %08x want %08x\n", elf->e_magic, ELF_MAGIC);
+		return -E_NOT_EXEC;
+	}
+
+	// Create new child environment
+	if ((r = sys_exofork()) < 0)
+  802ad8:	85 c0                	test   %eax,%eax
+  802ada:	0f 88 eb 05 00 00    	js     8030cb <spawn+0x654>
+		return r;
+	child = r;
+
+	// Set up trap frame, including initial stack.
+	child_tf = envs[ENVX(child)].env_tf;
+  802ae0:	25 ff 03 00 00       	and    $0x3ff,%eax
+  802ae5:	69 f0 8c 00 00 00    	imul   $0x8c,%eax,%esi
+  802aeb:	81 c6 00 00 c0 ee    	add    $0xeec00000,%esi
+  802af1:	8d bd a4 fd ff ff    	lea    -0x25c(%ebp),%edi
+  802af7:	b9 11 00 00 00       	mov    $0x11,%ecx
+  802afc:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+	child_tf.tf_eip = elf->e_entry;
+  802afe:	8b 85 00 fe ff ff    	mov    -0x200(%ebp),%eax
+  802b04:	89 85 d4 fd ff ff    	mov    %eax,-0x22c(%ebp)
+	uintptr_t *argv_store;
+
+	// Count the number of arguments (argc)
+	// and the total amount of space needed for strings (string_size).
+	string_size = 0;
+	for (argc = 0; argv[argc] != 0; argc++)
+  802b0a:	bb 00 00 00 00       	mov    $0x0,%ebx
+	string_size = 0;
+  802b0f:	be 00 00 00 00       	mov    $0x0,%esi
+  802b14:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	for (argc = 0; argv[argc] != 0; argc++)
+  802b17:	eb 4b                	jmp    802b64 <spawn+0xed>
+		close(fd);
+  802b19:	83 ec 0c             	sub    $0xc,%esp
+  802b1c:	ff b5 7c fd ff ff    	push   -0x284(%ebp)
+  802b22:	e8 62 ea ff ff       	call   801589 <close>
+		cprintf("elf magic %08x want %08x\n", elf->e_magic, ELF_MAGIC);
+  802b27:	83 c4 0c             	add    $0xc,%esp
+  802b2a:	68 7f 45 4c 46       	push   $0x464c457f
+  802b2f:	ff b5 e8 fd ff ff    	push   -0x218(%ebp)
+  802b35:	68 d1 45 80 00       	push   $0x8045d1
+  802b3a:	e8 93 d7 ff ff       	call   8002d2 <cprintf>
+		return -E_NOT_EXEC;
+  802b3f:	83 c4 10             	add    $0x10,%esp
+  802b42:	c7 85 7c fd ff ff f2 	movl   $0xfffffff2,-0x284(%ebp)
+  802b49:	ff ff ff 
+  802b4c:	e9 86 05 00 00       	jmp    8030d7 <spawn+0x660>
+		string_size += strlen(argv[argc]) + 1;
+  802b51:	83 ec 0c             	sub    $0xc,%esp
+  802b54:	50                   	push   %eax
+  802b55:	e8 2b dd ff ff       	call   800885 <strlen>
+  802b5a:	8d 74 06 01          	lea    0x1(%esi,%eax,1),%esi
+	for (argc = 0; argv[argc] != 0; argc++)
+  802b5e:	83 c3 01             	add    $0x1,%ebx
+  802b61:	83 c4 10             	add    $0x10,%esp
+  802b64:	8b 04 9f             	mov    (%edi,%ebx,4),%eax
+  802b67:	85 c0                	test   %eax,%eax
+  802b69:	75 e6                	jne    802b51 <spawn+0xda>
+	// Determine where to place the strings and the argv array.
+	// Set up pointers into the temporary page 'UTEMP'; we'll map a page
+	// there later, then remap that page into the child environment
+	// at (USTACKTOP - PGSIZE).
+	// strings is the topmost thing on the stack.
+	string_store = (char*) UTEMP + PGSIZE - string_size;
+  802b6b:	89 9d 88 fd ff ff    	mov    %ebx,-0x278(%ebp)
+  802b71:	bf 00 10 40 00       	mov    $0x401000,%edi
+  802b76:	29 f7                	sub    %esi,%edi
+	// argv is below that.  There's one argument pointer per argument, plus
+	// a null pointer.
+	argv_store = (uintptr_t*) (ROUNDDOWN(string_store, 4) - 4 * (argc + 1));
+  802b78:	89 fa                	mov    %edi,%edx
+  802b7a:	83 e2 fc             	and    $0xfffffffc,%edx
+  802b7d:	8d 04 9d 04 00 00 00 	lea    0x4(,%ebx,4),%eax
+  802b84:	29 c2                	sub    %eax,%edx
+  802b86:	89 95 94 fd ff ff    	mov    %edx,-0x26c(%ebp)
+
+	// Make sure that argv, strings, and the 2 words that hold 'argc'
+	// and 'argv' themselves will all fit in a single stack page.
+	if ((void*) (argv_store - 2) < (void*) UTEMP)
+  802b8c:	8d 42 f8             	lea    -0x8(%edx),%eax
+  802b8f:	3d ff ff 3f 00       	cmp    $0x3fffff,%eax
+  802b94:	0f 86 59 05 00 00    	jbe    8030f3 <spawn+0x67c>
+		return -E_NO_MEM;
+
+	// Allocate the single stack page at UTEMP.
+	if ((r = sys_page_alloc(0, (void*) UTEMP, PTE_P|PTE_U|PTE_W)) < 0)
+  802b9a:	83 ec 04             	sub    $0x4,%esp
+  802b9d:	6a 07                	push   $0x7
+  802b9f:	68 00 00 40 00       	push   $0x400000
+  802ba4:	6a 00                	push   $0x0
+  802ba6:	e8 21 e1 ff ff       	call   800ccc <sys_page_alloc>
+  802bab:	83 c4 10             	add    $0x10,%esp
+  802bae:	85 c0                	test   %eax,%eax
+  802bb0:	0f 88 42 05 00 00    	js     8030f8 <spawn+0x681>
+	//	  (Again, argv should use an address valid in the child's
+	//	  environment.)
+	//
+	//	* Set *init_esp to the initial stack pointer for the child,
+	//	  (Again, use an address valid in the child's environment.)
+	for (i = 0; i < argc; i++) {
+  802bb6:	be 00 00 00 00       	mov    $0x0,%esi
+  802bbb:	89 9d 90 fd ff ff    	mov    %ebx,-0x270(%ebp)
+  802bc1:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  802bc4:	eb 30                	jmp    802bf6 <spawn+0x17f>
+		argv_store[i] = UTEMP2USTACK(string_store);
+  802bc6:	8d 87 00 d0 7f ee    	lea    -0x11803000(%edi),%eax
+  802bcc:	8b 95 94 fd ff ff    	mov    -0x26c(%ebp),%edx
+  802bd2:	89 04 b2             	mov    %eax,(%edx,%esi,4)
+		strcpy(string_store, argv[i]);
+  802bd5:	83 ec 08             	sub    $0x8,%esp
+  802bd8:	ff 34 b3             	push   (%ebx,%esi,4)
+  802bdb:	57                   	push   %edi
+  802bdc:	e8 df dc ff ff       	call   8008c0 <strcpy>
+		string_store += strlen(argv[i]) + 1;
+  802be1:	83 c4 04             	add    $0x4,%esp
+  802be4:	ff 34 b3             	push   (%ebx,%esi,4)
+  802be7:	e8 99 dc ff ff       	call   800885 <strlen>
+  802bec:	8d 7c 07 01          	lea    0x1(%edi,%eax,1),%edi
+	for (i = 0; i < argc; i++) {
+  802bf0:	83 c6 01             	add    $0x1,%esi
+  802bf3:	83 c4 10             	add    $0x10,%esp
+  802bf6:	39 b5 90 fd ff ff    	cmp    %esi,-0x270(%ebp)
+  802bfc:	7f c8                	jg     802bc6 <spawn+0x14f>
+	}
+	argv_store[argc] = 0;
+  802bfe:	8b 85 94 fd ff ff    	mov    -0x26c(%ebp),%eax
+  802c04:	8b 8d 88 fd ff ff    	mov    -0x278(%ebp),%ecx
+  802c0a:	c7 04 88 00 00 00 00 	movl   $0x0,(%eax,%ecx,4)
+	assert(string_store == (char*)UTEMP + PGSIZE);
+  802c11:	81 ff 00 10 40 00    	cmp    $0x401000,%edi
+  802c17:	0f 85 83 00 00 00    	jne    802ca0 <spawn+0x229>
+
+	argv_store[-1] = UTEMP2USTACK(argv_store);
+  802c1d:	8b 95 94 fd ff ff    	mov    -0x26c(%ebp),%edx
+  802c23:	8d 82 00 d0 7f ee    	lea    -0x11803000(%edx),%eax
+  802c29:	89 42 fc             	mov    %eax,-0x4(%edx)
+	argv_store[-2] = argc;
+  802c2c:	89 d0                	mov    %edx,%eax
+  802c2e:	8b 8d 88 fd ff ff    	mov    -0x278(%ebp),%ecx
+  802c34:	89 4a f8             	mov    %ecx,-0x8(%edx)
+
+	*init_esp = UTEMP2USTACK(&argv_store[-2]);
+  802c37:	2d 08 30 80 11       	sub    $0x11803008,%eax
+  802c3c:	89 85 e0 fd ff ff    	mov    %eax,-0x220(%ebp)
+
+	// After completing the stack, map it into the child's address space
+	// and unmap it from ours!
+	if ((r = sys_page_map(0, UTEMP, child, (void*) (USTACKTOP - PGSIZE), PTE_P | PTE_U | PTE_W)) < 0)
+  802c42:	83 ec 0c             	sub    $0xc,%esp
+  802c45:	6a 07                	push   $0x7
+  802c47:	68 00 d0 bf ee       	push   $0xeebfd000
+  802c4c:	ff b5 8c fd ff ff    	push   -0x274(%ebp)
+  802c52:	68 00 00 40 00       	push   $0x400000
+  802c57:	6a 00                	push   $0x0
+  802c59:	e8 b9 e0 ff ff       	call   800d17 <sys_page_map>
+  802c5e:	89 c3                	mov    %eax,%ebx
+  802c60:	83 c4 20             	add    $0x20,%esp
+  802c63:	85 c0                	test   %eax,%eax
+  802c65:	0f 88 95 04 00 00    	js     803100 <spawn+0x689>
+		goto error;
+	if ((r = sys_page_unmap(0, UTEMP)) < 0)
+  802c6b:	83 ec 08             	sub    $0x8,%esp
+  802c6e:	68 00 00 40 00       	push   $0x400000
+  802c73:	6a 00                	push   $0x0
+  802c75:	e8 df e0 ff ff       	call   800d59 <sys_page_unmap>
+  802c7a:	89 c3                	mov    %eax,%ebx
+  802c7c:	83 c4 10             	add    $0x10,%esp
+  802c7f:	85 c0                	test   %eax,%eax
+  802c81:	0f 88 79 04 00 00    	js     803100 <spawn+0x689>
+	ph = (struct Proghdr*) (elf_buf + elf->e_phoff);
+  802c87:	8b 85 04 fe ff ff    	mov    -0x1fc(%ebp),%eax
+  802c8d:	8d b4 05 e8 fd ff ff 	lea    -0x218(%ebp,%eax,1),%esi
+	for (i = 0; i < elf->e_phnum; i++, ph++) {
+  802c94:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802c99:	89 df                	mov    %ebx,%edi
+  802c9b:	e9 7f 02 00 00       	jmp    802f1f <spawn+0x4a8>
+	assert(string_store == (char*)UTEMP + PGSIZE);
+  802ca0:	68 5c 46 80 00       	push   $0x80465c
+  802ca5:	68 ac 44 80 00       	push   $0x8044ac
+  802caa:	68 f0 00 00 00       	push   $0xf0
+  802caf:	68 eb 45 80 00       	push   $0x8045eb
+  802cb4:	e8 3e d5 ff ff       	call   8001f7 <_panic>
+
+	for (i = 0; i < memsz; i += n * PGSIZE) {
+		if (i >= filesz) {
+			// allocate a blank page
+			n = 1;
+			if ((r = sys_page_alloc(child, (void*) (va + i), perm)) < 0)
+  802cb9:	83 ec 04             	sub    $0x4,%esp
+  802cbc:	ff b5 94 fd ff ff    	push   -0x26c(%ebp)
+  802cc2:	8b 85 6c fd ff ff    	mov    -0x294(%ebp),%eax
+  802cc8:	01 f8                	add    %edi,%eax
+  802cca:	50                   	push   %eax
+  802ccb:	ff b5 8c fd ff ff    	push   -0x274(%ebp)
+  802cd1:	e8 f6 df ff ff       	call   800ccc <sys_page_alloc>
+  802cd6:	83 c4 10             	add    $0x10,%esp
+  802cd9:	85 c0                	test   %eax,%eax
+  802cdb:	0f 88 04 04 00 00    	js     8030e5 <spawn+0x66e>
+			n = 1;
+  802ce1:	be 01 00 00 00       	mov    $0x1,%esi
+  802ce6:	e9 99 01 00 00       	jmp    802e84 <spawn+0x40d>
+		if (!(perm & PTE_W) && (i + PGSIZE <= filesz || memsz <= filesz)) {
+			// read-only and all from file: map the file server's
+			// cached pages, so that every instance of the program
+			// shares one copy of its text
+			n = (memsz <= filesz ? ROUNDUP(filesz - i, PGSIZE)
+			     : ROUNDDOWN(filesz - i, PGSIZE)) / PGSIZE;
+  802ceb:	8b 85 84 fd ff ff    	mov    -0x27c(%ebp),%eax
+  802cf1:	8b 8d 80 fd ff ff    	mov    -0x280(%ebp),%ecx
+  802cf7:	39 c8                	cmp    %ecx,%eax
+  802cf9:	72 70                	jb     802d6b <spawn+0x2f4>
+			n = (memsz <= filesz ? ROUNDUP(filesz - i, PGSIZE)
+  802cfb:	05 ff 0f 00 00       	add    $0xfff,%eax
+  802d00:	29 f8                	sub    %edi,%eax
+			     : ROUNDDOWN(filesz - i, PGSIZE)) / PGSIZE;
+  802d02:	c1 e8 0c             	shr    $0xc,%eax
+			n = MIN(n, FSBULK_MAXPAGES);
+  802d05:	ba 40 00 00 00       	mov    $0x40,%edx
+  802d0a:	39 d0                	cmp    %edx,%eax
+  802d0c:	0f 4e d0             	cmovle %eax,%edx
+  802d0f:	89 d6                	mov    %edx,%esi
+			if ((r = mmap(UTEMP, n * PGSIZE, PROT_READ, MAP_SHARED,
+  802d11:	83 ec 08             	sub    $0x8,%esp
+  802d14:	8b 85 88 fd ff ff    	mov    -0x278(%ebp),%eax
+  802d1a:	8b 95 78 fd ff ff    	mov    -0x288(%ebp),%edx
+  802d20:	01 d0                	add    %edx,%eax
+  802d22:	50                   	push   %eax
+  802d23:	ff b5 7c fd ff ff    	push   -0x284(%ebp)
+  802d29:	6a 01                	push   $0x1
+  802d2b:	6a 01                	push   $0x1
+  802d2d:	89 f0                	mov    %esi,%eax
+  802d2f:	c1 e0 0c             	shl    $0xc,%eax
+  802d32:	50                   	push   %eax
+  802d33:	68 00 00 40 00       	push   $0x400000
+  802d38:	e8 1c f6 ff ff       	call   802359 <mmap>
+  802d3d:	83 c4 20             	add    $0x20,%esp
+  802d40:	85 c0                	test   %eax,%eax
+  802d42:	78 34                	js     802d78 <spawn+0x301>
+			if ((r = seek(fd, fileoffset + i)) < 0)
+				return r;
+			if ((r = readn(fd, UTEMP, MIN(n * PGSIZE, filesz-i))) < 0)
+				return r;
+		}
+		for (j = 0; j < n; j++) {
+  802d44:	8d 86 00 04 00 00    	lea    0x400(%esi),%eax
+  802d4a:	c1 e0 0c             	shl    $0xc,%eax
+  802d4d:	89 85 90 fd ff ff    	mov    %eax,-0x270(%ebp)
+  802d53:	bb 00 00 40 00       	mov    $0x400000,%ebx
+			if ((r = sys_page_map(0, UTEMP + j * PGSIZE, child, (void*) (va + i + j * PGSIZE), perm)) < 0)
+  802d58:	8b 85 70 fd ff ff    	mov    -0x290(%ebp),%eax
+  802d5e:	01 c7                	add    %eax,%edi
+  802d60:	89 b5 74 fd ff ff    	mov    %esi,-0x28c(%ebp)
+		for (j = 0; j < n; j++) {
+  802d66:	e9 ca 00 00 00       	jmp    802e35 <spawn+0x3be>
+			     : ROUNDDOWN(filesz - i, PGSIZE)) / PGSIZE;
+  802d6b:	8b 85 84 fd ff ff    	mov    -0x27c(%ebp),%eax
+  802d71:	29 f8                	sub    %edi,%eax
+  802d73:	c1 e8 0c             	shr    $0xc,%eax
+  802d76:	eb 8d                	jmp    802d05 <spawn+0x28e>
+  802d78:	89 c7                	mov    %eax,%edi
+  802d7a:	eb 27                	jmp    802da3 <spawn+0x32c>
+			for (j = 0; j < n; j++)
+  802d7c:	83 c3 01             	add    $0x1,%ebx
+  802d7f:	39 de                	cmp    %ebx,%esi
+  802d81:	7e 4a                	jle    802dcd <spawn+0x356>
+				if ((r = sys_page_alloc(0, UTEMP + j * PGSIZE, PTE_P|PTE_U|PTE_W)) < 0)
+  802d83:	83 ec 04             	sub    $0x4,%esp
+  802d86:	6a 07                	push   $0x7
+  802d88:	89 d8                	mov    %ebx,%eax
+  802d8a:	c1 e0 0c             	shl    $0xc,%eax
+  802d8d:	05 00 00 40 00       	add    $0x400000,%eax
+  802d92:	50                   	push   %eax
+  802d93:	6a 00                	push   $0x0
+  802d95:	e8 32 df ff ff       	call   800ccc <sys_page_alloc>
+  802d9a:	83 c4 10             	add    $0x10,%esp
+  802d9d:	85 c0                	test   %eax,%eax
+  802d9f:	79 db                	jns    802d7c <spawn+0x305>
+  802da1:	89 c7                	mov    %eax,%edi
+	sys_env_destroy(child);
+  802da3:	83 ec 0c             	sub    $0xc,%esp
+  802da6:	ff b5 8c fd ff ff    	push   -0x274(%ebp)
+  802dac:	e8 8c de ff ff       	call   800c3d <sys_env_destroy>
+	close(fd);
+  802db1:	83 c4 04             	add    $0x4,%esp
+  802db4:	ff b5 7c fd ff ff    	push   -0x284(%ebp)
+  802dba:	e8 ca e7 ff ff       	call   801589 <close>
+	return r;
+  802dbf:	83 c4 10             	add    $0x10,%esp
+  802dc2:	89 bd 7c fd ff ff    	mov    %edi,-0x284(%ebp)
+  802dc8:	e9 0a 03 00 00       	jmp    8030d7 <spawn+0x660>
+			if ((r = seek(fd, fileoffset + i)) < 0)
+  802dcd:	83 ec 08             	sub    $0x8,%esp
+  802dd0:	8b 85 88 fd ff ff    	mov    -0x278(%ebp),%eax
+  802dd6:	8b 95 78 fd ff ff    	mov    -0x288(%ebp),%edx
+  802ddc:	01 d0                	add    %edx,%eax
+  802dde:	50                   	push   %eax
+  802ddf:	8b 9d 7c fd ff ff    	mov    -0x284(%ebp),%ebx
+  802de5:	53                   	push   %ebx
+  802de6:	e8 2a ea ff ff       	call   801815 <seek>
+  802deb:	83 c4 10             	add    $0x10,%esp
+  802dee:	85 c0                	test   %eax,%eax
+  802df0:	0f 88 f6 02 00 00    	js     8030ec <spawn+0x675>
+			if ((r = readn(fd, UTEMP, MIN(n * PGSIZE, filesz-i))) < 0)
+  802df6:	83 ec 04             	sub    $0x4,%esp
+  802df9:	89 f0                	mov    %esi,%eax
+  802dfb:	c1 e0 0c             	shl    $0xc,%eax
+  802dfe:	8b 8d 90 fd ff ff    	mov    -0x270(%ebp),%ecx
+  802e04:	39 c8                	cmp    %ecx,%eax
+  802e06:	0f 47 c1             	cmova  %ecx,%eax
+  802e09:	50                   	push   %eax
+  802e0a:	68 00 00 40 00       	push   $0x400000
+  802e0f:	53                   	push   %ebx
+  802e10:	e8 37 e9 ff ff       	call   80174c <readn>
+  802e15:	83 c4 10             	add    $0x10,%esp
+  802e18:	85 c0                	test   %eax,%eax
+  802e1a:	0f 89 24 ff ff ff    	jns    802d44 <spawn+0x2cd>
+  802e20:	89 c7                	mov    %eax,%edi
+  802e22:	e9 7c ff ff ff       	jmp    802da3 <spawn+0x32c>
+				panic("spawn: sys_page_map data: %e", r);
+			sys_page_unmap(0, UTEMP + j * PGSIZE);
+  802e27:	83 ec 08             	sub    $0x8,%esp
+  802e2a:	56                   	push   %esi
+  802e2b:	6a 00                	push   $0x0
+  802e2d:	e8 27 df ff ff       	call   800d59 <sys_page_unmap>
+  802e32:	83 c4 10             	add    $0x10,%esp
+		for (j = 0; j < n; j++) {
+  802e35:	8b 85 90 fd ff ff    	mov    -0x270(%ebp),%eax
+  802e3b:	39 c3                	cmp    %eax,%ebx
+  802e3d:	74 3f                	je     802e7e <spawn+0x407>
+			if ((r = sys_page_map(0, UTEMP + j * PGSIZE, child, (void*) (va + i + j * PGSIZE), perm)) < 0)
+  802e3f:	89 de                	mov    %ebx,%esi
+  802e41:	83 ec 0c             	sub    $0xc,%esp
+  802e44:	ff b5 94 fd ff ff    	push   -0x26c(%ebp)
+  802e4a:	8d 04 1f             	lea    (%edi,%ebx,1),%eax
+  802e4d:	50                   	push   %eax
+  802e4e:	ff b5 8c fd ff ff    	push   -0x274(%ebp)
+  802e54:	53                   	push   %ebx
+  802e55:	6a 00                	push   $0x0
+  802e57:	e8 bb de ff ff       	call   800d17 <sys_page_map>
+  802e5c:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  802e62:	83 c4 20             	add    $0x20,%esp
+  802e65:	85 c0                	test   %eax,%eax
+  802e67:	79 be                	jns    802e27 <spawn+0x3b0>
+				panic("spawn: sys_page_map data: %e", r);
+  802e69:	50                   	push   %eax
+  802e6a:	68 f7 45 80 00       	push   $0x8045f7
+  802e6f:	68 36 01 00 00       	push   $0x136
+  802e74:	68 eb 45 80 00       	push   $0x8045eb
+  802e79:	e8 79 d3 ff ff       	call   8001f7 <_panic>
+  802e7e:	8b b5 74 fd ff ff    	mov    -0x28c(%ebp),%esi
+	for (i = 0; i < memsz; i += n * PGSIZE) {
+  802e84:	c1 e6 0c             	shl    $0xc,%esi
+  802e87:	01 b5 88 fd ff ff    	add    %esi,-0x278(%ebp)
+  802e8d:	8b 85 88 fd ff ff    	mov    -0x278(%ebp),%eax
+  802e93:	89 c7                	mov    %eax,%edi
+  802e95:	8b 8d 80 fd ff ff    	mov    -0x280(%ebp),%ecx
+  802e9b:	39 c8                	cmp    %ecx,%eax
+  802e9d:	73 6e                	jae    802f0d <spawn+0x496>
+		if (i >= filesz) {
+  802e9f:	8b 8d 84 fd ff ff    	mov    -0x27c(%ebp),%ecx
+  802ea5:	39 8d 88 fd ff ff    	cmp    %ecx,-0x278(%ebp)
+  802eab:	0f 83 08 fe ff ff    	jae    802cb9 <spawn+0x242>
+		if (!(perm & PTE_W) && (i + PGSIZE <= filesz || memsz <= filesz)) {
+  802eb1:	f6 85 94 fd ff ff 02 	testb  $0x2,-0x26c(%ebp)
+  802eb8:	75 27                	jne    802ee1 <spawn+0x46a>
+  802eba:	8b 85 88 fd ff ff    	mov    -0x278(%ebp),%eax
+  802ec0:	05 00 10 00 00       	add    $0x1000,%eax
+  802ec5:	8b 95 84 fd ff ff    	mov    -0x27c(%ebp),%edx
+  802ecb:	39 c2                	cmp    %eax,%edx
+  802ecd:	0f 83 18 fe ff ff    	jae    802ceb <spawn+0x274>
+  802ed3:	8b 85 80 fd ff ff    	mov    -0x280(%ebp),%eax
+  802ed9:	39 c2                	cmp    %eax,%edx
+  802edb:	0f 83 0a fe ff ff    	jae    802ceb <spawn+0x274>
+			n = MIN(FSBULK_MAXPAGES, ROUNDUP(filesz - i, PGSIZE) / PGSIZE);
+  802ee1:	8b 85 84 fd ff ff    	mov    -0x27c(%ebp),%eax
+  802ee7:	29 f8                	sub    %edi,%eax
+  802ee9:	89 85 90 fd ff ff    	mov    %eax,-0x270(%ebp)
+  802eef:	05 ff 0f 00 00       	add    $0xfff,%eax
+  802ef4:	c1 e8 0c             	shr    $0xc,%eax
+  802ef7:	89 c6                	mov    %eax,%esi
+  802ef9:	b8 40 00 00 00       	mov    $0x40,%eax
+  802efe:	39 c6                	cmp    %eax,%esi
+  802f00:	0f 47 f0             	cmova  %eax,%esi
+			for (j = 0; j < n; j++)
+  802f03:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802f08:	e9 72 fe ff ff       	jmp    802d7f <spawn+0x308>
+  802f0d:	8b bd 68 fd ff ff    	mov    -0x298(%ebp),%edi
+  802f13:	8b b5 64 fd ff ff    	mov    -0x29c(%ebp),%esi
+	for (i = 0; i < elf->e_phnum; i++, ph++) {
+  802f19:	83 c7 01             	add    $0x1,%edi
+  802f1c:	83 c6 20             	add    $0x20,%esi
+  802f1f:	0f b7 85 14 fe ff ff 	movzwl -0x1ec(%ebp),%eax
+  802f26:	39 f8                	cmp    %edi,%eax
+  802f28:	0f 8e 88 00 00 00    	jle    802fb6 <spawn+0x53f>
+		if (ph->p_type != ELF_PROG_LOAD)
+  802f2e:	83 3e 01             	cmpl   $0x1,(%esi)
+  802f31:	75 e6                	jne    802f19 <spawn+0x4a2>
+		if (ph->p_flags & ELF_PROG_FLAG_WRITE)
+  802f33:	8b 46 18             	mov    0x18(%esi),%eax
+  802f36:	83 e0 02             	and    $0x2,%eax
+		perm = PTE_P | PTE_U;
+  802f39:	83 f8 01             	cmp    $0x1,%eax
+  802f3c:	19 c0                	sbb    %eax,%eax
+  802f3e:	83 e0 fe             	and    $0xfffffffe,%eax
+  802f41:	83 c0 07             	add    $0x7,%eax
+  802f44:	89 85 94 fd ff ff    	mov    %eax,-0x26c(%ebp)
+		if ((r = map_segment(child, ph->p_va, ph->p_memsz,
+  802f4a:	8b 4e 04             	mov    0x4(%esi),%ecx
+  802f4d:	89 8d 78 fd ff ff    	mov    %ecx,-0x288(%ebp)
+  802f53:	8b 5e 10             	mov    0x10(%esi),%ebx
+  802f56:	89 9d 84 fd ff ff    	mov    %ebx,-0x27c(%ebp)
+  802f5c:	8b 46 14             	mov    0x14(%esi),%eax
+  802f5f:	89 85 80 fd ff ff    	mov    %eax,-0x280(%ebp)
+  802f65:	8b 56 08             	mov    0x8(%esi),%edx
+	if ((i = PGOFF(va))) {
+  802f68:	89 d0                	mov    %edx,%eax
+  802f6a:	25 ff 0f 00 00       	and    $0xfff,%eax
+  802f6f:	74 18                	je     802f89 <spawn+0x512>
+		va -= i;
+  802f71:	29 c2                	sub    %eax,%edx
+		memsz += i;
+  802f73:	01 85 80 fd ff ff    	add    %eax,-0x280(%ebp)
+		filesz += i;
+  802f79:	01 c3                	add    %eax,%ebx
+  802f7b:	89 9d 84 fd ff ff    	mov    %ebx,-0x27c(%ebp)
+		fileoffset -= i;
+  802f81:	29 c1                	sub    %eax,%ecx
+  802f83:	89 8d 78 fd ff ff    	mov    %ecx,-0x288(%ebp)
+	for (i = 0; i < memsz; i += n * PGSIZE) {
+  802f89:	c7 85 88 fd ff ff 00 	movl   $0x0,-0x278(%ebp)
+  802f90:	00 00 00 
+			if ((r = sys_page_map(0, UTEMP + j * PGSIZE, child, (void*) (va + i + j * PGSIZE), perm)) < 0)
+  802f93:	8d 82 00 00 c0 ff    	lea    -0x400000(%edx),%eax
+  802f99:	89 85 70 fd ff ff    	mov    %eax,-0x290(%ebp)
+  802f9f:	89 95 6c fd ff ff    	mov    %edx,-0x294(%ebp)
+  802fa5:	89 bd 68 fd ff ff    	mov    %edi,-0x298(%ebp)
+  802fab:	89 b5 64 fd ff ff    	mov    %esi,-0x29c(%ebp)
+	for (i = 0; i < memsz; i += n * PGSIZE) {
+  802fb1:	e9 d7 fe ff ff       	jmp    802e8d <spawn+0x416>
+	close(fd);
+  802fb6:	83 ec 0c             	sub    $0xc,%esp
+  802fb9:	ff b5 7c fd ff ff    	push   -0x284(%ebp)
+  802fbf:	e8 c5 e5 ff ff       	call   801589 <close>
+  802fc4:	83 c4 10             	add    $0x10,%esp
+// Copy the mappings for shared pages into the child address space.
+static int
+copy_shared_pages(envid_t child)
+{
+	// LAB 5: Your code here.
+	int r = 0;
+  802fc7:	ba 00 00 00 00       	mov    $0x0,%edx
+
+	for (uintptr_t va = 0; va < UTOP; va += PGSIZE) {
+  802fcc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802fd1:	8b b5 8c fd ff ff    	mov    -0x274(%ebp),%esi
+  802fd7:	eb 14                	jmp    802fed <spawn+0x576>
+		if (!(uvpd[PDX(va)] & PTE_P)) {
+			va += PTSIZE - PGSIZE;
+  802fd9:	81 c3 00 f0 3f 00    	add    $0x3ff000,%ebx
+	for (uintptr_t va = 0; va < UTOP; va += PGSIZE) {
+  802fdf:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  802fe5:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  802feb:	77 65                	ja     803052 <spawn+0x5db>
+		if (!(uvpd[PDX(va)] & PTE_P)) {
+  802fed:	89 d8                	mov    %ebx,%eax
+  802fef:	c1 e8 16             	shr    $0x16,%eax
+  802ff2:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  802ff9:	a8 01                	test   $0x1,%al
+  802ffb:	74 dc                	je     802fd9 <spawn+0x562>
+			continue;
+		}
+		if (!(uvpt[PGNUM(va)] & PTE_P) || !(uvpt[PGNUM(va)] & PTE_SHARE))
+  802ffd:	89 d8                	mov    %ebx,%eax
+  802fff:	c1 e8 0c             	shr    $0xc,%eax
+  803002:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  803009:	f6 c1 01             	test   $0x1,%cl
+  80300c:	74 d1                	je     802fdf <spawn+0x568>
+  80300e:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  803015:	f6 c5 04             	test   $0x4,%ch
+  803018:	74 c5                	je     802fdf <spawn+0x568>
+			continue;
+		r = sys_page_map(0, (void *) va, child, (void *) va,
+				 uvpt[PGNUM(va)] & PTE_SYSCALL);
+  80301a:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+		r = sys_page_map(0, (void *) va, child, (void *) va,
+  803021:	83 ec 0c             	sub    $0xc,%esp
+  803024:	25 07 0e 00 00       	and    $0xe07,%eax
+  803029:	50                   	push   %eax
+  80302a:	53                   	push   %ebx
+  80302b:	56                   	push   %esi
+  80302c:	53                   	push   %ebx
+  80302d:	6a 00                	push   $0x0
+  80302f:	e8 e3 dc ff ff       	call   800d17 <sys_page_map>
+  803034:	89 c2                	mov    %eax,%edx
+		if (r < 0)
+  803036:	83 c4 20             	add    $0x20,%esp
+  803039:	85 c0                	test   %eax,%eax
+  80303b:	79 a2                	jns    802fdf <spawn+0x568>
+		panic("copy_shared_pages: %e", r);
+  80303d:	52                   	push   %edx
+  80303e:	68 14 46 80 00       	push   $0x804614
+  803043:	68 80 00 00 00       	push   $0x80
+  803048:	68 eb 45 80 00       	push   $0x8045eb
+  80304d:	e8 a5 d1 ff ff       	call   8001f7 <_panic>
+	if ((r = copy_shared_pages(child)) < 0)
+  803052:	85 d2                	test   %edx,%edx
+  803054:	78 e7                	js     80303d <spawn+0x5c6>
+	child_tf.tf_eflags |= FL_IOPL_3;   // devious: see user/faultio.c
+  803056:	81 8d dc fd ff ff 00 	orl    $0x3000,-0x224(%ebp)
+  80305d:	30 00 00 
+	if ((r = sys_env_set_trapframe(child, &child_tf)) < 0)
+  803060:	83 ec 08             	sub    $0x8,%esp
+  803063:	8d 85 a4 fd ff ff    	lea    -0x25c(%ebp),%eax
+  803069:	50                   	push   %eax
+  80306a:	ff b5 8c fd ff ff    	push   -0x274(%ebp)
+  803070:	e8 78 dd ff ff       	call   800ded <sys_env_set_trapframe>
+  803075:	83 c4 10             	add    $0x10,%esp
+  803078:	85 c0                	test   %eax,%eax
+  80307a:	78 25                	js     8030a1 <spawn+0x62a>
+	if ((r = sys_env_set_status(child, ENV_RUNNABLE)) < 0)
+  80307c:	83 ec 08             	sub    $0x8,%esp
+  80307f:	6a 02                	push   $0x2
+  803081:	ff b5 8c fd ff ff    	push   -0x274(%ebp)
+  803087:	e8 17 dd ff ff       	call   800da3 <sys_env_set_status>
+  80308c:	83 c4 10             	add    $0x10,%esp
+  80308f:	85 c0                	test   %eax,%eax
+  803091:	78 23                	js     8030b6 <spawn+0x63f>
+	return child;
+  803093:	8b 85 8c fd ff ff    	mov    -0x274(%ebp),%eax
+  803099:	89 85 7c fd ff ff    	mov    %eax,-0x284(%ebp)
+  80309f:	eb 36                	jmp    8030d7 <spawn+0x660>
+		panic("sys_env_set_trapframe: %e", r);
+  8030a1:	50                   	push   %eax
+  8030a2:	68 2a 46 80 00       	push   $0x80462a
+  8030a7:	68 84 00 00 00       	push   $0x84
+  8030ac:	68 eb 45 80 00       	push   $0x8045eb
+  8030b1:	e8 41 d1 ff ff       	call   8001f7 <_panic>
+		panic("sys_env_set_status: %e", r);
+  8030b6:	50                   	push   %eax
+  8030b7:	68 44 46 80 00       	push   $0x804644
+  8030bc:	68 87 00 00 00       	push   $0x87
+  8030c1:	68 eb 45 80 00       	push   $0x8045eb
+  8030c6:	e8 2c d1 ff ff       	call   8001f7 <_panic>
+		return r;
+  8030cb:	8b 85 8c fd ff ff    	mov    -0x274(%ebp),%eax
+  8030d1:	89 85 7c fd ff ff    	mov    %eax,-0x284(%ebp)
+}
+  8030d7:	8b 85 7c fd ff ff    	mov    -0x284(%ebp),%eax
+  8030dd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8030e0:	5b                   	pop    %ebx
+  8030e1:	5e                   	pop    %esi
+  8030e2:	5f                   	pop    %edi
+  8030e3:	5d                   	pop    %ebp
+  8030e4:	c3                   	ret
+  8030e5:	89 c7                	mov    %eax,%edi
+  8030e7:	e9 b7 fc ff ff       	jmp    802da3 <spawn+0x32c>
+  8030ec:	89 c7                	mov    %eax,%edi
+  8030ee:	e9 b0 fc ff ff       	jmp    802da3 <spawn+0x32c>
+		return -E_NO_MEM;
+  8030f3:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+	return r;
+  8030f8:	89 85 7c fd ff ff    	mov    %eax,-0x284(%ebp)
+  8030fe:	eb d7                	jmp    8030d7 <spawn+0x660>
+	sys_page_unmap(0, UTEMP);
+  803100:	83 ec 08             	sub    $0x8,%esp
+  803103:	68 00 00 40 00       	push   $0x400000
+  803108:	6a 00                	push   $0x0
+  80310a:	e8 4a dc ff ff       	call   800d59 <sys_page_unmap>
+  80310f:	83 c4 10             	add    $0x10,%esp
+  803112:	89 9d 7c fd ff ff    	mov    %ebx,-0x284(%ebp)
+  803118:	eb bd                	jmp    8030d7 <spawn+0x660>
+
+0080311a <spawnl>:
+{
+  80311a:	55                   	push   %ebp
+  80311b:	89 e5                	mov    %esp,%ebp
+  80311d:	56                   	push   %esi
+  80311e:	53                   	push   %ebx
+	va_start(vl, arg0);
+  80311f:	8d 55 10             	lea    0x10(%ebp),%edx
+	int argc=0;
+  803122:	b8 00 00 00 00       	mov    $0x0,%eax
+	while(va_arg(vl, void *) != NULL)
+  803127:	eb 05                	jmp    80312e <spawnl+0x14>
+		argc++;
+  803129:	83 c0 01             	add    $0x1,%eax
+	while(va_arg(vl, void *) != NULL)
+  80312c:	89 ca                	mov    %ecx,%edx
+  80312e:	8d 4a 04             	lea    0x4(%edx),%ecx
+  803131:	83 3a 00             	cmpl   $0x0,(%edx)
+  803134:	75 f3                	jne    803129 <spawnl+0xf>
+	const char *argv[argc+2];
+  803136:	8d 14 85 17 00 00 00 	lea    0x17(,%eax,4),%edx
+  80313d:	83 e2 f0             	and    $0xfffffff0,%edx
+  803140:	29 d4                	sub    %edx,%esp
+  803142:	8d 5c 24 03          	lea    0x3(%esp),%ebx
+  803146:	89 da                	mov    %ebx,%edx
+  803148:	c1 ea 02             	shr    $0x2,%edx
+  80314b:	83 e3 fc             	and    $0xfffffffc,%ebx
+	argv[0] = arg0;
+  80314e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  803151:	89 0c 95 00 00 00 00 	mov    %ecx,0x0(,%edx,4)
+	argv[argc+1] = NULL;
+  803158:	c7 44 83 04 00 00 00 	movl   $0x0,0x4(%ebx,%eax,4)
+  80315f:	00 
+	va_start(vl, arg0);
+  803160:	8d 4d 10             	lea    0x10(%ebp),%ecx
+	for(i=0;i<argc;i++)
+  803163:	89 c2                	mov    %eax,%edx
+  803165:	b8 00 00 00 00       	mov    $0x0,%eax
+  80316a:	eb 0b                	jmp    803177 <spawnl+0x5d>
+		argv[i+1] = va_arg(vl, const char *);
+  80316c:	83 c0 01             	add    $0x1,%eax
+  80316f:	8b 31                	mov    (%ecx),%esi
+  803171:	89 34 83             	mov    %esi,(%ebx,%eax,4)
+  803174:	8d 49 04             	lea    0x4(%ecx),%ecx
+	for(i=0;i<argc;i++)
+  803177:	39 d0                	cmp    %edx,%eax
+  803179:	75 f1                	jne    80316c <spawnl+0x52>
+	return spawn(prog, argv);
+  80317b:	83 ec 08             	sub    $0x8,%esp
+  80317e:	53                   	push   %ebx
+  80317f:	ff 75 08             	push   0x8(%ebp)
+  803182:	e8 f0 f8 ff ff       	call   802a77 <spawn>
+}
+  803187:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80318a:	5b                   	pop    %ebx
+  80318b:	5e                   	pop    %esi
+  80318c:	5d                   	pop    %ebp
+  80318d:	c3                   	ret
+
+0080318e <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  80318e:	55                   	push   %ebp
+  80318f:	89 e5                	mov    %esp,%ebp
+  803191:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  803194:	68 82 46 80 00       	push   $0x804682
+  803199:	ff 75 0c             	push   0xc(%ebp)
+  80319c:	e8 1f d7 ff ff       	call   8008c0 <strcpy>
+	return 0;
+}
+  8031a1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8031a6:	c9                   	leave
+  8031a7:	c3                   	ret
+
+008031a8 <devsock_close>:
+{
+  8031a8:	55                   	push   %ebp
+  8031a9:	89 e5                	mov    %esp,%ebp
+  8031ab:	53                   	push   %ebx
+  8031ac:	83 ec 10             	sub    $0x10,%esp
+  8031af:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  8031b2:	53                   	push   %ebx
+  8031b3:	e8 ca 0b 00 00       	call   803d82 <pageref>
+  8031b8:	89 c2                	mov    %eax,%edx
+  8031ba:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  8031bd:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  8031c2:	83 fa 01             	cmp    $0x1,%edx
+  8031c5:	74 05                	je     8031cc <devsock_close+0x24>
+}
+  8031c7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8031ca:	c9                   	leave
+  8031cb:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  8031cc:	83 ec 0c             	sub    $0xc,%esp
+  8031cf:	ff 73 0c             	push   0xc(%ebx)
+  8031d2:	e8 b7 02 00 00       	call   80348e <nsipc_close>
+  8031d7:	83 c4 10             	add    $0x10,%esp
+  8031da:	eb eb                	jmp    8031c7 <devsock_close+0x1f>
+
+008031dc <devsock_write>:
+{
+  8031dc:	55                   	push   %ebp
+  8031dd:	89 e5                	mov    %esp,%ebp
+  8031df:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  8031e2:	6a 00                	push   $0x0
+  8031e4:	ff 75 10             	push   0x10(%ebp)
+  8031e7:	ff 75 0c             	push   0xc(%ebp)
+  8031ea:	8b 45 08             	mov    0x8(%ebp),%eax
+  8031ed:	ff 70 0c             	push   0xc(%eax)
+  8031f0:	e8 79 03 00 00       	call   80356e <nsipc_send>
+}
+  8031f5:	c9                   	leave
+  8031f6:	c3                   	ret
+
+008031f7 <devsock_read>:
+{
+  8031f7:	55                   	push   %ebp
+  8031f8:	89 e5                	mov    %esp,%ebp
+  8031fa:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  8031fd:	6a 00                	push   $0x0
+  8031ff:	ff 75 10             	push   0x10(%ebp)
+  803202:	ff 75 0c             	push   0xc(%ebp)
+  803205:	8b 45 08             	mov    0x8(%ebp),%eax
+  803208:	ff 70 0c             	push   0xc(%eax)
+  80320b:	e8 ef 02 00 00       	call   8034ff <nsipc_recv>
+}
+  803210:	c9                   	leave
+  803211:	c3                   	ret
+
+00803212 <fd2sockid>:
+{
+  803212:	55                   	push   %ebp
+  803213:	89 e5                	mov    %esp,%ebp
+  803215:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  803218:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  80321b:	52                   	push   %edx
+  80321c:	50                   	push   %eax
+  80321d:	e8 3d e2 ff ff       	call   80145f <fd_lookup>
+  803222:	83 c4 10             	add    $0x10,%esp
+  803225:	85 c0                	test   %eax,%eax
+  803227:	78 10                	js     803239 <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  803229:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80322c:	8b 0d 40 50 80 00    	mov    0x805040,%ecx
+  803232:	39 08                	cmp    %ecx,(%eax)
+  803234:	75 05                	jne    80323b <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  803236:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  803239:	c9                   	leave
+  80323a:	c3                   	ret
+		return -E_NOT_SUPP;
+  80323b:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  803240:	eb f7                	jmp    803239 <fd2sockid+0x27>
+
+00803242 <alloc_sockfd>:
+{
+  803242:	55                   	push   %ebp
+  803243:	89 e5                	mov    %esp,%ebp
+  803245:	56                   	push   %esi
+  803246:	53                   	push   %ebx
+  803247:	83 ec 1c             	sub    $0x1c,%esp
+  80324a:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  80324c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80324f:	50                   	push   %eax
+  803250:	e8 b4 e1 ff ff       	call   801409 <fd_alloc>
+  803255:	89 c3                	mov    %eax,%ebx
+  803257:	83 c4 10             	add    $0x10,%esp
+  80325a:	85 c0                	test   %eax,%eax
+  80325c:	78 43                	js     8032a1 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  80325e:	83 ec 04             	sub    $0x4,%esp
+  803261:	68 07 04 00 00       	push   $0x407
+  803266:	ff 75 f4             	push   -0xc(%ebp)
+  803269:	6a 00                	push   $0x0
+  80326b:	e8 5c da ff ff       	call   800ccc <sys_page_alloc>
+  803270:	89 c3                	mov    %eax,%ebx
+  803272:	83 c4 10             	add    $0x10,%esp
+  803275:	85 c0                	test   %eax,%eax
+  803277:	78 28                	js     8032a1 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  803279:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80327c:	8b 15 40 50 80 00    	mov    0x805040,%edx
+  803282:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  803284:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803287:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  80328e:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  803291:	83 ec 0c             	sub    $0xc,%esp
+  803294:	50                   	push   %eax
+  803295:	e8 48 e1 ff ff       	call   8013e2 <fd2num>
+  80329a:	89 c3                	mov    %eax,%ebx
+  80329c:	83 c4 10             	add    $0x10,%esp
+  80329f:	eb 0c                	jmp    8032ad <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  8032a1:	83 ec 0c             	sub    $0xc,%esp
+  8032a4:	56                   	push   %esi
+  8032a5:	e8 e4 01 00 00       	call   80348e <nsipc_close>
+		return r;
+  8032aa:	83 c4 10             	add    $0x10,%esp
+}
+  8032ad:	89 d8                	mov    %ebx,%eax
+  8032af:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8032b2:	5b                   	pop    %ebx
+  8032b3:	5e                   	pop    %esi
+  8032b4:	5d                   	pop    %ebp
+  8032b5:	c3                   	ret
+
+008032b6 <accept>:
+{
+  8032b6:	55                   	push   %ebp
+  8032b7:	89 e5                	mov    %esp,%ebp
+  8032b9:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8032bc:	8b 45 08             	mov    0x8(%ebp),%eax
+  8032bf:	e8 4e ff ff ff       	call   803212 <fd2sockid>
+  8032c4:	85 c0                	test   %eax,%eax
+  8032c6:	78 1b                	js     8032e3 <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  8032c8:	83 ec 04             	sub    $0x4,%esp
+  8032cb:	ff 75 10             	push   0x10(%ebp)
+  8032ce:	ff 75 0c             	push   0xc(%ebp)
+  8032d1:	50                   	push   %eax
+  8032d2:	e8 0e 01 00 00       	call   8033e5 <nsipc_accept>
+  8032d7:	83 c4 10             	add    $0x10,%esp
+  8032da:	85 c0                	test   %eax,%eax
+  8032dc:	78 05                	js     8032e3 <accept+0x2d>
+	return alloc_sockfd(r);
+  8032de:	e8 5f ff ff ff       	call   803242 <alloc_sockfd>
+}
+  8032e3:	c9                   	leave
+  8032e4:	c3                   	ret
+
+008032e5 <bind>:
+{
+  8032e5:	55                   	push   %ebp
+  8032e6:	89 e5                	mov    %esp,%ebp
+  8032e8:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8032eb:	8b 45 08             	mov    0x8(%ebp),%eax
+  8032ee:	e8 1f ff ff ff       	call   803212 <fd2sockid>
+  8032f3:	85 c0                	test   %eax,%eax
+  8032f5:	78 12                	js     803309 <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  8032f7:	83 ec 04             	sub    $0x4,%esp
+  8032fa:	ff 75 10             	push   0x10(%ebp)
+  8032fd:	ff 75 0c             	push   0xc(%ebp)
+  803300:	50                   	push   %eax
+  803301:	e8 31 01 00 00       	call   803437 <nsipc_bind>
+  803306:	83 c4 10             	add    $0x10,%esp
+}
+  803309:	c9                   	leave
+  80330a:	c3                   	ret
+
+0080330b <shutdown>:
+{
+  80330b:	55                   	push   %ebp
+  80330c:	89 e5                	mov    %esp,%ebp
+  80330e:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  803311:	8b 45 08             	mov    0x8(%ebp),%eax
+  803314:	e8 f9 fe ff ff       	call   803212 <fd2sockid>
+  803319:	85 c0                	test   %eax,%eax
+  80331b:	78 0f                	js     80332c <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  80331d:	83 ec 08             	sub    $0x8,%esp
+  803320:	ff 75 0c             	push   0xc(%ebp)
+  803323:	50                   	push   %eax
+  803324:	e8 43 01 00 00       	call   80346c <nsipc_shutdown>
+  803329:	83 c4 10             	add    $0x10,%esp
+}
+  80332c:	c9                   	leave
+  80332d:	c3                   	ret
+
+0080332e <connect>:
+{
+  80332e:	55                   	push   %ebp
+  80332f:	89 e5                	mov    %esp,%ebp
+  803331:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  803334:	8b 45 08             	mov    0x8(%ebp),%eax
+  803337:	e8 d6 fe ff ff       	call   803212 <fd2sockid>
+  80333c:	85 c0                	test   %eax,%eax
+  80333e:	78 12                	js     803352 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  803340:	83 ec 04             	sub    $0x4,%esp
+  803343:	ff 75 10             	push   0x10(%ebp)
+  803346:	ff 75 0c             	push   0xc(%ebp)
+  803349:	50                   	push   %eax
+  80334a:	e8 59 01 00 00       	call   8034a8 <nsipc_connect>
+  80334f:	83 c4 10             	add    $0x10,%esp
+}
+  803352:	c9                   	leave
+  803353:	c3                   	ret
+
+00803354 <listen>:
+{
+  803354:	55                   	push   %ebp
+  803355:	89 e5                	mov    %esp,%ebp
+  803357:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  80335a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80335d:	e8 b0 fe ff ff       	call   803212 <fd2sockid>
+  803362:	85 c0                	test   %eax,%eax
+  803364:	78 0f                	js     803375 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  803366:	83 ec 08             	sub    $0x8,%esp
+  803369:	ff 75 0c             	push   0xc(%ebp)
+  80336c:	50                   	push   %eax
+  80336d:	e8 6b 01 00 00       	call   8034dd <nsipc_listen>
+  803372:	83 c4 10             	add    $0x10,%esp
+}
+  803375:	c9                   	leave
+  803376:	c3                   	ret
+
+00803377 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  803377:	55                   	push   %ebp
+  803378:	89 e5                	mov    %esp,%ebp
+  80337a:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  80337d:	ff 75 10             	push   0x10(%ebp)
+  803380:	ff 75 0c             	push   0xc(%ebp)
+  803383:	ff 75 08             	push   0x8(%ebp)
+  803386:	e8 41 02 00 00       	call   8035cc <nsipc_socket>
+  80338b:	83 c4 10             	add    $0x10,%esp
+  80338e:	85 c0                	test   %eax,%eax
+  803390:	78 05                	js     803397 <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  803392:	e8 ab fe ff ff       	call   803242 <alloc_sockfd>
+}
+  803397:	c9                   	leave
+  803398:	c3                   	ret
+
+00803399 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  803399:	55                   	push   %ebp
+  80339a:	89 e5                	mov    %esp,%ebp
+  80339c:	53                   	push   %ebx
+  80339d:	83 ec 04             	sub    $0x4,%esp
+  8033a0:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  8033a2:	83 3d 00 a0 80 00 00 	cmpl   $0x0,0x80a000
+  8033a9:	74 26                	je     8033d1 <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  8033ab:	6a 07                	push   $0x7
+  8033ad:	68 00 90 80 00       	push   $0x809000
+  8033b2:	53                   	push   %ebx
+  8033b3:	ff 35 00 a0 80 00    	push   0x80a000
+  8033b9:	e8 4c 08 00 00       	call   803c0a <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  8033be:	83 c4 0c             	add    $0xc,%esp
+  8033c1:	6a 00                	push   $0x0
+  8033c3:	6a 00                	push   $0x0
+  8033c5:	6a 00                	push   $0x0
+  8033c7:	e8 d3 07 00 00       	call   803b9f <ipc_recv>
+}
+  8033cc:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8033cf:	c9                   	leave
+  8033d0:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  8033d1:	83 ec 0c             	sub    $0xc,%esp
+  8033d4:	6a 02                	push   $0x2
+  8033d6:	e8 68 09 00 00       	call   803d43 <ipc_find_env>
+  8033db:	a3 00 a0 80 00       	mov    %eax,0x80a000
+  8033e0:	83 c4 10             	add    $0x10,%esp
+  8033e3:	eb c6                	jmp    8033ab <nsipc+0x12>
+
+008033e5 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  8033e5:	55                   	push   %ebp
+  8033e6:	89 e5                	mov    %esp,%ebp
+  8033e8:	56                   	push   %esi
+  8033e9:	53                   	push   %ebx
+  8033ea:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  8033ed:	8b 45 08             	mov    0x8(%ebp),%eax
+  8033f0:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  8033f5:	8b 06                	mov    (%esi),%eax
+  8033f7:	a3 04 90 80 00       	mov    %eax,0x809004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  8033fc:	b8 01 00 00 00       	mov    $0x1,%eax
+  803401:	e8 93 ff ff ff       	call   803399 <nsipc>
+  803406:	89 c3                	mov    %eax,%ebx
+  803408:	85 c0                	test   %eax,%eax
+  80340a:	79 09                	jns    803415 <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  80340c:	89 d8                	mov    %ebx,%eax
+  80340e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803411:	5b                   	pop    %ebx
+  803412:	5e                   	pop    %esi
+  803413:	5d                   	pop    %ebp
+  803414:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  803415:	83 ec 04             	sub    $0x4,%esp
+  803418:	ff 35 10 90 80 00    	push   0x809010
+  80341e:	68 00 90 80 00       	push   $0x809000
+  803423:	ff 75 0c             	push   0xc(%ebp)
+  803426:	e8 1b d6 ff ff       	call   800a46 <memmove>
+		*addrlen = ret->ret_addrlen;
+  80342b:	a1 10 90 80 00       	mov    0x809010,%eax
+  803430:	89 06                	mov    %eax,(%esi)
+  803432:	83 c4 10             	add    $0x10,%esp
+	return r;
+  803435:	eb d5                	jmp    80340c <nsipc_accept+0x27>
+
+00803437 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  803437:	55                   	push   %ebp
+  803438:	89 e5                	mov    %esp,%ebp
+  80343a:	53                   	push   %ebx
+  80343b:	83 ec 08             	sub    $0x8,%esp
+  80343e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  803441:	8b 45 08             	mov    0x8(%ebp),%eax
+  803444:	a3 00 90 80 00       	mov    %eax,0x809000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  803449:	53                   	push   %ebx
+  80344a:	ff 75 0c             	push   0xc(%ebp)
+  80344d:	68 04 90 80 00       	push   $0x809004
+  803452:	e8 ef d5 ff ff       	call   800a46 <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  803457:	89 1d 14 90 80 00    	mov    %ebx,0x809014
+	return nsipc(NSREQ_BIND);
+  80345d:	b8 02 00 00 00       	mov    $0x2,%eax
+  803462:	e8 32 ff ff ff       	call   803399 <nsipc>
+}
+  803467:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80346a:	c9                   	leave
+  80346b:	c3                   	ret
+
+0080346c <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  80346c:	55                   	push   %ebp
+  80346d:	89 e5                	mov    %esp,%ebp
+  80346f:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  803472:	8b 45 08             	mov    0x8(%ebp),%eax
+  803475:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.shutdown.req_how = how;
+  80347a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80347d:	a3 04 90 80 00       	mov    %eax,0x809004
+	return nsipc(NSREQ_SHUTDOWN);
+  803482:	b8 03 00 00 00       	mov    $0x3,%eax
+  803487:	e8 0d ff ff ff       	call   803399 <nsipc>
+}
+  80348c:	c9                   	leave
+  80348d:	c3                   	ret
+
+0080348e <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  80348e:	55                   	push   %ebp
+  80348f:	89 e5                	mov    %esp,%ebp
+  803491:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  803494:	8b 45 08             	mov    0x8(%ebp),%eax
+  803497:	a3 00 90 80 00       	mov    %eax,0x809000
+	return nsipc(NSREQ_CLOSE);
+  80349c:	b8 04 00 00 00       	mov    $0x4,%eax
+  8034a1:	e8 f3 fe ff ff       	call   803399 <nsipc>
+}
+  8034a6:	c9                   	leave
+  8034a7:	c3                   	ret
+
+008034a8 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  8034a8:	55                   	push   %ebp
+  8034a9:	89 e5                	mov    %esp,%ebp
+  8034ab:	53                   	push   %ebx
+  8034ac:	83 ec 08             	sub    $0x8,%esp
+  8034af:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  8034b2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8034b5:	a3 00 90 80 00       	mov    %eax,0x809000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  8034ba:	53                   	push   %ebx
+  8034bb:	ff 75 0c             	push   0xc(%ebp)
+  8034be:	68 04 90 80 00       	push   $0x809004
+  8034c3:	e8 7e d5 ff ff       	call   800a46 <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  8034c8:	89 1d 14 90 80 00    	mov    %ebx,0x809014
+	return nsipc(NSREQ_CONNECT);
+  8034ce:	b8 05 00 00 00       	mov    $0x5,%eax
+  8034d3:	e8 c1 fe ff ff       	call   803399 <nsipc>
+}
+  8034d8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8034db:	c9                   	leave
+  8034dc:	c3                   	ret
+
+008034dd <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  8034dd:	55                   	push   %ebp
+  8034de:	89 e5                	mov    %esp,%ebp
+  8034e0:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  8034e3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8034e6:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.listen.req_backlog = backlog;
+  8034eb:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8034ee:	a3 04 90 80 00       	mov    %eax,0x809004
+	return nsipc(NSREQ_LISTEN);
+  8034f3:	b8 06 00 00 00       	mov    $0x6,%eax
+  8034f8:	e8 9c fe ff ff       	call   803399 <nsipc>
+}
+  8034fd:	c9                   	leave
+  8034fe:	c3                   	ret
+
+008034ff <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  8034ff:	55                   	push   %ebp
+  803500:	89 e5                	mov    %esp,%ebp
+  803502:	56                   	push   %esi
+  803503:	53                   	push   %ebx
+  803504:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  803507:	8b 45 08             	mov    0x8(%ebp),%eax
+  80350a:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.recv.req_len = len;
+  80350f:	89 35 04 90 80 00    	mov    %esi,0x809004
+	nsipcbuf.recv.req_flags = flags;
+  803515:	8b 45 14             	mov    0x14(%ebp),%eax
+  803518:	a3 08 90 80 00       	mov    %eax,0x809008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  80351d:	b8 07 00 00 00       	mov    $0x7,%eax
+  803522:	e8 72 fe ff ff       	call   803399 <nsipc>
+  803527:	89 c3                	mov    %eax,%ebx
+  803529:	85 c0                	test   %eax,%eax
+  80352b:	78 22                	js     80354f <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  80352d:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  803532:	39 c6                	cmp    %eax,%esi
+  803534:	0f 4e c6             	cmovle %esi,%eax
+  803537:	39 c3                	cmp    %eax,%ebx
+  803539:	7f 1d                	jg     803558 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  80353b:	83 ec 04             	sub    $0x4,%esp
+  80353e:	53                   	push   %ebx
+  80353f:	68 00 90 80 00       	push   $0x809000
+  803544:	ff 75 0c             	push   0xc(%ebp)
+  803547:	e8 fa d4 ff ff       	call   800a46 <memmove>
+  80354c:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  80354f:	89 d8                	mov    %ebx,%eax
+  803551:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803554:	5b                   	pop    %ebx
+  803555:	5e                   	pop    %esi
+  803556:	5d                   	pop    %ebp
+  803557:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  803558:	68 8e 46 80 00       	push   $0x80468e
+  80355d:	68 ac 44 80 00       	push   $0x8044ac
+  803562:	6a 62                	push   $0x62
+  803564:	68 a3 46 80 00       	push   $0x8046a3
+  803569:	e8 89 cc ff ff       	call   8001f7 <_panic>
+
+0080356e <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  80356e:	55                   	push   %ebp
+  80356f:	89 e5                	mov    %esp,%ebp
+  803571:	53                   	push   %ebx
+  803572:	83 ec 04             	sub    $0x4,%esp
+  803575:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  803578:	8b 45 08             	mov    0x8(%ebp),%eax
+  80357b:	a3 00 90 80 00       	mov    %eax,0x809000
+	assert(size < 1600);
+  803580:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  803586:	7f 2e                	jg     8035b6 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  803588:	83 ec 04             	sub    $0x4,%esp
+  80358b:	53                   	push   %ebx
+  80358c:	ff 75 0c             	push   0xc(%ebp)
+  80358f:	68 0c 90 80 00       	push   $0x80900c
+  803594:	e8 ad d4 ff ff       	call   800a46 <memmove>
+	nsipcbuf.send.req_size = size;
+  803599:	89 1d 04 90 80 00    	mov    %ebx,0x809004
+	nsipcbuf.send.req_flags = flags;
+  80359f:	8b 45 14             	mov    0x14(%ebp),%eax
+  8035a2:	a3 08 90 80 00       	mov    %eax,0x809008
+	return nsipc(NSREQ_SEND);
+  8035a7:	b8 08 00 00 00       	mov    $0x8,%eax
+  8035ac:	e8 e8 fd ff ff       	call   803399 <nsipc>
+}
+  8035b1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8035b4:	c9                   	leave
+  8035b5:	c3                   	ret
+	assert(size < 1600);
+  8035b6:	68 af 46 80 00       	push   $0x8046af
+  8035bb:	68 ac 44 80 00       	push   $0x8044ac
+  8035c0:	6a 6d                	push   $0x6d
+  8035c2:	68 a3 46 80 00       	push   $0x8046a3
+  8035c7:	e8 2b cc ff ff       	call   8001f7 <_panic>
+
+008035cc <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  8035cc:	55                   	push   %ebp
+  8035cd:	89 e5                	mov    %esp,%ebp
+  8035cf:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  8035d2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8035d5:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.socket.req_type = type;
+  8035da:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8035dd:	a3 04 90 80 00       	mov    %eax,0x809004
+	nsipcbuf.socket.req_protocol = protocol;
+  8035e2:	8b 45 10             	mov    0x10(%ebp),%eax
+  8035e5:	a3 08 90 80 00       	mov    %eax,0x809008
+	return nsipc(NSREQ_SOCKET);
+  8035ea:	b8 09 00 00 00       	mov    $0x9,%eax
+  8035ef:	e8 a5 fd ff ff       	call   803399 <nsipc>
+}
+  8035f4:	c9                   	leave
+  8035f5:	c3                   	ret
+
+008035f6 <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  8035f6:	55                   	push   %ebp
+  8035f7:	89 e5                	mov    %esp,%ebp
+  8035f9:	56                   	push   %esi
+  8035fa:	53                   	push   %ebx
+  8035fb:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  8035fe:	83 ec 0c             	sub    $0xc,%esp
+  803601:	ff 75 08             	push   0x8(%ebp)
+  803604:	e8 e9 dd ff ff       	call   8013f2 <fd2data>
+  803609:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  80360b:	83 c4 08             	add    $0x8,%esp
+  80360e:	68 bb 46 80 00       	push   $0x8046bb
+  803613:	53                   	push   %ebx
+  803614:	e8 a7 d2 ff ff       	call   8008c0 <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  803619:	8b 46 04             	mov    0x4(%esi),%eax
+  80361c:	2b 06                	sub    (%esi),%eax
+  80361e:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  803624:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  80362b:	00 00 00 
+	stat->st_dev = &devpipe;
+  80362e:	c7 83 88 00 00 00 60 	movl   $0x805060,0x88(%ebx)
+  803635:	50 80 00 
+	return 0;
+}
+  803638:	b8 00 00 00 00       	mov    $0x0,%eax
+  80363d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803640:	5b                   	pop    %ebx
+  803641:	5e                   	pop    %esi
+  803642:	5d                   	pop    %ebp
+  803643:	c3                   	ret
+
+00803644 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  803644:	55                   	push   %ebp
+  803645:	89 e5                	mov    %esp,%ebp
+  803647:	53                   	push   %ebx
+  803648:	83 ec 0c             	sub    $0xc,%esp
+  80364b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  80364e:	53                   	push   %ebx
+  80364f:	6a 00                	push   $0x0
+  803651:	e8 03 d7 ff ff       	call   800d59 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  803656:	89 1c 24             	mov    %ebx,(%esp)
+  803659:	e8 94 dd ff ff       	call   8013f2 <fd2data>
+  80365e:	83 c4 08             	add    $0x8,%esp
+  803661:	50                   	push   %eax
+  803662:	6a 00                	push   $0x0
+  803664:	e8 f0 d6 ff ff       	call   800d59 <sys_page_unmap>
+}
+  803669:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80366c:	c9                   	leave
+  80366d:	c3                   	ret
+
+0080366e <_pipeisclosed>:
+{
+  80366e:	55                   	push   %ebp
+  80366f:	89 e5                	mov    %esp,%ebp
+  803671:	57                   	push   %edi
+  803672:	56                   	push   %esi
+  803673:	53                   	push   %ebx
+  803674:	83 ec 1c             	sub    $0x1c,%esp
+  803677:	89 c7                	mov    %eax,%edi
+  803679:	89 d6                	mov    %edx,%esi
+		n = thisenv->env_runs;
+  80367b:	a1 00 60 80 00       	mov    0x806000,%eax
+  803680:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  803683:	83 ec 0c             	sub    $0xc,%esp
+  803686:	57                   	push   %edi
+  803687:	e8 f6 06 00 00       	call   803d82 <pageref>
+  80368c:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80368f:	89 34 24             	mov    %esi,(%esp)
+  803692:	e8 eb 06 00 00       	call   803d82 <pageref>
+		nn = thisenv->env_runs;
+  803697:	8b 15 00 60 80 00    	mov    0x806000,%edx
+  80369d:	8b 4a 58             	mov    0x58(%edx),%ecx
+		if (n == nn)
+  8036a0:	83 c4 10             	add    $0x10,%esp
+  8036a3:	39 cb                	cmp    %ecx,%ebx
+  8036a5:	74 1b                	je     8036c2 <_pipeisclosed+0x54>
+		if (n != nn && ret == 1)
+  8036a7:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  8036aa:	75 cf                	jne    80367b <_pipeisclosed+0xd>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  8036ac:	8b 42 58             	mov    0x58(%edx),%eax
+  8036af:	6a 01                	push   $0x1
+  8036b1:	50                   	push   %eax
+  8036b2:	53                   	push   %ebx
+  8036b3:	68 c2 46 80 00       	push   $0x8046c2
+  8036b8:	e8 15 cc ff ff       	call   8002d2 <cprintf>
+  8036bd:	83 c4 10             	add    $0x10,%esp
+  8036c0:	eb b9                	jmp    80367b <_pipeisclosed+0xd>
+		ret = pageref(fd) == pageref(p);
+  8036c2:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  8036c5:	0f 94 c0             	sete   %al
+  8036c8:	0f b6 c0             	movzbl %al,%eax
+}
+  8036cb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8036ce:	5b                   	pop    %ebx
+  8036cf:	5e                   	pop    %esi
+  8036d0:	5f                   	pop    %edi
+  8036d1:	5d                   	pop    %ebp
+  8036d2:	c3                   	ret
+
+008036d3 <devpipe_write>:
+{
+  8036d3:	55                   	push   %ebp
+  8036d4:	89 e5                	mov    %esp,%ebp
+  8036d6:	57                   	push   %edi
+  8036d7:	56                   	push   %esi
+  8036d8:	53                   	push   %ebx
+  8036d9:	83 ec 28             	sub    $0x28,%esp
+  8036dc:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  8036df:	56                   	push   %esi
+  8036e0:	e8 0d dd ff ff       	call   8013f2 <fd2data>
+  8036e5:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  8036e7:	83 c4 10             	add    $0x10,%esp
+  8036ea:	bf 00 00 00 00       	mov    $0x0,%edi
+  8036ef:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  8036f2:	75 09                	jne    8036fd <devpipe_write+0x2a>
+	return i;
+  8036f4:	89 f8                	mov    %edi,%eax
+  8036f6:	eb 23                	jmp    80371b <devpipe_write+0x48>
+			sys_yield();
+  8036f8:	e8 b0 d5 ff ff       	call   800cad <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  8036fd:	8b 43 04             	mov    0x4(%ebx),%eax
+  803700:	8b 0b                	mov    (%ebx),%ecx
+  803702:	8d 51 20             	lea    0x20(%ecx),%edx
+  803705:	39 d0                	cmp    %edx,%eax
+  803707:	72 1a                	jb     803723 <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  803709:	89 da                	mov    %ebx,%edx
+  80370b:	89 f0                	mov    %esi,%eax
+  80370d:	e8 5c ff ff ff       	call   80366e <_pipeisclosed>
+  803712:	85 c0                	test   %eax,%eax
+  803714:	74 e2                	je     8036f8 <devpipe_write+0x25>
+				return 0;
+  803716:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80371b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80371e:	5b                   	pop    %ebx
+  80371f:	5e                   	pop    %esi
+  803720:	5f                   	pop    %edi
+  803721:	5d                   	pop    %ebp
+  803722:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  803723:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  803726:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  80372a:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  80372d:	89 c2                	mov    %eax,%edx
+  80372f:	c1 fa 1f             	sar    $0x1f,%edx
+  803732:	89 d1                	mov    %edx,%ecx
+  803734:	c1 e9 1b             	shr    $0x1b,%ecx
+  803737:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  80373a:	83 e2 1f             	and    $0x1f,%edx
+  80373d:	29 ca                	sub    %ecx,%edx
+  80373f:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  803743:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  803747:	83 c0 01             	add    $0x1,%eax
+  80374a:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  80374d:	83 c7 01             	add    $0x1,%edi
+  803750:	eb 9d                	jmp    8036ef <devpipe_write+0x1c>
+
+00803752 <devpipe_read>:
+{
+  803752:	55                   	push   %ebp
+  803753:	89 e5                	mov    %esp,%ebp
+  803755:	57                   	push   %edi
+  803756:	56                   	push   %esi
+  803757:	53                   	push   %ebx
+  803758:	83 ec 18             	sub    $0x18,%esp
+  80375b:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  80375e:	57                   	push   %edi
+  80375f:	e8 8e dc ff ff       	call   8013f2 <fd2data>
+  803764:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  803766:	83 c4 10             	add    $0x10,%esp
+  803769:	be 00 00 00 00       	mov    $0x0,%esi
+  80376e:	3b 75 10             	cmp    0x10(%ebp),%esi
+  803771:	75 13                	jne    803786 <devpipe_read+0x34>
+	return i;
+  803773:	89 f0                	mov    %esi,%eax
+  803775:	eb 02                	jmp    803779 <devpipe_read+0x27>
+				return i;
+  803777:	89 f0                	mov    %esi,%eax
+}
+  803779:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80377c:	5b                   	pop    %ebx
+  80377d:	5e                   	pop    %esi
+  80377e:	5f                   	pop    %edi
+  80377f:	5d                   	pop    %ebp
+  803780:	c3                   	ret
+			sys_yield();
+  803781:	e8 27 d5 ff ff       	call   800cad <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  803786:	8b 03                	mov    (%ebx),%eax
+  803788:	3b 43 04             	cmp    0x4(%ebx),%eax
+  80378b:	75 18                	jne    8037a5 <devpipe_read+0x53>
+			if (i > 0)
+  80378d:	85 f6                	test   %esi,%esi
+  80378f:	75 e6                	jne    803777 <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  803791:	89 da                	mov    %ebx,%edx
+  803793:	89 f8                	mov    %edi,%eax
+  803795:	e8 d4 fe ff ff       	call   80366e <_pipeisclosed>
+  80379a:	85 c0                	test   %eax,%eax
+  80379c:	74 e3                	je     803781 <devpipe_read+0x2f>
+				return 0;
+  80379e:	b8 00 00 00 00       	mov    $0x0,%eax
+  8037a3:	eb d4                	jmp    803779 <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  8037a5:	99                   	cltd
+  8037a6:	c1 ea 1b             	shr    $0x1b,%edx
+  8037a9:	01 d0                	add    %edx,%eax
+  8037ab:	83 e0 1f             	and    $0x1f,%eax
+  8037ae:	29 d0                	sub    %edx,%eax
+  8037b0:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  8037b5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8037b8:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  8037bb:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  8037be:	83 c6 01             	add    $0x1,%esi
+  8037c1:	eb ab                	jmp    80376e <devpipe_read+0x1c>
+
+008037c3 <pipe>:
+{
+  8037c3:	55                   	push   %ebp
+  8037c4:	89 e5                	mov    %esp,%ebp
+  8037c6:	56                   	push   %esi
+  8037c7:	53                   	push   %ebx
+  8037c8:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  8037cb:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8037ce:	50                   	push   %eax
+  8037cf:	e8 35 dc ff ff       	call   801409 <fd_alloc>
+  8037d4:	89 c3                	mov    %eax,%ebx
+  8037d6:	83 c4 10             	add    $0x10,%esp
+  8037d9:	85 c0                	test   %eax,%eax
+  8037db:	0f 88 23 01 00 00    	js     803904 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8037e1:	83 ec 04             	sub    $0x4,%esp
+  8037e4:	68 07 04 00 00       	push   $0x407
+  8037e9:	ff 75 f4             	push   -0xc(%ebp)
+  8037ec:	6a 00                	push   $0x0
+  8037ee:	e8 d9 d4 ff ff       	call   800ccc <sys_page_alloc>
+  8037f3:	89 c3                	mov    %eax,%ebx
+  8037f5:	83 c4 10             	add    $0x10,%esp
+  8037f8:	85 c0                	test   %eax,%eax
+  8037fa:	0f 88 04 01 00 00    	js     803904 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  803800:	83 ec 0c             	sub    $0xc,%esp
+  803803:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  803806:	50                   	push   %eax
+  803807:	e8 fd db ff ff       	call   801409 <fd_alloc>
+  80380c:	89 c3                	mov    %eax,%ebx
+  80380e:	83 c4 10             	add    $0x10,%esp
+  803811:	85 c0                	test   %eax,%eax
+  803813:	0f 88 db 00 00 00    	js     8038f4 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803819:	83 ec 04             	sub    $0x4,%esp
+  80381c:	68 07 04 00 00       	push   $0x407
+  803821:	ff 75 f0             	push   -0x10(%ebp)
+  803824:	6a 00                	push   $0x0
+  803826:	e8 a1 d4 ff ff       	call   800ccc <sys_page_alloc>
+  80382b:	89 c3                	mov    %eax,%ebx
+  80382d:	83 c4 10             	add    $0x10,%esp
+  803830:	85 c0                	test   %eax,%eax
+  803832:	0f 88 bc 00 00 00    	js     8038f4 <pipe+0x131>
+	va = fd2data(fd0);
+  803838:	83 ec 0c             	sub    $0xc,%esp
+  80383b:	ff 75 f4             	push   -0xc(%ebp)
+  80383e:	e8 af db ff ff       	call   8013f2 <fd2data>
+  803843:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803845:	83 c4 0c             	add    $0xc,%esp
+  803848:	68 07 04 00 00       	push   $0x407
+  80384d:	50                   	push   %eax
+  80384e:	6a 00                	push   $0x0
+  803850:	e8 77 d4 ff ff       	call   800ccc <sys_page_alloc>
+  803855:	89 c3                	mov    %eax,%ebx
+  803857:	83 c4 10             	add    $0x10,%esp
+  80385a:	85 c0                	test   %eax,%eax
+  80385c:	0f 88 82 00 00 00    	js     8038e4 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803862:	83 ec 0c             	sub    $0xc,%esp
+  803865:	ff 75 f0             	push   -0x10(%ebp)
+  803868:	e8 85 db ff ff       	call   8013f2 <fd2data>
+  80386d:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  803874:	50                   	push   %eax
+  803875:	6a 00                	push   $0x0
+  803877:	56                   	push   %esi
+  803878:	6a 00                	push   $0x0
+  80387a:	e8 98 d4 ff ff       	call   800d17 <sys_page_map>
+  80387f:	89 c3                	mov    %eax,%ebx
+  803881:	83 c4 20             	add    $0x20,%esp
+  803884:	85 c0                	test   %eax,%eax
+  803886:	78 4e                	js     8038d6 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  803888:	a1 60 50 80 00       	mov    0x805060,%eax
+  80388d:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  803890:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  803892:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  803895:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  80389c:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  80389f:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  8038a1:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  8038a4:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  8038ab:	83 ec 0c             	sub    $0xc,%esp
+  8038ae:	ff 75 f4             	push   -0xc(%ebp)
+  8038b1:	e8 2c db ff ff       	call   8013e2 <fd2num>
+  8038b6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8038b9:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  8038bb:	83 c4 04             	add    $0x4,%esp
+  8038be:	ff 75 f0             	push   -0x10(%ebp)
+  8038c1:	e8 1c db ff ff       	call   8013e2 <fd2num>
+  8038c6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8038c9:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  8038cc:	83 c4 10             	add    $0x10,%esp
+  8038cf:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8038d4:	eb 2e                	jmp    803904 <pipe+0x141>
+	sys_page_unmap(0, va);
+  8038d6:	83 ec 08             	sub    $0x8,%esp
+  8038d9:	56                   	push   %esi
+  8038da:	6a 00                	push   $0x0
+  8038dc:	e8 78 d4 ff ff       	call   800d59 <sys_page_unmap>
+  8038e1:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  8038e4:	83 ec 08             	sub    $0x8,%esp
+  8038e7:	ff 75 f0             	push   -0x10(%ebp)
+  8038ea:	6a 00                	push   $0x0
+  8038ec:	e8 68 d4 ff ff       	call   800d59 <sys_page_unmap>
+  8038f1:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  8038f4:	83 ec 08             	sub    $0x8,%esp
+  8038f7:	ff 75 f4             	push   -0xc(%ebp)
+  8038fa:	6a 00                	push   $0x0
+  8038fc:	e8 58 d4 ff ff       	call   800d59 <sys_page_unmap>
+  803901:	83 c4 10             	add    $0x10,%esp
+}
+  803904:	89 d8                	mov    %ebx,%eax
+  803906:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803909:	5b                   	pop    %ebx
+  80390a:	5e                   	pop    %esi
+  80390b:	5d                   	pop    %ebp
+  80390c:	c3                   	ret
+
+0080390d <pipeisclosed>:
+{
+  80390d:	55                   	push   %ebp
+  80390e:	89 e5                	mov    %esp,%ebp
+  803910:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803913:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803916:	50                   	push   %eax
+  803917:	ff 75 08             	push   0x8(%ebp)
+  80391a:	e8 40 db ff ff       	call   80145f <fd_lookup>
+  80391f:	83 c4 10             	add    $0x10,%esp
+  803922:	85 c0                	test   %eax,%eax
+  803924:	78 18                	js     80393e <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  803926:	83 ec 0c             	sub    $0xc,%esp
+  803929:	ff 75 f4             	push   -0xc(%ebp)
+  80392c:	e8 c1 da ff ff       	call   8013f2 <fd2data>
+  803931:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  803933:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803936:	e8 33 fd ff ff       	call   80366e <_pipeisclosed>
+  80393b:	83 c4 10             	add    $0x10,%esp
+}
+  80393e:	c9                   	leave
+  80393f:	c3                   	ret
+
+00803940 <wait>:
+#include <inc/lib.h>
+
+// Waits until 'envid' exits.
+void
+wait(envid_t envid)
+{
+  803940:	55                   	push   %ebp
+  803941:	89 e5                	mov    %esp,%ebp
+  803943:	56                   	push   %esi
+  803944:	53                   	push   %ebx
+  803945:	8b 75 08             	mov    0x8(%ebp),%esi
+	const volatile struct Env *e;
+
+	assert(envid != 0);
+  803948:	85 f6                	test   %esi,%esi
+  80394a:	74 16                	je     803962 <wait+0x22>
+	e = &envs[ENVX(envid)];
+  80394c:	89 f3                	mov    %esi,%ebx
+  80394e:	81 e3 ff 03 00 00    	and    $0x3ff,%ebx
+	while (e->env_id == envid && e->env_status != ENV_FREE)
+  803954:	69 db 8c 00 00 00    	imul   $0x8c,%ebx,%ebx
+  80395a:	81 c3 00 00 c0 ee    	add    $0xeec00000,%ebx
+  803960:	eb 1b                	jmp    80397d <wait+0x3d>
+	assert(envid != 0);
+  803962:	68 da 46 80 00       	push   $0x8046da
+  803967:	68 ac 44 80 00       	push   $0x8044ac
+  80396c:	6a 09                	push   $0x9
+  80396e:	68 e5 46 80 00       	push   $0x8046e5
+  803973:	e8 7f c8 ff ff       	call   8001f7 <_panic>
+		sys_yield();
+  803978:	e8 30 d3 ff ff       	call   800cad <sys_yield>
+	while (e->env_id == envid && e->env_status != ENV_FREE)
+  80397d:	8b 43 48             	mov    0x48(%ebx),%eax
+  803980:	39 f0                	cmp    %esi,%eax
+  803982:	75 07                	jne    80398b <wait+0x4b>
+  803984:	8b 43 54             	mov    0x54(%ebx),%eax
+  803987:	85 c0                	test   %eax,%eax
+  803989:	75 ed                	jne    803978 <wait+0x38>
+}
+  80398b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80398e:	5b                   	pop    %ebx
+  80398f:	5e                   	pop    %esi
+  803990:	5d                   	pop    %ebp
+  803991:	c3                   	ret
+
+00803992 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  803992:	b8 00 00 00 00       	mov    $0x0,%eax
+  803997:	c3                   	ret
+
+00803998 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  803998:	55                   	push   %ebp
+  803999:	89 e5                	mov    %esp,%ebp
+  80399b:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  80399e:	68 f0 46 80 00       	push   $0x8046f0
+  8039a3:	ff 75 0c             	push   0xc(%ebp)
+  8039a6:	e8 15 cf ff ff       	call   8008c0 <strcpy>
+	return 0;
+}
+  8039ab:	b8 00 00 00 00       	mov    $0x0,%eax
+  8039b0:	c9                   	leave
+  8039b1:	c3                   	ret
+
+008039b2 <devcons_write>:
+{
+  8039b2:	55                   	push   %ebp
+  8039b3:	89 e5                	mov    %esp,%ebp
+  8039b5:	57                   	push   %edi
+  8039b6:	56                   	push   %esi
+  8039b7:	53                   	push   %ebx
+  8039b8:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  8039be:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  8039c3:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  8039c9:	eb 2e                	jmp    8039f9 <devcons_write+0x47>
+		m = n - tot;
+  8039cb:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8039ce:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  8039d0:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  8039d5:	39 c3                	cmp    %eax,%ebx
+  8039d7:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  8039da:	83 ec 04             	sub    $0x4,%esp
+  8039dd:	53                   	push   %ebx
+  8039de:	89 f0                	mov    %esi,%eax
+  8039e0:	03 45 0c             	add    0xc(%ebp),%eax
+  8039e3:	50                   	push   %eax
+  8039e4:	57                   	push   %edi
+  8039e5:	e8 5c d0 ff ff       	call   800a46 <memmove>
+		sys_cputs(buf, m);
+  8039ea:	83 c4 08             	add    $0x8,%esp
+  8039ed:	53                   	push   %ebx
+  8039ee:	57                   	push   %edi
+  8039ef:	e8 fc d1 ff ff       	call   800bf0 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  8039f4:	01 de                	add    %ebx,%esi
+  8039f6:	83 c4 10             	add    $0x10,%esp
+  8039f9:	3b 75 10             	cmp    0x10(%ebp),%esi
+  8039fc:	72 cd                	jb     8039cb <devcons_write+0x19>
+}
+  8039fe:	89 f0                	mov    %esi,%eax
+  803a00:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803a03:	5b                   	pop    %ebx
+  803a04:	5e                   	pop    %esi
+  803a05:	5f                   	pop    %edi
+  803a06:	5d                   	pop    %ebp
+  803a07:	c3                   	ret
+
+00803a08 <devcons_read>:
+{
+  803a08:	55                   	push   %ebp
+  803a09:	89 e5                	mov    %esp,%ebp
+  803a0b:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  803a0e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803a13:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  803a17:	75 07                	jne    803a20 <devcons_read+0x18>
+  803a19:	eb 1f                	jmp    803a3a <devcons_read+0x32>
+		sys_yield();
+  803a1b:	e8 8d d2 ff ff       	call   800cad <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  803a20:	e8 f1 d1 ff ff       	call   800c16 <sys_cgetc>
+  803a25:	85 c0                	test   %eax,%eax
+  803a27:	74 f2                	je     803a1b <devcons_read+0x13>
+	if (c < 0)
+  803a29:	78 0f                	js     803a3a <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  803a2b:	83 f8 04             	cmp    $0x4,%eax
+  803a2e:	74 0c                	je     803a3c <devcons_read+0x34>
+	*(char*)vbuf = c;
+  803a30:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803a33:	88 02                	mov    %al,(%edx)
+	return 1;
+  803a35:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  803a3a:	c9                   	leave
+  803a3b:	c3                   	ret
+		return 0;
+  803a3c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803a41:	eb f7                	jmp    803a3a <devcons_read+0x32>
+
+00803a43 <cputchar>:
+{
+  803a43:	55                   	push   %ebp
+  803a44:	89 e5                	mov    %esp,%ebp
+  803a46:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  803a49:	8b 45 08             	mov    0x8(%ebp),%eax
+  803a4c:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  803a4f:	6a 01                	push   $0x1
+  803a51:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  803a54:	50                   	push   %eax
+  803a55:	e8 96 d1 ff ff       	call   800bf0 <sys_cputs>
+}
+  803a5a:	83 c4 10             	add    $0x10,%esp
+  803a5d:	c9                   	leave
+  803a5e:	c3                   	ret
+
+00803a5f <getchar>:
+{
+  803a5f:	55                   	push   %ebp
+  803a60:	89 e5                	mov    %esp,%ebp
+  803a62:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  803a65:	6a 01                	push   $0x1
+  803a67:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  803a6a:	50                   	push   %eax
+  803a6b:	6a 00                	push   $0x0
+  803a6d:	e8 53 dc ff ff       	call   8016c5 <read>
+	if (r < 0)
+  803a72:	83 c4 10             	add    $0x10,%esp
+  803a75:	85 c0                	test   %eax,%eax
+  803a77:	78 06                	js     803a7f <getchar+0x20>
+	if (r < 1)
+  803a79:	74 06                	je     803a81 <getchar+0x22>
+	return c;
+  803a7b:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  803a7f:	c9                   	leave
+  803a80:	c3                   	ret
+		return -E_EOF;
+  803a81:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  803a86:	eb f7                	jmp    803a7f <getchar+0x20>
+
+00803a88 <iscons>:
+{
+  803a88:	55                   	push   %ebp
+  803a89:	89 e5                	mov    %esp,%ebp
+  803a8b:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803a8e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803a91:	50                   	push   %eax
+  803a92:	ff 75 08             	push   0x8(%ebp)
+  803a95:	e8 c5 d9 ff ff       	call   80145f <fd_lookup>
+  803a9a:	83 c4 10             	add    $0x10,%esp
+  803a9d:	85 c0                	test   %eax,%eax
+  803a9f:	78 11                	js     803ab2 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  803aa1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803aa4:	8b 15 80 50 80 00    	mov    0x805080,%edx
+  803aaa:	39 10                	cmp    %edx,(%eax)
+  803aac:	0f 94 c0             	sete   %al
+  803aaf:	0f b6 c0             	movzbl %al,%eax
+}
+  803ab2:	c9                   	leave
+  803ab3:	c3                   	ret
+
+00803ab4 <opencons>:
+{
+  803ab4:	55                   	push   %ebp
+  803ab5:	89 e5                	mov    %esp,%ebp
+  803ab7:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  803aba:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803abd:	50                   	push   %eax
+  803abe:	e8 46 d9 ff ff       	call   801409 <fd_alloc>
+  803ac3:	83 c4 10             	add    $0x10,%esp
+  803ac6:	85 c0                	test   %eax,%eax
+  803ac8:	78 3a                	js     803b04 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  803aca:	83 ec 04             	sub    $0x4,%esp
+  803acd:	68 07 04 00 00       	push   $0x407
+  803ad2:	ff 75 f4             	push   -0xc(%ebp)
+  803ad5:	6a 00                	push   $0x0
+  803ad7:	e8 f0 d1 ff ff       	call   800ccc <sys_page_alloc>
+  803adc:	83 c4 10             	add    $0x10,%esp
+  803adf:	85 c0                	test   %eax,%eax
+  803ae1:	78 21                	js     803b04 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  803ae3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803ae6:	8b 15 80 50 80 00    	mov    0x805080,%edx
+  803aec:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  803aee:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803af1:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  803af8:	83 ec 0c             	sub    $0xc,%esp
+  803afb:	50                   	push   %eax
+  803afc:	e8 e1 d8 ff ff       	call   8013e2 <fd2num>
+  803b01:	83 c4 10             	add    $0x10,%esp
+}
+  803b04:	c9                   	leave
+  803b05:	c3                   	ret
+
+00803b06 <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  803b06:	55                   	push   %ebp
+  803b07:	89 e5                	mov    %esp,%ebp
+  803b09:	83 ec 08             	sub    $0x8,%esp
+	if (_pgfault_handler == 0) {
+  803b0c:	83 3d 04 a0 80 00 00 	cmpl   $0x0,0x80a004
+  803b13:	74 0a                	je     803b1f <set_pgfault_handler+0x19>
+				       PTE_U | PTE_W | PTE_P));
+		assert(!sys_env_set_pgfault_upcall(0, _pgfault_upcall));
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  803b15:	8b 45 08             	mov    0x8(%ebp),%eax
+  803b18:	a3 04 a0 80 00       	mov    %eax,0x80a004
+}
+  803b1d:	c9                   	leave
+  803b1e:	c3                   	ret
+		assert(!sys_page_alloc(0, (void *) UXSTACKTOP - PGSIZE,
+  803b1f:	83 ec 04             	sub    $0x4,%esp
+  803b22:	6a 07                	push   $0x7
+  803b24:	68 00 f0 bf ee       	push   $0xeebff000
+  803b29:	6a 00                	push   $0x0
+  803b2b:	e8 9c d1 ff ff       	call   800ccc <sys_page_alloc>
+  803b30:	83 c4 10             	add    $0x10,%esp
+  803b33:	85 c0                	test   %eax,%eax
+  803b35:	75 2c                	jne    803b63 <set_pgfault_handler+0x5d>
+		assert(!sys_env_set_pgfault_upcall(0, _pgfault_upcall));
+  803b37:	83 ec 08             	sub    $0x8,%esp
+  803b3a:	68 79 3b 80 00       	push   $0x803b79
+  803b3f:	6a 00                	push   $0x0
+  803b41:	e8 f1 d2 ff ff       	call   800e37 <sys_env_set_pgfault_upcall>
+  803b46:	83 c4 10             	add    $0x10,%esp
+  803b49:	85 c0                	test   %eax,%eax
+  803b4b:	74 c8                	je     803b15 <set_pgfault_handler+0xf>
+  803b4d:	68 44 47 80 00       	push   $0x804744
+  803b52:	68 ac 44 80 00       	push   $0x8044ac
+  803b57:	6a 20                	push   $0x20
+  803b59:	68 74 47 80 00       	push   $0x804774
+  803b5e:	e8 94 c6 ff ff       	call   8001f7 <_panic>
+		assert(!sys_page_alloc(0, (void *) UXSTACKTOP - PGSIZE,
+  803b63:	68 fc 46 80 00       	push   $0x8046fc
+  803b68:	68 ac 44 80 00       	push   $0x8044ac
+  803b6d:	6a 1e                	push   $0x1e
+  803b6f:	68 74 47 80 00       	push   $0x804774
+  803b74:	e8 7e c6 ff ff       	call   8001f7 <_panic>
+
+00803b79 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  803b79:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  803b7a:	a1 04 a0 80 00       	mov    0x80a004,%eax
+	call *%eax
+  803b7f:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  803b81:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+	movl	$-0x4, %ebp
+  803b84:	bd fc ff ff ff       	mov    $0xfffffffc,%ebp
+	xadd	%ebp, 0x30(%esp)	# Load trap-time %esp.
+  803b89:	0f c1 6c 24 30       	xadd   %ebp,0x30(%esp)
+
+	movl	0x28(%esp), %eax	# Load trap-time %eip.
+  803b8e:	8b 44 24 28          	mov    0x28(%esp),%eax
+	movl	%eax, -0x4(%ebp)
+  803b92:	89 45 fc             	mov    %eax,-0x4(%ebp)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+	addl	$0x8, %esp
+  803b95:	83 c4 08             	add    $0x8,%esp
+	popal
+  803b98:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+	addl	$0x4, %esp
+  803b99:	83 c4 04             	add    $0x4,%esp
+	popfl
+  803b9c:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+	popl	%esp
+  803b9d:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+	ret
+  803b9e:	c3                   	ret
+
+00803b9f <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  803b9f:	55                   	push   %ebp
+  803ba0:	89 e5                	mov    %esp,%ebp
+  803ba2:	56                   	push   %esi
+  803ba3:	53                   	push   %ebx
+  803ba4:	8b 75 08             	mov    0x8(%ebp),%esi
+  803ba7:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803baa:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int r;
+
+	if (pg == NULL)
+		pg = (void *) UTOP;
+  803bad:	85 c0                	test   %eax,%eax
+  803baf:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  803bb4:	0f 44 c2             	cmove  %edx,%eax
+
+	r = sys_ipc_recv(pg);
+  803bb7:	83 ec 0c             	sub    $0xc,%esp
+  803bba:	50                   	push   %eax
+  803bbb:	e8 54 d3 ff ff       	call   800f14 <sys_ipc_recv>
+	if (from_env_store)
+  803bc0:	83 c4 10             	add    $0x10,%esp
+  803bc3:	85 f6                	test   %esi,%esi
+  803bc5:	74 14                	je     803bdb <ipc_recv+0x3c>
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  803bc7:	ba 00 00 00 00       	mov    $0x0,%edx
+  803bcc:	85 c0                	test   %eax,%eax
+  803bce:	75 09                	jne    803bd9 <ipc_recv+0x3a>
+  803bd0:	8b 15 00 60 80 00    	mov    0x806000,%edx
+  803bd6:	8b 52 74             	mov    0x74(%edx),%edx
+  803bd9:	89 16                	mov    %edx,(%esi)
+	if (perm_store)
+  803bdb:	85 db                	test   %ebx,%ebx
+  803bdd:	74 25                	je     803c04 <ipc_recv+0x65>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  803bdf:	85 c0                	test   %eax,%eax
+  803be1:	74 0d                	je     803bf0 <ipc_recv+0x51>
+  803be3:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+	return r ?: thisenv->env_ipc_value;
+}
+  803be9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803bec:	5b                   	pop    %ebx
+  803bed:	5e                   	pop    %esi
+  803bee:	5d                   	pop    %ebp
+  803bef:	c3                   	ret
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  803bf0:	a1 00 60 80 00       	mov    0x806000,%eax
+  803bf5:	8b 40 78             	mov    0x78(%eax),%eax
+  803bf8:	89 03                	mov    %eax,(%ebx)
+	return r ?: thisenv->env_ipc_value;
+  803bfa:	a1 00 60 80 00       	mov    0x806000,%eax
+  803bff:	8b 40 70             	mov    0x70(%eax),%eax
+  803c02:	eb e5                	jmp    803be9 <ipc_recv+0x4a>
+  803c04:	85 c0                	test   %eax,%eax
+  803c06:	75 e1                	jne    803be9 <ipc_recv+0x4a>
+  803c08:	eb f0                	jmp    803bfa <ipc_recv+0x5b>
+
+00803c0a <ipc_send>:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  803c0a:	55                   	push   %ebp
+  803c0b:	89 e5                	mov    %esp,%ebp
+  803c0d:	57                   	push   %edi
+  803c0e:	56                   	push   %esi
+  803c0f:	53                   	push   %ebx
+  803c10:	83 ec 0c             	sub    $0xc,%esp
+  803c13:	8b 7d 08             	mov    0x8(%ebp),%edi
+  803c16:	8b 75 0c             	mov    0xc(%ebp),%esi
+  803c19:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int r;
+
+	if (pg == NULL)
+		pg = (void *) UTOP;
+  803c1c:	85 db                	test   %ebx,%ebx
+  803c1e:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  803c23:	0f 44 d8             	cmove  %eax,%ebx
+
+	while ((r = sys_ipc_try_send(to_env, val, pg, perm))) {
+  803c26:	ff 75 14             	push   0x14(%ebp)
+  803c29:	53                   	push   %ebx
+  803c2a:	56                   	push   %esi
+  803c2b:	57                   	push   %edi
+  803c2c:	e8 50 d2 ff ff       	call   800e81 <sys_ipc_try_send>
+  803c31:	83 c4 10             	add    $0x10,%esp
+  803c34:	85 c0                	test   %eax,%eax
+  803c36:	74 22                	je     803c5a <ipc_send+0x50>
+		assert(r == -E_IPC_NOT_RECV);
+  803c38:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  803c3b:	75 07                	jne    803c44 <ipc_send+0x3a>
+		sys_yield();
+  803c3d:	e8 6b d0 ff ff       	call   800cad <sys_yield>
+  803c42:	eb e2                	jmp    803c26 <ipc_send+0x1c>
+		assert(r == -E_IPC_NOT_RECV);
+  803c44:	68 82 47 80 00       	push   $0x804782
+  803c49:	68 ac 44 80 00       	push   $0x8044ac
+  803c4e:	6a 39                	push   $0x39
+  803c50:	68 97 47 80 00       	push   $0x804797
+  803c55:	e8 9d c5 ff ff       	call   8001f7 <_panic>
+	}
+}
+  803c5a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803c5d:	5b                   	pop    %ebx
+  803c5e:	5e                   	pop    %esi
+  803c5f:	5f                   	pop    %edi
+  803c60:	5d                   	pop    %ebp
+  803c61:	c3                   	ret
+
+00803c62 <ipc_recvv>:
+// Receive a value and up to *npages pages, mapped one after another
+// starting at 'pg'.  Like ipc_recv otherwise; also stores the number
+// of pages actually received in *npages (0 on error).
+int32_t
+ipc_recvv(envid_t *from_env_store, void *pg, int *npages, int *perm_store)
+{
+  803c62:	55                   	push   %ebp
+  803c63:	89 e5                	mov    %esp,%ebp
+  803c65:	57                   	push   %edi
+  803c66:	56                   	push   %esi
+  803c67:	53                   	push   %ebx
+  803c68:	83 ec 10             	sub    $0x10,%esp
+  803c6b:	8b 7d 08             	mov    0x8(%ebp),%edi
+  803c6e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803c71:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  803c74:	8b 75 14             	mov    0x14(%ebp),%esi
+	int r;
+
+	if (pg == NULL)
+		pg = (void *) UTOP;
+  803c77:	85 c0                	test   %eax,%eax
+  803c79:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  803c7e:	0f 44 c2             	cmove  %edx,%eax
+
+	r = sys_ipc_recvv(pg, *npages, 0);
+  803c81:	6a 00                	push   $0x0
+  803c83:	ff 33                	push   (%ebx)
+  803c85:	50                   	push   %eax
+  803c86:	e8 46 d2 ff ff       	call   800ed1 <sys_ipc_recvv>
+	*npages = !r ? thisenv->env_ipc_npages : 0;
+  803c8b:	83 c4 10             	add    $0x10,%esp
+  803c8e:	85 c0                	test   %eax,%eax
+  803c90:	75 3c                	jne    803cce <ipc_recvv+0x6c>
+  803c92:	8b 15 00 60 80 00    	mov    0x806000,%edx
+  803c98:	8b 52 7c             	mov    0x7c(%edx),%edx
+  803c9b:	89 13                	mov    %edx,(%ebx)
+	if (from_env_store)
+  803c9d:	85 ff                	test   %edi,%edi
+  803c9f:	74 4e                	je     803cef <ipc_recvv+0x8d>
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  803ca1:	8b 15 00 60 80 00    	mov    0x806000,%edx
+  803ca7:	8b 52 74             	mov    0x74(%edx),%edx
+  803caa:	89 17                	mov    %edx,(%edi)
+	if (perm_store)
+  803cac:	85 f6                	test   %esi,%esi
+  803cae:	74 18                	je     803cc8 <ipc_recvv+0x66>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  803cb0:	85 c0                	test   %eax,%eax
+  803cb2:	75 2d                	jne    803ce1 <ipc_recvv+0x7f>
+  803cb4:	a1 00 60 80 00       	mov    0x806000,%eax
+  803cb9:	8b 40 78             	mov    0x78(%eax),%eax
+  803cbc:	89 06                	mov    %eax,(%esi)
+	return r ?: thisenv->env_ipc_value;
+  803cbe:	a1 00 60 80 00       	mov    0x806000,%eax
+  803cc3:	8b 40 70             	mov    0x70(%eax),%eax
+  803cc6:	eb 1f                	jmp    803ce7 <ipc_recvv+0x85>
+  803cc8:	85 c0                	test   %eax,%eax
+  803cca:	75 1b                	jne    803ce7 <ipc_recvv+0x85>
+  803ccc:	eb f0                	jmp    803cbe <ipc_recvv+0x5c>
+	*npages = !r ? thisenv->env_ipc_npages : 0;
+  803cce:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  803cd4:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (from_env_store)
+  803cd9:	85 ff                	test   %edi,%edi
+  803cdb:	75 cd                	jne    803caa <ipc_recvv+0x48>
+	if (perm_store)
+  803cdd:	85 f6                	test   %esi,%esi
+  803cdf:	74 e7                	je     803cc8 <ipc_recvv+0x66>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  803ce1:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+}
+  803ce7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803cea:	5b                   	pop    %ebx
+  803ceb:	5e                   	pop    %esi
+  803cec:	5f                   	pop    %edi
+  803ced:	5d                   	pop    %ebp
+  803cee:	c3                   	ret
+	if (perm_store)
+  803cef:	85 f6                	test   %esi,%esi
+  803cf1:	75 bd                	jne    803cb0 <ipc_recvv+0x4e>
+  803cf3:	eb c9                	jmp    803cbe <ipc_recvv+0x5c>
+
+00803cf5 <ipc_sendv>:
+// Each entry is a page address or'ed with the permissions to send
+// that page with (see sys_ipc_try_sendv).
+// Like ipc_send, keeps trying until it succeeds.
+void
+ipc_sendv(envid_t to_env, uint32_t val, const uintptr_t *pages, int npages)
+{
+  803cf5:	55                   	push   %ebp
+  803cf6:	89 e5                	mov    %esp,%ebp
+  803cf8:	57                   	push   %edi
+  803cf9:	56                   	push   %esi
+  803cfa:	53                   	push   %ebx
+  803cfb:	83 ec 0c             	sub    $0xc,%esp
+  803cfe:	8b 7d 08             	mov    0x8(%ebp),%edi
+  803d01:	8b 75 0c             	mov    0xc(%ebp),%esi
+  803d04:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int r;
+
+	while ((r = sys_ipc_try_sendv(to_env, val, pages, npages))) {
+  803d07:	ff 75 14             	push   0x14(%ebp)
+  803d0a:	53                   	push   %ebx
+  803d0b:	56                   	push   %esi
+  803d0c:	57                   	push   %edi
+  803d0d:	e8 97 d1 ff ff       	call   800ea9 <sys_ipc_try_sendv>
+  803d12:	83 c4 10             	add    $0x10,%esp
+  803d15:	85 c0                	test   %eax,%eax
+  803d17:	74 22                	je     803d3b <ipc_sendv+0x46>
+		assert(r == -E_IPC_NOT_RECV);
+  803d19:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  803d1c:	75 07                	jne    803d25 <ipc_sendv+0x30>
+		sys_yield();
+  803d1e:	e8 8a cf ff ff       	call   800cad <sys_yield>
+  803d23:	eb e2                	jmp    803d07 <ipc_sendv+0x12>
+		assert(r == -E_IPC_NOT_RECV);
+  803d25:	68 82 47 80 00       	push   $0x804782
+  803d2a:	68 ac 44 80 00       	push   $0x8044ac
+  803d2f:	6a 5c                	push   $0x5c
+  803d31:	68 97 47 80 00       	push   $0x804797
+  803d36:	e8 bc c4 ff ff       	call   8001f7 <_panic>
+	}
+}
+  803d3b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803d3e:	5b                   	pop    %ebx
+  803d3f:	5e                   	pop    %esi
+  803d40:	5f                   	pop    %edi
+  803d41:	5d                   	pop    %ebp
+  803d42:	c3                   	ret
+
+00803d43 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  803d43:	55                   	push   %ebp
+  803d44:	89 e5                	mov    %esp,%ebp
+  803d46:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  803d49:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (envs[i].env_type == type)
+  803d4e:	69 d0 8c 00 00 00    	imul   $0x8c,%eax,%edx
+  803d54:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  803d5a:	8b 52 50             	mov    0x50(%edx),%edx
+  803d5d:	39 ca                	cmp    %ecx,%edx
+  803d5f:	74 11                	je     803d72 <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  803d61:	83 c0 01             	add    $0x1,%eax
+  803d64:	3d 00 04 00 00       	cmp    $0x400,%eax
+  803d69:	75 e3                	jne    803d4e <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  803d6b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803d70:	eb 0e                	jmp    803d80 <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  803d72:	69 c0 8c 00 00 00    	imul   $0x8c,%eax,%eax
+  803d78:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803d7d:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  803d80:	5d                   	pop    %ebp
+  803d81:	c3                   	ret
+
+00803d82 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  803d82:	55                   	push   %ebp
+  803d83:	89 e5                	mov    %esp,%ebp
+  803d85:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  803d88:	89 c2                	mov    %eax,%edx
+  803d8a:	c1 ea 16             	shr    $0x16,%edx
+  803d8d:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  803d94:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  803d99:	f6 c1 01             	test   $0x1,%cl
+  803d9c:	74 22                	je     803dc0 <pageref+0x3e>
+	pte = uvpt[PGNUM(v)];
+  803d9e:	c1 e8 0c             	shr    $0xc,%eax
+  803da1:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  803da8:	a8 01                	test   $0x1,%al
+  803daa:	74 14                	je     803dc0 <pageref+0x3e>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  803dac:	c1 e8 0c             	shr    $0xc,%eax
+  803daf:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  803db2:	8d 04 85 00 00 00 ef 	lea    -0x11000000(,%eax,4),%eax
+  803db9:	0f b7 50 08          	movzwl 0x8(%eax),%edx
+  803dbd:	0f b7 d2             	movzwl %dx,%edx
+}
+  803dc0:	89 d0                	mov    %edx,%eax
+  803dc2:	5d                   	pop    %ebp
+  803dc3:	c3                   	ret
+
+00803dc4 <dm>:
+  803dc4:	55                   	push   %ebp
+  803dc5:	57                   	push   %edi
+  803dc6:	56                   	push   %esi
+  803dc7:	53                   	push   %ebx
+  803dc8:	83 ec 24             	sub    $0x24,%esp
+  803dcb:	89 44 24 08          	mov    %eax,0x8(%esp)
+  803dcf:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  803dd3:	8b 44 24 38          	mov    0x38(%esp),%eax
+  803dd7:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  803ddb:	89 44 24 10          	mov    %eax,0x10(%esp)
+  803ddf:	89 54 24 14          	mov    %edx,0x14(%esp)
+  803de3:	8b 7c 24 40          	mov    0x40(%esp),%edi
+  803de7:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  803dec:	b8 00 00 00 00       	mov    $0x0,%eax
+  803df1:	ba 00 00 00 00       	mov    $0x0,%edx
+  803df6:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  803dfd:	00 
+  803dfe:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  803e05:	00 
+  803e06:	89 fb                	mov    %edi,%ebx
+  803e08:	eb 08                	jmp    803e12 <dm+0x4e>
+  803e0a:	83 e9 01             	sub    $0x1,%ecx
+  803e0d:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  803e10:	74 68                	je     803e7a <dm+0xb6>
+  803e12:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  803e16:	01 c0                	add    %eax,%eax
+  803e18:	89 c6                	mov    %eax,%esi
+  803e1a:	89 d7                	mov    %edx,%edi
+  803e1c:	8b 44 24 08          	mov    0x8(%esp),%eax
+  803e20:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  803e24:	0f ad d0             	shrd   %cl,%edx,%eax
+  803e27:	d3 ea                	shr    %cl,%edx
+  803e29:	f6 c1 20             	test   $0x20,%cl
+  803e2c:	74 04                	je     803e32 <dm+0x6e>
+  803e2e:	89 d0                	mov    %edx,%eax
+  803e30:	31 d2                	xor    %edx,%edx
+  803e32:	83 e0 01             	and    $0x1,%eax
+  803e35:	89 04 24             	mov    %eax,(%esp)
+  803e38:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  803e3f:	00 
+  803e40:	8b 04 24             	mov    (%esp),%eax
+  803e43:	8b 54 24 04          	mov    0x4(%esp),%edx
+  803e47:	09 f0                	or     %esi,%eax
+  803e49:	09 fa                	or     %edi,%edx
+  803e4b:	8b 74 24 10          	mov    0x10(%esp),%esi
+  803e4f:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  803e53:	39 f0                	cmp    %esi,%eax
+  803e55:	89 d5                	mov    %edx,%ebp
+  803e57:	19 fd                	sbb    %edi,%ebp
+  803e59:	72 af                	jb     803e0a <dm+0x46>
+  803e5b:	29 f0                	sub    %esi,%eax
+  803e5d:	19 fa                	sbb    %edi,%edx
+  803e5f:	89 cf                	mov    %ecx,%edi
+  803e61:	c1 ef 05             	shr    $0x5,%edi
+  803e64:	83 e7 01             	and    $0x1,%edi
+  803e67:	89 fe                	mov    %edi,%esi
+  803e69:	83 f6 01             	xor    $0x1,%esi
+  803e6c:	d3 e6                	shl    %cl,%esi
+  803e6e:	d3 e7                	shl    %cl,%edi
+  803e70:	09 74 24 18          	or     %esi,0x18(%esp)
+  803e74:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  803e78:	eb 90                	jmp    803e0a <dm+0x46>
+  803e7a:	85 db                	test   %ebx,%ebx
+  803e7c:	74 05                	je     803e83 <dm+0xbf>
+  803e7e:	89 03                	mov    %eax,(%ebx)
+  803e80:	89 53 04             	mov    %edx,0x4(%ebx)
+  803e83:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803e87:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803e8b:	83 c4 24             	add    $0x24,%esp
+  803e8e:	5b                   	pop    %ebx
+  803e8f:	5e                   	pop    %esi
+  803e90:	5f                   	pop    %edi
+  803e91:	5d                   	pop    %ebp
+  803e92:	c3                   	ret
+
+00803e93 <__udivdi3>:
+  803e93:	83 ec 08             	sub    $0x8,%esp
+  803e96:	6a 00                	push   $0x0
+  803e98:	ff 74 24 1c          	push   0x1c(%esp)
+  803e9c:	ff 74 24 1c          	push   0x1c(%esp)
+  803ea0:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803ea4:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803ea8:	e8 17 ff ff ff       	call   803dc4 <dm>
+  803ead:	83 c4 14             	add    $0x14,%esp
+  803eb0:	c3                   	ret
+
+00803eb1 <__umoddi3>:
+  803eb1:	83 ec 18             	sub    $0x18,%esp
+  803eb4:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  803eb8:	50                   	push   %eax
+  803eb9:	ff 74 24 2c          	push   0x2c(%esp)
+  803ebd:	ff 74 24 2c          	push   0x2c(%esp)
+  803ec1:	8b 44 24 28          	mov    0x28(%esp),%eax
+  803ec5:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  803ec9:	e8 f6 fe ff ff       	call   803dc4 <dm>
+  803ece:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803ed2:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803ed6:	83 c4 24             	add    $0x24,%esp
+  803ed9:	c3                   	ret
+
+00803eda <__divdi3>:
+  803eda:	53                   	push   %ebx
+  803edb:	8b 44 24 08          	mov    0x8(%esp),%eax
+  803edf:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  803ee3:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  803ee7:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  803eeb:	85 d2                	test   %edx,%edx
+  803eed:	78 15                	js     803f04 <__divdi3+0x2a>
+  803eef:	85 db                	test   %ebx,%ebx
+  803ef1:	78 34                	js     803f27 <__divdi3+0x4d>
+  803ef3:	83 ec 04             	sub    $0x4,%esp
+  803ef6:	6a 00                	push   $0x0
+  803ef8:	53                   	push   %ebx
+  803ef9:	51                   	push   %ecx
+  803efa:	e8 c5 fe ff ff       	call   803dc4 <dm>
+  803eff:	83 c4 10             	add    $0x10,%esp
+  803f02:	eb 21                	jmp    803f25 <__divdi3+0x4b>
+  803f04:	f7 d8                	neg    %eax
+  803f06:	83 d2 00             	adc    $0x0,%edx
+  803f09:	f7 da                	neg    %edx
+  803f0b:	85 db                	test   %ebx,%ebx
+  803f0d:	78 30                	js     803f3f <__divdi3+0x65>
+  803f0f:	83 ec 04             	sub    $0x4,%esp
+  803f12:	6a 00                	push   $0x0
+  803f14:	53                   	push   %ebx
+  803f15:	51                   	push   %ecx
+  803f16:	e8 a9 fe ff ff       	call   803dc4 <dm>
+  803f1b:	83 c4 10             	add    $0x10,%esp
+  803f1e:	f7 d8                	neg    %eax
+  803f20:	83 d2 00             	adc    $0x0,%edx
+  803f23:	f7 da                	neg    %edx
+  803f25:	5b                   	pop    %ebx
+  803f26:	c3                   	ret
+  803f27:	83 ec 04             	sub    $0x4,%esp
+  803f2a:	6a 00                	push   $0x0
+  803f2c:	f7 d9                	neg    %ecx
+  803f2e:	83 d3 00             	adc    $0x0,%ebx
+  803f31:	f7 db                	neg    %ebx
+  803f33:	53                   	push   %ebx
+  803f34:	51                   	push   %ecx
+  803f35:	e8 8a fe ff ff       	call   803dc4 <dm>
+  803f3a:	83 c4 10             	add    $0x10,%esp
+  803f3d:	eb df                	jmp    803f1e <__divdi3+0x44>
+  803f3f:	83 ec 04             	sub    $0x4,%esp
+  803f42:	6a 00                	push   $0x0
+  803f44:	f7 d9                	neg    %ecx
+  803f46:	83 d3 00             	adc    $0x0,%ebx
+  803f49:	f7 db                	neg    %ebx
+  803f4b:	53                   	push   %ebx
+  803f4c:	51                   	push   %ecx
+  803f4d:	e8 72 fe ff ff       	call   803dc4 <dm>
+  803f52:	83 c4 10             	add    $0x10,%esp
+  803f55:	eb ce                	jmp    803f25 <__divdi3+0x4b>
+
+00803f57 <__moddi3>:
+  803f57:	55                   	push   %ebp
+  803f58:	57                   	push   %edi
+  803f59:	56                   	push   %esi
+  803f5a:	53                   	push   %ebx
+  803f5b:	83 ec 24             	sub    $0x24,%esp
+  803f5e:	8b 44 24 38          	mov    0x38(%esp),%eax
+  803f62:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  803f66:	8b 4c 24 40          	mov    0x40(%esp),%ecx
+  803f6a:	8b 5c 24 44          	mov    0x44(%esp),%ebx
+  803f6e:	85 d2                	test   %edx,%edx
+  803f70:	78 3b                	js     803fad <__moddi3+0x56>
+  803f72:	83 ec 04             	sub    $0x4,%esp
+  803f75:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  803f79:	56                   	push   %esi
+  803f7a:	89 ce                	mov    %ecx,%esi
+  803f7c:	f7 de                	neg    %esi
+  803f7e:	89 74 24 08          	mov    %esi,0x8(%esp)
+  803f82:	89 de                	mov    %ebx,%esi
+  803f84:	83 d6 00             	adc    $0x0,%esi
+  803f87:	f7 de                	neg    %esi
+  803f89:	89 74 24 14          	mov    %esi,0x14(%esp)
+  803f8d:	8b 74 24 08          	mov    0x8(%esp),%esi
+  803f91:	0f 48 f1             	cmovs  %ecx,%esi
+  803f94:	0f 49 5c 24 14       	cmovns 0x14(%esp),%ebx
+  803f99:	53                   	push   %ebx
+  803f9a:	56                   	push   %esi
+  803f9b:	e8 24 fe ff ff       	call   803dc4 <dm>
+  803fa0:	8b 44 24 28          	mov    0x28(%esp),%eax
+  803fa4:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  803fa8:	83 c4 10             	add    $0x10,%esp
+  803fab:	eb 47                	jmp    803ff4 <__moddi3+0x9d>
+  803fad:	f7 d8                	neg    %eax
+  803faf:	83 d2 00             	adc    $0x0,%edx
+  803fb2:	f7 da                	neg    %edx
+  803fb4:	83 ec 04             	sub    $0x4,%esp
+  803fb7:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  803fbb:	56                   	push   %esi
+  803fbc:	89 cf                	mov    %ecx,%edi
+  803fbe:	f7 df                	neg    %edi
+  803fc0:	89 de                	mov    %ebx,%esi
+  803fc2:	83 d6 00             	adc    $0x0,%esi
+  803fc5:	f7 de                	neg    %esi
+  803fc7:	0f 49 cf             	cmovns %edi,%ecx
+  803fca:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  803fce:	0f 49 de             	cmovns %esi,%ebx
+  803fd1:	89 5c 24 0c          	mov    %ebx,0xc(%esp)
+  803fd5:	ff 74 24 0c          	push   0xc(%esp)
+  803fd9:	ff 74 24 0c          	push   0xc(%esp)
+  803fdd:	e8 e2 fd ff ff       	call   803dc4 <dm>
+  803fe2:	8b 44 24 28          	mov    0x28(%esp),%eax
+  803fe6:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  803fea:	f7 d8                	neg    %eax
+  803fec:	83 d2 00             	adc    $0x0,%edx
+  803fef:	f7 da                	neg    %edx
+  803ff1:	83 c4 10             	add    $0x10,%esp
+  803ff4:	83 c4 24             	add    $0x24,%esp
+  803ff7:	5b                   	pop    %ebx
+  803ff8:	5e                   	pop    %esi
+  803ff9:	5f                   	pop    %edi
+  803ffa:	5d                   	pop    %ebp
+  803ffb:	c3                   	ret
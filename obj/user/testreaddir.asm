@@ -0,0 +1,8480 @@
+
+obj/user/testreaddir.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 97 09 00 00       	call   8009c8 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <mk>:
+static char buf[PGSIZE];
+static char sbuf[5*PGSIZE] __attribute__((aligned(PGSIZE)));
+
+static void
+mk(const char *name, int type, off_t size)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	57                   	push   %edi
+  800037:	56                   	push   %esi
+  800038:	53                   	push   %ebx
+  800039:	81 ec 1c 04 00 00    	sub    $0x41c,%esp
+  80003f:	89 c3                	mov    %eax,%ebx
+  800041:	89 d7                	mov    %edx,%edi
+  800043:	89 95 e0 fb ff ff    	mov    %edx,-0x420(%ebp)
+  800049:	89 8d e4 fb ff ff    	mov    %ecx,-0x41c(%ebp)
+	char path[MAXPATHLEN];
+	const char *p;
+	struct Ent *e;
+	int f, r;
+
+	snprintf(path, sizeof(path), "/rd/%s", name);
+  80004f:	50                   	push   %eax
+  800050:	68 e0 40 80 00       	push   $0x8040e0
+  800055:	68 00 04 00 00       	push   $0x400
+  80005a:	8d 85 e8 fb ff ff    	lea    -0x418(%ebp),%eax
+  800060:	50                   	push   %eax
+  800061:	e8 39 10 00 00       	call   80109f <snprintf>
+	if (type == FTYPE_DIR)
+  800066:	83 c4 10             	add    $0x10,%esp
+  800069:	83 ff 01             	cmp    $0x1,%edi
+  80006c:	0f 84 9b 00 00 00    	je     80010d <mk+0xda>
+		f = open(path, O_RDONLY|O_CREAT|O_EXCL|O_MKDIR);
+	else
+		f = open(path, O_RDWR|O_CREAT|O_EXCL);
+  800072:	83 ec 08             	sub    $0x8,%esp
+  800075:	68 02 05 00 00       	push   $0x502
+  80007a:	8d 85 e8 fb ff ff    	lea    -0x418(%ebp),%eax
+  800080:	50                   	push   %eax
+  800081:	e8 14 26 00 00       	call   80269a <open>
+  800086:	89 c6                	mov    %eax,%esi
+  800088:	83 c4 10             	add    $0x10,%esp
+	if (f < 0)
+  80008b:	85 f6                	test   %esi,%esi
+  80008d:	0f 88 98 00 00 00    	js     80012b <mk+0xf8>
+		panic("create %s: %e", path, f);
+	if (size && (r = write(f, data, size)) != size)
+  800093:	8b bd e4 fb ff ff    	mov    -0x41c(%ebp),%edi
+  800099:	85 ff                	test   %edi,%edi
+  80009b:	74 1a                	je     8000b7 <mk+0x84>
+  80009d:	83 ec 04             	sub    $0x4,%esp
+  8000a0:	57                   	push   %edi
+  8000a1:	68 00 c0 80 00       	push   $0x80c000
+  8000a6:	56                   	push   %esi
+  8000a7:	e8 06 1c 00 00       	call   801cb2 <write>
+  8000ac:	83 c4 10             	add    $0x10,%esp
+  8000af:	39 c7                	cmp    %eax,%edi
+  8000b1:	0f 85 90 00 00 00    	jne    800147 <mk+0x114>
+		panic("write %s: %e", path, r);
+	close(f);
+  8000b7:	83 ec 0c             	sub    $0xc,%esp
+  8000ba:	56                   	push   %esi
+  8000bb:	e8 e8 19 00 00       	call   801aa8 <close>
+
+	e = &ents[nents++];
+  8000c0:	8b 35 00 10 81 00    	mov    0x811000,%esi
+  8000c6:	8d 46 01             	lea    0x1(%esi),%eax
+  8000c9:	a3 00 10 81 00       	mov    %eax,0x811000
+	strcpy(e->name, name);
+  8000ce:	83 c4 08             	add    $0x8,%esp
+  8000d1:	53                   	push   %ebx
+  8000d2:	69 fe 10 04 00 00    	imul   $0x410,%esi,%edi
+  8000d8:	81 c7 20 10 81 00    	add    $0x811020,%edi
+  8000de:	57                   	push   %edi
+  8000df:	e8 10 10 00 00       	call   8010f4 <strcpy>
+	e->type = type;
+  8000e4:	8b 85 e0 fb ff ff    	mov    -0x420(%ebp),%eax
+  8000ea:	89 87 00 04 00 00    	mov    %eax,0x400(%edi)
+	e->size = size;
+  8000f0:	8b 85 e4 fb ff ff    	mov    -0x41c(%ebp),%eax
+  8000f6:	89 87 04 04 00 00    	mov    %eax,0x404(%edi)
+	for (e->depth = 0, p = name; *p; p++)
+  8000fc:	c7 87 08 04 00 00 00 	movl   $0x0,0x408(%edi)
+  800103:	00 00 00 
+  800106:	83 c4 10             	add    $0x10,%esp
+		if (*p == '/')
+			e->depth++;
+  800109:	89 fe                	mov    %edi,%esi
+	for (e->depth = 0, p = name; *p; p++)
+  80010b:	eb 59                	jmp    800166 <mk+0x133>
+		f = open(path, O_RDONLY|O_CREAT|O_EXCL|O_MKDIR);
+  80010d:	83 ec 08             	sub    $0x8,%esp
+  800110:	68 00 0d 00 00       	push   $0xd00
+  800115:	8d 85 e8 fb ff ff    	lea    -0x418(%ebp),%eax
+  80011b:	50                   	push   %eax
+  80011c:	e8 79 25 00 00       	call   80269a <open>
+  800121:	89 c6                	mov    %eax,%esi
+  800123:	83 c4 10             	add    $0x10,%esp
+  800126:	e9 60 ff ff ff       	jmp    80008b <mk+0x58>
+		panic("create %s: %e", path, f);
+  80012b:	83 ec 0c             	sub    $0xc,%esp
+  80012e:	56                   	push   %esi
+  80012f:	8d 85 e8 fb ff ff    	lea    -0x418(%ebp),%eax
+  800135:	50                   	push   %eax
+  800136:	68 e7 40 80 00       	push   $0x8040e7
+  80013b:	6a 27                	push   $0x27
+  80013d:	68 f5 40 80 00       	push   $0x8040f5
+  800142:	e8 e4 08 00 00       	call   800a2b <_panic>
+		panic("write %s: %e", path, r);
+  800147:	83 ec 0c             	sub    $0xc,%esp
+  80014a:	50                   	push   %eax
+  80014b:	8d 85 e8 fb ff ff    	lea    -0x418(%ebp),%eax
+  800151:	50                   	push   %eax
+  800152:	68 08 41 80 00       	push   $0x804108
+  800157:	6a 29                	push   $0x29
+  800159:	68 f5 40 80 00       	push   $0x8040f5
+  80015e:	e8 c8 08 00 00       	call   800a2b <_panic>
+	for (e->depth = 0, p = name; *p; p++)
+  800163:	83 c3 01             	add    $0x1,%ebx
+  800166:	0f b6 03             	movzbl (%ebx),%eax
+  800169:	84 c0                	test   %al,%al
+  80016b:	74 0d                	je     80017a <mk+0x147>
+		if (*p == '/')
+  80016d:	3c 2f                	cmp    $0x2f,%al
+  80016f:	75 f2                	jne    800163 <mk+0x130>
+			e->depth++;
+  800171:	83 86 08 04 00 00 01 	addl   $0x1,0x408(%esi)
+  800178:	eb e9                	jmp    800163 <mk+0x130>
+}
+  80017a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80017d:	5b                   	pop    %ebx
+  80017e:	5e                   	pop    %esi
+  80017f:	5f                   	pop    %edi
+  800180:	5d                   	pop    %ebp
+  800181:	c3                   	ret
+
+00800182 <check>:
+
+// Read all of /rd's entries with flags, n bytes at a time, and check
+// them against ents.  Returns the number of readdir calls it took.
+static int
+check(int fd, int flags, size_t n)
+{
+  800182:	55                   	push   %ebp
+  800183:	89 e5                	mov    %esp,%ebp
+  800185:	57                   	push   %edi
+  800186:	56                   	push   %esi
+  800187:	53                   	push   %ebx
+  800188:	83 ec 3c             	sub    $0x3c,%esp
+  80018b:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  80018e:	89 55 cc             	mov    %edx,-0x34(%ebp)
+  800191:	89 4d c0             	mov    %ecx,-0x40(%ebp)
+	struct Fsdirent *d;
+	struct Ent *e;
+	int i, r, calls, pos;
+	char *slash;
+
+	for (i = 0; i < nents; i++)
+  800194:	8b 0d 00 10 81 00    	mov    0x811000,%ecx
+  80019a:	ba 2c 14 81 00       	mov    $0x81142c,%edx
+  80019f:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001a4:	eb 0f                	jmp    8001b5 <check+0x33>
+		ents[i].seen = 0;
+  8001a6:	c7 02 00 00 00 00    	movl   $0x0,(%edx)
+	for (i = 0; i < nents; i++)
+  8001ac:	83 c0 01             	add    $0x1,%eax
+  8001af:	81 c2 10 04 00 00    	add    $0x410,%edx
+  8001b5:	39 c1                	cmp    %eax,%ecx
+  8001b7:	7f ed                	jg     8001a6 <check+0x24>
+	seek(fd, 0);
+  8001b9:	83 ec 08             	sub    $0x8,%esp
+  8001bc:	6a 00                	push   $0x0
+  8001be:	ff 75 c8             	push   -0x38(%ebp)
+  8001c1:	e8 6e 1b 00 00       	call   801d34 <seek>
+	for (calls = 0; (r = readdir(fd, buf, n, flags)) != 0; calls++) {
+  8001c6:	83 c4 10             	add    $0x10,%esp
+  8001c9:	bb 00 00 00 00       	mov    $0x0,%ebx
+					break;
+			if (e == ents + nents)
+				panic("readdir: unexpected entry %s", d->d_name);
+			if (e->seen++)
+				panic("readdir: %s listed twice", d->d_name);
+			if (e->depth > 0 && !(flags & FSREADDIR_RECURSIVE))
+  8001ce:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8001d1:	83 e0 01             	and    $0x1,%eax
+  8001d4:	89 45 dc             	mov    %eax,-0x24(%ebp)
+	for (calls = 0; (r = readdir(fd, buf, n, flags)) != 0; calls++) {
+  8001d7:	e9 2a 02 00 00       	jmp    800406 <check+0x284>
+			panic("readdir: %e", r);
+  8001dc:	ff 75 e0             	push   -0x20(%ebp)
+  8001df:	68 15 41 80 00       	push   $0x804115
+  8001e4:	6a 44                	push   $0x44
+  8001e6:	68 f5 40 80 00       	push   $0x8040f5
+  8001eb:	e8 3b 08 00 00       	call   800a2b <_panic>
+				panic("readdir: bad d_reclen %d", d->d_reclen);
+  8001f0:	0f b7 d2             	movzwl %dx,%edx
+  8001f3:	52                   	push   %edx
+  8001f4:	68 21 41 80 00       	push   $0x804121
+  8001f9:	6a 48                	push   $0x48
+  8001fb:	68 f5 40 80 00       	push   $0x8040f5
+  800200:	e8 26 08 00 00       	call   800a2b <_panic>
+			for (e = ents; e < ents + nents; e++)
+  800205:	81 c6 10 04 00 00    	add    $0x410,%esi
+  80020b:	69 05 00 10 81 00 10 	imul   $0x410,0x811000,%eax
+  800212:	04 00 00 
+  800215:	05 20 10 81 00       	add    $0x811020,%eax
+  80021a:	39 c6                	cmp    %eax,%esi
+  80021c:	73 11                	jae    80022f <check+0xad>
+				if (strcmp(e->name, d->d_name) == 0)
+  80021e:	83 ec 08             	sub    $0x8,%esp
+  800221:	53                   	push   %ebx
+  800222:	56                   	push   %esi
+  800223:	e8 7d 0f 00 00       	call   8011a5 <strcmp>
+  800228:	83 c4 10             	add    $0x10,%esp
+  80022b:	85 c0                	test   %eax,%eax
+  80022d:	75 d6                	jne    800205 <check+0x83>
+			if (e == ents + nents)
+  80022f:	69 05 00 10 81 00 10 	imul   $0x410,0x811000,%eax
+  800236:	04 00 00 
+  800239:	05 20 10 81 00       	add    $0x811020,%eax
+  80023e:	39 c6                	cmp    %eax,%esi
+  800240:	0f 84 a9 00 00 00    	je     8002ef <check+0x16d>
+			if (e->seen++)
+  800246:	8b 9e 0c 04 00 00    	mov    0x40c(%esi),%ebx
+  80024c:	8d 43 01             	lea    0x1(%ebx),%eax
+  80024f:	89 86 0c 04 00 00    	mov    %eax,0x40c(%esi)
+  800255:	85 db                	test   %ebx,%ebx
+  800257:	0f 85 a7 00 00 00    	jne    800304 <check+0x182>
+			if (e->depth > 0 && !(flags & FSREADDIR_RECURSIVE))
+  80025d:	8b 86 08 04 00 00    	mov    0x408(%esi),%eax
+  800263:	85 c0                	test   %eax,%eax
+  800265:	7e 0a                	jle    800271 <check+0xef>
+  800267:	83 7d dc 00          	cmpl   $0x0,-0x24(%ebp)
+  80026b:	0f 84 a8 00 00 00    	je     800319 <check+0x197>
+				panic("readdir: %s listed without FSREADDIR_RECURSIVE", d->d_name);
+			if (d->d_type != e->type || d->d_depth != e->depth
+  800271:	0f b6 4f 04          	movzbl 0x4(%edi),%ecx
+  800275:	8b 96 00 04 00 00    	mov    0x400(%esi),%edx
+  80027b:	39 d1                	cmp    %edx,%ecx
+  80027d:	0f 85 ab 00 00 00    	jne    80032e <check+0x1ac>
+  800283:	0f b6 4f 05          	movzbl 0x5(%edi),%ecx
+  800287:	39 c8                	cmp    %ecx,%eax
+  800289:	0f 85 a1 00 00 00    	jne    800330 <check+0x1ae>
+			    || (e->type == FTYPE_REG && d->d_size != e->size))
+  80028f:	85 d2                	test   %edx,%edx
+  800291:	75 0e                	jne    8002a1 <check+0x11f>
+  800293:	8b 8e 04 04 00 00    	mov    0x404(%esi),%ecx
+  800299:	39 0f                	cmp    %ecx,(%edi)
+  80029b:	0f 85 8f 00 00 00    	jne    800330 <check+0x1ae>
+				panic("readdir: %s has type %d depth %d size %d",
+				      d->d_name, d->d_type, d->d_depth, d->d_size);
+
+			// A directory's entries come after the directory
+			if (e->depth > 0) {
+  8002a1:	85 c0                	test   %eax,%eax
+  8002a3:	0f 8f a7 00 00 00    	jg     800350 <check+0x1ce>
+		for (pos = 0; pos < r; pos += d->d_reclen) {
+  8002a9:	0f b7 47 06          	movzwl 0x6(%edi),%eax
+  8002ad:	01 45 e4             	add    %eax,-0x1c(%ebp)
+  8002b0:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8002b3:	39 4d e0             	cmp    %ecx,-0x20(%ebp)
+  8002b6:	0f 8e 44 01 00 00    	jle    800400 <check+0x27e>
+			d = (struct Fsdirent *) (buf + pos);
+  8002bc:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8002bf:	8d b9 00 b0 80 00    	lea    0x80b000(%ecx),%edi
+			if (d->d_reclen == 0 || pos + d->d_reclen > r)
+  8002c5:	0f b7 57 06          	movzwl 0x6(%edi),%edx
+  8002c9:	66 85 d2             	test   %dx,%dx
+  8002cc:	0f 84 1e ff ff ff    	je     8001f0 <check+0x6e>
+  8002d2:	0f b7 c2             	movzwl %dx,%eax
+  8002d5:	01 c8                	add    %ecx,%eax
+  8002d7:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  8002da:	39 c8                	cmp    %ecx,%eax
+  8002dc:	0f 8f 0e ff ff ff    	jg     8001f0 <check+0x6e>
+			for (e = ents; e < ents + nents; e++)
+  8002e2:	be 20 10 81 00       	mov    $0x811020,%esi
+				if (strcmp(e->name, d->d_name) == 0)
+  8002e7:	8d 5f 08             	lea    0x8(%edi),%ebx
+  8002ea:	e9 1c ff ff ff       	jmp    80020b <check+0x89>
+				panic("readdir: unexpected entry %s", d->d_name);
+  8002ef:	8d 47 08             	lea    0x8(%edi),%eax
+  8002f2:	50                   	push   %eax
+  8002f3:	68 3a 41 80 00       	push   $0x80413a
+  8002f8:	6a 4d                	push   $0x4d
+  8002fa:	68 f5 40 80 00       	push   $0x8040f5
+  8002ff:	e8 27 07 00 00       	call   800a2b <_panic>
+				panic("readdir: %s listed twice", d->d_name);
+  800304:	8d 47 08             	lea    0x8(%edi),%eax
+  800307:	50                   	push   %eax
+  800308:	68 57 41 80 00       	push   $0x804157
+  80030d:	6a 4f                	push   $0x4f
+  80030f:	68 f5 40 80 00       	push   $0x8040f5
+  800314:	e8 12 07 00 00       	call   800a2b <_panic>
+				panic("readdir: %s listed without FSREADDIR_RECURSIVE", d->d_name);
+  800319:	8d 47 08             	lea    0x8(%edi),%eax
+  80031c:	50                   	push   %eax
+  80031d:	68 20 42 80 00       	push   $0x804220
+  800322:	6a 51                	push   $0x51
+  800324:	68 f5 40 80 00       	push   $0x8040f5
+  800329:	e8 fd 06 00 00       	call   800a2b <_panic>
+			if (d->d_type != e->type || d->d_depth != e->depth
+  80032e:	89 ca                	mov    %ecx,%edx
+				panic("readdir: %s has type %d depth %d size %d",
+  800330:	83 ec 04             	sub    $0x4,%esp
+  800333:	ff 37                	push   (%edi)
+  800335:	0f b6 47 05          	movzbl 0x5(%edi),%eax
+  800339:	50                   	push   %eax
+  80033a:	52                   	push   %edx
+  80033b:	8d 47 08             	lea    0x8(%edi),%eax
+  80033e:	50                   	push   %eax
+  80033f:	68 50 42 80 00       	push   $0x804250
+  800344:	6a 54                	push   $0x54
+  800346:	68 f5 40 80 00       	push   $0x8040f5
+  80034b:	e8 db 06 00 00       	call   800a2b <_panic>
+				slash = strchr(e->name, '/');
+  800350:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  800353:	83 ec 08             	sub    $0x8,%esp
+  800356:	6a 2f                	push   $0x2f
+  800358:	56                   	push   %esi
+  800359:	e8 a8 0e 00 00       	call   801206 <strchr>
+				while (strchr(slash + 1, '/'))
+  80035e:	83 c4 10             	add    $0x10,%esp
+  800361:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+  800364:	89 c3                	mov    %eax,%ebx
+  800366:	eb 10                	jmp    800378 <check+0x1f6>
+					slash = strchr(slash + 1, '/');
+  800368:	83 ec 08             	sub    $0x8,%esp
+  80036b:	6a 2f                	push   $0x2f
+  80036d:	56                   	push   %esi
+  80036e:	e8 93 0e 00 00       	call   801206 <strchr>
+  800373:	89 c3                	mov    %eax,%ebx
+  800375:	83 c4 10             	add    $0x10,%esp
+				while (strchr(slash + 1, '/'))
+  800378:	8d 73 01             	lea    0x1(%ebx),%esi
+  80037b:	83 ec 08             	sub    $0x8,%esp
+  80037e:	6a 2f                	push   $0x2f
+  800380:	56                   	push   %esi
+  800381:	e8 80 0e 00 00       	call   801206 <strchr>
+  800386:	83 c4 10             	add    $0x10,%esp
+  800389:	85 c0                	test   %eax,%eax
+  80038b:	75 db                	jne    800368 <check+0x1e6>
+				*slash = 0;
+  80038d:	89 d8                	mov    %ebx,%eax
+  80038f:	89 5d d4             	mov    %ebx,-0x2c(%ebp)
+  800392:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  800395:	c6 00 00             	movb   $0x0,(%eax)
+				for (i = 0; i < nents; i++)
+  800398:	be 20 10 81 00       	mov    $0x811020,%esi
+  80039d:	89 7d d0             	mov    %edi,-0x30(%ebp)
+  8003a0:	8b 7d d8             	mov    -0x28(%ebp),%edi
+  8003a3:	eb 03                	jmp    8003a8 <check+0x226>
+  8003a5:	83 c3 01             	add    $0x1,%ebx
+  8003a8:	39 1d 00 10 81 00    	cmp    %ebx,0x811000
+  8003ae:	7e 17                	jle    8003c7 <check+0x245>
+					if (strcmp(ents[i].name, e->name) == 0)
+  8003b0:	83 ec 08             	sub    $0x8,%esp
+  8003b3:	57                   	push   %edi
+  8003b4:	56                   	push   %esi
+  8003b5:	e8 eb 0d 00 00       	call   8011a5 <strcmp>
+  8003ba:	81 c6 10 04 00 00    	add    $0x410,%esi
+  8003c0:	83 c4 10             	add    $0x10,%esp
+  8003c3:	85 c0                	test   %eax,%eax
+  8003c5:	75 de                	jne    8003a5 <check+0x223>
+						break;
+				*slash = '/';
+  8003c7:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  8003ca:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  8003cd:	c6 00 2f             	movb   $0x2f,(%eax)
+				if (i == nents || !ents[i].seen)
+  8003d0:	39 1d 00 10 81 00    	cmp    %ebx,0x811000
+  8003d6:	74 13                	je     8003eb <check+0x269>
+  8003d8:	69 db 10 04 00 00    	imul   $0x410,%ebx,%ebx
+  8003de:	83 bb 2c 14 81 00 00 	cmpl   $0x0,0x81142c(%ebx)
+  8003e5:	0f 85 be fe ff ff    	jne    8002a9 <check+0x127>
+					panic("readdir: %s listed before its directory", d->d_name);
+  8003eb:	8d 47 08             	lea    0x8(%edi),%eax
+  8003ee:	50                   	push   %eax
+  8003ef:	68 7c 42 80 00       	push   $0x80427c
+  8003f4:	6a 62                	push   $0x62
+  8003f6:	68 f5 40 80 00       	push   $0x8040f5
+  8003fb:	e8 2b 06 00 00       	call   800a2b <_panic>
+	for (calls = 0; (r = readdir(fd, buf, n, flags)) != 0; calls++) {
+  800400:	8b 5d c4             	mov    -0x3c(%ebp),%ebx
+  800403:	83 c3 01             	add    $0x1,%ebx
+  800406:	ff 75 cc             	push   -0x34(%ebp)
+  800409:	ff 75 c0             	push   -0x40(%ebp)
+  80040c:	68 00 b0 80 00       	push   $0x80b000
+  800411:	ff 75 c8             	push   -0x38(%ebp)
+  800414:	e8 47 23 00 00       	call   802760 <readdir>
+  800419:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80041c:	83 c4 10             	add    $0x10,%esp
+  80041f:	85 c0                	test   %eax,%eax
+  800421:	74 19                	je     80043c <check+0x2ba>
+		if (r < 0)
+  800423:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800427:	0f 88 af fd ff ff    	js     8001dc <check+0x5a>
+		for (pos = 0; pos < r; pos += d->d_reclen) {
+  80042d:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800434:	89 5d c4             	mov    %ebx,-0x3c(%ebp)
+  800437:	e9 80 fe ff ff       	jmp    8002bc <check+0x13a>
+			}
+		}
+	}
+	for (e = ents; e < ents + nents; e++)
+  80043c:	69 0d 00 10 81 00 10 	imul   $0x410,0x811000,%ecx
+  800443:	04 00 00 
+  800446:	81 c1 20 10 81 00    	add    $0x811020,%ecx
+  80044c:	b8 20 10 81 00       	mov    $0x811020,%eax
+		if (!e->seen && (e->depth == 0 || (flags & FSREADDIR_RECURSIVE)))
+  800451:	8b 55 cc             	mov    -0x34(%ebp),%edx
+  800454:	83 e2 01             	and    $0x1,%edx
+  800457:	eb 05                	jmp    80045e <check+0x2dc>
+	for (e = ents; e < ents + nents; e++)
+  800459:	05 10 04 00 00       	add    $0x410,%eax
+  80045e:	39 c8                	cmp    %ecx,%eax
+  800460:	73 28                	jae    80048a <check+0x308>
+		if (!e->seen && (e->depth == 0 || (flags & FSREADDIR_RECURSIVE)))
+  800462:	83 b8 0c 04 00 00 00 	cmpl   $0x0,0x40c(%eax)
+  800469:	75 ee                	jne    800459 <check+0x2d7>
+  80046b:	83 b8 08 04 00 00 00 	cmpl   $0x0,0x408(%eax)
+  800472:	74 04                	je     800478 <check+0x2f6>
+  800474:	85 d2                	test   %edx,%edx
+  800476:	74 e1                	je     800459 <check+0x2d7>
+			panic("readdir: %s missing", e->name);
+  800478:	50                   	push   %eax
+  800479:	68 70 41 80 00       	push   $0x804170
+  80047e:	6a 68                	push   $0x68
+  800480:	68 f5 40 80 00       	push   $0x8040f5
+  800485:	e8 a1 05 00 00       	call   800a2b <_panic>
+	return calls;
+}
+  80048a:	89 d8                	mov    %ebx,%eax
+  80048c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80048f:	5b                   	pop    %ebx
+  800490:	5e                   	pop    %esi
+  800491:	5f                   	pop    %edi
+  800492:	5d                   	pop    %ebp
+  800493:	c3                   	ret
+
+00800494 <umain>:
+
+void
+umain(int argc, char **argv)
+{
+  800494:	55                   	push   %ebp
+  800495:	89 e5                	mov    %esp,%ebp
+  800497:	56                   	push   %esi
+  800498:	53                   	push   %ebx
+  800499:	81 ec 90 04 00 00    	sub    $0x490,%esp
+	char name[MAXPATHLEN];
+	struct Stat st;
+	int i, r, f;
+
+	for (i = 0; i < sizeof(data); i++)
+  80049f:	b9 00 00 00 00       	mov    $0x0,%ecx
+		data[i] = i % 251;
+  8004a4:	bb bf bf 8c 82       	mov    $0x828cbfbf,%ebx
+  8004a9:	89 c8                	mov    %ecx,%eax
+  8004ab:	f7 eb                	imul   %ebx
+  8004ad:	01 ca                	add    %ecx,%edx
+  8004af:	c1 fa 07             	sar    $0x7,%edx
+  8004b2:	89 c8                	mov    %ecx,%eax
+  8004b4:	c1 f8 1f             	sar    $0x1f,%eax
+  8004b7:	29 c2                	sub    %eax,%edx
+  8004b9:	69 d2 fb 00 00 00    	imul   $0xfb,%edx,%edx
+  8004bf:	89 c8                	mov    %ecx,%eax
+  8004c1:	29 d0                	sub    %edx,%eax
+  8004c3:	88 81 00 c0 80 00    	mov    %al,0x80c000(%ecx)
+	for (i = 0; i < sizeof(data); i++)
+  8004c9:	83 c1 01             	add    $0x1,%ecx
+  8004cc:	81 f9 00 50 00 00    	cmp    $0x5000,%ecx
+  8004d2:	75 d5                	jne    8004a9 <umain+0x15>
+
+	if ((r = open("/rd", O_RDONLY|O_CREAT|O_EXCL|O_MKDIR)) < 0)
+  8004d4:	83 ec 08             	sub    $0x8,%esp
+  8004d7:	68 00 0d 00 00       	push   $0xd00
+  8004dc:	68 84 41 80 00       	push   $0x804184
+  8004e1:	e8 b4 21 00 00       	call   80269a <open>
+  8004e6:	83 c4 10             	add    $0x10,%esp
+  8004e9:	85 c0                	test   %eax,%eax
+  8004eb:	0f 88 6a 03 00 00    	js     80085b <umain+0x3c7>
+		panic("mkdir /rd: %e", r);
+	close(r);
+  8004f1:	83 ec 0c             	sub    $0xc,%esp
+  8004f4:	50                   	push   %eax
+  8004f5:	e8 ae 15 00 00       	call   801aa8 <close>
+	mk("sub0", FTYPE_DIR, 0);
+  8004fa:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8004ff:	ba 01 00 00 00       	mov    $0x1,%edx
+  800504:	b8 96 41 80 00       	mov    $0x804196,%eax
+  800509:	e8 25 fb ff ff       	call   800033 <mk>
+	mk("sub1", FTYPE_DIR, 0);
+  80050e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800513:	ba 01 00 00 00       	mov    $0x1,%edx
+  800518:	b8 f8 41 80 00       	mov    $0x8041f8,%eax
+  80051d:	e8 11 fb ff ff       	call   800033 <mk>
+	mk("sub0/deep", FTYPE_DIR, 0);
+  800522:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800527:	ba 01 00 00 00       	mov    $0x1,%edx
+  80052c:	b8 9b 41 80 00       	mov    $0x80419b,%eax
+  800531:	e8 fd fa ff ff       	call   800033 <mk>
+  800536:	83 c4 10             	add    $0x10,%esp
+	for (i = 0; i < NTOP; i++) {
+  800539:	bb 00 00 00 00       	mov    $0x0,%ebx
+		snprintf(name, sizeof(name), LONG "-%02d", i);
+  80053e:	8d b5 f8 fb ff ff    	lea    -0x408(%ebp),%esi
+  800544:	53                   	push   %ebx
+  800545:	68 a4 42 80 00       	push   $0x8042a4
+  80054a:	68 00 04 00 00       	push   $0x400
+  80054f:	56                   	push   %esi
+  800550:	e8 4a 0b 00 00       	call   80109f <snprintf>
+		mk(name, FTYPE_REG, i * 10);
+  800555:	8d 0c 9b             	lea    (%ebx,%ebx,4),%ecx
+  800558:	01 c9                	add    %ecx,%ecx
+  80055a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80055f:	89 f0                	mov    %esi,%eax
+  800561:	e8 cd fa ff ff       	call   800033 <mk>
+	for (i = 0; i < NTOP; i++) {
+  800566:	83 c3 01             	add    $0x1,%ebx
+  800569:	83 c4 10             	add    $0x10,%esp
+  80056c:	83 fb 28             	cmp    $0x28,%ebx
+  80056f:	75 d3                	jne    800544 <umain+0xb0>
+	}
+	for (i = 0; i < NSUB; i++) {
+  800571:	bb 00 00 00 00       	mov    $0x0,%ebx
+		snprintf(name, sizeof(name), "sub0/" LONG "-%02d", i);
+  800576:	8d b5 f8 fb ff ff    	lea    -0x408(%ebp),%esi
+  80057c:	53                   	push   %ebx
+  80057d:	68 c8 42 80 00       	push   $0x8042c8
+  800582:	68 00 04 00 00       	push   $0x400
+  800587:	56                   	push   %esi
+  800588:	e8 12 0b 00 00       	call   80109f <snprintf>
+		mk(name, FTYPE_REG, i);
+  80058d:	89 d9                	mov    %ebx,%ecx
+  80058f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800594:	89 f0                	mov    %esi,%eax
+  800596:	e8 98 fa ff ff       	call   800033 <mk>
+		snprintf(name, sizeof(name), "sub1/" LONG "-%02d", i);
+  80059b:	53                   	push   %ebx
+  80059c:	68 f4 42 80 00       	push   $0x8042f4
+  8005a1:	68 00 04 00 00       	push   $0x400
+  8005a6:	56                   	push   %esi
+  8005a7:	e8 f3 0a 00 00       	call   80109f <snprintf>
+		mk(name, FTYPE_REG, 2 * i);
+  8005ac:	83 c4 20             	add    $0x20,%esp
+  8005af:	8d 0c 1b             	lea    (%ebx,%ebx,1),%ecx
+  8005b2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8005b7:	89 f0                	mov    %esi,%eax
+  8005b9:	e8 75 fa ff ff       	call   800033 <mk>
+	for (i = 0; i < NSUB; i++) {
+  8005be:	83 c3 01             	add    $0x1,%ebx
+  8005c1:	83 fb 1e             	cmp    $0x1e,%ebx
+  8005c4:	75 b6                	jne    80057c <umain+0xe8>
+	}
+	for (i = 0; i < NDEEP; i++) {
+  8005c6:	bb 00 00 00 00       	mov    $0x0,%ebx
+		snprintf(name, sizeof(name), "sub0/deep/" LONG "-%02d", i);
+  8005cb:	8d b5 f8 fb ff ff    	lea    -0x408(%ebp),%esi
+  8005d1:	53                   	push   %ebx
+  8005d2:	68 20 43 80 00       	push   $0x804320
+  8005d7:	68 00 04 00 00       	push   $0x400
+  8005dc:	56                   	push   %esi
+  8005dd:	e8 bd 0a 00 00       	call   80109f <snprintf>
+		mk(name, FTYPE_REG, PGSIZE + i);
+  8005e2:	8d 8b 00 10 00 00    	lea    0x1000(%ebx),%ecx
+  8005e8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8005ed:	89 f0                	mov    %esi,%eax
+  8005ef:	e8 3f fa ff ff       	call   800033 <mk>
+	for (i = 0; i < NDEEP; i++) {
+  8005f4:	83 c3 01             	add    $0x1,%ebx
+  8005f7:	83 c4 10             	add    $0x10,%esp
+  8005fa:	83 fb 0a             	cmp    $0xa,%ebx
+  8005fd:	75 d2                	jne    8005d1 <umain+0x13d>
+	}
+
+	if ((f = open("/rd", O_RDONLY)) < 0)
+  8005ff:	83 ec 08             	sub    $0x8,%esp
+  800602:	6a 00                	push   $0x0
+  800604:	68 84 41 80 00       	push   $0x804184
+  800609:	e8 8c 20 00 00       	call   80269a <open>
+  80060e:	89 c3                	mov    %eax,%ebx
+  800610:	83 c4 10             	add    $0x10,%esp
+  800613:	85 c0                	test   %eax,%eax
+  800615:	0f 88 52 02 00 00    	js     80086d <umain+0x3d9>
+		panic("open /rd: %e", f);
+	if ((r = readdir(f, buf, 8, 0)) != -E_INVAL)
+  80061b:	6a 00                	push   $0x0
+  80061d:	6a 08                	push   $0x8
+  80061f:	68 00 b0 80 00       	push   $0x80b000
+  800624:	50                   	push   %eax
+  800625:	e8 36 21 00 00       	call   802760 <readdir>
+  80062a:	83 c4 10             	add    $0x10,%esp
+  80062d:	83 f8 fd             	cmp    $0xfffffffd,%eax
+  800630:	0f 85 4c 02 00 00    	jne    800882 <umain+0x3ee>
+		panic("readdir into 8 bytes returned %d", r);
+
+	// Small replies make every call pick up where the last stopped
+	if ((r = check(f, 0, 256)) < 2)
+  800636:	b9 00 01 00 00       	mov    $0x100,%ecx
+  80063b:	ba 00 00 00 00       	mov    $0x0,%edx
+  800640:	89 d8                	mov    %ebx,%eax
+  800642:	e8 3b fb ff ff       	call   800182 <check>
+  800647:	83 f8 01             	cmp    $0x1,%eax
+  80064a:	0f 8e 47 02 00 00    	jle    800897 <umain+0x403>
+		panic("readdir took %d calls", r);
+	check(f, 0, PGSIZE);
+  800650:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  800655:	ba 00 00 00 00       	mov    $0x0,%edx
+  80065a:	89 d8                	mov    %ebx,%eax
+  80065c:	e8 21 fb ff ff       	call   800182 <check>
+	cprintf("readdir is good\n");
+  800661:	83 ec 0c             	sub    $0xc,%esp
+  800664:	68 c8 41 80 00       	push   $0x8041c8
+  800669:	e8 98 04 00 00       	call   800b06 <cprintf>
+
+	if ((r = check(f, FSREADDIR_RECURSIVE, PGSIZE)) < 2)
+  80066e:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  800673:	ba 01 00 00 00       	mov    $0x1,%edx
+  800678:	89 d8                	mov    %ebx,%eax
+  80067a:	e8 03 fb ff ff       	call   800182 <check>
+  80067f:	83 c4 10             	add    $0x10,%esp
+  800682:	83 f8 01             	cmp    $0x1,%eax
+  800685:	0f 8e 21 02 00 00    	jle    8008ac <umain+0x418>
+		panic("recursive readdir took %d calls", r);
+	check(f, FSREADDIR_RECURSIVE, 256);
+  80068b:	b9 00 01 00 00       	mov    $0x100,%ecx
+  800690:	ba 01 00 00 00       	mov    $0x1,%edx
+  800695:	89 d8                	mov    %ebx,%eax
+  800697:	e8 e6 fa ff ff       	call   800182 <check>
+	cprintf("readdir recursive is good\n");
+  80069c:	83 ec 0c             	sub    $0xc,%esp
+  80069f:	68 d9 41 80 00       	push   $0x8041d9
+  8006a4:	e8 5d 04 00 00       	call   800b06 <cprintf>
+	close(f);
+  8006a9:	89 1c 24             	mov    %ebx,(%esp)
+  8006ac:	e8 f7 13 00 00       	call   801aa8 <close>
+
+	// Small files come back through the request page
+	memset(buf, 0, sizeof(buf));
+  8006b1:	83 c4 0c             	add    $0xc,%esp
+  8006b4:	68 00 10 00 00       	push   $0x1000
+  8006b9:	6a 00                	push   $0x0
+  8006bb:	68 00 b0 80 00       	push   $0x80b000
+  8006c0:	e8 80 0b 00 00       	call   801245 <memset>
+	if ((r = file_slurp("/rd/" LONG "-05", buf, 100, &st)) != 50)
+  8006c5:	8d 85 6c fb ff ff    	lea    -0x494(%ebp),%eax
+  8006cb:	50                   	push   %eax
+  8006cc:	6a 64                	push   $0x64
+  8006ce:	68 00 b0 80 00       	push   $0x80b000
+  8006d3:	68 94 43 80 00       	push   $0x804394
+  8006d8:	e8 62 26 00 00       	call   802d3f <file_slurp>
+  8006dd:	83 c4 20             	add    $0x20,%esp
+  8006e0:	83 f8 32             	cmp    $0x32,%eax
+  8006e3:	0f 85 d8 01 00 00    	jne    8008c1 <umain+0x42d>
+		panic("file_slurp returned %d, wanted 50", r);
+	if (memcmp(buf, data, 50) != 0)
+  8006e9:	83 ec 04             	sub    $0x4,%esp
+  8006ec:	6a 32                	push   $0x32
+  8006ee:	68 00 c0 80 00       	push   $0x80c000
+  8006f3:	68 00 b0 80 00       	push   $0x80b000
+  8006f8:	e8 f5 0b 00 00       	call   8012f2 <memcmp>
+  8006fd:	83 c4 10             	add    $0x10,%esp
+  800700:	85 c0                	test   %eax,%eax
+  800702:	0f 85 ce 01 00 00    	jne    8008d6 <umain+0x442>
+		panic("file_slurp returned wrong data");
+	if (st.st_size != 50 || st.st_isdir || strcmp(st.st_name, LONG "-05") != 0)
+  800708:	83 bd ec fb ff ff 32 	cmpl   $0x32,-0x414(%ebp)
+  80070f:	0f 85 d8 01 00 00    	jne    8008ed <umain+0x459>
+  800715:	83 bd f0 fb ff ff 00 	cmpl   $0x0,-0x410(%ebp)
+  80071c:	0f 85 cb 01 00 00    	jne    8008ed <umain+0x459>
+  800722:	83 ec 08             	sub    $0x8,%esp
+  800725:	68 98 43 80 00       	push   $0x804398
+  80072a:	8d 85 6c fb ff ff    	lea    -0x494(%ebp),%eax
+  800730:	50                   	push   %eax
+  800731:	e8 6f 0a 00 00       	call   8011a5 <strcmp>
+  800736:	83 c4 10             	add    $0x10,%esp
+  800739:	85 c0                	test   %eax,%eax
+  80073b:	0f 85 ac 01 00 00    	jne    8008ed <umain+0x459>
+		panic("file_slurp stat: %s size %d isdir %d",
+		      st.st_name, st.st_size, st.st_isdir);
+	if ((r = file_slurp("/rd/" LONG "-05", buf, 20, 0)) != 20)
+  800741:	6a 00                	push   $0x0
+  800743:	6a 14                	push   $0x14
+  800745:	68 00 b0 80 00       	push   $0x80b000
+  80074a:	68 94 43 80 00       	push   $0x804394
+  80074f:	e8 eb 25 00 00       	call   802d3f <file_slurp>
+  800754:	83 c4 10             	add    $0x10,%esp
+  800757:	83 f8 14             	cmp    $0x14,%eax
+  80075a:	0f 85 b7 01 00 00    	jne    800917 <umain+0x483>
+		panic("short file_slurp returned %d, wanted 20", r);
+
+	// Bigger ones straight into the caller's pages
+	memset(sbuf, 0, sizeof(sbuf));
+  800760:	83 ec 04             	sub    $0x4,%esp
+  800763:	68 00 50 00 00       	push   $0x5000
+  800768:	6a 00                	push   $0x0
+  80076a:	68 00 60 80 00       	push   $0x806000
+  80076f:	e8 d1 0a 00 00       	call   801245 <memset>
+	if ((r = file_slurp("/rd/sub0/deep/" LONG "-07", sbuf + 100,
+  800774:	8d 85 6c fb ff ff    	lea    -0x494(%ebp),%eax
+  80077a:	50                   	push   %eax
+  80077b:	68 9c 4f 00 00       	push   $0x4f9c
+  800780:	68 64 60 80 00       	push   $0x806064
+  800785:	68 50 44 80 00       	push   $0x804450
+  80078a:	e8 b0 25 00 00       	call   802d3f <file_slurp>
+  80078f:	83 c4 20             	add    $0x20,%esp
+  800792:	3d 07 10 00 00       	cmp    $0x1007,%eax
+  800797:	0f 85 8f 01 00 00    	jne    80092c <umain+0x498>
+			    sizeof(sbuf) - 100, &st)) != PGSIZE + 7)
+		panic("file_slurp into pages returned %d, wanted %d", r, PGSIZE + 7);
+	if (memcmp(sbuf + 100, data, PGSIZE + 7) != 0)
+  80079d:	83 ec 04             	sub    $0x4,%esp
+  8007a0:	68 07 10 00 00       	push   $0x1007
+  8007a5:	68 00 c0 80 00       	push   $0x80c000
+  8007aa:	68 64 60 80 00       	push   $0x806064
+  8007af:	e8 3e 0b 00 00       	call   8012f2 <memcmp>
+  8007b4:	83 c4 10             	add    $0x10,%esp
+  8007b7:	85 c0                	test   %eax,%eax
+  8007b9:	0f 85 8a 01 00 00    	jne    800949 <umain+0x4b5>
+		panic("file_slurp into pages returned wrong data");
+	if (sbuf[99] != 0 || sbuf[100 + PGSIZE + 7] != 0)
+  8007bf:	0f b6 05 63 60 80 00 	movzbl 0x806063,%eax
+  8007c6:	0a 05 6b 70 80 00    	or     0x80706b,%al
+  8007cc:	0f 85 8e 01 00 00    	jne    800960 <umain+0x4cc>
+		panic("file_slurp wrote outside the buffer");
+	if (st.st_size != PGSIZE + 7 || st.st_isdir)
+  8007d2:	8b 85 ec fb ff ff    	mov    -0x414(%ebp),%eax
+  8007d8:	3d 07 10 00 00       	cmp    $0x1007,%eax
+  8007dd:	0f 85 94 01 00 00    	jne    800977 <umain+0x4e3>
+  8007e3:	83 bd f0 fb ff ff 00 	cmpl   $0x0,-0x410(%ebp)
+  8007ea:	0f 85 87 01 00 00    	jne    800977 <umain+0x4e3>
+		panic("file_slurp into pages stat: size %d isdir %d",
+		      st.st_size, st.st_isdir);
+
+	if ((r = file_slurp("/rd/sub1", buf, 100, &st)) != 0 || !st.st_isdir)
+  8007f0:	8d 85 6c fb ff ff    	lea    -0x494(%ebp),%eax
+  8007f6:	50                   	push   %eax
+  8007f7:	6a 64                	push   $0x64
+  8007f9:	68 00 b0 80 00       	push   $0x80b000
+  8007fe:	68 f4 41 80 00       	push   $0x8041f4
+  800803:	e8 37 25 00 00       	call   802d3f <file_slurp>
+  800808:	83 c4 10             	add    $0x10,%esp
+  80080b:	85 c0                	test   %eax,%eax
+  80080d:	0f 85 82 01 00 00    	jne    800995 <umain+0x501>
+  800813:	83 bd f0 fb ff ff 00 	cmpl   $0x0,-0x410(%ebp)
+  80081a:	0f 84 75 01 00 00    	je     800995 <umain+0x501>
+		panic("file_slurp of a directory returned %d, isdir %d", r, st.st_isdir);
+	if ((r = file_slurp("/rd/not-found", buf, 100, &st)) != -E_NOT_FOUND)
+  800820:	8d 85 6c fb ff ff    	lea    -0x494(%ebp),%eax
+  800826:	50                   	push   %eax
+  800827:	6a 64                	push   $0x64
+  800829:	68 00 b0 80 00       	push   $0x80b000
+  80082e:	68 fd 41 80 00       	push   $0x8041fd
+  800833:	e8 07 25 00 00       	call   802d3f <file_slurp>
+  800838:	83 c4 10             	add    $0x10,%esp
+  80083b:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  80083e:	0f 85 6f 01 00 00    	jne    8009b3 <umain+0x51f>
+		panic("file_slurp /rd/not-found returned %d", r);
+	cprintf("file_slurp is good\n");
+  800844:	83 ec 0c             	sub    $0xc,%esp
+  800847:	68 0b 42 80 00       	push   $0x80420b
+  80084c:	e8 b5 02 00 00       	call   800b06 <cprintf>
+}
+  800851:	83 c4 10             	add    $0x10,%esp
+  800854:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800857:	5b                   	pop    %ebx
+  800858:	5e                   	pop    %esi
+  800859:	5d                   	pop    %ebp
+  80085a:	c3                   	ret
+		panic("mkdir /rd: %e", r);
+  80085b:	50                   	push   %eax
+  80085c:	68 88 41 80 00       	push   $0x804188
+  800861:	6a 77                	push   $0x77
+  800863:	68 f5 40 80 00       	push   $0x8040f5
+  800868:	e8 be 01 00 00       	call   800a2b <_panic>
+		panic("open /rd: %e", f);
+  80086d:	50                   	push   %eax
+  80086e:	68 a5 41 80 00       	push   $0x8041a5
+  800873:	68 8c 00 00 00       	push   $0x8c
+  800878:	68 f5 40 80 00       	push   $0x8040f5
+  80087d:	e8 a9 01 00 00       	call   800a2b <_panic>
+		panic("readdir into 8 bytes returned %d", r);
+  800882:	50                   	push   %eax
+  800883:	68 50 43 80 00       	push   $0x804350
+  800888:	68 8e 00 00 00       	push   $0x8e
+  80088d:	68 f5 40 80 00       	push   $0x8040f5
+  800892:	e8 94 01 00 00       	call   800a2b <_panic>
+		panic("readdir took %d calls", r);
+  800897:	50                   	push   %eax
+  800898:	68 b2 41 80 00       	push   $0x8041b2
+  80089d:	68 92 00 00 00       	push   $0x92
+  8008a2:	68 f5 40 80 00       	push   $0x8040f5
+  8008a7:	e8 7f 01 00 00       	call   800a2b <_panic>
+		panic("recursive readdir took %d calls", r);
+  8008ac:	50                   	push   %eax
+  8008ad:	68 74 43 80 00       	push   $0x804374
+  8008b2:	68 97 00 00 00       	push   $0x97
+  8008b7:	68 f5 40 80 00       	push   $0x8040f5
+  8008bc:	e8 6a 01 00 00       	call   800a2b <_panic>
+		panic("file_slurp returned %d, wanted 50", r);
+  8008c1:	50                   	push   %eax
+  8008c2:	68 bc 43 80 00       	push   $0x8043bc
+  8008c7:	68 9f 00 00 00       	push   $0x9f
+  8008cc:	68 f5 40 80 00       	push   $0x8040f5
+  8008d1:	e8 55 01 00 00       	call   800a2b <_panic>
+		panic("file_slurp returned wrong data");
+  8008d6:	83 ec 04             	sub    $0x4,%esp
+  8008d9:	68 e0 43 80 00       	push   $0x8043e0
+  8008de:	68 a1 00 00 00       	push   $0xa1
+  8008e3:	68 f5 40 80 00       	push   $0x8040f5
+  8008e8:	e8 3e 01 00 00       	call   800a2b <_panic>
+		panic("file_slurp stat: %s size %d isdir %d",
+  8008ed:	83 ec 08             	sub    $0x8,%esp
+  8008f0:	ff b5 f0 fb ff ff    	push   -0x410(%ebp)
+  8008f6:	ff b5 ec fb ff ff    	push   -0x414(%ebp)
+  8008fc:	8d 85 6c fb ff ff    	lea    -0x494(%ebp),%eax
+  800902:	50                   	push   %eax
+  800903:	68 00 44 80 00       	push   $0x804400
+  800908:	68 a3 00 00 00       	push   $0xa3
+  80090d:	68 f5 40 80 00       	push   $0x8040f5
+  800912:	e8 14 01 00 00       	call   800a2b <_panic>
+		panic("short file_slurp returned %d, wanted 20", r);
+  800917:	50                   	push   %eax
+  800918:	68 28 44 80 00       	push   $0x804428
+  80091d:	68 a6 00 00 00       	push   $0xa6
+  800922:	68 f5 40 80 00       	push   $0x8040f5
+  800927:	e8 ff 00 00 00       	call   800a2b <_panic>
+		panic("file_slurp into pages returned %d, wanted %d", r, PGSIZE + 7);
+  80092c:	83 ec 0c             	sub    $0xc,%esp
+  80092f:	68 07 10 00 00       	push   $0x1007
+  800934:	50                   	push   %eax
+  800935:	68 80 44 80 00       	push   $0x804480
+  80093a:	68 ac 00 00 00       	push   $0xac
+  80093f:	68 f5 40 80 00       	push   $0x8040f5
+  800944:	e8 e2 00 00 00       	call   800a2b <_panic>
+		panic("file_slurp into pages returned wrong data");
+  800949:	83 ec 04             	sub    $0x4,%esp
+  80094c:	68 b0 44 80 00       	push   $0x8044b0
+  800951:	68 ae 00 00 00       	push   $0xae
+  800956:	68 f5 40 80 00       	push   $0x8040f5
+  80095b:	e8 cb 00 00 00       	call   800a2b <_panic>
+		panic("file_slurp wrote outside the buffer");
+  800960:	83 ec 04             	sub    $0x4,%esp
+  800963:	68 dc 44 80 00       	push   $0x8044dc
+  800968:	68 b0 00 00 00       	push   $0xb0
+  80096d:	68 f5 40 80 00       	push   $0x8040f5
+  800972:	e8 b4 00 00 00       	call   800a2b <_panic>
+		panic("file_slurp into pages stat: size %d isdir %d",
+  800977:	83 ec 0c             	sub    $0xc,%esp
+  80097a:	ff b5 f0 fb ff ff    	push   -0x410(%ebp)
+  800980:	50                   	push   %eax
+  800981:	68 00 45 80 00       	push   $0x804500
+  800986:	68 b2 00 00 00       	push   $0xb2
+  80098b:	68 f5 40 80 00       	push   $0x8040f5
+  800990:	e8 96 00 00 00       	call   800a2b <_panic>
+		panic("file_slurp of a directory returned %d, isdir %d", r, st.st_isdir);
+  800995:	83 ec 0c             	sub    $0xc,%esp
+  800998:	ff b5 f0 fb ff ff    	push   -0x410(%ebp)
+  80099e:	50                   	push   %eax
+  80099f:	68 30 45 80 00       	push   $0x804530
+  8009a4:	68 b6 00 00 00       	push   $0xb6
+  8009a9:	68 f5 40 80 00       	push   $0x8040f5
+  8009ae:	e8 78 00 00 00       	call   800a2b <_panic>
+		panic("file_slurp /rd/not-found returned %d", r);
+  8009b3:	50                   	push   %eax
+  8009b4:	68 60 45 80 00       	push   $0x804560
+  8009b9:	68 b8 00 00 00       	push   $0xb8
+  8009be:	68 f5 40 80 00       	push   $0x8040f5
+  8009c3:	e8 63 00 00 00       	call   800a2b <_panic>
+
+008009c8 <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  8009c8:	55                   	push   %ebp
+  8009c9:	89 e5                	mov    %esp,%ebp
+  8009cb:	56                   	push   %esi
+  8009cc:	53                   	push   %ebx
+  8009cd:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8009d0:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = &envs[ENVX(sys_getenvid())];
+  8009d3:	e8 e2 0a 00 00       	call   8014ba <sys_getenvid>
+  8009d8:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8009dd:	69 c0 8c 00 00 00    	imul   $0x8c,%eax,%eax
+  8009e3:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8009e8:	a3 30 db 82 00       	mov    %eax,0x82db30
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  8009ed:	85 db                	test   %ebx,%ebx
+  8009ef:	7e 07                	jle    8009f8 <libmain+0x30>
+		binaryname = argv[0];
+  8009f1:	8b 06                	mov    (%esi),%eax
+  8009f3:	a3 00 50 80 00       	mov    %eax,0x805000
+
+	// call user main routine
+	umain(argc, argv);
+  8009f8:	83 ec 08             	sub    $0x8,%esp
+  8009fb:	56                   	push   %esi
+  8009fc:	53                   	push   %ebx
+  8009fd:	e8 92 fa ff ff       	call   800494 <umain>
+
+	// exit gracefully
+	exit();
+  800a02:	e8 0a 00 00 00       	call   800a11 <exit>
+}
+  800a07:	83 c4 10             	add    $0x10,%esp
+  800a0a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800a0d:	5b                   	pop    %ebx
+  800a0e:	5e                   	pop    %esi
+  800a0f:	5d                   	pop    %ebp
+  800a10:	c3                   	ret
+
+00800a11 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800a11:	55                   	push   %ebp
+  800a12:	89 e5                	mov    %esp,%ebp
+  800a14:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  800a17:	e8 b9 10 00 00       	call   801ad5 <close_all>
+	sys_env_destroy(0);
+  800a1c:	83 ec 0c             	sub    $0xc,%esp
+  800a1f:	6a 00                	push   $0x0
+  800a21:	e8 4b 0a 00 00       	call   801471 <sys_env_destroy>
+}
+  800a26:	83 c4 10             	add    $0x10,%esp
+  800a29:	c9                   	leave
+  800a2a:	c3                   	ret
+
+00800a2b <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  800a2b:	55                   	push   %ebp
+  800a2c:	89 e5                	mov    %esp,%ebp
+  800a2e:	56                   	push   %esi
+  800a2f:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  800a30:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  800a33:	8b 35 00 50 80 00    	mov    0x805000,%esi
+  800a39:	e8 7c 0a 00 00       	call   8014ba <sys_getenvid>
+  800a3e:	83 ec 0c             	sub    $0xc,%esp
+  800a41:	ff 75 0c             	push   0xc(%ebp)
+  800a44:	ff 75 08             	push   0x8(%ebp)
+  800a47:	56                   	push   %esi
+  800a48:	50                   	push   %eax
+  800a49:	68 90 45 80 00       	push   $0x804590
+  800a4e:	e8 b3 00 00 00       	call   800b06 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  800a53:	83 c4 18             	add    $0x18,%esp
+  800a56:	53                   	push   %ebx
+  800a57:	ff 75 10             	push   0x10(%ebp)
+  800a5a:	e8 56 00 00 00       	call   800ab5 <vcprintf>
+	cprintf("\n");
+  800a5f:	c7 04 24 67 4a 80 00 	movl   $0x804a67,(%esp)
+  800a66:	e8 9b 00 00 00       	call   800b06 <cprintf>
+  800a6b:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  800a6e:	cc                   	int3
+	while (1)
+  800a6f:	eb fd                	jmp    800a6e <_panic+0x43>
+
+00800a71 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  800a71:	55                   	push   %ebp
+  800a72:	89 e5                	mov    %esp,%ebp
+  800a74:	53                   	push   %ebx
+  800a75:	83 ec 04             	sub    $0x4,%esp
+  800a78:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  800a7b:	8b 13                	mov    (%ebx),%edx
+  800a7d:	8d 42 01             	lea    0x1(%edx),%eax
+  800a80:	89 03                	mov    %eax,(%ebx)
+  800a82:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800a85:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  800a89:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800a8e:	74 09                	je     800a99 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  800a90:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  800a94:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800a97:	c9                   	leave
+  800a98:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  800a99:	83 ec 08             	sub    $0x8,%esp
+  800a9c:	68 ff 00 00 00       	push   $0xff
+  800aa1:	8d 43 08             	lea    0x8(%ebx),%eax
+  800aa4:	50                   	push   %eax
+  800aa5:	e8 7a 09 00 00       	call   801424 <sys_cputs>
+		b->idx = 0;
+  800aaa:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  800ab0:	83 c4 10             	add    $0x10,%esp
+  800ab3:	eb db                	jmp    800a90 <putch+0x1f>
+
+00800ab5 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  800ab5:	55                   	push   %ebp
+  800ab6:	89 e5                	mov    %esp,%ebp
+  800ab8:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  800abe:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  800ac5:	00 00 00 
+	b.cnt = 0;
+  800ac8:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  800acf:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  800ad2:	ff 75 0c             	push   0xc(%ebp)
+  800ad5:	ff 75 08             	push   0x8(%ebp)
+  800ad8:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  800ade:	50                   	push   %eax
+  800adf:	68 71 0a 80 00       	push   $0x800a71
+  800ae4:	e8 14 01 00 00       	call   800bfd <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  800ae9:	83 c4 08             	add    $0x8,%esp
+  800aec:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  800af2:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  800af8:	50                   	push   %eax
+  800af9:	e8 26 09 00 00       	call   801424 <sys_cputs>
+
+	return b.cnt;
+}
+  800afe:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800b04:	c9                   	leave
+  800b05:	c3                   	ret
+
+00800b06 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  800b06:	55                   	push   %ebp
+  800b07:	89 e5                	mov    %esp,%ebp
+  800b09:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  800b0c:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  800b0f:	50                   	push   %eax
+  800b10:	ff 75 08             	push   0x8(%ebp)
+  800b13:	e8 9d ff ff ff       	call   800ab5 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  800b18:	c9                   	leave
+  800b19:	c3                   	ret
+
+00800b1a <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  800b1a:	55                   	push   %ebp
+  800b1b:	89 e5                	mov    %esp,%ebp
+  800b1d:	57                   	push   %edi
+  800b1e:	56                   	push   %esi
+  800b1f:	53                   	push   %ebx
+  800b20:	83 ec 1c             	sub    $0x1c,%esp
+  800b23:	89 c7                	mov    %eax,%edi
+  800b25:	89 d6                	mov    %edx,%esi
+  800b27:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b2a:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800b2d:	89 d1                	mov    %edx,%ecx
+  800b2f:	89 c2                	mov    %eax,%edx
+  800b31:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800b34:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800b37:	8b 45 10             	mov    0x10(%ebp),%eax
+  800b3a:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  800b3d:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800b40:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800b47:	39 c2                	cmp    %eax,%edx
+  800b49:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  800b4c:	72 3e                	jb     800b8c <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  800b4e:	83 ec 0c             	sub    $0xc,%esp
+  800b51:	ff 75 18             	push   0x18(%ebp)
+  800b54:	83 eb 01             	sub    $0x1,%ebx
+  800b57:	53                   	push   %ebx
+  800b58:	50                   	push   %eax
+  800b59:	83 ec 08             	sub    $0x8,%esp
+  800b5c:	ff 75 e4             	push   -0x1c(%ebp)
+  800b5f:	ff 75 e0             	push   -0x20(%ebp)
+  800b62:	ff 75 dc             	push   -0x24(%ebp)
+  800b65:	ff 75 d8             	push   -0x28(%ebp)
+  800b68:	e8 f1 33 00 00       	call   803f5e <__udivdi3>
+  800b6d:	83 c4 18             	add    $0x18,%esp
+  800b70:	52                   	push   %edx
+  800b71:	50                   	push   %eax
+  800b72:	89 f2                	mov    %esi,%edx
+  800b74:	89 f8                	mov    %edi,%eax
+  800b76:	e8 9f ff ff ff       	call   800b1a <printnum>
+  800b7b:	83 c4 20             	add    $0x20,%esp
+  800b7e:	eb 13                	jmp    800b93 <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  800b80:	83 ec 08             	sub    $0x8,%esp
+  800b83:	56                   	push   %esi
+  800b84:	ff 75 18             	push   0x18(%ebp)
+  800b87:	ff d7                	call   *%edi
+  800b89:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  800b8c:	83 eb 01             	sub    $0x1,%ebx
+  800b8f:	85 db                	test   %ebx,%ebx
+  800b91:	7f ed                	jg     800b80 <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  800b93:	83 ec 08             	sub    $0x8,%esp
+  800b96:	56                   	push   %esi
+  800b97:	83 ec 04             	sub    $0x4,%esp
+  800b9a:	ff 75 e4             	push   -0x1c(%ebp)
+  800b9d:	ff 75 e0             	push   -0x20(%ebp)
+  800ba0:	ff 75 dc             	push   -0x24(%ebp)
+  800ba3:	ff 75 d8             	push   -0x28(%ebp)
+  800ba6:	e8 d1 33 00 00       	call   803f7c <__umoddi3>
+  800bab:	83 c4 14             	add    $0x14,%esp
+  800bae:	0f be 80 b3 45 80 00 	movsbl 0x8045b3(%eax),%eax
+  800bb5:	50                   	push   %eax
+  800bb6:	ff d7                	call   *%edi
+}
+  800bb8:	83 c4 10             	add    $0x10,%esp
+  800bbb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800bbe:	5b                   	pop    %ebx
+  800bbf:	5e                   	pop    %esi
+  800bc0:	5f                   	pop    %edi
+  800bc1:	5d                   	pop    %ebp
+  800bc2:	c3                   	ret
+
+00800bc3 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  800bc3:	55                   	push   %ebp
+  800bc4:	89 e5                	mov    %esp,%ebp
+  800bc6:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  800bc9:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  800bcd:	8b 10                	mov    (%eax),%edx
+  800bcf:	3b 50 04             	cmp    0x4(%eax),%edx
+  800bd2:	73 0a                	jae    800bde <sprintputch+0x1b>
+		*b->buf++ = ch;
+  800bd4:	8d 4a 01             	lea    0x1(%edx),%ecx
+  800bd7:	89 08                	mov    %ecx,(%eax)
+  800bd9:	8b 45 08             	mov    0x8(%ebp),%eax
+  800bdc:	88 02                	mov    %al,(%edx)
+}
+  800bde:	5d                   	pop    %ebp
+  800bdf:	c3                   	ret
+
+00800be0 <printfmt>:
+{
+  800be0:	55                   	push   %ebp
+  800be1:	89 e5                	mov    %esp,%ebp
+  800be3:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  800be6:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  800be9:	50                   	push   %eax
+  800bea:	ff 75 10             	push   0x10(%ebp)
+  800bed:	ff 75 0c             	push   0xc(%ebp)
+  800bf0:	ff 75 08             	push   0x8(%ebp)
+  800bf3:	e8 05 00 00 00       	call   800bfd <vprintfmt>
+}
+  800bf8:	83 c4 10             	add    $0x10,%esp
+  800bfb:	c9                   	leave
+  800bfc:	c3                   	ret
+
+00800bfd <vprintfmt>:
+{
+  800bfd:	55                   	push   %ebp
+  800bfe:	89 e5                	mov    %esp,%ebp
+  800c00:	57                   	push   %edi
+  800c01:	56                   	push   %esi
+  800c02:	53                   	push   %ebx
+  800c03:	83 ec 2c             	sub    $0x2c,%esp
+  800c06:	8b 75 08             	mov    0x8(%ebp),%esi
+  800c09:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800c0c:	8b 7d 10             	mov    0x10(%ebp),%edi
+  800c0f:	eb 0a                	jmp    800c1b <vprintfmt+0x1e>
+			putch(ch, putdat);
+  800c11:	83 ec 08             	sub    $0x8,%esp
+  800c14:	53                   	push   %ebx
+  800c15:	50                   	push   %eax
+  800c16:	ff d6                	call   *%esi
+  800c18:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800c1b:	83 c7 01             	add    $0x1,%edi
+  800c1e:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  800c22:	83 f8 25             	cmp    $0x25,%eax
+  800c25:	74 0c                	je     800c33 <vprintfmt+0x36>
+			if (ch == '\0')
+  800c27:	85 c0                	test   %eax,%eax
+  800c29:	75 e6                	jne    800c11 <vprintfmt+0x14>
+}
+  800c2b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c2e:	5b                   	pop    %ebx
+  800c2f:	5e                   	pop    %esi
+  800c30:	5f                   	pop    %edi
+  800c31:	5d                   	pop    %ebp
+  800c32:	c3                   	ret
+		padc = ' ';
+  800c33:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  800c37:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  800c3e:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  800c45:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  800c4c:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800c51:	8d 47 01             	lea    0x1(%edi),%eax
+  800c54:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800c57:	0f b6 17             	movzbl (%edi),%edx
+  800c5a:	8d 42 dd             	lea    -0x23(%edx),%eax
+  800c5d:	3c 55                	cmp    $0x55,%al
+  800c5f:	0f 87 cf 03 00 00    	ja     801034 <vprintfmt+0x437>
+  800c65:	0f b6 c0             	movzbl %al,%eax
+  800c68:	ff 24 85 20 47 80 00 	jmp    *0x804720(,%eax,4)
+  800c6f:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  800c72:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  800c76:	eb d9                	jmp    800c51 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  800c78:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800c7b:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  800c7f:	eb d0                	jmp    800c51 <vprintfmt+0x54>
+  800c81:	0f b6 d2             	movzbl %dl,%edx
+  800c84:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  800c87:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c8c:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  800c8f:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  800c92:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  800c96:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  800c99:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  800c9c:	83 f9 09             	cmp    $0x9,%ecx
+  800c9f:	77 55                	ja     800cf6 <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  800ca1:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  800ca4:	eb e9                	jmp    800c8f <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  800ca6:	8b 45 14             	mov    0x14(%ebp),%eax
+  800ca9:	8b 00                	mov    (%eax),%eax
+  800cab:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800cae:	8b 45 14             	mov    0x14(%ebp),%eax
+  800cb1:	8d 40 04             	lea    0x4(%eax),%eax
+  800cb4:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800cb7:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  800cba:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800cbe:	79 91                	jns    800c51 <vprintfmt+0x54>
+				width = precision, precision = -1;
+  800cc0:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800cc3:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800cc6:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  800ccd:	eb 82                	jmp    800c51 <vprintfmt+0x54>
+			if (width < 0)
+  800ccf:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800cd2:	85 d2                	test   %edx,%edx
+  800cd4:	b8 00 00 00 00       	mov    $0x0,%eax
+  800cd9:	0f 49 c2             	cmovns %edx,%eax
+  800cdc:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800cdf:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800ce2:	e9 6a ff ff ff       	jmp    800c51 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  800ce7:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  800cea:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  800cf1:	e9 5b ff ff ff       	jmp    800c51 <vprintfmt+0x54>
+  800cf6:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800cf9:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800cfc:	eb bc                	jmp    800cba <vprintfmt+0xbd>
+			lflag++;
+  800cfe:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  800d01:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800d04:	e9 48 ff ff ff       	jmp    800c51 <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  800d09:	8b 45 14             	mov    0x14(%ebp),%eax
+  800d0c:	8d 78 04             	lea    0x4(%eax),%edi
+  800d0f:	83 ec 08             	sub    $0x8,%esp
+  800d12:	53                   	push   %ebx
+  800d13:	ff 30                	push   (%eax)
+  800d15:	ff d6                	call   *%esi
+			break;
+  800d17:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  800d1a:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  800d1d:	e9 b1 02 00 00       	jmp    800fd3 <vprintfmt+0x3d6>
+			err = va_arg(ap, int);
+  800d22:	8b 45 14             	mov    0x14(%ebp),%eax
+  800d25:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  800d28:	8b 10                	mov    (%eax),%edx
+  800d2a:	89 d0                	mov    %edx,%eax
+  800d2c:	f7 d8                	neg    %eax
+  800d2e:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800d31:	83 f8 11             	cmp    $0x11,%eax
+  800d34:	7f 23                	jg     800d59 <vprintfmt+0x15c>
+  800d36:	8b 14 85 80 48 80 00 	mov    0x804880(,%eax,4),%edx
+  800d3d:	85 d2                	test   %edx,%edx
+  800d3f:	74 18                	je     800d59 <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  800d41:	52                   	push   %edx
+  800d42:	68 d2 49 80 00       	push   $0x8049d2
+  800d47:	53                   	push   %ebx
+  800d48:	56                   	push   %esi
+  800d49:	e8 92 fe ff ff       	call   800be0 <printfmt>
+  800d4e:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800d51:	89 7d 14             	mov    %edi,0x14(%ebp)
+  800d54:	e9 7a 02 00 00       	jmp    800fd3 <vprintfmt+0x3d6>
+				printfmt(putch, putdat, "error %d", err);
+  800d59:	50                   	push   %eax
+  800d5a:	68 cb 45 80 00       	push   $0x8045cb
+  800d5f:	53                   	push   %ebx
+  800d60:	56                   	push   %esi
+  800d61:	e8 7a fe ff ff       	call   800be0 <printfmt>
+  800d66:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800d69:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  800d6c:	e9 62 02 00 00       	jmp    800fd3 <vprintfmt+0x3d6>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800d71:	8b 45 14             	mov    0x14(%ebp),%eax
+  800d74:	83 c0 04             	add    $0x4,%eax
+  800d77:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  800d7a:	8b 45 14             	mov    0x14(%ebp),%eax
+  800d7d:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  800d7f:	85 c9                	test   %ecx,%ecx
+  800d81:	b8 c4 45 80 00       	mov    $0x8045c4,%eax
+  800d86:	0f 45 c1             	cmovne %ecx,%eax
+  800d89:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  800d8c:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800d90:	7e 06                	jle    800d98 <vprintfmt+0x19b>
+  800d92:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  800d96:	75 0b                	jne    800da3 <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800d98:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  800d9b:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  800d9e:	89 75 08             	mov    %esi,0x8(%ebp)
+  800da1:	eb 5c                	jmp    800dff <vprintfmt+0x202>
+  800da3:	83 ec 08             	sub    $0x8,%esp
+  800da6:	ff 75 d0             	push   -0x30(%ebp)
+  800da9:	ff 75 cc             	push   -0x34(%ebp)
+  800dac:	e8 20 03 00 00       	call   8010d1 <strnlen>
+  800db1:	89 c2                	mov    %eax,%edx
+  800db3:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800db6:	29 d0                	sub    %edx,%eax
+  800db8:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  800dbb:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  800dbf:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800dc2:	89 75 08             	mov    %esi,0x8(%ebp)
+  800dc5:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800dc7:	eb 0e                	jmp    800dd7 <vprintfmt+0x1da>
+					putch(padc, putdat);
+  800dc9:	83 ec 08             	sub    $0x8,%esp
+  800dcc:	53                   	push   %ebx
+  800dcd:	57                   	push   %edi
+  800dce:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800dd1:	83 ee 01             	sub    $0x1,%esi
+  800dd4:	83 c4 10             	add    $0x10,%esp
+  800dd7:	85 f6                	test   %esi,%esi
+  800dd9:	7f ee                	jg     800dc9 <vprintfmt+0x1cc>
+  800ddb:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800dde:	8b 75 08             	mov    0x8(%ebp),%esi
+  800de1:	85 c0                	test   %eax,%eax
+  800de3:	ba 00 00 00 00       	mov    $0x0,%edx
+  800de8:	0f 49 d0             	cmovns %eax,%edx
+  800deb:	29 d0                	sub    %edx,%eax
+  800ded:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800df0:	eb a6                	jmp    800d98 <vprintfmt+0x19b>
+					putch(ch, putdat);
+  800df2:	83 ec 08             	sub    $0x8,%esp
+  800df5:	53                   	push   %ebx
+  800df6:	52                   	push   %edx
+  800df7:	ff 55 08             	call   *0x8(%ebp)
+  800dfa:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800dfd:	89 f1                	mov    %esi,%ecx
+  800dff:	8d 71 01             	lea    0x1(%ecx),%esi
+  800e02:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800e06:	0f be d0             	movsbl %al,%edx
+  800e09:	85 d2                	test   %edx,%edx
+  800e0b:	74 28                	je     800e35 <vprintfmt+0x238>
+  800e0d:	85 ff                	test   %edi,%edi
+  800e0f:	78 05                	js     800e16 <vprintfmt+0x219>
+  800e11:	83 ef 01             	sub    $0x1,%edi
+  800e14:	78 30                	js     800e46 <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800e16:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800e1a:	74 d6                	je     800df2 <vprintfmt+0x1f5>
+  800e1c:	0f be c0             	movsbl %al,%eax
+  800e1f:	83 e8 20             	sub    $0x20,%eax
+  800e22:	83 f8 5e             	cmp    $0x5e,%eax
+  800e25:	76 cb                	jbe    800df2 <vprintfmt+0x1f5>
+					putch('?', putdat);
+  800e27:	83 ec 08             	sub    $0x8,%esp
+  800e2a:	53                   	push   %ebx
+  800e2b:	6a 3f                	push   $0x3f
+  800e2d:	ff 55 08             	call   *0x8(%ebp)
+  800e30:	83 c4 10             	add    $0x10,%esp
+  800e33:	eb c8                	jmp    800dfd <vprintfmt+0x200>
+  800e35:	8b 75 08             	mov    0x8(%ebp),%esi
+  800e38:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800e3b:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800e3e:	01 d0                	add    %edx,%eax
+  800e40:	29 c8                	sub    %ecx,%eax
+  800e42:	89 c7                	mov    %eax,%edi
+  800e44:	eb 13                	jmp    800e59 <vprintfmt+0x25c>
+  800e46:	8b 75 08             	mov    0x8(%ebp),%esi
+  800e49:	eb ed                	jmp    800e38 <vprintfmt+0x23b>
+				putch(' ', putdat);
+  800e4b:	83 ec 08             	sub    $0x8,%esp
+  800e4e:	53                   	push   %ebx
+  800e4f:	6a 20                	push   $0x20
+  800e51:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  800e53:	83 ef 01             	sub    $0x1,%edi
+  800e56:	83 c4 10             	add    $0x10,%esp
+  800e59:	85 ff                	test   %edi,%edi
+  800e5b:	7f ee                	jg     800e4b <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800e5d:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  800e60:	89 45 14             	mov    %eax,0x14(%ebp)
+  800e63:	e9 6b 01 00 00       	jmp    800fd3 <vprintfmt+0x3d6>
+	if (lflag >= 2)
+  800e68:	83 f9 01             	cmp    $0x1,%ecx
+  800e6b:	7f 1f                	jg     800e8c <vprintfmt+0x28f>
+	else if (lflag)
+  800e6d:	85 c9                	test   %ecx,%ecx
+  800e6f:	74 67                	je     800ed8 <vprintfmt+0x2db>
+		return va_arg(*ap, long);
+  800e71:	8b 45 14             	mov    0x14(%ebp),%eax
+  800e74:	8b 00                	mov    (%eax),%eax
+  800e76:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800e79:	89 c1                	mov    %eax,%ecx
+  800e7b:	c1 f9 1f             	sar    $0x1f,%ecx
+  800e7e:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800e81:	8b 45 14             	mov    0x14(%ebp),%eax
+  800e84:	8d 40 04             	lea    0x4(%eax),%eax
+  800e87:	89 45 14             	mov    %eax,0x14(%ebp)
+  800e8a:	eb 17                	jmp    800ea3 <vprintfmt+0x2a6>
+		return va_arg(*ap, long long);
+  800e8c:	8b 45 14             	mov    0x14(%ebp),%eax
+  800e8f:	8b 50 04             	mov    0x4(%eax),%edx
+  800e92:	8b 00                	mov    (%eax),%eax
+  800e94:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800e97:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800e9a:	8b 45 14             	mov    0x14(%ebp),%eax
+  800e9d:	8d 40 08             	lea    0x8(%eax),%eax
+  800ea0:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  800ea3:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800ea6:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  800ea9:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  800eae:	85 c9                	test   %ecx,%ecx
+  800eb0:	0f 89 03 01 00 00    	jns    800fb9 <vprintfmt+0x3bc>
+				putch('-', putdat);
+  800eb6:	83 ec 08             	sub    $0x8,%esp
+  800eb9:	53                   	push   %ebx
+  800eba:	6a 2d                	push   $0x2d
+  800ebc:	ff d6                	call   *%esi
+				num = -(long long) num;
+  800ebe:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800ec1:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800ec4:	f7 da                	neg    %edx
+  800ec6:	83 d1 00             	adc    $0x0,%ecx
+  800ec9:	f7 d9                	neg    %ecx
+  800ecb:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  800ece:	bf 0a 00 00 00       	mov    $0xa,%edi
+  800ed3:	e9 e1 00 00 00       	jmp    800fb9 <vprintfmt+0x3bc>
+		return va_arg(*ap, int);
+  800ed8:	8b 45 14             	mov    0x14(%ebp),%eax
+  800edb:	8b 00                	mov    (%eax),%eax
+  800edd:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800ee0:	89 c1                	mov    %eax,%ecx
+  800ee2:	c1 f9 1f             	sar    $0x1f,%ecx
+  800ee5:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800ee8:	8b 45 14             	mov    0x14(%ebp),%eax
+  800eeb:	8d 40 04             	lea    0x4(%eax),%eax
+  800eee:	89 45 14             	mov    %eax,0x14(%ebp)
+  800ef1:	eb b0                	jmp    800ea3 <vprintfmt+0x2a6>
+	if (lflag >= 2)
+  800ef3:	83 f9 01             	cmp    $0x1,%ecx
+  800ef6:	7f 1e                	jg     800f16 <vprintfmt+0x319>
+	else if (lflag)
+  800ef8:	85 c9                	test   %ecx,%ecx
+  800efa:	74 32                	je     800f2e <vprintfmt+0x331>
+		return va_arg(*ap, unsigned long);
+  800efc:	8b 45 14             	mov    0x14(%ebp),%eax
+  800eff:	8b 10                	mov    (%eax),%edx
+  800f01:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800f06:	8d 40 04             	lea    0x4(%eax),%eax
+  800f09:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800f0c:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  800f11:	e9 a3 00 00 00       	jmp    800fb9 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  800f16:	8b 45 14             	mov    0x14(%ebp),%eax
+  800f19:	8b 10                	mov    (%eax),%edx
+  800f1b:	8b 48 04             	mov    0x4(%eax),%ecx
+  800f1e:	8d 40 08             	lea    0x8(%eax),%eax
+  800f21:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800f24:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  800f29:	e9 8b 00 00 00       	jmp    800fb9 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  800f2e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800f31:	8b 10                	mov    (%eax),%edx
+  800f33:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800f38:	8d 40 04             	lea    0x4(%eax),%eax
+  800f3b:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800f3e:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  800f43:	eb 74                	jmp    800fb9 <vprintfmt+0x3bc>
+	if (lflag >= 2)
+  800f45:	83 f9 01             	cmp    $0x1,%ecx
+  800f48:	7f 1b                	jg     800f65 <vprintfmt+0x368>
+	else if (lflag)
+  800f4a:	85 c9                	test   %ecx,%ecx
+  800f4c:	74 2c                	je     800f7a <vprintfmt+0x37d>
+		return va_arg(*ap, unsigned long);
+  800f4e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800f51:	8b 10                	mov    (%eax),%edx
+  800f53:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800f58:	8d 40 04             	lea    0x4(%eax),%eax
+  800f5b:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800f5e:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long);
+  800f63:	eb 54                	jmp    800fb9 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  800f65:	8b 45 14             	mov    0x14(%ebp),%eax
+  800f68:	8b 10                	mov    (%eax),%edx
+  800f6a:	8b 48 04             	mov    0x4(%eax),%ecx
+  800f6d:	8d 40 08             	lea    0x8(%eax),%eax
+  800f70:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800f73:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long long);
+  800f78:	eb 3f                	jmp    800fb9 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  800f7a:	8b 45 14             	mov    0x14(%ebp),%eax
+  800f7d:	8b 10                	mov    (%eax),%edx
+  800f7f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800f84:	8d 40 04             	lea    0x4(%eax),%eax
+  800f87:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800f8a:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned int);
+  800f8f:	eb 28                	jmp    800fb9 <vprintfmt+0x3bc>
+			putch('0', putdat);
+  800f91:	83 ec 08             	sub    $0x8,%esp
+  800f94:	53                   	push   %ebx
+  800f95:	6a 30                	push   $0x30
+  800f97:	ff d6                	call   *%esi
+			putch('x', putdat);
+  800f99:	83 c4 08             	add    $0x8,%esp
+  800f9c:	53                   	push   %ebx
+  800f9d:	6a 78                	push   $0x78
+  800f9f:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  800fa1:	8b 45 14             	mov    0x14(%ebp),%eax
+  800fa4:	8b 10                	mov    (%eax),%edx
+  800fa6:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  800fab:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  800fae:	8d 40 04             	lea    0x4(%eax),%eax
+  800fb1:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800fb4:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  800fb9:	83 ec 0c             	sub    $0xc,%esp
+  800fbc:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  800fc0:	50                   	push   %eax
+  800fc1:	ff 75 e0             	push   -0x20(%ebp)
+  800fc4:	57                   	push   %edi
+  800fc5:	51                   	push   %ecx
+  800fc6:	52                   	push   %edx
+  800fc7:	89 da                	mov    %ebx,%edx
+  800fc9:	89 f0                	mov    %esi,%eax
+  800fcb:	e8 4a fb ff ff       	call   800b1a <printnum>
+			break;
+  800fd0:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  800fd3:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800fd6:	e9 40 fc ff ff       	jmp    800c1b <vprintfmt+0x1e>
+	if (lflag >= 2)
+  800fdb:	83 f9 01             	cmp    $0x1,%ecx
+  800fde:	7f 1b                	jg     800ffb <vprintfmt+0x3fe>
+	else if (lflag)
+  800fe0:	85 c9                	test   %ecx,%ecx
+  800fe2:	74 2c                	je     801010 <vprintfmt+0x413>
+		return va_arg(*ap, unsigned long);
+  800fe4:	8b 45 14             	mov    0x14(%ebp),%eax
+  800fe7:	8b 10                	mov    (%eax),%edx
+  800fe9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800fee:	8d 40 04             	lea    0x4(%eax),%eax
+  800ff1:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800ff4:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  800ff9:	eb be                	jmp    800fb9 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  800ffb:	8b 45 14             	mov    0x14(%ebp),%eax
+  800ffe:	8b 10                	mov    (%eax),%edx
+  801000:	8b 48 04             	mov    0x4(%eax),%ecx
+  801003:	8d 40 08             	lea    0x8(%eax),%eax
+  801006:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  801009:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  80100e:	eb a9                	jmp    800fb9 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  801010:	8b 45 14             	mov    0x14(%ebp),%eax
+  801013:	8b 10                	mov    (%eax),%edx
+  801015:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80101a:	8d 40 04             	lea    0x4(%eax),%eax
+  80101d:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  801020:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  801025:	eb 92                	jmp    800fb9 <vprintfmt+0x3bc>
+			putch(ch, putdat);
+  801027:	83 ec 08             	sub    $0x8,%esp
+  80102a:	53                   	push   %ebx
+  80102b:	6a 25                	push   $0x25
+  80102d:	ff d6                	call   *%esi
+			break;
+  80102f:	83 c4 10             	add    $0x10,%esp
+  801032:	eb 9f                	jmp    800fd3 <vprintfmt+0x3d6>
+			putch('%', putdat);
+  801034:	83 ec 08             	sub    $0x8,%esp
+  801037:	53                   	push   %ebx
+  801038:	6a 25                	push   $0x25
+  80103a:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  80103c:	83 c4 10             	add    $0x10,%esp
+  80103f:	89 f8                	mov    %edi,%eax
+  801041:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  801045:	74 05                	je     80104c <vprintfmt+0x44f>
+  801047:	83 e8 01             	sub    $0x1,%eax
+  80104a:	eb f5                	jmp    801041 <vprintfmt+0x444>
+  80104c:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80104f:	eb 82                	jmp    800fd3 <vprintfmt+0x3d6>
+
+00801051 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  801051:	55                   	push   %ebp
+  801052:	89 e5                	mov    %esp,%ebp
+  801054:	83 ec 18             	sub    $0x18,%esp
+  801057:	8b 45 08             	mov    0x8(%ebp),%eax
+  80105a:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  80105d:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  801060:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  801064:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  801067:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  80106e:	85 c0                	test   %eax,%eax
+  801070:	74 26                	je     801098 <vsnprintf+0x47>
+  801072:	85 d2                	test   %edx,%edx
+  801074:	7e 22                	jle    801098 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  801076:	ff 75 14             	push   0x14(%ebp)
+  801079:	ff 75 10             	push   0x10(%ebp)
+  80107c:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  80107f:	50                   	push   %eax
+  801080:	68 c3 0b 80 00       	push   $0x800bc3
+  801085:	e8 73 fb ff ff       	call   800bfd <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  80108a:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  80108d:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  801090:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801093:	83 c4 10             	add    $0x10,%esp
+}
+  801096:	c9                   	leave
+  801097:	c3                   	ret
+		return -E_INVAL;
+  801098:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80109d:	eb f7                	jmp    801096 <vsnprintf+0x45>
+
+0080109f <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  80109f:	55                   	push   %ebp
+  8010a0:	89 e5                	mov    %esp,%ebp
+  8010a2:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  8010a5:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  8010a8:	50                   	push   %eax
+  8010a9:	ff 75 10             	push   0x10(%ebp)
+  8010ac:	ff 75 0c             	push   0xc(%ebp)
+  8010af:	ff 75 08             	push   0x8(%ebp)
+  8010b2:	e8 9a ff ff ff       	call   801051 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  8010b7:	c9                   	leave
+  8010b8:	c3                   	ret
+
+008010b9 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  8010b9:	55                   	push   %ebp
+  8010ba:	89 e5                	mov    %esp,%ebp
+  8010bc:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  8010bf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8010c4:	eb 03                	jmp    8010c9 <strlen+0x10>
+		n++;
+  8010c6:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  8010c9:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  8010cd:	75 f7                	jne    8010c6 <strlen+0xd>
+	return n;
+}
+  8010cf:	5d                   	pop    %ebp
+  8010d0:	c3                   	ret
+
+008010d1 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  8010d1:	55                   	push   %ebp
+  8010d2:	89 e5                	mov    %esp,%ebp
+  8010d4:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8010d7:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8010da:	b8 00 00 00 00       	mov    $0x0,%eax
+  8010df:	eb 03                	jmp    8010e4 <strnlen+0x13>
+		n++;
+  8010e1:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8010e4:	39 d0                	cmp    %edx,%eax
+  8010e6:	74 08                	je     8010f0 <strnlen+0x1f>
+  8010e8:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  8010ec:	75 f3                	jne    8010e1 <strnlen+0x10>
+  8010ee:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  8010f0:	89 d0                	mov    %edx,%eax
+  8010f2:	5d                   	pop    %ebp
+  8010f3:	c3                   	ret
+
+008010f4 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  8010f4:	55                   	push   %ebp
+  8010f5:	89 e5                	mov    %esp,%ebp
+  8010f7:	53                   	push   %ebx
+  8010f8:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8010fb:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  8010fe:	b8 00 00 00 00       	mov    $0x0,%eax
+  801103:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  801107:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  80110a:	83 c0 01             	add    $0x1,%eax
+  80110d:	84 d2                	test   %dl,%dl
+  80110f:	75 f2                	jne    801103 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  801111:	89 c8                	mov    %ecx,%eax
+  801113:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801116:	c9                   	leave
+  801117:	c3                   	ret
+
+00801118 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  801118:	55                   	push   %ebp
+  801119:	89 e5                	mov    %esp,%ebp
+  80111b:	53                   	push   %ebx
+  80111c:	83 ec 10             	sub    $0x10,%esp
+  80111f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  801122:	53                   	push   %ebx
+  801123:	e8 91 ff ff ff       	call   8010b9 <strlen>
+  801128:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  80112b:	ff 75 0c             	push   0xc(%ebp)
+  80112e:	01 d8                	add    %ebx,%eax
+  801130:	50                   	push   %eax
+  801131:	e8 be ff ff ff       	call   8010f4 <strcpy>
+	return dst;
+}
+  801136:	89 d8                	mov    %ebx,%eax
+  801138:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80113b:	c9                   	leave
+  80113c:	c3                   	ret
+
+0080113d <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  80113d:	55                   	push   %ebp
+  80113e:	89 e5                	mov    %esp,%ebp
+  801140:	56                   	push   %esi
+  801141:	53                   	push   %ebx
+  801142:	8b 75 08             	mov    0x8(%ebp),%esi
+  801145:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  801148:	89 f3                	mov    %esi,%ebx
+  80114a:	03 5d 10             	add    0x10(%ebp),%ebx
+  80114d:	89 f0                	mov    %esi,%eax
+  80114f:	eb 0f                	jmp    801160 <strncpy+0x23>
+		*dst++ = *src;
+  801151:	83 c0 01             	add    $0x1,%eax
+  801154:	0f b6 0a             	movzbl (%edx),%ecx
+  801157:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  80115a:	80 f9 01             	cmp    $0x1,%cl
+  80115d:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  801160:	39 d8                	cmp    %ebx,%eax
+  801162:	75 ed                	jne    801151 <strncpy+0x14>
+	}
+	return ret;
+}
+  801164:	89 f0                	mov    %esi,%eax
+  801166:	5b                   	pop    %ebx
+  801167:	5e                   	pop    %esi
+  801168:	5d                   	pop    %ebp
+  801169:	c3                   	ret
+
+0080116a <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  80116a:	55                   	push   %ebp
+  80116b:	89 e5                	mov    %esp,%ebp
+  80116d:	56                   	push   %esi
+  80116e:	53                   	push   %ebx
+  80116f:	8b 75 08             	mov    0x8(%ebp),%esi
+  801172:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801175:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  801178:	89 f0                	mov    %esi,%eax
+  80117a:	85 d2                	test   %edx,%edx
+  80117c:	74 21                	je     80119f <strlcpy+0x35>
+  80117e:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  801182:	89 f2                	mov    %esi,%edx
+  801184:	eb 09                	jmp    80118f <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  801186:	83 c1 01             	add    $0x1,%ecx
+  801189:	83 c2 01             	add    $0x1,%edx
+  80118c:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  80118f:	39 c2                	cmp    %eax,%edx
+  801191:	74 09                	je     80119c <strlcpy+0x32>
+  801193:	0f b6 19             	movzbl (%ecx),%ebx
+  801196:	84 db                	test   %bl,%bl
+  801198:	75 ec                	jne    801186 <strlcpy+0x1c>
+  80119a:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  80119c:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  80119f:	29 f0                	sub    %esi,%eax
+}
+  8011a1:	5b                   	pop    %ebx
+  8011a2:	5e                   	pop    %esi
+  8011a3:	5d                   	pop    %ebp
+  8011a4:	c3                   	ret
+
+008011a5 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  8011a5:	55                   	push   %ebp
+  8011a6:	89 e5                	mov    %esp,%ebp
+  8011a8:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8011ab:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  8011ae:	eb 06                	jmp    8011b6 <strcmp+0x11>
+		p++, q++;
+  8011b0:	83 c1 01             	add    $0x1,%ecx
+  8011b3:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  8011b6:	0f b6 01             	movzbl (%ecx),%eax
+  8011b9:	84 c0                	test   %al,%al
+  8011bb:	74 04                	je     8011c1 <strcmp+0x1c>
+  8011bd:	3a 02                	cmp    (%edx),%al
+  8011bf:	74 ef                	je     8011b0 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  8011c1:	0f b6 c0             	movzbl %al,%eax
+  8011c4:	0f b6 12             	movzbl (%edx),%edx
+  8011c7:	29 d0                	sub    %edx,%eax
+}
+  8011c9:	5d                   	pop    %ebp
+  8011ca:	c3                   	ret
+
+008011cb <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  8011cb:	55                   	push   %ebp
+  8011cc:	89 e5                	mov    %esp,%ebp
+  8011ce:	53                   	push   %ebx
+  8011cf:	8b 45 08             	mov    0x8(%ebp),%eax
+  8011d2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011d5:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  8011d8:	eb 09                	jmp    8011e3 <strncmp+0x18>
+		n--, p++, q++;
+  8011da:	83 ea 01             	sub    $0x1,%edx
+  8011dd:	83 c0 01             	add    $0x1,%eax
+  8011e0:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  8011e3:	85 d2                	test   %edx,%edx
+  8011e5:	74 18                	je     8011ff <strncmp+0x34>
+  8011e7:	0f b6 18             	movzbl (%eax),%ebx
+  8011ea:	84 db                	test   %bl,%bl
+  8011ec:	74 04                	je     8011f2 <strncmp+0x27>
+  8011ee:	3a 19                	cmp    (%ecx),%bl
+  8011f0:	74 e8                	je     8011da <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  8011f2:	0f b6 00             	movzbl (%eax),%eax
+  8011f5:	0f b6 11             	movzbl (%ecx),%edx
+  8011f8:	29 d0                	sub    %edx,%eax
+}
+  8011fa:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8011fd:	c9                   	leave
+  8011fe:	c3                   	ret
+		return 0;
+  8011ff:	b8 00 00 00 00       	mov    $0x0,%eax
+  801204:	eb f4                	jmp    8011fa <strncmp+0x2f>
+
+00801206 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  801206:	55                   	push   %ebp
+  801207:	89 e5                	mov    %esp,%ebp
+  801209:	8b 45 08             	mov    0x8(%ebp),%eax
+  80120c:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  801210:	eb 03                	jmp    801215 <strchr+0xf>
+  801212:	83 c0 01             	add    $0x1,%eax
+  801215:	0f b6 10             	movzbl (%eax),%edx
+  801218:	84 d2                	test   %dl,%dl
+  80121a:	74 06                	je     801222 <strchr+0x1c>
+		if (*s == c)
+  80121c:	38 ca                	cmp    %cl,%dl
+  80121e:	75 f2                	jne    801212 <strchr+0xc>
+  801220:	eb 05                	jmp    801227 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  801222:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801227:	5d                   	pop    %ebp
+  801228:	c3                   	ret
+
+00801229 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  801229:	55                   	push   %ebp
+  80122a:	89 e5                	mov    %esp,%ebp
+  80122c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80122f:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  801233:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  801236:	38 ca                	cmp    %cl,%dl
+  801238:	74 09                	je     801243 <strfind+0x1a>
+  80123a:	84 d2                	test   %dl,%dl
+  80123c:	74 05                	je     801243 <strfind+0x1a>
+	for (; *s; s++)
+  80123e:	83 c0 01             	add    $0x1,%eax
+  801241:	eb f0                	jmp    801233 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  801243:	5d                   	pop    %ebp
+  801244:	c3                   	ret
+
+00801245 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  801245:	55                   	push   %ebp
+  801246:	89 e5                	mov    %esp,%ebp
+  801248:	57                   	push   %edi
+  801249:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80124c:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  80124f:	85 c9                	test   %ecx,%ecx
+  801251:	74 20                	je     801273 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  801253:	89 f8                	mov    %edi,%eax
+  801255:	09 c8                	or     %ecx,%eax
+  801257:	a8 03                	test   $0x3,%al
+  801259:	75 12                	jne    80126d <memset+0x28>
+		c &= 0xFF;
+  80125b:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  80125f:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  801265:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  801268:	fc                   	cld
+  801269:	f3 ab                	rep stos %eax,%es:(%edi)
+  80126b:	eb 06                	jmp    801273 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  80126d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801270:	fc                   	cld
+  801271:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  801273:	89 f8                	mov    %edi,%eax
+  801275:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  801278:	c9                   	leave
+  801279:	c3                   	ret
+
+0080127a <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  80127a:	55                   	push   %ebp
+  80127b:	89 e5                	mov    %esp,%ebp
+  80127d:	57                   	push   %edi
+  80127e:	56                   	push   %esi
+  80127f:	8b 45 08             	mov    0x8(%ebp),%eax
+  801282:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801285:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  801288:	39 c6                	cmp    %eax,%esi
+  80128a:	73 32                	jae    8012be <memmove+0x44>
+  80128c:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  80128f:	39 d0                	cmp    %edx,%eax
+  801291:	73 2b                	jae    8012be <memmove+0x44>
+		s += n;
+		d += n;
+  801293:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  801296:	89 d6                	mov    %edx,%esi
+  801298:	09 fe                	or     %edi,%esi
+  80129a:	09 ce                	or     %ecx,%esi
+  80129c:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  8012a2:	75 0e                	jne    8012b2 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  8012a4:	83 ef 04             	sub    $0x4,%edi
+  8012a7:	8d 72 fc             	lea    -0x4(%edx),%esi
+  8012aa:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  8012ad:	fd                   	std
+  8012ae:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  8012b0:	eb 09                	jmp    8012bb <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  8012b2:	83 ef 01             	sub    $0x1,%edi
+  8012b5:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  8012b8:	fd                   	std
+  8012b9:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  8012bb:	fc                   	cld
+  8012bc:	eb 1a                	jmp    8012d8 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  8012be:	89 f2                	mov    %esi,%edx
+  8012c0:	09 c2                	or     %eax,%edx
+  8012c2:	09 ca                	or     %ecx,%edx
+  8012c4:	f6 c2 03             	test   $0x3,%dl
+  8012c7:	75 0a                	jne    8012d3 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  8012c9:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  8012cc:	89 c7                	mov    %eax,%edi
+  8012ce:	fc                   	cld
+  8012cf:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  8012d1:	eb 05                	jmp    8012d8 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  8012d3:	89 c7                	mov    %eax,%edi
+  8012d5:	fc                   	cld
+  8012d6:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  8012d8:	5e                   	pop    %esi
+  8012d9:	5f                   	pop    %edi
+  8012da:	5d                   	pop    %ebp
+  8012db:	c3                   	ret
+
+008012dc <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  8012dc:	55                   	push   %ebp
+  8012dd:	89 e5                	mov    %esp,%ebp
+  8012df:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  8012e2:	ff 75 10             	push   0x10(%ebp)
+  8012e5:	ff 75 0c             	push   0xc(%ebp)
+  8012e8:	ff 75 08             	push   0x8(%ebp)
+  8012eb:	e8 8a ff ff ff       	call   80127a <memmove>
+}
+  8012f0:	c9                   	leave
+  8012f1:	c3                   	ret
+
+008012f2 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  8012f2:	55                   	push   %ebp
+  8012f3:	89 e5                	mov    %esp,%ebp
+  8012f5:	56                   	push   %esi
+  8012f6:	53                   	push   %ebx
+  8012f7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8012fa:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  8012fd:	89 c6                	mov    %eax,%esi
+  8012ff:	03 75 10             	add    0x10(%ebp),%esi
+  801302:	eb 06                	jmp    80130a <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  801304:	83 c0 01             	add    $0x1,%eax
+  801307:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  80130a:	39 f0                	cmp    %esi,%eax
+  80130c:	74 14                	je     801322 <memcmp+0x30>
+		if (*s1 != *s2)
+  80130e:	0f b6 08             	movzbl (%eax),%ecx
+  801311:	0f b6 1a             	movzbl (%edx),%ebx
+  801314:	38 d9                	cmp    %bl,%cl
+  801316:	74 ec                	je     801304 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  801318:	0f b6 c1             	movzbl %cl,%eax
+  80131b:	0f b6 db             	movzbl %bl,%ebx
+  80131e:	29 d8                	sub    %ebx,%eax
+  801320:	eb 05                	jmp    801327 <memcmp+0x35>
+	}
+
+	return 0;
+  801322:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801327:	5b                   	pop    %ebx
+  801328:	5e                   	pop    %esi
+  801329:	5d                   	pop    %ebp
+  80132a:	c3                   	ret
+
+0080132b <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  80132b:	55                   	push   %ebp
+  80132c:	89 e5                	mov    %esp,%ebp
+  80132e:	8b 45 08             	mov    0x8(%ebp),%eax
+  801331:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  801334:	89 c2                	mov    %eax,%edx
+  801336:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  801339:	eb 03                	jmp    80133e <memfind+0x13>
+  80133b:	83 c0 01             	add    $0x1,%eax
+  80133e:	39 d0                	cmp    %edx,%eax
+  801340:	73 04                	jae    801346 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  801342:	38 08                	cmp    %cl,(%eax)
+  801344:	75 f5                	jne    80133b <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  801346:	5d                   	pop    %ebp
+  801347:	c3                   	ret
+
+00801348 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  801348:	55                   	push   %ebp
+  801349:	89 e5                	mov    %esp,%ebp
+  80134b:	57                   	push   %edi
+  80134c:	56                   	push   %esi
+  80134d:	53                   	push   %ebx
+  80134e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801351:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  801354:	eb 03                	jmp    801359 <strtol+0x11>
+		s++;
+  801356:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  801359:	0f b6 02             	movzbl (%edx),%eax
+  80135c:	3c 20                	cmp    $0x20,%al
+  80135e:	74 f6                	je     801356 <strtol+0xe>
+  801360:	3c 09                	cmp    $0x9,%al
+  801362:	74 f2                	je     801356 <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  801364:	3c 2b                	cmp    $0x2b,%al
+  801366:	74 2a                	je     801392 <strtol+0x4a>
+	int neg = 0;
+  801368:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  80136d:	3c 2d                	cmp    $0x2d,%al
+  80136f:	74 2b                	je     80139c <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  801371:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  801377:	75 0f                	jne    801388 <strtol+0x40>
+  801379:	80 3a 30             	cmpb   $0x30,(%edx)
+  80137c:	74 28                	je     8013a6 <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  80137e:	85 db                	test   %ebx,%ebx
+  801380:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801385:	0f 44 d8             	cmove  %eax,%ebx
+  801388:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80138d:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  801390:	eb 46                	jmp    8013d8 <strtol+0x90>
+		s++;
+  801392:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  801395:	bf 00 00 00 00       	mov    $0x0,%edi
+  80139a:	eb d5                	jmp    801371 <strtol+0x29>
+		s++, neg = 1;
+  80139c:	83 c2 01             	add    $0x1,%edx
+  80139f:	bf 01 00 00 00       	mov    $0x1,%edi
+  8013a4:	eb cb                	jmp    801371 <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  8013a6:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  8013aa:	74 0e                	je     8013ba <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  8013ac:	85 db                	test   %ebx,%ebx
+  8013ae:	75 d8                	jne    801388 <strtol+0x40>
+		s++, base = 8;
+  8013b0:	83 c2 01             	add    $0x1,%edx
+  8013b3:	bb 08 00 00 00       	mov    $0x8,%ebx
+  8013b8:	eb ce                	jmp    801388 <strtol+0x40>
+		s += 2, base = 16;
+  8013ba:	83 c2 02             	add    $0x2,%edx
+  8013bd:	bb 10 00 00 00       	mov    $0x10,%ebx
+  8013c2:	eb c4                	jmp    801388 <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  8013c4:	0f be c0             	movsbl %al,%eax
+  8013c7:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  8013ca:	3b 45 10             	cmp    0x10(%ebp),%eax
+  8013cd:	7d 3a                	jge    801409 <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  8013cf:	83 c2 01             	add    $0x1,%edx
+  8013d2:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  8013d6:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  8013d8:	0f b6 02             	movzbl (%edx),%eax
+  8013db:	8d 70 d0             	lea    -0x30(%eax),%esi
+  8013de:	89 f3                	mov    %esi,%ebx
+  8013e0:	80 fb 09             	cmp    $0x9,%bl
+  8013e3:	76 df                	jbe    8013c4 <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  8013e5:	8d 70 9f             	lea    -0x61(%eax),%esi
+  8013e8:	89 f3                	mov    %esi,%ebx
+  8013ea:	80 fb 19             	cmp    $0x19,%bl
+  8013ed:	77 08                	ja     8013f7 <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  8013ef:	0f be c0             	movsbl %al,%eax
+  8013f2:	83 e8 57             	sub    $0x57,%eax
+  8013f5:	eb d3                	jmp    8013ca <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  8013f7:	8d 70 bf             	lea    -0x41(%eax),%esi
+  8013fa:	89 f3                	mov    %esi,%ebx
+  8013fc:	80 fb 19             	cmp    $0x19,%bl
+  8013ff:	77 08                	ja     801409 <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  801401:	0f be c0             	movsbl %al,%eax
+  801404:	83 e8 37             	sub    $0x37,%eax
+  801407:	eb c1                	jmp    8013ca <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  801409:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  80140d:	74 05                	je     801414 <strtol+0xcc>
+		*endptr = (char *) s;
+  80140f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801412:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  801414:	89 c8                	mov    %ecx,%eax
+  801416:	f7 d8                	neg    %eax
+  801418:	85 ff                	test   %edi,%edi
+  80141a:	0f 45 c8             	cmovne %eax,%ecx
+}
+  80141d:	89 c8                	mov    %ecx,%eax
+  80141f:	5b                   	pop    %ebx
+  801420:	5e                   	pop    %esi
+  801421:	5f                   	pop    %edi
+  801422:	5d                   	pop    %ebp
+  801423:	c3                   	ret
+
+00801424 <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  801424:	55                   	push   %ebp
+  801425:	89 e5                	mov    %esp,%ebp
+  801427:	57                   	push   %edi
+  801428:	56                   	push   %esi
+  801429:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  80142a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80142f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801432:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801435:	89 c3                	mov    %eax,%ebx
+  801437:	89 c7                	mov    %eax,%edi
+  801439:	55                   	push   %ebp
+  80143a:	89 e5                	mov    %esp,%ebp
+  80143c:	8d 35 44 14 80 00    	lea    0x801444,%esi
+  801442:	0f 34                	sysenter
+  801444:	5d                   	pop    %ebp
+	syscall2(SYS_cputs, 0, (uint32_t)s, len, 0, 0);
+}
+  801445:	5b                   	pop    %ebx
+  801446:	5e                   	pop    %esi
+  801447:	5f                   	pop    %edi
+  801448:	5d                   	pop    %ebp
+  801449:	c3                   	ret
+
+0080144a <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  80144a:	55                   	push   %ebp
+  80144b:	89 e5                	mov    %esp,%ebp
+  80144d:	57                   	push   %edi
+  80144e:	56                   	push   %esi
+  80144f:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  801450:	ba 00 00 00 00       	mov    $0x0,%edx
+  801455:	b8 01 00 00 00       	mov    $0x1,%eax
+  80145a:	89 d1                	mov    %edx,%ecx
+  80145c:	89 d3                	mov    %edx,%ebx
+  80145e:	89 d7                	mov    %edx,%edi
+  801460:	55                   	push   %ebp
+  801461:	89 e5                	mov    %esp,%ebp
+  801463:	8d 35 6b 14 80 00    	lea    0x80146b,%esi
+  801469:	0f 34                	sysenter
+  80146b:	5d                   	pop    %ebp
+	return syscall2(SYS_cgetc, 0, 0, 0, 0, 0);
+}
+  80146c:	5b                   	pop    %ebx
+  80146d:	5e                   	pop    %esi
+  80146e:	5f                   	pop    %edi
+  80146f:	5d                   	pop    %ebp
+  801470:	c3                   	ret
+
+00801471 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  801471:	55                   	push   %ebp
+  801472:	89 e5                	mov    %esp,%ebp
+  801474:	57                   	push   %edi
+  801475:	56                   	push   %esi
+  801476:	53                   	push   %ebx
+  801477:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  80147a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80147f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801482:	b8 03 00 00 00       	mov    $0x3,%eax
+  801487:	89 cb                	mov    %ecx,%ebx
+  801489:	89 cf                	mov    %ecx,%edi
+  80148b:	55                   	push   %ebp
+  80148c:	89 e5                	mov    %esp,%ebp
+  80148e:	8d 35 96 14 80 00    	lea    0x801496,%esi
+  801494:	0f 34                	sysenter
+  801496:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801497:	85 c0                	test   %eax,%eax
+  801499:	7f 08                	jg     8014a3 <sys_env_destroy+0x32>
+	return syscall2(SYS_env_destroy, 1, envid, 0, 0, 0);
+}
+  80149b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80149e:	5b                   	pop    %ebx
+  80149f:	5e                   	pop    %esi
+  8014a0:	5f                   	pop    %edi
+  8014a1:	5d                   	pop    %ebp
+  8014a2:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8014a3:	83 ec 0c             	sub    $0xc,%esp
+  8014a6:	50                   	push   %eax
+  8014a7:	6a 03                	push   $0x3
+  8014a9:	68 e7 48 80 00       	push   $0x8048e7
+  8014ae:	6a 3d                	push   $0x3d
+  8014b0:	68 04 49 80 00       	push   $0x804904
+  8014b5:	e8 71 f5 ff ff       	call   800a2b <_panic>
+
+008014ba <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  8014ba:	55                   	push   %ebp
+  8014bb:	89 e5                	mov    %esp,%ebp
+  8014bd:	57                   	push   %edi
+  8014be:	56                   	push   %esi
+  8014bf:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  8014c0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8014c5:	b8 02 00 00 00       	mov    $0x2,%eax
+  8014ca:	89 d1                	mov    %edx,%ecx
+  8014cc:	89 d3                	mov    %edx,%ebx
+  8014ce:	89 d7                	mov    %edx,%edi
+  8014d0:	55                   	push   %ebp
+  8014d1:	89 e5                	mov    %esp,%ebp
+  8014d3:	8d 35 db 14 80 00    	lea    0x8014db,%esi
+  8014d9:	0f 34                	sysenter
+  8014db:	5d                   	pop    %ebp
+	 return syscall2(SYS_getenvid, 0, 0, 0, 0, 0);
+}
+  8014dc:	5b                   	pop    %ebx
+  8014dd:	5e                   	pop    %esi
+  8014de:	5f                   	pop    %edi
+  8014df:	5d                   	pop    %ebp
+  8014e0:	c3                   	ret
+
+008014e1 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  8014e1:	55                   	push   %ebp
+  8014e2:	89 e5                	mov    %esp,%ebp
+  8014e4:	57                   	push   %edi
+  8014e5:	56                   	push   %esi
+  8014e6:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  8014e7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8014ec:	b8 0b 00 00 00       	mov    $0xb,%eax
+  8014f1:	89 d1                	mov    %edx,%ecx
+  8014f3:	89 d3                	mov    %edx,%ebx
+  8014f5:	89 d7                	mov    %edx,%edi
+  8014f7:	89 d6                	mov    %edx,%esi
+  8014f9:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  8014fb:	5b                   	pop    %ebx
+  8014fc:	5e                   	pop    %esi
+  8014fd:	5f                   	pop    %edi
+  8014fe:	5d                   	pop    %ebp
+  8014ff:	c3                   	ret
+
+00801500 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  801500:	55                   	push   %ebp
+  801501:	89 e5                	mov    %esp,%ebp
+  801503:	57                   	push   %edi
+  801504:	56                   	push   %esi
+  801505:	53                   	push   %ebx
+  801506:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  801509:	8b 55 08             	mov    0x8(%ebp),%edx
+  80150c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80150f:	b8 04 00 00 00       	mov    $0x4,%eax
+  801514:	bf 00 00 00 00       	mov    $0x0,%edi
+  801519:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80151c:	55                   	push   %ebp
+  80151d:	89 e5                	mov    %esp,%ebp
+  80151f:	8d 35 27 15 80 00    	lea    0x801527,%esi
+  801525:	0f 34                	sysenter
+  801527:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801528:	85 c0                	test   %eax,%eax
+  80152a:	7f 08                	jg     801534 <sys_page_alloc+0x34>
+	return syscall2(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0);
+}
+  80152c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80152f:	5b                   	pop    %ebx
+  801530:	5e                   	pop    %esi
+  801531:	5f                   	pop    %edi
+  801532:	5d                   	pop    %ebp
+  801533:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801534:	83 ec 0c             	sub    $0xc,%esp
+  801537:	50                   	push   %eax
+  801538:	6a 04                	push   $0x4
+  80153a:	68 e7 48 80 00       	push   $0x8048e7
+  80153f:	6a 3d                	push   $0x3d
+  801541:	68 04 49 80 00       	push   $0x804904
+  801546:	e8 e0 f4 ff ff       	call   800a2b <_panic>
+
+0080154b <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  80154b:	55                   	push   %ebp
+  80154c:	89 e5                	mov    %esp,%ebp
+  80154e:	57                   	push   %edi
+  80154f:	56                   	push   %esi
+  801550:	53                   	push   %ebx
+  801551:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801554:	8b 55 08             	mov    0x8(%ebp),%edx
+  801557:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80155a:	b8 05 00 00 00       	mov    $0x5,%eax
+  80155f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801562:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801565:	8b 75 18             	mov    0x18(%ebp),%esi
+  801568:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80156a:	85 c0                	test   %eax,%eax
+  80156c:	7f 08                	jg     801576 <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  80156e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801571:	5b                   	pop    %ebx
+  801572:	5e                   	pop    %esi
+  801573:	5f                   	pop    %edi
+  801574:	5d                   	pop    %ebp
+  801575:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801576:	83 ec 0c             	sub    $0xc,%esp
+  801579:	50                   	push   %eax
+  80157a:	6a 05                	push   $0x5
+  80157c:	68 e7 48 80 00       	push   $0x8048e7
+  801581:	6a 23                	push   $0x23
+  801583:	68 04 49 80 00       	push   $0x804904
+  801588:	e8 9e f4 ff ff       	call   800a2b <_panic>
+
+0080158d <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  80158d:	55                   	push   %ebp
+  80158e:	89 e5                	mov    %esp,%ebp
+  801590:	57                   	push   %edi
+  801591:	56                   	push   %esi
+  801592:	53                   	push   %ebx
+  801593:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  801596:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80159b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80159e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8015a1:	b8 06 00 00 00       	mov    $0x6,%eax
+  8015a6:	89 df                	mov    %ebx,%edi
+  8015a8:	55                   	push   %ebp
+  8015a9:	89 e5                	mov    %esp,%ebp
+  8015ab:	8d 35 b3 15 80 00    	lea    0x8015b3,%esi
+  8015b1:	0f 34                	sysenter
+  8015b3:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8015b4:	85 c0                	test   %eax,%eax
+  8015b6:	7f 08                	jg     8015c0 <sys_page_unmap+0x33>
+	return syscall2(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0);
+}
+  8015b8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8015bb:	5b                   	pop    %ebx
+  8015bc:	5e                   	pop    %esi
+  8015bd:	5f                   	pop    %edi
+  8015be:	5d                   	pop    %ebp
+  8015bf:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8015c0:	83 ec 0c             	sub    $0xc,%esp
+  8015c3:	50                   	push   %eax
+  8015c4:	6a 06                	push   $0x6
+  8015c6:	68 e7 48 80 00       	push   $0x8048e7
+  8015cb:	6a 3d                	push   $0x3d
+  8015cd:	68 04 49 80 00       	push   $0x804904
+  8015d2:	e8 54 f4 ff ff       	call   800a2b <_panic>
+
+008015d7 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  8015d7:	55                   	push   %ebp
+  8015d8:	89 e5                	mov    %esp,%ebp
+  8015da:	57                   	push   %edi
+  8015db:	56                   	push   %esi
+  8015dc:	53                   	push   %ebx
+  8015dd:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  8015e0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015e5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015e8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8015eb:	b8 08 00 00 00       	mov    $0x8,%eax
+  8015f0:	89 df                	mov    %ebx,%edi
+  8015f2:	55                   	push   %ebp
+  8015f3:	89 e5                	mov    %esp,%ebp
+  8015f5:	8d 35 fd 15 80 00    	lea    0x8015fd,%esi
+  8015fb:	0f 34                	sysenter
+  8015fd:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8015fe:	85 c0                	test   %eax,%eax
+  801600:	7f 08                	jg     80160a <sys_env_set_status+0x33>
+	return syscall2(SYS_env_set_status, 1, envid, status, 0, 0);
+}
+  801602:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801605:	5b                   	pop    %ebx
+  801606:	5e                   	pop    %esi
+  801607:	5f                   	pop    %edi
+  801608:	5d                   	pop    %ebp
+  801609:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80160a:	83 ec 0c             	sub    $0xc,%esp
+  80160d:	50                   	push   %eax
+  80160e:	6a 08                	push   $0x8
+  801610:	68 e7 48 80 00       	push   $0x8048e7
+  801615:	6a 3d                	push   $0x3d
+  801617:	68 04 49 80 00       	push   $0x804904
+  80161c:	e8 0a f4 ff ff       	call   800a2b <_panic>
+
+00801621 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  801621:	55                   	push   %ebp
+  801622:	89 e5                	mov    %esp,%ebp
+  801624:	57                   	push   %edi
+  801625:	56                   	push   %esi
+  801626:	53                   	push   %ebx
+  801627:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  80162a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80162f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801632:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801635:	b8 09 00 00 00       	mov    $0x9,%eax
+  80163a:	89 df                	mov    %ebx,%edi
+  80163c:	55                   	push   %ebp
+  80163d:	89 e5                	mov    %esp,%ebp
+  80163f:	8d 35 47 16 80 00    	lea    0x801647,%esi
+  801645:	0f 34                	sysenter
+  801647:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801648:	85 c0                	test   %eax,%eax
+  80164a:	7f 08                	jg     801654 <sys_env_set_trapframe+0x33>
+	return syscall2(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0);
+}
+  80164c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80164f:	5b                   	pop    %ebx
+  801650:	5e                   	pop    %esi
+  801651:	5f                   	pop    %edi
+  801652:	5d                   	pop    %ebp
+  801653:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801654:	83 ec 0c             	sub    $0xc,%esp
+  801657:	50                   	push   %eax
+  801658:	6a 09                	push   $0x9
+  80165a:	68 e7 48 80 00       	push   $0x8048e7
+  80165f:	6a 3d                	push   $0x3d
+  801661:	68 04 49 80 00       	push   $0x804904
+  801666:	e8 c0 f3 ff ff       	call   800a2b <_panic>
+
+0080166b <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  80166b:	55                   	push   %ebp
+  80166c:	89 e5                	mov    %esp,%ebp
+  80166e:	57                   	push   %edi
+  80166f:	56                   	push   %esi
+  801670:	53                   	push   %ebx
+  801671:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  801674:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801679:	8b 55 08             	mov    0x8(%ebp),%edx
+  80167c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80167f:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801684:	89 df                	mov    %ebx,%edi
+  801686:	55                   	push   %ebp
+  801687:	89 e5                	mov    %esp,%ebp
+  801689:	8d 35 91 16 80 00    	lea    0x801691,%esi
+  80168f:	0f 34                	sysenter
+  801691:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801692:	85 c0                	test   %eax,%eax
+  801694:	7f 08                	jg     80169e <sys_env_set_pgfault_upcall+0x33>
+	return syscall2(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0);
+}
+  801696:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801699:	5b                   	pop    %ebx
+  80169a:	5e                   	pop    %esi
+  80169b:	5f                   	pop    %edi
+  80169c:	5d                   	pop    %ebp
+  80169d:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80169e:	83 ec 0c             	sub    $0xc,%esp
+  8016a1:	50                   	push   %eax
+  8016a2:	6a 0a                	push   $0xa
+  8016a4:	68 e7 48 80 00       	push   $0x8048e7
+  8016a9:	6a 3d                	push   $0x3d
+  8016ab:	68 04 49 80 00       	push   $0x804904
+  8016b0:	e8 76 f3 ff ff       	call   800a2b <_panic>
+
+008016b5 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  8016b5:	55                   	push   %ebp
+  8016b6:	89 e5                	mov    %esp,%ebp
+  8016b8:	57                   	push   %edi
+  8016b9:	56                   	push   %esi
+  8016ba:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  8016bb:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016be:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8016c1:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8016c6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8016c9:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8016cc:	55                   	push   %ebp
+  8016cd:	89 e5                	mov    %esp,%ebp
+  8016cf:	8d 35 d7 16 80 00    	lea    0x8016d7,%esi
+  8016d5:	0f 34                	sysenter
+  8016d7:	5d                   	pop    %ebp
+	return syscall2(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm);
+}
+  8016d8:	5b                   	pop    %ebx
+  8016d9:	5e                   	pop    %esi
+  8016da:	5f                   	pop    %edi
+  8016db:	5d                   	pop    %ebp
+  8016dc:	c3                   	ret
+
+008016dd <sys_ipc_try_sendv>:
+
+int
+sys_ipc_try_sendv(envid_t envid, uint32_t value, const uintptr_t *pages, int npages)
+{
+  8016dd:	55                   	push   %ebp
+  8016de:	89 e5                	mov    %esp,%ebp
+  8016e0:	57                   	push   %edi
+  8016e1:	56                   	push   %esi
+  8016e2:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  8016e3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016e6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8016e9:	b8 17 00 00 00       	mov    $0x17,%eax
+  8016ee:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8016f1:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8016f4:	55                   	push   %ebp
+  8016f5:	89 e5                	mov    %esp,%ebp
+  8016f7:	8d 35 ff 16 80 00    	lea    0x8016ff,%esi
+  8016fd:	0f 34                	sysenter
+  8016ff:	5d                   	pop    %ebp
+	return syscall2(SYS_ipc_try_sendv, 0, envid, value, (uint32_t) pages, npages);
+}
+  801700:	5b                   	pop    %ebx
+  801701:	5e                   	pop    %esi
+  801702:	5f                   	pop    %edi
+  801703:	5d                   	pop    %ebp
+  801704:	c3                   	ret
+
+00801705 <sys_ipc_recvv>:
+	return sys_ipc_recvv(dstva, 1, 0);
+}
+
+int
+sys_ipc_recvv(void *dstva, int npages, int flags)
+{
+  801705:	55                   	push   %ebp
+  801706:	89 e5                	mov    %esp,%ebp
+  801708:	57                   	push   %edi
+  801709:	56                   	push   %esi
+  80170a:	53                   	push   %ebx
+  80170b:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  80170e:	be 00 00 00 00       	mov    $0x0,%esi
+  801713:	8b 55 08             	mov    0x8(%ebp),%edx
+  801716:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801719:	b8 0d 00 00 00       	mov    $0xd,%eax
+  80171e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801721:	89 f7                	mov    %esi,%edi
+  801723:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801725:	85 c0                	test   %eax,%eax
+  801727:	7f 08                	jg     801731 <sys_ipc_recvv+0x2c>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npages, flags, 0, 0);
+}
+  801729:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80172c:	5b                   	pop    %ebx
+  80172d:	5e                   	pop    %esi
+  80172e:	5f                   	pop    %edi
+  80172f:	5d                   	pop    %ebp
+  801730:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801731:	83 ec 0c             	sub    $0xc,%esp
+  801734:	50                   	push   %eax
+  801735:	6a 0d                	push   $0xd
+  801737:	68 e7 48 80 00       	push   $0x8048e7
+  80173c:	6a 23                	push   $0x23
+  80173e:	68 04 49 80 00       	push   $0x804904
+  801743:	e8 e3 f2 ff ff       	call   800a2b <_panic>
+
+00801748 <sys_ipc_recv>:
+{
+  801748:	55                   	push   %ebp
+  801749:	89 e5                	mov    %esp,%ebp
+  80174b:	83 ec 0c             	sub    $0xc,%esp
+	return sys_ipc_recvv(dstva, 1, 0);
+  80174e:	6a 00                	push   $0x0
+  801750:	6a 01                	push   $0x1
+  801752:	ff 75 08             	push   0x8(%ebp)
+  801755:	e8 ab ff ff ff       	call   801705 <sys_ipc_recvv>
+}
+  80175a:	c9                   	leave
+  80175b:	c3                   	ret
+
+0080175c <sys_ipc_recv_until>:
+
+int
+sys_ipc_recv_until(void *dstva, int npages, unsigned int deadline)
+{
+  80175c:	55                   	push   %ebp
+  80175d:	89 e5                	mov    %esp,%ebp
+  80175f:	57                   	push   %edi
+  801760:	56                   	push   %esi
+  801761:	53                   	push   %ebx
+  801762:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801765:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80176a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80176d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801770:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801775:	8b 7d 10             	mov    0x10(%ebp),%edi
+  801778:	89 de                	mov    %ebx,%esi
+  80177a:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80177c:	85 c0                	test   %eax,%eax
+  80177e:	7f 08                	jg     801788 <sys_ipc_recv_until+0x2c>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npages, 0, deadline, 0);
+}
+  801780:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801783:	5b                   	pop    %ebx
+  801784:	5e                   	pop    %esi
+  801785:	5f                   	pop    %edi
+  801786:	5d                   	pop    %ebp
+  801787:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801788:	83 ec 0c             	sub    $0xc,%esp
+  80178b:	50                   	push   %eax
+  80178c:	6a 0d                	push   $0xd
+  80178e:	68 e7 48 80 00       	push   $0x8048e7
+  801793:	6a 23                	push   $0x23
+  801795:	68 04 49 80 00       	push   $0x804904
+  80179a:	e8 8c f2 ff ff       	call   800a2b <_panic>
+
+0080179f <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  80179f:	55                   	push   %ebp
+  8017a0:	89 e5                	mov    %esp,%ebp
+  8017a2:	57                   	push   %edi
+  8017a3:	56                   	push   %esi
+  8017a4:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  8017a5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8017aa:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8017af:	89 d1                	mov    %edx,%ecx
+  8017b1:	89 d3                	mov    %edx,%ebx
+  8017b3:	89 d7                	mov    %edx,%edi
+  8017b5:	55                   	push   %ebp
+  8017b6:	89 e5                	mov    %esp,%ebp
+  8017b8:	8d 35 c0 17 80 00    	lea    0x8017c0,%esi
+  8017be:	0f 34                	sysenter
+  8017c0:	5d                   	pop    %ebp
+	return (unsigned int) syscall2(SYS_time_msec, 0, 0, 0, 0, 0);
+}
+  8017c1:	5b                   	pop    %ebx
+  8017c2:	5e                   	pop    %esi
+  8017c3:	5f                   	pop    %edi
+  8017c4:	5d                   	pop    %ebp
+  8017c5:	c3                   	ret
+
+008017c6 <sys_net_try_send>:
+
+size_t
+sys_net_try_send(void *packet, size_t length)
+{
+  8017c6:	55                   	push   %ebp
+  8017c7:	89 e5                	mov    %esp,%ebp
+  8017c9:	57                   	push   %edi
+  8017ca:	56                   	push   %esi
+  8017cb:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  8017cc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017d1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8017d4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8017d7:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8017dc:	89 df                	mov    %ebx,%edi
+  8017de:	55                   	push   %ebp
+  8017df:	89 e5                	mov    %esp,%ebp
+  8017e1:	8d 35 e9 17 80 00    	lea    0x8017e9,%esi
+  8017e7:	0f 34                	sysenter
+  8017e9:	5d                   	pop    %ebp
+	return syscall2(SYS_net_try_send, 0, (uint32_t) packet, length, 0, 0);
+}
+  8017ea:	5b                   	pop    %ebx
+  8017eb:	5e                   	pop    %esi
+  8017ec:	5f                   	pop    %edi
+  8017ed:	5d                   	pop    %ebp
+  8017ee:	c3                   	ret
+
+008017ef <sys_net_try_recv>:
+
+size_t
+sys_net_try_recv(uint8_t *buffer)
+{
+  8017ef:	55                   	push   %ebp
+  8017f0:	89 e5                	mov    %esp,%ebp
+  8017f2:	57                   	push   %edi
+  8017f3:	56                   	push   %esi
+  8017f4:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  8017f5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8017fa:	8b 55 08             	mov    0x8(%ebp),%edx
+  8017fd:	b8 10 00 00 00       	mov    $0x10,%eax
+  801802:	89 cb                	mov    %ecx,%ebx
+  801804:	89 cf                	mov    %ecx,%edi
+  801806:	55                   	push   %ebp
+  801807:	89 e5                	mov    %esp,%ebp
+  801809:	8d 35 11 18 80 00    	lea    0x801811,%esi
+  80180f:	0f 34                	sysenter
+  801811:	5d                   	pop    %ebp
+	return syscall2(SYS_net_try_recv, 0, (uint32_t) buffer, 0, 0, 0);
+}
+  801812:	5b                   	pop    %ebx
+  801813:	5e                   	pop    %esi
+  801814:	5f                   	pop    %edi
+  801815:	5d                   	pop    %ebp
+  801816:	c3                   	ret
+
+00801817 <sys_net_recv_pages>:
+
+int
+sys_net_recv_pages(void *dstva, int npages)
+{
+  801817:	55                   	push   %ebp
+  801818:	89 e5                	mov    %esp,%ebp
+  80181a:	57                   	push   %edi
+  80181b:	56                   	push   %esi
+  80181c:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  80181d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801822:	8b 55 08             	mov    0x8(%ebp),%edx
+  801825:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801828:	b8 12 00 00 00       	mov    $0x12,%eax
+  80182d:	89 df                	mov    %ebx,%edi
+  80182f:	55                   	push   %ebp
+  801830:	89 e5                	mov    %esp,%ebp
+  801832:	8d 35 3a 18 80 00    	lea    0x80183a,%esi
+  801838:	0f 34                	sysenter
+  80183a:	5d                   	pop    %ebp
+	return syscall2(SYS_net_recv_pages, 0, (uint32_t) dstva, npages, 0, 0);
+}
+  80183b:	5b                   	pop    %ebx
+  80183c:	5e                   	pop    %esi
+  80183d:	5f                   	pop    %edi
+  80183e:	5d                   	pop    %ebp
+  80183f:	c3                   	ret
+
+00801840 <sys_net_send_batch>:
+
+int
+sys_net_send_batch(const struct net_sg *pkts, int n)
+{
+  801840:	55                   	push   %ebp
+  801841:	89 e5                	mov    %esp,%ebp
+  801843:	57                   	push   %edi
+  801844:	56                   	push   %esi
+  801845:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  801846:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80184b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80184e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801851:	b8 14 00 00 00       	mov    $0x14,%eax
+  801856:	89 df                	mov    %ebx,%edi
+  801858:	55                   	push   %ebp
+  801859:	89 e5                	mov    %esp,%ebp
+  80185b:	8d 35 63 18 80 00    	lea    0x801863,%esi
+  801861:	0f 34                	sysenter
+  801863:	5d                   	pop    %ebp
+	return syscall2(SYS_net_send_batch, 0, (uint32_t) pkts, n, 0, 0);
+}
+  801864:	5b                   	pop    %ebx
+  801865:	5e                   	pop    %esi
+  801866:	5f                   	pop    %edi
+  801867:	5d                   	pop    %ebp
+  801868:	c3                   	ret
+
+00801869 <sys_net_send_sg>:
+
+int
+sys_net_send_sg(const struct net_sg *sg, int nsg,
+		const struct net_offload *off, struct net_txinfo *info)
+{
+  801869:	55                   	push   %ebp
+  80186a:	89 e5                	mov    %esp,%ebp
+  80186c:	57                   	push   %edi
+  80186d:	56                   	push   %esi
+  80186e:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  80186f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801872:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801875:	b8 13 00 00 00       	mov    $0x13,%eax
+  80187a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80187d:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801880:	55                   	push   %ebp
+  801881:	89 e5                	mov    %esp,%ebp
+  801883:	8d 35 8b 18 80 00    	lea    0x80188b,%esi
+  801889:	0f 34                	sysenter
+  80188b:	5d                   	pop    %ebp
+	return syscall2(SYS_net_send_sg, 0, (uint32_t) sg, nsg, (uint32_t) off,
+			(uint32_t) info);
+}
+  80188c:	5b                   	pop    %ebx
+  80188d:	5e                   	pop    %esi
+  80188e:	5f                   	pop    %edi
+  80188f:	5d                   	pop    %ebp
+  801890:	c3                   	ret
+
+00801891 <sys_net_wait>:
+
+int
+sys_net_wait(uint32_t events)
+{
+  801891:	55                   	push   %ebp
+  801892:	89 e5                	mov    %esp,%ebp
+  801894:	57                   	push   %edi
+  801895:	56                   	push   %esi
+  801896:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801897:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80189c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80189f:	b8 11 00 00 00       	mov    $0x11,%eax
+  8018a4:	89 cb                	mov    %ecx,%ebx
+  8018a6:	89 cf                	mov    %ecx,%edi
+  8018a8:	89 ce                	mov    %ecx,%esi
+  8018aa:	cd 30                	int    $0x30
+	// Blocks, so it has to go through the trap gate.
+	return syscall(SYS_net_wait, 0, events, 0, 0, 0, 0);
+}
+  8018ac:	5b                   	pop    %ebx
+  8018ad:	5e                   	pop    %esi
+  8018ae:	5f                   	pop    %edi
+  8018af:	5d                   	pop    %ebp
+  8018b0:	c3                   	ret
+
+008018b1 <sys_net_map>:
+
+int
+sys_net_map(void *va)
+{
+  8018b1:	55                   	push   %ebp
+  8018b2:	89 e5                	mov    %esp,%ebp
+  8018b4:	57                   	push   %edi
+  8018b5:	56                   	push   %esi
+  8018b6:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  8018b7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8018bc:	8b 55 08             	mov    0x8(%ebp),%edx
+  8018bf:	b8 15 00 00 00       	mov    $0x15,%eax
+  8018c4:	89 cb                	mov    %ecx,%ebx
+  8018c6:	89 cf                	mov    %ecx,%edi
+  8018c8:	55                   	push   %ebp
+  8018c9:	89 e5                	mov    %esp,%ebp
+  8018cb:	8d 35 d3 18 80 00    	lea    0x8018d3,%esi
+  8018d1:	0f 34                	sysenter
+  8018d3:	5d                   	pop    %ebp
+	return syscall2(SYS_net_map, 0, (uint32_t) va, 0, 0, 0);
+}
+  8018d4:	5b                   	pop    %ebx
+  8018d5:	5e                   	pop    %esi
+  8018d6:	5f                   	pop    %edi
+  8018d7:	5d                   	pop    %ebp
+  8018d8:	c3                   	ret
+
+008018d9 <sys_net_sync>:
+
+int
+sys_net_sync(uint32_t rings)
+{
+  8018d9:	55                   	push   %ebp
+  8018da:	89 e5                	mov    %esp,%ebp
+  8018dc:	57                   	push   %edi
+  8018dd:	56                   	push   %esi
+  8018de:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  8018df:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8018e4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8018e7:	b8 16 00 00 00       	mov    $0x16,%eax
+  8018ec:	89 cb                	mov    %ecx,%ebx
+  8018ee:	89 cf                	mov    %ecx,%edi
+  8018f0:	55                   	push   %ebp
+  8018f1:	89 e5                	mov    %esp,%ebp
+  8018f3:	8d 35 fb 18 80 00    	lea    0x8018fb,%esi
+  8018f9:	0f 34                	sysenter
+  8018fb:	5d                   	pop    %ebp
+	return syscall2(SYS_net_sync, 0, rings, 0, 0, 0);
+}
+  8018fc:	5b                   	pop    %ebx
+  8018fd:	5e                   	pop    %esi
+  8018fe:	5f                   	pop    %edi
+  8018ff:	5d                   	pop    %ebp
+  801900:	c3                   	ret
+
+00801901 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  801901:	55                   	push   %ebp
+  801902:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801904:	8b 45 08             	mov    0x8(%ebp),%eax
+  801907:	05 00 00 00 30       	add    $0x30000000,%eax
+  80190c:	c1 e8 0c             	shr    $0xc,%eax
+}
+  80190f:	5d                   	pop    %ebp
+  801910:	c3                   	ret
+
+00801911 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  801911:	55                   	push   %ebp
+  801912:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801914:	8b 45 08             	mov    0x8(%ebp),%eax
+  801917:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  80191c:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801921:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  801926:	5d                   	pop    %ebp
+  801927:	c3                   	ret
+
+00801928 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  801928:	55                   	push   %ebp
+  801929:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  80192b:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  801930:	eb 02                	jmp    801934 <fd_alloc+0xc>
+  801932:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  801934:	89 c2                	mov    %eax,%edx
+  801936:	c1 ea 16             	shr    $0x16,%edx
+  801939:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801940:	f6 c2 01             	test   $0x1,%dl
+  801943:	74 2b                	je     801970 <fd_alloc+0x48>
+  801945:	89 c2                	mov    %eax,%edx
+  801947:	c1 ea 0c             	shr    $0xc,%edx
+  80194a:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  801951:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  801957:	f6 c1 01             	test   $0x1,%cl
+  80195a:	74 14                	je     801970 <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  80195c:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  801962:	75 ce                	jne    801932 <fd_alloc+0xa>
+  801964:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  801969:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  80196e:	eb 05                	jmp    801975 <fd_alloc+0x4d>
+			return 0;
+  801970:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  801975:	8b 55 08             	mov    0x8(%ebp),%edx
+  801978:	89 02                	mov    %eax,(%edx)
+}
+  80197a:	89 c8                	mov    %ecx,%eax
+  80197c:	5d                   	pop    %ebp
+  80197d:	c3                   	ret
+
+0080197e <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  80197e:	55                   	push   %ebp
+  80197f:	89 e5                	mov    %esp,%ebp
+  801981:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  801984:	83 f8 1f             	cmp    $0x1f,%eax
+  801987:	77 30                	ja     8019b9 <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  801989:	c1 e0 0c             	shl    $0xc,%eax
+  80198c:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  801991:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  801997:	f6 c2 01             	test   $0x1,%dl
+  80199a:	74 24                	je     8019c0 <fd_lookup+0x42>
+  80199c:	89 c2                	mov    %eax,%edx
+  80199e:	c1 ea 0c             	shr    $0xc,%edx
+  8019a1:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8019a8:	f6 c2 01             	test   $0x1,%dl
+  8019ab:	74 1a                	je     8019c7 <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  8019ad:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8019b0:	89 02                	mov    %eax,(%edx)
+	return 0;
+  8019b2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8019b7:	5d                   	pop    %ebp
+  8019b8:	c3                   	ret
+		return -E_INVAL;
+  8019b9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8019be:	eb f7                	jmp    8019b7 <fd_lookup+0x39>
+		return -E_INVAL;
+  8019c0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8019c5:	eb f0                	jmp    8019b7 <fd_lookup+0x39>
+  8019c7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8019cc:	eb e9                	jmp    8019b7 <fd_lookup+0x39>
+
+008019ce <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  8019ce:	55                   	push   %ebp
+  8019cf:	89 e5                	mov    %esp,%ebp
+  8019d1:	53                   	push   %ebx
+  8019d2:	83 ec 04             	sub    $0x4,%esp
+  8019d5:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  8019d8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019dd:	eb 03                	jmp    8019e2 <dev_lookup+0x14>
+  8019df:	83 c0 01             	add    $0x1,%eax
+  8019e2:	8b 1c 85 90 49 80 00 	mov    0x804990(,%eax,4),%ebx
+  8019e9:	85 db                	test   %ebx,%ebx
+  8019eb:	74 0b                	je     8019f8 <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  8019ed:	39 13                	cmp    %edx,(%ebx)
+  8019ef:	75 ee                	jne    8019df <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  8019f1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019f6:	eb 1f                	jmp    801a17 <dev_lookup+0x49>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8019f8:	a1 30 db 82 00       	mov    0x82db30,%eax
+  8019fd:	8b 40 48             	mov    0x48(%eax),%eax
+  801a00:	83 ec 04             	sub    $0x4,%esp
+  801a03:	52                   	push   %edx
+  801a04:	50                   	push   %eax
+  801a05:	68 14 49 80 00       	push   $0x804914
+  801a0a:	e8 f7 f0 ff ff       	call   800b06 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  801a0f:	83 c4 10             	add    $0x10,%esp
+  801a12:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  801a17:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801a1a:	89 1a                	mov    %ebx,(%edx)
+}
+  801a1c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801a1f:	c9                   	leave
+  801a20:	c3                   	ret
+
+00801a21 <fd_close>:
+{
+  801a21:	55                   	push   %ebp
+  801a22:	89 e5                	mov    %esp,%ebp
+  801a24:	57                   	push   %edi
+  801a25:	56                   	push   %esi
+  801a26:	53                   	push   %ebx
+  801a27:	83 ec 24             	sub    $0x24,%esp
+  801a2a:	8b 75 08             	mov    0x8(%ebp),%esi
+  801a2d:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801a30:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801a33:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801a34:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  801a3a:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801a3d:	50                   	push   %eax
+  801a3e:	e8 3b ff ff ff       	call   80197e <fd_lookup>
+  801a43:	89 c3                	mov    %eax,%ebx
+  801a45:	83 c4 10             	add    $0x10,%esp
+  801a48:	85 c0                	test   %eax,%eax
+  801a4a:	78 05                	js     801a51 <fd_close+0x30>
+	    || fd != fd2)
+  801a4c:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801a4f:	74 16                	je     801a67 <fd_close+0x46>
+		return (must_exist ? r : 0);
+  801a51:	89 f8                	mov    %edi,%eax
+  801a53:	84 c0                	test   %al,%al
+  801a55:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a5a:	0f 44 d8             	cmove  %eax,%ebx
+}
+  801a5d:	89 d8                	mov    %ebx,%eax
+  801a5f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801a62:	5b                   	pop    %ebx
+  801a63:	5e                   	pop    %esi
+  801a64:	5f                   	pop    %edi
+  801a65:	5d                   	pop    %ebp
+  801a66:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801a67:	83 ec 08             	sub    $0x8,%esp
+  801a6a:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801a6d:	50                   	push   %eax
+  801a6e:	ff 36                	push   (%esi)
+  801a70:	e8 59 ff ff ff       	call   8019ce <dev_lookup>
+  801a75:	89 c3                	mov    %eax,%ebx
+  801a77:	83 c4 10             	add    $0x10,%esp
+  801a7a:	85 c0                	test   %eax,%eax
+  801a7c:	78 1a                	js     801a98 <fd_close+0x77>
+		if (dev->dev_close)
+  801a7e:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801a81:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  801a84:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  801a89:	85 c0                	test   %eax,%eax
+  801a8b:	74 0b                	je     801a98 <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  801a8d:	83 ec 0c             	sub    $0xc,%esp
+  801a90:	56                   	push   %esi
+  801a91:	ff d0                	call   *%eax
+  801a93:	89 c3                	mov    %eax,%ebx
+  801a95:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  801a98:	83 ec 08             	sub    $0x8,%esp
+  801a9b:	56                   	push   %esi
+  801a9c:	6a 00                	push   $0x0
+  801a9e:	e8 ea fa ff ff       	call   80158d <sys_page_unmap>
+	return r;
+  801aa3:	83 c4 10             	add    $0x10,%esp
+  801aa6:	eb b5                	jmp    801a5d <fd_close+0x3c>
+
+00801aa8 <close>:
+
+int
+close(int fdnum)
+{
+  801aa8:	55                   	push   %ebp
+  801aa9:	89 e5                	mov    %esp,%ebp
+  801aab:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801aae:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801ab1:	50                   	push   %eax
+  801ab2:	ff 75 08             	push   0x8(%ebp)
+  801ab5:	e8 c4 fe ff ff       	call   80197e <fd_lookup>
+  801aba:	83 c4 10             	add    $0x10,%esp
+  801abd:	85 c0                	test   %eax,%eax
+  801abf:	79 02                	jns    801ac3 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  801ac1:	c9                   	leave
+  801ac2:	c3                   	ret
+		return fd_close(fd, 1);
+  801ac3:	83 ec 08             	sub    $0x8,%esp
+  801ac6:	6a 01                	push   $0x1
+  801ac8:	ff 75 f4             	push   -0xc(%ebp)
+  801acb:	e8 51 ff ff ff       	call   801a21 <fd_close>
+  801ad0:	83 c4 10             	add    $0x10,%esp
+  801ad3:	eb ec                	jmp    801ac1 <close+0x19>
+
+00801ad5 <close_all>:
+
+void
+close_all(void)
+{
+  801ad5:	55                   	push   %ebp
+  801ad6:	89 e5                	mov    %esp,%ebp
+  801ad8:	53                   	push   %ebx
+  801ad9:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  801adc:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  801ae1:	83 ec 0c             	sub    $0xc,%esp
+  801ae4:	53                   	push   %ebx
+  801ae5:	e8 be ff ff ff       	call   801aa8 <close>
+	for (i = 0; i < MAXFD; i++)
+  801aea:	83 c3 01             	add    $0x1,%ebx
+  801aed:	83 c4 10             	add    $0x10,%esp
+  801af0:	83 fb 20             	cmp    $0x20,%ebx
+  801af3:	75 ec                	jne    801ae1 <close_all+0xc>
+}
+  801af5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801af8:	c9                   	leave
+  801af9:	c3                   	ret
+
+00801afa <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  801afa:	55                   	push   %ebp
+  801afb:	89 e5                	mov    %esp,%ebp
+  801afd:	57                   	push   %edi
+  801afe:	56                   	push   %esi
+  801aff:	53                   	push   %ebx
+  801b00:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  801b03:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801b06:	50                   	push   %eax
+  801b07:	ff 75 08             	push   0x8(%ebp)
+  801b0a:	e8 6f fe ff ff       	call   80197e <fd_lookup>
+  801b0f:	89 c3                	mov    %eax,%ebx
+  801b11:	83 c4 10             	add    $0x10,%esp
+  801b14:	85 c0                	test   %eax,%eax
+  801b16:	78 7f                	js     801b97 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  801b18:	83 ec 0c             	sub    $0xc,%esp
+  801b1b:	ff 75 0c             	push   0xc(%ebp)
+  801b1e:	e8 85 ff ff ff       	call   801aa8 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  801b23:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801b26:	c1 e6 0c             	shl    $0xc,%esi
+  801b29:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  801b2f:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801b32:	89 3c 24             	mov    %edi,(%esp)
+  801b35:	e8 d7 fd ff ff       	call   801911 <fd2data>
+  801b3a:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  801b3c:	89 34 24             	mov    %esi,(%esp)
+  801b3f:	e8 cd fd ff ff       	call   801911 <fd2data>
+  801b44:	83 c4 10             	add    $0x10,%esp
+  801b47:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  801b4a:	89 d8                	mov    %ebx,%eax
+  801b4c:	c1 e8 16             	shr    $0x16,%eax
+  801b4f:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801b56:	a8 01                	test   $0x1,%al
+  801b58:	74 11                	je     801b6b <dup+0x71>
+  801b5a:	89 d8                	mov    %ebx,%eax
+  801b5c:	c1 e8 0c             	shr    $0xc,%eax
+  801b5f:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801b66:	f6 c2 01             	test   $0x1,%dl
+  801b69:	75 36                	jne    801ba1 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  801b6b:	89 f8                	mov    %edi,%eax
+  801b6d:	c1 e8 0c             	shr    $0xc,%eax
+  801b70:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801b77:	83 ec 0c             	sub    $0xc,%esp
+  801b7a:	25 07 0e 00 00       	and    $0xe07,%eax
+  801b7f:	50                   	push   %eax
+  801b80:	56                   	push   %esi
+  801b81:	6a 00                	push   $0x0
+  801b83:	57                   	push   %edi
+  801b84:	6a 00                	push   $0x0
+  801b86:	e8 c0 f9 ff ff       	call   80154b <sys_page_map>
+  801b8b:	89 c3                	mov    %eax,%ebx
+  801b8d:	83 c4 20             	add    $0x20,%esp
+  801b90:	85 c0                	test   %eax,%eax
+  801b92:	78 33                	js     801bc7 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  801b94:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  801b97:	89 d8                	mov    %ebx,%eax
+  801b99:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801b9c:	5b                   	pop    %ebx
+  801b9d:	5e                   	pop    %esi
+  801b9e:	5f                   	pop    %edi
+  801b9f:	5d                   	pop    %ebp
+  801ba0:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  801ba1:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801ba8:	83 ec 0c             	sub    $0xc,%esp
+  801bab:	25 07 0e 00 00       	and    $0xe07,%eax
+  801bb0:	50                   	push   %eax
+  801bb1:	ff 75 d4             	push   -0x2c(%ebp)
+  801bb4:	6a 00                	push   $0x0
+  801bb6:	53                   	push   %ebx
+  801bb7:	6a 00                	push   $0x0
+  801bb9:	e8 8d f9 ff ff       	call   80154b <sys_page_map>
+  801bbe:	89 c3                	mov    %eax,%ebx
+  801bc0:	83 c4 20             	add    $0x20,%esp
+  801bc3:	85 c0                	test   %eax,%eax
+  801bc5:	79 a4                	jns    801b6b <dup+0x71>
+	sys_page_unmap(0, newfd);
+  801bc7:	83 ec 08             	sub    $0x8,%esp
+  801bca:	56                   	push   %esi
+  801bcb:	6a 00                	push   $0x0
+  801bcd:	e8 bb f9 ff ff       	call   80158d <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  801bd2:	83 c4 08             	add    $0x8,%esp
+  801bd5:	ff 75 d4             	push   -0x2c(%ebp)
+  801bd8:	6a 00                	push   $0x0
+  801bda:	e8 ae f9 ff ff       	call   80158d <sys_page_unmap>
+	return r;
+  801bdf:	83 c4 10             	add    $0x10,%esp
+  801be2:	eb b3                	jmp    801b97 <dup+0x9d>
+
+00801be4 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  801be4:	55                   	push   %ebp
+  801be5:	89 e5                	mov    %esp,%ebp
+  801be7:	56                   	push   %esi
+  801be8:	53                   	push   %ebx
+  801be9:	83 ec 18             	sub    $0x18,%esp
+  801bec:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801bef:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801bf2:	50                   	push   %eax
+  801bf3:	56                   	push   %esi
+  801bf4:	e8 85 fd ff ff       	call   80197e <fd_lookup>
+  801bf9:	83 c4 10             	add    $0x10,%esp
+  801bfc:	85 c0                	test   %eax,%eax
+  801bfe:	78 3c                	js     801c3c <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801c00:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  801c03:	83 ec 08             	sub    $0x8,%esp
+  801c06:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801c09:	50                   	push   %eax
+  801c0a:	ff 33                	push   (%ebx)
+  801c0c:	e8 bd fd ff ff       	call   8019ce <dev_lookup>
+  801c11:	83 c4 10             	add    $0x10,%esp
+  801c14:	85 c0                	test   %eax,%eax
+  801c16:	78 24                	js     801c3c <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801c18:	8b 43 08             	mov    0x8(%ebx),%eax
+  801c1b:	83 e0 03             	and    $0x3,%eax
+  801c1e:	83 f8 01             	cmp    $0x1,%eax
+  801c21:	74 20                	je     801c43 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  801c23:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801c26:	8b 40 08             	mov    0x8(%eax),%eax
+  801c29:	85 c0                	test   %eax,%eax
+  801c2b:	74 37                	je     801c64 <read+0x80>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  801c2d:	83 ec 04             	sub    $0x4,%esp
+  801c30:	ff 75 10             	push   0x10(%ebp)
+  801c33:	ff 75 0c             	push   0xc(%ebp)
+  801c36:	53                   	push   %ebx
+  801c37:	ff d0                	call   *%eax
+  801c39:	83 c4 10             	add    $0x10,%esp
+}
+  801c3c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801c3f:	5b                   	pop    %ebx
+  801c40:	5e                   	pop    %esi
+  801c41:	5d                   	pop    %ebp
+  801c42:	c3                   	ret
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801c43:	a1 30 db 82 00       	mov    0x82db30,%eax
+  801c48:	8b 40 48             	mov    0x48(%eax),%eax
+  801c4b:	83 ec 04             	sub    $0x4,%esp
+  801c4e:	56                   	push   %esi
+  801c4f:	50                   	push   %eax
+  801c50:	68 55 49 80 00       	push   $0x804955
+  801c55:	e8 ac ee ff ff       	call   800b06 <cprintf>
+		return -E_INVAL;
+  801c5a:	83 c4 10             	add    $0x10,%esp
+  801c5d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801c62:	eb d8                	jmp    801c3c <read+0x58>
+		return -E_NOT_SUPP;
+  801c64:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801c69:	eb d1                	jmp    801c3c <read+0x58>
+
+00801c6b <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  801c6b:	55                   	push   %ebp
+  801c6c:	89 e5                	mov    %esp,%ebp
+  801c6e:	57                   	push   %edi
+  801c6f:	56                   	push   %esi
+  801c70:	53                   	push   %ebx
+  801c71:	83 ec 0c             	sub    $0xc,%esp
+  801c74:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801c77:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  801c7a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801c7f:	eb 02                	jmp    801c83 <readn+0x18>
+  801c81:	01 c3                	add    %eax,%ebx
+  801c83:	39 f3                	cmp    %esi,%ebx
+  801c85:	73 21                	jae    801ca8 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801c87:	83 ec 04             	sub    $0x4,%esp
+  801c8a:	89 f0                	mov    %esi,%eax
+  801c8c:	29 d8                	sub    %ebx,%eax
+  801c8e:	50                   	push   %eax
+  801c8f:	89 d8                	mov    %ebx,%eax
+  801c91:	03 45 0c             	add    0xc(%ebp),%eax
+  801c94:	50                   	push   %eax
+  801c95:	57                   	push   %edi
+  801c96:	e8 49 ff ff ff       	call   801be4 <read>
+		if (m < 0)
+  801c9b:	83 c4 10             	add    $0x10,%esp
+  801c9e:	85 c0                	test   %eax,%eax
+  801ca0:	78 04                	js     801ca6 <readn+0x3b>
+			return m;
+		if (m == 0)
+  801ca2:	75 dd                	jne    801c81 <readn+0x16>
+  801ca4:	eb 02                	jmp    801ca8 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801ca6:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  801ca8:	89 d8                	mov    %ebx,%eax
+  801caa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801cad:	5b                   	pop    %ebx
+  801cae:	5e                   	pop    %esi
+  801caf:	5f                   	pop    %edi
+  801cb0:	5d                   	pop    %ebp
+  801cb1:	c3                   	ret
+
+00801cb2 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  801cb2:	55                   	push   %ebp
+  801cb3:	89 e5                	mov    %esp,%ebp
+  801cb5:	56                   	push   %esi
+  801cb6:	53                   	push   %ebx
+  801cb7:	83 ec 18             	sub    $0x18,%esp
+  801cba:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801cbd:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801cc0:	50                   	push   %eax
+  801cc1:	53                   	push   %ebx
+  801cc2:	e8 b7 fc ff ff       	call   80197e <fd_lookup>
+  801cc7:	83 c4 10             	add    $0x10,%esp
+  801cca:	85 c0                	test   %eax,%eax
+  801ccc:	78 37                	js     801d05 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801cce:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801cd1:	83 ec 08             	sub    $0x8,%esp
+  801cd4:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801cd7:	50                   	push   %eax
+  801cd8:	ff 36                	push   (%esi)
+  801cda:	e8 ef fc ff ff       	call   8019ce <dev_lookup>
+  801cdf:	83 c4 10             	add    $0x10,%esp
+  801ce2:	85 c0                	test   %eax,%eax
+  801ce4:	78 1f                	js     801d05 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801ce6:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801cea:	74 20                	je     801d0c <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  801cec:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801cef:	8b 40 0c             	mov    0xc(%eax),%eax
+  801cf2:	85 c0                	test   %eax,%eax
+  801cf4:	74 37                	je     801d2d <write+0x7b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  801cf6:	83 ec 04             	sub    $0x4,%esp
+  801cf9:	ff 75 10             	push   0x10(%ebp)
+  801cfc:	ff 75 0c             	push   0xc(%ebp)
+  801cff:	56                   	push   %esi
+  801d00:	ff d0                	call   *%eax
+  801d02:	83 c4 10             	add    $0x10,%esp
+}
+  801d05:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801d08:	5b                   	pop    %ebx
+  801d09:	5e                   	pop    %esi
+  801d0a:	5d                   	pop    %ebp
+  801d0b:	c3                   	ret
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801d0c:	a1 30 db 82 00       	mov    0x82db30,%eax
+  801d11:	8b 40 48             	mov    0x48(%eax),%eax
+  801d14:	83 ec 04             	sub    $0x4,%esp
+  801d17:	53                   	push   %ebx
+  801d18:	50                   	push   %eax
+  801d19:	68 71 49 80 00       	push   $0x804971
+  801d1e:	e8 e3 ed ff ff       	call   800b06 <cprintf>
+		return -E_INVAL;
+  801d23:	83 c4 10             	add    $0x10,%esp
+  801d26:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801d2b:	eb d8                	jmp    801d05 <write+0x53>
+		return -E_NOT_SUPP;
+  801d2d:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801d32:	eb d1                	jmp    801d05 <write+0x53>
+
+00801d34 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  801d34:	55                   	push   %ebp
+  801d35:	89 e5                	mov    %esp,%ebp
+  801d37:	53                   	push   %ebx
+  801d38:	83 ec 1c             	sub    $0x1c,%esp
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801d3b:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801d3e:	50                   	push   %eax
+  801d3f:	ff 75 08             	push   0x8(%ebp)
+  801d42:	e8 37 fc ff ff       	call   80197e <fd_lookup>
+  801d47:	83 c4 10             	add    $0x10,%esp
+  801d4a:	85 c0                	test   %eax,%eax
+  801d4c:	78 3a                	js     801d88 <seek+0x54>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801d4e:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  801d51:	83 ec 08             	sub    $0x8,%esp
+  801d54:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801d57:	50                   	push   %eax
+  801d58:	ff 33                	push   (%ebx)
+  801d5a:	e8 6f fc ff ff       	call   8019ce <dev_lookup>
+  801d5f:	83 c4 10             	add    $0x10,%esp
+  801d62:	85 c0                	test   %eax,%eax
+  801d64:	78 22                	js     801d88 <seek+0x54>
+		return r;
+	// Anything buffered for the old position goes out first.
+	if (dev->dev_sync && (r = (*dev->dev_sync)(fd)) < 0)
+  801d66:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801d69:	8b 40 1c             	mov    0x1c(%eax),%eax
+  801d6c:	85 c0                	test   %eax,%eax
+  801d6e:	74 0d                	je     801d7d <seek+0x49>
+  801d70:	83 ec 0c             	sub    $0xc,%esp
+  801d73:	53                   	push   %ebx
+  801d74:	ff d0                	call   *%eax
+  801d76:	83 c4 10             	add    $0x10,%esp
+  801d79:	85 c0                	test   %eax,%eax
+  801d7b:	78 0b                	js     801d88 <seek+0x54>
+		return r;
+	fd->fd_offset = offset;
+  801d7d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801d80:	89 43 04             	mov    %eax,0x4(%ebx)
+	return 0;
+  801d83:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801d88:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801d8b:	c9                   	leave
+  801d8c:	c3                   	ret
+
+00801d8d <fsync>:
+
+// Push out anything the library has buffered for fdnum.
+int
+fsync(int fdnum)
+{
+  801d8d:	55                   	push   %ebp
+  801d8e:	89 e5                	mov    %esp,%ebp
+  801d90:	53                   	push   %ebx
+  801d91:	83 ec 1c             	sub    $0x1c,%esp
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801d94:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801d97:	50                   	push   %eax
+  801d98:	ff 75 08             	push   0x8(%ebp)
+  801d9b:	e8 de fb ff ff       	call   80197e <fd_lookup>
+  801da0:	83 c4 10             	add    $0x10,%esp
+  801da3:	85 c0                	test   %eax,%eax
+  801da5:	78 2b                	js     801dd2 <fsync+0x45>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801da7:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  801daa:	83 ec 08             	sub    $0x8,%esp
+  801dad:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801db0:	50                   	push   %eax
+  801db1:	ff 33                	push   (%ebx)
+  801db3:	e8 16 fc ff ff       	call   8019ce <dev_lookup>
+  801db8:	83 c4 10             	add    $0x10,%esp
+  801dbb:	85 c0                	test   %eax,%eax
+  801dbd:	78 13                	js     801dd2 <fsync+0x45>
+		return r;
+	if (!dev->dev_sync)
+  801dbf:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801dc2:	8b 40 1c             	mov    0x1c(%eax),%eax
+  801dc5:	85 c0                	test   %eax,%eax
+  801dc7:	74 0e                	je     801dd7 <fsync+0x4a>
+		return 0;
+	return (*dev->dev_sync)(fd);
+  801dc9:	83 ec 0c             	sub    $0xc,%esp
+  801dcc:	53                   	push   %ebx
+  801dcd:	ff d0                	call   *%eax
+  801dcf:	83 c4 10             	add    $0x10,%esp
+}
+  801dd2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801dd5:	c9                   	leave
+  801dd6:	c3                   	ret
+		return 0;
+  801dd7:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ddc:	eb f4                	jmp    801dd2 <fsync+0x45>
+
+00801dde <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  801dde:	55                   	push   %ebp
+  801ddf:	89 e5                	mov    %esp,%ebp
+  801de1:	56                   	push   %esi
+  801de2:	53                   	push   %ebx
+  801de3:	83 ec 18             	sub    $0x18,%esp
+  801de6:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801de9:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801dec:	50                   	push   %eax
+  801ded:	53                   	push   %ebx
+  801dee:	e8 8b fb ff ff       	call   80197e <fd_lookup>
+  801df3:	83 c4 10             	add    $0x10,%esp
+  801df6:	85 c0                	test   %eax,%eax
+  801df8:	78 34                	js     801e2e <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801dfa:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801dfd:	83 ec 08             	sub    $0x8,%esp
+  801e00:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801e03:	50                   	push   %eax
+  801e04:	ff 36                	push   (%esi)
+  801e06:	e8 c3 fb ff ff       	call   8019ce <dev_lookup>
+  801e0b:	83 c4 10             	add    $0x10,%esp
+  801e0e:	85 c0                	test   %eax,%eax
+  801e10:	78 1c                	js     801e2e <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801e12:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801e16:	74 1d                	je     801e35 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  801e18:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801e1b:	8b 40 18             	mov    0x18(%eax),%eax
+  801e1e:	85 c0                	test   %eax,%eax
+  801e20:	74 34                	je     801e56 <ftruncate+0x78>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  801e22:	83 ec 08             	sub    $0x8,%esp
+  801e25:	ff 75 0c             	push   0xc(%ebp)
+  801e28:	56                   	push   %esi
+  801e29:	ff d0                	call   *%eax
+  801e2b:	83 c4 10             	add    $0x10,%esp
+}
+  801e2e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801e31:	5b                   	pop    %ebx
+  801e32:	5e                   	pop    %esi
+  801e33:	5d                   	pop    %ebp
+  801e34:	c3                   	ret
+			thisenv->env_id, fdnum);
+  801e35:	a1 30 db 82 00       	mov    0x82db30,%eax
+  801e3a:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801e3d:	83 ec 04             	sub    $0x4,%esp
+  801e40:	53                   	push   %ebx
+  801e41:	50                   	push   %eax
+  801e42:	68 34 49 80 00       	push   $0x804934
+  801e47:	e8 ba ec ff ff       	call   800b06 <cprintf>
+		return -E_INVAL;
+  801e4c:	83 c4 10             	add    $0x10,%esp
+  801e4f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801e54:	eb d8                	jmp    801e2e <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  801e56:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801e5b:	eb d1                	jmp    801e2e <ftruncate+0x50>
+
+00801e5d <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  801e5d:	55                   	push   %ebp
+  801e5e:	89 e5                	mov    %esp,%ebp
+  801e60:	56                   	push   %esi
+  801e61:	53                   	push   %ebx
+  801e62:	83 ec 18             	sub    $0x18,%esp
+  801e65:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801e68:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801e6b:	50                   	push   %eax
+  801e6c:	ff 75 08             	push   0x8(%ebp)
+  801e6f:	e8 0a fb ff ff       	call   80197e <fd_lookup>
+  801e74:	83 c4 10             	add    $0x10,%esp
+  801e77:	85 c0                	test   %eax,%eax
+  801e79:	78 49                	js     801ec4 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801e7b:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801e7e:	83 ec 08             	sub    $0x8,%esp
+  801e81:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801e84:	50                   	push   %eax
+  801e85:	ff 36                	push   (%esi)
+  801e87:	e8 42 fb ff ff       	call   8019ce <dev_lookup>
+  801e8c:	83 c4 10             	add    $0x10,%esp
+  801e8f:	85 c0                	test   %eax,%eax
+  801e91:	78 31                	js     801ec4 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  801e93:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801e96:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  801e9a:	74 2f                	je     801ecb <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  801e9c:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  801e9f:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801ea6:	00 00 00 
+	stat->st_isdir = 0;
+  801ea9:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801eb0:	00 00 00 
+	stat->st_dev = dev;
+  801eb3:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  801eb9:	83 ec 08             	sub    $0x8,%esp
+  801ebc:	53                   	push   %ebx
+  801ebd:	56                   	push   %esi
+  801ebe:	ff 50 14             	call   *0x14(%eax)
+  801ec1:	83 c4 10             	add    $0x10,%esp
+}
+  801ec4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801ec7:	5b                   	pop    %ebx
+  801ec8:	5e                   	pop    %esi
+  801ec9:	5d                   	pop    %ebp
+  801eca:	c3                   	ret
+		return -E_NOT_SUPP;
+  801ecb:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801ed0:	eb f2                	jmp    801ec4 <fstat+0x67>
+
+00801ed2 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  801ed2:	55                   	push   %ebp
+  801ed3:	89 e5                	mov    %esp,%ebp
+  801ed5:	56                   	push   %esi
+  801ed6:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY | O_NOBUF)) < 0)
+  801ed7:	83 ec 08             	sub    $0x8,%esp
+  801eda:	68 00 10 00 00       	push   $0x1000
+  801edf:	ff 75 08             	push   0x8(%ebp)
+  801ee2:	e8 b3 07 00 00       	call   80269a <open>
+  801ee7:	89 c3                	mov    %eax,%ebx
+  801ee9:	83 c4 10             	add    $0x10,%esp
+  801eec:	85 c0                	test   %eax,%eax
+  801eee:	78 1b                	js     801f0b <stat+0x39>
+		return fd;
+	r = fstat(fd, stat);
+  801ef0:	83 ec 08             	sub    $0x8,%esp
+  801ef3:	ff 75 0c             	push   0xc(%ebp)
+  801ef6:	50                   	push   %eax
+  801ef7:	e8 61 ff ff ff       	call   801e5d <fstat>
+  801efc:	89 c6                	mov    %eax,%esi
+	close(fd);
+  801efe:	89 1c 24             	mov    %ebx,(%esp)
+  801f01:	e8 a2 fb ff ff       	call   801aa8 <close>
+	return r;
+  801f06:	83 c4 10             	add    $0x10,%esp
+  801f09:	89 f3                	mov    %esi,%ebx
+}
+  801f0b:	89 d8                	mov    %ebx,%eax
+  801f0d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801f10:	5b                   	pop    %ebx
+  801f11:	5e                   	pop    %esi
+  801f12:	5d                   	pop    %ebp
+  801f13:	c3                   	ret
+
+00801f14 <fsipc_pages>:
+// need not be copied through fsipcbuf.  n must fit in FSBULK_MAXPAGES
+// pages.
+// Returns result from the file server.
+static int
+fsipc_pages(unsigned type, const void *buf, size_t n, int perm)
+{
+  801f14:	55                   	push   %ebp
+  801f15:	89 e5                	mov    %esp,%ebp
+  801f17:	57                   	push   %edi
+  801f18:	56                   	push   %esi
+  801f19:	53                   	push   %ebx
+  801f1a:	81 ec 2c 01 00 00    	sub    $0x12c,%esp
+  801f20:	89 85 d4 fe ff ff    	mov    %eax,-0x12c(%ebp)
+  801f26:	89 d6                	mov    %edx,%esi
+  801f28:	89 8d d0 fe ff ff    	mov    %ecx,-0x130(%ebp)
+  801f2e:	8b 7d 08             	mov    0x8(%ebp),%edi
+	uintptr_t pages[1 + FSBULK_MAXPAGES];
+	uintptr_t va, start = ROUNDDOWN((uintptr_t) buf, PGSIZE);
+  801f31:	89 d3                	mov    %edx,%ebx
+  801f33:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+	int npages;
+
+	if (fsenv == 0)
+  801f39:	83 3d c8 f0 82 00 00 	cmpl   $0x0,0x82f0c8
+  801f40:	74 1d                	je     801f5f <fsipc_pages+0x4b>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+
+	pages[0] = (uintptr_t) &fsipcbuf | PTE_P | PTE_W | PTE_U;
+  801f42:	b8 00 e0 82 00       	mov    $0x82e000,%eax
+  801f47:	83 c8 07             	or     $0x7,%eax
+  801f4a:	89 85 e4 fe ff ff    	mov    %eax,-0x11c(%ebp)
+	npages = 1;
+  801f50:	b8 01 00 00 00       	mov    $0x1,%eax
+	for (va = start; va < (uintptr_t) buf + n; va += PGSIZE)
+  801f55:	8b 8d d0 fe ff ff    	mov    -0x130(%ebp),%ecx
+  801f5b:	01 ce                	add    %ecx,%esi
+  801f5d:	eb 28                	jmp    801f87 <fsipc_pages+0x73>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801f5f:	83 ec 0c             	sub    $0xc,%esp
+  801f62:	6a 01                	push   $0x1
+  801f64:	e8 0c 1e 00 00       	call   803d75 <ipc_find_env>
+  801f69:	a3 c8 f0 82 00       	mov    %eax,0x82f0c8
+  801f6e:	83 c4 10             	add    $0x10,%esp
+  801f71:	eb cf                	jmp    801f42 <fsipc_pages+0x2e>
+		pages[npages++] = va | perm;
+  801f73:	83 c0 01             	add    $0x1,%eax
+  801f76:	89 fa                	mov    %edi,%edx
+  801f78:	09 da                	or     %ebx,%edx
+  801f7a:	89 94 85 e0 fe ff ff 	mov    %edx,-0x120(%ebp,%eax,4)
+	for (va = start; va < (uintptr_t) buf + n; va += PGSIZE)
+  801f81:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801f87:	39 f3                	cmp    %esi,%ebx
+  801f89:	72 e8                	jb     801f73 <fsipc_pages+0x5f>
+	assert(npages <= ARRAY_SIZE(pages));
+  801f8b:	83 f8 41             	cmp    $0x41,%eax
+  801f8e:	77 2f                	ja     801fbf <fsipc_pages+0xab>
+
+	if (debug)
+		cprintf("[%08x] fsipc_pages %d %08x %d pages\n",
+			thisenv->env_id, type, buf, npages - 1);
+
+	ipc_sendv(fsenv, type, pages, npages);
+  801f90:	50                   	push   %eax
+  801f91:	8d 85 e4 fe ff ff    	lea    -0x11c(%ebp),%eax
+  801f97:	50                   	push   %eax
+  801f98:	ff b5 d4 fe ff ff    	push   -0x12c(%ebp)
+  801f9e:	ff 35 c8 f0 82 00    	push   0x82f0c8
+  801fa4:	e8 7e 1d 00 00       	call   803d27 <ipc_sendv>
+	return ipc_recv(NULL, NULL, NULL);
+  801fa9:	83 c4 0c             	add    $0xc,%esp
+  801fac:	6a 00                	push   $0x0
+  801fae:	6a 00                	push   $0x0
+  801fb0:	6a 00                	push   $0x0
+  801fb2:	e8 1a 1c 00 00       	call   803bd1 <ipc_recv>
+}
+  801fb7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801fba:	5b                   	pop    %ebx
+  801fbb:	5e                   	pop    %esi
+  801fbc:	5f                   	pop    %edi
+  801fbd:	5d                   	pop    %ebp
+  801fbe:	c3                   	ret
+	assert(npages <= ARRAY_SIZE(pages));
+  801fbf:	68 a4 49 80 00       	push   $0x8049a4
+  801fc4:	68 c0 49 80 00       	push   $0x8049c0
+  801fc9:	6a 40                	push   $0x40
+  801fcb:	68 d5 49 80 00       	push   $0x8049d5
+  801fd0:	e8 56 ea ff ff       	call   800a2b <_panic>
+
+00801fd5 <fsring_post>:
+
+// Post a request of the given type for n bytes at 'offset' of fdnum,
+// with data page 'slot' already filled in as needed.
+static int
+fsring_post(uint32_t type, struct Fd *fd, off_t offset, size_t n, int slot)
+{
+  801fd5:	55                   	push   %ebp
+  801fd6:	89 e5                	mov    %esp,%ebp
+  801fd8:	57                   	push   %edi
+  801fd9:	56                   	push   %esi
+  801fda:	53                   	push   %ebx
+  801fdb:	83 ec 1c             	sub    $0x1c,%esp
+  801fde:	89 c3                	mov    %eax,%ebx
+  801fe0:	89 d6                	mov    %edx,%esi
+  801fe2:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+	struct Fsring_sqe *sqe;
+	uint32_t tail = fsring->r_sqtail;
+  801fe5:	8b 0d 04 00 00 cf    	mov    0xcf000004,%ecx
+
+	sqe = &fsring->r_sq[tail % FSRING_NSLOTS];
+  801feb:	89 ca                	mov    %ecx,%edx
+  801fed:	83 e2 0f             	and    $0xf,%edx
+	sqe->sqe_type = type;
+  801ff0:	8d 04 95 00 00 00 00 	lea    0x0(,%edx,4),%eax
+  801ff7:	8d 3c 10             	lea    (%eax,%edx,1),%edi
+  801ffa:	89 1c bd 10 00 00 cf 	mov    %ebx,-0x30fffff0(,%edi,4)
+	sqe->sqe_fileid = fd->fd_file.id;
+  802001:	8b 76 0c             	mov    0xc(%esi),%esi
+  802004:	89 fb                	mov    %edi,%ebx
+  802006:	89 34 bd 14 00 00 cf 	mov    %esi,-0x30ffffec(,%edi,4)
+	sqe->sqe_offset = offset;
+  80200d:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  802010:	89 3c 9d 18 00 00 cf 	mov    %edi,-0x30ffffe8(,%ebx,4)
+	sqe->sqe_n = n;
+  802017:	8b 75 08             	mov    0x8(%ebp),%esi
+  80201a:	89 34 9d 1c 00 00 cf 	mov    %esi,-0x30ffffe4(,%ebx,4)
+	sqe->sqe_slot = slot;
+  802021:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802024:	89 14 9d 20 00 00 cf 	mov    %edx,-0x30ffffe0(,%ebx,4)
+	// waking when the ring was empty before this request.  The kick
+	// gets no reply, and the server does not look at its request page.
+	// Publishing the tail with xchg, a full barrier, keeps the load of
+	// r_sqhead below from passing it; serve_ring_kick does the same the
+	// other way around, so one of the two sees the other's update.
+	xchg(&fsring->r_sqtail, tail + 1);
+  80202b:	8d 41 01             	lea    0x1(%ecx),%eax
+xchg(volatile uint32_t *addr, uint32_t newval)
+{
+	uint32_t result;
+
+	// The + in "+m" denotes a read-modify-write operand.
+	asm volatile("lock; xchgl %0, %1"
+  80202e:	f0 87 05 04 00 00 cf 	lock xchg %eax,0xcf000004
+	if (fsring->r_sqhead == tail)
+  802035:	a1 00 00 00 cf       	mov    0xcf000000,%eax
+  80203a:	39 c8                	cmp    %ecx,%eax
+  80203c:	74 0d                	je     80204b <fsring_post+0x76>
+		ipc_send(fsenv, FSREQ_RING_KICK, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+	return 0;
+}
+  80203e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802043:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802046:	5b                   	pop    %ebx
+  802047:	5e                   	pop    %esi
+  802048:	5f                   	pop    %edi
+  802049:	5d                   	pop    %ebp
+  80204a:	c3                   	ret
+		ipc_send(fsenv, FSREQ_RING_KICK, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  80204b:	6a 07                	push   $0x7
+  80204d:	68 00 e0 82 00       	push   $0x82e000
+  802052:	6a 0d                	push   $0xd
+  802054:	ff 35 c8 f0 82 00    	push   0x82f0c8
+  80205a:	e8 dd 1b 00 00       	call   803c3c <ipc_send>
+  80205f:	83 c4 10             	add    $0x10,%esp
+  802062:	eb da                	jmp    80203e <fsring_post+0x69>
+
+00802064 <fsipcv>:
+{
+  802064:	55                   	push   %ebp
+  802065:	89 e5                	mov    %esp,%ebp
+  802067:	57                   	push   %edi
+  802068:	56                   	push   %esi
+  802069:	53                   	push   %ebx
+  80206a:	83 ec 0c             	sub    $0xc,%esp
+  80206d:	89 c7                	mov    %eax,%edi
+  80206f:	89 d3                	mov    %edx,%ebx
+  802071:	89 ce                	mov    %ecx,%esi
+	if (fsenv == 0)
+  802073:	83 3d c8 f0 82 00 00 	cmpl   $0x0,0x82f0c8
+  80207a:	74 26                	je     8020a2 <fsipcv+0x3e>
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  80207c:	6a 07                	push   $0x7
+  80207e:	68 00 e0 82 00       	push   $0x82e000
+  802083:	57                   	push   %edi
+  802084:	ff 35 c8 f0 82 00    	push   0x82f0c8
+  80208a:	e8 ad 1b 00 00       	call   803c3c <ipc_send>
+	return ipc_recvv(NULL, dstva, npages, NULL);
+  80208f:	6a 00                	push   $0x0
+  802091:	56                   	push   %esi
+  802092:	53                   	push   %ebx
+  802093:	6a 00                	push   $0x0
+  802095:	e8 fa 1b 00 00       	call   803c94 <ipc_recvv>
+}
+  80209a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80209d:	5b                   	pop    %ebx
+  80209e:	5e                   	pop    %esi
+  80209f:	5f                   	pop    %edi
+  8020a0:	5d                   	pop    %ebp
+  8020a1:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  8020a2:	83 ec 0c             	sub    $0xc,%esp
+  8020a5:	6a 01                	push   $0x1
+  8020a7:	e8 c9 1c 00 00       	call   803d75 <ipc_find_env>
+  8020ac:	a3 c8 f0 82 00       	mov    %eax,0x82f0c8
+  8020b1:	83 c4 10             	add    $0x10,%esp
+  8020b4:	eb c6                	jmp    80207c <fsipcv+0x18>
+
+008020b6 <fsipc>:
+{
+  8020b6:	55                   	push   %ebp
+  8020b7:	89 e5                	mov    %esp,%ebp
+  8020b9:	83 ec 18             	sub    $0x18,%esp
+	int npages = 1;
+  8020bc:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+	return fsipcv(type, dstva, &npages);
+  8020c3:	8d 4d f4             	lea    -0xc(%ebp),%ecx
+  8020c6:	e8 99 ff ff ff       	call   802064 <fsipcv>
+}
+  8020cb:	c9                   	leave
+  8020cc:	c3                   	ret
+
+008020cd <file_write_direct>:
+{
+  8020cd:	55                   	push   %ebp
+  8020ce:	89 e5                	mov    %esp,%ebp
+  8020d0:	56                   	push   %esi
+  8020d1:	53                   	push   %ebx
+  8020d2:	89 c3                	mov    %eax,%ebx
+  8020d4:	89 c8                	mov    %ecx,%eax
+	if (n > sizeof(fsipcbuf.write.req_buf)) {
+  8020d6:	81 f9 f8 0f 00 00    	cmp    $0xff8,%ecx
+  8020dc:	77 40                	ja     80211e <file_write_direct+0x51>
+	n = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  8020de:	b9 f8 0f 00 00       	mov    $0xff8,%ecx
+  8020e3:	39 c8                	cmp    %ecx,%eax
+  8020e5:	0f 47 c1             	cmova  %ecx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8020e8:	8b 4b 0c             	mov    0xc(%ebx),%ecx
+  8020eb:	89 0d 00 e0 82 00    	mov    %ecx,0x82e000
+	fsipcbuf.write.req_n = n;
+  8020f1:	a3 04 e0 82 00       	mov    %eax,0x82e004
+	memmove(fsipcbuf.write.req_buf, buf, n);
+  8020f6:	83 ec 04             	sub    $0x4,%esp
+  8020f9:	50                   	push   %eax
+  8020fa:	52                   	push   %edx
+  8020fb:	68 08 e0 82 00       	push   $0x82e008
+  802100:	e8 75 f1 ff ff       	call   80127a <memmove>
+	return fsipc(FSREQ_WRITE, NULL);
+  802105:	ba 00 00 00 00       	mov    $0x0,%edx
+  80210a:	b8 04 00 00 00       	mov    $0x4,%eax
+  80210f:	e8 a2 ff ff ff       	call   8020b6 <fsipc>
+  802114:	83 c4 10             	add    $0x10,%esp
+}
+  802117:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80211a:	5b                   	pop    %ebx
+  80211b:	5e                   	pop    %esi
+  80211c:	5d                   	pop    %ebp
+  80211d:	c3                   	ret
+		n = MIN(n, FSBULK_MAXPAGES * PGSIZE - PGOFF(buf));
+  80211e:	89 d6                	mov    %edx,%esi
+  802120:	81 e6 ff 0f 00 00    	and    $0xfff,%esi
+  802126:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  80212b:	29 f1                	sub    %esi,%ecx
+  80212d:	39 c1                	cmp    %eax,%ecx
+  80212f:	0f 47 c8             	cmova  %eax,%ecx
+	fsipcbuf.bulk.req_fileid = fileid;
+  802132:	8b 43 0c             	mov    0xc(%ebx),%eax
+  802135:	a3 00 e0 82 00       	mov    %eax,0x82e000
+	fsipcbuf.bulk.req_n = n;
+  80213a:	89 0d 04 e0 82 00    	mov    %ecx,0x82e004
+	fsipcbuf.bulk.req_off = PGOFF(buf);
+  802140:	89 35 08 e0 82 00    	mov    %esi,0x82e008
+	return fsipc_pages(type, buf, n, perm);
+  802146:	83 ec 0c             	sub    $0xc,%esp
+  802149:	6a 05                	push   $0x5
+  80214b:	b8 0a 00 00 00       	mov    $0xa,%eax
+  802150:	e8 bf fd ff ff       	call   801f14 <fsipc_pages>
+		return fsipc_bulk(FSREQ_WRITE_BULK, fd->fd_file.id, buf, n,
+  802155:	83 c4 10             	add    $0x10,%esp
+  802158:	eb bd                	jmp    802117 <file_write_direct+0x4a>
+
+0080215a <devfile_sync>:
+{
+  80215a:	55                   	push   %ebp
+  80215b:	89 e5                	mov    %esp,%ebp
+  80215d:	57                   	push   %edi
+  80215e:	56                   	push   %esi
+  80215f:	53                   	push   %ebx
+  802160:	83 ec 28             	sub    $0x28,%esp
+  802163:	8b 75 08             	mov    0x8(%ebp),%esi
+	char *p = fd2data(fd);
+  802166:	56                   	push   %esi
+  802167:	e8 a5 f7 ff ff       	call   801911 <fd2data>
+  80216c:	89 c7                	mov    %eax,%edi
+	off_t pos = fd->fd_offset;
+  80216e:	8b 4e 04             	mov    0x4(%esi),%ecx
+	ff->buf_rlen = 0;
+  802171:	c7 46 18 00 00 00 00 	movl   $0x0,0x18(%esi)
+	if (ff->buf_wlen == 0)
+  802178:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  80217b:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (ff->buf_wlen == 0)
+  802180:	83 7e 1c 00          	cmpl   $0x0,0x1c(%esi)
+  802184:	74 45                	je     8021cb <devfile_sync+0x71>
+	fd->fd_offset = ff->buf_base;
+  802186:	8b 46 14             	mov    0x14(%esi),%eax
+  802189:	89 46 04             	mov    %eax,0x4(%esi)
+	for (done = 0, r = 0; done < ff->buf_wlen; done += r)
+  80218c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802191:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802196:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  802199:	8b 4e 1c             	mov    0x1c(%esi),%ecx
+  80219c:	39 cb                	cmp    %ecx,%ebx
+  80219e:	73 14                	jae    8021b4 <devfile_sync+0x5a>
+		if ((r = file_write_direct(fd, p + done, ff->buf_wlen - done)) <= 0)
+  8021a0:	29 d9                	sub    %ebx,%ecx
+  8021a2:	8d 14 1f             	lea    (%edi,%ebx,1),%edx
+  8021a5:	89 f0                	mov    %esi,%eax
+  8021a7:	e8 21 ff ff ff       	call   8020cd <file_write_direct>
+  8021ac:	85 c0                	test   %eax,%eax
+  8021ae:	7e 04                	jle    8021b4 <devfile_sync+0x5a>
+	for (done = 0, r = 0; done < ff->buf_wlen; done += r)
+  8021b0:	01 c3                	add    %eax,%ebx
+  8021b2:	eb e5                	jmp    802199 <devfile_sync+0x3f>
+	ff->buf_wlen = 0;
+  8021b4:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8021b7:	c7 46 1c 00 00 00 00 	movl   $0x0,0x1c(%esi)
+	fd->fd_offset = pos;
+  8021be:	89 4e 04             	mov    %ecx,0x4(%esi)
+	return r < 0 ? r : 0;
+  8021c1:	85 c0                	test   %eax,%eax
+  8021c3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8021c8:	0f 4f c2             	cmovg  %edx,%eax
+}
+  8021cb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8021ce:	5b                   	pop    %ebx
+  8021cf:	5e                   	pop    %esi
+  8021d0:	5f                   	pop    %edi
+  8021d1:	5d                   	pop    %ebp
+  8021d2:	c3                   	ret
+
+008021d3 <devfile_write>:
+{
+  8021d3:	55                   	push   %ebp
+  8021d4:	89 e5                	mov    %esp,%ebp
+  8021d6:	57                   	push   %edi
+  8021d7:	56                   	push   %esi
+  8021d8:	53                   	push   %ebx
+  8021d9:	83 ec 28             	sub    $0x28,%esp
+  8021dc:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8021df:	8b 75 10             	mov    0x10(%ebp),%esi
+	char *p = fd2data(fd);
+  8021e2:	53                   	push   %ebx
+  8021e3:	e8 29 f7 ff ff       	call   801911 <fd2data>
+  8021e8:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	off_t pos = fd->fd_offset;
+  8021eb:	8b 7b 04             	mov    0x4(%ebx),%edi
+	if (!ff->buffered)
+  8021ee:	83 c4 10             	add    $0x10,%esp
+  8021f1:	80 7b 10 00          	cmpb   $0x0,0x10(%ebx)
+  8021f5:	74 43                	je     80223a <devfile_write+0x67>
+	ff->buf_rlen = 0;
+  8021f7:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+	if (ff->buf_wlen > 0
+  8021fe:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  802201:	85 c0                	test   %eax,%eax
+  802203:	74 43                	je     802248 <devfile_write+0x75>
+	    && (pos != ff->buf_base + ff->buf_wlen
+  802205:	89 c2                	mov    %eax,%edx
+  802207:	03 53 14             	add    0x14(%ebx),%edx
+  80220a:	39 fa                	cmp    %edi,%edx
+  80220c:	75 0b                	jne    802219 <devfile_write+0x46>
+		|| ff->buf_wlen + n > FILEBUF_SIZE)
+  80220e:	8d 14 30             	lea    (%eax,%esi,1),%edx
+  802211:	81 fa 00 10 00 00    	cmp    $0x1000,%edx
+  802217:	76 66                	jbe    80227f <devfile_write+0xac>
+	    && (r = devfile_sync(fd)) < 0)
+  802219:	83 ec 0c             	sub    $0xc,%esp
+  80221c:	53                   	push   %ebx
+  80221d:	e8 38 ff ff ff       	call   80215a <devfile_sync>
+  802222:	83 c4 10             	add    $0x10,%esp
+  802225:	85 c0                	test   %eax,%eax
+  802227:	78 4e                	js     802277 <devfile_write+0xa4>
+	if (n >= FILEBUF_SIZE)
+  802229:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  80222f:	77 56                	ja     802287 <devfile_write+0xb4>
+	if (ff->buf_wlen == 0)
+  802231:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  802234:	85 c0                	test   %eax,%eax
+  802236:	75 20                	jne    802258 <devfile_write+0x85>
+  802238:	eb 16                	jmp    802250 <devfile_write+0x7d>
+		return file_write_direct(fd, buf, n);
+  80223a:	89 f1                	mov    %esi,%ecx
+  80223c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80223f:	89 d8                	mov    %ebx,%eax
+  802241:	e8 87 fe ff ff       	call   8020cd <file_write_direct>
+  802246:	eb 2f                	jmp    802277 <devfile_write+0xa4>
+	if (n >= FILEBUF_SIZE)
+  802248:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  80224e:	77 37                	ja     802287 <devfile_write+0xb4>
+		ff->buf_base = pos;
+  802250:	89 7b 14             	mov    %edi,0x14(%ebx)
+  802253:	b8 00 00 00 00       	mov    $0x0,%eax
+	memmove(p + ff->buf_wlen, buf, n);
+  802258:	83 ec 04             	sub    $0x4,%esp
+  80225b:	56                   	push   %esi
+  80225c:	ff 75 0c             	push   0xc(%ebp)
+  80225f:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  802262:	01 c1                	add    %eax,%ecx
+  802264:	51                   	push   %ecx
+  802265:	e8 10 f0 ff ff       	call   80127a <memmove>
+	ff->buf_wlen += n;
+  80226a:	01 73 1c             	add    %esi,0x1c(%ebx)
+	fd->fd_offset = pos + n;
+  80226d:	01 f7                	add    %esi,%edi
+  80226f:	89 7b 04             	mov    %edi,0x4(%ebx)
+	return n;
+  802272:	89 f0                	mov    %esi,%eax
+  802274:	83 c4 10             	add    $0x10,%esp
+}
+  802277:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80227a:	5b                   	pop    %ebx
+  80227b:	5e                   	pop    %esi
+  80227c:	5f                   	pop    %edi
+  80227d:	5d                   	pop    %ebp
+  80227e:	c3                   	ret
+	if (n >= FILEBUF_SIZE)
+  80227f:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  802285:	76 d1                	jbe    802258 <devfile_write+0x85>
+		return file_write_direct(fd, buf, n);
+  802287:	89 f1                	mov    %esi,%ecx
+  802289:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80228c:	89 d8                	mov    %ebx,%eax
+  80228e:	e8 3a fe ff ff       	call   8020cd <file_write_direct>
+  802293:	eb e2                	jmp    802277 <devfile_write+0xa4>
+
+00802295 <devfile_trunc>:
+{
+  802295:	55                   	push   %ebp
+  802296:	89 e5                	mov    %esp,%ebp
+  802298:	53                   	push   %ebx
+  802299:	83 ec 10             	sub    $0x10,%esp
+  80229c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if ((r = devfile_sync(fd)) < 0)
+  80229f:	53                   	push   %ebx
+  8022a0:	e8 b5 fe ff ff       	call   80215a <devfile_sync>
+  8022a5:	83 c4 10             	add    $0x10,%esp
+  8022a8:	85 c0                	test   %eax,%eax
+  8022aa:	78 1f                	js     8022cb <devfile_trunc+0x36>
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  8022ac:	8b 43 0c             	mov    0xc(%ebx),%eax
+  8022af:	a3 00 e0 82 00       	mov    %eax,0x82e000
+	fsipcbuf.set_size.req_size = newsize;
+  8022b4:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8022b7:	a3 04 e0 82 00       	mov    %eax,0x82e004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  8022bc:	ba 00 00 00 00       	mov    $0x0,%edx
+  8022c1:	b8 02 00 00 00       	mov    $0x2,%eax
+  8022c6:	e8 eb fd ff ff       	call   8020b6 <fsipc>
+}
+  8022cb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8022ce:	c9                   	leave
+  8022cf:	c3                   	ret
+
+008022d0 <devfile_stat>:
+{
+  8022d0:	55                   	push   %ebp
+  8022d1:	89 e5                	mov    %esp,%ebp
+  8022d3:	56                   	push   %esi
+  8022d4:	53                   	push   %ebx
+  8022d5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8022d8:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if ((r = devfile_sync(fd)) < 0)
+  8022db:	83 ec 0c             	sub    $0xc,%esp
+  8022de:	53                   	push   %ebx
+  8022df:	e8 76 fe ff ff       	call   80215a <devfile_sync>
+  8022e4:	83 c4 10             	add    $0x10,%esp
+  8022e7:	85 c0                	test   %eax,%eax
+  8022e9:	78 47                	js     802332 <devfile_stat+0x62>
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  8022eb:	8b 43 0c             	mov    0xc(%ebx),%eax
+  8022ee:	a3 00 e0 82 00       	mov    %eax,0x82e000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  8022f3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8022f8:	b8 05 00 00 00       	mov    $0x5,%eax
+  8022fd:	e8 b4 fd ff ff       	call   8020b6 <fsipc>
+  802302:	85 c0                	test   %eax,%eax
+  802304:	78 2c                	js     802332 <devfile_stat+0x62>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  802306:	83 ec 08             	sub    $0x8,%esp
+  802309:	68 00 e0 82 00       	push   $0x82e000
+  80230e:	56                   	push   %esi
+  80230f:	e8 e0 ed ff ff       	call   8010f4 <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  802314:	a1 80 e0 82 00       	mov    0x82e080,%eax
+  802319:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  80231f:	a1 84 e0 82 00       	mov    0x82e084,%eax
+  802324:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+	return 0;
+  80232a:	83 c4 10             	add    $0x10,%esp
+  80232d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802332:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802335:	5b                   	pop    %ebx
+  802336:	5e                   	pop    %esi
+  802337:	5d                   	pop    %ebp
+  802338:	c3                   	ret
+
+00802339 <devfile_flush>:
+{
+  802339:	55                   	push   %ebp
+  80233a:	89 e5                	mov    %esp,%ebp
+  80233c:	56                   	push   %esi
+  80233d:	53                   	push   %ebx
+  80233e:	8b 75 08             	mov    0x8(%ebp),%esi
+	r = devfile_sync(fd);
+  802341:	83 ec 0c             	sub    $0xc,%esp
+  802344:	56                   	push   %esi
+  802345:	e8 10 fe ff ff       	call   80215a <devfile_sync>
+  80234a:	89 c3                	mov    %eax,%ebx
+	if (fd->fd_file.buffered)
+  80234c:	83 c4 10             	add    $0x10,%esp
+  80234f:	80 7e 10 00          	cmpb   $0x0,0x10(%esi)
+  802353:	75 25                	jne    80237a <devfile_flush+0x41>
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  802355:	8b 46 0c             	mov    0xc(%esi),%eax
+  802358:	a3 00 e0 82 00       	mov    %eax,0x82e000
+	return fsipc(FSREQ_FLUSH, NULL) ?: r;
+  80235d:	ba 00 00 00 00       	mov    $0x0,%edx
+  802362:	b8 06 00 00 00       	mov    $0x6,%eax
+  802367:	e8 4a fd ff ff       	call   8020b6 <fsipc>
+  80236c:	85 c0                	test   %eax,%eax
+  80236e:	0f 45 d8             	cmovne %eax,%ebx
+}
+  802371:	89 d8                	mov    %ebx,%eax
+  802373:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802376:	5b                   	pop    %ebx
+  802377:	5e                   	pop    %esi
+  802378:	5d                   	pop    %ebp
+  802379:	c3                   	ret
+		sys_page_unmap(0, fd2data(fd));
+  80237a:	83 ec 0c             	sub    $0xc,%esp
+  80237d:	56                   	push   %esi
+  80237e:	e8 8e f5 ff ff       	call   801911 <fd2data>
+  802383:	83 c4 08             	add    $0x8,%esp
+  802386:	50                   	push   %eax
+  802387:	6a 00                	push   $0x0
+  802389:	e8 ff f1 ff ff       	call   80158d <sys_page_unmap>
+  80238e:	83 c4 10             	add    $0x10,%esp
+  802391:	eb c2                	jmp    802355 <devfile_flush+0x1c>
+
+00802393 <fsring_slot>:
+
+// Find a free data page and get fdnum ready for a request on it.
+// Returns the slot number, or < 0 on error.
+static int
+fsring_slot(int fdnum, struct Fd **fd_store)
+{
+  802393:	55                   	push   %ebp
+  802394:	89 e5                	mov    %esp,%ebp
+  802396:	57                   	push   %edi
+  802397:	56                   	push   %esi
+  802398:	53                   	push   %ebx
+  802399:	83 ec 64             	sub    $0x64,%esp
+  80239c:	89 d7                	mov    %edx,%edi
+	int r, slot;
+
+	if ((r = fd_lookup(fdnum, fd_store)) < 0)
+  80239e:	52                   	push   %edx
+  80239f:	50                   	push   %eax
+  8023a0:	e8 d9 f5 ff ff       	call   80197e <fd_lookup>
+  8023a5:	89 c1                	mov    %eax,%ecx
+  8023a7:	83 c4 10             	add    $0x10,%esp
+  8023aa:	85 c0                	test   %eax,%eax
+  8023ac:	0f 88 f2 00 00 00    	js     8024a4 <fsring_slot+0x111>
+		return r;
+	if ((*fd_store)->fd_dev_id != devfile.dev_id)
+  8023b2:	8b 07                	mov    (%edi),%eax
+  8023b4:	8b 15 20 50 80 00    	mov    0x805020,%edx
+  8023ba:	39 10                	cmp    %edx,(%eax)
+  8023bc:	0f 85 03 01 00 00    	jne    8024c5 <fsring_slot+0x132>
+	if (fsring_env == thisenv->env_id)
+  8023c2:	a1 30 db 82 00       	mov    0x82db30,%eax
+  8023c7:	8b 40 48             	mov    0x48(%eax),%eax
+  8023ca:	3b 05 c4 f0 82 00    	cmp    0x82f0c4,%eax
+  8023d0:	0f 84 96 00 00 00    	je     80246c <fsring_slot+0xd9>
+	if (fsenv == 0)
+  8023d6:	83 3d c8 f0 82 00 00 	cmpl   $0x0,0x82f0c8
+  8023dd:	0f 84 cb 00 00 00    	je     8024ae <fsring_slot+0x11b>
+	pages[0] = (uintptr_t) &fsipcbuf | PTE_P | PTE_W | PTE_U;
+  8023e3:	b8 00 e0 82 00       	mov    $0x82e000,%eax
+  8023e8:	83 c8 07             	or     $0x7,%eax
+  8023eb:	89 45 a0             	mov    %eax,-0x60(%ebp)
+	for (i = 0; i < FSRING_NPAGES; i++) {
+  8023ee:	8d 75 a4             	lea    -0x5c(%ebp),%esi
+	pages[0] = (uintptr_t) &fsipcbuf | PTE_P | PTE_W | PTE_U;
+  8023f1:	bb 00 00 00 cf       	mov    $0xcf000000,%ebx
+		if ((r = sys_page_alloc(0, (char *) fsring + i * PGSIZE,
+  8023f6:	83 ec 04             	sub    $0x4,%esp
+  8023f9:	68 07 04 00 00       	push   $0x407
+  8023fe:	53                   	push   %ebx
+  8023ff:	6a 00                	push   $0x0
+  802401:	e8 fa f0 ff ff       	call   801500 <sys_page_alloc>
+  802406:	89 c1                	mov    %eax,%ecx
+  802408:	83 c4 10             	add    $0x10,%esp
+  80240b:	85 c0                	test   %eax,%eax
+  80240d:	0f 88 91 00 00 00    	js     8024a4 <fsring_slot+0x111>
+		pages[1 + i] = ((uintptr_t) fsring + i * PGSIZE) | PTE_P | PTE_W | PTE_U;
+  802413:	89 d8                	mov    %ebx,%eax
+  802415:	83 c8 07             	or     $0x7,%eax
+  802418:	89 06                	mov    %eax,(%esi)
+	for (i = 0; i < FSRING_NPAGES; i++) {
+  80241a:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  802420:	83 c6 04             	add    $0x4,%esi
+  802423:	81 fb 00 10 01 cf    	cmp    $0xcf011000,%ebx
+  802429:	75 cb                	jne    8023f6 <fsring_slot+0x63>
+	ipc_sendv(fsenv, FSREQ_RING_SETUP, pages, ARRAY_SIZE(pages));
+  80242b:	6a 12                	push   $0x12
+  80242d:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  802430:	50                   	push   %eax
+  802431:	6a 0c                	push   $0xc
+  802433:	ff 35 c8 f0 82 00    	push   0x82f0c8
+  802439:	e8 e9 18 00 00       	call   803d27 <ipc_sendv>
+	if ((r = ipc_recv(NULL, NULL, NULL)) < 0)
+  80243e:	83 c4 0c             	add    $0xc,%esp
+  802441:	6a 00                	push   $0x0
+  802443:	6a 00                	push   $0x0
+  802445:	6a 00                	push   $0x0
+  802447:	e8 85 17 00 00       	call   803bd1 <ipc_recv>
+  80244c:	89 c1                	mov    %eax,%ecx
+  80244e:	83 c4 10             	add    $0x10,%esp
+  802451:	85 c0                	test   %eax,%eax
+  802453:	78 4f                	js     8024a4 <fsring_slot+0x111>
+	fsring_env = thisenv->env_id;
+  802455:	a1 30 db 82 00       	mov    0x82db30,%eax
+  80245a:	8b 40 48             	mov    0x48(%eax),%eax
+  80245d:	a3 c4 f0 82 00       	mov    %eax,0x82f0c4
+	fsring_busy = 0;
+  802462:	c7 05 c0 f0 82 00 00 	movl   $0x0,0x82f0c0
+  802469:	00 00 00 
+		return -E_NOT_SUPP;
+	if ((r = fsring_setup()) < 0)
+		return r;
+	// Buffered writes must reach the server ahead of anything posted.
+	if ((r = devfile_sync(*fd_store)) < 0)
+  80246c:	83 ec 0c             	sub    $0xc,%esp
+  80246f:	ff 37                	push   (%edi)
+  802471:	e8 e4 fc ff ff       	call   80215a <devfile_sync>
+  802476:	89 c1                	mov    %eax,%ecx
+  802478:	83 c4 10             	add    $0x10,%esp
+  80247b:	85 c0                	test   %eax,%eax
+  80247d:	78 25                	js     8024a4 <fsring_slot+0x111>
+		return r;
+	for (slot = 0; slot < FSRING_NSLOTS; slot++)
+		if (!(fsring_busy & (1 << slot)))
+  80247f:	8b 1d c0 f0 82 00    	mov    0x82f0c0,%ebx
+	for (slot = 0; slot < FSRING_NSLOTS; slot++)
+  802485:	b9 00 00 00 00       	mov    $0x0,%ecx
+		if (!(fsring_busy & (1 << slot)))
+  80248a:	ba 01 00 00 00       	mov    $0x1,%edx
+  80248f:	89 d0                	mov    %edx,%eax
+  802491:	d3 e0                	shl    %cl,%eax
+  802493:	85 d8                	test   %ebx,%eax
+  802495:	74 0d                	je     8024a4 <fsring_slot+0x111>
+	for (slot = 0; slot < FSRING_NSLOTS; slot++)
+  802497:	83 c1 01             	add    $0x1,%ecx
+  80249a:	83 f9 10             	cmp    $0x10,%ecx
+  80249d:	75 f0                	jne    80248f <fsring_slot+0xfc>
+			return slot;
+	return -E_NO_MEM;
+  80249f:	b9 fc ff ff ff       	mov    $0xfffffffc,%ecx
+}
+  8024a4:	89 c8                	mov    %ecx,%eax
+  8024a6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8024a9:	5b                   	pop    %ebx
+  8024aa:	5e                   	pop    %esi
+  8024ab:	5f                   	pop    %edi
+  8024ac:	5d                   	pop    %ebp
+  8024ad:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  8024ae:	83 ec 0c             	sub    $0xc,%esp
+  8024b1:	6a 01                	push   $0x1
+  8024b3:	e8 bd 18 00 00       	call   803d75 <ipc_find_env>
+  8024b8:	a3 c8 f0 82 00       	mov    %eax,0x82f0c8
+  8024bd:	83 c4 10             	add    $0x10,%esp
+  8024c0:	e9 1e ff ff ff       	jmp    8023e3 <fsring_slot+0x50>
+		return -E_NOT_SUPP;
+  8024c5:	b9 f1 ff ff ff       	mov    $0xfffffff1,%ecx
+  8024ca:	eb d8                	jmp    8024a4 <fsring_slot+0x111>
+
+008024cc <file_read_direct>:
+{
+  8024cc:	55                   	push   %ebp
+  8024cd:	89 e5                	mov    %esp,%ebp
+  8024cf:	57                   	push   %edi
+  8024d0:	56                   	push   %esi
+  8024d1:	53                   	push   %ebx
+  8024d2:	83 ec 1c             	sub    $0x1c,%esp
+  8024d5:	89 c7                	mov    %eax,%edi
+  8024d7:	89 d6                	mov    %edx,%esi
+  8024d9:	89 cb                	mov    %ecx,%ebx
+	if (n > PGSIZE) {
+  8024db:	81 f9 00 10 00 00    	cmp    $0x1000,%ecx
+  8024e1:	77 52                	ja     802535 <file_read_direct+0x69>
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8024e3:	8b 40 0c             	mov    0xc(%eax),%eax
+  8024e6:	a3 00 e0 82 00       	mov    %eax,0x82e000
+	fsipcbuf.read.req_n = n;
+  8024eb:	89 0d 04 e0 82 00    	mov    %ecx,0x82e004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  8024f1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8024f6:	b8 03 00 00 00       	mov    $0x3,%eax
+  8024fb:	e8 b6 fb ff ff       	call   8020b6 <fsipc>
+  802500:	89 c7                	mov    %eax,%edi
+  802502:	85 c0                	test   %eax,%eax
+  802504:	78 25                	js     80252b <file_read_direct+0x5f>
+	assert(r <= n);
+  802506:	39 c3                	cmp    %eax,%ebx
+  802508:	0f 82 87 00 00 00    	jb     802595 <file_read_direct+0xc9>
+	assert(r <= PGSIZE);
+  80250e:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  802513:	0f 8f 95 00 00 00    	jg     8025ae <file_read_direct+0xe2>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  802519:	83 ec 04             	sub    $0x4,%esp
+  80251c:	50                   	push   %eax
+  80251d:	68 00 e0 82 00       	push   $0x82e000
+  802522:	56                   	push   %esi
+  802523:	e8 52 ed ff ff       	call   80127a <memmove>
+	return r;
+  802528:	83 c4 10             	add    $0x10,%esp
+}
+  80252b:	89 f8                	mov    %edi,%eax
+  80252d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802530:	5b                   	pop    %ebx
+  802531:	5e                   	pop    %esi
+  802532:	5f                   	pop    %edi
+  802533:	5d                   	pop    %ebp
+  802534:	c3                   	ret
+		n = MIN(n, FSBULK_MAXPAGES * PGSIZE - PGOFF(buf));
+  802535:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  80253b:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  802540:	29 d1                	sub    %edx,%ecx
+  802542:	39 d9                	cmp    %ebx,%ecx
+  802544:	0f 46 d9             	cmovbe %ecx,%ebx
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  802547:	89 f0                	mov    %esi,%eax
+  802549:	8d 0c 1e             	lea    (%esi,%ebx,1),%ecx
+  80254c:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  80254f:	eb 0f                	jmp    802560 <file_read_direct+0x94>
+		*(volatile char *) p = *(volatile char *) p;
+  802551:	0f b6 10             	movzbl (%eax),%edx
+  802554:	88 10                	mov    %dl,(%eax)
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  802556:	05 00 10 00 00       	add    $0x1000,%eax
+  80255b:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  802560:	39 c8                	cmp    %ecx,%eax
+  802562:	72 ed                	jb     802551 <file_read_direct+0x85>
+	fsipcbuf.bulk.req_fileid = fileid;
+  802564:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802567:	8b 47 0c             	mov    0xc(%edi),%eax
+  80256a:	a3 00 e0 82 00       	mov    %eax,0x82e000
+	fsipcbuf.bulk.req_n = n;
+  80256f:	89 1d 04 e0 82 00    	mov    %ebx,0x82e004
+	fsipcbuf.bulk.req_off = PGOFF(buf);
+  802575:	89 15 08 e0 82 00    	mov    %edx,0x82e008
+	return fsipc_pages(type, buf, n, perm);
+  80257b:	83 ec 0c             	sub    $0xc,%esp
+  80257e:	6a 07                	push   $0x7
+  802580:	89 d9                	mov    %ebx,%ecx
+  802582:	89 f2                	mov    %esi,%edx
+  802584:	b8 09 00 00 00       	mov    $0x9,%eax
+  802589:	e8 86 f9 ff ff       	call   801f14 <fsipc_pages>
+  80258e:	89 c7                	mov    %eax,%edi
+		return fsipc_bulk(FSREQ_READ_BULK, fd->fd_file.id, buf, n,
+  802590:	83 c4 10             	add    $0x10,%esp
+  802593:	eb 96                	jmp    80252b <file_read_direct+0x5f>
+	assert(r <= n);
+  802595:	68 e0 49 80 00       	push   $0x8049e0
+  80259a:	68 c0 49 80 00       	push   $0x8049c0
+  80259f:	68 dc 00 00 00       	push   $0xdc
+  8025a4:	68 d5 49 80 00       	push   $0x8049d5
+  8025a9:	e8 7d e4 ff ff       	call   800a2b <_panic>
+	assert(r <= PGSIZE);
+  8025ae:	68 f1 49 80 00       	push   $0x8049f1
+  8025b3:	68 c0 49 80 00       	push   $0x8049c0
+  8025b8:	68 dd 00 00 00       	push   $0xdd
+  8025bd:	68 d5 49 80 00       	push   $0x8049d5
+  8025c2:	e8 64 e4 ff ff       	call   800a2b <_panic>
+
+008025c7 <devfile_read>:
+{
+  8025c7:	55                   	push   %ebp
+  8025c8:	89 e5                	mov    %esp,%ebp
+  8025ca:	57                   	push   %edi
+  8025cb:	56                   	push   %esi
+  8025cc:	53                   	push   %ebx
+  8025cd:	83 ec 28             	sub    $0x28,%esp
+  8025d0:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8025d3:	8b 75 10             	mov    0x10(%ebp),%esi
+	char *p = fd2data(fd);
+  8025d6:	53                   	push   %ebx
+  8025d7:	e8 35 f3 ff ff       	call   801911 <fd2data>
+  8025dc:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	off_t pos = fd->fd_offset;
+  8025df:	8b 7b 04             	mov    0x4(%ebx),%edi
+	if (!ff->buffered)
+  8025e2:	83 c4 10             	add    $0x10,%esp
+  8025e5:	80 7b 10 00          	cmpb   $0x0,0x10(%ebx)
+  8025e9:	74 7d                	je     802668 <devfile_read+0xa1>
+	if (ff->buf_wlen > 0 && (r = devfile_sync(fd)) < 0)
+  8025eb:	83 7b 1c 00          	cmpl   $0x0,0x1c(%ebx)
+  8025ef:	0f 85 81 00 00 00    	jne    802676 <devfile_read+0xaf>
+	if (ff->buf_rlen == 0 || pos < ff->buf_base
+  8025f5:	8b 43 18             	mov    0x18(%ebx),%eax
+  8025f8:	85 c0                	test   %eax,%eax
+  8025fa:	74 0d                	je     802609 <devfile_read+0x42>
+  8025fc:	8b 53 14             	mov    0x14(%ebx),%edx
+  8025ff:	39 fa                	cmp    %edi,%edx
+  802601:	7f 06                	jg     802609 <devfile_read+0x42>
+	    || pos >= ff->buf_base + ff->buf_rlen) {
+  802603:	01 c2                	add    %eax,%edx
+  802605:	39 d7                	cmp    %edx,%edi
+  802607:	72 28                	jb     802631 <devfile_read+0x6a>
+		ff->buf_rlen = 0;
+  802609:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+		if (n >= FILEBUF_SIZE)
+  802610:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  802616:	77 74                	ja     80268c <devfile_read+0xc5>
+		if ((r = file_read_direct(fd, p, FILEBUF_SIZE)) <= 0)
+  802618:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80261d:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802620:	89 d8                	mov    %ebx,%eax
+  802622:	e8 a5 fe ff ff       	call   8024cc <file_read_direct>
+  802627:	85 c0                	test   %eax,%eax
+  802629:	7e 35                	jle    802660 <devfile_read+0x99>
+		ff->buf_base = pos;
+  80262b:	89 7b 14             	mov    %edi,0x14(%ebx)
+		ff->buf_rlen = r;
+  80262e:	89 43 18             	mov    %eax,0x18(%ebx)
+	n = MIN(n, ff->buf_base + ff->buf_rlen - pos);
+  802631:	8b 53 14             	mov    0x14(%ebx),%edx
+  802634:	89 d0                	mov    %edx,%eax
+  802636:	03 43 18             	add    0x18(%ebx),%eax
+  802639:	29 f8                	sub    %edi,%eax
+  80263b:	39 f0                	cmp    %esi,%eax
+  80263d:	0f 46 f0             	cmovbe %eax,%esi
+	memmove(buf, p + (pos - ff->buf_base), n);
+  802640:	83 ec 04             	sub    $0x4,%esp
+  802643:	56                   	push   %esi
+  802644:	89 f8                	mov    %edi,%eax
+  802646:	29 d0                	sub    %edx,%eax
+  802648:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  80264b:	01 c1                	add    %eax,%ecx
+  80264d:	51                   	push   %ecx
+  80264e:	ff 75 0c             	push   0xc(%ebp)
+  802651:	e8 24 ec ff ff       	call   80127a <memmove>
+	fd->fd_offset = pos + n;
+  802656:	01 f7                	add    %esi,%edi
+  802658:	89 7b 04             	mov    %edi,0x4(%ebx)
+	return n;
+  80265b:	89 f0                	mov    %esi,%eax
+  80265d:	83 c4 10             	add    $0x10,%esp
+}
+  802660:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802663:	5b                   	pop    %ebx
+  802664:	5e                   	pop    %esi
+  802665:	5f                   	pop    %edi
+  802666:	5d                   	pop    %ebp
+  802667:	c3                   	ret
+		return file_read_direct(fd, buf, n);
+  802668:	89 f1                	mov    %esi,%ecx
+  80266a:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80266d:	89 d8                	mov    %ebx,%eax
+  80266f:	e8 58 fe ff ff       	call   8024cc <file_read_direct>
+  802674:	eb ea                	jmp    802660 <devfile_read+0x99>
+	if (ff->buf_wlen > 0 && (r = devfile_sync(fd)) < 0)
+  802676:	83 ec 0c             	sub    $0xc,%esp
+  802679:	53                   	push   %ebx
+  80267a:	e8 db fa ff ff       	call   80215a <devfile_sync>
+  80267f:	83 c4 10             	add    $0x10,%esp
+  802682:	85 c0                	test   %eax,%eax
+  802684:	0f 89 6b ff ff ff    	jns    8025f5 <devfile_read+0x2e>
+  80268a:	eb d4                	jmp    802660 <devfile_read+0x99>
+			return file_read_direct(fd, buf, n);
+  80268c:	89 f1                	mov    %esi,%ecx
+  80268e:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802691:	89 d8                	mov    %ebx,%eax
+  802693:	e8 34 fe ff ff       	call   8024cc <file_read_direct>
+  802698:	eb c6                	jmp    802660 <devfile_read+0x99>
+
+0080269a <open>:
+{
+  80269a:	55                   	push   %ebp
+  80269b:	89 e5                	mov    %esp,%ebp
+  80269d:	56                   	push   %esi
+  80269e:	53                   	push   %ebx
+  80269f:	83 ec 1c             	sub    $0x1c,%esp
+  8026a2:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  8026a5:	56                   	push   %esi
+  8026a6:	e8 0e ea ff ff       	call   8010b9 <strlen>
+  8026ab:	83 c4 10             	add    $0x10,%esp
+  8026ae:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8026b3:	0f 8f a0 00 00 00    	jg     802759 <open+0xbf>
+	if ((r = fd_alloc(&fd)) < 0)
+  8026b9:	83 ec 0c             	sub    $0xc,%esp
+  8026bc:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8026bf:	50                   	push   %eax
+  8026c0:	e8 63 f2 ff ff       	call   801928 <fd_alloc>
+  8026c5:	89 c3                	mov    %eax,%ebx
+  8026c7:	83 c4 10             	add    $0x10,%esp
+  8026ca:	85 c0                	test   %eax,%eax
+  8026cc:	78 45                	js     802713 <open+0x79>
+	strcpy(fsipcbuf.open.req_path, path);
+  8026ce:	83 ec 08             	sub    $0x8,%esp
+  8026d1:	56                   	push   %esi
+  8026d2:	68 00 e0 82 00       	push   $0x82e000
+  8026d7:	e8 18 ea ff ff       	call   8010f4 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  8026dc:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8026df:	a3 00 e4 82 00       	mov    %eax,0x82e400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  8026e4:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8026e7:	b8 01 00 00 00       	mov    $0x1,%eax
+  8026ec:	e8 c5 f9 ff ff       	call   8020b6 <fsipc>
+  8026f1:	89 c3                	mov    %eax,%ebx
+  8026f3:	83 c4 10             	add    $0x10,%esp
+  8026f6:	85 c0                	test   %eax,%eax
+  8026f8:	78 22                	js     80271c <open+0x82>
+	if (!(mode & O_NOBUF)
+  8026fa:	f7 45 0c 00 10 00 00 	testl  $0x1000,0xc(%ebp)
+  802701:	74 2b                	je     80272e <open+0x94>
+	return fd2num(fd);
+  802703:	83 ec 0c             	sub    $0xc,%esp
+  802706:	ff 75 f4             	push   -0xc(%ebp)
+  802709:	e8 f3 f1 ff ff       	call   801901 <fd2num>
+  80270e:	89 c3                	mov    %eax,%ebx
+  802710:	83 c4 10             	add    $0x10,%esp
+}
+  802713:	89 d8                	mov    %ebx,%eax
+  802715:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802718:	5b                   	pop    %ebx
+  802719:	5e                   	pop    %esi
+  80271a:	5d                   	pop    %ebp
+  80271b:	c3                   	ret
+		fd_close(fd, 0);
+  80271c:	83 ec 08             	sub    $0x8,%esp
+  80271f:	6a 00                	push   $0x0
+  802721:	ff 75 f4             	push   -0xc(%ebp)
+  802724:	e8 f8 f2 ff ff       	call   801a21 <fd_close>
+		return r;
+  802729:	83 c4 10             	add    $0x10,%esp
+  80272c:	eb e5                	jmp    802713 <open+0x79>
+	    && sys_page_alloc(0, fd2data(fd), PTE_P|PTE_U|PTE_W|PTE_SHARE) == 0)
+  80272e:	83 ec 0c             	sub    $0xc,%esp
+  802731:	ff 75 f4             	push   -0xc(%ebp)
+  802734:	e8 d8 f1 ff ff       	call   801911 <fd2data>
+  802739:	83 c4 0c             	add    $0xc,%esp
+  80273c:	68 07 04 00 00       	push   $0x407
+  802741:	50                   	push   %eax
+  802742:	6a 00                	push   $0x0
+  802744:	e8 b7 ed ff ff       	call   801500 <sys_page_alloc>
+  802749:	83 c4 10             	add    $0x10,%esp
+  80274c:	85 c0                	test   %eax,%eax
+  80274e:	75 b3                	jne    802703 <open+0x69>
+		fd->fd_file.buffered = 1;
+  802750:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802753:	c6 40 10 01          	movb   $0x1,0x10(%eax)
+  802757:	eb aa                	jmp    802703 <open+0x69>
+		return -E_BAD_PATH;
+  802759:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  80275e:	eb b3                	jmp    802713 <open+0x79>
+
+00802760 <readdir>:
+{
+  802760:	55                   	push   %ebp
+  802761:	89 e5                	mov    %esp,%ebp
+  802763:	53                   	push   %ebx
+  802764:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802767:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80276a:	50                   	push   %eax
+  80276b:	ff 75 08             	push   0x8(%ebp)
+  80276e:	e8 0b f2 ff ff       	call   80197e <fd_lookup>
+  802773:	89 c3                	mov    %eax,%ebx
+  802775:	83 c4 10             	add    $0x10,%esp
+  802778:	85 c0                	test   %eax,%eax
+  80277a:	78 73                	js     8027ef <readdir+0x8f>
+	if (fd->fd_dev_id != devfile.dev_id)
+  80277c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80277f:	8b 0d 20 50 80 00    	mov    0x805020,%ecx
+  802785:	39 08                	cmp    %ecx,(%eax)
+  802787:	0f 85 82 00 00 00    	jne    80280f <readdir+0xaf>
+	if ((r = devfile_sync(fd)) < 0)
+  80278d:	83 ec 0c             	sub    $0xc,%esp
+  802790:	50                   	push   %eax
+  802791:	e8 c4 f9 ff ff       	call   80215a <devfile_sync>
+  802796:	89 c3                	mov    %eax,%ebx
+  802798:	83 c4 10             	add    $0x10,%esp
+  80279b:	85 c0                	test   %eax,%eax
+  80279d:	78 50                	js     8027ef <readdir+0x8f>
+	fsipcbuf.readdir.req_fileid = fd->fd_file.id;
+  80279f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8027a2:	8b 40 0c             	mov    0xc(%eax),%eax
+  8027a5:	a3 00 e0 82 00       	mov    %eax,0x82e000
+	fsipcbuf.readdir.req_n = n;
+  8027aa:	8b 45 10             	mov    0x10(%ebp),%eax
+  8027ad:	a3 04 e0 82 00       	mov    %eax,0x82e004
+	fsipcbuf.readdir.req_flags = flags;
+  8027b2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8027b5:	a3 08 e0 82 00       	mov    %eax,0x82e008
+	if ((r = fsipc(FSREQ_READDIR, NULL)) <= 0)
+  8027ba:	ba 00 00 00 00       	mov    $0x0,%edx
+  8027bf:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8027c4:	e8 ed f8 ff ff       	call   8020b6 <fsipc>
+  8027c9:	89 c3                	mov    %eax,%ebx
+  8027cb:	85 c0                	test   %eax,%eax
+  8027cd:	7e 20                	jle    8027ef <readdir+0x8f>
+	assert(r <= n && r <= PGSIZE);
+  8027cf:	39 45 10             	cmp    %eax,0x10(%ebp)
+  8027d2:	72 22                	jb     8027f6 <readdir+0x96>
+  8027d4:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  8027d9:	7f 1b                	jg     8027f6 <readdir+0x96>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  8027db:	83 ec 04             	sub    $0x4,%esp
+  8027de:	50                   	push   %eax
+  8027df:	68 00 e0 82 00       	push   $0x82e000
+  8027e4:	ff 75 0c             	push   0xc(%ebp)
+  8027e7:	e8 8e ea ff ff       	call   80127a <memmove>
+	return r;
+  8027ec:	83 c4 10             	add    $0x10,%esp
+}
+  8027ef:	89 d8                	mov    %ebx,%eax
+  8027f1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8027f4:	c9                   	leave
+  8027f5:	c3                   	ret
+	assert(r <= n && r <= PGSIZE);
+  8027f6:	68 e7 49 80 00       	push   $0x8049e7
+  8027fb:	68 c0 49 80 00       	push   $0x8049c0
+  802800:	68 86 01 00 00       	push   $0x186
+  802805:	68 d5 49 80 00       	push   $0x8049d5
+  80280a:	e8 1c e2 ff ff       	call   800a2b <_panic>
+		return -E_NOT_SUPP;
+  80280f:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  802814:	eb d9                	jmp    8027ef <readdir+0x8f>
+
+00802816 <munmap>:
+{
+  802816:	55                   	push   %ebp
+  802817:	89 e5                	mov    %esp,%ebp
+  802819:	56                   	push   %esi
+  80281a:	53                   	push   %ebx
+  80281b:	8b 75 08             	mov    0x8(%ebp),%esi
+  80281e:	8b 55 0c             	mov    0xc(%ebp),%edx
+	if (PGOFF(addr) || (uintptr_t) addr >= UTOP || len > UTOP - (uintptr_t) addr)
+  802821:	f7 c6 ff 0f 00 00    	test   $0xfff,%esi
+  802827:	75 41                	jne    80286a <munmap+0x54>
+  802829:	81 fe ff ff bf ee    	cmp    $0xeebfffff,%esi
+  80282f:	77 39                	ja     80286a <munmap+0x54>
+  802831:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  802836:	29 f0                	sub    %esi,%eax
+  802838:	39 d0                	cmp    %edx,%eax
+  80283a:	72 35                	jb     802871 <munmap+0x5b>
+	for (va = (uintptr_t) addr; va < (uintptr_t) addr + len; va += PGSIZE)
+  80283c:	89 f3                	mov    %esi,%ebx
+  80283e:	01 d6                	add    %edx,%esi
+  802840:	39 f3                	cmp    %esi,%ebx
+  802842:	73 1a                	jae    80285e <munmap+0x48>
+		if ((r = sys_page_unmap(0, (void *) va)) < 0)
+  802844:	83 ec 08             	sub    $0x8,%esp
+  802847:	53                   	push   %ebx
+  802848:	6a 00                	push   $0x0
+  80284a:	e8 3e ed ff ff       	call   80158d <sys_page_unmap>
+  80284f:	83 c4 10             	add    $0x10,%esp
+  802852:	85 c0                	test   %eax,%eax
+  802854:	78 0d                	js     802863 <munmap+0x4d>
+	for (va = (uintptr_t) addr; va < (uintptr_t) addr + len; va += PGSIZE)
+  802856:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  80285c:	eb e2                	jmp    802840 <munmap+0x2a>
+	return 0;
+  80285e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802863:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802866:	5b                   	pop    %ebx
+  802867:	5e                   	pop    %esi
+  802868:	5d                   	pop    %ebp
+  802869:	c3                   	ret
+		return -E_INVAL;
+  80286a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80286f:	eb f2                	jmp    802863 <munmap+0x4d>
+  802871:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802876:	eb eb                	jmp    802863 <munmap+0x4d>
+
+00802878 <mmap>:
+{
+  802878:	55                   	push   %ebp
+  802879:	89 e5                	mov    %esp,%ebp
+  80287b:	57                   	push   %edi
+  80287c:	56                   	push   %esi
+  80287d:	53                   	push   %ebx
+  80287e:	83 ec 34             	sub    $0x34,%esp
+  802881:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802884:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  802887:	50                   	push   %eax
+  802888:	ff 75 18             	push   0x18(%ebp)
+  80288b:	e8 ee f0 ff ff       	call   80197e <fd_lookup>
+  802890:	89 c3                	mov    %eax,%ebx
+  802892:	83 c4 10             	add    $0x10,%esp
+  802895:	85 c0                	test   %eax,%eax
+  802897:	0f 88 0e 01 00 00    	js     8029ab <mmap+0x133>
+	if (fd->fd_dev_id != devfile.dev_id)
+  80289d:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8028a0:	a1 20 50 80 00       	mov    0x805020,%eax
+  8028a5:	39 02                	cmp    %eax,(%edx)
+  8028a7:	0f 85 50 01 00 00    	jne    8029fd <mmap+0x185>
+	if ((prot & PROT_WRITE) && !(flags & MAP_PRIVATE))
+  8028ad:	8b 45 10             	mov    0x10(%ebp),%eax
+  8028b0:	83 e0 02             	and    $0x2,%eax
+  8028b3:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  8028b6:	74 0a                	je     8028c2 <mmap+0x4a>
+  8028b8:	f6 45 14 02          	testb  $0x2,0x14(%ebp)
+  8028bc:	0f 84 42 01 00 00    	je     802a04 <mmap+0x18c>
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY
+  8028c2:	8b 42 08             	mov    0x8(%edx),%eax
+  8028c5:	83 e0 03             	and    $0x3,%eax
+  8028c8:	83 f8 01             	cmp    $0x1,%eax
+  8028cb:	0f 84 3a 01 00 00    	je     802a0b <mmap+0x193>
+	    || PGOFF(addr) || PGOFF(offset) || offset < 0
+  8028d1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8028d4:	0b 45 1c             	or     0x1c(%ebp),%eax
+  8028d7:	25 ff 0f 00 00       	and    $0xfff,%eax
+  8028dc:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8028df:	0f 85 2d 01 00 00    	jne    802a12 <mmap+0x19a>
+	    || (uintptr_t) addr >= UTOP || len > UTOP - (uintptr_t) addr)
+  8028e5:	83 7d 1c 00          	cmpl   $0x0,0x1c(%ebp)
+  8028e9:	0f 88 2a 01 00 00    	js     802a19 <mmap+0x1a1>
+  8028ef:	81 7d 08 ff ff bf ee 	cmpl   $0xeebfffff,0x8(%ebp)
+  8028f6:	0f 87 1d 01 00 00    	ja     802a19 <mmap+0x1a1>
+  8028fc:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  802901:	2b 45 08             	sub    0x8(%ebp),%eax
+  802904:	39 f8                	cmp    %edi,%eax
+  802906:	0f 82 14 01 00 00    	jb     802a20 <mmap+0x1a8>
+	if ((r = devfile_sync(fd)) < 0)
+  80290c:	83 ec 0c             	sub    $0xc,%esp
+  80290f:	52                   	push   %edx
+  802910:	e8 45 f8 ff ff       	call   80215a <devfile_sync>
+  802915:	89 c3                	mov    %eax,%ebx
+  802917:	83 c4 10             	add    $0x10,%esp
+  80291a:	85 c0                	test   %eax,%eax
+  80291c:	0f 88 89 00 00 00    	js     8029ab <mmap+0x133>
+	len = ROUNDUP(len, PGSIZE);
+  802922:	81 c7 ff 0f 00 00    	add    $0xfff,%edi
+  802928:	81 e7 00 f0 ff ff    	and    $0xfffff000,%edi
+	for (done = 0; done < len; done += n * PGSIZE) {
+  80292e:	be 00 00 00 00       	mov    $0x0,%esi
+  802933:	8b 5d 1c             	mov    0x1c(%ebp),%ebx
+  802936:	39 fe                	cmp    %edi,%esi
+  802938:	73 7b                	jae    8029b5 <mmap+0x13d>
+		n = MIN((len - done) / PGSIZE, FSBULK_MAXPAGES);
+  80293a:	89 f8                	mov    %edi,%eax
+  80293c:	29 f0                	sub    %esi,%eax
+  80293e:	c1 e8 0c             	shr    $0xc,%eax
+  802941:	ba 40 00 00 00       	mov    $0x40,%edx
+  802946:	39 d0                	cmp    %edx,%eax
+  802948:	0f 47 c2             	cmova  %edx,%eax
+  80294b:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		fsipcbuf.map.req_fileid = fd->fd_file.id;
+  80294e:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802951:	8b 52 0c             	mov    0xc(%edx),%edx
+  802954:	89 15 00 e0 82 00    	mov    %edx,0x82e000
+		fsipcbuf.map.req_offset = offset + done;
+  80295a:	8d 14 33             	lea    (%ebx,%esi,1),%edx
+  80295d:	89 15 04 e0 82 00    	mov    %edx,0x82e004
+		fsipcbuf.map.req_npages = n;
+  802963:	a3 08 e0 82 00       	mov    %eax,0x82e008
+		if ((r = fsipcv(FSREQ_MAP, addr + done, &n)) <= 0 || n == 0) {
+  802968:	89 f2                	mov    %esi,%edx
+  80296a:	03 55 08             	add    0x8(%ebp),%edx
+  80296d:	8d 4d e0             	lea    -0x20(%ebp),%ecx
+  802970:	b8 0b 00 00 00       	mov    $0xb,%eax
+  802975:	e8 ea f6 ff ff       	call   802064 <fsipcv>
+  80297a:	85 c0                	test   %eax,%eax
+  80297c:	7e 12                	jle    802990 <mmap+0x118>
+  80297e:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802981:	85 c0                	test   %eax,%eax
+  802983:	0f 84 9e 00 00 00    	je     802a27 <mmap+0x1af>
+	for (done = 0; done < len; done += n * PGSIZE) {
+  802989:	c1 e0 0c             	shl    $0xc,%eax
+  80298c:	01 c6                	add    %eax,%esi
+  80298e:	eb a6                	jmp    802936 <mmap+0xbe>
+			munmap(addr, done);
+  802990:	89 c3                	mov    %eax,%ebx
+  802992:	83 ec 08             	sub    $0x8,%esp
+  802995:	56                   	push   %esi
+  802996:	ff 75 08             	push   0x8(%ebp)
+  802999:	e8 78 fe ff ff       	call   802816 <munmap>
+			return r < 0 ? r : -E_INVAL;
+  80299e:	83 c4 10             	add    $0x10,%esp
+  8029a1:	85 db                	test   %ebx,%ebx
+  8029a3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8029a8:	0f 49 d8             	cmovns %eax,%ebx
+}
+  8029ab:	89 d8                	mov    %ebx,%eax
+  8029ad:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8029b0:	5b                   	pop    %ebx
+  8029b1:	5e                   	pop    %esi
+  8029b2:	5f                   	pop    %edi
+  8029b3:	5d                   	pop    %ebp
+  8029b4:	c3                   	ret
+	if (prot & PROT_WRITE)
+  8029b5:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+	return 0;
+  8029b8:	89 c3                	mov    %eax,%ebx
+	if (prot & PROT_WRITE)
+  8029ba:	85 c0                	test   %eax,%eax
+  8029bc:	74 ed                	je     8029ab <mmap+0x133>
+		for (done = 0; done < len; done += PGSIZE)
+  8029be:	be 00 00 00 00       	mov    $0x0,%esi
+  8029c3:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8029c6:	39 fe                	cmp    %edi,%esi
+  8029c8:	73 2e                	jae    8029f8 <mmap+0x180>
+			if ((r = cowpage(addr + done)) < 0) {
+  8029ca:	83 ec 0c             	sub    $0xc,%esp
+  8029cd:	8d 04 33             	lea    (%ebx,%esi,1),%eax
+  8029d0:	50                   	push   %eax
+  8029d1:	e8 fd 0f 00 00       	call   8039d3 <cowpage>
+  8029d6:	83 c4 10             	add    $0x10,%esp
+  8029d9:	85 c0                	test   %eax,%eax
+  8029db:	78 08                	js     8029e5 <mmap+0x16d>
+		for (done = 0; done < len; done += PGSIZE)
+  8029dd:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  8029e3:	eb e1                	jmp    8029c6 <mmap+0x14e>
+				munmap(addr, len);
+  8029e5:	89 c3                	mov    %eax,%ebx
+  8029e7:	83 ec 08             	sub    $0x8,%esp
+  8029ea:	57                   	push   %edi
+  8029eb:	ff 75 08             	push   0x8(%ebp)
+  8029ee:	e8 23 fe ff ff       	call   802816 <munmap>
+				return r;
+  8029f3:	83 c4 10             	add    $0x10,%esp
+  8029f6:	eb b3                	jmp    8029ab <mmap+0x133>
+	return 0;
+  8029f8:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  8029fb:	eb ae                	jmp    8029ab <mmap+0x133>
+		return -E_NOT_SUPP;
+  8029fd:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  802a02:	eb a7                	jmp    8029ab <mmap+0x133>
+		return -E_NOT_SUPP;
+  802a04:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  802a09:	eb a0                	jmp    8029ab <mmap+0x133>
+		return -E_INVAL;
+  802a0b:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  802a10:	eb 99                	jmp    8029ab <mmap+0x133>
+  802a12:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  802a17:	eb 92                	jmp    8029ab <mmap+0x133>
+  802a19:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  802a1e:	eb 8b                	jmp    8029ab <mmap+0x133>
+  802a20:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  802a25:	eb 84                	jmp    8029ab <mmap+0x133>
+			munmap(addr, done);
+  802a27:	83 ec 08             	sub    $0x8,%esp
+  802a2a:	56                   	push   %esi
+  802a2b:	ff 75 08             	push   0x8(%ebp)
+  802a2e:	e8 e3 fd ff ff       	call   802816 <munmap>
+  802a33:	83 c4 10             	add    $0x10,%esp
+			return r < 0 ? r : -E_INVAL;
+  802a36:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  802a3b:	e9 6b ff ff ff       	jmp    8029ab <mmap+0x133>
+
+00802a40 <fsring_read>:
+// buf.  fsring_reap returns 'tag' with the result once done.
+// Returns 0 on success, < 0 on error; -E_NO_MEM means too many requests
+// are outstanding, and some must be reaped first.
+int
+fsring_read(int fdnum, void *buf, size_t n, off_t offset, uint32_t tag)
+{
+  802a40:	55                   	push   %ebp
+  802a41:	89 e5                	mov    %esp,%ebp
+  802a43:	56                   	push   %esi
+  802a44:	53                   	push   %ebx
+  802a45:	83 ec 10             	sub    $0x10,%esp
+  802a48:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	struct Fd *fd;
+	int slot;
+
+	if ((slot = fsring_slot(fdnum, &fd)) < 0)
+  802a4b:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802a4e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a51:	e8 3d f9 ff ff       	call   802393 <fsring_slot>
+  802a56:	85 c0                	test   %eax,%eax
+  802a58:	78 60                	js     802aba <fsring_read+0x7a>
+		return slot;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY)
+  802a5a:	8b 75 f4             	mov    -0xc(%ebp),%esi
+  802a5d:	8b 56 08             	mov    0x8(%esi),%edx
+  802a60:	83 e2 03             	and    $0x3,%edx
+  802a63:	83 fa 01             	cmp    $0x1,%edx
+  802a66:	74 59                	je     802ac1 <fsring_read+0x81>
+		return -E_INVAL;
+	fsring_busy |= 1 << slot;
+  802a68:	ba 01 00 00 00       	mov    $0x1,%edx
+  802a6d:	89 c1                	mov    %eax,%ecx
+  802a6f:	d3 e2                	shl    %cl,%edx
+  802a71:	09 15 c0 f0 82 00    	or     %edx,0x82f0c0
+	fsring_slots[slot].s_type = FSREQ_READ;
+  802a77:	8d 14 40             	lea    (%eax,%eax,2),%edx
+  802a7a:	c1 e2 02             	shl    $0x2,%edx
+  802a7d:	8d 8a 00 f0 82 00    	lea    0x82f000(%edx),%ecx
+  802a83:	c7 82 00 f0 82 00 03 	movl   $0x3,0x82f000(%edx)
+  802a8a:	00 00 00 
+	fsring_slots[slot].s_tag = tag;
+  802a8d:	8b 55 18             	mov    0x18(%ebp),%edx
+  802a90:	89 51 04             	mov    %edx,0x4(%ecx)
+	fsring_slots[slot].s_buf = buf;
+  802a93:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802a96:	89 51 08             	mov    %edx,0x8(%ecx)
+	return fsring_post(FSREQ_READ, fd, offset, MIN(n, PGSIZE), slot);
+  802a99:	83 ec 08             	sub    $0x8,%esp
+  802a9c:	50                   	push   %eax
+  802a9d:	b8 00 10 00 00       	mov    $0x1000,%eax
+  802aa2:	39 c3                	cmp    %eax,%ebx
+  802aa4:	0f 47 d8             	cmova  %eax,%ebx
+  802aa7:	53                   	push   %ebx
+  802aa8:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  802aab:	89 f2                	mov    %esi,%edx
+  802aad:	b8 03 00 00 00       	mov    $0x3,%eax
+  802ab2:	e8 1e f5 ff ff       	call   801fd5 <fsring_post>
+  802ab7:	83 c4 10             	add    $0x10,%esp
+}
+  802aba:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802abd:	5b                   	pop    %ebx
+  802abe:	5e                   	pop    %esi
+  802abf:	5d                   	pop    %ebp
+  802ac0:	c3                   	ret
+		return -E_INVAL;
+  802ac1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802ac6:	eb f2                	jmp    802aba <fsring_read+0x7a>
+
+00802ac8 <fsring_write>:
+// Start writing up to n bytes (at most a page) from buf at 'offset' of
+// fdnum.  buf may be reused as soon as this returns.
+// Returns as fsring_read.
+int
+fsring_write(int fdnum, const void *buf, size_t n, off_t offset, uint32_t tag)
+{
+  802ac8:	55                   	push   %ebp
+  802ac9:	89 e5                	mov    %esp,%ebp
+  802acb:	56                   	push   %esi
+  802acc:	53                   	push   %ebx
+  802acd:	83 ec 10             	sub    $0x10,%esp
+  802ad0:	8b 75 10             	mov    0x10(%ebp),%esi
+	struct Fd *fd;
+	int slot;
+
+	if ((slot = fsring_slot(fdnum, &fd)) < 0)
+  802ad3:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802ad6:	8b 45 08             	mov    0x8(%ebp),%eax
+  802ad9:	e8 b5 f8 ff ff       	call   802393 <fsring_slot>
+  802ade:	89 c3                	mov    %eax,%ebx
+  802ae0:	85 c0                	test   %eax,%eax
+  802ae2:	78 77                	js     802b5b <fsring_write+0x93>
+		return slot;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY)
+  802ae4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802ae7:	f6 40 08 03          	testb  $0x3,0x8(%eax)
+  802aeb:	74 77                	je     802b64 <fsring_write+0x9c>
+		return -E_INVAL;
+	n = MIN(n, PGSIZE);
+  802aed:	b8 00 10 00 00       	mov    $0x1000,%eax
+  802af2:	39 c6                	cmp    %eax,%esi
+  802af4:	0f 47 f0             	cmova  %eax,%esi
+	memmove((char *) fsring + (1 + slot) * PGSIZE, buf, n);
+  802af7:	83 ec 04             	sub    $0x4,%esp
+  802afa:	56                   	push   %esi
+  802afb:	ff 75 0c             	push   0xc(%ebp)
+  802afe:	89 d8                	mov    %ebx,%eax
+  802b00:	c1 e0 0c             	shl    $0xc,%eax
+  802b03:	8d 80 00 10 00 cf    	lea    -0x30fff000(%eax),%eax
+  802b09:	50                   	push   %eax
+  802b0a:	e8 6b e7 ff ff       	call   80127a <memmove>
+	fsring_busy |= 1 << slot;
+  802b0f:	b8 01 00 00 00       	mov    $0x1,%eax
+  802b14:	89 d9                	mov    %ebx,%ecx
+  802b16:	d3 e0                	shl    %cl,%eax
+  802b18:	09 05 c0 f0 82 00    	or     %eax,0x82f0c0
+	fsring_slots[slot].s_type = FSREQ_WRITE;
+  802b1e:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  802b21:	c1 e0 02             	shl    $0x2,%eax
+  802b24:	8d 90 00 f0 82 00    	lea    0x82f000(%eax),%edx
+  802b2a:	c7 80 00 f0 82 00 04 	movl   $0x4,0x82f000(%eax)
+  802b31:	00 00 00 
+	fsring_slots[slot].s_tag = tag;
+  802b34:	8b 45 18             	mov    0x18(%ebp),%eax
+  802b37:	89 42 04             	mov    %eax,0x4(%edx)
+	fsring_slots[slot].s_buf = NULL;
+  802b3a:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	return fsring_post(FSREQ_WRITE, fd, offset, n, slot);
+  802b41:	83 c4 08             	add    $0x8,%esp
+  802b44:	53                   	push   %ebx
+  802b45:	56                   	push   %esi
+  802b46:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  802b49:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802b4c:	b8 04 00 00 00       	mov    $0x4,%eax
+  802b51:	e8 7f f4 ff ff       	call   801fd5 <fsring_post>
+  802b56:	89 c3                	mov    %eax,%ebx
+  802b58:	83 c4 10             	add    $0x10,%esp
+}
+  802b5b:	89 d8                	mov    %ebx,%eax
+  802b5d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802b60:	5b                   	pop    %ebx
+  802b61:	5e                   	pop    %esi
+  802b62:	5d                   	pop    %ebp
+  802b63:	c3                   	ret
+		return -E_INVAL;
+  802b64:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  802b69:	eb f0                	jmp    802b5b <fsring_write+0x93>
+
+00802b6b <fsring_stat>:
+
+// Start a stat of fdnum into *st.  Returns as fsring_read.
+int
+fsring_stat(int fdnum, struct Stat *st, uint32_t tag)
+{
+  802b6b:	55                   	push   %ebp
+  802b6c:	89 e5                	mov    %esp,%ebp
+  802b6e:	83 ec 18             	sub    $0x18,%esp
+	struct Fd *fd;
+	int slot;
+
+	if ((slot = fsring_slot(fdnum, &fd)) < 0)
+  802b71:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802b74:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b77:	e8 17 f8 ff ff       	call   802393 <fsring_slot>
+  802b7c:	85 c0                	test   %eax,%eax
+  802b7e:	78 4c                	js     802bcc <fsring_stat+0x61>
+		return slot;
+	fsring_busy |= 1 << slot;
+  802b80:	ba 01 00 00 00       	mov    $0x1,%edx
+  802b85:	89 c1                	mov    %eax,%ecx
+  802b87:	d3 e2                	shl    %cl,%edx
+  802b89:	09 15 c0 f0 82 00    	or     %edx,0x82f0c0
+	fsring_slots[slot].s_type = FSREQ_STAT;
+  802b8f:	8d 14 40             	lea    (%eax,%eax,2),%edx
+  802b92:	c1 e2 02             	shl    $0x2,%edx
+  802b95:	8d 8a 00 f0 82 00    	lea    0x82f000(%edx),%ecx
+  802b9b:	c7 82 00 f0 82 00 05 	movl   $0x5,0x82f000(%edx)
+  802ba2:	00 00 00 
+	fsring_slots[slot].s_tag = tag;
+  802ba5:	8b 55 10             	mov    0x10(%ebp),%edx
+  802ba8:	89 51 04             	mov    %edx,0x4(%ecx)
+	fsring_slots[slot].s_buf = st;
+  802bab:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802bae:	89 51 08             	mov    %edx,0x8(%ecx)
+	return fsring_post(FSREQ_STAT, fd, 0, 0, slot);
+  802bb1:	83 ec 08             	sub    $0x8,%esp
+  802bb4:	50                   	push   %eax
+  802bb5:	6a 00                	push   $0x0
+  802bb7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802bbc:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802bbf:	b8 05 00 00 00       	mov    $0x5,%eax
+  802bc4:	e8 0c f4 ff ff       	call   801fd5 <fsring_post>
+  802bc9:	83 c4 10             	add    $0x10,%esp
+}
+  802bcc:	c9                   	leave
+  802bcd:	c3                   	ret
+
+00802bce <fsring_reap>:
+// If none has finished, wait for one if 'wait' is set and any are
+// outstanding.
+// Returns 1 if a result was collected, 0 if not.
+int
+fsring_reap(uint32_t *tag_store, int *result_store, bool wait)
+{
+  802bce:	55                   	push   %ebp
+  802bcf:	89 e5                	mov    %esp,%ebp
+  802bd1:	57                   	push   %edi
+  802bd2:	56                   	push   %esi
+  802bd3:	53                   	push   %ebx
+  802bd4:	83 ec 1c             	sub    $0x1c,%esp
+  802bd7:	0f b6 5d 10          	movzbl 0x10(%ebp),%ebx
+	struct Fsring_cqe cqe;
+	struct Fsret_stat *ret;
+	struct Stat *st;
+	char *data;
+
+	if (fsring_env != thisenv->env_id)
+  802bdb:	a1 30 db 82 00       	mov    0x82db30,%eax
+  802be0:	8b 40 48             	mov    0x48(%eax),%eax
+  802be3:	3b 05 c4 f0 82 00    	cmp    0x82f0c4,%eax
+  802be9:	74 12                	je     802bfd <fsring_reap+0x2f>
+		return 0;
+  802beb:	b8 00 00 00 00       	mov    $0x0,%eax
+	}
+	fsring_busy &= ~(1 << cqe.cqe_slot);
+	*tag_store = fsring_slots[cqe.cqe_slot].s_tag;
+	*result_store = cqe.cqe_result;
+	return 1;
+}
+  802bf0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802bf3:	5b                   	pop    %ebx
+  802bf4:	5e                   	pop    %esi
+  802bf5:	5f                   	pop    %edi
+  802bf6:	5d                   	pop    %ebp
+  802bf7:	c3                   	ret
+		sys_yield();
+  802bf8:	e8 e4 e8 ff ff       	call   8014e1 <sys_yield>
+	while (fsring->r_cqhead == fsring->r_cqtail) {
+  802bfd:	8b 15 08 00 00 cf    	mov    0xcf000008,%edx
+  802c03:	a1 0c 00 00 cf       	mov    0xcf00000c,%eax
+  802c08:	39 c2                	cmp    %eax,%edx
+  802c0a:	75 18                	jne    802c24 <fsring_reap+0x56>
+		if (!wait || fsring_busy == 0)
+  802c0c:	84 db                	test   %bl,%bl
+  802c0e:	0f 84 21 01 00 00    	je     802d35 <fsring_reap+0x167>
+  802c14:	83 3d c0 f0 82 00 00 	cmpl   $0x0,0x82f0c0
+  802c1b:	75 db                	jne    802bf8 <fsring_reap+0x2a>
+			return 0;
+  802c1d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c22:	eb cc                	jmp    802bf0 <fsring_reap+0x22>
+	cqe = fsring->r_cq[fsring->r_cqhead % FSRING_NSLOTS];
+  802c24:	a1 08 00 00 cf       	mov    0xcf000008,%eax
+  802c29:	83 e0 0f             	and    $0xf,%eax
+  802c2c:	83 c0 2a             	add    $0x2a,%eax
+  802c2f:	8b 1c c5 00 00 00 cf 	mov    -0x31000000(,%eax,8),%ebx
+  802c36:	8b 3c c5 04 00 00 cf 	mov    -0x30fffffc(,%eax,8),%edi
+	fsring->r_cqhead++;
+  802c3d:	a1 08 00 00 cf       	mov    0xcf000008,%eax
+  802c42:	83 c0 01             	add    $0x1,%eax
+  802c45:	a3 08 00 00 cf       	mov    %eax,0xcf000008
+	if (cqe.cqe_slot >= FSRING_NSLOTS || !(fsring_busy & (1 << cqe.cqe_slot)))
+  802c4a:	83 fb 0f             	cmp    $0xf,%ebx
+  802c4d:	77 5b                	ja     802caa <fsring_reap+0xdc>
+  802c4f:	be 01 00 00 00       	mov    $0x1,%esi
+  802c54:	89 d9                	mov    %ebx,%ecx
+  802c56:	d3 e6                	shl    %cl,%esi
+  802c58:	89 f0                	mov    %esi,%eax
+  802c5a:	23 05 c0 f0 82 00    	and    0x82f0c0,%eax
+  802c60:	74 48                	je     802caa <fsring_reap+0xdc>
+	data = (char *) fsring + (1 + cqe.cqe_slot) * PGSIZE;
+  802c62:	89 d8                	mov    %ebx,%eax
+  802c64:	c1 e0 0c             	shl    $0xc,%eax
+  802c67:	8d 80 00 10 00 cf    	lea    -0x30fff000(%eax),%eax
+  802c6d:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	switch (fsring_slots[cqe.cqe_slot].s_type) {
+  802c70:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  802c73:	8b 04 85 00 f0 82 00 	mov    0x82f000(,%eax,4),%eax
+  802c7a:	83 f8 03             	cmp    $0x3,%eax
+  802c7d:	74 40                	je     802cbf <fsring_reap+0xf1>
+  802c7f:	83 f8 05             	cmp    $0x5,%eax
+  802c82:	74 64                	je     802ce8 <fsring_reap+0x11a>
+	fsring_busy &= ~(1 << cqe.cqe_slot);
+  802c84:	f7 d6                	not    %esi
+  802c86:	21 35 c0 f0 82 00    	and    %esi,0x82f0c0
+	*tag_store = fsring_slots[cqe.cqe_slot].s_tag;
+  802c8c:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  802c8f:	8b 14 85 04 f0 82 00 	mov    0x82f004(,%eax,4),%edx
+  802c96:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c99:	89 10                	mov    %edx,(%eax)
+	*result_store = cqe.cqe_result;
+  802c9b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802c9e:	89 38                	mov    %edi,(%eax)
+	return 1;
+  802ca0:	b8 01 00 00 00       	mov    $0x1,%eax
+  802ca5:	e9 46 ff ff ff       	jmp    802bf0 <fsring_reap+0x22>
+		panic("fsring_reap: bad slot %u", cqe.cqe_slot);
+  802caa:	53                   	push   %ebx
+  802cab:	68 fd 49 80 00       	push   $0x8049fd
+  802cb0:	68 8f 02 00 00       	push   $0x28f
+  802cb5:	68 d5 49 80 00       	push   $0x8049d5
+  802cba:	e8 6c dd ff ff       	call   800a2b <_panic>
+		if (cqe.cqe_result > 0)
+  802cbf:	85 ff                	test   %edi,%edi
+  802cc1:	7e c1                	jle    802c84 <fsring_reap+0xb6>
+			memmove(fsring_slots[cqe.cqe_slot].s_buf, data,
+  802cc3:	83 ec 04             	sub    $0x4,%esp
+				MIN(cqe.cqe_result, PGSIZE));
+  802cc6:	b8 00 10 00 00       	mov    $0x1000,%eax
+  802ccb:	39 c7                	cmp    %eax,%edi
+  802ccd:	0f 4e c7             	cmovle %edi,%eax
+			memmove(fsring_slots[cqe.cqe_slot].s_buf, data,
+  802cd0:	50                   	push   %eax
+  802cd1:	ff 75 e4             	push   -0x1c(%ebp)
+  802cd4:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  802cd7:	ff 34 85 08 f0 82 00 	push   0x82f008(,%eax,4)
+  802cde:	e8 97 e5 ff ff       	call   80127a <memmove>
+  802ce3:	83 c4 10             	add    $0x10,%esp
+  802ce6:	eb 9c                	jmp    802c84 <fsring_reap+0xb6>
+		if (cqe.cqe_result == 0) {
+  802ce8:	85 ff                	test   %edi,%edi
+  802cea:	75 98                	jne    802c84 <fsring_reap+0xb6>
+			st = fsring_slots[cqe.cqe_slot].s_buf;
+  802cec:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  802cef:	8b 0c 85 08 f0 82 00 	mov    0x82f008(,%eax,4),%ecx
+			strcpy(st->st_name, ret->ret_name);
+  802cf6:	83 ec 08             	sub    $0x8,%esp
+  802cf9:	ff 75 e4             	push   -0x1c(%ebp)
+  802cfc:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  802cff:	51                   	push   %ecx
+  802d00:	e8 ef e3 ff ff       	call   8010f4 <strcpy>
+			st->st_size = ret->ret_size;
+  802d05:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802d08:	8b 82 80 00 00 00    	mov    0x80(%edx),%eax
+  802d0e:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  802d11:	89 81 80 00 00 00    	mov    %eax,0x80(%ecx)
+			st->st_isdir = ret->ret_isdir;
+  802d17:	8b 82 84 00 00 00    	mov    0x84(%edx),%eax
+  802d1d:	89 81 84 00 00 00    	mov    %eax,0x84(%ecx)
+			st->st_dev = &devfile;
+  802d23:	c7 81 88 00 00 00 20 	movl   $0x805020,0x88(%ecx)
+  802d2a:	50 80 00 
+  802d2d:	83 c4 10             	add    $0x10,%esp
+  802d30:	e9 4f ff ff ff       	jmp    802c84 <fsring_reap+0xb6>
+			return 0;
+  802d35:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d3a:	e9 b1 fe ff ff       	jmp    802bf0 <fsring_reap+0x22>
+
+00802d3f <file_slurp>:
+// page are copied through fsipcbuf; larger ones go straight into buf's
+// pages, and stop at FSBULK_MAXPAGES of them.
+// Returns the number of bytes read, 0 for directories, or < 0 on error.
+ssize_t
+file_slurp(const char *path, void *buf, size_t n, struct Stat *st)
+{
+  802d3f:	55                   	push   %ebp
+  802d40:	89 e5                	mov    %esp,%ebp
+  802d42:	57                   	push   %edi
+  802d43:	56                   	push   %esi
+  802d44:	53                   	push   %ebx
+  802d45:	83 ec 28             	sub    $0x28,%esp
+  802d48:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802d4b:	8b 7d 10             	mov    0x10(%ebp),%edi
+  802d4e:	8b 75 14             	mov    0x14(%ebp),%esi
+	const char *name;
+	int r;
+
+	if (strlen(path) >= MAXPATHLEN)
+  802d51:	53                   	push   %ebx
+  802d52:	e8 62 e3 ff ff       	call   8010b9 <strlen>
+  802d57:	83 c4 10             	add    $0x10,%esp
+  802d5a:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802d5f:	0f 8f 02 01 00 00    	jg     802e67 <file_slurp+0x128>
+		return -E_BAD_PATH;
+
+	strcpy(fsipcbuf.slurp.req_path, path);
+  802d65:	83 ec 08             	sub    $0x8,%esp
+  802d68:	53                   	push   %ebx
+  802d69:	68 00 e0 82 00       	push   $0x82e000
+  802d6e:	e8 81 e3 ff ff       	call   8010f4 <strcpy>
+	if (n > sizeof(fsipcbuf.slurpRet.ret_buf)) {
+  802d73:	83 c4 10             	add    $0x10,%esp
+  802d76:	81 ff f8 0f 00 00    	cmp    $0xff8,%edi
+  802d7c:	76 69                	jbe    802de7 <file_slurp+0xa8>
+		n = MIN(n, FSBULK_MAXPAGES * PGSIZE - PGOFF(buf));
+  802d7e:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802d81:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  802d87:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  802d8c:	29 d1                	sub    %edx,%ecx
+  802d8e:	39 f9                	cmp    %edi,%ecx
+  802d90:	0f 46 f9             	cmovbe %ecx,%edi
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  802d93:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802d96:	89 f9                	mov    %edi,%ecx
+  802d98:	01 c1                	add    %eax,%ecx
+  802d9a:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  802d9d:	eb 0f                	jmp    802dae <file_slurp+0x6f>
+		*(volatile char *) p = *(volatile char *) p;
+  802d9f:	0f b6 10             	movzbl (%eax),%edx
+  802da2:	88 10                	mov    %dl,(%eax)
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  802da4:	05 00 10 00 00       	add    $0x1000,%eax
+  802da9:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  802dae:	39 c8                	cmp    %ecx,%eax
+  802db0:	72 ed                	jb     802d9f <file_slurp+0x60>
+		fsipc_touch(buf, n);
+		fsipcbuf.slurp.req_n = n;
+  802db2:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802db5:	89 3d 00 e4 82 00    	mov    %edi,0x82e400
+		fsipcbuf.slurp.req_off = PGOFF(buf);
+  802dbb:	89 15 04 e4 82 00    	mov    %edx,0x82e404
+		r = fsipc_pages(FSREQ_SLURP, buf, n, PTE_P | PTE_W | PTE_U);
+  802dc1:	83 ec 0c             	sub    $0xc,%esp
+  802dc4:	6a 07                	push   $0x7
+  802dc6:	89 f9                	mov    %edi,%ecx
+  802dc8:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802dcb:	b8 0f 00 00 00       	mov    $0xf,%eax
+  802dd0:	e8 3f f1 ff ff       	call   801f14 <fsipc_pages>
+  802dd5:	89 c7                	mov    %eax,%edi
+  802dd7:	83 c4 10             	add    $0x10,%esp
+			memmove(buf, fsipcbuf.slurpRet.ret_buf, r);
+	}
+	if (r < 0)
+		return r;
+
+	if (st) {
+  802dda:	85 f6                	test   %esi,%esi
+  802ddc:	74 7f                	je     802e5d <file_slurp+0x11e>
+  802dde:	8d 43 01             	lea    0x1(%ebx),%eax
+  802de1:	85 ff                	test   %edi,%edi
+  802de3:	79 3c                	jns    802e21 <file_slurp+0xe2>
+  802de5:	eb 76                	jmp    802e5d <file_slurp+0x11e>
+		fsipcbuf.slurp.req_n = n;
+  802de7:	89 3d 00 e4 82 00    	mov    %edi,0x82e400
+		if ((r = fsipc(FSREQ_SLURP, NULL)) > 0)
+  802ded:	ba 00 00 00 00       	mov    $0x0,%edx
+  802df2:	b8 0f 00 00 00       	mov    $0xf,%eax
+  802df7:	e8 ba f2 ff ff       	call   8020b6 <fsipc>
+  802dfc:	89 c7                	mov    %eax,%edi
+  802dfe:	85 c0                	test   %eax,%eax
+  802e00:	7e d8                	jle    802dda <file_slurp+0x9b>
+			memmove(buf, fsipcbuf.slurpRet.ret_buf, r);
+  802e02:	83 ec 04             	sub    $0x4,%esp
+  802e05:	50                   	push   %eax
+  802e06:	68 08 e0 82 00       	push   $0x82e008
+  802e0b:	ff 75 0c             	push   0xc(%ebp)
+  802e0e:	e8 67 e4 ff ff       	call   80127a <memmove>
+  802e13:	83 c4 10             	add    $0x10,%esp
+  802e16:	eb c2                	jmp    802dda <file_slurp+0x9b>
+		for (name = path; *path; path++)
+			if (*path == '/')
+				name = path + 1;
+  802e18:	80 fa 2f             	cmp    $0x2f,%dl
+  802e1b:	0f 44 d9             	cmove  %ecx,%ebx
+		for (name = path; *path; path++)
+  802e1e:	83 c0 01             	add    $0x1,%eax
+  802e21:	89 c1                	mov    %eax,%ecx
+  802e23:	0f b6 50 ff          	movzbl -0x1(%eax),%edx
+  802e27:	84 d2                	test   %dl,%dl
+  802e29:	75 ed                	jne    802e18 <file_slurp+0xd9>
+		strlcpy(st->st_name, name, sizeof(st->st_name));
+  802e2b:	83 ec 04             	sub    $0x4,%esp
+  802e2e:	68 80 00 00 00       	push   $0x80
+  802e33:	53                   	push   %ebx
+  802e34:	56                   	push   %esi
+  802e35:	e8 30 e3 ff ff       	call   80116a <strlcpy>
+		st->st_size = fsipcbuf.slurpRet.ret_size;
+  802e3a:	a1 00 e0 82 00       	mov    0x82e000,%eax
+  802e3f:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+		st->st_isdir = fsipcbuf.slurpRet.ret_isdir;
+  802e45:	a1 04 e0 82 00       	mov    0x82e004,%eax
+  802e4a:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+		st->st_dev = &devfile;
+  802e50:	c7 86 88 00 00 00 20 	movl   $0x805020,0x88(%esi)
+  802e57:	50 80 00 
+  802e5a:	83 c4 10             	add    $0x10,%esp
+	}
+	return r;
+}
+  802e5d:	89 f8                	mov    %edi,%eax
+  802e5f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802e62:	5b                   	pop    %ebx
+  802e63:	5e                   	pop    %esi
+  802e64:	5f                   	pop    %edi
+  802e65:	5d                   	pop    %ebp
+  802e66:	c3                   	ret
+		return -E_BAD_PATH;
+  802e67:	bf f4 ff ff ff       	mov    $0xfffffff4,%edi
+  802e6c:	eb ef                	jmp    802e5d <file_slurp+0x11e>
+
+00802e6e <remove>:
+
+// Delete a file
+int
+remove(const char *path)
+{
+  802e6e:	55                   	push   %ebp
+  802e6f:	89 e5                	mov    %esp,%ebp
+  802e71:	53                   	push   %ebx
+  802e72:	83 ec 10             	sub    $0x10,%esp
+  802e75:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (strlen(path) >= MAXPATHLEN)
+  802e78:	53                   	push   %ebx
+  802e79:	e8 3b e2 ff ff       	call   8010b9 <strlen>
+  802e7e:	83 c4 10             	add    $0x10,%esp
+  802e81:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802e86:	7f 25                	jg     802ead <remove+0x3f>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.remove.req_path, path);
+  802e88:	83 ec 08             	sub    $0x8,%esp
+  802e8b:	53                   	push   %ebx
+  802e8c:	68 00 e0 82 00       	push   $0x82e000
+  802e91:	e8 5e e2 ff ff       	call   8010f4 <strcpy>
+	return fsipc(FSREQ_REMOVE, NULL);
+  802e96:	ba 00 00 00 00       	mov    $0x0,%edx
+  802e9b:	b8 07 00 00 00       	mov    $0x7,%eax
+  802ea0:	e8 11 f2 ff ff       	call   8020b6 <fsipc>
+  802ea5:	83 c4 10             	add    $0x10,%esp
+}
+  802ea8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802eab:	c9                   	leave
+  802eac:	c3                   	ret
+		return -E_BAD_PATH;
+  802ead:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  802eb2:	eb f4                	jmp    802ea8 <remove+0x3a>
+
+00802eb4 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  802eb4:	55                   	push   %ebp
+  802eb5:	89 e5                	mov    %esp,%ebp
+  802eb7:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  802eba:	ba 00 00 00 00       	mov    $0x0,%edx
+  802ebf:	b8 08 00 00 00       	mov    $0x8,%eax
+  802ec4:	e8 ed f1 ff ff       	call   8020b6 <fsipc>
+}
+  802ec9:	c9                   	leave
+  802eca:	c3                   	ret
+
+00802ecb <defrag>:
+// Have the file server lay out the blocks of 'path' contiguously on
+// disk.  Stores the number of extents the file had before and has
+// after in *before and *after, if they are not null.
+int
+defrag(const char *path, uint32_t *before, uint32_t *after)
+{
+  802ecb:	55                   	push   %ebp
+  802ecc:	89 e5                	mov    %esp,%ebp
+  802ece:	57                   	push   %edi
+  802ecf:	56                   	push   %esi
+  802ed0:	53                   	push   %ebx
+  802ed1:	83 ec 18             	sub    $0x18,%esp
+  802ed4:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802ed7:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802eda:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int r;
+
+	if (strlen(path) >= MAXPATHLEN)
+  802edd:	57                   	push   %edi
+  802ede:	e8 d6 e1 ff ff       	call   8010b9 <strlen>
+  802ee3:	83 c4 10             	add    $0x10,%esp
+  802ee6:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802eeb:	7f 4c                	jg     802f39 <defrag+0x6e>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.defrag.req_path, path);
+  802eed:	83 ec 08             	sub    $0x8,%esp
+  802ef0:	57                   	push   %edi
+  802ef1:	68 00 e0 82 00       	push   $0x82e000
+  802ef6:	e8 f9 e1 ff ff       	call   8010f4 <strcpy>
+	if ((r = fsipc(FSREQ_DEFRAG, NULL)) < 0)
+  802efb:	ba 00 00 00 00       	mov    $0x0,%edx
+  802f00:	b8 10 00 00 00       	mov    $0x10,%eax
+  802f05:	e8 ac f1 ff ff       	call   8020b6 <fsipc>
+  802f0a:	83 c4 10             	add    $0x10,%esp
+  802f0d:	85 c0                	test   %eax,%eax
+  802f0f:	78 20                	js     802f31 <defrag+0x66>
+		return r;
+	if (before)
+  802f11:	85 f6                	test   %esi,%esi
+  802f13:	74 07                	je     802f1c <defrag+0x51>
+		*before = fsipcbuf.defragRet.ret_before;
+  802f15:	a1 00 e0 82 00       	mov    0x82e000,%eax
+  802f1a:	89 06                	mov    %eax,(%esi)
+	if (after)
+		*after = fsipcbuf.defragRet.ret_after;
+	return 0;
+  802f1c:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (after)
+  802f21:	85 db                	test   %ebx,%ebx
+  802f23:	74 0c                	je     802f31 <defrag+0x66>
+		*after = fsipcbuf.defragRet.ret_after;
+  802f25:	a1 04 e0 82 00       	mov    0x82e004,%eax
+  802f2a:	89 03                	mov    %eax,(%ebx)
+	return 0;
+  802f2c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802f31:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802f34:	5b                   	pop    %ebx
+  802f35:	5e                   	pop    %esi
+  802f36:	5f                   	pop    %edi
+  802f37:	5d                   	pop    %ebp
+  802f38:	c3                   	ret
+		return -E_BAD_PATH;
+  802f39:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  802f3e:	eb f1                	jmp    802f31 <defrag+0x66>
+
+00802f40 <fs_bcstats>:
+
+// Copy the file server's block cache statistics into *st.
+int
+fs_bcstats(struct BcStats *st)
+{
+  802f40:	55                   	push   %ebp
+  802f41:	89 e5                	mov    %esp,%ebp
+  802f43:	53                   	push   %ebx
+  802f44:	83 ec 04             	sub    $0x4,%esp
+  802f47:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if ((r = fsipc(FSREQ_BCSTATS, NULL)) < 0)
+  802f4a:	ba 00 00 00 00       	mov    $0x0,%edx
+  802f4f:	b8 11 00 00 00       	mov    $0x11,%eax
+  802f54:	e8 5d f1 ff ff       	call   8020b6 <fsipc>
+  802f59:	85 c0                	test   %eax,%eax
+  802f5b:	78 34                	js     802f91 <fs_bcstats+0x51>
+		return r;
+	*st = fsipcbuf.bcstatsRet;
+  802f5d:	a1 00 e0 82 00       	mov    0x82e000,%eax
+  802f62:	89 03                	mov    %eax,(%ebx)
+  802f64:	a1 04 e0 82 00       	mov    0x82e004,%eax
+  802f69:	89 43 04             	mov    %eax,0x4(%ebx)
+  802f6c:	a1 08 e0 82 00       	mov    0x82e008,%eax
+  802f71:	89 43 08             	mov    %eax,0x8(%ebx)
+  802f74:	a1 0c e0 82 00       	mov    0x82e00c,%eax
+  802f79:	89 43 0c             	mov    %eax,0xc(%ebx)
+  802f7c:	a1 10 e0 82 00       	mov    0x82e010,%eax
+  802f81:	89 43 10             	mov    %eax,0x10(%ebx)
+  802f84:	a1 14 e0 82 00       	mov    0x82e014,%eax
+  802f89:	89 43 14             	mov    %eax,0x14(%ebx)
+	return 0;
+  802f8c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802f91:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802f94:	c9                   	leave
+  802f95:	c3                   	ret
+
+00802f96 <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  802f96:	55                   	push   %ebp
+  802f97:	89 e5                	mov    %esp,%ebp
+  802f99:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  802f9c:	68 16 4a 80 00       	push   $0x804a16
+  802fa1:	ff 75 0c             	push   0xc(%ebp)
+  802fa4:	e8 4b e1 ff ff       	call   8010f4 <strcpy>
+	return 0;
+}
+  802fa9:	b8 00 00 00 00       	mov    $0x0,%eax
+  802fae:	c9                   	leave
+  802faf:	c3                   	ret
+
+00802fb0 <devsock_close>:
+{
+  802fb0:	55                   	push   %ebp
+  802fb1:	89 e5                	mov    %esp,%ebp
+  802fb3:	53                   	push   %ebx
+  802fb4:	83 ec 10             	sub    $0x10,%esp
+  802fb7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  802fba:	53                   	push   %ebx
+  802fbb:	e8 f4 0d 00 00       	call   803db4 <pageref>
+  802fc0:	89 c2                	mov    %eax,%edx
+  802fc2:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  802fc5:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  802fca:	83 fa 01             	cmp    $0x1,%edx
+  802fcd:	74 05                	je     802fd4 <devsock_close+0x24>
+}
+  802fcf:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802fd2:	c9                   	leave
+  802fd3:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  802fd4:	83 ec 0c             	sub    $0xc,%esp
+  802fd7:	ff 73 0c             	push   0xc(%ebx)
+  802fda:	e8 b7 02 00 00       	call   803296 <nsipc_close>
+  802fdf:	83 c4 10             	add    $0x10,%esp
+  802fe2:	eb eb                	jmp    802fcf <devsock_close+0x1f>
+
+00802fe4 <devsock_write>:
+{
+  802fe4:	55                   	push   %ebp
+  802fe5:	89 e5                	mov    %esp,%ebp
+  802fe7:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  802fea:	6a 00                	push   $0x0
+  802fec:	ff 75 10             	push   0x10(%ebp)
+  802fef:	ff 75 0c             	push   0xc(%ebp)
+  802ff2:	8b 45 08             	mov    0x8(%ebp),%eax
+  802ff5:	ff 70 0c             	push   0xc(%eax)
+  802ff8:	e8 79 03 00 00       	call   803376 <nsipc_send>
+}
+  802ffd:	c9                   	leave
+  802ffe:	c3                   	ret
+
+00802fff <devsock_read>:
+{
+  802fff:	55                   	push   %ebp
+  803000:	89 e5                	mov    %esp,%ebp
+  803002:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  803005:	6a 00                	push   $0x0
+  803007:	ff 75 10             	push   0x10(%ebp)
+  80300a:	ff 75 0c             	push   0xc(%ebp)
+  80300d:	8b 45 08             	mov    0x8(%ebp),%eax
+  803010:	ff 70 0c             	push   0xc(%eax)
+  803013:	e8 ef 02 00 00       	call   803307 <nsipc_recv>
+}
+  803018:	c9                   	leave
+  803019:	c3                   	ret
+
+0080301a <fd2sockid>:
+{
+  80301a:	55                   	push   %ebp
+  80301b:	89 e5                	mov    %esp,%ebp
+  80301d:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  803020:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  803023:	52                   	push   %edx
+  803024:	50                   	push   %eax
+  803025:	e8 54 e9 ff ff       	call   80197e <fd_lookup>
+  80302a:	83 c4 10             	add    $0x10,%esp
+  80302d:	85 c0                	test   %eax,%eax
+  80302f:	78 10                	js     803041 <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  803031:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803034:	8b 0d 40 50 80 00    	mov    0x805040,%ecx
+  80303a:	39 08                	cmp    %ecx,(%eax)
+  80303c:	75 05                	jne    803043 <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  80303e:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  803041:	c9                   	leave
+  803042:	c3                   	ret
+		return -E_NOT_SUPP;
+  803043:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  803048:	eb f7                	jmp    803041 <fd2sockid+0x27>
+
+0080304a <alloc_sockfd>:
+{
+  80304a:	55                   	push   %ebp
+  80304b:	89 e5                	mov    %esp,%ebp
+  80304d:	56                   	push   %esi
+  80304e:	53                   	push   %ebx
+  80304f:	83 ec 1c             	sub    $0x1c,%esp
+  803052:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  803054:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803057:	50                   	push   %eax
+  803058:	e8 cb e8 ff ff       	call   801928 <fd_alloc>
+  80305d:	89 c3                	mov    %eax,%ebx
+  80305f:	83 c4 10             	add    $0x10,%esp
+  803062:	85 c0                	test   %eax,%eax
+  803064:	78 43                	js     8030a9 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  803066:	83 ec 04             	sub    $0x4,%esp
+  803069:	68 07 04 00 00       	push   $0x407
+  80306e:	ff 75 f4             	push   -0xc(%ebp)
+  803071:	6a 00                	push   $0x0
+  803073:	e8 88 e4 ff ff       	call   801500 <sys_page_alloc>
+  803078:	89 c3                	mov    %eax,%ebx
+  80307a:	83 c4 10             	add    $0x10,%esp
+  80307d:	85 c0                	test   %eax,%eax
+  80307f:	78 28                	js     8030a9 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  803081:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803084:	8b 15 40 50 80 00    	mov    0x805040,%edx
+  80308a:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  80308c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80308f:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  803096:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  803099:	83 ec 0c             	sub    $0xc,%esp
+  80309c:	50                   	push   %eax
+  80309d:	e8 5f e8 ff ff       	call   801901 <fd2num>
+  8030a2:	89 c3                	mov    %eax,%ebx
+  8030a4:	83 c4 10             	add    $0x10,%esp
+  8030a7:	eb 0c                	jmp    8030b5 <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  8030a9:	83 ec 0c             	sub    $0xc,%esp
+  8030ac:	56                   	push   %esi
+  8030ad:	e8 e4 01 00 00       	call   803296 <nsipc_close>
+		return r;
+  8030b2:	83 c4 10             	add    $0x10,%esp
+}
+  8030b5:	89 d8                	mov    %ebx,%eax
+  8030b7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8030ba:	5b                   	pop    %ebx
+  8030bb:	5e                   	pop    %esi
+  8030bc:	5d                   	pop    %ebp
+  8030bd:	c3                   	ret
+
+008030be <accept>:
+{
+  8030be:	55                   	push   %ebp
+  8030bf:	89 e5                	mov    %esp,%ebp
+  8030c1:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8030c4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8030c7:	e8 4e ff ff ff       	call   80301a <fd2sockid>
+  8030cc:	85 c0                	test   %eax,%eax
+  8030ce:	78 1b                	js     8030eb <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  8030d0:	83 ec 04             	sub    $0x4,%esp
+  8030d3:	ff 75 10             	push   0x10(%ebp)
+  8030d6:	ff 75 0c             	push   0xc(%ebp)
+  8030d9:	50                   	push   %eax
+  8030da:	e8 0e 01 00 00       	call   8031ed <nsipc_accept>
+  8030df:	83 c4 10             	add    $0x10,%esp
+  8030e2:	85 c0                	test   %eax,%eax
+  8030e4:	78 05                	js     8030eb <accept+0x2d>
+	return alloc_sockfd(r);
+  8030e6:	e8 5f ff ff ff       	call   80304a <alloc_sockfd>
+}
+  8030eb:	c9                   	leave
+  8030ec:	c3                   	ret
+
+008030ed <bind>:
+{
+  8030ed:	55                   	push   %ebp
+  8030ee:	89 e5                	mov    %esp,%ebp
+  8030f0:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8030f3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8030f6:	e8 1f ff ff ff       	call   80301a <fd2sockid>
+  8030fb:	85 c0                	test   %eax,%eax
+  8030fd:	78 12                	js     803111 <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  8030ff:	83 ec 04             	sub    $0x4,%esp
+  803102:	ff 75 10             	push   0x10(%ebp)
+  803105:	ff 75 0c             	push   0xc(%ebp)
+  803108:	50                   	push   %eax
+  803109:	e8 31 01 00 00       	call   80323f <nsipc_bind>
+  80310e:	83 c4 10             	add    $0x10,%esp
+}
+  803111:	c9                   	leave
+  803112:	c3                   	ret
+
+00803113 <shutdown>:
+{
+  803113:	55                   	push   %ebp
+  803114:	89 e5                	mov    %esp,%ebp
+  803116:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  803119:	8b 45 08             	mov    0x8(%ebp),%eax
+  80311c:	e8 f9 fe ff ff       	call   80301a <fd2sockid>
+  803121:	85 c0                	test   %eax,%eax
+  803123:	78 0f                	js     803134 <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  803125:	83 ec 08             	sub    $0x8,%esp
+  803128:	ff 75 0c             	push   0xc(%ebp)
+  80312b:	50                   	push   %eax
+  80312c:	e8 43 01 00 00       	call   803274 <nsipc_shutdown>
+  803131:	83 c4 10             	add    $0x10,%esp
+}
+  803134:	c9                   	leave
+  803135:	c3                   	ret
+
+00803136 <connect>:
+{
+  803136:	55                   	push   %ebp
+  803137:	89 e5                	mov    %esp,%ebp
+  803139:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  80313c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80313f:	e8 d6 fe ff ff       	call   80301a <fd2sockid>
+  803144:	85 c0                	test   %eax,%eax
+  803146:	78 12                	js     80315a <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  803148:	83 ec 04             	sub    $0x4,%esp
+  80314b:	ff 75 10             	push   0x10(%ebp)
+  80314e:	ff 75 0c             	push   0xc(%ebp)
+  803151:	50                   	push   %eax
+  803152:	e8 59 01 00 00       	call   8032b0 <nsipc_connect>
+  803157:	83 c4 10             	add    $0x10,%esp
+}
+  80315a:	c9                   	leave
+  80315b:	c3                   	ret
+
+0080315c <listen>:
+{
+  80315c:	55                   	push   %ebp
+  80315d:	89 e5                	mov    %esp,%ebp
+  80315f:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  803162:	8b 45 08             	mov    0x8(%ebp),%eax
+  803165:	e8 b0 fe ff ff       	call   80301a <fd2sockid>
+  80316a:	85 c0                	test   %eax,%eax
+  80316c:	78 0f                	js     80317d <listen+0x21>
+	return nsipc_listen(r, backlog);
+  80316e:	83 ec 08             	sub    $0x8,%esp
+  803171:	ff 75 0c             	push   0xc(%ebp)
+  803174:	50                   	push   %eax
+  803175:	e8 6b 01 00 00       	call   8032e5 <nsipc_listen>
+  80317a:	83 c4 10             	add    $0x10,%esp
+}
+  80317d:	c9                   	leave
+  80317e:	c3                   	ret
+
+0080317f <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  80317f:	55                   	push   %ebp
+  803180:	89 e5                	mov    %esp,%ebp
+  803182:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  803185:	ff 75 10             	push   0x10(%ebp)
+  803188:	ff 75 0c             	push   0xc(%ebp)
+  80318b:	ff 75 08             	push   0x8(%ebp)
+  80318e:	e8 41 02 00 00       	call   8033d4 <nsipc_socket>
+  803193:	83 c4 10             	add    $0x10,%esp
+  803196:	85 c0                	test   %eax,%eax
+  803198:	78 05                	js     80319f <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  80319a:	e8 ab fe ff ff       	call   80304a <alloc_sockfd>
+}
+  80319f:	c9                   	leave
+  8031a0:	c3                   	ret
+
+008031a1 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  8031a1:	55                   	push   %ebp
+  8031a2:	89 e5                	mov    %esp,%ebp
+  8031a4:	53                   	push   %ebx
+  8031a5:	83 ec 04             	sub    $0x4,%esp
+  8031a8:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  8031aa:	83 3d 00 10 83 00 00 	cmpl   $0x0,0x831000
+  8031b1:	74 26                	je     8031d9 <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  8031b3:	6a 07                	push   $0x7
+  8031b5:	68 00 00 83 00       	push   $0x830000
+  8031ba:	53                   	push   %ebx
+  8031bb:	ff 35 00 10 83 00    	push   0x831000
+  8031c1:	e8 76 0a 00 00       	call   803c3c <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  8031c6:	83 c4 0c             	add    $0xc,%esp
+  8031c9:	6a 00                	push   $0x0
+  8031cb:	6a 00                	push   $0x0
+  8031cd:	6a 00                	push   $0x0
+  8031cf:	e8 fd 09 00 00       	call   803bd1 <ipc_recv>
+}
+  8031d4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8031d7:	c9                   	leave
+  8031d8:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  8031d9:	83 ec 0c             	sub    $0xc,%esp
+  8031dc:	6a 02                	push   $0x2
+  8031de:	e8 92 0b 00 00       	call   803d75 <ipc_find_env>
+  8031e3:	a3 00 10 83 00       	mov    %eax,0x831000
+  8031e8:	83 c4 10             	add    $0x10,%esp
+  8031eb:	eb c6                	jmp    8031b3 <nsipc+0x12>
+
+008031ed <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  8031ed:	55                   	push   %ebp
+  8031ee:	89 e5                	mov    %esp,%ebp
+  8031f0:	56                   	push   %esi
+  8031f1:	53                   	push   %ebx
+  8031f2:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  8031f5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8031f8:	a3 00 00 83 00       	mov    %eax,0x830000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  8031fd:	8b 06                	mov    (%esi),%eax
+  8031ff:	a3 04 00 83 00       	mov    %eax,0x830004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  803204:	b8 01 00 00 00       	mov    $0x1,%eax
+  803209:	e8 93 ff ff ff       	call   8031a1 <nsipc>
+  80320e:	89 c3                	mov    %eax,%ebx
+  803210:	85 c0                	test   %eax,%eax
+  803212:	79 09                	jns    80321d <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  803214:	89 d8                	mov    %ebx,%eax
+  803216:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803219:	5b                   	pop    %ebx
+  80321a:	5e                   	pop    %esi
+  80321b:	5d                   	pop    %ebp
+  80321c:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  80321d:	83 ec 04             	sub    $0x4,%esp
+  803220:	ff 35 10 00 83 00    	push   0x830010
+  803226:	68 00 00 83 00       	push   $0x830000
+  80322b:	ff 75 0c             	push   0xc(%ebp)
+  80322e:	e8 47 e0 ff ff       	call   80127a <memmove>
+		*addrlen = ret->ret_addrlen;
+  803233:	a1 10 00 83 00       	mov    0x830010,%eax
+  803238:	89 06                	mov    %eax,(%esi)
+  80323a:	83 c4 10             	add    $0x10,%esp
+	return r;
+  80323d:	eb d5                	jmp    803214 <nsipc_accept+0x27>
+
+0080323f <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  80323f:	55                   	push   %ebp
+  803240:	89 e5                	mov    %esp,%ebp
+  803242:	53                   	push   %ebx
+  803243:	83 ec 08             	sub    $0x8,%esp
+  803246:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  803249:	8b 45 08             	mov    0x8(%ebp),%eax
+  80324c:	a3 00 00 83 00       	mov    %eax,0x830000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  803251:	53                   	push   %ebx
+  803252:	ff 75 0c             	push   0xc(%ebp)
+  803255:	68 04 00 83 00       	push   $0x830004
+  80325a:	e8 1b e0 ff ff       	call   80127a <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  80325f:	89 1d 14 00 83 00    	mov    %ebx,0x830014
+	return nsipc(NSREQ_BIND);
+  803265:	b8 02 00 00 00       	mov    $0x2,%eax
+  80326a:	e8 32 ff ff ff       	call   8031a1 <nsipc>
+}
+  80326f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803272:	c9                   	leave
+  803273:	c3                   	ret
+
+00803274 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  803274:	55                   	push   %ebp
+  803275:	89 e5                	mov    %esp,%ebp
+  803277:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  80327a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80327d:	a3 00 00 83 00       	mov    %eax,0x830000
+	nsipcbuf.shutdown.req_how = how;
+  803282:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803285:	a3 04 00 83 00       	mov    %eax,0x830004
+	return nsipc(NSREQ_SHUTDOWN);
+  80328a:	b8 03 00 00 00       	mov    $0x3,%eax
+  80328f:	e8 0d ff ff ff       	call   8031a1 <nsipc>
+}
+  803294:	c9                   	leave
+  803295:	c3                   	ret
+
+00803296 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  803296:	55                   	push   %ebp
+  803297:	89 e5                	mov    %esp,%ebp
+  803299:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  80329c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80329f:	a3 00 00 83 00       	mov    %eax,0x830000
+	return nsipc(NSREQ_CLOSE);
+  8032a4:	b8 04 00 00 00       	mov    $0x4,%eax
+  8032a9:	e8 f3 fe ff ff       	call   8031a1 <nsipc>
+}
+  8032ae:	c9                   	leave
+  8032af:	c3                   	ret
+
+008032b0 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  8032b0:	55                   	push   %ebp
+  8032b1:	89 e5                	mov    %esp,%ebp
+  8032b3:	53                   	push   %ebx
+  8032b4:	83 ec 08             	sub    $0x8,%esp
+  8032b7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  8032ba:	8b 45 08             	mov    0x8(%ebp),%eax
+  8032bd:	a3 00 00 83 00       	mov    %eax,0x830000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  8032c2:	53                   	push   %ebx
+  8032c3:	ff 75 0c             	push   0xc(%ebp)
+  8032c6:	68 04 00 83 00       	push   $0x830004
+  8032cb:	e8 aa df ff ff       	call   80127a <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  8032d0:	89 1d 14 00 83 00    	mov    %ebx,0x830014
+	return nsipc(NSREQ_CONNECT);
+  8032d6:	b8 05 00 00 00       	mov    $0x5,%eax
+  8032db:	e8 c1 fe ff ff       	call   8031a1 <nsipc>
+}
+  8032e0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8032e3:	c9                   	leave
+  8032e4:	c3                   	ret
+
+008032e5 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  8032e5:	55                   	push   %ebp
+  8032e6:	89 e5                	mov    %esp,%ebp
+  8032e8:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  8032eb:	8b 45 08             	mov    0x8(%ebp),%eax
+  8032ee:	a3 00 00 83 00       	mov    %eax,0x830000
+	nsipcbuf.listen.req_backlog = backlog;
+  8032f3:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8032f6:	a3 04 00 83 00       	mov    %eax,0x830004
+	return nsipc(NSREQ_LISTEN);
+  8032fb:	b8 06 00 00 00       	mov    $0x6,%eax
+  803300:	e8 9c fe ff ff       	call   8031a1 <nsipc>
+}
+  803305:	c9                   	leave
+  803306:	c3                   	ret
+
+00803307 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  803307:	55                   	push   %ebp
+  803308:	89 e5                	mov    %esp,%ebp
+  80330a:	56                   	push   %esi
+  80330b:	53                   	push   %ebx
+  80330c:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  80330f:	8b 45 08             	mov    0x8(%ebp),%eax
+  803312:	a3 00 00 83 00       	mov    %eax,0x830000
+	nsipcbuf.recv.req_len = len;
+  803317:	89 35 04 00 83 00    	mov    %esi,0x830004
+	nsipcbuf.recv.req_flags = flags;
+  80331d:	8b 45 14             	mov    0x14(%ebp),%eax
+  803320:	a3 08 00 83 00       	mov    %eax,0x830008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  803325:	b8 07 00 00 00       	mov    $0x7,%eax
+  80332a:	e8 72 fe ff ff       	call   8031a1 <nsipc>
+  80332f:	89 c3                	mov    %eax,%ebx
+  803331:	85 c0                	test   %eax,%eax
+  803333:	78 22                	js     803357 <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  803335:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  80333a:	39 c6                	cmp    %eax,%esi
+  80333c:	0f 4e c6             	cmovle %esi,%eax
+  80333f:	39 c3                	cmp    %eax,%ebx
+  803341:	7f 1d                	jg     803360 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  803343:	83 ec 04             	sub    $0x4,%esp
+  803346:	53                   	push   %ebx
+  803347:	68 00 00 83 00       	push   $0x830000
+  80334c:	ff 75 0c             	push   0xc(%ebp)
+  80334f:	e8 26 df ff ff       	call   80127a <memmove>
+  803354:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  803357:	89 d8                	mov    %ebx,%eax
+  803359:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80335c:	5b                   	pop    %ebx
+  80335d:	5e                   	pop    %esi
+  80335e:	5d                   	pop    %ebp
+  80335f:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  803360:	68 22 4a 80 00       	push   $0x804a22
+  803365:	68 c0 49 80 00       	push   $0x8049c0
+  80336a:	6a 62                	push   $0x62
+  80336c:	68 37 4a 80 00       	push   $0x804a37
+  803371:	e8 b5 d6 ff ff       	call   800a2b <_panic>
+
+00803376 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  803376:	55                   	push   %ebp
+  803377:	89 e5                	mov    %esp,%ebp
+  803379:	53                   	push   %ebx
+  80337a:	83 ec 04             	sub    $0x4,%esp
+  80337d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  803380:	8b 45 08             	mov    0x8(%ebp),%eax
+  803383:	a3 00 00 83 00       	mov    %eax,0x830000
+	assert(size < 1600);
+  803388:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  80338e:	7f 2e                	jg     8033be <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  803390:	83 ec 04             	sub    $0x4,%esp
+  803393:	53                   	push   %ebx
+  803394:	ff 75 0c             	push   0xc(%ebp)
+  803397:	68 0c 00 83 00       	push   $0x83000c
+  80339c:	e8 d9 de ff ff       	call   80127a <memmove>
+	nsipcbuf.send.req_size = size;
+  8033a1:	89 1d 04 00 83 00    	mov    %ebx,0x830004
+	nsipcbuf.send.req_flags = flags;
+  8033a7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8033aa:	a3 08 00 83 00       	mov    %eax,0x830008
+	return nsipc(NSREQ_SEND);
+  8033af:	b8 08 00 00 00       	mov    $0x8,%eax
+  8033b4:	e8 e8 fd ff ff       	call   8031a1 <nsipc>
+}
+  8033b9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8033bc:	c9                   	leave
+  8033bd:	c3                   	ret
+	assert(size < 1600);
+  8033be:	68 43 4a 80 00       	push   $0x804a43
+  8033c3:	68 c0 49 80 00       	push   $0x8049c0
+  8033c8:	6a 6d                	push   $0x6d
+  8033ca:	68 37 4a 80 00       	push   $0x804a37
+  8033cf:	e8 57 d6 ff ff       	call   800a2b <_panic>
+
+008033d4 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  8033d4:	55                   	push   %ebp
+  8033d5:	89 e5                	mov    %esp,%ebp
+  8033d7:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  8033da:	8b 45 08             	mov    0x8(%ebp),%eax
+  8033dd:	a3 00 00 83 00       	mov    %eax,0x830000
+	nsipcbuf.socket.req_type = type;
+  8033e2:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8033e5:	a3 04 00 83 00       	mov    %eax,0x830004
+	nsipcbuf.socket.req_protocol = protocol;
+  8033ea:	8b 45 10             	mov    0x10(%ebp),%eax
+  8033ed:	a3 08 00 83 00       	mov    %eax,0x830008
+	return nsipc(NSREQ_SOCKET);
+  8033f2:	b8 09 00 00 00       	mov    $0x9,%eax
+  8033f7:	e8 a5 fd ff ff       	call   8031a1 <nsipc>
+}
+  8033fc:	c9                   	leave
+  8033fd:	c3                   	ret
+
+008033fe <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  8033fe:	55                   	push   %ebp
+  8033ff:	89 e5                	mov    %esp,%ebp
+  803401:	56                   	push   %esi
+  803402:	53                   	push   %ebx
+  803403:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  803406:	83 ec 0c             	sub    $0xc,%esp
+  803409:	ff 75 08             	push   0x8(%ebp)
+  80340c:	e8 00 e5 ff ff       	call   801911 <fd2data>
+  803411:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  803413:	83 c4 08             	add    $0x8,%esp
+  803416:	68 4f 4a 80 00       	push   $0x804a4f
+  80341b:	53                   	push   %ebx
+  80341c:	e8 d3 dc ff ff       	call   8010f4 <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  803421:	8b 46 04             	mov    0x4(%esi),%eax
+  803424:	2b 06                	sub    (%esi),%eax
+  803426:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  80342c:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  803433:	00 00 00 
+	stat->st_dev = &devpipe;
+  803436:	c7 83 88 00 00 00 60 	movl   $0x805060,0x88(%ebx)
+  80343d:	50 80 00 
+	return 0;
+}
+  803440:	b8 00 00 00 00       	mov    $0x0,%eax
+  803445:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803448:	5b                   	pop    %ebx
+  803449:	5e                   	pop    %esi
+  80344a:	5d                   	pop    %ebp
+  80344b:	c3                   	ret
+
+0080344c <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  80344c:	55                   	push   %ebp
+  80344d:	89 e5                	mov    %esp,%ebp
+  80344f:	53                   	push   %ebx
+  803450:	83 ec 0c             	sub    $0xc,%esp
+  803453:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  803456:	53                   	push   %ebx
+  803457:	6a 00                	push   $0x0
+  803459:	e8 2f e1 ff ff       	call   80158d <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  80345e:	89 1c 24             	mov    %ebx,(%esp)
+  803461:	e8 ab e4 ff ff       	call   801911 <fd2data>
+  803466:	83 c4 08             	add    $0x8,%esp
+  803469:	50                   	push   %eax
+  80346a:	6a 00                	push   $0x0
+  80346c:	e8 1c e1 ff ff       	call   80158d <sys_page_unmap>
+}
+  803471:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803474:	c9                   	leave
+  803475:	c3                   	ret
+
+00803476 <_pipeisclosed>:
+{
+  803476:	55                   	push   %ebp
+  803477:	89 e5                	mov    %esp,%ebp
+  803479:	57                   	push   %edi
+  80347a:	56                   	push   %esi
+  80347b:	53                   	push   %ebx
+  80347c:	83 ec 1c             	sub    $0x1c,%esp
+  80347f:	89 c7                	mov    %eax,%edi
+  803481:	89 d6                	mov    %edx,%esi
+		n = thisenv->env_runs;
+  803483:	a1 30 db 82 00       	mov    0x82db30,%eax
+  803488:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  80348b:	83 ec 0c             	sub    $0xc,%esp
+  80348e:	57                   	push   %edi
+  80348f:	e8 20 09 00 00       	call   803db4 <pageref>
+  803494:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  803497:	89 34 24             	mov    %esi,(%esp)
+  80349a:	e8 15 09 00 00       	call   803db4 <pageref>
+		nn = thisenv->env_runs;
+  80349f:	8b 15 30 db 82 00    	mov    0x82db30,%edx
+  8034a5:	8b 4a 58             	mov    0x58(%edx),%ecx
+		if (n == nn)
+  8034a8:	83 c4 10             	add    $0x10,%esp
+  8034ab:	39 cb                	cmp    %ecx,%ebx
+  8034ad:	74 1b                	je     8034ca <_pipeisclosed+0x54>
+		if (n != nn && ret == 1)
+  8034af:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  8034b2:	75 cf                	jne    803483 <_pipeisclosed+0xd>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  8034b4:	8b 42 58             	mov    0x58(%edx),%eax
+  8034b7:	6a 01                	push   $0x1
+  8034b9:	50                   	push   %eax
+  8034ba:	53                   	push   %ebx
+  8034bb:	68 56 4a 80 00       	push   $0x804a56
+  8034c0:	e8 41 d6 ff ff       	call   800b06 <cprintf>
+  8034c5:	83 c4 10             	add    $0x10,%esp
+  8034c8:	eb b9                	jmp    803483 <_pipeisclosed+0xd>
+		ret = pageref(fd) == pageref(p);
+  8034ca:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  8034cd:	0f 94 c0             	sete   %al
+  8034d0:	0f b6 c0             	movzbl %al,%eax
+}
+  8034d3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8034d6:	5b                   	pop    %ebx
+  8034d7:	5e                   	pop    %esi
+  8034d8:	5f                   	pop    %edi
+  8034d9:	5d                   	pop    %ebp
+  8034da:	c3                   	ret
+
+008034db <devpipe_write>:
+{
+  8034db:	55                   	push   %ebp
+  8034dc:	89 e5                	mov    %esp,%ebp
+  8034de:	57                   	push   %edi
+  8034df:	56                   	push   %esi
+  8034e0:	53                   	push   %ebx
+  8034e1:	83 ec 28             	sub    $0x28,%esp
+  8034e4:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  8034e7:	56                   	push   %esi
+  8034e8:	e8 24 e4 ff ff       	call   801911 <fd2data>
+  8034ed:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  8034ef:	83 c4 10             	add    $0x10,%esp
+  8034f2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8034f7:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  8034fa:	75 09                	jne    803505 <devpipe_write+0x2a>
+	return i;
+  8034fc:	89 f8                	mov    %edi,%eax
+  8034fe:	eb 23                	jmp    803523 <devpipe_write+0x48>
+			sys_yield();
+  803500:	e8 dc df ff ff       	call   8014e1 <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  803505:	8b 43 04             	mov    0x4(%ebx),%eax
+  803508:	8b 0b                	mov    (%ebx),%ecx
+  80350a:	8d 51 20             	lea    0x20(%ecx),%edx
+  80350d:	39 d0                	cmp    %edx,%eax
+  80350f:	72 1a                	jb     80352b <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  803511:	89 da                	mov    %ebx,%edx
+  803513:	89 f0                	mov    %esi,%eax
+  803515:	e8 5c ff ff ff       	call   803476 <_pipeisclosed>
+  80351a:	85 c0                	test   %eax,%eax
+  80351c:	74 e2                	je     803500 <devpipe_write+0x25>
+				return 0;
+  80351e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803523:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803526:	5b                   	pop    %ebx
+  803527:	5e                   	pop    %esi
+  803528:	5f                   	pop    %edi
+  803529:	5d                   	pop    %ebp
+  80352a:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  80352b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80352e:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  803532:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  803535:	89 c2                	mov    %eax,%edx
+  803537:	c1 fa 1f             	sar    $0x1f,%edx
+  80353a:	89 d1                	mov    %edx,%ecx
+  80353c:	c1 e9 1b             	shr    $0x1b,%ecx
+  80353f:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  803542:	83 e2 1f             	and    $0x1f,%edx
+  803545:	29 ca                	sub    %ecx,%edx
+  803547:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  80354b:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  80354f:	83 c0 01             	add    $0x1,%eax
+  803552:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  803555:	83 c7 01             	add    $0x1,%edi
+  803558:	eb 9d                	jmp    8034f7 <devpipe_write+0x1c>
+
+0080355a <devpipe_read>:
+{
+  80355a:	55                   	push   %ebp
+  80355b:	89 e5                	mov    %esp,%ebp
+  80355d:	57                   	push   %edi
+  80355e:	56                   	push   %esi
+  80355f:	53                   	push   %ebx
+  803560:	83 ec 18             	sub    $0x18,%esp
+  803563:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  803566:	57                   	push   %edi
+  803567:	e8 a5 e3 ff ff       	call   801911 <fd2data>
+  80356c:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  80356e:	83 c4 10             	add    $0x10,%esp
+  803571:	be 00 00 00 00       	mov    $0x0,%esi
+  803576:	3b 75 10             	cmp    0x10(%ebp),%esi
+  803579:	75 13                	jne    80358e <devpipe_read+0x34>
+	return i;
+  80357b:	89 f0                	mov    %esi,%eax
+  80357d:	eb 02                	jmp    803581 <devpipe_read+0x27>
+				return i;
+  80357f:	89 f0                	mov    %esi,%eax
+}
+  803581:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803584:	5b                   	pop    %ebx
+  803585:	5e                   	pop    %esi
+  803586:	5f                   	pop    %edi
+  803587:	5d                   	pop    %ebp
+  803588:	c3                   	ret
+			sys_yield();
+  803589:	e8 53 df ff ff       	call   8014e1 <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  80358e:	8b 03                	mov    (%ebx),%eax
+  803590:	3b 43 04             	cmp    0x4(%ebx),%eax
+  803593:	75 18                	jne    8035ad <devpipe_read+0x53>
+			if (i > 0)
+  803595:	85 f6                	test   %esi,%esi
+  803597:	75 e6                	jne    80357f <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  803599:	89 da                	mov    %ebx,%edx
+  80359b:	89 f8                	mov    %edi,%eax
+  80359d:	e8 d4 fe ff ff       	call   803476 <_pipeisclosed>
+  8035a2:	85 c0                	test   %eax,%eax
+  8035a4:	74 e3                	je     803589 <devpipe_read+0x2f>
+				return 0;
+  8035a6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8035ab:	eb d4                	jmp    803581 <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  8035ad:	99                   	cltd
+  8035ae:	c1 ea 1b             	shr    $0x1b,%edx
+  8035b1:	01 d0                	add    %edx,%eax
+  8035b3:	83 e0 1f             	and    $0x1f,%eax
+  8035b6:	29 d0                	sub    %edx,%eax
+  8035b8:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  8035bd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8035c0:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  8035c3:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  8035c6:	83 c6 01             	add    $0x1,%esi
+  8035c9:	eb ab                	jmp    803576 <devpipe_read+0x1c>
+
+008035cb <pipe>:
+{
+  8035cb:	55                   	push   %ebp
+  8035cc:	89 e5                	mov    %esp,%ebp
+  8035ce:	56                   	push   %esi
+  8035cf:	53                   	push   %ebx
+  8035d0:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  8035d3:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8035d6:	50                   	push   %eax
+  8035d7:	e8 4c e3 ff ff       	call   801928 <fd_alloc>
+  8035dc:	89 c3                	mov    %eax,%ebx
+  8035de:	83 c4 10             	add    $0x10,%esp
+  8035e1:	85 c0                	test   %eax,%eax
+  8035e3:	0f 88 23 01 00 00    	js     80370c <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8035e9:	83 ec 04             	sub    $0x4,%esp
+  8035ec:	68 07 04 00 00       	push   $0x407
+  8035f1:	ff 75 f4             	push   -0xc(%ebp)
+  8035f4:	6a 00                	push   $0x0
+  8035f6:	e8 05 df ff ff       	call   801500 <sys_page_alloc>
+  8035fb:	89 c3                	mov    %eax,%ebx
+  8035fd:	83 c4 10             	add    $0x10,%esp
+  803600:	85 c0                	test   %eax,%eax
+  803602:	0f 88 04 01 00 00    	js     80370c <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  803608:	83 ec 0c             	sub    $0xc,%esp
+  80360b:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80360e:	50                   	push   %eax
+  80360f:	e8 14 e3 ff ff       	call   801928 <fd_alloc>
+  803614:	89 c3                	mov    %eax,%ebx
+  803616:	83 c4 10             	add    $0x10,%esp
+  803619:	85 c0                	test   %eax,%eax
+  80361b:	0f 88 db 00 00 00    	js     8036fc <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803621:	83 ec 04             	sub    $0x4,%esp
+  803624:	68 07 04 00 00       	push   $0x407
+  803629:	ff 75 f0             	push   -0x10(%ebp)
+  80362c:	6a 00                	push   $0x0
+  80362e:	e8 cd de ff ff       	call   801500 <sys_page_alloc>
+  803633:	89 c3                	mov    %eax,%ebx
+  803635:	83 c4 10             	add    $0x10,%esp
+  803638:	85 c0                	test   %eax,%eax
+  80363a:	0f 88 bc 00 00 00    	js     8036fc <pipe+0x131>
+	va = fd2data(fd0);
+  803640:	83 ec 0c             	sub    $0xc,%esp
+  803643:	ff 75 f4             	push   -0xc(%ebp)
+  803646:	e8 c6 e2 ff ff       	call   801911 <fd2data>
+  80364b:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80364d:	83 c4 0c             	add    $0xc,%esp
+  803650:	68 07 04 00 00       	push   $0x407
+  803655:	50                   	push   %eax
+  803656:	6a 00                	push   $0x0
+  803658:	e8 a3 de ff ff       	call   801500 <sys_page_alloc>
+  80365d:	89 c3                	mov    %eax,%ebx
+  80365f:	83 c4 10             	add    $0x10,%esp
+  803662:	85 c0                	test   %eax,%eax
+  803664:	0f 88 82 00 00 00    	js     8036ec <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80366a:	83 ec 0c             	sub    $0xc,%esp
+  80366d:	ff 75 f0             	push   -0x10(%ebp)
+  803670:	e8 9c e2 ff ff       	call   801911 <fd2data>
+  803675:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  80367c:	50                   	push   %eax
+  80367d:	6a 00                	push   $0x0
+  80367f:	56                   	push   %esi
+  803680:	6a 00                	push   $0x0
+  803682:	e8 c4 de ff ff       	call   80154b <sys_page_map>
+  803687:	89 c3                	mov    %eax,%ebx
+  803689:	83 c4 20             	add    $0x20,%esp
+  80368c:	85 c0                	test   %eax,%eax
+  80368e:	78 4e                	js     8036de <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  803690:	a1 60 50 80 00       	mov    0x805060,%eax
+  803695:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  803698:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  80369a:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80369d:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  8036a4:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  8036a7:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  8036a9:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  8036ac:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  8036b3:	83 ec 0c             	sub    $0xc,%esp
+  8036b6:	ff 75 f4             	push   -0xc(%ebp)
+  8036b9:	e8 43 e2 ff ff       	call   801901 <fd2num>
+  8036be:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8036c1:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  8036c3:	83 c4 04             	add    $0x4,%esp
+  8036c6:	ff 75 f0             	push   -0x10(%ebp)
+  8036c9:	e8 33 e2 ff ff       	call   801901 <fd2num>
+  8036ce:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8036d1:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  8036d4:	83 c4 10             	add    $0x10,%esp
+  8036d7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8036dc:	eb 2e                	jmp    80370c <pipe+0x141>
+	sys_page_unmap(0, va);
+  8036de:	83 ec 08             	sub    $0x8,%esp
+  8036e1:	56                   	push   %esi
+  8036e2:	6a 00                	push   $0x0
+  8036e4:	e8 a4 de ff ff       	call   80158d <sys_page_unmap>
+  8036e9:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  8036ec:	83 ec 08             	sub    $0x8,%esp
+  8036ef:	ff 75 f0             	push   -0x10(%ebp)
+  8036f2:	6a 00                	push   $0x0
+  8036f4:	e8 94 de ff ff       	call   80158d <sys_page_unmap>
+  8036f9:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  8036fc:	83 ec 08             	sub    $0x8,%esp
+  8036ff:	ff 75 f4             	push   -0xc(%ebp)
+  803702:	6a 00                	push   $0x0
+  803704:	e8 84 de ff ff       	call   80158d <sys_page_unmap>
+  803709:	83 c4 10             	add    $0x10,%esp
+}
+  80370c:	89 d8                	mov    %ebx,%eax
+  80370e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803711:	5b                   	pop    %ebx
+  803712:	5e                   	pop    %esi
+  803713:	5d                   	pop    %ebp
+  803714:	c3                   	ret
+
+00803715 <pipeisclosed>:
+{
+  803715:	55                   	push   %ebp
+  803716:	89 e5                	mov    %esp,%ebp
+  803718:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80371b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80371e:	50                   	push   %eax
+  80371f:	ff 75 08             	push   0x8(%ebp)
+  803722:	e8 57 e2 ff ff       	call   80197e <fd_lookup>
+  803727:	83 c4 10             	add    $0x10,%esp
+  80372a:	85 c0                	test   %eax,%eax
+  80372c:	78 18                	js     803746 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  80372e:	83 ec 0c             	sub    $0xc,%esp
+  803731:	ff 75 f4             	push   -0xc(%ebp)
+  803734:	e8 d8 e1 ff ff       	call   801911 <fd2data>
+  803739:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  80373b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80373e:	e8 33 fd ff ff       	call   803476 <_pipeisclosed>
+  803743:	83 c4 10             	add    $0x10,%esp
+}
+  803746:	c9                   	leave
+  803747:	c3                   	ret
+
+00803748 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  803748:	b8 00 00 00 00       	mov    $0x0,%eax
+  80374d:	c3                   	ret
+
+0080374e <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  80374e:	55                   	push   %ebp
+  80374f:	89 e5                	mov    %esp,%ebp
+  803751:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  803754:	68 6e 4a 80 00       	push   $0x804a6e
+  803759:	ff 75 0c             	push   0xc(%ebp)
+  80375c:	e8 93 d9 ff ff       	call   8010f4 <strcpy>
+	return 0;
+}
+  803761:	b8 00 00 00 00       	mov    $0x0,%eax
+  803766:	c9                   	leave
+  803767:	c3                   	ret
+
+00803768 <devcons_write>:
+{
+  803768:	55                   	push   %ebp
+  803769:	89 e5                	mov    %esp,%ebp
+  80376b:	57                   	push   %edi
+  80376c:	56                   	push   %esi
+  80376d:	53                   	push   %ebx
+  80376e:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  803774:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  803779:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  80377f:	eb 2e                	jmp    8037af <devcons_write+0x47>
+		m = n - tot;
+  803781:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  803784:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  803786:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  80378b:	39 c3                	cmp    %eax,%ebx
+  80378d:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  803790:	83 ec 04             	sub    $0x4,%esp
+  803793:	53                   	push   %ebx
+  803794:	89 f0                	mov    %esi,%eax
+  803796:	03 45 0c             	add    0xc(%ebp),%eax
+  803799:	50                   	push   %eax
+  80379a:	57                   	push   %edi
+  80379b:	e8 da da ff ff       	call   80127a <memmove>
+		sys_cputs(buf, m);
+  8037a0:	83 c4 08             	add    $0x8,%esp
+  8037a3:	53                   	push   %ebx
+  8037a4:	57                   	push   %edi
+  8037a5:	e8 7a dc ff ff       	call   801424 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  8037aa:	01 de                	add    %ebx,%esi
+  8037ac:	83 c4 10             	add    $0x10,%esp
+  8037af:	3b 75 10             	cmp    0x10(%ebp),%esi
+  8037b2:	72 cd                	jb     803781 <devcons_write+0x19>
+}
+  8037b4:	89 f0                	mov    %esi,%eax
+  8037b6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8037b9:	5b                   	pop    %ebx
+  8037ba:	5e                   	pop    %esi
+  8037bb:	5f                   	pop    %edi
+  8037bc:	5d                   	pop    %ebp
+  8037bd:	c3                   	ret
+
+008037be <devcons_read>:
+{
+  8037be:	55                   	push   %ebp
+  8037bf:	89 e5                	mov    %esp,%ebp
+  8037c1:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  8037c4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8037c9:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8037cd:	75 07                	jne    8037d6 <devcons_read+0x18>
+  8037cf:	eb 1f                	jmp    8037f0 <devcons_read+0x32>
+		sys_yield();
+  8037d1:	e8 0b dd ff ff       	call   8014e1 <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  8037d6:	e8 6f dc ff ff       	call   80144a <sys_cgetc>
+  8037db:	85 c0                	test   %eax,%eax
+  8037dd:	74 f2                	je     8037d1 <devcons_read+0x13>
+	if (c < 0)
+  8037df:	78 0f                	js     8037f0 <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  8037e1:	83 f8 04             	cmp    $0x4,%eax
+  8037e4:	74 0c                	je     8037f2 <devcons_read+0x34>
+	*(char*)vbuf = c;
+  8037e6:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8037e9:	88 02                	mov    %al,(%edx)
+	return 1;
+  8037eb:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  8037f0:	c9                   	leave
+  8037f1:	c3                   	ret
+		return 0;
+  8037f2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8037f7:	eb f7                	jmp    8037f0 <devcons_read+0x32>
+
+008037f9 <cputchar>:
+{
+  8037f9:	55                   	push   %ebp
+  8037fa:	89 e5                	mov    %esp,%ebp
+  8037fc:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  8037ff:	8b 45 08             	mov    0x8(%ebp),%eax
+  803802:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  803805:	6a 01                	push   $0x1
+  803807:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  80380a:	50                   	push   %eax
+  80380b:	e8 14 dc ff ff       	call   801424 <sys_cputs>
+}
+  803810:	83 c4 10             	add    $0x10,%esp
+  803813:	c9                   	leave
+  803814:	c3                   	ret
+
+00803815 <getchar>:
+{
+  803815:	55                   	push   %ebp
+  803816:	89 e5                	mov    %esp,%ebp
+  803818:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  80381b:	6a 01                	push   $0x1
+  80381d:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  803820:	50                   	push   %eax
+  803821:	6a 00                	push   $0x0
+  803823:	e8 bc e3 ff ff       	call   801be4 <read>
+	if (r < 0)
+  803828:	83 c4 10             	add    $0x10,%esp
+  80382b:	85 c0                	test   %eax,%eax
+  80382d:	78 06                	js     803835 <getchar+0x20>
+	if (r < 1)
+  80382f:	74 06                	je     803837 <getchar+0x22>
+	return c;
+  803831:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  803835:	c9                   	leave
+  803836:	c3                   	ret
+		return -E_EOF;
+  803837:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  80383c:	eb f7                	jmp    803835 <getchar+0x20>
+
+0080383e <iscons>:
+{
+  80383e:	55                   	push   %ebp
+  80383f:	89 e5                	mov    %esp,%ebp
+  803841:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803844:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803847:	50                   	push   %eax
+  803848:	ff 75 08             	push   0x8(%ebp)
+  80384b:	e8 2e e1 ff ff       	call   80197e <fd_lookup>
+  803850:	83 c4 10             	add    $0x10,%esp
+  803853:	85 c0                	test   %eax,%eax
+  803855:	78 11                	js     803868 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  803857:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80385a:	8b 15 80 50 80 00    	mov    0x805080,%edx
+  803860:	39 10                	cmp    %edx,(%eax)
+  803862:	0f 94 c0             	sete   %al
+  803865:	0f b6 c0             	movzbl %al,%eax
+}
+  803868:	c9                   	leave
+  803869:	c3                   	ret
+
+0080386a <opencons>:
+{
+  80386a:	55                   	push   %ebp
+  80386b:	89 e5                	mov    %esp,%ebp
+  80386d:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  803870:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803873:	50                   	push   %eax
+  803874:	e8 af e0 ff ff       	call   801928 <fd_alloc>
+  803879:	83 c4 10             	add    $0x10,%esp
+  80387c:	85 c0                	test   %eax,%eax
+  80387e:	78 3a                	js     8038ba <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  803880:	83 ec 04             	sub    $0x4,%esp
+  803883:	68 07 04 00 00       	push   $0x407
+  803888:	ff 75 f4             	push   -0xc(%ebp)
+  80388b:	6a 00                	push   $0x0
+  80388d:	e8 6e dc ff ff       	call   801500 <sys_page_alloc>
+  803892:	83 c4 10             	add    $0x10,%esp
+  803895:	85 c0                	test   %eax,%eax
+  803897:	78 21                	js     8038ba <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  803899:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80389c:	8b 15 80 50 80 00    	mov    0x805080,%edx
+  8038a2:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  8038a4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8038a7:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  8038ae:	83 ec 0c             	sub    $0xc,%esp
+  8038b1:	50                   	push   %eax
+  8038b2:	e8 4a e0 ff ff       	call   801901 <fd2num>
+  8038b7:	83 c4 10             	add    $0x10,%esp
+}
+  8038ba:	c9                   	leave
+  8038bb:	c3                   	ret
+
+008038bc <copy_page_to>:
+// The handler cowpage found installed, which gets the faults that are
+// not copy-on-write faults.
+static void (*pgfault_next)(struct UTrapframe *utf);
+
+static int copy_page_to(envid_t envid, void *va, int perm)
+{
+  8038bc:	55                   	push   %ebp
+  8038bd:	89 e5                	mov    %esp,%ebp
+  8038bf:	57                   	push   %edi
+  8038c0:	56                   	push   %esi
+  8038c1:	53                   	push   %ebx
+  8038c2:	83 ec 20             	sub    $0x20,%esp
+  8038c5:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8038c8:	89 d7                	mov    %edx,%edi
+  8038ca:	89 ce                	mov    %ecx,%esi
+	int r;
+
+	r = sys_page_alloc(0, (void *) PFTEMP, perm);
+  8038cc:	51                   	push   %ecx
+  8038cd:	68 00 f0 7f 00       	push   $0x7ff000
+  8038d2:	6a 00                	push   $0x0
+  8038d4:	e8 27 dc ff ff       	call   801500 <sys_page_alloc>
+  8038d9:	89 c3                	mov    %eax,%ebx
+	if (r < 0)
+  8038db:	83 c4 10             	add    $0x10,%esp
+  8038de:	85 c0                	test   %eax,%eax
+  8038e0:	78 45                	js     803927 <copy_page_to+0x6b>
+		goto exit;
+	memmove((void *) PFTEMP, va, PGSIZE);
+  8038e2:	83 ec 04             	sub    $0x4,%esp
+  8038e5:	68 00 10 00 00       	push   $0x1000
+  8038ea:	57                   	push   %edi
+  8038eb:	68 00 f0 7f 00       	push   $0x7ff000
+  8038f0:	e8 85 d9 ff ff       	call   80127a <memmove>
+	r = sys_page_map(0, (void *) PFTEMP, envid, va, perm);
+  8038f5:	89 34 24             	mov    %esi,(%esp)
+  8038f8:	57                   	push   %edi
+  8038f9:	ff 75 e4             	push   -0x1c(%ebp)
+  8038fc:	68 00 f0 7f 00       	push   $0x7ff000
+  803901:	6a 00                	push   $0x0
+  803903:	e8 43 dc ff ff       	call   80154b <sys_page_map>
+  803908:	89 c3                	mov    %eax,%ebx
+	if (r < 0)
+  80390a:	83 c4 20             	add    $0x20,%esp
+  80390d:	85 c0                	test   %eax,%eax
+  80390f:	78 16                	js     803927 <copy_page_to+0x6b>
+		goto exit;
+	assert(!sys_page_unmap(0, (void *) PFTEMP));
+  803911:	83 ec 08             	sub    $0x8,%esp
+  803914:	68 00 f0 7f 00       	push   $0x7ff000
+  803919:	6a 00                	push   $0x0
+  80391b:	e8 6d dc ff ff       	call   80158d <sys_page_unmap>
+  803920:	83 c4 10             	add    $0x10,%esp
+  803923:	85 c0                	test   %eax,%eax
+  803925:	75 0a                	jne    803931 <copy_page_to+0x75>
+exit:
+	return r;
+}
+  803927:	89 d8                	mov    %ebx,%eax
+  803929:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80392c:	5b                   	pop    %ebx
+  80392d:	5e                   	pop    %esi
+  80392e:	5f                   	pop    %edi
+  80392f:	5d                   	pop    %ebp
+  803930:	c3                   	ret
+	assert(!sys_page_unmap(0, (void *) PFTEMP));
+  803931:	68 7c 4a 80 00       	push   $0x804a7c
+  803936:	68 c0 49 80 00       	push   $0x8049c0
+  80393b:	6a 1b                	push   $0x1b
+  80393d:	68 f4 4a 80 00       	push   $0x804af4
+  803942:	e8 e4 d0 ff ff       	call   800a2b <_panic>
+
+00803947 <pgfault>:
+// map in our own private writable copy.  Other faults go to the handler
+// cowpage replaced, if any.
+//
+static void
+pgfault(struct UTrapframe *utf)
+{
+  803947:	55                   	push   %ebp
+  803948:	89 e5                	mov    %esp,%ebp
+  80394a:	53                   	push   %ebx
+  80394b:	83 ec 04             	sub    $0x4,%esp
+  80394e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	void *addr = (void *) utf->utf_fault_va;
+  803951:	8b 13                	mov    (%ebx),%edx
+	// Hint:
+	//   Use the read-only page table mappings at uvpt
+	//   (see <inc/memlayout.h>).
+
+	// LAB 4: Your code here.
+	if (!(err & FEC_WR) || !(uvpd[PDX(addr)] & PTE_P)
+  803953:	f6 43 04 02          	testb  $0x2,0x4(%ebx)
+  803957:	74 21                	je     80397a <pgfault+0x33>
+  803959:	89 d0                	mov    %edx,%eax
+  80395b:	c1 e8 16             	shr    $0x16,%eax
+  80395e:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  803965:	a8 01                	test   $0x1,%al
+  803967:	74 11                	je     80397a <pgfault+0x33>
+	    || !(uvpt[PGNUM(addr)] & PTE_COW)) {
+  803969:	89 d0                	mov    %edx,%eax
+  80396b:	c1 e8 0c             	shr    $0xc,%eax
+  80396e:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  803975:	f6 c4 08             	test   $0x8,%ah
+  803978:	75 17                	jne    803991 <pgfault+0x4a>
+		if (pgfault_next) {
+  80397a:	a1 04 10 83 00       	mov    0x831004,%eax
+  80397f:	85 c0                	test   %eax,%eax
+  803981:	74 27                	je     8039aa <pgfault+0x63>
+			pgfault_next(utf);
+  803983:	83 ec 0c             	sub    $0xc,%esp
+  803986:	53                   	push   %ebx
+  803987:	ff d0                	call   *%eax
+			return;
+  803989:	83 c4 10             	add    $0x10,%esp
+exit:
+	cprintf("[%08x] pgfault: Can't handle page fault happened at"
+		"0x%08x, eip: 0x%08x. Exiting...\n", thisenv->env_id,
+		utf->utf_fault_va, utf->utf_eip);
+	sys_env_destroy(0);
+}
+  80398c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80398f:	c9                   	leave
+  803990:	c3                   	ret
+	if (copy_page_to(0, ROUNDDOWN(addr, PGSIZE), PTE_U | PTE_W | PTE_P) < 0)
+  803991:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+  803997:	b9 07 00 00 00       	mov    $0x7,%ecx
+  80399c:	b8 00 00 00 00       	mov    $0x0,%eax
+  8039a1:	e8 16 ff ff ff       	call   8038bc <copy_page_to>
+  8039a6:	85 c0                	test   %eax,%eax
+  8039a8:	79 e2                	jns    80398c <pgfault+0x45>
+		"0x%08x, eip: 0x%08x. Exiting...\n", thisenv->env_id,
+  8039aa:	a1 30 db 82 00       	mov    0x82db30,%eax
+  8039af:	8b 40 48             	mov    0x48(%eax),%eax
+	cprintf("[%08x] pgfault: Can't handle page fault happened at"
+  8039b2:	ff 73 28             	push   0x28(%ebx)
+  8039b5:	ff 33                	push   (%ebx)
+  8039b7:	50                   	push   %eax
+  8039b8:	68 a0 4a 80 00       	push   $0x804aa0
+  8039bd:	e8 44 d1 ff ff       	call   800b06 <cprintf>
+	sys_env_destroy(0);
+  8039c2:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  8039c9:	e8 a3 da ff ff       	call   801471 <sys_env_destroy>
+  8039ce:	83 c4 10             	add    $0x10,%esp
+  8039d1:	eb b9                	jmp    80398c <pgfault+0x45>
+
+008039d3 <cowpage>:
+//
+// Returns: 0 on success, < 0 on error.
+//
+int
+cowpage(void *va)
+{
+  8039d3:	55                   	push   %ebp
+  8039d4:	89 e5                	mov    %esp,%ebp
+  8039d6:	53                   	push   %ebx
+  8039d7:	83 ec 04             	sub    $0x4,%esp
+  8039da:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (_pgfault_handler != pgfault) {
+  8039dd:	a1 08 10 83 00       	mov    0x831008,%eax
+  8039e2:	3d 47 39 80 00       	cmp    $0x803947,%eax
+  8039e7:	74 15                	je     8039fe <cowpage+0x2b>
+		pgfault_next = _pgfault_handler;
+  8039e9:	a3 04 10 83 00       	mov    %eax,0x831004
+		set_pgfault_handler(pgfault);
+  8039ee:	83 ec 0c             	sub    $0xc,%esp
+  8039f1:	68 47 39 80 00       	push   $0x803947
+  8039f6:	e8 fb 03 00 00       	call   803df6 <set_pgfault_handler>
+  8039fb:	83 c4 10             	add    $0x10,%esp
+	}
+	return sys_page_map(0, va, 0, va, PTE_COW | PTE_U | PTE_P);
+  8039fe:	83 ec 0c             	sub    $0xc,%esp
+  803a01:	68 05 08 00 00       	push   $0x805
+  803a06:	53                   	push   %ebx
+  803a07:	6a 00                	push   $0x0
+  803a09:	53                   	push   %ebx
+  803a0a:	6a 00                	push   $0x0
+  803a0c:	e8 3a db ff ff       	call   80154b <sys_page_map>
+}
+  803a11:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803a14:	c9                   	leave
+  803a15:	c3                   	ret
+
+00803a16 <fork>:
+//   Neither user exception stack should ever be marked copy-on-write,
+//   so you must allocate a new page for the child's user exception stack.
+//
+envid_t
+fork(void)
+{
+  803a16:	55                   	push   %ebp
+  803a17:	89 e5                	mov    %esp,%ebp
+  803a19:	57                   	push   %edi
+  803a1a:	56                   	push   %esi
+  803a1b:	53                   	push   %ebx
+  803a1c:	83 ec 28             	sub    $0x28,%esp
+	// LAB 4: Your code here.
+	envid_t envid;
+	int r;
+
+	set_pgfault_handler(pgfault);
+  803a1f:	68 47 39 80 00       	push   $0x803947
+  803a24:	e8 cd 03 00 00       	call   803df6 <set_pgfault_handler>
+// child pointing to the trashed stack frame.
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	asm volatile("int %2"
+  803a29:	b8 07 00 00 00       	mov    $0x7,%eax
+  803a2e:	cd 30                	int    $0x30
+  803a30:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  803a33:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	envid = sys_exofork();
+	if (envid < 0)
+  803a36:	83 c4 10             	add    $0x10,%esp
+  803a39:	85 c0                	test   %eax,%eax
+  803a3b:	0f 88 6b 01 00 00    	js     803bac <fork+0x196>
+	else if (envid == 0) {
+		thisenv = &envs[ENVX(sys_getenvid())];
+		return 0;
+	}
+
+	for (uintptr_t addr = 0; addr < UTOP; addr += PGSIZE) {
+  803a41:	bb 00 00 00 00       	mov    $0x0,%ebx
+	else if (envid == 0) {
+  803a46:	75 37                	jne    803a7f <fork+0x69>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  803a48:	e8 6d da ff ff       	call   8014ba <sys_getenvid>
+  803a4d:	25 ff 03 00 00       	and    $0x3ff,%eax
+  803a52:	69 c0 8c 00 00 00    	imul   $0x8c,%eax,%eax
+  803a58:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803a5d:	a3 30 db 82 00       	mov    %eax,0x82db30
+		return 0;
+  803a62:	e9 45 01 00 00       	jmp    803bac <fork+0x196>
+		if (!(uvpd[PDX(addr)] & PTE_P)) {
+			addr += PTSIZE - PGSIZE;
+  803a67:	81 c3 00 f0 3f 00    	add    $0x3ff000,%ebx
+	for (uintptr_t addr = 0; addr < UTOP; addr += PGSIZE) {
+  803a6d:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  803a73:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  803a79:	0f 87 ba 00 00 00    	ja     803b39 <fork+0x123>
+		if (!(uvpd[PDX(addr)] & PTE_P)) {
+  803a7f:	89 d8                	mov    %ebx,%eax
+  803a81:	c1 e8 16             	shr    $0x16,%eax
+  803a84:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  803a8b:	a8 01                	test   $0x1,%al
+  803a8d:	74 d8                	je     803a67 <fork+0x51>
+			continue;
+		}
+		if (!(uvpt[PGNUM(addr)] & PTE_P))
+  803a8f:	89 d8                	mov    %ebx,%eax
+  803a91:	c1 e8 0c             	shr    $0xc,%eax
+  803a94:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  803a9b:	f6 c2 01             	test   $0x1,%dl
+  803a9e:	74 cd                	je     803a6d <fork+0x57>
+			continue;
+		if (addr == USTACKTOP - PGSIZE || addr == UXSTACKTOP - PGSIZE)
+  803aa0:	89 da                	mov    %ebx,%edx
+  803aa2:	80 e6 df             	and    $0xdf,%dh
+  803aa5:	81 fa 00 d0 bf ee    	cmp    $0xeebfd000,%edx
+  803aab:	74 c0                	je     803a6d <fork+0x57>
+	void *va = (void *) (pn << PGSHIFT);
+  803aad:	89 df                	mov    %ebx,%edi
+	if ((uvpt[pn] & PTE_SHARE) ||
+  803aaf:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  803ab6:	f6 c6 04             	test   $0x4,%dh
+  803ab9:	75 53                	jne    803b0e <fork+0xf8>
+	    (!(uvpt[pn] & PTE_COW) && !(uvpt[pn] & PTE_W)))
+  803abb:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+	if ((uvpt[pn] & PTE_SHARE) ||
+  803ac2:	f6 c6 08             	test   $0x8,%dh
+  803ac5:	75 0c                	jne    803ad3 <fork+0xbd>
+	    (!(uvpt[pn] & PTE_COW) && !(uvpt[pn] & PTE_W)))
+  803ac7:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  803ace:	f6 c2 02             	test   $0x2,%dl
+  803ad1:	74 3b                	je     803b0e <fork+0xf8>
+	r = sys_page_map(0, va, envid, va, PTE_COW | PTE_U | PTE_P);
+  803ad3:	83 ec 0c             	sub    $0xc,%esp
+  803ad6:	68 05 08 00 00       	push   $0x805
+  803adb:	57                   	push   %edi
+  803adc:	ff 75 e4             	push   -0x1c(%ebp)
+  803adf:	57                   	push   %edi
+  803ae0:	6a 00                	push   $0x0
+  803ae2:	e8 64 da ff ff       	call   80154b <sys_page_map>
+  803ae7:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  803ae9:	83 c4 20             	add    $0x20,%esp
+  803aec:	85 c0                	test   %eax,%eax
+  803aee:	0f 88 a7 00 00 00    	js     803b9b <fork+0x185>
+	r = sys_page_map(0, va, 0, va, PTE_COW | PTE_U | PTE_P);
+  803af4:	83 ec 0c             	sub    $0xc,%esp
+  803af7:	68 05 08 00 00       	push   $0x805
+  803afc:	57                   	push   %edi
+  803afd:	6a 00                	push   $0x0
+  803aff:	57                   	push   %edi
+  803b00:	6a 00                	push   $0x0
+  803b02:	e8 44 da ff ff       	call   80154b <sys_page_map>
+  803b07:	89 c6                	mov    %eax,%esi
+	return r;
+  803b09:	83 c4 20             	add    $0x20,%esp
+  803b0c:	eb 21                	jmp    803b2f <fork+0x119>
+		return sys_page_map(0, va, envid, va, uvpt[pn] & PTE_SYSCALL);
+  803b0e:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  803b15:	83 ec 0c             	sub    $0xc,%esp
+  803b18:	25 07 0e 00 00       	and    $0xe07,%eax
+  803b1d:	50                   	push   %eax
+  803b1e:	57                   	push   %edi
+  803b1f:	ff 75 e4             	push   -0x1c(%ebp)
+  803b22:	57                   	push   %edi
+  803b23:	6a 00                	push   $0x0
+  803b25:	e8 21 da ff ff       	call   80154b <sys_page_map>
+  803b2a:	89 c6                	mov    %eax,%esi
+  803b2c:	83 c4 20             	add    $0x20,%esp
+			continue;
+		r = duppage(envid, PGNUM(addr));
+		if (r < 0)
+  803b2f:	85 f6                	test   %esi,%esi
+  803b31:	0f 89 36 ff ff ff    	jns    803a6d <fork+0x57>
+  803b37:	eb 62                	jmp    803b9b <fork+0x185>
+			goto exit;
+	}
+
+	r = copy_page_to(envid, (void *) USTACKTOP - PGSIZE, PTE_U | PTE_W | PTE_P);
+  803b39:	b9 07 00 00 00       	mov    $0x7,%ecx
+  803b3e:	ba 00 d0 bf ee       	mov    $0xeebfd000,%edx
+  803b43:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  803b46:	89 f8                	mov    %edi,%eax
+  803b48:	e8 6f fd ff ff       	call   8038bc <copy_page_to>
+  803b4d:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  803b4f:	85 c0                	test   %eax,%eax
+  803b51:	78 48                	js     803b9b <fork+0x185>
+		goto exit;
+	r = sys_page_alloc(envid, (void *) UXSTACKTOP - PGSIZE, PTE_U | PTE_W | PTE_P);
+  803b53:	83 ec 04             	sub    $0x4,%esp
+  803b56:	6a 07                	push   $0x7
+  803b58:	68 00 f0 bf ee       	push   $0xeebff000
+  803b5d:	57                   	push   %edi
+  803b5e:	e8 9d d9 ff ff       	call   801500 <sys_page_alloc>
+  803b63:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  803b65:	83 c4 10             	add    $0x10,%esp
+  803b68:	85 c0                	test   %eax,%eax
+  803b6a:	78 2f                	js     803b9b <fork+0x185>
+		goto exit;
+	r = sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall);
+  803b6c:	a1 30 db 82 00       	mov    0x82db30,%eax
+  803b71:	8b 40 64             	mov    0x64(%eax),%eax
+  803b74:	83 ec 08             	sub    $0x8,%esp
+  803b77:	50                   	push   %eax
+  803b78:	57                   	push   %edi
+  803b79:	e8 ed da ff ff       	call   80166b <sys_env_set_pgfault_upcall>
+  803b7e:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  803b80:	83 c4 10             	add    $0x10,%esp
+  803b83:	85 c0                	test   %eax,%eax
+  803b85:	78 14                	js     803b9b <fork+0x185>
+		goto exit;
+	r = sys_env_set_status(envid, ENV_RUNNABLE);
+  803b87:	83 ec 08             	sub    $0x8,%esp
+  803b8a:	6a 02                	push   $0x2
+  803b8c:	57                   	push   %edi
+  803b8d:	e8 45 da ff ff       	call   8015d7 <sys_env_set_status>
+  803b92:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  803b94:	83 c4 10             	add    $0x10,%esp
+  803b97:	85 c0                	test   %eax,%eax
+  803b99:	79 11                	jns    803bac <fork+0x196>
+		goto exit;
+	return envid;
+exit:
+	sys_env_destroy(envid);
+  803b9b:	83 ec 0c             	sub    $0xc,%esp
+  803b9e:	ff 75 e0             	push   -0x20(%ebp)
+  803ba1:	e8 cb d8 ff ff       	call   801471 <sys_env_destroy>
+	return r;
+  803ba6:	83 c4 10             	add    $0x10,%esp
+  803ba9:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+}
+  803bac:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803baf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803bb2:	5b                   	pop    %ebx
+  803bb3:	5e                   	pop    %esi
+  803bb4:	5f                   	pop    %edi
+  803bb5:	5d                   	pop    %ebp
+  803bb6:	c3                   	ret
+
+00803bb7 <sfork>:
+
+// Challenge!
+int
+sfork(void)
+{
+  803bb7:	55                   	push   %ebp
+  803bb8:	89 e5                	mov    %esp,%ebp
+  803bba:	83 ec 0c             	sub    $0xc,%esp
+	panic("sfork not implemented");
+  803bbd:	68 ff 4a 80 00       	push   $0x804aff
+  803bc2:	68 bf 00 00 00       	push   $0xbf
+  803bc7:	68 f4 4a 80 00       	push   $0x804af4
+  803bcc:	e8 5a ce ff ff       	call   800a2b <_panic>
+
+00803bd1 <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  803bd1:	55                   	push   %ebp
+  803bd2:	89 e5                	mov    %esp,%ebp
+  803bd4:	56                   	push   %esi
+  803bd5:	53                   	push   %ebx
+  803bd6:	8b 75 08             	mov    0x8(%ebp),%esi
+  803bd9:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803bdc:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int r;
+
+	if (pg == NULL)
+		pg = (void *) UTOP;
+  803bdf:	85 c0                	test   %eax,%eax
+  803be1:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  803be6:	0f 44 c2             	cmove  %edx,%eax
+
+	r = sys_ipc_recv(pg);
+  803be9:	83 ec 0c             	sub    $0xc,%esp
+  803bec:	50                   	push   %eax
+  803bed:	e8 56 db ff ff       	call   801748 <sys_ipc_recv>
+	if (from_env_store)
+  803bf2:	83 c4 10             	add    $0x10,%esp
+  803bf5:	85 f6                	test   %esi,%esi
+  803bf7:	74 14                	je     803c0d <ipc_recv+0x3c>
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  803bf9:	ba 00 00 00 00       	mov    $0x0,%edx
+  803bfe:	85 c0                	test   %eax,%eax
+  803c00:	75 09                	jne    803c0b <ipc_recv+0x3a>
+  803c02:	8b 15 30 db 82 00    	mov    0x82db30,%edx
+  803c08:	8b 52 74             	mov    0x74(%edx),%edx
+  803c0b:	89 16                	mov    %edx,(%esi)
+	if (perm_store)
+  803c0d:	85 db                	test   %ebx,%ebx
+  803c0f:	74 25                	je     803c36 <ipc_recv+0x65>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  803c11:	85 c0                	test   %eax,%eax
+  803c13:	74 0d                	je     803c22 <ipc_recv+0x51>
+  803c15:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+	return r ?: thisenv->env_ipc_value;
+}
+  803c1b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803c1e:	5b                   	pop    %ebx
+  803c1f:	5e                   	pop    %esi
+  803c20:	5d                   	pop    %ebp
+  803c21:	c3                   	ret
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  803c22:	a1 30 db 82 00       	mov    0x82db30,%eax
+  803c27:	8b 40 78             	mov    0x78(%eax),%eax
+  803c2a:	89 03                	mov    %eax,(%ebx)
+	return r ?: thisenv->env_ipc_value;
+  803c2c:	a1 30 db 82 00       	mov    0x82db30,%eax
+  803c31:	8b 40 70             	mov    0x70(%eax),%eax
+  803c34:	eb e5                	jmp    803c1b <ipc_recv+0x4a>
+  803c36:	85 c0                	test   %eax,%eax
+  803c38:	75 e1                	jne    803c1b <ipc_recv+0x4a>
+  803c3a:	eb f0                	jmp    803c2c <ipc_recv+0x5b>
+
+00803c3c <ipc_send>:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  803c3c:	55                   	push   %ebp
+  803c3d:	89 e5                	mov    %esp,%ebp
+  803c3f:	57                   	push   %edi
+  803c40:	56                   	push   %esi
+  803c41:	53                   	push   %ebx
+  803c42:	83 ec 0c             	sub    $0xc,%esp
+  803c45:	8b 7d 08             	mov    0x8(%ebp),%edi
+  803c48:	8b 75 0c             	mov    0xc(%ebp),%esi
+  803c4b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int r;
+
+	if (pg == NULL)
+		pg = (void *) UTOP;
+  803c4e:	85 db                	test   %ebx,%ebx
+  803c50:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  803c55:	0f 44 d8             	cmove  %eax,%ebx
+
+	while ((r = sys_ipc_try_send(to_env, val, pg, perm))) {
+  803c58:	ff 75 14             	push   0x14(%ebp)
+  803c5b:	53                   	push   %ebx
+  803c5c:	56                   	push   %esi
+  803c5d:	57                   	push   %edi
+  803c5e:	e8 52 da ff ff       	call   8016b5 <sys_ipc_try_send>
+  803c63:	83 c4 10             	add    $0x10,%esp
+  803c66:	85 c0                	test   %eax,%eax
+  803c68:	74 22                	je     803c8c <ipc_send+0x50>
+		assert(r == -E_IPC_NOT_RECV);
+  803c6a:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  803c6d:	75 07                	jne    803c76 <ipc_send+0x3a>
+		sys_yield();
+  803c6f:	e8 6d d8 ff ff       	call   8014e1 <sys_yield>
+  803c74:	eb e2                	jmp    803c58 <ipc_send+0x1c>
+		assert(r == -E_IPC_NOT_RECV);
+  803c76:	68 15 4b 80 00       	push   $0x804b15
+  803c7b:	68 c0 49 80 00       	push   $0x8049c0
+  803c80:	6a 39                	push   $0x39
+  803c82:	68 2a 4b 80 00       	push   $0x804b2a
+  803c87:	e8 9f cd ff ff       	call   800a2b <_panic>
+	}
+}
+  803c8c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803c8f:	5b                   	pop    %ebx
+  803c90:	5e                   	pop    %esi
+  803c91:	5f                   	pop    %edi
+  803c92:	5d                   	pop    %ebp
+  803c93:	c3                   	ret
+
+00803c94 <ipc_recvv>:
+// Receive a value and up to *npages pages, mapped one after another
+// starting at 'pg'.  Like ipc_recv otherwise; also stores the number
+// of pages actually received in *npages (0 on error).
+int32_t
+ipc_recvv(envid_t *from_env_store, void *pg, int *npages, int *perm_store)
+{
+  803c94:	55                   	push   %ebp
+  803c95:	89 e5                	mov    %esp,%ebp
+  803c97:	57                   	push   %edi
+  803c98:	56                   	push   %esi
+  803c99:	53                   	push   %ebx
+  803c9a:	83 ec 10             	sub    $0x10,%esp
+  803c9d:	8b 7d 08             	mov    0x8(%ebp),%edi
+  803ca0:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803ca3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  803ca6:	8b 75 14             	mov    0x14(%ebp),%esi
+	int r;
+
+	if (pg == NULL)
+		pg = (void *) UTOP;
+  803ca9:	85 c0                	test   %eax,%eax
+  803cab:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  803cb0:	0f 44 c2             	cmove  %edx,%eax
+
+	r = sys_ipc_recvv(pg, *npages, 0);
+  803cb3:	6a 00                	push   $0x0
+  803cb5:	ff 33                	push   (%ebx)
+  803cb7:	50                   	push   %eax
+  803cb8:	e8 48 da ff ff       	call   801705 <sys_ipc_recvv>
+	*npages = !r ? thisenv->env_ipc_npages : 0;
+  803cbd:	83 c4 10             	add    $0x10,%esp
+  803cc0:	85 c0                	test   %eax,%eax
+  803cc2:	75 3c                	jne    803d00 <ipc_recvv+0x6c>
+  803cc4:	8b 15 30 db 82 00    	mov    0x82db30,%edx
+  803cca:	8b 52 7c             	mov    0x7c(%edx),%edx
+  803ccd:	89 13                	mov    %edx,(%ebx)
+	if (from_env_store)
+  803ccf:	85 ff                	test   %edi,%edi
+  803cd1:	74 4e                	je     803d21 <ipc_recvv+0x8d>
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  803cd3:	8b 15 30 db 82 00    	mov    0x82db30,%edx
+  803cd9:	8b 52 74             	mov    0x74(%edx),%edx
+  803cdc:	89 17                	mov    %edx,(%edi)
+	if (perm_store)
+  803cde:	85 f6                	test   %esi,%esi
+  803ce0:	74 18                	je     803cfa <ipc_recvv+0x66>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  803ce2:	85 c0                	test   %eax,%eax
+  803ce4:	75 2d                	jne    803d13 <ipc_recvv+0x7f>
+  803ce6:	a1 30 db 82 00       	mov    0x82db30,%eax
+  803ceb:	8b 40 78             	mov    0x78(%eax),%eax
+  803cee:	89 06                	mov    %eax,(%esi)
+	return r ?: thisenv->env_ipc_value;
+  803cf0:	a1 30 db 82 00       	mov    0x82db30,%eax
+  803cf5:	8b 40 70             	mov    0x70(%eax),%eax
+  803cf8:	eb 1f                	jmp    803d19 <ipc_recvv+0x85>
+  803cfa:	85 c0                	test   %eax,%eax
+  803cfc:	75 1b                	jne    803d19 <ipc_recvv+0x85>
+  803cfe:	eb f0                	jmp    803cf0 <ipc_recvv+0x5c>
+	*npages = !r ? thisenv->env_ipc_npages : 0;
+  803d00:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  803d06:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (from_env_store)
+  803d0b:	85 ff                	test   %edi,%edi
+  803d0d:	75 cd                	jne    803cdc <ipc_recvv+0x48>
+	if (perm_store)
+  803d0f:	85 f6                	test   %esi,%esi
+  803d11:	74 e7                	je     803cfa <ipc_recvv+0x66>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  803d13:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+}
+  803d19:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803d1c:	5b                   	pop    %ebx
+  803d1d:	5e                   	pop    %esi
+  803d1e:	5f                   	pop    %edi
+  803d1f:	5d                   	pop    %ebp
+  803d20:	c3                   	ret
+	if (perm_store)
+  803d21:	85 f6                	test   %esi,%esi
+  803d23:	75 bd                	jne    803ce2 <ipc_recvv+0x4e>
+  803d25:	eb c9                	jmp    803cf0 <ipc_recvv+0x5c>
+
+00803d27 <ipc_sendv>:
+// Each entry is a page address or'ed with the permissions to send
+// that page with (see sys_ipc_try_sendv).
+// Like ipc_send, keeps trying until it succeeds.
+void
+ipc_sendv(envid_t to_env, uint32_t val, const uintptr_t *pages, int npages)
+{
+  803d27:	55                   	push   %ebp
+  803d28:	89 e5                	mov    %esp,%ebp
+  803d2a:	57                   	push   %edi
+  803d2b:	56                   	push   %esi
+  803d2c:	53                   	push   %ebx
+  803d2d:	83 ec 0c             	sub    $0xc,%esp
+  803d30:	8b 7d 08             	mov    0x8(%ebp),%edi
+  803d33:	8b 75 0c             	mov    0xc(%ebp),%esi
+  803d36:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int r;
+
+	while ((r = sys_ipc_try_sendv(to_env, val, pages, npages))) {
+  803d39:	ff 75 14             	push   0x14(%ebp)
+  803d3c:	53                   	push   %ebx
+  803d3d:	56                   	push   %esi
+  803d3e:	57                   	push   %edi
+  803d3f:	e8 99 d9 ff ff       	call   8016dd <sys_ipc_try_sendv>
+  803d44:	83 c4 10             	add    $0x10,%esp
+  803d47:	85 c0                	test   %eax,%eax
+  803d49:	74 22                	je     803d6d <ipc_sendv+0x46>
+		assert(r == -E_IPC_NOT_RECV);
+  803d4b:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  803d4e:	75 07                	jne    803d57 <ipc_sendv+0x30>
+		sys_yield();
+  803d50:	e8 8c d7 ff ff       	call   8014e1 <sys_yield>
+  803d55:	eb e2                	jmp    803d39 <ipc_sendv+0x12>
+		assert(r == -E_IPC_NOT_RECV);
+  803d57:	68 15 4b 80 00       	push   $0x804b15
+  803d5c:	68 c0 49 80 00       	push   $0x8049c0
+  803d61:	6a 5c                	push   $0x5c
+  803d63:	68 2a 4b 80 00       	push   $0x804b2a
+  803d68:	e8 be cc ff ff       	call   800a2b <_panic>
+	}
+}
+  803d6d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803d70:	5b                   	pop    %ebx
+  803d71:	5e                   	pop    %esi
+  803d72:	5f                   	pop    %edi
+  803d73:	5d                   	pop    %ebp
+  803d74:	c3                   	ret
+
+00803d75 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  803d75:	55                   	push   %ebp
+  803d76:	89 e5                	mov    %esp,%ebp
+  803d78:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  803d7b:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (envs[i].env_type == type)
+  803d80:	69 d0 8c 00 00 00    	imul   $0x8c,%eax,%edx
+  803d86:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  803d8c:	8b 52 50             	mov    0x50(%edx),%edx
+  803d8f:	39 ca                	cmp    %ecx,%edx
+  803d91:	74 11                	je     803da4 <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  803d93:	83 c0 01             	add    $0x1,%eax
+  803d96:	3d 00 04 00 00       	cmp    $0x400,%eax
+  803d9b:	75 e3                	jne    803d80 <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  803d9d:	b8 00 00 00 00       	mov    $0x0,%eax
+  803da2:	eb 0e                	jmp    803db2 <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  803da4:	69 c0 8c 00 00 00    	imul   $0x8c,%eax,%eax
+  803daa:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803daf:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  803db2:	5d                   	pop    %ebp
+  803db3:	c3                   	ret
+
+00803db4 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  803db4:	55                   	push   %ebp
+  803db5:	89 e5                	mov    %esp,%ebp
+  803db7:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  803dba:	89 c2                	mov    %eax,%edx
+  803dbc:	c1 ea 16             	shr    $0x16,%edx
+  803dbf:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  803dc6:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  803dcb:	f6 c1 01             	test   $0x1,%cl
+  803dce:	74 22                	je     803df2 <pageref+0x3e>
+	pte = uvpt[PGNUM(v)];
+  803dd0:	c1 e8 0c             	shr    $0xc,%eax
+  803dd3:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  803dda:	a8 01                	test   $0x1,%al
+  803ddc:	74 14                	je     803df2 <pageref+0x3e>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  803dde:	c1 e8 0c             	shr    $0xc,%eax
+  803de1:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  803de4:	8d 04 85 00 00 00 ef 	lea    -0x11000000(,%eax,4),%eax
+  803deb:	0f b7 50 08          	movzwl 0x8(%eax),%edx
+  803def:	0f b7 d2             	movzwl %dx,%edx
+}
+  803df2:	89 d0                	mov    %edx,%eax
+  803df4:	5d                   	pop    %ebp
+  803df5:	c3                   	ret
+
+00803df6 <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  803df6:	55                   	push   %ebp
+  803df7:	89 e5                	mov    %esp,%ebp
+  803df9:	83 ec 08             	sub    $0x8,%esp
+	if (_pgfault_handler == 0) {
+  803dfc:	83 3d 08 10 83 00 00 	cmpl   $0x0,0x831008
+  803e03:	74 0a                	je     803e0f <set_pgfault_handler+0x19>
+				       PTE_U | PTE_W | PTE_P));
+		assert(!sys_env_set_pgfault_upcall(0, _pgfault_upcall));
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  803e05:	8b 45 08             	mov    0x8(%ebp),%eax
+  803e08:	a3 08 10 83 00       	mov    %eax,0x831008
+}
+  803e0d:	c9                   	leave
+  803e0e:	c3                   	ret
+		assert(!sys_page_alloc(0, (void *) UXSTACKTOP - PGSIZE,
+  803e0f:	83 ec 04             	sub    $0x4,%esp
+  803e12:	6a 07                	push   $0x7
+  803e14:	68 00 f0 bf ee       	push   $0xeebff000
+  803e19:	6a 00                	push   $0x0
+  803e1b:	e8 e0 d6 ff ff       	call   801500 <sys_page_alloc>
+  803e20:	83 c4 10             	add    $0x10,%esp
+  803e23:	85 c0                	test   %eax,%eax
+  803e25:	75 2c                	jne    803e53 <set_pgfault_handler+0x5d>
+		assert(!sys_env_set_pgfault_upcall(0, _pgfault_upcall));
+  803e27:	83 ec 08             	sub    $0x8,%esp
+  803e2a:	68 69 3e 80 00       	push   $0x803e69
+  803e2f:	6a 00                	push   $0x0
+  803e31:	e8 35 d8 ff ff       	call   80166b <sys_env_set_pgfault_upcall>
+  803e36:	83 c4 10             	add    $0x10,%esp
+  803e39:	85 c0                	test   %eax,%eax
+  803e3b:	74 c8                	je     803e05 <set_pgfault_handler+0xf>
+  803e3d:	68 7c 4b 80 00       	push   $0x804b7c
+  803e42:	68 c0 49 80 00       	push   $0x8049c0
+  803e47:	6a 20                	push   $0x20
+  803e49:	68 ac 4b 80 00       	push   $0x804bac
+  803e4e:	e8 d8 cb ff ff       	call   800a2b <_panic>
+		assert(!sys_page_alloc(0, (void *) UXSTACKTOP - PGSIZE,
+  803e53:	68 34 4b 80 00       	push   $0x804b34
+  803e58:	68 c0 49 80 00       	push   $0x8049c0
+  803e5d:	6a 1e                	push   $0x1e
+  803e5f:	68 ac 4b 80 00       	push   $0x804bac
+  803e64:	e8 c2 cb ff ff       	call   800a2b <_panic>
+
+00803e69 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  803e69:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  803e6a:	a1 08 10 83 00       	mov    0x831008,%eax
+	call *%eax
+  803e6f:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  803e71:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+	movl	$-0x4, %ebp
+  803e74:	bd fc ff ff ff       	mov    $0xfffffffc,%ebp
+	xadd	%ebp, 0x30(%esp)	# Load trap-time %esp.
+  803e79:	0f c1 6c 24 30       	xadd   %ebp,0x30(%esp)
+
+	movl	0x28(%esp), %eax	# Load trap-time %eip.
+  803e7e:	8b 44 24 28          	mov    0x28(%esp),%eax
+	movl	%eax, -0x4(%ebp)
+  803e82:	89 45 fc             	mov    %eax,-0x4(%ebp)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+	addl	$0x8, %esp
+  803e85:	83 c4 08             	add    $0x8,%esp
+	popal
+  803e88:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+	addl	$0x4, %esp
+  803e89:	83 c4 04             	add    $0x4,%esp
+	popfl
+  803e8c:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+	popl	%esp
+  803e8d:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+	ret
+  803e8e:	c3                   	ret
+
+00803e8f <dm>:
+  803e8f:	55                   	push   %ebp
+  803e90:	57                   	push   %edi
+  803e91:	56                   	push   %esi
+  803e92:	53                   	push   %ebx
+  803e93:	83 ec 24             	sub    $0x24,%esp
+  803e96:	89 44 24 08          	mov    %eax,0x8(%esp)
+  803e9a:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  803e9e:	8b 44 24 38          	mov    0x38(%esp),%eax
+  803ea2:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  803ea6:	89 44 24 10          	mov    %eax,0x10(%esp)
+  803eaa:	89 54 24 14          	mov    %edx,0x14(%esp)
+  803eae:	8b 7c 24 40          	mov    0x40(%esp),%edi
+  803eb2:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  803eb7:	b8 00 00 00 00       	mov    $0x0,%eax
+  803ebc:	ba 00 00 00 00       	mov    $0x0,%edx
+  803ec1:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  803ec8:	00 
+  803ec9:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  803ed0:	00 
+  803ed1:	89 fb                	mov    %edi,%ebx
+  803ed3:	eb 08                	jmp    803edd <dm+0x4e>
+  803ed5:	83 e9 01             	sub    $0x1,%ecx
+  803ed8:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  803edb:	74 68                	je     803f45 <dm+0xb6>
+  803edd:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  803ee1:	01 c0                	add    %eax,%eax
+  803ee3:	89 c6                	mov    %eax,%esi
+  803ee5:	89 d7                	mov    %edx,%edi
+  803ee7:	8b 44 24 08          	mov    0x8(%esp),%eax
+  803eeb:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  803eef:	0f ad d0             	shrd   %cl,%edx,%eax
+  803ef2:	d3 ea                	shr    %cl,%edx
+  803ef4:	f6 c1 20             	test   $0x20,%cl
+  803ef7:	74 04                	je     803efd <dm+0x6e>
+  803ef9:	89 d0                	mov    %edx,%eax
+  803efb:	31 d2                	xor    %edx,%edx
+  803efd:	83 e0 01             	and    $0x1,%eax
+  803f00:	89 04 24             	mov    %eax,(%esp)
+  803f03:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  803f0a:	00 
+  803f0b:	8b 04 24             	mov    (%esp),%eax
+  803f0e:	8b 54 24 04          	mov    0x4(%esp),%edx
+  803f12:	09 f0                	or     %esi,%eax
+  803f14:	09 fa                	or     %edi,%edx
+  803f16:	8b 74 24 10          	mov    0x10(%esp),%esi
+  803f1a:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  803f1e:	39 f0                	cmp    %esi,%eax
+  803f20:	89 d5                	mov    %edx,%ebp
+  803f22:	19 fd                	sbb    %edi,%ebp
+  803f24:	72 af                	jb     803ed5 <dm+0x46>
+  803f26:	29 f0                	sub    %esi,%eax
+  803f28:	19 fa                	sbb    %edi,%edx
+  803f2a:	89 cf                	mov    %ecx,%edi
+  803f2c:	c1 ef 05             	shr    $0x5,%edi
+  803f2f:	83 e7 01             	and    $0x1,%edi
+  803f32:	89 fe                	mov    %edi,%esi
+  803f34:	83 f6 01             	xor    $0x1,%esi
+  803f37:	d3 e6                	shl    %cl,%esi
+  803f39:	d3 e7                	shl    %cl,%edi
+  803f3b:	09 74 24 18          	or     %esi,0x18(%esp)
+  803f3f:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  803f43:	eb 90                	jmp    803ed5 <dm+0x46>
+  803f45:	85 db                	test   %ebx,%ebx
+  803f47:	74 05                	je     803f4e <dm+0xbf>
+  803f49:	89 03                	mov    %eax,(%ebx)
+  803f4b:	89 53 04             	mov    %edx,0x4(%ebx)
+  803f4e:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803f52:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803f56:	83 c4 24             	add    $0x24,%esp
+  803f59:	5b                   	pop    %ebx
+  803f5a:	5e                   	pop    %esi
+  803f5b:	5f                   	pop    %edi
+  803f5c:	5d                   	pop    %ebp
+  803f5d:	c3                   	ret
+
+00803f5e <__udivdi3>:
+  803f5e:	83 ec 08             	sub    $0x8,%esp
+  803f61:	6a 00                	push   $0x0
+  803f63:	ff 74 24 1c          	push   0x1c(%esp)
+  803f67:	ff 74 24 1c          	push   0x1c(%esp)
+  803f6b:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803f6f:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803f73:	e8 17 ff ff ff       	call   803e8f <dm>
+  803f78:	83 c4 14             	add    $0x14,%esp
+  803f7b:	c3                   	ret
+
+00803f7c <__umoddi3>:
+  803f7c:	83 ec 18             	sub    $0x18,%esp
+  803f7f:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  803f83:	50                   	push   %eax
+  803f84:	ff 74 24 2c          	push   0x2c(%esp)
+  803f88:	ff 74 24 2c          	push   0x2c(%esp)
+  803f8c:	8b 44 24 28          	mov    0x28(%esp),%eax
+  803f90:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  803f94:	e8 f6 fe ff ff       	call   803e8f <dm>
+  803f99:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803f9d:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803fa1:	83 c4 24             	add    $0x24,%esp
+  803fa4:	c3                   	ret
+
+00803fa5 <__divdi3>:
+  803fa5:	53                   	push   %ebx
+  803fa6:	8b 44 24 08          	mov    0x8(%esp),%eax
+  803faa:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  803fae:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  803fb2:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  803fb6:	85 d2                	test   %edx,%edx
+  803fb8:	78 15                	js     803fcf <__divdi3+0x2a>
+  803fba:	85 db                	test   %ebx,%ebx
+  803fbc:	78 34                	js     803ff2 <__divdi3+0x4d>
+  803fbe:	83 ec 04             	sub    $0x4,%esp
+  803fc1:	6a 00                	push   $0x0
+  803fc3:	53                   	push   %ebx
+  803fc4:	51                   	push   %ecx
+  803fc5:	e8 c5 fe ff ff       	call   803e8f <dm>
+  803fca:	83 c4 10             	add    $0x10,%esp
+  803fcd:	eb 21                	jmp    803ff0 <__divdi3+0x4b>
+  803fcf:	f7 d8                	neg    %eax
+  803fd1:	83 d2 00             	adc    $0x0,%edx
+  803fd4:	f7 da                	neg    %edx
+  803fd6:	85 db                	test   %ebx,%ebx
+  803fd8:	78 30                	js     80400a <__divdi3+0x65>
+  803fda:	83 ec 04             	sub    $0x4,%esp
+  803fdd:	6a 00                	push   $0x0
+  803fdf:	53                   	push   %ebx
+  803fe0:	51                   	push   %ecx
+  803fe1:	e8 a9 fe ff ff       	call   803e8f <dm>
+  803fe6:	83 c4 10             	add    $0x10,%esp
+  803fe9:	f7 d8                	neg    %eax
+  803feb:	83 d2 00             	adc    $0x0,%edx
+  803fee:	f7 da                	neg    %edx
+  803ff0:	5b                   	pop    %ebx
+  803ff1:	c3                   	ret
+  803ff2:	83 ec 04             	sub    $0x4,%esp
+  803ff5:	6a 00                	push   $0x0
+  803ff7:	f7 d9                	neg    %ecx
+  803ff9:	83 d3 00             	adc    $0x0,%ebx
+  803ffc:	f7 db                	neg    %ebx
+  803ffe:	53                   	push   %ebx
+  803fff:	51                   	push   %ecx
+  804000:	e8 8a fe ff ff       	call   803e8f <dm>
+  804005:	83 c4 10             	add    $0x10,%esp
+  804008:	eb df                	jmp    803fe9 <__divdi3+0x44>
+  80400a:	83 ec 04             	sub    $0x4,%esp
+  80400d:	6a 00                	push   $0x0
+  80400f:	f7 d9                	neg    %ecx
+  804011:	83 d3 00             	adc    $0x0,%ebx
+  804014:	f7 db                	neg    %ebx
+  804016:	53                   	push   %ebx
+  804017:	51                   	push   %ecx
+  804018:	e8 72 fe ff ff       	call   803e8f <dm>
+  80401d:	83 c4 10             	add    $0x10,%esp
+  804020:	eb ce                	jmp    803ff0 <__divdi3+0x4b>
+
+00804022 <__moddi3>:
+  804022:	55                   	push   %ebp
+  804023:	57                   	push   %edi
+  804024:	56                   	push   %esi
+  804025:	53                   	push   %ebx
+  804026:	83 ec 24             	sub    $0x24,%esp
+  804029:	8b 44 24 38          	mov    0x38(%esp),%eax
+  80402d:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  804031:	8b 4c 24 40          	mov    0x40(%esp),%ecx
+  804035:	8b 5c 24 44          	mov    0x44(%esp),%ebx
+  804039:	85 d2                	test   %edx,%edx
+  80403b:	78 3b                	js     804078 <__moddi3+0x56>
+  80403d:	83 ec 04             	sub    $0x4,%esp
+  804040:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  804044:	56                   	push   %esi
+  804045:	89 ce                	mov    %ecx,%esi
+  804047:	f7 de                	neg    %esi
+  804049:	89 74 24 08          	mov    %esi,0x8(%esp)
+  80404d:	89 de                	mov    %ebx,%esi
+  80404f:	83 d6 00             	adc    $0x0,%esi
+  804052:	f7 de                	neg    %esi
+  804054:	89 74 24 14          	mov    %esi,0x14(%esp)
+  804058:	8b 74 24 08          	mov    0x8(%esp),%esi
+  80405c:	0f 48 f1             	cmovs  %ecx,%esi
+  80405f:	0f 49 5c 24 14       	cmovns 0x14(%esp),%ebx
+  804064:	53                   	push   %ebx
+  804065:	56                   	push   %esi
+  804066:	e8 24 fe ff ff       	call   803e8f <dm>
+  80406b:	8b 44 24 28          	mov    0x28(%esp),%eax
+  80406f:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  804073:	83 c4 10             	add    $0x10,%esp
+  804076:	eb 47                	jmp    8040bf <__moddi3+0x9d>
+  804078:	f7 d8                	neg    %eax
+  80407a:	83 d2 00             	adc    $0x0,%edx
+  80407d:	f7 da                	neg    %edx
+  80407f:	83 ec 04             	sub    $0x4,%esp
+  804082:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  804086:	56                   	push   %esi
+  804087:	89 cf                	mov    %ecx,%edi
+  804089:	f7 df                	neg    %edi
+  80408b:	89 de                	mov    %ebx,%esi
+  80408d:	83 d6 00             	adc    $0x0,%esi
+  804090:	f7 de                	neg    %esi
+  804092:	0f 49 cf             	cmovns %edi,%ecx
+  804095:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  804099:	0f 49 de             	cmovns %esi,%ebx
+  80409c:	89 5c 24 0c          	mov    %ebx,0xc(%esp)
+  8040a0:	ff 74 24 0c          	push   0xc(%esp)
+  8040a4:	ff 74 24 0c          	push   0xc(%esp)
+  8040a8:	e8 e2 fd ff ff       	call   803e8f <dm>
+  8040ad:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8040b1:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8040b5:	f7 d8                	neg    %eax
+  8040b7:	83 d2 00             	adc    $0x0,%edx
+  8040ba:	f7 da                	neg    %edx
+  8040bc:	83 c4 10             	add    $0x10,%esp
+  8040bf:	83 c4 24             	add    $0x24,%esp
+  8040c2:	5b                   	pop    %ebx
+  8040c3:	5e                   	pop    %esi
+  8040c4:	5f                   	pop    %edi
+  8040c5:	5d                   	pop    %ebp
+  8040c6:	c3                   	ret
@@ -0,0 +1,8159 @@
+
+obj/user/testring.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 37 05 00 00       	call   800568 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <check>:
+	memset(p, c, PGSIZE);
+}
+
+static void
+check(const char *p, char c, const char *what, int i)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	57                   	push   %edi
+  800037:	56                   	push   %esi
+  800038:	53                   	push   %ebx
+  800039:	83 ec 0c             	sub    $0xc,%esp
+  80003c:	89 c3                	mov    %eax,%ebx
+  80003e:	89 d6                	mov    %edx,%esi
+  800040:	89 cf                	mov    %ecx,%edi
+  800042:	89 d1                	mov    %edx,%ecx
+	int j;
+
+	for (j = 0; j < PGSIZE; j++)
+  800044:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (p[j] != c)
+  800049:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  80004d:	38 ca                	cmp    %cl,%dl
+  80004f:	75 12                	jne    800063 <check+0x30>
+	for (j = 0; j < PGSIZE; j++)
+  800051:	83 c0 01             	add    $0x1,%eax
+  800054:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  800059:	75 ee                	jne    800049 <check+0x16>
+			panic("%s %d: byte %d is %02x, wanted %02x",
+			      what, i, j, (unsigned char) p[j], (unsigned char) c);
+}
+  80005b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80005e:	5b                   	pop    %ebx
+  80005f:	5e                   	pop    %esi
+  800060:	5f                   	pop    %edi
+  800061:	5d                   	pop    %ebp
+  800062:	c3                   	ret
+			panic("%s %d: byte %d is %02x, wanted %02x",
+  800063:	89 f3                	mov    %esi,%ebx
+  800065:	0f b6 f3             	movzbl %bl,%esi
+  800068:	56                   	push   %esi
+  800069:	0f b6 d2             	movzbl %dl,%edx
+  80006c:	52                   	push   %edx
+  80006d:	50                   	push   %eax
+  80006e:	ff 75 08             	push   0x8(%ebp)
+  800071:	57                   	push   %edi
+  800072:	68 80 3c 80 00       	push   $0x803c80
+  800077:	6a 19                	push   $0x19
+  800079:	68 4f 3d 80 00       	push   $0x803d4f
+  80007e:	e8 48 05 00 00       	call   8005cb <_panic>
+
+00800083 <umain>:
+
+void
+umain(int argc, char **argv)
+{
+  800083:	55                   	push   %ebp
+  800084:	89 e5                	mov    %esp,%ebp
+  800086:	57                   	push   %edi
+  800087:	56                   	push   %esi
+  800088:	53                   	push   %ebx
+  800089:	83 ec 34             	sub    $0x34,%esp
+	uint32_t tag, seen = 0;
+	int r, f, i, n, result;
+
+	if ((f = open("/ringfile", O_RDWR|O_CREAT|O_TRUNC|O_NOBUF)) < 0)
+  80008c:	68 02 13 00 00       	push   $0x1302
+  800091:	68 5f 3d 80 00       	push   $0x803d5f
+  800096:	e8 9f 21 00 00       	call   80223a <open>
+  80009b:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  80009e:	83 c4 10             	add    $0x10,%esp
+  8000a1:	85 c0                	test   %eax,%eax
+  8000a3:	78 53                	js     8000f8 <umain+0x75>
+  8000a5:	bb 61 00 00 00       	mov    $0x61,%ebx
+  8000aa:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+	memset(p, c, PGSIZE);
+  8000ad:	83 ec 04             	sub    $0x4,%esp
+  8000b0:	68 00 10 00 00       	push   $0x1000
+  8000b5:	53                   	push   %ebx
+  8000b6:	68 c0 68 81 00       	push   $0x8168c0
+  8000bb:	e8 25 0d 00 00       	call   800de5 <memset>
+		panic("open /ringfile: %e", f);
+	for (i = 0; i < FSRING_NSLOTS; i++) {
+		fill(page, 'a' + i);
+		if ((r = write(f, page, PGSIZE)) != PGSIZE)
+  8000c0:	83 c4 0c             	add    $0xc,%esp
+  8000c3:	68 00 10 00 00       	push   $0x1000
+  8000c8:	68 c0 68 81 00       	push   $0x8168c0
+  8000cd:	56                   	push   %esi
+  8000ce:	e8 7f 17 00 00       	call   801852 <write>
+  8000d3:	83 c3 01             	add    $0x1,%ebx
+  8000d6:	83 c4 10             	add    $0x10,%esp
+  8000d9:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  8000de:	75 2a                	jne    80010a <umain+0x87>
+	for (i = 0; i < FSRING_NSLOTS; i++) {
+  8000e0:	83 fb 71             	cmp    $0x71,%ebx
+  8000e3:	75 c8                	jne    8000ad <umain+0x2a>
+  8000e5:	c7 45 d0 00 60 80 00 	movl   $0x806000,-0x30(%ebp)
+  8000ec:	bb 64 00 00 00       	mov    $0x64,%ebx
+  8000f1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8000f6:	eb 67                	jmp    80015f <umain+0xdc>
+		panic("open /ringfile: %e", f);
+  8000f8:	50                   	push   %eax
+  8000f9:	68 69 3d 80 00       	push   $0x803d69
+  8000fe:	6a 24                	push   $0x24
+  800100:	68 4f 3d 80 00       	push   $0x803d4f
+  800105:	e8 c1 04 00 00       	call   8005cb <_panic>
+			panic("write /ringfile: %e", r);
+  80010a:	50                   	push   %eax
+  80010b:	68 7c 3d 80 00       	push   $0x803d7c
+  800110:	6a 28                	push   $0x28
+  800112:	68 4f 3d 80 00       	push   $0x803d4f
+  800117:	e8 af 04 00 00       	call   8005cb <_panic>
+	memset(p, c, PGSIZE);
+  80011c:	83 ec 04             	sub    $0x4,%esp
+  80011f:	68 00 10 00 00       	push   $0x1000
+	// Fill every slot with a mix of writes, reads and stats, each
+	// on its own page of the file
+	for (i = 0; i < FSRING_NSLOTS; i++) {
+		switch (i % 3) {
+		case 0:
+			fill(page, 'A' + i);
+  800124:	8d 43 dd             	lea    -0x23(%ebx),%eax
+	memset(p, c, PGSIZE);
+  800127:	50                   	push   %eax
+  800128:	68 c0 68 81 00       	push   $0x8168c0
+  80012d:	e8 b3 0c 00 00       	call   800de5 <memset>
+			r = fsring_write(f, page, PGSIZE, i * PGSIZE, 100 + i);
+  800132:	89 1c 24             	mov    %ebx,(%esp)
+  800135:	57                   	push   %edi
+  800136:	68 00 10 00 00       	push   $0x1000
+  80013b:	68 c0 68 81 00       	push   $0x8168c0
+  800140:	ff 75 d4             	push   -0x2c(%ebp)
+  800143:	e8 20 25 00 00       	call   802668 <fsring_write>
+			break;
+  800148:	83 c4 20             	add    $0x20,%esp
+			break;
+		default:
+			r = fsring_stat(f, &sts[i], 100 + i);
+			break;
+		}
+		if (r < 0)
+  80014b:	81 c7 00 10 00 00    	add    $0x1000,%edi
+  800151:	83 c3 01             	add    $0x1,%ebx
+  800154:	81 45 d0 8c 00 00 00 	addl   $0x8c,-0x30(%ebp)
+  80015b:	85 c0                	test   %eax,%eax
+  80015d:	78 56                	js     8001b5 <umain+0x132>
+  80015f:	8d 73 9c             	lea    -0x64(%ebx),%esi
+	for (i = 0; i < FSRING_NSLOTS; i++) {
+  800162:	83 fb 74             	cmp    $0x74,%ebx
+  800165:	74 64                	je     8001cb <umain+0x148>
+		switch (i % 3) {
+  800167:	b8 56 55 55 55       	mov    $0x55555556,%eax
+  80016c:	f7 ee                	imul   %esi
+  80016e:	89 f0                	mov    %esi,%eax
+  800170:	c1 f8 1f             	sar    $0x1f,%eax
+  800173:	29 c2                	sub    %eax,%edx
+  800175:	8d 04 52             	lea    (%edx,%edx,2),%eax
+  800178:	89 f2                	mov    %esi,%edx
+  80017a:	29 c2                	sub    %eax,%edx
+  80017c:	74 9e                	je     80011c <umain+0x99>
+  80017e:	83 fa 01             	cmp    $0x1,%edx
+  800181:	74 14                	je     800197 <umain+0x114>
+			r = fsring_stat(f, &sts[i], 100 + i);
+  800183:	83 ec 04             	sub    $0x4,%esp
+  800186:	53                   	push   %ebx
+  800187:	ff 75 d0             	push   -0x30(%ebp)
+  80018a:	ff 75 d4             	push   -0x2c(%ebp)
+  80018d:	e8 79 25 00 00       	call   80270b <fsring_stat>
+			break;
+  800192:	83 c4 10             	add    $0x10,%esp
+  800195:	eb b4                	jmp    80014b <umain+0xc8>
+			r = fsring_read(f, rbuf[i], PGSIZE, i * PGSIZE, 100 + i);
+  800197:	83 ec 0c             	sub    $0xc,%esp
+  80019a:	53                   	push   %ebx
+  80019b:	57                   	push   %edi
+  80019c:	68 00 10 00 00       	push   $0x1000
+  8001a1:	8d 87 c0 68 80 00    	lea    0x8068c0(%edi),%eax
+  8001a7:	50                   	push   %eax
+  8001a8:	ff 75 d4             	push   -0x2c(%ebp)
+  8001ab:	e8 30 24 00 00       	call   8025e0 <fsring_read>
+			break;
+  8001b0:	83 c4 20             	add    $0x20,%esp
+  8001b3:	eb 96                	jmp    80014b <umain+0xc8>
+			panic("fsring post %d: %e", i, r);
+  8001b5:	83 ec 0c             	sub    $0xc,%esp
+  8001b8:	50                   	push   %eax
+  8001b9:	56                   	push   %esi
+  8001ba:	68 90 3d 80 00       	push   $0x803d90
+  8001bf:	6a 3b                	push   $0x3b
+  8001c1:	68 4f 3d 80 00       	push   $0x803d4f
+  8001c6:	e8 00 04 00 00       	call   8005cb <_panic>
+	}
+	if ((r = fsring_stat(f, &sts[0], 99)) != -E_NO_MEM)
+  8001cb:	83 ec 04             	sub    $0x4,%esp
+  8001ce:	6a 63                	push   $0x63
+  8001d0:	68 00 60 80 00       	push   $0x806000
+  8001d5:	ff 75 d4             	push   -0x2c(%ebp)
+  8001d8:	e8 2e 25 00 00       	call   80270b <fsring_stat>
+  8001dd:	83 c4 10             	add    $0x10,%esp
+  8001e0:	83 f8 fc             	cmp    $0xfffffffc,%eax
+  8001e3:	75 0f                	jne    8001f4 <umain+0x171>
+		panic("fsring post on a full ring returned %d", r);
+
+	for (n = 0; n < FSRING_NSLOTS; n++) {
+  8001e5:	be 00 00 00 00       	mov    $0x0,%esi
+	uint32_t tag, seen = 0;
+  8001ea:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (!fsring_reap(&tag, &result, 1))
+  8001ef:	8d 7d e0             	lea    -0x20(%ebp),%edi
+  8001f2:	eb 50                	jmp    800244 <umain+0x1c1>
+		panic("fsring post on a full ring returned %d", r);
+  8001f4:	50                   	push   %eax
+  8001f5:	68 a4 3c 80 00       	push   $0x803ca4
+  8001fa:	6a 3e                	push   $0x3e
+  8001fc:	68 4f 3d 80 00       	push   $0x803d4f
+  800201:	e8 c5 03 00 00       	call   8005cb <_panic>
+			panic("fsring_reap: nothing after %d results", n);
+  800206:	56                   	push   %esi
+  800207:	68 cc 3c 80 00       	push   $0x803ccc
+  80020c:	6a 42                	push   $0x42
+  80020e:	68 4f 3d 80 00       	push   $0x803d4f
+  800213:	e8 b3 03 00 00       	call   8005cb <_panic>
+		i = tag - 100;
+		if (tag < 100 || i >= FSRING_NSLOTS || (seen & (1 << i)))
+			panic("fsring_reap: bad tag %d", tag);
+  800218:	52                   	push   %edx
+  800219:	68 a3 3d 80 00       	push   $0x803da3
+  80021e:	6a 45                	push   $0x45
+  800220:	68 4f 3d 80 00       	push   $0x803d4f
+  800225:	e8 a1 03 00 00       	call   8005cb <_panic>
+		seen |= 1 << i;
+		switch (i % 3) {
+		case 0:
+			if (result != PGSIZE)
+  80022a:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80022d:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  800232:	0f 85 91 00 00 00    	jne    8002c9 <umain+0x246>
+	for (n = 0; n < FSRING_NSLOTS; n++) {
+  800238:	83 c6 01             	add    $0x1,%esi
+  80023b:	83 fe 10             	cmp    $0x10,%esi
+  80023e:	0f 84 f7 00 00 00    	je     80033b <umain+0x2b8>
+		if (!fsring_reap(&tag, &result, 1))
+  800244:	83 ec 04             	sub    $0x4,%esp
+  800247:	6a 01                	push   $0x1
+  800249:	57                   	push   %edi
+  80024a:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80024d:	50                   	push   %eax
+  80024e:	e8 1b 25 00 00       	call   80276e <fsring_reap>
+  800253:	83 c4 10             	add    $0x10,%esp
+  800256:	85 c0                	test   %eax,%eax
+  800258:	74 ac                	je     800206 <umain+0x183>
+		i = tag - 100;
+  80025a:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  80025d:	8d 4a 9c             	lea    -0x64(%edx),%ecx
+		if (tag < 100 || i >= FSRING_NSLOTS || (seen & (1 << i)))
+  800260:	83 f9 0f             	cmp    $0xf,%ecx
+  800263:	7f b3                	jg     800218 <umain+0x195>
+  800265:	83 fa 63             	cmp    $0x63,%edx
+  800268:	76 ae                	jbe    800218 <umain+0x195>
+  80026a:	b8 01 00 00 00       	mov    $0x1,%eax
+  80026f:	d3 e0                	shl    %cl,%eax
+  800271:	85 d8                	test   %ebx,%eax
+  800273:	75 a3                	jne    800218 <umain+0x195>
+		seen |= 1 << i;
+  800275:	09 c3                	or     %eax,%ebx
+		switch (i % 3) {
+  800277:	ba 56 55 55 55       	mov    $0x55555556,%edx
+  80027c:	89 c8                	mov    %ecx,%eax
+  80027e:	f7 ea                	imul   %edx
+  800280:	89 c8                	mov    %ecx,%eax
+  800282:	c1 f8 1f             	sar    $0x1f,%eax
+  800285:	29 c2                	sub    %eax,%edx
+  800287:	8d 04 52             	lea    (%edx,%edx,2),%eax
+  80028a:	89 ca                	mov    %ecx,%edx
+  80028c:	29 c2                	sub    %eax,%edx
+  80028e:	74 9a                	je     80022a <umain+0x1a7>
+  800290:	83 fa 01             	cmp    $0x1,%edx
+  800293:	74 4a                	je     8002df <umain+0x25c>
+			if (result != PGSIZE)
+				panic("fsring read %d returned %d", i, result);
+			check(rbuf[i], 'a' + i, "fsring read", i);
+			break;
+		default:
+			if (result != 0)
+  800295:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800298:	85 c0                	test   %eax,%eax
+  80029a:	0f 85 85 00 00 00    	jne    800325 <umain+0x2a2>
+				panic("fsring stat %d returned %d", i, result);
+			if (sts[i].st_size != FSRING_NSLOTS * PGSIZE)
+  8002a0:	69 c1 8c 00 00 00    	imul   $0x8c,%ecx,%eax
+  8002a6:	8b 80 80 60 80 00    	mov    0x806080(%eax),%eax
+  8002ac:	3d 00 00 01 00       	cmp    $0x10000,%eax
+  8002b1:	74 85                	je     800238 <umain+0x1b5>
+				panic("fsring stat %d: size %d", i, sts[i].st_size);
+  8002b3:	83 ec 0c             	sub    $0xc,%esp
+  8002b6:	50                   	push   %eax
+  8002b7:	51                   	push   %ecx
+  8002b8:	68 19 3e 80 00       	push   $0x803e19
+  8002bd:	6a 55                	push   $0x55
+  8002bf:	68 4f 3d 80 00       	push   $0x803d4f
+  8002c4:	e8 02 03 00 00       	call   8005cb <_panic>
+				panic("fsring write %d returned %d", i, result);
+  8002c9:	83 ec 0c             	sub    $0xc,%esp
+  8002cc:	50                   	push   %eax
+  8002cd:	51                   	push   %ecx
+  8002ce:	68 bb 3d 80 00       	push   $0x803dbb
+  8002d3:	6a 4a                	push   $0x4a
+  8002d5:	68 4f 3d 80 00       	push   $0x803d4f
+  8002da:	e8 ec 02 00 00       	call   8005cb <_panic>
+			if (result != PGSIZE)
+  8002df:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8002e2:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  8002e7:	75 26                	jne    80030f <umain+0x28c>
+			check(rbuf[i], 'a' + i, "fsring read", i);
+  8002e9:	8d 51 61             	lea    0x61(%ecx),%edx
+  8002ec:	0f be d2             	movsbl %dl,%edx
+  8002ef:	89 c8                	mov    %ecx,%eax
+  8002f1:	c1 e0 0c             	shl    $0xc,%eax
+  8002f4:	05 c0 68 80 00       	add    $0x8068c0,%eax
+  8002f9:	83 ec 0c             	sub    $0xc,%esp
+  8002fc:	51                   	push   %ecx
+  8002fd:	b9 f2 3d 80 00       	mov    $0x803df2,%ecx
+  800302:	e8 2c fd ff ff       	call   800033 <check>
+  800307:	83 c4 10             	add    $0x10,%esp
+			break;
+  80030a:	e9 29 ff ff ff       	jmp    800238 <umain+0x1b5>
+				panic("fsring read %d returned %d", i, result);
+  80030f:	83 ec 0c             	sub    $0xc,%esp
+  800312:	50                   	push   %eax
+  800313:	51                   	push   %ecx
+  800314:	68 d7 3d 80 00       	push   $0x803dd7
+  800319:	6a 4e                	push   $0x4e
+  80031b:	68 4f 3d 80 00       	push   $0x803d4f
+  800320:	e8 a6 02 00 00       	call   8005cb <_panic>
+				panic("fsring stat %d returned %d", i, result);
+  800325:	83 ec 0c             	sub    $0xc,%esp
+  800328:	50                   	push   %eax
+  800329:	51                   	push   %ecx
+  80032a:	68 fe 3d 80 00       	push   $0x803dfe
+  80032f:	6a 53                	push   $0x53
+  800331:	68 4f 3d 80 00       	push   $0x803d4f
+  800336:	e8 90 02 00 00       	call   8005cb <_panic>
+			break;
+		}
+	}
+	if (fsring_reap(&tag, &result, 1))
+  80033b:	83 ec 04             	sub    $0x4,%esp
+  80033e:	6a 01                	push   $0x1
+  800340:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  800343:	50                   	push   %eax
+  800344:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  800347:	50                   	push   %eax
+  800348:	e8 21 24 00 00       	call   80276e <fsring_reap>
+  80034d:	89 c3                	mov    %eax,%ebx
+  80034f:	83 c4 10             	add    $0x10,%esp
+  800352:	85 c0                	test   %eax,%eax
+  800354:	0f 85 8e 01 00 00    	jne    8004e8 <umain+0x465>
+		panic("fsring_reap returned tag %d with nothing outstanding", tag);
+
+	for (i = 0; i < FSRING_NSLOTS; i += 3) {
+  80035a:	89 c6                	mov    %eax,%esi
+  80035c:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+		seek(f, i * PGSIZE);
+  80035f:	83 ec 08             	sub    $0x8,%esp
+  800362:	89 f0                	mov    %esi,%eax
+  800364:	c1 e0 0c             	shl    $0xc,%eax
+  800367:	50                   	push   %eax
+  800368:	57                   	push   %edi
+  800369:	e8 66 15 00 00       	call   8018d4 <seek>
+		if ((r = readn(f, page, PGSIZE)) != PGSIZE)
+  80036e:	83 c4 0c             	add    $0xc,%esp
+  800371:	68 00 10 00 00       	push   $0x1000
+  800376:	68 c0 68 81 00       	push   $0x8168c0
+  80037b:	57                   	push   %edi
+  80037c:	e8 8a 14 00 00       	call   80180b <readn>
+  800381:	83 c4 10             	add    $0x10,%esp
+  800384:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  800389:	0f 85 6d 01 00 00    	jne    8004fc <umain+0x479>
+			panic("read /ringfile: %e", r);
+		check(page, 'A' + i, "fsring write", i);
+  80038f:	8d 56 41             	lea    0x41(%esi),%edx
+  800392:	83 ec 0c             	sub    $0xc,%esp
+  800395:	56                   	push   %esi
+  800396:	b9 44 3e 80 00       	mov    $0x803e44,%ecx
+  80039b:	b8 c0 68 81 00       	mov    $0x8168c0,%eax
+  8003a0:	e8 8e fc ff ff       	call   800033 <check>
+  8003a5:	83 c4 10             	add    $0x10,%esp
+	for (i = 0; i < FSRING_NSLOTS; i += 3) {
+  8003a8:	83 c6 03             	add    $0x3,%esi
+  8003ab:	83 fe 12             	cmp    $0x12,%esi
+  8003ae:	75 af                	jne    80035f <umain+0x2dc>
+	}
+	cprintf("fsring requests are good\n");
+  8003b0:	83 ec 0c             	sub    $0xc,%esp
+  8003b3:	68 51 3e 80 00       	push   $0x803e51
+  8003b8:	e8 e9 02 00 00       	call   8006a6 <cprintf>
+  8003bd:	83 c4 10             	add    $0x10,%esp
+
+	// Post again as soon as the ring drains, so that the post races
+	// with the server going idle; a lost kick hangs here
+	for (i = 0; i < NREPOST; i++) {
+		fill(page, '0' + i % 10);
+  8003c0:	b8 67 66 66 66       	mov    $0x66666667,%eax
+  8003c5:	f7 eb                	imul   %ebx
+  8003c7:	c1 fa 02             	sar    $0x2,%edx
+  8003ca:	89 d8                	mov    %ebx,%eax
+  8003cc:	c1 f8 1f             	sar    $0x1f,%eax
+  8003cf:	29 c2                	sub    %eax,%edx
+  8003d1:	8d 04 92             	lea    (%edx,%edx,4),%eax
+  8003d4:	01 c0                	add    %eax,%eax
+  8003d6:	89 de                	mov    %ebx,%esi
+  8003d8:	29 c6                	sub    %eax,%esi
+  8003da:	8d 46 30             	lea    0x30(%esi),%eax
+  8003dd:	0f be f0             	movsbl %al,%esi
+	memset(p, c, PGSIZE);
+  8003e0:	83 ec 04             	sub    $0x4,%esp
+  8003e3:	68 00 10 00 00       	push   $0x1000
+  8003e8:	56                   	push   %esi
+  8003e9:	68 c0 68 81 00       	push   $0x8168c0
+  8003ee:	e8 f2 09 00 00       	call   800de5 <memset>
+		if ((r = fsring_write(f, page, PGSIZE, 0, i)) < 0)
+  8003f3:	89 1c 24             	mov    %ebx,(%esp)
+  8003f6:	6a 00                	push   $0x0
+  8003f8:	68 00 10 00 00       	push   $0x1000
+  8003fd:	68 c0 68 81 00       	push   $0x8168c0
+  800402:	ff 75 d4             	push   -0x2c(%ebp)
+  800405:	e8 5e 22 00 00       	call   802668 <fsring_write>
+  80040a:	83 c4 20             	add    $0x20,%esp
+  80040d:	85 c0                	test   %eax,%eax
+  80040f:	0f 88 f9 00 00 00    	js     80050e <umain+0x48b>
+			panic("fsring_write: %e", r);
+		if (!fsring_reap(&tag, &result, 1) || tag != i || result != PGSIZE)
+  800415:	83 ec 04             	sub    $0x4,%esp
+  800418:	6a 01                	push   $0x1
+  80041a:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  80041d:	50                   	push   %eax
+  80041e:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  800421:	50                   	push   %eax
+  800422:	e8 47 23 00 00       	call   80276e <fsring_reap>
+  800427:	83 c4 10             	add    $0x10,%esp
+  80042a:	85 c0                	test   %eax,%eax
+  80042c:	0f 84 ee 00 00 00    	je     800520 <umain+0x49d>
+  800432:	39 5d e4             	cmp    %ebx,-0x1c(%ebp)
+  800435:	0f 85 e5 00 00 00    	jne    800520 <umain+0x49d>
+  80043b:	81 7d e0 00 10 00 00 	cmpl   $0x1000,-0x20(%ebp)
+  800442:	0f 85 d8 00 00 00    	jne    800520 <umain+0x49d>
+			panic("fsring repost %d: tag %d result %d", i, tag, result);
+		if ((r = fsring_read(f, rbuf[0], PGSIZE, 0, i)) < 0)
+  800448:	83 ec 0c             	sub    $0xc,%esp
+  80044b:	53                   	push   %ebx
+  80044c:	6a 00                	push   $0x0
+  80044e:	68 00 10 00 00       	push   $0x1000
+  800453:	68 c0 68 80 00       	push   $0x8068c0
+  800458:	ff 75 d4             	push   -0x2c(%ebp)
+  80045b:	e8 80 21 00 00       	call   8025e0 <fsring_read>
+  800460:	83 c4 20             	add    $0x20,%esp
+  800463:	85 c0                	test   %eax,%eax
+  800465:	0f 88 d0 00 00 00    	js     80053b <umain+0x4b8>
+			panic("fsring_read: %e", r);
+		if (!fsring_reap(&tag, &result, 1) || tag != i || result != PGSIZE)
+  80046b:	83 ec 04             	sub    $0x4,%esp
+  80046e:	6a 01                	push   $0x1
+  800470:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  800473:	50                   	push   %eax
+  800474:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  800477:	50                   	push   %eax
+  800478:	e8 f1 22 00 00       	call   80276e <fsring_reap>
+  80047d:	83 c4 10             	add    $0x10,%esp
+  800480:	85 c0                	test   %eax,%eax
+  800482:	0f 84 c5 00 00 00    	je     80054d <umain+0x4ca>
+  800488:	39 5d e4             	cmp    %ebx,-0x1c(%ebp)
+  80048b:	0f 85 bc 00 00 00    	jne    80054d <umain+0x4ca>
+  800491:	81 7d e0 00 10 00 00 	cmpl   $0x1000,-0x20(%ebp)
+  800498:	0f 85 af 00 00 00    	jne    80054d <umain+0x4ca>
+			panic("fsring repost %d: tag %d result %d", i, tag, result);
+		check(rbuf[0], '0' + i % 10, "fsring repost", i);
+  80049e:	83 ec 0c             	sub    $0xc,%esp
+  8004a1:	53                   	push   %ebx
+  8004a2:	b9 8c 3e 80 00       	mov    $0x803e8c,%ecx
+  8004a7:	89 f2                	mov    %esi,%edx
+  8004a9:	b8 c0 68 80 00       	mov    $0x8068c0,%eax
+  8004ae:	e8 80 fb ff ff       	call   800033 <check>
+  8004b3:	83 c4 10             	add    $0x10,%esp
+	for (i = 0; i < NREPOST; i++) {
+  8004b6:	83 c3 01             	add    $0x1,%ebx
+  8004b9:	81 fb c8 00 00 00    	cmp    $0xc8,%ebx
+  8004bf:	0f 85 fb fe ff ff    	jne    8003c0 <umain+0x33d>
+	}
+	cprintf("fsring repost is good\n");
+  8004c5:	83 ec 0c             	sub    $0xc,%esp
+  8004c8:	68 9a 3e 80 00       	push   $0x803e9a
+  8004cd:	e8 d4 01 00 00       	call   8006a6 <cprintf>
+
+	close(f);
+  8004d2:	83 c4 04             	add    $0x4,%esp
+  8004d5:	ff 75 d4             	push   -0x2c(%ebp)
+  8004d8:	e8 6b 11 00 00       	call   801648 <close>
+}
+  8004dd:	83 c4 10             	add    $0x10,%esp
+  8004e0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8004e3:	5b                   	pop    %ebx
+  8004e4:	5e                   	pop    %esi
+  8004e5:	5f                   	pop    %edi
+  8004e6:	5d                   	pop    %ebp
+  8004e7:	c3                   	ret
+		panic("fsring_reap returned tag %d with nothing outstanding", tag);
+  8004e8:	ff 75 e4             	push   -0x1c(%ebp)
+  8004eb:	68 f4 3c 80 00       	push   $0x803cf4
+  8004f0:	6a 5a                	push   $0x5a
+  8004f2:	68 4f 3d 80 00       	push   $0x803d4f
+  8004f7:	e8 cf 00 00 00       	call   8005cb <_panic>
+			panic("read /ringfile: %e", r);
+  8004fc:	50                   	push   %eax
+  8004fd:	68 31 3e 80 00       	push   $0x803e31
+  800502:	6a 5f                	push   $0x5f
+  800504:	68 4f 3d 80 00       	push   $0x803d4f
+  800509:	e8 bd 00 00 00       	call   8005cb <_panic>
+			panic("fsring_write: %e", r);
+  80050e:	50                   	push   %eax
+  80050f:	68 6b 3e 80 00       	push   $0x803e6b
+  800514:	6a 69                	push   $0x69
+  800516:	68 4f 3d 80 00       	push   $0x803d4f
+  80051b:	e8 ab 00 00 00       	call   8005cb <_panic>
+			panic("fsring repost %d: tag %d result %d", i, tag, result);
+  800520:	83 ec 08             	sub    $0x8,%esp
+  800523:	ff 75 e0             	push   -0x20(%ebp)
+  800526:	ff 75 e4             	push   -0x1c(%ebp)
+  800529:	53                   	push   %ebx
+  80052a:	68 2c 3d 80 00       	push   $0x803d2c
+  80052f:	6a 6b                	push   $0x6b
+  800531:	68 4f 3d 80 00       	push   $0x803d4f
+  800536:	e8 90 00 00 00       	call   8005cb <_panic>
+			panic("fsring_read: %e", r);
+  80053b:	50                   	push   %eax
+  80053c:	68 7c 3e 80 00       	push   $0x803e7c
+  800541:	6a 6d                	push   $0x6d
+  800543:	68 4f 3d 80 00       	push   $0x803d4f
+  800548:	e8 7e 00 00 00       	call   8005cb <_panic>
+			panic("fsring repost %d: tag %d result %d", i, tag, result);
+  80054d:	83 ec 08             	sub    $0x8,%esp
+  800550:	ff 75 e0             	push   -0x20(%ebp)
+  800553:	ff 75 e4             	push   -0x1c(%ebp)
+  800556:	53                   	push   %ebx
+  800557:	68 2c 3d 80 00       	push   $0x803d2c
+  80055c:	6a 6f                	push   $0x6f
+  80055e:	68 4f 3d 80 00       	push   $0x803d4f
+  800563:	e8 63 00 00 00       	call   8005cb <_panic>
+
+00800568 <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  800568:	55                   	push   %ebp
+  800569:	89 e5                	mov    %esp,%ebp
+  80056b:	56                   	push   %esi
+  80056c:	53                   	push   %ebx
+  80056d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800570:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = &envs[ENVX(sys_getenvid())];
+  800573:	e8 e2 0a 00 00       	call   80105a <sys_getenvid>
+  800578:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80057d:	69 c0 8c 00 00 00    	imul   $0x8c,%eax,%eax
+  800583:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800588:	a3 c0 78 81 00       	mov    %eax,0x8178c0
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  80058d:	85 db                	test   %ebx,%ebx
+  80058f:	7e 07                	jle    800598 <libmain+0x30>
+		binaryname = argv[0];
+  800591:	8b 06                	mov    (%esi),%eax
+  800593:	a3 00 50 80 00       	mov    %eax,0x805000
+
+	// call user main routine
+	umain(argc, argv);
+  800598:	83 ec 08             	sub    $0x8,%esp
+  80059b:	56                   	push   %esi
+  80059c:	53                   	push   %ebx
+  80059d:	e8 e1 fa ff ff       	call   800083 <umain>
+
+	// exit gracefully
+	exit();
+  8005a2:	e8 0a 00 00 00       	call   8005b1 <exit>
+}
+  8005a7:	83 c4 10             	add    $0x10,%esp
+  8005aa:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8005ad:	5b                   	pop    %ebx
+  8005ae:	5e                   	pop    %esi
+  8005af:	5d                   	pop    %ebp
+  8005b0:	c3                   	ret
+
+008005b1 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  8005b1:	55                   	push   %ebp
+  8005b2:	89 e5                	mov    %esp,%ebp
+  8005b4:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  8005b7:	e8 b9 10 00 00       	call   801675 <close_all>
+	sys_env_destroy(0);
+  8005bc:	83 ec 0c             	sub    $0xc,%esp
+  8005bf:	6a 00                	push   $0x0
+  8005c1:	e8 4b 0a 00 00       	call   801011 <sys_env_destroy>
+}
+  8005c6:	83 c4 10             	add    $0x10,%esp
+  8005c9:	c9                   	leave
+  8005ca:	c3                   	ret
+
+008005cb <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  8005cb:	55                   	push   %ebp
+  8005cc:	89 e5                	mov    %esp,%ebp
+  8005ce:	56                   	push   %esi
+  8005cf:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  8005d0:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  8005d3:	8b 35 00 50 80 00    	mov    0x805000,%esi
+  8005d9:	e8 7c 0a 00 00       	call   80105a <sys_getenvid>
+  8005de:	83 ec 0c             	sub    $0xc,%esp
+  8005e1:	ff 75 0c             	push   0xc(%ebp)
+  8005e4:	ff 75 08             	push   0x8(%ebp)
+  8005e7:	56                   	push   %esi
+  8005e8:	50                   	push   %eax
+  8005e9:	68 bc 3e 80 00       	push   $0x803ebc
+  8005ee:	e8 b3 00 00 00       	call   8006a6 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  8005f3:	83 c4 18             	add    $0x18,%esp
+  8005f6:	53                   	push   %ebx
+  8005f7:	ff 75 10             	push   0x10(%ebp)
+  8005fa:	e8 56 00 00 00       	call   800655 <vcprintf>
+	cprintf("\n");
+  8005ff:	c7 04 24 87 43 80 00 	movl   $0x804387,(%esp)
+  800606:	e8 9b 00 00 00       	call   8006a6 <cprintf>
+  80060b:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  80060e:	cc                   	int3
+	while (1)
+  80060f:	eb fd                	jmp    80060e <_panic+0x43>
+
+00800611 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  800611:	55                   	push   %ebp
+  800612:	89 e5                	mov    %esp,%ebp
+  800614:	53                   	push   %ebx
+  800615:	83 ec 04             	sub    $0x4,%esp
+  800618:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  80061b:	8b 13                	mov    (%ebx),%edx
+  80061d:	8d 42 01             	lea    0x1(%edx),%eax
+  800620:	89 03                	mov    %eax,(%ebx)
+  800622:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800625:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  800629:	3d ff 00 00 00       	cmp    $0xff,%eax
+  80062e:	74 09                	je     800639 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  800630:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  800634:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800637:	c9                   	leave
+  800638:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  800639:	83 ec 08             	sub    $0x8,%esp
+  80063c:	68 ff 00 00 00       	push   $0xff
+  800641:	8d 43 08             	lea    0x8(%ebx),%eax
+  800644:	50                   	push   %eax
+  800645:	e8 7a 09 00 00       	call   800fc4 <sys_cputs>
+		b->idx = 0;
+  80064a:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  800650:	83 c4 10             	add    $0x10,%esp
+  800653:	eb db                	jmp    800630 <putch+0x1f>
+
+00800655 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  800655:	55                   	push   %ebp
+  800656:	89 e5                	mov    %esp,%ebp
+  800658:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  80065e:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  800665:	00 00 00 
+	b.cnt = 0;
+  800668:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  80066f:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  800672:	ff 75 0c             	push   0xc(%ebp)
+  800675:	ff 75 08             	push   0x8(%ebp)
+  800678:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  80067e:	50                   	push   %eax
+  80067f:	68 11 06 80 00       	push   $0x800611
+  800684:	e8 14 01 00 00       	call   80079d <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  800689:	83 c4 08             	add    $0x8,%esp
+  80068c:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  800692:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  800698:	50                   	push   %eax
+  800699:	e8 26 09 00 00       	call   800fc4 <sys_cputs>
+
+	return b.cnt;
+}
+  80069e:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  8006a4:	c9                   	leave
+  8006a5:	c3                   	ret
+
+008006a6 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  8006a6:	55                   	push   %ebp
+  8006a7:	89 e5                	mov    %esp,%ebp
+  8006a9:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  8006ac:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  8006af:	50                   	push   %eax
+  8006b0:	ff 75 08             	push   0x8(%ebp)
+  8006b3:	e8 9d ff ff ff       	call   800655 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  8006b8:	c9                   	leave
+  8006b9:	c3                   	ret
+
+008006ba <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  8006ba:	55                   	push   %ebp
+  8006bb:	89 e5                	mov    %esp,%ebp
+  8006bd:	57                   	push   %edi
+  8006be:	56                   	push   %esi
+  8006bf:	53                   	push   %ebx
+  8006c0:	83 ec 1c             	sub    $0x1c,%esp
+  8006c3:	89 c7                	mov    %eax,%edi
+  8006c5:	89 d6                	mov    %edx,%esi
+  8006c7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8006ca:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8006cd:	89 d1                	mov    %edx,%ecx
+  8006cf:	89 c2                	mov    %eax,%edx
+  8006d1:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8006d4:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8006d7:	8b 45 10             	mov    0x10(%ebp),%eax
+  8006da:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  8006dd:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8006e0:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8006e7:	39 c2                	cmp    %eax,%edx
+  8006e9:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  8006ec:	72 3e                	jb     80072c <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  8006ee:	83 ec 0c             	sub    $0xc,%esp
+  8006f1:	ff 75 18             	push   0x18(%ebp)
+  8006f4:	83 eb 01             	sub    $0x1,%ebx
+  8006f7:	53                   	push   %ebx
+  8006f8:	50                   	push   %eax
+  8006f9:	83 ec 08             	sub    $0x8,%esp
+  8006fc:	ff 75 e4             	push   -0x1c(%ebp)
+  8006ff:	ff 75 e0             	push   -0x20(%ebp)
+  800702:	ff 75 dc             	push   -0x24(%ebp)
+  800705:	ff 75 d8             	push   -0x28(%ebp)
+  800708:	e8 f1 33 00 00       	call   803afe <__udivdi3>
+  80070d:	83 c4 18             	add    $0x18,%esp
+  800710:	52                   	push   %edx
+  800711:	50                   	push   %eax
+  800712:	89 f2                	mov    %esi,%edx
+  800714:	89 f8                	mov    %edi,%eax
+  800716:	e8 9f ff ff ff       	call   8006ba <printnum>
+  80071b:	83 c4 20             	add    $0x20,%esp
+  80071e:	eb 13                	jmp    800733 <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  800720:	83 ec 08             	sub    $0x8,%esp
+  800723:	56                   	push   %esi
+  800724:	ff 75 18             	push   0x18(%ebp)
+  800727:	ff d7                	call   *%edi
+  800729:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  80072c:	83 eb 01             	sub    $0x1,%ebx
+  80072f:	85 db                	test   %ebx,%ebx
+  800731:	7f ed                	jg     800720 <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  800733:	83 ec 08             	sub    $0x8,%esp
+  800736:	56                   	push   %esi
+  800737:	83 ec 04             	sub    $0x4,%esp
+  80073a:	ff 75 e4             	push   -0x1c(%ebp)
+  80073d:	ff 75 e0             	push   -0x20(%ebp)
+  800740:	ff 75 dc             	push   -0x24(%ebp)
+  800743:	ff 75 d8             	push   -0x28(%ebp)
+  800746:	e8 d1 33 00 00       	call   803b1c <__umoddi3>
+  80074b:	83 c4 14             	add    $0x14,%esp
+  80074e:	0f be 80 df 3e 80 00 	movsbl 0x803edf(%eax),%eax
+  800755:	50                   	push   %eax
+  800756:	ff d7                	call   *%edi
+}
+  800758:	83 c4 10             	add    $0x10,%esp
+  80075b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80075e:	5b                   	pop    %ebx
+  80075f:	5e                   	pop    %esi
+  800760:	5f                   	pop    %edi
+  800761:	5d                   	pop    %ebp
+  800762:	c3                   	ret
+
+00800763 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  800763:	55                   	push   %ebp
+  800764:	89 e5                	mov    %esp,%ebp
+  800766:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  800769:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  80076d:	8b 10                	mov    (%eax),%edx
+  80076f:	3b 50 04             	cmp    0x4(%eax),%edx
+  800772:	73 0a                	jae    80077e <sprintputch+0x1b>
+		*b->buf++ = ch;
+  800774:	8d 4a 01             	lea    0x1(%edx),%ecx
+  800777:	89 08                	mov    %ecx,(%eax)
+  800779:	8b 45 08             	mov    0x8(%ebp),%eax
+  80077c:	88 02                	mov    %al,(%edx)
+}
+  80077e:	5d                   	pop    %ebp
+  80077f:	c3                   	ret
+
+00800780 <printfmt>:
+{
+  800780:	55                   	push   %ebp
+  800781:	89 e5                	mov    %esp,%ebp
+  800783:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  800786:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  800789:	50                   	push   %eax
+  80078a:	ff 75 10             	push   0x10(%ebp)
+  80078d:	ff 75 0c             	push   0xc(%ebp)
+  800790:	ff 75 08             	push   0x8(%ebp)
+  800793:	e8 05 00 00 00       	call   80079d <vprintfmt>
+}
+  800798:	83 c4 10             	add    $0x10,%esp
+  80079b:	c9                   	leave
+  80079c:	c3                   	ret
+
+0080079d <vprintfmt>:
+{
+  80079d:	55                   	push   %ebp
+  80079e:	89 e5                	mov    %esp,%ebp
+  8007a0:	57                   	push   %edi
+  8007a1:	56                   	push   %esi
+  8007a2:	53                   	push   %ebx
+  8007a3:	83 ec 2c             	sub    $0x2c,%esp
+  8007a6:	8b 75 08             	mov    0x8(%ebp),%esi
+  8007a9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8007ac:	8b 7d 10             	mov    0x10(%ebp),%edi
+  8007af:	eb 0a                	jmp    8007bb <vprintfmt+0x1e>
+			putch(ch, putdat);
+  8007b1:	83 ec 08             	sub    $0x8,%esp
+  8007b4:	53                   	push   %ebx
+  8007b5:	50                   	push   %eax
+  8007b6:	ff d6                	call   *%esi
+  8007b8:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8007bb:	83 c7 01             	add    $0x1,%edi
+  8007be:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  8007c2:	83 f8 25             	cmp    $0x25,%eax
+  8007c5:	74 0c                	je     8007d3 <vprintfmt+0x36>
+			if (ch == '\0')
+  8007c7:	85 c0                	test   %eax,%eax
+  8007c9:	75 e6                	jne    8007b1 <vprintfmt+0x14>
+}
+  8007cb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8007ce:	5b                   	pop    %ebx
+  8007cf:	5e                   	pop    %esi
+  8007d0:	5f                   	pop    %edi
+  8007d1:	5d                   	pop    %ebp
+  8007d2:	c3                   	ret
+		padc = ' ';
+  8007d3:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  8007d7:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  8007de:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  8007e5:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  8007ec:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  8007f1:	8d 47 01             	lea    0x1(%edi),%eax
+  8007f4:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8007f7:	0f b6 17             	movzbl (%edi),%edx
+  8007fa:	8d 42 dd             	lea    -0x23(%edx),%eax
+  8007fd:	3c 55                	cmp    $0x55,%al
+  8007ff:	0f 87 cf 03 00 00    	ja     800bd4 <vprintfmt+0x437>
+  800805:	0f b6 c0             	movzbl %al,%eax
+  800808:	ff 24 85 40 40 80 00 	jmp    *0x804040(,%eax,4)
+  80080f:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  800812:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  800816:	eb d9                	jmp    8007f1 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  800818:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80081b:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  80081f:	eb d0                	jmp    8007f1 <vprintfmt+0x54>
+  800821:	0f b6 d2             	movzbl %dl,%edx
+  800824:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  800827:	b8 00 00 00 00       	mov    $0x0,%eax
+  80082c:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  80082f:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  800832:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  800836:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  800839:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  80083c:	83 f9 09             	cmp    $0x9,%ecx
+  80083f:	77 55                	ja     800896 <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  800841:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  800844:	eb e9                	jmp    80082f <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  800846:	8b 45 14             	mov    0x14(%ebp),%eax
+  800849:	8b 00                	mov    (%eax),%eax
+  80084b:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80084e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800851:	8d 40 04             	lea    0x4(%eax),%eax
+  800854:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800857:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  80085a:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  80085e:	79 91                	jns    8007f1 <vprintfmt+0x54>
+				width = precision, precision = -1;
+  800860:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800863:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800866:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  80086d:	eb 82                	jmp    8007f1 <vprintfmt+0x54>
+			if (width < 0)
+  80086f:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800872:	85 d2                	test   %edx,%edx
+  800874:	b8 00 00 00 00       	mov    $0x0,%eax
+  800879:	0f 49 c2             	cmovns %edx,%eax
+  80087c:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  80087f:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800882:	e9 6a ff ff ff       	jmp    8007f1 <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  800887:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  80088a:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  800891:	e9 5b ff ff ff       	jmp    8007f1 <vprintfmt+0x54>
+  800896:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800899:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80089c:	eb bc                	jmp    80085a <vprintfmt+0xbd>
+			lflag++;
+  80089e:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  8008a1:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8008a4:	e9 48 ff ff ff       	jmp    8007f1 <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  8008a9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008ac:	8d 78 04             	lea    0x4(%eax),%edi
+  8008af:	83 ec 08             	sub    $0x8,%esp
+  8008b2:	53                   	push   %ebx
+  8008b3:	ff 30                	push   (%eax)
+  8008b5:	ff d6                	call   *%esi
+			break;
+  8008b7:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  8008ba:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  8008bd:	e9 b1 02 00 00       	jmp    800b73 <vprintfmt+0x3d6>
+			err = va_arg(ap, int);
+  8008c2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008c5:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  8008c8:	8b 10                	mov    (%eax),%edx
+  8008ca:	89 d0                	mov    %edx,%eax
+  8008cc:	f7 d8                	neg    %eax
+  8008ce:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  8008d1:	83 f8 11             	cmp    $0x11,%eax
+  8008d4:	7f 23                	jg     8008f9 <vprintfmt+0x15c>
+  8008d6:	8b 14 85 a0 41 80 00 	mov    0x8041a0(,%eax,4),%edx
+  8008dd:	85 d2                	test   %edx,%edx
+  8008df:	74 18                	je     8008f9 <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  8008e1:	52                   	push   %edx
+  8008e2:	68 f2 42 80 00       	push   $0x8042f2
+  8008e7:	53                   	push   %ebx
+  8008e8:	56                   	push   %esi
+  8008e9:	e8 92 fe ff ff       	call   800780 <printfmt>
+  8008ee:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8008f1:	89 7d 14             	mov    %edi,0x14(%ebp)
+  8008f4:	e9 7a 02 00 00       	jmp    800b73 <vprintfmt+0x3d6>
+				printfmt(putch, putdat, "error %d", err);
+  8008f9:	50                   	push   %eax
+  8008fa:	68 f7 3e 80 00       	push   $0x803ef7
+  8008ff:	53                   	push   %ebx
+  800900:	56                   	push   %esi
+  800901:	e8 7a fe ff ff       	call   800780 <printfmt>
+  800906:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800909:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  80090c:	e9 62 02 00 00       	jmp    800b73 <vprintfmt+0x3d6>
+			if ((p = va_arg(ap, char *)) == NULL)
+  800911:	8b 45 14             	mov    0x14(%ebp),%eax
+  800914:	83 c0 04             	add    $0x4,%eax
+  800917:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  80091a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80091d:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  80091f:	85 c9                	test   %ecx,%ecx
+  800921:	b8 f0 3e 80 00       	mov    $0x803ef0,%eax
+  800926:	0f 45 c1             	cmovne %ecx,%eax
+  800929:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  80092c:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800930:	7e 06                	jle    800938 <vprintfmt+0x19b>
+  800932:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  800936:	75 0b                	jne    800943 <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800938:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  80093b:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  80093e:	89 75 08             	mov    %esi,0x8(%ebp)
+  800941:	eb 5c                	jmp    80099f <vprintfmt+0x202>
+  800943:	83 ec 08             	sub    $0x8,%esp
+  800946:	ff 75 d0             	push   -0x30(%ebp)
+  800949:	ff 75 cc             	push   -0x34(%ebp)
+  80094c:	e8 20 03 00 00       	call   800c71 <strnlen>
+  800951:	89 c2                	mov    %eax,%edx
+  800953:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800956:	29 d0                	sub    %edx,%eax
+  800958:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  80095b:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  80095f:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800962:	89 75 08             	mov    %esi,0x8(%ebp)
+  800965:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800967:	eb 0e                	jmp    800977 <vprintfmt+0x1da>
+					putch(padc, putdat);
+  800969:	83 ec 08             	sub    $0x8,%esp
+  80096c:	53                   	push   %ebx
+  80096d:	57                   	push   %edi
+  80096e:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800971:	83 ee 01             	sub    $0x1,%esi
+  800974:	83 c4 10             	add    $0x10,%esp
+  800977:	85 f6                	test   %esi,%esi
+  800979:	7f ee                	jg     800969 <vprintfmt+0x1cc>
+  80097b:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80097e:	8b 75 08             	mov    0x8(%ebp),%esi
+  800981:	85 c0                	test   %eax,%eax
+  800983:	ba 00 00 00 00       	mov    $0x0,%edx
+  800988:	0f 49 d0             	cmovns %eax,%edx
+  80098b:	29 d0                	sub    %edx,%eax
+  80098d:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800990:	eb a6                	jmp    800938 <vprintfmt+0x19b>
+					putch(ch, putdat);
+  800992:	83 ec 08             	sub    $0x8,%esp
+  800995:	53                   	push   %ebx
+  800996:	52                   	push   %edx
+  800997:	ff 55 08             	call   *0x8(%ebp)
+  80099a:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  80099d:	89 f1                	mov    %esi,%ecx
+  80099f:	8d 71 01             	lea    0x1(%ecx),%esi
+  8009a2:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  8009a6:	0f be d0             	movsbl %al,%edx
+  8009a9:	85 d2                	test   %edx,%edx
+  8009ab:	74 28                	je     8009d5 <vprintfmt+0x238>
+  8009ad:	85 ff                	test   %edi,%edi
+  8009af:	78 05                	js     8009b6 <vprintfmt+0x219>
+  8009b1:	83 ef 01             	sub    $0x1,%edi
+  8009b4:	78 30                	js     8009e6 <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  8009b6:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  8009ba:	74 d6                	je     800992 <vprintfmt+0x1f5>
+  8009bc:	0f be c0             	movsbl %al,%eax
+  8009bf:	83 e8 20             	sub    $0x20,%eax
+  8009c2:	83 f8 5e             	cmp    $0x5e,%eax
+  8009c5:	76 cb                	jbe    800992 <vprintfmt+0x1f5>
+					putch('?', putdat);
+  8009c7:	83 ec 08             	sub    $0x8,%esp
+  8009ca:	53                   	push   %ebx
+  8009cb:	6a 3f                	push   $0x3f
+  8009cd:	ff 55 08             	call   *0x8(%ebp)
+  8009d0:	83 c4 10             	add    $0x10,%esp
+  8009d3:	eb c8                	jmp    80099d <vprintfmt+0x200>
+  8009d5:	8b 75 08             	mov    0x8(%ebp),%esi
+  8009d8:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8009db:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8009de:	01 d0                	add    %edx,%eax
+  8009e0:	29 c8                	sub    %ecx,%eax
+  8009e2:	89 c7                	mov    %eax,%edi
+  8009e4:	eb 13                	jmp    8009f9 <vprintfmt+0x25c>
+  8009e6:	8b 75 08             	mov    0x8(%ebp),%esi
+  8009e9:	eb ed                	jmp    8009d8 <vprintfmt+0x23b>
+				putch(' ', putdat);
+  8009eb:	83 ec 08             	sub    $0x8,%esp
+  8009ee:	53                   	push   %ebx
+  8009ef:	6a 20                	push   $0x20
+  8009f1:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  8009f3:	83 ef 01             	sub    $0x1,%edi
+  8009f6:	83 c4 10             	add    $0x10,%esp
+  8009f9:	85 ff                	test   %edi,%edi
+  8009fb:	7f ee                	jg     8009eb <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8009fd:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  800a00:	89 45 14             	mov    %eax,0x14(%ebp)
+  800a03:	e9 6b 01 00 00       	jmp    800b73 <vprintfmt+0x3d6>
+	if (lflag >= 2)
+  800a08:	83 f9 01             	cmp    $0x1,%ecx
+  800a0b:	7f 1f                	jg     800a2c <vprintfmt+0x28f>
+	else if (lflag)
+  800a0d:	85 c9                	test   %ecx,%ecx
+  800a0f:	74 67                	je     800a78 <vprintfmt+0x2db>
+		return va_arg(*ap, long);
+  800a11:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a14:	8b 00                	mov    (%eax),%eax
+  800a16:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800a19:	89 c1                	mov    %eax,%ecx
+  800a1b:	c1 f9 1f             	sar    $0x1f,%ecx
+  800a1e:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800a21:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a24:	8d 40 04             	lea    0x4(%eax),%eax
+  800a27:	89 45 14             	mov    %eax,0x14(%ebp)
+  800a2a:	eb 17                	jmp    800a43 <vprintfmt+0x2a6>
+		return va_arg(*ap, long long);
+  800a2c:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a2f:	8b 50 04             	mov    0x4(%eax),%edx
+  800a32:	8b 00                	mov    (%eax),%eax
+  800a34:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800a37:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800a3a:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a3d:	8d 40 08             	lea    0x8(%eax),%eax
+  800a40:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  800a43:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800a46:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  800a49:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  800a4e:	85 c9                	test   %ecx,%ecx
+  800a50:	0f 89 03 01 00 00    	jns    800b59 <vprintfmt+0x3bc>
+				putch('-', putdat);
+  800a56:	83 ec 08             	sub    $0x8,%esp
+  800a59:	53                   	push   %ebx
+  800a5a:	6a 2d                	push   $0x2d
+  800a5c:	ff d6                	call   *%esi
+				num = -(long long) num;
+  800a5e:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800a61:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800a64:	f7 da                	neg    %edx
+  800a66:	83 d1 00             	adc    $0x0,%ecx
+  800a69:	f7 d9                	neg    %ecx
+  800a6b:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  800a6e:	bf 0a 00 00 00       	mov    $0xa,%edi
+  800a73:	e9 e1 00 00 00       	jmp    800b59 <vprintfmt+0x3bc>
+		return va_arg(*ap, int);
+  800a78:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a7b:	8b 00                	mov    (%eax),%eax
+  800a7d:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800a80:	89 c1                	mov    %eax,%ecx
+  800a82:	c1 f9 1f             	sar    $0x1f,%ecx
+  800a85:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800a88:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a8b:	8d 40 04             	lea    0x4(%eax),%eax
+  800a8e:	89 45 14             	mov    %eax,0x14(%ebp)
+  800a91:	eb b0                	jmp    800a43 <vprintfmt+0x2a6>
+	if (lflag >= 2)
+  800a93:	83 f9 01             	cmp    $0x1,%ecx
+  800a96:	7f 1e                	jg     800ab6 <vprintfmt+0x319>
+	else if (lflag)
+  800a98:	85 c9                	test   %ecx,%ecx
+  800a9a:	74 32                	je     800ace <vprintfmt+0x331>
+		return va_arg(*ap, unsigned long);
+  800a9c:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a9f:	8b 10                	mov    (%eax),%edx
+  800aa1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800aa6:	8d 40 04             	lea    0x4(%eax),%eax
+  800aa9:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800aac:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  800ab1:	e9 a3 00 00 00       	jmp    800b59 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  800ab6:	8b 45 14             	mov    0x14(%ebp),%eax
+  800ab9:	8b 10                	mov    (%eax),%edx
+  800abb:	8b 48 04             	mov    0x4(%eax),%ecx
+  800abe:	8d 40 08             	lea    0x8(%eax),%eax
+  800ac1:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800ac4:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  800ac9:	e9 8b 00 00 00       	jmp    800b59 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  800ace:	8b 45 14             	mov    0x14(%ebp),%eax
+  800ad1:	8b 10                	mov    (%eax),%edx
+  800ad3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800ad8:	8d 40 04             	lea    0x4(%eax),%eax
+  800adb:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800ade:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  800ae3:	eb 74                	jmp    800b59 <vprintfmt+0x3bc>
+	if (lflag >= 2)
+  800ae5:	83 f9 01             	cmp    $0x1,%ecx
+  800ae8:	7f 1b                	jg     800b05 <vprintfmt+0x368>
+	else if (lflag)
+  800aea:	85 c9                	test   %ecx,%ecx
+  800aec:	74 2c                	je     800b1a <vprintfmt+0x37d>
+		return va_arg(*ap, unsigned long);
+  800aee:	8b 45 14             	mov    0x14(%ebp),%eax
+  800af1:	8b 10                	mov    (%eax),%edx
+  800af3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800af8:	8d 40 04             	lea    0x4(%eax),%eax
+  800afb:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800afe:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long);
+  800b03:	eb 54                	jmp    800b59 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  800b05:	8b 45 14             	mov    0x14(%ebp),%eax
+  800b08:	8b 10                	mov    (%eax),%edx
+  800b0a:	8b 48 04             	mov    0x4(%eax),%ecx
+  800b0d:	8d 40 08             	lea    0x8(%eax),%eax
+  800b10:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800b13:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long long);
+  800b18:	eb 3f                	jmp    800b59 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  800b1a:	8b 45 14             	mov    0x14(%ebp),%eax
+  800b1d:	8b 10                	mov    (%eax),%edx
+  800b1f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b24:	8d 40 04             	lea    0x4(%eax),%eax
+  800b27:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800b2a:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned int);
+  800b2f:	eb 28                	jmp    800b59 <vprintfmt+0x3bc>
+			putch('0', putdat);
+  800b31:	83 ec 08             	sub    $0x8,%esp
+  800b34:	53                   	push   %ebx
+  800b35:	6a 30                	push   $0x30
+  800b37:	ff d6                	call   *%esi
+			putch('x', putdat);
+  800b39:	83 c4 08             	add    $0x8,%esp
+  800b3c:	53                   	push   %ebx
+  800b3d:	6a 78                	push   $0x78
+  800b3f:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  800b41:	8b 45 14             	mov    0x14(%ebp),%eax
+  800b44:	8b 10                	mov    (%eax),%edx
+  800b46:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  800b4b:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  800b4e:	8d 40 04             	lea    0x4(%eax),%eax
+  800b51:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800b54:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  800b59:	83 ec 0c             	sub    $0xc,%esp
+  800b5c:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  800b60:	50                   	push   %eax
+  800b61:	ff 75 e0             	push   -0x20(%ebp)
+  800b64:	57                   	push   %edi
+  800b65:	51                   	push   %ecx
+  800b66:	52                   	push   %edx
+  800b67:	89 da                	mov    %ebx,%edx
+  800b69:	89 f0                	mov    %esi,%eax
+  800b6b:	e8 4a fb ff ff       	call   8006ba <printnum>
+			break;
+  800b70:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  800b73:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800b76:	e9 40 fc ff ff       	jmp    8007bb <vprintfmt+0x1e>
+	if (lflag >= 2)
+  800b7b:	83 f9 01             	cmp    $0x1,%ecx
+  800b7e:	7f 1b                	jg     800b9b <vprintfmt+0x3fe>
+	else if (lflag)
+  800b80:	85 c9                	test   %ecx,%ecx
+  800b82:	74 2c                	je     800bb0 <vprintfmt+0x413>
+		return va_arg(*ap, unsigned long);
+  800b84:	8b 45 14             	mov    0x14(%ebp),%eax
+  800b87:	8b 10                	mov    (%eax),%edx
+  800b89:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b8e:	8d 40 04             	lea    0x4(%eax),%eax
+  800b91:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800b94:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  800b99:	eb be                	jmp    800b59 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  800b9b:	8b 45 14             	mov    0x14(%ebp),%eax
+  800b9e:	8b 10                	mov    (%eax),%edx
+  800ba0:	8b 48 04             	mov    0x4(%eax),%ecx
+  800ba3:	8d 40 08             	lea    0x8(%eax),%eax
+  800ba6:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800ba9:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  800bae:	eb a9                	jmp    800b59 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  800bb0:	8b 45 14             	mov    0x14(%ebp),%eax
+  800bb3:	8b 10                	mov    (%eax),%edx
+  800bb5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800bba:	8d 40 04             	lea    0x4(%eax),%eax
+  800bbd:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800bc0:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  800bc5:	eb 92                	jmp    800b59 <vprintfmt+0x3bc>
+			putch(ch, putdat);
+  800bc7:	83 ec 08             	sub    $0x8,%esp
+  800bca:	53                   	push   %ebx
+  800bcb:	6a 25                	push   $0x25
+  800bcd:	ff d6                	call   *%esi
+			break;
+  800bcf:	83 c4 10             	add    $0x10,%esp
+  800bd2:	eb 9f                	jmp    800b73 <vprintfmt+0x3d6>
+			putch('%', putdat);
+  800bd4:	83 ec 08             	sub    $0x8,%esp
+  800bd7:	53                   	push   %ebx
+  800bd8:	6a 25                	push   $0x25
+  800bda:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800bdc:	83 c4 10             	add    $0x10,%esp
+  800bdf:	89 f8                	mov    %edi,%eax
+  800be1:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800be5:	74 05                	je     800bec <vprintfmt+0x44f>
+  800be7:	83 e8 01             	sub    $0x1,%eax
+  800bea:	eb f5                	jmp    800be1 <vprintfmt+0x444>
+  800bec:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800bef:	eb 82                	jmp    800b73 <vprintfmt+0x3d6>
+
+00800bf1 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800bf1:	55                   	push   %ebp
+  800bf2:	89 e5                	mov    %esp,%ebp
+  800bf4:	83 ec 18             	sub    $0x18,%esp
+  800bf7:	8b 45 08             	mov    0x8(%ebp),%eax
+  800bfa:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800bfd:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800c00:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800c04:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800c07:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  800c0e:	85 c0                	test   %eax,%eax
+  800c10:	74 26                	je     800c38 <vsnprintf+0x47>
+  800c12:	85 d2                	test   %edx,%edx
+  800c14:	7e 22                	jle    800c38 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800c16:	ff 75 14             	push   0x14(%ebp)
+  800c19:	ff 75 10             	push   0x10(%ebp)
+  800c1c:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800c1f:	50                   	push   %eax
+  800c20:	68 63 07 80 00       	push   $0x800763
+  800c25:	e8 73 fb ff ff       	call   80079d <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  800c2a:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800c2d:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  800c30:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800c33:	83 c4 10             	add    $0x10,%esp
+}
+  800c36:	c9                   	leave
+  800c37:	c3                   	ret
+		return -E_INVAL;
+  800c38:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800c3d:	eb f7                	jmp    800c36 <vsnprintf+0x45>
+
+00800c3f <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800c3f:	55                   	push   %ebp
+  800c40:	89 e5                	mov    %esp,%ebp
+  800c42:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  800c45:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  800c48:	50                   	push   %eax
+  800c49:	ff 75 10             	push   0x10(%ebp)
+  800c4c:	ff 75 0c             	push   0xc(%ebp)
+  800c4f:	ff 75 08             	push   0x8(%ebp)
+  800c52:	e8 9a ff ff ff       	call   800bf1 <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  800c57:	c9                   	leave
+  800c58:	c3                   	ret
+
+00800c59 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800c59:	55                   	push   %ebp
+  800c5a:	89 e5                	mov    %esp,%ebp
+  800c5c:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800c5f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c64:	eb 03                	jmp    800c69 <strlen+0x10>
+		n++;
+  800c66:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  800c69:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800c6d:	75 f7                	jne    800c66 <strlen+0xd>
+	return n;
+}
+  800c6f:	5d                   	pop    %ebp
+  800c70:	c3                   	ret
+
+00800c71 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800c71:	55                   	push   %ebp
+  800c72:	89 e5                	mov    %esp,%ebp
+  800c74:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800c77:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800c7a:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c7f:	eb 03                	jmp    800c84 <strnlen+0x13>
+		n++;
+  800c81:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800c84:	39 d0                	cmp    %edx,%eax
+  800c86:	74 08                	je     800c90 <strnlen+0x1f>
+  800c88:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800c8c:	75 f3                	jne    800c81 <strnlen+0x10>
+  800c8e:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  800c90:	89 d0                	mov    %edx,%eax
+  800c92:	5d                   	pop    %ebp
+  800c93:	c3                   	ret
+
+00800c94 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800c94:	55                   	push   %ebp
+  800c95:	89 e5                	mov    %esp,%ebp
+  800c97:	53                   	push   %ebx
+  800c98:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800c9b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800c9e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ca3:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800ca7:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800caa:	83 c0 01             	add    $0x1,%eax
+  800cad:	84 d2                	test   %dl,%dl
+  800caf:	75 f2                	jne    800ca3 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  800cb1:	89 c8                	mov    %ecx,%eax
+  800cb3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800cb6:	c9                   	leave
+  800cb7:	c3                   	ret
+
+00800cb8 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800cb8:	55                   	push   %ebp
+  800cb9:	89 e5                	mov    %esp,%ebp
+  800cbb:	53                   	push   %ebx
+  800cbc:	83 ec 10             	sub    $0x10,%esp
+  800cbf:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  800cc2:	53                   	push   %ebx
+  800cc3:	e8 91 ff ff ff       	call   800c59 <strlen>
+  800cc8:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800ccb:	ff 75 0c             	push   0xc(%ebp)
+  800cce:	01 d8                	add    %ebx,%eax
+  800cd0:	50                   	push   %eax
+  800cd1:	e8 be ff ff ff       	call   800c94 <strcpy>
+	return dst;
+}
+  800cd6:	89 d8                	mov    %ebx,%eax
+  800cd8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800cdb:	c9                   	leave
+  800cdc:	c3                   	ret
+
+00800cdd <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800cdd:	55                   	push   %ebp
+  800cde:	89 e5                	mov    %esp,%ebp
+  800ce0:	56                   	push   %esi
+  800ce1:	53                   	push   %ebx
+  800ce2:	8b 75 08             	mov    0x8(%ebp),%esi
+  800ce5:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800ce8:	89 f3                	mov    %esi,%ebx
+  800cea:	03 5d 10             	add    0x10(%ebp),%ebx
+  800ced:	89 f0                	mov    %esi,%eax
+  800cef:	eb 0f                	jmp    800d00 <strncpy+0x23>
+		*dst++ = *src;
+  800cf1:	83 c0 01             	add    $0x1,%eax
+  800cf4:	0f b6 0a             	movzbl (%edx),%ecx
+  800cf7:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800cfa:	80 f9 01             	cmp    $0x1,%cl
+  800cfd:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  800d00:	39 d8                	cmp    %ebx,%eax
+  800d02:	75 ed                	jne    800cf1 <strncpy+0x14>
+	}
+	return ret;
+}
+  800d04:	89 f0                	mov    %esi,%eax
+  800d06:	5b                   	pop    %ebx
+  800d07:	5e                   	pop    %esi
+  800d08:	5d                   	pop    %ebp
+  800d09:	c3                   	ret
+
+00800d0a <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800d0a:	55                   	push   %ebp
+  800d0b:	89 e5                	mov    %esp,%ebp
+  800d0d:	56                   	push   %esi
+  800d0e:	53                   	push   %ebx
+  800d0f:	8b 75 08             	mov    0x8(%ebp),%esi
+  800d12:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d15:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800d18:	89 f0                	mov    %esi,%eax
+  800d1a:	85 d2                	test   %edx,%edx
+  800d1c:	74 21                	je     800d3f <strlcpy+0x35>
+  800d1e:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800d22:	89 f2                	mov    %esi,%edx
+  800d24:	eb 09                	jmp    800d2f <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  800d26:	83 c1 01             	add    $0x1,%ecx
+  800d29:	83 c2 01             	add    $0x1,%edx
+  800d2c:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  800d2f:	39 c2                	cmp    %eax,%edx
+  800d31:	74 09                	je     800d3c <strlcpy+0x32>
+  800d33:	0f b6 19             	movzbl (%ecx),%ebx
+  800d36:	84 db                	test   %bl,%bl
+  800d38:	75 ec                	jne    800d26 <strlcpy+0x1c>
+  800d3a:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  800d3c:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  800d3f:	29 f0                	sub    %esi,%eax
+}
+  800d41:	5b                   	pop    %ebx
+  800d42:	5e                   	pop    %esi
+  800d43:	5d                   	pop    %ebp
+  800d44:	c3                   	ret
+
+00800d45 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800d45:	55                   	push   %ebp
+  800d46:	89 e5                	mov    %esp,%ebp
+  800d48:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800d4b:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  800d4e:	eb 06                	jmp    800d56 <strcmp+0x11>
+		p++, q++;
+  800d50:	83 c1 01             	add    $0x1,%ecx
+  800d53:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800d56:	0f b6 01             	movzbl (%ecx),%eax
+  800d59:	84 c0                	test   %al,%al
+  800d5b:	74 04                	je     800d61 <strcmp+0x1c>
+  800d5d:	3a 02                	cmp    (%edx),%al
+  800d5f:	74 ef                	je     800d50 <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800d61:	0f b6 c0             	movzbl %al,%eax
+  800d64:	0f b6 12             	movzbl (%edx),%edx
+  800d67:	29 d0                	sub    %edx,%eax
+}
+  800d69:	5d                   	pop    %ebp
+  800d6a:	c3                   	ret
+
+00800d6b <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800d6b:	55                   	push   %ebp
+  800d6c:	89 e5                	mov    %esp,%ebp
+  800d6e:	53                   	push   %ebx
+  800d6f:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d72:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d75:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  800d78:	eb 09                	jmp    800d83 <strncmp+0x18>
+		n--, p++, q++;
+  800d7a:	83 ea 01             	sub    $0x1,%edx
+  800d7d:	83 c0 01             	add    $0x1,%eax
+  800d80:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  800d83:	85 d2                	test   %edx,%edx
+  800d85:	74 18                	je     800d9f <strncmp+0x34>
+  800d87:	0f b6 18             	movzbl (%eax),%ebx
+  800d8a:	84 db                	test   %bl,%bl
+  800d8c:	74 04                	je     800d92 <strncmp+0x27>
+  800d8e:	3a 19                	cmp    (%ecx),%bl
+  800d90:	74 e8                	je     800d7a <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800d92:	0f b6 00             	movzbl (%eax),%eax
+  800d95:	0f b6 11             	movzbl (%ecx),%edx
+  800d98:	29 d0                	sub    %edx,%eax
+}
+  800d9a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800d9d:	c9                   	leave
+  800d9e:	c3                   	ret
+		return 0;
+  800d9f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800da4:	eb f4                	jmp    800d9a <strncmp+0x2f>
+
+00800da6 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800da6:	55                   	push   %ebp
+  800da7:	89 e5                	mov    %esp,%ebp
+  800da9:	8b 45 08             	mov    0x8(%ebp),%eax
+  800dac:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800db0:	eb 03                	jmp    800db5 <strchr+0xf>
+  800db2:	83 c0 01             	add    $0x1,%eax
+  800db5:	0f b6 10             	movzbl (%eax),%edx
+  800db8:	84 d2                	test   %dl,%dl
+  800dba:	74 06                	je     800dc2 <strchr+0x1c>
+		if (*s == c)
+  800dbc:	38 ca                	cmp    %cl,%dl
+  800dbe:	75 f2                	jne    800db2 <strchr+0xc>
+  800dc0:	eb 05                	jmp    800dc7 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  800dc2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800dc7:	5d                   	pop    %ebp
+  800dc8:	c3                   	ret
+
+00800dc9 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800dc9:	55                   	push   %ebp
+  800dca:	89 e5                	mov    %esp,%ebp
+  800dcc:	8b 45 08             	mov    0x8(%ebp),%eax
+  800dcf:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800dd3:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800dd6:	38 ca                	cmp    %cl,%dl
+  800dd8:	74 09                	je     800de3 <strfind+0x1a>
+  800dda:	84 d2                	test   %dl,%dl
+  800ddc:	74 05                	je     800de3 <strfind+0x1a>
+	for (; *s; s++)
+  800dde:	83 c0 01             	add    $0x1,%eax
+  800de1:	eb f0                	jmp    800dd3 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  800de3:	5d                   	pop    %ebp
+  800de4:	c3                   	ret
+
+00800de5 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800de5:	55                   	push   %ebp
+  800de6:	89 e5                	mov    %esp,%ebp
+  800de8:	57                   	push   %edi
+  800de9:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800dec:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800def:	85 c9                	test   %ecx,%ecx
+  800df1:	74 20                	je     800e13 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800df3:	89 f8                	mov    %edi,%eax
+  800df5:	09 c8                	or     %ecx,%eax
+  800df7:	a8 03                	test   $0x3,%al
+  800df9:	75 12                	jne    800e0d <memset+0x28>
+		c &= 0xFF;
+  800dfb:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800dff:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800e05:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800e08:	fc                   	cld
+  800e09:	f3 ab                	rep stos %eax,%es:(%edi)
+  800e0b:	eb 06                	jmp    800e13 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800e0d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800e10:	fc                   	cld
+  800e11:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800e13:	89 f8                	mov    %edi,%eax
+  800e15:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800e18:	c9                   	leave
+  800e19:	c3                   	ret
+
+00800e1a <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800e1a:	55                   	push   %ebp
+  800e1b:	89 e5                	mov    %esp,%ebp
+  800e1d:	57                   	push   %edi
+  800e1e:	56                   	push   %esi
+  800e1f:	8b 45 08             	mov    0x8(%ebp),%eax
+  800e22:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800e25:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800e28:	39 c6                	cmp    %eax,%esi
+  800e2a:	73 32                	jae    800e5e <memmove+0x44>
+  800e2c:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800e2f:	39 d0                	cmp    %edx,%eax
+  800e31:	73 2b                	jae    800e5e <memmove+0x44>
+		s += n;
+		d += n;
+  800e33:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800e36:	89 d6                	mov    %edx,%esi
+  800e38:	09 fe                	or     %edi,%esi
+  800e3a:	09 ce                	or     %ecx,%esi
+  800e3c:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800e42:	75 0e                	jne    800e52 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800e44:	83 ef 04             	sub    $0x4,%edi
+  800e47:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800e4a:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800e4d:	fd                   	std
+  800e4e:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800e50:	eb 09                	jmp    800e5b <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800e52:	83 ef 01             	sub    $0x1,%edi
+  800e55:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800e58:	fd                   	std
+  800e59:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800e5b:	fc                   	cld
+  800e5c:	eb 1a                	jmp    800e78 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800e5e:	89 f2                	mov    %esi,%edx
+  800e60:	09 c2                	or     %eax,%edx
+  800e62:	09 ca                	or     %ecx,%edx
+  800e64:	f6 c2 03             	test   $0x3,%dl
+  800e67:	75 0a                	jne    800e73 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800e69:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800e6c:	89 c7                	mov    %eax,%edi
+  800e6e:	fc                   	cld
+  800e6f:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800e71:	eb 05                	jmp    800e78 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800e73:	89 c7                	mov    %eax,%edi
+  800e75:	fc                   	cld
+  800e76:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800e78:	5e                   	pop    %esi
+  800e79:	5f                   	pop    %edi
+  800e7a:	5d                   	pop    %ebp
+  800e7b:	c3                   	ret
+
+00800e7c <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800e7c:	55                   	push   %ebp
+  800e7d:	89 e5                	mov    %esp,%ebp
+  800e7f:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800e82:	ff 75 10             	push   0x10(%ebp)
+  800e85:	ff 75 0c             	push   0xc(%ebp)
+  800e88:	ff 75 08             	push   0x8(%ebp)
+  800e8b:	e8 8a ff ff ff       	call   800e1a <memmove>
+}
+  800e90:	c9                   	leave
+  800e91:	c3                   	ret
+
+00800e92 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800e92:	55                   	push   %ebp
+  800e93:	89 e5                	mov    %esp,%ebp
+  800e95:	56                   	push   %esi
+  800e96:	53                   	push   %ebx
+  800e97:	8b 45 08             	mov    0x8(%ebp),%eax
+  800e9a:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800e9d:	89 c6                	mov    %eax,%esi
+  800e9f:	03 75 10             	add    0x10(%ebp),%esi
+  800ea2:	eb 06                	jmp    800eaa <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800ea4:	83 c0 01             	add    $0x1,%eax
+  800ea7:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800eaa:	39 f0                	cmp    %esi,%eax
+  800eac:	74 14                	je     800ec2 <memcmp+0x30>
+		if (*s1 != *s2)
+  800eae:	0f b6 08             	movzbl (%eax),%ecx
+  800eb1:	0f b6 1a             	movzbl (%edx),%ebx
+  800eb4:	38 d9                	cmp    %bl,%cl
+  800eb6:	74 ec                	je     800ea4 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800eb8:	0f b6 c1             	movzbl %cl,%eax
+  800ebb:	0f b6 db             	movzbl %bl,%ebx
+  800ebe:	29 d8                	sub    %ebx,%eax
+  800ec0:	eb 05                	jmp    800ec7 <memcmp+0x35>
+	}
+
+	return 0;
+  800ec2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800ec7:	5b                   	pop    %ebx
+  800ec8:	5e                   	pop    %esi
+  800ec9:	5d                   	pop    %ebp
+  800eca:	c3                   	ret
+
+00800ecb <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800ecb:	55                   	push   %ebp
+  800ecc:	89 e5                	mov    %esp,%ebp
+  800ece:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ed1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800ed4:	89 c2                	mov    %eax,%edx
+  800ed6:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800ed9:	eb 03                	jmp    800ede <memfind+0x13>
+  800edb:	83 c0 01             	add    $0x1,%eax
+  800ede:	39 d0                	cmp    %edx,%eax
+  800ee0:	73 04                	jae    800ee6 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800ee2:	38 08                	cmp    %cl,(%eax)
+  800ee4:	75 f5                	jne    800edb <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800ee6:	5d                   	pop    %ebp
+  800ee7:	c3                   	ret
+
+00800ee8 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800ee8:	55                   	push   %ebp
+  800ee9:	89 e5                	mov    %esp,%ebp
+  800eeb:	57                   	push   %edi
+  800eec:	56                   	push   %esi
+  800eed:	53                   	push   %ebx
+  800eee:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ef1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800ef4:	eb 03                	jmp    800ef9 <strtol+0x11>
+		s++;
+  800ef6:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800ef9:	0f b6 02             	movzbl (%edx),%eax
+  800efc:	3c 20                	cmp    $0x20,%al
+  800efe:	74 f6                	je     800ef6 <strtol+0xe>
+  800f00:	3c 09                	cmp    $0x9,%al
+  800f02:	74 f2                	je     800ef6 <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  800f04:	3c 2b                	cmp    $0x2b,%al
+  800f06:	74 2a                	je     800f32 <strtol+0x4a>
+	int neg = 0;
+  800f08:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800f0d:	3c 2d                	cmp    $0x2d,%al
+  800f0f:	74 2b                	je     800f3c <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800f11:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800f17:	75 0f                	jne    800f28 <strtol+0x40>
+  800f19:	80 3a 30             	cmpb   $0x30,(%edx)
+  800f1c:	74 28                	je     800f46 <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800f1e:	85 db                	test   %ebx,%ebx
+  800f20:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800f25:	0f 44 d8             	cmove  %eax,%ebx
+  800f28:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800f2d:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800f30:	eb 46                	jmp    800f78 <strtol+0x90>
+		s++;
+  800f32:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800f35:	bf 00 00 00 00       	mov    $0x0,%edi
+  800f3a:	eb d5                	jmp    800f11 <strtol+0x29>
+		s++, neg = 1;
+  800f3c:	83 c2 01             	add    $0x1,%edx
+  800f3f:	bf 01 00 00 00       	mov    $0x1,%edi
+  800f44:	eb cb                	jmp    800f11 <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800f46:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800f4a:	74 0e                	je     800f5a <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800f4c:	85 db                	test   %ebx,%ebx
+  800f4e:	75 d8                	jne    800f28 <strtol+0x40>
+		s++, base = 8;
+  800f50:	83 c2 01             	add    $0x1,%edx
+  800f53:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800f58:	eb ce                	jmp    800f28 <strtol+0x40>
+		s += 2, base = 16;
+  800f5a:	83 c2 02             	add    $0x2,%edx
+  800f5d:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800f62:	eb c4                	jmp    800f28 <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800f64:	0f be c0             	movsbl %al,%eax
+  800f67:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800f6a:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800f6d:	7d 3a                	jge    800fa9 <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800f6f:	83 c2 01             	add    $0x1,%edx
+  800f72:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800f76:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800f78:	0f b6 02             	movzbl (%edx),%eax
+  800f7b:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800f7e:	89 f3                	mov    %esi,%ebx
+  800f80:	80 fb 09             	cmp    $0x9,%bl
+  800f83:	76 df                	jbe    800f64 <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800f85:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800f88:	89 f3                	mov    %esi,%ebx
+  800f8a:	80 fb 19             	cmp    $0x19,%bl
+  800f8d:	77 08                	ja     800f97 <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800f8f:	0f be c0             	movsbl %al,%eax
+  800f92:	83 e8 57             	sub    $0x57,%eax
+  800f95:	eb d3                	jmp    800f6a <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800f97:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800f9a:	89 f3                	mov    %esi,%ebx
+  800f9c:	80 fb 19             	cmp    $0x19,%bl
+  800f9f:	77 08                	ja     800fa9 <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800fa1:	0f be c0             	movsbl %al,%eax
+  800fa4:	83 e8 37             	sub    $0x37,%eax
+  800fa7:	eb c1                	jmp    800f6a <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800fa9:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800fad:	74 05                	je     800fb4 <strtol+0xcc>
+		*endptr = (char *) s;
+  800faf:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800fb2:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800fb4:	89 c8                	mov    %ecx,%eax
+  800fb6:	f7 d8                	neg    %eax
+  800fb8:	85 ff                	test   %edi,%edi
+  800fba:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800fbd:	89 c8                	mov    %ecx,%eax
+  800fbf:	5b                   	pop    %ebx
+  800fc0:	5e                   	pop    %esi
+  800fc1:	5f                   	pop    %edi
+  800fc2:	5d                   	pop    %ebp
+  800fc3:	c3                   	ret
+
+00800fc4 <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800fc4:	55                   	push   %ebp
+  800fc5:	89 e5                	mov    %esp,%ebp
+  800fc7:	57                   	push   %edi
+  800fc8:	56                   	push   %esi
+  800fc9:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800fca:	b8 00 00 00 00       	mov    $0x0,%eax
+  800fcf:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fd2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fd5:	89 c3                	mov    %eax,%ebx
+  800fd7:	89 c7                	mov    %eax,%edi
+  800fd9:	55                   	push   %ebp
+  800fda:	89 e5                	mov    %esp,%ebp
+  800fdc:	8d 35 e4 0f 80 00    	lea    0x800fe4,%esi
+  800fe2:	0f 34                	sysenter
+  800fe4:	5d                   	pop    %ebp
+	syscall2(SYS_cputs, 0, (uint32_t)s, len, 0, 0);
+}
+  800fe5:	5b                   	pop    %ebx
+  800fe6:	5e                   	pop    %esi
+  800fe7:	5f                   	pop    %edi
+  800fe8:	5d                   	pop    %ebp
+  800fe9:	c3                   	ret
+
+00800fea <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800fea:	55                   	push   %ebp
+  800feb:	89 e5                	mov    %esp,%ebp
+  800fed:	57                   	push   %edi
+  800fee:	56                   	push   %esi
+  800fef:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800ff0:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ff5:	b8 01 00 00 00       	mov    $0x1,%eax
+  800ffa:	89 d1                	mov    %edx,%ecx
+  800ffc:	89 d3                	mov    %edx,%ebx
+  800ffe:	89 d7                	mov    %edx,%edi
+  801000:	55                   	push   %ebp
+  801001:	89 e5                	mov    %esp,%ebp
+  801003:	8d 35 0b 10 80 00    	lea    0x80100b,%esi
+  801009:	0f 34                	sysenter
+  80100b:	5d                   	pop    %ebp
+	return syscall2(SYS_cgetc, 0, 0, 0, 0, 0);
+}
+  80100c:	5b                   	pop    %ebx
+  80100d:	5e                   	pop    %esi
+  80100e:	5f                   	pop    %edi
+  80100f:	5d                   	pop    %ebp
+  801010:	c3                   	ret
+
+00801011 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  801011:	55                   	push   %ebp
+  801012:	89 e5                	mov    %esp,%ebp
+  801014:	57                   	push   %edi
+  801015:	56                   	push   %esi
+  801016:	53                   	push   %ebx
+  801017:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  80101a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80101f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801022:	b8 03 00 00 00       	mov    $0x3,%eax
+  801027:	89 cb                	mov    %ecx,%ebx
+  801029:	89 cf                	mov    %ecx,%edi
+  80102b:	55                   	push   %ebp
+  80102c:	89 e5                	mov    %esp,%ebp
+  80102e:	8d 35 36 10 80 00    	lea    0x801036,%esi
+  801034:	0f 34                	sysenter
+  801036:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801037:	85 c0                	test   %eax,%eax
+  801039:	7f 08                	jg     801043 <sys_env_destroy+0x32>
+	return syscall2(SYS_env_destroy, 1, envid, 0, 0, 0);
+}
+  80103b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80103e:	5b                   	pop    %ebx
+  80103f:	5e                   	pop    %esi
+  801040:	5f                   	pop    %edi
+  801041:	5d                   	pop    %ebp
+  801042:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801043:	83 ec 0c             	sub    $0xc,%esp
+  801046:	50                   	push   %eax
+  801047:	6a 03                	push   $0x3
+  801049:	68 07 42 80 00       	push   $0x804207
+  80104e:	6a 3d                	push   $0x3d
+  801050:	68 24 42 80 00       	push   $0x804224
+  801055:	e8 71 f5 ff ff       	call   8005cb <_panic>
+
+0080105a <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  80105a:	55                   	push   %ebp
+  80105b:	89 e5                	mov    %esp,%ebp
+  80105d:	57                   	push   %edi
+  80105e:	56                   	push   %esi
+  80105f:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  801060:	ba 00 00 00 00       	mov    $0x0,%edx
+  801065:	b8 02 00 00 00       	mov    $0x2,%eax
+  80106a:	89 d1                	mov    %edx,%ecx
+  80106c:	89 d3                	mov    %edx,%ebx
+  80106e:	89 d7                	mov    %edx,%edi
+  801070:	55                   	push   %ebp
+  801071:	89 e5                	mov    %esp,%ebp
+  801073:	8d 35 7b 10 80 00    	lea    0x80107b,%esi
+  801079:	0f 34                	sysenter
+  80107b:	5d                   	pop    %ebp
+	 return syscall2(SYS_getenvid, 0, 0, 0, 0, 0);
+}
+  80107c:	5b                   	pop    %ebx
+  80107d:	5e                   	pop    %esi
+  80107e:	5f                   	pop    %edi
+  80107f:	5d                   	pop    %ebp
+  801080:	c3                   	ret
+
+00801081 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  801081:	55                   	push   %ebp
+  801082:	89 e5                	mov    %esp,%ebp
+  801084:	57                   	push   %edi
+  801085:	56                   	push   %esi
+  801086:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801087:	ba 00 00 00 00       	mov    $0x0,%edx
+  80108c:	b8 0b 00 00 00       	mov    $0xb,%eax
+  801091:	89 d1                	mov    %edx,%ecx
+  801093:	89 d3                	mov    %edx,%ebx
+  801095:	89 d7                	mov    %edx,%edi
+  801097:	89 d6                	mov    %edx,%esi
+  801099:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  80109b:	5b                   	pop    %ebx
+  80109c:	5e                   	pop    %esi
+  80109d:	5f                   	pop    %edi
+  80109e:	5d                   	pop    %ebp
+  80109f:	c3                   	ret
+
+008010a0 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  8010a0:	55                   	push   %ebp
+  8010a1:	89 e5                	mov    %esp,%ebp
+  8010a3:	57                   	push   %edi
+  8010a4:	56                   	push   %esi
+  8010a5:	53                   	push   %ebx
+  8010a6:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  8010a9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010ac:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010af:	b8 04 00 00 00       	mov    $0x4,%eax
+  8010b4:	bf 00 00 00 00       	mov    $0x0,%edi
+  8010b9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8010bc:	55                   	push   %ebp
+  8010bd:	89 e5                	mov    %esp,%ebp
+  8010bf:	8d 35 c7 10 80 00    	lea    0x8010c7,%esi
+  8010c5:	0f 34                	sysenter
+  8010c7:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8010c8:	85 c0                	test   %eax,%eax
+  8010ca:	7f 08                	jg     8010d4 <sys_page_alloc+0x34>
+	return syscall2(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0);
+}
+  8010cc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010cf:	5b                   	pop    %ebx
+  8010d0:	5e                   	pop    %esi
+  8010d1:	5f                   	pop    %edi
+  8010d2:	5d                   	pop    %ebp
+  8010d3:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8010d4:	83 ec 0c             	sub    $0xc,%esp
+  8010d7:	50                   	push   %eax
+  8010d8:	6a 04                	push   $0x4
+  8010da:	68 07 42 80 00       	push   $0x804207
+  8010df:	6a 3d                	push   $0x3d
+  8010e1:	68 24 42 80 00       	push   $0x804224
+  8010e6:	e8 e0 f4 ff ff       	call   8005cb <_panic>
+
+008010eb <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  8010eb:	55                   	push   %ebp
+  8010ec:	89 e5                	mov    %esp,%ebp
+  8010ee:	57                   	push   %edi
+  8010ef:	56                   	push   %esi
+  8010f0:	53                   	push   %ebx
+  8010f1:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8010f4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010f7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010fa:	b8 05 00 00 00       	mov    $0x5,%eax
+  8010ff:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801102:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801105:	8b 75 18             	mov    0x18(%ebp),%esi
+  801108:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80110a:	85 c0                	test   %eax,%eax
+  80110c:	7f 08                	jg     801116 <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  80110e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801111:	5b                   	pop    %ebx
+  801112:	5e                   	pop    %esi
+  801113:	5f                   	pop    %edi
+  801114:	5d                   	pop    %ebp
+  801115:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801116:	83 ec 0c             	sub    $0xc,%esp
+  801119:	50                   	push   %eax
+  80111a:	6a 05                	push   $0x5
+  80111c:	68 07 42 80 00       	push   $0x804207
+  801121:	6a 23                	push   $0x23
+  801123:	68 24 42 80 00       	push   $0x804224
+  801128:	e8 9e f4 ff ff       	call   8005cb <_panic>
+
+0080112d <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  80112d:	55                   	push   %ebp
+  80112e:	89 e5                	mov    %esp,%ebp
+  801130:	57                   	push   %edi
+  801131:	56                   	push   %esi
+  801132:	53                   	push   %ebx
+  801133:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  801136:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80113b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80113e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801141:	b8 06 00 00 00       	mov    $0x6,%eax
+  801146:	89 df                	mov    %ebx,%edi
+  801148:	55                   	push   %ebp
+  801149:	89 e5                	mov    %esp,%ebp
+  80114b:	8d 35 53 11 80 00    	lea    0x801153,%esi
+  801151:	0f 34                	sysenter
+  801153:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801154:	85 c0                	test   %eax,%eax
+  801156:	7f 08                	jg     801160 <sys_page_unmap+0x33>
+	return syscall2(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0);
+}
+  801158:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80115b:	5b                   	pop    %ebx
+  80115c:	5e                   	pop    %esi
+  80115d:	5f                   	pop    %edi
+  80115e:	5d                   	pop    %ebp
+  80115f:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801160:	83 ec 0c             	sub    $0xc,%esp
+  801163:	50                   	push   %eax
+  801164:	6a 06                	push   $0x6
+  801166:	68 07 42 80 00       	push   $0x804207
+  80116b:	6a 3d                	push   $0x3d
+  80116d:	68 24 42 80 00       	push   $0x804224
+  801172:	e8 54 f4 ff ff       	call   8005cb <_panic>
+
+00801177 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  801177:	55                   	push   %ebp
+  801178:	89 e5                	mov    %esp,%ebp
+  80117a:	57                   	push   %edi
+  80117b:	56                   	push   %esi
+  80117c:	53                   	push   %ebx
+  80117d:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  801180:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801185:	8b 55 08             	mov    0x8(%ebp),%edx
+  801188:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80118b:	b8 08 00 00 00       	mov    $0x8,%eax
+  801190:	89 df                	mov    %ebx,%edi
+  801192:	55                   	push   %ebp
+  801193:	89 e5                	mov    %esp,%ebp
+  801195:	8d 35 9d 11 80 00    	lea    0x80119d,%esi
+  80119b:	0f 34                	sysenter
+  80119d:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  80119e:	85 c0                	test   %eax,%eax
+  8011a0:	7f 08                	jg     8011aa <sys_env_set_status+0x33>
+	return syscall2(SYS_env_set_status, 1, envid, status, 0, 0);
+}
+  8011a2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011a5:	5b                   	pop    %ebx
+  8011a6:	5e                   	pop    %esi
+  8011a7:	5f                   	pop    %edi
+  8011a8:	5d                   	pop    %ebp
+  8011a9:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8011aa:	83 ec 0c             	sub    $0xc,%esp
+  8011ad:	50                   	push   %eax
+  8011ae:	6a 08                	push   $0x8
+  8011b0:	68 07 42 80 00       	push   $0x804207
+  8011b5:	6a 3d                	push   $0x3d
+  8011b7:	68 24 42 80 00       	push   $0x804224
+  8011bc:	e8 0a f4 ff ff       	call   8005cb <_panic>
+
+008011c1 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  8011c1:	55                   	push   %ebp
+  8011c2:	89 e5                	mov    %esp,%ebp
+  8011c4:	57                   	push   %edi
+  8011c5:	56                   	push   %esi
+  8011c6:	53                   	push   %ebx
+  8011c7:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  8011ca:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011cf:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011d2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011d5:	b8 09 00 00 00       	mov    $0x9,%eax
+  8011da:	89 df                	mov    %ebx,%edi
+  8011dc:	55                   	push   %ebp
+  8011dd:	89 e5                	mov    %esp,%ebp
+  8011df:	8d 35 e7 11 80 00    	lea    0x8011e7,%esi
+  8011e5:	0f 34                	sysenter
+  8011e7:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8011e8:	85 c0                	test   %eax,%eax
+  8011ea:	7f 08                	jg     8011f4 <sys_env_set_trapframe+0x33>
+	return syscall2(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0);
+}
+  8011ec:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011ef:	5b                   	pop    %ebx
+  8011f0:	5e                   	pop    %esi
+  8011f1:	5f                   	pop    %edi
+  8011f2:	5d                   	pop    %ebp
+  8011f3:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8011f4:	83 ec 0c             	sub    $0xc,%esp
+  8011f7:	50                   	push   %eax
+  8011f8:	6a 09                	push   $0x9
+  8011fa:	68 07 42 80 00       	push   $0x804207
+  8011ff:	6a 3d                	push   $0x3d
+  801201:	68 24 42 80 00       	push   $0x804224
+  801206:	e8 c0 f3 ff ff       	call   8005cb <_panic>
+
+0080120b <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  80120b:	55                   	push   %ebp
+  80120c:	89 e5                	mov    %esp,%ebp
+  80120e:	57                   	push   %edi
+  80120f:	56                   	push   %esi
+  801210:	53                   	push   %ebx
+  801211:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  801214:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801219:	8b 55 08             	mov    0x8(%ebp),%edx
+  80121c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80121f:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801224:	89 df                	mov    %ebx,%edi
+  801226:	55                   	push   %ebp
+  801227:	89 e5                	mov    %esp,%ebp
+  801229:	8d 35 31 12 80 00    	lea    0x801231,%esi
+  80122f:	0f 34                	sysenter
+  801231:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801232:	85 c0                	test   %eax,%eax
+  801234:	7f 08                	jg     80123e <sys_env_set_pgfault_upcall+0x33>
+	return syscall2(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0);
+}
+  801236:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801239:	5b                   	pop    %ebx
+  80123a:	5e                   	pop    %esi
+  80123b:	5f                   	pop    %edi
+  80123c:	5d                   	pop    %ebp
+  80123d:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80123e:	83 ec 0c             	sub    $0xc,%esp
+  801241:	50                   	push   %eax
+  801242:	6a 0a                	push   $0xa
+  801244:	68 07 42 80 00       	push   $0x804207
+  801249:	6a 3d                	push   $0x3d
+  80124b:	68 24 42 80 00       	push   $0x804224
+  801250:	e8 76 f3 ff ff       	call   8005cb <_panic>
+
+00801255 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  801255:	55                   	push   %ebp
+  801256:	89 e5                	mov    %esp,%ebp
+  801258:	57                   	push   %edi
+  801259:	56                   	push   %esi
+  80125a:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  80125b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80125e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801261:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801266:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801269:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80126c:	55                   	push   %ebp
+  80126d:	89 e5                	mov    %esp,%ebp
+  80126f:	8d 35 77 12 80 00    	lea    0x801277,%esi
+  801275:	0f 34                	sysenter
+  801277:	5d                   	pop    %ebp
+	return syscall2(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm);
+}
+  801278:	5b                   	pop    %ebx
+  801279:	5e                   	pop    %esi
+  80127a:	5f                   	pop    %edi
+  80127b:	5d                   	pop    %ebp
+  80127c:	c3                   	ret
+
+0080127d <sys_ipc_try_sendv>:
+
+int
+sys_ipc_try_sendv(envid_t envid, uint32_t value, const uintptr_t *pages, int npages)
+{
+  80127d:	55                   	push   %ebp
+  80127e:	89 e5                	mov    %esp,%ebp
+  801280:	57                   	push   %edi
+  801281:	56                   	push   %esi
+  801282:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  801283:	8b 55 08             	mov    0x8(%ebp),%edx
+  801286:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801289:	b8 17 00 00 00       	mov    $0x17,%eax
+  80128e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801291:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801294:	55                   	push   %ebp
+  801295:	89 e5                	mov    %esp,%ebp
+  801297:	8d 35 9f 12 80 00    	lea    0x80129f,%esi
+  80129d:	0f 34                	sysenter
+  80129f:	5d                   	pop    %ebp
+	return syscall2(SYS_ipc_try_sendv, 0, envid, value, (uint32_t) pages, npages);
+}
+  8012a0:	5b                   	pop    %ebx
+  8012a1:	5e                   	pop    %esi
+  8012a2:	5f                   	pop    %edi
+  8012a3:	5d                   	pop    %ebp
+  8012a4:	c3                   	ret
+
+008012a5 <sys_ipc_recvv>:
+	return sys_ipc_recvv(dstva, 1, 0);
+}
+
+int
+sys_ipc_recvv(void *dstva, int npages, int flags)
+{
+  8012a5:	55                   	push   %ebp
+  8012a6:	89 e5                	mov    %esp,%ebp
+  8012a8:	57                   	push   %edi
+  8012a9:	56                   	push   %esi
+  8012aa:	53                   	push   %ebx
+  8012ab:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8012ae:	be 00 00 00 00       	mov    $0x0,%esi
+  8012b3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012b6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012b9:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8012be:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8012c1:	89 f7                	mov    %esi,%edi
+  8012c3:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8012c5:	85 c0                	test   %eax,%eax
+  8012c7:	7f 08                	jg     8012d1 <sys_ipc_recvv+0x2c>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npages, flags, 0, 0);
+}
+  8012c9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8012cc:	5b                   	pop    %ebx
+  8012cd:	5e                   	pop    %esi
+  8012ce:	5f                   	pop    %edi
+  8012cf:	5d                   	pop    %ebp
+  8012d0:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8012d1:	83 ec 0c             	sub    $0xc,%esp
+  8012d4:	50                   	push   %eax
+  8012d5:	6a 0d                	push   $0xd
+  8012d7:	68 07 42 80 00       	push   $0x804207
+  8012dc:	6a 23                	push   $0x23
+  8012de:	68 24 42 80 00       	push   $0x804224
+  8012e3:	e8 e3 f2 ff ff       	call   8005cb <_panic>
+
+008012e8 <sys_ipc_recv>:
+{
+  8012e8:	55                   	push   %ebp
+  8012e9:	89 e5                	mov    %esp,%ebp
+  8012eb:	83 ec 0c             	sub    $0xc,%esp
+	return sys_ipc_recvv(dstva, 1, 0);
+  8012ee:	6a 00                	push   $0x0
+  8012f0:	6a 01                	push   $0x1
+  8012f2:	ff 75 08             	push   0x8(%ebp)
+  8012f5:	e8 ab ff ff ff       	call   8012a5 <sys_ipc_recvv>
+}
+  8012fa:	c9                   	leave
+  8012fb:	c3                   	ret
+
+008012fc <sys_ipc_recv_until>:
+
+int
+sys_ipc_recv_until(void *dstva, int npages, unsigned int deadline)
+{
+  8012fc:	55                   	push   %ebp
+  8012fd:	89 e5                	mov    %esp,%ebp
+  8012ff:	57                   	push   %edi
+  801300:	56                   	push   %esi
+  801301:	53                   	push   %ebx
+  801302:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801305:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80130a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80130d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801310:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801315:	8b 7d 10             	mov    0x10(%ebp),%edi
+  801318:	89 de                	mov    %ebx,%esi
+  80131a:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  80131c:	85 c0                	test   %eax,%eax
+  80131e:	7f 08                	jg     801328 <sys_ipc_recv_until+0x2c>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npages, 0, deadline, 0);
+}
+  801320:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801323:	5b                   	pop    %ebx
+  801324:	5e                   	pop    %esi
+  801325:	5f                   	pop    %edi
+  801326:	5d                   	pop    %ebp
+  801327:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801328:	83 ec 0c             	sub    $0xc,%esp
+  80132b:	50                   	push   %eax
+  80132c:	6a 0d                	push   $0xd
+  80132e:	68 07 42 80 00       	push   $0x804207
+  801333:	6a 23                	push   $0x23
+  801335:	68 24 42 80 00       	push   $0x804224
+  80133a:	e8 8c f2 ff ff       	call   8005cb <_panic>
+
+0080133f <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  80133f:	55                   	push   %ebp
+  801340:	89 e5                	mov    %esp,%ebp
+  801342:	57                   	push   %edi
+  801343:	56                   	push   %esi
+  801344:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  801345:	ba 00 00 00 00       	mov    $0x0,%edx
+  80134a:	b8 0e 00 00 00       	mov    $0xe,%eax
+  80134f:	89 d1                	mov    %edx,%ecx
+  801351:	89 d3                	mov    %edx,%ebx
+  801353:	89 d7                	mov    %edx,%edi
+  801355:	55                   	push   %ebp
+  801356:	89 e5                	mov    %esp,%ebp
+  801358:	8d 35 60 13 80 00    	lea    0x801360,%esi
+  80135e:	0f 34                	sysenter
+  801360:	5d                   	pop    %ebp
+	return (unsigned int) syscall2(SYS_time_msec, 0, 0, 0, 0, 0);
+}
+  801361:	5b                   	pop    %ebx
+  801362:	5e                   	pop    %esi
+  801363:	5f                   	pop    %edi
+  801364:	5d                   	pop    %ebp
+  801365:	c3                   	ret
+
+00801366 <sys_net_try_send>:
+
+size_t
+sys_net_try_send(void *packet, size_t length)
+{
+  801366:	55                   	push   %ebp
+  801367:	89 e5                	mov    %esp,%ebp
+  801369:	57                   	push   %edi
+  80136a:	56                   	push   %esi
+  80136b:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  80136c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801371:	8b 55 08             	mov    0x8(%ebp),%edx
+  801374:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801377:	b8 0f 00 00 00       	mov    $0xf,%eax
+  80137c:	89 df                	mov    %ebx,%edi
+  80137e:	55                   	push   %ebp
+  80137f:	89 e5                	mov    %esp,%ebp
+  801381:	8d 35 89 13 80 00    	lea    0x801389,%esi
+  801387:	0f 34                	sysenter
+  801389:	5d                   	pop    %ebp
+	return syscall2(SYS_net_try_send, 0, (uint32_t) packet, length, 0, 0);
+}
+  80138a:	5b                   	pop    %ebx
+  80138b:	5e                   	pop    %esi
+  80138c:	5f                   	pop    %edi
+  80138d:	5d                   	pop    %ebp
+  80138e:	c3                   	ret
+
+0080138f <sys_net_try_recv>:
+
+size_t
+sys_net_try_recv(uint8_t *buffer)
+{
+  80138f:	55                   	push   %ebp
+  801390:	89 e5                	mov    %esp,%ebp
+  801392:	57                   	push   %edi
+  801393:	56                   	push   %esi
+  801394:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  801395:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80139a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80139d:	b8 10 00 00 00       	mov    $0x10,%eax
+  8013a2:	89 cb                	mov    %ecx,%ebx
+  8013a4:	89 cf                	mov    %ecx,%edi
+  8013a6:	55                   	push   %ebp
+  8013a7:	89 e5                	mov    %esp,%ebp
+  8013a9:	8d 35 b1 13 80 00    	lea    0x8013b1,%esi
+  8013af:	0f 34                	sysenter
+  8013b1:	5d                   	pop    %ebp
+	return syscall2(SYS_net_try_recv, 0, (uint32_t) buffer, 0, 0, 0);
+}
+  8013b2:	5b                   	pop    %ebx
+  8013b3:	5e                   	pop    %esi
+  8013b4:	5f                   	pop    %edi
+  8013b5:	5d                   	pop    %ebp
+  8013b6:	c3                   	ret
+
+008013b7 <sys_net_recv_pages>:
+
+int
+sys_net_recv_pages(void *dstva, int npages)
+{
+  8013b7:	55                   	push   %ebp
+  8013b8:	89 e5                	mov    %esp,%ebp
+  8013ba:	57                   	push   %edi
+  8013bb:	56                   	push   %esi
+  8013bc:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  8013bd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013c2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013c5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013c8:	b8 12 00 00 00       	mov    $0x12,%eax
+  8013cd:	89 df                	mov    %ebx,%edi
+  8013cf:	55                   	push   %ebp
+  8013d0:	89 e5                	mov    %esp,%ebp
+  8013d2:	8d 35 da 13 80 00    	lea    0x8013da,%esi
+  8013d8:	0f 34                	sysenter
+  8013da:	5d                   	pop    %ebp
+	return syscall2(SYS_net_recv_pages, 0, (uint32_t) dstva, npages, 0, 0);
+}
+  8013db:	5b                   	pop    %ebx
+  8013dc:	5e                   	pop    %esi
+  8013dd:	5f                   	pop    %edi
+  8013de:	5d                   	pop    %ebp
+  8013df:	c3                   	ret
+
+008013e0 <sys_net_send_batch>:
+
+int
+sys_net_send_batch(const struct net_sg *pkts, int n)
+{
+  8013e0:	55                   	push   %ebp
+  8013e1:	89 e5                	mov    %esp,%ebp
+  8013e3:	57                   	push   %edi
+  8013e4:	56                   	push   %esi
+  8013e5:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  8013e6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013eb:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013ee:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013f1:	b8 14 00 00 00       	mov    $0x14,%eax
+  8013f6:	89 df                	mov    %ebx,%edi
+  8013f8:	55                   	push   %ebp
+  8013f9:	89 e5                	mov    %esp,%ebp
+  8013fb:	8d 35 03 14 80 00    	lea    0x801403,%esi
+  801401:	0f 34                	sysenter
+  801403:	5d                   	pop    %ebp
+	return syscall2(SYS_net_send_batch, 0, (uint32_t) pkts, n, 0, 0);
+}
+  801404:	5b                   	pop    %ebx
+  801405:	5e                   	pop    %esi
+  801406:	5f                   	pop    %edi
+  801407:	5d                   	pop    %ebp
+  801408:	c3                   	ret
+
+00801409 <sys_net_send_sg>:
+
+int
+sys_net_send_sg(const struct net_sg *sg, int nsg,
+		const struct net_offload *off, struct net_txinfo *info)
+{
+  801409:	55                   	push   %ebp
+  80140a:	89 e5                	mov    %esp,%ebp
+  80140c:	57                   	push   %edi
+  80140d:	56                   	push   %esi
+  80140e:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  80140f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801412:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801415:	b8 13 00 00 00       	mov    $0x13,%eax
+  80141a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80141d:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801420:	55                   	push   %ebp
+  801421:	89 e5                	mov    %esp,%ebp
+  801423:	8d 35 2b 14 80 00    	lea    0x80142b,%esi
+  801429:	0f 34                	sysenter
+  80142b:	5d                   	pop    %ebp
+	return syscall2(SYS_net_send_sg, 0, (uint32_t) sg, nsg, (uint32_t) off,
+			(uint32_t) info);
+}
+  80142c:	5b                   	pop    %ebx
+  80142d:	5e                   	pop    %esi
+  80142e:	5f                   	pop    %edi
+  80142f:	5d                   	pop    %ebp
+  801430:	c3                   	ret
+
+00801431 <sys_net_wait>:
+
+int
+sys_net_wait(uint32_t events)
+{
+  801431:	55                   	push   %ebp
+  801432:	89 e5                	mov    %esp,%ebp
+  801434:	57                   	push   %edi
+  801435:	56                   	push   %esi
+  801436:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801437:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80143c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80143f:	b8 11 00 00 00       	mov    $0x11,%eax
+  801444:	89 cb                	mov    %ecx,%ebx
+  801446:	89 cf                	mov    %ecx,%edi
+  801448:	89 ce                	mov    %ecx,%esi
+  80144a:	cd 30                	int    $0x30
+	// Blocks, so it has to go through the trap gate.
+	return syscall(SYS_net_wait, 0, events, 0, 0, 0, 0);
+}
+  80144c:	5b                   	pop    %ebx
+  80144d:	5e                   	pop    %esi
+  80144e:	5f                   	pop    %edi
+  80144f:	5d                   	pop    %ebp
+  801450:	c3                   	ret
+
+00801451 <sys_net_map>:
+
+int
+sys_net_map(void *va)
+{
+  801451:	55                   	push   %ebp
+  801452:	89 e5                	mov    %esp,%ebp
+  801454:	57                   	push   %edi
+  801455:	56                   	push   %esi
+  801456:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  801457:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80145c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80145f:	b8 15 00 00 00       	mov    $0x15,%eax
+  801464:	89 cb                	mov    %ecx,%ebx
+  801466:	89 cf                	mov    %ecx,%edi
+  801468:	55                   	push   %ebp
+  801469:	89 e5                	mov    %esp,%ebp
+  80146b:	8d 35 73 14 80 00    	lea    0x801473,%esi
+  801471:	0f 34                	sysenter
+  801473:	5d                   	pop    %ebp
+	return syscall2(SYS_net_map, 0, (uint32_t) va, 0, 0, 0);
+}
+  801474:	5b                   	pop    %ebx
+  801475:	5e                   	pop    %esi
+  801476:	5f                   	pop    %edi
+  801477:	5d                   	pop    %ebp
+  801478:	c3                   	ret
+
+00801479 <sys_net_sync>:
+
+int
+sys_net_sync(uint32_t rings)
+{
+  801479:	55                   	push   %ebp
+  80147a:	89 e5                	mov    %esp,%ebp
+  80147c:	57                   	push   %edi
+  80147d:	56                   	push   %esi
+  80147e:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  80147f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801484:	8b 55 08             	mov    0x8(%ebp),%edx
+  801487:	b8 16 00 00 00       	mov    $0x16,%eax
+  80148c:	89 cb                	mov    %ecx,%ebx
+  80148e:	89 cf                	mov    %ecx,%edi
+  801490:	55                   	push   %ebp
+  801491:	89 e5                	mov    %esp,%ebp
+  801493:	8d 35 9b 14 80 00    	lea    0x80149b,%esi
+  801499:	0f 34                	sysenter
+  80149b:	5d                   	pop    %ebp
+	return syscall2(SYS_net_sync, 0, rings, 0, 0, 0);
+}
+  80149c:	5b                   	pop    %ebx
+  80149d:	5e                   	pop    %esi
+  80149e:	5f                   	pop    %edi
+  80149f:	5d                   	pop    %ebp
+  8014a0:	c3                   	ret
+
+008014a1 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  8014a1:	55                   	push   %ebp
+  8014a2:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8014a4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8014a7:	05 00 00 00 30       	add    $0x30000000,%eax
+  8014ac:	c1 e8 0c             	shr    $0xc,%eax
+}
+  8014af:	5d                   	pop    %ebp
+  8014b0:	c3                   	ret
+
+008014b1 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  8014b1:	55                   	push   %ebp
+  8014b2:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8014b4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8014b7:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  8014bc:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  8014c1:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  8014c6:	5d                   	pop    %ebp
+  8014c7:	c3                   	ret
+
+008014c8 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  8014c8:	55                   	push   %ebp
+  8014c9:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  8014cb:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  8014d0:	eb 02                	jmp    8014d4 <fd_alloc+0xc>
+  8014d2:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  8014d4:	89 c2                	mov    %eax,%edx
+  8014d6:	c1 ea 16             	shr    $0x16,%edx
+  8014d9:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  8014e0:	f6 c2 01             	test   $0x1,%dl
+  8014e3:	74 2b                	je     801510 <fd_alloc+0x48>
+  8014e5:	89 c2                	mov    %eax,%edx
+  8014e7:	c1 ea 0c             	shr    $0xc,%edx
+  8014ea:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  8014f1:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  8014f7:	f6 c1 01             	test   $0x1,%cl
+  8014fa:	74 14                	je     801510 <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  8014fc:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  801502:	75 ce                	jne    8014d2 <fd_alloc+0xa>
+  801504:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  801509:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  80150e:	eb 05                	jmp    801515 <fd_alloc+0x4d>
+			return 0;
+  801510:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  801515:	8b 55 08             	mov    0x8(%ebp),%edx
+  801518:	89 02                	mov    %eax,(%edx)
+}
+  80151a:	89 c8                	mov    %ecx,%eax
+  80151c:	5d                   	pop    %ebp
+  80151d:	c3                   	ret
+
+0080151e <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  80151e:	55                   	push   %ebp
+  80151f:	89 e5                	mov    %esp,%ebp
+  801521:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  801524:	83 f8 1f             	cmp    $0x1f,%eax
+  801527:	77 30                	ja     801559 <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  801529:	c1 e0 0c             	shl    $0xc,%eax
+  80152c:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  801531:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  801537:	f6 c2 01             	test   $0x1,%dl
+  80153a:	74 24                	je     801560 <fd_lookup+0x42>
+  80153c:	89 c2                	mov    %eax,%edx
+  80153e:	c1 ea 0c             	shr    $0xc,%edx
+  801541:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801548:	f6 c2 01             	test   $0x1,%dl
+  80154b:	74 1a                	je     801567 <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  80154d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801550:	89 02                	mov    %eax,(%edx)
+	return 0;
+  801552:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801557:	5d                   	pop    %ebp
+  801558:	c3                   	ret
+		return -E_INVAL;
+  801559:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80155e:	eb f7                	jmp    801557 <fd_lookup+0x39>
+		return -E_INVAL;
+  801560:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801565:	eb f0                	jmp    801557 <fd_lookup+0x39>
+  801567:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80156c:	eb e9                	jmp    801557 <fd_lookup+0x39>
+
+0080156e <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  80156e:	55                   	push   %ebp
+  80156f:	89 e5                	mov    %esp,%ebp
+  801571:	53                   	push   %ebx
+  801572:	83 ec 04             	sub    $0x4,%esp
+  801575:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  801578:	b8 00 00 00 00       	mov    $0x0,%eax
+  80157d:	eb 03                	jmp    801582 <dev_lookup+0x14>
+  80157f:	83 c0 01             	add    $0x1,%eax
+  801582:	8b 1c 85 b0 42 80 00 	mov    0x8042b0(,%eax,4),%ebx
+  801589:	85 db                	test   %ebx,%ebx
+  80158b:	74 0b                	je     801598 <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  80158d:	39 13                	cmp    %edx,(%ebx)
+  80158f:	75 ee                	jne    80157f <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  801591:	b8 00 00 00 00       	mov    $0x0,%eax
+  801596:	eb 1f                	jmp    8015b7 <dev_lookup+0x49>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801598:	a1 c0 78 81 00       	mov    0x8178c0,%eax
+  80159d:	8b 40 48             	mov    0x48(%eax),%eax
+  8015a0:	83 ec 04             	sub    $0x4,%esp
+  8015a3:	52                   	push   %edx
+  8015a4:	50                   	push   %eax
+  8015a5:	68 34 42 80 00       	push   $0x804234
+  8015aa:	e8 f7 f0 ff ff       	call   8006a6 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  8015af:	83 c4 10             	add    $0x10,%esp
+  8015b2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  8015b7:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8015ba:	89 1a                	mov    %ebx,(%edx)
+}
+  8015bc:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8015bf:	c9                   	leave
+  8015c0:	c3                   	ret
+
+008015c1 <fd_close>:
+{
+  8015c1:	55                   	push   %ebp
+  8015c2:	89 e5                	mov    %esp,%ebp
+  8015c4:	57                   	push   %edi
+  8015c5:	56                   	push   %esi
+  8015c6:	53                   	push   %ebx
+  8015c7:	83 ec 24             	sub    $0x24,%esp
+  8015ca:	8b 75 08             	mov    0x8(%ebp),%esi
+  8015cd:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8015d0:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8015d3:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8015d4:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  8015da:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8015dd:	50                   	push   %eax
+  8015de:	e8 3b ff ff ff       	call   80151e <fd_lookup>
+  8015e3:	89 c3                	mov    %eax,%ebx
+  8015e5:	83 c4 10             	add    $0x10,%esp
+  8015e8:	85 c0                	test   %eax,%eax
+  8015ea:	78 05                	js     8015f1 <fd_close+0x30>
+	    || fd != fd2)
+  8015ec:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  8015ef:	74 16                	je     801607 <fd_close+0x46>
+		return (must_exist ? r : 0);
+  8015f1:	89 f8                	mov    %edi,%eax
+  8015f3:	84 c0                	test   %al,%al
+  8015f5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015fa:	0f 44 d8             	cmove  %eax,%ebx
+}
+  8015fd:	89 d8                	mov    %ebx,%eax
+  8015ff:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801602:	5b                   	pop    %ebx
+  801603:	5e                   	pop    %esi
+  801604:	5f                   	pop    %edi
+  801605:	5d                   	pop    %ebp
+  801606:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801607:	83 ec 08             	sub    $0x8,%esp
+  80160a:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  80160d:	50                   	push   %eax
+  80160e:	ff 36                	push   (%esi)
+  801610:	e8 59 ff ff ff       	call   80156e <dev_lookup>
+  801615:	89 c3                	mov    %eax,%ebx
+  801617:	83 c4 10             	add    $0x10,%esp
+  80161a:	85 c0                	test   %eax,%eax
+  80161c:	78 1a                	js     801638 <fd_close+0x77>
+		if (dev->dev_close)
+  80161e:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801621:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  801624:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  801629:	85 c0                	test   %eax,%eax
+  80162b:	74 0b                	je     801638 <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  80162d:	83 ec 0c             	sub    $0xc,%esp
+  801630:	56                   	push   %esi
+  801631:	ff d0                	call   *%eax
+  801633:	89 c3                	mov    %eax,%ebx
+  801635:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  801638:	83 ec 08             	sub    $0x8,%esp
+  80163b:	56                   	push   %esi
+  80163c:	6a 00                	push   $0x0
+  80163e:	e8 ea fa ff ff       	call   80112d <sys_page_unmap>
+	return r;
+  801643:	83 c4 10             	add    $0x10,%esp
+  801646:	eb b5                	jmp    8015fd <fd_close+0x3c>
+
+00801648 <close>:
+
+int
+close(int fdnum)
+{
+  801648:	55                   	push   %ebp
+  801649:	89 e5                	mov    %esp,%ebp
+  80164b:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80164e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801651:	50                   	push   %eax
+  801652:	ff 75 08             	push   0x8(%ebp)
+  801655:	e8 c4 fe ff ff       	call   80151e <fd_lookup>
+  80165a:	83 c4 10             	add    $0x10,%esp
+  80165d:	85 c0                	test   %eax,%eax
+  80165f:	79 02                	jns    801663 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  801661:	c9                   	leave
+  801662:	c3                   	ret
+		return fd_close(fd, 1);
+  801663:	83 ec 08             	sub    $0x8,%esp
+  801666:	6a 01                	push   $0x1
+  801668:	ff 75 f4             	push   -0xc(%ebp)
+  80166b:	e8 51 ff ff ff       	call   8015c1 <fd_close>
+  801670:	83 c4 10             	add    $0x10,%esp
+  801673:	eb ec                	jmp    801661 <close+0x19>
+
+00801675 <close_all>:
+
+void
+close_all(void)
+{
+  801675:	55                   	push   %ebp
+  801676:	89 e5                	mov    %esp,%ebp
+  801678:	53                   	push   %ebx
+  801679:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  80167c:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  801681:	83 ec 0c             	sub    $0xc,%esp
+  801684:	53                   	push   %ebx
+  801685:	e8 be ff ff ff       	call   801648 <close>
+	for (i = 0; i < MAXFD; i++)
+  80168a:	83 c3 01             	add    $0x1,%ebx
+  80168d:	83 c4 10             	add    $0x10,%esp
+  801690:	83 fb 20             	cmp    $0x20,%ebx
+  801693:	75 ec                	jne    801681 <close_all+0xc>
+}
+  801695:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801698:	c9                   	leave
+  801699:	c3                   	ret
+
+0080169a <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  80169a:	55                   	push   %ebp
+  80169b:	89 e5                	mov    %esp,%ebp
+  80169d:	57                   	push   %edi
+  80169e:	56                   	push   %esi
+  80169f:	53                   	push   %ebx
+  8016a0:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  8016a3:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8016a6:	50                   	push   %eax
+  8016a7:	ff 75 08             	push   0x8(%ebp)
+  8016aa:	e8 6f fe ff ff       	call   80151e <fd_lookup>
+  8016af:	89 c3                	mov    %eax,%ebx
+  8016b1:	83 c4 10             	add    $0x10,%esp
+  8016b4:	85 c0                	test   %eax,%eax
+  8016b6:	78 7f                	js     801737 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  8016b8:	83 ec 0c             	sub    $0xc,%esp
+  8016bb:	ff 75 0c             	push   0xc(%ebp)
+  8016be:	e8 85 ff ff ff       	call   801648 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  8016c3:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8016c6:	c1 e6 0c             	shl    $0xc,%esi
+  8016c9:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  8016cf:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8016d2:	89 3c 24             	mov    %edi,(%esp)
+  8016d5:	e8 d7 fd ff ff       	call   8014b1 <fd2data>
+  8016da:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  8016dc:	89 34 24             	mov    %esi,(%esp)
+  8016df:	e8 cd fd ff ff       	call   8014b1 <fd2data>
+  8016e4:	83 c4 10             	add    $0x10,%esp
+  8016e7:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  8016ea:	89 d8                	mov    %ebx,%eax
+  8016ec:	c1 e8 16             	shr    $0x16,%eax
+  8016ef:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8016f6:	a8 01                	test   $0x1,%al
+  8016f8:	74 11                	je     80170b <dup+0x71>
+  8016fa:	89 d8                	mov    %ebx,%eax
+  8016fc:	c1 e8 0c             	shr    $0xc,%eax
+  8016ff:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801706:	f6 c2 01             	test   $0x1,%dl
+  801709:	75 36                	jne    801741 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  80170b:	89 f8                	mov    %edi,%eax
+  80170d:	c1 e8 0c             	shr    $0xc,%eax
+  801710:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801717:	83 ec 0c             	sub    $0xc,%esp
+  80171a:	25 07 0e 00 00       	and    $0xe07,%eax
+  80171f:	50                   	push   %eax
+  801720:	56                   	push   %esi
+  801721:	6a 00                	push   $0x0
+  801723:	57                   	push   %edi
+  801724:	6a 00                	push   $0x0
+  801726:	e8 c0 f9 ff ff       	call   8010eb <sys_page_map>
+  80172b:	89 c3                	mov    %eax,%ebx
+  80172d:	83 c4 20             	add    $0x20,%esp
+  801730:	85 c0                	test   %eax,%eax
+  801732:	78 33                	js     801767 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  801734:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  801737:	89 d8                	mov    %ebx,%eax
+  801739:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80173c:	5b                   	pop    %ebx
+  80173d:	5e                   	pop    %esi
+  80173e:	5f                   	pop    %edi
+  80173f:	5d                   	pop    %ebp
+  801740:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  801741:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801748:	83 ec 0c             	sub    $0xc,%esp
+  80174b:	25 07 0e 00 00       	and    $0xe07,%eax
+  801750:	50                   	push   %eax
+  801751:	ff 75 d4             	push   -0x2c(%ebp)
+  801754:	6a 00                	push   $0x0
+  801756:	53                   	push   %ebx
+  801757:	6a 00                	push   $0x0
+  801759:	e8 8d f9 ff ff       	call   8010eb <sys_page_map>
+  80175e:	89 c3                	mov    %eax,%ebx
+  801760:	83 c4 20             	add    $0x20,%esp
+  801763:	85 c0                	test   %eax,%eax
+  801765:	79 a4                	jns    80170b <dup+0x71>
+	sys_page_unmap(0, newfd);
+  801767:	83 ec 08             	sub    $0x8,%esp
+  80176a:	56                   	push   %esi
+  80176b:	6a 00                	push   $0x0
+  80176d:	e8 bb f9 ff ff       	call   80112d <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  801772:	83 c4 08             	add    $0x8,%esp
+  801775:	ff 75 d4             	push   -0x2c(%ebp)
+  801778:	6a 00                	push   $0x0
+  80177a:	e8 ae f9 ff ff       	call   80112d <sys_page_unmap>
+	return r;
+  80177f:	83 c4 10             	add    $0x10,%esp
+  801782:	eb b3                	jmp    801737 <dup+0x9d>
+
+00801784 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  801784:	55                   	push   %ebp
+  801785:	89 e5                	mov    %esp,%ebp
+  801787:	56                   	push   %esi
+  801788:	53                   	push   %ebx
+  801789:	83 ec 18             	sub    $0x18,%esp
+  80178c:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80178f:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801792:	50                   	push   %eax
+  801793:	56                   	push   %esi
+  801794:	e8 85 fd ff ff       	call   80151e <fd_lookup>
+  801799:	83 c4 10             	add    $0x10,%esp
+  80179c:	85 c0                	test   %eax,%eax
+  80179e:	78 3c                	js     8017dc <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8017a0:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  8017a3:	83 ec 08             	sub    $0x8,%esp
+  8017a6:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8017a9:	50                   	push   %eax
+  8017aa:	ff 33                	push   (%ebx)
+  8017ac:	e8 bd fd ff ff       	call   80156e <dev_lookup>
+  8017b1:	83 c4 10             	add    $0x10,%esp
+  8017b4:	85 c0                	test   %eax,%eax
+  8017b6:	78 24                	js     8017dc <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  8017b8:	8b 43 08             	mov    0x8(%ebx),%eax
+  8017bb:	83 e0 03             	and    $0x3,%eax
+  8017be:	83 f8 01             	cmp    $0x1,%eax
+  8017c1:	74 20                	je     8017e3 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  8017c3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8017c6:	8b 40 08             	mov    0x8(%eax),%eax
+  8017c9:	85 c0                	test   %eax,%eax
+  8017cb:	74 37                	je     801804 <read+0x80>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  8017cd:	83 ec 04             	sub    $0x4,%esp
+  8017d0:	ff 75 10             	push   0x10(%ebp)
+  8017d3:	ff 75 0c             	push   0xc(%ebp)
+  8017d6:	53                   	push   %ebx
+  8017d7:	ff d0                	call   *%eax
+  8017d9:	83 c4 10             	add    $0x10,%esp
+}
+  8017dc:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8017df:	5b                   	pop    %ebx
+  8017e0:	5e                   	pop    %esi
+  8017e1:	5d                   	pop    %ebp
+  8017e2:	c3                   	ret
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8017e3:	a1 c0 78 81 00       	mov    0x8178c0,%eax
+  8017e8:	8b 40 48             	mov    0x48(%eax),%eax
+  8017eb:	83 ec 04             	sub    $0x4,%esp
+  8017ee:	56                   	push   %esi
+  8017ef:	50                   	push   %eax
+  8017f0:	68 75 42 80 00       	push   $0x804275
+  8017f5:	e8 ac ee ff ff       	call   8006a6 <cprintf>
+		return -E_INVAL;
+  8017fa:	83 c4 10             	add    $0x10,%esp
+  8017fd:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801802:	eb d8                	jmp    8017dc <read+0x58>
+		return -E_NOT_SUPP;
+  801804:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801809:	eb d1                	jmp    8017dc <read+0x58>
+
+0080180b <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  80180b:	55                   	push   %ebp
+  80180c:	89 e5                	mov    %esp,%ebp
+  80180e:	57                   	push   %edi
+  80180f:	56                   	push   %esi
+  801810:	53                   	push   %ebx
+  801811:	83 ec 0c             	sub    $0xc,%esp
+  801814:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801817:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  80181a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80181f:	eb 02                	jmp    801823 <readn+0x18>
+  801821:	01 c3                	add    %eax,%ebx
+  801823:	39 f3                	cmp    %esi,%ebx
+  801825:	73 21                	jae    801848 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801827:	83 ec 04             	sub    $0x4,%esp
+  80182a:	89 f0                	mov    %esi,%eax
+  80182c:	29 d8                	sub    %ebx,%eax
+  80182e:	50                   	push   %eax
+  80182f:	89 d8                	mov    %ebx,%eax
+  801831:	03 45 0c             	add    0xc(%ebp),%eax
+  801834:	50                   	push   %eax
+  801835:	57                   	push   %edi
+  801836:	e8 49 ff ff ff       	call   801784 <read>
+		if (m < 0)
+  80183b:	83 c4 10             	add    $0x10,%esp
+  80183e:	85 c0                	test   %eax,%eax
+  801840:	78 04                	js     801846 <readn+0x3b>
+			return m;
+		if (m == 0)
+  801842:	75 dd                	jne    801821 <readn+0x16>
+  801844:	eb 02                	jmp    801848 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801846:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  801848:	89 d8                	mov    %ebx,%eax
+  80184a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80184d:	5b                   	pop    %ebx
+  80184e:	5e                   	pop    %esi
+  80184f:	5f                   	pop    %edi
+  801850:	5d                   	pop    %ebp
+  801851:	c3                   	ret
+
+00801852 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  801852:	55                   	push   %ebp
+  801853:	89 e5                	mov    %esp,%ebp
+  801855:	56                   	push   %esi
+  801856:	53                   	push   %ebx
+  801857:	83 ec 18             	sub    $0x18,%esp
+  80185a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80185d:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801860:	50                   	push   %eax
+  801861:	53                   	push   %ebx
+  801862:	e8 b7 fc ff ff       	call   80151e <fd_lookup>
+  801867:	83 c4 10             	add    $0x10,%esp
+  80186a:	85 c0                	test   %eax,%eax
+  80186c:	78 37                	js     8018a5 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80186e:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801871:	83 ec 08             	sub    $0x8,%esp
+  801874:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801877:	50                   	push   %eax
+  801878:	ff 36                	push   (%esi)
+  80187a:	e8 ef fc ff ff       	call   80156e <dev_lookup>
+  80187f:	83 c4 10             	add    $0x10,%esp
+  801882:	85 c0                	test   %eax,%eax
+  801884:	78 1f                	js     8018a5 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801886:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  80188a:	74 20                	je     8018ac <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  80188c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80188f:	8b 40 0c             	mov    0xc(%eax),%eax
+  801892:	85 c0                	test   %eax,%eax
+  801894:	74 37                	je     8018cd <write+0x7b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  801896:	83 ec 04             	sub    $0x4,%esp
+  801899:	ff 75 10             	push   0x10(%ebp)
+  80189c:	ff 75 0c             	push   0xc(%ebp)
+  80189f:	56                   	push   %esi
+  8018a0:	ff d0                	call   *%eax
+  8018a2:	83 c4 10             	add    $0x10,%esp
+}
+  8018a5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8018a8:	5b                   	pop    %ebx
+  8018a9:	5e                   	pop    %esi
+  8018aa:	5d                   	pop    %ebp
+  8018ab:	c3                   	ret
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  8018ac:	a1 c0 78 81 00       	mov    0x8178c0,%eax
+  8018b1:	8b 40 48             	mov    0x48(%eax),%eax
+  8018b4:	83 ec 04             	sub    $0x4,%esp
+  8018b7:	53                   	push   %ebx
+  8018b8:	50                   	push   %eax
+  8018b9:	68 91 42 80 00       	push   $0x804291
+  8018be:	e8 e3 ed ff ff       	call   8006a6 <cprintf>
+		return -E_INVAL;
+  8018c3:	83 c4 10             	add    $0x10,%esp
+  8018c6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8018cb:	eb d8                	jmp    8018a5 <write+0x53>
+		return -E_NOT_SUPP;
+  8018cd:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8018d2:	eb d1                	jmp    8018a5 <write+0x53>
+
+008018d4 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  8018d4:	55                   	push   %ebp
+  8018d5:	89 e5                	mov    %esp,%ebp
+  8018d7:	53                   	push   %ebx
+  8018d8:	83 ec 1c             	sub    $0x1c,%esp
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8018db:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8018de:	50                   	push   %eax
+  8018df:	ff 75 08             	push   0x8(%ebp)
+  8018e2:	e8 37 fc ff ff       	call   80151e <fd_lookup>
+  8018e7:	83 c4 10             	add    $0x10,%esp
+  8018ea:	85 c0                	test   %eax,%eax
+  8018ec:	78 3a                	js     801928 <seek+0x54>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8018ee:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  8018f1:	83 ec 08             	sub    $0x8,%esp
+  8018f4:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8018f7:	50                   	push   %eax
+  8018f8:	ff 33                	push   (%ebx)
+  8018fa:	e8 6f fc ff ff       	call   80156e <dev_lookup>
+  8018ff:	83 c4 10             	add    $0x10,%esp
+  801902:	85 c0                	test   %eax,%eax
+  801904:	78 22                	js     801928 <seek+0x54>
+		return r;
+	// Anything buffered for the old position goes out first.
+	if (dev->dev_sync && (r = (*dev->dev_sync)(fd)) < 0)
+  801906:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801909:	8b 40 1c             	mov    0x1c(%eax),%eax
+  80190c:	85 c0                	test   %eax,%eax
+  80190e:	74 0d                	je     80191d <seek+0x49>
+  801910:	83 ec 0c             	sub    $0xc,%esp
+  801913:	53                   	push   %ebx
+  801914:	ff d0                	call   *%eax
+  801916:	83 c4 10             	add    $0x10,%esp
+  801919:	85 c0                	test   %eax,%eax
+  80191b:	78 0b                	js     801928 <seek+0x54>
+		return r;
+	fd->fd_offset = offset;
+  80191d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801920:	89 43 04             	mov    %eax,0x4(%ebx)
+	return 0;
+  801923:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801928:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80192b:	c9                   	leave
+  80192c:	c3                   	ret
+
+0080192d <fsync>:
+
+// Push out anything the library has buffered for fdnum.
+int
+fsync(int fdnum)
+{
+  80192d:	55                   	push   %ebp
+  80192e:	89 e5                	mov    %esp,%ebp
+  801930:	53                   	push   %ebx
+  801931:	83 ec 1c             	sub    $0x1c,%esp
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801934:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801937:	50                   	push   %eax
+  801938:	ff 75 08             	push   0x8(%ebp)
+  80193b:	e8 de fb ff ff       	call   80151e <fd_lookup>
+  801940:	83 c4 10             	add    $0x10,%esp
+  801943:	85 c0                	test   %eax,%eax
+  801945:	78 2b                	js     801972 <fsync+0x45>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801947:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  80194a:	83 ec 08             	sub    $0x8,%esp
+  80194d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801950:	50                   	push   %eax
+  801951:	ff 33                	push   (%ebx)
+  801953:	e8 16 fc ff ff       	call   80156e <dev_lookup>
+  801958:	83 c4 10             	add    $0x10,%esp
+  80195b:	85 c0                	test   %eax,%eax
+  80195d:	78 13                	js     801972 <fsync+0x45>
+		return r;
+	if (!dev->dev_sync)
+  80195f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801962:	8b 40 1c             	mov    0x1c(%eax),%eax
+  801965:	85 c0                	test   %eax,%eax
+  801967:	74 0e                	je     801977 <fsync+0x4a>
+		return 0;
+	return (*dev->dev_sync)(fd);
+  801969:	83 ec 0c             	sub    $0xc,%esp
+  80196c:	53                   	push   %ebx
+  80196d:	ff d0                	call   *%eax
+  80196f:	83 c4 10             	add    $0x10,%esp
+}
+  801972:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801975:	c9                   	leave
+  801976:	c3                   	ret
+		return 0;
+  801977:	b8 00 00 00 00       	mov    $0x0,%eax
+  80197c:	eb f4                	jmp    801972 <fsync+0x45>
+
+0080197e <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  80197e:	55                   	push   %ebp
+  80197f:	89 e5                	mov    %esp,%ebp
+  801981:	56                   	push   %esi
+  801982:	53                   	push   %ebx
+  801983:	83 ec 18             	sub    $0x18,%esp
+  801986:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801989:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80198c:	50                   	push   %eax
+  80198d:	53                   	push   %ebx
+  80198e:	e8 8b fb ff ff       	call   80151e <fd_lookup>
+  801993:	83 c4 10             	add    $0x10,%esp
+  801996:	85 c0                	test   %eax,%eax
+  801998:	78 34                	js     8019ce <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80199a:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80199d:	83 ec 08             	sub    $0x8,%esp
+  8019a0:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8019a3:	50                   	push   %eax
+  8019a4:	ff 36                	push   (%esi)
+  8019a6:	e8 c3 fb ff ff       	call   80156e <dev_lookup>
+  8019ab:	83 c4 10             	add    $0x10,%esp
+  8019ae:	85 c0                	test   %eax,%eax
+  8019b0:	78 1c                	js     8019ce <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8019b2:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8019b6:	74 1d                	je     8019d5 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  8019b8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8019bb:	8b 40 18             	mov    0x18(%eax),%eax
+  8019be:	85 c0                	test   %eax,%eax
+  8019c0:	74 34                	je     8019f6 <ftruncate+0x78>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  8019c2:	83 ec 08             	sub    $0x8,%esp
+  8019c5:	ff 75 0c             	push   0xc(%ebp)
+  8019c8:	56                   	push   %esi
+  8019c9:	ff d0                	call   *%eax
+  8019cb:	83 c4 10             	add    $0x10,%esp
+}
+  8019ce:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8019d1:	5b                   	pop    %ebx
+  8019d2:	5e                   	pop    %esi
+  8019d3:	5d                   	pop    %ebp
+  8019d4:	c3                   	ret
+			thisenv->env_id, fdnum);
+  8019d5:	a1 c0 78 81 00       	mov    0x8178c0,%eax
+  8019da:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8019dd:	83 ec 04             	sub    $0x4,%esp
+  8019e0:	53                   	push   %ebx
+  8019e1:	50                   	push   %eax
+  8019e2:	68 54 42 80 00       	push   $0x804254
+  8019e7:	e8 ba ec ff ff       	call   8006a6 <cprintf>
+		return -E_INVAL;
+  8019ec:	83 c4 10             	add    $0x10,%esp
+  8019ef:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8019f4:	eb d8                	jmp    8019ce <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  8019f6:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8019fb:	eb d1                	jmp    8019ce <ftruncate+0x50>
+
+008019fd <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  8019fd:	55                   	push   %ebp
+  8019fe:	89 e5                	mov    %esp,%ebp
+  801a00:	56                   	push   %esi
+  801a01:	53                   	push   %ebx
+  801a02:	83 ec 18             	sub    $0x18,%esp
+  801a05:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801a08:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801a0b:	50                   	push   %eax
+  801a0c:	ff 75 08             	push   0x8(%ebp)
+  801a0f:	e8 0a fb ff ff       	call   80151e <fd_lookup>
+  801a14:	83 c4 10             	add    $0x10,%esp
+  801a17:	85 c0                	test   %eax,%eax
+  801a19:	78 49                	js     801a64 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801a1b:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801a1e:	83 ec 08             	sub    $0x8,%esp
+  801a21:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801a24:	50                   	push   %eax
+  801a25:	ff 36                	push   (%esi)
+  801a27:	e8 42 fb ff ff       	call   80156e <dev_lookup>
+  801a2c:	83 c4 10             	add    $0x10,%esp
+  801a2f:	85 c0                	test   %eax,%eax
+  801a31:	78 31                	js     801a64 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  801a33:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801a36:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  801a3a:	74 2f                	je     801a6b <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  801a3c:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  801a3f:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801a46:	00 00 00 
+	stat->st_isdir = 0;
+  801a49:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801a50:	00 00 00 
+	stat->st_dev = dev;
+  801a53:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  801a59:	83 ec 08             	sub    $0x8,%esp
+  801a5c:	53                   	push   %ebx
+  801a5d:	56                   	push   %esi
+  801a5e:	ff 50 14             	call   *0x14(%eax)
+  801a61:	83 c4 10             	add    $0x10,%esp
+}
+  801a64:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801a67:	5b                   	pop    %ebx
+  801a68:	5e                   	pop    %esi
+  801a69:	5d                   	pop    %ebp
+  801a6a:	c3                   	ret
+		return -E_NOT_SUPP;
+  801a6b:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801a70:	eb f2                	jmp    801a64 <fstat+0x67>
+
+00801a72 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  801a72:	55                   	push   %ebp
+  801a73:	89 e5                	mov    %esp,%ebp
+  801a75:	56                   	push   %esi
+  801a76:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY | O_NOBUF)) < 0)
+  801a77:	83 ec 08             	sub    $0x8,%esp
+  801a7a:	68 00 10 00 00       	push   $0x1000
+  801a7f:	ff 75 08             	push   0x8(%ebp)
+  801a82:	e8 b3 07 00 00       	call   80223a <open>
+  801a87:	89 c3                	mov    %eax,%ebx
+  801a89:	83 c4 10             	add    $0x10,%esp
+  801a8c:	85 c0                	test   %eax,%eax
+  801a8e:	78 1b                	js     801aab <stat+0x39>
+		return fd;
+	r = fstat(fd, stat);
+  801a90:	83 ec 08             	sub    $0x8,%esp
+  801a93:	ff 75 0c             	push   0xc(%ebp)
+  801a96:	50                   	push   %eax
+  801a97:	e8 61 ff ff ff       	call   8019fd <fstat>
+  801a9c:	89 c6                	mov    %eax,%esi
+	close(fd);
+  801a9e:	89 1c 24             	mov    %ebx,(%esp)
+  801aa1:	e8 a2 fb ff ff       	call   801648 <close>
+	return r;
+  801aa6:	83 c4 10             	add    $0x10,%esp
+  801aa9:	89 f3                	mov    %esi,%ebx
+}
+  801aab:	89 d8                	mov    %ebx,%eax
+  801aad:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801ab0:	5b                   	pop    %ebx
+  801ab1:	5e                   	pop    %esi
+  801ab2:	5d                   	pop    %ebp
+  801ab3:	c3                   	ret
+
+00801ab4 <fsipc_pages>:
+// need not be copied through fsipcbuf.  n must fit in FSBULK_MAXPAGES
+// pages.
+// Returns result from the file server.
+static int
+fsipc_pages(unsigned type, const void *buf, size_t n, int perm)
+{
+  801ab4:	55                   	push   %ebp
+  801ab5:	89 e5                	mov    %esp,%ebp
+  801ab7:	57                   	push   %edi
+  801ab8:	56                   	push   %esi
+  801ab9:	53                   	push   %ebx
+  801aba:	81 ec 2c 01 00 00    	sub    $0x12c,%esp
+  801ac0:	89 85 d4 fe ff ff    	mov    %eax,-0x12c(%ebp)
+  801ac6:	89 d6                	mov    %edx,%esi
+  801ac8:	89 8d d0 fe ff ff    	mov    %ecx,-0x130(%ebp)
+  801ace:	8b 7d 08             	mov    0x8(%ebp),%edi
+	uintptr_t pages[1 + FSBULK_MAXPAGES];
+	uintptr_t va, start = ROUNDDOWN((uintptr_t) buf, PGSIZE);
+  801ad1:	89 d3                	mov    %edx,%ebx
+  801ad3:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+	int npages;
+
+	if (fsenv == 0)
+  801ad9:	83 3d c8 90 81 00 00 	cmpl   $0x0,0x8190c8
+  801ae0:	74 1d                	je     801aff <fsipc_pages+0x4b>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+
+	pages[0] = (uintptr_t) &fsipcbuf | PTE_P | PTE_W | PTE_U;
+  801ae2:	b8 00 80 81 00       	mov    $0x818000,%eax
+  801ae7:	83 c8 07             	or     $0x7,%eax
+  801aea:	89 85 e4 fe ff ff    	mov    %eax,-0x11c(%ebp)
+	npages = 1;
+  801af0:	b8 01 00 00 00       	mov    $0x1,%eax
+	for (va = start; va < (uintptr_t) buf + n; va += PGSIZE)
+  801af5:	8b 8d d0 fe ff ff    	mov    -0x130(%ebp),%ecx
+  801afb:	01 ce                	add    %ecx,%esi
+  801afd:	eb 28                	jmp    801b27 <fsipc_pages+0x73>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801aff:	83 ec 0c             	sub    $0xc,%esp
+  801b02:	6a 01                	push   $0x1
+  801b04:	e8 0c 1e 00 00       	call   803915 <ipc_find_env>
+  801b09:	a3 c8 90 81 00       	mov    %eax,0x8190c8
+  801b0e:	83 c4 10             	add    $0x10,%esp
+  801b11:	eb cf                	jmp    801ae2 <fsipc_pages+0x2e>
+		pages[npages++] = va | perm;
+  801b13:	83 c0 01             	add    $0x1,%eax
+  801b16:	89 fa                	mov    %edi,%edx
+  801b18:	09 da                	or     %ebx,%edx
+  801b1a:	89 94 85 e0 fe ff ff 	mov    %edx,-0x120(%ebp,%eax,4)
+	for (va = start; va < (uintptr_t) buf + n; va += PGSIZE)
+  801b21:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801b27:	39 f3                	cmp    %esi,%ebx
+  801b29:	72 e8                	jb     801b13 <fsipc_pages+0x5f>
+	assert(npages <= ARRAY_SIZE(pages));
+  801b2b:	83 f8 41             	cmp    $0x41,%eax
+  801b2e:	77 2f                	ja     801b5f <fsipc_pages+0xab>
+
+	if (debug)
+		cprintf("[%08x] fsipc_pages %d %08x %d pages\n",
+			thisenv->env_id, type, buf, npages - 1);
+
+	ipc_sendv(fsenv, type, pages, npages);
+  801b30:	50                   	push   %eax
+  801b31:	8d 85 e4 fe ff ff    	lea    -0x11c(%ebp),%eax
+  801b37:	50                   	push   %eax
+  801b38:	ff b5 d4 fe ff ff    	push   -0x12c(%ebp)
+  801b3e:	ff 35 c8 90 81 00    	push   0x8190c8
+  801b44:	e8 7e 1d 00 00       	call   8038c7 <ipc_sendv>
+	return ipc_recv(NULL, NULL, NULL);
+  801b49:	83 c4 0c             	add    $0xc,%esp
+  801b4c:	6a 00                	push   $0x0
+  801b4e:	6a 00                	push   $0x0
+  801b50:	6a 00                	push   $0x0
+  801b52:	e8 1a 1c 00 00       	call   803771 <ipc_recv>
+}
+  801b57:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801b5a:	5b                   	pop    %ebx
+  801b5b:	5e                   	pop    %esi
+  801b5c:	5f                   	pop    %edi
+  801b5d:	5d                   	pop    %ebp
+  801b5e:	c3                   	ret
+	assert(npages <= ARRAY_SIZE(pages));
+  801b5f:	68 c4 42 80 00       	push   $0x8042c4
+  801b64:	68 e0 42 80 00       	push   $0x8042e0
+  801b69:	6a 40                	push   $0x40
+  801b6b:	68 f5 42 80 00       	push   $0x8042f5
+  801b70:	e8 56 ea ff ff       	call   8005cb <_panic>
+
+00801b75 <fsring_post>:
+
+// Post a request of the given type for n bytes at 'offset' of fdnum,
+// with data page 'slot' already filled in as needed.
+static int
+fsring_post(uint32_t type, struct Fd *fd, off_t offset, size_t n, int slot)
+{
+  801b75:	55                   	push   %ebp
+  801b76:	89 e5                	mov    %esp,%ebp
+  801b78:	57                   	push   %edi
+  801b79:	56                   	push   %esi
+  801b7a:	53                   	push   %ebx
+  801b7b:	83 ec 1c             	sub    $0x1c,%esp
+  801b7e:	89 c3                	mov    %eax,%ebx
+  801b80:	89 d6                	mov    %edx,%esi
+  801b82:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+	struct Fsring_sqe *sqe;
+	uint32_t tail = fsring->r_sqtail;
+  801b85:	8b 0d 04 00 00 cf    	mov    0xcf000004,%ecx
+
+	sqe = &fsring->r_sq[tail % FSRING_NSLOTS];
+  801b8b:	89 ca                	mov    %ecx,%edx
+  801b8d:	83 e2 0f             	and    $0xf,%edx
+	sqe->sqe_type = type;
+  801b90:	8d 04 95 00 00 00 00 	lea    0x0(,%edx,4),%eax
+  801b97:	8d 3c 10             	lea    (%eax,%edx,1),%edi
+  801b9a:	89 1c bd 10 00 00 cf 	mov    %ebx,-0x30fffff0(,%edi,4)
+	sqe->sqe_fileid = fd->fd_file.id;
+  801ba1:	8b 76 0c             	mov    0xc(%esi),%esi
+  801ba4:	89 fb                	mov    %edi,%ebx
+  801ba6:	89 34 bd 14 00 00 cf 	mov    %esi,-0x30ffffec(,%edi,4)
+	sqe->sqe_offset = offset;
+  801bad:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801bb0:	89 3c 9d 18 00 00 cf 	mov    %edi,-0x30ffffe8(,%ebx,4)
+	sqe->sqe_n = n;
+  801bb7:	8b 75 08             	mov    0x8(%ebp),%esi
+  801bba:	89 34 9d 1c 00 00 cf 	mov    %esi,-0x30ffffe4(,%ebx,4)
+	sqe->sqe_slot = slot;
+  801bc1:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801bc4:	89 14 9d 20 00 00 cf 	mov    %edx,-0x30ffffe0(,%ebx,4)
+	// waking when the ring was empty before this request.  The kick
+	// gets no reply, and the server does not look at its request page.
+	// Publishing the tail with xchg, a full barrier, keeps the load of
+	// r_sqhead below from passing it; serve_ring_kick does the same the
+	// other way around, so one of the two sees the other's update.
+	xchg(&fsring->r_sqtail, tail + 1);
+  801bcb:	8d 41 01             	lea    0x1(%ecx),%eax
+xchg(volatile uint32_t *addr, uint32_t newval)
+{
+	uint32_t result;
+
+	// The + in "+m" denotes a read-modify-write operand.
+	asm volatile("lock; xchgl %0, %1"
+  801bce:	f0 87 05 04 00 00 cf 	lock xchg %eax,0xcf000004
+	if (fsring->r_sqhead == tail)
+  801bd5:	a1 00 00 00 cf       	mov    0xcf000000,%eax
+  801bda:	39 c8                	cmp    %ecx,%eax
+  801bdc:	74 0d                	je     801beb <fsring_post+0x76>
+		ipc_send(fsenv, FSREQ_RING_KICK, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+	return 0;
+}
+  801bde:	b8 00 00 00 00       	mov    $0x0,%eax
+  801be3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801be6:	5b                   	pop    %ebx
+  801be7:	5e                   	pop    %esi
+  801be8:	5f                   	pop    %edi
+  801be9:	5d                   	pop    %ebp
+  801bea:	c3                   	ret
+		ipc_send(fsenv, FSREQ_RING_KICK, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801beb:	6a 07                	push   $0x7
+  801bed:	68 00 80 81 00       	push   $0x818000
+  801bf2:	6a 0d                	push   $0xd
+  801bf4:	ff 35 c8 90 81 00    	push   0x8190c8
+  801bfa:	e8 dd 1b 00 00       	call   8037dc <ipc_send>
+  801bff:	83 c4 10             	add    $0x10,%esp
+  801c02:	eb da                	jmp    801bde <fsring_post+0x69>
+
+00801c04 <fsipcv>:
+{
+  801c04:	55                   	push   %ebp
+  801c05:	89 e5                	mov    %esp,%ebp
+  801c07:	57                   	push   %edi
+  801c08:	56                   	push   %esi
+  801c09:	53                   	push   %ebx
+  801c0a:	83 ec 0c             	sub    $0xc,%esp
+  801c0d:	89 c7                	mov    %eax,%edi
+  801c0f:	89 d3                	mov    %edx,%ebx
+  801c11:	89 ce                	mov    %ecx,%esi
+	if (fsenv == 0)
+  801c13:	83 3d c8 90 81 00 00 	cmpl   $0x0,0x8190c8
+  801c1a:	74 26                	je     801c42 <fsipcv+0x3e>
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801c1c:	6a 07                	push   $0x7
+  801c1e:	68 00 80 81 00       	push   $0x818000
+  801c23:	57                   	push   %edi
+  801c24:	ff 35 c8 90 81 00    	push   0x8190c8
+  801c2a:	e8 ad 1b 00 00       	call   8037dc <ipc_send>
+	return ipc_recvv(NULL, dstva, npages, NULL);
+  801c2f:	6a 00                	push   $0x0
+  801c31:	56                   	push   %esi
+  801c32:	53                   	push   %ebx
+  801c33:	6a 00                	push   $0x0
+  801c35:	e8 fa 1b 00 00       	call   803834 <ipc_recvv>
+}
+  801c3a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801c3d:	5b                   	pop    %ebx
+  801c3e:	5e                   	pop    %esi
+  801c3f:	5f                   	pop    %edi
+  801c40:	5d                   	pop    %ebp
+  801c41:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801c42:	83 ec 0c             	sub    $0xc,%esp
+  801c45:	6a 01                	push   $0x1
+  801c47:	e8 c9 1c 00 00       	call   803915 <ipc_find_env>
+  801c4c:	a3 c8 90 81 00       	mov    %eax,0x8190c8
+  801c51:	83 c4 10             	add    $0x10,%esp
+  801c54:	eb c6                	jmp    801c1c <fsipcv+0x18>
+
+00801c56 <fsipc>:
+{
+  801c56:	55                   	push   %ebp
+  801c57:	89 e5                	mov    %esp,%ebp
+  801c59:	83 ec 18             	sub    $0x18,%esp
+	int npages = 1;
+  801c5c:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+	return fsipcv(type, dstva, &npages);
+  801c63:	8d 4d f4             	lea    -0xc(%ebp),%ecx
+  801c66:	e8 99 ff ff ff       	call   801c04 <fsipcv>
+}
+  801c6b:	c9                   	leave
+  801c6c:	c3                   	ret
+
+00801c6d <file_write_direct>:
+{
+  801c6d:	55                   	push   %ebp
+  801c6e:	89 e5                	mov    %esp,%ebp
+  801c70:	56                   	push   %esi
+  801c71:	53                   	push   %ebx
+  801c72:	89 c3                	mov    %eax,%ebx
+  801c74:	89 c8                	mov    %ecx,%eax
+	if (n > sizeof(fsipcbuf.write.req_buf)) {
+  801c76:	81 f9 f8 0f 00 00    	cmp    $0xff8,%ecx
+  801c7c:	77 40                	ja     801cbe <file_write_direct+0x51>
+	n = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  801c7e:	b9 f8 0f 00 00       	mov    $0xff8,%ecx
+  801c83:	39 c8                	cmp    %ecx,%eax
+  801c85:	0f 47 c1             	cmova  %ecx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801c88:	8b 4b 0c             	mov    0xc(%ebx),%ecx
+  801c8b:	89 0d 00 80 81 00    	mov    %ecx,0x818000
+	fsipcbuf.write.req_n = n;
+  801c91:	a3 04 80 81 00       	mov    %eax,0x818004
+	memmove(fsipcbuf.write.req_buf, buf, n);
+  801c96:	83 ec 04             	sub    $0x4,%esp
+  801c99:	50                   	push   %eax
+  801c9a:	52                   	push   %edx
+  801c9b:	68 08 80 81 00       	push   $0x818008
+  801ca0:	e8 75 f1 ff ff       	call   800e1a <memmove>
+	return fsipc(FSREQ_WRITE, NULL);
+  801ca5:	ba 00 00 00 00       	mov    $0x0,%edx
+  801caa:	b8 04 00 00 00       	mov    $0x4,%eax
+  801caf:	e8 a2 ff ff ff       	call   801c56 <fsipc>
+  801cb4:	83 c4 10             	add    $0x10,%esp
+}
+  801cb7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801cba:	5b                   	pop    %ebx
+  801cbb:	5e                   	pop    %esi
+  801cbc:	5d                   	pop    %ebp
+  801cbd:	c3                   	ret
+		n = MIN(n, FSBULK_MAXPAGES * PGSIZE - PGOFF(buf));
+  801cbe:	89 d6                	mov    %edx,%esi
+  801cc0:	81 e6 ff 0f 00 00    	and    $0xfff,%esi
+  801cc6:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  801ccb:	29 f1                	sub    %esi,%ecx
+  801ccd:	39 c1                	cmp    %eax,%ecx
+  801ccf:	0f 47 c8             	cmova  %eax,%ecx
+	fsipcbuf.bulk.req_fileid = fileid;
+  801cd2:	8b 43 0c             	mov    0xc(%ebx),%eax
+  801cd5:	a3 00 80 81 00       	mov    %eax,0x818000
+	fsipcbuf.bulk.req_n = n;
+  801cda:	89 0d 04 80 81 00    	mov    %ecx,0x818004
+	fsipcbuf.bulk.req_off = PGOFF(buf);
+  801ce0:	89 35 08 80 81 00    	mov    %esi,0x818008
+	return fsipc_pages(type, buf, n, perm);
+  801ce6:	83 ec 0c             	sub    $0xc,%esp
+  801ce9:	6a 05                	push   $0x5
+  801ceb:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801cf0:	e8 bf fd ff ff       	call   801ab4 <fsipc_pages>
+		return fsipc_bulk(FSREQ_WRITE_BULK, fd->fd_file.id, buf, n,
+  801cf5:	83 c4 10             	add    $0x10,%esp
+  801cf8:	eb bd                	jmp    801cb7 <file_write_direct+0x4a>
+
+00801cfa <devfile_sync>:
+{
+  801cfa:	55                   	push   %ebp
+  801cfb:	89 e5                	mov    %esp,%ebp
+  801cfd:	57                   	push   %edi
+  801cfe:	56                   	push   %esi
+  801cff:	53                   	push   %ebx
+  801d00:	83 ec 28             	sub    $0x28,%esp
+  801d03:	8b 75 08             	mov    0x8(%ebp),%esi
+	char *p = fd2data(fd);
+  801d06:	56                   	push   %esi
+  801d07:	e8 a5 f7 ff ff       	call   8014b1 <fd2data>
+  801d0c:	89 c7                	mov    %eax,%edi
+	off_t pos = fd->fd_offset;
+  801d0e:	8b 4e 04             	mov    0x4(%esi),%ecx
+	ff->buf_rlen = 0;
+  801d11:	c7 46 18 00 00 00 00 	movl   $0x0,0x18(%esi)
+	if (ff->buf_wlen == 0)
+  801d18:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  801d1b:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (ff->buf_wlen == 0)
+  801d20:	83 7e 1c 00          	cmpl   $0x0,0x1c(%esi)
+  801d24:	74 45                	je     801d6b <devfile_sync+0x71>
+	fd->fd_offset = ff->buf_base;
+  801d26:	8b 46 14             	mov    0x14(%esi),%eax
+  801d29:	89 46 04             	mov    %eax,0x4(%esi)
+	for (done = 0, r = 0; done < ff->buf_wlen; done += r)
+  801d2c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d31:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801d36:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  801d39:	8b 4e 1c             	mov    0x1c(%esi),%ecx
+  801d3c:	39 cb                	cmp    %ecx,%ebx
+  801d3e:	73 14                	jae    801d54 <devfile_sync+0x5a>
+		if ((r = file_write_direct(fd, p + done, ff->buf_wlen - done)) <= 0)
+  801d40:	29 d9                	sub    %ebx,%ecx
+  801d42:	8d 14 1f             	lea    (%edi,%ebx,1),%edx
+  801d45:	89 f0                	mov    %esi,%eax
+  801d47:	e8 21 ff ff ff       	call   801c6d <file_write_direct>
+  801d4c:	85 c0                	test   %eax,%eax
+  801d4e:	7e 04                	jle    801d54 <devfile_sync+0x5a>
+	for (done = 0, r = 0; done < ff->buf_wlen; done += r)
+  801d50:	01 c3                	add    %eax,%ebx
+  801d52:	eb e5                	jmp    801d39 <devfile_sync+0x3f>
+	ff->buf_wlen = 0;
+  801d54:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  801d57:	c7 46 1c 00 00 00 00 	movl   $0x0,0x1c(%esi)
+	fd->fd_offset = pos;
+  801d5e:	89 4e 04             	mov    %ecx,0x4(%esi)
+	return r < 0 ? r : 0;
+  801d61:	85 c0                	test   %eax,%eax
+  801d63:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d68:	0f 4f c2             	cmovg  %edx,%eax
+}
+  801d6b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801d6e:	5b                   	pop    %ebx
+  801d6f:	5e                   	pop    %esi
+  801d70:	5f                   	pop    %edi
+  801d71:	5d                   	pop    %ebp
+  801d72:	c3                   	ret
+
+00801d73 <devfile_write>:
+{
+  801d73:	55                   	push   %ebp
+  801d74:	89 e5                	mov    %esp,%ebp
+  801d76:	57                   	push   %edi
+  801d77:	56                   	push   %esi
+  801d78:	53                   	push   %ebx
+  801d79:	83 ec 28             	sub    $0x28,%esp
+  801d7c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801d7f:	8b 75 10             	mov    0x10(%ebp),%esi
+	char *p = fd2data(fd);
+  801d82:	53                   	push   %ebx
+  801d83:	e8 29 f7 ff ff       	call   8014b1 <fd2data>
+  801d88:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	off_t pos = fd->fd_offset;
+  801d8b:	8b 7b 04             	mov    0x4(%ebx),%edi
+	if (!ff->buffered)
+  801d8e:	83 c4 10             	add    $0x10,%esp
+  801d91:	80 7b 10 00          	cmpb   $0x0,0x10(%ebx)
+  801d95:	74 43                	je     801dda <devfile_write+0x67>
+	ff->buf_rlen = 0;
+  801d97:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+	if (ff->buf_wlen > 0
+  801d9e:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  801da1:	85 c0                	test   %eax,%eax
+  801da3:	74 43                	je     801de8 <devfile_write+0x75>
+	    && (pos != ff->buf_base + ff->buf_wlen
+  801da5:	89 c2                	mov    %eax,%edx
+  801da7:	03 53 14             	add    0x14(%ebx),%edx
+  801daa:	39 fa                	cmp    %edi,%edx
+  801dac:	75 0b                	jne    801db9 <devfile_write+0x46>
+		|| ff->buf_wlen + n > FILEBUF_SIZE)
+  801dae:	8d 14 30             	lea    (%eax,%esi,1),%edx
+  801db1:	81 fa 00 10 00 00    	cmp    $0x1000,%edx
+  801db7:	76 66                	jbe    801e1f <devfile_write+0xac>
+	    && (r = devfile_sync(fd)) < 0)
+  801db9:	83 ec 0c             	sub    $0xc,%esp
+  801dbc:	53                   	push   %ebx
+  801dbd:	e8 38 ff ff ff       	call   801cfa <devfile_sync>
+  801dc2:	83 c4 10             	add    $0x10,%esp
+  801dc5:	85 c0                	test   %eax,%eax
+  801dc7:	78 4e                	js     801e17 <devfile_write+0xa4>
+	if (n >= FILEBUF_SIZE)
+  801dc9:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  801dcf:	77 56                	ja     801e27 <devfile_write+0xb4>
+	if (ff->buf_wlen == 0)
+  801dd1:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  801dd4:	85 c0                	test   %eax,%eax
+  801dd6:	75 20                	jne    801df8 <devfile_write+0x85>
+  801dd8:	eb 16                	jmp    801df0 <devfile_write+0x7d>
+		return file_write_direct(fd, buf, n);
+  801dda:	89 f1                	mov    %esi,%ecx
+  801ddc:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801ddf:	89 d8                	mov    %ebx,%eax
+  801de1:	e8 87 fe ff ff       	call   801c6d <file_write_direct>
+  801de6:	eb 2f                	jmp    801e17 <devfile_write+0xa4>
+	if (n >= FILEBUF_SIZE)
+  801de8:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  801dee:	77 37                	ja     801e27 <devfile_write+0xb4>
+		ff->buf_base = pos;
+  801df0:	89 7b 14             	mov    %edi,0x14(%ebx)
+  801df3:	b8 00 00 00 00       	mov    $0x0,%eax
+	memmove(p + ff->buf_wlen, buf, n);
+  801df8:	83 ec 04             	sub    $0x4,%esp
+  801dfb:	56                   	push   %esi
+  801dfc:	ff 75 0c             	push   0xc(%ebp)
+  801dff:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  801e02:	01 c1                	add    %eax,%ecx
+  801e04:	51                   	push   %ecx
+  801e05:	e8 10 f0 ff ff       	call   800e1a <memmove>
+	ff->buf_wlen += n;
+  801e0a:	01 73 1c             	add    %esi,0x1c(%ebx)
+	fd->fd_offset = pos + n;
+  801e0d:	01 f7                	add    %esi,%edi
+  801e0f:	89 7b 04             	mov    %edi,0x4(%ebx)
+	return n;
+  801e12:	89 f0                	mov    %esi,%eax
+  801e14:	83 c4 10             	add    $0x10,%esp
+}
+  801e17:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801e1a:	5b                   	pop    %ebx
+  801e1b:	5e                   	pop    %esi
+  801e1c:	5f                   	pop    %edi
+  801e1d:	5d                   	pop    %ebp
+  801e1e:	c3                   	ret
+	if (n >= FILEBUF_SIZE)
+  801e1f:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  801e25:	76 d1                	jbe    801df8 <devfile_write+0x85>
+		return file_write_direct(fd, buf, n);
+  801e27:	89 f1                	mov    %esi,%ecx
+  801e29:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801e2c:	89 d8                	mov    %ebx,%eax
+  801e2e:	e8 3a fe ff ff       	call   801c6d <file_write_direct>
+  801e33:	eb e2                	jmp    801e17 <devfile_write+0xa4>
+
+00801e35 <devfile_trunc>:
+{
+  801e35:	55                   	push   %ebp
+  801e36:	89 e5                	mov    %esp,%ebp
+  801e38:	53                   	push   %ebx
+  801e39:	83 ec 10             	sub    $0x10,%esp
+  801e3c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if ((r = devfile_sync(fd)) < 0)
+  801e3f:	53                   	push   %ebx
+  801e40:	e8 b5 fe ff ff       	call   801cfa <devfile_sync>
+  801e45:	83 c4 10             	add    $0x10,%esp
+  801e48:	85 c0                	test   %eax,%eax
+  801e4a:	78 1f                	js     801e6b <devfile_trunc+0x36>
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801e4c:	8b 43 0c             	mov    0xc(%ebx),%eax
+  801e4f:	a3 00 80 81 00       	mov    %eax,0x818000
+	fsipcbuf.set_size.req_size = newsize;
+  801e54:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801e57:	a3 04 80 81 00       	mov    %eax,0x818004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  801e5c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e61:	b8 02 00 00 00       	mov    $0x2,%eax
+  801e66:	e8 eb fd ff ff       	call   801c56 <fsipc>
+}
+  801e6b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801e6e:	c9                   	leave
+  801e6f:	c3                   	ret
+
+00801e70 <devfile_stat>:
+{
+  801e70:	55                   	push   %ebp
+  801e71:	89 e5                	mov    %esp,%ebp
+  801e73:	56                   	push   %esi
+  801e74:	53                   	push   %ebx
+  801e75:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801e78:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if ((r = devfile_sync(fd)) < 0)
+  801e7b:	83 ec 0c             	sub    $0xc,%esp
+  801e7e:	53                   	push   %ebx
+  801e7f:	e8 76 fe ff ff       	call   801cfa <devfile_sync>
+  801e84:	83 c4 10             	add    $0x10,%esp
+  801e87:	85 c0                	test   %eax,%eax
+  801e89:	78 47                	js     801ed2 <devfile_stat+0x62>
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801e8b:	8b 43 0c             	mov    0xc(%ebx),%eax
+  801e8e:	a3 00 80 81 00       	mov    %eax,0x818000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  801e93:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e98:	b8 05 00 00 00       	mov    $0x5,%eax
+  801e9d:	e8 b4 fd ff ff       	call   801c56 <fsipc>
+  801ea2:	85 c0                	test   %eax,%eax
+  801ea4:	78 2c                	js     801ed2 <devfile_stat+0x62>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801ea6:	83 ec 08             	sub    $0x8,%esp
+  801ea9:	68 00 80 81 00       	push   $0x818000
+  801eae:	56                   	push   %esi
+  801eaf:	e8 e0 ed ff ff       	call   800c94 <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  801eb4:	a1 80 80 81 00       	mov    0x818080,%eax
+  801eb9:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801ebf:	a1 84 80 81 00       	mov    0x818084,%eax
+  801ec4:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+	return 0;
+  801eca:	83 c4 10             	add    $0x10,%esp
+  801ecd:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801ed2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801ed5:	5b                   	pop    %ebx
+  801ed6:	5e                   	pop    %esi
+  801ed7:	5d                   	pop    %ebp
+  801ed8:	c3                   	ret
+
+00801ed9 <devfile_flush>:
+{
+  801ed9:	55                   	push   %ebp
+  801eda:	89 e5                	mov    %esp,%ebp
+  801edc:	56                   	push   %esi
+  801edd:	53                   	push   %ebx
+  801ede:	8b 75 08             	mov    0x8(%ebp),%esi
+	r = devfile_sync(fd);
+  801ee1:	83 ec 0c             	sub    $0xc,%esp
+  801ee4:	56                   	push   %esi
+  801ee5:	e8 10 fe ff ff       	call   801cfa <devfile_sync>
+  801eea:	89 c3                	mov    %eax,%ebx
+	if (fd->fd_file.buffered)
+  801eec:	83 c4 10             	add    $0x10,%esp
+  801eef:	80 7e 10 00          	cmpb   $0x0,0x10(%esi)
+  801ef3:	75 25                	jne    801f1a <devfile_flush+0x41>
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801ef5:	8b 46 0c             	mov    0xc(%esi),%eax
+  801ef8:	a3 00 80 81 00       	mov    %eax,0x818000
+	return fsipc(FSREQ_FLUSH, NULL) ?: r;
+  801efd:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f02:	b8 06 00 00 00       	mov    $0x6,%eax
+  801f07:	e8 4a fd ff ff       	call   801c56 <fsipc>
+  801f0c:	85 c0                	test   %eax,%eax
+  801f0e:	0f 45 d8             	cmovne %eax,%ebx
+}
+  801f11:	89 d8                	mov    %ebx,%eax
+  801f13:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801f16:	5b                   	pop    %ebx
+  801f17:	5e                   	pop    %esi
+  801f18:	5d                   	pop    %ebp
+  801f19:	c3                   	ret
+		sys_page_unmap(0, fd2data(fd));
+  801f1a:	83 ec 0c             	sub    $0xc,%esp
+  801f1d:	56                   	push   %esi
+  801f1e:	e8 8e f5 ff ff       	call   8014b1 <fd2data>
+  801f23:	83 c4 08             	add    $0x8,%esp
+  801f26:	50                   	push   %eax
+  801f27:	6a 00                	push   $0x0
+  801f29:	e8 ff f1 ff ff       	call   80112d <sys_page_unmap>
+  801f2e:	83 c4 10             	add    $0x10,%esp
+  801f31:	eb c2                	jmp    801ef5 <devfile_flush+0x1c>
+
+00801f33 <fsring_slot>:
+
+// Find a free data page and get fdnum ready for a request on it.
+// Returns the slot number, or < 0 on error.
+static int
+fsring_slot(int fdnum, struct Fd **fd_store)
+{
+  801f33:	55                   	push   %ebp
+  801f34:	89 e5                	mov    %esp,%ebp
+  801f36:	57                   	push   %edi
+  801f37:	56                   	push   %esi
+  801f38:	53                   	push   %ebx
+  801f39:	83 ec 64             	sub    $0x64,%esp
+  801f3c:	89 d7                	mov    %edx,%edi
+	int r, slot;
+
+	if ((r = fd_lookup(fdnum, fd_store)) < 0)
+  801f3e:	52                   	push   %edx
+  801f3f:	50                   	push   %eax
+  801f40:	e8 d9 f5 ff ff       	call   80151e <fd_lookup>
+  801f45:	89 c1                	mov    %eax,%ecx
+  801f47:	83 c4 10             	add    $0x10,%esp
+  801f4a:	85 c0                	test   %eax,%eax
+  801f4c:	0f 88 f2 00 00 00    	js     802044 <fsring_slot+0x111>
+		return r;
+	if ((*fd_store)->fd_dev_id != devfile.dev_id)
+  801f52:	8b 07                	mov    (%edi),%eax
+  801f54:	8b 15 20 50 80 00    	mov    0x805020,%edx
+  801f5a:	39 10                	cmp    %edx,(%eax)
+  801f5c:	0f 85 03 01 00 00    	jne    802065 <fsring_slot+0x132>
+	if (fsring_env == thisenv->env_id)
+  801f62:	a1 c0 78 81 00       	mov    0x8178c0,%eax
+  801f67:	8b 40 48             	mov    0x48(%eax),%eax
+  801f6a:	3b 05 c4 90 81 00    	cmp    0x8190c4,%eax
+  801f70:	0f 84 96 00 00 00    	je     80200c <fsring_slot+0xd9>
+	if (fsenv == 0)
+  801f76:	83 3d c8 90 81 00 00 	cmpl   $0x0,0x8190c8
+  801f7d:	0f 84 cb 00 00 00    	je     80204e <fsring_slot+0x11b>
+	pages[0] = (uintptr_t) &fsipcbuf | PTE_P | PTE_W | PTE_U;
+  801f83:	b8 00 80 81 00       	mov    $0x818000,%eax
+  801f88:	83 c8 07             	or     $0x7,%eax
+  801f8b:	89 45 a0             	mov    %eax,-0x60(%ebp)
+	for (i = 0; i < FSRING_NPAGES; i++) {
+  801f8e:	8d 75 a4             	lea    -0x5c(%ebp),%esi
+	pages[0] = (uintptr_t) &fsipcbuf | PTE_P | PTE_W | PTE_U;
+  801f91:	bb 00 00 00 cf       	mov    $0xcf000000,%ebx
+		if ((r = sys_page_alloc(0, (char *) fsring + i * PGSIZE,
+  801f96:	83 ec 04             	sub    $0x4,%esp
+  801f99:	68 07 04 00 00       	push   $0x407
+  801f9e:	53                   	push   %ebx
+  801f9f:	6a 00                	push   $0x0
+  801fa1:	e8 fa f0 ff ff       	call   8010a0 <sys_page_alloc>
+  801fa6:	89 c1                	mov    %eax,%ecx
+  801fa8:	83 c4 10             	add    $0x10,%esp
+  801fab:	85 c0                	test   %eax,%eax
+  801fad:	0f 88 91 00 00 00    	js     802044 <fsring_slot+0x111>
+		pages[1 + i] = ((uintptr_t) fsring + i * PGSIZE) | PTE_P | PTE_W | PTE_U;
+  801fb3:	89 d8                	mov    %ebx,%eax
+  801fb5:	83 c8 07             	or     $0x7,%eax
+  801fb8:	89 06                	mov    %eax,(%esi)
+	for (i = 0; i < FSRING_NPAGES; i++) {
+  801fba:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801fc0:	83 c6 04             	add    $0x4,%esi
+  801fc3:	81 fb 00 10 01 cf    	cmp    $0xcf011000,%ebx
+  801fc9:	75 cb                	jne    801f96 <fsring_slot+0x63>
+	ipc_sendv(fsenv, FSREQ_RING_SETUP, pages, ARRAY_SIZE(pages));
+  801fcb:	6a 12                	push   $0x12
+  801fcd:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  801fd0:	50                   	push   %eax
+  801fd1:	6a 0c                	push   $0xc
+  801fd3:	ff 35 c8 90 81 00    	push   0x8190c8
+  801fd9:	e8 e9 18 00 00       	call   8038c7 <ipc_sendv>
+	if ((r = ipc_recv(NULL, NULL, NULL)) < 0)
+  801fde:	83 c4 0c             	add    $0xc,%esp
+  801fe1:	6a 00                	push   $0x0
+  801fe3:	6a 00                	push   $0x0
+  801fe5:	6a 00                	push   $0x0
+  801fe7:	e8 85 17 00 00       	call   803771 <ipc_recv>
+  801fec:	89 c1                	mov    %eax,%ecx
+  801fee:	83 c4 10             	add    $0x10,%esp
+  801ff1:	85 c0                	test   %eax,%eax
+  801ff3:	78 4f                	js     802044 <fsring_slot+0x111>
+	fsring_env = thisenv->env_id;
+  801ff5:	a1 c0 78 81 00       	mov    0x8178c0,%eax
+  801ffa:	8b 40 48             	mov    0x48(%eax),%eax
+  801ffd:	a3 c4 90 81 00       	mov    %eax,0x8190c4
+	fsring_busy = 0;
+  802002:	c7 05 c0 90 81 00 00 	movl   $0x0,0x8190c0
+  802009:	00 00 00 
+		return -E_NOT_SUPP;
+	if ((r = fsring_setup()) < 0)
+		return r;
+	// Buffered writes must reach the server ahead of anything posted.
+	if ((r = devfile_sync(*fd_store)) < 0)
+  80200c:	83 ec 0c             	sub    $0xc,%esp
+  80200f:	ff 37                	push   (%edi)
+  802011:	e8 e4 fc ff ff       	call   801cfa <devfile_sync>
+  802016:	89 c1                	mov    %eax,%ecx
+  802018:	83 c4 10             	add    $0x10,%esp
+  80201b:	85 c0                	test   %eax,%eax
+  80201d:	78 25                	js     802044 <fsring_slot+0x111>
+		return r;
+	for (slot = 0; slot < FSRING_NSLOTS; slot++)
+		if (!(fsring_busy & (1 << slot)))
+  80201f:	8b 1d c0 90 81 00    	mov    0x8190c0,%ebx
+	for (slot = 0; slot < FSRING_NSLOTS; slot++)
+  802025:	b9 00 00 00 00       	mov    $0x0,%ecx
+		if (!(fsring_busy & (1 << slot)))
+  80202a:	ba 01 00 00 00       	mov    $0x1,%edx
+  80202f:	89 d0                	mov    %edx,%eax
+  802031:	d3 e0                	shl    %cl,%eax
+  802033:	85 d8                	test   %ebx,%eax
+  802035:	74 0d                	je     802044 <fsring_slot+0x111>
+	for (slot = 0; slot < FSRING_NSLOTS; slot++)
+  802037:	83 c1 01             	add    $0x1,%ecx
+  80203a:	83 f9 10             	cmp    $0x10,%ecx
+  80203d:	75 f0                	jne    80202f <fsring_slot+0xfc>
+			return slot;
+	return -E_NO_MEM;
+  80203f:	b9 fc ff ff ff       	mov    $0xfffffffc,%ecx
+}
+  802044:	89 c8                	mov    %ecx,%eax
+  802046:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802049:	5b                   	pop    %ebx
+  80204a:	5e                   	pop    %esi
+  80204b:	5f                   	pop    %edi
+  80204c:	5d                   	pop    %ebp
+  80204d:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  80204e:	83 ec 0c             	sub    $0xc,%esp
+  802051:	6a 01                	push   $0x1
+  802053:	e8 bd 18 00 00       	call   803915 <ipc_find_env>
+  802058:	a3 c8 90 81 00       	mov    %eax,0x8190c8
+  80205d:	83 c4 10             	add    $0x10,%esp
+  802060:	e9 1e ff ff ff       	jmp    801f83 <fsring_slot+0x50>
+		return -E_NOT_SUPP;
+  802065:	b9 f1 ff ff ff       	mov    $0xfffffff1,%ecx
+  80206a:	eb d8                	jmp    802044 <fsring_slot+0x111>
+
+0080206c <file_read_direct>:
+{
+  80206c:	55                   	push   %ebp
+  80206d:	89 e5                	mov    %esp,%ebp
+  80206f:	57                   	push   %edi
+  802070:	56                   	push   %esi
+  802071:	53                   	push   %ebx
+  802072:	83 ec 1c             	sub    $0x1c,%esp
+  802075:	89 c7                	mov    %eax,%edi
+  802077:	89 d6                	mov    %edx,%esi
+  802079:	89 cb                	mov    %ecx,%ebx
+	if (n > PGSIZE) {
+  80207b:	81 f9 00 10 00 00    	cmp    $0x1000,%ecx
+  802081:	77 52                	ja     8020d5 <file_read_direct+0x69>
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802083:	8b 40 0c             	mov    0xc(%eax),%eax
+  802086:	a3 00 80 81 00       	mov    %eax,0x818000
+	fsipcbuf.read.req_n = n;
+  80208b:	89 0d 04 80 81 00    	mov    %ecx,0x818004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  802091:	ba 00 00 00 00       	mov    $0x0,%edx
+  802096:	b8 03 00 00 00       	mov    $0x3,%eax
+  80209b:	e8 b6 fb ff ff       	call   801c56 <fsipc>
+  8020a0:	89 c7                	mov    %eax,%edi
+  8020a2:	85 c0                	test   %eax,%eax
+  8020a4:	78 25                	js     8020cb <file_read_direct+0x5f>
+	assert(r <= n);
+  8020a6:	39 c3                	cmp    %eax,%ebx
+  8020a8:	0f 82 87 00 00 00    	jb     802135 <file_read_direct+0xc9>
+	assert(r <= PGSIZE);
+  8020ae:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  8020b3:	0f 8f 95 00 00 00    	jg     80214e <file_read_direct+0xe2>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  8020b9:	83 ec 04             	sub    $0x4,%esp
+  8020bc:	50                   	push   %eax
+  8020bd:	68 00 80 81 00       	push   $0x818000
+  8020c2:	56                   	push   %esi
+  8020c3:	e8 52 ed ff ff       	call   800e1a <memmove>
+	return r;
+  8020c8:	83 c4 10             	add    $0x10,%esp
+}
+  8020cb:	89 f8                	mov    %edi,%eax
+  8020cd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8020d0:	5b                   	pop    %ebx
+  8020d1:	5e                   	pop    %esi
+  8020d2:	5f                   	pop    %edi
+  8020d3:	5d                   	pop    %ebp
+  8020d4:	c3                   	ret
+		n = MIN(n, FSBULK_MAXPAGES * PGSIZE - PGOFF(buf));
+  8020d5:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  8020db:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  8020e0:	29 d1                	sub    %edx,%ecx
+  8020e2:	39 d9                	cmp    %ebx,%ecx
+  8020e4:	0f 46 d9             	cmovbe %ecx,%ebx
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  8020e7:	89 f0                	mov    %esi,%eax
+  8020e9:	8d 0c 1e             	lea    (%esi,%ebx,1),%ecx
+  8020ec:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  8020ef:	eb 0f                	jmp    802100 <file_read_direct+0x94>
+		*(volatile char *) p = *(volatile char *) p;
+  8020f1:	0f b6 10             	movzbl (%eax),%edx
+  8020f4:	88 10                	mov    %dl,(%eax)
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  8020f6:	05 00 10 00 00       	add    $0x1000,%eax
+  8020fb:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  802100:	39 c8                	cmp    %ecx,%eax
+  802102:	72 ed                	jb     8020f1 <file_read_direct+0x85>
+	fsipcbuf.bulk.req_fileid = fileid;
+  802104:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802107:	8b 47 0c             	mov    0xc(%edi),%eax
+  80210a:	a3 00 80 81 00       	mov    %eax,0x818000
+	fsipcbuf.bulk.req_n = n;
+  80210f:	89 1d 04 80 81 00    	mov    %ebx,0x818004
+	fsipcbuf.bulk.req_off = PGOFF(buf);
+  802115:	89 15 08 80 81 00    	mov    %edx,0x818008
+	return fsipc_pages(type, buf, n, perm);
+  80211b:	83 ec 0c             	sub    $0xc,%esp
+  80211e:	6a 07                	push   $0x7
+  802120:	89 d9                	mov    %ebx,%ecx
+  802122:	89 f2                	mov    %esi,%edx
+  802124:	b8 09 00 00 00       	mov    $0x9,%eax
+  802129:	e8 86 f9 ff ff       	call   801ab4 <fsipc_pages>
+  80212e:	89 c7                	mov    %eax,%edi
+		return fsipc_bulk(FSREQ_READ_BULK, fd->fd_file.id, buf, n,
+  802130:	83 c4 10             	add    $0x10,%esp
+  802133:	eb 96                	jmp    8020cb <file_read_direct+0x5f>
+	assert(r <= n);
+  802135:	68 00 43 80 00       	push   $0x804300
+  80213a:	68 e0 42 80 00       	push   $0x8042e0
+  80213f:	68 dc 00 00 00       	push   $0xdc
+  802144:	68 f5 42 80 00       	push   $0x8042f5
+  802149:	e8 7d e4 ff ff       	call   8005cb <_panic>
+	assert(r <= PGSIZE);
+  80214e:	68 11 43 80 00       	push   $0x804311
+  802153:	68 e0 42 80 00       	push   $0x8042e0
+  802158:	68 dd 00 00 00       	push   $0xdd
+  80215d:	68 f5 42 80 00       	push   $0x8042f5
+  802162:	e8 64 e4 ff ff       	call   8005cb <_panic>
+
+00802167 <devfile_read>:
+{
+  802167:	55                   	push   %ebp
+  802168:	89 e5                	mov    %esp,%ebp
+  80216a:	57                   	push   %edi
+  80216b:	56                   	push   %esi
+  80216c:	53                   	push   %ebx
+  80216d:	83 ec 28             	sub    $0x28,%esp
+  802170:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802173:	8b 75 10             	mov    0x10(%ebp),%esi
+	char *p = fd2data(fd);
+  802176:	53                   	push   %ebx
+  802177:	e8 35 f3 ff ff       	call   8014b1 <fd2data>
+  80217c:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	off_t pos = fd->fd_offset;
+  80217f:	8b 7b 04             	mov    0x4(%ebx),%edi
+	if (!ff->buffered)
+  802182:	83 c4 10             	add    $0x10,%esp
+  802185:	80 7b 10 00          	cmpb   $0x0,0x10(%ebx)
+  802189:	74 7d                	je     802208 <devfile_read+0xa1>
+	if (ff->buf_wlen > 0 && (r = devfile_sync(fd)) < 0)
+  80218b:	83 7b 1c 00          	cmpl   $0x0,0x1c(%ebx)
+  80218f:	0f 85 81 00 00 00    	jne    802216 <devfile_read+0xaf>
+	if (ff->buf_rlen == 0 || pos < ff->buf_base
+  802195:	8b 43 18             	mov    0x18(%ebx),%eax
+  802198:	85 c0                	test   %eax,%eax
+  80219a:	74 0d                	je     8021a9 <devfile_read+0x42>
+  80219c:	8b 53 14             	mov    0x14(%ebx),%edx
+  80219f:	39 fa                	cmp    %edi,%edx
+  8021a1:	7f 06                	jg     8021a9 <devfile_read+0x42>
+	    || pos >= ff->buf_base + ff->buf_rlen) {
+  8021a3:	01 c2                	add    %eax,%edx
+  8021a5:	39 d7                	cmp    %edx,%edi
+  8021a7:	72 28                	jb     8021d1 <devfile_read+0x6a>
+		ff->buf_rlen = 0;
+  8021a9:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+		if (n >= FILEBUF_SIZE)
+  8021b0:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  8021b6:	77 74                	ja     80222c <devfile_read+0xc5>
+		if ((r = file_read_direct(fd, p, FILEBUF_SIZE)) <= 0)
+  8021b8:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8021bd:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8021c0:	89 d8                	mov    %ebx,%eax
+  8021c2:	e8 a5 fe ff ff       	call   80206c <file_read_direct>
+  8021c7:	85 c0                	test   %eax,%eax
+  8021c9:	7e 35                	jle    802200 <devfile_read+0x99>
+		ff->buf_base = pos;
+  8021cb:	89 7b 14             	mov    %edi,0x14(%ebx)
+		ff->buf_rlen = r;
+  8021ce:	89 43 18             	mov    %eax,0x18(%ebx)
+	n = MIN(n, ff->buf_base + ff->buf_rlen - pos);
+  8021d1:	8b 53 14             	mov    0x14(%ebx),%edx
+  8021d4:	89 d0                	mov    %edx,%eax
+  8021d6:	03 43 18             	add    0x18(%ebx),%eax
+  8021d9:	29 f8                	sub    %edi,%eax
+  8021db:	39 f0                	cmp    %esi,%eax
+  8021dd:	0f 46 f0             	cmovbe %eax,%esi
+	memmove(buf, p + (pos - ff->buf_base), n);
+  8021e0:	83 ec 04             	sub    $0x4,%esp
+  8021e3:	56                   	push   %esi
+  8021e4:	89 f8                	mov    %edi,%eax
+  8021e6:	29 d0                	sub    %edx,%eax
+  8021e8:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8021eb:	01 c1                	add    %eax,%ecx
+  8021ed:	51                   	push   %ecx
+  8021ee:	ff 75 0c             	push   0xc(%ebp)
+  8021f1:	e8 24 ec ff ff       	call   800e1a <memmove>
+	fd->fd_offset = pos + n;
+  8021f6:	01 f7                	add    %esi,%edi
+  8021f8:	89 7b 04             	mov    %edi,0x4(%ebx)
+	return n;
+  8021fb:	89 f0                	mov    %esi,%eax
+  8021fd:	83 c4 10             	add    $0x10,%esp
+}
+  802200:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802203:	5b                   	pop    %ebx
+  802204:	5e                   	pop    %esi
+  802205:	5f                   	pop    %edi
+  802206:	5d                   	pop    %ebp
+  802207:	c3                   	ret
+		return file_read_direct(fd, buf, n);
+  802208:	89 f1                	mov    %esi,%ecx
+  80220a:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80220d:	89 d8                	mov    %ebx,%eax
+  80220f:	e8 58 fe ff ff       	call   80206c <file_read_direct>
+  802214:	eb ea                	jmp    802200 <devfile_read+0x99>
+	if (ff->buf_wlen > 0 && (r = devfile_sync(fd)) < 0)
+  802216:	83 ec 0c             	sub    $0xc,%esp
+  802219:	53                   	push   %ebx
+  80221a:	e8 db fa ff ff       	call   801cfa <devfile_sync>
+  80221f:	83 c4 10             	add    $0x10,%esp
+  802222:	85 c0                	test   %eax,%eax
+  802224:	0f 89 6b ff ff ff    	jns    802195 <devfile_read+0x2e>
+  80222a:	eb d4                	jmp    802200 <devfile_read+0x99>
+			return file_read_direct(fd, buf, n);
+  80222c:	89 f1                	mov    %esi,%ecx
+  80222e:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802231:	89 d8                	mov    %ebx,%eax
+  802233:	e8 34 fe ff ff       	call   80206c <file_read_direct>
+  802238:	eb c6                	jmp    802200 <devfile_read+0x99>
+
+0080223a <open>:
+{
+  80223a:	55                   	push   %ebp
+  80223b:	89 e5                	mov    %esp,%ebp
+  80223d:	56                   	push   %esi
+  80223e:	53                   	push   %ebx
+  80223f:	83 ec 1c             	sub    $0x1c,%esp
+  802242:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  802245:	56                   	push   %esi
+  802246:	e8 0e ea ff ff       	call   800c59 <strlen>
+  80224b:	83 c4 10             	add    $0x10,%esp
+  80224e:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802253:	0f 8f a0 00 00 00    	jg     8022f9 <open+0xbf>
+	if ((r = fd_alloc(&fd)) < 0)
+  802259:	83 ec 0c             	sub    $0xc,%esp
+  80225c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80225f:	50                   	push   %eax
+  802260:	e8 63 f2 ff ff       	call   8014c8 <fd_alloc>
+  802265:	89 c3                	mov    %eax,%ebx
+  802267:	83 c4 10             	add    $0x10,%esp
+  80226a:	85 c0                	test   %eax,%eax
+  80226c:	78 45                	js     8022b3 <open+0x79>
+	strcpy(fsipcbuf.open.req_path, path);
+  80226e:	83 ec 08             	sub    $0x8,%esp
+  802271:	56                   	push   %esi
+  802272:	68 00 80 81 00       	push   $0x818000
+  802277:	e8 18 ea ff ff       	call   800c94 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  80227c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80227f:	a3 00 84 81 00       	mov    %eax,0x818400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  802284:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802287:	b8 01 00 00 00       	mov    $0x1,%eax
+  80228c:	e8 c5 f9 ff ff       	call   801c56 <fsipc>
+  802291:	89 c3                	mov    %eax,%ebx
+  802293:	83 c4 10             	add    $0x10,%esp
+  802296:	85 c0                	test   %eax,%eax
+  802298:	78 22                	js     8022bc <open+0x82>
+	if (!(mode & O_NOBUF)
+  80229a:	f7 45 0c 00 10 00 00 	testl  $0x1000,0xc(%ebp)
+  8022a1:	74 2b                	je     8022ce <open+0x94>
+	return fd2num(fd);
+  8022a3:	83 ec 0c             	sub    $0xc,%esp
+  8022a6:	ff 75 f4             	push   -0xc(%ebp)
+  8022a9:	e8 f3 f1 ff ff       	call   8014a1 <fd2num>
+  8022ae:	89 c3                	mov    %eax,%ebx
+  8022b0:	83 c4 10             	add    $0x10,%esp
+}
+  8022b3:	89 d8                	mov    %ebx,%eax
+  8022b5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8022b8:	5b                   	pop    %ebx
+  8022b9:	5e                   	pop    %esi
+  8022ba:	5d                   	pop    %ebp
+  8022bb:	c3                   	ret
+		fd_close(fd, 0);
+  8022bc:	83 ec 08             	sub    $0x8,%esp
+  8022bf:	6a 00                	push   $0x0
+  8022c1:	ff 75 f4             	push   -0xc(%ebp)
+  8022c4:	e8 f8 f2 ff ff       	call   8015c1 <fd_close>
+		return r;
+  8022c9:	83 c4 10             	add    $0x10,%esp
+  8022cc:	eb e5                	jmp    8022b3 <open+0x79>
+	    && sys_page_alloc(0, fd2data(fd), PTE_P|PTE_U|PTE_W|PTE_SHARE) == 0)
+  8022ce:	83 ec 0c             	sub    $0xc,%esp
+  8022d1:	ff 75 f4             	push   -0xc(%ebp)
+  8022d4:	e8 d8 f1 ff ff       	call   8014b1 <fd2data>
+  8022d9:	83 c4 0c             	add    $0xc,%esp
+  8022dc:	68 07 04 00 00       	push   $0x407
+  8022e1:	50                   	push   %eax
+  8022e2:	6a 00                	push   $0x0
+  8022e4:	e8 b7 ed ff ff       	call   8010a0 <sys_page_alloc>
+  8022e9:	83 c4 10             	add    $0x10,%esp
+  8022ec:	85 c0                	test   %eax,%eax
+  8022ee:	75 b3                	jne    8022a3 <open+0x69>
+		fd->fd_file.buffered = 1;
+  8022f0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8022f3:	c6 40 10 01          	movb   $0x1,0x10(%eax)
+  8022f7:	eb aa                	jmp    8022a3 <open+0x69>
+		return -E_BAD_PATH;
+  8022f9:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  8022fe:	eb b3                	jmp    8022b3 <open+0x79>
+
+00802300 <readdir>:
+{
+  802300:	55                   	push   %ebp
+  802301:	89 e5                	mov    %esp,%ebp
+  802303:	53                   	push   %ebx
+  802304:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802307:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80230a:	50                   	push   %eax
+  80230b:	ff 75 08             	push   0x8(%ebp)
+  80230e:	e8 0b f2 ff ff       	call   80151e <fd_lookup>
+  802313:	89 c3                	mov    %eax,%ebx
+  802315:	83 c4 10             	add    $0x10,%esp
+  802318:	85 c0                	test   %eax,%eax
+  80231a:	78 73                	js     80238f <readdir+0x8f>
+	if (fd->fd_dev_id != devfile.dev_id)
+  80231c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80231f:	8b 0d 20 50 80 00    	mov    0x805020,%ecx
+  802325:	39 08                	cmp    %ecx,(%eax)
+  802327:	0f 85 82 00 00 00    	jne    8023af <readdir+0xaf>
+	if ((r = devfile_sync(fd)) < 0)
+  80232d:	83 ec 0c             	sub    $0xc,%esp
+  802330:	50                   	push   %eax
+  802331:	e8 c4 f9 ff ff       	call   801cfa <devfile_sync>
+  802336:	89 c3                	mov    %eax,%ebx
+  802338:	83 c4 10             	add    $0x10,%esp
+  80233b:	85 c0                	test   %eax,%eax
+  80233d:	78 50                	js     80238f <readdir+0x8f>
+	fsipcbuf.readdir.req_fileid = fd->fd_file.id;
+  80233f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802342:	8b 40 0c             	mov    0xc(%eax),%eax
+  802345:	a3 00 80 81 00       	mov    %eax,0x818000
+	fsipcbuf.readdir.req_n = n;
+  80234a:	8b 45 10             	mov    0x10(%ebp),%eax
+  80234d:	a3 04 80 81 00       	mov    %eax,0x818004
+	fsipcbuf.readdir.req_flags = flags;
+  802352:	8b 45 14             	mov    0x14(%ebp),%eax
+  802355:	a3 08 80 81 00       	mov    %eax,0x818008
+	if ((r = fsipc(FSREQ_READDIR, NULL)) <= 0)
+  80235a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80235f:	b8 0e 00 00 00       	mov    $0xe,%eax
+  802364:	e8 ed f8 ff ff       	call   801c56 <fsipc>
+  802369:	89 c3                	mov    %eax,%ebx
+  80236b:	85 c0                	test   %eax,%eax
+  80236d:	7e 20                	jle    80238f <readdir+0x8f>
+	assert(r <= n && r <= PGSIZE);
+  80236f:	39 45 10             	cmp    %eax,0x10(%ebp)
+  802372:	72 22                	jb     802396 <readdir+0x96>
+  802374:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  802379:	7f 1b                	jg     802396 <readdir+0x96>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  80237b:	83 ec 04             	sub    $0x4,%esp
+  80237e:	50                   	push   %eax
+  80237f:	68 00 80 81 00       	push   $0x818000
+  802384:	ff 75 0c             	push   0xc(%ebp)
+  802387:	e8 8e ea ff ff       	call   800e1a <memmove>
+	return r;
+  80238c:	83 c4 10             	add    $0x10,%esp
+}
+  80238f:	89 d8                	mov    %ebx,%eax
+  802391:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802394:	c9                   	leave
+  802395:	c3                   	ret
+	assert(r <= n && r <= PGSIZE);
+  802396:	68 07 43 80 00       	push   $0x804307
+  80239b:	68 e0 42 80 00       	push   $0x8042e0
+  8023a0:	68 86 01 00 00       	push   $0x186
+  8023a5:	68 f5 42 80 00       	push   $0x8042f5
+  8023aa:	e8 1c e2 ff ff       	call   8005cb <_panic>
+		return -E_NOT_SUPP;
+  8023af:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  8023b4:	eb d9                	jmp    80238f <readdir+0x8f>
+
+008023b6 <munmap>:
+{
+  8023b6:	55                   	push   %ebp
+  8023b7:	89 e5                	mov    %esp,%ebp
+  8023b9:	56                   	push   %esi
+  8023ba:	53                   	push   %ebx
+  8023bb:	8b 75 08             	mov    0x8(%ebp),%esi
+  8023be:	8b 55 0c             	mov    0xc(%ebp),%edx
+	if (PGOFF(addr) || (uintptr_t) addr >= UTOP || len > UTOP - (uintptr_t) addr)
+  8023c1:	f7 c6 ff 0f 00 00    	test   $0xfff,%esi
+  8023c7:	75 41                	jne    80240a <munmap+0x54>
+  8023c9:	81 fe ff ff bf ee    	cmp    $0xeebfffff,%esi
+  8023cf:	77 39                	ja     80240a <munmap+0x54>
+  8023d1:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  8023d6:	29 f0                	sub    %esi,%eax
+  8023d8:	39 d0                	cmp    %edx,%eax
+  8023da:	72 35                	jb     802411 <munmap+0x5b>
+	for (va = (uintptr_t) addr; va < (uintptr_t) addr + len; va += PGSIZE)
+  8023dc:	89 f3                	mov    %esi,%ebx
+  8023de:	01 d6                	add    %edx,%esi
+  8023e0:	39 f3                	cmp    %esi,%ebx
+  8023e2:	73 1a                	jae    8023fe <munmap+0x48>
+		if ((r = sys_page_unmap(0, (void *) va)) < 0)
+  8023e4:	83 ec 08             	sub    $0x8,%esp
+  8023e7:	53                   	push   %ebx
+  8023e8:	6a 00                	push   $0x0
+  8023ea:	e8 3e ed ff ff       	call   80112d <sys_page_unmap>
+  8023ef:	83 c4 10             	add    $0x10,%esp
+  8023f2:	85 c0                	test   %eax,%eax
+  8023f4:	78 0d                	js     802403 <munmap+0x4d>
+	for (va = (uintptr_t) addr; va < (uintptr_t) addr + len; va += PGSIZE)
+  8023f6:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8023fc:	eb e2                	jmp    8023e0 <munmap+0x2a>
+	return 0;
+  8023fe:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802403:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802406:	5b                   	pop    %ebx
+  802407:	5e                   	pop    %esi
+  802408:	5d                   	pop    %ebp
+  802409:	c3                   	ret
+		return -E_INVAL;
+  80240a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80240f:	eb f2                	jmp    802403 <munmap+0x4d>
+  802411:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802416:	eb eb                	jmp    802403 <munmap+0x4d>
+
+00802418 <mmap>:
+{
+  802418:	55                   	push   %ebp
+  802419:	89 e5                	mov    %esp,%ebp
+  80241b:	57                   	push   %edi
+  80241c:	56                   	push   %esi
+  80241d:	53                   	push   %ebx
+  80241e:	83 ec 34             	sub    $0x34,%esp
+  802421:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802424:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  802427:	50                   	push   %eax
+  802428:	ff 75 18             	push   0x18(%ebp)
+  80242b:	e8 ee f0 ff ff       	call   80151e <fd_lookup>
+  802430:	89 c3                	mov    %eax,%ebx
+  802432:	83 c4 10             	add    $0x10,%esp
+  802435:	85 c0                	test   %eax,%eax
+  802437:	0f 88 0e 01 00 00    	js     80254b <mmap+0x133>
+	if (fd->fd_dev_id != devfile.dev_id)
+  80243d:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802440:	a1 20 50 80 00       	mov    0x805020,%eax
+  802445:	39 02                	cmp    %eax,(%edx)
+  802447:	0f 85 50 01 00 00    	jne    80259d <mmap+0x185>
+	if ((prot & PROT_WRITE) && !(flags & MAP_PRIVATE))
+  80244d:	8b 45 10             	mov    0x10(%ebp),%eax
+  802450:	83 e0 02             	and    $0x2,%eax
+  802453:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  802456:	74 0a                	je     802462 <mmap+0x4a>
+  802458:	f6 45 14 02          	testb  $0x2,0x14(%ebp)
+  80245c:	0f 84 42 01 00 00    	je     8025a4 <mmap+0x18c>
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY
+  802462:	8b 42 08             	mov    0x8(%edx),%eax
+  802465:	83 e0 03             	and    $0x3,%eax
+  802468:	83 f8 01             	cmp    $0x1,%eax
+  80246b:	0f 84 3a 01 00 00    	je     8025ab <mmap+0x193>
+	    || PGOFF(addr) || PGOFF(offset) || offset < 0
+  802471:	8b 45 08             	mov    0x8(%ebp),%eax
+  802474:	0b 45 1c             	or     0x1c(%ebp),%eax
+  802477:	25 ff 0f 00 00       	and    $0xfff,%eax
+  80247c:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80247f:	0f 85 2d 01 00 00    	jne    8025b2 <mmap+0x19a>
+	    || (uintptr_t) addr >= UTOP || len > UTOP - (uintptr_t) addr)
+  802485:	83 7d 1c 00          	cmpl   $0x0,0x1c(%ebp)
+  802489:	0f 88 2a 01 00 00    	js     8025b9 <mmap+0x1a1>
+  80248f:	81 7d 08 ff ff bf ee 	cmpl   $0xeebfffff,0x8(%ebp)
+  802496:	0f 87 1d 01 00 00    	ja     8025b9 <mmap+0x1a1>
+  80249c:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  8024a1:	2b 45 08             	sub    0x8(%ebp),%eax
+  8024a4:	39 f8                	cmp    %edi,%eax
+  8024a6:	0f 82 14 01 00 00    	jb     8025c0 <mmap+0x1a8>
+	if ((r = devfile_sync(fd)) < 0)
+  8024ac:	83 ec 0c             	sub    $0xc,%esp
+  8024af:	52                   	push   %edx
+  8024b0:	e8 45 f8 ff ff       	call   801cfa <devfile_sync>
+  8024b5:	89 c3                	mov    %eax,%ebx
+  8024b7:	83 c4 10             	add    $0x10,%esp
+  8024ba:	85 c0                	test   %eax,%eax
+  8024bc:	0f 88 89 00 00 00    	js     80254b <mmap+0x133>
+	len = ROUNDUP(len, PGSIZE);
+  8024c2:	81 c7 ff 0f 00 00    	add    $0xfff,%edi
+  8024c8:	81 e7 00 f0 ff ff    	and    $0xfffff000,%edi
+	for (done = 0; done < len; done += n * PGSIZE) {
+  8024ce:	be 00 00 00 00       	mov    $0x0,%esi
+  8024d3:	8b 5d 1c             	mov    0x1c(%ebp),%ebx
+  8024d6:	39 fe                	cmp    %edi,%esi
+  8024d8:	73 7b                	jae    802555 <mmap+0x13d>
+		n = MIN((len - done) / PGSIZE, FSBULK_MAXPAGES);
+  8024da:	89 f8                	mov    %edi,%eax
+  8024dc:	29 f0                	sub    %esi,%eax
+  8024de:	c1 e8 0c             	shr    $0xc,%eax
+  8024e1:	ba 40 00 00 00       	mov    $0x40,%edx
+  8024e6:	39 d0                	cmp    %edx,%eax
+  8024e8:	0f 47 c2             	cmova  %edx,%eax
+  8024eb:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		fsipcbuf.map.req_fileid = fd->fd_file.id;
+  8024ee:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8024f1:	8b 52 0c             	mov    0xc(%edx),%edx
+  8024f4:	89 15 00 80 81 00    	mov    %edx,0x818000
+		fsipcbuf.map.req_offset = offset + done;
+  8024fa:	8d 14 33             	lea    (%ebx,%esi,1),%edx
+  8024fd:	89 15 04 80 81 00    	mov    %edx,0x818004
+		fsipcbuf.map.req_npages = n;
+  802503:	a3 08 80 81 00       	mov    %eax,0x818008
+		if ((r = fsipcv(FSREQ_MAP, addr + done, &n)) <= 0 || n == 0) {
+  802508:	89 f2                	mov    %esi,%edx
+  80250a:	03 55 08             	add    0x8(%ebp),%edx
+  80250d:	8d 4d e0             	lea    -0x20(%ebp),%ecx
+  802510:	b8 0b 00 00 00       	mov    $0xb,%eax
+  802515:	e8 ea f6 ff ff       	call   801c04 <fsipcv>
+  80251a:	85 c0                	test   %eax,%eax
+  80251c:	7e 12                	jle    802530 <mmap+0x118>
+  80251e:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802521:	85 c0                	test   %eax,%eax
+  802523:	0f 84 9e 00 00 00    	je     8025c7 <mmap+0x1af>
+	for (done = 0; done < len; done += n * PGSIZE) {
+  802529:	c1 e0 0c             	shl    $0xc,%eax
+  80252c:	01 c6                	add    %eax,%esi
+  80252e:	eb a6                	jmp    8024d6 <mmap+0xbe>
+			munmap(addr, done);
+  802530:	89 c3                	mov    %eax,%ebx
+  802532:	83 ec 08             	sub    $0x8,%esp
+  802535:	56                   	push   %esi
+  802536:	ff 75 08             	push   0x8(%ebp)
+  802539:	e8 78 fe ff ff       	call   8023b6 <munmap>
+			return r < 0 ? r : -E_INVAL;
+  80253e:	83 c4 10             	add    $0x10,%esp
+  802541:	85 db                	test   %ebx,%ebx
+  802543:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802548:	0f 49 d8             	cmovns %eax,%ebx
+}
+  80254b:	89 d8                	mov    %ebx,%eax
+  80254d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802550:	5b                   	pop    %ebx
+  802551:	5e                   	pop    %esi
+  802552:	5f                   	pop    %edi
+  802553:	5d                   	pop    %ebp
+  802554:	c3                   	ret
+	if (prot & PROT_WRITE)
+  802555:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+	return 0;
+  802558:	89 c3                	mov    %eax,%ebx
+	if (prot & PROT_WRITE)
+  80255a:	85 c0                	test   %eax,%eax
+  80255c:	74 ed                	je     80254b <mmap+0x133>
+		for (done = 0; done < len; done += PGSIZE)
+  80255e:	be 00 00 00 00       	mov    $0x0,%esi
+  802563:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802566:	39 fe                	cmp    %edi,%esi
+  802568:	73 2e                	jae    802598 <mmap+0x180>
+			if ((r = cowpage(addr + done)) < 0) {
+  80256a:	83 ec 0c             	sub    $0xc,%esp
+  80256d:	8d 04 33             	lea    (%ebx,%esi,1),%eax
+  802570:	50                   	push   %eax
+  802571:	e8 fd 0f 00 00       	call   803573 <cowpage>
+  802576:	83 c4 10             	add    $0x10,%esp
+  802579:	85 c0                	test   %eax,%eax
+  80257b:	78 08                	js     802585 <mmap+0x16d>
+		for (done = 0; done < len; done += PGSIZE)
+  80257d:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  802583:	eb e1                	jmp    802566 <mmap+0x14e>
+				munmap(addr, len);
+  802585:	89 c3                	mov    %eax,%ebx
+  802587:	83 ec 08             	sub    $0x8,%esp
+  80258a:	57                   	push   %edi
+  80258b:	ff 75 08             	push   0x8(%ebp)
+  80258e:	e8 23 fe ff ff       	call   8023b6 <munmap>
+				return r;
+  802593:	83 c4 10             	add    $0x10,%esp
+  802596:	eb b3                	jmp    80254b <mmap+0x133>
+	return 0;
+  802598:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  80259b:	eb ae                	jmp    80254b <mmap+0x133>
+		return -E_NOT_SUPP;
+  80259d:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  8025a2:	eb a7                	jmp    80254b <mmap+0x133>
+		return -E_NOT_SUPP;
+  8025a4:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  8025a9:	eb a0                	jmp    80254b <mmap+0x133>
+		return -E_INVAL;
+  8025ab:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  8025b0:	eb 99                	jmp    80254b <mmap+0x133>
+  8025b2:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  8025b7:	eb 92                	jmp    80254b <mmap+0x133>
+  8025b9:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  8025be:	eb 8b                	jmp    80254b <mmap+0x133>
+  8025c0:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  8025c5:	eb 84                	jmp    80254b <mmap+0x133>
+			munmap(addr, done);
+  8025c7:	83 ec 08             	sub    $0x8,%esp
+  8025ca:	56                   	push   %esi
+  8025cb:	ff 75 08             	push   0x8(%ebp)
+  8025ce:	e8 e3 fd ff ff       	call   8023b6 <munmap>
+  8025d3:	83 c4 10             	add    $0x10,%esp
+			return r < 0 ? r : -E_INVAL;
+  8025d6:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  8025db:	e9 6b ff ff ff       	jmp    80254b <mmap+0x133>
+
+008025e0 <fsring_read>:
+// buf.  fsring_reap returns 'tag' with the result once done.
+// Returns 0 on success, < 0 on error; -E_NO_MEM means too many requests
+// are outstanding, and some must be reaped first.
+int
+fsring_read(int fdnum, void *buf, size_t n, off_t offset, uint32_t tag)
+{
+  8025e0:	55                   	push   %ebp
+  8025e1:	89 e5                	mov    %esp,%ebp
+  8025e3:	56                   	push   %esi
+  8025e4:	53                   	push   %ebx
+  8025e5:	83 ec 10             	sub    $0x10,%esp
+  8025e8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	struct Fd *fd;
+	int slot;
+
+	if ((slot = fsring_slot(fdnum, &fd)) < 0)
+  8025eb:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8025ee:	8b 45 08             	mov    0x8(%ebp),%eax
+  8025f1:	e8 3d f9 ff ff       	call   801f33 <fsring_slot>
+  8025f6:	85 c0                	test   %eax,%eax
+  8025f8:	78 60                	js     80265a <fsring_read+0x7a>
+		return slot;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY)
+  8025fa:	8b 75 f4             	mov    -0xc(%ebp),%esi
+  8025fd:	8b 56 08             	mov    0x8(%esi),%edx
+  802600:	83 e2 03             	and    $0x3,%edx
+  802603:	83 fa 01             	cmp    $0x1,%edx
+  802606:	74 59                	je     802661 <fsring_read+0x81>
+		return -E_INVAL;
+	fsring_busy |= 1 << slot;
+  802608:	ba 01 00 00 00       	mov    $0x1,%edx
+  80260d:	89 c1                	mov    %eax,%ecx
+  80260f:	d3 e2                	shl    %cl,%edx
+  802611:	09 15 c0 90 81 00    	or     %edx,0x8190c0
+	fsring_slots[slot].s_type = FSREQ_READ;
+  802617:	8d 14 40             	lea    (%eax,%eax,2),%edx
+  80261a:	c1 e2 02             	shl    $0x2,%edx
+  80261d:	8d 8a 00 90 81 00    	lea    0x819000(%edx),%ecx
+  802623:	c7 82 00 90 81 00 03 	movl   $0x3,0x819000(%edx)
+  80262a:	00 00 00 
+	fsring_slots[slot].s_tag = tag;
+  80262d:	8b 55 18             	mov    0x18(%ebp),%edx
+  802630:	89 51 04             	mov    %edx,0x4(%ecx)
+	fsring_slots[slot].s_buf = buf;
+  802633:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802636:	89 51 08             	mov    %edx,0x8(%ecx)
+	return fsring_post(FSREQ_READ, fd, offset, MIN(n, PGSIZE), slot);
+  802639:	83 ec 08             	sub    $0x8,%esp
+  80263c:	50                   	push   %eax
+  80263d:	b8 00 10 00 00       	mov    $0x1000,%eax
+  802642:	39 c3                	cmp    %eax,%ebx
+  802644:	0f 47 d8             	cmova  %eax,%ebx
+  802647:	53                   	push   %ebx
+  802648:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  80264b:	89 f2                	mov    %esi,%edx
+  80264d:	b8 03 00 00 00       	mov    $0x3,%eax
+  802652:	e8 1e f5 ff ff       	call   801b75 <fsring_post>
+  802657:	83 c4 10             	add    $0x10,%esp
+}
+  80265a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80265d:	5b                   	pop    %ebx
+  80265e:	5e                   	pop    %esi
+  80265f:	5d                   	pop    %ebp
+  802660:	c3                   	ret
+		return -E_INVAL;
+  802661:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802666:	eb f2                	jmp    80265a <fsring_read+0x7a>
+
+00802668 <fsring_write>:
+// Start writing up to n bytes (at most a page) from buf at 'offset' of
+// fdnum.  buf may be reused as soon as this returns.
+// Returns as fsring_read.
+int
+fsring_write(int fdnum, const void *buf, size_t n, off_t offset, uint32_t tag)
+{
+  802668:	55                   	push   %ebp
+  802669:	89 e5                	mov    %esp,%ebp
+  80266b:	56                   	push   %esi
+  80266c:	53                   	push   %ebx
+  80266d:	83 ec 10             	sub    $0x10,%esp
+  802670:	8b 75 10             	mov    0x10(%ebp),%esi
+	struct Fd *fd;
+	int slot;
+
+	if ((slot = fsring_slot(fdnum, &fd)) < 0)
+  802673:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802676:	8b 45 08             	mov    0x8(%ebp),%eax
+  802679:	e8 b5 f8 ff ff       	call   801f33 <fsring_slot>
+  80267e:	89 c3                	mov    %eax,%ebx
+  802680:	85 c0                	test   %eax,%eax
+  802682:	78 77                	js     8026fb <fsring_write+0x93>
+		return slot;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY)
+  802684:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802687:	f6 40 08 03          	testb  $0x3,0x8(%eax)
+  80268b:	74 77                	je     802704 <fsring_write+0x9c>
+		return -E_INVAL;
+	n = MIN(n, PGSIZE);
+  80268d:	b8 00 10 00 00       	mov    $0x1000,%eax
+  802692:	39 c6                	cmp    %eax,%esi
+  802694:	0f 47 f0             	cmova  %eax,%esi
+	memmove((char *) fsring + (1 + slot) * PGSIZE, buf, n);
+  802697:	83 ec 04             	sub    $0x4,%esp
+  80269a:	56                   	push   %esi
+  80269b:	ff 75 0c             	push   0xc(%ebp)
+  80269e:	89 d8                	mov    %ebx,%eax
+  8026a0:	c1 e0 0c             	shl    $0xc,%eax
+  8026a3:	8d 80 00 10 00 cf    	lea    -0x30fff000(%eax),%eax
+  8026a9:	50                   	push   %eax
+  8026aa:	e8 6b e7 ff ff       	call   800e1a <memmove>
+	fsring_busy |= 1 << slot;
+  8026af:	b8 01 00 00 00       	mov    $0x1,%eax
+  8026b4:	89 d9                	mov    %ebx,%ecx
+  8026b6:	d3 e0                	shl    %cl,%eax
+  8026b8:	09 05 c0 90 81 00    	or     %eax,0x8190c0
+	fsring_slots[slot].s_type = FSREQ_WRITE;
+  8026be:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  8026c1:	c1 e0 02             	shl    $0x2,%eax
+  8026c4:	8d 90 00 90 81 00    	lea    0x819000(%eax),%edx
+  8026ca:	c7 80 00 90 81 00 04 	movl   $0x4,0x819000(%eax)
+  8026d1:	00 00 00 
+	fsring_slots[slot].s_tag = tag;
+  8026d4:	8b 45 18             	mov    0x18(%ebp),%eax
+  8026d7:	89 42 04             	mov    %eax,0x4(%edx)
+	fsring_slots[slot].s_buf = NULL;
+  8026da:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	return fsring_post(FSREQ_WRITE, fd, offset, n, slot);
+  8026e1:	83 c4 08             	add    $0x8,%esp
+  8026e4:	53                   	push   %ebx
+  8026e5:	56                   	push   %esi
+  8026e6:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  8026e9:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8026ec:	b8 04 00 00 00       	mov    $0x4,%eax
+  8026f1:	e8 7f f4 ff ff       	call   801b75 <fsring_post>
+  8026f6:	89 c3                	mov    %eax,%ebx
+  8026f8:	83 c4 10             	add    $0x10,%esp
+}
+  8026fb:	89 d8                	mov    %ebx,%eax
+  8026fd:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802700:	5b                   	pop    %ebx
+  802701:	5e                   	pop    %esi
+  802702:	5d                   	pop    %ebp
+  802703:	c3                   	ret
+		return -E_INVAL;
+  802704:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  802709:	eb f0                	jmp    8026fb <fsring_write+0x93>
+
+0080270b <fsring_stat>:
+
+// Start a stat of fdnum into *st.  Returns as fsring_read.
+int
+fsring_stat(int fdnum, struct Stat *st, uint32_t tag)
+{
+  80270b:	55                   	push   %ebp
+  80270c:	89 e5                	mov    %esp,%ebp
+  80270e:	83 ec 18             	sub    $0x18,%esp
+	struct Fd *fd;
+	int slot;
+
+	if ((slot = fsring_slot(fdnum, &fd)) < 0)
+  802711:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802714:	8b 45 08             	mov    0x8(%ebp),%eax
+  802717:	e8 17 f8 ff ff       	call   801f33 <fsring_slot>
+  80271c:	85 c0                	test   %eax,%eax
+  80271e:	78 4c                	js     80276c <fsring_stat+0x61>
+		return slot;
+	fsring_busy |= 1 << slot;
+  802720:	ba 01 00 00 00       	mov    $0x1,%edx
+  802725:	89 c1                	mov    %eax,%ecx
+  802727:	d3 e2                	shl    %cl,%edx
+  802729:	09 15 c0 90 81 00    	or     %edx,0x8190c0
+	fsring_slots[slot].s_type = FSREQ_STAT;
+  80272f:	8d 14 40             	lea    (%eax,%eax,2),%edx
+  802732:	c1 e2 02             	shl    $0x2,%edx
+  802735:	8d 8a 00 90 81 00    	lea    0x819000(%edx),%ecx
+  80273b:	c7 82 00 90 81 00 05 	movl   $0x5,0x819000(%edx)
+  802742:	00 00 00 
+	fsring_slots[slot].s_tag = tag;
+  802745:	8b 55 10             	mov    0x10(%ebp),%edx
+  802748:	89 51 04             	mov    %edx,0x4(%ecx)
+	fsring_slots[slot].s_buf = st;
+  80274b:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80274e:	89 51 08             	mov    %edx,0x8(%ecx)
+	return fsring_post(FSREQ_STAT, fd, 0, 0, slot);
+  802751:	83 ec 08             	sub    $0x8,%esp
+  802754:	50                   	push   %eax
+  802755:	6a 00                	push   $0x0
+  802757:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80275c:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80275f:	b8 05 00 00 00       	mov    $0x5,%eax
+  802764:	e8 0c f4 ff ff       	call   801b75 <fsring_post>
+  802769:	83 c4 10             	add    $0x10,%esp
+}
+  80276c:	c9                   	leave
+  80276d:	c3                   	ret
+
+0080276e <fsring_reap>:
+// If none has finished, wait for one if 'wait' is set and any are
+// outstanding.
+// Returns 1 if a result was collected, 0 if not.
+int
+fsring_reap(uint32_t *tag_store, int *result_store, bool wait)
+{
+  80276e:	55                   	push   %ebp
+  80276f:	89 e5                	mov    %esp,%ebp
+  802771:	57                   	push   %edi
+  802772:	56                   	push   %esi
+  802773:	53                   	push   %ebx
+  802774:	83 ec 1c             	sub    $0x1c,%esp
+  802777:	0f b6 5d 10          	movzbl 0x10(%ebp),%ebx
+	struct Fsring_cqe cqe;
+	struct Fsret_stat *ret;
+	struct Stat *st;
+	char *data;
+
+	if (fsring_env != thisenv->env_id)
+  80277b:	a1 c0 78 81 00       	mov    0x8178c0,%eax
+  802780:	8b 40 48             	mov    0x48(%eax),%eax
+  802783:	3b 05 c4 90 81 00    	cmp    0x8190c4,%eax
+  802789:	74 12                	je     80279d <fsring_reap+0x2f>
+		return 0;
+  80278b:	b8 00 00 00 00       	mov    $0x0,%eax
+	}
+	fsring_busy &= ~(1 << cqe.cqe_slot);
+	*tag_store = fsring_slots[cqe.cqe_slot].s_tag;
+	*result_store = cqe.cqe_result;
+	return 1;
+}
+  802790:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802793:	5b                   	pop    %ebx
+  802794:	5e                   	pop    %esi
+  802795:	5f                   	pop    %edi
+  802796:	5d                   	pop    %ebp
+  802797:	c3                   	ret
+		sys_yield();
+  802798:	e8 e4 e8 ff ff       	call   801081 <sys_yield>
+	while (fsring->r_cqhead == fsring->r_cqtail) {
+  80279d:	8b 15 08 00 00 cf    	mov    0xcf000008,%edx
+  8027a3:	a1 0c 00 00 cf       	mov    0xcf00000c,%eax
+  8027a8:	39 c2                	cmp    %eax,%edx
+  8027aa:	75 18                	jne    8027c4 <fsring_reap+0x56>
+		if (!wait || fsring_busy == 0)
+  8027ac:	84 db                	test   %bl,%bl
+  8027ae:	0f 84 21 01 00 00    	je     8028d5 <fsring_reap+0x167>
+  8027b4:	83 3d c0 90 81 00 00 	cmpl   $0x0,0x8190c0
+  8027bb:	75 db                	jne    802798 <fsring_reap+0x2a>
+			return 0;
+  8027bd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8027c2:	eb cc                	jmp    802790 <fsring_reap+0x22>
+	cqe = fsring->r_cq[fsring->r_cqhead % FSRING_NSLOTS];
+  8027c4:	a1 08 00 00 cf       	mov    0xcf000008,%eax
+  8027c9:	83 e0 0f             	and    $0xf,%eax
+  8027cc:	83 c0 2a             	add    $0x2a,%eax
+  8027cf:	8b 1c c5 00 00 00 cf 	mov    -0x31000000(,%eax,8),%ebx
+  8027d6:	8b 3c c5 04 00 00 cf 	mov    -0x30fffffc(,%eax,8),%edi
+	fsring->r_cqhead++;
+  8027dd:	a1 08 00 00 cf       	mov    0xcf000008,%eax
+  8027e2:	83 c0 01             	add    $0x1,%eax
+  8027e5:	a3 08 00 00 cf       	mov    %eax,0xcf000008
+	if (cqe.cqe_slot >= FSRING_NSLOTS || !(fsring_busy & (1 << cqe.cqe_slot)))
+  8027ea:	83 fb 0f             	cmp    $0xf,%ebx
+  8027ed:	77 5b                	ja     80284a <fsring_reap+0xdc>
+  8027ef:	be 01 00 00 00       	mov    $0x1,%esi
+  8027f4:	89 d9                	mov    %ebx,%ecx
+  8027f6:	d3 e6                	shl    %cl,%esi
+  8027f8:	89 f0                	mov    %esi,%eax
+  8027fa:	23 05 c0 90 81 00    	and    0x8190c0,%eax
+  802800:	74 48                	je     80284a <fsring_reap+0xdc>
+	data = (char *) fsring + (1 + cqe.cqe_slot) * PGSIZE;
+  802802:	89 d8                	mov    %ebx,%eax
+  802804:	c1 e0 0c             	shl    $0xc,%eax
+  802807:	8d 80 00 10 00 cf    	lea    -0x30fff000(%eax),%eax
+  80280d:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	switch (fsring_slots[cqe.cqe_slot].s_type) {
+  802810:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  802813:	8b 04 85 00 90 81 00 	mov    0x819000(,%eax,4),%eax
+  80281a:	83 f8 03             	cmp    $0x3,%eax
+  80281d:	74 40                	je     80285f <fsring_reap+0xf1>
+  80281f:	83 f8 05             	cmp    $0x5,%eax
+  802822:	74 64                	je     802888 <fsring_reap+0x11a>
+	fsring_busy &= ~(1 << cqe.cqe_slot);
+  802824:	f7 d6                	not    %esi
+  802826:	21 35 c0 90 81 00    	and    %esi,0x8190c0
+	*tag_store = fsring_slots[cqe.cqe_slot].s_tag;
+  80282c:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  80282f:	8b 14 85 04 90 81 00 	mov    0x819004(,%eax,4),%edx
+  802836:	8b 45 08             	mov    0x8(%ebp),%eax
+  802839:	89 10                	mov    %edx,(%eax)
+	*result_store = cqe.cqe_result;
+  80283b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80283e:	89 38                	mov    %edi,(%eax)
+	return 1;
+  802840:	b8 01 00 00 00       	mov    $0x1,%eax
+  802845:	e9 46 ff ff ff       	jmp    802790 <fsring_reap+0x22>
+		panic("fsring_reap: bad slot %u", cqe.cqe_slot);
+  80284a:	53                   	push   %ebx
+  80284b:	68 1d 43 80 00       	push   $0x80431d
+  802850:	68 8f 02 00 00       	push   $0x28f
+  802855:	68 f5 42 80 00       	push   $0x8042f5
+  80285a:	e8 6c dd ff ff       	call   8005cb <_panic>
+		if (cqe.cqe_result > 0)
+  80285f:	85 ff                	test   %edi,%edi
+  802861:	7e c1                	jle    802824 <fsring_reap+0xb6>
+			memmove(fsring_slots[cqe.cqe_slot].s_buf, data,
+  802863:	83 ec 04             	sub    $0x4,%esp
+				MIN(cqe.cqe_result, PGSIZE));
+  802866:	b8 00 10 00 00       	mov    $0x1000,%eax
+  80286b:	39 c7                	cmp    %eax,%edi
+  80286d:	0f 4e c7             	cmovle %edi,%eax
+			memmove(fsring_slots[cqe.cqe_slot].s_buf, data,
+  802870:	50                   	push   %eax
+  802871:	ff 75 e4             	push   -0x1c(%ebp)
+  802874:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  802877:	ff 34 85 08 90 81 00 	push   0x819008(,%eax,4)
+  80287e:	e8 97 e5 ff ff       	call   800e1a <memmove>
+  802883:	83 c4 10             	add    $0x10,%esp
+  802886:	eb 9c                	jmp    802824 <fsring_reap+0xb6>
+		if (cqe.cqe_result == 0) {
+  802888:	85 ff                	test   %edi,%edi
+  80288a:	75 98                	jne    802824 <fsring_reap+0xb6>
+			st = fsring_slots[cqe.cqe_slot].s_buf;
+  80288c:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  80288f:	8b 0c 85 08 90 81 00 	mov    0x819008(,%eax,4),%ecx
+			strcpy(st->st_name, ret->ret_name);
+  802896:	83 ec 08             	sub    $0x8,%esp
+  802899:	ff 75 e4             	push   -0x1c(%ebp)
+  80289c:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  80289f:	51                   	push   %ecx
+  8028a0:	e8 ef e3 ff ff       	call   800c94 <strcpy>
+			st->st_size = ret->ret_size;
+  8028a5:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8028a8:	8b 82 80 00 00 00    	mov    0x80(%edx),%eax
+  8028ae:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  8028b1:	89 81 80 00 00 00    	mov    %eax,0x80(%ecx)
+			st->st_isdir = ret->ret_isdir;
+  8028b7:	8b 82 84 00 00 00    	mov    0x84(%edx),%eax
+  8028bd:	89 81 84 00 00 00    	mov    %eax,0x84(%ecx)
+			st->st_dev = &devfile;
+  8028c3:	c7 81 88 00 00 00 20 	movl   $0x805020,0x88(%ecx)
+  8028ca:	50 80 00 
+  8028cd:	83 c4 10             	add    $0x10,%esp
+  8028d0:	e9 4f ff ff ff       	jmp    802824 <fsring_reap+0xb6>
+			return 0;
+  8028d5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8028da:	e9 b1 fe ff ff       	jmp    802790 <fsring_reap+0x22>
+
+008028df <file_slurp>:
+// page are copied through fsipcbuf; larger ones go straight into buf's
+// pages, and stop at FSBULK_MAXPAGES of them.
+// Returns the number of bytes read, 0 for directories, or < 0 on error.
+ssize_t
+file_slurp(const char *path, void *buf, size_t n, struct Stat *st)
+{
+  8028df:	55                   	push   %ebp
+  8028e0:	89 e5                	mov    %esp,%ebp
+  8028e2:	57                   	push   %edi
+  8028e3:	56                   	push   %esi
+  8028e4:	53                   	push   %ebx
+  8028e5:	83 ec 28             	sub    $0x28,%esp
+  8028e8:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8028eb:	8b 7d 10             	mov    0x10(%ebp),%edi
+  8028ee:	8b 75 14             	mov    0x14(%ebp),%esi
+	const char *name;
+	int r;
+
+	if (strlen(path) >= MAXPATHLEN)
+  8028f1:	53                   	push   %ebx
+  8028f2:	e8 62 e3 ff ff       	call   800c59 <strlen>
+  8028f7:	83 c4 10             	add    $0x10,%esp
+  8028fa:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8028ff:	0f 8f 02 01 00 00    	jg     802a07 <file_slurp+0x128>
+		return -E_BAD_PATH;
+
+	strcpy(fsipcbuf.slurp.req_path, path);
+  802905:	83 ec 08             	sub    $0x8,%esp
+  802908:	53                   	push   %ebx
+  802909:	68 00 80 81 00       	push   $0x818000
+  80290e:	e8 81 e3 ff ff       	call   800c94 <strcpy>
+	if (n > sizeof(fsipcbuf.slurpRet.ret_buf)) {
+  802913:	83 c4 10             	add    $0x10,%esp
+  802916:	81 ff f8 0f 00 00    	cmp    $0xff8,%edi
+  80291c:	76 69                	jbe    802987 <file_slurp+0xa8>
+		n = MIN(n, FSBULK_MAXPAGES * PGSIZE - PGOFF(buf));
+  80291e:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802921:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  802927:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  80292c:	29 d1                	sub    %edx,%ecx
+  80292e:	39 f9                	cmp    %edi,%ecx
+  802930:	0f 46 f9             	cmovbe %ecx,%edi
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  802933:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802936:	89 f9                	mov    %edi,%ecx
+  802938:	01 c1                	add    %eax,%ecx
+  80293a:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  80293d:	eb 0f                	jmp    80294e <file_slurp+0x6f>
+		*(volatile char *) p = *(volatile char *) p;
+  80293f:	0f b6 10             	movzbl (%eax),%edx
+  802942:	88 10                	mov    %dl,(%eax)
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  802944:	05 00 10 00 00       	add    $0x1000,%eax
+  802949:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  80294e:	39 c8                	cmp    %ecx,%eax
+  802950:	72 ed                	jb     80293f <file_slurp+0x60>
+		fsipc_touch(buf, n);
+		fsipcbuf.slurp.req_n = n;
+  802952:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802955:	89 3d 00 84 81 00    	mov    %edi,0x818400
+		fsipcbuf.slurp.req_off = PGOFF(buf);
+  80295b:	89 15 04 84 81 00    	mov    %edx,0x818404
+		r = fsipc_pages(FSREQ_SLURP, buf, n, PTE_P | PTE_W | PTE_U);
+  802961:	83 ec 0c             	sub    $0xc,%esp
+  802964:	6a 07                	push   $0x7
+  802966:	89 f9                	mov    %edi,%ecx
+  802968:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80296b:	b8 0f 00 00 00       	mov    $0xf,%eax
+  802970:	e8 3f f1 ff ff       	call   801ab4 <fsipc_pages>
+  802975:	89 c7                	mov    %eax,%edi
+  802977:	83 c4 10             	add    $0x10,%esp
+			memmove(buf, fsipcbuf.slurpRet.ret_buf, r);
+	}
+	if (r < 0)
+		return r;
+
+	if (st) {
+  80297a:	85 f6                	test   %esi,%esi
+  80297c:	74 7f                	je     8029fd <file_slurp+0x11e>
+  80297e:	8d 43 01             	lea    0x1(%ebx),%eax
+  802981:	85 ff                	test   %edi,%edi
+  802983:	79 3c                	jns    8029c1 <file_slurp+0xe2>
+  802985:	eb 76                	jmp    8029fd <file_slurp+0x11e>
+		fsipcbuf.slurp.req_n = n;
+  802987:	89 3d 00 84 81 00    	mov    %edi,0x818400
+		if ((r = fsipc(FSREQ_SLURP, NULL)) > 0)
+  80298d:	ba 00 00 00 00       	mov    $0x0,%edx
+  802992:	b8 0f 00 00 00       	mov    $0xf,%eax
+  802997:	e8 ba f2 ff ff       	call   801c56 <fsipc>
+  80299c:	89 c7                	mov    %eax,%edi
+  80299e:	85 c0                	test   %eax,%eax
+  8029a0:	7e d8                	jle    80297a <file_slurp+0x9b>
+			memmove(buf, fsipcbuf.slurpRet.ret_buf, r);
+  8029a2:	83 ec 04             	sub    $0x4,%esp
+  8029a5:	50                   	push   %eax
+  8029a6:	68 08 80 81 00       	push   $0x818008
+  8029ab:	ff 75 0c             	push   0xc(%ebp)
+  8029ae:	e8 67 e4 ff ff       	call   800e1a <memmove>
+  8029b3:	83 c4 10             	add    $0x10,%esp
+  8029b6:	eb c2                	jmp    80297a <file_slurp+0x9b>
+		for (name = path; *path; path++)
+			if (*path == '/')
+				name = path + 1;
+  8029b8:	80 fa 2f             	cmp    $0x2f,%dl
+  8029bb:	0f 44 d9             	cmove  %ecx,%ebx
+		for (name = path; *path; path++)
+  8029be:	83 c0 01             	add    $0x1,%eax
+  8029c1:	89 c1                	mov    %eax,%ecx
+  8029c3:	0f b6 50 ff          	movzbl -0x1(%eax),%edx
+  8029c7:	84 d2                	test   %dl,%dl
+  8029c9:	75 ed                	jne    8029b8 <file_slurp+0xd9>
+		strlcpy(st->st_name, name, sizeof(st->st_name));
+  8029cb:	83 ec 04             	sub    $0x4,%esp
+  8029ce:	68 80 00 00 00       	push   $0x80
+  8029d3:	53                   	push   %ebx
+  8029d4:	56                   	push   %esi
+  8029d5:	e8 30 e3 ff ff       	call   800d0a <strlcpy>
+		st->st_size = fsipcbuf.slurpRet.ret_size;
+  8029da:	a1 00 80 81 00       	mov    0x818000,%eax
+  8029df:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+		st->st_isdir = fsipcbuf.slurpRet.ret_isdir;
+  8029e5:	a1 04 80 81 00       	mov    0x818004,%eax
+  8029ea:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+		st->st_dev = &devfile;
+  8029f0:	c7 86 88 00 00 00 20 	movl   $0x805020,0x88(%esi)
+  8029f7:	50 80 00 
+  8029fa:	83 c4 10             	add    $0x10,%esp
+	}
+	return r;
+}
+  8029fd:	89 f8                	mov    %edi,%eax
+  8029ff:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802a02:	5b                   	pop    %ebx
+  802a03:	5e                   	pop    %esi
+  802a04:	5f                   	pop    %edi
+  802a05:	5d                   	pop    %ebp
+  802a06:	c3                   	ret
+		return -E_BAD_PATH;
+  802a07:	bf f4 ff ff ff       	mov    $0xfffffff4,%edi
+  802a0c:	eb ef                	jmp    8029fd <file_slurp+0x11e>
+
+00802a0e <remove>:
+
+// Delete a file
+int
+remove(const char *path)
+{
+  802a0e:	55                   	push   %ebp
+  802a0f:	89 e5                	mov    %esp,%ebp
+  802a11:	53                   	push   %ebx
+  802a12:	83 ec 10             	sub    $0x10,%esp
+  802a15:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (strlen(path) >= MAXPATHLEN)
+  802a18:	53                   	push   %ebx
+  802a19:	e8 3b e2 ff ff       	call   800c59 <strlen>
+  802a1e:	83 c4 10             	add    $0x10,%esp
+  802a21:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802a26:	7f 25                	jg     802a4d <remove+0x3f>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.remove.req_path, path);
+  802a28:	83 ec 08             	sub    $0x8,%esp
+  802a2b:	53                   	push   %ebx
+  802a2c:	68 00 80 81 00       	push   $0x818000
+  802a31:	e8 5e e2 ff ff       	call   800c94 <strcpy>
+	return fsipc(FSREQ_REMOVE, NULL);
+  802a36:	ba 00 00 00 00       	mov    $0x0,%edx
+  802a3b:	b8 07 00 00 00       	mov    $0x7,%eax
+  802a40:	e8 11 f2 ff ff       	call   801c56 <fsipc>
+  802a45:	83 c4 10             	add    $0x10,%esp
+}
+  802a48:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802a4b:	c9                   	leave
+  802a4c:	c3                   	ret
+		return -E_BAD_PATH;
+  802a4d:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  802a52:	eb f4                	jmp    802a48 <remove+0x3a>
+
+00802a54 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  802a54:	55                   	push   %ebp
+  802a55:	89 e5                	mov    %esp,%ebp
+  802a57:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  802a5a:	ba 00 00 00 00       	mov    $0x0,%edx
+  802a5f:	b8 08 00 00 00       	mov    $0x8,%eax
+  802a64:	e8 ed f1 ff ff       	call   801c56 <fsipc>
+}
+  802a69:	c9                   	leave
+  802a6a:	c3                   	ret
+
+00802a6b <defrag>:
+// Have the file server lay out the blocks of 'path' contiguously on
+// disk.  Stores the number of extents the file had before and has
+// after in *before and *after, if they are not null.
+int
+defrag(const char *path, uint32_t *before, uint32_t *after)
+{
+  802a6b:	55                   	push   %ebp
+  802a6c:	89 e5                	mov    %esp,%ebp
+  802a6e:	57                   	push   %edi
+  802a6f:	56                   	push   %esi
+  802a70:	53                   	push   %ebx
+  802a71:	83 ec 18             	sub    $0x18,%esp
+  802a74:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802a77:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802a7a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int r;
+
+	if (strlen(path) >= MAXPATHLEN)
+  802a7d:	57                   	push   %edi
+  802a7e:	e8 d6 e1 ff ff       	call   800c59 <strlen>
+  802a83:	83 c4 10             	add    $0x10,%esp
+  802a86:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802a8b:	7f 4c                	jg     802ad9 <defrag+0x6e>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.defrag.req_path, path);
+  802a8d:	83 ec 08             	sub    $0x8,%esp
+  802a90:	57                   	push   %edi
+  802a91:	68 00 80 81 00       	push   $0x818000
+  802a96:	e8 f9 e1 ff ff       	call   800c94 <strcpy>
+	if ((r = fsipc(FSREQ_DEFRAG, NULL)) < 0)
+  802a9b:	ba 00 00 00 00       	mov    $0x0,%edx
+  802aa0:	b8 10 00 00 00       	mov    $0x10,%eax
+  802aa5:	e8 ac f1 ff ff       	call   801c56 <fsipc>
+  802aaa:	83 c4 10             	add    $0x10,%esp
+  802aad:	85 c0                	test   %eax,%eax
+  802aaf:	78 20                	js     802ad1 <defrag+0x66>
+		return r;
+	if (before)
+  802ab1:	85 f6                	test   %esi,%esi
+  802ab3:	74 07                	je     802abc <defrag+0x51>
+		*before = fsipcbuf.defragRet.ret_before;
+  802ab5:	a1 00 80 81 00       	mov    0x818000,%eax
+  802aba:	89 06                	mov    %eax,(%esi)
+	if (after)
+		*after = fsipcbuf.defragRet.ret_after;
+	return 0;
+  802abc:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (after)
+  802ac1:	85 db                	test   %ebx,%ebx
+  802ac3:	74 0c                	je     802ad1 <defrag+0x66>
+		*after = fsipcbuf.defragRet.ret_after;
+  802ac5:	a1 04 80 81 00       	mov    0x818004,%eax
+  802aca:	89 03                	mov    %eax,(%ebx)
+	return 0;
+  802acc:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802ad1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802ad4:	5b                   	pop    %ebx
+  802ad5:	5e                   	pop    %esi
+  802ad6:	5f                   	pop    %edi
+  802ad7:	5d                   	pop    %ebp
+  802ad8:	c3                   	ret
+		return -E_BAD_PATH;
+  802ad9:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  802ade:	eb f1                	jmp    802ad1 <defrag+0x66>
+
+00802ae0 <fs_bcstats>:
+
+// Copy the file server's block cache statistics into *st.
+int
+fs_bcstats(struct BcStats *st)
+{
+  802ae0:	55                   	push   %ebp
+  802ae1:	89 e5                	mov    %esp,%ebp
+  802ae3:	53                   	push   %ebx
+  802ae4:	83 ec 04             	sub    $0x4,%esp
+  802ae7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if ((r = fsipc(FSREQ_BCSTATS, NULL)) < 0)
+  802aea:	ba 00 00 00 00       	mov    $0x0,%edx
+  802aef:	b8 11 00 00 00       	mov    $0x11,%eax
+  802af4:	e8 5d f1 ff ff       	call   801c56 <fsipc>
+  802af9:	85 c0                	test   %eax,%eax
+  802afb:	78 34                	js     802b31 <fs_bcstats+0x51>
+		return r;
+	*st = fsipcbuf.bcstatsRet;
+  802afd:	a1 00 80 81 00       	mov    0x818000,%eax
+  802b02:	89 03                	mov    %eax,(%ebx)
+  802b04:	a1 04 80 81 00       	mov    0x818004,%eax
+  802b09:	89 43 04             	mov    %eax,0x4(%ebx)
+  802b0c:	a1 08 80 81 00       	mov    0x818008,%eax
+  802b11:	89 43 08             	mov    %eax,0x8(%ebx)
+  802b14:	a1 0c 80 81 00       	mov    0x81800c,%eax
+  802b19:	89 43 0c             	mov    %eax,0xc(%ebx)
+  802b1c:	a1 10 80 81 00       	mov    0x818010,%eax
+  802b21:	89 43 10             	mov    %eax,0x10(%ebx)
+  802b24:	a1 14 80 81 00       	mov    0x818014,%eax
+  802b29:	89 43 14             	mov    %eax,0x14(%ebx)
+	return 0;
+  802b2c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802b31:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802b34:	c9                   	leave
+  802b35:	c3                   	ret
+
+00802b36 <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  802b36:	55                   	push   %ebp
+  802b37:	89 e5                	mov    %esp,%ebp
+  802b39:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  802b3c:	68 36 43 80 00       	push   $0x804336
+  802b41:	ff 75 0c             	push   0xc(%ebp)
+  802b44:	e8 4b e1 ff ff       	call   800c94 <strcpy>
+	return 0;
+}
+  802b49:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b4e:	c9                   	leave
+  802b4f:	c3                   	ret
+
+00802b50 <devsock_close>:
+{
+  802b50:	55                   	push   %ebp
+  802b51:	89 e5                	mov    %esp,%ebp
+  802b53:	53                   	push   %ebx
+  802b54:	83 ec 10             	sub    $0x10,%esp
+  802b57:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  802b5a:	53                   	push   %ebx
+  802b5b:	e8 f4 0d 00 00       	call   803954 <pageref>
+  802b60:	89 c2                	mov    %eax,%edx
+  802b62:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  802b65:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  802b6a:	83 fa 01             	cmp    $0x1,%edx
+  802b6d:	74 05                	je     802b74 <devsock_close+0x24>
+}
+  802b6f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802b72:	c9                   	leave
+  802b73:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  802b74:	83 ec 0c             	sub    $0xc,%esp
+  802b77:	ff 73 0c             	push   0xc(%ebx)
+  802b7a:	e8 b7 02 00 00       	call   802e36 <nsipc_close>
+  802b7f:	83 c4 10             	add    $0x10,%esp
+  802b82:	eb eb                	jmp    802b6f <devsock_close+0x1f>
+
+00802b84 <devsock_write>:
+{
+  802b84:	55                   	push   %ebp
+  802b85:	89 e5                	mov    %esp,%ebp
+  802b87:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  802b8a:	6a 00                	push   $0x0
+  802b8c:	ff 75 10             	push   0x10(%ebp)
+  802b8f:	ff 75 0c             	push   0xc(%ebp)
+  802b92:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b95:	ff 70 0c             	push   0xc(%eax)
+  802b98:	e8 79 03 00 00       	call   802f16 <nsipc_send>
+}
+  802b9d:	c9                   	leave
+  802b9e:	c3                   	ret
+
+00802b9f <devsock_read>:
+{
+  802b9f:	55                   	push   %ebp
+  802ba0:	89 e5                	mov    %esp,%ebp
+  802ba2:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  802ba5:	6a 00                	push   $0x0
+  802ba7:	ff 75 10             	push   0x10(%ebp)
+  802baa:	ff 75 0c             	push   0xc(%ebp)
+  802bad:	8b 45 08             	mov    0x8(%ebp),%eax
+  802bb0:	ff 70 0c             	push   0xc(%eax)
+  802bb3:	e8 ef 02 00 00       	call   802ea7 <nsipc_recv>
+}
+  802bb8:	c9                   	leave
+  802bb9:	c3                   	ret
+
+00802bba <fd2sockid>:
+{
+  802bba:	55                   	push   %ebp
+  802bbb:	89 e5                	mov    %esp,%ebp
+  802bbd:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  802bc0:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802bc3:	52                   	push   %edx
+  802bc4:	50                   	push   %eax
+  802bc5:	e8 54 e9 ff ff       	call   80151e <fd_lookup>
+  802bca:	83 c4 10             	add    $0x10,%esp
+  802bcd:	85 c0                	test   %eax,%eax
+  802bcf:	78 10                	js     802be1 <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  802bd1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802bd4:	8b 0d 40 50 80 00    	mov    0x805040,%ecx
+  802bda:	39 08                	cmp    %ecx,(%eax)
+  802bdc:	75 05                	jne    802be3 <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  802bde:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  802be1:	c9                   	leave
+  802be2:	c3                   	ret
+		return -E_NOT_SUPP;
+  802be3:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802be8:	eb f7                	jmp    802be1 <fd2sockid+0x27>
+
+00802bea <alloc_sockfd>:
+{
+  802bea:	55                   	push   %ebp
+  802beb:	89 e5                	mov    %esp,%ebp
+  802bed:	56                   	push   %esi
+  802bee:	53                   	push   %ebx
+  802bef:	83 ec 1c             	sub    $0x1c,%esp
+  802bf2:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  802bf4:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802bf7:	50                   	push   %eax
+  802bf8:	e8 cb e8 ff ff       	call   8014c8 <fd_alloc>
+  802bfd:	89 c3                	mov    %eax,%ebx
+  802bff:	83 c4 10             	add    $0x10,%esp
+  802c02:	85 c0                	test   %eax,%eax
+  802c04:	78 43                	js     802c49 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  802c06:	83 ec 04             	sub    $0x4,%esp
+  802c09:	68 07 04 00 00       	push   $0x407
+  802c0e:	ff 75 f4             	push   -0xc(%ebp)
+  802c11:	6a 00                	push   $0x0
+  802c13:	e8 88 e4 ff ff       	call   8010a0 <sys_page_alloc>
+  802c18:	89 c3                	mov    %eax,%ebx
+  802c1a:	83 c4 10             	add    $0x10,%esp
+  802c1d:	85 c0                	test   %eax,%eax
+  802c1f:	78 28                	js     802c49 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  802c21:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802c24:	8b 15 40 50 80 00    	mov    0x805040,%edx
+  802c2a:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  802c2c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802c2f:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  802c36:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  802c39:	83 ec 0c             	sub    $0xc,%esp
+  802c3c:	50                   	push   %eax
+  802c3d:	e8 5f e8 ff ff       	call   8014a1 <fd2num>
+  802c42:	89 c3                	mov    %eax,%ebx
+  802c44:	83 c4 10             	add    $0x10,%esp
+  802c47:	eb 0c                	jmp    802c55 <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  802c49:	83 ec 0c             	sub    $0xc,%esp
+  802c4c:	56                   	push   %esi
+  802c4d:	e8 e4 01 00 00       	call   802e36 <nsipc_close>
+		return r;
+  802c52:	83 c4 10             	add    $0x10,%esp
+}
+  802c55:	89 d8                	mov    %ebx,%eax
+  802c57:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802c5a:	5b                   	pop    %ebx
+  802c5b:	5e                   	pop    %esi
+  802c5c:	5d                   	pop    %ebp
+  802c5d:	c3                   	ret
+
+00802c5e <accept>:
+{
+  802c5e:	55                   	push   %ebp
+  802c5f:	89 e5                	mov    %esp,%ebp
+  802c61:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802c64:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c67:	e8 4e ff ff ff       	call   802bba <fd2sockid>
+  802c6c:	85 c0                	test   %eax,%eax
+  802c6e:	78 1b                	js     802c8b <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  802c70:	83 ec 04             	sub    $0x4,%esp
+  802c73:	ff 75 10             	push   0x10(%ebp)
+  802c76:	ff 75 0c             	push   0xc(%ebp)
+  802c79:	50                   	push   %eax
+  802c7a:	e8 0e 01 00 00       	call   802d8d <nsipc_accept>
+  802c7f:	83 c4 10             	add    $0x10,%esp
+  802c82:	85 c0                	test   %eax,%eax
+  802c84:	78 05                	js     802c8b <accept+0x2d>
+	return alloc_sockfd(r);
+  802c86:	e8 5f ff ff ff       	call   802bea <alloc_sockfd>
+}
+  802c8b:	c9                   	leave
+  802c8c:	c3                   	ret
+
+00802c8d <bind>:
+{
+  802c8d:	55                   	push   %ebp
+  802c8e:	89 e5                	mov    %esp,%ebp
+  802c90:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802c93:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c96:	e8 1f ff ff ff       	call   802bba <fd2sockid>
+  802c9b:	85 c0                	test   %eax,%eax
+  802c9d:	78 12                	js     802cb1 <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  802c9f:	83 ec 04             	sub    $0x4,%esp
+  802ca2:	ff 75 10             	push   0x10(%ebp)
+  802ca5:	ff 75 0c             	push   0xc(%ebp)
+  802ca8:	50                   	push   %eax
+  802ca9:	e8 31 01 00 00       	call   802ddf <nsipc_bind>
+  802cae:	83 c4 10             	add    $0x10,%esp
+}
+  802cb1:	c9                   	leave
+  802cb2:	c3                   	ret
+
+00802cb3 <shutdown>:
+{
+  802cb3:	55                   	push   %ebp
+  802cb4:	89 e5                	mov    %esp,%ebp
+  802cb6:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802cb9:	8b 45 08             	mov    0x8(%ebp),%eax
+  802cbc:	e8 f9 fe ff ff       	call   802bba <fd2sockid>
+  802cc1:	85 c0                	test   %eax,%eax
+  802cc3:	78 0f                	js     802cd4 <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  802cc5:	83 ec 08             	sub    $0x8,%esp
+  802cc8:	ff 75 0c             	push   0xc(%ebp)
+  802ccb:	50                   	push   %eax
+  802ccc:	e8 43 01 00 00       	call   802e14 <nsipc_shutdown>
+  802cd1:	83 c4 10             	add    $0x10,%esp
+}
+  802cd4:	c9                   	leave
+  802cd5:	c3                   	ret
+
+00802cd6 <connect>:
+{
+  802cd6:	55                   	push   %ebp
+  802cd7:	89 e5                	mov    %esp,%ebp
+  802cd9:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802cdc:	8b 45 08             	mov    0x8(%ebp),%eax
+  802cdf:	e8 d6 fe ff ff       	call   802bba <fd2sockid>
+  802ce4:	85 c0                	test   %eax,%eax
+  802ce6:	78 12                	js     802cfa <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  802ce8:	83 ec 04             	sub    $0x4,%esp
+  802ceb:	ff 75 10             	push   0x10(%ebp)
+  802cee:	ff 75 0c             	push   0xc(%ebp)
+  802cf1:	50                   	push   %eax
+  802cf2:	e8 59 01 00 00       	call   802e50 <nsipc_connect>
+  802cf7:	83 c4 10             	add    $0x10,%esp
+}
+  802cfa:	c9                   	leave
+  802cfb:	c3                   	ret
+
+00802cfc <listen>:
+{
+  802cfc:	55                   	push   %ebp
+  802cfd:	89 e5                	mov    %esp,%ebp
+  802cff:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802d02:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d05:	e8 b0 fe ff ff       	call   802bba <fd2sockid>
+  802d0a:	85 c0                	test   %eax,%eax
+  802d0c:	78 0f                	js     802d1d <listen+0x21>
+	return nsipc_listen(r, backlog);
+  802d0e:	83 ec 08             	sub    $0x8,%esp
+  802d11:	ff 75 0c             	push   0xc(%ebp)
+  802d14:	50                   	push   %eax
+  802d15:	e8 6b 01 00 00       	call   802e85 <nsipc_listen>
+  802d1a:	83 c4 10             	add    $0x10,%esp
+}
+  802d1d:	c9                   	leave
+  802d1e:	c3                   	ret
+
+00802d1f <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  802d1f:	55                   	push   %ebp
+  802d20:	89 e5                	mov    %esp,%ebp
+  802d22:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  802d25:	ff 75 10             	push   0x10(%ebp)
+  802d28:	ff 75 0c             	push   0xc(%ebp)
+  802d2b:	ff 75 08             	push   0x8(%ebp)
+  802d2e:	e8 41 02 00 00       	call   802f74 <nsipc_socket>
+  802d33:	83 c4 10             	add    $0x10,%esp
+  802d36:	85 c0                	test   %eax,%eax
+  802d38:	78 05                	js     802d3f <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  802d3a:	e8 ab fe ff ff       	call   802bea <alloc_sockfd>
+}
+  802d3f:	c9                   	leave
+  802d40:	c3                   	ret
+
+00802d41 <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  802d41:	55                   	push   %ebp
+  802d42:	89 e5                	mov    %esp,%ebp
+  802d44:	53                   	push   %ebx
+  802d45:	83 ec 04             	sub    $0x4,%esp
+  802d48:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  802d4a:	83 3d 00 b0 81 00 00 	cmpl   $0x0,0x81b000
+  802d51:	74 26                	je     802d79 <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  802d53:	6a 07                	push   $0x7
+  802d55:	68 00 a0 81 00       	push   $0x81a000
+  802d5a:	53                   	push   %ebx
+  802d5b:	ff 35 00 b0 81 00    	push   0x81b000
+  802d61:	e8 76 0a 00 00       	call   8037dc <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  802d66:	83 c4 0c             	add    $0xc,%esp
+  802d69:	6a 00                	push   $0x0
+  802d6b:	6a 00                	push   $0x0
+  802d6d:	6a 00                	push   $0x0
+  802d6f:	e8 fd 09 00 00       	call   803771 <ipc_recv>
+}
+  802d74:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802d77:	c9                   	leave
+  802d78:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  802d79:	83 ec 0c             	sub    $0xc,%esp
+  802d7c:	6a 02                	push   $0x2
+  802d7e:	e8 92 0b 00 00       	call   803915 <ipc_find_env>
+  802d83:	a3 00 b0 81 00       	mov    %eax,0x81b000
+  802d88:	83 c4 10             	add    $0x10,%esp
+  802d8b:	eb c6                	jmp    802d53 <nsipc+0x12>
+
+00802d8d <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  802d8d:	55                   	push   %ebp
+  802d8e:	89 e5                	mov    %esp,%ebp
+  802d90:	56                   	push   %esi
+  802d91:	53                   	push   %ebx
+  802d92:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  802d95:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d98:	a3 00 a0 81 00       	mov    %eax,0x81a000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  802d9d:	8b 06                	mov    (%esi),%eax
+  802d9f:	a3 04 a0 81 00       	mov    %eax,0x81a004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  802da4:	b8 01 00 00 00       	mov    $0x1,%eax
+  802da9:	e8 93 ff ff ff       	call   802d41 <nsipc>
+  802dae:	89 c3                	mov    %eax,%ebx
+  802db0:	85 c0                	test   %eax,%eax
+  802db2:	79 09                	jns    802dbd <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  802db4:	89 d8                	mov    %ebx,%eax
+  802db6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802db9:	5b                   	pop    %ebx
+  802dba:	5e                   	pop    %esi
+  802dbb:	5d                   	pop    %ebp
+  802dbc:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  802dbd:	83 ec 04             	sub    $0x4,%esp
+  802dc0:	ff 35 10 a0 81 00    	push   0x81a010
+  802dc6:	68 00 a0 81 00       	push   $0x81a000
+  802dcb:	ff 75 0c             	push   0xc(%ebp)
+  802dce:	e8 47 e0 ff ff       	call   800e1a <memmove>
+		*addrlen = ret->ret_addrlen;
+  802dd3:	a1 10 a0 81 00       	mov    0x81a010,%eax
+  802dd8:	89 06                	mov    %eax,(%esi)
+  802dda:	83 c4 10             	add    $0x10,%esp
+	return r;
+  802ddd:	eb d5                	jmp    802db4 <nsipc_accept+0x27>
+
+00802ddf <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  802ddf:	55                   	push   %ebp
+  802de0:	89 e5                	mov    %esp,%ebp
+  802de2:	53                   	push   %ebx
+  802de3:	83 ec 08             	sub    $0x8,%esp
+  802de6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  802de9:	8b 45 08             	mov    0x8(%ebp),%eax
+  802dec:	a3 00 a0 81 00       	mov    %eax,0x81a000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  802df1:	53                   	push   %ebx
+  802df2:	ff 75 0c             	push   0xc(%ebp)
+  802df5:	68 04 a0 81 00       	push   $0x81a004
+  802dfa:	e8 1b e0 ff ff       	call   800e1a <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  802dff:	89 1d 14 a0 81 00    	mov    %ebx,0x81a014
+	return nsipc(NSREQ_BIND);
+  802e05:	b8 02 00 00 00       	mov    $0x2,%eax
+  802e0a:	e8 32 ff ff ff       	call   802d41 <nsipc>
+}
+  802e0f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802e12:	c9                   	leave
+  802e13:	c3                   	ret
+
+00802e14 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  802e14:	55                   	push   %ebp
+  802e15:	89 e5                	mov    %esp,%ebp
+  802e17:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  802e1a:	8b 45 08             	mov    0x8(%ebp),%eax
+  802e1d:	a3 00 a0 81 00       	mov    %eax,0x81a000
+	nsipcbuf.shutdown.req_how = how;
+  802e22:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802e25:	a3 04 a0 81 00       	mov    %eax,0x81a004
+	return nsipc(NSREQ_SHUTDOWN);
+  802e2a:	b8 03 00 00 00       	mov    $0x3,%eax
+  802e2f:	e8 0d ff ff ff       	call   802d41 <nsipc>
+}
+  802e34:	c9                   	leave
+  802e35:	c3                   	ret
+
+00802e36 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  802e36:	55                   	push   %ebp
+  802e37:	89 e5                	mov    %esp,%ebp
+  802e39:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  802e3c:	8b 45 08             	mov    0x8(%ebp),%eax
+  802e3f:	a3 00 a0 81 00       	mov    %eax,0x81a000
+	return nsipc(NSREQ_CLOSE);
+  802e44:	b8 04 00 00 00       	mov    $0x4,%eax
+  802e49:	e8 f3 fe ff ff       	call   802d41 <nsipc>
+}
+  802e4e:	c9                   	leave
+  802e4f:	c3                   	ret
+
+00802e50 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  802e50:	55                   	push   %ebp
+  802e51:	89 e5                	mov    %esp,%ebp
+  802e53:	53                   	push   %ebx
+  802e54:	83 ec 08             	sub    $0x8,%esp
+  802e57:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  802e5a:	8b 45 08             	mov    0x8(%ebp),%eax
+  802e5d:	a3 00 a0 81 00       	mov    %eax,0x81a000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  802e62:	53                   	push   %ebx
+  802e63:	ff 75 0c             	push   0xc(%ebp)
+  802e66:	68 04 a0 81 00       	push   $0x81a004
+  802e6b:	e8 aa df ff ff       	call   800e1a <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  802e70:	89 1d 14 a0 81 00    	mov    %ebx,0x81a014
+	return nsipc(NSREQ_CONNECT);
+  802e76:	b8 05 00 00 00       	mov    $0x5,%eax
+  802e7b:	e8 c1 fe ff ff       	call   802d41 <nsipc>
+}
+  802e80:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802e83:	c9                   	leave
+  802e84:	c3                   	ret
+
+00802e85 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  802e85:	55                   	push   %ebp
+  802e86:	89 e5                	mov    %esp,%ebp
+  802e88:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  802e8b:	8b 45 08             	mov    0x8(%ebp),%eax
+  802e8e:	a3 00 a0 81 00       	mov    %eax,0x81a000
+	nsipcbuf.listen.req_backlog = backlog;
+  802e93:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802e96:	a3 04 a0 81 00       	mov    %eax,0x81a004
+	return nsipc(NSREQ_LISTEN);
+  802e9b:	b8 06 00 00 00       	mov    $0x6,%eax
+  802ea0:	e8 9c fe ff ff       	call   802d41 <nsipc>
+}
+  802ea5:	c9                   	leave
+  802ea6:	c3                   	ret
+
+00802ea7 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  802ea7:	55                   	push   %ebp
+  802ea8:	89 e5                	mov    %esp,%ebp
+  802eaa:	56                   	push   %esi
+  802eab:	53                   	push   %ebx
+  802eac:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  802eaf:	8b 45 08             	mov    0x8(%ebp),%eax
+  802eb2:	a3 00 a0 81 00       	mov    %eax,0x81a000
+	nsipcbuf.recv.req_len = len;
+  802eb7:	89 35 04 a0 81 00    	mov    %esi,0x81a004
+	nsipcbuf.recv.req_flags = flags;
+  802ebd:	8b 45 14             	mov    0x14(%ebp),%eax
+  802ec0:	a3 08 a0 81 00       	mov    %eax,0x81a008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  802ec5:	b8 07 00 00 00       	mov    $0x7,%eax
+  802eca:	e8 72 fe ff ff       	call   802d41 <nsipc>
+  802ecf:	89 c3                	mov    %eax,%ebx
+  802ed1:	85 c0                	test   %eax,%eax
+  802ed3:	78 22                	js     802ef7 <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  802ed5:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  802eda:	39 c6                	cmp    %eax,%esi
+  802edc:	0f 4e c6             	cmovle %esi,%eax
+  802edf:	39 c3                	cmp    %eax,%ebx
+  802ee1:	7f 1d                	jg     802f00 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  802ee3:	83 ec 04             	sub    $0x4,%esp
+  802ee6:	53                   	push   %ebx
+  802ee7:	68 00 a0 81 00       	push   $0x81a000
+  802eec:	ff 75 0c             	push   0xc(%ebp)
+  802eef:	e8 26 df ff ff       	call   800e1a <memmove>
+  802ef4:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  802ef7:	89 d8                	mov    %ebx,%eax
+  802ef9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802efc:	5b                   	pop    %ebx
+  802efd:	5e                   	pop    %esi
+  802efe:	5d                   	pop    %ebp
+  802eff:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  802f00:	68 42 43 80 00       	push   $0x804342
+  802f05:	68 e0 42 80 00       	push   $0x8042e0
+  802f0a:	6a 62                	push   $0x62
+  802f0c:	68 57 43 80 00       	push   $0x804357
+  802f11:	e8 b5 d6 ff ff       	call   8005cb <_panic>
+
+00802f16 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  802f16:	55                   	push   %ebp
+  802f17:	89 e5                	mov    %esp,%ebp
+  802f19:	53                   	push   %ebx
+  802f1a:	83 ec 04             	sub    $0x4,%esp
+  802f1d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  802f20:	8b 45 08             	mov    0x8(%ebp),%eax
+  802f23:	a3 00 a0 81 00       	mov    %eax,0x81a000
+	assert(size < 1600);
+  802f28:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  802f2e:	7f 2e                	jg     802f5e <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  802f30:	83 ec 04             	sub    $0x4,%esp
+  802f33:	53                   	push   %ebx
+  802f34:	ff 75 0c             	push   0xc(%ebp)
+  802f37:	68 0c a0 81 00       	push   $0x81a00c
+  802f3c:	e8 d9 de ff ff       	call   800e1a <memmove>
+	nsipcbuf.send.req_size = size;
+  802f41:	89 1d 04 a0 81 00    	mov    %ebx,0x81a004
+	nsipcbuf.send.req_flags = flags;
+  802f47:	8b 45 14             	mov    0x14(%ebp),%eax
+  802f4a:	a3 08 a0 81 00       	mov    %eax,0x81a008
+	return nsipc(NSREQ_SEND);
+  802f4f:	b8 08 00 00 00       	mov    $0x8,%eax
+  802f54:	e8 e8 fd ff ff       	call   802d41 <nsipc>
+}
+  802f59:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802f5c:	c9                   	leave
+  802f5d:	c3                   	ret
+	assert(size < 1600);
+  802f5e:	68 63 43 80 00       	push   $0x804363
+  802f63:	68 e0 42 80 00       	push   $0x8042e0
+  802f68:	6a 6d                	push   $0x6d
+  802f6a:	68 57 43 80 00       	push   $0x804357
+  802f6f:	e8 57 d6 ff ff       	call   8005cb <_panic>
+
+00802f74 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  802f74:	55                   	push   %ebp
+  802f75:	89 e5                	mov    %esp,%ebp
+  802f77:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  802f7a:	8b 45 08             	mov    0x8(%ebp),%eax
+  802f7d:	a3 00 a0 81 00       	mov    %eax,0x81a000
+	nsipcbuf.socket.req_type = type;
+  802f82:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802f85:	a3 04 a0 81 00       	mov    %eax,0x81a004
+	nsipcbuf.socket.req_protocol = protocol;
+  802f8a:	8b 45 10             	mov    0x10(%ebp),%eax
+  802f8d:	a3 08 a0 81 00       	mov    %eax,0x81a008
+	return nsipc(NSREQ_SOCKET);
+  802f92:	b8 09 00 00 00       	mov    $0x9,%eax
+  802f97:	e8 a5 fd ff ff       	call   802d41 <nsipc>
+}
+  802f9c:	c9                   	leave
+  802f9d:	c3                   	ret
+
+00802f9e <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  802f9e:	55                   	push   %ebp
+  802f9f:	89 e5                	mov    %esp,%ebp
+  802fa1:	56                   	push   %esi
+  802fa2:	53                   	push   %ebx
+  802fa3:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  802fa6:	83 ec 0c             	sub    $0xc,%esp
+  802fa9:	ff 75 08             	push   0x8(%ebp)
+  802fac:	e8 00 e5 ff ff       	call   8014b1 <fd2data>
+  802fb1:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  802fb3:	83 c4 08             	add    $0x8,%esp
+  802fb6:	68 6f 43 80 00       	push   $0x80436f
+  802fbb:	53                   	push   %ebx
+  802fbc:	e8 d3 dc ff ff       	call   800c94 <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  802fc1:	8b 46 04             	mov    0x4(%esi),%eax
+  802fc4:	2b 06                	sub    (%esi),%eax
+  802fc6:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  802fcc:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  802fd3:	00 00 00 
+	stat->st_dev = &devpipe;
+  802fd6:	c7 83 88 00 00 00 60 	movl   $0x805060,0x88(%ebx)
+  802fdd:	50 80 00 
+	return 0;
+}
+  802fe0:	b8 00 00 00 00       	mov    $0x0,%eax
+  802fe5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802fe8:	5b                   	pop    %ebx
+  802fe9:	5e                   	pop    %esi
+  802fea:	5d                   	pop    %ebp
+  802feb:	c3                   	ret
+
+00802fec <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  802fec:	55                   	push   %ebp
+  802fed:	89 e5                	mov    %esp,%ebp
+  802fef:	53                   	push   %ebx
+  802ff0:	83 ec 0c             	sub    $0xc,%esp
+  802ff3:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  802ff6:	53                   	push   %ebx
+  802ff7:	6a 00                	push   $0x0
+  802ff9:	e8 2f e1 ff ff       	call   80112d <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  802ffe:	89 1c 24             	mov    %ebx,(%esp)
+  803001:	e8 ab e4 ff ff       	call   8014b1 <fd2data>
+  803006:	83 c4 08             	add    $0x8,%esp
+  803009:	50                   	push   %eax
+  80300a:	6a 00                	push   $0x0
+  80300c:	e8 1c e1 ff ff       	call   80112d <sys_page_unmap>
+}
+  803011:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803014:	c9                   	leave
+  803015:	c3                   	ret
+
+00803016 <_pipeisclosed>:
+{
+  803016:	55                   	push   %ebp
+  803017:	89 e5                	mov    %esp,%ebp
+  803019:	57                   	push   %edi
+  80301a:	56                   	push   %esi
+  80301b:	53                   	push   %ebx
+  80301c:	83 ec 1c             	sub    $0x1c,%esp
+  80301f:	89 c7                	mov    %eax,%edi
+  803021:	89 d6                	mov    %edx,%esi
+		n = thisenv->env_runs;
+  803023:	a1 c0 78 81 00       	mov    0x8178c0,%eax
+  803028:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  80302b:	83 ec 0c             	sub    $0xc,%esp
+  80302e:	57                   	push   %edi
+  80302f:	e8 20 09 00 00       	call   803954 <pageref>
+  803034:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  803037:	89 34 24             	mov    %esi,(%esp)
+  80303a:	e8 15 09 00 00       	call   803954 <pageref>
+		nn = thisenv->env_runs;
+  80303f:	8b 15 c0 78 81 00    	mov    0x8178c0,%edx
+  803045:	8b 4a 58             	mov    0x58(%edx),%ecx
+		if (n == nn)
+  803048:	83 c4 10             	add    $0x10,%esp
+  80304b:	39 cb                	cmp    %ecx,%ebx
+  80304d:	74 1b                	je     80306a <_pipeisclosed+0x54>
+		if (n != nn && ret == 1)
+  80304f:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  803052:	75 cf                	jne    803023 <_pipeisclosed+0xd>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  803054:	8b 42 58             	mov    0x58(%edx),%eax
+  803057:	6a 01                	push   $0x1
+  803059:	50                   	push   %eax
+  80305a:	53                   	push   %ebx
+  80305b:	68 76 43 80 00       	push   $0x804376
+  803060:	e8 41 d6 ff ff       	call   8006a6 <cprintf>
+  803065:	83 c4 10             	add    $0x10,%esp
+  803068:	eb b9                	jmp    803023 <_pipeisclosed+0xd>
+		ret = pageref(fd) == pageref(p);
+  80306a:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  80306d:	0f 94 c0             	sete   %al
+  803070:	0f b6 c0             	movzbl %al,%eax
+}
+  803073:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803076:	5b                   	pop    %ebx
+  803077:	5e                   	pop    %esi
+  803078:	5f                   	pop    %edi
+  803079:	5d                   	pop    %ebp
+  80307a:	c3                   	ret
+
+0080307b <devpipe_write>:
+{
+  80307b:	55                   	push   %ebp
+  80307c:	89 e5                	mov    %esp,%ebp
+  80307e:	57                   	push   %edi
+  80307f:	56                   	push   %esi
+  803080:	53                   	push   %ebx
+  803081:	83 ec 28             	sub    $0x28,%esp
+  803084:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  803087:	56                   	push   %esi
+  803088:	e8 24 e4 ff ff       	call   8014b1 <fd2data>
+  80308d:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  80308f:	83 c4 10             	add    $0x10,%esp
+  803092:	bf 00 00 00 00       	mov    $0x0,%edi
+  803097:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  80309a:	75 09                	jne    8030a5 <devpipe_write+0x2a>
+	return i;
+  80309c:	89 f8                	mov    %edi,%eax
+  80309e:	eb 23                	jmp    8030c3 <devpipe_write+0x48>
+			sys_yield();
+  8030a0:	e8 dc df ff ff       	call   801081 <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  8030a5:	8b 43 04             	mov    0x4(%ebx),%eax
+  8030a8:	8b 0b                	mov    (%ebx),%ecx
+  8030aa:	8d 51 20             	lea    0x20(%ecx),%edx
+  8030ad:	39 d0                	cmp    %edx,%eax
+  8030af:	72 1a                	jb     8030cb <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  8030b1:	89 da                	mov    %ebx,%edx
+  8030b3:	89 f0                	mov    %esi,%eax
+  8030b5:	e8 5c ff ff ff       	call   803016 <_pipeisclosed>
+  8030ba:	85 c0                	test   %eax,%eax
+  8030bc:	74 e2                	je     8030a0 <devpipe_write+0x25>
+				return 0;
+  8030be:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8030c3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8030c6:	5b                   	pop    %ebx
+  8030c7:	5e                   	pop    %esi
+  8030c8:	5f                   	pop    %edi
+  8030c9:	5d                   	pop    %ebp
+  8030ca:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  8030cb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8030ce:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  8030d2:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  8030d5:	89 c2                	mov    %eax,%edx
+  8030d7:	c1 fa 1f             	sar    $0x1f,%edx
+  8030da:	89 d1                	mov    %edx,%ecx
+  8030dc:	c1 e9 1b             	shr    $0x1b,%ecx
+  8030df:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  8030e2:	83 e2 1f             	and    $0x1f,%edx
+  8030e5:	29 ca                	sub    %ecx,%edx
+  8030e7:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  8030eb:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  8030ef:	83 c0 01             	add    $0x1,%eax
+  8030f2:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  8030f5:	83 c7 01             	add    $0x1,%edi
+  8030f8:	eb 9d                	jmp    803097 <devpipe_write+0x1c>
+
+008030fa <devpipe_read>:
+{
+  8030fa:	55                   	push   %ebp
+  8030fb:	89 e5                	mov    %esp,%ebp
+  8030fd:	57                   	push   %edi
+  8030fe:	56                   	push   %esi
+  8030ff:	53                   	push   %ebx
+  803100:	83 ec 18             	sub    $0x18,%esp
+  803103:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  803106:	57                   	push   %edi
+  803107:	e8 a5 e3 ff ff       	call   8014b1 <fd2data>
+  80310c:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  80310e:	83 c4 10             	add    $0x10,%esp
+  803111:	be 00 00 00 00       	mov    $0x0,%esi
+  803116:	3b 75 10             	cmp    0x10(%ebp),%esi
+  803119:	75 13                	jne    80312e <devpipe_read+0x34>
+	return i;
+  80311b:	89 f0                	mov    %esi,%eax
+  80311d:	eb 02                	jmp    803121 <devpipe_read+0x27>
+				return i;
+  80311f:	89 f0                	mov    %esi,%eax
+}
+  803121:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803124:	5b                   	pop    %ebx
+  803125:	5e                   	pop    %esi
+  803126:	5f                   	pop    %edi
+  803127:	5d                   	pop    %ebp
+  803128:	c3                   	ret
+			sys_yield();
+  803129:	e8 53 df ff ff       	call   801081 <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  80312e:	8b 03                	mov    (%ebx),%eax
+  803130:	3b 43 04             	cmp    0x4(%ebx),%eax
+  803133:	75 18                	jne    80314d <devpipe_read+0x53>
+			if (i > 0)
+  803135:	85 f6                	test   %esi,%esi
+  803137:	75 e6                	jne    80311f <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  803139:	89 da                	mov    %ebx,%edx
+  80313b:	89 f8                	mov    %edi,%eax
+  80313d:	e8 d4 fe ff ff       	call   803016 <_pipeisclosed>
+  803142:	85 c0                	test   %eax,%eax
+  803144:	74 e3                	je     803129 <devpipe_read+0x2f>
+				return 0;
+  803146:	b8 00 00 00 00       	mov    $0x0,%eax
+  80314b:	eb d4                	jmp    803121 <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  80314d:	99                   	cltd
+  80314e:	c1 ea 1b             	shr    $0x1b,%edx
+  803151:	01 d0                	add    %edx,%eax
+  803153:	83 e0 1f             	and    $0x1f,%eax
+  803156:	29 d0                	sub    %edx,%eax
+  803158:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  80315d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  803160:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  803163:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  803166:	83 c6 01             	add    $0x1,%esi
+  803169:	eb ab                	jmp    803116 <devpipe_read+0x1c>
+
+0080316b <pipe>:
+{
+  80316b:	55                   	push   %ebp
+  80316c:	89 e5                	mov    %esp,%ebp
+  80316e:	56                   	push   %esi
+  80316f:	53                   	push   %ebx
+  803170:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  803173:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803176:	50                   	push   %eax
+  803177:	e8 4c e3 ff ff       	call   8014c8 <fd_alloc>
+  80317c:	89 c3                	mov    %eax,%ebx
+  80317e:	83 c4 10             	add    $0x10,%esp
+  803181:	85 c0                	test   %eax,%eax
+  803183:	0f 88 23 01 00 00    	js     8032ac <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803189:	83 ec 04             	sub    $0x4,%esp
+  80318c:	68 07 04 00 00       	push   $0x407
+  803191:	ff 75 f4             	push   -0xc(%ebp)
+  803194:	6a 00                	push   $0x0
+  803196:	e8 05 df ff ff       	call   8010a0 <sys_page_alloc>
+  80319b:	89 c3                	mov    %eax,%ebx
+  80319d:	83 c4 10             	add    $0x10,%esp
+  8031a0:	85 c0                	test   %eax,%eax
+  8031a2:	0f 88 04 01 00 00    	js     8032ac <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  8031a8:	83 ec 0c             	sub    $0xc,%esp
+  8031ab:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8031ae:	50                   	push   %eax
+  8031af:	e8 14 e3 ff ff       	call   8014c8 <fd_alloc>
+  8031b4:	89 c3                	mov    %eax,%ebx
+  8031b6:	83 c4 10             	add    $0x10,%esp
+  8031b9:	85 c0                	test   %eax,%eax
+  8031bb:	0f 88 db 00 00 00    	js     80329c <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8031c1:	83 ec 04             	sub    $0x4,%esp
+  8031c4:	68 07 04 00 00       	push   $0x407
+  8031c9:	ff 75 f0             	push   -0x10(%ebp)
+  8031cc:	6a 00                	push   $0x0
+  8031ce:	e8 cd de ff ff       	call   8010a0 <sys_page_alloc>
+  8031d3:	89 c3                	mov    %eax,%ebx
+  8031d5:	83 c4 10             	add    $0x10,%esp
+  8031d8:	85 c0                	test   %eax,%eax
+  8031da:	0f 88 bc 00 00 00    	js     80329c <pipe+0x131>
+	va = fd2data(fd0);
+  8031e0:	83 ec 0c             	sub    $0xc,%esp
+  8031e3:	ff 75 f4             	push   -0xc(%ebp)
+  8031e6:	e8 c6 e2 ff ff       	call   8014b1 <fd2data>
+  8031eb:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8031ed:	83 c4 0c             	add    $0xc,%esp
+  8031f0:	68 07 04 00 00       	push   $0x407
+  8031f5:	50                   	push   %eax
+  8031f6:	6a 00                	push   $0x0
+  8031f8:	e8 a3 de ff ff       	call   8010a0 <sys_page_alloc>
+  8031fd:	89 c3                	mov    %eax,%ebx
+  8031ff:	83 c4 10             	add    $0x10,%esp
+  803202:	85 c0                	test   %eax,%eax
+  803204:	0f 88 82 00 00 00    	js     80328c <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80320a:	83 ec 0c             	sub    $0xc,%esp
+  80320d:	ff 75 f0             	push   -0x10(%ebp)
+  803210:	e8 9c e2 ff ff       	call   8014b1 <fd2data>
+  803215:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  80321c:	50                   	push   %eax
+  80321d:	6a 00                	push   $0x0
+  80321f:	56                   	push   %esi
+  803220:	6a 00                	push   $0x0
+  803222:	e8 c4 de ff ff       	call   8010eb <sys_page_map>
+  803227:	89 c3                	mov    %eax,%ebx
+  803229:	83 c4 20             	add    $0x20,%esp
+  80322c:	85 c0                	test   %eax,%eax
+  80322e:	78 4e                	js     80327e <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  803230:	a1 60 50 80 00       	mov    0x805060,%eax
+  803235:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  803238:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  80323a:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80323d:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  803244:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  803247:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  803249:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  80324c:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  803253:	83 ec 0c             	sub    $0xc,%esp
+  803256:	ff 75 f4             	push   -0xc(%ebp)
+  803259:	e8 43 e2 ff ff       	call   8014a1 <fd2num>
+  80325e:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803261:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  803263:	83 c4 04             	add    $0x4,%esp
+  803266:	ff 75 f0             	push   -0x10(%ebp)
+  803269:	e8 33 e2 ff ff       	call   8014a1 <fd2num>
+  80326e:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803271:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  803274:	83 c4 10             	add    $0x10,%esp
+  803277:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80327c:	eb 2e                	jmp    8032ac <pipe+0x141>
+	sys_page_unmap(0, va);
+  80327e:	83 ec 08             	sub    $0x8,%esp
+  803281:	56                   	push   %esi
+  803282:	6a 00                	push   $0x0
+  803284:	e8 a4 de ff ff       	call   80112d <sys_page_unmap>
+  803289:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  80328c:	83 ec 08             	sub    $0x8,%esp
+  80328f:	ff 75 f0             	push   -0x10(%ebp)
+  803292:	6a 00                	push   $0x0
+  803294:	e8 94 de ff ff       	call   80112d <sys_page_unmap>
+  803299:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  80329c:	83 ec 08             	sub    $0x8,%esp
+  80329f:	ff 75 f4             	push   -0xc(%ebp)
+  8032a2:	6a 00                	push   $0x0
+  8032a4:	e8 84 de ff ff       	call   80112d <sys_page_unmap>
+  8032a9:	83 c4 10             	add    $0x10,%esp
+}
+  8032ac:	89 d8                	mov    %ebx,%eax
+  8032ae:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8032b1:	5b                   	pop    %ebx
+  8032b2:	5e                   	pop    %esi
+  8032b3:	5d                   	pop    %ebp
+  8032b4:	c3                   	ret
+
+008032b5 <pipeisclosed>:
+{
+  8032b5:	55                   	push   %ebp
+  8032b6:	89 e5                	mov    %esp,%ebp
+  8032b8:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8032bb:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8032be:	50                   	push   %eax
+  8032bf:	ff 75 08             	push   0x8(%ebp)
+  8032c2:	e8 57 e2 ff ff       	call   80151e <fd_lookup>
+  8032c7:	83 c4 10             	add    $0x10,%esp
+  8032ca:	85 c0                	test   %eax,%eax
+  8032cc:	78 18                	js     8032e6 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  8032ce:	83 ec 0c             	sub    $0xc,%esp
+  8032d1:	ff 75 f4             	push   -0xc(%ebp)
+  8032d4:	e8 d8 e1 ff ff       	call   8014b1 <fd2data>
+  8032d9:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  8032db:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8032de:	e8 33 fd ff ff       	call   803016 <_pipeisclosed>
+  8032e3:	83 c4 10             	add    $0x10,%esp
+}
+  8032e6:	c9                   	leave
+  8032e7:	c3                   	ret
+
+008032e8 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  8032e8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8032ed:	c3                   	ret
+
+008032ee <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  8032ee:	55                   	push   %ebp
+  8032ef:	89 e5                	mov    %esp,%ebp
+  8032f1:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  8032f4:	68 8e 43 80 00       	push   $0x80438e
+  8032f9:	ff 75 0c             	push   0xc(%ebp)
+  8032fc:	e8 93 d9 ff ff       	call   800c94 <strcpy>
+	return 0;
+}
+  803301:	b8 00 00 00 00       	mov    $0x0,%eax
+  803306:	c9                   	leave
+  803307:	c3                   	ret
+
+00803308 <devcons_write>:
+{
+  803308:	55                   	push   %ebp
+  803309:	89 e5                	mov    %esp,%ebp
+  80330b:	57                   	push   %edi
+  80330c:	56                   	push   %esi
+  80330d:	53                   	push   %ebx
+  80330e:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  803314:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  803319:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  80331f:	eb 2e                	jmp    80334f <devcons_write+0x47>
+		m = n - tot;
+  803321:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  803324:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  803326:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  80332b:	39 c3                	cmp    %eax,%ebx
+  80332d:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  803330:	83 ec 04             	sub    $0x4,%esp
+  803333:	53                   	push   %ebx
+  803334:	89 f0                	mov    %esi,%eax
+  803336:	03 45 0c             	add    0xc(%ebp),%eax
+  803339:	50                   	push   %eax
+  80333a:	57                   	push   %edi
+  80333b:	e8 da da ff ff       	call   800e1a <memmove>
+		sys_cputs(buf, m);
+  803340:	83 c4 08             	add    $0x8,%esp
+  803343:	53                   	push   %ebx
+  803344:	57                   	push   %edi
+  803345:	e8 7a dc ff ff       	call   800fc4 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  80334a:	01 de                	add    %ebx,%esi
+  80334c:	83 c4 10             	add    $0x10,%esp
+  80334f:	3b 75 10             	cmp    0x10(%ebp),%esi
+  803352:	72 cd                	jb     803321 <devcons_write+0x19>
+}
+  803354:	89 f0                	mov    %esi,%eax
+  803356:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803359:	5b                   	pop    %ebx
+  80335a:	5e                   	pop    %esi
+  80335b:	5f                   	pop    %edi
+  80335c:	5d                   	pop    %ebp
+  80335d:	c3                   	ret
+
+0080335e <devcons_read>:
+{
+  80335e:	55                   	push   %ebp
+  80335f:	89 e5                	mov    %esp,%ebp
+  803361:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  803364:	b8 00 00 00 00       	mov    $0x0,%eax
+  803369:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  80336d:	75 07                	jne    803376 <devcons_read+0x18>
+  80336f:	eb 1f                	jmp    803390 <devcons_read+0x32>
+		sys_yield();
+  803371:	e8 0b dd ff ff       	call   801081 <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  803376:	e8 6f dc ff ff       	call   800fea <sys_cgetc>
+  80337b:	85 c0                	test   %eax,%eax
+  80337d:	74 f2                	je     803371 <devcons_read+0x13>
+	if (c < 0)
+  80337f:	78 0f                	js     803390 <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  803381:	83 f8 04             	cmp    $0x4,%eax
+  803384:	74 0c                	je     803392 <devcons_read+0x34>
+	*(char*)vbuf = c;
+  803386:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803389:	88 02                	mov    %al,(%edx)
+	return 1;
+  80338b:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  803390:	c9                   	leave
+  803391:	c3                   	ret
+		return 0;
+  803392:	b8 00 00 00 00       	mov    $0x0,%eax
+  803397:	eb f7                	jmp    803390 <devcons_read+0x32>
+
+00803399 <cputchar>:
+{
+  803399:	55                   	push   %ebp
+  80339a:	89 e5                	mov    %esp,%ebp
+  80339c:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  80339f:	8b 45 08             	mov    0x8(%ebp),%eax
+  8033a2:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  8033a5:	6a 01                	push   $0x1
+  8033a7:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8033aa:	50                   	push   %eax
+  8033ab:	e8 14 dc ff ff       	call   800fc4 <sys_cputs>
+}
+  8033b0:	83 c4 10             	add    $0x10,%esp
+  8033b3:	c9                   	leave
+  8033b4:	c3                   	ret
+
+008033b5 <getchar>:
+{
+  8033b5:	55                   	push   %ebp
+  8033b6:	89 e5                	mov    %esp,%ebp
+  8033b8:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  8033bb:	6a 01                	push   $0x1
+  8033bd:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8033c0:	50                   	push   %eax
+  8033c1:	6a 00                	push   $0x0
+  8033c3:	e8 bc e3 ff ff       	call   801784 <read>
+	if (r < 0)
+  8033c8:	83 c4 10             	add    $0x10,%esp
+  8033cb:	85 c0                	test   %eax,%eax
+  8033cd:	78 06                	js     8033d5 <getchar+0x20>
+	if (r < 1)
+  8033cf:	74 06                	je     8033d7 <getchar+0x22>
+	return c;
+  8033d1:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  8033d5:	c9                   	leave
+  8033d6:	c3                   	ret
+		return -E_EOF;
+  8033d7:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  8033dc:	eb f7                	jmp    8033d5 <getchar+0x20>
+
+008033de <iscons>:
+{
+  8033de:	55                   	push   %ebp
+  8033df:	89 e5                	mov    %esp,%ebp
+  8033e1:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8033e4:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8033e7:	50                   	push   %eax
+  8033e8:	ff 75 08             	push   0x8(%ebp)
+  8033eb:	e8 2e e1 ff ff       	call   80151e <fd_lookup>
+  8033f0:	83 c4 10             	add    $0x10,%esp
+  8033f3:	85 c0                	test   %eax,%eax
+  8033f5:	78 11                	js     803408 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  8033f7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8033fa:	8b 15 80 50 80 00    	mov    0x805080,%edx
+  803400:	39 10                	cmp    %edx,(%eax)
+  803402:	0f 94 c0             	sete   %al
+  803405:	0f b6 c0             	movzbl %al,%eax
+}
+  803408:	c9                   	leave
+  803409:	c3                   	ret
+
+0080340a <opencons>:
+{
+  80340a:	55                   	push   %ebp
+  80340b:	89 e5                	mov    %esp,%ebp
+  80340d:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  803410:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803413:	50                   	push   %eax
+  803414:	e8 af e0 ff ff       	call   8014c8 <fd_alloc>
+  803419:	83 c4 10             	add    $0x10,%esp
+  80341c:	85 c0                	test   %eax,%eax
+  80341e:	78 3a                	js     80345a <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  803420:	83 ec 04             	sub    $0x4,%esp
+  803423:	68 07 04 00 00       	push   $0x407
+  803428:	ff 75 f4             	push   -0xc(%ebp)
+  80342b:	6a 00                	push   $0x0
+  80342d:	e8 6e dc ff ff       	call   8010a0 <sys_page_alloc>
+  803432:	83 c4 10             	add    $0x10,%esp
+  803435:	85 c0                	test   %eax,%eax
+  803437:	78 21                	js     80345a <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  803439:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80343c:	8b 15 80 50 80 00    	mov    0x805080,%edx
+  803442:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  803444:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803447:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  80344e:	83 ec 0c             	sub    $0xc,%esp
+  803451:	50                   	push   %eax
+  803452:	e8 4a e0 ff ff       	call   8014a1 <fd2num>
+  803457:	83 c4 10             	add    $0x10,%esp
+}
+  80345a:	c9                   	leave
+  80345b:	c3                   	ret
+
+0080345c <copy_page_to>:
+// The handler cowpage found installed, which gets the faults that are
+// not copy-on-write faults.
+static void (*pgfault_next)(struct UTrapframe *utf);
+
+static int copy_page_to(envid_t envid, void *va, int perm)
+{
+  80345c:	55                   	push   %ebp
+  80345d:	89 e5                	mov    %esp,%ebp
+  80345f:	57                   	push   %edi
+  803460:	56                   	push   %esi
+  803461:	53                   	push   %ebx
+  803462:	83 ec 20             	sub    $0x20,%esp
+  803465:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  803468:	89 d7                	mov    %edx,%edi
+  80346a:	89 ce                	mov    %ecx,%esi
+	int r;
+
+	r = sys_page_alloc(0, (void *) PFTEMP, perm);
+  80346c:	51                   	push   %ecx
+  80346d:	68 00 f0 7f 00       	push   $0x7ff000
+  803472:	6a 00                	push   $0x0
+  803474:	e8 27 dc ff ff       	call   8010a0 <sys_page_alloc>
+  803479:	89 c3                	mov    %eax,%ebx
+	if (r < 0)
+  80347b:	83 c4 10             	add    $0x10,%esp
+  80347e:	85 c0                	test   %eax,%eax
+  803480:	78 45                	js     8034c7 <copy_page_to+0x6b>
+		goto exit;
+	memmove((void *) PFTEMP, va, PGSIZE);
+  803482:	83 ec 04             	sub    $0x4,%esp
+  803485:	68 00 10 00 00       	push   $0x1000
+  80348a:	57                   	push   %edi
+  80348b:	68 00 f0 7f 00       	push   $0x7ff000
+  803490:	e8 85 d9 ff ff       	call   800e1a <memmove>
+	r = sys_page_map(0, (void *) PFTEMP, envid, va, perm);
+  803495:	89 34 24             	mov    %esi,(%esp)
+  803498:	57                   	push   %edi
+  803499:	ff 75 e4             	push   -0x1c(%ebp)
+  80349c:	68 00 f0 7f 00       	push   $0x7ff000
+  8034a1:	6a 00                	push   $0x0
+  8034a3:	e8 43 dc ff ff       	call   8010eb <sys_page_map>
+  8034a8:	89 c3                	mov    %eax,%ebx
+	if (r < 0)
+  8034aa:	83 c4 20             	add    $0x20,%esp
+  8034ad:	85 c0                	test   %eax,%eax
+  8034af:	78 16                	js     8034c7 <copy_page_to+0x6b>
+		goto exit;
+	assert(!sys_page_unmap(0, (void *) PFTEMP));
+  8034b1:	83 ec 08             	sub    $0x8,%esp
+  8034b4:	68 00 f0 7f 00       	push   $0x7ff000
+  8034b9:	6a 00                	push   $0x0
+  8034bb:	e8 6d dc ff ff       	call   80112d <sys_page_unmap>
+  8034c0:	83 c4 10             	add    $0x10,%esp
+  8034c3:	85 c0                	test   %eax,%eax
+  8034c5:	75 0a                	jne    8034d1 <copy_page_to+0x75>
+exit:
+	return r;
+}
+  8034c7:	89 d8                	mov    %ebx,%eax
+  8034c9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8034cc:	5b                   	pop    %ebx
+  8034cd:	5e                   	pop    %esi
+  8034ce:	5f                   	pop    %edi
+  8034cf:	5d                   	pop    %ebp
+  8034d0:	c3                   	ret
+	assert(!sys_page_unmap(0, (void *) PFTEMP));
+  8034d1:	68 9c 43 80 00       	push   $0x80439c
+  8034d6:	68 e0 42 80 00       	push   $0x8042e0
+  8034db:	6a 1b                	push   $0x1b
+  8034dd:	68 14 44 80 00       	push   $0x804414
+  8034e2:	e8 e4 d0 ff ff       	call   8005cb <_panic>
+
+008034e7 <pgfault>:
+// map in our own private writable copy.  Other faults go to the handler
+// cowpage replaced, if any.
+//
+static void
+pgfault(struct UTrapframe *utf)
+{
+  8034e7:	55                   	push   %ebp
+  8034e8:	89 e5                	mov    %esp,%ebp
+  8034ea:	53                   	push   %ebx
+  8034eb:	83 ec 04             	sub    $0x4,%esp
+  8034ee:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	void *addr = (void *) utf->utf_fault_va;
+  8034f1:	8b 13                	mov    (%ebx),%edx
+	// Hint:
+	//   Use the read-only page table mappings at uvpt
+	//   (see <inc/memlayout.h>).
+
+	// LAB 4: Your code here.
+	if (!(err & FEC_WR) || !(uvpd[PDX(addr)] & PTE_P)
+  8034f3:	f6 43 04 02          	testb  $0x2,0x4(%ebx)
+  8034f7:	74 21                	je     80351a <pgfault+0x33>
+  8034f9:	89 d0                	mov    %edx,%eax
+  8034fb:	c1 e8 16             	shr    $0x16,%eax
+  8034fe:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  803505:	a8 01                	test   $0x1,%al
+  803507:	74 11                	je     80351a <pgfault+0x33>
+	    || !(uvpt[PGNUM(addr)] & PTE_COW)) {
+  803509:	89 d0                	mov    %edx,%eax
+  80350b:	c1 e8 0c             	shr    $0xc,%eax
+  80350e:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  803515:	f6 c4 08             	test   $0x8,%ah
+  803518:	75 17                	jne    803531 <pgfault+0x4a>
+		if (pgfault_next) {
+  80351a:	a1 04 b0 81 00       	mov    0x81b004,%eax
+  80351f:	85 c0                	test   %eax,%eax
+  803521:	74 27                	je     80354a <pgfault+0x63>
+			pgfault_next(utf);
+  803523:	83 ec 0c             	sub    $0xc,%esp
+  803526:	53                   	push   %ebx
+  803527:	ff d0                	call   *%eax
+			return;
+  803529:	83 c4 10             	add    $0x10,%esp
+exit:
+	cprintf("[%08x] pgfault: Can't handle page fault happened at"
+		"0x%08x, eip: 0x%08x. Exiting...\n", thisenv->env_id,
+		utf->utf_fault_va, utf->utf_eip);
+	sys_env_destroy(0);
+}
+  80352c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80352f:	c9                   	leave
+  803530:	c3                   	ret
+	if (copy_page_to(0, ROUNDDOWN(addr, PGSIZE), PTE_U | PTE_W | PTE_P) < 0)
+  803531:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+  803537:	b9 07 00 00 00       	mov    $0x7,%ecx
+  80353c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803541:	e8 16 ff ff ff       	call   80345c <copy_page_to>
+  803546:	85 c0                	test   %eax,%eax
+  803548:	79 e2                	jns    80352c <pgfault+0x45>
+		"0x%08x, eip: 0x%08x. Exiting...\n", thisenv->env_id,
+  80354a:	a1 c0 78 81 00       	mov    0x8178c0,%eax
+  80354f:	8b 40 48             	mov    0x48(%eax),%eax
+	cprintf("[%08x] pgfault: Can't handle page fault happened at"
+  803552:	ff 73 28             	push   0x28(%ebx)
+  803555:	ff 33                	push   (%ebx)
+  803557:	50                   	push   %eax
+  803558:	68 c0 43 80 00       	push   $0x8043c0
+  80355d:	e8 44 d1 ff ff       	call   8006a6 <cprintf>
+	sys_env_destroy(0);
+  803562:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  803569:	e8 a3 da ff ff       	call   801011 <sys_env_destroy>
+  80356e:	83 c4 10             	add    $0x10,%esp
+  803571:	eb b9                	jmp    80352c <pgfault+0x45>
+
+00803573 <cowpage>:
+//
+// Returns: 0 on success, < 0 on error.
+//
+int
+cowpage(void *va)
+{
+  803573:	55                   	push   %ebp
+  803574:	89 e5                	mov    %esp,%ebp
+  803576:	53                   	push   %ebx
+  803577:	83 ec 04             	sub    $0x4,%esp
+  80357a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (_pgfault_handler != pgfault) {
+  80357d:	a1 08 b0 81 00       	mov    0x81b008,%eax
+  803582:	3d e7 34 80 00       	cmp    $0x8034e7,%eax
+  803587:	74 15                	je     80359e <cowpage+0x2b>
+		pgfault_next = _pgfault_handler;
+  803589:	a3 04 b0 81 00       	mov    %eax,0x81b004
+		set_pgfault_handler(pgfault);
+  80358e:	83 ec 0c             	sub    $0xc,%esp
+  803591:	68 e7 34 80 00       	push   $0x8034e7
+  803596:	e8 fb 03 00 00       	call   803996 <set_pgfault_handler>
+  80359b:	83 c4 10             	add    $0x10,%esp
+	}
+	return sys_page_map(0, va, 0, va, PTE_COW | PTE_U | PTE_P);
+  80359e:	83 ec 0c             	sub    $0xc,%esp
+  8035a1:	68 05 08 00 00       	push   $0x805
+  8035a6:	53                   	push   %ebx
+  8035a7:	6a 00                	push   $0x0
+  8035a9:	53                   	push   %ebx
+  8035aa:	6a 00                	push   $0x0
+  8035ac:	e8 3a db ff ff       	call   8010eb <sys_page_map>
+}
+  8035b1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8035b4:	c9                   	leave
+  8035b5:	c3                   	ret
+
+008035b6 <fork>:
+//   Neither user exception stack should ever be marked copy-on-write,
+//   so you must allocate a new page for the child's user exception stack.
+//
+envid_t
+fork(void)
+{
+  8035b6:	55                   	push   %ebp
+  8035b7:	89 e5                	mov    %esp,%ebp
+  8035b9:	57                   	push   %edi
+  8035ba:	56                   	push   %esi
+  8035bb:	53                   	push   %ebx
+  8035bc:	83 ec 28             	sub    $0x28,%esp
+	// LAB 4: Your code here.
+	envid_t envid;
+	int r;
+
+	set_pgfault_handler(pgfault);
+  8035bf:	68 e7 34 80 00       	push   $0x8034e7
+  8035c4:	e8 cd 03 00 00       	call   803996 <set_pgfault_handler>
+// child pointing to the trashed stack frame.
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	asm volatile("int %2"
+  8035c9:	b8 07 00 00 00       	mov    $0x7,%eax
+  8035ce:	cd 30                	int    $0x30
+  8035d0:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8035d3:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	envid = sys_exofork();
+	if (envid < 0)
+  8035d6:	83 c4 10             	add    $0x10,%esp
+  8035d9:	85 c0                	test   %eax,%eax
+  8035db:	0f 88 6b 01 00 00    	js     80374c <fork+0x196>
+	else if (envid == 0) {
+		thisenv = &envs[ENVX(sys_getenvid())];
+		return 0;
+	}
+
+	for (uintptr_t addr = 0; addr < UTOP; addr += PGSIZE) {
+  8035e1:	bb 00 00 00 00       	mov    $0x0,%ebx
+	else if (envid == 0) {
+  8035e6:	75 37                	jne    80361f <fork+0x69>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  8035e8:	e8 6d da ff ff       	call   80105a <sys_getenvid>
+  8035ed:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8035f2:	69 c0 8c 00 00 00    	imul   $0x8c,%eax,%eax
+  8035f8:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8035fd:	a3 c0 78 81 00       	mov    %eax,0x8178c0
+		return 0;
+  803602:	e9 45 01 00 00       	jmp    80374c <fork+0x196>
+		if (!(uvpd[PDX(addr)] & PTE_P)) {
+			addr += PTSIZE - PGSIZE;
+  803607:	81 c3 00 f0 3f 00    	add    $0x3ff000,%ebx
+	for (uintptr_t addr = 0; addr < UTOP; addr += PGSIZE) {
+  80360d:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  803613:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  803619:	0f 87 ba 00 00 00    	ja     8036d9 <fork+0x123>
+		if (!(uvpd[PDX(addr)] & PTE_P)) {
+  80361f:	89 d8                	mov    %ebx,%eax
+  803621:	c1 e8 16             	shr    $0x16,%eax
+  803624:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  80362b:	a8 01                	test   $0x1,%al
+  80362d:	74 d8                	je     803607 <fork+0x51>
+			continue;
+		}
+		if (!(uvpt[PGNUM(addr)] & PTE_P))
+  80362f:	89 d8                	mov    %ebx,%eax
+  803631:	c1 e8 0c             	shr    $0xc,%eax
+  803634:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  80363b:	f6 c2 01             	test   $0x1,%dl
+  80363e:	74 cd                	je     80360d <fork+0x57>
+			continue;
+		if (addr == USTACKTOP - PGSIZE || addr == UXSTACKTOP - PGSIZE)
+  803640:	89 da                	mov    %ebx,%edx
+  803642:	80 e6 df             	and    $0xdf,%dh
+  803645:	81 fa 00 d0 bf ee    	cmp    $0xeebfd000,%edx
+  80364b:	74 c0                	je     80360d <fork+0x57>
+	void *va = (void *) (pn << PGSHIFT);
+  80364d:	89 df                	mov    %ebx,%edi
+	if ((uvpt[pn] & PTE_SHARE) ||
+  80364f:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  803656:	f6 c6 04             	test   $0x4,%dh
+  803659:	75 53                	jne    8036ae <fork+0xf8>
+	    (!(uvpt[pn] & PTE_COW) && !(uvpt[pn] & PTE_W)))
+  80365b:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+	if ((uvpt[pn] & PTE_SHARE) ||
+  803662:	f6 c6 08             	test   $0x8,%dh
+  803665:	75 0c                	jne    803673 <fork+0xbd>
+	    (!(uvpt[pn] & PTE_COW) && !(uvpt[pn] & PTE_W)))
+  803667:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  80366e:	f6 c2 02             	test   $0x2,%dl
+  803671:	74 3b                	je     8036ae <fork+0xf8>
+	r = sys_page_map(0, va, envid, va, PTE_COW | PTE_U | PTE_P);
+  803673:	83 ec 0c             	sub    $0xc,%esp
+  803676:	68 05 08 00 00       	push   $0x805
+  80367b:	57                   	push   %edi
+  80367c:	ff 75 e4             	push   -0x1c(%ebp)
+  80367f:	57                   	push   %edi
+  803680:	6a 00                	push   $0x0
+  803682:	e8 64 da ff ff       	call   8010eb <sys_page_map>
+  803687:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  803689:	83 c4 20             	add    $0x20,%esp
+  80368c:	85 c0                	test   %eax,%eax
+  80368e:	0f 88 a7 00 00 00    	js     80373b <fork+0x185>
+	r = sys_page_map(0, va, 0, va, PTE_COW | PTE_U | PTE_P);
+  803694:	83 ec 0c             	sub    $0xc,%esp
+  803697:	68 05 08 00 00       	push   $0x805
+  80369c:	57                   	push   %edi
+  80369d:	6a 00                	push   $0x0
+  80369f:	57                   	push   %edi
+  8036a0:	6a 00                	push   $0x0
+  8036a2:	e8 44 da ff ff       	call   8010eb <sys_page_map>
+  8036a7:	89 c6                	mov    %eax,%esi
+	return r;
+  8036a9:	83 c4 20             	add    $0x20,%esp
+  8036ac:	eb 21                	jmp    8036cf <fork+0x119>
+		return sys_page_map(0, va, envid, va, uvpt[pn] & PTE_SYSCALL);
+  8036ae:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8036b5:	83 ec 0c             	sub    $0xc,%esp
+  8036b8:	25 07 0e 00 00       	and    $0xe07,%eax
+  8036bd:	50                   	push   %eax
+  8036be:	57                   	push   %edi
+  8036bf:	ff 75 e4             	push   -0x1c(%ebp)
+  8036c2:	57                   	push   %edi
+  8036c3:	6a 00                	push   $0x0
+  8036c5:	e8 21 da ff ff       	call   8010eb <sys_page_map>
+  8036ca:	89 c6                	mov    %eax,%esi
+  8036cc:	83 c4 20             	add    $0x20,%esp
+			continue;
+		r = duppage(envid, PGNUM(addr));
+		if (r < 0)
+  8036cf:	85 f6                	test   %esi,%esi
+  8036d1:	0f 89 36 ff ff ff    	jns    80360d <fork+0x57>
+  8036d7:	eb 62                	jmp    80373b <fork+0x185>
+			goto exit;
+	}
+
+	r = copy_page_to(envid, (void *) USTACKTOP - PGSIZE, PTE_U | PTE_W | PTE_P);
+  8036d9:	b9 07 00 00 00       	mov    $0x7,%ecx
+  8036de:	ba 00 d0 bf ee       	mov    $0xeebfd000,%edx
+  8036e3:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  8036e6:	89 f8                	mov    %edi,%eax
+  8036e8:	e8 6f fd ff ff       	call   80345c <copy_page_to>
+  8036ed:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  8036ef:	85 c0                	test   %eax,%eax
+  8036f1:	78 48                	js     80373b <fork+0x185>
+		goto exit;
+	r = sys_page_alloc(envid, (void *) UXSTACKTOP - PGSIZE, PTE_U | PTE_W | PTE_P);
+  8036f3:	83 ec 04             	sub    $0x4,%esp
+  8036f6:	6a 07                	push   $0x7
+  8036f8:	68 00 f0 bf ee       	push   $0xeebff000
+  8036fd:	57                   	push   %edi
+  8036fe:	e8 9d d9 ff ff       	call   8010a0 <sys_page_alloc>
+  803703:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  803705:	83 c4 10             	add    $0x10,%esp
+  803708:	85 c0                	test   %eax,%eax
+  80370a:	78 2f                	js     80373b <fork+0x185>
+		goto exit;
+	r = sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall);
+  80370c:	a1 c0 78 81 00       	mov    0x8178c0,%eax
+  803711:	8b 40 64             	mov    0x64(%eax),%eax
+  803714:	83 ec 08             	sub    $0x8,%esp
+  803717:	50                   	push   %eax
+  803718:	57                   	push   %edi
+  803719:	e8 ed da ff ff       	call   80120b <sys_env_set_pgfault_upcall>
+  80371e:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  803720:	83 c4 10             	add    $0x10,%esp
+  803723:	85 c0                	test   %eax,%eax
+  803725:	78 14                	js     80373b <fork+0x185>
+		goto exit;
+	r = sys_env_set_status(envid, ENV_RUNNABLE);
+  803727:	83 ec 08             	sub    $0x8,%esp
+  80372a:	6a 02                	push   $0x2
+  80372c:	57                   	push   %edi
+  80372d:	e8 45 da ff ff       	call   801177 <sys_env_set_status>
+  803732:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  803734:	83 c4 10             	add    $0x10,%esp
+  803737:	85 c0                	test   %eax,%eax
+  803739:	79 11                	jns    80374c <fork+0x196>
+		goto exit;
+	return envid;
+exit:
+	sys_env_destroy(envid);
+  80373b:	83 ec 0c             	sub    $0xc,%esp
+  80373e:	ff 75 e0             	push   -0x20(%ebp)
+  803741:	e8 cb d8 ff ff       	call   801011 <sys_env_destroy>
+	return r;
+  803746:	83 c4 10             	add    $0x10,%esp
+  803749:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+}
+  80374c:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80374f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803752:	5b                   	pop    %ebx
+  803753:	5e                   	pop    %esi
+  803754:	5f                   	pop    %edi
+  803755:	5d                   	pop    %ebp
+  803756:	c3                   	ret
+
+00803757 <sfork>:
+
+// Challenge!
+int
+sfork(void)
+{
+  803757:	55                   	push   %ebp
+  803758:	89 e5                	mov    %esp,%ebp
+  80375a:	83 ec 0c             	sub    $0xc,%esp
+	panic("sfork not implemented");
+  80375d:	68 1f 44 80 00       	push   $0x80441f
+  803762:	68 bf 00 00 00       	push   $0xbf
+  803767:	68 14 44 80 00       	push   $0x804414
+  80376c:	e8 5a ce ff ff       	call   8005cb <_panic>
+
+00803771 <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  803771:	55                   	push   %ebp
+  803772:	89 e5                	mov    %esp,%ebp
+  803774:	56                   	push   %esi
+  803775:	53                   	push   %ebx
+  803776:	8b 75 08             	mov    0x8(%ebp),%esi
+  803779:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80377c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int r;
+
+	if (pg == NULL)
+		pg = (void *) UTOP;
+  80377f:	85 c0                	test   %eax,%eax
+  803781:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  803786:	0f 44 c2             	cmove  %edx,%eax
+
+	r = sys_ipc_recv(pg);
+  803789:	83 ec 0c             	sub    $0xc,%esp
+  80378c:	50                   	push   %eax
+  80378d:	e8 56 db ff ff       	call   8012e8 <sys_ipc_recv>
+	if (from_env_store)
+  803792:	83 c4 10             	add    $0x10,%esp
+  803795:	85 f6                	test   %esi,%esi
+  803797:	74 14                	je     8037ad <ipc_recv+0x3c>
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  803799:	ba 00 00 00 00       	mov    $0x0,%edx
+  80379e:	85 c0                	test   %eax,%eax
+  8037a0:	75 09                	jne    8037ab <ipc_recv+0x3a>
+  8037a2:	8b 15 c0 78 81 00    	mov    0x8178c0,%edx
+  8037a8:	8b 52 74             	mov    0x74(%edx),%edx
+  8037ab:	89 16                	mov    %edx,(%esi)
+	if (perm_store)
+  8037ad:	85 db                	test   %ebx,%ebx
+  8037af:	74 25                	je     8037d6 <ipc_recv+0x65>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  8037b1:	85 c0                	test   %eax,%eax
+  8037b3:	74 0d                	je     8037c2 <ipc_recv+0x51>
+  8037b5:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+	return r ?: thisenv->env_ipc_value;
+}
+  8037bb:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8037be:	5b                   	pop    %ebx
+  8037bf:	5e                   	pop    %esi
+  8037c0:	5d                   	pop    %ebp
+  8037c1:	c3                   	ret
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  8037c2:	a1 c0 78 81 00       	mov    0x8178c0,%eax
+  8037c7:	8b 40 78             	mov    0x78(%eax),%eax
+  8037ca:	89 03                	mov    %eax,(%ebx)
+	return r ?: thisenv->env_ipc_value;
+  8037cc:	a1 c0 78 81 00       	mov    0x8178c0,%eax
+  8037d1:	8b 40 70             	mov    0x70(%eax),%eax
+  8037d4:	eb e5                	jmp    8037bb <ipc_recv+0x4a>
+  8037d6:	85 c0                	test   %eax,%eax
+  8037d8:	75 e1                	jne    8037bb <ipc_recv+0x4a>
+  8037da:	eb f0                	jmp    8037cc <ipc_recv+0x5b>
+
+008037dc <ipc_send>:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  8037dc:	55                   	push   %ebp
+  8037dd:	89 e5                	mov    %esp,%ebp
+  8037df:	57                   	push   %edi
+  8037e0:	56                   	push   %esi
+  8037e1:	53                   	push   %ebx
+  8037e2:	83 ec 0c             	sub    $0xc,%esp
+  8037e5:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8037e8:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8037eb:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int r;
+
+	if (pg == NULL)
+		pg = (void *) UTOP;
+  8037ee:	85 db                	test   %ebx,%ebx
+  8037f0:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  8037f5:	0f 44 d8             	cmove  %eax,%ebx
+
+	while ((r = sys_ipc_try_send(to_env, val, pg, perm))) {
+  8037f8:	ff 75 14             	push   0x14(%ebp)
+  8037fb:	53                   	push   %ebx
+  8037fc:	56                   	push   %esi
+  8037fd:	57                   	push   %edi
+  8037fe:	e8 52 da ff ff       	call   801255 <sys_ipc_try_send>
+  803803:	83 c4 10             	add    $0x10,%esp
+  803806:	85 c0                	test   %eax,%eax
+  803808:	74 22                	je     80382c <ipc_send+0x50>
+		assert(r == -E_IPC_NOT_RECV);
+  80380a:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  80380d:	75 07                	jne    803816 <ipc_send+0x3a>
+		sys_yield();
+  80380f:	e8 6d d8 ff ff       	call   801081 <sys_yield>
+  803814:	eb e2                	jmp    8037f8 <ipc_send+0x1c>
+		assert(r == -E_IPC_NOT_RECV);
+  803816:	68 35 44 80 00       	push   $0x804435
+  80381b:	68 e0 42 80 00       	push   $0x8042e0
+  803820:	6a 39                	push   $0x39
+  803822:	68 4a 44 80 00       	push   $0x80444a
+  803827:	e8 9f cd ff ff       	call   8005cb <_panic>
+	}
+}
+  80382c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80382f:	5b                   	pop    %ebx
+  803830:	5e                   	pop    %esi
+  803831:	5f                   	pop    %edi
+  803832:	5d                   	pop    %ebp
+  803833:	c3                   	ret
+
+00803834 <ipc_recvv>:
+// Receive a value and up to *npages pages, mapped one after another
+// starting at 'pg'.  Like ipc_recv otherwise; also stores the number
+// of pages actually received in *npages (0 on error).
+int32_t
+ipc_recvv(envid_t *from_env_store, void *pg, int *npages, int *perm_store)
+{
+  803834:	55                   	push   %ebp
+  803835:	89 e5                	mov    %esp,%ebp
+  803837:	57                   	push   %edi
+  803838:	56                   	push   %esi
+  803839:	53                   	push   %ebx
+  80383a:	83 ec 10             	sub    $0x10,%esp
+  80383d:	8b 7d 08             	mov    0x8(%ebp),%edi
+  803840:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803843:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  803846:	8b 75 14             	mov    0x14(%ebp),%esi
+	int r;
+
+	if (pg == NULL)
+		pg = (void *) UTOP;
+  803849:	85 c0                	test   %eax,%eax
+  80384b:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  803850:	0f 44 c2             	cmove  %edx,%eax
+
+	r = sys_ipc_recvv(pg, *npages, 0);
+  803853:	6a 00                	push   $0x0
+  803855:	ff 33                	push   (%ebx)
+  803857:	50                   	push   %eax
+  803858:	e8 48 da ff ff       	call   8012a5 <sys_ipc_recvv>
+	*npages = !r ? thisenv->env_ipc_npages : 0;
+  80385d:	83 c4 10             	add    $0x10,%esp
+  803860:	85 c0                	test   %eax,%eax
+  803862:	75 3c                	jne    8038a0 <ipc_recvv+0x6c>
+  803864:	8b 15 c0 78 81 00    	mov    0x8178c0,%edx
+  80386a:	8b 52 7c             	mov    0x7c(%edx),%edx
+  80386d:	89 13                	mov    %edx,(%ebx)
+	if (from_env_store)
+  80386f:	85 ff                	test   %edi,%edi
+  803871:	74 4e                	je     8038c1 <ipc_recvv+0x8d>
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  803873:	8b 15 c0 78 81 00    	mov    0x8178c0,%edx
+  803879:	8b 52 74             	mov    0x74(%edx),%edx
+  80387c:	89 17                	mov    %edx,(%edi)
+	if (perm_store)
+  80387e:	85 f6                	test   %esi,%esi
+  803880:	74 18                	je     80389a <ipc_recvv+0x66>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  803882:	85 c0                	test   %eax,%eax
+  803884:	75 2d                	jne    8038b3 <ipc_recvv+0x7f>
+  803886:	a1 c0 78 81 00       	mov    0x8178c0,%eax
+  80388b:	8b 40 78             	mov    0x78(%eax),%eax
+  80388e:	89 06                	mov    %eax,(%esi)
+	return r ?: thisenv->env_ipc_value;
+  803890:	a1 c0 78 81 00       	mov    0x8178c0,%eax
+  803895:	8b 40 70             	mov    0x70(%eax),%eax
+  803898:	eb 1f                	jmp    8038b9 <ipc_recvv+0x85>
+  80389a:	85 c0                	test   %eax,%eax
+  80389c:	75 1b                	jne    8038b9 <ipc_recvv+0x85>
+  80389e:	eb f0                	jmp    803890 <ipc_recvv+0x5c>
+	*npages = !r ? thisenv->env_ipc_npages : 0;
+  8038a0:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  8038a6:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (from_env_store)
+  8038ab:	85 ff                	test   %edi,%edi
+  8038ad:	75 cd                	jne    80387c <ipc_recvv+0x48>
+	if (perm_store)
+  8038af:	85 f6                	test   %esi,%esi
+  8038b1:	74 e7                	je     80389a <ipc_recvv+0x66>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  8038b3:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+}
+  8038b9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8038bc:	5b                   	pop    %ebx
+  8038bd:	5e                   	pop    %esi
+  8038be:	5f                   	pop    %edi
+  8038bf:	5d                   	pop    %ebp
+  8038c0:	c3                   	ret
+	if (perm_store)
+  8038c1:	85 f6                	test   %esi,%esi
+  8038c3:	75 bd                	jne    803882 <ipc_recvv+0x4e>
+  8038c5:	eb c9                	jmp    803890 <ipc_recvv+0x5c>
+
+008038c7 <ipc_sendv>:
+// Each entry is a page address or'ed with the permissions to send
+// that page with (see sys_ipc_try_sendv).
+// Like ipc_send, keeps trying until it succeeds.
+void
+ipc_sendv(envid_t to_env, uint32_t val, const uintptr_t *pages, int npages)
+{
+  8038c7:	55                   	push   %ebp
+  8038c8:	89 e5                	mov    %esp,%ebp
+  8038ca:	57                   	push   %edi
+  8038cb:	56                   	push   %esi
+  8038cc:	53                   	push   %ebx
+  8038cd:	83 ec 0c             	sub    $0xc,%esp
+  8038d0:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8038d3:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8038d6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int r;
+
+	while ((r = sys_ipc_try_sendv(to_env, val, pages, npages))) {
+  8038d9:	ff 75 14             	push   0x14(%ebp)
+  8038dc:	53                   	push   %ebx
+  8038dd:	56                   	push   %esi
+  8038de:	57                   	push   %edi
+  8038df:	e8 99 d9 ff ff       	call   80127d <sys_ipc_try_sendv>
+  8038e4:	83 c4 10             	add    $0x10,%esp
+  8038e7:	85 c0                	test   %eax,%eax
+  8038e9:	74 22                	je     80390d <ipc_sendv+0x46>
+		assert(r == -E_IPC_NOT_RECV);
+  8038eb:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  8038ee:	75 07                	jne    8038f7 <ipc_sendv+0x30>
+		sys_yield();
+  8038f0:	e8 8c d7 ff ff       	call   801081 <sys_yield>
+  8038f5:	eb e2                	jmp    8038d9 <ipc_sendv+0x12>
+		assert(r == -E_IPC_NOT_RECV);
+  8038f7:	68 35 44 80 00       	push   $0x804435
+  8038fc:	68 e0 42 80 00       	push   $0x8042e0
+  803901:	6a 5c                	push   $0x5c
+  803903:	68 4a 44 80 00       	push   $0x80444a
+  803908:	e8 be cc ff ff       	call   8005cb <_panic>
+	}
+}
+  80390d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803910:	5b                   	pop    %ebx
+  803911:	5e                   	pop    %esi
+  803912:	5f                   	pop    %edi
+  803913:	5d                   	pop    %ebp
+  803914:	c3                   	ret
+
+00803915 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  803915:	55                   	push   %ebp
+  803916:	89 e5                	mov    %esp,%ebp
+  803918:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  80391b:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (envs[i].env_type == type)
+  803920:	69 d0 8c 00 00 00    	imul   $0x8c,%eax,%edx
+  803926:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  80392c:	8b 52 50             	mov    0x50(%edx),%edx
+  80392f:	39 ca                	cmp    %ecx,%edx
+  803931:	74 11                	je     803944 <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  803933:	83 c0 01             	add    $0x1,%eax
+  803936:	3d 00 04 00 00       	cmp    $0x400,%eax
+  80393b:	75 e3                	jne    803920 <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  80393d:	b8 00 00 00 00       	mov    $0x0,%eax
+  803942:	eb 0e                	jmp    803952 <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  803944:	69 c0 8c 00 00 00    	imul   $0x8c,%eax,%eax
+  80394a:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80394f:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  803952:	5d                   	pop    %ebp
+  803953:	c3                   	ret
+
+00803954 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  803954:	55                   	push   %ebp
+  803955:	89 e5                	mov    %esp,%ebp
+  803957:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  80395a:	89 c2                	mov    %eax,%edx
+  80395c:	c1 ea 16             	shr    $0x16,%edx
+  80395f:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  803966:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  80396b:	f6 c1 01             	test   $0x1,%cl
+  80396e:	74 22                	je     803992 <pageref+0x3e>
+	pte = uvpt[PGNUM(v)];
+  803970:	c1 e8 0c             	shr    $0xc,%eax
+  803973:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  80397a:	a8 01                	test   $0x1,%al
+  80397c:	74 14                	je     803992 <pageref+0x3e>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  80397e:	c1 e8 0c             	shr    $0xc,%eax
+  803981:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  803984:	8d 04 85 00 00 00 ef 	lea    -0x11000000(,%eax,4),%eax
+  80398b:	0f b7 50 08          	movzwl 0x8(%eax),%edx
+  80398f:	0f b7 d2             	movzwl %dx,%edx
+}
+  803992:	89 d0                	mov    %edx,%eax
+  803994:	5d                   	pop    %ebp
+  803995:	c3                   	ret
+
+00803996 <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  803996:	55                   	push   %ebp
+  803997:	89 e5                	mov    %esp,%ebp
+  803999:	83 ec 08             	sub    $0x8,%esp
+	if (_pgfault_handler == 0) {
+  80399c:	83 3d 08 b0 81 00 00 	cmpl   $0x0,0x81b008
+  8039a3:	74 0a                	je     8039af <set_pgfault_handler+0x19>
+				       PTE_U | PTE_W | PTE_P));
+		assert(!sys_env_set_pgfault_upcall(0, _pgfault_upcall));
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  8039a5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8039a8:	a3 08 b0 81 00       	mov    %eax,0x81b008
+}
+  8039ad:	c9                   	leave
+  8039ae:	c3                   	ret
+		assert(!sys_page_alloc(0, (void *) UXSTACKTOP - PGSIZE,
+  8039af:	83 ec 04             	sub    $0x4,%esp
+  8039b2:	6a 07                	push   $0x7
+  8039b4:	68 00 f0 bf ee       	push   $0xeebff000
+  8039b9:	6a 00                	push   $0x0
+  8039bb:	e8 e0 d6 ff ff       	call   8010a0 <sys_page_alloc>
+  8039c0:	83 c4 10             	add    $0x10,%esp
+  8039c3:	85 c0                	test   %eax,%eax
+  8039c5:	75 2c                	jne    8039f3 <set_pgfault_handler+0x5d>
+		assert(!sys_env_set_pgfault_upcall(0, _pgfault_upcall));
+  8039c7:	83 ec 08             	sub    $0x8,%esp
+  8039ca:	68 09 3a 80 00       	push   $0x803a09
+  8039cf:	6a 00                	push   $0x0
+  8039d1:	e8 35 d8 ff ff       	call   80120b <sys_env_set_pgfault_upcall>
+  8039d6:	83 c4 10             	add    $0x10,%esp
+  8039d9:	85 c0                	test   %eax,%eax
+  8039db:	74 c8                	je     8039a5 <set_pgfault_handler+0xf>
+  8039dd:	68 9c 44 80 00       	push   $0x80449c
+  8039e2:	68 e0 42 80 00       	push   $0x8042e0
+  8039e7:	6a 20                	push   $0x20
+  8039e9:	68 cc 44 80 00       	push   $0x8044cc
+  8039ee:	e8 d8 cb ff ff       	call   8005cb <_panic>
+		assert(!sys_page_alloc(0, (void *) UXSTACKTOP - PGSIZE,
+  8039f3:	68 54 44 80 00       	push   $0x804454
+  8039f8:	68 e0 42 80 00       	push   $0x8042e0
+  8039fd:	6a 1e                	push   $0x1e
+  8039ff:	68 cc 44 80 00       	push   $0x8044cc
+  803a04:	e8 c2 cb ff ff       	call   8005cb <_panic>
+
+00803a09 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  803a09:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  803a0a:	a1 08 b0 81 00       	mov    0x81b008,%eax
+	call *%eax
+  803a0f:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  803a11:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+	movl	$-0x4, %ebp
+  803a14:	bd fc ff ff ff       	mov    $0xfffffffc,%ebp
+	xadd	%ebp, 0x30(%esp)	# Load trap-time %esp.
+  803a19:	0f c1 6c 24 30       	xadd   %ebp,0x30(%esp)
+
+	movl	0x28(%esp), %eax	# Load trap-time %eip.
+  803a1e:	8b 44 24 28          	mov    0x28(%esp),%eax
+	movl	%eax, -0x4(%ebp)
+  803a22:	89 45 fc             	mov    %eax,-0x4(%ebp)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+	addl	$0x8, %esp
+  803a25:	83 c4 08             	add    $0x8,%esp
+	popal
+  803a28:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+	addl	$0x4, %esp
+  803a29:	83 c4 04             	add    $0x4,%esp
+	popfl
+  803a2c:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+	popl	%esp
+  803a2d:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+	ret
+  803a2e:	c3                   	ret
+
+00803a2f <dm>:
+  803a2f:	55                   	push   %ebp
+  803a30:	57                   	push   %edi
+  803a31:	56                   	push   %esi
+  803a32:	53                   	push   %ebx
+  803a33:	83 ec 24             	sub    $0x24,%esp
+  803a36:	89 44 24 08          	mov    %eax,0x8(%esp)
+  803a3a:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  803a3e:	8b 44 24 38          	mov    0x38(%esp),%eax
+  803a42:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  803a46:	89 44 24 10          	mov    %eax,0x10(%esp)
+  803a4a:	89 54 24 14          	mov    %edx,0x14(%esp)
+  803a4e:	8b 7c 24 40          	mov    0x40(%esp),%edi
+  803a52:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  803a57:	b8 00 00 00 00       	mov    $0x0,%eax
+  803a5c:	ba 00 00 00 00       	mov    $0x0,%edx
+  803a61:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  803a68:	00 
+  803a69:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  803a70:	00 
+  803a71:	89 fb                	mov    %edi,%ebx
+  803a73:	eb 08                	jmp    803a7d <dm+0x4e>
+  803a75:	83 e9 01             	sub    $0x1,%ecx
+  803a78:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  803a7b:	74 68                	je     803ae5 <dm+0xb6>
+  803a7d:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  803a81:	01 c0                	add    %eax,%eax
+  803a83:	89 c6                	mov    %eax,%esi
+  803a85:	89 d7                	mov    %edx,%edi
+  803a87:	8b 44 24 08          	mov    0x8(%esp),%eax
+  803a8b:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  803a8f:	0f ad d0             	shrd   %cl,%edx,%eax
+  803a92:	d3 ea                	shr    %cl,%edx
+  803a94:	f6 c1 20             	test   $0x20,%cl
+  803a97:	74 04                	je     803a9d <dm+0x6e>
+  803a99:	89 d0                	mov    %edx,%eax
+  803a9b:	31 d2                	xor    %edx,%edx
+  803a9d:	83 e0 01             	and    $0x1,%eax
+  803aa0:	89 04 24             	mov    %eax,(%esp)
+  803aa3:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  803aaa:	00 
+  803aab:	8b 04 24             	mov    (%esp),%eax
+  803aae:	8b 54 24 04          	mov    0x4(%esp),%edx
+  803ab2:	09 f0                	or     %esi,%eax
+  803ab4:	09 fa                	or     %edi,%edx
+  803ab6:	8b 74 24 10          	mov    0x10(%esp),%esi
+  803aba:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  803abe:	39 f0                	cmp    %esi,%eax
+  803ac0:	89 d5                	mov    %edx,%ebp
+  803ac2:	19 fd                	sbb    %edi,%ebp
+  803ac4:	72 af                	jb     803a75 <dm+0x46>
+  803ac6:	29 f0                	sub    %esi,%eax
+  803ac8:	19 fa                	sbb    %edi,%edx
+  803aca:	89 cf                	mov    %ecx,%edi
+  803acc:	c1 ef 05             	shr    $0x5,%edi
+  803acf:	83 e7 01             	and    $0x1,%edi
+  803ad2:	89 fe                	mov    %edi,%esi
+  803ad4:	83 f6 01             	xor    $0x1,%esi
+  803ad7:	d3 e6                	shl    %cl,%esi
+  803ad9:	d3 e7                	shl    %cl,%edi
+  803adb:	09 74 24 18          	or     %esi,0x18(%esp)
+  803adf:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  803ae3:	eb 90                	jmp    803a75 <dm+0x46>
+  803ae5:	85 db                	test   %ebx,%ebx
+  803ae7:	74 05                	je     803aee <dm+0xbf>
+  803ae9:	89 03                	mov    %eax,(%ebx)
+  803aeb:	89 53 04             	mov    %edx,0x4(%ebx)
+  803aee:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803af2:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803af6:	83 c4 24             	add    $0x24,%esp
+  803af9:	5b                   	pop    %ebx
+  803afa:	5e                   	pop    %esi
+  803afb:	5f                   	pop    %edi
+  803afc:	5d                   	pop    %ebp
+  803afd:	c3                   	ret
+
+00803afe <__udivdi3>:
+  803afe:	83 ec 08             	sub    $0x8,%esp
+  803b01:	6a 00                	push   $0x0
+  803b03:	ff 74 24 1c          	push   0x1c(%esp)
+  803b07:	ff 74 24 1c          	push   0x1c(%esp)
+  803b0b:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803b0f:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803b13:	e8 17 ff ff ff       	call   803a2f <dm>
+  803b18:	83 c4 14             	add    $0x14,%esp
+  803b1b:	c3                   	ret
+
+00803b1c <__umoddi3>:
+  803b1c:	83 ec 18             	sub    $0x18,%esp
+  803b1f:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  803b23:	50                   	push   %eax
+  803b24:	ff 74 24 2c          	push   0x2c(%esp)
+  803b28:	ff 74 24 2c          	push   0x2c(%esp)
+  803b2c:	8b 44 24 28          	mov    0x28(%esp),%eax
+  803b30:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  803b34:	e8 f6 fe ff ff       	call   803a2f <dm>
+  803b39:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803b3d:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803b41:	83 c4 24             	add    $0x24,%esp
+  803b44:	c3                   	ret
+
+00803b45 <__divdi3>:
+  803b45:	53                   	push   %ebx
+  803b46:	8b 44 24 08          	mov    0x8(%esp),%eax
+  803b4a:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  803b4e:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  803b52:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  803b56:	85 d2                	test   %edx,%edx
+  803b58:	78 15                	js     803b6f <__divdi3+0x2a>
+  803b5a:	85 db                	test   %ebx,%ebx
+  803b5c:	78 34                	js     803b92 <__divdi3+0x4d>
+  803b5e:	83 ec 04             	sub    $0x4,%esp
+  803b61:	6a 00                	push   $0x0
+  803b63:	53                   	push   %ebx
+  803b64:	51                   	push   %ecx
+  803b65:	e8 c5 fe ff ff       	call   803a2f <dm>
+  803b6a:	83 c4 10             	add    $0x10,%esp
+  803b6d:	eb 21                	jmp    803b90 <__divdi3+0x4b>
+  803b6f:	f7 d8                	neg    %eax
+  803b71:	83 d2 00             	adc    $0x0,%edx
+  803b74:	f7 da                	neg    %edx
+  803b76:	85 db                	test   %ebx,%ebx
+  803b78:	78 30                	js     803baa <__divdi3+0x65>
+  803b7a:	83 ec 04             	sub    $0x4,%esp
+  803b7d:	6a 00                	push   $0x0
+  803b7f:	53                   	push   %ebx
+  803b80:	51                   	push   %ecx
+  803b81:	e8 a9 fe ff ff       	call   803a2f <dm>
+  803b86:	83 c4 10             	add    $0x10,%esp
+  803b89:	f7 d8                	neg    %eax
+  803b8b:	83 d2 00             	adc    $0x0,%edx
+  803b8e:	f7 da                	neg    %edx
+  803b90:	5b                   	pop    %ebx
+  803b91:	c3                   	ret
+  803b92:	83 ec 04             	sub    $0x4,%esp
+  803b95:	6a 00                	push   $0x0
+  803b97:	f7 d9                	neg    %ecx
+  803b99:	83 d3 00             	adc    $0x0,%ebx
+  803b9c:	f7 db                	neg    %ebx
+  803b9e:	53                   	push   %ebx
+  803b9f:	51                   	push   %ecx
+  803ba0:	e8 8a fe ff ff       	call   803a2f <dm>
+  803ba5:	83 c4 10             	add    $0x10,%esp
+  803ba8:	eb df                	jmp    803b89 <__divdi3+0x44>
+  803baa:	83 ec 04             	sub    $0x4,%esp
+  803bad:	6a 00                	push   $0x0
+  803baf:	f7 d9                	neg    %ecx
+  803bb1:	83 d3 00             	adc    $0x0,%ebx
+  803bb4:	f7 db                	neg    %ebx
+  803bb6:	53                   	push   %ebx
+  803bb7:	51                   	push   %ecx
+  803bb8:	e8 72 fe ff ff       	call   803a2f <dm>
+  803bbd:	83 c4 10             	add    $0x10,%esp
+  803bc0:	eb ce                	jmp    803b90 <__divdi3+0x4b>
+
+00803bc2 <__moddi3>:
+  803bc2:	55                   	push   %ebp
+  803bc3:	57                   	push   %edi
+  803bc4:	56                   	push   %esi
+  803bc5:	53                   	push   %ebx
+  803bc6:	83 ec 24             	sub    $0x24,%esp
+  803bc9:	8b 44 24 38          	mov    0x38(%esp),%eax
+  803bcd:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  803bd1:	8b 4c 24 40          	mov    0x40(%esp),%ecx
+  803bd5:	8b 5c 24 44          	mov    0x44(%esp),%ebx
+  803bd9:	85 d2                	test   %edx,%edx
+  803bdb:	78 3b                	js     803c18 <__moddi3+0x56>
+  803bdd:	83 ec 04             	sub    $0x4,%esp
+  803be0:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  803be4:	56                   	push   %esi
+  803be5:	89 ce                	mov    %ecx,%esi
+  803be7:	f7 de                	neg    %esi
+  803be9:	89 74 24 08          	mov    %esi,0x8(%esp)
+  803bed:	89 de                	mov    %ebx,%esi
+  803bef:	83 d6 00             	adc    $0x0,%esi
+  803bf2:	f7 de                	neg    %esi
+  803bf4:	89 74 24 14          	mov    %esi,0x14(%esp)
+  803bf8:	8b 74 24 08          	mov    0x8(%esp),%esi
+  803bfc:	0f 48 f1             	cmovs  %ecx,%esi
+  803bff:	0f 49 5c 24 14       	cmovns 0x14(%esp),%ebx
+  803c04:	53                   	push   %ebx
+  803c05:	56                   	push   %esi
+  803c06:	e8 24 fe ff ff       	call   803a2f <dm>
+  803c0b:	8b 44 24 28          	mov    0x28(%esp),%eax
+  803c0f:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  803c13:	83 c4 10             	add    $0x10,%esp
+  803c16:	eb 47                	jmp    803c5f <__moddi3+0x9d>
+  803c18:	f7 d8                	neg    %eax
+  803c1a:	83 d2 00             	adc    $0x0,%edx
+  803c1d:	f7 da                	neg    %edx
+  803c1f:	83 ec 04             	sub    $0x4,%esp
+  803c22:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  803c26:	56                   	push   %esi
+  803c27:	89 cf                	mov    %ecx,%edi
+  803c29:	f7 df                	neg    %edi
+  803c2b:	89 de                	mov    %ebx,%esi
+  803c2d:	83 d6 00             	adc    $0x0,%esi
+  803c30:	f7 de                	neg    %esi
+  803c32:	0f 49 cf             	cmovns %edi,%ecx
+  803c35:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  803c39:	0f 49 de             	cmovns %esi,%ebx
+  803c3c:	89 5c 24 0c          	mov    %ebx,0xc(%esp)
+  803c40:	ff 74 24 0c          	push   0xc(%esp)
+  803c44:	ff 74 24 0c          	push   0xc(%esp)
+  803c48:	e8 e2 fd ff ff       	call   803a2f <dm>
+  803c4d:	8b 44 24 28          	mov    0x28(%esp),%eax
+  803c51:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  803c55:	f7 d8                	neg    %eax
+  803c57:	83 d2 00             	adc    $0x0,%edx
+  803c5a:	f7 da                	neg    %edx
+  803c5c:	83 c4 10             	add    $0x10,%esp
+  803c5f:	83 c4 24             	add    $0x24,%esp
+  803c62:	5b                   	pop    %ebx
+  803c63:	5e                   	pop    %esi
+  803c64:	5f                   	pop    %edi
+  803c65:	5d                   	pop    %ebp
+  803c66:	c3                   	ret
@@ -0,0 +1,8649 @@
+
+obj/user/testshell.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 54 04 00 00       	call   800485 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <wrong>:
+	breakpoint();
+}
+
+void
+wrong(int rfd, int kfd, int off)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	57                   	push   %edi
+  800037:	56                   	push   %esi
+  800038:	53                   	push   %ebx
+  800039:	81 ec 84 00 00 00    	sub    $0x84,%esp
+  80003f:	8b 75 08             	mov    0x8(%ebp),%esi
+  800042:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  800045:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	char buf[100];
+	int n;
+
+	seek(rfd, off);
+  800048:	53                   	push   %ebx
+  800049:	56                   	push   %esi
+  80004a:	e8 b7 1a 00 00       	call   801b06 <seek>
+	seek(kfd, off);
+  80004f:	83 c4 08             	add    $0x8,%esp
+  800052:	53                   	push   %ebx
+  800053:	57                   	push   %edi
+  800054:	e8 ad 1a 00 00       	call   801b06 <seek>
+
+	cprintf("shell produced incorrect output.\n");
+  800059:	c7 04 24 80 41 80 00 	movl   $0x804180,(%esp)
+  800060:	e8 5e 05 00 00       	call   8005c3 <cprintf>
+	cprintf("expected:\n===\n");
+  800065:	c7 04 24 eb 41 80 00 	movl   $0x8041eb,(%esp)
+  80006c:	e8 52 05 00 00       	call   8005c3 <cprintf>
+	while ((n = read(kfd, buf, sizeof buf-1)) > 0)
+  800071:	83 c4 10             	add    $0x10,%esp
+  800074:	8d 5d 84             	lea    -0x7c(%ebp),%ebx
+  800077:	eb 0d                	jmp    800086 <wrong+0x53>
+		sys_cputs(buf, n);
+  800079:	83 ec 08             	sub    $0x8,%esp
+  80007c:	50                   	push   %eax
+  80007d:	53                   	push   %ebx
+  80007e:	e8 5e 0e 00 00       	call   800ee1 <sys_cputs>
+  800083:	83 c4 10             	add    $0x10,%esp
+	while ((n = read(kfd, buf, sizeof buf-1)) > 0)
+  800086:	83 ec 04             	sub    $0x4,%esp
+  800089:	6a 63                	push   $0x63
+  80008b:	53                   	push   %ebx
+  80008c:	57                   	push   %edi
+  80008d:	e8 24 19 00 00       	call   8019b6 <read>
+  800092:	83 c4 10             	add    $0x10,%esp
+  800095:	85 c0                	test   %eax,%eax
+  800097:	7f e0                	jg     800079 <wrong+0x46>
+	cprintf("===\ngot:\n===\n");
+  800099:	83 ec 0c             	sub    $0xc,%esp
+  80009c:	68 fa 41 80 00       	push   $0x8041fa
+  8000a1:	e8 1d 05 00 00       	call   8005c3 <cprintf>
+	while ((n = read(rfd, buf, sizeof buf-1)) > 0)
+  8000a6:	83 c4 10             	add    $0x10,%esp
+  8000a9:	8d 5d 84             	lea    -0x7c(%ebp),%ebx
+  8000ac:	eb 0d                	jmp    8000bb <wrong+0x88>
+		sys_cputs(buf, n);
+  8000ae:	83 ec 08             	sub    $0x8,%esp
+  8000b1:	50                   	push   %eax
+  8000b2:	53                   	push   %ebx
+  8000b3:	e8 29 0e 00 00       	call   800ee1 <sys_cputs>
+  8000b8:	83 c4 10             	add    $0x10,%esp
+	while ((n = read(rfd, buf, sizeof buf-1)) > 0)
+  8000bb:	83 ec 04             	sub    $0x4,%esp
+  8000be:	6a 63                	push   $0x63
+  8000c0:	53                   	push   %ebx
+  8000c1:	56                   	push   %esi
+  8000c2:	e8 ef 18 00 00       	call   8019b6 <read>
+  8000c7:	83 c4 10             	add    $0x10,%esp
+  8000ca:	85 c0                	test   %eax,%eax
+  8000cc:	7f e0                	jg     8000ae <wrong+0x7b>
+	cprintf("===\n");
+  8000ce:	83 ec 0c             	sub    $0xc,%esp
+  8000d1:	68 f5 41 80 00       	push   $0x8041f5
+  8000d6:	e8 e8 04 00 00       	call   8005c3 <cprintf>
+	exit();
+  8000db:	e8 ee 03 00 00       	call   8004ce <exit>
+}
+  8000e0:	83 c4 10             	add    $0x10,%esp
+  8000e3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8000e6:	5b                   	pop    %ebx
+  8000e7:	5e                   	pop    %esi
+  8000e8:	5f                   	pop    %edi
+  8000e9:	5d                   	pop    %ebp
+  8000ea:	c3                   	ret
+
+008000eb <umain>:
+{
+  8000eb:	55                   	push   %ebp
+  8000ec:	89 e5                	mov    %esp,%ebp
+  8000ee:	57                   	push   %edi
+  8000ef:	56                   	push   %esi
+  8000f0:	53                   	push   %ebx
+  8000f1:	83 ec 38             	sub    $0x38,%esp
+	close(0);
+  8000f4:	6a 00                	push   $0x0
+  8000f6:	e8 7f 17 00 00       	call   80187a <close>
+	close(1);
+  8000fb:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+  800102:	e8 73 17 00 00       	call   80187a <close>
+	opencons();
+  800107:	e8 27 03 00 00       	call   800433 <opencons>
+	opencons();
+  80010c:	e8 22 03 00 00       	call   800433 <opencons>
+	if ((rfd = open("testshell.sh", O_RDONLY)) < 0)
+  800111:	83 c4 08             	add    $0x8,%esp
+  800114:	6a 00                	push   $0x0
+  800116:	68 08 42 80 00       	push   $0x804208
+  80011b:	e8 4c 23 00 00       	call   80246c <open>
+  800120:	89 c3                	mov    %eax,%ebx
+  800122:	83 c4 10             	add    $0x10,%esp
+  800125:	85 c0                	test   %eax,%eax
+  800127:	0f 88 e7 00 00 00    	js     800214 <umain+0x129>
+	if ((wfd = pipe(pfds)) < 0)
+  80012d:	83 ec 0c             	sub    $0xc,%esp
+  800130:	8d 45 dc             	lea    -0x24(%ebp),%eax
+  800133:	50                   	push   %eax
+  800134:	e8 7b 39 00 00       	call   803ab4 <pipe>
+  800139:	83 c4 10             	add    $0x10,%esp
+  80013c:	85 c0                	test   %eax,%eax
+  80013e:	0f 88 e2 00 00 00    	js     800226 <umain+0x13b>
+	wfd = pfds[1];
+  800144:	8b 75 e0             	mov    -0x20(%ebp),%esi
+	cprintf("running sh -x < testshell.sh | cat\n");
+  800147:	83 ec 0c             	sub    $0xc,%esp
+  80014a:	68 a4 41 80 00       	push   $0x8041a4
+  80014f:	e8 6f 04 00 00       	call   8005c3 <cprintf>
+	if ((r = fork()) < 0)
+  800154:	e8 bf 13 00 00       	call   801518 <fork>
+  800159:	83 c4 10             	add    $0x10,%esp
+  80015c:	85 c0                	test   %eax,%eax
+  80015e:	0f 88 d4 00 00 00    	js     800238 <umain+0x14d>
+	if (r == 0) {
+  800164:	75 6f                	jne    8001d5 <umain+0xea>
+		dup(rfd, 0);
+  800166:	83 ec 08             	sub    $0x8,%esp
+  800169:	6a 00                	push   $0x0
+  80016b:	53                   	push   %ebx
+  80016c:	e8 5b 17 00 00       	call   8018cc <dup>
+		dup(wfd, 1);
+  800171:	83 c4 08             	add    $0x8,%esp
+  800174:	6a 01                	push   $0x1
+  800176:	56                   	push   %esi
+  800177:	e8 50 17 00 00       	call   8018cc <dup>
+		close(rfd);
+  80017c:	89 1c 24             	mov    %ebx,(%esp)
+  80017f:	e8 f6 16 00 00       	call   80187a <close>
+		close(wfd);
+  800184:	89 34 24             	mov    %esi,(%esp)
+  800187:	e8 ee 16 00 00       	call   80187a <close>
+		if ((r = spawnl("/sh", "sh", "-x", 0)) < 0)
+  80018c:	6a 00                	push   $0x0
+  80018e:	68 4e 42 80 00       	push   $0x80424e
+  800193:	68 12 42 80 00       	push   $0x804212
+  800198:	68 51 42 80 00       	push   $0x804251
+  80019d:	e8 69 32 00 00       	call   80340b <spawnl>
+  8001a2:	89 c7                	mov    %eax,%edi
+  8001a4:	83 c4 20             	add    $0x20,%esp
+  8001a7:	85 c0                	test   %eax,%eax
+  8001a9:	0f 88 9b 00 00 00    	js     80024a <umain+0x15f>
+		close(0);
+  8001af:	83 ec 0c             	sub    $0xc,%esp
+  8001b2:	6a 00                	push   $0x0
+  8001b4:	e8 c1 16 00 00       	call   80187a <close>
+		close(1);
+  8001b9:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+  8001c0:	e8 b5 16 00 00       	call   80187a <close>
+		wait(r);
+  8001c5:	89 3c 24             	mov    %edi,(%esp)
+  8001c8:	e8 64 3a 00 00       	call   803c31 <wait>
+		exit();
+  8001cd:	e8 fc 02 00 00       	call   8004ce <exit>
+  8001d2:	83 c4 10             	add    $0x10,%esp
+	close(rfd);
+  8001d5:	83 ec 0c             	sub    $0xc,%esp
+  8001d8:	53                   	push   %ebx
+  8001d9:	e8 9c 16 00 00       	call   80187a <close>
+	close(wfd);
+  8001de:	89 34 24             	mov    %esi,(%esp)
+  8001e1:	e8 94 16 00 00       	call   80187a <close>
+	rfd = pfds[0];
+  8001e6:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  8001e9:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+	if ((kfd = open("testshell.key", O_RDONLY)) < 0)
+  8001ec:	83 c4 08             	add    $0x8,%esp
+  8001ef:	6a 00                	push   $0x0
+  8001f1:	68 5f 42 80 00       	push   $0x80425f
+  8001f6:	e8 71 22 00 00       	call   80246c <open>
+  8001fb:	83 c4 10             	add    $0x10,%esp
+  8001fe:	85 c0                	test   %eax,%eax
+  800200:	78 5a                	js     80025c <umain+0x171>
+  800202:	be 01 00 00 00       	mov    $0x1,%esi
+	nloff = 0;
+  800207:	bf 00 00 00 00       	mov    $0x0,%edi
+		n2 = read(kfd, &c2, 1);
+  80020c:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80020f:	e9 9a 00 00 00       	jmp    8002ae <umain+0x1c3>
+		panic("open testshell.sh: %e", rfd);
+  800214:	50                   	push   %eax
+  800215:	68 15 42 80 00       	push   $0x804215
+  80021a:	6a 13                	push   $0x13
+  80021c:	68 2b 42 80 00       	push   $0x80422b
+  800221:	e8 c2 02 00 00       	call   8004e8 <_panic>
+		panic("pipe: %e", wfd);
+  800226:	50                   	push   %eax
+  800227:	68 3c 42 80 00       	push   $0x80423c
+  80022c:	6a 15                	push   $0x15
+  80022e:	68 2b 42 80 00       	push   $0x80422b
+  800233:	e8 b0 02 00 00       	call   8004e8 <_panic>
+		panic("fork: %e", r);
+  800238:	50                   	push   %eax
+  800239:	68 45 42 80 00       	push   $0x804245
+  80023e:	6a 1a                	push   $0x1a
+  800240:	68 2b 42 80 00       	push   $0x80422b
+  800245:	e8 9e 02 00 00       	call   8004e8 <_panic>
+			panic("spawn: %e", r);
+  80024a:	50                   	push   %eax
+  80024b:	68 55 42 80 00       	push   $0x804255
+  800250:	6a 21                	push   $0x21
+  800252:	68 2b 42 80 00       	push   $0x80422b
+  800257:	e8 8c 02 00 00       	call   8004e8 <_panic>
+		panic("open testshell.key for reading: %e", kfd);
+  80025c:	50                   	push   %eax
+  80025d:	68 c8 41 80 00       	push   $0x8041c8
+  800262:	6a 2c                	push   $0x2c
+  800264:	68 2b 42 80 00       	push   $0x80422b
+  800269:	e8 7a 02 00 00       	call   8004e8 <_panic>
+			panic("reading testshell.out: %e", n1);
+  80026e:	53                   	push   %ebx
+  80026f:	68 6d 42 80 00       	push   $0x80426d
+  800274:	6a 33                	push   $0x33
+  800276:	68 2b 42 80 00       	push   $0x80422b
+  80027b:	e8 68 02 00 00       	call   8004e8 <_panic>
+			panic("reading testshell.key: %e", n2);
+  800280:	50                   	push   %eax
+  800281:	68 87 42 80 00       	push   $0x804287
+  800286:	6a 35                	push   $0x35
+  800288:	68 2b 42 80 00       	push   $0x80422b
+  80028d:	e8 56 02 00 00       	call   8004e8 <_panic>
+			wrong(rfd, kfd, nloff);
+  800292:	83 ec 04             	sub    $0x4,%esp
+  800295:	57                   	push   %edi
+  800296:	ff 75 d0             	push   -0x30(%ebp)
+  800299:	ff 75 d4             	push   -0x2c(%ebp)
+  80029c:	e8 92 fd ff ff       	call   800033 <wrong>
+  8002a1:	83 c4 10             	add    $0x10,%esp
+			nloff = off+1;
+  8002a4:	80 7d e7 0a          	cmpb   $0xa,-0x19(%ebp)
+  8002a8:	0f 44 fe             	cmove  %esi,%edi
+	for (off=0;; off++) {
+  8002ab:	83 c6 01             	add    $0x1,%esi
+		n1 = read(rfd, &c1, 1);
+  8002ae:	83 ec 04             	sub    $0x4,%esp
+  8002b1:	6a 01                	push   $0x1
+  8002b3:	8d 45 e7             	lea    -0x19(%ebp),%eax
+  8002b6:	50                   	push   %eax
+  8002b7:	ff 75 d4             	push   -0x2c(%ebp)
+  8002ba:	e8 f7 16 00 00       	call   8019b6 <read>
+  8002bf:	89 c3                	mov    %eax,%ebx
+		n2 = read(kfd, &c2, 1);
+  8002c1:	83 c4 0c             	add    $0xc,%esp
+  8002c4:	6a 01                	push   $0x1
+  8002c6:	8d 45 e6             	lea    -0x1a(%ebp),%eax
+  8002c9:	50                   	push   %eax
+  8002ca:	ff 75 d0             	push   -0x30(%ebp)
+  8002cd:	e8 e4 16 00 00       	call   8019b6 <read>
+		if (n1 < 0)
+  8002d2:	83 c4 10             	add    $0x10,%esp
+  8002d5:	85 db                	test   %ebx,%ebx
+  8002d7:	78 95                	js     80026e <umain+0x183>
+		if (n2 < 0)
+  8002d9:	85 c0                	test   %eax,%eax
+  8002db:	78 a3                	js     800280 <umain+0x195>
+		if (n1 == 0 && n2 == 0)
+  8002dd:	89 d9                	mov    %ebx,%ecx
+  8002df:	09 c1                	or     %eax,%ecx
+  8002e1:	74 15                	je     8002f8 <umain+0x20d>
+		if (n1 != 1 || n2 != 1 || c1 != c2)
+  8002e3:	83 fb 01             	cmp    $0x1,%ebx
+  8002e6:	75 aa                	jne    800292 <umain+0x1a7>
+  8002e8:	83 f8 01             	cmp    $0x1,%eax
+  8002eb:	75 a5                	jne    800292 <umain+0x1a7>
+  8002ed:	0f b6 45 e6          	movzbl -0x1a(%ebp),%eax
+  8002f1:	38 45 e7             	cmp    %al,-0x19(%ebp)
+  8002f4:	75 9c                	jne    800292 <umain+0x1a7>
+  8002f6:	eb ac                	jmp    8002a4 <umain+0x1b9>
+	cprintf("shell ran correctly\n");
+  8002f8:	83 ec 0c             	sub    $0xc,%esp
+  8002fb:	68 a1 42 80 00       	push   $0x8042a1
+  800300:	e8 be 02 00 00       	call   8005c3 <cprintf>
+#include <inc/types.h>
+
+static inline void
+breakpoint(void)
+{
+	asm volatile("int3");
+  800305:	cc                   	int3
+}
+  800306:	83 c4 10             	add    $0x10,%esp
+  800309:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80030c:	5b                   	pop    %ebx
+  80030d:	5e                   	pop    %esi
+  80030e:	5f                   	pop    %edi
+  80030f:	5d                   	pop    %ebp
+  800310:	c3                   	ret
+
+00800311 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  800311:	b8 00 00 00 00       	mov    $0x0,%eax
+  800316:	c3                   	ret
+
+00800317 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  800317:	55                   	push   %ebp
+  800318:	89 e5                	mov    %esp,%ebp
+  80031a:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  80031d:	68 b6 42 80 00       	push   $0x8042b6
+  800322:	ff 75 0c             	push   0xc(%ebp)
+  800325:	e8 87 08 00 00       	call   800bb1 <strcpy>
+	return 0;
+}
+  80032a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80032f:	c9                   	leave
+  800330:	c3                   	ret
+
+00800331 <devcons_write>:
+{
+  800331:	55                   	push   %ebp
+  800332:	89 e5                	mov    %esp,%ebp
+  800334:	57                   	push   %edi
+  800335:	56                   	push   %esi
+  800336:	53                   	push   %ebx
+  800337:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  80033d:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  800342:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  800348:	eb 2e                	jmp    800378 <devcons_write+0x47>
+		m = n - tot;
+  80034a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80034d:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  80034f:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  800354:	39 c3                	cmp    %eax,%ebx
+  800356:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  800359:	83 ec 04             	sub    $0x4,%esp
+  80035c:	53                   	push   %ebx
+  80035d:	89 f0                	mov    %esi,%eax
+  80035f:	03 45 0c             	add    0xc(%ebp),%eax
+  800362:	50                   	push   %eax
+  800363:	57                   	push   %edi
+  800364:	e8 ce 09 00 00       	call   800d37 <memmove>
+		sys_cputs(buf, m);
+  800369:	83 c4 08             	add    $0x8,%esp
+  80036c:	53                   	push   %ebx
+  80036d:	57                   	push   %edi
+  80036e:	e8 6e 0b 00 00       	call   800ee1 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  800373:	01 de                	add    %ebx,%esi
+  800375:	83 c4 10             	add    $0x10,%esp
+  800378:	3b 75 10             	cmp    0x10(%ebp),%esi
+  80037b:	72 cd                	jb     80034a <devcons_write+0x19>
+}
+  80037d:	89 f0                	mov    %esi,%eax
+  80037f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800382:	5b                   	pop    %ebx
+  800383:	5e                   	pop    %esi
+  800384:	5f                   	pop    %edi
+  800385:	5d                   	pop    %ebp
+  800386:	c3                   	ret
+
+00800387 <devcons_read>:
+{
+  800387:	55                   	push   %ebp
+  800388:	89 e5                	mov    %esp,%ebp
+  80038a:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  80038d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800392:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  800396:	75 07                	jne    80039f <devcons_read+0x18>
+  800398:	eb 1f                	jmp    8003b9 <devcons_read+0x32>
+		sys_yield();
+  80039a:	e8 ff 0b 00 00       	call   800f9e <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  80039f:	e8 63 0b 00 00       	call   800f07 <sys_cgetc>
+  8003a4:	85 c0                	test   %eax,%eax
+  8003a6:	74 f2                	je     80039a <devcons_read+0x13>
+	if (c < 0)
+  8003a8:	78 0f                	js     8003b9 <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  8003aa:	83 f8 04             	cmp    $0x4,%eax
+  8003ad:	74 0c                	je     8003bb <devcons_read+0x34>
+	*(char*)vbuf = c;
+  8003af:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8003b2:	88 02                	mov    %al,(%edx)
+	return 1;
+  8003b4:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  8003b9:	c9                   	leave
+  8003ba:	c3                   	ret
+		return 0;
+  8003bb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003c0:	eb f7                	jmp    8003b9 <devcons_read+0x32>
+
+008003c2 <cputchar>:
+{
+  8003c2:	55                   	push   %ebp
+  8003c3:	89 e5                	mov    %esp,%ebp
+  8003c5:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  8003c8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8003cb:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  8003ce:	6a 01                	push   $0x1
+  8003d0:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8003d3:	50                   	push   %eax
+  8003d4:	e8 08 0b 00 00       	call   800ee1 <sys_cputs>
+}
+  8003d9:	83 c4 10             	add    $0x10,%esp
+  8003dc:	c9                   	leave
+  8003dd:	c3                   	ret
+
+008003de <getchar>:
+{
+  8003de:	55                   	push   %ebp
+  8003df:	89 e5                	mov    %esp,%ebp
+  8003e1:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  8003e4:	6a 01                	push   $0x1
+  8003e6:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8003e9:	50                   	push   %eax
+  8003ea:	6a 00                	push   $0x0
+  8003ec:	e8 c5 15 00 00       	call   8019b6 <read>
+	if (r < 0)
+  8003f1:	83 c4 10             	add    $0x10,%esp
+  8003f4:	85 c0                	test   %eax,%eax
+  8003f6:	78 06                	js     8003fe <getchar+0x20>
+	if (r < 1)
+  8003f8:	74 06                	je     800400 <getchar+0x22>
+	return c;
+  8003fa:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  8003fe:	c9                   	leave
+  8003ff:	c3                   	ret
+		return -E_EOF;
+  800400:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  800405:	eb f7                	jmp    8003fe <getchar+0x20>
+
+00800407 <iscons>:
+{
+  800407:	55                   	push   %ebp
+  800408:	89 e5                	mov    %esp,%ebp
+  80040a:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80040d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800410:	50                   	push   %eax
+  800411:	ff 75 08             	push   0x8(%ebp)
+  800414:	e8 37 13 00 00       	call   801750 <fd_lookup>
+  800419:	83 c4 10             	add    $0x10,%esp
+  80041c:	85 c0                	test   %eax,%eax
+  80041e:	78 11                	js     800431 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  800420:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800423:	8b 15 00 50 80 00    	mov    0x805000,%edx
+  800429:	39 10                	cmp    %edx,(%eax)
+  80042b:	0f 94 c0             	sete   %al
+  80042e:	0f b6 c0             	movzbl %al,%eax
+}
+  800431:	c9                   	leave
+  800432:	c3                   	ret
+
+00800433 <opencons>:
+{
+  800433:	55                   	push   %ebp
+  800434:	89 e5                	mov    %esp,%ebp
+  800436:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  800439:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80043c:	50                   	push   %eax
+  80043d:	e8 b8 12 00 00       	call   8016fa <fd_alloc>
+  800442:	83 c4 10             	add    $0x10,%esp
+  800445:	85 c0                	test   %eax,%eax
+  800447:	78 3a                	js     800483 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  800449:	83 ec 04             	sub    $0x4,%esp
+  80044c:	68 07 04 00 00       	push   $0x407
+  800451:	ff 75 f4             	push   -0xc(%ebp)
+  800454:	6a 00                	push   $0x0
+  800456:	e8 62 0b 00 00       	call   800fbd <sys_page_alloc>
+  80045b:	83 c4 10             	add    $0x10,%esp
+  80045e:	85 c0                	test   %eax,%eax
+  800460:	78 21                	js     800483 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  800462:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800465:	8b 15 00 50 80 00    	mov    0x805000,%edx
+  80046b:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  80046d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800470:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  800477:	83 ec 0c             	sub    $0xc,%esp
+  80047a:	50                   	push   %eax
+  80047b:	e8 53 12 00 00       	call   8016d3 <fd2num>
+  800480:	83 c4 10             	add    $0x10,%esp
+}
+  800483:	c9                   	leave
+  800484:	c3                   	ret
+
+00800485 <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  800485:	55                   	push   %ebp
+  800486:	89 e5                	mov    %esp,%ebp
+  800488:	56                   	push   %esi
+  800489:	53                   	push   %ebx
+  80048a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80048d:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = &envs[ENVX(sys_getenvid())];
+  800490:	e8 e2 0a 00 00       	call   800f77 <sys_getenvid>
+  800495:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80049a:	69 c0 8c 00 00 00    	imul   $0x8c,%eax,%eax
+  8004a0:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8004a5:	a3 00 60 80 00       	mov    %eax,0x806000
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  8004aa:	85 db                	test   %ebx,%ebx
+  8004ac:	7e 07                	jle    8004b5 <libmain+0x30>
+		binaryname = argv[0];
+  8004ae:	8b 06                	mov    (%esi),%eax
+  8004b0:	a3 20 50 80 00       	mov    %eax,0x805020
+
+	// call user main routine
+	umain(argc, argv);
+  8004b5:	83 ec 08             	sub    $0x8,%esp
+  8004b8:	56                   	push   %esi
+  8004b9:	53                   	push   %ebx
+  8004ba:	e8 2c fc ff ff       	call   8000eb <umain>
+
+	// exit gracefully
+	exit();
+  8004bf:	e8 0a 00 00 00       	call   8004ce <exit>
+}
+  8004c4:	83 c4 10             	add    $0x10,%esp
+  8004c7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8004ca:	5b                   	pop    %ebx
+  8004cb:	5e                   	pop    %esi
+  8004cc:	5d                   	pop    %ebp
+  8004cd:	c3                   	ret
+
+008004ce <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  8004ce:	55                   	push   %ebp
+  8004cf:	89 e5                	mov    %esp,%ebp
+  8004d1:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  8004d4:	e8 ce 13 00 00       	call   8018a7 <close_all>
+	sys_env_destroy(0);
+  8004d9:	83 ec 0c             	sub    $0xc,%esp
+  8004dc:	6a 00                	push   $0x0
+  8004de:	e8 4b 0a 00 00       	call   800f2e <sys_env_destroy>
+}
+  8004e3:	83 c4 10             	add    $0x10,%esp
+  8004e6:	c9                   	leave
+  8004e7:	c3                   	ret
+
+008004e8 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  8004e8:	55                   	push   %ebp
+  8004e9:	89 e5                	mov    %esp,%ebp
+  8004eb:	56                   	push   %esi
+  8004ec:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  8004ed:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  8004f0:	8b 35 20 50 80 00    	mov    0x805020,%esi
+  8004f6:	e8 7c 0a 00 00       	call   800f77 <sys_getenvid>
+  8004fb:	83 ec 0c             	sub    $0xc,%esp
+  8004fe:	ff 75 0c             	push   0xc(%ebp)
+  800501:	ff 75 08             	push   0x8(%ebp)
+  800504:	56                   	push   %esi
+  800505:	50                   	push   %eax
+  800506:	68 cc 42 80 00       	push   $0x8042cc
+  80050b:	e8 b3 00 00 00       	call   8005c3 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  800510:	83 c4 18             	add    $0x18,%esp
+  800513:	53                   	push   %ebx
+  800514:	ff 75 10             	push   0x10(%ebp)
+  800517:	e8 56 00 00 00       	call   800572 <vcprintf>
+	cprintf("\n");
+  80051c:	c7 04 24 f8 41 80 00 	movl   $0x8041f8,(%esp)
+  800523:	e8 9b 00 00 00       	call   8005c3 <cprintf>
+  800528:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  80052b:	cc                   	int3
+	while (1)
+  80052c:	eb fd                	jmp    80052b <_panic+0x43>
+
+0080052e <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  80052e:	55                   	push   %ebp
+  80052f:	89 e5                	mov    %esp,%ebp
+  800531:	53                   	push   %ebx
+  800532:	83 ec 04             	sub    $0x4,%esp
+  800535:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  800538:	8b 13                	mov    (%ebx),%edx
+  80053a:	8d 42 01             	lea    0x1(%edx),%eax
+  80053d:	89 03                	mov    %eax,(%ebx)
+  80053f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800542:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  800546:	3d ff 00 00 00       	cmp    $0xff,%eax
+  80054b:	74 09                	je     800556 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  80054d:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  800551:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800554:	c9                   	leave
+  800555:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  800556:	83 ec 08             	sub    $0x8,%esp
+  800559:	68 ff 00 00 00       	push   $0xff
+  80055e:	8d 43 08             	lea    0x8(%ebx),%eax
+  800561:	50                   	push   %eax
+  800562:	e8 7a 09 00 00       	call   800ee1 <sys_cputs>
+		b->idx = 0;
+  800567:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  80056d:	83 c4 10             	add    $0x10,%esp
+  800570:	eb db                	jmp    80054d <putch+0x1f>
+
+00800572 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  800572:	55                   	push   %ebp
+  800573:	89 e5                	mov    %esp,%ebp
+  800575:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  80057b:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  800582:	00 00 00 
+	b.cnt = 0;
+  800585:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  80058c:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  80058f:	ff 75 0c             	push   0xc(%ebp)
+  800592:	ff 75 08             	push   0x8(%ebp)
+  800595:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  80059b:	50                   	push   %eax
+  80059c:	68 2e 05 80 00       	push   $0x80052e
+  8005a1:	e8 14 01 00 00       	call   8006ba <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  8005a6:	83 c4 08             	add    $0x8,%esp
+  8005a9:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  8005af:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  8005b5:	50                   	push   %eax
+  8005b6:	e8 26 09 00 00       	call   800ee1 <sys_cputs>
+
+	return b.cnt;
+}
+  8005bb:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  8005c1:	c9                   	leave
+  8005c2:	c3                   	ret
+
+008005c3 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  8005c3:	55                   	push   %ebp
+  8005c4:	89 e5                	mov    %esp,%ebp
+  8005c6:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  8005c9:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  8005cc:	50                   	push   %eax
+  8005cd:	ff 75 08             	push   0x8(%ebp)
+  8005d0:	e8 9d ff ff ff       	call   800572 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  8005d5:	c9                   	leave
+  8005d6:	c3                   	ret
+
+008005d7 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  8005d7:	55                   	push   %ebp
+  8005d8:	89 e5                	mov    %esp,%ebp
+  8005da:	57                   	push   %edi
+  8005db:	56                   	push   %esi
+  8005dc:	53                   	push   %ebx
+  8005dd:	83 ec 1c             	sub    $0x1c,%esp
+  8005e0:	89 c7                	mov    %eax,%edi
+  8005e2:	89 d6                	mov    %edx,%esi
+  8005e4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8005e7:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8005ea:	89 d1                	mov    %edx,%ecx
+  8005ec:	89 c2                	mov    %eax,%edx
+  8005ee:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8005f1:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8005f4:	8b 45 10             	mov    0x10(%ebp),%eax
+  8005f7:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  8005fa:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8005fd:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800604:	39 c2                	cmp    %eax,%edx
+  800606:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  800609:	72 3e                	jb     800649 <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  80060b:	83 ec 0c             	sub    $0xc,%esp
+  80060e:	ff 75 18             	push   0x18(%ebp)
+  800611:	83 eb 01             	sub    $0x1,%ebx
+  800614:	53                   	push   %ebx
+  800615:	50                   	push   %eax
+  800616:	83 ec 08             	sub    $0x8,%esp
+  800619:	ff 75 e4             	push   -0x1c(%ebp)
+  80061c:	ff 75 e0             	push   -0x20(%ebp)
+  80061f:	ff 75 dc             	push   -0x24(%ebp)
+  800622:	ff 75 d8             	push   -0x28(%ebp)
+  800625:	e8 e6 39 00 00       	call   804010 <__udivdi3>
+  80062a:	83 c4 18             	add    $0x18,%esp
+  80062d:	52                   	push   %edx
+  80062e:	50                   	push   %eax
+  80062f:	89 f2                	mov    %esi,%edx
+  800631:	89 f8                	mov    %edi,%eax
+  800633:	e8 9f ff ff ff       	call   8005d7 <printnum>
+  800638:	83 c4 20             	add    $0x20,%esp
+  80063b:	eb 13                	jmp    800650 <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  80063d:	83 ec 08             	sub    $0x8,%esp
+  800640:	56                   	push   %esi
+  800641:	ff 75 18             	push   0x18(%ebp)
+  800644:	ff d7                	call   *%edi
+  800646:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  800649:	83 eb 01             	sub    $0x1,%ebx
+  80064c:	85 db                	test   %ebx,%ebx
+  80064e:	7f ed                	jg     80063d <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  800650:	83 ec 08             	sub    $0x8,%esp
+  800653:	56                   	push   %esi
+  800654:	83 ec 04             	sub    $0x4,%esp
+  800657:	ff 75 e4             	push   -0x1c(%ebp)
+  80065a:	ff 75 e0             	push   -0x20(%ebp)
+  80065d:	ff 75 dc             	push   -0x24(%ebp)
+  800660:	ff 75 d8             	push   -0x28(%ebp)
+  800663:	e8 c6 39 00 00       	call   80402e <__umoddi3>
+  800668:	83 c4 14             	add    $0x14,%esp
+  80066b:	0f be 80 ef 42 80 00 	movsbl 0x8042ef(%eax),%eax
+  800672:	50                   	push   %eax
+  800673:	ff d7                	call   *%edi
+}
+  800675:	83 c4 10             	add    $0x10,%esp
+  800678:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80067b:	5b                   	pop    %ebx
+  80067c:	5e                   	pop    %esi
+  80067d:	5f                   	pop    %edi
+  80067e:	5d                   	pop    %ebp
+  80067f:	c3                   	ret
+
+00800680 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  800680:	55                   	push   %ebp
+  800681:	89 e5                	mov    %esp,%ebp
+  800683:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  800686:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  80068a:	8b 10                	mov    (%eax),%edx
+  80068c:	3b 50 04             	cmp    0x4(%eax),%edx
+  80068f:	73 0a                	jae    80069b <sprintputch+0x1b>
+		*b->buf++ = ch;
+  800691:	8d 4a 01             	lea    0x1(%edx),%ecx
+  800694:	89 08                	mov    %ecx,(%eax)
+  800696:	8b 45 08             	mov    0x8(%ebp),%eax
+  800699:	88 02                	mov    %al,(%edx)
+}
+  80069b:	5d                   	pop    %ebp
+  80069c:	c3                   	ret
+
+0080069d <printfmt>:
+{
+  80069d:	55                   	push   %ebp
+  80069e:	89 e5                	mov    %esp,%ebp
+  8006a0:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  8006a3:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  8006a6:	50                   	push   %eax
+  8006a7:	ff 75 10             	push   0x10(%ebp)
+  8006aa:	ff 75 0c             	push   0xc(%ebp)
+  8006ad:	ff 75 08             	push   0x8(%ebp)
+  8006b0:	e8 05 00 00 00       	call   8006ba <vprintfmt>
+}
+  8006b5:	83 c4 10             	add    $0x10,%esp
+  8006b8:	c9                   	leave
+  8006b9:	c3                   	ret
+
+008006ba <vprintfmt>:
+{
+  8006ba:	55                   	push   %ebp
+  8006bb:	89 e5                	mov    %esp,%ebp
+  8006bd:	57                   	push   %edi
+  8006be:	56                   	push   %esi
+  8006bf:	53                   	push   %ebx
+  8006c0:	83 ec 2c             	sub    $0x2c,%esp
+  8006c3:	8b 75 08             	mov    0x8(%ebp),%esi
+  8006c6:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8006c9:	8b 7d 10             	mov    0x10(%ebp),%edi
+  8006cc:	eb 0a                	jmp    8006d8 <vprintfmt+0x1e>
+			putch(ch, putdat);
+  8006ce:	83 ec 08             	sub    $0x8,%esp
+  8006d1:	53                   	push   %ebx
+  8006d2:	50                   	push   %eax
+  8006d3:	ff d6                	call   *%esi
+  8006d5:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8006d8:	83 c7 01             	add    $0x1,%edi
+  8006db:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  8006df:	83 f8 25             	cmp    $0x25,%eax
+  8006e2:	74 0c                	je     8006f0 <vprintfmt+0x36>
+			if (ch == '\0')
+  8006e4:	85 c0                	test   %eax,%eax
+  8006e6:	75 e6                	jne    8006ce <vprintfmt+0x14>
+}
+  8006e8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8006eb:	5b                   	pop    %ebx
+  8006ec:	5e                   	pop    %esi
+  8006ed:	5f                   	pop    %edi
+  8006ee:	5d                   	pop    %ebp
+  8006ef:	c3                   	ret
+		padc = ' ';
+  8006f0:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  8006f4:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  8006fb:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  800702:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  800709:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  80070e:	8d 47 01             	lea    0x1(%edi),%eax
+  800711:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800714:	0f b6 17             	movzbl (%edi),%edx
+  800717:	8d 42 dd             	lea    -0x23(%edx),%eax
+  80071a:	3c 55                	cmp    $0x55,%al
+  80071c:	0f 87 cf 03 00 00    	ja     800af1 <vprintfmt+0x437>
+  800722:	0f b6 c0             	movzbl %al,%eax
+  800725:	ff 24 85 40 44 80 00 	jmp    *0x804440(,%eax,4)
+  80072c:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  80072f:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  800733:	eb d9                	jmp    80070e <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  800735:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800738:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  80073c:	eb d0                	jmp    80070e <vprintfmt+0x54>
+  80073e:	0f b6 d2             	movzbl %dl,%edx
+  800741:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  800744:	b8 00 00 00 00       	mov    $0x0,%eax
+  800749:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  80074c:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  80074f:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  800753:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  800756:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  800759:	83 f9 09             	cmp    $0x9,%ecx
+  80075c:	77 55                	ja     8007b3 <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  80075e:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  800761:	eb e9                	jmp    80074c <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  800763:	8b 45 14             	mov    0x14(%ebp),%eax
+  800766:	8b 00                	mov    (%eax),%eax
+  800768:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80076b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80076e:	8d 40 04             	lea    0x4(%eax),%eax
+  800771:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800774:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  800777:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  80077b:	79 91                	jns    80070e <vprintfmt+0x54>
+				width = precision, precision = -1;
+  80077d:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800780:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800783:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  80078a:	eb 82                	jmp    80070e <vprintfmt+0x54>
+			if (width < 0)
+  80078c:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  80078f:	85 d2                	test   %edx,%edx
+  800791:	b8 00 00 00 00       	mov    $0x0,%eax
+  800796:	0f 49 c2             	cmovns %edx,%eax
+  800799:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  80079c:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  80079f:	e9 6a ff ff ff       	jmp    80070e <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  8007a4:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  8007a7:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  8007ae:	e9 5b ff ff ff       	jmp    80070e <vprintfmt+0x54>
+  8007b3:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8007b6:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8007b9:	eb bc                	jmp    800777 <vprintfmt+0xbd>
+			lflag++;
+  8007bb:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  8007be:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  8007c1:	e9 48 ff ff ff       	jmp    80070e <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  8007c6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007c9:	8d 78 04             	lea    0x4(%eax),%edi
+  8007cc:	83 ec 08             	sub    $0x8,%esp
+  8007cf:	53                   	push   %ebx
+  8007d0:	ff 30                	push   (%eax)
+  8007d2:	ff d6                	call   *%esi
+			break;
+  8007d4:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  8007d7:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  8007da:	e9 b1 02 00 00       	jmp    800a90 <vprintfmt+0x3d6>
+			err = va_arg(ap, int);
+  8007df:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007e2:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  8007e5:	8b 10                	mov    (%eax),%edx
+  8007e7:	89 d0                	mov    %edx,%eax
+  8007e9:	f7 d8                	neg    %eax
+  8007eb:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  8007ee:	83 f8 11             	cmp    $0x11,%eax
+  8007f1:	7f 23                	jg     800816 <vprintfmt+0x15c>
+  8007f3:	8b 14 85 a0 45 80 00 	mov    0x8045a0(,%eax,4),%edx
+  8007fa:	85 d2                	test   %edx,%edx
+  8007fc:	74 18                	je     800816 <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  8007fe:	52                   	push   %edx
+  8007ff:	68 be 46 80 00       	push   $0x8046be
+  800804:	53                   	push   %ebx
+  800805:	56                   	push   %esi
+  800806:	e8 92 fe ff ff       	call   80069d <printfmt>
+  80080b:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  80080e:	89 7d 14             	mov    %edi,0x14(%ebp)
+  800811:	e9 7a 02 00 00       	jmp    800a90 <vprintfmt+0x3d6>
+				printfmt(putch, putdat, "error %d", err);
+  800816:	50                   	push   %eax
+  800817:	68 07 43 80 00       	push   $0x804307
+  80081c:	53                   	push   %ebx
+  80081d:	56                   	push   %esi
+  80081e:	e8 7a fe ff ff       	call   80069d <printfmt>
+  800823:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800826:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  800829:	e9 62 02 00 00       	jmp    800a90 <vprintfmt+0x3d6>
+			if ((p = va_arg(ap, char *)) == NULL)
+  80082e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800831:	83 c0 04             	add    $0x4,%eax
+  800834:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  800837:	8b 45 14             	mov    0x14(%ebp),%eax
+  80083a:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  80083c:	85 c9                	test   %ecx,%ecx
+  80083e:	b8 00 43 80 00       	mov    $0x804300,%eax
+  800843:	0f 45 c1             	cmovne %ecx,%eax
+  800846:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  800849:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  80084d:	7e 06                	jle    800855 <vprintfmt+0x19b>
+  80084f:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  800853:	75 0b                	jne    800860 <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800855:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  800858:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  80085b:	89 75 08             	mov    %esi,0x8(%ebp)
+  80085e:	eb 5c                	jmp    8008bc <vprintfmt+0x202>
+  800860:	83 ec 08             	sub    $0x8,%esp
+  800863:	ff 75 d0             	push   -0x30(%ebp)
+  800866:	ff 75 cc             	push   -0x34(%ebp)
+  800869:	e8 20 03 00 00       	call   800b8e <strnlen>
+  80086e:	89 c2                	mov    %eax,%edx
+  800870:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800873:	29 d0                	sub    %edx,%eax
+  800875:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  800878:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  80087c:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80087f:	89 75 08             	mov    %esi,0x8(%ebp)
+  800882:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800884:	eb 0e                	jmp    800894 <vprintfmt+0x1da>
+					putch(padc, putdat);
+  800886:	83 ec 08             	sub    $0x8,%esp
+  800889:	53                   	push   %ebx
+  80088a:	57                   	push   %edi
+  80088b:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80088e:	83 ee 01             	sub    $0x1,%esi
+  800891:	83 c4 10             	add    $0x10,%esp
+  800894:	85 f6                	test   %esi,%esi
+  800896:	7f ee                	jg     800886 <vprintfmt+0x1cc>
+  800898:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80089b:	8b 75 08             	mov    0x8(%ebp),%esi
+  80089e:	85 c0                	test   %eax,%eax
+  8008a0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8008a5:	0f 49 d0             	cmovns %eax,%edx
+  8008a8:	29 d0                	sub    %edx,%eax
+  8008aa:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8008ad:	eb a6                	jmp    800855 <vprintfmt+0x19b>
+					putch(ch, putdat);
+  8008af:	83 ec 08             	sub    $0x8,%esp
+  8008b2:	53                   	push   %ebx
+  8008b3:	52                   	push   %edx
+  8008b4:	ff 55 08             	call   *0x8(%ebp)
+  8008b7:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8008ba:	89 f1                	mov    %esi,%ecx
+  8008bc:	8d 71 01             	lea    0x1(%ecx),%esi
+  8008bf:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  8008c3:	0f be d0             	movsbl %al,%edx
+  8008c6:	85 d2                	test   %edx,%edx
+  8008c8:	74 28                	je     8008f2 <vprintfmt+0x238>
+  8008ca:	85 ff                	test   %edi,%edi
+  8008cc:	78 05                	js     8008d3 <vprintfmt+0x219>
+  8008ce:	83 ef 01             	sub    $0x1,%edi
+  8008d1:	78 30                	js     800903 <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  8008d3:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  8008d7:	74 d6                	je     8008af <vprintfmt+0x1f5>
+  8008d9:	0f be c0             	movsbl %al,%eax
+  8008dc:	83 e8 20             	sub    $0x20,%eax
+  8008df:	83 f8 5e             	cmp    $0x5e,%eax
+  8008e2:	76 cb                	jbe    8008af <vprintfmt+0x1f5>
+					putch('?', putdat);
+  8008e4:	83 ec 08             	sub    $0x8,%esp
+  8008e7:	53                   	push   %ebx
+  8008e8:	6a 3f                	push   $0x3f
+  8008ea:	ff 55 08             	call   *0x8(%ebp)
+  8008ed:	83 c4 10             	add    $0x10,%esp
+  8008f0:	eb c8                	jmp    8008ba <vprintfmt+0x200>
+  8008f2:	8b 75 08             	mov    0x8(%ebp),%esi
+  8008f5:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8008f8:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8008fb:	01 d0                	add    %edx,%eax
+  8008fd:	29 c8                	sub    %ecx,%eax
+  8008ff:	89 c7                	mov    %eax,%edi
+  800901:	eb 13                	jmp    800916 <vprintfmt+0x25c>
+  800903:	8b 75 08             	mov    0x8(%ebp),%esi
+  800906:	eb ed                	jmp    8008f5 <vprintfmt+0x23b>
+				putch(' ', putdat);
+  800908:	83 ec 08             	sub    $0x8,%esp
+  80090b:	53                   	push   %ebx
+  80090c:	6a 20                	push   $0x20
+  80090e:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  800910:	83 ef 01             	sub    $0x1,%edi
+  800913:	83 c4 10             	add    $0x10,%esp
+  800916:	85 ff                	test   %edi,%edi
+  800918:	7f ee                	jg     800908 <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  80091a:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  80091d:	89 45 14             	mov    %eax,0x14(%ebp)
+  800920:	e9 6b 01 00 00       	jmp    800a90 <vprintfmt+0x3d6>
+	if (lflag >= 2)
+  800925:	83 f9 01             	cmp    $0x1,%ecx
+  800928:	7f 1f                	jg     800949 <vprintfmt+0x28f>
+	else if (lflag)
+  80092a:	85 c9                	test   %ecx,%ecx
+  80092c:	74 67                	je     800995 <vprintfmt+0x2db>
+		return va_arg(*ap, long);
+  80092e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800931:	8b 00                	mov    (%eax),%eax
+  800933:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800936:	89 c1                	mov    %eax,%ecx
+  800938:	c1 f9 1f             	sar    $0x1f,%ecx
+  80093b:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80093e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800941:	8d 40 04             	lea    0x4(%eax),%eax
+  800944:	89 45 14             	mov    %eax,0x14(%ebp)
+  800947:	eb 17                	jmp    800960 <vprintfmt+0x2a6>
+		return va_arg(*ap, long long);
+  800949:	8b 45 14             	mov    0x14(%ebp),%eax
+  80094c:	8b 50 04             	mov    0x4(%eax),%edx
+  80094f:	8b 00                	mov    (%eax),%eax
+  800951:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800954:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800957:	8b 45 14             	mov    0x14(%ebp),%eax
+  80095a:	8d 40 08             	lea    0x8(%eax),%eax
+  80095d:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  800960:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800963:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  800966:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  80096b:	85 c9                	test   %ecx,%ecx
+  80096d:	0f 89 03 01 00 00    	jns    800a76 <vprintfmt+0x3bc>
+				putch('-', putdat);
+  800973:	83 ec 08             	sub    $0x8,%esp
+  800976:	53                   	push   %ebx
+  800977:	6a 2d                	push   $0x2d
+  800979:	ff d6                	call   *%esi
+				num = -(long long) num;
+  80097b:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  80097e:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800981:	f7 da                	neg    %edx
+  800983:	83 d1 00             	adc    $0x0,%ecx
+  800986:	f7 d9                	neg    %ecx
+  800988:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  80098b:	bf 0a 00 00 00       	mov    $0xa,%edi
+  800990:	e9 e1 00 00 00       	jmp    800a76 <vprintfmt+0x3bc>
+		return va_arg(*ap, int);
+  800995:	8b 45 14             	mov    0x14(%ebp),%eax
+  800998:	8b 00                	mov    (%eax),%eax
+  80099a:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80099d:	89 c1                	mov    %eax,%ecx
+  80099f:	c1 f9 1f             	sar    $0x1f,%ecx
+  8009a2:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8009a5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009a8:	8d 40 04             	lea    0x4(%eax),%eax
+  8009ab:	89 45 14             	mov    %eax,0x14(%ebp)
+  8009ae:	eb b0                	jmp    800960 <vprintfmt+0x2a6>
+	if (lflag >= 2)
+  8009b0:	83 f9 01             	cmp    $0x1,%ecx
+  8009b3:	7f 1e                	jg     8009d3 <vprintfmt+0x319>
+	else if (lflag)
+  8009b5:	85 c9                	test   %ecx,%ecx
+  8009b7:	74 32                	je     8009eb <vprintfmt+0x331>
+		return va_arg(*ap, unsigned long);
+  8009b9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009bc:	8b 10                	mov    (%eax),%edx
+  8009be:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8009c3:	8d 40 04             	lea    0x4(%eax),%eax
+  8009c6:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8009c9:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  8009ce:	e9 a3 00 00 00       	jmp    800a76 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  8009d3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009d6:	8b 10                	mov    (%eax),%edx
+  8009d8:	8b 48 04             	mov    0x4(%eax),%ecx
+  8009db:	8d 40 08             	lea    0x8(%eax),%eax
+  8009de:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8009e1:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  8009e6:	e9 8b 00 00 00       	jmp    800a76 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  8009eb:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009ee:	8b 10                	mov    (%eax),%edx
+  8009f0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8009f5:	8d 40 04             	lea    0x4(%eax),%eax
+  8009f8:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8009fb:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  800a00:	eb 74                	jmp    800a76 <vprintfmt+0x3bc>
+	if (lflag >= 2)
+  800a02:	83 f9 01             	cmp    $0x1,%ecx
+  800a05:	7f 1b                	jg     800a22 <vprintfmt+0x368>
+	else if (lflag)
+  800a07:	85 c9                	test   %ecx,%ecx
+  800a09:	74 2c                	je     800a37 <vprintfmt+0x37d>
+		return va_arg(*ap, unsigned long);
+  800a0b:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a0e:	8b 10                	mov    (%eax),%edx
+  800a10:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800a15:	8d 40 04             	lea    0x4(%eax),%eax
+  800a18:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800a1b:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long);
+  800a20:	eb 54                	jmp    800a76 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  800a22:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a25:	8b 10                	mov    (%eax),%edx
+  800a27:	8b 48 04             	mov    0x4(%eax),%ecx
+  800a2a:	8d 40 08             	lea    0x8(%eax),%eax
+  800a2d:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800a30:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long long);
+  800a35:	eb 3f                	jmp    800a76 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  800a37:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a3a:	8b 10                	mov    (%eax),%edx
+  800a3c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800a41:	8d 40 04             	lea    0x4(%eax),%eax
+  800a44:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800a47:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned int);
+  800a4c:	eb 28                	jmp    800a76 <vprintfmt+0x3bc>
+			putch('0', putdat);
+  800a4e:	83 ec 08             	sub    $0x8,%esp
+  800a51:	53                   	push   %ebx
+  800a52:	6a 30                	push   $0x30
+  800a54:	ff d6                	call   *%esi
+			putch('x', putdat);
+  800a56:	83 c4 08             	add    $0x8,%esp
+  800a59:	53                   	push   %ebx
+  800a5a:	6a 78                	push   $0x78
+  800a5c:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  800a5e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a61:	8b 10                	mov    (%eax),%edx
+  800a63:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  800a68:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  800a6b:	8d 40 04             	lea    0x4(%eax),%eax
+  800a6e:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800a71:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  800a76:	83 ec 0c             	sub    $0xc,%esp
+  800a79:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  800a7d:	50                   	push   %eax
+  800a7e:	ff 75 e0             	push   -0x20(%ebp)
+  800a81:	57                   	push   %edi
+  800a82:	51                   	push   %ecx
+  800a83:	52                   	push   %edx
+  800a84:	89 da                	mov    %ebx,%edx
+  800a86:	89 f0                	mov    %esi,%eax
+  800a88:	e8 4a fb ff ff       	call   8005d7 <printnum>
+			break;
+  800a8d:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  800a90:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800a93:	e9 40 fc ff ff       	jmp    8006d8 <vprintfmt+0x1e>
+	if (lflag >= 2)
+  800a98:	83 f9 01             	cmp    $0x1,%ecx
+  800a9b:	7f 1b                	jg     800ab8 <vprintfmt+0x3fe>
+	else if (lflag)
+  800a9d:	85 c9                	test   %ecx,%ecx
+  800a9f:	74 2c                	je     800acd <vprintfmt+0x413>
+		return va_arg(*ap, unsigned long);
+  800aa1:	8b 45 14             	mov    0x14(%ebp),%eax
+  800aa4:	8b 10                	mov    (%eax),%edx
+  800aa6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800aab:	8d 40 04             	lea    0x4(%eax),%eax
+  800aae:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800ab1:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  800ab6:	eb be                	jmp    800a76 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  800ab8:	8b 45 14             	mov    0x14(%ebp),%eax
+  800abb:	8b 10                	mov    (%eax),%edx
+  800abd:	8b 48 04             	mov    0x4(%eax),%ecx
+  800ac0:	8d 40 08             	lea    0x8(%eax),%eax
+  800ac3:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800ac6:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  800acb:	eb a9                	jmp    800a76 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  800acd:	8b 45 14             	mov    0x14(%ebp),%eax
+  800ad0:	8b 10                	mov    (%eax),%edx
+  800ad2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800ad7:	8d 40 04             	lea    0x4(%eax),%eax
+  800ada:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800add:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  800ae2:	eb 92                	jmp    800a76 <vprintfmt+0x3bc>
+			putch(ch, putdat);
+  800ae4:	83 ec 08             	sub    $0x8,%esp
+  800ae7:	53                   	push   %ebx
+  800ae8:	6a 25                	push   $0x25
+  800aea:	ff d6                	call   *%esi
+			break;
+  800aec:	83 c4 10             	add    $0x10,%esp
+  800aef:	eb 9f                	jmp    800a90 <vprintfmt+0x3d6>
+			putch('%', putdat);
+  800af1:	83 ec 08             	sub    $0x8,%esp
+  800af4:	53                   	push   %ebx
+  800af5:	6a 25                	push   $0x25
+  800af7:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  800af9:	83 c4 10             	add    $0x10,%esp
+  800afc:	89 f8                	mov    %edi,%eax
+  800afe:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800b02:	74 05                	je     800b09 <vprintfmt+0x44f>
+  800b04:	83 e8 01             	sub    $0x1,%eax
+  800b07:	eb f5                	jmp    800afe <vprintfmt+0x444>
+  800b09:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800b0c:	eb 82                	jmp    800a90 <vprintfmt+0x3d6>
+
+00800b0e <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800b0e:	55                   	push   %ebp
+  800b0f:	89 e5                	mov    %esp,%ebp
+  800b11:	83 ec 18             	sub    $0x18,%esp
+  800b14:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b17:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  800b1a:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800b1d:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800b21:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800b24:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  800b2b:	85 c0                	test   %eax,%eax
+  800b2d:	74 26                	je     800b55 <vsnprintf+0x47>
+  800b2f:	85 d2                	test   %edx,%edx
+  800b31:	7e 22                	jle    800b55 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800b33:	ff 75 14             	push   0x14(%ebp)
+  800b36:	ff 75 10             	push   0x10(%ebp)
+  800b39:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800b3c:	50                   	push   %eax
+  800b3d:	68 80 06 80 00       	push   $0x800680
+  800b42:	e8 73 fb ff ff       	call   8006ba <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  800b47:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800b4a:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  800b4d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800b50:	83 c4 10             	add    $0x10,%esp
+}
+  800b53:	c9                   	leave
+  800b54:	c3                   	ret
+		return -E_INVAL;
+  800b55:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800b5a:	eb f7                	jmp    800b53 <vsnprintf+0x45>
+
+00800b5c <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800b5c:	55                   	push   %ebp
+  800b5d:	89 e5                	mov    %esp,%ebp
+  800b5f:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  800b62:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  800b65:	50                   	push   %eax
+  800b66:	ff 75 10             	push   0x10(%ebp)
+  800b69:	ff 75 0c             	push   0xc(%ebp)
+  800b6c:	ff 75 08             	push   0x8(%ebp)
+  800b6f:	e8 9a ff ff ff       	call   800b0e <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  800b74:	c9                   	leave
+  800b75:	c3                   	ret
+
+00800b76 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800b76:	55                   	push   %ebp
+  800b77:	89 e5                	mov    %esp,%ebp
+  800b79:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  800b7c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b81:	eb 03                	jmp    800b86 <strlen+0x10>
+		n++;
+  800b83:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  800b86:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800b8a:	75 f7                	jne    800b83 <strlen+0xd>
+	return n;
+}
+  800b8c:	5d                   	pop    %ebp
+  800b8d:	c3                   	ret
+
+00800b8e <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800b8e:	55                   	push   %ebp
+  800b8f:	89 e5                	mov    %esp,%ebp
+  800b91:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800b94:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800b97:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b9c:	eb 03                	jmp    800ba1 <strnlen+0x13>
+		n++;
+  800b9e:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800ba1:	39 d0                	cmp    %edx,%eax
+  800ba3:	74 08                	je     800bad <strnlen+0x1f>
+  800ba5:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800ba9:	75 f3                	jne    800b9e <strnlen+0x10>
+  800bab:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  800bad:	89 d0                	mov    %edx,%eax
+  800baf:	5d                   	pop    %ebp
+  800bb0:	c3                   	ret
+
+00800bb1 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800bb1:	55                   	push   %ebp
+  800bb2:	89 e5                	mov    %esp,%ebp
+  800bb4:	53                   	push   %ebx
+  800bb5:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800bb8:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  800bbb:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bc0:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800bc4:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800bc7:	83 c0 01             	add    $0x1,%eax
+  800bca:	84 d2                	test   %dl,%dl
+  800bcc:	75 f2                	jne    800bc0 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  800bce:	89 c8                	mov    %ecx,%eax
+  800bd0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800bd3:	c9                   	leave
+  800bd4:	c3                   	ret
+
+00800bd5 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800bd5:	55                   	push   %ebp
+  800bd6:	89 e5                	mov    %esp,%ebp
+  800bd8:	53                   	push   %ebx
+  800bd9:	83 ec 10             	sub    $0x10,%esp
+  800bdc:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  800bdf:	53                   	push   %ebx
+  800be0:	e8 91 ff ff ff       	call   800b76 <strlen>
+  800be5:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800be8:	ff 75 0c             	push   0xc(%ebp)
+  800beb:	01 d8                	add    %ebx,%eax
+  800bed:	50                   	push   %eax
+  800bee:	e8 be ff ff ff       	call   800bb1 <strcpy>
+	return dst;
+}
+  800bf3:	89 d8                	mov    %ebx,%eax
+  800bf5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800bf8:	c9                   	leave
+  800bf9:	c3                   	ret
+
+00800bfa <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800bfa:	55                   	push   %ebp
+  800bfb:	89 e5                	mov    %esp,%ebp
+  800bfd:	56                   	push   %esi
+  800bfe:	53                   	push   %ebx
+  800bff:	8b 75 08             	mov    0x8(%ebp),%esi
+  800c02:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800c05:	89 f3                	mov    %esi,%ebx
+  800c07:	03 5d 10             	add    0x10(%ebp),%ebx
+  800c0a:	89 f0                	mov    %esi,%eax
+  800c0c:	eb 0f                	jmp    800c1d <strncpy+0x23>
+		*dst++ = *src;
+  800c0e:	83 c0 01             	add    $0x1,%eax
+  800c11:	0f b6 0a             	movzbl (%edx),%ecx
+  800c14:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800c17:	80 f9 01             	cmp    $0x1,%cl
+  800c1a:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  800c1d:	39 d8                	cmp    %ebx,%eax
+  800c1f:	75 ed                	jne    800c0e <strncpy+0x14>
+	}
+	return ret;
+}
+  800c21:	89 f0                	mov    %esi,%eax
+  800c23:	5b                   	pop    %ebx
+  800c24:	5e                   	pop    %esi
+  800c25:	5d                   	pop    %ebp
+  800c26:	c3                   	ret
+
+00800c27 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800c27:	55                   	push   %ebp
+  800c28:	89 e5                	mov    %esp,%ebp
+  800c2a:	56                   	push   %esi
+  800c2b:	53                   	push   %ebx
+  800c2c:	8b 75 08             	mov    0x8(%ebp),%esi
+  800c2f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c32:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800c35:	89 f0                	mov    %esi,%eax
+  800c37:	85 d2                	test   %edx,%edx
+  800c39:	74 21                	je     800c5c <strlcpy+0x35>
+  800c3b:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800c3f:	89 f2                	mov    %esi,%edx
+  800c41:	eb 09                	jmp    800c4c <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  800c43:	83 c1 01             	add    $0x1,%ecx
+  800c46:	83 c2 01             	add    $0x1,%edx
+  800c49:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  800c4c:	39 c2                	cmp    %eax,%edx
+  800c4e:	74 09                	je     800c59 <strlcpy+0x32>
+  800c50:	0f b6 19             	movzbl (%ecx),%ebx
+  800c53:	84 db                	test   %bl,%bl
+  800c55:	75 ec                	jne    800c43 <strlcpy+0x1c>
+  800c57:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  800c59:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  800c5c:	29 f0                	sub    %esi,%eax
+}
+  800c5e:	5b                   	pop    %ebx
+  800c5f:	5e                   	pop    %esi
+  800c60:	5d                   	pop    %ebp
+  800c61:	c3                   	ret
+
+00800c62 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800c62:	55                   	push   %ebp
+  800c63:	89 e5                	mov    %esp,%ebp
+  800c65:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800c68:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  800c6b:	eb 06                	jmp    800c73 <strcmp+0x11>
+		p++, q++;
+  800c6d:	83 c1 01             	add    $0x1,%ecx
+  800c70:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800c73:	0f b6 01             	movzbl (%ecx),%eax
+  800c76:	84 c0                	test   %al,%al
+  800c78:	74 04                	je     800c7e <strcmp+0x1c>
+  800c7a:	3a 02                	cmp    (%edx),%al
+  800c7c:	74 ef                	je     800c6d <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  800c7e:	0f b6 c0             	movzbl %al,%eax
+  800c81:	0f b6 12             	movzbl (%edx),%edx
+  800c84:	29 d0                	sub    %edx,%eax
+}
+  800c86:	5d                   	pop    %ebp
+  800c87:	c3                   	ret
+
+00800c88 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800c88:	55                   	push   %ebp
+  800c89:	89 e5                	mov    %esp,%ebp
+  800c8b:	53                   	push   %ebx
+  800c8c:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c8f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c92:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  800c95:	eb 09                	jmp    800ca0 <strncmp+0x18>
+		n--, p++, q++;
+  800c97:	83 ea 01             	sub    $0x1,%edx
+  800c9a:	83 c0 01             	add    $0x1,%eax
+  800c9d:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  800ca0:	85 d2                	test   %edx,%edx
+  800ca2:	74 18                	je     800cbc <strncmp+0x34>
+  800ca4:	0f b6 18             	movzbl (%eax),%ebx
+  800ca7:	84 db                	test   %bl,%bl
+  800ca9:	74 04                	je     800caf <strncmp+0x27>
+  800cab:	3a 19                	cmp    (%ecx),%bl
+  800cad:	74 e8                	je     800c97 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800caf:	0f b6 00             	movzbl (%eax),%eax
+  800cb2:	0f b6 11             	movzbl (%ecx),%edx
+  800cb5:	29 d0                	sub    %edx,%eax
+}
+  800cb7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800cba:	c9                   	leave
+  800cbb:	c3                   	ret
+		return 0;
+  800cbc:	b8 00 00 00 00       	mov    $0x0,%eax
+  800cc1:	eb f4                	jmp    800cb7 <strncmp+0x2f>
+
+00800cc3 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800cc3:	55                   	push   %ebp
+  800cc4:	89 e5                	mov    %esp,%ebp
+  800cc6:	8b 45 08             	mov    0x8(%ebp),%eax
+  800cc9:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800ccd:	eb 03                	jmp    800cd2 <strchr+0xf>
+  800ccf:	83 c0 01             	add    $0x1,%eax
+  800cd2:	0f b6 10             	movzbl (%eax),%edx
+  800cd5:	84 d2                	test   %dl,%dl
+  800cd7:	74 06                	je     800cdf <strchr+0x1c>
+		if (*s == c)
+  800cd9:	38 ca                	cmp    %cl,%dl
+  800cdb:	75 f2                	jne    800ccf <strchr+0xc>
+  800cdd:	eb 05                	jmp    800ce4 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  800cdf:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800ce4:	5d                   	pop    %ebp
+  800ce5:	c3                   	ret
+
+00800ce6 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800ce6:	55                   	push   %ebp
+  800ce7:	89 e5                	mov    %esp,%ebp
+  800ce9:	8b 45 08             	mov    0x8(%ebp),%eax
+  800cec:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800cf0:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800cf3:	38 ca                	cmp    %cl,%dl
+  800cf5:	74 09                	je     800d00 <strfind+0x1a>
+  800cf7:	84 d2                	test   %dl,%dl
+  800cf9:	74 05                	je     800d00 <strfind+0x1a>
+	for (; *s; s++)
+  800cfb:	83 c0 01             	add    $0x1,%eax
+  800cfe:	eb f0                	jmp    800cf0 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  800d00:	5d                   	pop    %ebp
+  800d01:	c3                   	ret
+
+00800d02 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800d02:	55                   	push   %ebp
+  800d03:	89 e5                	mov    %esp,%ebp
+  800d05:	57                   	push   %edi
+  800d06:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800d09:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  800d0c:	85 c9                	test   %ecx,%ecx
+  800d0e:	74 20                	je     800d30 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800d10:	89 f8                	mov    %edi,%eax
+  800d12:	09 c8                	or     %ecx,%eax
+  800d14:	a8 03                	test   $0x3,%al
+  800d16:	75 12                	jne    800d2a <memset+0x28>
+		c &= 0xFF;
+  800d18:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800d1c:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800d22:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800d25:	fc                   	cld
+  800d26:	f3 ab                	rep stos %eax,%es:(%edi)
+  800d28:	eb 06                	jmp    800d30 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  800d2a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800d2d:	fc                   	cld
+  800d2e:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  800d30:	89 f8                	mov    %edi,%eax
+  800d32:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800d35:	c9                   	leave
+  800d36:	c3                   	ret
+
+00800d37 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800d37:	55                   	push   %ebp
+  800d38:	89 e5                	mov    %esp,%ebp
+  800d3a:	57                   	push   %edi
+  800d3b:	56                   	push   %esi
+  800d3c:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d3f:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800d42:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800d45:	39 c6                	cmp    %eax,%esi
+  800d47:	73 32                	jae    800d7b <memmove+0x44>
+  800d49:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800d4c:	39 d0                	cmp    %edx,%eax
+  800d4e:	73 2b                	jae    800d7b <memmove+0x44>
+		s += n;
+		d += n;
+  800d50:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800d53:	89 d6                	mov    %edx,%esi
+  800d55:	09 fe                	or     %edi,%esi
+  800d57:	09 ce                	or     %ecx,%esi
+  800d59:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800d5f:	75 0e                	jne    800d6f <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800d61:	83 ef 04             	sub    $0x4,%edi
+  800d64:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800d67:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800d6a:	fd                   	std
+  800d6b:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800d6d:	eb 09                	jmp    800d78 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800d6f:	83 ef 01             	sub    $0x1,%edi
+  800d72:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800d75:	fd                   	std
+  800d76:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800d78:	fc                   	cld
+  800d79:	eb 1a                	jmp    800d95 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800d7b:	89 f2                	mov    %esi,%edx
+  800d7d:	09 c2                	or     %eax,%edx
+  800d7f:	09 ca                	or     %ecx,%edx
+  800d81:	f6 c2 03             	test   $0x3,%dl
+  800d84:	75 0a                	jne    800d90 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800d86:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800d89:	89 c7                	mov    %eax,%edi
+  800d8b:	fc                   	cld
+  800d8c:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800d8e:	eb 05                	jmp    800d95 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800d90:	89 c7                	mov    %eax,%edi
+  800d92:	fc                   	cld
+  800d93:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800d95:	5e                   	pop    %esi
+  800d96:	5f                   	pop    %edi
+  800d97:	5d                   	pop    %ebp
+  800d98:	c3                   	ret
+
+00800d99 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800d99:	55                   	push   %ebp
+  800d9a:	89 e5                	mov    %esp,%ebp
+  800d9c:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800d9f:	ff 75 10             	push   0x10(%ebp)
+  800da2:	ff 75 0c             	push   0xc(%ebp)
+  800da5:	ff 75 08             	push   0x8(%ebp)
+  800da8:	e8 8a ff ff ff       	call   800d37 <memmove>
+}
+  800dad:	c9                   	leave
+  800dae:	c3                   	ret
+
+00800daf <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800daf:	55                   	push   %ebp
+  800db0:	89 e5                	mov    %esp,%ebp
+  800db2:	56                   	push   %esi
+  800db3:	53                   	push   %ebx
+  800db4:	8b 45 08             	mov    0x8(%ebp),%eax
+  800db7:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800dba:	89 c6                	mov    %eax,%esi
+  800dbc:	03 75 10             	add    0x10(%ebp),%esi
+  800dbf:	eb 06                	jmp    800dc7 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800dc1:	83 c0 01             	add    $0x1,%eax
+  800dc4:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800dc7:	39 f0                	cmp    %esi,%eax
+  800dc9:	74 14                	je     800ddf <memcmp+0x30>
+		if (*s1 != *s2)
+  800dcb:	0f b6 08             	movzbl (%eax),%ecx
+  800dce:	0f b6 1a             	movzbl (%edx),%ebx
+  800dd1:	38 d9                	cmp    %bl,%cl
+  800dd3:	74 ec                	je     800dc1 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800dd5:	0f b6 c1             	movzbl %cl,%eax
+  800dd8:	0f b6 db             	movzbl %bl,%ebx
+  800ddb:	29 d8                	sub    %ebx,%eax
+  800ddd:	eb 05                	jmp    800de4 <memcmp+0x35>
+	}
+
+	return 0;
+  800ddf:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800de4:	5b                   	pop    %ebx
+  800de5:	5e                   	pop    %esi
+  800de6:	5d                   	pop    %ebp
+  800de7:	c3                   	ret
+
+00800de8 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800de8:	55                   	push   %ebp
+  800de9:	89 e5                	mov    %esp,%ebp
+  800deb:	8b 45 08             	mov    0x8(%ebp),%eax
+  800dee:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800df1:	89 c2                	mov    %eax,%edx
+  800df3:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800df6:	eb 03                	jmp    800dfb <memfind+0x13>
+  800df8:	83 c0 01             	add    $0x1,%eax
+  800dfb:	39 d0                	cmp    %edx,%eax
+  800dfd:	73 04                	jae    800e03 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800dff:	38 08                	cmp    %cl,(%eax)
+  800e01:	75 f5                	jne    800df8 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800e03:	5d                   	pop    %ebp
+  800e04:	c3                   	ret
+
+00800e05 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800e05:	55                   	push   %ebp
+  800e06:	89 e5                	mov    %esp,%ebp
+  800e08:	57                   	push   %edi
+  800e09:	56                   	push   %esi
+  800e0a:	53                   	push   %ebx
+  800e0b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e0e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800e11:	eb 03                	jmp    800e16 <strtol+0x11>
+		s++;
+  800e13:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800e16:	0f b6 02             	movzbl (%edx),%eax
+  800e19:	3c 20                	cmp    $0x20,%al
+  800e1b:	74 f6                	je     800e13 <strtol+0xe>
+  800e1d:	3c 09                	cmp    $0x9,%al
+  800e1f:	74 f2                	je     800e13 <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  800e21:	3c 2b                	cmp    $0x2b,%al
+  800e23:	74 2a                	je     800e4f <strtol+0x4a>
+	int neg = 0;
+  800e25:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800e2a:	3c 2d                	cmp    $0x2d,%al
+  800e2c:	74 2b                	je     800e59 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800e2e:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800e34:	75 0f                	jne    800e45 <strtol+0x40>
+  800e36:	80 3a 30             	cmpb   $0x30,(%edx)
+  800e39:	74 28                	je     800e63 <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800e3b:	85 db                	test   %ebx,%ebx
+  800e3d:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800e42:	0f 44 d8             	cmove  %eax,%ebx
+  800e45:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800e4a:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800e4d:	eb 46                	jmp    800e95 <strtol+0x90>
+		s++;
+  800e4f:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800e52:	bf 00 00 00 00       	mov    $0x0,%edi
+  800e57:	eb d5                	jmp    800e2e <strtol+0x29>
+		s++, neg = 1;
+  800e59:	83 c2 01             	add    $0x1,%edx
+  800e5c:	bf 01 00 00 00       	mov    $0x1,%edi
+  800e61:	eb cb                	jmp    800e2e <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800e63:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800e67:	74 0e                	je     800e77 <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800e69:	85 db                	test   %ebx,%ebx
+  800e6b:	75 d8                	jne    800e45 <strtol+0x40>
+		s++, base = 8;
+  800e6d:	83 c2 01             	add    $0x1,%edx
+  800e70:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800e75:	eb ce                	jmp    800e45 <strtol+0x40>
+		s += 2, base = 16;
+  800e77:	83 c2 02             	add    $0x2,%edx
+  800e7a:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800e7f:	eb c4                	jmp    800e45 <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800e81:	0f be c0             	movsbl %al,%eax
+  800e84:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800e87:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800e8a:	7d 3a                	jge    800ec6 <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800e8c:	83 c2 01             	add    $0x1,%edx
+  800e8f:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800e93:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800e95:	0f b6 02             	movzbl (%edx),%eax
+  800e98:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800e9b:	89 f3                	mov    %esi,%ebx
+  800e9d:	80 fb 09             	cmp    $0x9,%bl
+  800ea0:	76 df                	jbe    800e81 <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800ea2:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800ea5:	89 f3                	mov    %esi,%ebx
+  800ea7:	80 fb 19             	cmp    $0x19,%bl
+  800eaa:	77 08                	ja     800eb4 <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800eac:	0f be c0             	movsbl %al,%eax
+  800eaf:	83 e8 57             	sub    $0x57,%eax
+  800eb2:	eb d3                	jmp    800e87 <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800eb4:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800eb7:	89 f3                	mov    %esi,%ebx
+  800eb9:	80 fb 19             	cmp    $0x19,%bl
+  800ebc:	77 08                	ja     800ec6 <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800ebe:	0f be c0             	movsbl %al,%eax
+  800ec1:	83 e8 37             	sub    $0x37,%eax
+  800ec4:	eb c1                	jmp    800e87 <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800ec6:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800eca:	74 05                	je     800ed1 <strtol+0xcc>
+		*endptr = (char *) s;
+  800ecc:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800ecf:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800ed1:	89 c8                	mov    %ecx,%eax
+  800ed3:	f7 d8                	neg    %eax
+  800ed5:	85 ff                	test   %edi,%edi
+  800ed7:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800eda:	89 c8                	mov    %ecx,%eax
+  800edc:	5b                   	pop    %ebx
+  800edd:	5e                   	pop    %esi
+  800ede:	5f                   	pop    %edi
+  800edf:	5d                   	pop    %ebp
+  800ee0:	c3                   	ret
+
+00800ee1 <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800ee1:	55                   	push   %ebp
+  800ee2:	89 e5                	mov    %esp,%ebp
+  800ee4:	57                   	push   %edi
+  800ee5:	56                   	push   %esi
+  800ee6:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800ee7:	b8 00 00 00 00       	mov    $0x0,%eax
+  800eec:	8b 55 08             	mov    0x8(%ebp),%edx
+  800eef:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ef2:	89 c3                	mov    %eax,%ebx
+  800ef4:	89 c7                	mov    %eax,%edi
+  800ef6:	55                   	push   %ebp
+  800ef7:	89 e5                	mov    %esp,%ebp
+  800ef9:	8d 35 01 0f 80 00    	lea    0x800f01,%esi
+  800eff:	0f 34                	sysenter
+  800f01:	5d                   	pop    %ebp
+	syscall2(SYS_cputs, 0, (uint32_t)s, len, 0, 0);
+}
+  800f02:	5b                   	pop    %ebx
+  800f03:	5e                   	pop    %esi
+  800f04:	5f                   	pop    %edi
+  800f05:	5d                   	pop    %ebp
+  800f06:	c3                   	ret
+
+00800f07 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800f07:	55                   	push   %ebp
+  800f08:	89 e5                	mov    %esp,%ebp
+  800f0a:	57                   	push   %edi
+  800f0b:	56                   	push   %esi
+  800f0c:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800f0d:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f12:	b8 01 00 00 00       	mov    $0x1,%eax
+  800f17:	89 d1                	mov    %edx,%ecx
+  800f19:	89 d3                	mov    %edx,%ebx
+  800f1b:	89 d7                	mov    %edx,%edi
+  800f1d:	55                   	push   %ebp
+  800f1e:	89 e5                	mov    %esp,%ebp
+  800f20:	8d 35 28 0f 80 00    	lea    0x800f28,%esi
+  800f26:	0f 34                	sysenter
+  800f28:	5d                   	pop    %ebp
+	return syscall2(SYS_cgetc, 0, 0, 0, 0, 0);
+}
+  800f29:	5b                   	pop    %ebx
+  800f2a:	5e                   	pop    %esi
+  800f2b:	5f                   	pop    %edi
+  800f2c:	5d                   	pop    %ebp
+  800f2d:	c3                   	ret
+
+00800f2e <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800f2e:	55                   	push   %ebp
+  800f2f:	89 e5                	mov    %esp,%ebp
+  800f31:	57                   	push   %edi
+  800f32:	56                   	push   %esi
+  800f33:	53                   	push   %ebx
+  800f34:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800f37:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800f3c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f3f:	b8 03 00 00 00       	mov    $0x3,%eax
+  800f44:	89 cb                	mov    %ecx,%ebx
+  800f46:	89 cf                	mov    %ecx,%edi
+  800f48:	55                   	push   %ebp
+  800f49:	89 e5                	mov    %esp,%ebp
+  800f4b:	8d 35 53 0f 80 00    	lea    0x800f53,%esi
+  800f51:	0f 34                	sysenter
+  800f53:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800f54:	85 c0                	test   %eax,%eax
+  800f56:	7f 08                	jg     800f60 <sys_env_destroy+0x32>
+	return syscall2(SYS_env_destroy, 1, envid, 0, 0, 0);
+}
+  800f58:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f5b:	5b                   	pop    %ebx
+  800f5c:	5e                   	pop    %esi
+  800f5d:	5f                   	pop    %edi
+  800f5e:	5d                   	pop    %ebp
+  800f5f:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800f60:	83 ec 0c             	sub    $0xc,%esp
+  800f63:	50                   	push   %eax
+  800f64:	6a 03                	push   $0x3
+  800f66:	68 07 46 80 00       	push   $0x804607
+  800f6b:	6a 3d                	push   $0x3d
+  800f6d:	68 24 46 80 00       	push   $0x804624
+  800f72:	e8 71 f5 ff ff       	call   8004e8 <_panic>
+
+00800f77 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800f77:	55                   	push   %ebp
+  800f78:	89 e5                	mov    %esp,%ebp
+  800f7a:	57                   	push   %edi
+  800f7b:	56                   	push   %esi
+  800f7c:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800f7d:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f82:	b8 02 00 00 00       	mov    $0x2,%eax
+  800f87:	89 d1                	mov    %edx,%ecx
+  800f89:	89 d3                	mov    %edx,%ebx
+  800f8b:	89 d7                	mov    %edx,%edi
+  800f8d:	55                   	push   %ebp
+  800f8e:	89 e5                	mov    %esp,%ebp
+  800f90:	8d 35 98 0f 80 00    	lea    0x800f98,%esi
+  800f96:	0f 34                	sysenter
+  800f98:	5d                   	pop    %ebp
+	 return syscall2(SYS_getenvid, 0, 0, 0, 0, 0);
+}
+  800f99:	5b                   	pop    %ebx
+  800f9a:	5e                   	pop    %esi
+  800f9b:	5f                   	pop    %edi
+  800f9c:	5d                   	pop    %ebp
+  800f9d:	c3                   	ret
+
+00800f9e <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800f9e:	55                   	push   %ebp
+  800f9f:	89 e5                	mov    %esp,%ebp
+  800fa1:	57                   	push   %edi
+  800fa2:	56                   	push   %esi
+  800fa3:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800fa4:	ba 00 00 00 00       	mov    $0x0,%edx
+  800fa9:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800fae:	89 d1                	mov    %edx,%ecx
+  800fb0:	89 d3                	mov    %edx,%ebx
+  800fb2:	89 d7                	mov    %edx,%edi
+  800fb4:	89 d6                	mov    %edx,%esi
+  800fb6:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800fb8:	5b                   	pop    %ebx
+  800fb9:	5e                   	pop    %esi
+  800fba:	5f                   	pop    %edi
+  800fbb:	5d                   	pop    %ebp
+  800fbc:	c3                   	ret
+
+00800fbd <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800fbd:	55                   	push   %ebp
+  800fbe:	89 e5                	mov    %esp,%ebp
+  800fc0:	57                   	push   %edi
+  800fc1:	56                   	push   %esi
+  800fc2:	53                   	push   %ebx
+  800fc3:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800fc6:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fc9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fcc:	b8 04 00 00 00       	mov    $0x4,%eax
+  800fd1:	bf 00 00 00 00       	mov    $0x0,%edi
+  800fd6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800fd9:	55                   	push   %ebp
+  800fda:	89 e5                	mov    %esp,%ebp
+  800fdc:	8d 35 e4 0f 80 00    	lea    0x800fe4,%esi
+  800fe2:	0f 34                	sysenter
+  800fe4:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800fe5:	85 c0                	test   %eax,%eax
+  800fe7:	7f 08                	jg     800ff1 <sys_page_alloc+0x34>
+	return syscall2(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0);
+}
+  800fe9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fec:	5b                   	pop    %ebx
+  800fed:	5e                   	pop    %esi
+  800fee:	5f                   	pop    %edi
+  800fef:	5d                   	pop    %ebp
+  800ff0:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ff1:	83 ec 0c             	sub    $0xc,%esp
+  800ff4:	50                   	push   %eax
+  800ff5:	6a 04                	push   $0x4
+  800ff7:	68 07 46 80 00       	push   $0x804607
+  800ffc:	6a 3d                	push   $0x3d
+  800ffe:	68 24 46 80 00       	push   $0x804624
+  801003:	e8 e0 f4 ff ff       	call   8004e8 <_panic>
+
+00801008 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  801008:	55                   	push   %ebp
+  801009:	89 e5                	mov    %esp,%ebp
+  80100b:	57                   	push   %edi
+  80100c:	56                   	push   %esi
+  80100d:	53                   	push   %ebx
+  80100e:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801011:	8b 55 08             	mov    0x8(%ebp),%edx
+  801014:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801017:	b8 05 00 00 00       	mov    $0x5,%eax
+  80101c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80101f:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801022:	8b 75 18             	mov    0x18(%ebp),%esi
+  801025:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801027:	85 c0                	test   %eax,%eax
+  801029:	7f 08                	jg     801033 <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  80102b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80102e:	5b                   	pop    %ebx
+  80102f:	5e                   	pop    %esi
+  801030:	5f                   	pop    %edi
+  801031:	5d                   	pop    %ebp
+  801032:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801033:	83 ec 0c             	sub    $0xc,%esp
+  801036:	50                   	push   %eax
+  801037:	6a 05                	push   $0x5
+  801039:	68 07 46 80 00       	push   $0x804607
+  80103e:	6a 23                	push   $0x23
+  801040:	68 24 46 80 00       	push   $0x804624
+  801045:	e8 9e f4 ff ff       	call   8004e8 <_panic>
+
+0080104a <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  80104a:	55                   	push   %ebp
+  80104b:	89 e5                	mov    %esp,%ebp
+  80104d:	57                   	push   %edi
+  80104e:	56                   	push   %esi
+  80104f:	53                   	push   %ebx
+  801050:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  801053:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801058:	8b 55 08             	mov    0x8(%ebp),%edx
+  80105b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80105e:	b8 06 00 00 00       	mov    $0x6,%eax
+  801063:	89 df                	mov    %ebx,%edi
+  801065:	55                   	push   %ebp
+  801066:	89 e5                	mov    %esp,%ebp
+  801068:	8d 35 70 10 80 00    	lea    0x801070,%esi
+  80106e:	0f 34                	sysenter
+  801070:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801071:	85 c0                	test   %eax,%eax
+  801073:	7f 08                	jg     80107d <sys_page_unmap+0x33>
+	return syscall2(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0);
+}
+  801075:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801078:	5b                   	pop    %ebx
+  801079:	5e                   	pop    %esi
+  80107a:	5f                   	pop    %edi
+  80107b:	5d                   	pop    %ebp
+  80107c:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80107d:	83 ec 0c             	sub    $0xc,%esp
+  801080:	50                   	push   %eax
+  801081:	6a 06                	push   $0x6
+  801083:	68 07 46 80 00       	push   $0x804607
+  801088:	6a 3d                	push   $0x3d
+  80108a:	68 24 46 80 00       	push   $0x804624
+  80108f:	e8 54 f4 ff ff       	call   8004e8 <_panic>
+
+00801094 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  801094:	55                   	push   %ebp
+  801095:	89 e5                	mov    %esp,%ebp
+  801097:	57                   	push   %edi
+  801098:	56                   	push   %esi
+  801099:	53                   	push   %ebx
+  80109a:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  80109d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010a2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010a5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010a8:	b8 08 00 00 00       	mov    $0x8,%eax
+  8010ad:	89 df                	mov    %ebx,%edi
+  8010af:	55                   	push   %ebp
+  8010b0:	89 e5                	mov    %esp,%ebp
+  8010b2:	8d 35 ba 10 80 00    	lea    0x8010ba,%esi
+  8010b8:	0f 34                	sysenter
+  8010ba:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  8010bb:	85 c0                	test   %eax,%eax
+  8010bd:	7f 08                	jg     8010c7 <sys_env_set_status+0x33>
+	return syscall2(SYS_env_set_status, 1, envid, status, 0, 0);
+}
+  8010bf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010c2:	5b                   	pop    %ebx
+  8010c3:	5e                   	pop    %esi
+  8010c4:	5f                   	pop    %edi
+  8010c5:	5d                   	pop    %ebp
+  8010c6:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8010c7:	83 ec 0c             	sub    $0xc,%esp
+  8010ca:	50                   	push   %eax
+  8010cb:	6a 08                	push   $0x8
+  8010cd:	68 07 46 80 00       	push   $0x804607
+  8010d2:	6a 3d                	push   $0x3d
+  8010d4:	68 24 46 80 00       	push   $0x804624
+  8010d9:	e8 0a f4 ff ff       	call   8004e8 <_panic>
+
+008010de <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  8010de:	55                   	push   %ebp
+  8010df:	89 e5                	mov    %esp,%ebp
+  8010e1:	57                   	push   %edi
+  8010e2:	56                   	push   %esi
+  8010e3:	53                   	push   %ebx
+  8010e4:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  8010e7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010ec:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010ef:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010f2:	b8 09 00 00 00       	mov    $0x9,%eax
+  8010f7:	89 df                	mov    %ebx,%edi
+  8010f9:	55                   	push   %ebp
+  8010fa:	89 e5                	mov    %esp,%ebp
+  8010fc:	8d 35 04 11 80 00    	lea    0x801104,%esi
+  801102:	0f 34                	sysenter
+  801104:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  801105:	85 c0                	test   %eax,%eax
+  801107:	7f 08                	jg     801111 <sys_env_set_trapframe+0x33>
+	return syscall2(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0);
+}
+  801109:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80110c:	5b                   	pop    %ebx
+  80110d:	5e                   	pop    %esi
+  80110e:	5f                   	pop    %edi
+  80110f:	5d                   	pop    %ebp
+  801110:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801111:	83 ec 0c             	sub    $0xc,%esp
+  801114:	50                   	push   %eax
+  801115:	6a 09                	push   $0x9
+  801117:	68 07 46 80 00       	push   $0x804607
+  80111c:	6a 3d                	push   $0x3d
+  80111e:	68 24 46 80 00       	push   $0x804624
+  801123:	e8 c0 f3 ff ff       	call   8004e8 <_panic>
+
+00801128 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  801128:	55                   	push   %ebp
+  801129:	89 e5                	mov    %esp,%ebp
+  80112b:	57                   	push   %edi
+  80112c:	56                   	push   %esi
+  80112d:	53                   	push   %ebx
+  80112e:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  801131:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801136:	8b 55 08             	mov    0x8(%ebp),%edx
+  801139:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80113c:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801141:	89 df                	mov    %ebx,%edi
+  801143:	55                   	push   %ebp
+  801144:	89 e5                	mov    %esp,%ebp
+  801146:	8d 35 4e 11 80 00    	lea    0x80114e,%esi
+  80114c:	0f 34                	sysenter
+  80114e:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  80114f:	85 c0                	test   %eax,%eax
+  801151:	7f 08                	jg     80115b <sys_env_set_pgfault_upcall+0x33>
+	return syscall2(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0);
+}
+  801153:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801156:	5b                   	pop    %ebx
+  801157:	5e                   	pop    %esi
+  801158:	5f                   	pop    %edi
+  801159:	5d                   	pop    %ebp
+  80115a:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  80115b:	83 ec 0c             	sub    $0xc,%esp
+  80115e:	50                   	push   %eax
+  80115f:	6a 0a                	push   $0xa
+  801161:	68 07 46 80 00       	push   $0x804607
+  801166:	6a 3d                	push   $0x3d
+  801168:	68 24 46 80 00       	push   $0x804624
+  80116d:	e8 76 f3 ff ff       	call   8004e8 <_panic>
+
+00801172 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  801172:	55                   	push   %ebp
+  801173:	89 e5                	mov    %esp,%ebp
+  801175:	57                   	push   %edi
+  801176:	56                   	push   %esi
+  801177:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  801178:	8b 55 08             	mov    0x8(%ebp),%edx
+  80117b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80117e:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801183:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801186:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801189:	55                   	push   %ebp
+  80118a:	89 e5                	mov    %esp,%ebp
+  80118c:	8d 35 94 11 80 00    	lea    0x801194,%esi
+  801192:	0f 34                	sysenter
+  801194:	5d                   	pop    %ebp
+	return syscall2(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm);
+}
+  801195:	5b                   	pop    %ebx
+  801196:	5e                   	pop    %esi
+  801197:	5f                   	pop    %edi
+  801198:	5d                   	pop    %ebp
+  801199:	c3                   	ret
+
+0080119a <sys_ipc_try_sendv>:
+
+int
+sys_ipc_try_sendv(envid_t envid, uint32_t value, const uintptr_t *pages, int npages)
+{
+  80119a:	55                   	push   %ebp
+  80119b:	89 e5                	mov    %esp,%ebp
+  80119d:	57                   	push   %edi
+  80119e:	56                   	push   %esi
+  80119f:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  8011a0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011a3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011a6:	b8 17 00 00 00       	mov    $0x17,%eax
+  8011ab:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8011ae:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8011b1:	55                   	push   %ebp
+  8011b2:	89 e5                	mov    %esp,%ebp
+  8011b4:	8d 35 bc 11 80 00    	lea    0x8011bc,%esi
+  8011ba:	0f 34                	sysenter
+  8011bc:	5d                   	pop    %ebp
+	return syscall2(SYS_ipc_try_sendv, 0, envid, value, (uint32_t) pages, npages);
+}
+  8011bd:	5b                   	pop    %ebx
+  8011be:	5e                   	pop    %esi
+  8011bf:	5f                   	pop    %edi
+  8011c0:	5d                   	pop    %ebp
+  8011c1:	c3                   	ret
+
+008011c2 <sys_ipc_recvv>:
+	return sys_ipc_recvv(dstva, 1, 0);
+}
+
+int
+sys_ipc_recvv(void *dstva, int npages, int flags)
+{
+  8011c2:	55                   	push   %ebp
+  8011c3:	89 e5                	mov    %esp,%ebp
+  8011c5:	57                   	push   %edi
+  8011c6:	56                   	push   %esi
+  8011c7:	53                   	push   %ebx
+  8011c8:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  8011cb:	be 00 00 00 00       	mov    $0x0,%esi
+  8011d0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011d3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011d6:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8011db:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8011de:	89 f7                	mov    %esi,%edi
+  8011e0:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  8011e2:	85 c0                	test   %eax,%eax
+  8011e4:	7f 08                	jg     8011ee <sys_ipc_recvv+0x2c>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npages, flags, 0, 0);
+}
+  8011e6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011e9:	5b                   	pop    %ebx
+  8011ea:	5e                   	pop    %esi
+  8011eb:	5f                   	pop    %edi
+  8011ec:	5d                   	pop    %ebp
+  8011ed:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  8011ee:	83 ec 0c             	sub    $0xc,%esp
+  8011f1:	50                   	push   %eax
+  8011f2:	6a 0d                	push   $0xd
+  8011f4:	68 07 46 80 00       	push   $0x804607
+  8011f9:	6a 23                	push   $0x23
+  8011fb:	68 24 46 80 00       	push   $0x804624
+  801200:	e8 e3 f2 ff ff       	call   8004e8 <_panic>
+
+00801205 <sys_ipc_recv>:
+{
+  801205:	55                   	push   %ebp
+  801206:	89 e5                	mov    %esp,%ebp
+  801208:	83 ec 0c             	sub    $0xc,%esp
+	return sys_ipc_recvv(dstva, 1, 0);
+  80120b:	6a 00                	push   $0x0
+  80120d:	6a 01                	push   $0x1
+  80120f:	ff 75 08             	push   0x8(%ebp)
+  801212:	e8 ab ff ff ff       	call   8011c2 <sys_ipc_recvv>
+}
+  801217:	c9                   	leave
+  801218:	c3                   	ret
+
+00801219 <sys_ipc_recv_until>:
+
+int
+sys_ipc_recv_until(void *dstva, int npages, unsigned int deadline)
+{
+  801219:	55                   	push   %ebp
+  80121a:	89 e5                	mov    %esp,%ebp
+  80121c:	57                   	push   %edi
+  80121d:	56                   	push   %esi
+  80121e:	53                   	push   %ebx
+  80121f:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  801222:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801227:	8b 55 08             	mov    0x8(%ebp),%edx
+  80122a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80122d:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801232:	8b 7d 10             	mov    0x10(%ebp),%edi
+  801235:	89 de                	mov    %ebx,%esi
+  801237:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  801239:	85 c0                	test   %eax,%eax
+  80123b:	7f 08                	jg     801245 <sys_ipc_recv_until+0x2c>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npages, 0, deadline, 0);
+}
+  80123d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801240:	5b                   	pop    %ebx
+  801241:	5e                   	pop    %esi
+  801242:	5f                   	pop    %edi
+  801243:	5d                   	pop    %ebp
+  801244:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  801245:	83 ec 0c             	sub    $0xc,%esp
+  801248:	50                   	push   %eax
+  801249:	6a 0d                	push   $0xd
+  80124b:	68 07 46 80 00       	push   $0x804607
+  801250:	6a 23                	push   $0x23
+  801252:	68 24 46 80 00       	push   $0x804624
+  801257:	e8 8c f2 ff ff       	call   8004e8 <_panic>
+
+0080125c <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  80125c:	55                   	push   %ebp
+  80125d:	89 e5                	mov    %esp,%ebp
+  80125f:	57                   	push   %edi
+  801260:	56                   	push   %esi
+  801261:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  801262:	ba 00 00 00 00       	mov    $0x0,%edx
+  801267:	b8 0e 00 00 00       	mov    $0xe,%eax
+  80126c:	89 d1                	mov    %edx,%ecx
+  80126e:	89 d3                	mov    %edx,%ebx
+  801270:	89 d7                	mov    %edx,%edi
+  801272:	55                   	push   %ebp
+  801273:	89 e5                	mov    %esp,%ebp
+  801275:	8d 35 7d 12 80 00    	lea    0x80127d,%esi
+  80127b:	0f 34                	sysenter
+  80127d:	5d                   	pop    %ebp
+	return (unsigned int) syscall2(SYS_time_msec, 0, 0, 0, 0, 0);
+}
+  80127e:	5b                   	pop    %ebx
+  80127f:	5e                   	pop    %esi
+  801280:	5f                   	pop    %edi
+  801281:	5d                   	pop    %ebp
+  801282:	c3                   	ret
+
+00801283 <sys_net_try_send>:
+
+size_t
+sys_net_try_send(void *packet, size_t length)
+{
+  801283:	55                   	push   %ebp
+  801284:	89 e5                	mov    %esp,%ebp
+  801286:	57                   	push   %edi
+  801287:	56                   	push   %esi
+  801288:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  801289:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80128e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801291:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801294:	b8 0f 00 00 00       	mov    $0xf,%eax
+  801299:	89 df                	mov    %ebx,%edi
+  80129b:	55                   	push   %ebp
+  80129c:	89 e5                	mov    %esp,%ebp
+  80129e:	8d 35 a6 12 80 00    	lea    0x8012a6,%esi
+  8012a4:	0f 34                	sysenter
+  8012a6:	5d                   	pop    %ebp
+	return syscall2(SYS_net_try_send, 0, (uint32_t) packet, length, 0, 0);
+}
+  8012a7:	5b                   	pop    %ebx
+  8012a8:	5e                   	pop    %esi
+  8012a9:	5f                   	pop    %edi
+  8012aa:	5d                   	pop    %ebp
+  8012ab:	c3                   	ret
+
+008012ac <sys_net_try_recv>:
+
+size_t
+sys_net_try_recv(uint8_t *buffer)
+{
+  8012ac:	55                   	push   %ebp
+  8012ad:	89 e5                	mov    %esp,%ebp
+  8012af:	57                   	push   %edi
+  8012b0:	56                   	push   %esi
+  8012b1:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  8012b2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8012b7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012ba:	b8 10 00 00 00       	mov    $0x10,%eax
+  8012bf:	89 cb                	mov    %ecx,%ebx
+  8012c1:	89 cf                	mov    %ecx,%edi
+  8012c3:	55                   	push   %ebp
+  8012c4:	89 e5                	mov    %esp,%ebp
+  8012c6:	8d 35 ce 12 80 00    	lea    0x8012ce,%esi
+  8012cc:	0f 34                	sysenter
+  8012ce:	5d                   	pop    %ebp
+	return syscall2(SYS_net_try_recv, 0, (uint32_t) buffer, 0, 0, 0);
+}
+  8012cf:	5b                   	pop    %ebx
+  8012d0:	5e                   	pop    %esi
+  8012d1:	5f                   	pop    %edi
+  8012d2:	5d                   	pop    %ebp
+  8012d3:	c3                   	ret
+
+008012d4 <sys_net_recv_pages>:
+
+int
+sys_net_recv_pages(void *dstva, int npages)
+{
+  8012d4:	55                   	push   %ebp
+  8012d5:	89 e5                	mov    %esp,%ebp
+  8012d7:	57                   	push   %edi
+  8012d8:	56                   	push   %esi
+  8012d9:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  8012da:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012df:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012e2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012e5:	b8 12 00 00 00       	mov    $0x12,%eax
+  8012ea:	89 df                	mov    %ebx,%edi
+  8012ec:	55                   	push   %ebp
+  8012ed:	89 e5                	mov    %esp,%ebp
+  8012ef:	8d 35 f7 12 80 00    	lea    0x8012f7,%esi
+  8012f5:	0f 34                	sysenter
+  8012f7:	5d                   	pop    %ebp
+	return syscall2(SYS_net_recv_pages, 0, (uint32_t) dstva, npages, 0, 0);
+}
+  8012f8:	5b                   	pop    %ebx
+  8012f9:	5e                   	pop    %esi
+  8012fa:	5f                   	pop    %edi
+  8012fb:	5d                   	pop    %ebp
+  8012fc:	c3                   	ret
+
+008012fd <sys_net_send_batch>:
+
+int
+sys_net_send_batch(const struct net_sg *pkts, int n)
+{
+  8012fd:	55                   	push   %ebp
+  8012fe:	89 e5                	mov    %esp,%ebp
+  801300:	57                   	push   %edi
+  801301:	56                   	push   %esi
+  801302:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  801303:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801308:	8b 55 08             	mov    0x8(%ebp),%edx
+  80130b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80130e:	b8 14 00 00 00       	mov    $0x14,%eax
+  801313:	89 df                	mov    %ebx,%edi
+  801315:	55                   	push   %ebp
+  801316:	89 e5                	mov    %esp,%ebp
+  801318:	8d 35 20 13 80 00    	lea    0x801320,%esi
+  80131e:	0f 34                	sysenter
+  801320:	5d                   	pop    %ebp
+	return syscall2(SYS_net_send_batch, 0, (uint32_t) pkts, n, 0, 0);
+}
+  801321:	5b                   	pop    %ebx
+  801322:	5e                   	pop    %esi
+  801323:	5f                   	pop    %edi
+  801324:	5d                   	pop    %ebp
+  801325:	c3                   	ret
+
+00801326 <sys_net_send_sg>:
+
+int
+sys_net_send_sg(const struct net_sg *sg, int nsg,
+		const struct net_offload *off, struct net_txinfo *info)
+{
+  801326:	55                   	push   %ebp
+  801327:	89 e5                	mov    %esp,%ebp
+  801329:	57                   	push   %edi
+  80132a:	56                   	push   %esi
+  80132b:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  80132c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80132f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801332:	b8 13 00 00 00       	mov    $0x13,%eax
+  801337:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80133a:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80133d:	55                   	push   %ebp
+  80133e:	89 e5                	mov    %esp,%ebp
+  801340:	8d 35 48 13 80 00    	lea    0x801348,%esi
+  801346:	0f 34                	sysenter
+  801348:	5d                   	pop    %ebp
+	return syscall2(SYS_net_send_sg, 0, (uint32_t) sg, nsg, (uint32_t) off,
+			(uint32_t) info);
+}
+  801349:	5b                   	pop    %ebx
+  80134a:	5e                   	pop    %esi
+  80134b:	5f                   	pop    %edi
+  80134c:	5d                   	pop    %ebp
+  80134d:	c3                   	ret
+
+0080134e <sys_net_wait>:
+
+int
+sys_net_wait(uint32_t events)
+{
+  80134e:	55                   	push   %ebp
+  80134f:	89 e5                	mov    %esp,%ebp
+  801351:	57                   	push   %edi
+  801352:	56                   	push   %esi
+  801353:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  801354:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801359:	8b 55 08             	mov    0x8(%ebp),%edx
+  80135c:	b8 11 00 00 00       	mov    $0x11,%eax
+  801361:	89 cb                	mov    %ecx,%ebx
+  801363:	89 cf                	mov    %ecx,%edi
+  801365:	89 ce                	mov    %ecx,%esi
+  801367:	cd 30                	int    $0x30
+	// Blocks, so it has to go through the trap gate.
+	return syscall(SYS_net_wait, 0, events, 0, 0, 0, 0);
+}
+  801369:	5b                   	pop    %ebx
+  80136a:	5e                   	pop    %esi
+  80136b:	5f                   	pop    %edi
+  80136c:	5d                   	pop    %ebp
+  80136d:	c3                   	ret
+
+0080136e <sys_net_map>:
+
+int
+sys_net_map(void *va)
+{
+  80136e:	55                   	push   %ebp
+  80136f:	89 e5                	mov    %esp,%ebp
+  801371:	57                   	push   %edi
+  801372:	56                   	push   %esi
+  801373:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  801374:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801379:	8b 55 08             	mov    0x8(%ebp),%edx
+  80137c:	b8 15 00 00 00       	mov    $0x15,%eax
+  801381:	89 cb                	mov    %ecx,%ebx
+  801383:	89 cf                	mov    %ecx,%edi
+  801385:	55                   	push   %ebp
+  801386:	89 e5                	mov    %esp,%ebp
+  801388:	8d 35 90 13 80 00    	lea    0x801390,%esi
+  80138e:	0f 34                	sysenter
+  801390:	5d                   	pop    %ebp
+	return syscall2(SYS_net_map, 0, (uint32_t) va, 0, 0, 0);
+}
+  801391:	5b                   	pop    %ebx
+  801392:	5e                   	pop    %esi
+  801393:	5f                   	pop    %edi
+  801394:	5d                   	pop    %ebp
+  801395:	c3                   	ret
+
+00801396 <sys_net_sync>:
+
+int
+sys_net_sync(uint32_t rings)
+{
+  801396:	55                   	push   %ebp
+  801397:	89 e5                	mov    %esp,%ebp
+  801399:	57                   	push   %edi
+  80139a:	56                   	push   %esi
+  80139b:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  80139c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8013a1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013a4:	b8 16 00 00 00       	mov    $0x16,%eax
+  8013a9:	89 cb                	mov    %ecx,%ebx
+  8013ab:	89 cf                	mov    %ecx,%edi
+  8013ad:	55                   	push   %ebp
+  8013ae:	89 e5                	mov    %esp,%ebp
+  8013b0:	8d 35 b8 13 80 00    	lea    0x8013b8,%esi
+  8013b6:	0f 34                	sysenter
+  8013b8:	5d                   	pop    %ebp
+	return syscall2(SYS_net_sync, 0, rings, 0, 0, 0);
+}
+  8013b9:	5b                   	pop    %ebx
+  8013ba:	5e                   	pop    %esi
+  8013bb:	5f                   	pop    %edi
+  8013bc:	5d                   	pop    %ebp
+  8013bd:	c3                   	ret
+
+008013be <copy_page_to>:
+// The handler cowpage found installed, which gets the faults that are
+// not copy-on-write faults.
+static void (*pgfault_next)(struct UTrapframe *utf);
+
+static int copy_page_to(envid_t envid, void *va, int perm)
+{
+  8013be:	55                   	push   %ebp
+  8013bf:	89 e5                	mov    %esp,%ebp
+  8013c1:	57                   	push   %edi
+  8013c2:	56                   	push   %esi
+  8013c3:	53                   	push   %ebx
+  8013c4:	83 ec 20             	sub    $0x20,%esp
+  8013c7:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8013ca:	89 d7                	mov    %edx,%edi
+  8013cc:	89 ce                	mov    %ecx,%esi
+	int r;
+
+	r = sys_page_alloc(0, (void *) PFTEMP, perm);
+  8013ce:	51                   	push   %ecx
+  8013cf:	68 00 f0 7f 00       	push   $0x7ff000
+  8013d4:	6a 00                	push   $0x0
+  8013d6:	e8 e2 fb ff ff       	call   800fbd <sys_page_alloc>
+  8013db:	89 c3                	mov    %eax,%ebx
+	if (r < 0)
+  8013dd:	83 c4 10             	add    $0x10,%esp
+  8013e0:	85 c0                	test   %eax,%eax
+  8013e2:	78 45                	js     801429 <copy_page_to+0x6b>
+		goto exit;
+	memmove((void *) PFTEMP, va, PGSIZE);
+  8013e4:	83 ec 04             	sub    $0x4,%esp
+  8013e7:	68 00 10 00 00       	push   $0x1000
+  8013ec:	57                   	push   %edi
+  8013ed:	68 00 f0 7f 00       	push   $0x7ff000
+  8013f2:	e8 40 f9 ff ff       	call   800d37 <memmove>
+	r = sys_page_map(0, (void *) PFTEMP, envid, va, perm);
+  8013f7:	89 34 24             	mov    %esi,(%esp)
+  8013fa:	57                   	push   %edi
+  8013fb:	ff 75 e4             	push   -0x1c(%ebp)
+  8013fe:	68 00 f0 7f 00       	push   $0x7ff000
+  801403:	6a 00                	push   $0x0
+  801405:	e8 fe fb ff ff       	call   801008 <sys_page_map>
+  80140a:	89 c3                	mov    %eax,%ebx
+	if (r < 0)
+  80140c:	83 c4 20             	add    $0x20,%esp
+  80140f:	85 c0                	test   %eax,%eax
+  801411:	78 16                	js     801429 <copy_page_to+0x6b>
+		goto exit;
+	assert(!sys_page_unmap(0, (void *) PFTEMP));
+  801413:	83 ec 08             	sub    $0x8,%esp
+  801416:	68 00 f0 7f 00       	push   $0x7ff000
+  80141b:	6a 00                	push   $0x0
+  80141d:	e8 28 fc ff ff       	call   80104a <sys_page_unmap>
+  801422:	83 c4 10             	add    $0x10,%esp
+  801425:	85 c0                	test   %eax,%eax
+  801427:	75 0a                	jne    801433 <copy_page_to+0x75>
+exit:
+	return r;
+}
+  801429:	89 d8                	mov    %ebx,%eax
+  80142b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80142e:	5b                   	pop    %ebx
+  80142f:	5e                   	pop    %esi
+  801430:	5f                   	pop    %edi
+  801431:	5d                   	pop    %ebp
+  801432:	c3                   	ret
+	assert(!sys_page_unmap(0, (void *) PFTEMP));
+  801433:	68 34 46 80 00       	push   $0x804634
+  801438:	68 ac 46 80 00       	push   $0x8046ac
+  80143d:	6a 1b                	push   $0x1b
+  80143f:	68 c1 46 80 00       	push   $0x8046c1
+  801444:	e8 9f f0 ff ff       	call   8004e8 <_panic>
+
+00801449 <pgfault>:
+// map in our own private writable copy.  Other faults go to the handler
+// cowpage replaced, if any.
+//
+static void
+pgfault(struct UTrapframe *utf)
+{
+  801449:	55                   	push   %ebp
+  80144a:	89 e5                	mov    %esp,%ebp
+  80144c:	53                   	push   %ebx
+  80144d:	83 ec 04             	sub    $0x4,%esp
+  801450:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	void *addr = (void *) utf->utf_fault_va;
+  801453:	8b 13                	mov    (%ebx),%edx
+	// Hint:
+	//   Use the read-only page table mappings at uvpt
+	//   (see <inc/memlayout.h>).
+
+	// LAB 4: Your code here.
+	if (!(err & FEC_WR) || !(uvpd[PDX(addr)] & PTE_P)
+  801455:	f6 43 04 02          	testb  $0x2,0x4(%ebx)
+  801459:	74 21                	je     80147c <pgfault+0x33>
+  80145b:	89 d0                	mov    %edx,%eax
+  80145d:	c1 e8 16             	shr    $0x16,%eax
+  801460:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801467:	a8 01                	test   $0x1,%al
+  801469:	74 11                	je     80147c <pgfault+0x33>
+	    || !(uvpt[PGNUM(addr)] & PTE_COW)) {
+  80146b:	89 d0                	mov    %edx,%eax
+  80146d:	c1 e8 0c             	shr    $0xc,%eax
+  801470:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801477:	f6 c4 08             	test   $0x8,%ah
+  80147a:	75 17                	jne    801493 <pgfault+0x4a>
+		if (pgfault_next) {
+  80147c:	a1 04 60 80 00       	mov    0x806004,%eax
+  801481:	85 c0                	test   %eax,%eax
+  801483:	74 27                	je     8014ac <pgfault+0x63>
+			pgfault_next(utf);
+  801485:	83 ec 0c             	sub    $0xc,%esp
+  801488:	53                   	push   %ebx
+  801489:	ff d0                	call   *%eax
+			return;
+  80148b:	83 c4 10             	add    $0x10,%esp
+exit:
+	cprintf("[%08x] pgfault: Can't handle page fault happened at"
+		"0x%08x, eip: 0x%08x. Exiting...\n", thisenv->env_id,
+		utf->utf_fault_va, utf->utf_eip);
+	sys_env_destroy(0);
+}
+  80148e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801491:	c9                   	leave
+  801492:	c3                   	ret
+	if (copy_page_to(0, ROUNDDOWN(addr, PGSIZE), PTE_U | PTE_W | PTE_P) < 0)
+  801493:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+  801499:	b9 07 00 00 00       	mov    $0x7,%ecx
+  80149e:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014a3:	e8 16 ff ff ff       	call   8013be <copy_page_to>
+  8014a8:	85 c0                	test   %eax,%eax
+  8014aa:	79 e2                	jns    80148e <pgfault+0x45>
+		"0x%08x, eip: 0x%08x. Exiting...\n", thisenv->env_id,
+  8014ac:	a1 00 60 80 00       	mov    0x806000,%eax
+  8014b1:	8b 40 48             	mov    0x48(%eax),%eax
+	cprintf("[%08x] pgfault: Can't handle page fault happened at"
+  8014b4:	ff 73 28             	push   0x28(%ebx)
+  8014b7:	ff 33                	push   (%ebx)
+  8014b9:	50                   	push   %eax
+  8014ba:	68 58 46 80 00       	push   $0x804658
+  8014bf:	e8 ff f0 ff ff       	call   8005c3 <cprintf>
+	sys_env_destroy(0);
+  8014c4:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  8014cb:	e8 5e fa ff ff       	call   800f2e <sys_env_destroy>
+  8014d0:	83 c4 10             	add    $0x10,%esp
+  8014d3:	eb b9                	jmp    80148e <pgfault+0x45>
+
+008014d5 <cowpage>:
+//
+// Returns: 0 on success, < 0 on error.
+//
+int
+cowpage(void *va)
+{
+  8014d5:	55                   	push   %ebp
+  8014d6:	89 e5                	mov    %esp,%ebp
+  8014d8:	53                   	push   %ebx
+  8014d9:	83 ec 04             	sub    $0x4,%esp
+  8014dc:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (_pgfault_handler != pgfault) {
+  8014df:	a1 04 a0 80 00       	mov    0x80a004,%eax
+  8014e4:	3d 49 14 80 00       	cmp    $0x801449,%eax
+  8014e9:	74 15                	je     801500 <cowpage+0x2b>
+		pgfault_next = _pgfault_handler;
+  8014eb:	a3 04 60 80 00       	mov    %eax,0x806004
+		set_pgfault_handler(pgfault);
+  8014f0:	83 ec 0c             	sub    $0xc,%esp
+  8014f3:	68 49 14 80 00       	push   $0x801449
+  8014f8:	e8 86 27 00 00       	call   803c83 <set_pgfault_handler>
+  8014fd:	83 c4 10             	add    $0x10,%esp
+	}
+	return sys_page_map(0, va, 0, va, PTE_COW | PTE_U | PTE_P);
+  801500:	83 ec 0c             	sub    $0xc,%esp
+  801503:	68 05 08 00 00       	push   $0x805
+  801508:	53                   	push   %ebx
+  801509:	6a 00                	push   $0x0
+  80150b:	53                   	push   %ebx
+  80150c:	6a 00                	push   $0x0
+  80150e:	e8 f5 fa ff ff       	call   801008 <sys_page_map>
+}
+  801513:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801516:	c9                   	leave
+  801517:	c3                   	ret
+
+00801518 <fork>:
+//   Neither user exception stack should ever be marked copy-on-write,
+//   so you must allocate a new page for the child's user exception stack.
+//
+envid_t
+fork(void)
+{
+  801518:	55                   	push   %ebp
+  801519:	89 e5                	mov    %esp,%ebp
+  80151b:	57                   	push   %edi
+  80151c:	56                   	push   %esi
+  80151d:	53                   	push   %ebx
+  80151e:	83 ec 28             	sub    $0x28,%esp
+	// LAB 4: Your code here.
+	envid_t envid;
+	int r;
+
+	set_pgfault_handler(pgfault);
+  801521:	68 49 14 80 00       	push   $0x801449
+  801526:	e8 58 27 00 00       	call   803c83 <set_pgfault_handler>
+// child pointing to the trashed stack frame.
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	asm volatile("int %2"
+  80152b:	b8 07 00 00 00       	mov    $0x7,%eax
+  801530:	cd 30                	int    $0x30
+  801532:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  801535:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	envid = sys_exofork();
+	if (envid < 0)
+  801538:	83 c4 10             	add    $0x10,%esp
+  80153b:	85 c0                	test   %eax,%eax
+  80153d:	0f 88 6b 01 00 00    	js     8016ae <fork+0x196>
+	else if (envid == 0) {
+		thisenv = &envs[ENVX(sys_getenvid())];
+		return 0;
+	}
+
+	for (uintptr_t addr = 0; addr < UTOP; addr += PGSIZE) {
+  801543:	bb 00 00 00 00       	mov    $0x0,%ebx
+	else if (envid == 0) {
+  801548:	75 37                	jne    801581 <fork+0x69>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  80154a:	e8 28 fa ff ff       	call   800f77 <sys_getenvid>
+  80154f:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801554:	69 c0 8c 00 00 00    	imul   $0x8c,%eax,%eax
+  80155a:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80155f:	a3 00 60 80 00       	mov    %eax,0x806000
+		return 0;
+  801564:	e9 45 01 00 00       	jmp    8016ae <fork+0x196>
+		if (!(uvpd[PDX(addr)] & PTE_P)) {
+			addr += PTSIZE - PGSIZE;
+  801569:	81 c3 00 f0 3f 00    	add    $0x3ff000,%ebx
+	for (uintptr_t addr = 0; addr < UTOP; addr += PGSIZE) {
+  80156f:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801575:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  80157b:	0f 87 ba 00 00 00    	ja     80163b <fork+0x123>
+		if (!(uvpd[PDX(addr)] & PTE_P)) {
+  801581:	89 d8                	mov    %ebx,%eax
+  801583:	c1 e8 16             	shr    $0x16,%eax
+  801586:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  80158d:	a8 01                	test   $0x1,%al
+  80158f:	74 d8                	je     801569 <fork+0x51>
+			continue;
+		}
+		if (!(uvpt[PGNUM(addr)] & PTE_P))
+  801591:	89 d8                	mov    %ebx,%eax
+  801593:	c1 e8 0c             	shr    $0xc,%eax
+  801596:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  80159d:	f6 c2 01             	test   $0x1,%dl
+  8015a0:	74 cd                	je     80156f <fork+0x57>
+			continue;
+		if (addr == USTACKTOP - PGSIZE || addr == UXSTACKTOP - PGSIZE)
+  8015a2:	89 da                	mov    %ebx,%edx
+  8015a4:	80 e6 df             	and    $0xdf,%dh
+  8015a7:	81 fa 00 d0 bf ee    	cmp    $0xeebfd000,%edx
+  8015ad:	74 c0                	je     80156f <fork+0x57>
+	void *va = (void *) (pn << PGSHIFT);
+  8015af:	89 df                	mov    %ebx,%edi
+	if ((uvpt[pn] & PTE_SHARE) ||
+  8015b1:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8015b8:	f6 c6 04             	test   $0x4,%dh
+  8015bb:	75 53                	jne    801610 <fork+0xf8>
+	    (!(uvpt[pn] & PTE_COW) && !(uvpt[pn] & PTE_W)))
+  8015bd:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+	if ((uvpt[pn] & PTE_SHARE) ||
+  8015c4:	f6 c6 08             	test   $0x8,%dh
+  8015c7:	75 0c                	jne    8015d5 <fork+0xbd>
+	    (!(uvpt[pn] & PTE_COW) && !(uvpt[pn] & PTE_W)))
+  8015c9:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8015d0:	f6 c2 02             	test   $0x2,%dl
+  8015d3:	74 3b                	je     801610 <fork+0xf8>
+	r = sys_page_map(0, va, envid, va, PTE_COW | PTE_U | PTE_P);
+  8015d5:	83 ec 0c             	sub    $0xc,%esp
+  8015d8:	68 05 08 00 00       	push   $0x805
+  8015dd:	57                   	push   %edi
+  8015de:	ff 75 e4             	push   -0x1c(%ebp)
+  8015e1:	57                   	push   %edi
+  8015e2:	6a 00                	push   $0x0
+  8015e4:	e8 1f fa ff ff       	call   801008 <sys_page_map>
+  8015e9:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  8015eb:	83 c4 20             	add    $0x20,%esp
+  8015ee:	85 c0                	test   %eax,%eax
+  8015f0:	0f 88 a7 00 00 00    	js     80169d <fork+0x185>
+	r = sys_page_map(0, va, 0, va, PTE_COW | PTE_U | PTE_P);
+  8015f6:	83 ec 0c             	sub    $0xc,%esp
+  8015f9:	68 05 08 00 00       	push   $0x805
+  8015fe:	57                   	push   %edi
+  8015ff:	6a 00                	push   $0x0
+  801601:	57                   	push   %edi
+  801602:	6a 00                	push   $0x0
+  801604:	e8 ff f9 ff ff       	call   801008 <sys_page_map>
+  801609:	89 c6                	mov    %eax,%esi
+	return r;
+  80160b:	83 c4 20             	add    $0x20,%esp
+  80160e:	eb 21                	jmp    801631 <fork+0x119>
+		return sys_page_map(0, va, envid, va, uvpt[pn] & PTE_SYSCALL);
+  801610:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801617:	83 ec 0c             	sub    $0xc,%esp
+  80161a:	25 07 0e 00 00       	and    $0xe07,%eax
+  80161f:	50                   	push   %eax
+  801620:	57                   	push   %edi
+  801621:	ff 75 e4             	push   -0x1c(%ebp)
+  801624:	57                   	push   %edi
+  801625:	6a 00                	push   $0x0
+  801627:	e8 dc f9 ff ff       	call   801008 <sys_page_map>
+  80162c:	89 c6                	mov    %eax,%esi
+  80162e:	83 c4 20             	add    $0x20,%esp
+			continue;
+		r = duppage(envid, PGNUM(addr));
+		if (r < 0)
+  801631:	85 f6                	test   %esi,%esi
+  801633:	0f 89 36 ff ff ff    	jns    80156f <fork+0x57>
+  801639:	eb 62                	jmp    80169d <fork+0x185>
+			goto exit;
+	}
+
+	r = copy_page_to(envid, (void *) USTACKTOP - PGSIZE, PTE_U | PTE_W | PTE_P);
+  80163b:	b9 07 00 00 00       	mov    $0x7,%ecx
+  801640:	ba 00 d0 bf ee       	mov    $0xeebfd000,%edx
+  801645:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  801648:	89 f8                	mov    %edi,%eax
+  80164a:	e8 6f fd ff ff       	call   8013be <copy_page_to>
+  80164f:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  801651:	85 c0                	test   %eax,%eax
+  801653:	78 48                	js     80169d <fork+0x185>
+		goto exit;
+	r = sys_page_alloc(envid, (void *) UXSTACKTOP - PGSIZE, PTE_U | PTE_W | PTE_P);
+  801655:	83 ec 04             	sub    $0x4,%esp
+  801658:	6a 07                	push   $0x7
+  80165a:	68 00 f0 bf ee       	push   $0xeebff000
+  80165f:	57                   	push   %edi
+  801660:	e8 58 f9 ff ff       	call   800fbd <sys_page_alloc>
+  801665:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  801667:	83 c4 10             	add    $0x10,%esp
+  80166a:	85 c0                	test   %eax,%eax
+  80166c:	78 2f                	js     80169d <fork+0x185>
+		goto exit;
+	r = sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall);
+  80166e:	a1 00 60 80 00       	mov    0x806000,%eax
+  801673:	8b 40 64             	mov    0x64(%eax),%eax
+  801676:	83 ec 08             	sub    $0x8,%esp
+  801679:	50                   	push   %eax
+  80167a:	57                   	push   %edi
+  80167b:	e8 a8 fa ff ff       	call   801128 <sys_env_set_pgfault_upcall>
+  801680:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  801682:	83 c4 10             	add    $0x10,%esp
+  801685:	85 c0                	test   %eax,%eax
+  801687:	78 14                	js     80169d <fork+0x185>
+		goto exit;
+	r = sys_env_set_status(envid, ENV_RUNNABLE);
+  801689:	83 ec 08             	sub    $0x8,%esp
+  80168c:	6a 02                	push   $0x2
+  80168e:	57                   	push   %edi
+  80168f:	e8 00 fa ff ff       	call   801094 <sys_env_set_status>
+  801694:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  801696:	83 c4 10             	add    $0x10,%esp
+  801699:	85 c0                	test   %eax,%eax
+  80169b:	79 11                	jns    8016ae <fork+0x196>
+		goto exit;
+	return envid;
+exit:
+	sys_env_destroy(envid);
+  80169d:	83 ec 0c             	sub    $0xc,%esp
+  8016a0:	ff 75 e0             	push   -0x20(%ebp)
+  8016a3:	e8 86 f8 ff ff       	call   800f2e <sys_env_destroy>
+	return r;
+  8016a8:	83 c4 10             	add    $0x10,%esp
+  8016ab:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+}
+  8016ae:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8016b1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8016b4:	5b                   	pop    %ebx
+  8016b5:	5e                   	pop    %esi
+  8016b6:	5f                   	pop    %edi
+  8016b7:	5d                   	pop    %ebp
+  8016b8:	c3                   	ret
+
+008016b9 <sfork>:
+
+// Challenge!
+int
+sfork(void)
+{
+  8016b9:	55                   	push   %ebp
+  8016ba:	89 e5                	mov    %esp,%ebp
+  8016bc:	83 ec 0c             	sub    $0xc,%esp
+	panic("sfork not implemented");
+  8016bf:	68 cc 46 80 00       	push   $0x8046cc
+  8016c4:	68 bf 00 00 00       	push   $0xbf
+  8016c9:	68 c1 46 80 00       	push   $0x8046c1
+  8016ce:	e8 15 ee ff ff       	call   8004e8 <_panic>
+
+008016d3 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  8016d3:	55                   	push   %ebp
+  8016d4:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8016d6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8016d9:	05 00 00 00 30       	add    $0x30000000,%eax
+  8016de:	c1 e8 0c             	shr    $0xc,%eax
+}
+  8016e1:	5d                   	pop    %ebp
+  8016e2:	c3                   	ret
+
+008016e3 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  8016e3:	55                   	push   %ebp
+  8016e4:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8016e6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8016e9:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  8016ee:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  8016f3:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  8016f8:	5d                   	pop    %ebp
+  8016f9:	c3                   	ret
+
+008016fa <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  8016fa:	55                   	push   %ebp
+  8016fb:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  8016fd:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  801702:	eb 02                	jmp    801706 <fd_alloc+0xc>
+  801704:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  801706:	89 c2                	mov    %eax,%edx
+  801708:	c1 ea 16             	shr    $0x16,%edx
+  80170b:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801712:	f6 c2 01             	test   $0x1,%dl
+  801715:	74 2b                	je     801742 <fd_alloc+0x48>
+  801717:	89 c2                	mov    %eax,%edx
+  801719:	c1 ea 0c             	shr    $0xc,%edx
+  80171c:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  801723:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  801729:	f6 c1 01             	test   $0x1,%cl
+  80172c:	74 14                	je     801742 <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  80172e:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  801734:	75 ce                	jne    801704 <fd_alloc+0xa>
+  801736:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  80173b:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  801740:	eb 05                	jmp    801747 <fd_alloc+0x4d>
+			return 0;
+  801742:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  801747:	8b 55 08             	mov    0x8(%ebp),%edx
+  80174a:	89 02                	mov    %eax,(%edx)
+}
+  80174c:	89 c8                	mov    %ecx,%eax
+  80174e:	5d                   	pop    %ebp
+  80174f:	c3                   	ret
+
+00801750 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  801750:	55                   	push   %ebp
+  801751:	89 e5                	mov    %esp,%ebp
+  801753:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  801756:	83 f8 1f             	cmp    $0x1f,%eax
+  801759:	77 30                	ja     80178b <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  80175b:	c1 e0 0c             	shl    $0xc,%eax
+  80175e:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  801763:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  801769:	f6 c2 01             	test   $0x1,%dl
+  80176c:	74 24                	je     801792 <fd_lookup+0x42>
+  80176e:	89 c2                	mov    %eax,%edx
+  801770:	c1 ea 0c             	shr    $0xc,%edx
+  801773:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  80177a:	f6 c2 01             	test   $0x1,%dl
+  80177d:	74 1a                	je     801799 <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  80177f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801782:	89 02                	mov    %eax,(%edx)
+	return 0;
+  801784:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801789:	5d                   	pop    %ebp
+  80178a:	c3                   	ret
+		return -E_INVAL;
+  80178b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801790:	eb f7                	jmp    801789 <fd_lookup+0x39>
+		return -E_INVAL;
+  801792:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801797:	eb f0                	jmp    801789 <fd_lookup+0x39>
+  801799:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80179e:	eb e9                	jmp    801789 <fd_lookup+0x39>
+
+008017a0 <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  8017a0:	55                   	push   %ebp
+  8017a1:	89 e5                	mov    %esp,%ebp
+  8017a3:	53                   	push   %ebx
+  8017a4:	83 ec 04             	sub    $0x4,%esp
+  8017a7:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  8017aa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017af:	eb 03                	jmp    8017b4 <dev_lookup+0x14>
+  8017b1:	83 c0 01             	add    $0x1,%eax
+  8017b4:	8b 1c 85 60 47 80 00 	mov    0x804760(,%eax,4),%ebx
+  8017bb:	85 db                	test   %ebx,%ebx
+  8017bd:	74 0b                	je     8017ca <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  8017bf:	39 13                	cmp    %edx,(%ebx)
+  8017c1:	75 ee                	jne    8017b1 <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  8017c3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017c8:	eb 1f                	jmp    8017e9 <dev_lookup+0x49>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8017ca:	a1 00 60 80 00       	mov    0x806000,%eax
+  8017cf:	8b 40 48             	mov    0x48(%eax),%eax
+  8017d2:	83 ec 04             	sub    $0x4,%esp
+  8017d5:	52                   	push   %edx
+  8017d6:	50                   	push   %eax
+  8017d7:	68 e4 46 80 00       	push   $0x8046e4
+  8017dc:	e8 e2 ed ff ff       	call   8005c3 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  8017e1:	83 c4 10             	add    $0x10,%esp
+  8017e4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  8017e9:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8017ec:	89 1a                	mov    %ebx,(%edx)
+}
+  8017ee:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8017f1:	c9                   	leave
+  8017f2:	c3                   	ret
+
+008017f3 <fd_close>:
+{
+  8017f3:	55                   	push   %ebp
+  8017f4:	89 e5                	mov    %esp,%ebp
+  8017f6:	57                   	push   %edi
+  8017f7:	56                   	push   %esi
+  8017f8:	53                   	push   %ebx
+  8017f9:	83 ec 24             	sub    $0x24,%esp
+  8017fc:	8b 75 08             	mov    0x8(%ebp),%esi
+  8017ff:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801802:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801805:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801806:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  80180c:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  80180f:	50                   	push   %eax
+  801810:	e8 3b ff ff ff       	call   801750 <fd_lookup>
+  801815:	89 c3                	mov    %eax,%ebx
+  801817:	83 c4 10             	add    $0x10,%esp
+  80181a:	85 c0                	test   %eax,%eax
+  80181c:	78 05                	js     801823 <fd_close+0x30>
+	    || fd != fd2)
+  80181e:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801821:	74 16                	je     801839 <fd_close+0x46>
+		return (must_exist ? r : 0);
+  801823:	89 f8                	mov    %edi,%eax
+  801825:	84 c0                	test   %al,%al
+  801827:	b8 00 00 00 00       	mov    $0x0,%eax
+  80182c:	0f 44 d8             	cmove  %eax,%ebx
+}
+  80182f:	89 d8                	mov    %ebx,%eax
+  801831:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801834:	5b                   	pop    %ebx
+  801835:	5e                   	pop    %esi
+  801836:	5f                   	pop    %edi
+  801837:	5d                   	pop    %ebp
+  801838:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801839:	83 ec 08             	sub    $0x8,%esp
+  80183c:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  80183f:	50                   	push   %eax
+  801840:	ff 36                	push   (%esi)
+  801842:	e8 59 ff ff ff       	call   8017a0 <dev_lookup>
+  801847:	89 c3                	mov    %eax,%ebx
+  801849:	83 c4 10             	add    $0x10,%esp
+  80184c:	85 c0                	test   %eax,%eax
+  80184e:	78 1a                	js     80186a <fd_close+0x77>
+		if (dev->dev_close)
+  801850:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801853:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  801856:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  80185b:	85 c0                	test   %eax,%eax
+  80185d:	74 0b                	je     80186a <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  80185f:	83 ec 0c             	sub    $0xc,%esp
+  801862:	56                   	push   %esi
+  801863:	ff d0                	call   *%eax
+  801865:	89 c3                	mov    %eax,%ebx
+  801867:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  80186a:	83 ec 08             	sub    $0x8,%esp
+  80186d:	56                   	push   %esi
+  80186e:	6a 00                	push   $0x0
+  801870:	e8 d5 f7 ff ff       	call   80104a <sys_page_unmap>
+	return r;
+  801875:	83 c4 10             	add    $0x10,%esp
+  801878:	eb b5                	jmp    80182f <fd_close+0x3c>
+
+0080187a <close>:
+
+int
+close(int fdnum)
+{
+  80187a:	55                   	push   %ebp
+  80187b:	89 e5                	mov    %esp,%ebp
+  80187d:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801880:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801883:	50                   	push   %eax
+  801884:	ff 75 08             	push   0x8(%ebp)
+  801887:	e8 c4 fe ff ff       	call   801750 <fd_lookup>
+  80188c:	83 c4 10             	add    $0x10,%esp
+  80188f:	85 c0                	test   %eax,%eax
+  801891:	79 02                	jns    801895 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  801893:	c9                   	leave
+  801894:	c3                   	ret
+		return fd_close(fd, 1);
+  801895:	83 ec 08             	sub    $0x8,%esp
+  801898:	6a 01                	push   $0x1
+  80189a:	ff 75 f4             	push   -0xc(%ebp)
+  80189d:	e8 51 ff ff ff       	call   8017f3 <fd_close>
+  8018a2:	83 c4 10             	add    $0x10,%esp
+  8018a5:	eb ec                	jmp    801893 <close+0x19>
+
+008018a7 <close_all>:
+
+void
+close_all(void)
+{
+  8018a7:	55                   	push   %ebp
+  8018a8:	89 e5                	mov    %esp,%ebp
+  8018aa:	53                   	push   %ebx
+  8018ab:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  8018ae:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  8018b3:	83 ec 0c             	sub    $0xc,%esp
+  8018b6:	53                   	push   %ebx
+  8018b7:	e8 be ff ff ff       	call   80187a <close>
+	for (i = 0; i < MAXFD; i++)
+  8018bc:	83 c3 01             	add    $0x1,%ebx
+  8018bf:	83 c4 10             	add    $0x10,%esp
+  8018c2:	83 fb 20             	cmp    $0x20,%ebx
+  8018c5:	75 ec                	jne    8018b3 <close_all+0xc>
+}
+  8018c7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8018ca:	c9                   	leave
+  8018cb:	c3                   	ret
+
+008018cc <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  8018cc:	55                   	push   %ebp
+  8018cd:	89 e5                	mov    %esp,%ebp
+  8018cf:	57                   	push   %edi
+  8018d0:	56                   	push   %esi
+  8018d1:	53                   	push   %ebx
+  8018d2:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  8018d5:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8018d8:	50                   	push   %eax
+  8018d9:	ff 75 08             	push   0x8(%ebp)
+  8018dc:	e8 6f fe ff ff       	call   801750 <fd_lookup>
+  8018e1:	89 c3                	mov    %eax,%ebx
+  8018e3:	83 c4 10             	add    $0x10,%esp
+  8018e6:	85 c0                	test   %eax,%eax
+  8018e8:	78 7f                	js     801969 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  8018ea:	83 ec 0c             	sub    $0xc,%esp
+  8018ed:	ff 75 0c             	push   0xc(%ebp)
+  8018f0:	e8 85 ff ff ff       	call   80187a <close>
+
+	newfd = INDEX2FD(newfdnum);
+  8018f5:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8018f8:	c1 e6 0c             	shl    $0xc,%esi
+  8018fb:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  801901:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801904:	89 3c 24             	mov    %edi,(%esp)
+  801907:	e8 d7 fd ff ff       	call   8016e3 <fd2data>
+  80190c:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  80190e:	89 34 24             	mov    %esi,(%esp)
+  801911:	e8 cd fd ff ff       	call   8016e3 <fd2data>
+  801916:	83 c4 10             	add    $0x10,%esp
+  801919:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  80191c:	89 d8                	mov    %ebx,%eax
+  80191e:	c1 e8 16             	shr    $0x16,%eax
+  801921:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801928:	a8 01                	test   $0x1,%al
+  80192a:	74 11                	je     80193d <dup+0x71>
+  80192c:	89 d8                	mov    %ebx,%eax
+  80192e:	c1 e8 0c             	shr    $0xc,%eax
+  801931:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801938:	f6 c2 01             	test   $0x1,%dl
+  80193b:	75 36                	jne    801973 <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  80193d:	89 f8                	mov    %edi,%eax
+  80193f:	c1 e8 0c             	shr    $0xc,%eax
+  801942:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801949:	83 ec 0c             	sub    $0xc,%esp
+  80194c:	25 07 0e 00 00       	and    $0xe07,%eax
+  801951:	50                   	push   %eax
+  801952:	56                   	push   %esi
+  801953:	6a 00                	push   $0x0
+  801955:	57                   	push   %edi
+  801956:	6a 00                	push   $0x0
+  801958:	e8 ab f6 ff ff       	call   801008 <sys_page_map>
+  80195d:	89 c3                	mov    %eax,%ebx
+  80195f:	83 c4 20             	add    $0x20,%esp
+  801962:	85 c0                	test   %eax,%eax
+  801964:	78 33                	js     801999 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  801966:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  801969:	89 d8                	mov    %ebx,%eax
+  80196b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80196e:	5b                   	pop    %ebx
+  80196f:	5e                   	pop    %esi
+  801970:	5f                   	pop    %edi
+  801971:	5d                   	pop    %ebp
+  801972:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  801973:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80197a:	83 ec 0c             	sub    $0xc,%esp
+  80197d:	25 07 0e 00 00       	and    $0xe07,%eax
+  801982:	50                   	push   %eax
+  801983:	ff 75 d4             	push   -0x2c(%ebp)
+  801986:	6a 00                	push   $0x0
+  801988:	53                   	push   %ebx
+  801989:	6a 00                	push   $0x0
+  80198b:	e8 78 f6 ff ff       	call   801008 <sys_page_map>
+  801990:	89 c3                	mov    %eax,%ebx
+  801992:	83 c4 20             	add    $0x20,%esp
+  801995:	85 c0                	test   %eax,%eax
+  801997:	79 a4                	jns    80193d <dup+0x71>
+	sys_page_unmap(0, newfd);
+  801999:	83 ec 08             	sub    $0x8,%esp
+  80199c:	56                   	push   %esi
+  80199d:	6a 00                	push   $0x0
+  80199f:	e8 a6 f6 ff ff       	call   80104a <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  8019a4:	83 c4 08             	add    $0x8,%esp
+  8019a7:	ff 75 d4             	push   -0x2c(%ebp)
+  8019aa:	6a 00                	push   $0x0
+  8019ac:	e8 99 f6 ff ff       	call   80104a <sys_page_unmap>
+	return r;
+  8019b1:	83 c4 10             	add    $0x10,%esp
+  8019b4:	eb b3                	jmp    801969 <dup+0x9d>
+
+008019b6 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  8019b6:	55                   	push   %ebp
+  8019b7:	89 e5                	mov    %esp,%ebp
+  8019b9:	56                   	push   %esi
+  8019ba:	53                   	push   %ebx
+  8019bb:	83 ec 18             	sub    $0x18,%esp
+  8019be:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8019c1:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8019c4:	50                   	push   %eax
+  8019c5:	56                   	push   %esi
+  8019c6:	e8 85 fd ff ff       	call   801750 <fd_lookup>
+  8019cb:	83 c4 10             	add    $0x10,%esp
+  8019ce:	85 c0                	test   %eax,%eax
+  8019d0:	78 3c                	js     801a0e <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8019d2:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  8019d5:	83 ec 08             	sub    $0x8,%esp
+  8019d8:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8019db:	50                   	push   %eax
+  8019dc:	ff 33                	push   (%ebx)
+  8019de:	e8 bd fd ff ff       	call   8017a0 <dev_lookup>
+  8019e3:	83 c4 10             	add    $0x10,%esp
+  8019e6:	85 c0                	test   %eax,%eax
+  8019e8:	78 24                	js     801a0e <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  8019ea:	8b 43 08             	mov    0x8(%ebx),%eax
+  8019ed:	83 e0 03             	and    $0x3,%eax
+  8019f0:	83 f8 01             	cmp    $0x1,%eax
+  8019f3:	74 20                	je     801a15 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  8019f5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8019f8:	8b 40 08             	mov    0x8(%eax),%eax
+  8019fb:	85 c0                	test   %eax,%eax
+  8019fd:	74 37                	je     801a36 <read+0x80>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  8019ff:	83 ec 04             	sub    $0x4,%esp
+  801a02:	ff 75 10             	push   0x10(%ebp)
+  801a05:	ff 75 0c             	push   0xc(%ebp)
+  801a08:	53                   	push   %ebx
+  801a09:	ff d0                	call   *%eax
+  801a0b:	83 c4 10             	add    $0x10,%esp
+}
+  801a0e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801a11:	5b                   	pop    %ebx
+  801a12:	5e                   	pop    %esi
+  801a13:	5d                   	pop    %ebp
+  801a14:	c3                   	ret
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801a15:	a1 00 60 80 00       	mov    0x806000,%eax
+  801a1a:	8b 40 48             	mov    0x48(%eax),%eax
+  801a1d:	83 ec 04             	sub    $0x4,%esp
+  801a20:	56                   	push   %esi
+  801a21:	50                   	push   %eax
+  801a22:	68 25 47 80 00       	push   $0x804725
+  801a27:	e8 97 eb ff ff       	call   8005c3 <cprintf>
+		return -E_INVAL;
+  801a2c:	83 c4 10             	add    $0x10,%esp
+  801a2f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801a34:	eb d8                	jmp    801a0e <read+0x58>
+		return -E_NOT_SUPP;
+  801a36:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801a3b:	eb d1                	jmp    801a0e <read+0x58>
+
+00801a3d <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  801a3d:	55                   	push   %ebp
+  801a3e:	89 e5                	mov    %esp,%ebp
+  801a40:	57                   	push   %edi
+  801a41:	56                   	push   %esi
+  801a42:	53                   	push   %ebx
+  801a43:	83 ec 0c             	sub    $0xc,%esp
+  801a46:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801a49:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  801a4c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801a51:	eb 02                	jmp    801a55 <readn+0x18>
+  801a53:	01 c3                	add    %eax,%ebx
+  801a55:	39 f3                	cmp    %esi,%ebx
+  801a57:	73 21                	jae    801a7a <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801a59:	83 ec 04             	sub    $0x4,%esp
+  801a5c:	89 f0                	mov    %esi,%eax
+  801a5e:	29 d8                	sub    %ebx,%eax
+  801a60:	50                   	push   %eax
+  801a61:	89 d8                	mov    %ebx,%eax
+  801a63:	03 45 0c             	add    0xc(%ebp),%eax
+  801a66:	50                   	push   %eax
+  801a67:	57                   	push   %edi
+  801a68:	e8 49 ff ff ff       	call   8019b6 <read>
+		if (m < 0)
+  801a6d:	83 c4 10             	add    $0x10,%esp
+  801a70:	85 c0                	test   %eax,%eax
+  801a72:	78 04                	js     801a78 <readn+0x3b>
+			return m;
+		if (m == 0)
+  801a74:	75 dd                	jne    801a53 <readn+0x16>
+  801a76:	eb 02                	jmp    801a7a <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801a78:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  801a7a:	89 d8                	mov    %ebx,%eax
+  801a7c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801a7f:	5b                   	pop    %ebx
+  801a80:	5e                   	pop    %esi
+  801a81:	5f                   	pop    %edi
+  801a82:	5d                   	pop    %ebp
+  801a83:	c3                   	ret
+
+00801a84 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  801a84:	55                   	push   %ebp
+  801a85:	89 e5                	mov    %esp,%ebp
+  801a87:	56                   	push   %esi
+  801a88:	53                   	push   %ebx
+  801a89:	83 ec 18             	sub    $0x18,%esp
+  801a8c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801a8f:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801a92:	50                   	push   %eax
+  801a93:	53                   	push   %ebx
+  801a94:	e8 b7 fc ff ff       	call   801750 <fd_lookup>
+  801a99:	83 c4 10             	add    $0x10,%esp
+  801a9c:	85 c0                	test   %eax,%eax
+  801a9e:	78 37                	js     801ad7 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801aa0:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801aa3:	83 ec 08             	sub    $0x8,%esp
+  801aa6:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801aa9:	50                   	push   %eax
+  801aaa:	ff 36                	push   (%esi)
+  801aac:	e8 ef fc ff ff       	call   8017a0 <dev_lookup>
+  801ab1:	83 c4 10             	add    $0x10,%esp
+  801ab4:	85 c0                	test   %eax,%eax
+  801ab6:	78 1f                	js     801ad7 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801ab8:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801abc:	74 20                	je     801ade <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  801abe:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801ac1:	8b 40 0c             	mov    0xc(%eax),%eax
+  801ac4:	85 c0                	test   %eax,%eax
+  801ac6:	74 37                	je     801aff <write+0x7b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  801ac8:	83 ec 04             	sub    $0x4,%esp
+  801acb:	ff 75 10             	push   0x10(%ebp)
+  801ace:	ff 75 0c             	push   0xc(%ebp)
+  801ad1:	56                   	push   %esi
+  801ad2:	ff d0                	call   *%eax
+  801ad4:	83 c4 10             	add    $0x10,%esp
+}
+  801ad7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801ada:	5b                   	pop    %ebx
+  801adb:	5e                   	pop    %esi
+  801adc:	5d                   	pop    %ebp
+  801add:	c3                   	ret
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801ade:	a1 00 60 80 00       	mov    0x806000,%eax
+  801ae3:	8b 40 48             	mov    0x48(%eax),%eax
+  801ae6:	83 ec 04             	sub    $0x4,%esp
+  801ae9:	53                   	push   %ebx
+  801aea:	50                   	push   %eax
+  801aeb:	68 41 47 80 00       	push   $0x804741
+  801af0:	e8 ce ea ff ff       	call   8005c3 <cprintf>
+		return -E_INVAL;
+  801af5:	83 c4 10             	add    $0x10,%esp
+  801af8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801afd:	eb d8                	jmp    801ad7 <write+0x53>
+		return -E_NOT_SUPP;
+  801aff:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801b04:	eb d1                	jmp    801ad7 <write+0x53>
+
+00801b06 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  801b06:	55                   	push   %ebp
+  801b07:	89 e5                	mov    %esp,%ebp
+  801b09:	53                   	push   %ebx
+  801b0a:	83 ec 1c             	sub    $0x1c,%esp
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801b0d:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801b10:	50                   	push   %eax
+  801b11:	ff 75 08             	push   0x8(%ebp)
+  801b14:	e8 37 fc ff ff       	call   801750 <fd_lookup>
+  801b19:	83 c4 10             	add    $0x10,%esp
+  801b1c:	85 c0                	test   %eax,%eax
+  801b1e:	78 3a                	js     801b5a <seek+0x54>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801b20:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  801b23:	83 ec 08             	sub    $0x8,%esp
+  801b26:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801b29:	50                   	push   %eax
+  801b2a:	ff 33                	push   (%ebx)
+  801b2c:	e8 6f fc ff ff       	call   8017a0 <dev_lookup>
+  801b31:	83 c4 10             	add    $0x10,%esp
+  801b34:	85 c0                	test   %eax,%eax
+  801b36:	78 22                	js     801b5a <seek+0x54>
+		return r;
+	// Anything buffered for the old position goes out first.
+	if (dev->dev_sync && (r = (*dev->dev_sync)(fd)) < 0)
+  801b38:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801b3b:	8b 40 1c             	mov    0x1c(%eax),%eax
+  801b3e:	85 c0                	test   %eax,%eax
+  801b40:	74 0d                	je     801b4f <seek+0x49>
+  801b42:	83 ec 0c             	sub    $0xc,%esp
+  801b45:	53                   	push   %ebx
+  801b46:	ff d0                	call   *%eax
+  801b48:	83 c4 10             	add    $0x10,%esp
+  801b4b:	85 c0                	test   %eax,%eax
+  801b4d:	78 0b                	js     801b5a <seek+0x54>
+		return r;
+	fd->fd_offset = offset;
+  801b4f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801b52:	89 43 04             	mov    %eax,0x4(%ebx)
+	return 0;
+  801b55:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801b5a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801b5d:	c9                   	leave
+  801b5e:	c3                   	ret
+
+00801b5f <fsync>:
+
+// Push out anything the library has buffered for fdnum.
+int
+fsync(int fdnum)
+{
+  801b5f:	55                   	push   %ebp
+  801b60:	89 e5                	mov    %esp,%ebp
+  801b62:	53                   	push   %ebx
+  801b63:	83 ec 1c             	sub    $0x1c,%esp
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801b66:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801b69:	50                   	push   %eax
+  801b6a:	ff 75 08             	push   0x8(%ebp)
+  801b6d:	e8 de fb ff ff       	call   801750 <fd_lookup>
+  801b72:	83 c4 10             	add    $0x10,%esp
+  801b75:	85 c0                	test   %eax,%eax
+  801b77:	78 2b                	js     801ba4 <fsync+0x45>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801b79:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  801b7c:	83 ec 08             	sub    $0x8,%esp
+  801b7f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801b82:	50                   	push   %eax
+  801b83:	ff 33                	push   (%ebx)
+  801b85:	e8 16 fc ff ff       	call   8017a0 <dev_lookup>
+  801b8a:	83 c4 10             	add    $0x10,%esp
+  801b8d:	85 c0                	test   %eax,%eax
+  801b8f:	78 13                	js     801ba4 <fsync+0x45>
+		return r;
+	if (!dev->dev_sync)
+  801b91:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801b94:	8b 40 1c             	mov    0x1c(%eax),%eax
+  801b97:	85 c0                	test   %eax,%eax
+  801b99:	74 0e                	je     801ba9 <fsync+0x4a>
+		return 0;
+	return (*dev->dev_sync)(fd);
+  801b9b:	83 ec 0c             	sub    $0xc,%esp
+  801b9e:	53                   	push   %ebx
+  801b9f:	ff d0                	call   *%eax
+  801ba1:	83 c4 10             	add    $0x10,%esp
+}
+  801ba4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801ba7:	c9                   	leave
+  801ba8:	c3                   	ret
+		return 0;
+  801ba9:	b8 00 00 00 00       	mov    $0x0,%eax
+  801bae:	eb f4                	jmp    801ba4 <fsync+0x45>
+
+00801bb0 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  801bb0:	55                   	push   %ebp
+  801bb1:	89 e5                	mov    %esp,%ebp
+  801bb3:	56                   	push   %esi
+  801bb4:	53                   	push   %ebx
+  801bb5:	83 ec 18             	sub    $0x18,%esp
+  801bb8:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801bbb:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801bbe:	50                   	push   %eax
+  801bbf:	53                   	push   %ebx
+  801bc0:	e8 8b fb ff ff       	call   801750 <fd_lookup>
+  801bc5:	83 c4 10             	add    $0x10,%esp
+  801bc8:	85 c0                	test   %eax,%eax
+  801bca:	78 34                	js     801c00 <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801bcc:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801bcf:	83 ec 08             	sub    $0x8,%esp
+  801bd2:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801bd5:	50                   	push   %eax
+  801bd6:	ff 36                	push   (%esi)
+  801bd8:	e8 c3 fb ff ff       	call   8017a0 <dev_lookup>
+  801bdd:	83 c4 10             	add    $0x10,%esp
+  801be0:	85 c0                	test   %eax,%eax
+  801be2:	78 1c                	js     801c00 <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801be4:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801be8:	74 1d                	je     801c07 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  801bea:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801bed:	8b 40 18             	mov    0x18(%eax),%eax
+  801bf0:	85 c0                	test   %eax,%eax
+  801bf2:	74 34                	je     801c28 <ftruncate+0x78>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  801bf4:	83 ec 08             	sub    $0x8,%esp
+  801bf7:	ff 75 0c             	push   0xc(%ebp)
+  801bfa:	56                   	push   %esi
+  801bfb:	ff d0                	call   *%eax
+  801bfd:	83 c4 10             	add    $0x10,%esp
+}
+  801c00:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801c03:	5b                   	pop    %ebx
+  801c04:	5e                   	pop    %esi
+  801c05:	5d                   	pop    %ebp
+  801c06:	c3                   	ret
+			thisenv->env_id, fdnum);
+  801c07:	a1 00 60 80 00       	mov    0x806000,%eax
+  801c0c:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801c0f:	83 ec 04             	sub    $0x4,%esp
+  801c12:	53                   	push   %ebx
+  801c13:	50                   	push   %eax
+  801c14:	68 04 47 80 00       	push   $0x804704
+  801c19:	e8 a5 e9 ff ff       	call   8005c3 <cprintf>
+		return -E_INVAL;
+  801c1e:	83 c4 10             	add    $0x10,%esp
+  801c21:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801c26:	eb d8                	jmp    801c00 <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  801c28:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801c2d:	eb d1                	jmp    801c00 <ftruncate+0x50>
+
+00801c2f <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  801c2f:	55                   	push   %ebp
+  801c30:	89 e5                	mov    %esp,%ebp
+  801c32:	56                   	push   %esi
+  801c33:	53                   	push   %ebx
+  801c34:	83 ec 18             	sub    $0x18,%esp
+  801c37:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801c3a:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801c3d:	50                   	push   %eax
+  801c3e:	ff 75 08             	push   0x8(%ebp)
+  801c41:	e8 0a fb ff ff       	call   801750 <fd_lookup>
+  801c46:	83 c4 10             	add    $0x10,%esp
+  801c49:	85 c0                	test   %eax,%eax
+  801c4b:	78 49                	js     801c96 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801c4d:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801c50:	83 ec 08             	sub    $0x8,%esp
+  801c53:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801c56:	50                   	push   %eax
+  801c57:	ff 36                	push   (%esi)
+  801c59:	e8 42 fb ff ff       	call   8017a0 <dev_lookup>
+  801c5e:	83 c4 10             	add    $0x10,%esp
+  801c61:	85 c0                	test   %eax,%eax
+  801c63:	78 31                	js     801c96 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  801c65:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801c68:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  801c6c:	74 2f                	je     801c9d <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  801c6e:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  801c71:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801c78:	00 00 00 
+	stat->st_isdir = 0;
+  801c7b:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801c82:	00 00 00 
+	stat->st_dev = dev;
+  801c85:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  801c8b:	83 ec 08             	sub    $0x8,%esp
+  801c8e:	53                   	push   %ebx
+  801c8f:	56                   	push   %esi
+  801c90:	ff 50 14             	call   *0x14(%eax)
+  801c93:	83 c4 10             	add    $0x10,%esp
+}
+  801c96:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801c99:	5b                   	pop    %ebx
+  801c9a:	5e                   	pop    %esi
+  801c9b:	5d                   	pop    %ebp
+  801c9c:	c3                   	ret
+		return -E_NOT_SUPP;
+  801c9d:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801ca2:	eb f2                	jmp    801c96 <fstat+0x67>
+
+00801ca4 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  801ca4:	55                   	push   %ebp
+  801ca5:	89 e5                	mov    %esp,%ebp
+  801ca7:	56                   	push   %esi
+  801ca8:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY | O_NOBUF)) < 0)
+  801ca9:	83 ec 08             	sub    $0x8,%esp
+  801cac:	68 00 10 00 00       	push   $0x1000
+  801cb1:	ff 75 08             	push   0x8(%ebp)
+  801cb4:	e8 b3 07 00 00       	call   80246c <open>
+  801cb9:	89 c3                	mov    %eax,%ebx
+  801cbb:	83 c4 10             	add    $0x10,%esp
+  801cbe:	85 c0                	test   %eax,%eax
+  801cc0:	78 1b                	js     801cdd <stat+0x39>
+		return fd;
+	r = fstat(fd, stat);
+  801cc2:	83 ec 08             	sub    $0x8,%esp
+  801cc5:	ff 75 0c             	push   0xc(%ebp)
+  801cc8:	50                   	push   %eax
+  801cc9:	e8 61 ff ff ff       	call   801c2f <fstat>
+  801cce:	89 c6                	mov    %eax,%esi
+	close(fd);
+  801cd0:	89 1c 24             	mov    %ebx,(%esp)
+  801cd3:	e8 a2 fb ff ff       	call   80187a <close>
+	return r;
+  801cd8:	83 c4 10             	add    $0x10,%esp
+  801cdb:	89 f3                	mov    %esi,%ebx
+}
+  801cdd:	89 d8                	mov    %ebx,%eax
+  801cdf:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801ce2:	5b                   	pop    %ebx
+  801ce3:	5e                   	pop    %esi
+  801ce4:	5d                   	pop    %ebp
+  801ce5:	c3                   	ret
+
+00801ce6 <fsipc_pages>:
+// need not be copied through fsipcbuf.  n must fit in FSBULK_MAXPAGES
+// pages.
+// Returns result from the file server.
+static int
+fsipc_pages(unsigned type, const void *buf, size_t n, int perm)
+{
+  801ce6:	55                   	push   %ebp
+  801ce7:	89 e5                	mov    %esp,%ebp
+  801ce9:	57                   	push   %edi
+  801cea:	56                   	push   %esi
+  801ceb:	53                   	push   %ebx
+  801cec:	81 ec 2c 01 00 00    	sub    $0x12c,%esp
+  801cf2:	89 85 d4 fe ff ff    	mov    %eax,-0x12c(%ebp)
+  801cf8:	89 d6                	mov    %edx,%esi
+  801cfa:	89 8d d0 fe ff ff    	mov    %ecx,-0x130(%ebp)
+  801d00:	8b 7d 08             	mov    0x8(%ebp),%edi
+	uintptr_t pages[1 + FSBULK_MAXPAGES];
+	uintptr_t va, start = ROUNDDOWN((uintptr_t) buf, PGSIZE);
+  801d03:	89 d3                	mov    %edx,%ebx
+  801d05:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+	int npages;
+
+	if (fsenv == 0)
+  801d0b:	83 3d c8 80 80 00 00 	cmpl   $0x0,0x8080c8
+  801d12:	74 1d                	je     801d31 <fsipc_pages+0x4b>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+
+	pages[0] = (uintptr_t) &fsipcbuf | PTE_P | PTE_W | PTE_U;
+  801d14:	b8 00 70 80 00       	mov    $0x807000,%eax
+  801d19:	83 c8 07             	or     $0x7,%eax
+  801d1c:	89 85 e4 fe ff ff    	mov    %eax,-0x11c(%ebp)
+	npages = 1;
+  801d22:	b8 01 00 00 00       	mov    $0x1,%eax
+	for (va = start; va < (uintptr_t) buf + n; va += PGSIZE)
+  801d27:	8b 8d d0 fe ff ff    	mov    -0x130(%ebp),%ecx
+  801d2d:	01 ce                	add    %ecx,%esi
+  801d2f:	eb 28                	jmp    801d59 <fsipc_pages+0x73>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801d31:	83 ec 0c             	sub    $0xc,%esp
+  801d34:	6a 01                	push   $0x1
+  801d36:	e8 85 21 00 00       	call   803ec0 <ipc_find_env>
+  801d3b:	a3 c8 80 80 00       	mov    %eax,0x8080c8
+  801d40:	83 c4 10             	add    $0x10,%esp
+  801d43:	eb cf                	jmp    801d14 <fsipc_pages+0x2e>
+		pages[npages++] = va | perm;
+  801d45:	83 c0 01             	add    $0x1,%eax
+  801d48:	89 fa                	mov    %edi,%edx
+  801d4a:	09 da                	or     %ebx,%edx
+  801d4c:	89 94 85 e0 fe ff ff 	mov    %edx,-0x120(%ebp,%eax,4)
+	for (va = start; va < (uintptr_t) buf + n; va += PGSIZE)
+  801d53:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801d59:	39 f3                	cmp    %esi,%ebx
+  801d5b:	72 e8                	jb     801d45 <fsipc_pages+0x5f>
+	assert(npages <= ARRAY_SIZE(pages));
+  801d5d:	83 f8 41             	cmp    $0x41,%eax
+  801d60:	77 2f                	ja     801d91 <fsipc_pages+0xab>
+
+	if (debug)
+		cprintf("[%08x] fsipc_pages %d %08x %d pages\n",
+			thisenv->env_id, type, buf, npages - 1);
+
+	ipc_sendv(fsenv, type, pages, npages);
+  801d62:	50                   	push   %eax
+  801d63:	8d 85 e4 fe ff ff    	lea    -0x11c(%ebp),%eax
+  801d69:	50                   	push   %eax
+  801d6a:	ff b5 d4 fe ff ff    	push   -0x12c(%ebp)
+  801d70:	ff 35 c8 80 80 00    	push   0x8080c8
+  801d76:	e8 f7 20 00 00       	call   803e72 <ipc_sendv>
+	return ipc_recv(NULL, NULL, NULL);
+  801d7b:	83 c4 0c             	add    $0xc,%esp
+  801d7e:	6a 00                	push   $0x0
+  801d80:	6a 00                	push   $0x0
+  801d82:	6a 00                	push   $0x0
+  801d84:	e8 93 1f 00 00       	call   803d1c <ipc_recv>
+}
+  801d89:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801d8c:	5b                   	pop    %ebx
+  801d8d:	5e                   	pop    %esi
+  801d8e:	5f                   	pop    %edi
+  801d8f:	5d                   	pop    %ebp
+  801d90:	c3                   	ret
+	assert(npages <= ARRAY_SIZE(pages));
+  801d91:	68 74 47 80 00       	push   $0x804774
+  801d96:	68 ac 46 80 00       	push   $0x8046ac
+  801d9b:	6a 40                	push   $0x40
+  801d9d:	68 90 47 80 00       	push   $0x804790
+  801da2:	e8 41 e7 ff ff       	call   8004e8 <_panic>
+
+00801da7 <fsring_post>:
+
+// Post a request of the given type for n bytes at 'offset' of fdnum,
+// with data page 'slot' already filled in as needed.
+static int
+fsring_post(uint32_t type, struct Fd *fd, off_t offset, size_t n, int slot)
+{
+  801da7:	55                   	push   %ebp
+  801da8:	89 e5                	mov    %esp,%ebp
+  801daa:	57                   	push   %edi
+  801dab:	56                   	push   %esi
+  801dac:	53                   	push   %ebx
+  801dad:	83 ec 1c             	sub    $0x1c,%esp
+  801db0:	89 c3                	mov    %eax,%ebx
+  801db2:	89 d6                	mov    %edx,%esi
+  801db4:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+	struct Fsring_sqe *sqe;
+	uint32_t tail = fsring->r_sqtail;
+  801db7:	8b 0d 04 00 00 cf    	mov    0xcf000004,%ecx
+
+	sqe = &fsring->r_sq[tail % FSRING_NSLOTS];
+  801dbd:	89 ca                	mov    %ecx,%edx
+  801dbf:	83 e2 0f             	and    $0xf,%edx
+	sqe->sqe_type = type;
+  801dc2:	8d 04 95 00 00 00 00 	lea    0x0(,%edx,4),%eax
+  801dc9:	8d 3c 10             	lea    (%eax,%edx,1),%edi
+  801dcc:	89 1c bd 10 00 00 cf 	mov    %ebx,-0x30fffff0(,%edi,4)
+	sqe->sqe_fileid = fd->fd_file.id;
+  801dd3:	8b 76 0c             	mov    0xc(%esi),%esi
+  801dd6:	89 fb                	mov    %edi,%ebx
+  801dd8:	89 34 bd 14 00 00 cf 	mov    %esi,-0x30ffffec(,%edi,4)
+	sqe->sqe_offset = offset;
+  801ddf:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801de2:	89 3c 9d 18 00 00 cf 	mov    %edi,-0x30ffffe8(,%ebx,4)
+	sqe->sqe_n = n;
+  801de9:	8b 75 08             	mov    0x8(%ebp),%esi
+  801dec:	89 34 9d 1c 00 00 cf 	mov    %esi,-0x30ffffe4(,%ebx,4)
+	sqe->sqe_slot = slot;
+  801df3:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801df6:	89 14 9d 20 00 00 cf 	mov    %edx,-0x30ffffe0(,%ebx,4)
+	// waking when the ring was empty before this request.  The kick
+	// gets no reply, and the server does not look at its request page.
+	// Publishing the tail with xchg, a full barrier, keeps the load of
+	// r_sqhead below from passing it; serve_ring_kick does the same the
+	// other way around, so one of the two sees the other's update.
+	xchg(&fsring->r_sqtail, tail + 1);
+  801dfd:	8d 41 01             	lea    0x1(%ecx),%eax
+xchg(volatile uint32_t *addr, uint32_t newval)
+{
+	uint32_t result;
+
+	// The + in "+m" denotes a read-modify-write operand.
+	asm volatile("lock; xchgl %0, %1"
+  801e00:	f0 87 05 04 00 00 cf 	lock xchg %eax,0xcf000004
+	if (fsring->r_sqhead == tail)
+  801e07:	a1 00 00 00 cf       	mov    0xcf000000,%eax
+  801e0c:	39 c8                	cmp    %ecx,%eax
+  801e0e:	74 0d                	je     801e1d <fsring_post+0x76>
+		ipc_send(fsenv, FSREQ_RING_KICK, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+	return 0;
+}
+  801e10:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e15:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801e18:	5b                   	pop    %ebx
+  801e19:	5e                   	pop    %esi
+  801e1a:	5f                   	pop    %edi
+  801e1b:	5d                   	pop    %ebp
+  801e1c:	c3                   	ret
+		ipc_send(fsenv, FSREQ_RING_KICK, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801e1d:	6a 07                	push   $0x7
+  801e1f:	68 00 70 80 00       	push   $0x807000
+  801e24:	6a 0d                	push   $0xd
+  801e26:	ff 35 c8 80 80 00    	push   0x8080c8
+  801e2c:	e8 56 1f 00 00       	call   803d87 <ipc_send>
+  801e31:	83 c4 10             	add    $0x10,%esp
+  801e34:	eb da                	jmp    801e10 <fsring_post+0x69>
+
+00801e36 <fsipcv>:
+{
+  801e36:	55                   	push   %ebp
+  801e37:	89 e5                	mov    %esp,%ebp
+  801e39:	57                   	push   %edi
+  801e3a:	56                   	push   %esi
+  801e3b:	53                   	push   %ebx
+  801e3c:	83 ec 0c             	sub    $0xc,%esp
+  801e3f:	89 c7                	mov    %eax,%edi
+  801e41:	89 d3                	mov    %edx,%ebx
+  801e43:	89 ce                	mov    %ecx,%esi
+	if (fsenv == 0)
+  801e45:	83 3d c8 80 80 00 00 	cmpl   $0x0,0x8080c8
+  801e4c:	74 26                	je     801e74 <fsipcv+0x3e>
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801e4e:	6a 07                	push   $0x7
+  801e50:	68 00 70 80 00       	push   $0x807000
+  801e55:	57                   	push   %edi
+  801e56:	ff 35 c8 80 80 00    	push   0x8080c8
+  801e5c:	e8 26 1f 00 00       	call   803d87 <ipc_send>
+	return ipc_recvv(NULL, dstva, npages, NULL);
+  801e61:	6a 00                	push   $0x0
+  801e63:	56                   	push   %esi
+  801e64:	53                   	push   %ebx
+  801e65:	6a 00                	push   $0x0
+  801e67:	e8 73 1f 00 00       	call   803ddf <ipc_recvv>
+}
+  801e6c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801e6f:	5b                   	pop    %ebx
+  801e70:	5e                   	pop    %esi
+  801e71:	5f                   	pop    %edi
+  801e72:	5d                   	pop    %ebp
+  801e73:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801e74:	83 ec 0c             	sub    $0xc,%esp
+  801e77:	6a 01                	push   $0x1
+  801e79:	e8 42 20 00 00       	call   803ec0 <ipc_find_env>
+  801e7e:	a3 c8 80 80 00       	mov    %eax,0x8080c8
+  801e83:	83 c4 10             	add    $0x10,%esp
+  801e86:	eb c6                	jmp    801e4e <fsipcv+0x18>
+
+00801e88 <fsipc>:
+{
+  801e88:	55                   	push   %ebp
+  801e89:	89 e5                	mov    %esp,%ebp
+  801e8b:	83 ec 18             	sub    $0x18,%esp
+	int npages = 1;
+  801e8e:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+	return fsipcv(type, dstva, &npages);
+  801e95:	8d 4d f4             	lea    -0xc(%ebp),%ecx
+  801e98:	e8 99 ff ff ff       	call   801e36 <fsipcv>
+}
+  801e9d:	c9                   	leave
+  801e9e:	c3                   	ret
+
+00801e9f <file_write_direct>:
+{
+  801e9f:	55                   	push   %ebp
+  801ea0:	89 e5                	mov    %esp,%ebp
+  801ea2:	56                   	push   %esi
+  801ea3:	53                   	push   %ebx
+  801ea4:	89 c3                	mov    %eax,%ebx
+  801ea6:	89 c8                	mov    %ecx,%eax
+	if (n > sizeof(fsipcbuf.write.req_buf)) {
+  801ea8:	81 f9 f8 0f 00 00    	cmp    $0xff8,%ecx
+  801eae:	77 40                	ja     801ef0 <file_write_direct+0x51>
+	n = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  801eb0:	b9 f8 0f 00 00       	mov    $0xff8,%ecx
+  801eb5:	39 c8                	cmp    %ecx,%eax
+  801eb7:	0f 47 c1             	cmova  %ecx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801eba:	8b 4b 0c             	mov    0xc(%ebx),%ecx
+  801ebd:	89 0d 00 70 80 00    	mov    %ecx,0x807000
+	fsipcbuf.write.req_n = n;
+  801ec3:	a3 04 70 80 00       	mov    %eax,0x807004
+	memmove(fsipcbuf.write.req_buf, buf, n);
+  801ec8:	83 ec 04             	sub    $0x4,%esp
+  801ecb:	50                   	push   %eax
+  801ecc:	52                   	push   %edx
+  801ecd:	68 08 70 80 00       	push   $0x807008
+  801ed2:	e8 60 ee ff ff       	call   800d37 <memmove>
+	return fsipc(FSREQ_WRITE, NULL);
+  801ed7:	ba 00 00 00 00       	mov    $0x0,%edx
+  801edc:	b8 04 00 00 00       	mov    $0x4,%eax
+  801ee1:	e8 a2 ff ff ff       	call   801e88 <fsipc>
+  801ee6:	83 c4 10             	add    $0x10,%esp
+}
+  801ee9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801eec:	5b                   	pop    %ebx
+  801eed:	5e                   	pop    %esi
+  801eee:	5d                   	pop    %ebp
+  801eef:	c3                   	ret
+		n = MIN(n, FSBULK_MAXPAGES * PGSIZE - PGOFF(buf));
+  801ef0:	89 d6                	mov    %edx,%esi
+  801ef2:	81 e6 ff 0f 00 00    	and    $0xfff,%esi
+  801ef8:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  801efd:	29 f1                	sub    %esi,%ecx
+  801eff:	39 c1                	cmp    %eax,%ecx
+  801f01:	0f 47 c8             	cmova  %eax,%ecx
+	fsipcbuf.bulk.req_fileid = fileid;
+  801f04:	8b 43 0c             	mov    0xc(%ebx),%eax
+  801f07:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.bulk.req_n = n;
+  801f0c:	89 0d 04 70 80 00    	mov    %ecx,0x807004
+	fsipcbuf.bulk.req_off = PGOFF(buf);
+  801f12:	89 35 08 70 80 00    	mov    %esi,0x807008
+	return fsipc_pages(type, buf, n, perm);
+  801f18:	83 ec 0c             	sub    $0xc,%esp
+  801f1b:	6a 05                	push   $0x5
+  801f1d:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801f22:	e8 bf fd ff ff       	call   801ce6 <fsipc_pages>
+		return fsipc_bulk(FSREQ_WRITE_BULK, fd->fd_file.id, buf, n,
+  801f27:	83 c4 10             	add    $0x10,%esp
+  801f2a:	eb bd                	jmp    801ee9 <file_write_direct+0x4a>
+
+00801f2c <devfile_sync>:
+{
+  801f2c:	55                   	push   %ebp
+  801f2d:	89 e5                	mov    %esp,%ebp
+  801f2f:	57                   	push   %edi
+  801f30:	56                   	push   %esi
+  801f31:	53                   	push   %ebx
+  801f32:	83 ec 28             	sub    $0x28,%esp
+  801f35:	8b 75 08             	mov    0x8(%ebp),%esi
+	char *p = fd2data(fd);
+  801f38:	56                   	push   %esi
+  801f39:	e8 a5 f7 ff ff       	call   8016e3 <fd2data>
+  801f3e:	89 c7                	mov    %eax,%edi
+	off_t pos = fd->fd_offset;
+  801f40:	8b 4e 04             	mov    0x4(%esi),%ecx
+	ff->buf_rlen = 0;
+  801f43:	c7 46 18 00 00 00 00 	movl   $0x0,0x18(%esi)
+	if (ff->buf_wlen == 0)
+  801f4a:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  801f4d:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (ff->buf_wlen == 0)
+  801f52:	83 7e 1c 00          	cmpl   $0x0,0x1c(%esi)
+  801f56:	74 45                	je     801f9d <devfile_sync+0x71>
+	fd->fd_offset = ff->buf_base;
+  801f58:	8b 46 14             	mov    0x14(%esi),%eax
+  801f5b:	89 46 04             	mov    %eax,0x4(%esi)
+	for (done = 0, r = 0; done < ff->buf_wlen; done += r)
+  801f5e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f63:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801f68:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  801f6b:	8b 4e 1c             	mov    0x1c(%esi),%ecx
+  801f6e:	39 cb                	cmp    %ecx,%ebx
+  801f70:	73 14                	jae    801f86 <devfile_sync+0x5a>
+		if ((r = file_write_direct(fd, p + done, ff->buf_wlen - done)) <= 0)
+  801f72:	29 d9                	sub    %ebx,%ecx
+  801f74:	8d 14 1f             	lea    (%edi,%ebx,1),%edx
+  801f77:	89 f0                	mov    %esi,%eax
+  801f79:	e8 21 ff ff ff       	call   801e9f <file_write_direct>
+  801f7e:	85 c0                	test   %eax,%eax
+  801f80:	7e 04                	jle    801f86 <devfile_sync+0x5a>
+	for (done = 0, r = 0; done < ff->buf_wlen; done += r)
+  801f82:	01 c3                	add    %eax,%ebx
+  801f84:	eb e5                	jmp    801f6b <devfile_sync+0x3f>
+	ff->buf_wlen = 0;
+  801f86:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  801f89:	c7 46 1c 00 00 00 00 	movl   $0x0,0x1c(%esi)
+	fd->fd_offset = pos;
+  801f90:	89 4e 04             	mov    %ecx,0x4(%esi)
+	return r < 0 ? r : 0;
+  801f93:	85 c0                	test   %eax,%eax
+  801f95:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f9a:	0f 4f c2             	cmovg  %edx,%eax
+}
+  801f9d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801fa0:	5b                   	pop    %ebx
+  801fa1:	5e                   	pop    %esi
+  801fa2:	5f                   	pop    %edi
+  801fa3:	5d                   	pop    %ebp
+  801fa4:	c3                   	ret
+
+00801fa5 <devfile_write>:
+{
+  801fa5:	55                   	push   %ebp
+  801fa6:	89 e5                	mov    %esp,%ebp
+  801fa8:	57                   	push   %edi
+  801fa9:	56                   	push   %esi
+  801faa:	53                   	push   %ebx
+  801fab:	83 ec 28             	sub    $0x28,%esp
+  801fae:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801fb1:	8b 75 10             	mov    0x10(%ebp),%esi
+	char *p = fd2data(fd);
+  801fb4:	53                   	push   %ebx
+  801fb5:	e8 29 f7 ff ff       	call   8016e3 <fd2data>
+  801fba:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	off_t pos = fd->fd_offset;
+  801fbd:	8b 7b 04             	mov    0x4(%ebx),%edi
+	if (!ff->buffered)
+  801fc0:	83 c4 10             	add    $0x10,%esp
+  801fc3:	80 7b 10 00          	cmpb   $0x0,0x10(%ebx)
+  801fc7:	74 43                	je     80200c <devfile_write+0x67>
+	ff->buf_rlen = 0;
+  801fc9:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+	if (ff->buf_wlen > 0
+  801fd0:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  801fd3:	85 c0                	test   %eax,%eax
+  801fd5:	74 43                	je     80201a <devfile_write+0x75>
+	    && (pos != ff->buf_base + ff->buf_wlen
+  801fd7:	89 c2                	mov    %eax,%edx
+  801fd9:	03 53 14             	add    0x14(%ebx),%edx
+  801fdc:	39 fa                	cmp    %edi,%edx
+  801fde:	75 0b                	jne    801feb <devfile_write+0x46>
+		|| ff->buf_wlen + n > FILEBUF_SIZE)
+  801fe0:	8d 14 30             	lea    (%eax,%esi,1),%edx
+  801fe3:	81 fa 00 10 00 00    	cmp    $0x1000,%edx
+  801fe9:	76 66                	jbe    802051 <devfile_write+0xac>
+	    && (r = devfile_sync(fd)) < 0)
+  801feb:	83 ec 0c             	sub    $0xc,%esp
+  801fee:	53                   	push   %ebx
+  801fef:	e8 38 ff ff ff       	call   801f2c <devfile_sync>
+  801ff4:	83 c4 10             	add    $0x10,%esp
+  801ff7:	85 c0                	test   %eax,%eax
+  801ff9:	78 4e                	js     802049 <devfile_write+0xa4>
+	if (n >= FILEBUF_SIZE)
+  801ffb:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  802001:	77 56                	ja     802059 <devfile_write+0xb4>
+	if (ff->buf_wlen == 0)
+  802003:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  802006:	85 c0                	test   %eax,%eax
+  802008:	75 20                	jne    80202a <devfile_write+0x85>
+  80200a:	eb 16                	jmp    802022 <devfile_write+0x7d>
+		return file_write_direct(fd, buf, n);
+  80200c:	89 f1                	mov    %esi,%ecx
+  80200e:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802011:	89 d8                	mov    %ebx,%eax
+  802013:	e8 87 fe ff ff       	call   801e9f <file_write_direct>
+  802018:	eb 2f                	jmp    802049 <devfile_write+0xa4>
+	if (n >= FILEBUF_SIZE)
+  80201a:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  802020:	77 37                	ja     802059 <devfile_write+0xb4>
+		ff->buf_base = pos;
+  802022:	89 7b 14             	mov    %edi,0x14(%ebx)
+  802025:	b8 00 00 00 00       	mov    $0x0,%eax
+	memmove(p + ff->buf_wlen, buf, n);
+  80202a:	83 ec 04             	sub    $0x4,%esp
+  80202d:	56                   	push   %esi
+  80202e:	ff 75 0c             	push   0xc(%ebp)
+  802031:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  802034:	01 c1                	add    %eax,%ecx
+  802036:	51                   	push   %ecx
+  802037:	e8 fb ec ff ff       	call   800d37 <memmove>
+	ff->buf_wlen += n;
+  80203c:	01 73 1c             	add    %esi,0x1c(%ebx)
+	fd->fd_offset = pos + n;
+  80203f:	01 f7                	add    %esi,%edi
+  802041:	89 7b 04             	mov    %edi,0x4(%ebx)
+	return n;
+  802044:	89 f0                	mov    %esi,%eax
+  802046:	83 c4 10             	add    $0x10,%esp
+}
+  802049:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80204c:	5b                   	pop    %ebx
+  80204d:	5e                   	pop    %esi
+  80204e:	5f                   	pop    %edi
+  80204f:	5d                   	pop    %ebp
+  802050:	c3                   	ret
+	if (n >= FILEBUF_SIZE)
+  802051:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  802057:	76 d1                	jbe    80202a <devfile_write+0x85>
+		return file_write_direct(fd, buf, n);
+  802059:	89 f1                	mov    %esi,%ecx
+  80205b:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80205e:	89 d8                	mov    %ebx,%eax
+  802060:	e8 3a fe ff ff       	call   801e9f <file_write_direct>
+  802065:	eb e2                	jmp    802049 <devfile_write+0xa4>
+
+00802067 <devfile_trunc>:
+{
+  802067:	55                   	push   %ebp
+  802068:	89 e5                	mov    %esp,%ebp
+  80206a:	53                   	push   %ebx
+  80206b:	83 ec 10             	sub    $0x10,%esp
+  80206e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if ((r = devfile_sync(fd)) < 0)
+  802071:	53                   	push   %ebx
+  802072:	e8 b5 fe ff ff       	call   801f2c <devfile_sync>
+  802077:	83 c4 10             	add    $0x10,%esp
+  80207a:	85 c0                	test   %eax,%eax
+  80207c:	78 1f                	js     80209d <devfile_trunc+0x36>
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  80207e:	8b 43 0c             	mov    0xc(%ebx),%eax
+  802081:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.set_size.req_size = newsize;
+  802086:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802089:	a3 04 70 80 00       	mov    %eax,0x807004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  80208e:	ba 00 00 00 00       	mov    $0x0,%edx
+  802093:	b8 02 00 00 00       	mov    $0x2,%eax
+  802098:	e8 eb fd ff ff       	call   801e88 <fsipc>
+}
+  80209d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8020a0:	c9                   	leave
+  8020a1:	c3                   	ret
+
+008020a2 <devfile_stat>:
+{
+  8020a2:	55                   	push   %ebp
+  8020a3:	89 e5                	mov    %esp,%ebp
+  8020a5:	56                   	push   %esi
+  8020a6:	53                   	push   %ebx
+  8020a7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8020aa:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if ((r = devfile_sync(fd)) < 0)
+  8020ad:	83 ec 0c             	sub    $0xc,%esp
+  8020b0:	53                   	push   %ebx
+  8020b1:	e8 76 fe ff ff       	call   801f2c <devfile_sync>
+  8020b6:	83 c4 10             	add    $0x10,%esp
+  8020b9:	85 c0                	test   %eax,%eax
+  8020bb:	78 47                	js     802104 <devfile_stat+0x62>
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  8020bd:	8b 43 0c             	mov    0xc(%ebx),%eax
+  8020c0:	a3 00 70 80 00       	mov    %eax,0x807000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  8020c5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8020ca:	b8 05 00 00 00       	mov    $0x5,%eax
+  8020cf:	e8 b4 fd ff ff       	call   801e88 <fsipc>
+  8020d4:	85 c0                	test   %eax,%eax
+  8020d6:	78 2c                	js     802104 <devfile_stat+0x62>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  8020d8:	83 ec 08             	sub    $0x8,%esp
+  8020db:	68 00 70 80 00       	push   $0x807000
+  8020e0:	56                   	push   %esi
+  8020e1:	e8 cb ea ff ff       	call   800bb1 <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  8020e6:	a1 80 70 80 00       	mov    0x807080,%eax
+  8020eb:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8020f1:	a1 84 70 80 00       	mov    0x807084,%eax
+  8020f6:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+	return 0;
+  8020fc:	83 c4 10             	add    $0x10,%esp
+  8020ff:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802104:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802107:	5b                   	pop    %ebx
+  802108:	5e                   	pop    %esi
+  802109:	5d                   	pop    %ebp
+  80210a:	c3                   	ret
+
+0080210b <devfile_flush>:
+{
+  80210b:	55                   	push   %ebp
+  80210c:	89 e5                	mov    %esp,%ebp
+  80210e:	56                   	push   %esi
+  80210f:	53                   	push   %ebx
+  802110:	8b 75 08             	mov    0x8(%ebp),%esi
+	r = devfile_sync(fd);
+  802113:	83 ec 0c             	sub    $0xc,%esp
+  802116:	56                   	push   %esi
+  802117:	e8 10 fe ff ff       	call   801f2c <devfile_sync>
+  80211c:	89 c3                	mov    %eax,%ebx
+	if (fd->fd_file.buffered)
+  80211e:	83 c4 10             	add    $0x10,%esp
+  802121:	80 7e 10 00          	cmpb   $0x0,0x10(%esi)
+  802125:	75 25                	jne    80214c <devfile_flush+0x41>
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  802127:	8b 46 0c             	mov    0xc(%esi),%eax
+  80212a:	a3 00 70 80 00       	mov    %eax,0x807000
+	return fsipc(FSREQ_FLUSH, NULL) ?: r;
+  80212f:	ba 00 00 00 00       	mov    $0x0,%edx
+  802134:	b8 06 00 00 00       	mov    $0x6,%eax
+  802139:	e8 4a fd ff ff       	call   801e88 <fsipc>
+  80213e:	85 c0                	test   %eax,%eax
+  802140:	0f 45 d8             	cmovne %eax,%ebx
+}
+  802143:	89 d8                	mov    %ebx,%eax
+  802145:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802148:	5b                   	pop    %ebx
+  802149:	5e                   	pop    %esi
+  80214a:	5d                   	pop    %ebp
+  80214b:	c3                   	ret
+		sys_page_unmap(0, fd2data(fd));
+  80214c:	83 ec 0c             	sub    $0xc,%esp
+  80214f:	56                   	push   %esi
+  802150:	e8 8e f5 ff ff       	call   8016e3 <fd2data>
+  802155:	83 c4 08             	add    $0x8,%esp
+  802158:	50                   	push   %eax
+  802159:	6a 00                	push   $0x0
+  80215b:	e8 ea ee ff ff       	call   80104a <sys_page_unmap>
+  802160:	83 c4 10             	add    $0x10,%esp
+  802163:	eb c2                	jmp    802127 <devfile_flush+0x1c>
+
+00802165 <fsring_slot>:
+
+// Find a free data page and get fdnum ready for a request on it.
+// Returns the slot number, or < 0 on error.
+static int
+fsring_slot(int fdnum, struct Fd **fd_store)
+{
+  802165:	55                   	push   %ebp
+  802166:	89 e5                	mov    %esp,%ebp
+  802168:	57                   	push   %edi
+  802169:	56                   	push   %esi
+  80216a:	53                   	push   %ebx
+  80216b:	83 ec 64             	sub    $0x64,%esp
+  80216e:	89 d7                	mov    %edx,%edi
+	int r, slot;
+
+	if ((r = fd_lookup(fdnum, fd_store)) < 0)
+  802170:	52                   	push   %edx
+  802171:	50                   	push   %eax
+  802172:	e8 d9 f5 ff ff       	call   801750 <fd_lookup>
+  802177:	89 c1                	mov    %eax,%ecx
+  802179:	83 c4 10             	add    $0x10,%esp
+  80217c:	85 c0                	test   %eax,%eax
+  80217e:	0f 88 f2 00 00 00    	js     802276 <fsring_slot+0x111>
+		return r;
+	if ((*fd_store)->fd_dev_id != devfile.dev_id)
+  802184:	8b 07                	mov    (%edi),%eax
+  802186:	8b 15 40 50 80 00    	mov    0x805040,%edx
+  80218c:	39 10                	cmp    %edx,(%eax)
+  80218e:	0f 85 03 01 00 00    	jne    802297 <fsring_slot+0x132>
+	if (fsring_env == thisenv->env_id)
+  802194:	a1 00 60 80 00       	mov    0x806000,%eax
+  802199:	8b 40 48             	mov    0x48(%eax),%eax
+  80219c:	3b 05 c4 80 80 00    	cmp    0x8080c4,%eax
+  8021a2:	0f 84 96 00 00 00    	je     80223e <fsring_slot+0xd9>
+	if (fsenv == 0)
+  8021a8:	83 3d c8 80 80 00 00 	cmpl   $0x0,0x8080c8
+  8021af:	0f 84 cb 00 00 00    	je     802280 <fsring_slot+0x11b>
+	pages[0] = (uintptr_t) &fsipcbuf | PTE_P | PTE_W | PTE_U;
+  8021b5:	b8 00 70 80 00       	mov    $0x807000,%eax
+  8021ba:	83 c8 07             	or     $0x7,%eax
+  8021bd:	89 45 a0             	mov    %eax,-0x60(%ebp)
+	for (i = 0; i < FSRING_NPAGES; i++) {
+  8021c0:	8d 75 a4             	lea    -0x5c(%ebp),%esi
+	pages[0] = (uintptr_t) &fsipcbuf | PTE_P | PTE_W | PTE_U;
+  8021c3:	bb 00 00 00 cf       	mov    $0xcf000000,%ebx
+		if ((r = sys_page_alloc(0, (char *) fsring + i * PGSIZE,
+  8021c8:	83 ec 04             	sub    $0x4,%esp
+  8021cb:	68 07 04 00 00       	push   $0x407
+  8021d0:	53                   	push   %ebx
+  8021d1:	6a 00                	push   $0x0
+  8021d3:	e8 e5 ed ff ff       	call   800fbd <sys_page_alloc>
+  8021d8:	89 c1                	mov    %eax,%ecx
+  8021da:	83 c4 10             	add    $0x10,%esp
+  8021dd:	85 c0                	test   %eax,%eax
+  8021df:	0f 88 91 00 00 00    	js     802276 <fsring_slot+0x111>
+		pages[1 + i] = ((uintptr_t) fsring + i * PGSIZE) | PTE_P | PTE_W | PTE_U;
+  8021e5:	89 d8                	mov    %ebx,%eax
+  8021e7:	83 c8 07             	or     $0x7,%eax
+  8021ea:	89 06                	mov    %eax,(%esi)
+	for (i = 0; i < FSRING_NPAGES; i++) {
+  8021ec:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8021f2:	83 c6 04             	add    $0x4,%esi
+  8021f5:	81 fb 00 10 01 cf    	cmp    $0xcf011000,%ebx
+  8021fb:	75 cb                	jne    8021c8 <fsring_slot+0x63>
+	ipc_sendv(fsenv, FSREQ_RING_SETUP, pages, ARRAY_SIZE(pages));
+  8021fd:	6a 12                	push   $0x12
+  8021ff:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  802202:	50                   	push   %eax
+  802203:	6a 0c                	push   $0xc
+  802205:	ff 35 c8 80 80 00    	push   0x8080c8
+  80220b:	e8 62 1c 00 00       	call   803e72 <ipc_sendv>
+	if ((r = ipc_recv(NULL, NULL, NULL)) < 0)
+  802210:	83 c4 0c             	add    $0xc,%esp
+  802213:	6a 00                	push   $0x0
+  802215:	6a 00                	push   $0x0
+  802217:	6a 00                	push   $0x0
+  802219:	e8 fe 1a 00 00       	call   803d1c <ipc_recv>
+  80221e:	89 c1                	mov    %eax,%ecx
+  802220:	83 c4 10             	add    $0x10,%esp
+  802223:	85 c0                	test   %eax,%eax
+  802225:	78 4f                	js     802276 <fsring_slot+0x111>
+	fsring_env = thisenv->env_id;
+  802227:	a1 00 60 80 00       	mov    0x806000,%eax
+  80222c:	8b 40 48             	mov    0x48(%eax),%eax
+  80222f:	a3 c4 80 80 00       	mov    %eax,0x8080c4
+	fsring_busy = 0;
+  802234:	c7 05 c0 80 80 00 00 	movl   $0x0,0x8080c0
+  80223b:	00 00 00 
+		return -E_NOT_SUPP;
+	if ((r = fsring_setup()) < 0)
+		return r;
+	// Buffered writes must reach the server ahead of anything posted.
+	if ((r = devfile_sync(*fd_store)) < 0)
+  80223e:	83 ec 0c             	sub    $0xc,%esp
+  802241:	ff 37                	push   (%edi)
+  802243:	e8 e4 fc ff ff       	call   801f2c <devfile_sync>
+  802248:	89 c1                	mov    %eax,%ecx
+  80224a:	83 c4 10             	add    $0x10,%esp
+  80224d:	85 c0                	test   %eax,%eax
+  80224f:	78 25                	js     802276 <fsring_slot+0x111>
+		return r;
+	for (slot = 0; slot < FSRING_NSLOTS; slot++)
+		if (!(fsring_busy & (1 << slot)))
+  802251:	8b 1d c0 80 80 00    	mov    0x8080c0,%ebx
+	for (slot = 0; slot < FSRING_NSLOTS; slot++)
+  802257:	b9 00 00 00 00       	mov    $0x0,%ecx
+		if (!(fsring_busy & (1 << slot)))
+  80225c:	ba 01 00 00 00       	mov    $0x1,%edx
+  802261:	89 d0                	mov    %edx,%eax
+  802263:	d3 e0                	shl    %cl,%eax
+  802265:	85 d8                	test   %ebx,%eax
+  802267:	74 0d                	je     802276 <fsring_slot+0x111>
+	for (slot = 0; slot < FSRING_NSLOTS; slot++)
+  802269:	83 c1 01             	add    $0x1,%ecx
+  80226c:	83 f9 10             	cmp    $0x10,%ecx
+  80226f:	75 f0                	jne    802261 <fsring_slot+0xfc>
+			return slot;
+	return -E_NO_MEM;
+  802271:	b9 fc ff ff ff       	mov    $0xfffffffc,%ecx
+}
+  802276:	89 c8                	mov    %ecx,%eax
+  802278:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80227b:	5b                   	pop    %ebx
+  80227c:	5e                   	pop    %esi
+  80227d:	5f                   	pop    %edi
+  80227e:	5d                   	pop    %ebp
+  80227f:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  802280:	83 ec 0c             	sub    $0xc,%esp
+  802283:	6a 01                	push   $0x1
+  802285:	e8 36 1c 00 00       	call   803ec0 <ipc_find_env>
+  80228a:	a3 c8 80 80 00       	mov    %eax,0x8080c8
+  80228f:	83 c4 10             	add    $0x10,%esp
+  802292:	e9 1e ff ff ff       	jmp    8021b5 <fsring_slot+0x50>
+		return -E_NOT_SUPP;
+  802297:	b9 f1 ff ff ff       	mov    $0xfffffff1,%ecx
+  80229c:	eb d8                	jmp    802276 <fsring_slot+0x111>
+
+0080229e <file_read_direct>:
+{
+  80229e:	55                   	push   %ebp
+  80229f:	89 e5                	mov    %esp,%ebp
+  8022a1:	57                   	push   %edi
+  8022a2:	56                   	push   %esi
+  8022a3:	53                   	push   %ebx
+  8022a4:	83 ec 1c             	sub    $0x1c,%esp
+  8022a7:	89 c7                	mov    %eax,%edi
+  8022a9:	89 d6                	mov    %edx,%esi
+  8022ab:	89 cb                	mov    %ecx,%ebx
+	if (n > PGSIZE) {
+  8022ad:	81 f9 00 10 00 00    	cmp    $0x1000,%ecx
+  8022b3:	77 52                	ja     802307 <file_read_direct+0x69>
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8022b5:	8b 40 0c             	mov    0xc(%eax),%eax
+  8022b8:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.read.req_n = n;
+  8022bd:	89 0d 04 70 80 00    	mov    %ecx,0x807004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  8022c3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8022c8:	b8 03 00 00 00       	mov    $0x3,%eax
+  8022cd:	e8 b6 fb ff ff       	call   801e88 <fsipc>
+  8022d2:	89 c7                	mov    %eax,%edi
+  8022d4:	85 c0                	test   %eax,%eax
+  8022d6:	78 25                	js     8022fd <file_read_direct+0x5f>
+	assert(r <= n);
+  8022d8:	39 c3                	cmp    %eax,%ebx
+  8022da:	0f 82 87 00 00 00    	jb     802367 <file_read_direct+0xc9>
+	assert(r <= PGSIZE);
+  8022e0:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  8022e5:	0f 8f 95 00 00 00    	jg     802380 <file_read_direct+0xe2>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  8022eb:	83 ec 04             	sub    $0x4,%esp
+  8022ee:	50                   	push   %eax
+  8022ef:	68 00 70 80 00       	push   $0x807000
+  8022f4:	56                   	push   %esi
+  8022f5:	e8 3d ea ff ff       	call   800d37 <memmove>
+	return r;
+  8022fa:	83 c4 10             	add    $0x10,%esp
+}
+  8022fd:	89 f8                	mov    %edi,%eax
+  8022ff:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802302:	5b                   	pop    %ebx
+  802303:	5e                   	pop    %esi
+  802304:	5f                   	pop    %edi
+  802305:	5d                   	pop    %ebp
+  802306:	c3                   	ret
+		n = MIN(n, FSBULK_MAXPAGES * PGSIZE - PGOFF(buf));
+  802307:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  80230d:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  802312:	29 d1                	sub    %edx,%ecx
+  802314:	39 d9                	cmp    %ebx,%ecx
+  802316:	0f 46 d9             	cmovbe %ecx,%ebx
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  802319:	89 f0                	mov    %esi,%eax
+  80231b:	8d 0c 1e             	lea    (%esi,%ebx,1),%ecx
+  80231e:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  802321:	eb 0f                	jmp    802332 <file_read_direct+0x94>
+		*(volatile char *) p = *(volatile char *) p;
+  802323:	0f b6 10             	movzbl (%eax),%edx
+  802326:	88 10                	mov    %dl,(%eax)
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  802328:	05 00 10 00 00       	add    $0x1000,%eax
+  80232d:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  802332:	39 c8                	cmp    %ecx,%eax
+  802334:	72 ed                	jb     802323 <file_read_direct+0x85>
+	fsipcbuf.bulk.req_fileid = fileid;
+  802336:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802339:	8b 47 0c             	mov    0xc(%edi),%eax
+  80233c:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.bulk.req_n = n;
+  802341:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+	fsipcbuf.bulk.req_off = PGOFF(buf);
+  802347:	89 15 08 70 80 00    	mov    %edx,0x807008
+	return fsipc_pages(type, buf, n, perm);
+  80234d:	83 ec 0c             	sub    $0xc,%esp
+  802350:	6a 07                	push   $0x7
+  802352:	89 d9                	mov    %ebx,%ecx
+  802354:	89 f2                	mov    %esi,%edx
+  802356:	b8 09 00 00 00       	mov    $0x9,%eax
+  80235b:	e8 86 f9 ff ff       	call   801ce6 <fsipc_pages>
+  802360:	89 c7                	mov    %eax,%edi
+		return fsipc_bulk(FSREQ_READ_BULK, fd->fd_file.id, buf, n,
+  802362:	83 c4 10             	add    $0x10,%esp
+  802365:	eb 96                	jmp    8022fd <file_read_direct+0x5f>
+	assert(r <= n);
+  802367:	68 9b 47 80 00       	push   $0x80479b
+  80236c:	68 ac 46 80 00       	push   $0x8046ac
+  802371:	68 dc 00 00 00       	push   $0xdc
+  802376:	68 90 47 80 00       	push   $0x804790
+  80237b:	e8 68 e1 ff ff       	call   8004e8 <_panic>
+	assert(r <= PGSIZE);
+  802380:	68 ac 47 80 00       	push   $0x8047ac
+  802385:	68 ac 46 80 00       	push   $0x8046ac
+  80238a:	68 dd 00 00 00       	push   $0xdd
+  80238f:	68 90 47 80 00       	push   $0x804790
+  802394:	e8 4f e1 ff ff       	call   8004e8 <_panic>
+
+00802399 <devfile_read>:
+{
+  802399:	55                   	push   %ebp
+  80239a:	89 e5                	mov    %esp,%ebp
+  80239c:	57                   	push   %edi
+  80239d:	56                   	push   %esi
+  80239e:	53                   	push   %ebx
+  80239f:	83 ec 28             	sub    $0x28,%esp
+  8023a2:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8023a5:	8b 75 10             	mov    0x10(%ebp),%esi
+	char *p = fd2data(fd);
+  8023a8:	53                   	push   %ebx
+  8023a9:	e8 35 f3 ff ff       	call   8016e3 <fd2data>
+  8023ae:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	off_t pos = fd->fd_offset;
+  8023b1:	8b 7b 04             	mov    0x4(%ebx),%edi
+	if (!ff->buffered)
+  8023b4:	83 c4 10             	add    $0x10,%esp
+  8023b7:	80 7b 10 00          	cmpb   $0x0,0x10(%ebx)
+  8023bb:	74 7d                	je     80243a <devfile_read+0xa1>
+	if (ff->buf_wlen > 0 && (r = devfile_sync(fd)) < 0)
+  8023bd:	83 7b 1c 00          	cmpl   $0x0,0x1c(%ebx)
+  8023c1:	0f 85 81 00 00 00    	jne    802448 <devfile_read+0xaf>
+	if (ff->buf_rlen == 0 || pos < ff->buf_base
+  8023c7:	8b 43 18             	mov    0x18(%ebx),%eax
+  8023ca:	85 c0                	test   %eax,%eax
+  8023cc:	74 0d                	je     8023db <devfile_read+0x42>
+  8023ce:	8b 53 14             	mov    0x14(%ebx),%edx
+  8023d1:	39 fa                	cmp    %edi,%edx
+  8023d3:	7f 06                	jg     8023db <devfile_read+0x42>
+	    || pos >= ff->buf_base + ff->buf_rlen) {
+  8023d5:	01 c2                	add    %eax,%edx
+  8023d7:	39 d7                	cmp    %edx,%edi
+  8023d9:	72 28                	jb     802403 <devfile_read+0x6a>
+		ff->buf_rlen = 0;
+  8023db:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+		if (n >= FILEBUF_SIZE)
+  8023e2:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  8023e8:	77 74                	ja     80245e <devfile_read+0xc5>
+		if ((r = file_read_direct(fd, p, FILEBUF_SIZE)) <= 0)
+  8023ea:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8023ef:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8023f2:	89 d8                	mov    %ebx,%eax
+  8023f4:	e8 a5 fe ff ff       	call   80229e <file_read_direct>
+  8023f9:	85 c0                	test   %eax,%eax
+  8023fb:	7e 35                	jle    802432 <devfile_read+0x99>
+		ff->buf_base = pos;
+  8023fd:	89 7b 14             	mov    %edi,0x14(%ebx)
+		ff->buf_rlen = r;
+  802400:	89 43 18             	mov    %eax,0x18(%ebx)
+	n = MIN(n, ff->buf_base + ff->buf_rlen - pos);
+  802403:	8b 53 14             	mov    0x14(%ebx),%edx
+  802406:	89 d0                	mov    %edx,%eax
+  802408:	03 43 18             	add    0x18(%ebx),%eax
+  80240b:	29 f8                	sub    %edi,%eax
+  80240d:	39 f0                	cmp    %esi,%eax
+  80240f:	0f 46 f0             	cmovbe %eax,%esi
+	memmove(buf, p + (pos - ff->buf_base), n);
+  802412:	83 ec 04             	sub    $0x4,%esp
+  802415:	56                   	push   %esi
+  802416:	89 f8                	mov    %edi,%eax
+  802418:	29 d0                	sub    %edx,%eax
+  80241a:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  80241d:	01 c1                	add    %eax,%ecx
+  80241f:	51                   	push   %ecx
+  802420:	ff 75 0c             	push   0xc(%ebp)
+  802423:	e8 0f e9 ff ff       	call   800d37 <memmove>
+	fd->fd_offset = pos + n;
+  802428:	01 f7                	add    %esi,%edi
+  80242a:	89 7b 04             	mov    %edi,0x4(%ebx)
+	return n;
+  80242d:	89 f0                	mov    %esi,%eax
+  80242f:	83 c4 10             	add    $0x10,%esp
+}
+  802432:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802435:	5b                   	pop    %ebx
+  802436:	5e                   	pop    %esi
+  802437:	5f                   	pop    %edi
+  802438:	5d                   	pop    %ebp
+  802439:	c3                   	ret
+		return file_read_direct(fd, buf, n);
+  80243a:	89 f1                	mov    %esi,%ecx
+  80243c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80243f:	89 d8                	mov    %ebx,%eax
+  802441:	e8 58 fe ff ff       	call   80229e <file_read_direct>
+  802446:	eb ea                	jmp    802432 <devfile_read+0x99>
+	if (ff->buf_wlen > 0 && (r = devfile_sync(fd)) < 0)
+  802448:	83 ec 0c             	sub    $0xc,%esp
+  80244b:	53                   	push   %ebx
+  80244c:	e8 db fa ff ff       	call   801f2c <devfile_sync>
+  802451:	83 c4 10             	add    $0x10,%esp
+  802454:	85 c0                	test   %eax,%eax
+  802456:	0f 89 6b ff ff ff    	jns    8023c7 <devfile_read+0x2e>
+  80245c:	eb d4                	jmp    802432 <devfile_read+0x99>
+			return file_read_direct(fd, buf, n);
+  80245e:	89 f1                	mov    %esi,%ecx
+  802460:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802463:	89 d8                	mov    %ebx,%eax
+  802465:	e8 34 fe ff ff       	call   80229e <file_read_direct>
+  80246a:	eb c6                	jmp    802432 <devfile_read+0x99>
+
+0080246c <open>:
+{
+  80246c:	55                   	push   %ebp
+  80246d:	89 e5                	mov    %esp,%ebp
+  80246f:	56                   	push   %esi
+  802470:	53                   	push   %ebx
+  802471:	83 ec 1c             	sub    $0x1c,%esp
+  802474:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  802477:	56                   	push   %esi
+  802478:	e8 f9 e6 ff ff       	call   800b76 <strlen>
+  80247d:	83 c4 10             	add    $0x10,%esp
+  802480:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802485:	0f 8f a0 00 00 00    	jg     80252b <open+0xbf>
+	if ((r = fd_alloc(&fd)) < 0)
+  80248b:	83 ec 0c             	sub    $0xc,%esp
+  80248e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802491:	50                   	push   %eax
+  802492:	e8 63 f2 ff ff       	call   8016fa <fd_alloc>
+  802497:	89 c3                	mov    %eax,%ebx
+  802499:	83 c4 10             	add    $0x10,%esp
+  80249c:	85 c0                	test   %eax,%eax
+  80249e:	78 45                	js     8024e5 <open+0x79>
+	strcpy(fsipcbuf.open.req_path, path);
+  8024a0:	83 ec 08             	sub    $0x8,%esp
+  8024a3:	56                   	push   %esi
+  8024a4:	68 00 70 80 00       	push   $0x807000
+  8024a9:	e8 03 e7 ff ff       	call   800bb1 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  8024ae:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8024b1:	a3 00 74 80 00       	mov    %eax,0x807400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  8024b6:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8024b9:	b8 01 00 00 00       	mov    $0x1,%eax
+  8024be:	e8 c5 f9 ff ff       	call   801e88 <fsipc>
+  8024c3:	89 c3                	mov    %eax,%ebx
+  8024c5:	83 c4 10             	add    $0x10,%esp
+  8024c8:	85 c0                	test   %eax,%eax
+  8024ca:	78 22                	js     8024ee <open+0x82>
+	if (!(mode & O_NOBUF)
+  8024cc:	f7 45 0c 00 10 00 00 	testl  $0x1000,0xc(%ebp)
+  8024d3:	74 2b                	je     802500 <open+0x94>
+	return fd2num(fd);
+  8024d5:	83 ec 0c             	sub    $0xc,%esp
+  8024d8:	ff 75 f4             	push   -0xc(%ebp)
+  8024db:	e8 f3 f1 ff ff       	call   8016d3 <fd2num>
+  8024e0:	89 c3                	mov    %eax,%ebx
+  8024e2:	83 c4 10             	add    $0x10,%esp
+}
+  8024e5:	89 d8                	mov    %ebx,%eax
+  8024e7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8024ea:	5b                   	pop    %ebx
+  8024eb:	5e                   	pop    %esi
+  8024ec:	5d                   	pop    %ebp
+  8024ed:	c3                   	ret
+		fd_close(fd, 0);
+  8024ee:	83 ec 08             	sub    $0x8,%esp
+  8024f1:	6a 00                	push   $0x0
+  8024f3:	ff 75 f4             	push   -0xc(%ebp)
+  8024f6:	e8 f8 f2 ff ff       	call   8017f3 <fd_close>
+		return r;
+  8024fb:	83 c4 10             	add    $0x10,%esp
+  8024fe:	eb e5                	jmp    8024e5 <open+0x79>
+	    && sys_page_alloc(0, fd2data(fd), PTE_P|PTE_U|PTE_W|PTE_SHARE) == 0)
+  802500:	83 ec 0c             	sub    $0xc,%esp
+  802503:	ff 75 f4             	push   -0xc(%ebp)
+  802506:	e8 d8 f1 ff ff       	call   8016e3 <fd2data>
+  80250b:	83 c4 0c             	add    $0xc,%esp
+  80250e:	68 07 04 00 00       	push   $0x407
+  802513:	50                   	push   %eax
+  802514:	6a 00                	push   $0x0
+  802516:	e8 a2 ea ff ff       	call   800fbd <sys_page_alloc>
+  80251b:	83 c4 10             	add    $0x10,%esp
+  80251e:	85 c0                	test   %eax,%eax
+  802520:	75 b3                	jne    8024d5 <open+0x69>
+		fd->fd_file.buffered = 1;
+  802522:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802525:	c6 40 10 01          	movb   $0x1,0x10(%eax)
+  802529:	eb aa                	jmp    8024d5 <open+0x69>
+		return -E_BAD_PATH;
+  80252b:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  802530:	eb b3                	jmp    8024e5 <open+0x79>
+
+00802532 <readdir>:
+{
+  802532:	55                   	push   %ebp
+  802533:	89 e5                	mov    %esp,%ebp
+  802535:	53                   	push   %ebx
+  802536:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802539:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80253c:	50                   	push   %eax
+  80253d:	ff 75 08             	push   0x8(%ebp)
+  802540:	e8 0b f2 ff ff       	call   801750 <fd_lookup>
+  802545:	89 c3                	mov    %eax,%ebx
+  802547:	83 c4 10             	add    $0x10,%esp
+  80254a:	85 c0                	test   %eax,%eax
+  80254c:	78 73                	js     8025c1 <readdir+0x8f>
+	if (fd->fd_dev_id != devfile.dev_id)
+  80254e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802551:	8b 0d 40 50 80 00    	mov    0x805040,%ecx
+  802557:	39 08                	cmp    %ecx,(%eax)
+  802559:	0f 85 82 00 00 00    	jne    8025e1 <readdir+0xaf>
+	if ((r = devfile_sync(fd)) < 0)
+  80255f:	83 ec 0c             	sub    $0xc,%esp
+  802562:	50                   	push   %eax
+  802563:	e8 c4 f9 ff ff       	call   801f2c <devfile_sync>
+  802568:	89 c3                	mov    %eax,%ebx
+  80256a:	83 c4 10             	add    $0x10,%esp
+  80256d:	85 c0                	test   %eax,%eax
+  80256f:	78 50                	js     8025c1 <readdir+0x8f>
+	fsipcbuf.readdir.req_fileid = fd->fd_file.id;
+  802571:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802574:	8b 40 0c             	mov    0xc(%eax),%eax
+  802577:	a3 00 70 80 00       	mov    %eax,0x807000
+	fsipcbuf.readdir.req_n = n;
+  80257c:	8b 45 10             	mov    0x10(%ebp),%eax
+  80257f:	a3 04 70 80 00       	mov    %eax,0x807004
+	fsipcbuf.readdir.req_flags = flags;
+  802584:	8b 45 14             	mov    0x14(%ebp),%eax
+  802587:	a3 08 70 80 00       	mov    %eax,0x807008
+	if ((r = fsipc(FSREQ_READDIR, NULL)) <= 0)
+  80258c:	ba 00 00 00 00       	mov    $0x0,%edx
+  802591:	b8 0e 00 00 00       	mov    $0xe,%eax
+  802596:	e8 ed f8 ff ff       	call   801e88 <fsipc>
+  80259b:	89 c3                	mov    %eax,%ebx
+  80259d:	85 c0                	test   %eax,%eax
+  80259f:	7e 20                	jle    8025c1 <readdir+0x8f>
+	assert(r <= n && r <= PGSIZE);
+  8025a1:	39 45 10             	cmp    %eax,0x10(%ebp)
+  8025a4:	72 22                	jb     8025c8 <readdir+0x96>
+  8025a6:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  8025ab:	7f 1b                	jg     8025c8 <readdir+0x96>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  8025ad:	83 ec 04             	sub    $0x4,%esp
+  8025b0:	50                   	push   %eax
+  8025b1:	68 00 70 80 00       	push   $0x807000
+  8025b6:	ff 75 0c             	push   0xc(%ebp)
+  8025b9:	e8 79 e7 ff ff       	call   800d37 <memmove>
+	return r;
+  8025be:	83 c4 10             	add    $0x10,%esp
+}
+  8025c1:	89 d8                	mov    %ebx,%eax
+  8025c3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8025c6:	c9                   	leave
+  8025c7:	c3                   	ret
+	assert(r <= n && r <= PGSIZE);
+  8025c8:	68 a2 47 80 00       	push   $0x8047a2
+  8025cd:	68 ac 46 80 00       	push   $0x8046ac
+  8025d2:	68 86 01 00 00       	push   $0x186
+  8025d7:	68 90 47 80 00       	push   $0x804790
+  8025dc:	e8 07 df ff ff       	call   8004e8 <_panic>
+		return -E_NOT_SUPP;
+  8025e1:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  8025e6:	eb d9                	jmp    8025c1 <readdir+0x8f>
+
+008025e8 <munmap>:
+{
+  8025e8:	55                   	push   %ebp
+  8025e9:	89 e5                	mov    %esp,%ebp
+  8025eb:	56                   	push   %esi
+  8025ec:	53                   	push   %ebx
+  8025ed:	8b 75 08             	mov    0x8(%ebp),%esi
+  8025f0:	8b 55 0c             	mov    0xc(%ebp),%edx
+	if (PGOFF(addr) || (uintptr_t) addr >= UTOP || len > UTOP - (uintptr_t) addr)
+  8025f3:	f7 c6 ff 0f 00 00    	test   $0xfff,%esi
+  8025f9:	75 41                	jne    80263c <munmap+0x54>
+  8025fb:	81 fe ff ff bf ee    	cmp    $0xeebfffff,%esi
+  802601:	77 39                	ja     80263c <munmap+0x54>
+  802603:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  802608:	29 f0                	sub    %esi,%eax
+  80260a:	39 d0                	cmp    %edx,%eax
+  80260c:	72 35                	jb     802643 <munmap+0x5b>
+	for (va = (uintptr_t) addr; va < (uintptr_t) addr + len; va += PGSIZE)
+  80260e:	89 f3                	mov    %esi,%ebx
+  802610:	01 d6                	add    %edx,%esi
+  802612:	39 f3                	cmp    %esi,%ebx
+  802614:	73 1a                	jae    802630 <munmap+0x48>
+		if ((r = sys_page_unmap(0, (void *) va)) < 0)
+  802616:	83 ec 08             	sub    $0x8,%esp
+  802619:	53                   	push   %ebx
+  80261a:	6a 00                	push   $0x0
+  80261c:	e8 29 ea ff ff       	call   80104a <sys_page_unmap>
+  802621:	83 c4 10             	add    $0x10,%esp
+  802624:	85 c0                	test   %eax,%eax
+  802626:	78 0d                	js     802635 <munmap+0x4d>
+	for (va = (uintptr_t) addr; va < (uintptr_t) addr + len; va += PGSIZE)
+  802628:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  80262e:	eb e2                	jmp    802612 <munmap+0x2a>
+	return 0;
+  802630:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802635:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802638:	5b                   	pop    %ebx
+  802639:	5e                   	pop    %esi
+  80263a:	5d                   	pop    %ebp
+  80263b:	c3                   	ret
+		return -E_INVAL;
+  80263c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802641:	eb f2                	jmp    802635 <munmap+0x4d>
+  802643:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802648:	eb eb                	jmp    802635 <munmap+0x4d>
+
+0080264a <mmap>:
+{
+  80264a:	55                   	push   %ebp
+  80264b:	89 e5                	mov    %esp,%ebp
+  80264d:	57                   	push   %edi
+  80264e:	56                   	push   %esi
+  80264f:	53                   	push   %ebx
+  802650:	83 ec 34             	sub    $0x34,%esp
+  802653:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802656:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  802659:	50                   	push   %eax
+  80265a:	ff 75 18             	push   0x18(%ebp)
+  80265d:	e8 ee f0 ff ff       	call   801750 <fd_lookup>
+  802662:	89 c3                	mov    %eax,%ebx
+  802664:	83 c4 10             	add    $0x10,%esp
+  802667:	85 c0                	test   %eax,%eax
+  802669:	0f 88 0e 01 00 00    	js     80277d <mmap+0x133>
+	if (fd->fd_dev_id != devfile.dev_id)
+  80266f:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802672:	a1 40 50 80 00       	mov    0x805040,%eax
+  802677:	39 02                	cmp    %eax,(%edx)
+  802679:	0f 85 50 01 00 00    	jne    8027cf <mmap+0x185>
+	if ((prot & PROT_WRITE) && !(flags & MAP_PRIVATE))
+  80267f:	8b 45 10             	mov    0x10(%ebp),%eax
+  802682:	83 e0 02             	and    $0x2,%eax
+  802685:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  802688:	74 0a                	je     802694 <mmap+0x4a>
+  80268a:	f6 45 14 02          	testb  $0x2,0x14(%ebp)
+  80268e:	0f 84 42 01 00 00    	je     8027d6 <mmap+0x18c>
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY
+  802694:	8b 42 08             	mov    0x8(%edx),%eax
+  802697:	83 e0 03             	and    $0x3,%eax
+  80269a:	83 f8 01             	cmp    $0x1,%eax
+  80269d:	0f 84 3a 01 00 00    	je     8027dd <mmap+0x193>
+	    || PGOFF(addr) || PGOFF(offset) || offset < 0
+  8026a3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8026a6:	0b 45 1c             	or     0x1c(%ebp),%eax
+  8026a9:	25 ff 0f 00 00       	and    $0xfff,%eax
+  8026ae:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8026b1:	0f 85 2d 01 00 00    	jne    8027e4 <mmap+0x19a>
+	    || (uintptr_t) addr >= UTOP || len > UTOP - (uintptr_t) addr)
+  8026b7:	83 7d 1c 00          	cmpl   $0x0,0x1c(%ebp)
+  8026bb:	0f 88 2a 01 00 00    	js     8027eb <mmap+0x1a1>
+  8026c1:	81 7d 08 ff ff bf ee 	cmpl   $0xeebfffff,0x8(%ebp)
+  8026c8:	0f 87 1d 01 00 00    	ja     8027eb <mmap+0x1a1>
+  8026ce:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  8026d3:	2b 45 08             	sub    0x8(%ebp),%eax
+  8026d6:	39 f8                	cmp    %edi,%eax
+  8026d8:	0f 82 14 01 00 00    	jb     8027f2 <mmap+0x1a8>
+	if ((r = devfile_sync(fd)) < 0)
+  8026de:	83 ec 0c             	sub    $0xc,%esp
+  8026e1:	52                   	push   %edx
+  8026e2:	e8 45 f8 ff ff       	call   801f2c <devfile_sync>
+  8026e7:	89 c3                	mov    %eax,%ebx
+  8026e9:	83 c4 10             	add    $0x10,%esp
+  8026ec:	85 c0                	test   %eax,%eax
+  8026ee:	0f 88 89 00 00 00    	js     80277d <mmap+0x133>
+	len = ROUNDUP(len, PGSIZE);
+  8026f4:	81 c7 ff 0f 00 00    	add    $0xfff,%edi
+  8026fa:	81 e7 00 f0 ff ff    	and    $0xfffff000,%edi
+	for (done = 0; done < len; done += n * PGSIZE) {
+  802700:	be 00 00 00 00       	mov    $0x0,%esi
+  802705:	8b 5d 1c             	mov    0x1c(%ebp),%ebx
+  802708:	39 fe                	cmp    %edi,%esi
+  80270a:	73 7b                	jae    802787 <mmap+0x13d>
+		n = MIN((len - done) / PGSIZE, FSBULK_MAXPAGES);
+  80270c:	89 f8                	mov    %edi,%eax
+  80270e:	29 f0                	sub    %esi,%eax
+  802710:	c1 e8 0c             	shr    $0xc,%eax
+  802713:	ba 40 00 00 00       	mov    $0x40,%edx
+  802718:	39 d0                	cmp    %edx,%eax
+  80271a:	0f 47 c2             	cmova  %edx,%eax
+  80271d:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		fsipcbuf.map.req_fileid = fd->fd_file.id;
+  802720:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802723:	8b 52 0c             	mov    0xc(%edx),%edx
+  802726:	89 15 00 70 80 00    	mov    %edx,0x807000
+		fsipcbuf.map.req_offset = offset + done;
+  80272c:	8d 14 33             	lea    (%ebx,%esi,1),%edx
+  80272f:	89 15 04 70 80 00    	mov    %edx,0x807004
+		fsipcbuf.map.req_npages = n;
+  802735:	a3 08 70 80 00       	mov    %eax,0x807008
+		if ((r = fsipcv(FSREQ_MAP, addr + done, &n)) <= 0 || n == 0) {
+  80273a:	89 f2                	mov    %esi,%edx
+  80273c:	03 55 08             	add    0x8(%ebp),%edx
+  80273f:	8d 4d e0             	lea    -0x20(%ebp),%ecx
+  802742:	b8 0b 00 00 00       	mov    $0xb,%eax
+  802747:	e8 ea f6 ff ff       	call   801e36 <fsipcv>
+  80274c:	85 c0                	test   %eax,%eax
+  80274e:	7e 12                	jle    802762 <mmap+0x118>
+  802750:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802753:	85 c0                	test   %eax,%eax
+  802755:	0f 84 9e 00 00 00    	je     8027f9 <mmap+0x1af>
+	for (done = 0; done < len; done += n * PGSIZE) {
+  80275b:	c1 e0 0c             	shl    $0xc,%eax
+  80275e:	01 c6                	add    %eax,%esi
+  802760:	eb a6                	jmp    802708 <mmap+0xbe>
+			munmap(addr, done);
+  802762:	89 c3                	mov    %eax,%ebx
+  802764:	83 ec 08             	sub    $0x8,%esp
+  802767:	56                   	push   %esi
+  802768:	ff 75 08             	push   0x8(%ebp)
+  80276b:	e8 78 fe ff ff       	call   8025e8 <munmap>
+			return r < 0 ? r : -E_INVAL;
+  802770:	83 c4 10             	add    $0x10,%esp
+  802773:	85 db                	test   %ebx,%ebx
+  802775:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80277a:	0f 49 d8             	cmovns %eax,%ebx
+}
+  80277d:	89 d8                	mov    %ebx,%eax
+  80277f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802782:	5b                   	pop    %ebx
+  802783:	5e                   	pop    %esi
+  802784:	5f                   	pop    %edi
+  802785:	5d                   	pop    %ebp
+  802786:	c3                   	ret
+	if (prot & PROT_WRITE)
+  802787:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+	return 0;
+  80278a:	89 c3                	mov    %eax,%ebx
+	if (prot & PROT_WRITE)
+  80278c:	85 c0                	test   %eax,%eax
+  80278e:	74 ed                	je     80277d <mmap+0x133>
+		for (done = 0; done < len; done += PGSIZE)
+  802790:	be 00 00 00 00       	mov    $0x0,%esi
+  802795:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802798:	39 fe                	cmp    %edi,%esi
+  80279a:	73 2e                	jae    8027ca <mmap+0x180>
+			if ((r = cowpage(addr + done)) < 0) {
+  80279c:	83 ec 0c             	sub    $0xc,%esp
+  80279f:	8d 04 33             	lea    (%ebx,%esi,1),%eax
+  8027a2:	50                   	push   %eax
+  8027a3:	e8 2d ed ff ff       	call   8014d5 <cowpage>
+  8027a8:	83 c4 10             	add    $0x10,%esp
+  8027ab:	85 c0                	test   %eax,%eax
+  8027ad:	78 08                	js     8027b7 <mmap+0x16d>
+		for (done = 0; done < len; done += PGSIZE)
+  8027af:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  8027b5:	eb e1                	jmp    802798 <mmap+0x14e>
+				munmap(addr, len);
+  8027b7:	89 c3                	mov    %eax,%ebx
+  8027b9:	83 ec 08             	sub    $0x8,%esp
+  8027bc:	57                   	push   %edi
+  8027bd:	ff 75 08             	push   0x8(%ebp)
+  8027c0:	e8 23 fe ff ff       	call   8025e8 <munmap>
+				return r;
+  8027c5:	83 c4 10             	add    $0x10,%esp
+  8027c8:	eb b3                	jmp    80277d <mmap+0x133>
+	return 0;
+  8027ca:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  8027cd:	eb ae                	jmp    80277d <mmap+0x133>
+		return -E_NOT_SUPP;
+  8027cf:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  8027d4:	eb a7                	jmp    80277d <mmap+0x133>
+		return -E_NOT_SUPP;
+  8027d6:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  8027db:	eb a0                	jmp    80277d <mmap+0x133>
+		return -E_INVAL;
+  8027dd:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  8027e2:	eb 99                	jmp    80277d <mmap+0x133>
+  8027e4:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  8027e9:	eb 92                	jmp    80277d <mmap+0x133>
+  8027eb:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  8027f0:	eb 8b                	jmp    80277d <mmap+0x133>
+  8027f2:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  8027f7:	eb 84                	jmp    80277d <mmap+0x133>
+			munmap(addr, done);
+  8027f9:	83 ec 08             	sub    $0x8,%esp
+  8027fc:	56                   	push   %esi
+  8027fd:	ff 75 08             	push   0x8(%ebp)
+  802800:	e8 e3 fd ff ff       	call   8025e8 <munmap>
+  802805:	83 c4 10             	add    $0x10,%esp
+			return r < 0 ? r : -E_INVAL;
+  802808:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  80280d:	e9 6b ff ff ff       	jmp    80277d <mmap+0x133>
+
+00802812 <fsring_read>:
+// buf.  fsring_reap returns 'tag' with the result once done.
+// Returns 0 on success, < 0 on error; -E_NO_MEM means too many requests
+// are outstanding, and some must be reaped first.
+int
+fsring_read(int fdnum, void *buf, size_t n, off_t offset, uint32_t tag)
+{
+  802812:	55                   	push   %ebp
+  802813:	89 e5                	mov    %esp,%ebp
+  802815:	56                   	push   %esi
+  802816:	53                   	push   %ebx
+  802817:	83 ec 10             	sub    $0x10,%esp
+  80281a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	struct Fd *fd;
+	int slot;
+
+	if ((slot = fsring_slot(fdnum, &fd)) < 0)
+  80281d:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802820:	8b 45 08             	mov    0x8(%ebp),%eax
+  802823:	e8 3d f9 ff ff       	call   802165 <fsring_slot>
+  802828:	85 c0                	test   %eax,%eax
+  80282a:	78 60                	js     80288c <fsring_read+0x7a>
+		return slot;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY)
+  80282c:	8b 75 f4             	mov    -0xc(%ebp),%esi
+  80282f:	8b 56 08             	mov    0x8(%esi),%edx
+  802832:	83 e2 03             	and    $0x3,%edx
+  802835:	83 fa 01             	cmp    $0x1,%edx
+  802838:	74 59                	je     802893 <fsring_read+0x81>
+		return -E_INVAL;
+	fsring_busy |= 1 << slot;
+  80283a:	ba 01 00 00 00       	mov    $0x1,%edx
+  80283f:	89 c1                	mov    %eax,%ecx
+  802841:	d3 e2                	shl    %cl,%edx
+  802843:	09 15 c0 80 80 00    	or     %edx,0x8080c0
+	fsring_slots[slot].s_type = FSREQ_READ;
+  802849:	8d 14 40             	lea    (%eax,%eax,2),%edx
+  80284c:	c1 e2 02             	shl    $0x2,%edx
+  80284f:	8d 8a 00 80 80 00    	lea    0x808000(%edx),%ecx
+  802855:	c7 82 00 80 80 00 03 	movl   $0x3,0x808000(%edx)
+  80285c:	00 00 00 
+	fsring_slots[slot].s_tag = tag;
+  80285f:	8b 55 18             	mov    0x18(%ebp),%edx
+  802862:	89 51 04             	mov    %edx,0x4(%ecx)
+	fsring_slots[slot].s_buf = buf;
+  802865:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802868:	89 51 08             	mov    %edx,0x8(%ecx)
+	return fsring_post(FSREQ_READ, fd, offset, MIN(n, PGSIZE), slot);
+  80286b:	83 ec 08             	sub    $0x8,%esp
+  80286e:	50                   	push   %eax
+  80286f:	b8 00 10 00 00       	mov    $0x1000,%eax
+  802874:	39 c3                	cmp    %eax,%ebx
+  802876:	0f 47 d8             	cmova  %eax,%ebx
+  802879:	53                   	push   %ebx
+  80287a:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  80287d:	89 f2                	mov    %esi,%edx
+  80287f:	b8 03 00 00 00       	mov    $0x3,%eax
+  802884:	e8 1e f5 ff ff       	call   801da7 <fsring_post>
+  802889:	83 c4 10             	add    $0x10,%esp
+}
+  80288c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80288f:	5b                   	pop    %ebx
+  802890:	5e                   	pop    %esi
+  802891:	5d                   	pop    %ebp
+  802892:	c3                   	ret
+		return -E_INVAL;
+  802893:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802898:	eb f2                	jmp    80288c <fsring_read+0x7a>
+
+0080289a <fsring_write>:
+// Start writing up to n bytes (at most a page) from buf at 'offset' of
+// fdnum.  buf may be reused as soon as this returns.
+// Returns as fsring_read.
+int
+fsring_write(int fdnum, const void *buf, size_t n, off_t offset, uint32_t tag)
+{
+  80289a:	55                   	push   %ebp
+  80289b:	89 e5                	mov    %esp,%ebp
+  80289d:	56                   	push   %esi
+  80289e:	53                   	push   %ebx
+  80289f:	83 ec 10             	sub    $0x10,%esp
+  8028a2:	8b 75 10             	mov    0x10(%ebp),%esi
+	struct Fd *fd;
+	int slot;
+
+	if ((slot = fsring_slot(fdnum, &fd)) < 0)
+  8028a5:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8028a8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8028ab:	e8 b5 f8 ff ff       	call   802165 <fsring_slot>
+  8028b0:	89 c3                	mov    %eax,%ebx
+  8028b2:	85 c0                	test   %eax,%eax
+  8028b4:	78 77                	js     80292d <fsring_write+0x93>
+		return slot;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY)
+  8028b6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8028b9:	f6 40 08 03          	testb  $0x3,0x8(%eax)
+  8028bd:	74 77                	je     802936 <fsring_write+0x9c>
+		return -E_INVAL;
+	n = MIN(n, PGSIZE);
+  8028bf:	b8 00 10 00 00       	mov    $0x1000,%eax
+  8028c4:	39 c6                	cmp    %eax,%esi
+  8028c6:	0f 47 f0             	cmova  %eax,%esi
+	memmove((char *) fsring + (1 + slot) * PGSIZE, buf, n);
+  8028c9:	83 ec 04             	sub    $0x4,%esp
+  8028cc:	56                   	push   %esi
+  8028cd:	ff 75 0c             	push   0xc(%ebp)
+  8028d0:	89 d8                	mov    %ebx,%eax
+  8028d2:	c1 e0 0c             	shl    $0xc,%eax
+  8028d5:	8d 80 00 10 00 cf    	lea    -0x30fff000(%eax),%eax
+  8028db:	50                   	push   %eax
+  8028dc:	e8 56 e4 ff ff       	call   800d37 <memmove>
+	fsring_busy |= 1 << slot;
+  8028e1:	b8 01 00 00 00       	mov    $0x1,%eax
+  8028e6:	89 d9                	mov    %ebx,%ecx
+  8028e8:	d3 e0                	shl    %cl,%eax
+  8028ea:	09 05 c0 80 80 00    	or     %eax,0x8080c0
+	fsring_slots[slot].s_type = FSREQ_WRITE;
+  8028f0:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  8028f3:	c1 e0 02             	shl    $0x2,%eax
+  8028f6:	8d 90 00 80 80 00    	lea    0x808000(%eax),%edx
+  8028fc:	c7 80 00 80 80 00 04 	movl   $0x4,0x808000(%eax)
+  802903:	00 00 00 
+	fsring_slots[slot].s_tag = tag;
+  802906:	8b 45 18             	mov    0x18(%ebp),%eax
+  802909:	89 42 04             	mov    %eax,0x4(%edx)
+	fsring_slots[slot].s_buf = NULL;
+  80290c:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	return fsring_post(FSREQ_WRITE, fd, offset, n, slot);
+  802913:	83 c4 08             	add    $0x8,%esp
+  802916:	53                   	push   %ebx
+  802917:	56                   	push   %esi
+  802918:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  80291b:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80291e:	b8 04 00 00 00       	mov    $0x4,%eax
+  802923:	e8 7f f4 ff ff       	call   801da7 <fsring_post>
+  802928:	89 c3                	mov    %eax,%ebx
+  80292a:	83 c4 10             	add    $0x10,%esp
+}
+  80292d:	89 d8                	mov    %ebx,%eax
+  80292f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802932:	5b                   	pop    %ebx
+  802933:	5e                   	pop    %esi
+  802934:	5d                   	pop    %ebp
+  802935:	c3                   	ret
+		return -E_INVAL;
+  802936:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  80293b:	eb f0                	jmp    80292d <fsring_write+0x93>
+
+0080293d <fsring_stat>:
+
+// Start a stat of fdnum into *st.  Returns as fsring_read.
+int
+fsring_stat(int fdnum, struct Stat *st, uint32_t tag)
+{
+  80293d:	55                   	push   %ebp
+  80293e:	89 e5                	mov    %esp,%ebp
+  802940:	83 ec 18             	sub    $0x18,%esp
+	struct Fd *fd;
+	int slot;
+
+	if ((slot = fsring_slot(fdnum, &fd)) < 0)
+  802943:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802946:	8b 45 08             	mov    0x8(%ebp),%eax
+  802949:	e8 17 f8 ff ff       	call   802165 <fsring_slot>
+  80294e:	85 c0                	test   %eax,%eax
+  802950:	78 4c                	js     80299e <fsring_stat+0x61>
+		return slot;
+	fsring_busy |= 1 << slot;
+  802952:	ba 01 00 00 00       	mov    $0x1,%edx
+  802957:	89 c1                	mov    %eax,%ecx
+  802959:	d3 e2                	shl    %cl,%edx
+  80295b:	09 15 c0 80 80 00    	or     %edx,0x8080c0
+	fsring_slots[slot].s_type = FSREQ_STAT;
+  802961:	8d 14 40             	lea    (%eax,%eax,2),%edx
+  802964:	c1 e2 02             	shl    $0x2,%edx
+  802967:	8d 8a 00 80 80 00    	lea    0x808000(%edx),%ecx
+  80296d:	c7 82 00 80 80 00 05 	movl   $0x5,0x808000(%edx)
+  802974:	00 00 00 
+	fsring_slots[slot].s_tag = tag;
+  802977:	8b 55 10             	mov    0x10(%ebp),%edx
+  80297a:	89 51 04             	mov    %edx,0x4(%ecx)
+	fsring_slots[slot].s_buf = st;
+  80297d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802980:	89 51 08             	mov    %edx,0x8(%ecx)
+	return fsring_post(FSREQ_STAT, fd, 0, 0, slot);
+  802983:	83 ec 08             	sub    $0x8,%esp
+  802986:	50                   	push   %eax
+  802987:	6a 00                	push   $0x0
+  802989:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80298e:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802991:	b8 05 00 00 00       	mov    $0x5,%eax
+  802996:	e8 0c f4 ff ff       	call   801da7 <fsring_post>
+  80299b:	83 c4 10             	add    $0x10,%esp
+}
+  80299e:	c9                   	leave
+  80299f:	c3                   	ret
+
+008029a0 <fsring_reap>:
+// If none has finished, wait for one if 'wait' is set and any are
+// outstanding.
+// Returns 1 if a result was collected, 0 if not.
+int
+fsring_reap(uint32_t *tag_store, int *result_store, bool wait)
+{
+  8029a0:	55                   	push   %ebp
+  8029a1:	89 e5                	mov    %esp,%ebp
+  8029a3:	57                   	push   %edi
+  8029a4:	56                   	push   %esi
+  8029a5:	53                   	push   %ebx
+  8029a6:	83 ec 1c             	sub    $0x1c,%esp
+  8029a9:	0f b6 5d 10          	movzbl 0x10(%ebp),%ebx
+	struct Fsring_cqe cqe;
+	struct Fsret_stat *ret;
+	struct Stat *st;
+	char *data;
+
+	if (fsring_env != thisenv->env_id)
+  8029ad:	a1 00 60 80 00       	mov    0x806000,%eax
+  8029b2:	8b 40 48             	mov    0x48(%eax),%eax
+  8029b5:	3b 05 c4 80 80 00    	cmp    0x8080c4,%eax
+  8029bb:	74 12                	je     8029cf <fsring_reap+0x2f>
+		return 0;
+  8029bd:	b8 00 00 00 00       	mov    $0x0,%eax
+	}
+	fsring_busy &= ~(1 << cqe.cqe_slot);
+	*tag_store = fsring_slots[cqe.cqe_slot].s_tag;
+	*result_store = cqe.cqe_result;
+	return 1;
+}
+  8029c2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8029c5:	5b                   	pop    %ebx
+  8029c6:	5e                   	pop    %esi
+  8029c7:	5f                   	pop    %edi
+  8029c8:	5d                   	pop    %ebp
+  8029c9:	c3                   	ret
+		sys_yield();
+  8029ca:	e8 cf e5 ff ff       	call   800f9e <sys_yield>
+	while (fsring->r_cqhead == fsring->r_cqtail) {
+  8029cf:	8b 15 08 00 00 cf    	mov    0xcf000008,%edx
+  8029d5:	a1 0c 00 00 cf       	mov    0xcf00000c,%eax
+  8029da:	39 c2                	cmp    %eax,%edx
+  8029dc:	75 18                	jne    8029f6 <fsring_reap+0x56>
+		if (!wait || fsring_busy == 0)
+  8029de:	84 db                	test   %bl,%bl
+  8029e0:	0f 84 21 01 00 00    	je     802b07 <fsring_reap+0x167>
+  8029e6:	83 3d c0 80 80 00 00 	cmpl   $0x0,0x8080c0
+  8029ed:	75 db                	jne    8029ca <fsring_reap+0x2a>
+			return 0;
+  8029ef:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029f4:	eb cc                	jmp    8029c2 <fsring_reap+0x22>
+	cqe = fsring->r_cq[fsring->r_cqhead % FSRING_NSLOTS];
+  8029f6:	a1 08 00 00 cf       	mov    0xcf000008,%eax
+  8029fb:	83 e0 0f             	and    $0xf,%eax
+  8029fe:	83 c0 2a             	add    $0x2a,%eax
+  802a01:	8b 1c c5 00 00 00 cf 	mov    -0x31000000(,%eax,8),%ebx
+  802a08:	8b 3c c5 04 00 00 cf 	mov    -0x30fffffc(,%eax,8),%edi
+	fsring->r_cqhead++;
+  802a0f:	a1 08 00 00 cf       	mov    0xcf000008,%eax
+  802a14:	83 c0 01             	add    $0x1,%eax
+  802a17:	a3 08 00 00 cf       	mov    %eax,0xcf000008
+	if (cqe.cqe_slot >= FSRING_NSLOTS || !(fsring_busy & (1 << cqe.cqe_slot)))
+  802a1c:	83 fb 0f             	cmp    $0xf,%ebx
+  802a1f:	77 5b                	ja     802a7c <fsring_reap+0xdc>
+  802a21:	be 01 00 00 00       	mov    $0x1,%esi
+  802a26:	89 d9                	mov    %ebx,%ecx
+  802a28:	d3 e6                	shl    %cl,%esi
+  802a2a:	89 f0                	mov    %esi,%eax
+  802a2c:	23 05 c0 80 80 00    	and    0x8080c0,%eax
+  802a32:	74 48                	je     802a7c <fsring_reap+0xdc>
+	data = (char *) fsring + (1 + cqe.cqe_slot) * PGSIZE;
+  802a34:	89 d8                	mov    %ebx,%eax
+  802a36:	c1 e0 0c             	shl    $0xc,%eax
+  802a39:	8d 80 00 10 00 cf    	lea    -0x30fff000(%eax),%eax
+  802a3f:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	switch (fsring_slots[cqe.cqe_slot].s_type) {
+  802a42:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  802a45:	8b 04 85 00 80 80 00 	mov    0x808000(,%eax,4),%eax
+  802a4c:	83 f8 03             	cmp    $0x3,%eax
+  802a4f:	74 40                	je     802a91 <fsring_reap+0xf1>
+  802a51:	83 f8 05             	cmp    $0x5,%eax
+  802a54:	74 64                	je     802aba <fsring_reap+0x11a>
+	fsring_busy &= ~(1 << cqe.cqe_slot);
+  802a56:	f7 d6                	not    %esi
+  802a58:	21 35 c0 80 80 00    	and    %esi,0x8080c0
+	*tag_store = fsring_slots[cqe.cqe_slot].s_tag;
+  802a5e:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  802a61:	8b 14 85 04 80 80 00 	mov    0x808004(,%eax,4),%edx
+  802a68:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a6b:	89 10                	mov    %edx,(%eax)
+	*result_store = cqe.cqe_result;
+  802a6d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802a70:	89 38                	mov    %edi,(%eax)
+	return 1;
+  802a72:	b8 01 00 00 00       	mov    $0x1,%eax
+  802a77:	e9 46 ff ff ff       	jmp    8029c2 <fsring_reap+0x22>
+		panic("fsring_reap: bad slot %u", cqe.cqe_slot);
+  802a7c:	53                   	push   %ebx
+  802a7d:	68 b8 47 80 00       	push   $0x8047b8
+  802a82:	68 8f 02 00 00       	push   $0x28f
+  802a87:	68 90 47 80 00       	push   $0x804790
+  802a8c:	e8 57 da ff ff       	call   8004e8 <_panic>
+		if (cqe.cqe_result > 0)
+  802a91:	85 ff                	test   %edi,%edi
+  802a93:	7e c1                	jle    802a56 <fsring_reap+0xb6>
+			memmove(fsring_slots[cqe.cqe_slot].s_buf, data,
+  802a95:	83 ec 04             	sub    $0x4,%esp
+				MIN(cqe.cqe_result, PGSIZE));
+  802a98:	b8 00 10 00 00       	mov    $0x1000,%eax
+  802a9d:	39 c7                	cmp    %eax,%edi
+  802a9f:	0f 4e c7             	cmovle %edi,%eax
+			memmove(fsring_slots[cqe.cqe_slot].s_buf, data,
+  802aa2:	50                   	push   %eax
+  802aa3:	ff 75 e4             	push   -0x1c(%ebp)
+  802aa6:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  802aa9:	ff 34 85 08 80 80 00 	push   0x808008(,%eax,4)
+  802ab0:	e8 82 e2 ff ff       	call   800d37 <memmove>
+  802ab5:	83 c4 10             	add    $0x10,%esp
+  802ab8:	eb 9c                	jmp    802a56 <fsring_reap+0xb6>
+		if (cqe.cqe_result == 0) {
+  802aba:	85 ff                	test   %edi,%edi
+  802abc:	75 98                	jne    802a56 <fsring_reap+0xb6>
+			st = fsring_slots[cqe.cqe_slot].s_buf;
+  802abe:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  802ac1:	8b 0c 85 08 80 80 00 	mov    0x808008(,%eax,4),%ecx
+			strcpy(st->st_name, ret->ret_name);
+  802ac8:	83 ec 08             	sub    $0x8,%esp
+  802acb:	ff 75 e4             	push   -0x1c(%ebp)
+  802ace:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  802ad1:	51                   	push   %ecx
+  802ad2:	e8 da e0 ff ff       	call   800bb1 <strcpy>
+			st->st_size = ret->ret_size;
+  802ad7:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802ada:	8b 82 80 00 00 00    	mov    0x80(%edx),%eax
+  802ae0:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  802ae3:	89 81 80 00 00 00    	mov    %eax,0x80(%ecx)
+			st->st_isdir = ret->ret_isdir;
+  802ae9:	8b 82 84 00 00 00    	mov    0x84(%edx),%eax
+  802aef:	89 81 84 00 00 00    	mov    %eax,0x84(%ecx)
+			st->st_dev = &devfile;
+  802af5:	c7 81 88 00 00 00 40 	movl   $0x805040,0x88(%ecx)
+  802afc:	50 80 00 
+  802aff:	83 c4 10             	add    $0x10,%esp
+  802b02:	e9 4f ff ff ff       	jmp    802a56 <fsring_reap+0xb6>
+			return 0;
+  802b07:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b0c:	e9 b1 fe ff ff       	jmp    8029c2 <fsring_reap+0x22>
+
+00802b11 <file_slurp>:
+// page are copied through fsipcbuf; larger ones go straight into buf's
+// pages, and stop at FSBULK_MAXPAGES of them.
+// Returns the number of bytes read, 0 for directories, or < 0 on error.
+ssize_t
+file_slurp(const char *path, void *buf, size_t n, struct Stat *st)
+{
+  802b11:	55                   	push   %ebp
+  802b12:	89 e5                	mov    %esp,%ebp
+  802b14:	57                   	push   %edi
+  802b15:	56                   	push   %esi
+  802b16:	53                   	push   %ebx
+  802b17:	83 ec 28             	sub    $0x28,%esp
+  802b1a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802b1d:	8b 7d 10             	mov    0x10(%ebp),%edi
+  802b20:	8b 75 14             	mov    0x14(%ebp),%esi
+	const char *name;
+	int r;
+
+	if (strlen(path) >= MAXPATHLEN)
+  802b23:	53                   	push   %ebx
+  802b24:	e8 4d e0 ff ff       	call   800b76 <strlen>
+  802b29:	83 c4 10             	add    $0x10,%esp
+  802b2c:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802b31:	0f 8f 02 01 00 00    	jg     802c39 <file_slurp+0x128>
+		return -E_BAD_PATH;
+
+	strcpy(fsipcbuf.slurp.req_path, path);
+  802b37:	83 ec 08             	sub    $0x8,%esp
+  802b3a:	53                   	push   %ebx
+  802b3b:	68 00 70 80 00       	push   $0x807000
+  802b40:	e8 6c e0 ff ff       	call   800bb1 <strcpy>
+	if (n > sizeof(fsipcbuf.slurpRet.ret_buf)) {
+  802b45:	83 c4 10             	add    $0x10,%esp
+  802b48:	81 ff f8 0f 00 00    	cmp    $0xff8,%edi
+  802b4e:	76 69                	jbe    802bb9 <file_slurp+0xa8>
+		n = MIN(n, FSBULK_MAXPAGES * PGSIZE - PGOFF(buf));
+  802b50:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802b53:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  802b59:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  802b5e:	29 d1                	sub    %edx,%ecx
+  802b60:	39 f9                	cmp    %edi,%ecx
+  802b62:	0f 46 f9             	cmovbe %ecx,%edi
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  802b65:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802b68:	89 f9                	mov    %edi,%ecx
+  802b6a:	01 c1                	add    %eax,%ecx
+  802b6c:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  802b6f:	eb 0f                	jmp    802b80 <file_slurp+0x6f>
+		*(volatile char *) p = *(volatile char *) p;
+  802b71:	0f b6 10             	movzbl (%eax),%edx
+  802b74:	88 10                	mov    %dl,(%eax)
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  802b76:	05 00 10 00 00       	add    $0x1000,%eax
+  802b7b:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  802b80:	39 c8                	cmp    %ecx,%eax
+  802b82:	72 ed                	jb     802b71 <file_slurp+0x60>
+		fsipc_touch(buf, n);
+		fsipcbuf.slurp.req_n = n;
+  802b84:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802b87:	89 3d 00 74 80 00    	mov    %edi,0x807400
+		fsipcbuf.slurp.req_off = PGOFF(buf);
+  802b8d:	89 15 04 74 80 00    	mov    %edx,0x807404
+		r = fsipc_pages(FSREQ_SLURP, buf, n, PTE_P | PTE_W | PTE_U);
+  802b93:	83 ec 0c             	sub    $0xc,%esp
+  802b96:	6a 07                	push   $0x7
+  802b98:	89 f9                	mov    %edi,%ecx
+  802b9a:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802b9d:	b8 0f 00 00 00       	mov    $0xf,%eax
+  802ba2:	e8 3f f1 ff ff       	call   801ce6 <fsipc_pages>
+  802ba7:	89 c7                	mov    %eax,%edi
+  802ba9:	83 c4 10             	add    $0x10,%esp
+			memmove(buf, fsipcbuf.slurpRet.ret_buf, r);
+	}
+	if (r < 0)
+		return r;
+
+	if (st) {
+  802bac:	85 f6                	test   %esi,%esi
+  802bae:	74 7f                	je     802c2f <file_slurp+0x11e>
+  802bb0:	8d 43 01             	lea    0x1(%ebx),%eax
+  802bb3:	85 ff                	test   %edi,%edi
+  802bb5:	79 3c                	jns    802bf3 <file_slurp+0xe2>
+  802bb7:	eb 76                	jmp    802c2f <file_slurp+0x11e>
+		fsipcbuf.slurp.req_n = n;
+  802bb9:	89 3d 00 74 80 00    	mov    %edi,0x807400
+		if ((r = fsipc(FSREQ_SLURP, NULL)) > 0)
+  802bbf:	ba 00 00 00 00       	mov    $0x0,%edx
+  802bc4:	b8 0f 00 00 00       	mov    $0xf,%eax
+  802bc9:	e8 ba f2 ff ff       	call   801e88 <fsipc>
+  802bce:	89 c7                	mov    %eax,%edi
+  802bd0:	85 c0                	test   %eax,%eax
+  802bd2:	7e d8                	jle    802bac <file_slurp+0x9b>
+			memmove(buf, fsipcbuf.slurpRet.ret_buf, r);
+  802bd4:	83 ec 04             	sub    $0x4,%esp
+  802bd7:	50                   	push   %eax
+  802bd8:	68 08 70 80 00       	push   $0x807008
+  802bdd:	ff 75 0c             	push   0xc(%ebp)
+  802be0:	e8 52 e1 ff ff       	call   800d37 <memmove>
+  802be5:	83 c4 10             	add    $0x10,%esp
+  802be8:	eb c2                	jmp    802bac <file_slurp+0x9b>
+		for (name = path; *path; path++)
+			if (*path == '/')
+				name = path + 1;
+  802bea:	80 fa 2f             	cmp    $0x2f,%dl
+  802bed:	0f 44 d9             	cmove  %ecx,%ebx
+		for (name = path; *path; path++)
+  802bf0:	83 c0 01             	add    $0x1,%eax
+  802bf3:	89 c1                	mov    %eax,%ecx
+  802bf5:	0f b6 50 ff          	movzbl -0x1(%eax),%edx
+  802bf9:	84 d2                	test   %dl,%dl
+  802bfb:	75 ed                	jne    802bea <file_slurp+0xd9>
+		strlcpy(st->st_name, name, sizeof(st->st_name));
+  802bfd:	83 ec 04             	sub    $0x4,%esp
+  802c00:	68 80 00 00 00       	push   $0x80
+  802c05:	53                   	push   %ebx
+  802c06:	56                   	push   %esi
+  802c07:	e8 1b e0 ff ff       	call   800c27 <strlcpy>
+		st->st_size = fsipcbuf.slurpRet.ret_size;
+  802c0c:	a1 00 70 80 00       	mov    0x807000,%eax
+  802c11:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+		st->st_isdir = fsipcbuf.slurpRet.ret_isdir;
+  802c17:	a1 04 70 80 00       	mov    0x807004,%eax
+  802c1c:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+		st->st_dev = &devfile;
+  802c22:	c7 86 88 00 00 00 40 	movl   $0x805040,0x88(%esi)
+  802c29:	50 80 00 
+  802c2c:	83 c4 10             	add    $0x10,%esp
+	}
+	return r;
+}
+  802c2f:	89 f8                	mov    %edi,%eax
+  802c31:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802c34:	5b                   	pop    %ebx
+  802c35:	5e                   	pop    %esi
+  802c36:	5f                   	pop    %edi
+  802c37:	5d                   	pop    %ebp
+  802c38:	c3                   	ret
+		return -E_BAD_PATH;
+  802c39:	bf f4 ff ff ff       	mov    $0xfffffff4,%edi
+  802c3e:	eb ef                	jmp    802c2f <file_slurp+0x11e>
+
+00802c40 <remove>:
+
+// Delete a file
+int
+remove(const char *path)
+{
+  802c40:	55                   	push   %ebp
+  802c41:	89 e5                	mov    %esp,%ebp
+  802c43:	53                   	push   %ebx
+  802c44:	83 ec 10             	sub    $0x10,%esp
+  802c47:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (strlen(path) >= MAXPATHLEN)
+  802c4a:	53                   	push   %ebx
+  802c4b:	e8 26 df ff ff       	call   800b76 <strlen>
+  802c50:	83 c4 10             	add    $0x10,%esp
+  802c53:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802c58:	7f 25                	jg     802c7f <remove+0x3f>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.remove.req_path, path);
+  802c5a:	83 ec 08             	sub    $0x8,%esp
+  802c5d:	53                   	push   %ebx
+  802c5e:	68 00 70 80 00       	push   $0x807000
+  802c63:	e8 49 df ff ff       	call   800bb1 <strcpy>
+	return fsipc(FSREQ_REMOVE, NULL);
+  802c68:	ba 00 00 00 00       	mov    $0x0,%edx
+  802c6d:	b8 07 00 00 00       	mov    $0x7,%eax
+  802c72:	e8 11 f2 ff ff       	call   801e88 <fsipc>
+  802c77:	83 c4 10             	add    $0x10,%esp
+}
+  802c7a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802c7d:	c9                   	leave
+  802c7e:	c3                   	ret
+		return -E_BAD_PATH;
+  802c7f:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  802c84:	eb f4                	jmp    802c7a <remove+0x3a>
+
+00802c86 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  802c86:	55                   	push   %ebp
+  802c87:	89 e5                	mov    %esp,%ebp
+  802c89:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  802c8c:	ba 00 00 00 00       	mov    $0x0,%edx
+  802c91:	b8 08 00 00 00       	mov    $0x8,%eax
+  802c96:	e8 ed f1 ff ff       	call   801e88 <fsipc>
+}
+  802c9b:	c9                   	leave
+  802c9c:	c3                   	ret
+
+00802c9d <defrag>:
+// Have the file server lay out the blocks of 'path' contiguously on
+// disk.  Stores the number of extents the file had before and has
+// after in *before and *after, if they are not null.
+int
+defrag(const char *path, uint32_t *before, uint32_t *after)
+{
+  802c9d:	55                   	push   %ebp
+  802c9e:	89 e5                	mov    %esp,%ebp
+  802ca0:	57                   	push   %edi
+  802ca1:	56                   	push   %esi
+  802ca2:	53                   	push   %ebx
+  802ca3:	83 ec 18             	sub    $0x18,%esp
+  802ca6:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802ca9:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802cac:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int r;
+
+	if (strlen(path) >= MAXPATHLEN)
+  802caf:	57                   	push   %edi
+  802cb0:	e8 c1 de ff ff       	call   800b76 <strlen>
+  802cb5:	83 c4 10             	add    $0x10,%esp
+  802cb8:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802cbd:	7f 4c                	jg     802d0b <defrag+0x6e>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.defrag.req_path, path);
+  802cbf:	83 ec 08             	sub    $0x8,%esp
+  802cc2:	57                   	push   %edi
+  802cc3:	68 00 70 80 00       	push   $0x807000
+  802cc8:	e8 e4 de ff ff       	call   800bb1 <strcpy>
+	if ((r = fsipc(FSREQ_DEFRAG, NULL)) < 0)
+  802ccd:	ba 00 00 00 00       	mov    $0x0,%edx
+  802cd2:	b8 10 00 00 00       	mov    $0x10,%eax
+  802cd7:	e8 ac f1 ff ff       	call   801e88 <fsipc>
+  802cdc:	83 c4 10             	add    $0x10,%esp
+  802cdf:	85 c0                	test   %eax,%eax
+  802ce1:	78 20                	js     802d03 <defrag+0x66>
+		return r;
+	if (before)
+  802ce3:	85 f6                	test   %esi,%esi
+  802ce5:	74 07                	je     802cee <defrag+0x51>
+		*before = fsipcbuf.defragRet.ret_before;
+  802ce7:	a1 00 70 80 00       	mov    0x807000,%eax
+  802cec:	89 06                	mov    %eax,(%esi)
+	if (after)
+		*after = fsipcbuf.defragRet.ret_after;
+	return 0;
+  802cee:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (after)
+  802cf3:	85 db                	test   %ebx,%ebx
+  802cf5:	74 0c                	je     802d03 <defrag+0x66>
+		*after = fsipcbuf.defragRet.ret_after;
+  802cf7:	a1 04 70 80 00       	mov    0x807004,%eax
+  802cfc:	89 03                	mov    %eax,(%ebx)
+	return 0;
+  802cfe:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802d03:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802d06:	5b                   	pop    %ebx
+  802d07:	5e                   	pop    %esi
+  802d08:	5f                   	pop    %edi
+  802d09:	5d                   	pop    %ebp
+  802d0a:	c3                   	ret
+		return -E_BAD_PATH;
+  802d0b:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  802d10:	eb f1                	jmp    802d03 <defrag+0x66>
+
+00802d12 <fs_bcstats>:
+
+// Copy the file server's block cache statistics into *st.
+int
+fs_bcstats(struct BcStats *st)
+{
+  802d12:	55                   	push   %ebp
+  802d13:	89 e5                	mov    %esp,%ebp
+  802d15:	53                   	push   %ebx
+  802d16:	83 ec 04             	sub    $0x4,%esp
+  802d19:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if ((r = fsipc(FSREQ_BCSTATS, NULL)) < 0)
+  802d1c:	ba 00 00 00 00       	mov    $0x0,%edx
+  802d21:	b8 11 00 00 00       	mov    $0x11,%eax
+  802d26:	e8 5d f1 ff ff       	call   801e88 <fsipc>
+  802d2b:	85 c0                	test   %eax,%eax
+  802d2d:	78 34                	js     802d63 <fs_bcstats+0x51>
+		return r;
+	*st = fsipcbuf.bcstatsRet;
+  802d2f:	a1 00 70 80 00       	mov    0x807000,%eax
+  802d34:	89 03                	mov    %eax,(%ebx)
+  802d36:	a1 04 70 80 00       	mov    0x807004,%eax
+  802d3b:	89 43 04             	mov    %eax,0x4(%ebx)
+  802d3e:	a1 08 70 80 00       	mov    0x807008,%eax
+  802d43:	89 43 08             	mov    %eax,0x8(%ebx)
+  802d46:	a1 0c 70 80 00       	mov    0x80700c,%eax
+  802d4b:	89 43 0c             	mov    %eax,0xc(%ebx)
+  802d4e:	a1 10 70 80 00       	mov    0x807010,%eax
+  802d53:	89 43 10             	mov    %eax,0x10(%ebx)
+  802d56:	a1 14 70 80 00       	mov    0x807014,%eax
+  802d5b:	89 43 14             	mov    %eax,0x14(%ebx)
+	return 0;
+  802d5e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802d63:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802d66:	c9                   	leave
+  802d67:	c3                   	ret
+
+00802d68 <spawn>:
+// argv: pointer to null-terminated array of pointers to strings,
+// 	 which will be passed to the child as its command-line arguments.
+// Returns child envid on success, < 0 on failure.
+int
+spawn(const char *prog, const char **argv)
+{
+  802d68:	55                   	push   %ebp
+  802d69:	89 e5                	mov    %esp,%ebp
+  802d6b:	57                   	push   %edi
+  802d6c:	56                   	push   %esi
+  802d6d:	53                   	push   %ebx
+  802d6e:	81 ec a4 02 00 00    	sub    $0x2a4,%esp
+	//   - Call sys_env_set_trapframe(child, &child_tf) to set up the
+	//     correct initial eip and esp values in the child.
+	//
+	//   - Start the child process running with sys_env_set_status().
+
+	if ((r = open(prog, O_RDONLY)) < 0)
+  802d74:	6a 00                	push   $0x0
+  802d76:	ff 75 08             	push   0x8(%ebp)
+  802d79:	e8 ee f6 ff ff       	call   80246c <open>
+  802d7e:	89 85 7c fd ff ff    	mov    %eax,-0x284(%ebp)
+  802d84:	83 c4 10             	add    $0x10,%esp
+  802d87:	85 c0                	test   %eax,%eax
+  802d89:	0f 88 39 06 00 00    	js     8033c8 <spawn+0x660>
+  802d8f:	89 c1                	mov    %eax,%ecx
+		return r;
+	fd = r;
+
+	// Read elf header
+	elf = (struct Elf*) elf_buf;
+	if (readn(fd, elf_buf, sizeof(elf_buf)) != sizeof(elf_buf)
+  802d91:	83 ec 04             	sub    $0x4,%esp
+  802d94:	68 00 02 00 00       	push   $0x200
+  802d99:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+  802d9f:	50                   	push   %eax
+  802da0:	51                   	push   %ecx
+  802da1:	e8 97 ec ff ff       	call   801a3d <readn>
+  802da6:	83 c4 10             	add    $0x10,%esp
+  802da9:	3d 00 02 00 00       	cmp    $0x200,%eax
+  802dae:	75 5a                	jne    802e0a <spawn+0xa2>
+	    || elf->e_magic != ELF_MAGIC) {
+  802db0:	81 bd e8 fd ff ff 7f 	cmpl   $0x464c457f,-0x218(%ebp)
+  802db7:	45 4c 46 
+  802dba:	75 4e                	jne    802e0a <spawn+0xa2>
+  802dbc:	b8 07 00 00 00       	mov    $0x7,%eax
+  802dc1:	cd 30                	int    $0x30
+  802dc3:	89 85 8c fd ff ff    	mov    %eax,-0x274(%ebp)
+		cprintf("elf magic %08x want %08x\n", elf->e_magic, ELF_MAGIC);
+		return -E_NOT_EXEC;
+	}
+
+	// Create new child environment
+	if ((r = sys_exofork()) < 0)
+  802dc9:	85 c0                	test   %eax,%eax
+  802dcb:	0f 88 eb 05 00 00    	js     8033bc <spawn+0x654>
+		return r;
+	child = r;
+
+	// Set up trap frame, including initial stack.
+	child_tf = envs[ENVX(child)].env_tf;
+  802dd1:	25 ff 03 00 00       	and    $0x3ff,%eax
+  802dd6:	69 f0 8c 00 00 00    	imul   $0x8c,%eax,%esi
+  802ddc:	81 c6 00 00 c0 ee    	add    $0xeec00000,%esi
+  802de2:	8d bd a4 fd ff ff    	lea    -0x25c(%ebp),%edi
+  802de8:	b9 11 00 00 00       	mov    $0x11,%ecx
+  802ded:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+	child_tf.tf_eip = elf->e_entry;
+  802def:	8b 85 00 fe ff ff    	mov    -0x200(%ebp),%eax
+  802df5:	89 85 d4 fd ff ff    	mov    %eax,-0x22c(%ebp)
+	uintptr_t *argv_store;
+
+	// Count the number of arguments (argc)
+	// and the total amount of space needed for strings (string_size).
+	string_size = 0;
+	for (argc = 0; argv[argc] != 0; argc++)
+  802dfb:	bb 00 00 00 00       	mov    $0x0,%ebx
+	string_size = 0;
+  802e00:	be 00 00 00 00       	mov    $0x0,%esi
+  802e05:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	for (argc = 0; argv[argc] != 0; argc++)
+  802e08:	eb 4b                	jmp    802e55 <spawn+0xed>
+		close(fd);
+  802e0a:	83 ec 0c             	sub    $0xc,%esp
+  802e0d:	ff b5 7c fd ff ff    	push   -0x284(%ebp)
+  802e13:	e8 62 ea ff ff       	call   80187a <close>
+		cprintf("elf magic %08x want %08x\n", elf->e_magic, ELF_MAGIC);
+  802e18:	83 c4 0c             	add    $0xc,%esp
+  802e1b:	68 7f 45 4c 46       	push   $0x464c457f
+  802e20:	ff b5 e8 fd ff ff    	push   -0x218(%ebp)
+  802e26:	68 d1 47 80 00       	push   $0x8047d1
+  802e2b:	e8 93 d7 ff ff       	call   8005c3 <cprintf>
+		return -E_NOT_EXEC;
+  802e30:	83 c4 10             	add    $0x10,%esp
+  802e33:	c7 85 7c fd ff ff f2 	movl   $0xfffffff2,-0x284(%ebp)
+  802e3a:	ff ff ff 
+  802e3d:	e9 86 05 00 00       	jmp    8033c8 <spawn+0x660>
+		string_size += strlen(argv[argc]) + 1;
+  802e42:	83 ec 0c             	sub    $0xc,%esp
+  802e45:	50                   	push   %eax
+  802e46:	e8 2b dd ff ff       	call   800b76 <strlen>
+  802e4b:	8d 74 06 01          	lea    0x1(%esi,%eax,1),%esi
+	for (argc = 0; argv[argc] != 0; argc++)
+  802e4f:	83 c3 01             	add    $0x1,%ebx
+  802e52:	83 c4 10             	add    $0x10,%esp
+  802e55:	8b 04 9f             	mov    (%edi,%ebx,4),%eax
+  802e58:	85 c0                	test   %eax,%eax
+  802e5a:	75 e6                	jne    802e42 <spawn+0xda>
+	// Determine where to place the strings and the argv array.
+	// Set up pointers into the temporary page 'UTEMP'; we'll map a page
+	// there later, then remap that page into the child environment
+	// at (USTACKTOP - PGSIZE).
+	// strings is the topmost thing on the stack.
+	string_store = (char*) UTEMP + PGSIZE - string_size;
+  802e5c:	89 9d 88 fd ff ff    	mov    %ebx,-0x278(%ebp)
+  802e62:	bf 00 10 40 00       	mov    $0x401000,%edi
+  802e67:	29 f7                	sub    %esi,%edi
+	// argv is below that.  There's one argument pointer per argument, plus
+	// a null pointer.
+	argv_store = (uintptr_t*) (ROUNDDOWN(string_store, 4) - 4 * (argc + 1));
+  802e69:	89 fa                	mov    %edi,%edx
+  802e6b:	83 e2 fc             	and    $0xfffffffc,%edx
+  802e6e:	8d 04 9d 04 00 00 00 	lea    0x4(,%ebx,4),%eax
+  802e75:	29 c2                	sub    %eax,%edx
+  802e77:	89 95 94 fd ff ff    	mov    %edx,-0x26c(%ebp)
+
+	// Make sure that argv, strings, and the 2 words that hold 'argc'
+	// and 'argv' themselves will all fit in a single stack page.
+	if ((void*) (argv_store - 2) < (void*) UTEMP)
+  802e7d:	8d 42 f8             	lea    -0x8(%edx),%eax
+  802e80:	3d ff ff 3f 00       	cmp    $0x3fffff,%eax
+  802e85:	0f 86 59 05 00 00    	jbe    8033e4 <spawn+0x67c>
+		return -E_NO_MEM;
+
+	// Allocate the single stack page at UTEMP.
+	if ((r = sys_page_alloc(0, (void*) UTEMP, PTE_P|PTE_U|PTE_W)) < 0)
+  802e8b:	83 ec 04             	sub    $0x4,%esp
+  802e8e:	6a 07                	push   $0x7
+  802e90:	68 00 00 40 00       	push   $0x400000
+  802e95:	6a 00                	push   $0x0
+  802e97:	e8 21 e1 ff ff       	call   800fbd <sys_page_alloc>
+  802e9c:	83 c4 10             	add    $0x10,%esp
+  802e9f:	85 c0                	test   %eax,%eax
+  802ea1:	0f 88 42 05 00 00    	js     8033e9 <spawn+0x681>
+	//	  (Again, argv should use an address valid in the child's
+	//	  environment.)
+	//
+	//	* Set *init_esp to the initial stack pointer for the child,
+	//	  (Again, use an address valid in the child's environment.)
+	for (i = 0; i < argc; i++) {
+  802ea7:	be 00 00 00 00       	mov    $0x0,%esi
+  802eac:	89 9d 90 fd ff ff    	mov    %ebx,-0x270(%ebp)
+  802eb2:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  802eb5:	eb 30                	jmp    802ee7 <spawn+0x17f>
+		argv_store[i] = UTEMP2USTACK(string_store);
+  802eb7:	8d 87 00 d0 7f ee    	lea    -0x11803000(%edi),%eax
+  802ebd:	8b 95 94 fd ff ff    	mov    -0x26c(%ebp),%edx
+  802ec3:	89 04 b2             	mov    %eax,(%edx,%esi,4)
+		strcpy(string_store, argv[i]);
+  802ec6:	83 ec 08             	sub    $0x8,%esp
+  802ec9:	ff 34 b3             	push   (%ebx,%esi,4)
+  802ecc:	57                   	push   %edi
+  802ecd:	e8 df dc ff ff       	call   800bb1 <strcpy>
+		string_store += strlen(argv[i]) + 1;
+  802ed2:	83 c4 04             	add    $0x4,%esp
+  802ed5:	ff 34 b3             	push   (%ebx,%esi,4)
+  802ed8:	e8 99 dc ff ff       	call   800b76 <strlen>
+  802edd:	8d 7c 07 01          	lea    0x1(%edi,%eax,1),%edi
+	for (i = 0; i < argc; i++) {
+  802ee1:	83 c6 01             	add    $0x1,%esi
+  802ee4:	83 c4 10             	add    $0x10,%esp
+  802ee7:	39 b5 90 fd ff ff    	cmp    %esi,-0x270(%ebp)
+  802eed:	7f c8                	jg     802eb7 <spawn+0x14f>
+	}
+	argv_store[argc] = 0;
+  802eef:	8b 85 94 fd ff ff    	mov    -0x26c(%ebp),%eax
+  802ef5:	8b 8d 88 fd ff ff    	mov    -0x278(%ebp),%ecx
+  802efb:	c7 04 88 00 00 00 00 	movl   $0x0,(%eax,%ecx,4)
+	assert(string_store == (char*)UTEMP + PGSIZE);
+  802f02:	81 ff 00 10 40 00    	cmp    $0x401000,%edi
+  802f08:	0f 85 83 00 00 00    	jne    802f91 <spawn+0x229>
+
+	argv_store[-1] = UTEMP2USTACK(argv_store);
+  802f0e:	8b 95 94 fd ff ff    	mov    -0x26c(%ebp),%edx
+  802f14:	8d 82 00 d0 7f ee    	lea    -0x11803000(%edx),%eax
+  802f1a:	89 42 fc             	mov    %eax,-0x4(%edx)
+	argv_store[-2] = argc;
+  802f1d:	89 d0                	mov    %edx,%eax
+  802f1f:	8b 8d 88 fd ff ff    	mov    -0x278(%ebp),%ecx
+  802f25:	89 4a f8             	mov    %ecx,-0x8(%edx)
+
+	*init_esp = UTEMP2USTACK(&argv_store[-2]);
+  802f28:	2d 08 30 80 11       	sub    $0x11803008,%eax
+  802f2d:	89 85 e0 fd ff ff    	mov    %eax,-0x220(%ebp)
+
+	// After completing the stack, map it into the child's address space
+	// and unmap it from ours!
+	if ((r = sys_page_map(0, UTEMP, child, (void*) (USTACKTOP - PGSIZE), PTE_P | PTE_U | PTE_W)) < 0)
+  802f33:	83 ec 0c             	sub    $0xc,%esp
+  802f36:	6a 07                	push   $0x7
+  802f38:	68 00 d0 bf ee       	push   $0xeebfd000
+  802f3d:	ff b5 8c fd ff ff    	push   -0x274(%ebp)
+  802f43:	68 00 00 40 00       	push   $0x400000
+  802f48:	6a 00                	push   $0x0
+  802f4a:	e8 b9 e0 ff ff       	call   801008 <sys_page_map>
+  802f4f:	89 c3                	mov    %eax,%ebx
+  802f51:	83 c4 20             	add    $0x20,%esp
+  802f54:	85 c0                	test   %eax,%eax
+  802f56:	0f 88 95 04 00 00    	js     8033f1 <spawn+0x689>
+		goto error;
+	if ((r = sys_page_unmap(0, UTEMP)) < 0)
+  802f5c:	83 ec 08             	sub    $0x8,%esp
+  802f5f:	68 00 00 40 00       	push   $0x400000
+  802f64:	6a 00                	push   $0x0
+  802f66:	e8 df e0 ff ff       	call   80104a <sys_page_unmap>
+  802f6b:	89 c3                	mov    %eax,%ebx
+  802f6d:	83 c4 10             	add    $0x10,%esp
+  802f70:	85 c0                	test   %eax,%eax
+  802f72:	0f 88 79 04 00 00    	js     8033f1 <spawn+0x689>
+	ph = (struct Proghdr*) (elf_buf + elf->e_phoff);
+  802f78:	8b 85 04 fe ff ff    	mov    -0x1fc(%ebp),%eax
+  802f7e:	8d b4 05 e8 fd ff ff 	lea    -0x218(%ebp,%eax,1),%esi
+	for (i = 0; i < elf->e_phnum; i++, ph++) {
+  802f85:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802f8a:	89 df                	mov    %ebx,%edi
+  802f8c:	e9 7f 02 00 00       	jmp    803210 <spawn+0x4a8>
+	assert(string_store == (char*)UTEMP + PGSIZE);
+  802f91:	68 5c 48 80 00       	push   $0x80485c
+  802f96:	68 ac 46 80 00       	push   $0x8046ac
+  802f9b:	68 f0 00 00 00       	push   $0xf0
+  802fa0:	68 eb 47 80 00       	push   $0x8047eb
+  802fa5:	e8 3e d5 ff ff       	call   8004e8 <_panic>
+
+	for (i = 0; i < memsz; i += n * PGSIZE) {
+		if (i >= filesz) {
+			// allocate a blank page
+			n = 1;
+			if ((r = sys_page_alloc(child, (void*) (va + i), perm)) < 0)
+  802faa:	83 ec 04             	sub    $0x4,%esp
+  802fad:	ff b5 94 fd ff ff    	push   -0x26c(%ebp)
+  802fb3:	8b 85 6c fd ff ff    	mov    -0x294(%ebp),%eax
+  802fb9:	01 f8                	add    %edi,%eax
+  802fbb:	50                   	push   %eax
+  802fbc:	ff b5 8c fd ff ff    	push   -0x274(%ebp)
+  802fc2:	e8 f6 df ff ff       	call   800fbd <sys_page_alloc>
+  802fc7:	83 c4 10             	add    $0x10,%esp
+  802fca:	85 c0                	test   %eax,%eax
+  802fcc:	0f 88 04 04 00 00    	js     8033d6 <spawn+0x66e>
+			n = 1;
+  802fd2:	be 01 00 00 00       	mov    $0x1,%esi
+  802fd7:	e9 99 01 00 00       	jmp    803175 <spawn+0x40d>
+		if (!(perm & PTE_W) && (i + PGSIZE <= filesz || memsz <= filesz)) {
+			// read-only and all from file: map the file server's
+			// cached pages, so that every instance of the program
+			// shares one copy of its text
+			n = (memsz <= filesz ? ROUNDUP(filesz - i, PGSIZE)
+			     : ROUNDDOWN(filesz - i, PGSIZE)) / PGSIZE;
+  802fdc:	8b 85 84 fd ff ff    	mov    -0x27c(%ebp),%eax
+  802fe2:	8b 8d 80 fd ff ff    	mov    -0x280(%ebp),%ecx
+  802fe8:	39 c8                	cmp    %ecx,%eax
+  802fea:	72 70                	jb     80305c <spawn+0x2f4>
+			n = (memsz <= filesz ? ROUNDUP(filesz - i, PGSIZE)
+  802fec:	05 ff 0f 00 00       	add    $0xfff,%eax
+  802ff1:	29 f8                	sub    %edi,%eax
+			     : ROUNDDOWN(filesz - i, PGSIZE)) / PGSIZE;
+  802ff3:	c1 e8 0c             	shr    $0xc,%eax
+			n = MIN(n, FSBULK_MAXPAGES);
+  802ff6:	ba 40 00 00 00       	mov    $0x40,%edx
+  802ffb:	39 d0                	cmp    %edx,%eax
+  802ffd:	0f 4e d0             	cmovle %eax,%edx
+  803000:	89 d6                	mov    %edx,%esi
+			if ((r = mmap(UTEMP, n * PGSIZE, PROT_READ, MAP_SHARED,
+  803002:	83 ec 08             	sub    $0x8,%esp
+  803005:	8b 85 88 fd ff ff    	mov    -0x278(%ebp),%eax
+  80300b:	8b 95 78 fd ff ff    	mov    -0x288(%ebp),%edx
+  803011:	01 d0                	add    %edx,%eax
+  803013:	50                   	push   %eax
+  803014:	ff b5 7c fd ff ff    	push   -0x284(%ebp)
+  80301a:	6a 01                	push   $0x1
+  80301c:	6a 01                	push   $0x1
+  80301e:	89 f0                	mov    %esi,%eax
+  803020:	c1 e0 0c             	shl    $0xc,%eax
+  803023:	50                   	push   %eax
+  803024:	68 00 00 40 00       	push   $0x400000
+  803029:	e8 1c f6 ff ff       	call   80264a <mmap>
+  80302e:	83 c4 20             	add    $0x20,%esp
+  803031:	85 c0                	test   %eax,%eax
+  803033:	78 34                	js     803069 <spawn+0x301>
+			if ((r = seek(fd, fileoffset + i)) < 0)
+				return r;
+			if ((r = readn(fd, UTEMP, MIN(n * PGSIZE, filesz-i))) < 0)
+				return r;
+		}
+		for (j = 0; j < n; j++) {
+  803035:	8d 86 00 04 00 00    	lea    0x400(%esi),%eax
+  80303b:	c1 e0 0c             	shl    $0xc,%eax
+  80303e:	89 85 90 fd ff ff    	mov    %eax,-0x270(%ebp)
+  803044:	bb 00 00 40 00       	mov    $0x400000,%ebx
+			if ((r = sys_page_map(0, UTEMP + j * PGSIZE, child, (void*) (va + i + j * PGSIZE), perm)) < 0)
+  803049:	8b 85 70 fd ff ff    	mov    -0x290(%ebp),%eax
+  80304f:	01 c7                	add    %eax,%edi
+  803051:	89 b5 74 fd ff ff    	mov    %esi,-0x28c(%ebp)
+		for (j = 0; j < n; j++) {
+  803057:	e9 ca 00 00 00       	jmp    803126 <spawn+0x3be>
+			     : ROUNDDOWN(filesz - i, PGSIZE)) / PGSIZE;
+  80305c:	8b 85 84 fd ff ff    	mov    -0x27c(%ebp),%eax
+  803062:	29 f8                	sub    %edi,%eax
+  803064:	c1 e8 0c             	shr    $0xc,%eax
+  803067:	eb 8d                	jmp    802ff6 <spawn+0x28e>
+  803069:	89 c7                	mov    %eax,%edi
+  80306b:	eb 27                	jmp    803094 <spawn+0x32c>
+			for (j = 0; j < n; j++)
+  80306d:	83 c3 01             	add    $0x1,%ebx
+  803070:	39 de                	cmp    %ebx,%esi
+  803072:	7e 4a                	jle    8030be <spawn+0x356>
+				if ((r = sys_page_alloc(0, UTEMP + j * PGSIZE, PTE_P|PTE_U|PTE_W)) < 0)
+  803074:	83 ec 04             	sub    $0x4,%esp
+  803077:	6a 07                	push   $0x7
+  803079:	89 d8                	mov    %ebx,%eax
+  80307b:	c1 e0 0c             	shl    $0xc,%eax
+  80307e:	05 00 00 40 00       	add    $0x400000,%eax
+  803083:	50                   	push   %eax
+  803084:	6a 00                	push   $0x0
+  803086:	e8 32 df ff ff       	call   800fbd <sys_page_alloc>
+  80308b:	83 c4 10             	add    $0x10,%esp
+  80308e:	85 c0                	test   %eax,%eax
+  803090:	79 db                	jns    80306d <spawn+0x305>
+  803092:	89 c7                	mov    %eax,%edi
+	sys_env_destroy(child);
+  803094:	83 ec 0c             	sub    $0xc,%esp
+  803097:	ff b5 8c fd ff ff    	push   -0x274(%ebp)
+  80309d:	e8 8c de ff ff       	call   800f2e <sys_env_destroy>
+	close(fd);
+  8030a2:	83 c4 04             	add    $0x4,%esp
+  8030a5:	ff b5 7c fd ff ff    	push   -0x284(%ebp)
+  8030ab:	e8 ca e7 ff ff       	call   80187a <close>
+	return r;
+  8030b0:	83 c4 10             	add    $0x10,%esp
+  8030b3:	89 bd 7c fd ff ff    	mov    %edi,-0x284(%ebp)
+  8030b9:	e9 0a 03 00 00       	jmp    8033c8 <spawn+0x660>
+			if ((r = seek(fd, fileoffset + i)) < 0)
+  8030be:	83 ec 08             	sub    $0x8,%esp
+  8030c1:	8b 85 88 fd ff ff    	mov    -0x278(%ebp),%eax
+  8030c7:	8b 95 78 fd ff ff    	mov    -0x288(%ebp),%edx
+  8030cd:	01 d0                	add    %edx,%eax
+  8030cf:	50                   	push   %eax
+  8030d0:	8b 9d 7c fd ff ff    	mov    -0x284(%ebp),%ebx
+  8030d6:	53                   	push   %ebx
+  8030d7:	e8 2a ea ff ff       	call   801b06 <seek>
+  8030dc:	83 c4 10             	add    $0x10,%esp
+  8030df:	85 c0                	test   %eax,%eax
+  8030e1:	0f 88 f6 02 00 00    	js     8033dd <spawn+0x675>
+			if ((r = readn(fd, UTEMP, MIN(n * PGSIZE, filesz-i))) < 0)
+  8030e7:	83 ec 04             	sub    $0x4,%esp
+  8030ea:	89 f0                	mov    %esi,%eax
+  8030ec:	c1 e0 0c             	shl    $0xc,%eax
+  8030ef:	8b 8d 90 fd ff ff    	mov    -0x270(%ebp),%ecx
+  8030f5:	39 c8                	cmp    %ecx,%eax
+  8030f7:	0f 47 c1             	cmova  %ecx,%eax
+  8030fa:	50                   	push   %eax
+  8030fb:	68 00 00 40 00       	push   $0x400000
+  803100:	53                   	push   %ebx
+  803101:	e8 37 e9 ff ff       	call   801a3d <readn>
+  803106:	83 c4 10             	add    $0x10,%esp
+  803109:	85 c0                	test   %eax,%eax
+  80310b:	0f 89 24 ff ff ff    	jns    803035 <spawn+0x2cd>
+  803111:	89 c7                	mov    %eax,%edi
+  803113:	e9 7c ff ff ff       	jmp    803094 <spawn+0x32c>
+				panic("spawn: sys_page_map data: %e", r);
+			sys_page_unmap(0, UTEMP + j * PGSIZE);
+  803118:	83 ec 08             	sub    $0x8,%esp
+  80311b:	56                   	push   %esi
+  80311c:	6a 00                	push   $0x0
+  80311e:	e8 27 df ff ff       	call   80104a <sys_page_unmap>
+  803123:	83 c4 10             	add    $0x10,%esp
+		for (j = 0; j < n; j++) {
+  803126:	8b 85 90 fd ff ff    	mov    -0x270(%ebp),%eax
+  80312c:	39 c3                	cmp    %eax,%ebx
+  80312e:	74 3f                	je     80316f <spawn+0x407>
+			if ((r = sys_page_map(0, UTEMP + j * PGSIZE, child, (void*) (va + i + j * PGSIZE), perm)) < 0)
+  803130:	89 de                	mov    %ebx,%esi
+  803132:	83 ec 0c             	sub    $0xc,%esp
+  803135:	ff b5 94 fd ff ff    	push   -0x26c(%ebp)
+  80313b:	8d 04 1f             	lea    (%edi,%ebx,1),%eax
+  80313e:	50                   	push   %eax
+  80313f:	ff b5 8c fd ff ff    	push   -0x274(%ebp)
+  803145:	53                   	push   %ebx
+  803146:	6a 00                	push   $0x0
+  803148:	e8 bb de ff ff       	call   801008 <sys_page_map>
+  80314d:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  803153:	83 c4 20             	add    $0x20,%esp
+  803156:	85 c0                	test   %eax,%eax
+  803158:	79 be                	jns    803118 <spawn+0x3b0>
+				panic("spawn: sys_page_map data: %e", r);
+  80315a:	50                   	push   %eax
+  80315b:	68 f7 47 80 00       	push   $0x8047f7
+  803160:	68 36 01 00 00       	push   $0x136
+  803165:	68 eb 47 80 00       	push   $0x8047eb
+  80316a:	e8 79 d3 ff ff       	call   8004e8 <_panic>
+  80316f:	8b b5 74 fd ff ff    	mov    -0x28c(%ebp),%esi
+	for (i = 0; i < memsz; i += n * PGSIZE) {
+  803175:	c1 e6 0c             	shl    $0xc,%esi
+  803178:	01 b5 88 fd ff ff    	add    %esi,-0x278(%ebp)
+  80317e:	8b 85 88 fd ff ff    	mov    -0x278(%ebp),%eax
+  803184:	89 c7                	mov    %eax,%edi
+  803186:	8b 8d 80 fd ff ff    	mov    -0x280(%ebp),%ecx
+  80318c:	39 c8                	cmp    %ecx,%eax
+  80318e:	73 6e                	jae    8031fe <spawn+0x496>
+		if (i >= filesz) {
+  803190:	8b 8d 84 fd ff ff    	mov    -0x27c(%ebp),%ecx
+  803196:	39 8d 88 fd ff ff    	cmp    %ecx,-0x278(%ebp)
+  80319c:	0f 83 08 fe ff ff    	jae    802faa <spawn+0x242>
+		if (!(perm & PTE_W) && (i + PGSIZE <= filesz || memsz <= filesz)) {
+  8031a2:	f6 85 94 fd ff ff 02 	testb  $0x2,-0x26c(%ebp)
+  8031a9:	75 27                	jne    8031d2 <spawn+0x46a>
+  8031ab:	8b 85 88 fd ff ff    	mov    -0x278(%ebp),%eax
+  8031b1:	05 00 10 00 00       	add    $0x1000,%eax
+  8031b6:	8b 95 84 fd ff ff    	mov    -0x27c(%ebp),%edx
+  8031bc:	39 c2                	cmp    %eax,%edx
+  8031be:	0f 83 18 fe ff ff    	jae    802fdc <spawn+0x274>
+  8031c4:	8b 85 80 fd ff ff    	mov    -0x280(%ebp),%eax
+  8031ca:	39 c2                	cmp    %eax,%edx
+  8031cc:	0f 83 0a fe ff ff    	jae    802fdc <spawn+0x274>
+			n = MIN(FSBULK_MAXPAGES, ROUNDUP(filesz - i, PGSIZE) / PGSIZE);
+  8031d2:	8b 85 84 fd ff ff    	mov    -0x27c(%ebp),%eax
+  8031d8:	29 f8                	sub    %edi,%eax
+  8031da:	89 85 90 fd ff ff    	mov    %eax,-0x270(%ebp)
+  8031e0:	05 ff 0f 00 00       	add    $0xfff,%eax
+  8031e5:	c1 e8 0c             	shr    $0xc,%eax
+  8031e8:	89 c6                	mov    %eax,%esi
+  8031ea:	b8 40 00 00 00       	mov    $0x40,%eax
+  8031ef:	39 c6                	cmp    %eax,%esi
+  8031f1:	0f 47 f0             	cmova  %eax,%esi
+			for (j = 0; j < n; j++)
+  8031f4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8031f9:	e9 72 fe ff ff       	jmp    803070 <spawn+0x308>
+  8031fe:	8b bd 68 fd ff ff    	mov    -0x298(%ebp),%edi
+  803204:	8b b5 64 fd ff ff    	mov    -0x29c(%ebp),%esi
+	for (i = 0; i < elf->e_phnum; i++, ph++) {
+  80320a:	83 c7 01             	add    $0x1,%edi
+  80320d:	83 c6 20             	add    $0x20,%esi
+  803210:	0f b7 85 14 fe ff ff 	movzwl -0x1ec(%ebp),%eax
+  803217:	39 f8                	cmp    %edi,%eax
+  803219:	0f 8e 88 00 00 00    	jle    8032a7 <spawn+0x53f>
+		if (ph->p_type != ELF_PROG_LOAD)
+  80321f:	83 3e 01             	cmpl   $0x1,(%esi)
+  803222:	75 e6                	jne    80320a <spawn+0x4a2>
+		if (ph->p_flags & ELF_PROG_FLAG_WRITE)
+  803224:	8b 46 18             	mov    0x18(%esi),%eax
+  803227:	83 e0 02             	and    $0x2,%eax
+		perm = PTE_P | PTE_U;
+  80322a:	83 f8 01             	cmp    $0x1,%eax
+  80322d:	19 c0                	sbb    %eax,%eax
+  80322f:	83 e0 fe             	and    $0xfffffffe,%eax
+  803232:	83 c0 07             	add    $0x7,%eax
+  803235:	89 85 94 fd ff ff    	mov    %eax,-0x26c(%ebp)
+		if ((r = map_segment(child, ph->p_va, ph->p_memsz,
+  80323b:	8b 4e 04             	mov    0x4(%esi),%ecx
+  80323e:	89 8d 78 fd ff ff    	mov    %ecx,-0x288(%ebp)
+  803244:	8b 5e 10             	mov    0x10(%esi),%ebx
+  803247:	89 9d 84 fd ff ff    	mov    %ebx,-0x27c(%ebp)
+  80324d:	8b 46 14             	mov    0x14(%esi),%eax
+  803250:	89 85 80 fd ff ff    	mov    %eax,-0x280(%ebp)
+  803256:	8b 56 08             	mov    0x8(%esi),%edx
+	if ((i = PGOFF(va))) {
+  803259:	89 d0                	mov    %edx,%eax
+  80325b:	25 ff 0f 00 00       	and    $0xfff,%eax
+  803260:	74 18                	je     80327a <spawn+0x512>
+		va -= i;
+  803262:	29 c2                	sub    %eax,%edx
+		memsz += i;
+  803264:	01 85 80 fd ff ff    	add    %eax,-0x280(%ebp)
+		filesz += i;
+  80326a:	01 c3                	add    %eax,%ebx
+  80326c:	89 9d 84 fd ff ff    	mov    %ebx,-0x27c(%ebp)
+		fileoffset -= i;
+  803272:	29 c1                	sub    %eax,%ecx
+  803274:	89 8d 78 fd ff ff    	mov    %ecx,-0x288(%ebp)
+	for (i = 0; i < memsz; i += n * PGSIZE) {
+  80327a:	c7 85 88 fd ff ff 00 	movl   $0x0,-0x278(%ebp)
+  803281:	00 00 00 
+			if ((r = sys_page_map(0, UTEMP + j * PGSIZE, child, (void*) (va + i + j * PGSIZE), perm)) < 0)
+  803284:	8d 82 00 00 c0 ff    	lea    -0x400000(%edx),%eax
+  80328a:	89 85 70 fd ff ff    	mov    %eax,-0x290(%ebp)
+  803290:	89 95 6c fd ff ff    	mov    %edx,-0x294(%ebp)
+  803296:	89 bd 68 fd ff ff    	mov    %edi,-0x298(%ebp)
+  80329c:	89 b5 64 fd ff ff    	mov    %esi,-0x29c(%ebp)
+	for (i = 0; i < memsz; i += n * PGSIZE) {
+  8032a2:	e9 d7 fe ff ff       	jmp    80317e <spawn+0x416>
+	close(fd);
+  8032a7:	83 ec 0c             	sub    $0xc,%esp
+  8032aa:	ff b5 7c fd ff ff    	push   -0x284(%ebp)
+  8032b0:	e8 c5 e5 ff ff       	call   80187a <close>
+  8032b5:	83 c4 10             	add    $0x10,%esp
+// Copy the mappings for shared pages into the child address space.
+static int
+copy_shared_pages(envid_t child)
+{
+	// LAB 5: Your code here.
+	int r = 0;
+  8032b8:	ba 00 00 00 00       	mov    $0x0,%edx
+
+	for (uintptr_t va = 0; va < UTOP; va += PGSIZE) {
+  8032bd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8032c2:	8b b5 8c fd ff ff    	mov    -0x274(%ebp),%esi
+  8032c8:	eb 14                	jmp    8032de <spawn+0x576>
+		if (!(uvpd[PDX(va)] & PTE_P)) {
+			va += PTSIZE - PGSIZE;
+  8032ca:	81 c3 00 f0 3f 00    	add    $0x3ff000,%ebx
+	for (uintptr_t va = 0; va < UTOP; va += PGSIZE) {
+  8032d0:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8032d6:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  8032dc:	77 65                	ja     803343 <spawn+0x5db>
+		if (!(uvpd[PDX(va)] & PTE_P)) {
+  8032de:	89 d8                	mov    %ebx,%eax
+  8032e0:	c1 e8 16             	shr    $0x16,%eax
+  8032e3:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8032ea:	a8 01                	test   $0x1,%al
+  8032ec:	74 dc                	je     8032ca <spawn+0x562>
+			continue;
+		}
+		if (!(uvpt[PGNUM(va)] & PTE_P) || !(uvpt[PGNUM(va)] & PTE_SHARE))
+  8032ee:	89 d8                	mov    %ebx,%eax
+  8032f0:	c1 e8 0c             	shr    $0xc,%eax
+  8032f3:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  8032fa:	f6 c1 01             	test   $0x1,%cl
+  8032fd:	74 d1                	je     8032d0 <spawn+0x568>
+  8032ff:	8b 0c 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%ecx
+  803306:	f6 c5 04             	test   $0x4,%ch
+  803309:	74 c5                	je     8032d0 <spawn+0x568>
+			continue;
+		r = sys_page_map(0, (void *) va, child, (void *) va,
+				 uvpt[PGNUM(va)] & PTE_SYSCALL);
+  80330b:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+		r = sys_page_map(0, (void *) va, child, (void *) va,
+  803312:	83 ec 0c             	sub    $0xc,%esp
+  803315:	25 07 0e 00 00       	and    $0xe07,%eax
+  80331a:	50                   	push   %eax
+  80331b:	53                   	push   %ebx
+  80331c:	56                   	push   %esi
+  80331d:	53                   	push   %ebx
+  80331e:	6a 00                	push   $0x0
+  803320:	e8 e3 dc ff ff       	call   801008 <sys_page_map>
+  803325:	89 c2                	mov    %eax,%edx
+		if (r < 0)
+  803327:	83 c4 20             	add    $0x20,%esp
+  80332a:	85 c0                	test   %eax,%eax
+  80332c:	79 a2                	jns    8032d0 <spawn+0x568>
+		panic("copy_shared_pages: %e", r);
+  80332e:	52                   	push   %edx
+  80332f:	68 14 48 80 00       	push   $0x804814
+  803334:	68 80 00 00 00       	push   $0x80
+  803339:	68 eb 47 80 00       	push   $0x8047eb
+  80333e:	e8 a5 d1 ff ff       	call   8004e8 <_panic>
+	if ((r = copy_shared_pages(child)) < 0)
+  803343:	85 d2                	test   %edx,%edx
+  803345:	78 e7                	js     80332e <spawn+0x5c6>
+	child_tf.tf_eflags |= FL_IOPL_3;   // devious: see user/faultio.c
+  803347:	81 8d dc fd ff ff 00 	orl    $0x3000,-0x224(%ebp)
+  80334e:	30 00 00 
+	if ((r = sys_env_set_trapframe(child, &child_tf)) < 0)
+  803351:	83 ec 08             	sub    $0x8,%esp
+  803354:	8d 85 a4 fd ff ff    	lea    -0x25c(%ebp),%eax
+  80335a:	50                   	push   %eax
+  80335b:	ff b5 8c fd ff ff    	push   -0x274(%ebp)
+  803361:	e8 78 dd ff ff       	call   8010de <sys_env_set_trapframe>
+  803366:	83 c4 10             	add    $0x10,%esp
+  803369:	85 c0                	test   %eax,%eax
+  80336b:	78 25                	js     803392 <spawn+0x62a>
+	if ((r = sys_env_set_status(child, ENV_RUNNABLE)) < 0)
+  80336d:	83 ec 08             	sub    $0x8,%esp
+  803370:	6a 02                	push   $0x2
+  803372:	ff b5 8c fd ff ff    	push   -0x274(%ebp)
+  803378:	e8 17 dd ff ff       	call   801094 <sys_env_set_status>
+  80337d:	83 c4 10             	add    $0x10,%esp
+  803380:	85 c0                	test   %eax,%eax
+  803382:	78 23                	js     8033a7 <spawn+0x63f>
+	return child;
+  803384:	8b 85 8c fd ff ff    	mov    -0x274(%ebp),%eax
+  80338a:	89 85 7c fd ff ff    	mov    %eax,-0x284(%ebp)
+  803390:	eb 36                	jmp    8033c8 <spawn+0x660>
+		panic("sys_env_set_trapframe: %e", r);
+  803392:	50                   	push   %eax
+  803393:	68 2a 48 80 00       	push   $0x80482a
+  803398:	68 84 00 00 00       	push   $0x84
+  80339d:	68 eb 47 80 00       	push   $0x8047eb
+  8033a2:	e8 41 d1 ff ff       	call   8004e8 <_panic>
+		panic("sys_env_set_status: %e", r);
+  8033a7:	50                   	push   %eax
+  8033a8:	68 44 48 80 00       	push   $0x804844
+  8033ad:	68 87 00 00 00       	push   $0x87
+  8033b2:	68 eb 47 80 00       	push   $0x8047eb
+  8033b7:	e8 2c d1 ff ff       	call   8004e8 <_panic>
+		return r;
+  8033bc:	8b 85 8c fd ff ff    	mov    -0x274(%ebp),%eax
+  8033c2:	89 85 7c fd ff ff    	mov    %eax,-0x284(%ebp)
+}
+  8033c8:	8b 85 7c fd ff ff    	mov    -0x284(%ebp),%eax
+  8033ce:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8033d1:	5b                   	pop    %ebx
+  8033d2:	5e                   	pop    %esi
+  8033d3:	5f                   	pop    %edi
+  8033d4:	5d                   	pop    %ebp
+  8033d5:	c3                   	ret
+  8033d6:	89 c7                	mov    %eax,%edi
+  8033d8:	e9 b7 fc ff ff       	jmp    803094 <spawn+0x32c>
+  8033dd:	89 c7                	mov    %eax,%edi
+  8033df:	e9 b0 fc ff ff       	jmp    803094 <spawn+0x32c>
+		return -E_NO_MEM;
+  8033e4:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+	return r;
+  8033e9:	89 85 7c fd ff ff    	mov    %eax,-0x284(%ebp)
+  8033ef:	eb d7                	jmp    8033c8 <spawn+0x660>
+	sys_page_unmap(0, UTEMP);
+  8033f1:	83 ec 08             	sub    $0x8,%esp
+  8033f4:	68 00 00 40 00       	push   $0x400000
+  8033f9:	6a 00                	push   $0x0
+  8033fb:	e8 4a dc ff ff       	call   80104a <sys_page_unmap>
+  803400:	83 c4 10             	add    $0x10,%esp
+  803403:	89 9d 7c fd ff ff    	mov    %ebx,-0x284(%ebp)
+  803409:	eb bd                	jmp    8033c8 <spawn+0x660>
+
+0080340b <spawnl>:
+{
+  80340b:	55                   	push   %ebp
+  80340c:	89 e5                	mov    %esp,%ebp
+  80340e:	56                   	push   %esi
+  80340f:	53                   	push   %ebx
+	va_start(vl, arg0);
+  803410:	8d 55 10             	lea    0x10(%ebp),%edx
+	int argc=0;
+  803413:	b8 00 00 00 00       	mov    $0x0,%eax
+	while(va_arg(vl, void *) != NULL)
+  803418:	eb 05                	jmp    80341f <spawnl+0x14>
+		argc++;
+  80341a:	83 c0 01             	add    $0x1,%eax
+	while(va_arg(vl, void *) != NULL)
+  80341d:	89 ca                	mov    %ecx,%edx
+  80341f:	8d 4a 04             	lea    0x4(%edx),%ecx
+  803422:	83 3a 00             	cmpl   $0x0,(%edx)
+  803425:	75 f3                	jne    80341a <spawnl+0xf>
+	const char *argv[argc+2];
+  803427:	8d 14 85 17 00 00 00 	lea    0x17(,%eax,4),%edx
+  80342e:	83 e2 f0             	and    $0xfffffff0,%edx
+  803431:	29 d4                	sub    %edx,%esp
+  803433:	8d 5c 24 03          	lea    0x3(%esp),%ebx
+  803437:	89 da                	mov    %ebx,%edx
+  803439:	c1 ea 02             	shr    $0x2,%edx
+  80343c:	83 e3 fc             	and    $0xfffffffc,%ebx
+	argv[0] = arg0;
+  80343f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  803442:	89 0c 95 00 00 00 00 	mov    %ecx,0x0(,%edx,4)
+	argv[argc+1] = NULL;
+  803449:	c7 44 83 04 00 00 00 	movl   $0x0,0x4(%ebx,%eax,4)
+  803450:	00 
+	va_start(vl, arg0);
+  803451:	8d 4d 10             	lea    0x10(%ebp),%ecx
+	for(i=0;i<argc;i++)
+  803454:	89 c2                	mov    %eax,%edx
+  803456:	b8 00 00 00 00       	mov    $0x0,%eax
+  80345b:	eb 0b                	jmp    803468 <spawnl+0x5d>
+		argv[i+1] = va_arg(vl, const char *);
+  80345d:	83 c0 01             	add    $0x1,%eax
+  803460:	8b 31                	mov    (%ecx),%esi
+  803462:	89 34 83             	mov    %esi,(%ebx,%eax,4)
+  803465:	8d 49 04             	lea    0x4(%ecx),%ecx
+	for(i=0;i<argc;i++)
+  803468:	39 d0                	cmp    %edx,%eax
+  80346a:	75 f1                	jne    80345d <spawnl+0x52>
+	return spawn(prog, argv);
+  80346c:	83 ec 08             	sub    $0x8,%esp
+  80346f:	53                   	push   %ebx
+  803470:	ff 75 08             	push   0x8(%ebp)
+  803473:	e8 f0 f8 ff ff       	call   802d68 <spawn>
+}
+  803478:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80347b:	5b                   	pop    %ebx
+  80347c:	5e                   	pop    %esi
+  80347d:	5d                   	pop    %ebp
+  80347e:	c3                   	ret
+
+0080347f <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  80347f:	55                   	push   %ebp
+  803480:	89 e5                	mov    %esp,%ebp
+  803482:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  803485:	68 82 48 80 00       	push   $0x804882
+  80348a:	ff 75 0c             	push   0xc(%ebp)
+  80348d:	e8 1f d7 ff ff       	call   800bb1 <strcpy>
+	return 0;
+}
+  803492:	b8 00 00 00 00       	mov    $0x0,%eax
+  803497:	c9                   	leave
+  803498:	c3                   	ret
+
+00803499 <devsock_close>:
+{
+  803499:	55                   	push   %ebp
+  80349a:	89 e5                	mov    %esp,%ebp
+  80349c:	53                   	push   %ebx
+  80349d:	83 ec 10             	sub    $0x10,%esp
+  8034a0:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  8034a3:	53                   	push   %ebx
+  8034a4:	e8 56 0a 00 00       	call   803eff <pageref>
+  8034a9:	89 c2                	mov    %eax,%edx
+  8034ab:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  8034ae:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  8034b3:	83 fa 01             	cmp    $0x1,%edx
+  8034b6:	74 05                	je     8034bd <devsock_close+0x24>
+}
+  8034b8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8034bb:	c9                   	leave
+  8034bc:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  8034bd:	83 ec 0c             	sub    $0xc,%esp
+  8034c0:	ff 73 0c             	push   0xc(%ebx)
+  8034c3:	e8 b7 02 00 00       	call   80377f <nsipc_close>
+  8034c8:	83 c4 10             	add    $0x10,%esp
+  8034cb:	eb eb                	jmp    8034b8 <devsock_close+0x1f>
+
+008034cd <devsock_write>:
+{
+  8034cd:	55                   	push   %ebp
+  8034ce:	89 e5                	mov    %esp,%ebp
+  8034d0:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  8034d3:	6a 00                	push   $0x0
+  8034d5:	ff 75 10             	push   0x10(%ebp)
+  8034d8:	ff 75 0c             	push   0xc(%ebp)
+  8034db:	8b 45 08             	mov    0x8(%ebp),%eax
+  8034de:	ff 70 0c             	push   0xc(%eax)
+  8034e1:	e8 79 03 00 00       	call   80385f <nsipc_send>
+}
+  8034e6:	c9                   	leave
+  8034e7:	c3                   	ret
+
+008034e8 <devsock_read>:
+{
+  8034e8:	55                   	push   %ebp
+  8034e9:	89 e5                	mov    %esp,%ebp
+  8034eb:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  8034ee:	6a 00                	push   $0x0
+  8034f0:	ff 75 10             	push   0x10(%ebp)
+  8034f3:	ff 75 0c             	push   0xc(%ebp)
+  8034f6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8034f9:	ff 70 0c             	push   0xc(%eax)
+  8034fc:	e8 ef 02 00 00       	call   8037f0 <nsipc_recv>
+}
+  803501:	c9                   	leave
+  803502:	c3                   	ret
+
+00803503 <fd2sockid>:
+{
+  803503:	55                   	push   %ebp
+  803504:	89 e5                	mov    %esp,%ebp
+  803506:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  803509:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  80350c:	52                   	push   %edx
+  80350d:	50                   	push   %eax
+  80350e:	e8 3d e2 ff ff       	call   801750 <fd_lookup>
+  803513:	83 c4 10             	add    $0x10,%esp
+  803516:	85 c0                	test   %eax,%eax
+  803518:	78 10                	js     80352a <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  80351a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80351d:	8b 0d 60 50 80 00    	mov    0x805060,%ecx
+  803523:	39 08                	cmp    %ecx,(%eax)
+  803525:	75 05                	jne    80352c <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  803527:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  80352a:	c9                   	leave
+  80352b:	c3                   	ret
+		return -E_NOT_SUPP;
+  80352c:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  803531:	eb f7                	jmp    80352a <fd2sockid+0x27>
+
+00803533 <alloc_sockfd>:
+{
+  803533:	55                   	push   %ebp
+  803534:	89 e5                	mov    %esp,%ebp
+  803536:	56                   	push   %esi
+  803537:	53                   	push   %ebx
+  803538:	83 ec 1c             	sub    $0x1c,%esp
+  80353b:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  80353d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803540:	50                   	push   %eax
+  803541:	e8 b4 e1 ff ff       	call   8016fa <fd_alloc>
+  803546:	89 c3                	mov    %eax,%ebx
+  803548:	83 c4 10             	add    $0x10,%esp
+  80354b:	85 c0                	test   %eax,%eax
+  80354d:	78 43                	js     803592 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  80354f:	83 ec 04             	sub    $0x4,%esp
+  803552:	68 07 04 00 00       	push   $0x407
+  803557:	ff 75 f4             	push   -0xc(%ebp)
+  80355a:	6a 00                	push   $0x0
+  80355c:	e8 5c da ff ff       	call   800fbd <sys_page_alloc>
+  803561:	89 c3                	mov    %eax,%ebx
+  803563:	83 c4 10             	add    $0x10,%esp
+  803566:	85 c0                	test   %eax,%eax
+  803568:	78 28                	js     803592 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  80356a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80356d:	8b 15 60 50 80 00    	mov    0x805060,%edx
+  803573:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  803575:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803578:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  80357f:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  803582:	83 ec 0c             	sub    $0xc,%esp
+  803585:	50                   	push   %eax
+  803586:	e8 48 e1 ff ff       	call   8016d3 <fd2num>
+  80358b:	89 c3                	mov    %eax,%ebx
+  80358d:	83 c4 10             	add    $0x10,%esp
+  803590:	eb 0c                	jmp    80359e <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  803592:	83 ec 0c             	sub    $0xc,%esp
+  803595:	56                   	push   %esi
+  803596:	e8 e4 01 00 00       	call   80377f <nsipc_close>
+		return r;
+  80359b:	83 c4 10             	add    $0x10,%esp
+}
+  80359e:	89 d8                	mov    %ebx,%eax
+  8035a0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8035a3:	5b                   	pop    %ebx
+  8035a4:	5e                   	pop    %esi
+  8035a5:	5d                   	pop    %ebp
+  8035a6:	c3                   	ret
+
+008035a7 <accept>:
+{
+  8035a7:	55                   	push   %ebp
+  8035a8:	89 e5                	mov    %esp,%ebp
+  8035aa:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8035ad:	8b 45 08             	mov    0x8(%ebp),%eax
+  8035b0:	e8 4e ff ff ff       	call   803503 <fd2sockid>
+  8035b5:	85 c0                	test   %eax,%eax
+  8035b7:	78 1b                	js     8035d4 <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  8035b9:	83 ec 04             	sub    $0x4,%esp
+  8035bc:	ff 75 10             	push   0x10(%ebp)
+  8035bf:	ff 75 0c             	push   0xc(%ebp)
+  8035c2:	50                   	push   %eax
+  8035c3:	e8 0e 01 00 00       	call   8036d6 <nsipc_accept>
+  8035c8:	83 c4 10             	add    $0x10,%esp
+  8035cb:	85 c0                	test   %eax,%eax
+  8035cd:	78 05                	js     8035d4 <accept+0x2d>
+	return alloc_sockfd(r);
+  8035cf:	e8 5f ff ff ff       	call   803533 <alloc_sockfd>
+}
+  8035d4:	c9                   	leave
+  8035d5:	c3                   	ret
+
+008035d6 <bind>:
+{
+  8035d6:	55                   	push   %ebp
+  8035d7:	89 e5                	mov    %esp,%ebp
+  8035d9:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8035dc:	8b 45 08             	mov    0x8(%ebp),%eax
+  8035df:	e8 1f ff ff ff       	call   803503 <fd2sockid>
+  8035e4:	85 c0                	test   %eax,%eax
+  8035e6:	78 12                	js     8035fa <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  8035e8:	83 ec 04             	sub    $0x4,%esp
+  8035eb:	ff 75 10             	push   0x10(%ebp)
+  8035ee:	ff 75 0c             	push   0xc(%ebp)
+  8035f1:	50                   	push   %eax
+  8035f2:	e8 31 01 00 00       	call   803728 <nsipc_bind>
+  8035f7:	83 c4 10             	add    $0x10,%esp
+}
+  8035fa:	c9                   	leave
+  8035fb:	c3                   	ret
+
+008035fc <shutdown>:
+{
+  8035fc:	55                   	push   %ebp
+  8035fd:	89 e5                	mov    %esp,%ebp
+  8035ff:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  803602:	8b 45 08             	mov    0x8(%ebp),%eax
+  803605:	e8 f9 fe ff ff       	call   803503 <fd2sockid>
+  80360a:	85 c0                	test   %eax,%eax
+  80360c:	78 0f                	js     80361d <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  80360e:	83 ec 08             	sub    $0x8,%esp
+  803611:	ff 75 0c             	push   0xc(%ebp)
+  803614:	50                   	push   %eax
+  803615:	e8 43 01 00 00       	call   80375d <nsipc_shutdown>
+  80361a:	83 c4 10             	add    $0x10,%esp
+}
+  80361d:	c9                   	leave
+  80361e:	c3                   	ret
+
+0080361f <connect>:
+{
+  80361f:	55                   	push   %ebp
+  803620:	89 e5                	mov    %esp,%ebp
+  803622:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  803625:	8b 45 08             	mov    0x8(%ebp),%eax
+  803628:	e8 d6 fe ff ff       	call   803503 <fd2sockid>
+  80362d:	85 c0                	test   %eax,%eax
+  80362f:	78 12                	js     803643 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  803631:	83 ec 04             	sub    $0x4,%esp
+  803634:	ff 75 10             	push   0x10(%ebp)
+  803637:	ff 75 0c             	push   0xc(%ebp)
+  80363a:	50                   	push   %eax
+  80363b:	e8 59 01 00 00       	call   803799 <nsipc_connect>
+  803640:	83 c4 10             	add    $0x10,%esp
+}
+  803643:	c9                   	leave
+  803644:	c3                   	ret
+
+00803645 <listen>:
+{
+  803645:	55                   	push   %ebp
+  803646:	89 e5                	mov    %esp,%ebp
+  803648:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  80364b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80364e:	e8 b0 fe ff ff       	call   803503 <fd2sockid>
+  803653:	85 c0                	test   %eax,%eax
+  803655:	78 0f                	js     803666 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  803657:	83 ec 08             	sub    $0x8,%esp
+  80365a:	ff 75 0c             	push   0xc(%ebp)
+  80365d:	50                   	push   %eax
+  80365e:	e8 6b 01 00 00       	call   8037ce <nsipc_listen>
+  803663:	83 c4 10             	add    $0x10,%esp
+}
+  803666:	c9                   	leave
+  803667:	c3                   	ret
+
+00803668 <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  803668:	55                   	push   %ebp
+  803669:	89 e5                	mov    %esp,%ebp
+  80366b:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  80366e:	ff 75 10             	push   0x10(%ebp)
+  803671:	ff 75 0c             	push   0xc(%ebp)
+  803674:	ff 75 08             	push   0x8(%ebp)
+  803677:	e8 41 02 00 00       	call   8038bd <nsipc_socket>
+  80367c:	83 c4 10             	add    $0x10,%esp
+  80367f:	85 c0                	test   %eax,%eax
+  803681:	78 05                	js     803688 <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  803683:	e8 ab fe ff ff       	call   803533 <alloc_sockfd>
+}
+  803688:	c9                   	leave
+  803689:	c3                   	ret
+
+0080368a <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  80368a:	55                   	push   %ebp
+  80368b:	89 e5                	mov    %esp,%ebp
+  80368d:	53                   	push   %ebx
+  80368e:	83 ec 04             	sub    $0x4,%esp
+  803691:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  803693:	83 3d 00 a0 80 00 00 	cmpl   $0x0,0x80a000
+  80369a:	74 26                	je     8036c2 <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  80369c:	6a 07                	push   $0x7
+  80369e:	68 00 90 80 00       	push   $0x809000
+  8036a3:	53                   	push   %ebx
+  8036a4:	ff 35 00 a0 80 00    	push   0x80a000
+  8036aa:	e8 d8 06 00 00       	call   803d87 <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  8036af:	83 c4 0c             	add    $0xc,%esp
+  8036b2:	6a 00                	push   $0x0
+  8036b4:	6a 00                	push   $0x0
+  8036b6:	6a 00                	push   $0x0
+  8036b8:	e8 5f 06 00 00       	call   803d1c <ipc_recv>
+}
+  8036bd:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8036c0:	c9                   	leave
+  8036c1:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  8036c2:	83 ec 0c             	sub    $0xc,%esp
+  8036c5:	6a 02                	push   $0x2
+  8036c7:	e8 f4 07 00 00       	call   803ec0 <ipc_find_env>
+  8036cc:	a3 00 a0 80 00       	mov    %eax,0x80a000
+  8036d1:	83 c4 10             	add    $0x10,%esp
+  8036d4:	eb c6                	jmp    80369c <nsipc+0x12>
+
+008036d6 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  8036d6:	55                   	push   %ebp
+  8036d7:	89 e5                	mov    %esp,%ebp
+  8036d9:	56                   	push   %esi
+  8036da:	53                   	push   %ebx
+  8036db:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  8036de:	8b 45 08             	mov    0x8(%ebp),%eax
+  8036e1:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  8036e6:	8b 06                	mov    (%esi),%eax
+  8036e8:	a3 04 90 80 00       	mov    %eax,0x809004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  8036ed:	b8 01 00 00 00       	mov    $0x1,%eax
+  8036f2:	e8 93 ff ff ff       	call   80368a <nsipc>
+  8036f7:	89 c3                	mov    %eax,%ebx
+  8036f9:	85 c0                	test   %eax,%eax
+  8036fb:	79 09                	jns    803706 <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  8036fd:	89 d8                	mov    %ebx,%eax
+  8036ff:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803702:	5b                   	pop    %ebx
+  803703:	5e                   	pop    %esi
+  803704:	5d                   	pop    %ebp
+  803705:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  803706:	83 ec 04             	sub    $0x4,%esp
+  803709:	ff 35 10 90 80 00    	push   0x809010
+  80370f:	68 00 90 80 00       	push   $0x809000
+  803714:	ff 75 0c             	push   0xc(%ebp)
+  803717:	e8 1b d6 ff ff       	call   800d37 <memmove>
+		*addrlen = ret->ret_addrlen;
+  80371c:	a1 10 90 80 00       	mov    0x809010,%eax
+  803721:	89 06                	mov    %eax,(%esi)
+  803723:	83 c4 10             	add    $0x10,%esp
+	return r;
+  803726:	eb d5                	jmp    8036fd <nsipc_accept+0x27>
+
+00803728 <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  803728:	55                   	push   %ebp
+  803729:	89 e5                	mov    %esp,%ebp
+  80372b:	53                   	push   %ebx
+  80372c:	83 ec 08             	sub    $0x8,%esp
+  80372f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  803732:	8b 45 08             	mov    0x8(%ebp),%eax
+  803735:	a3 00 90 80 00       	mov    %eax,0x809000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  80373a:	53                   	push   %ebx
+  80373b:	ff 75 0c             	push   0xc(%ebp)
+  80373e:	68 04 90 80 00       	push   $0x809004
+  803743:	e8 ef d5 ff ff       	call   800d37 <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  803748:	89 1d 14 90 80 00    	mov    %ebx,0x809014
+	return nsipc(NSREQ_BIND);
+  80374e:	b8 02 00 00 00       	mov    $0x2,%eax
+  803753:	e8 32 ff ff ff       	call   80368a <nsipc>
+}
+  803758:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80375b:	c9                   	leave
+  80375c:	c3                   	ret
+
+0080375d <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  80375d:	55                   	push   %ebp
+  80375e:	89 e5                	mov    %esp,%ebp
+  803760:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  803763:	8b 45 08             	mov    0x8(%ebp),%eax
+  803766:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.shutdown.req_how = how;
+  80376b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80376e:	a3 04 90 80 00       	mov    %eax,0x809004
+	return nsipc(NSREQ_SHUTDOWN);
+  803773:	b8 03 00 00 00       	mov    $0x3,%eax
+  803778:	e8 0d ff ff ff       	call   80368a <nsipc>
+}
+  80377d:	c9                   	leave
+  80377e:	c3                   	ret
+
+0080377f <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  80377f:	55                   	push   %ebp
+  803780:	89 e5                	mov    %esp,%ebp
+  803782:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  803785:	8b 45 08             	mov    0x8(%ebp),%eax
+  803788:	a3 00 90 80 00       	mov    %eax,0x809000
+	return nsipc(NSREQ_CLOSE);
+  80378d:	b8 04 00 00 00       	mov    $0x4,%eax
+  803792:	e8 f3 fe ff ff       	call   80368a <nsipc>
+}
+  803797:	c9                   	leave
+  803798:	c3                   	ret
+
+00803799 <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  803799:	55                   	push   %ebp
+  80379a:	89 e5                	mov    %esp,%ebp
+  80379c:	53                   	push   %ebx
+  80379d:	83 ec 08             	sub    $0x8,%esp
+  8037a0:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  8037a3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8037a6:	a3 00 90 80 00       	mov    %eax,0x809000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  8037ab:	53                   	push   %ebx
+  8037ac:	ff 75 0c             	push   0xc(%ebp)
+  8037af:	68 04 90 80 00       	push   $0x809004
+  8037b4:	e8 7e d5 ff ff       	call   800d37 <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  8037b9:	89 1d 14 90 80 00    	mov    %ebx,0x809014
+	return nsipc(NSREQ_CONNECT);
+  8037bf:	b8 05 00 00 00       	mov    $0x5,%eax
+  8037c4:	e8 c1 fe ff ff       	call   80368a <nsipc>
+}
+  8037c9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8037cc:	c9                   	leave
+  8037cd:	c3                   	ret
+
+008037ce <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  8037ce:	55                   	push   %ebp
+  8037cf:	89 e5                	mov    %esp,%ebp
+  8037d1:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  8037d4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8037d7:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.listen.req_backlog = backlog;
+  8037dc:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8037df:	a3 04 90 80 00       	mov    %eax,0x809004
+	return nsipc(NSREQ_LISTEN);
+  8037e4:	b8 06 00 00 00       	mov    $0x6,%eax
+  8037e9:	e8 9c fe ff ff       	call   80368a <nsipc>
+}
+  8037ee:	c9                   	leave
+  8037ef:	c3                   	ret
+
+008037f0 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  8037f0:	55                   	push   %ebp
+  8037f1:	89 e5                	mov    %esp,%ebp
+  8037f3:	56                   	push   %esi
+  8037f4:	53                   	push   %ebx
+  8037f5:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  8037f8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8037fb:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.recv.req_len = len;
+  803800:	89 35 04 90 80 00    	mov    %esi,0x809004
+	nsipcbuf.recv.req_flags = flags;
+  803806:	8b 45 14             	mov    0x14(%ebp),%eax
+  803809:	a3 08 90 80 00       	mov    %eax,0x809008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  80380e:	b8 07 00 00 00       	mov    $0x7,%eax
+  803813:	e8 72 fe ff ff       	call   80368a <nsipc>
+  803818:	89 c3                	mov    %eax,%ebx
+  80381a:	85 c0                	test   %eax,%eax
+  80381c:	78 22                	js     803840 <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  80381e:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  803823:	39 c6                	cmp    %eax,%esi
+  803825:	0f 4e c6             	cmovle %esi,%eax
+  803828:	39 c3                	cmp    %eax,%ebx
+  80382a:	7f 1d                	jg     803849 <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  80382c:	83 ec 04             	sub    $0x4,%esp
+  80382f:	53                   	push   %ebx
+  803830:	68 00 90 80 00       	push   $0x809000
+  803835:	ff 75 0c             	push   0xc(%ebp)
+  803838:	e8 fa d4 ff ff       	call   800d37 <memmove>
+  80383d:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  803840:	89 d8                	mov    %ebx,%eax
+  803842:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803845:	5b                   	pop    %ebx
+  803846:	5e                   	pop    %esi
+  803847:	5d                   	pop    %ebp
+  803848:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  803849:	68 8e 48 80 00       	push   $0x80488e
+  80384e:	68 ac 46 80 00       	push   $0x8046ac
+  803853:	6a 62                	push   $0x62
+  803855:	68 a3 48 80 00       	push   $0x8048a3
+  80385a:	e8 89 cc ff ff       	call   8004e8 <_panic>
+
+0080385f <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  80385f:	55                   	push   %ebp
+  803860:	89 e5                	mov    %esp,%ebp
+  803862:	53                   	push   %ebx
+  803863:	83 ec 04             	sub    $0x4,%esp
+  803866:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  803869:	8b 45 08             	mov    0x8(%ebp),%eax
+  80386c:	a3 00 90 80 00       	mov    %eax,0x809000
+	assert(size < 1600);
+  803871:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  803877:	7f 2e                	jg     8038a7 <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  803879:	83 ec 04             	sub    $0x4,%esp
+  80387c:	53                   	push   %ebx
+  80387d:	ff 75 0c             	push   0xc(%ebp)
+  803880:	68 0c 90 80 00       	push   $0x80900c
+  803885:	e8 ad d4 ff ff       	call   800d37 <memmove>
+	nsipcbuf.send.req_size = size;
+  80388a:	89 1d 04 90 80 00    	mov    %ebx,0x809004
+	nsipcbuf.send.req_flags = flags;
+  803890:	8b 45 14             	mov    0x14(%ebp),%eax
+  803893:	a3 08 90 80 00       	mov    %eax,0x809008
+	return nsipc(NSREQ_SEND);
+  803898:	b8 08 00 00 00       	mov    $0x8,%eax
+  80389d:	e8 e8 fd ff ff       	call   80368a <nsipc>
+}
+  8038a2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8038a5:	c9                   	leave
+  8038a6:	c3                   	ret
+	assert(size < 1600);
+  8038a7:	68 af 48 80 00       	push   $0x8048af
+  8038ac:	68 ac 46 80 00       	push   $0x8046ac
+  8038b1:	6a 6d                	push   $0x6d
+  8038b3:	68 a3 48 80 00       	push   $0x8048a3
+  8038b8:	e8 2b cc ff ff       	call   8004e8 <_panic>
+
+008038bd <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  8038bd:	55                   	push   %ebp
+  8038be:	89 e5                	mov    %esp,%ebp
+  8038c0:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  8038c3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8038c6:	a3 00 90 80 00       	mov    %eax,0x809000
+	nsipcbuf.socket.req_type = type;
+  8038cb:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8038ce:	a3 04 90 80 00       	mov    %eax,0x809004
+	nsipcbuf.socket.req_protocol = protocol;
+  8038d3:	8b 45 10             	mov    0x10(%ebp),%eax
+  8038d6:	a3 08 90 80 00       	mov    %eax,0x809008
+	return nsipc(NSREQ_SOCKET);
+  8038db:	b8 09 00 00 00       	mov    $0x9,%eax
+  8038e0:	e8 a5 fd ff ff       	call   80368a <nsipc>
+}
+  8038e5:	c9                   	leave
+  8038e6:	c3                   	ret
+
+008038e7 <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  8038e7:	55                   	push   %ebp
+  8038e8:	89 e5                	mov    %esp,%ebp
+  8038ea:	56                   	push   %esi
+  8038eb:	53                   	push   %ebx
+  8038ec:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  8038ef:	83 ec 0c             	sub    $0xc,%esp
+  8038f2:	ff 75 08             	push   0x8(%ebp)
+  8038f5:	e8 e9 dd ff ff       	call   8016e3 <fd2data>
+  8038fa:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  8038fc:	83 c4 08             	add    $0x8,%esp
+  8038ff:	68 bb 48 80 00       	push   $0x8048bb
+  803904:	53                   	push   %ebx
+  803905:	e8 a7 d2 ff ff       	call   800bb1 <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  80390a:	8b 46 04             	mov    0x4(%esi),%eax
+  80390d:	2b 06                	sub    (%esi),%eax
+  80390f:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  803915:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  80391c:	00 00 00 
+	stat->st_dev = &devpipe;
+  80391f:	c7 83 88 00 00 00 80 	movl   $0x805080,0x88(%ebx)
+  803926:	50 80 00 
+	return 0;
+}
+  803929:	b8 00 00 00 00       	mov    $0x0,%eax
+  80392e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803931:	5b                   	pop    %ebx
+  803932:	5e                   	pop    %esi
+  803933:	5d                   	pop    %ebp
+  803934:	c3                   	ret
+
+00803935 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  803935:	55                   	push   %ebp
+  803936:	89 e5                	mov    %esp,%ebp
+  803938:	53                   	push   %ebx
+  803939:	83 ec 0c             	sub    $0xc,%esp
+  80393c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  80393f:	53                   	push   %ebx
+  803940:	6a 00                	push   $0x0
+  803942:	e8 03 d7 ff ff       	call   80104a <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  803947:	89 1c 24             	mov    %ebx,(%esp)
+  80394a:	e8 94 dd ff ff       	call   8016e3 <fd2data>
+  80394f:	83 c4 08             	add    $0x8,%esp
+  803952:	50                   	push   %eax
+  803953:	6a 00                	push   $0x0
+  803955:	e8 f0 d6 ff ff       	call   80104a <sys_page_unmap>
+}
+  80395a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80395d:	c9                   	leave
+  80395e:	c3                   	ret
+
+0080395f <_pipeisclosed>:
+{
+  80395f:	55                   	push   %ebp
+  803960:	89 e5                	mov    %esp,%ebp
+  803962:	57                   	push   %edi
+  803963:	56                   	push   %esi
+  803964:	53                   	push   %ebx
+  803965:	83 ec 1c             	sub    $0x1c,%esp
+  803968:	89 c7                	mov    %eax,%edi
+  80396a:	89 d6                	mov    %edx,%esi
+		n = thisenv->env_runs;
+  80396c:	a1 00 60 80 00       	mov    0x806000,%eax
+  803971:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  803974:	83 ec 0c             	sub    $0xc,%esp
+  803977:	57                   	push   %edi
+  803978:	e8 82 05 00 00       	call   803eff <pageref>
+  80397d:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  803980:	89 34 24             	mov    %esi,(%esp)
+  803983:	e8 77 05 00 00       	call   803eff <pageref>
+		nn = thisenv->env_runs;
+  803988:	8b 15 00 60 80 00    	mov    0x806000,%edx
+  80398e:	8b 4a 58             	mov    0x58(%edx),%ecx
+		if (n == nn)
+  803991:	83 c4 10             	add    $0x10,%esp
+  803994:	39 cb                	cmp    %ecx,%ebx
+  803996:	74 1b                	je     8039b3 <_pipeisclosed+0x54>
+		if (n != nn && ret == 1)
+  803998:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  80399b:	75 cf                	jne    80396c <_pipeisclosed+0xd>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  80399d:	8b 42 58             	mov    0x58(%edx),%eax
+  8039a0:	6a 01                	push   $0x1
+  8039a2:	50                   	push   %eax
+  8039a3:	53                   	push   %ebx
+  8039a4:	68 c2 48 80 00       	push   $0x8048c2
+  8039a9:	e8 15 cc ff ff       	call   8005c3 <cprintf>
+  8039ae:	83 c4 10             	add    $0x10,%esp
+  8039b1:	eb b9                	jmp    80396c <_pipeisclosed+0xd>
+		ret = pageref(fd) == pageref(p);
+  8039b3:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  8039b6:	0f 94 c0             	sete   %al
+  8039b9:	0f b6 c0             	movzbl %al,%eax
+}
+  8039bc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8039bf:	5b                   	pop    %ebx
+  8039c0:	5e                   	pop    %esi
+  8039c1:	5f                   	pop    %edi
+  8039c2:	5d                   	pop    %ebp
+  8039c3:	c3                   	ret
+
+008039c4 <devpipe_write>:
+{
+  8039c4:	55                   	push   %ebp
+  8039c5:	89 e5                	mov    %esp,%ebp
+  8039c7:	57                   	push   %edi
+  8039c8:	56                   	push   %esi
+  8039c9:	53                   	push   %ebx
+  8039ca:	83 ec 28             	sub    $0x28,%esp
+  8039cd:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  8039d0:	56                   	push   %esi
+  8039d1:	e8 0d dd ff ff       	call   8016e3 <fd2data>
+  8039d6:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  8039d8:	83 c4 10             	add    $0x10,%esp
+  8039db:	bf 00 00 00 00       	mov    $0x0,%edi
+  8039e0:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  8039e3:	75 09                	jne    8039ee <devpipe_write+0x2a>
+	return i;
+  8039e5:	89 f8                	mov    %edi,%eax
+  8039e7:	eb 23                	jmp    803a0c <devpipe_write+0x48>
+			sys_yield();
+  8039e9:	e8 b0 d5 ff ff       	call   800f9e <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  8039ee:	8b 43 04             	mov    0x4(%ebx),%eax
+  8039f1:	8b 0b                	mov    (%ebx),%ecx
+  8039f3:	8d 51 20             	lea    0x20(%ecx),%edx
+  8039f6:	39 d0                	cmp    %edx,%eax
+  8039f8:	72 1a                	jb     803a14 <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  8039fa:	89 da                	mov    %ebx,%edx
+  8039fc:	89 f0                	mov    %esi,%eax
+  8039fe:	e8 5c ff ff ff       	call   80395f <_pipeisclosed>
+  803a03:	85 c0                	test   %eax,%eax
+  803a05:	74 e2                	je     8039e9 <devpipe_write+0x25>
+				return 0;
+  803a07:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803a0c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803a0f:	5b                   	pop    %ebx
+  803a10:	5e                   	pop    %esi
+  803a11:	5f                   	pop    %edi
+  803a12:	5d                   	pop    %ebp
+  803a13:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  803a14:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  803a17:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  803a1b:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  803a1e:	89 c2                	mov    %eax,%edx
+  803a20:	c1 fa 1f             	sar    $0x1f,%edx
+  803a23:	89 d1                	mov    %edx,%ecx
+  803a25:	c1 e9 1b             	shr    $0x1b,%ecx
+  803a28:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  803a2b:	83 e2 1f             	and    $0x1f,%edx
+  803a2e:	29 ca                	sub    %ecx,%edx
+  803a30:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  803a34:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  803a38:	83 c0 01             	add    $0x1,%eax
+  803a3b:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  803a3e:	83 c7 01             	add    $0x1,%edi
+  803a41:	eb 9d                	jmp    8039e0 <devpipe_write+0x1c>
+
+00803a43 <devpipe_read>:
+{
+  803a43:	55                   	push   %ebp
+  803a44:	89 e5                	mov    %esp,%ebp
+  803a46:	57                   	push   %edi
+  803a47:	56                   	push   %esi
+  803a48:	53                   	push   %ebx
+  803a49:	83 ec 18             	sub    $0x18,%esp
+  803a4c:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  803a4f:	57                   	push   %edi
+  803a50:	e8 8e dc ff ff       	call   8016e3 <fd2data>
+  803a55:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  803a57:	83 c4 10             	add    $0x10,%esp
+  803a5a:	be 00 00 00 00       	mov    $0x0,%esi
+  803a5f:	3b 75 10             	cmp    0x10(%ebp),%esi
+  803a62:	75 13                	jne    803a77 <devpipe_read+0x34>
+	return i;
+  803a64:	89 f0                	mov    %esi,%eax
+  803a66:	eb 02                	jmp    803a6a <devpipe_read+0x27>
+				return i;
+  803a68:	89 f0                	mov    %esi,%eax
+}
+  803a6a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803a6d:	5b                   	pop    %ebx
+  803a6e:	5e                   	pop    %esi
+  803a6f:	5f                   	pop    %edi
+  803a70:	5d                   	pop    %ebp
+  803a71:	c3                   	ret
+			sys_yield();
+  803a72:	e8 27 d5 ff ff       	call   800f9e <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  803a77:	8b 03                	mov    (%ebx),%eax
+  803a79:	3b 43 04             	cmp    0x4(%ebx),%eax
+  803a7c:	75 18                	jne    803a96 <devpipe_read+0x53>
+			if (i > 0)
+  803a7e:	85 f6                	test   %esi,%esi
+  803a80:	75 e6                	jne    803a68 <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  803a82:	89 da                	mov    %ebx,%edx
+  803a84:	89 f8                	mov    %edi,%eax
+  803a86:	e8 d4 fe ff ff       	call   80395f <_pipeisclosed>
+  803a8b:	85 c0                	test   %eax,%eax
+  803a8d:	74 e3                	je     803a72 <devpipe_read+0x2f>
+				return 0;
+  803a8f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803a94:	eb d4                	jmp    803a6a <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  803a96:	99                   	cltd
+  803a97:	c1 ea 1b             	shr    $0x1b,%edx
+  803a9a:	01 d0                	add    %edx,%eax
+  803a9c:	83 e0 1f             	and    $0x1f,%eax
+  803a9f:	29 d0                	sub    %edx,%eax
+  803aa1:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  803aa6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  803aa9:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  803aac:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  803aaf:	83 c6 01             	add    $0x1,%esi
+  803ab2:	eb ab                	jmp    803a5f <devpipe_read+0x1c>
+
+00803ab4 <pipe>:
+{
+  803ab4:	55                   	push   %ebp
+  803ab5:	89 e5                	mov    %esp,%ebp
+  803ab7:	56                   	push   %esi
+  803ab8:	53                   	push   %ebx
+  803ab9:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  803abc:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803abf:	50                   	push   %eax
+  803ac0:	e8 35 dc ff ff       	call   8016fa <fd_alloc>
+  803ac5:	89 c3                	mov    %eax,%ebx
+  803ac7:	83 c4 10             	add    $0x10,%esp
+  803aca:	85 c0                	test   %eax,%eax
+  803acc:	0f 88 23 01 00 00    	js     803bf5 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803ad2:	83 ec 04             	sub    $0x4,%esp
+  803ad5:	68 07 04 00 00       	push   $0x407
+  803ada:	ff 75 f4             	push   -0xc(%ebp)
+  803add:	6a 00                	push   $0x0
+  803adf:	e8 d9 d4 ff ff       	call   800fbd <sys_page_alloc>
+  803ae4:	89 c3                	mov    %eax,%ebx
+  803ae6:	83 c4 10             	add    $0x10,%esp
+  803ae9:	85 c0                	test   %eax,%eax
+  803aeb:	0f 88 04 01 00 00    	js     803bf5 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  803af1:	83 ec 0c             	sub    $0xc,%esp
+  803af4:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  803af7:	50                   	push   %eax
+  803af8:	e8 fd db ff ff       	call   8016fa <fd_alloc>
+  803afd:	89 c3                	mov    %eax,%ebx
+  803aff:	83 c4 10             	add    $0x10,%esp
+  803b02:	85 c0                	test   %eax,%eax
+  803b04:	0f 88 db 00 00 00    	js     803be5 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803b0a:	83 ec 04             	sub    $0x4,%esp
+  803b0d:	68 07 04 00 00       	push   $0x407
+  803b12:	ff 75 f0             	push   -0x10(%ebp)
+  803b15:	6a 00                	push   $0x0
+  803b17:	e8 a1 d4 ff ff       	call   800fbd <sys_page_alloc>
+  803b1c:	89 c3                	mov    %eax,%ebx
+  803b1e:	83 c4 10             	add    $0x10,%esp
+  803b21:	85 c0                	test   %eax,%eax
+  803b23:	0f 88 bc 00 00 00    	js     803be5 <pipe+0x131>
+	va = fd2data(fd0);
+  803b29:	83 ec 0c             	sub    $0xc,%esp
+  803b2c:	ff 75 f4             	push   -0xc(%ebp)
+  803b2f:	e8 af db ff ff       	call   8016e3 <fd2data>
+  803b34:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803b36:	83 c4 0c             	add    $0xc,%esp
+  803b39:	68 07 04 00 00       	push   $0x407
+  803b3e:	50                   	push   %eax
+  803b3f:	6a 00                	push   $0x0
+  803b41:	e8 77 d4 ff ff       	call   800fbd <sys_page_alloc>
+  803b46:	89 c3                	mov    %eax,%ebx
+  803b48:	83 c4 10             	add    $0x10,%esp
+  803b4b:	85 c0                	test   %eax,%eax
+  803b4d:	0f 88 82 00 00 00    	js     803bd5 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803b53:	83 ec 0c             	sub    $0xc,%esp
+  803b56:	ff 75 f0             	push   -0x10(%ebp)
+  803b59:	e8 85 db ff ff       	call   8016e3 <fd2data>
+  803b5e:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  803b65:	50                   	push   %eax
+  803b66:	6a 00                	push   $0x0
+  803b68:	56                   	push   %esi
+  803b69:	6a 00                	push   $0x0
+  803b6b:	e8 98 d4 ff ff       	call   801008 <sys_page_map>
+  803b70:	89 c3                	mov    %eax,%ebx
+  803b72:	83 c4 20             	add    $0x20,%esp
+  803b75:	85 c0                	test   %eax,%eax
+  803b77:	78 4e                	js     803bc7 <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  803b79:	a1 80 50 80 00       	mov    0x805080,%eax
+  803b7e:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  803b81:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  803b83:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  803b86:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  803b8d:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  803b90:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  803b92:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  803b95:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  803b9c:	83 ec 0c             	sub    $0xc,%esp
+  803b9f:	ff 75 f4             	push   -0xc(%ebp)
+  803ba2:	e8 2c db ff ff       	call   8016d3 <fd2num>
+  803ba7:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803baa:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  803bac:	83 c4 04             	add    $0x4,%esp
+  803baf:	ff 75 f0             	push   -0x10(%ebp)
+  803bb2:	e8 1c db ff ff       	call   8016d3 <fd2num>
+  803bb7:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803bba:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  803bbd:	83 c4 10             	add    $0x10,%esp
+  803bc0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803bc5:	eb 2e                	jmp    803bf5 <pipe+0x141>
+	sys_page_unmap(0, va);
+  803bc7:	83 ec 08             	sub    $0x8,%esp
+  803bca:	56                   	push   %esi
+  803bcb:	6a 00                	push   $0x0
+  803bcd:	e8 78 d4 ff ff       	call   80104a <sys_page_unmap>
+  803bd2:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  803bd5:	83 ec 08             	sub    $0x8,%esp
+  803bd8:	ff 75 f0             	push   -0x10(%ebp)
+  803bdb:	6a 00                	push   $0x0
+  803bdd:	e8 68 d4 ff ff       	call   80104a <sys_page_unmap>
+  803be2:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  803be5:	83 ec 08             	sub    $0x8,%esp
+  803be8:	ff 75 f4             	push   -0xc(%ebp)
+  803beb:	6a 00                	push   $0x0
+  803bed:	e8 58 d4 ff ff       	call   80104a <sys_page_unmap>
+  803bf2:	83 c4 10             	add    $0x10,%esp
+}
+  803bf5:	89 d8                	mov    %ebx,%eax
+  803bf7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803bfa:	5b                   	pop    %ebx
+  803bfb:	5e                   	pop    %esi
+  803bfc:	5d                   	pop    %ebp
+  803bfd:	c3                   	ret
+
+00803bfe <pipeisclosed>:
+{
+  803bfe:	55                   	push   %ebp
+  803bff:	89 e5                	mov    %esp,%ebp
+  803c01:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803c04:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803c07:	50                   	push   %eax
+  803c08:	ff 75 08             	push   0x8(%ebp)
+  803c0b:	e8 40 db ff ff       	call   801750 <fd_lookup>
+  803c10:	83 c4 10             	add    $0x10,%esp
+  803c13:	85 c0                	test   %eax,%eax
+  803c15:	78 18                	js     803c2f <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  803c17:	83 ec 0c             	sub    $0xc,%esp
+  803c1a:	ff 75 f4             	push   -0xc(%ebp)
+  803c1d:	e8 c1 da ff ff       	call   8016e3 <fd2data>
+  803c22:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  803c24:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803c27:	e8 33 fd ff ff       	call   80395f <_pipeisclosed>
+  803c2c:	83 c4 10             	add    $0x10,%esp
+}
+  803c2f:	c9                   	leave
+  803c30:	c3                   	ret
+
+00803c31 <wait>:
+#include <inc/lib.h>
+
+// Waits until 'envid' exits.
+void
+wait(envid_t envid)
+{
+  803c31:	55                   	push   %ebp
+  803c32:	89 e5                	mov    %esp,%ebp
+  803c34:	56                   	push   %esi
+  803c35:	53                   	push   %ebx
+  803c36:	8b 75 08             	mov    0x8(%ebp),%esi
+	const volatile struct Env *e;
+
+	assert(envid != 0);
+  803c39:	85 f6                	test   %esi,%esi
+  803c3b:	74 16                	je     803c53 <wait+0x22>
+	e = &envs[ENVX(envid)];
+  803c3d:	89 f3                	mov    %esi,%ebx
+  803c3f:	81 e3 ff 03 00 00    	and    $0x3ff,%ebx
+	while (e->env_id == envid && e->env_status != ENV_FREE)
+  803c45:	69 db 8c 00 00 00    	imul   $0x8c,%ebx,%ebx
+  803c4b:	81 c3 00 00 c0 ee    	add    $0xeec00000,%ebx
+  803c51:	eb 1b                	jmp    803c6e <wait+0x3d>
+	assert(envid != 0);
+  803c53:	68 da 48 80 00       	push   $0x8048da
+  803c58:	68 ac 46 80 00       	push   $0x8046ac
+  803c5d:	6a 09                	push   $0x9
+  803c5f:	68 e5 48 80 00       	push   $0x8048e5
+  803c64:	e8 7f c8 ff ff       	call   8004e8 <_panic>
+		sys_yield();
+  803c69:	e8 30 d3 ff ff       	call   800f9e <sys_yield>
+	while (e->env_id == envid && e->env_status != ENV_FREE)
+  803c6e:	8b 43 48             	mov    0x48(%ebx),%eax
+  803c71:	39 f0                	cmp    %esi,%eax
+  803c73:	75 07                	jne    803c7c <wait+0x4b>
+  803c75:	8b 43 54             	mov    0x54(%ebx),%eax
+  803c78:	85 c0                	test   %eax,%eax
+  803c7a:	75 ed                	jne    803c69 <wait+0x38>
+}
+  803c7c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803c7f:	5b                   	pop    %ebx
+  803c80:	5e                   	pop    %esi
+  803c81:	5d                   	pop    %ebp
+  803c82:	c3                   	ret
+
+00803c83 <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  803c83:	55                   	push   %ebp
+  803c84:	89 e5                	mov    %esp,%ebp
+  803c86:	83 ec 08             	sub    $0x8,%esp
+	if (_pgfault_handler == 0) {
+  803c89:	83 3d 04 a0 80 00 00 	cmpl   $0x0,0x80a004
+  803c90:	74 0a                	je     803c9c <set_pgfault_handler+0x19>
+				       PTE_U | PTE_W | PTE_P));
+		assert(!sys_env_set_pgfault_upcall(0, _pgfault_upcall));
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  803c92:	8b 45 08             	mov    0x8(%ebp),%eax
+  803c95:	a3 04 a0 80 00       	mov    %eax,0x80a004
+}
+  803c9a:	c9                   	leave
+  803c9b:	c3                   	ret
+		assert(!sys_page_alloc(0, (void *) UXSTACKTOP - PGSIZE,
+  803c9c:	83 ec 04             	sub    $0x4,%esp
+  803c9f:	6a 07                	push   $0x7
+  803ca1:	68 00 f0 bf ee       	push   $0xeebff000
+  803ca6:	6a 00                	push   $0x0
+  803ca8:	e8 10 d3 ff ff       	call   800fbd <sys_page_alloc>
+  803cad:	83 c4 10             	add    $0x10,%esp
+  803cb0:	85 c0                	test   %eax,%eax
+  803cb2:	75 2c                	jne    803ce0 <set_pgfault_handler+0x5d>
+		assert(!sys_env_set_pgfault_upcall(0, _pgfault_upcall));
+  803cb4:	83 ec 08             	sub    $0x8,%esp
+  803cb7:	68 f6 3c 80 00       	push   $0x803cf6
+  803cbc:	6a 00                	push   $0x0
+  803cbe:	e8 65 d4 ff ff       	call   801128 <sys_env_set_pgfault_upcall>
+  803cc3:	83 c4 10             	add    $0x10,%esp
+  803cc6:	85 c0                	test   %eax,%eax
+  803cc8:	74 c8                	je     803c92 <set_pgfault_handler+0xf>
+  803cca:	68 38 49 80 00       	push   $0x804938
+  803ccf:	68 ac 46 80 00       	push   $0x8046ac
+  803cd4:	6a 20                	push   $0x20
+  803cd6:	68 68 49 80 00       	push   $0x804968
+  803cdb:	e8 08 c8 ff ff       	call   8004e8 <_panic>
+		assert(!sys_page_alloc(0, (void *) UXSTACKTOP - PGSIZE,
+  803ce0:	68 f0 48 80 00       	push   $0x8048f0
+  803ce5:	68 ac 46 80 00       	push   $0x8046ac
+  803cea:	6a 1e                	push   $0x1e
+  803cec:	68 68 49 80 00       	push   $0x804968
+  803cf1:	e8 f2 c7 ff ff       	call   8004e8 <_panic>
+
+00803cf6 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  803cf6:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  803cf7:	a1 04 a0 80 00       	mov    0x80a004,%eax
+	call *%eax
+  803cfc:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  803cfe:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+	movl	$-0x4, %ebp
+  803d01:	bd fc ff ff ff       	mov    $0xfffffffc,%ebp
+	xadd	%ebp, 0x30(%esp)	# Load trap-time %esp.
+  803d06:	0f c1 6c 24 30       	xadd   %ebp,0x30(%esp)
+
+	movl	0x28(%esp), %eax	# Load trap-time %eip.
+  803d0b:	8b 44 24 28          	mov    0x28(%esp),%eax
+	movl	%eax, -0x4(%ebp)
+  803d0f:	89 45 fc             	mov    %eax,-0x4(%ebp)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+	addl	$0x8, %esp
+  803d12:	83 c4 08             	add    $0x8,%esp
+	popal
+  803d15:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+	addl	$0x4, %esp
+  803d16:	83 c4 04             	add    $0x4,%esp
+	popfl
+  803d19:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+	popl	%esp
+  803d1a:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+	ret
+  803d1b:	c3                   	ret
+
+00803d1c <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  803d1c:	55                   	push   %ebp
+  803d1d:	89 e5                	mov    %esp,%ebp
+  803d1f:	56                   	push   %esi
+  803d20:	53                   	push   %ebx
+  803d21:	8b 75 08             	mov    0x8(%ebp),%esi
+  803d24:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803d27:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int r;
+
+	if (pg == NULL)
+		pg = (void *) UTOP;
+  803d2a:	85 c0                	test   %eax,%eax
+  803d2c:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  803d31:	0f 44 c2             	cmove  %edx,%eax
+
+	r = sys_ipc_recv(pg);
+  803d34:	83 ec 0c             	sub    $0xc,%esp
+  803d37:	50                   	push   %eax
+  803d38:	e8 c8 d4 ff ff       	call   801205 <sys_ipc_recv>
+	if (from_env_store)
+  803d3d:	83 c4 10             	add    $0x10,%esp
+  803d40:	85 f6                	test   %esi,%esi
+  803d42:	74 14                	je     803d58 <ipc_recv+0x3c>
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  803d44:	ba 00 00 00 00       	mov    $0x0,%edx
+  803d49:	85 c0                	test   %eax,%eax
+  803d4b:	75 09                	jne    803d56 <ipc_recv+0x3a>
+  803d4d:	8b 15 00 60 80 00    	mov    0x806000,%edx
+  803d53:	8b 52 74             	mov    0x74(%edx),%edx
+  803d56:	89 16                	mov    %edx,(%esi)
+	if (perm_store)
+  803d58:	85 db                	test   %ebx,%ebx
+  803d5a:	74 25                	je     803d81 <ipc_recv+0x65>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  803d5c:	85 c0                	test   %eax,%eax
+  803d5e:	74 0d                	je     803d6d <ipc_recv+0x51>
+  803d60:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+	return r ?: thisenv->env_ipc_value;
+}
+  803d66:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803d69:	5b                   	pop    %ebx
+  803d6a:	5e                   	pop    %esi
+  803d6b:	5d                   	pop    %ebp
+  803d6c:	c3                   	ret
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  803d6d:	a1 00 60 80 00       	mov    0x806000,%eax
+  803d72:	8b 40 78             	mov    0x78(%eax),%eax
+  803d75:	89 03                	mov    %eax,(%ebx)
+	return r ?: thisenv->env_ipc_value;
+  803d77:	a1 00 60 80 00       	mov    0x806000,%eax
+  803d7c:	8b 40 70             	mov    0x70(%eax),%eax
+  803d7f:	eb e5                	jmp    803d66 <ipc_recv+0x4a>
+  803d81:	85 c0                	test   %eax,%eax
+  803d83:	75 e1                	jne    803d66 <ipc_recv+0x4a>
+  803d85:	eb f0                	jmp    803d77 <ipc_recv+0x5b>
+
+00803d87 <ipc_send>:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  803d87:	55                   	push   %ebp
+  803d88:	89 e5                	mov    %esp,%ebp
+  803d8a:	57                   	push   %edi
+  803d8b:	56                   	push   %esi
+  803d8c:	53                   	push   %ebx
+  803d8d:	83 ec 0c             	sub    $0xc,%esp
+  803d90:	8b 7d 08             	mov    0x8(%ebp),%edi
+  803d93:	8b 75 0c             	mov    0xc(%ebp),%esi
+  803d96:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int r;
+
+	if (pg == NULL)
+		pg = (void *) UTOP;
+  803d99:	85 db                	test   %ebx,%ebx
+  803d9b:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  803da0:	0f 44 d8             	cmove  %eax,%ebx
+
+	while ((r = sys_ipc_try_send(to_env, val, pg, perm))) {
+  803da3:	ff 75 14             	push   0x14(%ebp)
+  803da6:	53                   	push   %ebx
+  803da7:	56                   	push   %esi
+  803da8:	57                   	push   %edi
+  803da9:	e8 c4 d3 ff ff       	call   801172 <sys_ipc_try_send>
+  803dae:	83 c4 10             	add    $0x10,%esp
+  803db1:	85 c0                	test   %eax,%eax
+  803db3:	74 22                	je     803dd7 <ipc_send+0x50>
+		assert(r == -E_IPC_NOT_RECV);
+  803db5:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  803db8:	75 07                	jne    803dc1 <ipc_send+0x3a>
+		sys_yield();
+  803dba:	e8 df d1 ff ff       	call   800f9e <sys_yield>
+  803dbf:	eb e2                	jmp    803da3 <ipc_send+0x1c>
+		assert(r == -E_IPC_NOT_RECV);
+  803dc1:	68 76 49 80 00       	push   $0x804976
+  803dc6:	68 ac 46 80 00       	push   $0x8046ac
+  803dcb:	6a 39                	push   $0x39
+  803dcd:	68 8b 49 80 00       	push   $0x80498b
+  803dd2:	e8 11 c7 ff ff       	call   8004e8 <_panic>
+	}
+}
+  803dd7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803dda:	5b                   	pop    %ebx
+  803ddb:	5e                   	pop    %esi
+  803ddc:	5f                   	pop    %edi
+  803ddd:	5d                   	pop    %ebp
+  803dde:	c3                   	ret
+
+00803ddf <ipc_recvv>:
+// Receive a value and up to *npages pages, mapped one after another
+// starting at 'pg'.  Like ipc_recv otherwise; also stores the number
+// of pages actually received in *npages (0 on error).
+int32_t
+ipc_recvv(envid_t *from_env_store, void *pg, int *npages, int *perm_store)
+{
+  803ddf:	55                   	push   %ebp
+  803de0:	89 e5                	mov    %esp,%ebp
+  803de2:	57                   	push   %edi
+  803de3:	56                   	push   %esi
+  803de4:	53                   	push   %ebx
+  803de5:	83 ec 10             	sub    $0x10,%esp
+  803de8:	8b 7d 08             	mov    0x8(%ebp),%edi
+  803deb:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803dee:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  803df1:	8b 75 14             	mov    0x14(%ebp),%esi
+	int r;
+
+	if (pg == NULL)
+		pg = (void *) UTOP;
+  803df4:	85 c0                	test   %eax,%eax
+  803df6:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  803dfb:	0f 44 c2             	cmove  %edx,%eax
+
+	r = sys_ipc_recvv(pg, *npages, 0);
+  803dfe:	6a 00                	push   $0x0
+  803e00:	ff 33                	push   (%ebx)
+  803e02:	50                   	push   %eax
+  803e03:	e8 ba d3 ff ff       	call   8011c2 <sys_ipc_recvv>
+	*npages = !r ? thisenv->env_ipc_npages : 0;
+  803e08:	83 c4 10             	add    $0x10,%esp
+  803e0b:	85 c0                	test   %eax,%eax
+  803e0d:	75 3c                	jne    803e4b <ipc_recvv+0x6c>
+  803e0f:	8b 15 00 60 80 00    	mov    0x806000,%edx
+  803e15:	8b 52 7c             	mov    0x7c(%edx),%edx
+  803e18:	89 13                	mov    %edx,(%ebx)
+	if (from_env_store)
+  803e1a:	85 ff                	test   %edi,%edi
+  803e1c:	74 4e                	je     803e6c <ipc_recvv+0x8d>
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  803e1e:	8b 15 00 60 80 00    	mov    0x806000,%edx
+  803e24:	8b 52 74             	mov    0x74(%edx),%edx
+  803e27:	89 17                	mov    %edx,(%edi)
+	if (perm_store)
+  803e29:	85 f6                	test   %esi,%esi
+  803e2b:	74 18                	je     803e45 <ipc_recvv+0x66>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  803e2d:	85 c0                	test   %eax,%eax
+  803e2f:	75 2d                	jne    803e5e <ipc_recvv+0x7f>
+  803e31:	a1 00 60 80 00       	mov    0x806000,%eax
+  803e36:	8b 40 78             	mov    0x78(%eax),%eax
+  803e39:	89 06                	mov    %eax,(%esi)
+	return r ?: thisenv->env_ipc_value;
+  803e3b:	a1 00 60 80 00       	mov    0x806000,%eax
+  803e40:	8b 40 70             	mov    0x70(%eax),%eax
+  803e43:	eb 1f                	jmp    803e64 <ipc_recvv+0x85>
+  803e45:	85 c0                	test   %eax,%eax
+  803e47:	75 1b                	jne    803e64 <ipc_recvv+0x85>
+  803e49:	eb f0                	jmp    803e3b <ipc_recvv+0x5c>
+	*npages = !r ? thisenv->env_ipc_npages : 0;
+  803e4b:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  803e51:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (from_env_store)
+  803e56:	85 ff                	test   %edi,%edi
+  803e58:	75 cd                	jne    803e27 <ipc_recvv+0x48>
+	if (perm_store)
+  803e5a:	85 f6                	test   %esi,%esi
+  803e5c:	74 e7                	je     803e45 <ipc_recvv+0x66>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  803e5e:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+}
+  803e64:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803e67:	5b                   	pop    %ebx
+  803e68:	5e                   	pop    %esi
+  803e69:	5f                   	pop    %edi
+  803e6a:	5d                   	pop    %ebp
+  803e6b:	c3                   	ret
+	if (perm_store)
+  803e6c:	85 f6                	test   %esi,%esi
+  803e6e:	75 bd                	jne    803e2d <ipc_recvv+0x4e>
+  803e70:	eb c9                	jmp    803e3b <ipc_recvv+0x5c>
+
+00803e72 <ipc_sendv>:
+// Each entry is a page address or'ed with the permissions to send
+// that page with (see sys_ipc_try_sendv).
+// Like ipc_send, keeps trying until it succeeds.
+void
+ipc_sendv(envid_t to_env, uint32_t val, const uintptr_t *pages, int npages)
+{
+  803e72:	55                   	push   %ebp
+  803e73:	89 e5                	mov    %esp,%ebp
+  803e75:	57                   	push   %edi
+  803e76:	56                   	push   %esi
+  803e77:	53                   	push   %ebx
+  803e78:	83 ec 0c             	sub    $0xc,%esp
+  803e7b:	8b 7d 08             	mov    0x8(%ebp),%edi
+  803e7e:	8b 75 0c             	mov    0xc(%ebp),%esi
+  803e81:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int r;
+
+	while ((r = sys_ipc_try_sendv(to_env, val, pages, npages))) {
+  803e84:	ff 75 14             	push   0x14(%ebp)
+  803e87:	53                   	push   %ebx
+  803e88:	56                   	push   %esi
+  803e89:	57                   	push   %edi
+  803e8a:	e8 0b d3 ff ff       	call   80119a <sys_ipc_try_sendv>
+  803e8f:	83 c4 10             	add    $0x10,%esp
+  803e92:	85 c0                	test   %eax,%eax
+  803e94:	74 22                	je     803eb8 <ipc_sendv+0x46>
+		assert(r == -E_IPC_NOT_RECV);
+  803e96:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  803e99:	75 07                	jne    803ea2 <ipc_sendv+0x30>
+		sys_yield();
+  803e9b:	e8 fe d0 ff ff       	call   800f9e <sys_yield>
+  803ea0:	eb e2                	jmp    803e84 <ipc_sendv+0x12>
+		assert(r == -E_IPC_NOT_RECV);
+  803ea2:	68 76 49 80 00       	push   $0x804976
+  803ea7:	68 ac 46 80 00       	push   $0x8046ac
+  803eac:	6a 5c                	push   $0x5c
+  803eae:	68 8b 49 80 00       	push   $0x80498b
+  803eb3:	e8 30 c6 ff ff       	call   8004e8 <_panic>
+	}
+}
+  803eb8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803ebb:	5b                   	pop    %ebx
+  803ebc:	5e                   	pop    %esi
+  803ebd:	5f                   	pop    %edi
+  803ebe:	5d                   	pop    %ebp
+  803ebf:	c3                   	ret
+
+00803ec0 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  803ec0:	55                   	push   %ebp
+  803ec1:	89 e5                	mov    %esp,%ebp
+  803ec3:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  803ec6:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (envs[i].env_type == type)
+  803ecb:	69 d0 8c 00 00 00    	imul   $0x8c,%eax,%edx
+  803ed1:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  803ed7:	8b 52 50             	mov    0x50(%edx),%edx
+  803eda:	39 ca                	cmp    %ecx,%edx
+  803edc:	74 11                	je     803eef <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  803ede:	83 c0 01             	add    $0x1,%eax
+  803ee1:	3d 00 04 00 00       	cmp    $0x400,%eax
+  803ee6:	75 e3                	jne    803ecb <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  803ee8:	b8 00 00 00 00       	mov    $0x0,%eax
+  803eed:	eb 0e                	jmp    803efd <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  803eef:	69 c0 8c 00 00 00    	imul   $0x8c,%eax,%eax
+  803ef5:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803efa:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  803efd:	5d                   	pop    %ebp
+  803efe:	c3                   	ret
+
+00803eff <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  803eff:	55                   	push   %ebp
+  803f00:	89 e5                	mov    %esp,%ebp
+  803f02:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  803f05:	89 c2                	mov    %eax,%edx
+  803f07:	c1 ea 16             	shr    $0x16,%edx
+  803f0a:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  803f11:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  803f16:	f6 c1 01             	test   $0x1,%cl
+  803f19:	74 22                	je     803f3d <pageref+0x3e>
+	pte = uvpt[PGNUM(v)];
+  803f1b:	c1 e8 0c             	shr    $0xc,%eax
+  803f1e:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  803f25:	a8 01                	test   $0x1,%al
+  803f27:	74 14                	je     803f3d <pageref+0x3e>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  803f29:	c1 e8 0c             	shr    $0xc,%eax
+  803f2c:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  803f2f:	8d 04 85 00 00 00 ef 	lea    -0x11000000(,%eax,4),%eax
+  803f36:	0f b7 50 08          	movzwl 0x8(%eax),%edx
+  803f3a:	0f b7 d2             	movzwl %dx,%edx
+}
+  803f3d:	89 d0                	mov    %edx,%eax
+  803f3f:	5d                   	pop    %ebp
+  803f40:	c3                   	ret
+
+00803f41 <dm>:
+  803f41:	55                   	push   %ebp
+  803f42:	57                   	push   %edi
+  803f43:	56                   	push   %esi
+  803f44:	53                   	push   %ebx
+  803f45:	83 ec 24             	sub    $0x24,%esp
+  803f48:	89 44 24 08          	mov    %eax,0x8(%esp)
+  803f4c:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  803f50:	8b 44 24 38          	mov    0x38(%esp),%eax
+  803f54:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  803f58:	89 44 24 10          	mov    %eax,0x10(%esp)
+  803f5c:	89 54 24 14          	mov    %edx,0x14(%esp)
+  803f60:	8b 7c 24 40          	mov    0x40(%esp),%edi
+  803f64:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  803f69:	b8 00 00 00 00       	mov    $0x0,%eax
+  803f6e:	ba 00 00 00 00       	mov    $0x0,%edx
+  803f73:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  803f7a:	00 
+  803f7b:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  803f82:	00 
+  803f83:	89 fb                	mov    %edi,%ebx
+  803f85:	eb 08                	jmp    803f8f <dm+0x4e>
+  803f87:	83 e9 01             	sub    $0x1,%ecx
+  803f8a:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  803f8d:	74 68                	je     803ff7 <dm+0xb6>
+  803f8f:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  803f93:	01 c0                	add    %eax,%eax
+  803f95:	89 c6                	mov    %eax,%esi
+  803f97:	89 d7                	mov    %edx,%edi
+  803f99:	8b 44 24 08          	mov    0x8(%esp),%eax
+  803f9d:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  803fa1:	0f ad d0             	shrd   %cl,%edx,%eax
+  803fa4:	d3 ea                	shr    %cl,%edx
+  803fa6:	f6 c1 20             	test   $0x20,%cl
+  803fa9:	74 04                	je     803faf <dm+0x6e>
+  803fab:	89 d0                	mov    %edx,%eax
+  803fad:	31 d2                	xor    %edx,%edx
+  803faf:	83 e0 01             	and    $0x1,%eax
+  803fb2:	89 04 24             	mov    %eax,(%esp)
+  803fb5:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  803fbc:	00 
+  803fbd:	8b 04 24             	mov    (%esp),%eax
+  803fc0:	8b 54 24 04          	mov    0x4(%esp),%edx
+  803fc4:	09 f0                	or     %esi,%eax
+  803fc6:	09 fa                	or     %edi,%edx
+  803fc8:	8b 74 24 10          	mov    0x10(%esp),%esi
+  803fcc:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  803fd0:	39 f0                	cmp    %esi,%eax
+  803fd2:	89 d5                	mov    %edx,%ebp
+  803fd4:	19 fd                	sbb    %edi,%ebp
+  803fd6:	72 af                	jb     803f87 <dm+0x46>
+  803fd8:	29 f0                	sub    %esi,%eax
+  803fda:	19 fa                	sbb    %edi,%edx
+  803fdc:	89 cf                	mov    %ecx,%edi
+  803fde:	c1 ef 05             	shr    $0x5,%edi
+  803fe1:	83 e7 01             	and    $0x1,%edi
+  803fe4:	89 fe                	mov    %edi,%esi
+  803fe6:	83 f6 01             	xor    $0x1,%esi
+  803fe9:	d3 e6                	shl    %cl,%esi
+  803feb:	d3 e7                	shl    %cl,%edi
+  803fed:	09 74 24 18          	or     %esi,0x18(%esp)
+  803ff1:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  803ff5:	eb 90                	jmp    803f87 <dm+0x46>
+  803ff7:	85 db                	test   %ebx,%ebx
+  803ff9:	74 05                	je     804000 <dm+0xbf>
+  803ffb:	89 03                	mov    %eax,(%ebx)
+  803ffd:	89 53 04             	mov    %edx,0x4(%ebx)
+  804000:	8b 44 24 18          	mov    0x18(%esp),%eax
+  804004:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  804008:	83 c4 24             	add    $0x24,%esp
+  80400b:	5b                   	pop    %ebx
+  80400c:	5e                   	pop    %esi
+  80400d:	5f                   	pop    %edi
+  80400e:	5d                   	pop    %ebp
+  80400f:	c3                   	ret
+
+00804010 <__udivdi3>:
+  804010:	83 ec 08             	sub    $0x8,%esp
+  804013:	6a 00                	push   $0x0
+  804015:	ff 74 24 1c          	push   0x1c(%esp)
+  804019:	ff 74 24 1c          	push   0x1c(%esp)
+  80401d:	8b 44 24 18          	mov    0x18(%esp),%eax
+  804021:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  804025:	e8 17 ff ff ff       	call   803f41 <dm>
+  80402a:	83 c4 14             	add    $0x14,%esp
+  80402d:	c3                   	ret
+
+0080402e <__umoddi3>:
+  80402e:	83 ec 18             	sub    $0x18,%esp
+  804031:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  804035:	50                   	push   %eax
+  804036:	ff 74 24 2c          	push   0x2c(%esp)
+  80403a:	ff 74 24 2c          	push   0x2c(%esp)
+  80403e:	8b 44 24 28          	mov    0x28(%esp),%eax
+  804042:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  804046:	e8 f6 fe ff ff       	call   803f41 <dm>
+  80404b:	8b 44 24 18          	mov    0x18(%esp),%eax
+  80404f:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  804053:	83 c4 24             	add    $0x24,%esp
+  804056:	c3                   	ret
+
+00804057 <__divdi3>:
+  804057:	53                   	push   %ebx
+  804058:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80405c:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  804060:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  804064:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  804068:	85 d2                	test   %edx,%edx
+  80406a:	78 15                	js     804081 <__divdi3+0x2a>
+  80406c:	85 db                	test   %ebx,%ebx
+  80406e:	78 34                	js     8040a4 <__divdi3+0x4d>
+  804070:	83 ec 04             	sub    $0x4,%esp
+  804073:	6a 00                	push   $0x0
+  804075:	53                   	push   %ebx
+  804076:	51                   	push   %ecx
+  804077:	e8 c5 fe ff ff       	call   803f41 <dm>
+  80407c:	83 c4 10             	add    $0x10,%esp
+  80407f:	eb 21                	jmp    8040a2 <__divdi3+0x4b>
+  804081:	f7 d8                	neg    %eax
+  804083:	83 d2 00             	adc    $0x0,%edx
+  804086:	f7 da                	neg    %edx
+  804088:	85 db                	test   %ebx,%ebx
+  80408a:	78 30                	js     8040bc <__divdi3+0x65>
+  80408c:	83 ec 04             	sub    $0x4,%esp
+  80408f:	6a 00                	push   $0x0
+  804091:	53                   	push   %ebx
+  804092:	51                   	push   %ecx
+  804093:	e8 a9 fe ff ff       	call   803f41 <dm>
+  804098:	83 c4 10             	add    $0x10,%esp
+  80409b:	f7 d8                	neg    %eax
+  80409d:	83 d2 00             	adc    $0x0,%edx
+  8040a0:	f7 da                	neg    %edx
+  8040a2:	5b                   	pop    %ebx
+  8040a3:	c3                   	ret
+  8040a4:	83 ec 04             	sub    $0x4,%esp
+  8040a7:	6a 00                	push   $0x0
+  8040a9:	f7 d9                	neg    %ecx
+  8040ab:	83 d3 00             	adc    $0x0,%ebx
+  8040ae:	f7 db                	neg    %ebx
+  8040b0:	53                   	push   %ebx
+  8040b1:	51                   	push   %ecx
+  8040b2:	e8 8a fe ff ff       	call   803f41 <dm>
+  8040b7:	83 c4 10             	add    $0x10,%esp
+  8040ba:	eb df                	jmp    80409b <__divdi3+0x44>
+  8040bc:	83 ec 04             	sub    $0x4,%esp
+  8040bf:	6a 00                	push   $0x0
+  8040c1:	f7 d9                	neg    %ecx
+  8040c3:	83 d3 00             	adc    $0x0,%ebx
+  8040c6:	f7 db                	neg    %ebx
+  8040c8:	53                   	push   %ebx
+  8040c9:	51                   	push   %ecx
+  8040ca:	e8 72 fe ff ff       	call   803f41 <dm>
+  8040cf:	83 c4 10             	add    $0x10,%esp
+  8040d2:	eb ce                	jmp    8040a2 <__divdi3+0x4b>
+
+008040d4 <__moddi3>:
+  8040d4:	55                   	push   %ebp
+  8040d5:	57                   	push   %edi
+  8040d6:	56                   	push   %esi
+  8040d7:	53                   	push   %ebx
+  8040d8:	83 ec 24             	sub    $0x24,%esp
+  8040db:	8b 44 24 38          	mov    0x38(%esp),%eax
+  8040df:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  8040e3:	8b 4c 24 40          	mov    0x40(%esp),%ecx
+  8040e7:	8b 5c 24 44          	mov    0x44(%esp),%ebx
+  8040eb:	85 d2                	test   %edx,%edx
+  8040ed:	78 3b                	js     80412a <__moddi3+0x56>
+  8040ef:	83 ec 04             	sub    $0x4,%esp
+  8040f2:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  8040f6:	56                   	push   %esi
+  8040f7:	89 ce                	mov    %ecx,%esi
+  8040f9:	f7 de                	neg    %esi
+  8040fb:	89 74 24 08          	mov    %esi,0x8(%esp)
+  8040ff:	89 de                	mov    %ebx,%esi
+  804101:	83 d6 00             	adc    $0x0,%esi
+  804104:	f7 de                	neg    %esi
+  804106:	89 74 24 14          	mov    %esi,0x14(%esp)
+  80410a:	8b 74 24 08          	mov    0x8(%esp),%esi
+  80410e:	0f 48 f1             	cmovs  %ecx,%esi
+  804111:	0f 49 5c 24 14       	cmovns 0x14(%esp),%ebx
+  804116:	53                   	push   %ebx
+  804117:	56                   	push   %esi
+  804118:	e8 24 fe ff ff       	call   803f41 <dm>
+  80411d:	8b 44 24 28          	mov    0x28(%esp),%eax
+  804121:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  804125:	83 c4 10             	add    $0x10,%esp
+  804128:	eb 47                	jmp    804171 <__moddi3+0x9d>
+  80412a:	f7 d8                	neg    %eax
+  80412c:	83 d2 00             	adc    $0x0,%edx
+  80412f:	f7 da                	neg    %edx
+  804131:	83 ec 04             	sub    $0x4,%esp
+  804134:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  804138:	56                   	push   %esi
+  804139:	89 cf                	mov    %ecx,%edi
+  80413b:	f7 df                	neg    %edi
+  80413d:	89 de                	mov    %ebx,%esi
+  80413f:	83 d6 00             	adc    $0x0,%esi
+  804142:	f7 de                	neg    %esi
+  804144:	0f 49 cf             	cmovns %edi,%ecx
+  804147:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  80414b:	0f 49 de             	cmovns %esi,%ebx
+  80414e:	89 5c 24 0c          	mov    %ebx,0xc(%esp)
+  804152:	ff 74 24 0c          	push   0xc(%esp)
+  804156:	ff 74 24 0c          	push   0xc(%esp)
+  80415a:	e8 e2 fd ff ff       	call   803f41 <dm>
+  80415f:	8b 44 24 28          	mov    0x28(%esp),%eax
+  804163:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  804167:	f7 d8                	neg    %eax
+  804169:	83 d2 00             	adc    $0x0,%edx
+  80416c:	f7 da                	neg    %edx
+  80416e:	83 c4 10             	add    $0x10,%esp
+  804171:	83 c4 24             	add    $0x24,%esp
+  804174:	5b                   	pop    %ebx
+  804175:	5e                   	pop    %esi
+  804176:	5f                   	pop    %edi
+  804177:	5d                   	pop    %ebp
+  804178:	c3                   	ret
@@ -0,0 +1,7720 @@
+
+obj/user/testtime.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 c5 00 00 00       	call   8000f6 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <sleep>:
+#include <inc/lib.h>
+#include <inc/x86.h>
+
+void
+sleep(int sec)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	53                   	push   %ebx
+  800037:	83 ec 04             	sub    $0x4,%esp
+	unsigned now = sys_time_msec();
+  80003a:	e8 8e 0e 00 00       	call   800ecd <sys_time_msec>
+	unsigned end = now + sec * 1000;
+  80003f:	69 5d 08 e8 03 00 00 	imul   $0x3e8,0x8(%ebp),%ebx
+  800046:	01 c3                	add    %eax,%ebx
+
+	if ((int)now < 0 && (int)now > -MAXERROR)
+  800048:	85 c0                	test   %eax,%eax
+  80004a:	79 05                	jns    800051 <sleep+0x1e>
+  80004c:	83 f8 ef             	cmp    $0xffffffef,%eax
+  80004f:	7d 18                	jge    800069 <sleep+0x36>
+		panic("sys_time_msec: %e", (int)now);
+	if (end < now)
+  800051:	39 c3                	cmp    %eax,%ebx
+  800053:	73 2b                	jae    800080 <sleep+0x4d>
+		panic("sleep: wrap");
+  800055:	83 ec 04             	sub    $0x4,%esp
+  800058:	68 22 38 80 00       	push   $0x803822
+  80005d:	6a 0d                	push   $0xd
+  80005f:	68 12 38 80 00       	push   $0x803812
+  800064:	e8 f0 00 00 00       	call   800159 <_panic>
+		panic("sys_time_msec: %e", (int)now);
+  800069:	50                   	push   %eax
+  80006a:	68 00 38 80 00       	push   $0x803800
+  80006f:	6a 0b                	push   $0xb
+  800071:	68 12 38 80 00       	push   $0x803812
+  800076:	e8 de 00 00 00       	call   800159 <_panic>
+
+	while (sys_time_msec() < end)
+		sys_yield();
+  80007b:	e8 8f 0b 00 00       	call   800c0f <sys_yield>
+	while (sys_time_msec() < end)
+  800080:	e8 48 0e 00 00       	call   800ecd <sys_time_msec>
+  800085:	39 d8                	cmp    %ebx,%eax
+  800087:	72 f2                	jb     80007b <sleep+0x48>
+}
+  800089:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80008c:	c9                   	leave
+  80008d:	c3                   	ret
+
+0080008e <umain>:
+
+void
+umain(int argc, char **argv)
+{
+  80008e:	55                   	push   %ebp
+  80008f:	89 e5                	mov    %esp,%ebp
+  800091:	53                   	push   %ebx
+  800092:	83 ec 04             	sub    $0x4,%esp
+	int i;
+
+	// Wait for the console to calm down
+	for (i = 0; i < 50; i++)
+  800095:	bb 33 00 00 00       	mov    $0x33,%ebx
+  80009a:	eb 05                	jmp    8000a1 <umain+0x13>
+		sys_yield();
+  80009c:	e8 6e 0b 00 00       	call   800c0f <sys_yield>
+	for (i = 0; i < 50; i++)
+  8000a1:	83 eb 01             	sub    $0x1,%ebx
+  8000a4:	75 f6                	jne    80009c <umain+0xe>
+
+	cprintf("starting count down: ");
+  8000a6:	83 ec 0c             	sub    $0xc,%esp
+  8000a9:	68 2e 38 80 00       	push   $0x80382e
+  8000ae:	e8 81 01 00 00       	call   800234 <cprintf>
+  8000b3:	83 c4 10             	add    $0x10,%esp
+	for (i = 5; i >= 0; i--) {
+  8000b6:	bb 05 00 00 00       	mov    $0x5,%ebx
+		cprintf("%d ", i);
+  8000bb:	83 ec 08             	sub    $0x8,%esp
+  8000be:	53                   	push   %ebx
+  8000bf:	68 44 38 80 00       	push   $0x803844
+  8000c4:	e8 6b 01 00 00       	call   800234 <cprintf>
+		sleep(1);
+  8000c9:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+  8000d0:	e8 5e ff ff ff       	call   800033 <sleep>
+	for (i = 5; i >= 0; i--) {
+  8000d5:	83 eb 01             	sub    $0x1,%ebx
+  8000d8:	83 c4 10             	add    $0x10,%esp
+  8000db:	83 fb ff             	cmp    $0xffffffff,%ebx
+  8000de:	75 db                	jne    8000bb <umain+0x2d>
+	}
+	cprintf("\n");
+  8000e0:	83 ec 0c             	sub    $0xc,%esp
+  8000e3:	68 27 3d 80 00       	push   $0x803d27
+  8000e8:	e8 47 01 00 00       	call   800234 <cprintf>
+#include <inc/types.h>
+
+static inline void
+breakpoint(void)
+{
+	asm volatile("int3");
+  8000ed:	cc                   	int3
+	breakpoint();
+}
+  8000ee:	83 c4 10             	add    $0x10,%esp
+  8000f1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8000f4:	c9                   	leave
+  8000f5:	c3                   	ret
+
+008000f6 <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  8000f6:	55                   	push   %ebp
+  8000f7:	89 e5                	mov    %esp,%ebp
+  8000f9:	56                   	push   %esi
+  8000fa:	53                   	push   %ebx
+  8000fb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8000fe:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = &envs[ENVX(sys_getenvid())];
+  800101:	e8 e2 0a 00 00       	call   800be8 <sys_getenvid>
+  800106:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80010b:	69 c0 8c 00 00 00    	imul   $0x8c,%eax,%eax
+  800111:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800116:	a3 00 50 80 00       	mov    %eax,0x805000
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  80011b:	85 db                	test   %ebx,%ebx
+  80011d:	7e 07                	jle    800126 <libmain+0x30>
+		binaryname = argv[0];
+  80011f:	8b 06                	mov    (%esi),%eax
+  800121:	a3 00 40 80 00       	mov    %eax,0x804000
+
+	// call user main routine
+	umain(argc, argv);
+  800126:	83 ec 08             	sub    $0x8,%esp
+  800129:	56                   	push   %esi
+  80012a:	53                   	push   %ebx
+  80012b:	e8 5e ff ff ff       	call   80008e <umain>
+
+	// exit gracefully
+	exit();
+  800130:	e8 0a 00 00 00       	call   80013f <exit>
+}
+  800135:	83 c4 10             	add    $0x10,%esp
+  800138:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80013b:	5b                   	pop    %ebx
+  80013c:	5e                   	pop    %esi
+  80013d:	5d                   	pop    %ebp
+  80013e:	c3                   	ret
+
+0080013f <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  80013f:	55                   	push   %ebp
+  800140:	89 e5                	mov    %esp,%ebp
+  800142:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  800145:	e8 b9 10 00 00       	call   801203 <close_all>
+	sys_env_destroy(0);
+  80014a:	83 ec 0c             	sub    $0xc,%esp
+  80014d:	6a 00                	push   $0x0
+  80014f:	e8 4b 0a 00 00       	call   800b9f <sys_env_destroy>
+}
+  800154:	83 c4 10             	add    $0x10,%esp
+  800157:	c9                   	leave
+  800158:	c3                   	ret
+
+00800159 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  800159:	55                   	push   %ebp
+  80015a:	89 e5                	mov    %esp,%ebp
+  80015c:	56                   	push   %esi
+  80015d:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  80015e:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  800161:	8b 35 00 40 80 00    	mov    0x804000,%esi
+  800167:	e8 7c 0a 00 00       	call   800be8 <sys_getenvid>
+  80016c:	83 ec 0c             	sub    $0xc,%esp
+  80016f:	ff 75 0c             	push   0xc(%ebp)
+  800172:	ff 75 08             	push   0x8(%ebp)
+  800175:	56                   	push   %esi
+  800176:	50                   	push   %eax
+  800177:	68 54 38 80 00       	push   $0x803854
+  80017c:	e8 b3 00 00 00       	call   800234 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  800181:	83 c4 18             	add    $0x18,%esp
+  800184:	53                   	push   %ebx
+  800185:	ff 75 10             	push   0x10(%ebp)
+  800188:	e8 56 00 00 00       	call   8001e3 <vcprintf>
+	cprintf("\n");
+  80018d:	c7 04 24 27 3d 80 00 	movl   $0x803d27,(%esp)
+  800194:	e8 9b 00 00 00       	call   800234 <cprintf>
+  800199:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  80019c:	cc                   	int3
+	while (1)
+  80019d:	eb fd                	jmp    80019c <_panic+0x43>
+
+0080019f <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  80019f:	55                   	push   %ebp
+  8001a0:	89 e5                	mov    %esp,%ebp
+  8001a2:	53                   	push   %ebx
+  8001a3:	83 ec 04             	sub    $0x4,%esp
+  8001a6:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  8001a9:	8b 13                	mov    (%ebx),%edx
+  8001ab:	8d 42 01             	lea    0x1(%edx),%eax
+  8001ae:	89 03                	mov    %eax,(%ebx)
+  8001b0:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8001b3:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  8001b7:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8001bc:	74 09                	je     8001c7 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  8001be:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  8001c2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8001c5:	c9                   	leave
+  8001c6:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  8001c7:	83 ec 08             	sub    $0x8,%esp
+  8001ca:	68 ff 00 00 00       	push   $0xff
+  8001cf:	8d 43 08             	lea    0x8(%ebx),%eax
+  8001d2:	50                   	push   %eax
+  8001d3:	e8 7a 09 00 00       	call   800b52 <sys_cputs>
+		b->idx = 0;
+  8001d8:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8001de:	83 c4 10             	add    $0x10,%esp
+  8001e1:	eb db                	jmp    8001be <putch+0x1f>
+
+008001e3 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8001e3:	55                   	push   %ebp
+  8001e4:	89 e5                	mov    %esp,%ebp
+  8001e6:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  8001ec:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8001f3:	00 00 00 
+	b.cnt = 0;
+  8001f6:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8001fd:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  800200:	ff 75 0c             	push   0xc(%ebp)
+  800203:	ff 75 08             	push   0x8(%ebp)
+  800206:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  80020c:	50                   	push   %eax
+  80020d:	68 9f 01 80 00       	push   $0x80019f
+  800212:	e8 14 01 00 00       	call   80032b <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  800217:	83 c4 08             	add    $0x8,%esp
+  80021a:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  800220:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  800226:	50                   	push   %eax
+  800227:	e8 26 09 00 00       	call   800b52 <sys_cputs>
+
+	return b.cnt;
+}
+  80022c:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800232:	c9                   	leave
+  800233:	c3                   	ret
+
+00800234 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  800234:	55                   	push   %ebp
+  800235:	89 e5                	mov    %esp,%ebp
+  800237:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  80023a:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  80023d:	50                   	push   %eax
+  80023e:	ff 75 08             	push   0x8(%ebp)
+  800241:	e8 9d ff ff ff       	call   8001e3 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  800246:	c9                   	leave
+  800247:	c3                   	ret
+
+00800248 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  800248:	55                   	push   %ebp
+  800249:	89 e5                	mov    %esp,%ebp
+  80024b:	57                   	push   %edi
+  80024c:	56                   	push   %esi
+  80024d:	53                   	push   %ebx
+  80024e:	83 ec 1c             	sub    $0x1c,%esp
+  800251:	89 c7                	mov    %eax,%edi
+  800253:	89 d6                	mov    %edx,%esi
+  800255:	8b 45 08             	mov    0x8(%ebp),%eax
+  800258:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80025b:	89 d1                	mov    %edx,%ecx
+  80025d:	89 c2                	mov    %eax,%edx
+  80025f:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800262:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800265:	8b 45 10             	mov    0x10(%ebp),%eax
+  800268:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  80026b:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80026e:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800275:	39 c2                	cmp    %eax,%edx
+  800277:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  80027a:	72 3e                	jb     8002ba <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  80027c:	83 ec 0c             	sub    $0xc,%esp
+  80027f:	ff 75 18             	push   0x18(%ebp)
+  800282:	83 eb 01             	sub    $0x1,%ebx
+  800285:	53                   	push   %ebx
+  800286:	50                   	push   %eax
+  800287:	83 ec 08             	sub    $0x8,%esp
+  80028a:	ff 75 e4             	push   -0x1c(%ebp)
+  80028d:	ff 75 e0             	push   -0x20(%ebp)
+  800290:	ff 75 dc             	push   -0x24(%ebp)
+  800293:	ff 75 d8             	push   -0x28(%ebp)
+  800296:	e8 f1 33 00 00       	call   80368c <__udivdi3>
+  80029b:	83 c4 18             	add    $0x18,%esp
+  80029e:	52                   	push   %edx
+  80029f:	50                   	push   %eax
+  8002a0:	89 f2                	mov    %esi,%edx
+  8002a2:	89 f8                	mov    %edi,%eax
+  8002a4:	e8 9f ff ff ff       	call   800248 <printnum>
+  8002a9:	83 c4 20             	add    $0x20,%esp
+  8002ac:	eb 13                	jmp    8002c1 <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  8002ae:	83 ec 08             	sub    $0x8,%esp
+  8002b1:	56                   	push   %esi
+  8002b2:	ff 75 18             	push   0x18(%ebp)
+  8002b5:	ff d7                	call   *%edi
+  8002b7:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  8002ba:	83 eb 01             	sub    $0x1,%ebx
+  8002bd:	85 db                	test   %ebx,%ebx
+  8002bf:	7f ed                	jg     8002ae <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  8002c1:	83 ec 08             	sub    $0x8,%esp
+  8002c4:	56                   	push   %esi
+  8002c5:	83 ec 04             	sub    $0x4,%esp
+  8002c8:	ff 75 e4             	push   -0x1c(%ebp)
+  8002cb:	ff 75 e0             	push   -0x20(%ebp)
+  8002ce:	ff 75 dc             	push   -0x24(%ebp)
+  8002d1:	ff 75 d8             	push   -0x28(%ebp)
+  8002d4:	e8 d1 33 00 00       	call   8036aa <__umoddi3>
+  8002d9:	83 c4 14             	add    $0x14,%esp
+  8002dc:	0f be 80 77 38 80 00 	movsbl 0x803877(%eax),%eax
+  8002e3:	50                   	push   %eax
+  8002e4:	ff d7                	call   *%edi
+}
+  8002e6:	83 c4 10             	add    $0x10,%esp
+  8002e9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8002ec:	5b                   	pop    %ebx
+  8002ed:	5e                   	pop    %esi
+  8002ee:	5f                   	pop    %edi
+  8002ef:	5d                   	pop    %ebp
+  8002f0:	c3                   	ret
+
+008002f1 <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  8002f1:	55                   	push   %ebp
+  8002f2:	89 e5                	mov    %esp,%ebp
+  8002f4:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  8002f7:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  8002fb:	8b 10                	mov    (%eax),%edx
+  8002fd:	3b 50 04             	cmp    0x4(%eax),%edx
+  800300:	73 0a                	jae    80030c <sprintputch+0x1b>
+		*b->buf++ = ch;
+  800302:	8d 4a 01             	lea    0x1(%edx),%ecx
+  800305:	89 08                	mov    %ecx,(%eax)
+  800307:	8b 45 08             	mov    0x8(%ebp),%eax
+  80030a:	88 02                	mov    %al,(%edx)
+}
+  80030c:	5d                   	pop    %ebp
+  80030d:	c3                   	ret
+
+0080030e <printfmt>:
+{
+  80030e:	55                   	push   %ebp
+  80030f:	89 e5                	mov    %esp,%ebp
+  800311:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  800314:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  800317:	50                   	push   %eax
+  800318:	ff 75 10             	push   0x10(%ebp)
+  80031b:	ff 75 0c             	push   0xc(%ebp)
+  80031e:	ff 75 08             	push   0x8(%ebp)
+  800321:	e8 05 00 00 00       	call   80032b <vprintfmt>
+}
+  800326:	83 c4 10             	add    $0x10,%esp
+  800329:	c9                   	leave
+  80032a:	c3                   	ret
+
+0080032b <vprintfmt>:
+{
+  80032b:	55                   	push   %ebp
+  80032c:	89 e5                	mov    %esp,%ebp
+  80032e:	57                   	push   %edi
+  80032f:	56                   	push   %esi
+  800330:	53                   	push   %ebx
+  800331:	83 ec 2c             	sub    $0x2c,%esp
+  800334:	8b 75 08             	mov    0x8(%ebp),%esi
+  800337:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80033a:	8b 7d 10             	mov    0x10(%ebp),%edi
+  80033d:	eb 0a                	jmp    800349 <vprintfmt+0x1e>
+			putch(ch, putdat);
+  80033f:	83 ec 08             	sub    $0x8,%esp
+  800342:	53                   	push   %ebx
+  800343:	50                   	push   %eax
+  800344:	ff d6                	call   *%esi
+  800346:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800349:	83 c7 01             	add    $0x1,%edi
+  80034c:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  800350:	83 f8 25             	cmp    $0x25,%eax
+  800353:	74 0c                	je     800361 <vprintfmt+0x36>
+			if (ch == '\0')
+  800355:	85 c0                	test   %eax,%eax
+  800357:	75 e6                	jne    80033f <vprintfmt+0x14>
+}
+  800359:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80035c:	5b                   	pop    %ebx
+  80035d:	5e                   	pop    %esi
+  80035e:	5f                   	pop    %edi
+  80035f:	5d                   	pop    %ebp
+  800360:	c3                   	ret
+		padc = ' ';
+  800361:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  800365:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  80036c:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  800373:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  80037a:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  80037f:	8d 47 01             	lea    0x1(%edi),%eax
+  800382:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800385:	0f b6 17             	movzbl (%edi),%edx
+  800388:	8d 42 dd             	lea    -0x23(%edx),%eax
+  80038b:	3c 55                	cmp    $0x55,%al
+  80038d:	0f 87 cf 03 00 00    	ja     800762 <vprintfmt+0x437>
+  800393:	0f b6 c0             	movzbl %al,%eax
+  800396:	ff 24 85 e0 39 80 00 	jmp    *0x8039e0(,%eax,4)
+  80039d:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  8003a0:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  8003a4:	eb d9                	jmp    80037f <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  8003a6:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8003a9:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  8003ad:	eb d0                	jmp    80037f <vprintfmt+0x54>
+  8003af:	0f b6 d2             	movzbl %dl,%edx
+  8003b2:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  8003b5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003ba:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  8003bd:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  8003c0:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  8003c4:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  8003c7:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  8003ca:	83 f9 09             	cmp    $0x9,%ecx
+  8003cd:	77 55                	ja     800424 <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  8003cf:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  8003d2:	eb e9                	jmp    8003bd <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  8003d4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003d7:	8b 00                	mov    (%eax),%eax
+  8003d9:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8003dc:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003df:	8d 40 04             	lea    0x4(%eax),%eax
+  8003e2:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  8003e5:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  8003e8:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8003ec:	79 91                	jns    80037f <vprintfmt+0x54>
+				width = precision, precision = -1;
+  8003ee:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8003f1:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8003f4:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  8003fb:	eb 82                	jmp    80037f <vprintfmt+0x54>
+			if (width < 0)
+  8003fd:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800400:	85 d2                	test   %edx,%edx
+  800402:	b8 00 00 00 00       	mov    $0x0,%eax
+  800407:	0f 49 c2             	cmovns %edx,%eax
+  80040a:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  80040d:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800410:	e9 6a ff ff ff       	jmp    80037f <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  800415:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  800418:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  80041f:	e9 5b ff ff ff       	jmp    80037f <vprintfmt+0x54>
+  800424:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800427:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80042a:	eb bc                	jmp    8003e8 <vprintfmt+0xbd>
+			lflag++;
+  80042c:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  80042f:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800432:	e9 48 ff ff ff       	jmp    80037f <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  800437:	8b 45 14             	mov    0x14(%ebp),%eax
+  80043a:	8d 78 04             	lea    0x4(%eax),%edi
+  80043d:	83 ec 08             	sub    $0x8,%esp
+  800440:	53                   	push   %ebx
+  800441:	ff 30                	push   (%eax)
+  800443:	ff d6                	call   *%esi
+			break;
+  800445:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  800448:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  80044b:	e9 b1 02 00 00       	jmp    800701 <vprintfmt+0x3d6>
+			err = va_arg(ap, int);
+  800450:	8b 45 14             	mov    0x14(%ebp),%eax
+  800453:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  800456:	8b 10                	mov    (%eax),%edx
+  800458:	89 d0                	mov    %edx,%eax
+  80045a:	f7 d8                	neg    %eax
+  80045c:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  80045f:	83 f8 11             	cmp    $0x11,%eax
+  800462:	7f 23                	jg     800487 <vprintfmt+0x15c>
+  800464:	8b 14 85 40 3b 80 00 	mov    0x803b40(,%eax,4),%edx
+  80046b:	85 d2                	test   %edx,%edx
+  80046d:	74 18                	je     800487 <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  80046f:	52                   	push   %edx
+  800470:	68 92 3c 80 00       	push   $0x803c92
+  800475:	53                   	push   %ebx
+  800476:	56                   	push   %esi
+  800477:	e8 92 fe ff ff       	call   80030e <printfmt>
+  80047c:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  80047f:	89 7d 14             	mov    %edi,0x14(%ebp)
+  800482:	e9 7a 02 00 00       	jmp    800701 <vprintfmt+0x3d6>
+				printfmt(putch, putdat, "error %d", err);
+  800487:	50                   	push   %eax
+  800488:	68 8f 38 80 00       	push   $0x80388f
+  80048d:	53                   	push   %ebx
+  80048e:	56                   	push   %esi
+  80048f:	e8 7a fe ff ff       	call   80030e <printfmt>
+  800494:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  800497:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  80049a:	e9 62 02 00 00       	jmp    800701 <vprintfmt+0x3d6>
+			if ((p = va_arg(ap, char *)) == NULL)
+  80049f:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004a2:	83 c0 04             	add    $0x4,%eax
+  8004a5:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  8004a8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004ab:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  8004ad:	85 c9                	test   %ecx,%ecx
+  8004af:	b8 88 38 80 00       	mov    $0x803888,%eax
+  8004b4:	0f 45 c1             	cmovne %ecx,%eax
+  8004b7:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  8004ba:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8004be:	7e 06                	jle    8004c6 <vprintfmt+0x19b>
+  8004c0:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  8004c4:	75 0b                	jne    8004d1 <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8004c6:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  8004c9:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  8004cc:	89 75 08             	mov    %esi,0x8(%ebp)
+  8004cf:	eb 5c                	jmp    80052d <vprintfmt+0x202>
+  8004d1:	83 ec 08             	sub    $0x8,%esp
+  8004d4:	ff 75 d0             	push   -0x30(%ebp)
+  8004d7:	ff 75 cc             	push   -0x34(%ebp)
+  8004da:	e8 20 03 00 00       	call   8007ff <strnlen>
+  8004df:	89 c2                	mov    %eax,%edx
+  8004e1:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8004e4:	29 d0                	sub    %edx,%eax
+  8004e6:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  8004e9:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  8004ed:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8004f0:	89 75 08             	mov    %esi,0x8(%ebp)
+  8004f3:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8004f5:	eb 0e                	jmp    800505 <vprintfmt+0x1da>
+					putch(padc, putdat);
+  8004f7:	83 ec 08             	sub    $0x8,%esp
+  8004fa:	53                   	push   %ebx
+  8004fb:	57                   	push   %edi
+  8004fc:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  8004ff:	83 ee 01             	sub    $0x1,%esi
+  800502:	83 c4 10             	add    $0x10,%esp
+  800505:	85 f6                	test   %esi,%esi
+  800507:	7f ee                	jg     8004f7 <vprintfmt+0x1cc>
+  800509:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80050c:	8b 75 08             	mov    0x8(%ebp),%esi
+  80050f:	85 c0                	test   %eax,%eax
+  800511:	ba 00 00 00 00       	mov    $0x0,%edx
+  800516:	0f 49 d0             	cmovns %eax,%edx
+  800519:	29 d0                	sub    %edx,%eax
+  80051b:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80051e:	eb a6                	jmp    8004c6 <vprintfmt+0x19b>
+					putch(ch, putdat);
+  800520:	83 ec 08             	sub    $0x8,%esp
+  800523:	53                   	push   %ebx
+  800524:	52                   	push   %edx
+  800525:	ff 55 08             	call   *0x8(%ebp)
+  800528:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  80052b:	89 f1                	mov    %esi,%ecx
+  80052d:	8d 71 01             	lea    0x1(%ecx),%esi
+  800530:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800534:	0f be d0             	movsbl %al,%edx
+  800537:	85 d2                	test   %edx,%edx
+  800539:	74 28                	je     800563 <vprintfmt+0x238>
+  80053b:	85 ff                	test   %edi,%edi
+  80053d:	78 05                	js     800544 <vprintfmt+0x219>
+  80053f:	83 ef 01             	sub    $0x1,%edi
+  800542:	78 30                	js     800574 <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  800544:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800548:	74 d6                	je     800520 <vprintfmt+0x1f5>
+  80054a:	0f be c0             	movsbl %al,%eax
+  80054d:	83 e8 20             	sub    $0x20,%eax
+  800550:	83 f8 5e             	cmp    $0x5e,%eax
+  800553:	76 cb                	jbe    800520 <vprintfmt+0x1f5>
+					putch('?', putdat);
+  800555:	83 ec 08             	sub    $0x8,%esp
+  800558:	53                   	push   %ebx
+  800559:	6a 3f                	push   $0x3f
+  80055b:	ff 55 08             	call   *0x8(%ebp)
+  80055e:	83 c4 10             	add    $0x10,%esp
+  800561:	eb c8                	jmp    80052b <vprintfmt+0x200>
+  800563:	8b 75 08             	mov    0x8(%ebp),%esi
+  800566:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800569:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  80056c:	01 d0                	add    %edx,%eax
+  80056e:	29 c8                	sub    %ecx,%eax
+  800570:	89 c7                	mov    %eax,%edi
+  800572:	eb 13                	jmp    800587 <vprintfmt+0x25c>
+  800574:	8b 75 08             	mov    0x8(%ebp),%esi
+  800577:	eb ed                	jmp    800566 <vprintfmt+0x23b>
+				putch(' ', putdat);
+  800579:	83 ec 08             	sub    $0x8,%esp
+  80057c:	53                   	push   %ebx
+  80057d:	6a 20                	push   $0x20
+  80057f:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  800581:	83 ef 01             	sub    $0x1,%edi
+  800584:	83 c4 10             	add    $0x10,%esp
+  800587:	85 ff                	test   %edi,%edi
+  800589:	7f ee                	jg     800579 <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  80058b:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  80058e:	89 45 14             	mov    %eax,0x14(%ebp)
+  800591:	e9 6b 01 00 00       	jmp    800701 <vprintfmt+0x3d6>
+	if (lflag >= 2)
+  800596:	83 f9 01             	cmp    $0x1,%ecx
+  800599:	7f 1f                	jg     8005ba <vprintfmt+0x28f>
+	else if (lflag)
+  80059b:	85 c9                	test   %ecx,%ecx
+  80059d:	74 67                	je     800606 <vprintfmt+0x2db>
+		return va_arg(*ap, long);
+  80059f:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005a2:	8b 00                	mov    (%eax),%eax
+  8005a4:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8005a7:	89 c1                	mov    %eax,%ecx
+  8005a9:	c1 f9 1f             	sar    $0x1f,%ecx
+  8005ac:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8005af:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005b2:	8d 40 04             	lea    0x4(%eax),%eax
+  8005b5:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005b8:	eb 17                	jmp    8005d1 <vprintfmt+0x2a6>
+		return va_arg(*ap, long long);
+  8005ba:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005bd:	8b 50 04             	mov    0x4(%eax),%edx
+  8005c0:	8b 00                	mov    (%eax),%eax
+  8005c2:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8005c5:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8005c8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005cb:	8d 40 08             	lea    0x8(%eax),%eax
+  8005ce:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  8005d1:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8005d4:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  8005d7:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  8005dc:	85 c9                	test   %ecx,%ecx
+  8005de:	0f 89 03 01 00 00    	jns    8006e7 <vprintfmt+0x3bc>
+				putch('-', putdat);
+  8005e4:	83 ec 08             	sub    $0x8,%esp
+  8005e7:	53                   	push   %ebx
+  8005e8:	6a 2d                	push   $0x2d
+  8005ea:	ff d6                	call   *%esi
+				num = -(long long) num;
+  8005ec:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8005ef:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8005f2:	f7 da                	neg    %edx
+  8005f4:	83 d1 00             	adc    $0x0,%ecx
+  8005f7:	f7 d9                	neg    %ecx
+  8005f9:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  8005fc:	bf 0a 00 00 00       	mov    $0xa,%edi
+  800601:	e9 e1 00 00 00       	jmp    8006e7 <vprintfmt+0x3bc>
+		return va_arg(*ap, int);
+  800606:	8b 45 14             	mov    0x14(%ebp),%eax
+  800609:	8b 00                	mov    (%eax),%eax
+  80060b:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80060e:	89 c1                	mov    %eax,%ecx
+  800610:	c1 f9 1f             	sar    $0x1f,%ecx
+  800613:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800616:	8b 45 14             	mov    0x14(%ebp),%eax
+  800619:	8d 40 04             	lea    0x4(%eax),%eax
+  80061c:	89 45 14             	mov    %eax,0x14(%ebp)
+  80061f:	eb b0                	jmp    8005d1 <vprintfmt+0x2a6>
+	if (lflag >= 2)
+  800621:	83 f9 01             	cmp    $0x1,%ecx
+  800624:	7f 1e                	jg     800644 <vprintfmt+0x319>
+	else if (lflag)
+  800626:	85 c9                	test   %ecx,%ecx
+  800628:	74 32                	je     80065c <vprintfmt+0x331>
+		return va_arg(*ap, unsigned long);
+  80062a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80062d:	8b 10                	mov    (%eax),%edx
+  80062f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800634:	8d 40 04             	lea    0x4(%eax),%eax
+  800637:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80063a:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  80063f:	e9 a3 00 00 00       	jmp    8006e7 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  800644:	8b 45 14             	mov    0x14(%ebp),%eax
+  800647:	8b 10                	mov    (%eax),%edx
+  800649:	8b 48 04             	mov    0x4(%eax),%ecx
+  80064c:	8d 40 08             	lea    0x8(%eax),%eax
+  80064f:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800652:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  800657:	e9 8b 00 00 00       	jmp    8006e7 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  80065c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80065f:	8b 10                	mov    (%eax),%edx
+  800661:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800666:	8d 40 04             	lea    0x4(%eax),%eax
+  800669:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  80066c:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  800671:	eb 74                	jmp    8006e7 <vprintfmt+0x3bc>
+	if (lflag >= 2)
+  800673:	83 f9 01             	cmp    $0x1,%ecx
+  800676:	7f 1b                	jg     800693 <vprintfmt+0x368>
+	else if (lflag)
+  800678:	85 c9                	test   %ecx,%ecx
+  80067a:	74 2c                	je     8006a8 <vprintfmt+0x37d>
+		return va_arg(*ap, unsigned long);
+  80067c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80067f:	8b 10                	mov    (%eax),%edx
+  800681:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800686:	8d 40 04             	lea    0x4(%eax),%eax
+  800689:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  80068c:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long);
+  800691:	eb 54                	jmp    8006e7 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  800693:	8b 45 14             	mov    0x14(%ebp),%eax
+  800696:	8b 10                	mov    (%eax),%edx
+  800698:	8b 48 04             	mov    0x4(%eax),%ecx
+  80069b:	8d 40 08             	lea    0x8(%eax),%eax
+  80069e:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8006a1:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long long);
+  8006a6:	eb 3f                	jmp    8006e7 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  8006a8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006ab:	8b 10                	mov    (%eax),%edx
+  8006ad:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006b2:	8d 40 04             	lea    0x4(%eax),%eax
+  8006b5:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8006b8:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned int);
+  8006bd:	eb 28                	jmp    8006e7 <vprintfmt+0x3bc>
+			putch('0', putdat);
+  8006bf:	83 ec 08             	sub    $0x8,%esp
+  8006c2:	53                   	push   %ebx
+  8006c3:	6a 30                	push   $0x30
+  8006c5:	ff d6                	call   *%esi
+			putch('x', putdat);
+  8006c7:	83 c4 08             	add    $0x8,%esp
+  8006ca:	53                   	push   %ebx
+  8006cb:	6a 78                	push   $0x78
+  8006cd:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  8006cf:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006d2:	8b 10                	mov    (%eax),%edx
+  8006d4:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  8006d9:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  8006dc:	8d 40 04             	lea    0x4(%eax),%eax
+  8006df:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8006e2:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  8006e7:	83 ec 0c             	sub    $0xc,%esp
+  8006ea:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  8006ee:	50                   	push   %eax
+  8006ef:	ff 75 e0             	push   -0x20(%ebp)
+  8006f2:	57                   	push   %edi
+  8006f3:	51                   	push   %ecx
+  8006f4:	52                   	push   %edx
+  8006f5:	89 da                	mov    %ebx,%edx
+  8006f7:	89 f0                	mov    %esi,%eax
+  8006f9:	e8 4a fb ff ff       	call   800248 <printnum>
+			break;
+  8006fe:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  800701:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800704:	e9 40 fc ff ff       	jmp    800349 <vprintfmt+0x1e>
+	if (lflag >= 2)
+  800709:	83 f9 01             	cmp    $0x1,%ecx
+  80070c:	7f 1b                	jg     800729 <vprintfmt+0x3fe>
+	else if (lflag)
+  80070e:	85 c9                	test   %ecx,%ecx
+  800710:	74 2c                	je     80073e <vprintfmt+0x413>
+		return va_arg(*ap, unsigned long);
+  800712:	8b 45 14             	mov    0x14(%ebp),%eax
+  800715:	8b 10                	mov    (%eax),%edx
+  800717:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80071c:	8d 40 04             	lea    0x4(%eax),%eax
+  80071f:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800722:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  800727:	eb be                	jmp    8006e7 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  800729:	8b 45 14             	mov    0x14(%ebp),%eax
+  80072c:	8b 10                	mov    (%eax),%edx
+  80072e:	8b 48 04             	mov    0x4(%eax),%ecx
+  800731:	8d 40 08             	lea    0x8(%eax),%eax
+  800734:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800737:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  80073c:	eb a9                	jmp    8006e7 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  80073e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800741:	8b 10                	mov    (%eax),%edx
+  800743:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800748:	8d 40 04             	lea    0x4(%eax),%eax
+  80074b:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  80074e:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  800753:	eb 92                	jmp    8006e7 <vprintfmt+0x3bc>
+			putch(ch, putdat);
+  800755:	83 ec 08             	sub    $0x8,%esp
+  800758:	53                   	push   %ebx
+  800759:	6a 25                	push   $0x25
+  80075b:	ff d6                	call   *%esi
+			break;
+  80075d:	83 c4 10             	add    $0x10,%esp
+  800760:	eb 9f                	jmp    800701 <vprintfmt+0x3d6>
+			putch('%', putdat);
+  800762:	83 ec 08             	sub    $0x8,%esp
+  800765:	53                   	push   %ebx
+  800766:	6a 25                	push   $0x25
+  800768:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  80076a:	83 c4 10             	add    $0x10,%esp
+  80076d:	89 f8                	mov    %edi,%eax
+  80076f:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800773:	74 05                	je     80077a <vprintfmt+0x44f>
+  800775:	83 e8 01             	sub    $0x1,%eax
+  800778:	eb f5                	jmp    80076f <vprintfmt+0x444>
+  80077a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80077d:	eb 82                	jmp    800701 <vprintfmt+0x3d6>
+
+0080077f <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  80077f:	55                   	push   %ebp
+  800780:	89 e5                	mov    %esp,%ebp
+  800782:	83 ec 18             	sub    $0x18,%esp
+  800785:	8b 45 08             	mov    0x8(%ebp),%eax
+  800788:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  80078b:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  80078e:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800792:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800795:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  80079c:	85 c0                	test   %eax,%eax
+  80079e:	74 26                	je     8007c6 <vsnprintf+0x47>
+  8007a0:	85 d2                	test   %edx,%edx
+  8007a2:	7e 22                	jle    8007c6 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  8007a4:	ff 75 14             	push   0x14(%ebp)
+  8007a7:	ff 75 10             	push   0x10(%ebp)
+  8007aa:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  8007ad:	50                   	push   %eax
+  8007ae:	68 f1 02 80 00       	push   $0x8002f1
+  8007b3:	e8 73 fb ff ff       	call   80032b <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  8007b8:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8007bb:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  8007be:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8007c1:	83 c4 10             	add    $0x10,%esp
+}
+  8007c4:	c9                   	leave
+  8007c5:	c3                   	ret
+		return -E_INVAL;
+  8007c6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8007cb:	eb f7                	jmp    8007c4 <vsnprintf+0x45>
+
+008007cd <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  8007cd:	55                   	push   %ebp
+  8007ce:	89 e5                	mov    %esp,%ebp
+  8007d0:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  8007d3:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  8007d6:	50                   	push   %eax
+  8007d7:	ff 75 10             	push   0x10(%ebp)
+  8007da:	ff 75 0c             	push   0xc(%ebp)
+  8007dd:	ff 75 08             	push   0x8(%ebp)
+  8007e0:	e8 9a ff ff ff       	call   80077f <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  8007e5:	c9                   	leave
+  8007e6:	c3                   	ret
+
+008007e7 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  8007e7:	55                   	push   %ebp
+  8007e8:	89 e5                	mov    %esp,%ebp
+  8007ea:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  8007ed:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007f2:	eb 03                	jmp    8007f7 <strlen+0x10>
+		n++;
+  8007f4:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  8007f7:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  8007fb:	75 f7                	jne    8007f4 <strlen+0xd>
+	return n;
+}
+  8007fd:	5d                   	pop    %ebp
+  8007fe:	c3                   	ret
+
+008007ff <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  8007ff:	55                   	push   %ebp
+  800800:	89 e5                	mov    %esp,%ebp
+  800802:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800805:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800808:	b8 00 00 00 00       	mov    $0x0,%eax
+  80080d:	eb 03                	jmp    800812 <strnlen+0x13>
+		n++;
+  80080f:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800812:	39 d0                	cmp    %edx,%eax
+  800814:	74 08                	je     80081e <strnlen+0x1f>
+  800816:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  80081a:	75 f3                	jne    80080f <strnlen+0x10>
+  80081c:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  80081e:	89 d0                	mov    %edx,%eax
+  800820:	5d                   	pop    %ebp
+  800821:	c3                   	ret
+
+00800822 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800822:	55                   	push   %ebp
+  800823:	89 e5                	mov    %esp,%ebp
+  800825:	53                   	push   %ebx
+  800826:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800829:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  80082c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800831:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800835:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800838:	83 c0 01             	add    $0x1,%eax
+  80083b:	84 d2                	test   %dl,%dl
+  80083d:	75 f2                	jne    800831 <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  80083f:	89 c8                	mov    %ecx,%eax
+  800841:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800844:	c9                   	leave
+  800845:	c3                   	ret
+
+00800846 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800846:	55                   	push   %ebp
+  800847:	89 e5                	mov    %esp,%ebp
+  800849:	53                   	push   %ebx
+  80084a:	83 ec 10             	sub    $0x10,%esp
+  80084d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  800850:	53                   	push   %ebx
+  800851:	e8 91 ff ff ff       	call   8007e7 <strlen>
+  800856:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  800859:	ff 75 0c             	push   0xc(%ebp)
+  80085c:	01 d8                	add    %ebx,%eax
+  80085e:	50                   	push   %eax
+  80085f:	e8 be ff ff ff       	call   800822 <strcpy>
+	return dst;
+}
+  800864:	89 d8                	mov    %ebx,%eax
+  800866:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800869:	c9                   	leave
+  80086a:	c3                   	ret
+
+0080086b <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  80086b:	55                   	push   %ebp
+  80086c:	89 e5                	mov    %esp,%ebp
+  80086e:	56                   	push   %esi
+  80086f:	53                   	push   %ebx
+  800870:	8b 75 08             	mov    0x8(%ebp),%esi
+  800873:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  800876:	89 f3                	mov    %esi,%ebx
+  800878:	03 5d 10             	add    0x10(%ebp),%ebx
+  80087b:	89 f0                	mov    %esi,%eax
+  80087d:	eb 0f                	jmp    80088e <strncpy+0x23>
+		*dst++ = *src;
+  80087f:	83 c0 01             	add    $0x1,%eax
+  800882:	0f b6 0a             	movzbl (%edx),%ecx
+  800885:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  800888:	80 f9 01             	cmp    $0x1,%cl
+  80088b:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  80088e:	39 d8                	cmp    %ebx,%eax
+  800890:	75 ed                	jne    80087f <strncpy+0x14>
+	}
+	return ret;
+}
+  800892:	89 f0                	mov    %esi,%eax
+  800894:	5b                   	pop    %ebx
+  800895:	5e                   	pop    %esi
+  800896:	5d                   	pop    %ebp
+  800897:	c3                   	ret
+
+00800898 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800898:	55                   	push   %ebp
+  800899:	89 e5                	mov    %esp,%ebp
+  80089b:	56                   	push   %esi
+  80089c:	53                   	push   %ebx
+  80089d:	8b 75 08             	mov    0x8(%ebp),%esi
+  8008a0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8008a3:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  8008a6:	89 f0                	mov    %esi,%eax
+  8008a8:	85 d2                	test   %edx,%edx
+  8008aa:	74 21                	je     8008cd <strlcpy+0x35>
+  8008ac:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  8008b0:	89 f2                	mov    %esi,%edx
+  8008b2:	eb 09                	jmp    8008bd <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  8008b4:	83 c1 01             	add    $0x1,%ecx
+  8008b7:	83 c2 01             	add    $0x1,%edx
+  8008ba:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  8008bd:	39 c2                	cmp    %eax,%edx
+  8008bf:	74 09                	je     8008ca <strlcpy+0x32>
+  8008c1:	0f b6 19             	movzbl (%ecx),%ebx
+  8008c4:	84 db                	test   %bl,%bl
+  8008c6:	75 ec                	jne    8008b4 <strlcpy+0x1c>
+  8008c8:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  8008ca:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  8008cd:	29 f0                	sub    %esi,%eax
+}
+  8008cf:	5b                   	pop    %ebx
+  8008d0:	5e                   	pop    %esi
+  8008d1:	5d                   	pop    %ebp
+  8008d2:	c3                   	ret
+
+008008d3 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  8008d3:	55                   	push   %ebp
+  8008d4:	89 e5                	mov    %esp,%ebp
+  8008d6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8008d9:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  8008dc:	eb 06                	jmp    8008e4 <strcmp+0x11>
+		p++, q++;
+  8008de:	83 c1 01             	add    $0x1,%ecx
+  8008e1:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  8008e4:	0f b6 01             	movzbl (%ecx),%eax
+  8008e7:	84 c0                	test   %al,%al
+  8008e9:	74 04                	je     8008ef <strcmp+0x1c>
+  8008eb:	3a 02                	cmp    (%edx),%al
+  8008ed:	74 ef                	je     8008de <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  8008ef:	0f b6 c0             	movzbl %al,%eax
+  8008f2:	0f b6 12             	movzbl (%edx),%edx
+  8008f5:	29 d0                	sub    %edx,%eax
+}
+  8008f7:	5d                   	pop    %ebp
+  8008f8:	c3                   	ret
+
+008008f9 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  8008f9:	55                   	push   %ebp
+  8008fa:	89 e5                	mov    %esp,%ebp
+  8008fc:	53                   	push   %ebx
+  8008fd:	8b 45 08             	mov    0x8(%ebp),%eax
+  800900:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800903:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  800906:	eb 09                	jmp    800911 <strncmp+0x18>
+		n--, p++, q++;
+  800908:	83 ea 01             	sub    $0x1,%edx
+  80090b:	83 c0 01             	add    $0x1,%eax
+  80090e:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  800911:	85 d2                	test   %edx,%edx
+  800913:	74 18                	je     80092d <strncmp+0x34>
+  800915:	0f b6 18             	movzbl (%eax),%ebx
+  800918:	84 db                	test   %bl,%bl
+  80091a:	74 04                	je     800920 <strncmp+0x27>
+  80091c:	3a 19                	cmp    (%ecx),%bl
+  80091e:	74 e8                	je     800908 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  800920:	0f b6 00             	movzbl (%eax),%eax
+  800923:	0f b6 11             	movzbl (%ecx),%edx
+  800926:	29 d0                	sub    %edx,%eax
+}
+  800928:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80092b:	c9                   	leave
+  80092c:	c3                   	ret
+		return 0;
+  80092d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800932:	eb f4                	jmp    800928 <strncmp+0x2f>
+
+00800934 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800934:	55                   	push   %ebp
+  800935:	89 e5                	mov    %esp,%ebp
+  800937:	8b 45 08             	mov    0x8(%ebp),%eax
+  80093a:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  80093e:	eb 03                	jmp    800943 <strchr+0xf>
+  800940:	83 c0 01             	add    $0x1,%eax
+  800943:	0f b6 10             	movzbl (%eax),%edx
+  800946:	84 d2                	test   %dl,%dl
+  800948:	74 06                	je     800950 <strchr+0x1c>
+		if (*s == c)
+  80094a:	38 ca                	cmp    %cl,%dl
+  80094c:	75 f2                	jne    800940 <strchr+0xc>
+  80094e:	eb 05                	jmp    800955 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  800950:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800955:	5d                   	pop    %ebp
+  800956:	c3                   	ret
+
+00800957 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800957:	55                   	push   %ebp
+  800958:	89 e5                	mov    %esp,%ebp
+  80095a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80095d:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  800961:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  800964:	38 ca                	cmp    %cl,%dl
+  800966:	74 09                	je     800971 <strfind+0x1a>
+  800968:	84 d2                	test   %dl,%dl
+  80096a:	74 05                	je     800971 <strfind+0x1a>
+	for (; *s; s++)
+  80096c:	83 c0 01             	add    $0x1,%eax
+  80096f:	eb f0                	jmp    800961 <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  800971:	5d                   	pop    %ebp
+  800972:	c3                   	ret
+
+00800973 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800973:	55                   	push   %ebp
+  800974:	89 e5                	mov    %esp,%ebp
+  800976:	57                   	push   %edi
+  800977:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80097a:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  80097d:	85 c9                	test   %ecx,%ecx
+  80097f:	74 20                	je     8009a1 <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  800981:	89 f8                	mov    %edi,%eax
+  800983:	09 c8                	or     %ecx,%eax
+  800985:	a8 03                	test   $0x3,%al
+  800987:	75 12                	jne    80099b <memset+0x28>
+		c &= 0xFF;
+  800989:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  80098d:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  800993:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  800996:	fc                   	cld
+  800997:	f3 ab                	rep stos %eax,%es:(%edi)
+  800999:	eb 06                	jmp    8009a1 <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  80099b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80099e:	fc                   	cld
+  80099f:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  8009a1:	89 f8                	mov    %edi,%eax
+  8009a3:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  8009a6:	c9                   	leave
+  8009a7:	c3                   	ret
+
+008009a8 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  8009a8:	55                   	push   %ebp
+  8009a9:	89 e5                	mov    %esp,%ebp
+  8009ab:	57                   	push   %edi
+  8009ac:	56                   	push   %esi
+  8009ad:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009b0:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8009b3:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  8009b6:	39 c6                	cmp    %eax,%esi
+  8009b8:	73 32                	jae    8009ec <memmove+0x44>
+  8009ba:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  8009bd:	39 d0                	cmp    %edx,%eax
+  8009bf:	73 2b                	jae    8009ec <memmove+0x44>
+		s += n;
+		d += n;
+  8009c1:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  8009c4:	89 d6                	mov    %edx,%esi
+  8009c6:	09 fe                	or     %edi,%esi
+  8009c8:	09 ce                	or     %ecx,%esi
+  8009ca:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  8009d0:	75 0e                	jne    8009e0 <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  8009d2:	83 ef 04             	sub    $0x4,%edi
+  8009d5:	8d 72 fc             	lea    -0x4(%edx),%esi
+  8009d8:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  8009db:	fd                   	std
+  8009dc:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  8009de:	eb 09                	jmp    8009e9 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  8009e0:	83 ef 01             	sub    $0x1,%edi
+  8009e3:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  8009e6:	fd                   	std
+  8009e7:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  8009e9:	fc                   	cld
+  8009ea:	eb 1a                	jmp    800a06 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  8009ec:	89 f2                	mov    %esi,%edx
+  8009ee:	09 c2                	or     %eax,%edx
+  8009f0:	09 ca                	or     %ecx,%edx
+  8009f2:	f6 c2 03             	test   $0x3,%dl
+  8009f5:	75 0a                	jne    800a01 <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  8009f7:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  8009fa:	89 c7                	mov    %eax,%edi
+  8009fc:	fc                   	cld
+  8009fd:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  8009ff:	eb 05                	jmp    800a06 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  800a01:	89 c7                	mov    %eax,%edi
+  800a03:	fc                   	cld
+  800a04:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800a06:	5e                   	pop    %esi
+  800a07:	5f                   	pop    %edi
+  800a08:	5d                   	pop    %ebp
+  800a09:	c3                   	ret
+
+00800a0a <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800a0a:	55                   	push   %ebp
+  800a0b:	89 e5                	mov    %esp,%ebp
+  800a0d:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  800a10:	ff 75 10             	push   0x10(%ebp)
+  800a13:	ff 75 0c             	push   0xc(%ebp)
+  800a16:	ff 75 08             	push   0x8(%ebp)
+  800a19:	e8 8a ff ff ff       	call   8009a8 <memmove>
+}
+  800a1e:	c9                   	leave
+  800a1f:	c3                   	ret
+
+00800a20 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800a20:	55                   	push   %ebp
+  800a21:	89 e5                	mov    %esp,%ebp
+  800a23:	56                   	push   %esi
+  800a24:	53                   	push   %ebx
+  800a25:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a28:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800a2b:	89 c6                	mov    %eax,%esi
+  800a2d:	03 75 10             	add    0x10(%ebp),%esi
+  800a30:	eb 06                	jmp    800a38 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800a32:	83 c0 01             	add    $0x1,%eax
+  800a35:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800a38:	39 f0                	cmp    %esi,%eax
+  800a3a:	74 14                	je     800a50 <memcmp+0x30>
+		if (*s1 != *s2)
+  800a3c:	0f b6 08             	movzbl (%eax),%ecx
+  800a3f:	0f b6 1a             	movzbl (%edx),%ebx
+  800a42:	38 d9                	cmp    %bl,%cl
+  800a44:	74 ec                	je     800a32 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  800a46:	0f b6 c1             	movzbl %cl,%eax
+  800a49:	0f b6 db             	movzbl %bl,%ebx
+  800a4c:	29 d8                	sub    %ebx,%eax
+  800a4e:	eb 05                	jmp    800a55 <memcmp+0x35>
+	}
+
+	return 0;
+  800a50:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800a55:	5b                   	pop    %ebx
+  800a56:	5e                   	pop    %esi
+  800a57:	5d                   	pop    %ebp
+  800a58:	c3                   	ret
+
+00800a59 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800a59:	55                   	push   %ebp
+  800a5a:	89 e5                	mov    %esp,%ebp
+  800a5c:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a5f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  800a62:	89 c2                	mov    %eax,%edx
+  800a64:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  800a67:	eb 03                	jmp    800a6c <memfind+0x13>
+  800a69:	83 c0 01             	add    $0x1,%eax
+  800a6c:	39 d0                	cmp    %edx,%eax
+  800a6e:	73 04                	jae    800a74 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  800a70:	38 08                	cmp    %cl,(%eax)
+  800a72:	75 f5                	jne    800a69 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  800a74:	5d                   	pop    %ebp
+  800a75:	c3                   	ret
+
+00800a76 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800a76:	55                   	push   %ebp
+  800a77:	89 e5                	mov    %esp,%ebp
+  800a79:	57                   	push   %edi
+  800a7a:	56                   	push   %esi
+  800a7b:	53                   	push   %ebx
+  800a7c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800a7f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  800a82:	eb 03                	jmp    800a87 <strtol+0x11>
+		s++;
+  800a84:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  800a87:	0f b6 02             	movzbl (%edx),%eax
+  800a8a:	3c 20                	cmp    $0x20,%al
+  800a8c:	74 f6                	je     800a84 <strtol+0xe>
+  800a8e:	3c 09                	cmp    $0x9,%al
+  800a90:	74 f2                	je     800a84 <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  800a92:	3c 2b                	cmp    $0x2b,%al
+  800a94:	74 2a                	je     800ac0 <strtol+0x4a>
+	int neg = 0;
+  800a96:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  800a9b:	3c 2d                	cmp    $0x2d,%al
+  800a9d:	74 2b                	je     800aca <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800a9f:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800aa5:	75 0f                	jne    800ab6 <strtol+0x40>
+  800aa7:	80 3a 30             	cmpb   $0x30,(%edx)
+  800aaa:	74 28                	je     800ad4 <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800aac:	85 db                	test   %ebx,%ebx
+  800aae:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800ab3:	0f 44 d8             	cmove  %eax,%ebx
+  800ab6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800abb:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800abe:	eb 46                	jmp    800b06 <strtol+0x90>
+		s++;
+  800ac0:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800ac3:	bf 00 00 00 00       	mov    $0x0,%edi
+  800ac8:	eb d5                	jmp    800a9f <strtol+0x29>
+		s++, neg = 1;
+  800aca:	83 c2 01             	add    $0x1,%edx
+  800acd:	bf 01 00 00 00       	mov    $0x1,%edi
+  800ad2:	eb cb                	jmp    800a9f <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800ad4:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800ad8:	74 0e                	je     800ae8 <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800ada:	85 db                	test   %ebx,%ebx
+  800adc:	75 d8                	jne    800ab6 <strtol+0x40>
+		s++, base = 8;
+  800ade:	83 c2 01             	add    $0x1,%edx
+  800ae1:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800ae6:	eb ce                	jmp    800ab6 <strtol+0x40>
+		s += 2, base = 16;
+  800ae8:	83 c2 02             	add    $0x2,%edx
+  800aeb:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800af0:	eb c4                	jmp    800ab6 <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800af2:	0f be c0             	movsbl %al,%eax
+  800af5:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800af8:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800afb:	7d 3a                	jge    800b37 <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800afd:	83 c2 01             	add    $0x1,%edx
+  800b00:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800b04:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800b06:	0f b6 02             	movzbl (%edx),%eax
+  800b09:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800b0c:	89 f3                	mov    %esi,%ebx
+  800b0e:	80 fb 09             	cmp    $0x9,%bl
+  800b11:	76 df                	jbe    800af2 <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800b13:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800b16:	89 f3                	mov    %esi,%ebx
+  800b18:	80 fb 19             	cmp    $0x19,%bl
+  800b1b:	77 08                	ja     800b25 <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800b1d:	0f be c0             	movsbl %al,%eax
+  800b20:	83 e8 57             	sub    $0x57,%eax
+  800b23:	eb d3                	jmp    800af8 <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800b25:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800b28:	89 f3                	mov    %esi,%ebx
+  800b2a:	80 fb 19             	cmp    $0x19,%bl
+  800b2d:	77 08                	ja     800b37 <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800b2f:	0f be c0             	movsbl %al,%eax
+  800b32:	83 e8 37             	sub    $0x37,%eax
+  800b35:	eb c1                	jmp    800af8 <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800b37:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800b3b:	74 05                	je     800b42 <strtol+0xcc>
+		*endptr = (char *) s;
+  800b3d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800b40:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800b42:	89 c8                	mov    %ecx,%eax
+  800b44:	f7 d8                	neg    %eax
+  800b46:	85 ff                	test   %edi,%edi
+  800b48:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800b4b:	89 c8                	mov    %ecx,%eax
+  800b4d:	5b                   	pop    %ebx
+  800b4e:	5e                   	pop    %esi
+  800b4f:	5f                   	pop    %edi
+  800b50:	5d                   	pop    %ebp
+  800b51:	c3                   	ret
+
+00800b52 <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800b52:	55                   	push   %ebp
+  800b53:	89 e5                	mov    %esp,%ebp
+  800b55:	57                   	push   %edi
+  800b56:	56                   	push   %esi
+  800b57:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800b58:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b5d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b60:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800b63:	89 c3                	mov    %eax,%ebx
+  800b65:	89 c7                	mov    %eax,%edi
+  800b67:	55                   	push   %ebp
+  800b68:	89 e5                	mov    %esp,%ebp
+  800b6a:	8d 35 72 0b 80 00    	lea    0x800b72,%esi
+  800b70:	0f 34                	sysenter
+  800b72:	5d                   	pop    %ebp
+	syscall2(SYS_cputs, 0, (uint32_t)s, len, 0, 0);
+}
+  800b73:	5b                   	pop    %ebx
+  800b74:	5e                   	pop    %esi
+  800b75:	5f                   	pop    %edi
+  800b76:	5d                   	pop    %ebp
+  800b77:	c3                   	ret
+
+00800b78 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800b78:	55                   	push   %ebp
+  800b79:	89 e5                	mov    %esp,%ebp
+  800b7b:	57                   	push   %edi
+  800b7c:	56                   	push   %esi
+  800b7d:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800b7e:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b83:	b8 01 00 00 00       	mov    $0x1,%eax
+  800b88:	89 d1                	mov    %edx,%ecx
+  800b8a:	89 d3                	mov    %edx,%ebx
+  800b8c:	89 d7                	mov    %edx,%edi
+  800b8e:	55                   	push   %ebp
+  800b8f:	89 e5                	mov    %esp,%ebp
+  800b91:	8d 35 99 0b 80 00    	lea    0x800b99,%esi
+  800b97:	0f 34                	sysenter
+  800b99:	5d                   	pop    %ebp
+	return syscall2(SYS_cgetc, 0, 0, 0, 0, 0);
+}
+  800b9a:	5b                   	pop    %ebx
+  800b9b:	5e                   	pop    %esi
+  800b9c:	5f                   	pop    %edi
+  800b9d:	5d                   	pop    %ebp
+  800b9e:	c3                   	ret
+
+00800b9f <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800b9f:	55                   	push   %ebp
+  800ba0:	89 e5                	mov    %esp,%ebp
+  800ba2:	57                   	push   %edi
+  800ba3:	56                   	push   %esi
+  800ba4:	53                   	push   %ebx
+  800ba5:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800ba8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800bad:	8b 55 08             	mov    0x8(%ebp),%edx
+  800bb0:	b8 03 00 00 00       	mov    $0x3,%eax
+  800bb5:	89 cb                	mov    %ecx,%ebx
+  800bb7:	89 cf                	mov    %ecx,%edi
+  800bb9:	55                   	push   %ebp
+  800bba:	89 e5                	mov    %esp,%ebp
+  800bbc:	8d 35 c4 0b 80 00    	lea    0x800bc4,%esi
+  800bc2:	0f 34                	sysenter
+  800bc4:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800bc5:	85 c0                	test   %eax,%eax
+  800bc7:	7f 08                	jg     800bd1 <sys_env_destroy+0x32>
+	return syscall2(SYS_env_destroy, 1, envid, 0, 0, 0);
+}
+  800bc9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800bcc:	5b                   	pop    %ebx
+  800bcd:	5e                   	pop    %esi
+  800bce:	5f                   	pop    %edi
+  800bcf:	5d                   	pop    %ebp
+  800bd0:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800bd1:	83 ec 0c             	sub    $0xc,%esp
+  800bd4:	50                   	push   %eax
+  800bd5:	6a 03                	push   $0x3
+  800bd7:	68 a7 3b 80 00       	push   $0x803ba7
+  800bdc:	6a 3d                	push   $0x3d
+  800bde:	68 c4 3b 80 00       	push   $0x803bc4
+  800be3:	e8 71 f5 ff ff       	call   800159 <_panic>
+
+00800be8 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800be8:	55                   	push   %ebp
+  800be9:	89 e5                	mov    %esp,%ebp
+  800beb:	57                   	push   %edi
+  800bec:	56                   	push   %esi
+  800bed:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800bee:	ba 00 00 00 00       	mov    $0x0,%edx
+  800bf3:	b8 02 00 00 00       	mov    $0x2,%eax
+  800bf8:	89 d1                	mov    %edx,%ecx
+  800bfa:	89 d3                	mov    %edx,%ebx
+  800bfc:	89 d7                	mov    %edx,%edi
+  800bfe:	55                   	push   %ebp
+  800bff:	89 e5                	mov    %esp,%ebp
+  800c01:	8d 35 09 0c 80 00    	lea    0x800c09,%esi
+  800c07:	0f 34                	sysenter
+  800c09:	5d                   	pop    %ebp
+	 return syscall2(SYS_getenvid, 0, 0, 0, 0, 0);
+}
+  800c0a:	5b                   	pop    %ebx
+  800c0b:	5e                   	pop    %esi
+  800c0c:	5f                   	pop    %edi
+  800c0d:	5d                   	pop    %ebp
+  800c0e:	c3                   	ret
+
+00800c0f <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800c0f:	55                   	push   %ebp
+  800c10:	89 e5                	mov    %esp,%ebp
+  800c12:	57                   	push   %edi
+  800c13:	56                   	push   %esi
+  800c14:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800c15:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c1a:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800c1f:	89 d1                	mov    %edx,%ecx
+  800c21:	89 d3                	mov    %edx,%ebx
+  800c23:	89 d7                	mov    %edx,%edi
+  800c25:	89 d6                	mov    %edx,%esi
+  800c27:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800c29:	5b                   	pop    %ebx
+  800c2a:	5e                   	pop    %esi
+  800c2b:	5f                   	pop    %edi
+  800c2c:	5d                   	pop    %ebp
+  800c2d:	c3                   	ret
+
+00800c2e <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800c2e:	55                   	push   %ebp
+  800c2f:	89 e5                	mov    %esp,%ebp
+  800c31:	57                   	push   %edi
+  800c32:	56                   	push   %esi
+  800c33:	53                   	push   %ebx
+  800c34:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800c37:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c3a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c3d:	b8 04 00 00 00       	mov    $0x4,%eax
+  800c42:	bf 00 00 00 00       	mov    $0x0,%edi
+  800c47:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800c4a:	55                   	push   %ebp
+  800c4b:	89 e5                	mov    %esp,%ebp
+  800c4d:	8d 35 55 0c 80 00    	lea    0x800c55,%esi
+  800c53:	0f 34                	sysenter
+  800c55:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800c56:	85 c0                	test   %eax,%eax
+  800c58:	7f 08                	jg     800c62 <sys_page_alloc+0x34>
+	return syscall2(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0);
+}
+  800c5a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c5d:	5b                   	pop    %ebx
+  800c5e:	5e                   	pop    %esi
+  800c5f:	5f                   	pop    %edi
+  800c60:	5d                   	pop    %ebp
+  800c61:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800c62:	83 ec 0c             	sub    $0xc,%esp
+  800c65:	50                   	push   %eax
+  800c66:	6a 04                	push   $0x4
+  800c68:	68 a7 3b 80 00       	push   $0x803ba7
+  800c6d:	6a 3d                	push   $0x3d
+  800c6f:	68 c4 3b 80 00       	push   $0x803bc4
+  800c74:	e8 e0 f4 ff ff       	call   800159 <_panic>
+
+00800c79 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800c79:	55                   	push   %ebp
+  800c7a:	89 e5                	mov    %esp,%ebp
+  800c7c:	57                   	push   %edi
+  800c7d:	56                   	push   %esi
+  800c7e:	53                   	push   %ebx
+  800c7f:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800c82:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c85:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c88:	b8 05 00 00 00       	mov    $0x5,%eax
+  800c8d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800c90:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800c93:	8b 75 18             	mov    0x18(%ebp),%esi
+  800c96:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800c98:	85 c0                	test   %eax,%eax
+  800c9a:	7f 08                	jg     800ca4 <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800c9c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c9f:	5b                   	pop    %ebx
+  800ca0:	5e                   	pop    %esi
+  800ca1:	5f                   	pop    %edi
+  800ca2:	5d                   	pop    %ebp
+  800ca3:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ca4:	83 ec 0c             	sub    $0xc,%esp
+  800ca7:	50                   	push   %eax
+  800ca8:	6a 05                	push   $0x5
+  800caa:	68 a7 3b 80 00       	push   $0x803ba7
+  800caf:	6a 23                	push   $0x23
+  800cb1:	68 c4 3b 80 00       	push   $0x803bc4
+  800cb6:	e8 9e f4 ff ff       	call   800159 <_panic>
+
+00800cbb <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800cbb:	55                   	push   %ebp
+  800cbc:	89 e5                	mov    %esp,%ebp
+  800cbe:	57                   	push   %edi
+  800cbf:	56                   	push   %esi
+  800cc0:	53                   	push   %ebx
+  800cc1:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800cc4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800cc9:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ccc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ccf:	b8 06 00 00 00       	mov    $0x6,%eax
+  800cd4:	89 df                	mov    %ebx,%edi
+  800cd6:	55                   	push   %ebp
+  800cd7:	89 e5                	mov    %esp,%ebp
+  800cd9:	8d 35 e1 0c 80 00    	lea    0x800ce1,%esi
+  800cdf:	0f 34                	sysenter
+  800ce1:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800ce2:	85 c0                	test   %eax,%eax
+  800ce4:	7f 08                	jg     800cee <sys_page_unmap+0x33>
+	return syscall2(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0);
+}
+  800ce6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ce9:	5b                   	pop    %ebx
+  800cea:	5e                   	pop    %esi
+  800ceb:	5f                   	pop    %edi
+  800cec:	5d                   	pop    %ebp
+  800ced:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800cee:	83 ec 0c             	sub    $0xc,%esp
+  800cf1:	50                   	push   %eax
+  800cf2:	6a 06                	push   $0x6
+  800cf4:	68 a7 3b 80 00       	push   $0x803ba7
+  800cf9:	6a 3d                	push   $0x3d
+  800cfb:	68 c4 3b 80 00       	push   $0x803bc4
+  800d00:	e8 54 f4 ff ff       	call   800159 <_panic>
+
+00800d05 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800d05:	55                   	push   %ebp
+  800d06:	89 e5                	mov    %esp,%ebp
+  800d08:	57                   	push   %edi
+  800d09:	56                   	push   %esi
+  800d0a:	53                   	push   %ebx
+  800d0b:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800d0e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800d13:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d16:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d19:	b8 08 00 00 00       	mov    $0x8,%eax
+  800d1e:	89 df                	mov    %ebx,%edi
+  800d20:	55                   	push   %ebp
+  800d21:	89 e5                	mov    %esp,%ebp
+  800d23:	8d 35 2b 0d 80 00    	lea    0x800d2b,%esi
+  800d29:	0f 34                	sysenter
+  800d2b:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800d2c:	85 c0                	test   %eax,%eax
+  800d2e:	7f 08                	jg     800d38 <sys_env_set_status+0x33>
+	return syscall2(SYS_env_set_status, 1, envid, status, 0, 0);
+}
+  800d30:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d33:	5b                   	pop    %ebx
+  800d34:	5e                   	pop    %esi
+  800d35:	5f                   	pop    %edi
+  800d36:	5d                   	pop    %ebp
+  800d37:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d38:	83 ec 0c             	sub    $0xc,%esp
+  800d3b:	50                   	push   %eax
+  800d3c:	6a 08                	push   $0x8
+  800d3e:	68 a7 3b 80 00       	push   $0x803ba7
+  800d43:	6a 3d                	push   $0x3d
+  800d45:	68 c4 3b 80 00       	push   $0x803bc4
+  800d4a:	e8 0a f4 ff ff       	call   800159 <_panic>
+
+00800d4f <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  800d4f:	55                   	push   %ebp
+  800d50:	89 e5                	mov    %esp,%ebp
+  800d52:	57                   	push   %edi
+  800d53:	56                   	push   %esi
+  800d54:	53                   	push   %ebx
+  800d55:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800d58:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800d5d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d60:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d63:	b8 09 00 00 00       	mov    $0x9,%eax
+  800d68:	89 df                	mov    %ebx,%edi
+  800d6a:	55                   	push   %ebp
+  800d6b:	89 e5                	mov    %esp,%ebp
+  800d6d:	8d 35 75 0d 80 00    	lea    0x800d75,%esi
+  800d73:	0f 34                	sysenter
+  800d75:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800d76:	85 c0                	test   %eax,%eax
+  800d78:	7f 08                	jg     800d82 <sys_env_set_trapframe+0x33>
+	return syscall2(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0);
+}
+  800d7a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d7d:	5b                   	pop    %ebx
+  800d7e:	5e                   	pop    %esi
+  800d7f:	5f                   	pop    %edi
+  800d80:	5d                   	pop    %ebp
+  800d81:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d82:	83 ec 0c             	sub    $0xc,%esp
+  800d85:	50                   	push   %eax
+  800d86:	6a 09                	push   $0x9
+  800d88:	68 a7 3b 80 00       	push   $0x803ba7
+  800d8d:	6a 3d                	push   $0x3d
+  800d8f:	68 c4 3b 80 00       	push   $0x803bc4
+  800d94:	e8 c0 f3 ff ff       	call   800159 <_panic>
+
+00800d99 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  800d99:	55                   	push   %ebp
+  800d9a:	89 e5                	mov    %esp,%ebp
+  800d9c:	57                   	push   %edi
+  800d9d:	56                   	push   %esi
+  800d9e:	53                   	push   %ebx
+  800d9f:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800da2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800da7:	8b 55 08             	mov    0x8(%ebp),%edx
+  800daa:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800dad:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800db2:	89 df                	mov    %ebx,%edi
+  800db4:	55                   	push   %ebp
+  800db5:	89 e5                	mov    %esp,%ebp
+  800db7:	8d 35 bf 0d 80 00    	lea    0x800dbf,%esi
+  800dbd:	0f 34                	sysenter
+  800dbf:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800dc0:	85 c0                	test   %eax,%eax
+  800dc2:	7f 08                	jg     800dcc <sys_env_set_pgfault_upcall+0x33>
+	return syscall2(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0);
+}
+  800dc4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800dc7:	5b                   	pop    %ebx
+  800dc8:	5e                   	pop    %esi
+  800dc9:	5f                   	pop    %edi
+  800dca:	5d                   	pop    %ebp
+  800dcb:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800dcc:	83 ec 0c             	sub    $0xc,%esp
+  800dcf:	50                   	push   %eax
+  800dd0:	6a 0a                	push   $0xa
+  800dd2:	68 a7 3b 80 00       	push   $0x803ba7
+  800dd7:	6a 3d                	push   $0x3d
+  800dd9:	68 c4 3b 80 00       	push   $0x803bc4
+  800dde:	e8 76 f3 ff ff       	call   800159 <_panic>
+
+00800de3 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  800de3:	55                   	push   %ebp
+  800de4:	89 e5                	mov    %esp,%ebp
+  800de6:	57                   	push   %edi
+  800de7:	56                   	push   %esi
+  800de8:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800de9:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dec:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800def:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800df4:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800df7:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800dfa:	55                   	push   %ebp
+  800dfb:	89 e5                	mov    %esp,%ebp
+  800dfd:	8d 35 05 0e 80 00    	lea    0x800e05,%esi
+  800e03:	0f 34                	sysenter
+  800e05:	5d                   	pop    %ebp
+	return syscall2(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm);
+}
+  800e06:	5b                   	pop    %ebx
+  800e07:	5e                   	pop    %esi
+  800e08:	5f                   	pop    %edi
+  800e09:	5d                   	pop    %ebp
+  800e0a:	c3                   	ret
+
+00800e0b <sys_ipc_try_sendv>:
+
+int
+sys_ipc_try_sendv(envid_t envid, uint32_t value, const uintptr_t *pages, int npages)
+{
+  800e0b:	55                   	push   %ebp
+  800e0c:	89 e5                	mov    %esp,%ebp
+  800e0e:	57                   	push   %edi
+  800e0f:	56                   	push   %esi
+  800e10:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800e11:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e14:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e17:	b8 17 00 00 00       	mov    $0x17,%eax
+  800e1c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e1f:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800e22:	55                   	push   %ebp
+  800e23:	89 e5                	mov    %esp,%ebp
+  800e25:	8d 35 2d 0e 80 00    	lea    0x800e2d,%esi
+  800e2b:	0f 34                	sysenter
+  800e2d:	5d                   	pop    %ebp
+	return syscall2(SYS_ipc_try_sendv, 0, envid, value, (uint32_t) pages, npages);
+}
+  800e2e:	5b                   	pop    %ebx
+  800e2f:	5e                   	pop    %esi
+  800e30:	5f                   	pop    %edi
+  800e31:	5d                   	pop    %ebp
+  800e32:	c3                   	ret
+
+00800e33 <sys_ipc_recvv>:
+	return sys_ipc_recvv(dstva, 1, 0);
+}
+
+int
+sys_ipc_recvv(void *dstva, int npages, int flags)
+{
+  800e33:	55                   	push   %ebp
+  800e34:	89 e5                	mov    %esp,%ebp
+  800e36:	57                   	push   %edi
+  800e37:	56                   	push   %esi
+  800e38:	53                   	push   %ebx
+  800e39:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800e3c:	be 00 00 00 00       	mov    $0x0,%esi
+  800e41:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e44:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e47:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800e4c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e4f:	89 f7                	mov    %esi,%edi
+  800e51:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e53:	85 c0                	test   %eax,%eax
+  800e55:	7f 08                	jg     800e5f <sys_ipc_recvv+0x2c>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npages, flags, 0, 0);
+}
+  800e57:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e5a:	5b                   	pop    %ebx
+  800e5b:	5e                   	pop    %esi
+  800e5c:	5f                   	pop    %edi
+  800e5d:	5d                   	pop    %ebp
+  800e5e:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e5f:	83 ec 0c             	sub    $0xc,%esp
+  800e62:	50                   	push   %eax
+  800e63:	6a 0d                	push   $0xd
+  800e65:	68 a7 3b 80 00       	push   $0x803ba7
+  800e6a:	6a 23                	push   $0x23
+  800e6c:	68 c4 3b 80 00       	push   $0x803bc4
+  800e71:	e8 e3 f2 ff ff       	call   800159 <_panic>
+
+00800e76 <sys_ipc_recv>:
+{
+  800e76:	55                   	push   %ebp
+  800e77:	89 e5                	mov    %esp,%ebp
+  800e79:	83 ec 0c             	sub    $0xc,%esp
+	return sys_ipc_recvv(dstva, 1, 0);
+  800e7c:	6a 00                	push   $0x0
+  800e7e:	6a 01                	push   $0x1
+  800e80:	ff 75 08             	push   0x8(%ebp)
+  800e83:	e8 ab ff ff ff       	call   800e33 <sys_ipc_recvv>
+}
+  800e88:	c9                   	leave
+  800e89:	c3                   	ret
+
+00800e8a <sys_ipc_recv_until>:
+
+int
+sys_ipc_recv_until(void *dstva, int npages, unsigned int deadline)
+{
+  800e8a:	55                   	push   %ebp
+  800e8b:	89 e5                	mov    %esp,%ebp
+  800e8d:	57                   	push   %edi
+  800e8e:	56                   	push   %esi
+  800e8f:	53                   	push   %ebx
+  800e90:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800e93:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e98:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e9b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e9e:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800ea3:	8b 7d 10             	mov    0x10(%ebp),%edi
+  800ea6:	89 de                	mov    %ebx,%esi
+  800ea8:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800eaa:	85 c0                	test   %eax,%eax
+  800eac:	7f 08                	jg     800eb6 <sys_ipc_recv_until+0x2c>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npages, 0, deadline, 0);
+}
+  800eae:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800eb1:	5b                   	pop    %ebx
+  800eb2:	5e                   	pop    %esi
+  800eb3:	5f                   	pop    %edi
+  800eb4:	5d                   	pop    %ebp
+  800eb5:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800eb6:	83 ec 0c             	sub    $0xc,%esp
+  800eb9:	50                   	push   %eax
+  800eba:	6a 0d                	push   $0xd
+  800ebc:	68 a7 3b 80 00       	push   $0x803ba7
+  800ec1:	6a 23                	push   $0x23
+  800ec3:	68 c4 3b 80 00       	push   $0x803bc4
+  800ec8:	e8 8c f2 ff ff       	call   800159 <_panic>
+
+00800ecd <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  800ecd:	55                   	push   %ebp
+  800ece:	89 e5                	mov    %esp,%ebp
+  800ed0:	57                   	push   %edi
+  800ed1:	56                   	push   %esi
+  800ed2:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800ed3:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ed8:	b8 0e 00 00 00       	mov    $0xe,%eax
+  800edd:	89 d1                	mov    %edx,%ecx
+  800edf:	89 d3                	mov    %edx,%ebx
+  800ee1:	89 d7                	mov    %edx,%edi
+  800ee3:	55                   	push   %ebp
+  800ee4:	89 e5                	mov    %esp,%ebp
+  800ee6:	8d 35 ee 0e 80 00    	lea    0x800eee,%esi
+  800eec:	0f 34                	sysenter
+  800eee:	5d                   	pop    %ebp
+	return (unsigned int) syscall2(SYS_time_msec, 0, 0, 0, 0, 0);
+}
+  800eef:	5b                   	pop    %ebx
+  800ef0:	5e                   	pop    %esi
+  800ef1:	5f                   	pop    %edi
+  800ef2:	5d                   	pop    %ebp
+  800ef3:	c3                   	ret
+
+00800ef4 <sys_net_try_send>:
+
+size_t
+sys_net_try_send(void *packet, size_t length)
+{
+  800ef4:	55                   	push   %ebp
+  800ef5:	89 e5                	mov    %esp,%ebp
+  800ef7:	57                   	push   %edi
+  800ef8:	56                   	push   %esi
+  800ef9:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800efa:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800eff:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f02:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f05:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800f0a:	89 df                	mov    %ebx,%edi
+  800f0c:	55                   	push   %ebp
+  800f0d:	89 e5                	mov    %esp,%ebp
+  800f0f:	8d 35 17 0f 80 00    	lea    0x800f17,%esi
+  800f15:	0f 34                	sysenter
+  800f17:	5d                   	pop    %ebp
+	return syscall2(SYS_net_try_send, 0, (uint32_t) packet, length, 0, 0);
+}
+  800f18:	5b                   	pop    %ebx
+  800f19:	5e                   	pop    %esi
+  800f1a:	5f                   	pop    %edi
+  800f1b:	5d                   	pop    %ebp
+  800f1c:	c3                   	ret
+
+00800f1d <sys_net_try_recv>:
+
+size_t
+sys_net_try_recv(uint8_t *buffer)
+{
+  800f1d:	55                   	push   %ebp
+  800f1e:	89 e5                	mov    %esp,%ebp
+  800f20:	57                   	push   %edi
+  800f21:	56                   	push   %esi
+  800f22:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800f23:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800f28:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f2b:	b8 10 00 00 00       	mov    $0x10,%eax
+  800f30:	89 cb                	mov    %ecx,%ebx
+  800f32:	89 cf                	mov    %ecx,%edi
+  800f34:	55                   	push   %ebp
+  800f35:	89 e5                	mov    %esp,%ebp
+  800f37:	8d 35 3f 0f 80 00    	lea    0x800f3f,%esi
+  800f3d:	0f 34                	sysenter
+  800f3f:	5d                   	pop    %ebp
+	return syscall2(SYS_net_try_recv, 0, (uint32_t) buffer, 0, 0, 0);
+}
+  800f40:	5b                   	pop    %ebx
+  800f41:	5e                   	pop    %esi
+  800f42:	5f                   	pop    %edi
+  800f43:	5d                   	pop    %ebp
+  800f44:	c3                   	ret
+
+00800f45 <sys_net_recv_pages>:
+
+int
+sys_net_recv_pages(void *dstva, int npages)
+{
+  800f45:	55                   	push   %ebp
+  800f46:	89 e5                	mov    %esp,%ebp
+  800f48:	57                   	push   %edi
+  800f49:	56                   	push   %esi
+  800f4a:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800f4b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f50:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f53:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f56:	b8 12 00 00 00       	mov    $0x12,%eax
+  800f5b:	89 df                	mov    %ebx,%edi
+  800f5d:	55                   	push   %ebp
+  800f5e:	89 e5                	mov    %esp,%ebp
+  800f60:	8d 35 68 0f 80 00    	lea    0x800f68,%esi
+  800f66:	0f 34                	sysenter
+  800f68:	5d                   	pop    %ebp
+	return syscall2(SYS_net_recv_pages, 0, (uint32_t) dstva, npages, 0, 0);
+}
+  800f69:	5b                   	pop    %ebx
+  800f6a:	5e                   	pop    %esi
+  800f6b:	5f                   	pop    %edi
+  800f6c:	5d                   	pop    %ebp
+  800f6d:	c3                   	ret
+
+00800f6e <sys_net_send_batch>:
+
+int
+sys_net_send_batch(const struct net_sg *pkts, int n)
+{
+  800f6e:	55                   	push   %ebp
+  800f6f:	89 e5                	mov    %esp,%ebp
+  800f71:	57                   	push   %edi
+  800f72:	56                   	push   %esi
+  800f73:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800f74:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f79:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f7c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f7f:	b8 14 00 00 00       	mov    $0x14,%eax
+  800f84:	89 df                	mov    %ebx,%edi
+  800f86:	55                   	push   %ebp
+  800f87:	89 e5                	mov    %esp,%ebp
+  800f89:	8d 35 91 0f 80 00    	lea    0x800f91,%esi
+  800f8f:	0f 34                	sysenter
+  800f91:	5d                   	pop    %ebp
+	return syscall2(SYS_net_send_batch, 0, (uint32_t) pkts, n, 0, 0);
+}
+  800f92:	5b                   	pop    %ebx
+  800f93:	5e                   	pop    %esi
+  800f94:	5f                   	pop    %edi
+  800f95:	5d                   	pop    %ebp
+  800f96:	c3                   	ret
+
+00800f97 <sys_net_send_sg>:
+
+int
+sys_net_send_sg(const struct net_sg *sg, int nsg,
+		const struct net_offload *off, struct net_txinfo *info)
+{
+  800f97:	55                   	push   %ebp
+  800f98:	89 e5                	mov    %esp,%ebp
+  800f9a:	57                   	push   %edi
+  800f9b:	56                   	push   %esi
+  800f9c:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800f9d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fa0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fa3:	b8 13 00 00 00       	mov    $0x13,%eax
+  800fa8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800fab:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800fae:	55                   	push   %ebp
+  800faf:	89 e5                	mov    %esp,%ebp
+  800fb1:	8d 35 b9 0f 80 00    	lea    0x800fb9,%esi
+  800fb7:	0f 34                	sysenter
+  800fb9:	5d                   	pop    %ebp
+	return syscall2(SYS_net_send_sg, 0, (uint32_t) sg, nsg, (uint32_t) off,
+			(uint32_t) info);
+}
+  800fba:	5b                   	pop    %ebx
+  800fbb:	5e                   	pop    %esi
+  800fbc:	5f                   	pop    %edi
+  800fbd:	5d                   	pop    %ebp
+  800fbe:	c3                   	ret
+
+00800fbf <sys_net_wait>:
+
+int
+sys_net_wait(uint32_t events)
+{
+  800fbf:	55                   	push   %ebp
+  800fc0:	89 e5                	mov    %esp,%ebp
+  800fc2:	57                   	push   %edi
+  800fc3:	56                   	push   %esi
+  800fc4:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800fc5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800fca:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fcd:	b8 11 00 00 00       	mov    $0x11,%eax
+  800fd2:	89 cb                	mov    %ecx,%ebx
+  800fd4:	89 cf                	mov    %ecx,%edi
+  800fd6:	89 ce                	mov    %ecx,%esi
+  800fd8:	cd 30                	int    $0x30
+	// Blocks, so it has to go through the trap gate.
+	return syscall(SYS_net_wait, 0, events, 0, 0, 0, 0);
+}
+  800fda:	5b                   	pop    %ebx
+  800fdb:	5e                   	pop    %esi
+  800fdc:	5f                   	pop    %edi
+  800fdd:	5d                   	pop    %ebp
+  800fde:	c3                   	ret
+
+00800fdf <sys_net_map>:
+
+int
+sys_net_map(void *va)
+{
+  800fdf:	55                   	push   %ebp
+  800fe0:	89 e5                	mov    %esp,%ebp
+  800fe2:	57                   	push   %edi
+  800fe3:	56                   	push   %esi
+  800fe4:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800fe5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800fea:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fed:	b8 15 00 00 00       	mov    $0x15,%eax
+  800ff2:	89 cb                	mov    %ecx,%ebx
+  800ff4:	89 cf                	mov    %ecx,%edi
+  800ff6:	55                   	push   %ebp
+  800ff7:	89 e5                	mov    %esp,%ebp
+  800ff9:	8d 35 01 10 80 00    	lea    0x801001,%esi
+  800fff:	0f 34                	sysenter
+  801001:	5d                   	pop    %ebp
+	return syscall2(SYS_net_map, 0, (uint32_t) va, 0, 0, 0);
+}
+  801002:	5b                   	pop    %ebx
+  801003:	5e                   	pop    %esi
+  801004:	5f                   	pop    %edi
+  801005:	5d                   	pop    %ebp
+  801006:	c3                   	ret
+
+00801007 <sys_net_sync>:
+
+int
+sys_net_sync(uint32_t rings)
+{
+  801007:	55                   	push   %ebp
+  801008:	89 e5                	mov    %esp,%ebp
+  80100a:	57                   	push   %edi
+  80100b:	56                   	push   %esi
+  80100c:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  80100d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801012:	8b 55 08             	mov    0x8(%ebp),%edx
+  801015:	b8 16 00 00 00       	mov    $0x16,%eax
+  80101a:	89 cb                	mov    %ecx,%ebx
+  80101c:	89 cf                	mov    %ecx,%edi
+  80101e:	55                   	push   %ebp
+  80101f:	89 e5                	mov    %esp,%ebp
+  801021:	8d 35 29 10 80 00    	lea    0x801029,%esi
+  801027:	0f 34                	sysenter
+  801029:	5d                   	pop    %ebp
+	return syscall2(SYS_net_sync, 0, rings, 0, 0, 0);
+}
+  80102a:	5b                   	pop    %ebx
+  80102b:	5e                   	pop    %esi
+  80102c:	5f                   	pop    %edi
+  80102d:	5d                   	pop    %ebp
+  80102e:	c3                   	ret
+
+0080102f <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  80102f:	55                   	push   %ebp
+  801030:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801032:	8b 45 08             	mov    0x8(%ebp),%eax
+  801035:	05 00 00 00 30       	add    $0x30000000,%eax
+  80103a:	c1 e8 0c             	shr    $0xc,%eax
+}
+  80103d:	5d                   	pop    %ebp
+  80103e:	c3                   	ret
+
+0080103f <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  80103f:	55                   	push   %ebp
+  801040:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801042:	8b 45 08             	mov    0x8(%ebp),%eax
+  801045:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  80104a:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  80104f:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  801054:	5d                   	pop    %ebp
+  801055:	c3                   	ret
+
+00801056 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  801056:	55                   	push   %ebp
+  801057:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  801059:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  80105e:	eb 02                	jmp    801062 <fd_alloc+0xc>
+  801060:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  801062:	89 c2                	mov    %eax,%edx
+  801064:	c1 ea 16             	shr    $0x16,%edx
+  801067:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  80106e:	f6 c2 01             	test   $0x1,%dl
+  801071:	74 2b                	je     80109e <fd_alloc+0x48>
+  801073:	89 c2                	mov    %eax,%edx
+  801075:	c1 ea 0c             	shr    $0xc,%edx
+  801078:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  80107f:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  801085:	f6 c1 01             	test   $0x1,%cl
+  801088:	74 14                	je     80109e <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  80108a:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  801090:	75 ce                	jne    801060 <fd_alloc+0xa>
+  801092:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  801097:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  80109c:	eb 05                	jmp    8010a3 <fd_alloc+0x4d>
+			return 0;
+  80109e:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  8010a3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010a6:	89 02                	mov    %eax,(%edx)
+}
+  8010a8:	89 c8                	mov    %ecx,%eax
+  8010aa:	5d                   	pop    %ebp
+  8010ab:	c3                   	ret
+
+008010ac <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  8010ac:	55                   	push   %ebp
+  8010ad:	89 e5                	mov    %esp,%ebp
+  8010af:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  8010b2:	83 f8 1f             	cmp    $0x1f,%eax
+  8010b5:	77 30                	ja     8010e7 <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  8010b7:	c1 e0 0c             	shl    $0xc,%eax
+  8010ba:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  8010bf:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  8010c5:	f6 c2 01             	test   $0x1,%dl
+  8010c8:	74 24                	je     8010ee <fd_lookup+0x42>
+  8010ca:	89 c2                	mov    %eax,%edx
+  8010cc:	c1 ea 0c             	shr    $0xc,%edx
+  8010cf:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8010d6:	f6 c2 01             	test   $0x1,%dl
+  8010d9:	74 1a                	je     8010f5 <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  8010db:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8010de:	89 02                	mov    %eax,(%edx)
+	return 0;
+  8010e0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8010e5:	5d                   	pop    %ebp
+  8010e6:	c3                   	ret
+		return -E_INVAL;
+  8010e7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8010ec:	eb f7                	jmp    8010e5 <fd_lookup+0x39>
+		return -E_INVAL;
+  8010ee:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8010f3:	eb f0                	jmp    8010e5 <fd_lookup+0x39>
+  8010f5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8010fa:	eb e9                	jmp    8010e5 <fd_lookup+0x39>
+
+008010fc <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  8010fc:	55                   	push   %ebp
+  8010fd:	89 e5                	mov    %esp,%ebp
+  8010ff:	53                   	push   %ebx
+  801100:	83 ec 04             	sub    $0x4,%esp
+  801103:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  801106:	b8 00 00 00 00       	mov    $0x0,%eax
+  80110b:	eb 03                	jmp    801110 <dev_lookup+0x14>
+  80110d:	83 c0 01             	add    $0x1,%eax
+  801110:	8b 1c 85 50 3c 80 00 	mov    0x803c50(,%eax,4),%ebx
+  801117:	85 db                	test   %ebx,%ebx
+  801119:	74 0b                	je     801126 <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  80111b:	39 13                	cmp    %edx,(%ebx)
+  80111d:	75 ee                	jne    80110d <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  80111f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801124:	eb 1f                	jmp    801145 <dev_lookup+0x49>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801126:	a1 00 50 80 00       	mov    0x805000,%eax
+  80112b:	8b 40 48             	mov    0x48(%eax),%eax
+  80112e:	83 ec 04             	sub    $0x4,%esp
+  801131:	52                   	push   %edx
+  801132:	50                   	push   %eax
+  801133:	68 d4 3b 80 00       	push   $0x803bd4
+  801138:	e8 f7 f0 ff ff       	call   800234 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  80113d:	83 c4 10             	add    $0x10,%esp
+  801140:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  801145:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801148:	89 1a                	mov    %ebx,(%edx)
+}
+  80114a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80114d:	c9                   	leave
+  80114e:	c3                   	ret
+
+0080114f <fd_close>:
+{
+  80114f:	55                   	push   %ebp
+  801150:	89 e5                	mov    %esp,%ebp
+  801152:	57                   	push   %edi
+  801153:	56                   	push   %esi
+  801154:	53                   	push   %ebx
+  801155:	83 ec 24             	sub    $0x24,%esp
+  801158:	8b 75 08             	mov    0x8(%ebp),%esi
+  80115b:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  80115e:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801161:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  801162:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  801168:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  80116b:	50                   	push   %eax
+  80116c:	e8 3b ff ff ff       	call   8010ac <fd_lookup>
+  801171:	89 c3                	mov    %eax,%ebx
+  801173:	83 c4 10             	add    $0x10,%esp
+  801176:	85 c0                	test   %eax,%eax
+  801178:	78 05                	js     80117f <fd_close+0x30>
+	    || fd != fd2)
+  80117a:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  80117d:	74 16                	je     801195 <fd_close+0x46>
+		return (must_exist ? r : 0);
+  80117f:	89 f8                	mov    %edi,%eax
+  801181:	84 c0                	test   %al,%al
+  801183:	b8 00 00 00 00       	mov    $0x0,%eax
+  801188:	0f 44 d8             	cmove  %eax,%ebx
+}
+  80118b:	89 d8                	mov    %ebx,%eax
+  80118d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801190:	5b                   	pop    %ebx
+  801191:	5e                   	pop    %esi
+  801192:	5f                   	pop    %edi
+  801193:	5d                   	pop    %ebp
+  801194:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801195:	83 ec 08             	sub    $0x8,%esp
+  801198:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  80119b:	50                   	push   %eax
+  80119c:	ff 36                	push   (%esi)
+  80119e:	e8 59 ff ff ff       	call   8010fc <dev_lookup>
+  8011a3:	89 c3                	mov    %eax,%ebx
+  8011a5:	83 c4 10             	add    $0x10,%esp
+  8011a8:	85 c0                	test   %eax,%eax
+  8011aa:	78 1a                	js     8011c6 <fd_close+0x77>
+		if (dev->dev_close)
+  8011ac:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8011af:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  8011b2:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  8011b7:	85 c0                	test   %eax,%eax
+  8011b9:	74 0b                	je     8011c6 <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  8011bb:	83 ec 0c             	sub    $0xc,%esp
+  8011be:	56                   	push   %esi
+  8011bf:	ff d0                	call   *%eax
+  8011c1:	89 c3                	mov    %eax,%ebx
+  8011c3:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  8011c6:	83 ec 08             	sub    $0x8,%esp
+  8011c9:	56                   	push   %esi
+  8011ca:	6a 00                	push   $0x0
+  8011cc:	e8 ea fa ff ff       	call   800cbb <sys_page_unmap>
+	return r;
+  8011d1:	83 c4 10             	add    $0x10,%esp
+  8011d4:	eb b5                	jmp    80118b <fd_close+0x3c>
+
+008011d6 <close>:
+
+int
+close(int fdnum)
+{
+  8011d6:	55                   	push   %ebp
+  8011d7:	89 e5                	mov    %esp,%ebp
+  8011d9:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8011dc:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8011df:	50                   	push   %eax
+  8011e0:	ff 75 08             	push   0x8(%ebp)
+  8011e3:	e8 c4 fe ff ff       	call   8010ac <fd_lookup>
+  8011e8:	83 c4 10             	add    $0x10,%esp
+  8011eb:	85 c0                	test   %eax,%eax
+  8011ed:	79 02                	jns    8011f1 <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  8011ef:	c9                   	leave
+  8011f0:	c3                   	ret
+		return fd_close(fd, 1);
+  8011f1:	83 ec 08             	sub    $0x8,%esp
+  8011f4:	6a 01                	push   $0x1
+  8011f6:	ff 75 f4             	push   -0xc(%ebp)
+  8011f9:	e8 51 ff ff ff       	call   80114f <fd_close>
+  8011fe:	83 c4 10             	add    $0x10,%esp
+  801201:	eb ec                	jmp    8011ef <close+0x19>
+
+00801203 <close_all>:
+
+void
+close_all(void)
+{
+  801203:	55                   	push   %ebp
+  801204:	89 e5                	mov    %esp,%ebp
+  801206:	53                   	push   %ebx
+  801207:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  80120a:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  80120f:	83 ec 0c             	sub    $0xc,%esp
+  801212:	53                   	push   %ebx
+  801213:	e8 be ff ff ff       	call   8011d6 <close>
+	for (i = 0; i < MAXFD; i++)
+  801218:	83 c3 01             	add    $0x1,%ebx
+  80121b:	83 c4 10             	add    $0x10,%esp
+  80121e:	83 fb 20             	cmp    $0x20,%ebx
+  801221:	75 ec                	jne    80120f <close_all+0xc>
+}
+  801223:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801226:	c9                   	leave
+  801227:	c3                   	ret
+
+00801228 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  801228:	55                   	push   %ebp
+  801229:	89 e5                	mov    %esp,%ebp
+  80122b:	57                   	push   %edi
+  80122c:	56                   	push   %esi
+  80122d:	53                   	push   %ebx
+  80122e:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  801231:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801234:	50                   	push   %eax
+  801235:	ff 75 08             	push   0x8(%ebp)
+  801238:	e8 6f fe ff ff       	call   8010ac <fd_lookup>
+  80123d:	89 c3                	mov    %eax,%ebx
+  80123f:	83 c4 10             	add    $0x10,%esp
+  801242:	85 c0                	test   %eax,%eax
+  801244:	78 7f                	js     8012c5 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  801246:	83 ec 0c             	sub    $0xc,%esp
+  801249:	ff 75 0c             	push   0xc(%ebp)
+  80124c:	e8 85 ff ff ff       	call   8011d6 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  801251:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801254:	c1 e6 0c             	shl    $0xc,%esi
+  801257:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  80125d:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  801260:	89 3c 24             	mov    %edi,(%esp)
+  801263:	e8 d7 fd ff ff       	call   80103f <fd2data>
+  801268:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  80126a:	89 34 24             	mov    %esi,(%esp)
+  80126d:	e8 cd fd ff ff       	call   80103f <fd2data>
+  801272:	83 c4 10             	add    $0x10,%esp
+  801275:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  801278:	89 d8                	mov    %ebx,%eax
+  80127a:	c1 e8 16             	shr    $0x16,%eax
+  80127d:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801284:	a8 01                	test   $0x1,%al
+  801286:	74 11                	je     801299 <dup+0x71>
+  801288:	89 d8                	mov    %ebx,%eax
+  80128a:	c1 e8 0c             	shr    $0xc,%eax
+  80128d:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801294:	f6 c2 01             	test   $0x1,%dl
+  801297:	75 36                	jne    8012cf <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  801299:	89 f8                	mov    %edi,%eax
+  80129b:	c1 e8 0c             	shr    $0xc,%eax
+  80129e:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8012a5:	83 ec 0c             	sub    $0xc,%esp
+  8012a8:	25 07 0e 00 00       	and    $0xe07,%eax
+  8012ad:	50                   	push   %eax
+  8012ae:	56                   	push   %esi
+  8012af:	6a 00                	push   $0x0
+  8012b1:	57                   	push   %edi
+  8012b2:	6a 00                	push   $0x0
+  8012b4:	e8 c0 f9 ff ff       	call   800c79 <sys_page_map>
+  8012b9:	89 c3                	mov    %eax,%ebx
+  8012bb:	83 c4 20             	add    $0x20,%esp
+  8012be:	85 c0                	test   %eax,%eax
+  8012c0:	78 33                	js     8012f5 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  8012c2:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  8012c5:	89 d8                	mov    %ebx,%eax
+  8012c7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8012ca:	5b                   	pop    %ebx
+  8012cb:	5e                   	pop    %esi
+  8012cc:	5f                   	pop    %edi
+  8012cd:	5d                   	pop    %ebp
+  8012ce:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  8012cf:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8012d6:	83 ec 0c             	sub    $0xc,%esp
+  8012d9:	25 07 0e 00 00       	and    $0xe07,%eax
+  8012de:	50                   	push   %eax
+  8012df:	ff 75 d4             	push   -0x2c(%ebp)
+  8012e2:	6a 00                	push   $0x0
+  8012e4:	53                   	push   %ebx
+  8012e5:	6a 00                	push   $0x0
+  8012e7:	e8 8d f9 ff ff       	call   800c79 <sys_page_map>
+  8012ec:	89 c3                	mov    %eax,%ebx
+  8012ee:	83 c4 20             	add    $0x20,%esp
+  8012f1:	85 c0                	test   %eax,%eax
+  8012f3:	79 a4                	jns    801299 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  8012f5:	83 ec 08             	sub    $0x8,%esp
+  8012f8:	56                   	push   %esi
+  8012f9:	6a 00                	push   $0x0
+  8012fb:	e8 bb f9 ff ff       	call   800cbb <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  801300:	83 c4 08             	add    $0x8,%esp
+  801303:	ff 75 d4             	push   -0x2c(%ebp)
+  801306:	6a 00                	push   $0x0
+  801308:	e8 ae f9 ff ff       	call   800cbb <sys_page_unmap>
+	return r;
+  80130d:	83 c4 10             	add    $0x10,%esp
+  801310:	eb b3                	jmp    8012c5 <dup+0x9d>
+
+00801312 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  801312:	55                   	push   %ebp
+  801313:	89 e5                	mov    %esp,%ebp
+  801315:	56                   	push   %esi
+  801316:	53                   	push   %ebx
+  801317:	83 ec 18             	sub    $0x18,%esp
+  80131a:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80131d:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801320:	50                   	push   %eax
+  801321:	56                   	push   %esi
+  801322:	e8 85 fd ff ff       	call   8010ac <fd_lookup>
+  801327:	83 c4 10             	add    $0x10,%esp
+  80132a:	85 c0                	test   %eax,%eax
+  80132c:	78 3c                	js     80136a <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80132e:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  801331:	83 ec 08             	sub    $0x8,%esp
+  801334:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801337:	50                   	push   %eax
+  801338:	ff 33                	push   (%ebx)
+  80133a:	e8 bd fd ff ff       	call   8010fc <dev_lookup>
+  80133f:	83 c4 10             	add    $0x10,%esp
+  801342:	85 c0                	test   %eax,%eax
+  801344:	78 24                	js     80136a <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801346:	8b 43 08             	mov    0x8(%ebx),%eax
+  801349:	83 e0 03             	and    $0x3,%eax
+  80134c:	83 f8 01             	cmp    $0x1,%eax
+  80134f:	74 20                	je     801371 <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  801351:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801354:	8b 40 08             	mov    0x8(%eax),%eax
+  801357:	85 c0                	test   %eax,%eax
+  801359:	74 37                	je     801392 <read+0x80>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  80135b:	83 ec 04             	sub    $0x4,%esp
+  80135e:	ff 75 10             	push   0x10(%ebp)
+  801361:	ff 75 0c             	push   0xc(%ebp)
+  801364:	53                   	push   %ebx
+  801365:	ff d0                	call   *%eax
+  801367:	83 c4 10             	add    $0x10,%esp
+}
+  80136a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80136d:	5b                   	pop    %ebx
+  80136e:	5e                   	pop    %esi
+  80136f:	5d                   	pop    %ebp
+  801370:	c3                   	ret
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801371:	a1 00 50 80 00       	mov    0x805000,%eax
+  801376:	8b 40 48             	mov    0x48(%eax),%eax
+  801379:	83 ec 04             	sub    $0x4,%esp
+  80137c:	56                   	push   %esi
+  80137d:	50                   	push   %eax
+  80137e:	68 15 3c 80 00       	push   $0x803c15
+  801383:	e8 ac ee ff ff       	call   800234 <cprintf>
+		return -E_INVAL;
+  801388:	83 c4 10             	add    $0x10,%esp
+  80138b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801390:	eb d8                	jmp    80136a <read+0x58>
+		return -E_NOT_SUPP;
+  801392:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801397:	eb d1                	jmp    80136a <read+0x58>
+
+00801399 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  801399:	55                   	push   %ebp
+  80139a:	89 e5                	mov    %esp,%ebp
+  80139c:	57                   	push   %edi
+  80139d:	56                   	push   %esi
+  80139e:	53                   	push   %ebx
+  80139f:	83 ec 0c             	sub    $0xc,%esp
+  8013a2:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8013a5:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  8013a8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013ad:	eb 02                	jmp    8013b1 <readn+0x18>
+  8013af:	01 c3                	add    %eax,%ebx
+  8013b1:	39 f3                	cmp    %esi,%ebx
+  8013b3:	73 21                	jae    8013d6 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  8013b5:	83 ec 04             	sub    $0x4,%esp
+  8013b8:	89 f0                	mov    %esi,%eax
+  8013ba:	29 d8                	sub    %ebx,%eax
+  8013bc:	50                   	push   %eax
+  8013bd:	89 d8                	mov    %ebx,%eax
+  8013bf:	03 45 0c             	add    0xc(%ebp),%eax
+  8013c2:	50                   	push   %eax
+  8013c3:	57                   	push   %edi
+  8013c4:	e8 49 ff ff ff       	call   801312 <read>
+		if (m < 0)
+  8013c9:	83 c4 10             	add    $0x10,%esp
+  8013cc:	85 c0                	test   %eax,%eax
+  8013ce:	78 04                	js     8013d4 <readn+0x3b>
+			return m;
+		if (m == 0)
+  8013d0:	75 dd                	jne    8013af <readn+0x16>
+  8013d2:	eb 02                	jmp    8013d6 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  8013d4:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  8013d6:	89 d8                	mov    %ebx,%eax
+  8013d8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8013db:	5b                   	pop    %ebx
+  8013dc:	5e                   	pop    %esi
+  8013dd:	5f                   	pop    %edi
+  8013de:	5d                   	pop    %ebp
+  8013df:	c3                   	ret
+
+008013e0 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  8013e0:	55                   	push   %ebp
+  8013e1:	89 e5                	mov    %esp,%ebp
+  8013e3:	56                   	push   %esi
+  8013e4:	53                   	push   %ebx
+  8013e5:	83 ec 18             	sub    $0x18,%esp
+  8013e8:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8013eb:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8013ee:	50                   	push   %eax
+  8013ef:	53                   	push   %ebx
+  8013f0:	e8 b7 fc ff ff       	call   8010ac <fd_lookup>
+  8013f5:	83 c4 10             	add    $0x10,%esp
+  8013f8:	85 c0                	test   %eax,%eax
+  8013fa:	78 37                	js     801433 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8013fc:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8013ff:	83 ec 08             	sub    $0x8,%esp
+  801402:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801405:	50                   	push   %eax
+  801406:	ff 36                	push   (%esi)
+  801408:	e8 ef fc ff ff       	call   8010fc <dev_lookup>
+  80140d:	83 c4 10             	add    $0x10,%esp
+  801410:	85 c0                	test   %eax,%eax
+  801412:	78 1f                	js     801433 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801414:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801418:	74 20                	je     80143a <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  80141a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80141d:	8b 40 0c             	mov    0xc(%eax),%eax
+  801420:	85 c0                	test   %eax,%eax
+  801422:	74 37                	je     80145b <write+0x7b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  801424:	83 ec 04             	sub    $0x4,%esp
+  801427:	ff 75 10             	push   0x10(%ebp)
+  80142a:	ff 75 0c             	push   0xc(%ebp)
+  80142d:	56                   	push   %esi
+  80142e:	ff d0                	call   *%eax
+  801430:	83 c4 10             	add    $0x10,%esp
+}
+  801433:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801436:	5b                   	pop    %ebx
+  801437:	5e                   	pop    %esi
+  801438:	5d                   	pop    %ebp
+  801439:	c3                   	ret
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  80143a:	a1 00 50 80 00       	mov    0x805000,%eax
+  80143f:	8b 40 48             	mov    0x48(%eax),%eax
+  801442:	83 ec 04             	sub    $0x4,%esp
+  801445:	53                   	push   %ebx
+  801446:	50                   	push   %eax
+  801447:	68 31 3c 80 00       	push   $0x803c31
+  80144c:	e8 e3 ed ff ff       	call   800234 <cprintf>
+		return -E_INVAL;
+  801451:	83 c4 10             	add    $0x10,%esp
+  801454:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801459:	eb d8                	jmp    801433 <write+0x53>
+		return -E_NOT_SUPP;
+  80145b:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801460:	eb d1                	jmp    801433 <write+0x53>
+
+00801462 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  801462:	55                   	push   %ebp
+  801463:	89 e5                	mov    %esp,%ebp
+  801465:	53                   	push   %ebx
+  801466:	83 ec 1c             	sub    $0x1c,%esp
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801469:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80146c:	50                   	push   %eax
+  80146d:	ff 75 08             	push   0x8(%ebp)
+  801470:	e8 37 fc ff ff       	call   8010ac <fd_lookup>
+  801475:	83 c4 10             	add    $0x10,%esp
+  801478:	85 c0                	test   %eax,%eax
+  80147a:	78 3a                	js     8014b6 <seek+0x54>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80147c:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  80147f:	83 ec 08             	sub    $0x8,%esp
+  801482:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801485:	50                   	push   %eax
+  801486:	ff 33                	push   (%ebx)
+  801488:	e8 6f fc ff ff       	call   8010fc <dev_lookup>
+  80148d:	83 c4 10             	add    $0x10,%esp
+  801490:	85 c0                	test   %eax,%eax
+  801492:	78 22                	js     8014b6 <seek+0x54>
+		return r;
+	// Anything buffered for the old position goes out first.
+	if (dev->dev_sync && (r = (*dev->dev_sync)(fd)) < 0)
+  801494:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801497:	8b 40 1c             	mov    0x1c(%eax),%eax
+  80149a:	85 c0                	test   %eax,%eax
+  80149c:	74 0d                	je     8014ab <seek+0x49>
+  80149e:	83 ec 0c             	sub    $0xc,%esp
+  8014a1:	53                   	push   %ebx
+  8014a2:	ff d0                	call   *%eax
+  8014a4:	83 c4 10             	add    $0x10,%esp
+  8014a7:	85 c0                	test   %eax,%eax
+  8014a9:	78 0b                	js     8014b6 <seek+0x54>
+		return r;
+	fd->fd_offset = offset;
+  8014ab:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8014ae:	89 43 04             	mov    %eax,0x4(%ebx)
+	return 0;
+  8014b1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8014b6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8014b9:	c9                   	leave
+  8014ba:	c3                   	ret
+
+008014bb <fsync>:
+
+// Push out anything the library has buffered for fdnum.
+int
+fsync(int fdnum)
+{
+  8014bb:	55                   	push   %ebp
+  8014bc:	89 e5                	mov    %esp,%ebp
+  8014be:	53                   	push   %ebx
+  8014bf:	83 ec 1c             	sub    $0x1c,%esp
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8014c2:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8014c5:	50                   	push   %eax
+  8014c6:	ff 75 08             	push   0x8(%ebp)
+  8014c9:	e8 de fb ff ff       	call   8010ac <fd_lookup>
+  8014ce:	83 c4 10             	add    $0x10,%esp
+  8014d1:	85 c0                	test   %eax,%eax
+  8014d3:	78 2b                	js     801500 <fsync+0x45>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8014d5:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  8014d8:	83 ec 08             	sub    $0x8,%esp
+  8014db:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8014de:	50                   	push   %eax
+  8014df:	ff 33                	push   (%ebx)
+  8014e1:	e8 16 fc ff ff       	call   8010fc <dev_lookup>
+  8014e6:	83 c4 10             	add    $0x10,%esp
+  8014e9:	85 c0                	test   %eax,%eax
+  8014eb:	78 13                	js     801500 <fsync+0x45>
+		return r;
+	if (!dev->dev_sync)
+  8014ed:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8014f0:	8b 40 1c             	mov    0x1c(%eax),%eax
+  8014f3:	85 c0                	test   %eax,%eax
+  8014f5:	74 0e                	je     801505 <fsync+0x4a>
+		return 0;
+	return (*dev->dev_sync)(fd);
+  8014f7:	83 ec 0c             	sub    $0xc,%esp
+  8014fa:	53                   	push   %ebx
+  8014fb:	ff d0                	call   *%eax
+  8014fd:	83 c4 10             	add    $0x10,%esp
+}
+  801500:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801503:	c9                   	leave
+  801504:	c3                   	ret
+		return 0;
+  801505:	b8 00 00 00 00       	mov    $0x0,%eax
+  80150a:	eb f4                	jmp    801500 <fsync+0x45>
+
+0080150c <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  80150c:	55                   	push   %ebp
+  80150d:	89 e5                	mov    %esp,%ebp
+  80150f:	56                   	push   %esi
+  801510:	53                   	push   %ebx
+  801511:	83 ec 18             	sub    $0x18,%esp
+  801514:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801517:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80151a:	50                   	push   %eax
+  80151b:	53                   	push   %ebx
+  80151c:	e8 8b fb ff ff       	call   8010ac <fd_lookup>
+  801521:	83 c4 10             	add    $0x10,%esp
+  801524:	85 c0                	test   %eax,%eax
+  801526:	78 34                	js     80155c <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801528:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80152b:	83 ec 08             	sub    $0x8,%esp
+  80152e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801531:	50                   	push   %eax
+  801532:	ff 36                	push   (%esi)
+  801534:	e8 c3 fb ff ff       	call   8010fc <dev_lookup>
+  801539:	83 c4 10             	add    $0x10,%esp
+  80153c:	85 c0                	test   %eax,%eax
+  80153e:	78 1c                	js     80155c <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801540:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801544:	74 1d                	je     801563 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  801546:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801549:	8b 40 18             	mov    0x18(%eax),%eax
+  80154c:	85 c0                	test   %eax,%eax
+  80154e:	74 34                	je     801584 <ftruncate+0x78>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  801550:	83 ec 08             	sub    $0x8,%esp
+  801553:	ff 75 0c             	push   0xc(%ebp)
+  801556:	56                   	push   %esi
+  801557:	ff d0                	call   *%eax
+  801559:	83 c4 10             	add    $0x10,%esp
+}
+  80155c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80155f:	5b                   	pop    %ebx
+  801560:	5e                   	pop    %esi
+  801561:	5d                   	pop    %ebp
+  801562:	c3                   	ret
+			thisenv->env_id, fdnum);
+  801563:	a1 00 50 80 00       	mov    0x805000,%eax
+  801568:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  80156b:	83 ec 04             	sub    $0x4,%esp
+  80156e:	53                   	push   %ebx
+  80156f:	50                   	push   %eax
+  801570:	68 f4 3b 80 00       	push   $0x803bf4
+  801575:	e8 ba ec ff ff       	call   800234 <cprintf>
+		return -E_INVAL;
+  80157a:	83 c4 10             	add    $0x10,%esp
+  80157d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801582:	eb d8                	jmp    80155c <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  801584:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801589:	eb d1                	jmp    80155c <ftruncate+0x50>
+
+0080158b <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  80158b:	55                   	push   %ebp
+  80158c:	89 e5                	mov    %esp,%ebp
+  80158e:	56                   	push   %esi
+  80158f:	53                   	push   %ebx
+  801590:	83 ec 18             	sub    $0x18,%esp
+  801593:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801596:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801599:	50                   	push   %eax
+  80159a:	ff 75 08             	push   0x8(%ebp)
+  80159d:	e8 0a fb ff ff       	call   8010ac <fd_lookup>
+  8015a2:	83 c4 10             	add    $0x10,%esp
+  8015a5:	85 c0                	test   %eax,%eax
+  8015a7:	78 49                	js     8015f2 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8015a9:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8015ac:	83 ec 08             	sub    $0x8,%esp
+  8015af:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8015b2:	50                   	push   %eax
+  8015b3:	ff 36                	push   (%esi)
+  8015b5:	e8 42 fb ff ff       	call   8010fc <dev_lookup>
+  8015ba:	83 c4 10             	add    $0x10,%esp
+  8015bd:	85 c0                	test   %eax,%eax
+  8015bf:	78 31                	js     8015f2 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  8015c1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8015c4:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  8015c8:	74 2f                	je     8015f9 <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  8015ca:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  8015cd:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  8015d4:	00 00 00 
+	stat->st_isdir = 0;
+  8015d7:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8015de:	00 00 00 
+	stat->st_dev = dev;
+  8015e1:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  8015e7:	83 ec 08             	sub    $0x8,%esp
+  8015ea:	53                   	push   %ebx
+  8015eb:	56                   	push   %esi
+  8015ec:	ff 50 14             	call   *0x14(%eax)
+  8015ef:	83 c4 10             	add    $0x10,%esp
+}
+  8015f2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8015f5:	5b                   	pop    %ebx
+  8015f6:	5e                   	pop    %esi
+  8015f7:	5d                   	pop    %ebp
+  8015f8:	c3                   	ret
+		return -E_NOT_SUPP;
+  8015f9:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8015fe:	eb f2                	jmp    8015f2 <fstat+0x67>
+
+00801600 <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  801600:	55                   	push   %ebp
+  801601:	89 e5                	mov    %esp,%ebp
+  801603:	56                   	push   %esi
+  801604:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY | O_NOBUF)) < 0)
+  801605:	83 ec 08             	sub    $0x8,%esp
+  801608:	68 00 10 00 00       	push   $0x1000
+  80160d:	ff 75 08             	push   0x8(%ebp)
+  801610:	e8 b3 07 00 00       	call   801dc8 <open>
+  801615:	89 c3                	mov    %eax,%ebx
+  801617:	83 c4 10             	add    $0x10,%esp
+  80161a:	85 c0                	test   %eax,%eax
+  80161c:	78 1b                	js     801639 <stat+0x39>
+		return fd;
+	r = fstat(fd, stat);
+  80161e:	83 ec 08             	sub    $0x8,%esp
+  801621:	ff 75 0c             	push   0xc(%ebp)
+  801624:	50                   	push   %eax
+  801625:	e8 61 ff ff ff       	call   80158b <fstat>
+  80162a:	89 c6                	mov    %eax,%esi
+	close(fd);
+  80162c:	89 1c 24             	mov    %ebx,(%esp)
+  80162f:	e8 a2 fb ff ff       	call   8011d6 <close>
+	return r;
+  801634:	83 c4 10             	add    $0x10,%esp
+  801637:	89 f3                	mov    %esi,%ebx
+}
+  801639:	89 d8                	mov    %ebx,%eax
+  80163b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80163e:	5b                   	pop    %ebx
+  80163f:	5e                   	pop    %esi
+  801640:	5d                   	pop    %ebp
+  801641:	c3                   	ret
+
+00801642 <fsipc_pages>:
+// need not be copied through fsipcbuf.  n must fit in FSBULK_MAXPAGES
+// pages.
+// Returns result from the file server.
+static int
+fsipc_pages(unsigned type, const void *buf, size_t n, int perm)
+{
+  801642:	55                   	push   %ebp
+  801643:	89 e5                	mov    %esp,%ebp
+  801645:	57                   	push   %edi
+  801646:	56                   	push   %esi
+  801647:	53                   	push   %ebx
+  801648:	81 ec 2c 01 00 00    	sub    $0x12c,%esp
+  80164e:	89 85 d4 fe ff ff    	mov    %eax,-0x12c(%ebp)
+  801654:	89 d6                	mov    %edx,%esi
+  801656:	89 8d d0 fe ff ff    	mov    %ecx,-0x130(%ebp)
+  80165c:	8b 7d 08             	mov    0x8(%ebp),%edi
+	uintptr_t pages[1 + FSBULK_MAXPAGES];
+	uintptr_t va, start = ROUNDDOWN((uintptr_t) buf, PGSIZE);
+  80165f:	89 d3                	mov    %edx,%ebx
+  801661:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+	int npages;
+
+	if (fsenv == 0)
+  801667:	83 3d c8 70 80 00 00 	cmpl   $0x0,0x8070c8
+  80166e:	74 1d                	je     80168d <fsipc_pages+0x4b>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+
+	pages[0] = (uintptr_t) &fsipcbuf | PTE_P | PTE_W | PTE_U;
+  801670:	b8 00 60 80 00       	mov    $0x806000,%eax
+  801675:	83 c8 07             	or     $0x7,%eax
+  801678:	89 85 e4 fe ff ff    	mov    %eax,-0x11c(%ebp)
+	npages = 1;
+  80167e:	b8 01 00 00 00       	mov    $0x1,%eax
+	for (va = start; va < (uintptr_t) buf + n; va += PGSIZE)
+  801683:	8b 8d d0 fe ff ff    	mov    -0x130(%ebp),%ecx
+  801689:	01 ce                	add    %ecx,%esi
+  80168b:	eb 28                	jmp    8016b5 <fsipc_pages+0x73>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  80168d:	83 ec 0c             	sub    $0xc,%esp
+  801690:	6a 01                	push   $0x1
+  801692:	e8 0c 1e 00 00       	call   8034a3 <ipc_find_env>
+  801697:	a3 c8 70 80 00       	mov    %eax,0x8070c8
+  80169c:	83 c4 10             	add    $0x10,%esp
+  80169f:	eb cf                	jmp    801670 <fsipc_pages+0x2e>
+		pages[npages++] = va | perm;
+  8016a1:	83 c0 01             	add    $0x1,%eax
+  8016a4:	89 fa                	mov    %edi,%edx
+  8016a6:	09 da                	or     %ebx,%edx
+  8016a8:	89 94 85 e0 fe ff ff 	mov    %edx,-0x120(%ebp,%eax,4)
+	for (va = start; va < (uintptr_t) buf + n; va += PGSIZE)
+  8016af:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8016b5:	39 f3                	cmp    %esi,%ebx
+  8016b7:	72 e8                	jb     8016a1 <fsipc_pages+0x5f>
+	assert(npages <= ARRAY_SIZE(pages));
+  8016b9:	83 f8 41             	cmp    $0x41,%eax
+  8016bc:	77 2f                	ja     8016ed <fsipc_pages+0xab>
+
+	if (debug)
+		cprintf("[%08x] fsipc_pages %d %08x %d pages\n",
+			thisenv->env_id, type, buf, npages - 1);
+
+	ipc_sendv(fsenv, type, pages, npages);
+  8016be:	50                   	push   %eax
+  8016bf:	8d 85 e4 fe ff ff    	lea    -0x11c(%ebp),%eax
+  8016c5:	50                   	push   %eax
+  8016c6:	ff b5 d4 fe ff ff    	push   -0x12c(%ebp)
+  8016cc:	ff 35 c8 70 80 00    	push   0x8070c8
+  8016d2:	e8 7e 1d 00 00       	call   803455 <ipc_sendv>
+	return ipc_recv(NULL, NULL, NULL);
+  8016d7:	83 c4 0c             	add    $0xc,%esp
+  8016da:	6a 00                	push   $0x0
+  8016dc:	6a 00                	push   $0x0
+  8016de:	6a 00                	push   $0x0
+  8016e0:	e8 1a 1c 00 00       	call   8032ff <ipc_recv>
+}
+  8016e5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8016e8:	5b                   	pop    %ebx
+  8016e9:	5e                   	pop    %esi
+  8016ea:	5f                   	pop    %edi
+  8016eb:	5d                   	pop    %ebp
+  8016ec:	c3                   	ret
+	assert(npages <= ARRAY_SIZE(pages));
+  8016ed:	68 64 3c 80 00       	push   $0x803c64
+  8016f2:	68 80 3c 80 00       	push   $0x803c80
+  8016f7:	6a 40                	push   $0x40
+  8016f9:	68 95 3c 80 00       	push   $0x803c95
+  8016fe:	e8 56 ea ff ff       	call   800159 <_panic>
+
+00801703 <fsring_post>:
+
+// Post a request of the given type for n bytes at 'offset' of fdnum,
+// with data page 'slot' already filled in as needed.
+static int
+fsring_post(uint32_t type, struct Fd *fd, off_t offset, size_t n, int slot)
+{
+  801703:	55                   	push   %ebp
+  801704:	89 e5                	mov    %esp,%ebp
+  801706:	57                   	push   %edi
+  801707:	56                   	push   %esi
+  801708:	53                   	push   %ebx
+  801709:	83 ec 1c             	sub    $0x1c,%esp
+  80170c:	89 c3                	mov    %eax,%ebx
+  80170e:	89 d6                	mov    %edx,%esi
+  801710:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+	struct Fsring_sqe *sqe;
+	uint32_t tail = fsring->r_sqtail;
+  801713:	8b 0d 04 00 00 cf    	mov    0xcf000004,%ecx
+
+	sqe = &fsring->r_sq[tail % FSRING_NSLOTS];
+  801719:	89 ca                	mov    %ecx,%edx
+  80171b:	83 e2 0f             	and    $0xf,%edx
+	sqe->sqe_type = type;
+  80171e:	8d 04 95 00 00 00 00 	lea    0x0(,%edx,4),%eax
+  801725:	8d 3c 10             	lea    (%eax,%edx,1),%edi
+  801728:	89 1c bd 10 00 00 cf 	mov    %ebx,-0x30fffff0(,%edi,4)
+	sqe->sqe_fileid = fd->fd_file.id;
+  80172f:	8b 76 0c             	mov    0xc(%esi),%esi
+  801732:	89 fb                	mov    %edi,%ebx
+  801734:	89 34 bd 14 00 00 cf 	mov    %esi,-0x30ffffec(,%edi,4)
+	sqe->sqe_offset = offset;
+  80173b:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80173e:	89 3c 9d 18 00 00 cf 	mov    %edi,-0x30ffffe8(,%ebx,4)
+	sqe->sqe_n = n;
+  801745:	8b 75 08             	mov    0x8(%ebp),%esi
+  801748:	89 34 9d 1c 00 00 cf 	mov    %esi,-0x30ffffe4(,%ebx,4)
+	sqe->sqe_slot = slot;
+  80174f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801752:	89 14 9d 20 00 00 cf 	mov    %edx,-0x30ffffe0(,%ebx,4)
+	// waking when the ring was empty before this request.  The kick
+	// gets no reply, and the server does not look at its request page.
+	// Publishing the tail with xchg, a full barrier, keeps the load of
+	// r_sqhead below from passing it; serve_ring_kick does the same the
+	// other way around, so one of the two sees the other's update.
+	xchg(&fsring->r_sqtail, tail + 1);
+  801759:	8d 41 01             	lea    0x1(%ecx),%eax
+xchg(volatile uint32_t *addr, uint32_t newval)
+{
+	uint32_t result;
+
+	// The + in "+m" denotes a read-modify-write operand.
+	asm volatile("lock; xchgl %0, %1"
+  80175c:	f0 87 05 04 00 00 cf 	lock xchg %eax,0xcf000004
+	if (fsring->r_sqhead == tail)
+  801763:	a1 00 00 00 cf       	mov    0xcf000000,%eax
+  801768:	39 c8                	cmp    %ecx,%eax
+  80176a:	74 0d                	je     801779 <fsring_post+0x76>
+		ipc_send(fsenv, FSREQ_RING_KICK, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+	return 0;
+}
+  80176c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801771:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801774:	5b                   	pop    %ebx
+  801775:	5e                   	pop    %esi
+  801776:	5f                   	pop    %edi
+  801777:	5d                   	pop    %ebp
+  801778:	c3                   	ret
+		ipc_send(fsenv, FSREQ_RING_KICK, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801779:	6a 07                	push   $0x7
+  80177b:	68 00 60 80 00       	push   $0x806000
+  801780:	6a 0d                	push   $0xd
+  801782:	ff 35 c8 70 80 00    	push   0x8070c8
+  801788:	e8 dd 1b 00 00       	call   80336a <ipc_send>
+  80178d:	83 c4 10             	add    $0x10,%esp
+  801790:	eb da                	jmp    80176c <fsring_post+0x69>
+
+00801792 <fsipcv>:
+{
+  801792:	55                   	push   %ebp
+  801793:	89 e5                	mov    %esp,%ebp
+  801795:	57                   	push   %edi
+  801796:	56                   	push   %esi
+  801797:	53                   	push   %ebx
+  801798:	83 ec 0c             	sub    $0xc,%esp
+  80179b:	89 c7                	mov    %eax,%edi
+  80179d:	89 d3                	mov    %edx,%ebx
+  80179f:	89 ce                	mov    %ecx,%esi
+	if (fsenv == 0)
+  8017a1:	83 3d c8 70 80 00 00 	cmpl   $0x0,0x8070c8
+  8017a8:	74 26                	je     8017d0 <fsipcv+0x3e>
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  8017aa:	6a 07                	push   $0x7
+  8017ac:	68 00 60 80 00       	push   $0x806000
+  8017b1:	57                   	push   %edi
+  8017b2:	ff 35 c8 70 80 00    	push   0x8070c8
+  8017b8:	e8 ad 1b 00 00       	call   80336a <ipc_send>
+	return ipc_recvv(NULL, dstva, npages, NULL);
+  8017bd:	6a 00                	push   $0x0
+  8017bf:	56                   	push   %esi
+  8017c0:	53                   	push   %ebx
+  8017c1:	6a 00                	push   $0x0
+  8017c3:	e8 fa 1b 00 00       	call   8033c2 <ipc_recvv>
+}
+  8017c8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8017cb:	5b                   	pop    %ebx
+  8017cc:	5e                   	pop    %esi
+  8017cd:	5f                   	pop    %edi
+  8017ce:	5d                   	pop    %ebp
+  8017cf:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  8017d0:	83 ec 0c             	sub    $0xc,%esp
+  8017d3:	6a 01                	push   $0x1
+  8017d5:	e8 c9 1c 00 00       	call   8034a3 <ipc_find_env>
+  8017da:	a3 c8 70 80 00       	mov    %eax,0x8070c8
+  8017df:	83 c4 10             	add    $0x10,%esp
+  8017e2:	eb c6                	jmp    8017aa <fsipcv+0x18>
+
+008017e4 <fsipc>:
+{
+  8017e4:	55                   	push   %ebp
+  8017e5:	89 e5                	mov    %esp,%ebp
+  8017e7:	83 ec 18             	sub    $0x18,%esp
+	int npages = 1;
+  8017ea:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+	return fsipcv(type, dstva, &npages);
+  8017f1:	8d 4d f4             	lea    -0xc(%ebp),%ecx
+  8017f4:	e8 99 ff ff ff       	call   801792 <fsipcv>
+}
+  8017f9:	c9                   	leave
+  8017fa:	c3                   	ret
+
+008017fb <file_write_direct>:
+{
+  8017fb:	55                   	push   %ebp
+  8017fc:	89 e5                	mov    %esp,%ebp
+  8017fe:	56                   	push   %esi
+  8017ff:	53                   	push   %ebx
+  801800:	89 c3                	mov    %eax,%ebx
+  801802:	89 c8                	mov    %ecx,%eax
+	if (n > sizeof(fsipcbuf.write.req_buf)) {
+  801804:	81 f9 f8 0f 00 00    	cmp    $0xff8,%ecx
+  80180a:	77 40                	ja     80184c <file_write_direct+0x51>
+	n = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  80180c:	b9 f8 0f 00 00       	mov    $0xff8,%ecx
+  801811:	39 c8                	cmp    %ecx,%eax
+  801813:	0f 47 c1             	cmova  %ecx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801816:	8b 4b 0c             	mov    0xc(%ebx),%ecx
+  801819:	89 0d 00 60 80 00    	mov    %ecx,0x806000
+	fsipcbuf.write.req_n = n;
+  80181f:	a3 04 60 80 00       	mov    %eax,0x806004
+	memmove(fsipcbuf.write.req_buf, buf, n);
+  801824:	83 ec 04             	sub    $0x4,%esp
+  801827:	50                   	push   %eax
+  801828:	52                   	push   %edx
+  801829:	68 08 60 80 00       	push   $0x806008
+  80182e:	e8 75 f1 ff ff       	call   8009a8 <memmove>
+	return fsipc(FSREQ_WRITE, NULL);
+  801833:	ba 00 00 00 00       	mov    $0x0,%edx
+  801838:	b8 04 00 00 00       	mov    $0x4,%eax
+  80183d:	e8 a2 ff ff ff       	call   8017e4 <fsipc>
+  801842:	83 c4 10             	add    $0x10,%esp
+}
+  801845:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801848:	5b                   	pop    %ebx
+  801849:	5e                   	pop    %esi
+  80184a:	5d                   	pop    %ebp
+  80184b:	c3                   	ret
+		n = MIN(n, FSBULK_MAXPAGES * PGSIZE - PGOFF(buf));
+  80184c:	89 d6                	mov    %edx,%esi
+  80184e:	81 e6 ff 0f 00 00    	and    $0xfff,%esi
+  801854:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  801859:	29 f1                	sub    %esi,%ecx
+  80185b:	39 c1                	cmp    %eax,%ecx
+  80185d:	0f 47 c8             	cmova  %eax,%ecx
+	fsipcbuf.bulk.req_fileid = fileid;
+  801860:	8b 43 0c             	mov    0xc(%ebx),%eax
+  801863:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.bulk.req_n = n;
+  801868:	89 0d 04 60 80 00    	mov    %ecx,0x806004
+	fsipcbuf.bulk.req_off = PGOFF(buf);
+  80186e:	89 35 08 60 80 00    	mov    %esi,0x806008
+	return fsipc_pages(type, buf, n, perm);
+  801874:	83 ec 0c             	sub    $0xc,%esp
+  801877:	6a 05                	push   $0x5
+  801879:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80187e:	e8 bf fd ff ff       	call   801642 <fsipc_pages>
+		return fsipc_bulk(FSREQ_WRITE_BULK, fd->fd_file.id, buf, n,
+  801883:	83 c4 10             	add    $0x10,%esp
+  801886:	eb bd                	jmp    801845 <file_write_direct+0x4a>
+
+00801888 <devfile_sync>:
+{
+  801888:	55                   	push   %ebp
+  801889:	89 e5                	mov    %esp,%ebp
+  80188b:	57                   	push   %edi
+  80188c:	56                   	push   %esi
+  80188d:	53                   	push   %ebx
+  80188e:	83 ec 28             	sub    $0x28,%esp
+  801891:	8b 75 08             	mov    0x8(%ebp),%esi
+	char *p = fd2data(fd);
+  801894:	56                   	push   %esi
+  801895:	e8 a5 f7 ff ff       	call   80103f <fd2data>
+  80189a:	89 c7                	mov    %eax,%edi
+	off_t pos = fd->fd_offset;
+  80189c:	8b 4e 04             	mov    0x4(%esi),%ecx
+	ff->buf_rlen = 0;
+  80189f:	c7 46 18 00 00 00 00 	movl   $0x0,0x18(%esi)
+	if (ff->buf_wlen == 0)
+  8018a6:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  8018a9:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (ff->buf_wlen == 0)
+  8018ae:	83 7e 1c 00          	cmpl   $0x0,0x1c(%esi)
+  8018b2:	74 45                	je     8018f9 <devfile_sync+0x71>
+	fd->fd_offset = ff->buf_base;
+  8018b4:	8b 46 14             	mov    0x14(%esi),%eax
+  8018b7:	89 46 04             	mov    %eax,0x4(%esi)
+	for (done = 0, r = 0; done < ff->buf_wlen; done += r)
+  8018ba:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018bf:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8018c4:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  8018c7:	8b 4e 1c             	mov    0x1c(%esi),%ecx
+  8018ca:	39 cb                	cmp    %ecx,%ebx
+  8018cc:	73 14                	jae    8018e2 <devfile_sync+0x5a>
+		if ((r = file_write_direct(fd, p + done, ff->buf_wlen - done)) <= 0)
+  8018ce:	29 d9                	sub    %ebx,%ecx
+  8018d0:	8d 14 1f             	lea    (%edi,%ebx,1),%edx
+  8018d3:	89 f0                	mov    %esi,%eax
+  8018d5:	e8 21 ff ff ff       	call   8017fb <file_write_direct>
+  8018da:	85 c0                	test   %eax,%eax
+  8018dc:	7e 04                	jle    8018e2 <devfile_sync+0x5a>
+	for (done = 0, r = 0; done < ff->buf_wlen; done += r)
+  8018de:	01 c3                	add    %eax,%ebx
+  8018e0:	eb e5                	jmp    8018c7 <devfile_sync+0x3f>
+	ff->buf_wlen = 0;
+  8018e2:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8018e5:	c7 46 1c 00 00 00 00 	movl   $0x0,0x1c(%esi)
+	fd->fd_offset = pos;
+  8018ec:	89 4e 04             	mov    %ecx,0x4(%esi)
+	return r < 0 ? r : 0;
+  8018ef:	85 c0                	test   %eax,%eax
+  8018f1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8018f6:	0f 4f c2             	cmovg  %edx,%eax
+}
+  8018f9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8018fc:	5b                   	pop    %ebx
+  8018fd:	5e                   	pop    %esi
+  8018fe:	5f                   	pop    %edi
+  8018ff:	5d                   	pop    %ebp
+  801900:	c3                   	ret
+
+00801901 <devfile_write>:
+{
+  801901:	55                   	push   %ebp
+  801902:	89 e5                	mov    %esp,%ebp
+  801904:	57                   	push   %edi
+  801905:	56                   	push   %esi
+  801906:	53                   	push   %ebx
+  801907:	83 ec 28             	sub    $0x28,%esp
+  80190a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80190d:	8b 75 10             	mov    0x10(%ebp),%esi
+	char *p = fd2data(fd);
+  801910:	53                   	push   %ebx
+  801911:	e8 29 f7 ff ff       	call   80103f <fd2data>
+  801916:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	off_t pos = fd->fd_offset;
+  801919:	8b 7b 04             	mov    0x4(%ebx),%edi
+	if (!ff->buffered)
+  80191c:	83 c4 10             	add    $0x10,%esp
+  80191f:	80 7b 10 00          	cmpb   $0x0,0x10(%ebx)
+  801923:	74 43                	je     801968 <devfile_write+0x67>
+	ff->buf_rlen = 0;
+  801925:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+	if (ff->buf_wlen > 0
+  80192c:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  80192f:	85 c0                	test   %eax,%eax
+  801931:	74 43                	je     801976 <devfile_write+0x75>
+	    && (pos != ff->buf_base + ff->buf_wlen
+  801933:	89 c2                	mov    %eax,%edx
+  801935:	03 53 14             	add    0x14(%ebx),%edx
+  801938:	39 fa                	cmp    %edi,%edx
+  80193a:	75 0b                	jne    801947 <devfile_write+0x46>
+		|| ff->buf_wlen + n > FILEBUF_SIZE)
+  80193c:	8d 14 30             	lea    (%eax,%esi,1),%edx
+  80193f:	81 fa 00 10 00 00    	cmp    $0x1000,%edx
+  801945:	76 66                	jbe    8019ad <devfile_write+0xac>
+	    && (r = devfile_sync(fd)) < 0)
+  801947:	83 ec 0c             	sub    $0xc,%esp
+  80194a:	53                   	push   %ebx
+  80194b:	e8 38 ff ff ff       	call   801888 <devfile_sync>
+  801950:	83 c4 10             	add    $0x10,%esp
+  801953:	85 c0                	test   %eax,%eax
+  801955:	78 4e                	js     8019a5 <devfile_write+0xa4>
+	if (n >= FILEBUF_SIZE)
+  801957:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  80195d:	77 56                	ja     8019b5 <devfile_write+0xb4>
+	if (ff->buf_wlen == 0)
+  80195f:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  801962:	85 c0                	test   %eax,%eax
+  801964:	75 20                	jne    801986 <devfile_write+0x85>
+  801966:	eb 16                	jmp    80197e <devfile_write+0x7d>
+		return file_write_direct(fd, buf, n);
+  801968:	89 f1                	mov    %esi,%ecx
+  80196a:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80196d:	89 d8                	mov    %ebx,%eax
+  80196f:	e8 87 fe ff ff       	call   8017fb <file_write_direct>
+  801974:	eb 2f                	jmp    8019a5 <devfile_write+0xa4>
+	if (n >= FILEBUF_SIZE)
+  801976:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  80197c:	77 37                	ja     8019b5 <devfile_write+0xb4>
+		ff->buf_base = pos;
+  80197e:	89 7b 14             	mov    %edi,0x14(%ebx)
+  801981:	b8 00 00 00 00       	mov    $0x0,%eax
+	memmove(p + ff->buf_wlen, buf, n);
+  801986:	83 ec 04             	sub    $0x4,%esp
+  801989:	56                   	push   %esi
+  80198a:	ff 75 0c             	push   0xc(%ebp)
+  80198d:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  801990:	01 c1                	add    %eax,%ecx
+  801992:	51                   	push   %ecx
+  801993:	e8 10 f0 ff ff       	call   8009a8 <memmove>
+	ff->buf_wlen += n;
+  801998:	01 73 1c             	add    %esi,0x1c(%ebx)
+	fd->fd_offset = pos + n;
+  80199b:	01 f7                	add    %esi,%edi
+  80199d:	89 7b 04             	mov    %edi,0x4(%ebx)
+	return n;
+  8019a0:	89 f0                	mov    %esi,%eax
+  8019a2:	83 c4 10             	add    $0x10,%esp
+}
+  8019a5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8019a8:	5b                   	pop    %ebx
+  8019a9:	5e                   	pop    %esi
+  8019aa:	5f                   	pop    %edi
+  8019ab:	5d                   	pop    %ebp
+  8019ac:	c3                   	ret
+	if (n >= FILEBUF_SIZE)
+  8019ad:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  8019b3:	76 d1                	jbe    801986 <devfile_write+0x85>
+		return file_write_direct(fd, buf, n);
+  8019b5:	89 f1                	mov    %esi,%ecx
+  8019b7:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8019ba:	89 d8                	mov    %ebx,%eax
+  8019bc:	e8 3a fe ff ff       	call   8017fb <file_write_direct>
+  8019c1:	eb e2                	jmp    8019a5 <devfile_write+0xa4>
+
+008019c3 <devfile_trunc>:
+{
+  8019c3:	55                   	push   %ebp
+  8019c4:	89 e5                	mov    %esp,%ebp
+  8019c6:	53                   	push   %ebx
+  8019c7:	83 ec 10             	sub    $0x10,%esp
+  8019ca:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if ((r = devfile_sync(fd)) < 0)
+  8019cd:	53                   	push   %ebx
+  8019ce:	e8 b5 fe ff ff       	call   801888 <devfile_sync>
+  8019d3:	83 c4 10             	add    $0x10,%esp
+  8019d6:	85 c0                	test   %eax,%eax
+  8019d8:	78 1f                	js     8019f9 <devfile_trunc+0x36>
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  8019da:	8b 43 0c             	mov    0xc(%ebx),%eax
+  8019dd:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.set_size.req_size = newsize;
+  8019e2:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8019e5:	a3 04 60 80 00       	mov    %eax,0x806004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  8019ea:	ba 00 00 00 00       	mov    $0x0,%edx
+  8019ef:	b8 02 00 00 00       	mov    $0x2,%eax
+  8019f4:	e8 eb fd ff ff       	call   8017e4 <fsipc>
+}
+  8019f9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8019fc:	c9                   	leave
+  8019fd:	c3                   	ret
+
+008019fe <devfile_stat>:
+{
+  8019fe:	55                   	push   %ebp
+  8019ff:	89 e5                	mov    %esp,%ebp
+  801a01:	56                   	push   %esi
+  801a02:	53                   	push   %ebx
+  801a03:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801a06:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if ((r = devfile_sync(fd)) < 0)
+  801a09:	83 ec 0c             	sub    $0xc,%esp
+  801a0c:	53                   	push   %ebx
+  801a0d:	e8 76 fe ff ff       	call   801888 <devfile_sync>
+  801a12:	83 c4 10             	add    $0x10,%esp
+  801a15:	85 c0                	test   %eax,%eax
+  801a17:	78 47                	js     801a60 <devfile_stat+0x62>
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801a19:	8b 43 0c             	mov    0xc(%ebx),%eax
+  801a1c:	a3 00 60 80 00       	mov    %eax,0x806000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  801a21:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a26:	b8 05 00 00 00       	mov    $0x5,%eax
+  801a2b:	e8 b4 fd ff ff       	call   8017e4 <fsipc>
+  801a30:	85 c0                	test   %eax,%eax
+  801a32:	78 2c                	js     801a60 <devfile_stat+0x62>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801a34:	83 ec 08             	sub    $0x8,%esp
+  801a37:	68 00 60 80 00       	push   $0x806000
+  801a3c:	56                   	push   %esi
+  801a3d:	e8 e0 ed ff ff       	call   800822 <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  801a42:	a1 80 60 80 00       	mov    0x806080,%eax
+  801a47:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801a4d:	a1 84 60 80 00       	mov    0x806084,%eax
+  801a52:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+	return 0;
+  801a58:	83 c4 10             	add    $0x10,%esp
+  801a5b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801a60:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801a63:	5b                   	pop    %ebx
+  801a64:	5e                   	pop    %esi
+  801a65:	5d                   	pop    %ebp
+  801a66:	c3                   	ret
+
+00801a67 <devfile_flush>:
+{
+  801a67:	55                   	push   %ebp
+  801a68:	89 e5                	mov    %esp,%ebp
+  801a6a:	56                   	push   %esi
+  801a6b:	53                   	push   %ebx
+  801a6c:	8b 75 08             	mov    0x8(%ebp),%esi
+	r = devfile_sync(fd);
+  801a6f:	83 ec 0c             	sub    $0xc,%esp
+  801a72:	56                   	push   %esi
+  801a73:	e8 10 fe ff ff       	call   801888 <devfile_sync>
+  801a78:	89 c3                	mov    %eax,%ebx
+	if (fd->fd_file.buffered)
+  801a7a:	83 c4 10             	add    $0x10,%esp
+  801a7d:	80 7e 10 00          	cmpb   $0x0,0x10(%esi)
+  801a81:	75 25                	jne    801aa8 <devfile_flush+0x41>
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801a83:	8b 46 0c             	mov    0xc(%esi),%eax
+  801a86:	a3 00 60 80 00       	mov    %eax,0x806000
+	return fsipc(FSREQ_FLUSH, NULL) ?: r;
+  801a8b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a90:	b8 06 00 00 00       	mov    $0x6,%eax
+  801a95:	e8 4a fd ff ff       	call   8017e4 <fsipc>
+  801a9a:	85 c0                	test   %eax,%eax
+  801a9c:	0f 45 d8             	cmovne %eax,%ebx
+}
+  801a9f:	89 d8                	mov    %ebx,%eax
+  801aa1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801aa4:	5b                   	pop    %ebx
+  801aa5:	5e                   	pop    %esi
+  801aa6:	5d                   	pop    %ebp
+  801aa7:	c3                   	ret
+		sys_page_unmap(0, fd2data(fd));
+  801aa8:	83 ec 0c             	sub    $0xc,%esp
+  801aab:	56                   	push   %esi
+  801aac:	e8 8e f5 ff ff       	call   80103f <fd2data>
+  801ab1:	83 c4 08             	add    $0x8,%esp
+  801ab4:	50                   	push   %eax
+  801ab5:	6a 00                	push   $0x0
+  801ab7:	e8 ff f1 ff ff       	call   800cbb <sys_page_unmap>
+  801abc:	83 c4 10             	add    $0x10,%esp
+  801abf:	eb c2                	jmp    801a83 <devfile_flush+0x1c>
+
+00801ac1 <fsring_slot>:
+
+// Find a free data page and get fdnum ready for a request on it.
+// Returns the slot number, or < 0 on error.
+static int
+fsring_slot(int fdnum, struct Fd **fd_store)
+{
+  801ac1:	55                   	push   %ebp
+  801ac2:	89 e5                	mov    %esp,%ebp
+  801ac4:	57                   	push   %edi
+  801ac5:	56                   	push   %esi
+  801ac6:	53                   	push   %ebx
+  801ac7:	83 ec 64             	sub    $0x64,%esp
+  801aca:	89 d7                	mov    %edx,%edi
+	int r, slot;
+
+	if ((r = fd_lookup(fdnum, fd_store)) < 0)
+  801acc:	52                   	push   %edx
+  801acd:	50                   	push   %eax
+  801ace:	e8 d9 f5 ff ff       	call   8010ac <fd_lookup>
+  801ad3:	89 c1                	mov    %eax,%ecx
+  801ad5:	83 c4 10             	add    $0x10,%esp
+  801ad8:	85 c0                	test   %eax,%eax
+  801ada:	0f 88 f2 00 00 00    	js     801bd2 <fsring_slot+0x111>
+		return r;
+	if ((*fd_store)->fd_dev_id != devfile.dev_id)
+  801ae0:	8b 07                	mov    (%edi),%eax
+  801ae2:	8b 15 20 40 80 00    	mov    0x804020,%edx
+  801ae8:	39 10                	cmp    %edx,(%eax)
+  801aea:	0f 85 03 01 00 00    	jne    801bf3 <fsring_slot+0x132>
+	if (fsring_env == thisenv->env_id)
+  801af0:	a1 00 50 80 00       	mov    0x805000,%eax
+  801af5:	8b 40 48             	mov    0x48(%eax),%eax
+  801af8:	3b 05 c4 70 80 00    	cmp    0x8070c4,%eax
+  801afe:	0f 84 96 00 00 00    	je     801b9a <fsring_slot+0xd9>
+	if (fsenv == 0)
+  801b04:	83 3d c8 70 80 00 00 	cmpl   $0x0,0x8070c8
+  801b0b:	0f 84 cb 00 00 00    	je     801bdc <fsring_slot+0x11b>
+	pages[0] = (uintptr_t) &fsipcbuf | PTE_P | PTE_W | PTE_U;
+  801b11:	b8 00 60 80 00       	mov    $0x806000,%eax
+  801b16:	83 c8 07             	or     $0x7,%eax
+  801b19:	89 45 a0             	mov    %eax,-0x60(%ebp)
+	for (i = 0; i < FSRING_NPAGES; i++) {
+  801b1c:	8d 75 a4             	lea    -0x5c(%ebp),%esi
+	pages[0] = (uintptr_t) &fsipcbuf | PTE_P | PTE_W | PTE_U;
+  801b1f:	bb 00 00 00 cf       	mov    $0xcf000000,%ebx
+		if ((r = sys_page_alloc(0, (char *) fsring + i * PGSIZE,
+  801b24:	83 ec 04             	sub    $0x4,%esp
+  801b27:	68 07 04 00 00       	push   $0x407
+  801b2c:	53                   	push   %ebx
+  801b2d:	6a 00                	push   $0x0
+  801b2f:	e8 fa f0 ff ff       	call   800c2e <sys_page_alloc>
+  801b34:	89 c1                	mov    %eax,%ecx
+  801b36:	83 c4 10             	add    $0x10,%esp
+  801b39:	85 c0                	test   %eax,%eax
+  801b3b:	0f 88 91 00 00 00    	js     801bd2 <fsring_slot+0x111>
+		pages[1 + i] = ((uintptr_t) fsring + i * PGSIZE) | PTE_P | PTE_W | PTE_U;
+  801b41:	89 d8                	mov    %ebx,%eax
+  801b43:	83 c8 07             	or     $0x7,%eax
+  801b46:	89 06                	mov    %eax,(%esi)
+	for (i = 0; i < FSRING_NPAGES; i++) {
+  801b48:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801b4e:	83 c6 04             	add    $0x4,%esi
+  801b51:	81 fb 00 10 01 cf    	cmp    $0xcf011000,%ebx
+  801b57:	75 cb                	jne    801b24 <fsring_slot+0x63>
+	ipc_sendv(fsenv, FSREQ_RING_SETUP, pages, ARRAY_SIZE(pages));
+  801b59:	6a 12                	push   $0x12
+  801b5b:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  801b5e:	50                   	push   %eax
+  801b5f:	6a 0c                	push   $0xc
+  801b61:	ff 35 c8 70 80 00    	push   0x8070c8
+  801b67:	e8 e9 18 00 00       	call   803455 <ipc_sendv>
+	if ((r = ipc_recv(NULL, NULL, NULL)) < 0)
+  801b6c:	83 c4 0c             	add    $0xc,%esp
+  801b6f:	6a 00                	push   $0x0
+  801b71:	6a 00                	push   $0x0
+  801b73:	6a 00                	push   $0x0
+  801b75:	e8 85 17 00 00       	call   8032ff <ipc_recv>
+  801b7a:	89 c1                	mov    %eax,%ecx
+  801b7c:	83 c4 10             	add    $0x10,%esp
+  801b7f:	85 c0                	test   %eax,%eax
+  801b81:	78 4f                	js     801bd2 <fsring_slot+0x111>
+	fsring_env = thisenv->env_id;
+  801b83:	a1 00 50 80 00       	mov    0x805000,%eax
+  801b88:	8b 40 48             	mov    0x48(%eax),%eax
+  801b8b:	a3 c4 70 80 00       	mov    %eax,0x8070c4
+	fsring_busy = 0;
+  801b90:	c7 05 c0 70 80 00 00 	movl   $0x0,0x8070c0
+  801b97:	00 00 00 
+		return -E_NOT_SUPP;
+	if ((r = fsring_setup()) < 0)
+		return r;
+	// Buffered writes must reach the server ahead of anything posted.
+	if ((r = devfile_sync(*fd_store)) < 0)
+  801b9a:	83 ec 0c             	sub    $0xc,%esp
+  801b9d:	ff 37                	push   (%edi)
+  801b9f:	e8 e4 fc ff ff       	call   801888 <devfile_sync>
+  801ba4:	89 c1                	mov    %eax,%ecx
+  801ba6:	83 c4 10             	add    $0x10,%esp
+  801ba9:	85 c0                	test   %eax,%eax
+  801bab:	78 25                	js     801bd2 <fsring_slot+0x111>
+		return r;
+	for (slot = 0; slot < FSRING_NSLOTS; slot++)
+		if (!(fsring_busy & (1 << slot)))
+  801bad:	8b 1d c0 70 80 00    	mov    0x8070c0,%ebx
+	for (slot = 0; slot < FSRING_NSLOTS; slot++)
+  801bb3:	b9 00 00 00 00       	mov    $0x0,%ecx
+		if (!(fsring_busy & (1 << slot)))
+  801bb8:	ba 01 00 00 00       	mov    $0x1,%edx
+  801bbd:	89 d0                	mov    %edx,%eax
+  801bbf:	d3 e0                	shl    %cl,%eax
+  801bc1:	85 d8                	test   %ebx,%eax
+  801bc3:	74 0d                	je     801bd2 <fsring_slot+0x111>
+	for (slot = 0; slot < FSRING_NSLOTS; slot++)
+  801bc5:	83 c1 01             	add    $0x1,%ecx
+  801bc8:	83 f9 10             	cmp    $0x10,%ecx
+  801bcb:	75 f0                	jne    801bbd <fsring_slot+0xfc>
+			return slot;
+	return -E_NO_MEM;
+  801bcd:	b9 fc ff ff ff       	mov    $0xfffffffc,%ecx
+}
+  801bd2:	89 c8                	mov    %ecx,%eax
+  801bd4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801bd7:	5b                   	pop    %ebx
+  801bd8:	5e                   	pop    %esi
+  801bd9:	5f                   	pop    %edi
+  801bda:	5d                   	pop    %ebp
+  801bdb:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801bdc:	83 ec 0c             	sub    $0xc,%esp
+  801bdf:	6a 01                	push   $0x1
+  801be1:	e8 bd 18 00 00       	call   8034a3 <ipc_find_env>
+  801be6:	a3 c8 70 80 00       	mov    %eax,0x8070c8
+  801beb:	83 c4 10             	add    $0x10,%esp
+  801bee:	e9 1e ff ff ff       	jmp    801b11 <fsring_slot+0x50>
+		return -E_NOT_SUPP;
+  801bf3:	b9 f1 ff ff ff       	mov    $0xfffffff1,%ecx
+  801bf8:	eb d8                	jmp    801bd2 <fsring_slot+0x111>
+
+00801bfa <file_read_direct>:
+{
+  801bfa:	55                   	push   %ebp
+  801bfb:	89 e5                	mov    %esp,%ebp
+  801bfd:	57                   	push   %edi
+  801bfe:	56                   	push   %esi
+  801bff:	53                   	push   %ebx
+  801c00:	83 ec 1c             	sub    $0x1c,%esp
+  801c03:	89 c7                	mov    %eax,%edi
+  801c05:	89 d6                	mov    %edx,%esi
+  801c07:	89 cb                	mov    %ecx,%ebx
+	if (n > PGSIZE) {
+  801c09:	81 f9 00 10 00 00    	cmp    $0x1000,%ecx
+  801c0f:	77 52                	ja     801c63 <file_read_direct+0x69>
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801c11:	8b 40 0c             	mov    0xc(%eax),%eax
+  801c14:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.read.req_n = n;
+  801c19:	89 0d 04 60 80 00    	mov    %ecx,0x806004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  801c1f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c24:	b8 03 00 00 00       	mov    $0x3,%eax
+  801c29:	e8 b6 fb ff ff       	call   8017e4 <fsipc>
+  801c2e:	89 c7                	mov    %eax,%edi
+  801c30:	85 c0                	test   %eax,%eax
+  801c32:	78 25                	js     801c59 <file_read_direct+0x5f>
+	assert(r <= n);
+  801c34:	39 c3                	cmp    %eax,%ebx
+  801c36:	0f 82 87 00 00 00    	jb     801cc3 <file_read_direct+0xc9>
+	assert(r <= PGSIZE);
+  801c3c:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  801c41:	0f 8f 95 00 00 00    	jg     801cdc <file_read_direct+0xe2>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  801c47:	83 ec 04             	sub    $0x4,%esp
+  801c4a:	50                   	push   %eax
+  801c4b:	68 00 60 80 00       	push   $0x806000
+  801c50:	56                   	push   %esi
+  801c51:	e8 52 ed ff ff       	call   8009a8 <memmove>
+	return r;
+  801c56:	83 c4 10             	add    $0x10,%esp
+}
+  801c59:	89 f8                	mov    %edi,%eax
+  801c5b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801c5e:	5b                   	pop    %ebx
+  801c5f:	5e                   	pop    %esi
+  801c60:	5f                   	pop    %edi
+  801c61:	5d                   	pop    %ebp
+  801c62:	c3                   	ret
+		n = MIN(n, FSBULK_MAXPAGES * PGSIZE - PGOFF(buf));
+  801c63:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  801c69:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  801c6e:	29 d1                	sub    %edx,%ecx
+  801c70:	39 d9                	cmp    %ebx,%ecx
+  801c72:	0f 46 d9             	cmovbe %ecx,%ebx
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  801c75:	89 f0                	mov    %esi,%eax
+  801c77:	8d 0c 1e             	lea    (%esi,%ebx,1),%ecx
+  801c7a:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  801c7d:	eb 0f                	jmp    801c8e <file_read_direct+0x94>
+		*(volatile char *) p = *(volatile char *) p;
+  801c7f:	0f b6 10             	movzbl (%eax),%edx
+  801c82:	88 10                	mov    %dl,(%eax)
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  801c84:	05 00 10 00 00       	add    $0x1000,%eax
+  801c89:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801c8e:	39 c8                	cmp    %ecx,%eax
+  801c90:	72 ed                	jb     801c7f <file_read_direct+0x85>
+	fsipcbuf.bulk.req_fileid = fileid;
+  801c92:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801c95:	8b 47 0c             	mov    0xc(%edi),%eax
+  801c98:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.bulk.req_n = n;
+  801c9d:	89 1d 04 60 80 00    	mov    %ebx,0x806004
+	fsipcbuf.bulk.req_off = PGOFF(buf);
+  801ca3:	89 15 08 60 80 00    	mov    %edx,0x806008
+	return fsipc_pages(type, buf, n, perm);
+  801ca9:	83 ec 0c             	sub    $0xc,%esp
+  801cac:	6a 07                	push   $0x7
+  801cae:	89 d9                	mov    %ebx,%ecx
+  801cb0:	89 f2                	mov    %esi,%edx
+  801cb2:	b8 09 00 00 00       	mov    $0x9,%eax
+  801cb7:	e8 86 f9 ff ff       	call   801642 <fsipc_pages>
+  801cbc:	89 c7                	mov    %eax,%edi
+		return fsipc_bulk(FSREQ_READ_BULK, fd->fd_file.id, buf, n,
+  801cbe:	83 c4 10             	add    $0x10,%esp
+  801cc1:	eb 96                	jmp    801c59 <file_read_direct+0x5f>
+	assert(r <= n);
+  801cc3:	68 a0 3c 80 00       	push   $0x803ca0
+  801cc8:	68 80 3c 80 00       	push   $0x803c80
+  801ccd:	68 dc 00 00 00       	push   $0xdc
+  801cd2:	68 95 3c 80 00       	push   $0x803c95
+  801cd7:	e8 7d e4 ff ff       	call   800159 <_panic>
+	assert(r <= PGSIZE);
+  801cdc:	68 b1 3c 80 00       	push   $0x803cb1
+  801ce1:	68 80 3c 80 00       	push   $0x803c80
+  801ce6:	68 dd 00 00 00       	push   $0xdd
+  801ceb:	68 95 3c 80 00       	push   $0x803c95
+  801cf0:	e8 64 e4 ff ff       	call   800159 <_panic>
+
+00801cf5 <devfile_read>:
+{
+  801cf5:	55                   	push   %ebp
+  801cf6:	89 e5                	mov    %esp,%ebp
+  801cf8:	57                   	push   %edi
+  801cf9:	56                   	push   %esi
+  801cfa:	53                   	push   %ebx
+  801cfb:	83 ec 28             	sub    $0x28,%esp
+  801cfe:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801d01:	8b 75 10             	mov    0x10(%ebp),%esi
+	char *p = fd2data(fd);
+  801d04:	53                   	push   %ebx
+  801d05:	e8 35 f3 ff ff       	call   80103f <fd2data>
+  801d0a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	off_t pos = fd->fd_offset;
+  801d0d:	8b 7b 04             	mov    0x4(%ebx),%edi
+	if (!ff->buffered)
+  801d10:	83 c4 10             	add    $0x10,%esp
+  801d13:	80 7b 10 00          	cmpb   $0x0,0x10(%ebx)
+  801d17:	74 7d                	je     801d96 <devfile_read+0xa1>
+	if (ff->buf_wlen > 0 && (r = devfile_sync(fd)) < 0)
+  801d19:	83 7b 1c 00          	cmpl   $0x0,0x1c(%ebx)
+  801d1d:	0f 85 81 00 00 00    	jne    801da4 <devfile_read+0xaf>
+	if (ff->buf_rlen == 0 || pos < ff->buf_base
+  801d23:	8b 43 18             	mov    0x18(%ebx),%eax
+  801d26:	85 c0                	test   %eax,%eax
+  801d28:	74 0d                	je     801d37 <devfile_read+0x42>
+  801d2a:	8b 53 14             	mov    0x14(%ebx),%edx
+  801d2d:	39 fa                	cmp    %edi,%edx
+  801d2f:	7f 06                	jg     801d37 <devfile_read+0x42>
+	    || pos >= ff->buf_base + ff->buf_rlen) {
+  801d31:	01 c2                	add    %eax,%edx
+  801d33:	39 d7                	cmp    %edx,%edi
+  801d35:	72 28                	jb     801d5f <devfile_read+0x6a>
+		ff->buf_rlen = 0;
+  801d37:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+		if (n >= FILEBUF_SIZE)
+  801d3e:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  801d44:	77 74                	ja     801dba <devfile_read+0xc5>
+		if ((r = file_read_direct(fd, p, FILEBUF_SIZE)) <= 0)
+  801d46:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  801d4b:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801d4e:	89 d8                	mov    %ebx,%eax
+  801d50:	e8 a5 fe ff ff       	call   801bfa <file_read_direct>
+  801d55:	85 c0                	test   %eax,%eax
+  801d57:	7e 35                	jle    801d8e <devfile_read+0x99>
+		ff->buf_base = pos;
+  801d59:	89 7b 14             	mov    %edi,0x14(%ebx)
+		ff->buf_rlen = r;
+  801d5c:	89 43 18             	mov    %eax,0x18(%ebx)
+	n = MIN(n, ff->buf_base + ff->buf_rlen - pos);
+  801d5f:	8b 53 14             	mov    0x14(%ebx),%edx
+  801d62:	89 d0                	mov    %edx,%eax
+  801d64:	03 43 18             	add    0x18(%ebx),%eax
+  801d67:	29 f8                	sub    %edi,%eax
+  801d69:	39 f0                	cmp    %esi,%eax
+  801d6b:	0f 46 f0             	cmovbe %eax,%esi
+	memmove(buf, p + (pos - ff->buf_base), n);
+  801d6e:	83 ec 04             	sub    $0x4,%esp
+  801d71:	56                   	push   %esi
+  801d72:	89 f8                	mov    %edi,%eax
+  801d74:	29 d0                	sub    %edx,%eax
+  801d76:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  801d79:	01 c1                	add    %eax,%ecx
+  801d7b:	51                   	push   %ecx
+  801d7c:	ff 75 0c             	push   0xc(%ebp)
+  801d7f:	e8 24 ec ff ff       	call   8009a8 <memmove>
+	fd->fd_offset = pos + n;
+  801d84:	01 f7                	add    %esi,%edi
+  801d86:	89 7b 04             	mov    %edi,0x4(%ebx)
+	return n;
+  801d89:	89 f0                	mov    %esi,%eax
+  801d8b:	83 c4 10             	add    $0x10,%esp
+}
+  801d8e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801d91:	5b                   	pop    %ebx
+  801d92:	5e                   	pop    %esi
+  801d93:	5f                   	pop    %edi
+  801d94:	5d                   	pop    %ebp
+  801d95:	c3                   	ret
+		return file_read_direct(fd, buf, n);
+  801d96:	89 f1                	mov    %esi,%ecx
+  801d98:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801d9b:	89 d8                	mov    %ebx,%eax
+  801d9d:	e8 58 fe ff ff       	call   801bfa <file_read_direct>
+  801da2:	eb ea                	jmp    801d8e <devfile_read+0x99>
+	if (ff->buf_wlen > 0 && (r = devfile_sync(fd)) < 0)
+  801da4:	83 ec 0c             	sub    $0xc,%esp
+  801da7:	53                   	push   %ebx
+  801da8:	e8 db fa ff ff       	call   801888 <devfile_sync>
+  801dad:	83 c4 10             	add    $0x10,%esp
+  801db0:	85 c0                	test   %eax,%eax
+  801db2:	0f 89 6b ff ff ff    	jns    801d23 <devfile_read+0x2e>
+  801db8:	eb d4                	jmp    801d8e <devfile_read+0x99>
+			return file_read_direct(fd, buf, n);
+  801dba:	89 f1                	mov    %esi,%ecx
+  801dbc:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801dbf:	89 d8                	mov    %ebx,%eax
+  801dc1:	e8 34 fe ff ff       	call   801bfa <file_read_direct>
+  801dc6:	eb c6                	jmp    801d8e <devfile_read+0x99>
+
+00801dc8 <open>:
+{
+  801dc8:	55                   	push   %ebp
+  801dc9:	89 e5                	mov    %esp,%ebp
+  801dcb:	56                   	push   %esi
+  801dcc:	53                   	push   %ebx
+  801dcd:	83 ec 1c             	sub    $0x1c,%esp
+  801dd0:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  801dd3:	56                   	push   %esi
+  801dd4:	e8 0e ea ff ff       	call   8007e7 <strlen>
+  801dd9:	83 c4 10             	add    $0x10,%esp
+  801ddc:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801de1:	0f 8f a0 00 00 00    	jg     801e87 <open+0xbf>
+	if ((r = fd_alloc(&fd)) < 0)
+  801de7:	83 ec 0c             	sub    $0xc,%esp
+  801dea:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801ded:	50                   	push   %eax
+  801dee:	e8 63 f2 ff ff       	call   801056 <fd_alloc>
+  801df3:	89 c3                	mov    %eax,%ebx
+  801df5:	83 c4 10             	add    $0x10,%esp
+  801df8:	85 c0                	test   %eax,%eax
+  801dfa:	78 45                	js     801e41 <open+0x79>
+	strcpy(fsipcbuf.open.req_path, path);
+  801dfc:	83 ec 08             	sub    $0x8,%esp
+  801dff:	56                   	push   %esi
+  801e00:	68 00 60 80 00       	push   $0x806000
+  801e05:	e8 18 ea ff ff       	call   800822 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  801e0a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801e0d:	a3 00 64 80 00       	mov    %eax,0x806400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  801e12:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801e15:	b8 01 00 00 00       	mov    $0x1,%eax
+  801e1a:	e8 c5 f9 ff ff       	call   8017e4 <fsipc>
+  801e1f:	89 c3                	mov    %eax,%ebx
+  801e21:	83 c4 10             	add    $0x10,%esp
+  801e24:	85 c0                	test   %eax,%eax
+  801e26:	78 22                	js     801e4a <open+0x82>
+	if (!(mode & O_NOBUF)
+  801e28:	f7 45 0c 00 10 00 00 	testl  $0x1000,0xc(%ebp)
+  801e2f:	74 2b                	je     801e5c <open+0x94>
+	return fd2num(fd);
+  801e31:	83 ec 0c             	sub    $0xc,%esp
+  801e34:	ff 75 f4             	push   -0xc(%ebp)
+  801e37:	e8 f3 f1 ff ff       	call   80102f <fd2num>
+  801e3c:	89 c3                	mov    %eax,%ebx
+  801e3e:	83 c4 10             	add    $0x10,%esp
+}
+  801e41:	89 d8                	mov    %ebx,%eax
+  801e43:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801e46:	5b                   	pop    %ebx
+  801e47:	5e                   	pop    %esi
+  801e48:	5d                   	pop    %ebp
+  801e49:	c3                   	ret
+		fd_close(fd, 0);
+  801e4a:	83 ec 08             	sub    $0x8,%esp
+  801e4d:	6a 00                	push   $0x0
+  801e4f:	ff 75 f4             	push   -0xc(%ebp)
+  801e52:	e8 f8 f2 ff ff       	call   80114f <fd_close>
+		return r;
+  801e57:	83 c4 10             	add    $0x10,%esp
+  801e5a:	eb e5                	jmp    801e41 <open+0x79>
+	    && sys_page_alloc(0, fd2data(fd), PTE_P|PTE_U|PTE_W|PTE_SHARE) == 0)
+  801e5c:	83 ec 0c             	sub    $0xc,%esp
+  801e5f:	ff 75 f4             	push   -0xc(%ebp)
+  801e62:	e8 d8 f1 ff ff       	call   80103f <fd2data>
+  801e67:	83 c4 0c             	add    $0xc,%esp
+  801e6a:	68 07 04 00 00       	push   $0x407
+  801e6f:	50                   	push   %eax
+  801e70:	6a 00                	push   $0x0
+  801e72:	e8 b7 ed ff ff       	call   800c2e <sys_page_alloc>
+  801e77:	83 c4 10             	add    $0x10,%esp
+  801e7a:	85 c0                	test   %eax,%eax
+  801e7c:	75 b3                	jne    801e31 <open+0x69>
+		fd->fd_file.buffered = 1;
+  801e7e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801e81:	c6 40 10 01          	movb   $0x1,0x10(%eax)
+  801e85:	eb aa                	jmp    801e31 <open+0x69>
+		return -E_BAD_PATH;
+  801e87:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801e8c:	eb b3                	jmp    801e41 <open+0x79>
+
+00801e8e <readdir>:
+{
+  801e8e:	55                   	push   %ebp
+  801e8f:	89 e5                	mov    %esp,%ebp
+  801e91:	53                   	push   %ebx
+  801e92:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801e95:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801e98:	50                   	push   %eax
+  801e99:	ff 75 08             	push   0x8(%ebp)
+  801e9c:	e8 0b f2 ff ff       	call   8010ac <fd_lookup>
+  801ea1:	89 c3                	mov    %eax,%ebx
+  801ea3:	83 c4 10             	add    $0x10,%esp
+  801ea6:	85 c0                	test   %eax,%eax
+  801ea8:	78 73                	js     801f1d <readdir+0x8f>
+	if (fd->fd_dev_id != devfile.dev_id)
+  801eaa:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801ead:	8b 0d 20 40 80 00    	mov    0x804020,%ecx
+  801eb3:	39 08                	cmp    %ecx,(%eax)
+  801eb5:	0f 85 82 00 00 00    	jne    801f3d <readdir+0xaf>
+	if ((r = devfile_sync(fd)) < 0)
+  801ebb:	83 ec 0c             	sub    $0xc,%esp
+  801ebe:	50                   	push   %eax
+  801ebf:	e8 c4 f9 ff ff       	call   801888 <devfile_sync>
+  801ec4:	89 c3                	mov    %eax,%ebx
+  801ec6:	83 c4 10             	add    $0x10,%esp
+  801ec9:	85 c0                	test   %eax,%eax
+  801ecb:	78 50                	js     801f1d <readdir+0x8f>
+	fsipcbuf.readdir.req_fileid = fd->fd_file.id;
+  801ecd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801ed0:	8b 40 0c             	mov    0xc(%eax),%eax
+  801ed3:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.readdir.req_n = n;
+  801ed8:	8b 45 10             	mov    0x10(%ebp),%eax
+  801edb:	a3 04 60 80 00       	mov    %eax,0x806004
+	fsipcbuf.readdir.req_flags = flags;
+  801ee0:	8b 45 14             	mov    0x14(%ebp),%eax
+  801ee3:	a3 08 60 80 00       	mov    %eax,0x806008
+	if ((r = fsipc(FSREQ_READDIR, NULL)) <= 0)
+  801ee8:	ba 00 00 00 00       	mov    $0x0,%edx
+  801eed:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801ef2:	e8 ed f8 ff ff       	call   8017e4 <fsipc>
+  801ef7:	89 c3                	mov    %eax,%ebx
+  801ef9:	85 c0                	test   %eax,%eax
+  801efb:	7e 20                	jle    801f1d <readdir+0x8f>
+	assert(r <= n && r <= PGSIZE);
+  801efd:	39 45 10             	cmp    %eax,0x10(%ebp)
+  801f00:	72 22                	jb     801f24 <readdir+0x96>
+  801f02:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  801f07:	7f 1b                	jg     801f24 <readdir+0x96>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  801f09:	83 ec 04             	sub    $0x4,%esp
+  801f0c:	50                   	push   %eax
+  801f0d:	68 00 60 80 00       	push   $0x806000
+  801f12:	ff 75 0c             	push   0xc(%ebp)
+  801f15:	e8 8e ea ff ff       	call   8009a8 <memmove>
+	return r;
+  801f1a:	83 c4 10             	add    $0x10,%esp
+}
+  801f1d:	89 d8                	mov    %ebx,%eax
+  801f1f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801f22:	c9                   	leave
+  801f23:	c3                   	ret
+	assert(r <= n && r <= PGSIZE);
+  801f24:	68 a7 3c 80 00       	push   $0x803ca7
+  801f29:	68 80 3c 80 00       	push   $0x803c80
+  801f2e:	68 86 01 00 00       	push   $0x186
+  801f33:	68 95 3c 80 00       	push   $0x803c95
+  801f38:	e8 1c e2 ff ff       	call   800159 <_panic>
+		return -E_NOT_SUPP;
+  801f3d:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  801f42:	eb d9                	jmp    801f1d <readdir+0x8f>
+
+00801f44 <munmap>:
+{
+  801f44:	55                   	push   %ebp
+  801f45:	89 e5                	mov    %esp,%ebp
+  801f47:	56                   	push   %esi
+  801f48:	53                   	push   %ebx
+  801f49:	8b 75 08             	mov    0x8(%ebp),%esi
+  801f4c:	8b 55 0c             	mov    0xc(%ebp),%edx
+	if (PGOFF(addr) || (uintptr_t) addr >= UTOP || len > UTOP - (uintptr_t) addr)
+  801f4f:	f7 c6 ff 0f 00 00    	test   $0xfff,%esi
+  801f55:	75 41                	jne    801f98 <munmap+0x54>
+  801f57:	81 fe ff ff bf ee    	cmp    $0xeebfffff,%esi
+  801f5d:	77 39                	ja     801f98 <munmap+0x54>
+  801f5f:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  801f64:	29 f0                	sub    %esi,%eax
+  801f66:	39 d0                	cmp    %edx,%eax
+  801f68:	72 35                	jb     801f9f <munmap+0x5b>
+	for (va = (uintptr_t) addr; va < (uintptr_t) addr + len; va += PGSIZE)
+  801f6a:	89 f3                	mov    %esi,%ebx
+  801f6c:	01 d6                	add    %edx,%esi
+  801f6e:	39 f3                	cmp    %esi,%ebx
+  801f70:	73 1a                	jae    801f8c <munmap+0x48>
+		if ((r = sys_page_unmap(0, (void *) va)) < 0)
+  801f72:	83 ec 08             	sub    $0x8,%esp
+  801f75:	53                   	push   %ebx
+  801f76:	6a 00                	push   $0x0
+  801f78:	e8 3e ed ff ff       	call   800cbb <sys_page_unmap>
+  801f7d:	83 c4 10             	add    $0x10,%esp
+  801f80:	85 c0                	test   %eax,%eax
+  801f82:	78 0d                	js     801f91 <munmap+0x4d>
+	for (va = (uintptr_t) addr; va < (uintptr_t) addr + len; va += PGSIZE)
+  801f84:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801f8a:	eb e2                	jmp    801f6e <munmap+0x2a>
+	return 0;
+  801f8c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801f91:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801f94:	5b                   	pop    %ebx
+  801f95:	5e                   	pop    %esi
+  801f96:	5d                   	pop    %ebp
+  801f97:	c3                   	ret
+		return -E_INVAL;
+  801f98:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801f9d:	eb f2                	jmp    801f91 <munmap+0x4d>
+  801f9f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801fa4:	eb eb                	jmp    801f91 <munmap+0x4d>
+
+00801fa6 <mmap>:
+{
+  801fa6:	55                   	push   %ebp
+  801fa7:	89 e5                	mov    %esp,%ebp
+  801fa9:	57                   	push   %edi
+  801faa:	56                   	push   %esi
+  801fab:	53                   	push   %ebx
+  801fac:	83 ec 34             	sub    $0x34,%esp
+  801faf:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801fb2:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801fb5:	50                   	push   %eax
+  801fb6:	ff 75 18             	push   0x18(%ebp)
+  801fb9:	e8 ee f0 ff ff       	call   8010ac <fd_lookup>
+  801fbe:	89 c3                	mov    %eax,%ebx
+  801fc0:	83 c4 10             	add    $0x10,%esp
+  801fc3:	85 c0                	test   %eax,%eax
+  801fc5:	0f 88 0e 01 00 00    	js     8020d9 <mmap+0x133>
+	if (fd->fd_dev_id != devfile.dev_id)
+  801fcb:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801fce:	a1 20 40 80 00       	mov    0x804020,%eax
+  801fd3:	39 02                	cmp    %eax,(%edx)
+  801fd5:	0f 85 50 01 00 00    	jne    80212b <mmap+0x185>
+	if ((prot & PROT_WRITE) && !(flags & MAP_PRIVATE))
+  801fdb:	8b 45 10             	mov    0x10(%ebp),%eax
+  801fde:	83 e0 02             	and    $0x2,%eax
+  801fe1:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  801fe4:	74 0a                	je     801ff0 <mmap+0x4a>
+  801fe6:	f6 45 14 02          	testb  $0x2,0x14(%ebp)
+  801fea:	0f 84 42 01 00 00    	je     802132 <mmap+0x18c>
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY
+  801ff0:	8b 42 08             	mov    0x8(%edx),%eax
+  801ff3:	83 e0 03             	and    $0x3,%eax
+  801ff6:	83 f8 01             	cmp    $0x1,%eax
+  801ff9:	0f 84 3a 01 00 00    	je     802139 <mmap+0x193>
+	    || PGOFF(addr) || PGOFF(offset) || offset < 0
+  801fff:	8b 45 08             	mov    0x8(%ebp),%eax
+  802002:	0b 45 1c             	or     0x1c(%ebp),%eax
+  802005:	25 ff 0f 00 00       	and    $0xfff,%eax
+  80200a:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80200d:	0f 85 2d 01 00 00    	jne    802140 <mmap+0x19a>
+	    || (uintptr_t) addr >= UTOP || len > UTOP - (uintptr_t) addr)
+  802013:	83 7d 1c 00          	cmpl   $0x0,0x1c(%ebp)
+  802017:	0f 88 2a 01 00 00    	js     802147 <mmap+0x1a1>
+  80201d:	81 7d 08 ff ff bf ee 	cmpl   $0xeebfffff,0x8(%ebp)
+  802024:	0f 87 1d 01 00 00    	ja     802147 <mmap+0x1a1>
+  80202a:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  80202f:	2b 45 08             	sub    0x8(%ebp),%eax
+  802032:	39 f8                	cmp    %edi,%eax
+  802034:	0f 82 14 01 00 00    	jb     80214e <mmap+0x1a8>
+	if ((r = devfile_sync(fd)) < 0)
+  80203a:	83 ec 0c             	sub    $0xc,%esp
+  80203d:	52                   	push   %edx
+  80203e:	e8 45 f8 ff ff       	call   801888 <devfile_sync>
+  802043:	89 c3                	mov    %eax,%ebx
+  802045:	83 c4 10             	add    $0x10,%esp
+  802048:	85 c0                	test   %eax,%eax
+  80204a:	0f 88 89 00 00 00    	js     8020d9 <mmap+0x133>
+	len = ROUNDUP(len, PGSIZE);
+  802050:	81 c7 ff 0f 00 00    	add    $0xfff,%edi
+  802056:	81 e7 00 f0 ff ff    	and    $0xfffff000,%edi
+	for (done = 0; done < len; done += n * PGSIZE) {
+  80205c:	be 00 00 00 00       	mov    $0x0,%esi
+  802061:	8b 5d 1c             	mov    0x1c(%ebp),%ebx
+  802064:	39 fe                	cmp    %edi,%esi
+  802066:	73 7b                	jae    8020e3 <mmap+0x13d>
+		n = MIN((len - done) / PGSIZE, FSBULK_MAXPAGES);
+  802068:	89 f8                	mov    %edi,%eax
+  80206a:	29 f0                	sub    %esi,%eax
+  80206c:	c1 e8 0c             	shr    $0xc,%eax
+  80206f:	ba 40 00 00 00       	mov    $0x40,%edx
+  802074:	39 d0                	cmp    %edx,%eax
+  802076:	0f 47 c2             	cmova  %edx,%eax
+  802079:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		fsipcbuf.map.req_fileid = fd->fd_file.id;
+  80207c:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  80207f:	8b 52 0c             	mov    0xc(%edx),%edx
+  802082:	89 15 00 60 80 00    	mov    %edx,0x806000
+		fsipcbuf.map.req_offset = offset + done;
+  802088:	8d 14 33             	lea    (%ebx,%esi,1),%edx
+  80208b:	89 15 04 60 80 00    	mov    %edx,0x806004
+		fsipcbuf.map.req_npages = n;
+  802091:	a3 08 60 80 00       	mov    %eax,0x806008
+		if ((r = fsipcv(FSREQ_MAP, addr + done, &n)) <= 0 || n == 0) {
+  802096:	89 f2                	mov    %esi,%edx
+  802098:	03 55 08             	add    0x8(%ebp),%edx
+  80209b:	8d 4d e0             	lea    -0x20(%ebp),%ecx
+  80209e:	b8 0b 00 00 00       	mov    $0xb,%eax
+  8020a3:	e8 ea f6 ff ff       	call   801792 <fsipcv>
+  8020a8:	85 c0                	test   %eax,%eax
+  8020aa:	7e 12                	jle    8020be <mmap+0x118>
+  8020ac:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8020af:	85 c0                	test   %eax,%eax
+  8020b1:	0f 84 9e 00 00 00    	je     802155 <mmap+0x1af>
+	for (done = 0; done < len; done += n * PGSIZE) {
+  8020b7:	c1 e0 0c             	shl    $0xc,%eax
+  8020ba:	01 c6                	add    %eax,%esi
+  8020bc:	eb a6                	jmp    802064 <mmap+0xbe>
+			munmap(addr, done);
+  8020be:	89 c3                	mov    %eax,%ebx
+  8020c0:	83 ec 08             	sub    $0x8,%esp
+  8020c3:	56                   	push   %esi
+  8020c4:	ff 75 08             	push   0x8(%ebp)
+  8020c7:	e8 78 fe ff ff       	call   801f44 <munmap>
+			return r < 0 ? r : -E_INVAL;
+  8020cc:	83 c4 10             	add    $0x10,%esp
+  8020cf:	85 db                	test   %ebx,%ebx
+  8020d1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8020d6:	0f 49 d8             	cmovns %eax,%ebx
+}
+  8020d9:	89 d8                	mov    %ebx,%eax
+  8020db:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8020de:	5b                   	pop    %ebx
+  8020df:	5e                   	pop    %esi
+  8020e0:	5f                   	pop    %edi
+  8020e1:	5d                   	pop    %ebp
+  8020e2:	c3                   	ret
+	if (prot & PROT_WRITE)
+  8020e3:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+	return 0;
+  8020e6:	89 c3                	mov    %eax,%ebx
+	if (prot & PROT_WRITE)
+  8020e8:	85 c0                	test   %eax,%eax
+  8020ea:	74 ed                	je     8020d9 <mmap+0x133>
+		for (done = 0; done < len; done += PGSIZE)
+  8020ec:	be 00 00 00 00       	mov    $0x0,%esi
+  8020f1:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8020f4:	39 fe                	cmp    %edi,%esi
+  8020f6:	73 2e                	jae    802126 <mmap+0x180>
+			if ((r = cowpage(addr + done)) < 0) {
+  8020f8:	83 ec 0c             	sub    $0xc,%esp
+  8020fb:	8d 04 33             	lea    (%ebx,%esi,1),%eax
+  8020fe:	50                   	push   %eax
+  8020ff:	e8 fd 0f 00 00       	call   803101 <cowpage>
+  802104:	83 c4 10             	add    $0x10,%esp
+  802107:	85 c0                	test   %eax,%eax
+  802109:	78 08                	js     802113 <mmap+0x16d>
+		for (done = 0; done < len; done += PGSIZE)
+  80210b:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  802111:	eb e1                	jmp    8020f4 <mmap+0x14e>
+				munmap(addr, len);
+  802113:	89 c3                	mov    %eax,%ebx
+  802115:	83 ec 08             	sub    $0x8,%esp
+  802118:	57                   	push   %edi
+  802119:	ff 75 08             	push   0x8(%ebp)
+  80211c:	e8 23 fe ff ff       	call   801f44 <munmap>
+				return r;
+  802121:	83 c4 10             	add    $0x10,%esp
+  802124:	eb b3                	jmp    8020d9 <mmap+0x133>
+	return 0;
+  802126:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  802129:	eb ae                	jmp    8020d9 <mmap+0x133>
+		return -E_NOT_SUPP;
+  80212b:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  802130:	eb a7                	jmp    8020d9 <mmap+0x133>
+		return -E_NOT_SUPP;
+  802132:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  802137:	eb a0                	jmp    8020d9 <mmap+0x133>
+		return -E_INVAL;
+  802139:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  80213e:	eb 99                	jmp    8020d9 <mmap+0x133>
+  802140:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  802145:	eb 92                	jmp    8020d9 <mmap+0x133>
+  802147:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  80214c:	eb 8b                	jmp    8020d9 <mmap+0x133>
+  80214e:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  802153:	eb 84                	jmp    8020d9 <mmap+0x133>
+			munmap(addr, done);
+  802155:	83 ec 08             	sub    $0x8,%esp
+  802158:	56                   	push   %esi
+  802159:	ff 75 08             	push   0x8(%ebp)
+  80215c:	e8 e3 fd ff ff       	call   801f44 <munmap>
+  802161:	83 c4 10             	add    $0x10,%esp
+			return r < 0 ? r : -E_INVAL;
+  802164:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  802169:	e9 6b ff ff ff       	jmp    8020d9 <mmap+0x133>
+
+0080216e <fsring_read>:
+// buf.  fsring_reap returns 'tag' with the result once done.
+// Returns 0 on success, < 0 on error; -E_NO_MEM means too many requests
+// are outstanding, and some must be reaped first.
+int
+fsring_read(int fdnum, void *buf, size_t n, off_t offset, uint32_t tag)
+{
+  80216e:	55                   	push   %ebp
+  80216f:	89 e5                	mov    %esp,%ebp
+  802171:	56                   	push   %esi
+  802172:	53                   	push   %ebx
+  802173:	83 ec 10             	sub    $0x10,%esp
+  802176:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	struct Fd *fd;
+	int slot;
+
+	if ((slot = fsring_slot(fdnum, &fd)) < 0)
+  802179:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  80217c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80217f:	e8 3d f9 ff ff       	call   801ac1 <fsring_slot>
+  802184:	85 c0                	test   %eax,%eax
+  802186:	78 60                	js     8021e8 <fsring_read+0x7a>
+		return slot;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY)
+  802188:	8b 75 f4             	mov    -0xc(%ebp),%esi
+  80218b:	8b 56 08             	mov    0x8(%esi),%edx
+  80218e:	83 e2 03             	and    $0x3,%edx
+  802191:	83 fa 01             	cmp    $0x1,%edx
+  802194:	74 59                	je     8021ef <fsring_read+0x81>
+		return -E_INVAL;
+	fsring_busy |= 1 << slot;
+  802196:	ba 01 00 00 00       	mov    $0x1,%edx
+  80219b:	89 c1                	mov    %eax,%ecx
+  80219d:	d3 e2                	shl    %cl,%edx
+  80219f:	09 15 c0 70 80 00    	or     %edx,0x8070c0
+	fsring_slots[slot].s_type = FSREQ_READ;
+  8021a5:	8d 14 40             	lea    (%eax,%eax,2),%edx
+  8021a8:	c1 e2 02             	shl    $0x2,%edx
+  8021ab:	8d 8a 00 70 80 00    	lea    0x807000(%edx),%ecx
+  8021b1:	c7 82 00 70 80 00 03 	movl   $0x3,0x807000(%edx)
+  8021b8:	00 00 00 
+	fsring_slots[slot].s_tag = tag;
+  8021bb:	8b 55 18             	mov    0x18(%ebp),%edx
+  8021be:	89 51 04             	mov    %edx,0x4(%ecx)
+	fsring_slots[slot].s_buf = buf;
+  8021c1:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8021c4:	89 51 08             	mov    %edx,0x8(%ecx)
+	return fsring_post(FSREQ_READ, fd, offset, MIN(n, PGSIZE), slot);
+  8021c7:	83 ec 08             	sub    $0x8,%esp
+  8021ca:	50                   	push   %eax
+  8021cb:	b8 00 10 00 00       	mov    $0x1000,%eax
+  8021d0:	39 c3                	cmp    %eax,%ebx
+  8021d2:	0f 47 d8             	cmova  %eax,%ebx
+  8021d5:	53                   	push   %ebx
+  8021d6:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  8021d9:	89 f2                	mov    %esi,%edx
+  8021db:	b8 03 00 00 00       	mov    $0x3,%eax
+  8021e0:	e8 1e f5 ff ff       	call   801703 <fsring_post>
+  8021e5:	83 c4 10             	add    $0x10,%esp
+}
+  8021e8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8021eb:	5b                   	pop    %ebx
+  8021ec:	5e                   	pop    %esi
+  8021ed:	5d                   	pop    %ebp
+  8021ee:	c3                   	ret
+		return -E_INVAL;
+  8021ef:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8021f4:	eb f2                	jmp    8021e8 <fsring_read+0x7a>
+
+008021f6 <fsring_write>:
+// Start writing up to n bytes (at most a page) from buf at 'offset' of
+// fdnum.  buf may be reused as soon as this returns.
+// Returns as fsring_read.
+int
+fsring_write(int fdnum, const void *buf, size_t n, off_t offset, uint32_t tag)
+{
+  8021f6:	55                   	push   %ebp
+  8021f7:	89 e5                	mov    %esp,%ebp
+  8021f9:	56                   	push   %esi
+  8021fa:	53                   	push   %ebx
+  8021fb:	83 ec 10             	sub    $0x10,%esp
+  8021fe:	8b 75 10             	mov    0x10(%ebp),%esi
+	struct Fd *fd;
+	int slot;
+
+	if ((slot = fsring_slot(fdnum, &fd)) < 0)
+  802201:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802204:	8b 45 08             	mov    0x8(%ebp),%eax
+  802207:	e8 b5 f8 ff ff       	call   801ac1 <fsring_slot>
+  80220c:	89 c3                	mov    %eax,%ebx
+  80220e:	85 c0                	test   %eax,%eax
+  802210:	78 77                	js     802289 <fsring_write+0x93>
+		return slot;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY)
+  802212:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802215:	f6 40 08 03          	testb  $0x3,0x8(%eax)
+  802219:	74 77                	je     802292 <fsring_write+0x9c>
+		return -E_INVAL;
+	n = MIN(n, PGSIZE);
+  80221b:	b8 00 10 00 00       	mov    $0x1000,%eax
+  802220:	39 c6                	cmp    %eax,%esi
+  802222:	0f 47 f0             	cmova  %eax,%esi
+	memmove((char *) fsring + (1 + slot) * PGSIZE, buf, n);
+  802225:	83 ec 04             	sub    $0x4,%esp
+  802228:	56                   	push   %esi
+  802229:	ff 75 0c             	push   0xc(%ebp)
+  80222c:	89 d8                	mov    %ebx,%eax
+  80222e:	c1 e0 0c             	shl    $0xc,%eax
+  802231:	8d 80 00 10 00 cf    	lea    -0x30fff000(%eax),%eax
+  802237:	50                   	push   %eax
+  802238:	e8 6b e7 ff ff       	call   8009a8 <memmove>
+	fsring_busy |= 1 << slot;
+  80223d:	b8 01 00 00 00       	mov    $0x1,%eax
+  802242:	89 d9                	mov    %ebx,%ecx
+  802244:	d3 e0                	shl    %cl,%eax
+  802246:	09 05 c0 70 80 00    	or     %eax,0x8070c0
+	fsring_slots[slot].s_type = FSREQ_WRITE;
+  80224c:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  80224f:	c1 e0 02             	shl    $0x2,%eax
+  802252:	8d 90 00 70 80 00    	lea    0x807000(%eax),%edx
+  802258:	c7 80 00 70 80 00 04 	movl   $0x4,0x807000(%eax)
+  80225f:	00 00 00 
+	fsring_slots[slot].s_tag = tag;
+  802262:	8b 45 18             	mov    0x18(%ebp),%eax
+  802265:	89 42 04             	mov    %eax,0x4(%edx)
+	fsring_slots[slot].s_buf = NULL;
+  802268:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	return fsring_post(FSREQ_WRITE, fd, offset, n, slot);
+  80226f:	83 c4 08             	add    $0x8,%esp
+  802272:	53                   	push   %ebx
+  802273:	56                   	push   %esi
+  802274:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  802277:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80227a:	b8 04 00 00 00       	mov    $0x4,%eax
+  80227f:	e8 7f f4 ff ff       	call   801703 <fsring_post>
+  802284:	89 c3                	mov    %eax,%ebx
+  802286:	83 c4 10             	add    $0x10,%esp
+}
+  802289:	89 d8                	mov    %ebx,%eax
+  80228b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80228e:	5b                   	pop    %ebx
+  80228f:	5e                   	pop    %esi
+  802290:	5d                   	pop    %ebp
+  802291:	c3                   	ret
+		return -E_INVAL;
+  802292:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  802297:	eb f0                	jmp    802289 <fsring_write+0x93>
+
+00802299 <fsring_stat>:
+
+// Start a stat of fdnum into *st.  Returns as fsring_read.
+int
+fsring_stat(int fdnum, struct Stat *st, uint32_t tag)
+{
+  802299:	55                   	push   %ebp
+  80229a:	89 e5                	mov    %esp,%ebp
+  80229c:	83 ec 18             	sub    $0x18,%esp
+	struct Fd *fd;
+	int slot;
+
+	if ((slot = fsring_slot(fdnum, &fd)) < 0)
+  80229f:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8022a2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8022a5:	e8 17 f8 ff ff       	call   801ac1 <fsring_slot>
+  8022aa:	85 c0                	test   %eax,%eax
+  8022ac:	78 4c                	js     8022fa <fsring_stat+0x61>
+		return slot;
+	fsring_busy |= 1 << slot;
+  8022ae:	ba 01 00 00 00       	mov    $0x1,%edx
+  8022b3:	89 c1                	mov    %eax,%ecx
+  8022b5:	d3 e2                	shl    %cl,%edx
+  8022b7:	09 15 c0 70 80 00    	or     %edx,0x8070c0
+	fsring_slots[slot].s_type = FSREQ_STAT;
+  8022bd:	8d 14 40             	lea    (%eax,%eax,2),%edx
+  8022c0:	c1 e2 02             	shl    $0x2,%edx
+  8022c3:	8d 8a 00 70 80 00    	lea    0x807000(%edx),%ecx
+  8022c9:	c7 82 00 70 80 00 05 	movl   $0x5,0x807000(%edx)
+  8022d0:	00 00 00 
+	fsring_slots[slot].s_tag = tag;
+  8022d3:	8b 55 10             	mov    0x10(%ebp),%edx
+  8022d6:	89 51 04             	mov    %edx,0x4(%ecx)
+	fsring_slots[slot].s_buf = st;
+  8022d9:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8022dc:	89 51 08             	mov    %edx,0x8(%ecx)
+	return fsring_post(FSREQ_STAT, fd, 0, 0, slot);
+  8022df:	83 ec 08             	sub    $0x8,%esp
+  8022e2:	50                   	push   %eax
+  8022e3:	6a 00                	push   $0x0
+  8022e5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8022ea:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8022ed:	b8 05 00 00 00       	mov    $0x5,%eax
+  8022f2:	e8 0c f4 ff ff       	call   801703 <fsring_post>
+  8022f7:	83 c4 10             	add    $0x10,%esp
+}
+  8022fa:	c9                   	leave
+  8022fb:	c3                   	ret
+
+008022fc <fsring_reap>:
+// If none has finished, wait for one if 'wait' is set and any are
+// outstanding.
+// Returns 1 if a result was collected, 0 if not.
+int
+fsring_reap(uint32_t *tag_store, int *result_store, bool wait)
+{
+  8022fc:	55                   	push   %ebp
+  8022fd:	89 e5                	mov    %esp,%ebp
+  8022ff:	57                   	push   %edi
+  802300:	56                   	push   %esi
+  802301:	53                   	push   %ebx
+  802302:	83 ec 1c             	sub    $0x1c,%esp
+  802305:	0f b6 5d 10          	movzbl 0x10(%ebp),%ebx
+	struct Fsring_cqe cqe;
+	struct Fsret_stat *ret;
+	struct Stat *st;
+	char *data;
+
+	if (fsring_env != thisenv->env_id)
+  802309:	a1 00 50 80 00       	mov    0x805000,%eax
+  80230e:	8b 40 48             	mov    0x48(%eax),%eax
+  802311:	3b 05 c4 70 80 00    	cmp    0x8070c4,%eax
+  802317:	74 12                	je     80232b <fsring_reap+0x2f>
+		return 0;
+  802319:	b8 00 00 00 00       	mov    $0x0,%eax
+	}
+	fsring_busy &= ~(1 << cqe.cqe_slot);
+	*tag_store = fsring_slots[cqe.cqe_slot].s_tag;
+	*result_store = cqe.cqe_result;
+	return 1;
+}
+  80231e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802321:	5b                   	pop    %ebx
+  802322:	5e                   	pop    %esi
+  802323:	5f                   	pop    %edi
+  802324:	5d                   	pop    %ebp
+  802325:	c3                   	ret
+		sys_yield();
+  802326:	e8 e4 e8 ff ff       	call   800c0f <sys_yield>
+	while (fsring->r_cqhead == fsring->r_cqtail) {
+  80232b:	8b 15 08 00 00 cf    	mov    0xcf000008,%edx
+  802331:	a1 0c 00 00 cf       	mov    0xcf00000c,%eax
+  802336:	39 c2                	cmp    %eax,%edx
+  802338:	75 18                	jne    802352 <fsring_reap+0x56>
+		if (!wait || fsring_busy == 0)
+  80233a:	84 db                	test   %bl,%bl
+  80233c:	0f 84 21 01 00 00    	je     802463 <fsring_reap+0x167>
+  802342:	83 3d c0 70 80 00 00 	cmpl   $0x0,0x8070c0
+  802349:	75 db                	jne    802326 <fsring_reap+0x2a>
+			return 0;
+  80234b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802350:	eb cc                	jmp    80231e <fsring_reap+0x22>
+	cqe = fsring->r_cq[fsring->r_cqhead % FSRING_NSLOTS];
+  802352:	a1 08 00 00 cf       	mov    0xcf000008,%eax
+  802357:	83 e0 0f             	and    $0xf,%eax
+  80235a:	83 c0 2a             	add    $0x2a,%eax
+  80235d:	8b 1c c5 00 00 00 cf 	mov    -0x31000000(,%eax,8),%ebx
+  802364:	8b 3c c5 04 00 00 cf 	mov    -0x30fffffc(,%eax,8),%edi
+	fsring->r_cqhead++;
+  80236b:	a1 08 00 00 cf       	mov    0xcf000008,%eax
+  802370:	83 c0 01             	add    $0x1,%eax
+  802373:	a3 08 00 00 cf       	mov    %eax,0xcf000008
+	if (cqe.cqe_slot >= FSRING_NSLOTS || !(fsring_busy & (1 << cqe.cqe_slot)))
+  802378:	83 fb 0f             	cmp    $0xf,%ebx
+  80237b:	77 5b                	ja     8023d8 <fsring_reap+0xdc>
+  80237d:	be 01 00 00 00       	mov    $0x1,%esi
+  802382:	89 d9                	mov    %ebx,%ecx
+  802384:	d3 e6                	shl    %cl,%esi
+  802386:	89 f0                	mov    %esi,%eax
+  802388:	23 05 c0 70 80 00    	and    0x8070c0,%eax
+  80238e:	74 48                	je     8023d8 <fsring_reap+0xdc>
+	data = (char *) fsring + (1 + cqe.cqe_slot) * PGSIZE;
+  802390:	89 d8                	mov    %ebx,%eax
+  802392:	c1 e0 0c             	shl    $0xc,%eax
+  802395:	8d 80 00 10 00 cf    	lea    -0x30fff000(%eax),%eax
+  80239b:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	switch (fsring_slots[cqe.cqe_slot].s_type) {
+  80239e:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  8023a1:	8b 04 85 00 70 80 00 	mov    0x807000(,%eax,4),%eax
+  8023a8:	83 f8 03             	cmp    $0x3,%eax
+  8023ab:	74 40                	je     8023ed <fsring_reap+0xf1>
+  8023ad:	83 f8 05             	cmp    $0x5,%eax
+  8023b0:	74 64                	je     802416 <fsring_reap+0x11a>
+	fsring_busy &= ~(1 << cqe.cqe_slot);
+  8023b2:	f7 d6                	not    %esi
+  8023b4:	21 35 c0 70 80 00    	and    %esi,0x8070c0
+	*tag_store = fsring_slots[cqe.cqe_slot].s_tag;
+  8023ba:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  8023bd:	8b 14 85 04 70 80 00 	mov    0x807004(,%eax,4),%edx
+  8023c4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8023c7:	89 10                	mov    %edx,(%eax)
+	*result_store = cqe.cqe_result;
+  8023c9:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8023cc:	89 38                	mov    %edi,(%eax)
+	return 1;
+  8023ce:	b8 01 00 00 00       	mov    $0x1,%eax
+  8023d3:	e9 46 ff ff ff       	jmp    80231e <fsring_reap+0x22>
+		panic("fsring_reap: bad slot %u", cqe.cqe_slot);
+  8023d8:	53                   	push   %ebx
+  8023d9:	68 bd 3c 80 00       	push   $0x803cbd
+  8023de:	68 8f 02 00 00       	push   $0x28f
+  8023e3:	68 95 3c 80 00       	push   $0x803c95
+  8023e8:	e8 6c dd ff ff       	call   800159 <_panic>
+		if (cqe.cqe_result > 0)
+  8023ed:	85 ff                	test   %edi,%edi
+  8023ef:	7e c1                	jle    8023b2 <fsring_reap+0xb6>
+			memmove(fsring_slots[cqe.cqe_slot].s_buf, data,
+  8023f1:	83 ec 04             	sub    $0x4,%esp
+				MIN(cqe.cqe_result, PGSIZE));
+  8023f4:	b8 00 10 00 00       	mov    $0x1000,%eax
+  8023f9:	39 c7                	cmp    %eax,%edi
+  8023fb:	0f 4e c7             	cmovle %edi,%eax
+			memmove(fsring_slots[cqe.cqe_slot].s_buf, data,
+  8023fe:	50                   	push   %eax
+  8023ff:	ff 75 e4             	push   -0x1c(%ebp)
+  802402:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  802405:	ff 34 85 08 70 80 00 	push   0x807008(,%eax,4)
+  80240c:	e8 97 e5 ff ff       	call   8009a8 <memmove>
+  802411:	83 c4 10             	add    $0x10,%esp
+  802414:	eb 9c                	jmp    8023b2 <fsring_reap+0xb6>
+		if (cqe.cqe_result == 0) {
+  802416:	85 ff                	test   %edi,%edi
+  802418:	75 98                	jne    8023b2 <fsring_reap+0xb6>
+			st = fsring_slots[cqe.cqe_slot].s_buf;
+  80241a:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  80241d:	8b 0c 85 08 70 80 00 	mov    0x807008(,%eax,4),%ecx
+			strcpy(st->st_name, ret->ret_name);
+  802424:	83 ec 08             	sub    $0x8,%esp
+  802427:	ff 75 e4             	push   -0x1c(%ebp)
+  80242a:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  80242d:	51                   	push   %ecx
+  80242e:	e8 ef e3 ff ff       	call   800822 <strcpy>
+			st->st_size = ret->ret_size;
+  802433:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802436:	8b 82 80 00 00 00    	mov    0x80(%edx),%eax
+  80243c:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  80243f:	89 81 80 00 00 00    	mov    %eax,0x80(%ecx)
+			st->st_isdir = ret->ret_isdir;
+  802445:	8b 82 84 00 00 00    	mov    0x84(%edx),%eax
+  80244b:	89 81 84 00 00 00    	mov    %eax,0x84(%ecx)
+			st->st_dev = &devfile;
+  802451:	c7 81 88 00 00 00 20 	movl   $0x804020,0x88(%ecx)
+  802458:	40 80 00 
+  80245b:	83 c4 10             	add    $0x10,%esp
+  80245e:	e9 4f ff ff ff       	jmp    8023b2 <fsring_reap+0xb6>
+			return 0;
+  802463:	b8 00 00 00 00       	mov    $0x0,%eax
+  802468:	e9 b1 fe ff ff       	jmp    80231e <fsring_reap+0x22>
+
+0080246d <file_slurp>:
+// page are copied through fsipcbuf; larger ones go straight into buf's
+// pages, and stop at FSBULK_MAXPAGES of them.
+// Returns the number of bytes read, 0 for directories, or < 0 on error.
+ssize_t
+file_slurp(const char *path, void *buf, size_t n, struct Stat *st)
+{
+  80246d:	55                   	push   %ebp
+  80246e:	89 e5                	mov    %esp,%ebp
+  802470:	57                   	push   %edi
+  802471:	56                   	push   %esi
+  802472:	53                   	push   %ebx
+  802473:	83 ec 28             	sub    $0x28,%esp
+  802476:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802479:	8b 7d 10             	mov    0x10(%ebp),%edi
+  80247c:	8b 75 14             	mov    0x14(%ebp),%esi
+	const char *name;
+	int r;
+
+	if (strlen(path) >= MAXPATHLEN)
+  80247f:	53                   	push   %ebx
+  802480:	e8 62 e3 ff ff       	call   8007e7 <strlen>
+  802485:	83 c4 10             	add    $0x10,%esp
+  802488:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  80248d:	0f 8f 02 01 00 00    	jg     802595 <file_slurp+0x128>
+		return -E_BAD_PATH;
+
+	strcpy(fsipcbuf.slurp.req_path, path);
+  802493:	83 ec 08             	sub    $0x8,%esp
+  802496:	53                   	push   %ebx
+  802497:	68 00 60 80 00       	push   $0x806000
+  80249c:	e8 81 e3 ff ff       	call   800822 <strcpy>
+	if (n > sizeof(fsipcbuf.slurpRet.ret_buf)) {
+  8024a1:	83 c4 10             	add    $0x10,%esp
+  8024a4:	81 ff f8 0f 00 00    	cmp    $0xff8,%edi
+  8024aa:	76 69                	jbe    802515 <file_slurp+0xa8>
+		n = MIN(n, FSBULK_MAXPAGES * PGSIZE - PGOFF(buf));
+  8024ac:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8024af:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  8024b5:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  8024ba:	29 d1                	sub    %edx,%ecx
+  8024bc:	39 f9                	cmp    %edi,%ecx
+  8024be:	0f 46 f9             	cmovbe %ecx,%edi
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  8024c1:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8024c4:	89 f9                	mov    %edi,%ecx
+  8024c6:	01 c1                	add    %eax,%ecx
+  8024c8:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  8024cb:	eb 0f                	jmp    8024dc <file_slurp+0x6f>
+		*(volatile char *) p = *(volatile char *) p;
+  8024cd:	0f b6 10             	movzbl (%eax),%edx
+  8024d0:	88 10                	mov    %dl,(%eax)
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  8024d2:	05 00 10 00 00       	add    $0x1000,%eax
+  8024d7:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  8024dc:	39 c8                	cmp    %ecx,%eax
+  8024de:	72 ed                	jb     8024cd <file_slurp+0x60>
+		fsipc_touch(buf, n);
+		fsipcbuf.slurp.req_n = n;
+  8024e0:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8024e3:	89 3d 00 64 80 00    	mov    %edi,0x806400
+		fsipcbuf.slurp.req_off = PGOFF(buf);
+  8024e9:	89 15 04 64 80 00    	mov    %edx,0x806404
+		r = fsipc_pages(FSREQ_SLURP, buf, n, PTE_P | PTE_W | PTE_U);
+  8024ef:	83 ec 0c             	sub    $0xc,%esp
+  8024f2:	6a 07                	push   $0x7
+  8024f4:	89 f9                	mov    %edi,%ecx
+  8024f6:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8024f9:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8024fe:	e8 3f f1 ff ff       	call   801642 <fsipc_pages>
+  802503:	89 c7                	mov    %eax,%edi
+  802505:	83 c4 10             	add    $0x10,%esp
+			memmove(buf, fsipcbuf.slurpRet.ret_buf, r);
+	}
+	if (r < 0)
+		return r;
+
+	if (st) {
+  802508:	85 f6                	test   %esi,%esi
+  80250a:	74 7f                	je     80258b <file_slurp+0x11e>
+  80250c:	8d 43 01             	lea    0x1(%ebx),%eax
+  80250f:	85 ff                	test   %edi,%edi
+  802511:	79 3c                	jns    80254f <file_slurp+0xe2>
+  802513:	eb 76                	jmp    80258b <file_slurp+0x11e>
+		fsipcbuf.slurp.req_n = n;
+  802515:	89 3d 00 64 80 00    	mov    %edi,0x806400
+		if ((r = fsipc(FSREQ_SLURP, NULL)) > 0)
+  80251b:	ba 00 00 00 00       	mov    $0x0,%edx
+  802520:	b8 0f 00 00 00       	mov    $0xf,%eax
+  802525:	e8 ba f2 ff ff       	call   8017e4 <fsipc>
+  80252a:	89 c7                	mov    %eax,%edi
+  80252c:	85 c0                	test   %eax,%eax
+  80252e:	7e d8                	jle    802508 <file_slurp+0x9b>
+			memmove(buf, fsipcbuf.slurpRet.ret_buf, r);
+  802530:	83 ec 04             	sub    $0x4,%esp
+  802533:	50                   	push   %eax
+  802534:	68 08 60 80 00       	push   $0x806008
+  802539:	ff 75 0c             	push   0xc(%ebp)
+  80253c:	e8 67 e4 ff ff       	call   8009a8 <memmove>
+  802541:	83 c4 10             	add    $0x10,%esp
+  802544:	eb c2                	jmp    802508 <file_slurp+0x9b>
+		for (name = path; *path; path++)
+			if (*path == '/')
+				name = path + 1;
+  802546:	80 fa 2f             	cmp    $0x2f,%dl
+  802549:	0f 44 d9             	cmove  %ecx,%ebx
+		for (name = path; *path; path++)
+  80254c:	83 c0 01             	add    $0x1,%eax
+  80254f:	89 c1                	mov    %eax,%ecx
+  802551:	0f b6 50 ff          	movzbl -0x1(%eax),%edx
+  802555:	84 d2                	test   %dl,%dl
+  802557:	75 ed                	jne    802546 <file_slurp+0xd9>
+		strlcpy(st->st_name, name, sizeof(st->st_name));
+  802559:	83 ec 04             	sub    $0x4,%esp
+  80255c:	68 80 00 00 00       	push   $0x80
+  802561:	53                   	push   %ebx
+  802562:	56                   	push   %esi
+  802563:	e8 30 e3 ff ff       	call   800898 <strlcpy>
+		st->st_size = fsipcbuf.slurpRet.ret_size;
+  802568:	a1 00 60 80 00       	mov    0x806000,%eax
+  80256d:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+		st->st_isdir = fsipcbuf.slurpRet.ret_isdir;
+  802573:	a1 04 60 80 00       	mov    0x806004,%eax
+  802578:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+		st->st_dev = &devfile;
+  80257e:	c7 86 88 00 00 00 20 	movl   $0x804020,0x88(%esi)
+  802585:	40 80 00 
+  802588:	83 c4 10             	add    $0x10,%esp
+	}
+	return r;
+}
+  80258b:	89 f8                	mov    %edi,%eax
+  80258d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802590:	5b                   	pop    %ebx
+  802591:	5e                   	pop    %esi
+  802592:	5f                   	pop    %edi
+  802593:	5d                   	pop    %ebp
+  802594:	c3                   	ret
+		return -E_BAD_PATH;
+  802595:	bf f4 ff ff ff       	mov    $0xfffffff4,%edi
+  80259a:	eb ef                	jmp    80258b <file_slurp+0x11e>
+
+0080259c <remove>:
+
+// Delete a file
+int
+remove(const char *path)
+{
+  80259c:	55                   	push   %ebp
+  80259d:	89 e5                	mov    %esp,%ebp
+  80259f:	53                   	push   %ebx
+  8025a0:	83 ec 10             	sub    $0x10,%esp
+  8025a3:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (strlen(path) >= MAXPATHLEN)
+  8025a6:	53                   	push   %ebx
+  8025a7:	e8 3b e2 ff ff       	call   8007e7 <strlen>
+  8025ac:	83 c4 10             	add    $0x10,%esp
+  8025af:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8025b4:	7f 25                	jg     8025db <remove+0x3f>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.remove.req_path, path);
+  8025b6:	83 ec 08             	sub    $0x8,%esp
+  8025b9:	53                   	push   %ebx
+  8025ba:	68 00 60 80 00       	push   $0x806000
+  8025bf:	e8 5e e2 ff ff       	call   800822 <strcpy>
+	return fsipc(FSREQ_REMOVE, NULL);
+  8025c4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8025c9:	b8 07 00 00 00       	mov    $0x7,%eax
+  8025ce:	e8 11 f2 ff ff       	call   8017e4 <fsipc>
+  8025d3:	83 c4 10             	add    $0x10,%esp
+}
+  8025d6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8025d9:	c9                   	leave
+  8025da:	c3                   	ret
+		return -E_BAD_PATH;
+  8025db:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  8025e0:	eb f4                	jmp    8025d6 <remove+0x3a>
+
+008025e2 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  8025e2:	55                   	push   %ebp
+  8025e3:	89 e5                	mov    %esp,%ebp
+  8025e5:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  8025e8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8025ed:	b8 08 00 00 00       	mov    $0x8,%eax
+  8025f2:	e8 ed f1 ff ff       	call   8017e4 <fsipc>
+}
+  8025f7:	c9                   	leave
+  8025f8:	c3                   	ret
+
+008025f9 <defrag>:
+// Have the file server lay out the blocks of 'path' contiguously on
+// disk.  Stores the number of extents the file had before and has
+// after in *before and *after, if they are not null.
+int
+defrag(const char *path, uint32_t *before, uint32_t *after)
+{
+  8025f9:	55                   	push   %ebp
+  8025fa:	89 e5                	mov    %esp,%ebp
+  8025fc:	57                   	push   %edi
+  8025fd:	56                   	push   %esi
+  8025fe:	53                   	push   %ebx
+  8025ff:	83 ec 18             	sub    $0x18,%esp
+  802602:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802605:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802608:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int r;
+
+	if (strlen(path) >= MAXPATHLEN)
+  80260b:	57                   	push   %edi
+  80260c:	e8 d6 e1 ff ff       	call   8007e7 <strlen>
+  802611:	83 c4 10             	add    $0x10,%esp
+  802614:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802619:	7f 4c                	jg     802667 <defrag+0x6e>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.defrag.req_path, path);
+  80261b:	83 ec 08             	sub    $0x8,%esp
+  80261e:	57                   	push   %edi
+  80261f:	68 00 60 80 00       	push   $0x806000
+  802624:	e8 f9 e1 ff ff       	call   800822 <strcpy>
+	if ((r = fsipc(FSREQ_DEFRAG, NULL)) < 0)
+  802629:	ba 00 00 00 00       	mov    $0x0,%edx
+  80262e:	b8 10 00 00 00       	mov    $0x10,%eax
+  802633:	e8 ac f1 ff ff       	call   8017e4 <fsipc>
+  802638:	83 c4 10             	add    $0x10,%esp
+  80263b:	85 c0                	test   %eax,%eax
+  80263d:	78 20                	js     80265f <defrag+0x66>
+		return r;
+	if (before)
+  80263f:	85 f6                	test   %esi,%esi
+  802641:	74 07                	je     80264a <defrag+0x51>
+		*before = fsipcbuf.defragRet.ret_before;
+  802643:	a1 00 60 80 00       	mov    0x806000,%eax
+  802648:	89 06                	mov    %eax,(%esi)
+	if (after)
+		*after = fsipcbuf.defragRet.ret_after;
+	return 0;
+  80264a:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (after)
+  80264f:	85 db                	test   %ebx,%ebx
+  802651:	74 0c                	je     80265f <defrag+0x66>
+		*after = fsipcbuf.defragRet.ret_after;
+  802653:	a1 04 60 80 00       	mov    0x806004,%eax
+  802658:	89 03                	mov    %eax,(%ebx)
+	return 0;
+  80265a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80265f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802662:	5b                   	pop    %ebx
+  802663:	5e                   	pop    %esi
+  802664:	5f                   	pop    %edi
+  802665:	5d                   	pop    %ebp
+  802666:	c3                   	ret
+		return -E_BAD_PATH;
+  802667:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  80266c:	eb f1                	jmp    80265f <defrag+0x66>
+
+0080266e <fs_bcstats>:
+
+// Copy the file server's block cache statistics into *st.
+int
+fs_bcstats(struct BcStats *st)
+{
+  80266e:	55                   	push   %ebp
+  80266f:	89 e5                	mov    %esp,%ebp
+  802671:	53                   	push   %ebx
+  802672:	83 ec 04             	sub    $0x4,%esp
+  802675:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if ((r = fsipc(FSREQ_BCSTATS, NULL)) < 0)
+  802678:	ba 00 00 00 00       	mov    $0x0,%edx
+  80267d:	b8 11 00 00 00       	mov    $0x11,%eax
+  802682:	e8 5d f1 ff ff       	call   8017e4 <fsipc>
+  802687:	85 c0                	test   %eax,%eax
+  802689:	78 34                	js     8026bf <fs_bcstats+0x51>
+		return r;
+	*st = fsipcbuf.bcstatsRet;
+  80268b:	a1 00 60 80 00       	mov    0x806000,%eax
+  802690:	89 03                	mov    %eax,(%ebx)
+  802692:	a1 04 60 80 00       	mov    0x806004,%eax
+  802697:	89 43 04             	mov    %eax,0x4(%ebx)
+  80269a:	a1 08 60 80 00       	mov    0x806008,%eax
+  80269f:	89 43 08             	mov    %eax,0x8(%ebx)
+  8026a2:	a1 0c 60 80 00       	mov    0x80600c,%eax
+  8026a7:	89 43 0c             	mov    %eax,0xc(%ebx)
+  8026aa:	a1 10 60 80 00       	mov    0x806010,%eax
+  8026af:	89 43 10             	mov    %eax,0x10(%ebx)
+  8026b2:	a1 14 60 80 00       	mov    0x806014,%eax
+  8026b7:	89 43 14             	mov    %eax,0x14(%ebx)
+	return 0;
+  8026ba:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8026bf:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8026c2:	c9                   	leave
+  8026c3:	c3                   	ret
+
+008026c4 <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  8026c4:	55                   	push   %ebp
+  8026c5:	89 e5                	mov    %esp,%ebp
+  8026c7:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  8026ca:	68 d6 3c 80 00       	push   $0x803cd6
+  8026cf:	ff 75 0c             	push   0xc(%ebp)
+  8026d2:	e8 4b e1 ff ff       	call   800822 <strcpy>
+	return 0;
+}
+  8026d7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8026dc:	c9                   	leave
+  8026dd:	c3                   	ret
+
+008026de <devsock_close>:
+{
+  8026de:	55                   	push   %ebp
+  8026df:	89 e5                	mov    %esp,%ebp
+  8026e1:	53                   	push   %ebx
+  8026e2:	83 ec 10             	sub    $0x10,%esp
+  8026e5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  8026e8:	53                   	push   %ebx
+  8026e9:	e8 f4 0d 00 00       	call   8034e2 <pageref>
+  8026ee:	89 c2                	mov    %eax,%edx
+  8026f0:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  8026f3:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  8026f8:	83 fa 01             	cmp    $0x1,%edx
+  8026fb:	74 05                	je     802702 <devsock_close+0x24>
+}
+  8026fd:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802700:	c9                   	leave
+  802701:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  802702:	83 ec 0c             	sub    $0xc,%esp
+  802705:	ff 73 0c             	push   0xc(%ebx)
+  802708:	e8 b7 02 00 00       	call   8029c4 <nsipc_close>
+  80270d:	83 c4 10             	add    $0x10,%esp
+  802710:	eb eb                	jmp    8026fd <devsock_close+0x1f>
+
+00802712 <devsock_write>:
+{
+  802712:	55                   	push   %ebp
+  802713:	89 e5                	mov    %esp,%ebp
+  802715:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  802718:	6a 00                	push   $0x0
+  80271a:	ff 75 10             	push   0x10(%ebp)
+  80271d:	ff 75 0c             	push   0xc(%ebp)
+  802720:	8b 45 08             	mov    0x8(%ebp),%eax
+  802723:	ff 70 0c             	push   0xc(%eax)
+  802726:	e8 79 03 00 00       	call   802aa4 <nsipc_send>
+}
+  80272b:	c9                   	leave
+  80272c:	c3                   	ret
+
+0080272d <devsock_read>:
+{
+  80272d:	55                   	push   %ebp
+  80272e:	89 e5                	mov    %esp,%ebp
+  802730:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  802733:	6a 00                	push   $0x0
+  802735:	ff 75 10             	push   0x10(%ebp)
+  802738:	ff 75 0c             	push   0xc(%ebp)
+  80273b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80273e:	ff 70 0c             	push   0xc(%eax)
+  802741:	e8 ef 02 00 00       	call   802a35 <nsipc_recv>
+}
+  802746:	c9                   	leave
+  802747:	c3                   	ret
+
+00802748 <fd2sockid>:
+{
+  802748:	55                   	push   %ebp
+  802749:	89 e5                	mov    %esp,%ebp
+  80274b:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  80274e:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802751:	52                   	push   %edx
+  802752:	50                   	push   %eax
+  802753:	e8 54 e9 ff ff       	call   8010ac <fd_lookup>
+  802758:	83 c4 10             	add    $0x10,%esp
+  80275b:	85 c0                	test   %eax,%eax
+  80275d:	78 10                	js     80276f <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  80275f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802762:	8b 0d 40 40 80 00    	mov    0x804040,%ecx
+  802768:	39 08                	cmp    %ecx,(%eax)
+  80276a:	75 05                	jne    802771 <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  80276c:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  80276f:	c9                   	leave
+  802770:	c3                   	ret
+		return -E_NOT_SUPP;
+  802771:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802776:	eb f7                	jmp    80276f <fd2sockid+0x27>
+
+00802778 <alloc_sockfd>:
+{
+  802778:	55                   	push   %ebp
+  802779:	89 e5                	mov    %esp,%ebp
+  80277b:	56                   	push   %esi
+  80277c:	53                   	push   %ebx
+  80277d:	83 ec 1c             	sub    $0x1c,%esp
+  802780:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  802782:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802785:	50                   	push   %eax
+  802786:	e8 cb e8 ff ff       	call   801056 <fd_alloc>
+  80278b:	89 c3                	mov    %eax,%ebx
+  80278d:	83 c4 10             	add    $0x10,%esp
+  802790:	85 c0                	test   %eax,%eax
+  802792:	78 43                	js     8027d7 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  802794:	83 ec 04             	sub    $0x4,%esp
+  802797:	68 07 04 00 00       	push   $0x407
+  80279c:	ff 75 f4             	push   -0xc(%ebp)
+  80279f:	6a 00                	push   $0x0
+  8027a1:	e8 88 e4 ff ff       	call   800c2e <sys_page_alloc>
+  8027a6:	89 c3                	mov    %eax,%ebx
+  8027a8:	83 c4 10             	add    $0x10,%esp
+  8027ab:	85 c0                	test   %eax,%eax
+  8027ad:	78 28                	js     8027d7 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  8027af:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8027b2:	8b 15 40 40 80 00    	mov    0x804040,%edx
+  8027b8:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  8027ba:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8027bd:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  8027c4:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  8027c7:	83 ec 0c             	sub    $0xc,%esp
+  8027ca:	50                   	push   %eax
+  8027cb:	e8 5f e8 ff ff       	call   80102f <fd2num>
+  8027d0:	89 c3                	mov    %eax,%ebx
+  8027d2:	83 c4 10             	add    $0x10,%esp
+  8027d5:	eb 0c                	jmp    8027e3 <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  8027d7:	83 ec 0c             	sub    $0xc,%esp
+  8027da:	56                   	push   %esi
+  8027db:	e8 e4 01 00 00       	call   8029c4 <nsipc_close>
+		return r;
+  8027e0:	83 c4 10             	add    $0x10,%esp
+}
+  8027e3:	89 d8                	mov    %ebx,%eax
+  8027e5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8027e8:	5b                   	pop    %ebx
+  8027e9:	5e                   	pop    %esi
+  8027ea:	5d                   	pop    %ebp
+  8027eb:	c3                   	ret
+
+008027ec <accept>:
+{
+  8027ec:	55                   	push   %ebp
+  8027ed:	89 e5                	mov    %esp,%ebp
+  8027ef:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8027f2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8027f5:	e8 4e ff ff ff       	call   802748 <fd2sockid>
+  8027fa:	85 c0                	test   %eax,%eax
+  8027fc:	78 1b                	js     802819 <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  8027fe:	83 ec 04             	sub    $0x4,%esp
+  802801:	ff 75 10             	push   0x10(%ebp)
+  802804:	ff 75 0c             	push   0xc(%ebp)
+  802807:	50                   	push   %eax
+  802808:	e8 0e 01 00 00       	call   80291b <nsipc_accept>
+  80280d:	83 c4 10             	add    $0x10,%esp
+  802810:	85 c0                	test   %eax,%eax
+  802812:	78 05                	js     802819 <accept+0x2d>
+	return alloc_sockfd(r);
+  802814:	e8 5f ff ff ff       	call   802778 <alloc_sockfd>
+}
+  802819:	c9                   	leave
+  80281a:	c3                   	ret
+
+0080281b <bind>:
+{
+  80281b:	55                   	push   %ebp
+  80281c:	89 e5                	mov    %esp,%ebp
+  80281e:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802821:	8b 45 08             	mov    0x8(%ebp),%eax
+  802824:	e8 1f ff ff ff       	call   802748 <fd2sockid>
+  802829:	85 c0                	test   %eax,%eax
+  80282b:	78 12                	js     80283f <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  80282d:	83 ec 04             	sub    $0x4,%esp
+  802830:	ff 75 10             	push   0x10(%ebp)
+  802833:	ff 75 0c             	push   0xc(%ebp)
+  802836:	50                   	push   %eax
+  802837:	e8 31 01 00 00       	call   80296d <nsipc_bind>
+  80283c:	83 c4 10             	add    $0x10,%esp
+}
+  80283f:	c9                   	leave
+  802840:	c3                   	ret
+
+00802841 <shutdown>:
+{
+  802841:	55                   	push   %ebp
+  802842:	89 e5                	mov    %esp,%ebp
+  802844:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802847:	8b 45 08             	mov    0x8(%ebp),%eax
+  80284a:	e8 f9 fe ff ff       	call   802748 <fd2sockid>
+  80284f:	85 c0                	test   %eax,%eax
+  802851:	78 0f                	js     802862 <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  802853:	83 ec 08             	sub    $0x8,%esp
+  802856:	ff 75 0c             	push   0xc(%ebp)
+  802859:	50                   	push   %eax
+  80285a:	e8 43 01 00 00       	call   8029a2 <nsipc_shutdown>
+  80285f:	83 c4 10             	add    $0x10,%esp
+}
+  802862:	c9                   	leave
+  802863:	c3                   	ret
+
+00802864 <connect>:
+{
+  802864:	55                   	push   %ebp
+  802865:	89 e5                	mov    %esp,%ebp
+  802867:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  80286a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80286d:	e8 d6 fe ff ff       	call   802748 <fd2sockid>
+  802872:	85 c0                	test   %eax,%eax
+  802874:	78 12                	js     802888 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  802876:	83 ec 04             	sub    $0x4,%esp
+  802879:	ff 75 10             	push   0x10(%ebp)
+  80287c:	ff 75 0c             	push   0xc(%ebp)
+  80287f:	50                   	push   %eax
+  802880:	e8 59 01 00 00       	call   8029de <nsipc_connect>
+  802885:	83 c4 10             	add    $0x10,%esp
+}
+  802888:	c9                   	leave
+  802889:	c3                   	ret
+
+0080288a <listen>:
+{
+  80288a:	55                   	push   %ebp
+  80288b:	89 e5                	mov    %esp,%ebp
+  80288d:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802890:	8b 45 08             	mov    0x8(%ebp),%eax
+  802893:	e8 b0 fe ff ff       	call   802748 <fd2sockid>
+  802898:	85 c0                	test   %eax,%eax
+  80289a:	78 0f                	js     8028ab <listen+0x21>
+	return nsipc_listen(r, backlog);
+  80289c:	83 ec 08             	sub    $0x8,%esp
+  80289f:	ff 75 0c             	push   0xc(%ebp)
+  8028a2:	50                   	push   %eax
+  8028a3:	e8 6b 01 00 00       	call   802a13 <nsipc_listen>
+  8028a8:	83 c4 10             	add    $0x10,%esp
+}
+  8028ab:	c9                   	leave
+  8028ac:	c3                   	ret
+
+008028ad <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  8028ad:	55                   	push   %ebp
+  8028ae:	89 e5                	mov    %esp,%ebp
+  8028b0:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  8028b3:	ff 75 10             	push   0x10(%ebp)
+  8028b6:	ff 75 0c             	push   0xc(%ebp)
+  8028b9:	ff 75 08             	push   0x8(%ebp)
+  8028bc:	e8 41 02 00 00       	call   802b02 <nsipc_socket>
+  8028c1:	83 c4 10             	add    $0x10,%esp
+  8028c4:	85 c0                	test   %eax,%eax
+  8028c6:	78 05                	js     8028cd <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  8028c8:	e8 ab fe ff ff       	call   802778 <alloc_sockfd>
+}
+  8028cd:	c9                   	leave
+  8028ce:	c3                   	ret
+
+008028cf <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  8028cf:	55                   	push   %ebp
+  8028d0:	89 e5                	mov    %esp,%ebp
+  8028d2:	53                   	push   %ebx
+  8028d3:	83 ec 04             	sub    $0x4,%esp
+  8028d6:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  8028d8:	83 3d 00 90 80 00 00 	cmpl   $0x0,0x809000
+  8028df:	74 26                	je     802907 <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  8028e1:	6a 07                	push   $0x7
+  8028e3:	68 00 80 80 00       	push   $0x808000
+  8028e8:	53                   	push   %ebx
+  8028e9:	ff 35 00 90 80 00    	push   0x809000
+  8028ef:	e8 76 0a 00 00       	call   80336a <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  8028f4:	83 c4 0c             	add    $0xc,%esp
+  8028f7:	6a 00                	push   $0x0
+  8028f9:	6a 00                	push   $0x0
+  8028fb:	6a 00                	push   $0x0
+  8028fd:	e8 fd 09 00 00       	call   8032ff <ipc_recv>
+}
+  802902:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802905:	c9                   	leave
+  802906:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  802907:	83 ec 0c             	sub    $0xc,%esp
+  80290a:	6a 02                	push   $0x2
+  80290c:	e8 92 0b 00 00       	call   8034a3 <ipc_find_env>
+  802911:	a3 00 90 80 00       	mov    %eax,0x809000
+  802916:	83 c4 10             	add    $0x10,%esp
+  802919:	eb c6                	jmp    8028e1 <nsipc+0x12>
+
+0080291b <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  80291b:	55                   	push   %ebp
+  80291c:	89 e5                	mov    %esp,%ebp
+  80291e:	56                   	push   %esi
+  80291f:	53                   	push   %ebx
+  802920:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  802923:	8b 45 08             	mov    0x8(%ebp),%eax
+  802926:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  80292b:	8b 06                	mov    (%esi),%eax
+  80292d:	a3 04 80 80 00       	mov    %eax,0x808004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  802932:	b8 01 00 00 00       	mov    $0x1,%eax
+  802937:	e8 93 ff ff ff       	call   8028cf <nsipc>
+  80293c:	89 c3                	mov    %eax,%ebx
+  80293e:	85 c0                	test   %eax,%eax
+  802940:	79 09                	jns    80294b <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  802942:	89 d8                	mov    %ebx,%eax
+  802944:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802947:	5b                   	pop    %ebx
+  802948:	5e                   	pop    %esi
+  802949:	5d                   	pop    %ebp
+  80294a:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  80294b:	83 ec 04             	sub    $0x4,%esp
+  80294e:	ff 35 10 80 80 00    	push   0x808010
+  802954:	68 00 80 80 00       	push   $0x808000
+  802959:	ff 75 0c             	push   0xc(%ebp)
+  80295c:	e8 47 e0 ff ff       	call   8009a8 <memmove>
+		*addrlen = ret->ret_addrlen;
+  802961:	a1 10 80 80 00       	mov    0x808010,%eax
+  802966:	89 06                	mov    %eax,(%esi)
+  802968:	83 c4 10             	add    $0x10,%esp
+	return r;
+  80296b:	eb d5                	jmp    802942 <nsipc_accept+0x27>
+
+0080296d <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  80296d:	55                   	push   %ebp
+  80296e:	89 e5                	mov    %esp,%ebp
+  802970:	53                   	push   %ebx
+  802971:	83 ec 08             	sub    $0x8,%esp
+  802974:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  802977:	8b 45 08             	mov    0x8(%ebp),%eax
+  80297a:	a3 00 80 80 00       	mov    %eax,0x808000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  80297f:	53                   	push   %ebx
+  802980:	ff 75 0c             	push   0xc(%ebp)
+  802983:	68 04 80 80 00       	push   $0x808004
+  802988:	e8 1b e0 ff ff       	call   8009a8 <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  80298d:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+	return nsipc(NSREQ_BIND);
+  802993:	b8 02 00 00 00       	mov    $0x2,%eax
+  802998:	e8 32 ff ff ff       	call   8028cf <nsipc>
+}
+  80299d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8029a0:	c9                   	leave
+  8029a1:	c3                   	ret
+
+008029a2 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  8029a2:	55                   	push   %ebp
+  8029a3:	89 e5                	mov    %esp,%ebp
+  8029a5:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  8029a8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8029ab:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.shutdown.req_how = how;
+  8029b0:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8029b3:	a3 04 80 80 00       	mov    %eax,0x808004
+	return nsipc(NSREQ_SHUTDOWN);
+  8029b8:	b8 03 00 00 00       	mov    $0x3,%eax
+  8029bd:	e8 0d ff ff ff       	call   8028cf <nsipc>
+}
+  8029c2:	c9                   	leave
+  8029c3:	c3                   	ret
+
+008029c4 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  8029c4:	55                   	push   %ebp
+  8029c5:	89 e5                	mov    %esp,%ebp
+  8029c7:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  8029ca:	8b 45 08             	mov    0x8(%ebp),%eax
+  8029cd:	a3 00 80 80 00       	mov    %eax,0x808000
+	return nsipc(NSREQ_CLOSE);
+  8029d2:	b8 04 00 00 00       	mov    $0x4,%eax
+  8029d7:	e8 f3 fe ff ff       	call   8028cf <nsipc>
+}
+  8029dc:	c9                   	leave
+  8029dd:	c3                   	ret
+
+008029de <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  8029de:	55                   	push   %ebp
+  8029df:	89 e5                	mov    %esp,%ebp
+  8029e1:	53                   	push   %ebx
+  8029e2:	83 ec 08             	sub    $0x8,%esp
+  8029e5:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  8029e8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8029eb:	a3 00 80 80 00       	mov    %eax,0x808000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  8029f0:	53                   	push   %ebx
+  8029f1:	ff 75 0c             	push   0xc(%ebp)
+  8029f4:	68 04 80 80 00       	push   $0x808004
+  8029f9:	e8 aa df ff ff       	call   8009a8 <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  8029fe:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+	return nsipc(NSREQ_CONNECT);
+  802a04:	b8 05 00 00 00       	mov    $0x5,%eax
+  802a09:	e8 c1 fe ff ff       	call   8028cf <nsipc>
+}
+  802a0e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802a11:	c9                   	leave
+  802a12:	c3                   	ret
+
+00802a13 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  802a13:	55                   	push   %ebp
+  802a14:	89 e5                	mov    %esp,%ebp
+  802a16:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  802a19:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a1c:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.listen.req_backlog = backlog;
+  802a21:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802a24:	a3 04 80 80 00       	mov    %eax,0x808004
+	return nsipc(NSREQ_LISTEN);
+  802a29:	b8 06 00 00 00       	mov    $0x6,%eax
+  802a2e:	e8 9c fe ff ff       	call   8028cf <nsipc>
+}
+  802a33:	c9                   	leave
+  802a34:	c3                   	ret
+
+00802a35 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  802a35:	55                   	push   %ebp
+  802a36:	89 e5                	mov    %esp,%ebp
+  802a38:	56                   	push   %esi
+  802a39:	53                   	push   %ebx
+  802a3a:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  802a3d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a40:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.recv.req_len = len;
+  802a45:	89 35 04 80 80 00    	mov    %esi,0x808004
+	nsipcbuf.recv.req_flags = flags;
+  802a4b:	8b 45 14             	mov    0x14(%ebp),%eax
+  802a4e:	a3 08 80 80 00       	mov    %eax,0x808008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  802a53:	b8 07 00 00 00       	mov    $0x7,%eax
+  802a58:	e8 72 fe ff ff       	call   8028cf <nsipc>
+  802a5d:	89 c3                	mov    %eax,%ebx
+  802a5f:	85 c0                	test   %eax,%eax
+  802a61:	78 22                	js     802a85 <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  802a63:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  802a68:	39 c6                	cmp    %eax,%esi
+  802a6a:	0f 4e c6             	cmovle %esi,%eax
+  802a6d:	39 c3                	cmp    %eax,%ebx
+  802a6f:	7f 1d                	jg     802a8e <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  802a71:	83 ec 04             	sub    $0x4,%esp
+  802a74:	53                   	push   %ebx
+  802a75:	68 00 80 80 00       	push   $0x808000
+  802a7a:	ff 75 0c             	push   0xc(%ebp)
+  802a7d:	e8 26 df ff ff       	call   8009a8 <memmove>
+  802a82:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  802a85:	89 d8                	mov    %ebx,%eax
+  802a87:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802a8a:	5b                   	pop    %ebx
+  802a8b:	5e                   	pop    %esi
+  802a8c:	5d                   	pop    %ebp
+  802a8d:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  802a8e:	68 e2 3c 80 00       	push   $0x803ce2
+  802a93:	68 80 3c 80 00       	push   $0x803c80
+  802a98:	6a 62                	push   $0x62
+  802a9a:	68 f7 3c 80 00       	push   $0x803cf7
+  802a9f:	e8 b5 d6 ff ff       	call   800159 <_panic>
+
+00802aa4 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  802aa4:	55                   	push   %ebp
+  802aa5:	89 e5                	mov    %esp,%ebp
+  802aa7:	53                   	push   %ebx
+  802aa8:	83 ec 04             	sub    $0x4,%esp
+  802aab:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  802aae:	8b 45 08             	mov    0x8(%ebp),%eax
+  802ab1:	a3 00 80 80 00       	mov    %eax,0x808000
+	assert(size < 1600);
+  802ab6:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  802abc:	7f 2e                	jg     802aec <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  802abe:	83 ec 04             	sub    $0x4,%esp
+  802ac1:	53                   	push   %ebx
+  802ac2:	ff 75 0c             	push   0xc(%ebp)
+  802ac5:	68 0c 80 80 00       	push   $0x80800c
+  802aca:	e8 d9 de ff ff       	call   8009a8 <memmove>
+	nsipcbuf.send.req_size = size;
+  802acf:	89 1d 04 80 80 00    	mov    %ebx,0x808004
+	nsipcbuf.send.req_flags = flags;
+  802ad5:	8b 45 14             	mov    0x14(%ebp),%eax
+  802ad8:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_SEND);
+  802add:	b8 08 00 00 00       	mov    $0x8,%eax
+  802ae2:	e8 e8 fd ff ff       	call   8028cf <nsipc>
+}
+  802ae7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802aea:	c9                   	leave
+  802aeb:	c3                   	ret
+	assert(size < 1600);
+  802aec:	68 03 3d 80 00       	push   $0x803d03
+  802af1:	68 80 3c 80 00       	push   $0x803c80
+  802af6:	6a 6d                	push   $0x6d
+  802af8:	68 f7 3c 80 00       	push   $0x803cf7
+  802afd:	e8 57 d6 ff ff       	call   800159 <_panic>
+
+00802b02 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  802b02:	55                   	push   %ebp
+  802b03:	89 e5                	mov    %esp,%ebp
+  802b05:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  802b08:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b0b:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.socket.req_type = type;
+  802b10:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802b13:	a3 04 80 80 00       	mov    %eax,0x808004
+	nsipcbuf.socket.req_protocol = protocol;
+  802b18:	8b 45 10             	mov    0x10(%ebp),%eax
+  802b1b:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_SOCKET);
+  802b20:	b8 09 00 00 00       	mov    $0x9,%eax
+  802b25:	e8 a5 fd ff ff       	call   8028cf <nsipc>
+}
+  802b2a:	c9                   	leave
+  802b2b:	c3                   	ret
+
+00802b2c <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  802b2c:	55                   	push   %ebp
+  802b2d:	89 e5                	mov    %esp,%ebp
+  802b2f:	56                   	push   %esi
+  802b30:	53                   	push   %ebx
+  802b31:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  802b34:	83 ec 0c             	sub    $0xc,%esp
+  802b37:	ff 75 08             	push   0x8(%ebp)
+  802b3a:	e8 00 e5 ff ff       	call   80103f <fd2data>
+  802b3f:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  802b41:	83 c4 08             	add    $0x8,%esp
+  802b44:	68 0f 3d 80 00       	push   $0x803d0f
+  802b49:	53                   	push   %ebx
+  802b4a:	e8 d3 dc ff ff       	call   800822 <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  802b4f:	8b 46 04             	mov    0x4(%esi),%eax
+  802b52:	2b 06                	sub    (%esi),%eax
+  802b54:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  802b5a:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  802b61:	00 00 00 
+	stat->st_dev = &devpipe;
+  802b64:	c7 83 88 00 00 00 60 	movl   $0x804060,0x88(%ebx)
+  802b6b:	40 80 00 
+	return 0;
+}
+  802b6e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b73:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802b76:	5b                   	pop    %ebx
+  802b77:	5e                   	pop    %esi
+  802b78:	5d                   	pop    %ebp
+  802b79:	c3                   	ret
+
+00802b7a <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  802b7a:	55                   	push   %ebp
+  802b7b:	89 e5                	mov    %esp,%ebp
+  802b7d:	53                   	push   %ebx
+  802b7e:	83 ec 0c             	sub    $0xc,%esp
+  802b81:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  802b84:	53                   	push   %ebx
+  802b85:	6a 00                	push   $0x0
+  802b87:	e8 2f e1 ff ff       	call   800cbb <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  802b8c:	89 1c 24             	mov    %ebx,(%esp)
+  802b8f:	e8 ab e4 ff ff       	call   80103f <fd2data>
+  802b94:	83 c4 08             	add    $0x8,%esp
+  802b97:	50                   	push   %eax
+  802b98:	6a 00                	push   $0x0
+  802b9a:	e8 1c e1 ff ff       	call   800cbb <sys_page_unmap>
+}
+  802b9f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802ba2:	c9                   	leave
+  802ba3:	c3                   	ret
+
+00802ba4 <_pipeisclosed>:
+{
+  802ba4:	55                   	push   %ebp
+  802ba5:	89 e5                	mov    %esp,%ebp
+  802ba7:	57                   	push   %edi
+  802ba8:	56                   	push   %esi
+  802ba9:	53                   	push   %ebx
+  802baa:	83 ec 1c             	sub    $0x1c,%esp
+  802bad:	89 c7                	mov    %eax,%edi
+  802baf:	89 d6                	mov    %edx,%esi
+		n = thisenv->env_runs;
+  802bb1:	a1 00 50 80 00       	mov    0x805000,%eax
+  802bb6:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  802bb9:	83 ec 0c             	sub    $0xc,%esp
+  802bbc:	57                   	push   %edi
+  802bbd:	e8 20 09 00 00       	call   8034e2 <pageref>
+  802bc2:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802bc5:	89 34 24             	mov    %esi,(%esp)
+  802bc8:	e8 15 09 00 00       	call   8034e2 <pageref>
+		nn = thisenv->env_runs;
+  802bcd:	8b 15 00 50 80 00    	mov    0x805000,%edx
+  802bd3:	8b 4a 58             	mov    0x58(%edx),%ecx
+		if (n == nn)
+  802bd6:	83 c4 10             	add    $0x10,%esp
+  802bd9:	39 cb                	cmp    %ecx,%ebx
+  802bdb:	74 1b                	je     802bf8 <_pipeisclosed+0x54>
+		if (n != nn && ret == 1)
+  802bdd:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802be0:	75 cf                	jne    802bb1 <_pipeisclosed+0xd>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  802be2:	8b 42 58             	mov    0x58(%edx),%eax
+  802be5:	6a 01                	push   $0x1
+  802be7:	50                   	push   %eax
+  802be8:	53                   	push   %ebx
+  802be9:	68 16 3d 80 00       	push   $0x803d16
+  802bee:	e8 41 d6 ff ff       	call   800234 <cprintf>
+  802bf3:	83 c4 10             	add    $0x10,%esp
+  802bf6:	eb b9                	jmp    802bb1 <_pipeisclosed+0xd>
+		ret = pageref(fd) == pageref(p);
+  802bf8:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802bfb:	0f 94 c0             	sete   %al
+  802bfe:	0f b6 c0             	movzbl %al,%eax
+}
+  802c01:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802c04:	5b                   	pop    %ebx
+  802c05:	5e                   	pop    %esi
+  802c06:	5f                   	pop    %edi
+  802c07:	5d                   	pop    %ebp
+  802c08:	c3                   	ret
+
+00802c09 <devpipe_write>:
+{
+  802c09:	55                   	push   %ebp
+  802c0a:	89 e5                	mov    %esp,%ebp
+  802c0c:	57                   	push   %edi
+  802c0d:	56                   	push   %esi
+  802c0e:	53                   	push   %ebx
+  802c0f:	83 ec 28             	sub    $0x28,%esp
+  802c12:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  802c15:	56                   	push   %esi
+  802c16:	e8 24 e4 ff ff       	call   80103f <fd2data>
+  802c1b:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  802c1d:	83 c4 10             	add    $0x10,%esp
+  802c20:	bf 00 00 00 00       	mov    $0x0,%edi
+  802c25:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  802c28:	75 09                	jne    802c33 <devpipe_write+0x2a>
+	return i;
+  802c2a:	89 f8                	mov    %edi,%eax
+  802c2c:	eb 23                	jmp    802c51 <devpipe_write+0x48>
+			sys_yield();
+  802c2e:	e8 dc df ff ff       	call   800c0f <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  802c33:	8b 43 04             	mov    0x4(%ebx),%eax
+  802c36:	8b 0b                	mov    (%ebx),%ecx
+  802c38:	8d 51 20             	lea    0x20(%ecx),%edx
+  802c3b:	39 d0                	cmp    %edx,%eax
+  802c3d:	72 1a                	jb     802c59 <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  802c3f:	89 da                	mov    %ebx,%edx
+  802c41:	89 f0                	mov    %esi,%eax
+  802c43:	e8 5c ff ff ff       	call   802ba4 <_pipeisclosed>
+  802c48:	85 c0                	test   %eax,%eax
+  802c4a:	74 e2                	je     802c2e <devpipe_write+0x25>
+				return 0;
+  802c4c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802c51:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802c54:	5b                   	pop    %ebx
+  802c55:	5e                   	pop    %esi
+  802c56:	5f                   	pop    %edi
+  802c57:	5d                   	pop    %ebp
+  802c58:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  802c59:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802c5c:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  802c60:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  802c63:	89 c2                	mov    %eax,%edx
+  802c65:	c1 fa 1f             	sar    $0x1f,%edx
+  802c68:	89 d1                	mov    %edx,%ecx
+  802c6a:	c1 e9 1b             	shr    $0x1b,%ecx
+  802c6d:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  802c70:	83 e2 1f             	and    $0x1f,%edx
+  802c73:	29 ca                	sub    %ecx,%edx
+  802c75:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  802c79:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  802c7d:	83 c0 01             	add    $0x1,%eax
+  802c80:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  802c83:	83 c7 01             	add    $0x1,%edi
+  802c86:	eb 9d                	jmp    802c25 <devpipe_write+0x1c>
+
+00802c88 <devpipe_read>:
+{
+  802c88:	55                   	push   %ebp
+  802c89:	89 e5                	mov    %esp,%ebp
+  802c8b:	57                   	push   %edi
+  802c8c:	56                   	push   %esi
+  802c8d:	53                   	push   %ebx
+  802c8e:	83 ec 18             	sub    $0x18,%esp
+  802c91:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  802c94:	57                   	push   %edi
+  802c95:	e8 a5 e3 ff ff       	call   80103f <fd2data>
+  802c9a:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  802c9c:	83 c4 10             	add    $0x10,%esp
+  802c9f:	be 00 00 00 00       	mov    $0x0,%esi
+  802ca4:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802ca7:	75 13                	jne    802cbc <devpipe_read+0x34>
+	return i;
+  802ca9:	89 f0                	mov    %esi,%eax
+  802cab:	eb 02                	jmp    802caf <devpipe_read+0x27>
+				return i;
+  802cad:	89 f0                	mov    %esi,%eax
+}
+  802caf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802cb2:	5b                   	pop    %ebx
+  802cb3:	5e                   	pop    %esi
+  802cb4:	5f                   	pop    %edi
+  802cb5:	5d                   	pop    %ebp
+  802cb6:	c3                   	ret
+			sys_yield();
+  802cb7:	e8 53 df ff ff       	call   800c0f <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  802cbc:	8b 03                	mov    (%ebx),%eax
+  802cbe:	3b 43 04             	cmp    0x4(%ebx),%eax
+  802cc1:	75 18                	jne    802cdb <devpipe_read+0x53>
+			if (i > 0)
+  802cc3:	85 f6                	test   %esi,%esi
+  802cc5:	75 e6                	jne    802cad <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  802cc7:	89 da                	mov    %ebx,%edx
+  802cc9:	89 f8                	mov    %edi,%eax
+  802ccb:	e8 d4 fe ff ff       	call   802ba4 <_pipeisclosed>
+  802cd0:	85 c0                	test   %eax,%eax
+  802cd2:	74 e3                	je     802cb7 <devpipe_read+0x2f>
+				return 0;
+  802cd4:	b8 00 00 00 00       	mov    $0x0,%eax
+  802cd9:	eb d4                	jmp    802caf <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  802cdb:	99                   	cltd
+  802cdc:	c1 ea 1b             	shr    $0x1b,%edx
+  802cdf:	01 d0                	add    %edx,%eax
+  802ce1:	83 e0 1f             	and    $0x1f,%eax
+  802ce4:	29 d0                	sub    %edx,%eax
+  802ce6:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  802ceb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802cee:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  802cf1:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  802cf4:	83 c6 01             	add    $0x1,%esi
+  802cf7:	eb ab                	jmp    802ca4 <devpipe_read+0x1c>
+
+00802cf9 <pipe>:
+{
+  802cf9:	55                   	push   %ebp
+  802cfa:	89 e5                	mov    %esp,%ebp
+  802cfc:	56                   	push   %esi
+  802cfd:	53                   	push   %ebx
+  802cfe:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  802d01:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802d04:	50                   	push   %eax
+  802d05:	e8 4c e3 ff ff       	call   801056 <fd_alloc>
+  802d0a:	89 c3                	mov    %eax,%ebx
+  802d0c:	83 c4 10             	add    $0x10,%esp
+  802d0f:	85 c0                	test   %eax,%eax
+  802d11:	0f 88 23 01 00 00    	js     802e3a <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802d17:	83 ec 04             	sub    $0x4,%esp
+  802d1a:	68 07 04 00 00       	push   $0x407
+  802d1f:	ff 75 f4             	push   -0xc(%ebp)
+  802d22:	6a 00                	push   $0x0
+  802d24:	e8 05 df ff ff       	call   800c2e <sys_page_alloc>
+  802d29:	89 c3                	mov    %eax,%ebx
+  802d2b:	83 c4 10             	add    $0x10,%esp
+  802d2e:	85 c0                	test   %eax,%eax
+  802d30:	0f 88 04 01 00 00    	js     802e3a <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  802d36:	83 ec 0c             	sub    $0xc,%esp
+  802d39:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802d3c:	50                   	push   %eax
+  802d3d:	e8 14 e3 ff ff       	call   801056 <fd_alloc>
+  802d42:	89 c3                	mov    %eax,%ebx
+  802d44:	83 c4 10             	add    $0x10,%esp
+  802d47:	85 c0                	test   %eax,%eax
+  802d49:	0f 88 db 00 00 00    	js     802e2a <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802d4f:	83 ec 04             	sub    $0x4,%esp
+  802d52:	68 07 04 00 00       	push   $0x407
+  802d57:	ff 75 f0             	push   -0x10(%ebp)
+  802d5a:	6a 00                	push   $0x0
+  802d5c:	e8 cd de ff ff       	call   800c2e <sys_page_alloc>
+  802d61:	89 c3                	mov    %eax,%ebx
+  802d63:	83 c4 10             	add    $0x10,%esp
+  802d66:	85 c0                	test   %eax,%eax
+  802d68:	0f 88 bc 00 00 00    	js     802e2a <pipe+0x131>
+	va = fd2data(fd0);
+  802d6e:	83 ec 0c             	sub    $0xc,%esp
+  802d71:	ff 75 f4             	push   -0xc(%ebp)
+  802d74:	e8 c6 e2 ff ff       	call   80103f <fd2data>
+  802d79:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802d7b:	83 c4 0c             	add    $0xc,%esp
+  802d7e:	68 07 04 00 00       	push   $0x407
+  802d83:	50                   	push   %eax
+  802d84:	6a 00                	push   $0x0
+  802d86:	e8 a3 de ff ff       	call   800c2e <sys_page_alloc>
+  802d8b:	89 c3                	mov    %eax,%ebx
+  802d8d:	83 c4 10             	add    $0x10,%esp
+  802d90:	85 c0                	test   %eax,%eax
+  802d92:	0f 88 82 00 00 00    	js     802e1a <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802d98:	83 ec 0c             	sub    $0xc,%esp
+  802d9b:	ff 75 f0             	push   -0x10(%ebp)
+  802d9e:	e8 9c e2 ff ff       	call   80103f <fd2data>
+  802da3:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  802daa:	50                   	push   %eax
+  802dab:	6a 00                	push   $0x0
+  802dad:	56                   	push   %esi
+  802dae:	6a 00                	push   $0x0
+  802db0:	e8 c4 de ff ff       	call   800c79 <sys_page_map>
+  802db5:	89 c3                	mov    %eax,%ebx
+  802db7:	83 c4 20             	add    $0x20,%esp
+  802dba:	85 c0                	test   %eax,%eax
+  802dbc:	78 4e                	js     802e0c <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  802dbe:	a1 60 40 80 00       	mov    0x804060,%eax
+  802dc3:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802dc6:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  802dc8:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802dcb:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  802dd2:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  802dd5:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  802dd7:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  802dda:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  802de1:	83 ec 0c             	sub    $0xc,%esp
+  802de4:	ff 75 f4             	push   -0xc(%ebp)
+  802de7:	e8 43 e2 ff ff       	call   80102f <fd2num>
+  802dec:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802def:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  802df1:	83 c4 04             	add    $0x4,%esp
+  802df4:	ff 75 f0             	push   -0x10(%ebp)
+  802df7:	e8 33 e2 ff ff       	call   80102f <fd2num>
+  802dfc:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802dff:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  802e02:	83 c4 10             	add    $0x10,%esp
+  802e05:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802e0a:	eb 2e                	jmp    802e3a <pipe+0x141>
+	sys_page_unmap(0, va);
+  802e0c:	83 ec 08             	sub    $0x8,%esp
+  802e0f:	56                   	push   %esi
+  802e10:	6a 00                	push   $0x0
+  802e12:	e8 a4 de ff ff       	call   800cbb <sys_page_unmap>
+  802e17:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  802e1a:	83 ec 08             	sub    $0x8,%esp
+  802e1d:	ff 75 f0             	push   -0x10(%ebp)
+  802e20:	6a 00                	push   $0x0
+  802e22:	e8 94 de ff ff       	call   800cbb <sys_page_unmap>
+  802e27:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  802e2a:	83 ec 08             	sub    $0x8,%esp
+  802e2d:	ff 75 f4             	push   -0xc(%ebp)
+  802e30:	6a 00                	push   $0x0
+  802e32:	e8 84 de ff ff       	call   800cbb <sys_page_unmap>
+  802e37:	83 c4 10             	add    $0x10,%esp
+}
+  802e3a:	89 d8                	mov    %ebx,%eax
+  802e3c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802e3f:	5b                   	pop    %ebx
+  802e40:	5e                   	pop    %esi
+  802e41:	5d                   	pop    %ebp
+  802e42:	c3                   	ret
+
+00802e43 <pipeisclosed>:
+{
+  802e43:	55                   	push   %ebp
+  802e44:	89 e5                	mov    %esp,%ebp
+  802e46:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802e49:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802e4c:	50                   	push   %eax
+  802e4d:	ff 75 08             	push   0x8(%ebp)
+  802e50:	e8 57 e2 ff ff       	call   8010ac <fd_lookup>
+  802e55:	83 c4 10             	add    $0x10,%esp
+  802e58:	85 c0                	test   %eax,%eax
+  802e5a:	78 18                	js     802e74 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  802e5c:	83 ec 0c             	sub    $0xc,%esp
+  802e5f:	ff 75 f4             	push   -0xc(%ebp)
+  802e62:	e8 d8 e1 ff ff       	call   80103f <fd2data>
+  802e67:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  802e69:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802e6c:	e8 33 fd ff ff       	call   802ba4 <_pipeisclosed>
+  802e71:	83 c4 10             	add    $0x10,%esp
+}
+  802e74:	c9                   	leave
+  802e75:	c3                   	ret
+
+00802e76 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  802e76:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e7b:	c3                   	ret
+
+00802e7c <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  802e7c:	55                   	push   %ebp
+  802e7d:	89 e5                	mov    %esp,%ebp
+  802e7f:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  802e82:	68 2e 3d 80 00       	push   $0x803d2e
+  802e87:	ff 75 0c             	push   0xc(%ebp)
+  802e8a:	e8 93 d9 ff ff       	call   800822 <strcpy>
+	return 0;
+}
+  802e8f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e94:	c9                   	leave
+  802e95:	c3                   	ret
+
+00802e96 <devcons_write>:
+{
+  802e96:	55                   	push   %ebp
+  802e97:	89 e5                	mov    %esp,%ebp
+  802e99:	57                   	push   %edi
+  802e9a:	56                   	push   %esi
+  802e9b:	53                   	push   %ebx
+  802e9c:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  802ea2:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  802ea7:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  802ead:	eb 2e                	jmp    802edd <devcons_write+0x47>
+		m = n - tot;
+  802eaf:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802eb2:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  802eb4:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  802eb9:	39 c3                	cmp    %eax,%ebx
+  802ebb:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  802ebe:	83 ec 04             	sub    $0x4,%esp
+  802ec1:	53                   	push   %ebx
+  802ec2:	89 f0                	mov    %esi,%eax
+  802ec4:	03 45 0c             	add    0xc(%ebp),%eax
+  802ec7:	50                   	push   %eax
+  802ec8:	57                   	push   %edi
+  802ec9:	e8 da da ff ff       	call   8009a8 <memmove>
+		sys_cputs(buf, m);
+  802ece:	83 c4 08             	add    $0x8,%esp
+  802ed1:	53                   	push   %ebx
+  802ed2:	57                   	push   %edi
+  802ed3:	e8 7a dc ff ff       	call   800b52 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  802ed8:	01 de                	add    %ebx,%esi
+  802eda:	83 c4 10             	add    $0x10,%esp
+  802edd:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802ee0:	72 cd                	jb     802eaf <devcons_write+0x19>
+}
+  802ee2:	89 f0                	mov    %esi,%eax
+  802ee4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802ee7:	5b                   	pop    %ebx
+  802ee8:	5e                   	pop    %esi
+  802ee9:	5f                   	pop    %edi
+  802eea:	5d                   	pop    %ebp
+  802eeb:	c3                   	ret
+
+00802eec <devcons_read>:
+{
+  802eec:	55                   	push   %ebp
+  802eed:	89 e5                	mov    %esp,%ebp
+  802eef:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  802ef2:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ef7:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802efb:	75 07                	jne    802f04 <devcons_read+0x18>
+  802efd:	eb 1f                	jmp    802f1e <devcons_read+0x32>
+		sys_yield();
+  802eff:	e8 0b dd ff ff       	call   800c0f <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  802f04:	e8 6f dc ff ff       	call   800b78 <sys_cgetc>
+  802f09:	85 c0                	test   %eax,%eax
+  802f0b:	74 f2                	je     802eff <devcons_read+0x13>
+	if (c < 0)
+  802f0d:	78 0f                	js     802f1e <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  802f0f:	83 f8 04             	cmp    $0x4,%eax
+  802f12:	74 0c                	je     802f20 <devcons_read+0x34>
+	*(char*)vbuf = c;
+  802f14:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802f17:	88 02                	mov    %al,(%edx)
+	return 1;
+  802f19:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  802f1e:	c9                   	leave
+  802f1f:	c3                   	ret
+		return 0;
+  802f20:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f25:	eb f7                	jmp    802f1e <devcons_read+0x32>
+
+00802f27 <cputchar>:
+{
+  802f27:	55                   	push   %ebp
+  802f28:	89 e5                	mov    %esp,%ebp
+  802f2a:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  802f2d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802f30:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  802f33:	6a 01                	push   $0x1
+  802f35:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802f38:	50                   	push   %eax
+  802f39:	e8 14 dc ff ff       	call   800b52 <sys_cputs>
+}
+  802f3e:	83 c4 10             	add    $0x10,%esp
+  802f41:	c9                   	leave
+  802f42:	c3                   	ret
+
+00802f43 <getchar>:
+{
+  802f43:	55                   	push   %ebp
+  802f44:	89 e5                	mov    %esp,%ebp
+  802f46:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  802f49:	6a 01                	push   $0x1
+  802f4b:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802f4e:	50                   	push   %eax
+  802f4f:	6a 00                	push   $0x0
+  802f51:	e8 bc e3 ff ff       	call   801312 <read>
+	if (r < 0)
+  802f56:	83 c4 10             	add    $0x10,%esp
+  802f59:	85 c0                	test   %eax,%eax
+  802f5b:	78 06                	js     802f63 <getchar+0x20>
+	if (r < 1)
+  802f5d:	74 06                	je     802f65 <getchar+0x22>
+	return c;
+  802f5f:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  802f63:	c9                   	leave
+  802f64:	c3                   	ret
+		return -E_EOF;
+  802f65:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  802f6a:	eb f7                	jmp    802f63 <getchar+0x20>
+
+00802f6c <iscons>:
+{
+  802f6c:	55                   	push   %ebp
+  802f6d:	89 e5                	mov    %esp,%ebp
+  802f6f:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802f72:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802f75:	50                   	push   %eax
+  802f76:	ff 75 08             	push   0x8(%ebp)
+  802f79:	e8 2e e1 ff ff       	call   8010ac <fd_lookup>
+  802f7e:	83 c4 10             	add    $0x10,%esp
+  802f81:	85 c0                	test   %eax,%eax
+  802f83:	78 11                	js     802f96 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  802f85:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802f88:	8b 15 80 40 80 00    	mov    0x804080,%edx
+  802f8e:	39 10                	cmp    %edx,(%eax)
+  802f90:	0f 94 c0             	sete   %al
+  802f93:	0f b6 c0             	movzbl %al,%eax
+}
+  802f96:	c9                   	leave
+  802f97:	c3                   	ret
+
+00802f98 <opencons>:
+{
+  802f98:	55                   	push   %ebp
+  802f99:	89 e5                	mov    %esp,%ebp
+  802f9b:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  802f9e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802fa1:	50                   	push   %eax
+  802fa2:	e8 af e0 ff ff       	call   801056 <fd_alloc>
+  802fa7:	83 c4 10             	add    $0x10,%esp
+  802faa:	85 c0                	test   %eax,%eax
+  802fac:	78 3a                	js     802fe8 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  802fae:	83 ec 04             	sub    $0x4,%esp
+  802fb1:	68 07 04 00 00       	push   $0x407
+  802fb6:	ff 75 f4             	push   -0xc(%ebp)
+  802fb9:	6a 00                	push   $0x0
+  802fbb:	e8 6e dc ff ff       	call   800c2e <sys_page_alloc>
+  802fc0:	83 c4 10             	add    $0x10,%esp
+  802fc3:	85 c0                	test   %eax,%eax
+  802fc5:	78 21                	js     802fe8 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  802fc7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802fca:	8b 15 80 40 80 00    	mov    0x804080,%edx
+  802fd0:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  802fd2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802fd5:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  802fdc:	83 ec 0c             	sub    $0xc,%esp
+  802fdf:	50                   	push   %eax
+  802fe0:	e8 4a e0 ff ff       	call   80102f <fd2num>
+  802fe5:	83 c4 10             	add    $0x10,%esp
+}
+  802fe8:	c9                   	leave
+  802fe9:	c3                   	ret
+
+00802fea <copy_page_to>:
+// The handler cowpage found installed, which gets the faults that are
+// not copy-on-write faults.
+static void (*pgfault_next)(struct UTrapframe *utf);
+
+static int copy_page_to(envid_t envid, void *va, int perm)
+{
+  802fea:	55                   	push   %ebp
+  802feb:	89 e5                	mov    %esp,%ebp
+  802fed:	57                   	push   %edi
+  802fee:	56                   	push   %esi
+  802fef:	53                   	push   %ebx
+  802ff0:	83 ec 20             	sub    $0x20,%esp
+  802ff3:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802ff6:	89 d7                	mov    %edx,%edi
+  802ff8:	89 ce                	mov    %ecx,%esi
+	int r;
+
+	r = sys_page_alloc(0, (void *) PFTEMP, perm);
+  802ffa:	51                   	push   %ecx
+  802ffb:	68 00 f0 7f 00       	push   $0x7ff000
+  803000:	6a 00                	push   $0x0
+  803002:	e8 27 dc ff ff       	call   800c2e <sys_page_alloc>
+  803007:	89 c3                	mov    %eax,%ebx
+	if (r < 0)
+  803009:	83 c4 10             	add    $0x10,%esp
+  80300c:	85 c0                	test   %eax,%eax
+  80300e:	78 45                	js     803055 <copy_page_to+0x6b>
+		goto exit;
+	memmove((void *) PFTEMP, va, PGSIZE);
+  803010:	83 ec 04             	sub    $0x4,%esp
+  803013:	68 00 10 00 00       	push   $0x1000
+  803018:	57                   	push   %edi
+  803019:	68 00 f0 7f 00       	push   $0x7ff000
+  80301e:	e8 85 d9 ff ff       	call   8009a8 <memmove>
+	r = sys_page_map(0, (void *) PFTEMP, envid, va, perm);
+  803023:	89 34 24             	mov    %esi,(%esp)
+  803026:	57                   	push   %edi
+  803027:	ff 75 e4             	push   -0x1c(%ebp)
+  80302a:	68 00 f0 7f 00       	push   $0x7ff000
+  80302f:	6a 00                	push   $0x0
+  803031:	e8 43 dc ff ff       	call   800c79 <sys_page_map>
+  803036:	89 c3                	mov    %eax,%ebx
+	if (r < 0)
+  803038:	83 c4 20             	add    $0x20,%esp
+  80303b:	85 c0                	test   %eax,%eax
+  80303d:	78 16                	js     803055 <copy_page_to+0x6b>
+		goto exit;
+	assert(!sys_page_unmap(0, (void *) PFTEMP));
+  80303f:	83 ec 08             	sub    $0x8,%esp
+  803042:	68 00 f0 7f 00       	push   $0x7ff000
+  803047:	6a 00                	push   $0x0
+  803049:	e8 6d dc ff ff       	call   800cbb <sys_page_unmap>
+  80304e:	83 c4 10             	add    $0x10,%esp
+  803051:	85 c0                	test   %eax,%eax
+  803053:	75 0a                	jne    80305f <copy_page_to+0x75>
+exit:
+	return r;
+}
+  803055:	89 d8                	mov    %ebx,%eax
+  803057:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80305a:	5b                   	pop    %ebx
+  80305b:	5e                   	pop    %esi
+  80305c:	5f                   	pop    %edi
+  80305d:	5d                   	pop    %ebp
+  80305e:	c3                   	ret
+	assert(!sys_page_unmap(0, (void *) PFTEMP));
+  80305f:	68 3c 3d 80 00       	push   $0x803d3c
+  803064:	68 80 3c 80 00       	push   $0x803c80
+  803069:	6a 1b                	push   $0x1b
+  80306b:	68 b4 3d 80 00       	push   $0x803db4
+  803070:	e8 e4 d0 ff ff       	call   800159 <_panic>
+
+00803075 <pgfault>:
+// map in our own private writable copy.  Other faults go to the handler
+// cowpage replaced, if any.
+//
+static void
+pgfault(struct UTrapframe *utf)
+{
+  803075:	55                   	push   %ebp
+  803076:	89 e5                	mov    %esp,%ebp
+  803078:	53                   	push   %ebx
+  803079:	83 ec 04             	sub    $0x4,%esp
+  80307c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	void *addr = (void *) utf->utf_fault_va;
+  80307f:	8b 13                	mov    (%ebx),%edx
+	// Hint:
+	//   Use the read-only page table mappings at uvpt
+	//   (see <inc/memlayout.h>).
+
+	// LAB 4: Your code here.
+	if (!(err & FEC_WR) || !(uvpd[PDX(addr)] & PTE_P)
+  803081:	f6 43 04 02          	testb  $0x2,0x4(%ebx)
+  803085:	74 21                	je     8030a8 <pgfault+0x33>
+  803087:	89 d0                	mov    %edx,%eax
+  803089:	c1 e8 16             	shr    $0x16,%eax
+  80308c:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  803093:	a8 01                	test   $0x1,%al
+  803095:	74 11                	je     8030a8 <pgfault+0x33>
+	    || !(uvpt[PGNUM(addr)] & PTE_COW)) {
+  803097:	89 d0                	mov    %edx,%eax
+  803099:	c1 e8 0c             	shr    $0xc,%eax
+  80309c:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8030a3:	f6 c4 08             	test   $0x8,%ah
+  8030a6:	75 17                	jne    8030bf <pgfault+0x4a>
+		if (pgfault_next) {
+  8030a8:	a1 04 90 80 00       	mov    0x809004,%eax
+  8030ad:	85 c0                	test   %eax,%eax
+  8030af:	74 27                	je     8030d8 <pgfault+0x63>
+			pgfault_next(utf);
+  8030b1:	83 ec 0c             	sub    $0xc,%esp
+  8030b4:	53                   	push   %ebx
+  8030b5:	ff d0                	call   *%eax
+			return;
+  8030b7:	83 c4 10             	add    $0x10,%esp
+exit:
+	cprintf("[%08x] pgfault: Can't handle page fault happened at"
+		"0x%08x, eip: 0x%08x. Exiting...\n", thisenv->env_id,
+		utf->utf_fault_va, utf->utf_eip);
+	sys_env_destroy(0);
+}
+  8030ba:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8030bd:	c9                   	leave
+  8030be:	c3                   	ret
+	if (copy_page_to(0, ROUNDDOWN(addr, PGSIZE), PTE_U | PTE_W | PTE_P) < 0)
+  8030bf:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+  8030c5:	b9 07 00 00 00       	mov    $0x7,%ecx
+  8030ca:	b8 00 00 00 00       	mov    $0x0,%eax
+  8030cf:	e8 16 ff ff ff       	call   802fea <copy_page_to>
+  8030d4:	85 c0                	test   %eax,%eax
+  8030d6:	79 e2                	jns    8030ba <pgfault+0x45>
+		"0x%08x, eip: 0x%08x. Exiting...\n", thisenv->env_id,
+  8030d8:	a1 00 50 80 00       	mov    0x805000,%eax
+  8030dd:	8b 40 48             	mov    0x48(%eax),%eax
+	cprintf("[%08x] pgfault: Can't handle page fault happened at"
+  8030e0:	ff 73 28             	push   0x28(%ebx)
+  8030e3:	ff 33                	push   (%ebx)
+  8030e5:	50                   	push   %eax
+  8030e6:	68 60 3d 80 00       	push   $0x803d60
+  8030eb:	e8 44 d1 ff ff       	call   800234 <cprintf>
+	sys_env_destroy(0);
+  8030f0:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  8030f7:	e8 a3 da ff ff       	call   800b9f <sys_env_destroy>
+  8030fc:	83 c4 10             	add    $0x10,%esp
+  8030ff:	eb b9                	jmp    8030ba <pgfault+0x45>
+
+00803101 <cowpage>:
+//
+// Returns: 0 on success, < 0 on error.
+//
+int
+cowpage(void *va)
+{
+  803101:	55                   	push   %ebp
+  803102:	89 e5                	mov    %esp,%ebp
+  803104:	53                   	push   %ebx
+  803105:	83 ec 04             	sub    $0x4,%esp
+  803108:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (_pgfault_handler != pgfault) {
+  80310b:	a1 08 90 80 00       	mov    0x809008,%eax
+  803110:	3d 75 30 80 00       	cmp    $0x803075,%eax
+  803115:	74 15                	je     80312c <cowpage+0x2b>
+		pgfault_next = _pgfault_handler;
+  803117:	a3 04 90 80 00       	mov    %eax,0x809004
+		set_pgfault_handler(pgfault);
+  80311c:	83 ec 0c             	sub    $0xc,%esp
+  80311f:	68 75 30 80 00       	push   $0x803075
+  803124:	e8 fb 03 00 00       	call   803524 <set_pgfault_handler>
+  803129:	83 c4 10             	add    $0x10,%esp
+	}
+	return sys_page_map(0, va, 0, va, PTE_COW | PTE_U | PTE_P);
+  80312c:	83 ec 0c             	sub    $0xc,%esp
+  80312f:	68 05 08 00 00       	push   $0x805
+  803134:	53                   	push   %ebx
+  803135:	6a 00                	push   $0x0
+  803137:	53                   	push   %ebx
+  803138:	6a 00                	push   $0x0
+  80313a:	e8 3a db ff ff       	call   800c79 <sys_page_map>
+}
+  80313f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803142:	c9                   	leave
+  803143:	c3                   	ret
+
+00803144 <fork>:
+//   Neither user exception stack should ever be marked copy-on-write,
+//   so you must allocate a new page for the child's user exception stack.
+//
+envid_t
+fork(void)
+{
+  803144:	55                   	push   %ebp
+  803145:	89 e5                	mov    %esp,%ebp
+  803147:	57                   	push   %edi
+  803148:	56                   	push   %esi
+  803149:	53                   	push   %ebx
+  80314a:	83 ec 28             	sub    $0x28,%esp
+	// LAB 4: Your code here.
+	envid_t envid;
+	int r;
+
+	set_pgfault_handler(pgfault);
+  80314d:	68 75 30 80 00       	push   $0x803075
+  803152:	e8 cd 03 00 00       	call   803524 <set_pgfault_handler>
+// child pointing to the trashed stack frame.
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	asm volatile("int %2"
+  803157:	b8 07 00 00 00       	mov    $0x7,%eax
+  80315c:	cd 30                	int    $0x30
+  80315e:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  803161:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	envid = sys_exofork();
+	if (envid < 0)
+  803164:	83 c4 10             	add    $0x10,%esp
+  803167:	85 c0                	test   %eax,%eax
+  803169:	0f 88 6b 01 00 00    	js     8032da <fork+0x196>
+	else if (envid == 0) {
+		thisenv = &envs[ENVX(sys_getenvid())];
+		return 0;
+	}
+
+	for (uintptr_t addr = 0; addr < UTOP; addr += PGSIZE) {
+  80316f:	bb 00 00 00 00       	mov    $0x0,%ebx
+	else if (envid == 0) {
+  803174:	75 37                	jne    8031ad <fork+0x69>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  803176:	e8 6d da ff ff       	call   800be8 <sys_getenvid>
+  80317b:	25 ff 03 00 00       	and    $0x3ff,%eax
+  803180:	69 c0 8c 00 00 00    	imul   $0x8c,%eax,%eax
+  803186:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80318b:	a3 00 50 80 00       	mov    %eax,0x805000
+		return 0;
+  803190:	e9 45 01 00 00       	jmp    8032da <fork+0x196>
+		if (!(uvpd[PDX(addr)] & PTE_P)) {
+			addr += PTSIZE - PGSIZE;
+  803195:	81 c3 00 f0 3f 00    	add    $0x3ff000,%ebx
+	for (uintptr_t addr = 0; addr < UTOP; addr += PGSIZE) {
+  80319b:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8031a1:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  8031a7:	0f 87 ba 00 00 00    	ja     803267 <fork+0x123>
+		if (!(uvpd[PDX(addr)] & PTE_P)) {
+  8031ad:	89 d8                	mov    %ebx,%eax
+  8031af:	c1 e8 16             	shr    $0x16,%eax
+  8031b2:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8031b9:	a8 01                	test   $0x1,%al
+  8031bb:	74 d8                	je     803195 <fork+0x51>
+			continue;
+		}
+		if (!(uvpt[PGNUM(addr)] & PTE_P))
+  8031bd:	89 d8                	mov    %ebx,%eax
+  8031bf:	c1 e8 0c             	shr    $0xc,%eax
+  8031c2:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8031c9:	f6 c2 01             	test   $0x1,%dl
+  8031cc:	74 cd                	je     80319b <fork+0x57>
+			continue;
+		if (addr == USTACKTOP - PGSIZE || addr == UXSTACKTOP - PGSIZE)
+  8031ce:	89 da                	mov    %ebx,%edx
+  8031d0:	80 e6 df             	and    $0xdf,%dh
+  8031d3:	81 fa 00 d0 bf ee    	cmp    $0xeebfd000,%edx
+  8031d9:	74 c0                	je     80319b <fork+0x57>
+	void *va = (void *) (pn << PGSHIFT);
+  8031db:	89 df                	mov    %ebx,%edi
+	if ((uvpt[pn] & PTE_SHARE) ||
+  8031dd:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8031e4:	f6 c6 04             	test   $0x4,%dh
+  8031e7:	75 53                	jne    80323c <fork+0xf8>
+	    (!(uvpt[pn] & PTE_COW) && !(uvpt[pn] & PTE_W)))
+  8031e9:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+	if ((uvpt[pn] & PTE_SHARE) ||
+  8031f0:	f6 c6 08             	test   $0x8,%dh
+  8031f3:	75 0c                	jne    803201 <fork+0xbd>
+	    (!(uvpt[pn] & PTE_COW) && !(uvpt[pn] & PTE_W)))
+  8031f5:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8031fc:	f6 c2 02             	test   $0x2,%dl
+  8031ff:	74 3b                	je     80323c <fork+0xf8>
+	r = sys_page_map(0, va, envid, va, PTE_COW | PTE_U | PTE_P);
+  803201:	83 ec 0c             	sub    $0xc,%esp
+  803204:	68 05 08 00 00       	push   $0x805
+  803209:	57                   	push   %edi
+  80320a:	ff 75 e4             	push   -0x1c(%ebp)
+  80320d:	57                   	push   %edi
+  80320e:	6a 00                	push   $0x0
+  803210:	e8 64 da ff ff       	call   800c79 <sys_page_map>
+  803215:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  803217:	83 c4 20             	add    $0x20,%esp
+  80321a:	85 c0                	test   %eax,%eax
+  80321c:	0f 88 a7 00 00 00    	js     8032c9 <fork+0x185>
+	r = sys_page_map(0, va, 0, va, PTE_COW | PTE_U | PTE_P);
+  803222:	83 ec 0c             	sub    $0xc,%esp
+  803225:	68 05 08 00 00       	push   $0x805
+  80322a:	57                   	push   %edi
+  80322b:	6a 00                	push   $0x0
+  80322d:	57                   	push   %edi
+  80322e:	6a 00                	push   $0x0
+  803230:	e8 44 da ff ff       	call   800c79 <sys_page_map>
+  803235:	89 c6                	mov    %eax,%esi
+	return r;
+  803237:	83 c4 20             	add    $0x20,%esp
+  80323a:	eb 21                	jmp    80325d <fork+0x119>
+		return sys_page_map(0, va, envid, va, uvpt[pn] & PTE_SYSCALL);
+  80323c:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  803243:	83 ec 0c             	sub    $0xc,%esp
+  803246:	25 07 0e 00 00       	and    $0xe07,%eax
+  80324b:	50                   	push   %eax
+  80324c:	57                   	push   %edi
+  80324d:	ff 75 e4             	push   -0x1c(%ebp)
+  803250:	57                   	push   %edi
+  803251:	6a 00                	push   $0x0
+  803253:	e8 21 da ff ff       	call   800c79 <sys_page_map>
+  803258:	89 c6                	mov    %eax,%esi
+  80325a:	83 c4 20             	add    $0x20,%esp
+			continue;
+		r = duppage(envid, PGNUM(addr));
+		if (r < 0)
+  80325d:	85 f6                	test   %esi,%esi
+  80325f:	0f 89 36 ff ff ff    	jns    80319b <fork+0x57>
+  803265:	eb 62                	jmp    8032c9 <fork+0x185>
+			goto exit;
+	}
+
+	r = copy_page_to(envid, (void *) USTACKTOP - PGSIZE, PTE_U | PTE_W | PTE_P);
+  803267:	b9 07 00 00 00       	mov    $0x7,%ecx
+  80326c:	ba 00 d0 bf ee       	mov    $0xeebfd000,%edx
+  803271:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  803274:	89 f8                	mov    %edi,%eax
+  803276:	e8 6f fd ff ff       	call   802fea <copy_page_to>
+  80327b:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  80327d:	85 c0                	test   %eax,%eax
+  80327f:	78 48                	js     8032c9 <fork+0x185>
+		goto exit;
+	r = sys_page_alloc(envid, (void *) UXSTACKTOP - PGSIZE, PTE_U | PTE_W | PTE_P);
+  803281:	83 ec 04             	sub    $0x4,%esp
+  803284:	6a 07                	push   $0x7
+  803286:	68 00 f0 bf ee       	push   $0xeebff000
+  80328b:	57                   	push   %edi
+  80328c:	e8 9d d9 ff ff       	call   800c2e <sys_page_alloc>
+  803291:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  803293:	83 c4 10             	add    $0x10,%esp
+  803296:	85 c0                	test   %eax,%eax
+  803298:	78 2f                	js     8032c9 <fork+0x185>
+		goto exit;
+	r = sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall);
+  80329a:	a1 00 50 80 00       	mov    0x805000,%eax
+  80329f:	8b 40 64             	mov    0x64(%eax),%eax
+  8032a2:	83 ec 08             	sub    $0x8,%esp
+  8032a5:	50                   	push   %eax
+  8032a6:	57                   	push   %edi
+  8032a7:	e8 ed da ff ff       	call   800d99 <sys_env_set_pgfault_upcall>
+  8032ac:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  8032ae:	83 c4 10             	add    $0x10,%esp
+  8032b1:	85 c0                	test   %eax,%eax
+  8032b3:	78 14                	js     8032c9 <fork+0x185>
+		goto exit;
+	r = sys_env_set_status(envid, ENV_RUNNABLE);
+  8032b5:	83 ec 08             	sub    $0x8,%esp
+  8032b8:	6a 02                	push   $0x2
+  8032ba:	57                   	push   %edi
+  8032bb:	e8 45 da ff ff       	call   800d05 <sys_env_set_status>
+  8032c0:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  8032c2:	83 c4 10             	add    $0x10,%esp
+  8032c5:	85 c0                	test   %eax,%eax
+  8032c7:	79 11                	jns    8032da <fork+0x196>
+		goto exit;
+	return envid;
+exit:
+	sys_env_destroy(envid);
+  8032c9:	83 ec 0c             	sub    $0xc,%esp
+  8032cc:	ff 75 e0             	push   -0x20(%ebp)
+  8032cf:	e8 cb d8 ff ff       	call   800b9f <sys_env_destroy>
+	return r;
+  8032d4:	83 c4 10             	add    $0x10,%esp
+  8032d7:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+}
+  8032da:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8032dd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8032e0:	5b                   	pop    %ebx
+  8032e1:	5e                   	pop    %esi
+  8032e2:	5f                   	pop    %edi
+  8032e3:	5d                   	pop    %ebp
+  8032e4:	c3                   	ret
+
+008032e5 <sfork>:
+
+// Challenge!
+int
+sfork(void)
+{
+  8032e5:	55                   	push   %ebp
+  8032e6:	89 e5                	mov    %esp,%ebp
+  8032e8:	83 ec 0c             	sub    $0xc,%esp
+	panic("sfork not implemented");
+  8032eb:	68 bf 3d 80 00       	push   $0x803dbf
+  8032f0:	68 bf 00 00 00       	push   $0xbf
+  8032f5:	68 b4 3d 80 00       	push   $0x803db4
+  8032fa:	e8 5a ce ff ff       	call   800159 <_panic>
+
+008032ff <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  8032ff:	55                   	push   %ebp
+  803300:	89 e5                	mov    %esp,%ebp
+  803302:	56                   	push   %esi
+  803303:	53                   	push   %ebx
+  803304:	8b 75 08             	mov    0x8(%ebp),%esi
+  803307:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80330a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int r;
+
+	if (pg == NULL)
+		pg = (void *) UTOP;
+  80330d:	85 c0                	test   %eax,%eax
+  80330f:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  803314:	0f 44 c2             	cmove  %edx,%eax
+
+	r = sys_ipc_recv(pg);
+  803317:	83 ec 0c             	sub    $0xc,%esp
+  80331a:	50                   	push   %eax
+  80331b:	e8 56 db ff ff       	call   800e76 <sys_ipc_recv>
+	if (from_env_store)
+  803320:	83 c4 10             	add    $0x10,%esp
+  803323:	85 f6                	test   %esi,%esi
+  803325:	74 14                	je     80333b <ipc_recv+0x3c>
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  803327:	ba 00 00 00 00       	mov    $0x0,%edx
+  80332c:	85 c0                	test   %eax,%eax
+  80332e:	75 09                	jne    803339 <ipc_recv+0x3a>
+  803330:	8b 15 00 50 80 00    	mov    0x805000,%edx
+  803336:	8b 52 74             	mov    0x74(%edx),%edx
+  803339:	89 16                	mov    %edx,(%esi)
+	if (perm_store)
+  80333b:	85 db                	test   %ebx,%ebx
+  80333d:	74 25                	je     803364 <ipc_recv+0x65>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  80333f:	85 c0                	test   %eax,%eax
+  803341:	74 0d                	je     803350 <ipc_recv+0x51>
+  803343:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+	return r ?: thisenv->env_ipc_value;
+}
+  803349:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80334c:	5b                   	pop    %ebx
+  80334d:	5e                   	pop    %esi
+  80334e:	5d                   	pop    %ebp
+  80334f:	c3                   	ret
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  803350:	a1 00 50 80 00       	mov    0x805000,%eax
+  803355:	8b 40 78             	mov    0x78(%eax),%eax
+  803358:	89 03                	mov    %eax,(%ebx)
+	return r ?: thisenv->env_ipc_value;
+  80335a:	a1 00 50 80 00       	mov    0x805000,%eax
+  80335f:	8b 40 70             	mov    0x70(%eax),%eax
+  803362:	eb e5                	jmp    803349 <ipc_recv+0x4a>
+  803364:	85 c0                	test   %eax,%eax
+  803366:	75 e1                	jne    803349 <ipc_recv+0x4a>
+  803368:	eb f0                	jmp    80335a <ipc_recv+0x5b>
+
+0080336a <ipc_send>:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  80336a:	55                   	push   %ebp
+  80336b:	89 e5                	mov    %esp,%ebp
+  80336d:	57                   	push   %edi
+  80336e:	56                   	push   %esi
+  80336f:	53                   	push   %ebx
+  803370:	83 ec 0c             	sub    $0xc,%esp
+  803373:	8b 7d 08             	mov    0x8(%ebp),%edi
+  803376:	8b 75 0c             	mov    0xc(%ebp),%esi
+  803379:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int r;
+
+	if (pg == NULL)
+		pg = (void *) UTOP;
+  80337c:	85 db                	test   %ebx,%ebx
+  80337e:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  803383:	0f 44 d8             	cmove  %eax,%ebx
+
+	while ((r = sys_ipc_try_send(to_env, val, pg, perm))) {
+  803386:	ff 75 14             	push   0x14(%ebp)
+  803389:	53                   	push   %ebx
+  80338a:	56                   	push   %esi
+  80338b:	57                   	push   %edi
+  80338c:	e8 52 da ff ff       	call   800de3 <sys_ipc_try_send>
+  803391:	83 c4 10             	add    $0x10,%esp
+  803394:	85 c0                	test   %eax,%eax
+  803396:	74 22                	je     8033ba <ipc_send+0x50>
+		assert(r == -E_IPC_NOT_RECV);
+  803398:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  80339b:	75 07                	jne    8033a4 <ipc_send+0x3a>
+		sys_yield();
+  80339d:	e8 6d d8 ff ff       	call   800c0f <sys_yield>
+  8033a2:	eb e2                	jmp    803386 <ipc_send+0x1c>
+		assert(r == -E_IPC_NOT_RECV);
+  8033a4:	68 d5 3d 80 00       	push   $0x803dd5
+  8033a9:	68 80 3c 80 00       	push   $0x803c80
+  8033ae:	6a 39                	push   $0x39
+  8033b0:	68 ea 3d 80 00       	push   $0x803dea
+  8033b5:	e8 9f cd ff ff       	call   800159 <_panic>
+	}
+}
+  8033ba:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8033bd:	5b                   	pop    %ebx
+  8033be:	5e                   	pop    %esi
+  8033bf:	5f                   	pop    %edi
+  8033c0:	5d                   	pop    %ebp
+  8033c1:	c3                   	ret
+
+008033c2 <ipc_recvv>:
+// Receive a value and up to *npages pages, mapped one after another
+// starting at 'pg'.  Like ipc_recv otherwise; also stores the number
+// of pages actually received in *npages (0 on error).
+int32_t
+ipc_recvv(envid_t *from_env_store, void *pg, int *npages, int *perm_store)
+{
+  8033c2:	55                   	push   %ebp
+  8033c3:	89 e5                	mov    %esp,%ebp
+  8033c5:	57                   	push   %edi
+  8033c6:	56                   	push   %esi
+  8033c7:	53                   	push   %ebx
+  8033c8:	83 ec 10             	sub    $0x10,%esp
+  8033cb:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8033ce:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8033d1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8033d4:	8b 75 14             	mov    0x14(%ebp),%esi
+	int r;
+
+	if (pg == NULL)
+		pg = (void *) UTOP;
+  8033d7:	85 c0                	test   %eax,%eax
+  8033d9:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  8033de:	0f 44 c2             	cmove  %edx,%eax
+
+	r = sys_ipc_recvv(pg, *npages, 0);
+  8033e1:	6a 00                	push   $0x0
+  8033e3:	ff 33                	push   (%ebx)
+  8033e5:	50                   	push   %eax
+  8033e6:	e8 48 da ff ff       	call   800e33 <sys_ipc_recvv>
+	*npages = !r ? thisenv->env_ipc_npages : 0;
+  8033eb:	83 c4 10             	add    $0x10,%esp
+  8033ee:	85 c0                	test   %eax,%eax
+  8033f0:	75 3c                	jne    80342e <ipc_recvv+0x6c>
+  8033f2:	8b 15 00 50 80 00    	mov    0x805000,%edx
+  8033f8:	8b 52 7c             	mov    0x7c(%edx),%edx
+  8033fb:	89 13                	mov    %edx,(%ebx)
+	if (from_env_store)
+  8033fd:	85 ff                	test   %edi,%edi
+  8033ff:	74 4e                	je     80344f <ipc_recvv+0x8d>
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  803401:	8b 15 00 50 80 00    	mov    0x805000,%edx
+  803407:	8b 52 74             	mov    0x74(%edx),%edx
+  80340a:	89 17                	mov    %edx,(%edi)
+	if (perm_store)
+  80340c:	85 f6                	test   %esi,%esi
+  80340e:	74 18                	je     803428 <ipc_recvv+0x66>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  803410:	85 c0                	test   %eax,%eax
+  803412:	75 2d                	jne    803441 <ipc_recvv+0x7f>
+  803414:	a1 00 50 80 00       	mov    0x805000,%eax
+  803419:	8b 40 78             	mov    0x78(%eax),%eax
+  80341c:	89 06                	mov    %eax,(%esi)
+	return r ?: thisenv->env_ipc_value;
+  80341e:	a1 00 50 80 00       	mov    0x805000,%eax
+  803423:	8b 40 70             	mov    0x70(%eax),%eax
+  803426:	eb 1f                	jmp    803447 <ipc_recvv+0x85>
+  803428:	85 c0                	test   %eax,%eax
+  80342a:	75 1b                	jne    803447 <ipc_recvv+0x85>
+  80342c:	eb f0                	jmp    80341e <ipc_recvv+0x5c>
+	*npages = !r ? thisenv->env_ipc_npages : 0;
+  80342e:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  803434:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (from_env_store)
+  803439:	85 ff                	test   %edi,%edi
+  80343b:	75 cd                	jne    80340a <ipc_recvv+0x48>
+	if (perm_store)
+  80343d:	85 f6                	test   %esi,%esi
+  80343f:	74 e7                	je     803428 <ipc_recvv+0x66>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  803441:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+}
+  803447:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80344a:	5b                   	pop    %ebx
+  80344b:	5e                   	pop    %esi
+  80344c:	5f                   	pop    %edi
+  80344d:	5d                   	pop    %ebp
+  80344e:	c3                   	ret
+	if (perm_store)
+  80344f:	85 f6                	test   %esi,%esi
+  803451:	75 bd                	jne    803410 <ipc_recvv+0x4e>
+  803453:	eb c9                	jmp    80341e <ipc_recvv+0x5c>
+
+00803455 <ipc_sendv>:
+// Each entry is a page address or'ed with the permissions to send
+// that page with (see sys_ipc_try_sendv).
+// Like ipc_send, keeps trying until it succeeds.
+void
+ipc_sendv(envid_t to_env, uint32_t val, const uintptr_t *pages, int npages)
+{
+  803455:	55                   	push   %ebp
+  803456:	89 e5                	mov    %esp,%ebp
+  803458:	57                   	push   %edi
+  803459:	56                   	push   %esi
+  80345a:	53                   	push   %ebx
+  80345b:	83 ec 0c             	sub    $0xc,%esp
+  80345e:	8b 7d 08             	mov    0x8(%ebp),%edi
+  803461:	8b 75 0c             	mov    0xc(%ebp),%esi
+  803464:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int r;
+
+	while ((r = sys_ipc_try_sendv(to_env, val, pages, npages))) {
+  803467:	ff 75 14             	push   0x14(%ebp)
+  80346a:	53                   	push   %ebx
+  80346b:	56                   	push   %esi
+  80346c:	57                   	push   %edi
+  80346d:	e8 99 d9 ff ff       	call   800e0b <sys_ipc_try_sendv>
+  803472:	83 c4 10             	add    $0x10,%esp
+  803475:	85 c0                	test   %eax,%eax
+  803477:	74 22                	je     80349b <ipc_sendv+0x46>
+		assert(r == -E_IPC_NOT_RECV);
+  803479:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  80347c:	75 07                	jne    803485 <ipc_sendv+0x30>
+		sys_yield();
+  80347e:	e8 8c d7 ff ff       	call   800c0f <sys_yield>
+  803483:	eb e2                	jmp    803467 <ipc_sendv+0x12>
+		assert(r == -E_IPC_NOT_RECV);
+  803485:	68 d5 3d 80 00       	push   $0x803dd5
+  80348a:	68 80 3c 80 00       	push   $0x803c80
+  80348f:	6a 5c                	push   $0x5c
+  803491:	68 ea 3d 80 00       	push   $0x803dea
+  803496:	e8 be cc ff ff       	call   800159 <_panic>
+	}
+}
+  80349b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80349e:	5b                   	pop    %ebx
+  80349f:	5e                   	pop    %esi
+  8034a0:	5f                   	pop    %edi
+  8034a1:	5d                   	pop    %ebp
+  8034a2:	c3                   	ret
+
+008034a3 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  8034a3:	55                   	push   %ebp
+  8034a4:	89 e5                	mov    %esp,%ebp
+  8034a6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  8034a9:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (envs[i].env_type == type)
+  8034ae:	69 d0 8c 00 00 00    	imul   $0x8c,%eax,%edx
+  8034b4:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  8034ba:	8b 52 50             	mov    0x50(%edx),%edx
+  8034bd:	39 ca                	cmp    %ecx,%edx
+  8034bf:	74 11                	je     8034d2 <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  8034c1:	83 c0 01             	add    $0x1,%eax
+  8034c4:	3d 00 04 00 00       	cmp    $0x400,%eax
+  8034c9:	75 e3                	jne    8034ae <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  8034cb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8034d0:	eb 0e                	jmp    8034e0 <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  8034d2:	69 c0 8c 00 00 00    	imul   $0x8c,%eax,%eax
+  8034d8:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8034dd:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  8034e0:	5d                   	pop    %ebp
+  8034e1:	c3                   	ret
+
+008034e2 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  8034e2:	55                   	push   %ebp
+  8034e3:	89 e5                	mov    %esp,%ebp
+  8034e5:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  8034e8:	89 c2                	mov    %eax,%edx
+  8034ea:	c1 ea 16             	shr    $0x16,%edx
+  8034ed:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  8034f4:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  8034f9:	f6 c1 01             	test   $0x1,%cl
+  8034fc:	74 22                	je     803520 <pageref+0x3e>
+	pte = uvpt[PGNUM(v)];
+  8034fe:	c1 e8 0c             	shr    $0xc,%eax
+  803501:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  803508:	a8 01                	test   $0x1,%al
+  80350a:	74 14                	je     803520 <pageref+0x3e>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  80350c:	c1 e8 0c             	shr    $0xc,%eax
+  80350f:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  803512:	8d 04 85 00 00 00 ef 	lea    -0x11000000(,%eax,4),%eax
+  803519:	0f b7 50 08          	movzwl 0x8(%eax),%edx
+  80351d:	0f b7 d2             	movzwl %dx,%edx
+}
+  803520:	89 d0                	mov    %edx,%eax
+  803522:	5d                   	pop    %ebp
+  803523:	c3                   	ret
+
+00803524 <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  803524:	55                   	push   %ebp
+  803525:	89 e5                	mov    %esp,%ebp
+  803527:	83 ec 08             	sub    $0x8,%esp
+	if (_pgfault_handler == 0) {
+  80352a:	83 3d 08 90 80 00 00 	cmpl   $0x0,0x809008
+  803531:	74 0a                	je     80353d <set_pgfault_handler+0x19>
+				       PTE_U | PTE_W | PTE_P));
+		assert(!sys_env_set_pgfault_upcall(0, _pgfault_upcall));
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  803533:	8b 45 08             	mov    0x8(%ebp),%eax
+  803536:	a3 08 90 80 00       	mov    %eax,0x809008
+}
+  80353b:	c9                   	leave
+  80353c:	c3                   	ret
+		assert(!sys_page_alloc(0, (void *) UXSTACKTOP - PGSIZE,
+  80353d:	83 ec 04             	sub    $0x4,%esp
+  803540:	6a 07                	push   $0x7
+  803542:	68 00 f0 bf ee       	push   $0xeebff000
+  803547:	6a 00                	push   $0x0
+  803549:	e8 e0 d6 ff ff       	call   800c2e <sys_page_alloc>
+  80354e:	83 c4 10             	add    $0x10,%esp
+  803551:	85 c0                	test   %eax,%eax
+  803553:	75 2c                	jne    803581 <set_pgfault_handler+0x5d>
+		assert(!sys_env_set_pgfault_upcall(0, _pgfault_upcall));
+  803555:	83 ec 08             	sub    $0x8,%esp
+  803558:	68 97 35 80 00       	push   $0x803597
+  80355d:	6a 00                	push   $0x0
+  80355f:	e8 35 d8 ff ff       	call   800d99 <sys_env_set_pgfault_upcall>
+  803564:	83 c4 10             	add    $0x10,%esp
+  803567:	85 c0                	test   %eax,%eax
+  803569:	74 c8                	je     803533 <set_pgfault_handler+0xf>
+  80356b:	68 3c 3e 80 00       	push   $0x803e3c
+  803570:	68 80 3c 80 00       	push   $0x803c80
+  803575:	6a 20                	push   $0x20
+  803577:	68 6c 3e 80 00       	push   $0x803e6c
+  80357c:	e8 d8 cb ff ff       	call   800159 <_panic>
+		assert(!sys_page_alloc(0, (void *) UXSTACKTOP - PGSIZE,
+  803581:	68 f4 3d 80 00       	push   $0x803df4
+  803586:	68 80 3c 80 00       	push   $0x803c80
+  80358b:	6a 1e                	push   $0x1e
+  80358d:	68 6c 3e 80 00       	push   $0x803e6c
+  803592:	e8 c2 cb ff ff       	call   800159 <_panic>
+
+00803597 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  803597:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  803598:	a1 08 90 80 00       	mov    0x809008,%eax
+	call *%eax
+  80359d:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  80359f:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+	movl	$-0x4, %ebp
+  8035a2:	bd fc ff ff ff       	mov    $0xfffffffc,%ebp
+	xadd	%ebp, 0x30(%esp)	# Load trap-time %esp.
+  8035a7:	0f c1 6c 24 30       	xadd   %ebp,0x30(%esp)
+
+	movl	0x28(%esp), %eax	# Load trap-time %eip.
+  8035ac:	8b 44 24 28          	mov    0x28(%esp),%eax
+	movl	%eax, -0x4(%ebp)
+  8035b0:	89 45 fc             	mov    %eax,-0x4(%ebp)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+	addl	$0x8, %esp
+  8035b3:	83 c4 08             	add    $0x8,%esp
+	popal
+  8035b6:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+	addl	$0x4, %esp
+  8035b7:	83 c4 04             	add    $0x4,%esp
+	popfl
+  8035ba:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+	popl	%esp
+  8035bb:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+	ret
+  8035bc:	c3                   	ret
+
+008035bd <dm>:
+  8035bd:	55                   	push   %ebp
+  8035be:	57                   	push   %edi
+  8035bf:	56                   	push   %esi
+  8035c0:	53                   	push   %ebx
+  8035c1:	83 ec 24             	sub    $0x24,%esp
+  8035c4:	89 44 24 08          	mov    %eax,0x8(%esp)
+  8035c8:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  8035cc:	8b 44 24 38          	mov    0x38(%esp),%eax
+  8035d0:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  8035d4:	89 44 24 10          	mov    %eax,0x10(%esp)
+  8035d8:	89 54 24 14          	mov    %edx,0x14(%esp)
+  8035dc:	8b 7c 24 40          	mov    0x40(%esp),%edi
+  8035e0:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8035e5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8035ea:	ba 00 00 00 00       	mov    $0x0,%edx
+  8035ef:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  8035f6:	00 
+  8035f7:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  8035fe:	00 
+  8035ff:	89 fb                	mov    %edi,%ebx
+  803601:	eb 08                	jmp    80360b <dm+0x4e>
+  803603:	83 e9 01             	sub    $0x1,%ecx
+  803606:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  803609:	74 68                	je     803673 <dm+0xb6>
+  80360b:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  80360f:	01 c0                	add    %eax,%eax
+  803611:	89 c6                	mov    %eax,%esi
+  803613:	89 d7                	mov    %edx,%edi
+  803615:	8b 44 24 08          	mov    0x8(%esp),%eax
+  803619:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  80361d:	0f ad d0             	shrd   %cl,%edx,%eax
+  803620:	d3 ea                	shr    %cl,%edx
+  803622:	f6 c1 20             	test   $0x20,%cl
+  803625:	74 04                	je     80362b <dm+0x6e>
+  803627:	89 d0                	mov    %edx,%eax
+  803629:	31 d2                	xor    %edx,%edx
+  80362b:	83 e0 01             	and    $0x1,%eax
+  80362e:	89 04 24             	mov    %eax,(%esp)
+  803631:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  803638:	00 
+  803639:	8b 04 24             	mov    (%esp),%eax
+  80363c:	8b 54 24 04          	mov    0x4(%esp),%edx
+  803640:	09 f0                	or     %esi,%eax
+  803642:	09 fa                	or     %edi,%edx
+  803644:	8b 74 24 10          	mov    0x10(%esp),%esi
+  803648:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  80364c:	39 f0                	cmp    %esi,%eax
+  80364e:	89 d5                	mov    %edx,%ebp
+  803650:	19 fd                	sbb    %edi,%ebp
+  803652:	72 af                	jb     803603 <dm+0x46>
+  803654:	29 f0                	sub    %esi,%eax
+  803656:	19 fa                	sbb    %edi,%edx
+  803658:	89 cf                	mov    %ecx,%edi
+  80365a:	c1 ef 05             	shr    $0x5,%edi
+  80365d:	83 e7 01             	and    $0x1,%edi
+  803660:	89 fe                	mov    %edi,%esi
+  803662:	83 f6 01             	xor    $0x1,%esi
+  803665:	d3 e6                	shl    %cl,%esi
+  803667:	d3 e7                	shl    %cl,%edi
+  803669:	09 74 24 18          	or     %esi,0x18(%esp)
+  80366d:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  803671:	eb 90                	jmp    803603 <dm+0x46>
+  803673:	85 db                	test   %ebx,%ebx
+  803675:	74 05                	je     80367c <dm+0xbf>
+  803677:	89 03                	mov    %eax,(%ebx)
+  803679:	89 53 04             	mov    %edx,0x4(%ebx)
+  80367c:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803680:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803684:	83 c4 24             	add    $0x24,%esp
+  803687:	5b                   	pop    %ebx
+  803688:	5e                   	pop    %esi
+  803689:	5f                   	pop    %edi
+  80368a:	5d                   	pop    %ebp
+  80368b:	c3                   	ret
+
+0080368c <__udivdi3>:
+  80368c:	83 ec 08             	sub    $0x8,%esp
+  80368f:	6a 00                	push   $0x0
+  803691:	ff 74 24 1c          	push   0x1c(%esp)
+  803695:	ff 74 24 1c          	push   0x1c(%esp)
+  803699:	8b 44 24 18          	mov    0x18(%esp),%eax
+  80369d:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8036a1:	e8 17 ff ff ff       	call   8035bd <dm>
+  8036a6:	83 c4 14             	add    $0x14,%esp
+  8036a9:	c3                   	ret
+
+008036aa <__umoddi3>:
+  8036aa:	83 ec 18             	sub    $0x18,%esp
+  8036ad:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  8036b1:	50                   	push   %eax
+  8036b2:	ff 74 24 2c          	push   0x2c(%esp)
+  8036b6:	ff 74 24 2c          	push   0x2c(%esp)
+  8036ba:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8036be:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8036c2:	e8 f6 fe ff ff       	call   8035bd <dm>
+  8036c7:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8036cb:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8036cf:	83 c4 24             	add    $0x24,%esp
+  8036d2:	c3                   	ret
+
+008036d3 <__divdi3>:
+  8036d3:	53                   	push   %ebx
+  8036d4:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8036d8:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8036dc:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  8036e0:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  8036e4:	85 d2                	test   %edx,%edx
+  8036e6:	78 15                	js     8036fd <__divdi3+0x2a>
+  8036e8:	85 db                	test   %ebx,%ebx
+  8036ea:	78 34                	js     803720 <__divdi3+0x4d>
+  8036ec:	83 ec 04             	sub    $0x4,%esp
+  8036ef:	6a 00                	push   $0x0
+  8036f1:	53                   	push   %ebx
+  8036f2:	51                   	push   %ecx
+  8036f3:	e8 c5 fe ff ff       	call   8035bd <dm>
+  8036f8:	83 c4 10             	add    $0x10,%esp
+  8036fb:	eb 21                	jmp    80371e <__divdi3+0x4b>
+  8036fd:	f7 d8                	neg    %eax
+  8036ff:	83 d2 00             	adc    $0x0,%edx
+  803702:	f7 da                	neg    %edx
+  803704:	85 db                	test   %ebx,%ebx
+  803706:	78 30                	js     803738 <__divdi3+0x65>
+  803708:	83 ec 04             	sub    $0x4,%esp
+  80370b:	6a 00                	push   $0x0
+  80370d:	53                   	push   %ebx
+  80370e:	51                   	push   %ecx
+  80370f:	e8 a9 fe ff ff       	call   8035bd <dm>
+  803714:	83 c4 10             	add    $0x10,%esp
+  803717:	f7 d8                	neg    %eax
+  803719:	83 d2 00             	adc    $0x0,%edx
+  80371c:	f7 da                	neg    %edx
+  80371e:	5b                   	pop    %ebx
+  80371f:	c3                   	ret
+  803720:	83 ec 04             	sub    $0x4,%esp
+  803723:	6a 00                	push   $0x0
+  803725:	f7 d9                	neg    %ecx
+  803727:	83 d3 00             	adc    $0x0,%ebx
+  80372a:	f7 db                	neg    %ebx
+  80372c:	53                   	push   %ebx
+  80372d:	51                   	push   %ecx
+  80372e:	e8 8a fe ff ff       	call   8035bd <dm>
+  803733:	83 c4 10             	add    $0x10,%esp
+  803736:	eb df                	jmp    803717 <__divdi3+0x44>
+  803738:	83 ec 04             	sub    $0x4,%esp
+  80373b:	6a 00                	push   $0x0
+  80373d:	f7 d9                	neg    %ecx
+  80373f:	83 d3 00             	adc    $0x0,%ebx
+  803742:	f7 db                	neg    %ebx
+  803744:	53                   	push   %ebx
+  803745:	51                   	push   %ecx
+  803746:	e8 72 fe ff ff       	call   8035bd <dm>
+  80374b:	83 c4 10             	add    $0x10,%esp
+  80374e:	eb ce                	jmp    80371e <__divdi3+0x4b>
+
+00803750 <__moddi3>:
+  803750:	55                   	push   %ebp
+  803751:	57                   	push   %edi
+  803752:	56                   	push   %esi
+  803753:	53                   	push   %ebx
+  803754:	83 ec 24             	sub    $0x24,%esp
+  803757:	8b 44 24 38          	mov    0x38(%esp),%eax
+  80375b:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  80375f:	8b 4c 24 40          	mov    0x40(%esp),%ecx
+  803763:	8b 5c 24 44          	mov    0x44(%esp),%ebx
+  803767:	85 d2                	test   %edx,%edx
+  803769:	78 3b                	js     8037a6 <__moddi3+0x56>
+  80376b:	83 ec 04             	sub    $0x4,%esp
+  80376e:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  803772:	56                   	push   %esi
+  803773:	89 ce                	mov    %ecx,%esi
+  803775:	f7 de                	neg    %esi
+  803777:	89 74 24 08          	mov    %esi,0x8(%esp)
+  80377b:	89 de                	mov    %ebx,%esi
+  80377d:	83 d6 00             	adc    $0x0,%esi
+  803780:	f7 de                	neg    %esi
+  803782:	89 74 24 14          	mov    %esi,0x14(%esp)
+  803786:	8b 74 24 08          	mov    0x8(%esp),%esi
+  80378a:	0f 48 f1             	cmovs  %ecx,%esi
+  80378d:	0f 49 5c 24 14       	cmovns 0x14(%esp),%ebx
+  803792:	53                   	push   %ebx
+  803793:	56                   	push   %esi
+  803794:	e8 24 fe ff ff       	call   8035bd <dm>
+  803799:	8b 44 24 28          	mov    0x28(%esp),%eax
+  80379d:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8037a1:	83 c4 10             	add    $0x10,%esp
+  8037a4:	eb 47                	jmp    8037ed <__moddi3+0x9d>
+  8037a6:	f7 d8                	neg    %eax
+  8037a8:	83 d2 00             	adc    $0x0,%edx
+  8037ab:	f7 da                	neg    %edx
+  8037ad:	83 ec 04             	sub    $0x4,%esp
+  8037b0:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  8037b4:	56                   	push   %esi
+  8037b5:	89 cf                	mov    %ecx,%edi
+  8037b7:	f7 df                	neg    %edi
+  8037b9:	89 de                	mov    %ebx,%esi
+  8037bb:	83 d6 00             	adc    $0x0,%esi
+  8037be:	f7 de                	neg    %esi
+  8037c0:	0f 49 cf             	cmovns %edi,%ecx
+  8037c3:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  8037c7:	0f 49 de             	cmovns %esi,%ebx
+  8037ca:	89 5c 24 0c          	mov    %ebx,0xc(%esp)
+  8037ce:	ff 74 24 0c          	push   0xc(%esp)
+  8037d2:	ff 74 24 0c          	push   0xc(%esp)
+  8037d6:	e8 e2 fd ff ff       	call   8035bd <dm>
+  8037db:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8037df:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8037e3:	f7 d8                	neg    %eax
+  8037e5:	83 d2 00             	adc    $0x0,%edx
+  8037e8:	f7 da                	neg    %edx
+  8037ea:	83 c4 10             	add    $0x10,%esp
+  8037ed:	83 c4 24             	add    $0x24,%esp
+  8037f0:	5b                   	pop    %ebx
+  8037f1:	5e                   	pop    %esi
+  8037f2:	5f                   	pop    %edi
+  8037f3:	5d                   	pop    %ebp
+  8037f4:	c3                   	ret
@@ -0,0 +1,7662 @@
+
+obj/user/yield.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 69 00 00 00       	call   80009a <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	53                   	push   %ebx
+  800037:	83 ec 0c             	sub    $0xc,%esp
+	int i;
+
+	cprintf("Hello, I am environment %08x.\n", thisenv->env_id);
+  80003a:	a1 00 50 80 00       	mov    0x805000,%eax
+  80003f:	8b 40 48             	mov    0x48(%eax),%eax
+  800042:	50                   	push   %eax
+  800043:	68 a0 37 80 00       	push   $0x8037a0
+  800048:	e8 45 01 00 00       	call   800192 <cprintf>
+  80004d:	83 c4 10             	add    $0x10,%esp
+	for (i = 0; i < 5; i++) {
+  800050:	bb 00 00 00 00       	mov    $0x0,%ebx
+		sys_yield();
+  800055:	e8 13 0b 00 00       	call   800b6d <sys_yield>
+		cprintf("Back in environment %08x, iteration %d.\n",
+			thisenv->env_id, i);
+  80005a:	a1 00 50 80 00       	mov    0x805000,%eax
+  80005f:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("Back in environment %08x, iteration %d.\n",
+  800062:	83 ec 04             	sub    $0x4,%esp
+  800065:	53                   	push   %ebx
+  800066:	50                   	push   %eax
+  800067:	68 c0 37 80 00       	push   $0x8037c0
+  80006c:	e8 21 01 00 00       	call   800192 <cprintf>
+	for (i = 0; i < 5; i++) {
+  800071:	83 c3 01             	add    $0x1,%ebx
+  800074:	83 c4 10             	add    $0x10,%esp
+  800077:	83 fb 05             	cmp    $0x5,%ebx
+  80007a:	75 d9                	jne    800055 <umain+0x22>
+	}
+	cprintf("All done in environment %08x.\n", thisenv->env_id);
+  80007c:	a1 00 50 80 00       	mov    0x805000,%eax
+  800081:	8b 40 48             	mov    0x48(%eax),%eax
+  800084:	83 ec 08             	sub    $0x8,%esp
+  800087:	50                   	push   %eax
+  800088:	68 ec 37 80 00       	push   $0x8037ec
+  80008d:	e8 00 01 00 00       	call   800192 <cprintf>
+}
+  800092:	83 c4 10             	add    $0x10,%esp
+  800095:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800098:	c9                   	leave
+  800099:	c3                   	ret
+
+0080009a <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  80009a:	55                   	push   %ebp
+  80009b:	89 e5                	mov    %esp,%ebp
+  80009d:	56                   	push   %esi
+  80009e:	53                   	push   %ebx
+  80009f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8000a2:	8b 75 0c             	mov    0xc(%ebp),%esi
+	// set thisenv to point at our Env structure in envs[].
+	// LAB 3: Your code here.
+	thisenv = &envs[ENVX(sys_getenvid())];
+  8000a5:	e8 9c 0a 00 00       	call   800b46 <sys_getenvid>
+  8000aa:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8000af:	69 c0 8c 00 00 00    	imul   $0x8c,%eax,%eax
+  8000b5:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8000ba:	a3 00 50 80 00       	mov    %eax,0x805000
+
+	// save the name of the program so that panic() can use it
+	if (argc > 0)
+  8000bf:	85 db                	test   %ebx,%ebx
+  8000c1:	7e 07                	jle    8000ca <libmain+0x30>
+		binaryname = argv[0];
+  8000c3:	8b 06                	mov    (%esi),%eax
+  8000c5:	a3 00 40 80 00       	mov    %eax,0x804000
+
+	// call user main routine
+	umain(argc, argv);
+  8000ca:	83 ec 08             	sub    $0x8,%esp
+  8000cd:	56                   	push   %esi
+  8000ce:	53                   	push   %ebx
+  8000cf:	e8 5f ff ff ff       	call   800033 <umain>
+
+	// exit gracefully
+	exit();
+  8000d4:	e8 0a 00 00 00       	call   8000e3 <exit>
+}
+  8000d9:	83 c4 10             	add    $0x10,%esp
+  8000dc:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8000df:	5b                   	pop    %ebx
+  8000e0:	5e                   	pop    %esi
+  8000e1:	5d                   	pop    %ebp
+  8000e2:	c3                   	ret
+
+008000e3 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  8000e3:	55                   	push   %ebp
+  8000e4:	89 e5                	mov    %esp,%ebp
+  8000e6:	83 ec 08             	sub    $0x8,%esp
+	close_all();
+  8000e9:	e8 73 10 00 00       	call   801161 <close_all>
+	sys_env_destroy(0);
+  8000ee:	83 ec 0c             	sub    $0xc,%esp
+  8000f1:	6a 00                	push   $0x0
+  8000f3:	e8 05 0a 00 00       	call   800afd <sys_env_destroy>
+}
+  8000f8:	83 c4 10             	add    $0x10,%esp
+  8000fb:	c9                   	leave
+  8000fc:	c3                   	ret
+
+008000fd <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  8000fd:	55                   	push   %ebp
+  8000fe:	89 e5                	mov    %esp,%ebp
+  800100:	53                   	push   %ebx
+  800101:	83 ec 04             	sub    $0x4,%esp
+  800104:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	b->buf[b->idx++] = ch;
+  800107:	8b 13                	mov    (%ebx),%edx
+  800109:	8d 42 01             	lea    0x1(%edx),%eax
+  80010c:	89 03                	mov    %eax,(%ebx)
+  80010e:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800111:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+	if (b->idx == 256-1) {
+  800115:	3d ff 00 00 00       	cmp    $0xff,%eax
+  80011a:	74 09                	je     800125 <putch+0x28>
+		sys_cputs(b->buf, b->idx);
+		b->idx = 0;
+	}
+	b->cnt++;
+  80011c:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  800120:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800123:	c9                   	leave
+  800124:	c3                   	ret
+		sys_cputs(b->buf, b->idx);
+  800125:	83 ec 08             	sub    $0x8,%esp
+  800128:	68 ff 00 00 00       	push   $0xff
+  80012d:	8d 43 08             	lea    0x8(%ebx),%eax
+  800130:	50                   	push   %eax
+  800131:	e8 7a 09 00 00       	call   800ab0 <sys_cputs>
+		b->idx = 0;
+  800136:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  80013c:	83 c4 10             	add    $0x10,%esp
+  80013f:	eb db                	jmp    80011c <putch+0x1f>
+
+00800141 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  800141:	55                   	push   %ebp
+  800142:	89 e5                	mov    %esp,%ebp
+  800144:	81 ec 18 01 00 00    	sub    $0x118,%esp
+	struct printbuf b;
+
+	b.idx = 0;
+  80014a:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  800151:	00 00 00 
+	b.cnt = 0;
+  800154:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  80015b:	00 00 00 
+	vprintfmt((void*)putch, &b, fmt, ap);
+  80015e:	ff 75 0c             	push   0xc(%ebp)
+  800161:	ff 75 08             	push   0x8(%ebp)
+  800164:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  80016a:	50                   	push   %eax
+  80016b:	68 fd 00 80 00       	push   $0x8000fd
+  800170:	e8 14 01 00 00       	call   800289 <vprintfmt>
+	sys_cputs(b.buf, b.idx);
+  800175:	83 c4 08             	add    $0x8,%esp
+  800178:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  80017e:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  800184:	50                   	push   %eax
+  800185:	e8 26 09 00 00       	call   800ab0 <sys_cputs>
+
+	return b.cnt;
+}
+  80018a:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800190:	c9                   	leave
+  800191:	c3                   	ret
+
+00800192 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  800192:	55                   	push   %ebp
+  800193:	89 e5                	mov    %esp,%ebp
+  800195:	83 ec 10             	sub    $0x10,%esp
+	va_list ap;
+	int cnt;
+
+	va_start(ap, fmt);
+  800198:	8d 45 0c             	lea    0xc(%ebp),%eax
+	cnt = vcprintf(fmt, ap);
+  80019b:	50                   	push   %eax
+  80019c:	ff 75 08             	push   0x8(%ebp)
+  80019f:	e8 9d ff ff ff       	call   800141 <vcprintf>
+	va_end(ap);
+
+	return cnt;
+}
+  8001a4:	c9                   	leave
+  8001a5:	c3                   	ret
+
+008001a6 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+	 unsigned long long num, unsigned base, int width, int padc)
+{
+  8001a6:	55                   	push   %ebp
+  8001a7:	89 e5                	mov    %esp,%ebp
+  8001a9:	57                   	push   %edi
+  8001aa:	56                   	push   %esi
+  8001ab:	53                   	push   %ebx
+  8001ac:	83 ec 1c             	sub    $0x1c,%esp
+  8001af:	89 c7                	mov    %eax,%edi
+  8001b1:	89 d6                	mov    %edx,%esi
+  8001b3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8001b6:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8001b9:	89 d1                	mov    %edx,%ecx
+  8001bb:	89 c2                	mov    %eax,%edx
+  8001bd:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8001c0:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8001c3:	8b 45 10             	mov    0x10(%ebp),%eax
+  8001c6:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	// first recursively print all preceding (more significant) digits
+	if (num >= base) {
+  8001c9:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8001cc:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8001d3:	39 c2                	cmp    %eax,%edx
+  8001d5:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  8001d8:	72 3e                	jb     800218 <printnum+0x72>
+		printnum(putch, putdat, num / base, base, width - 1, padc);
+  8001da:	83 ec 0c             	sub    $0xc,%esp
+  8001dd:	ff 75 18             	push   0x18(%ebp)
+  8001e0:	83 eb 01             	sub    $0x1,%ebx
+  8001e3:	53                   	push   %ebx
+  8001e4:	50                   	push   %eax
+  8001e5:	83 ec 08             	sub    $0x8,%esp
+  8001e8:	ff 75 e4             	push   -0x1c(%ebp)
+  8001eb:	ff 75 e0             	push   -0x20(%ebp)
+  8001ee:	ff 75 dc             	push   -0x24(%ebp)
+  8001f1:	ff 75 d8             	push   -0x28(%ebp)
+  8001f4:	e8 37 34 00 00       	call   803630 <__udivdi3>
+  8001f9:	83 c4 18             	add    $0x18,%esp
+  8001fc:	52                   	push   %edx
+  8001fd:	50                   	push   %eax
+  8001fe:	89 f2                	mov    %esi,%edx
+  800200:	89 f8                	mov    %edi,%eax
+  800202:	e8 9f ff ff ff       	call   8001a6 <printnum>
+  800207:	83 c4 20             	add    $0x20,%esp
+  80020a:	eb 13                	jmp    80021f <printnum+0x79>
+	} else {
+		// print any needed pad characters before first digit
+		while (--width > 0)
+			putch(padc, putdat);
+  80020c:	83 ec 08             	sub    $0x8,%esp
+  80020f:	56                   	push   %esi
+  800210:	ff 75 18             	push   0x18(%ebp)
+  800213:	ff d7                	call   *%edi
+  800215:	83 c4 10             	add    $0x10,%esp
+		while (--width > 0)
+  800218:	83 eb 01             	sub    $0x1,%ebx
+  80021b:	85 db                	test   %ebx,%ebx
+  80021d:	7f ed                	jg     80020c <printnum+0x66>
+	}
+
+	// then print this (the least significant) digit
+	putch("0123456789abcdef"[num % base], putdat);
+  80021f:	83 ec 08             	sub    $0x8,%esp
+  800222:	56                   	push   %esi
+  800223:	83 ec 04             	sub    $0x4,%esp
+  800226:	ff 75 e4             	push   -0x1c(%ebp)
+  800229:	ff 75 e0             	push   -0x20(%ebp)
+  80022c:	ff 75 dc             	push   -0x24(%ebp)
+  80022f:	ff 75 d8             	push   -0x28(%ebp)
+  800232:	e8 17 34 00 00       	call   80364e <__umoddi3>
+  800237:	83 c4 14             	add    $0x14,%esp
+  80023a:	0f be 80 15 38 80 00 	movsbl 0x803815(%eax),%eax
+  800241:	50                   	push   %eax
+  800242:	ff d7                	call   *%edi
+}
+  800244:	83 c4 10             	add    $0x10,%esp
+  800247:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80024a:	5b                   	pop    %ebx
+  80024b:	5e                   	pop    %esi
+  80024c:	5f                   	pop    %edi
+  80024d:	5d                   	pop    %ebp
+  80024e:	c3                   	ret
+
+0080024f <sprintputch>:
+	int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  80024f:	55                   	push   %ebp
+  800250:	89 e5                	mov    %esp,%ebp
+  800252:	8b 45 0c             	mov    0xc(%ebp),%eax
+	b->cnt++;
+  800255:	83 40 08 01          	addl   $0x1,0x8(%eax)
+	if (b->buf < b->ebuf)
+  800259:	8b 10                	mov    (%eax),%edx
+  80025b:	3b 50 04             	cmp    0x4(%eax),%edx
+  80025e:	73 0a                	jae    80026a <sprintputch+0x1b>
+		*b->buf++ = ch;
+  800260:	8d 4a 01             	lea    0x1(%edx),%ecx
+  800263:	89 08                	mov    %ecx,(%eax)
+  800265:	8b 45 08             	mov    0x8(%ebp),%eax
+  800268:	88 02                	mov    %al,(%edx)
+}
+  80026a:	5d                   	pop    %ebp
+  80026b:	c3                   	ret
+
+0080026c <printfmt>:
+{
+  80026c:	55                   	push   %ebp
+  80026d:	89 e5                	mov    %esp,%ebp
+  80026f:	83 ec 08             	sub    $0x8,%esp
+	va_start(ap, fmt);
+  800272:	8d 45 14             	lea    0x14(%ebp),%eax
+	vprintfmt(putch, putdat, fmt, ap);
+  800275:	50                   	push   %eax
+  800276:	ff 75 10             	push   0x10(%ebp)
+  800279:	ff 75 0c             	push   0xc(%ebp)
+  80027c:	ff 75 08             	push   0x8(%ebp)
+  80027f:	e8 05 00 00 00       	call   800289 <vprintfmt>
+}
+  800284:	83 c4 10             	add    $0x10,%esp
+  800287:	c9                   	leave
+  800288:	c3                   	ret
+
+00800289 <vprintfmt>:
+{
+  800289:	55                   	push   %ebp
+  80028a:	89 e5                	mov    %esp,%ebp
+  80028c:	57                   	push   %edi
+  80028d:	56                   	push   %esi
+  80028e:	53                   	push   %ebx
+  80028f:	83 ec 2c             	sub    $0x2c,%esp
+  800292:	8b 75 08             	mov    0x8(%ebp),%esi
+  800295:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800298:	8b 7d 10             	mov    0x10(%ebp),%edi
+  80029b:	eb 0a                	jmp    8002a7 <vprintfmt+0x1e>
+			putch(ch, putdat);
+  80029d:	83 ec 08             	sub    $0x8,%esp
+  8002a0:	53                   	push   %ebx
+  8002a1:	50                   	push   %eax
+  8002a2:	ff d6                	call   *%esi
+  8002a4:	83 c4 10             	add    $0x10,%esp
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  8002a7:	83 c7 01             	add    $0x1,%edi
+  8002aa:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  8002ae:	83 f8 25             	cmp    $0x25,%eax
+  8002b1:	74 0c                	je     8002bf <vprintfmt+0x36>
+			if (ch == '\0')
+  8002b3:	85 c0                	test   %eax,%eax
+  8002b5:	75 e6                	jne    80029d <vprintfmt+0x14>
+}
+  8002b7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8002ba:	5b                   	pop    %ebx
+  8002bb:	5e                   	pop    %esi
+  8002bc:	5f                   	pop    %edi
+  8002bd:	5d                   	pop    %ebp
+  8002be:	c3                   	ret
+		padc = ' ';
+  8002bf:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+		altflag = 0;
+  8002c3:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+		precision = -1;
+  8002ca:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+		width = -1;
+  8002d1:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+		lflag = 0;
+  8002d8:	b9 00 00 00 00       	mov    $0x0,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  8002dd:	8d 47 01             	lea    0x1(%edi),%eax
+  8002e0:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8002e3:	0f b6 17             	movzbl (%edi),%edx
+  8002e6:	8d 42 dd             	lea    -0x23(%edx),%eax
+  8002e9:	3c 55                	cmp    $0x55,%al
+  8002eb:	0f 87 cf 03 00 00    	ja     8006c0 <vprintfmt+0x437>
+  8002f1:	0f b6 c0             	movzbl %al,%eax
+  8002f4:	ff 24 85 80 39 80 00 	jmp    *0x803980(,%eax,4)
+  8002fb:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			padc = '-';
+  8002fe:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  800302:	eb d9                	jmp    8002dd <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  800304:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800307:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  80030b:	eb d0                	jmp    8002dd <vprintfmt+0x54>
+  80030d:	0f b6 d2             	movzbl %dl,%edx
+  800310:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			for (precision = 0; ; ++fmt) {
+  800313:	b8 00 00 00 00       	mov    $0x0,%eax
+  800318:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+				precision = precision * 10 + ch - '0';
+  80031b:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  80031e:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+				ch = *fmt;
+  800322:	0f be 17             	movsbl (%edi),%edx
+				if (ch < '0' || ch > '9')
+  800325:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  800328:	83 f9 09             	cmp    $0x9,%ecx
+  80032b:	77 55                	ja     800382 <vprintfmt+0xf9>
+			for (precision = 0; ; ++fmt) {
+  80032d:	83 c7 01             	add    $0x1,%edi
+				precision = precision * 10 + ch - '0';
+  800330:	eb e9                	jmp    80031b <vprintfmt+0x92>
+			precision = va_arg(ap, int);
+  800332:	8b 45 14             	mov    0x14(%ebp),%eax
+  800335:	8b 00                	mov    (%eax),%eax
+  800337:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80033a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80033d:	8d 40 04             	lea    0x4(%eax),%eax
+  800340:	89 45 14             	mov    %eax,0x14(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  800343:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			if (width < 0)
+  800346:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  80034a:	79 91                	jns    8002dd <vprintfmt+0x54>
+				width = precision, precision = -1;
+  80034c:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  80034f:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800352:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  800359:	eb 82                	jmp    8002dd <vprintfmt+0x54>
+			if (width < 0)
+  80035b:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  80035e:	85 d2                	test   %edx,%edx
+  800360:	b8 00 00 00 00       	mov    $0x0,%eax
+  800365:	0f 49 c2             	cmovns %edx,%eax
+  800368:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		switch (ch = *(unsigned char *) fmt++) {
+  80036b:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  80036e:	e9 6a ff ff ff       	jmp    8002dd <vprintfmt+0x54>
+		switch (ch = *(unsigned char *) fmt++) {
+  800373:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			altflag = 1;
+  800376:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+			goto reswitch;
+  80037d:	e9 5b ff ff ff       	jmp    8002dd <vprintfmt+0x54>
+  800382:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800385:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800388:	eb bc                	jmp    800346 <vprintfmt+0xbd>
+			lflag++;
+  80038a:	83 c1 01             	add    $0x1,%ecx
+		switch (ch = *(unsigned char *) fmt++) {
+  80038d:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+			goto reswitch;
+  800390:	e9 48 ff ff ff       	jmp    8002dd <vprintfmt+0x54>
+			putch(va_arg(ap, int), putdat);
+  800395:	8b 45 14             	mov    0x14(%ebp),%eax
+  800398:	8d 78 04             	lea    0x4(%eax),%edi
+  80039b:	83 ec 08             	sub    $0x8,%esp
+  80039e:	53                   	push   %ebx
+  80039f:	ff 30                	push   (%eax)
+  8003a1:	ff d6                	call   *%esi
+			break;
+  8003a3:	83 c4 10             	add    $0x10,%esp
+			putch(va_arg(ap, int), putdat);
+  8003a6:	89 7d 14             	mov    %edi,0x14(%ebp)
+			break;
+  8003a9:	e9 b1 02 00 00       	jmp    80065f <vprintfmt+0x3d6>
+			err = va_arg(ap, int);
+  8003ae:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003b1:	8d 78 04             	lea    0x4(%eax),%edi
+			if (err < 0)
+  8003b4:	8b 10                	mov    (%eax),%edx
+  8003b6:	89 d0                	mov    %edx,%eax
+  8003b8:	f7 d8                	neg    %eax
+  8003ba:	0f 48 c2             	cmovs  %edx,%eax
+			if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  8003bd:	83 f8 11             	cmp    $0x11,%eax
+  8003c0:	7f 23                	jg     8003e5 <vprintfmt+0x15c>
+  8003c2:	8b 14 85 e0 3a 80 00 	mov    0x803ae0(,%eax,4),%edx
+  8003c9:	85 d2                	test   %edx,%edx
+  8003cb:	74 18                	je     8003e5 <vprintfmt+0x15c>
+				printfmt(putch, putdat, "%s", p);
+  8003cd:	52                   	push   %edx
+  8003ce:	68 32 3c 80 00       	push   $0x803c32
+  8003d3:	53                   	push   %ebx
+  8003d4:	56                   	push   %esi
+  8003d5:	e8 92 fe ff ff       	call   80026c <printfmt>
+  8003da:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8003dd:	89 7d 14             	mov    %edi,0x14(%ebp)
+  8003e0:	e9 7a 02 00 00       	jmp    80065f <vprintfmt+0x3d6>
+				printfmt(putch, putdat, "error %d", err);
+  8003e5:	50                   	push   %eax
+  8003e6:	68 2d 38 80 00       	push   $0x80382d
+  8003eb:	53                   	push   %ebx
+  8003ec:	56                   	push   %esi
+  8003ed:	e8 7a fe ff ff       	call   80026c <printfmt>
+  8003f2:	83 c4 10             	add    $0x10,%esp
+			err = va_arg(ap, int);
+  8003f5:	89 7d 14             	mov    %edi,0x14(%ebp)
+				printfmt(putch, putdat, "error %d", err);
+  8003f8:	e9 62 02 00 00       	jmp    80065f <vprintfmt+0x3d6>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8003fd:	8b 45 14             	mov    0x14(%ebp),%eax
+  800400:	83 c0 04             	add    $0x4,%eax
+  800403:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  800406:	8b 45 14             	mov    0x14(%ebp),%eax
+  800409:	8b 08                	mov    (%eax),%ecx
+				p = "(null)";
+  80040b:	85 c9                	test   %ecx,%ecx
+  80040d:	b8 26 38 80 00       	mov    $0x803826,%eax
+  800412:	0f 45 c1             	cmovne %ecx,%eax
+  800415:	89 45 cc             	mov    %eax,-0x34(%ebp)
+			if (width > 0 && padc != '-')
+  800418:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  80041c:	7e 06                	jle    800424 <vprintfmt+0x19b>
+  80041e:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  800422:	75 0b                	jne    80042f <vprintfmt+0x1a6>
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800424:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  800427:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  80042a:	89 75 08             	mov    %esi,0x8(%ebp)
+  80042d:	eb 5c                	jmp    80048b <vprintfmt+0x202>
+  80042f:	83 ec 08             	sub    $0x8,%esp
+  800432:	ff 75 d0             	push   -0x30(%ebp)
+  800435:	ff 75 cc             	push   -0x34(%ebp)
+  800438:	e8 20 03 00 00       	call   80075d <strnlen>
+  80043d:	89 c2                	mov    %eax,%edx
+  80043f:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800442:	29 d0                	sub    %edx,%eax
+  800444:	83 c4 10             	add    $0x10,%esp
+					putch(padc, putdat);
+  800447:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  80044b:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80044e:	89 75 08             	mov    %esi,0x8(%ebp)
+  800451:	89 c6                	mov    %eax,%esi
+				for (width -= strnlen(p, precision); width > 0; width--)
+  800453:	eb 0e                	jmp    800463 <vprintfmt+0x1da>
+					putch(padc, putdat);
+  800455:	83 ec 08             	sub    $0x8,%esp
+  800458:	53                   	push   %ebx
+  800459:	57                   	push   %edi
+  80045a:	ff 55 08             	call   *0x8(%ebp)
+				for (width -= strnlen(p, precision); width > 0; width--)
+  80045d:	83 ee 01             	sub    $0x1,%esi
+  800460:	83 c4 10             	add    $0x10,%esp
+  800463:	85 f6                	test   %esi,%esi
+  800465:	7f ee                	jg     800455 <vprintfmt+0x1cc>
+  800467:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80046a:	8b 75 08             	mov    0x8(%ebp),%esi
+  80046d:	85 c0                	test   %eax,%eax
+  80046f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800474:	0f 49 d0             	cmovns %eax,%edx
+  800477:	29 d0                	sub    %edx,%eax
+  800479:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80047c:	eb a6                	jmp    800424 <vprintfmt+0x19b>
+					putch(ch, putdat);
+  80047e:	83 ec 08             	sub    $0x8,%esp
+  800481:	53                   	push   %ebx
+  800482:	52                   	push   %edx
+  800483:	ff 55 08             	call   *0x8(%ebp)
+  800486:	83 c4 10             	add    $0x10,%esp
+			for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800489:	89 f1                	mov    %esi,%ecx
+  80048b:	8d 71 01             	lea    0x1(%ecx),%esi
+  80048e:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800492:	0f be d0             	movsbl %al,%edx
+  800495:	85 d2                	test   %edx,%edx
+  800497:	74 28                	je     8004c1 <vprintfmt+0x238>
+  800499:	85 ff                	test   %edi,%edi
+  80049b:	78 05                	js     8004a2 <vprintfmt+0x219>
+  80049d:	83 ef 01             	sub    $0x1,%edi
+  8004a0:	78 30                	js     8004d2 <vprintfmt+0x249>
+				if (altflag && (ch < ' ' || ch > '~'))
+  8004a2:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  8004a6:	74 d6                	je     80047e <vprintfmt+0x1f5>
+  8004a8:	0f be c0             	movsbl %al,%eax
+  8004ab:	83 e8 20             	sub    $0x20,%eax
+  8004ae:	83 f8 5e             	cmp    $0x5e,%eax
+  8004b1:	76 cb                	jbe    80047e <vprintfmt+0x1f5>
+					putch('?', putdat);
+  8004b3:	83 ec 08             	sub    $0x8,%esp
+  8004b6:	53                   	push   %ebx
+  8004b7:	6a 3f                	push   $0x3f
+  8004b9:	ff 55 08             	call   *0x8(%ebp)
+  8004bc:	83 c4 10             	add    $0x10,%esp
+  8004bf:	eb c8                	jmp    800489 <vprintfmt+0x200>
+  8004c1:	8b 75 08             	mov    0x8(%ebp),%esi
+  8004c4:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8004c7:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8004ca:	01 d0                	add    %edx,%eax
+  8004cc:	29 c8                	sub    %ecx,%eax
+  8004ce:	89 c7                	mov    %eax,%edi
+  8004d0:	eb 13                	jmp    8004e5 <vprintfmt+0x25c>
+  8004d2:	8b 75 08             	mov    0x8(%ebp),%esi
+  8004d5:	eb ed                	jmp    8004c4 <vprintfmt+0x23b>
+				putch(' ', putdat);
+  8004d7:	83 ec 08             	sub    $0x8,%esp
+  8004da:	53                   	push   %ebx
+  8004db:	6a 20                	push   $0x20
+  8004dd:	ff d6                	call   *%esi
+			for (; width > 0; width--)
+  8004df:	83 ef 01             	sub    $0x1,%edi
+  8004e2:	83 c4 10             	add    $0x10,%esp
+  8004e5:	85 ff                	test   %edi,%edi
+  8004e7:	7f ee                	jg     8004d7 <vprintfmt+0x24e>
+			if ((p = va_arg(ap, char *)) == NULL)
+  8004e9:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  8004ec:	89 45 14             	mov    %eax,0x14(%ebp)
+  8004ef:	e9 6b 01 00 00       	jmp    80065f <vprintfmt+0x3d6>
+	if (lflag >= 2)
+  8004f4:	83 f9 01             	cmp    $0x1,%ecx
+  8004f7:	7f 1f                	jg     800518 <vprintfmt+0x28f>
+	else if (lflag)
+  8004f9:	85 c9                	test   %ecx,%ecx
+  8004fb:	74 67                	je     800564 <vprintfmt+0x2db>
+		return va_arg(*ap, long);
+  8004fd:	8b 45 14             	mov    0x14(%ebp),%eax
+  800500:	8b 00                	mov    (%eax),%eax
+  800502:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800505:	89 c1                	mov    %eax,%ecx
+  800507:	c1 f9 1f             	sar    $0x1f,%ecx
+  80050a:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80050d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800510:	8d 40 04             	lea    0x4(%eax),%eax
+  800513:	89 45 14             	mov    %eax,0x14(%ebp)
+  800516:	eb 17                	jmp    80052f <vprintfmt+0x2a6>
+		return va_arg(*ap, long long);
+  800518:	8b 45 14             	mov    0x14(%ebp),%eax
+  80051b:	8b 50 04             	mov    0x4(%eax),%edx
+  80051e:	8b 00                	mov    (%eax),%eax
+  800520:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800523:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800526:	8b 45 14             	mov    0x14(%ebp),%eax
+  800529:	8d 40 08             	lea    0x8(%eax),%eax
+  80052c:	89 45 14             	mov    %eax,0x14(%ebp)
+			if ((long long) num < 0) {
+  80052f:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800532:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+			base = 10;
+  800535:	bf 0a 00 00 00       	mov    $0xa,%edi
+			if ((long long) num < 0) {
+  80053a:	85 c9                	test   %ecx,%ecx
+  80053c:	0f 89 03 01 00 00    	jns    800645 <vprintfmt+0x3bc>
+				putch('-', putdat);
+  800542:	83 ec 08             	sub    $0x8,%esp
+  800545:	53                   	push   %ebx
+  800546:	6a 2d                	push   $0x2d
+  800548:	ff d6                	call   *%esi
+				num = -(long long) num;
+  80054a:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  80054d:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800550:	f7 da                	neg    %edx
+  800552:	83 d1 00             	adc    $0x0,%ecx
+  800555:	f7 d9                	neg    %ecx
+  800557:	83 c4 10             	add    $0x10,%esp
+			base = 10;
+  80055a:	bf 0a 00 00 00       	mov    $0xa,%edi
+  80055f:	e9 e1 00 00 00       	jmp    800645 <vprintfmt+0x3bc>
+		return va_arg(*ap, int);
+  800564:	8b 45 14             	mov    0x14(%ebp),%eax
+  800567:	8b 00                	mov    (%eax),%eax
+  800569:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80056c:	89 c1                	mov    %eax,%ecx
+  80056e:	c1 f9 1f             	sar    $0x1f,%ecx
+  800571:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800574:	8b 45 14             	mov    0x14(%ebp),%eax
+  800577:	8d 40 04             	lea    0x4(%eax),%eax
+  80057a:	89 45 14             	mov    %eax,0x14(%ebp)
+  80057d:	eb b0                	jmp    80052f <vprintfmt+0x2a6>
+	if (lflag >= 2)
+  80057f:	83 f9 01             	cmp    $0x1,%ecx
+  800582:	7f 1e                	jg     8005a2 <vprintfmt+0x319>
+	else if (lflag)
+  800584:	85 c9                	test   %ecx,%ecx
+  800586:	74 32                	je     8005ba <vprintfmt+0x331>
+		return va_arg(*ap, unsigned long);
+  800588:	8b 45 14             	mov    0x14(%ebp),%eax
+  80058b:	8b 10                	mov    (%eax),%edx
+  80058d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800592:	8d 40 04             	lea    0x4(%eax),%eax
+  800595:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  800598:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long);
+  80059d:	e9 a3 00 00 00       	jmp    800645 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  8005a2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005a5:	8b 10                	mov    (%eax),%edx
+  8005a7:	8b 48 04             	mov    0x4(%eax),%ecx
+  8005aa:	8d 40 08             	lea    0x8(%eax),%eax
+  8005ad:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8005b0:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned long long);
+  8005b5:	e9 8b 00 00 00       	jmp    800645 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  8005ba:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005bd:	8b 10                	mov    (%eax),%edx
+  8005bf:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8005c4:	8d 40 04             	lea    0x4(%eax),%eax
+  8005c7:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 10;
+  8005ca:	bf 0a 00 00 00       	mov    $0xa,%edi
+		return va_arg(*ap, unsigned int);
+  8005cf:	eb 74                	jmp    800645 <vprintfmt+0x3bc>
+	if (lflag >= 2)
+  8005d1:	83 f9 01             	cmp    $0x1,%ecx
+  8005d4:	7f 1b                	jg     8005f1 <vprintfmt+0x368>
+	else if (lflag)
+  8005d6:	85 c9                	test   %ecx,%ecx
+  8005d8:	74 2c                	je     800606 <vprintfmt+0x37d>
+		return va_arg(*ap, unsigned long);
+  8005da:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005dd:	8b 10                	mov    (%eax),%edx
+  8005df:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8005e4:	8d 40 04             	lea    0x4(%eax),%eax
+  8005e7:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8005ea:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long);
+  8005ef:	eb 54                	jmp    800645 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  8005f1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005f4:	8b 10                	mov    (%eax),%edx
+  8005f6:	8b 48 04             	mov    0x4(%eax),%ecx
+  8005f9:	8d 40 08             	lea    0x8(%eax),%eax
+  8005fc:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  8005ff:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned long long);
+  800604:	eb 3f                	jmp    800645 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  800606:	8b 45 14             	mov    0x14(%ebp),%eax
+  800609:	8b 10                	mov    (%eax),%edx
+  80060b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800610:	8d 40 04             	lea    0x4(%eax),%eax
+  800613:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 8;
+  800616:	bf 08 00 00 00       	mov    $0x8,%edi
+		return va_arg(*ap, unsigned int);
+  80061b:	eb 28                	jmp    800645 <vprintfmt+0x3bc>
+			putch('0', putdat);
+  80061d:	83 ec 08             	sub    $0x8,%esp
+  800620:	53                   	push   %ebx
+  800621:	6a 30                	push   $0x30
+  800623:	ff d6                	call   *%esi
+			putch('x', putdat);
+  800625:	83 c4 08             	add    $0x8,%esp
+  800628:	53                   	push   %ebx
+  800629:	6a 78                	push   $0x78
+  80062b:	ff d6                	call   *%esi
+			num = (unsigned long long)
+  80062d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800630:	8b 10                	mov    (%eax),%edx
+  800632:	b9 00 00 00 00       	mov    $0x0,%ecx
+			goto number;
+  800637:	83 c4 10             	add    $0x10,%esp
+				(uintptr_t) va_arg(ap, void *);
+  80063a:	8d 40 04             	lea    0x4(%eax),%eax
+  80063d:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800640:	bf 10 00 00 00       	mov    $0x10,%edi
+			printnum(putch, putdat, num, base, width, padc);
+  800645:	83 ec 0c             	sub    $0xc,%esp
+  800648:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  80064c:	50                   	push   %eax
+  80064d:	ff 75 e0             	push   -0x20(%ebp)
+  800650:	57                   	push   %edi
+  800651:	51                   	push   %ecx
+  800652:	52                   	push   %edx
+  800653:	89 da                	mov    %ebx,%edx
+  800655:	89 f0                	mov    %esi,%eax
+  800657:	e8 4a fb ff ff       	call   8001a6 <printnum>
+			break;
+  80065c:	83 c4 20             	add    $0x20,%esp
+			err = va_arg(ap, int);
+  80065f:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+		while ((ch = *(unsigned char *) fmt++) != '%') {
+  800662:	e9 40 fc ff ff       	jmp    8002a7 <vprintfmt+0x1e>
+	if (lflag >= 2)
+  800667:	83 f9 01             	cmp    $0x1,%ecx
+  80066a:	7f 1b                	jg     800687 <vprintfmt+0x3fe>
+	else if (lflag)
+  80066c:	85 c9                	test   %ecx,%ecx
+  80066e:	74 2c                	je     80069c <vprintfmt+0x413>
+		return va_arg(*ap, unsigned long);
+  800670:	8b 45 14             	mov    0x14(%ebp),%eax
+  800673:	8b 10                	mov    (%eax),%edx
+  800675:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80067a:	8d 40 04             	lea    0x4(%eax),%eax
+  80067d:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800680:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long);
+  800685:	eb be                	jmp    800645 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned long long);
+  800687:	8b 45 14             	mov    0x14(%ebp),%eax
+  80068a:	8b 10                	mov    (%eax),%edx
+  80068c:	8b 48 04             	mov    0x4(%eax),%ecx
+  80068f:	8d 40 08             	lea    0x8(%eax),%eax
+  800692:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  800695:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned long long);
+  80069a:	eb a9                	jmp    800645 <vprintfmt+0x3bc>
+		return va_arg(*ap, unsigned int);
+  80069c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80069f:	8b 10                	mov    (%eax),%edx
+  8006a1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006a6:	8d 40 04             	lea    0x4(%eax),%eax
+  8006a9:	89 45 14             	mov    %eax,0x14(%ebp)
+			base = 16;
+  8006ac:	bf 10 00 00 00       	mov    $0x10,%edi
+		return va_arg(*ap, unsigned int);
+  8006b1:	eb 92                	jmp    800645 <vprintfmt+0x3bc>
+			putch(ch, putdat);
+  8006b3:	83 ec 08             	sub    $0x8,%esp
+  8006b6:	53                   	push   %ebx
+  8006b7:	6a 25                	push   $0x25
+  8006b9:	ff d6                	call   *%esi
+			break;
+  8006bb:	83 c4 10             	add    $0x10,%esp
+  8006be:	eb 9f                	jmp    80065f <vprintfmt+0x3d6>
+			putch('%', putdat);
+  8006c0:	83 ec 08             	sub    $0x8,%esp
+  8006c3:	53                   	push   %ebx
+  8006c4:	6a 25                	push   $0x25
+  8006c6:	ff d6                	call   *%esi
+			for (fmt--; fmt[-1] != '%'; fmt--)
+  8006c8:	83 c4 10             	add    $0x10,%esp
+  8006cb:	89 f8                	mov    %edi,%eax
+  8006cd:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  8006d1:	74 05                	je     8006d8 <vprintfmt+0x44f>
+  8006d3:	83 e8 01             	sub    $0x1,%eax
+  8006d6:	eb f5                	jmp    8006cd <vprintfmt+0x444>
+  8006d8:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8006db:	eb 82                	jmp    80065f <vprintfmt+0x3d6>
+
+008006dd <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  8006dd:	55                   	push   %ebp
+  8006de:	89 e5                	mov    %esp,%ebp
+  8006e0:	83 ec 18             	sub    $0x18,%esp
+  8006e3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8006e6:	8b 55 0c             	mov    0xc(%ebp),%edx
+	struct sprintbuf b = {buf, buf+n-1, 0};
+  8006e9:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  8006ec:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  8006f0:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  8006f3:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+	if (buf == NULL || n < 1)
+  8006fa:	85 c0                	test   %eax,%eax
+  8006fc:	74 26                	je     800724 <vsnprintf+0x47>
+  8006fe:	85 d2                	test   %edx,%edx
+  800700:	7e 22                	jle    800724 <vsnprintf+0x47>
+		return -E_INVAL;
+
+	// print the string to the buffer
+	vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800702:	ff 75 14             	push   0x14(%ebp)
+  800705:	ff 75 10             	push   0x10(%ebp)
+  800708:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  80070b:	50                   	push   %eax
+  80070c:	68 4f 02 80 00       	push   $0x80024f
+  800711:	e8 73 fb ff ff       	call   800289 <vprintfmt>
+
+	// null terminate the buffer
+	*b.buf = '\0';
+  800716:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800719:	c6 00 00             	movb   $0x0,(%eax)
+
+	return b.cnt;
+  80071c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80071f:	83 c4 10             	add    $0x10,%esp
+}
+  800722:	c9                   	leave
+  800723:	c3                   	ret
+		return -E_INVAL;
+  800724:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800729:	eb f7                	jmp    800722 <vsnprintf+0x45>
+
+0080072b <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  80072b:	55                   	push   %ebp
+  80072c:	89 e5                	mov    %esp,%ebp
+  80072e:	83 ec 08             	sub    $0x8,%esp
+	va_list ap;
+	int rc;
+
+	va_start(ap, fmt);
+  800731:	8d 45 14             	lea    0x14(%ebp),%eax
+	rc = vsnprintf(buf, n, fmt, ap);
+  800734:	50                   	push   %eax
+  800735:	ff 75 10             	push   0x10(%ebp)
+  800738:	ff 75 0c             	push   0xc(%ebp)
+  80073b:	ff 75 08             	push   0x8(%ebp)
+  80073e:	e8 9a ff ff ff       	call   8006dd <vsnprintf>
+	va_end(ap);
+
+	return rc;
+}
+  800743:	c9                   	leave
+  800744:	c3                   	ret
+
+00800745 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800745:	55                   	push   %ebp
+  800746:	89 e5                	mov    %esp,%ebp
+  800748:	8b 55 08             	mov    0x8(%ebp),%edx
+	int n;
+
+	for (n = 0; *s != '\0'; s++)
+  80074b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800750:	eb 03                	jmp    800755 <strlen+0x10>
+		n++;
+  800752:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; *s != '\0'; s++)
+  800755:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800759:	75 f7                	jne    800752 <strlen+0xd>
+	return n;
+}
+  80075b:	5d                   	pop    %ebp
+  80075c:	c3                   	ret
+
+0080075d <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  80075d:	55                   	push   %ebp
+  80075e:	89 e5                	mov    %esp,%ebp
+  800760:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int n;
+
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800763:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800766:	b8 00 00 00 00       	mov    $0x0,%eax
+  80076b:	eb 03                	jmp    800770 <strnlen+0x13>
+		n++;
+  80076d:	83 c0 01             	add    $0x1,%eax
+	for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800770:	39 d0                	cmp    %edx,%eax
+  800772:	74 08                	je     80077c <strnlen+0x1f>
+  800774:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800778:	75 f3                	jne    80076d <strnlen+0x10>
+  80077a:	89 c2                	mov    %eax,%edx
+	return n;
+}
+  80077c:	89 d0                	mov    %edx,%eax
+  80077e:	5d                   	pop    %ebp
+  80077f:	c3                   	ret
+
+00800780 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800780:	55                   	push   %ebp
+  800781:	89 e5                	mov    %esp,%ebp
+  800783:	53                   	push   %ebx
+  800784:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800787:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	char *ret;
+
+	ret = dst;
+	while ((*dst++ = *src++) != '\0')
+  80078a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80078f:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800793:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800796:	83 c0 01             	add    $0x1,%eax
+  800799:	84 d2                	test   %dl,%dl
+  80079b:	75 f2                	jne    80078f <strcpy+0xf>
+		/* do nothing */;
+	return ret;
+}
+  80079d:	89 c8                	mov    %ecx,%eax
+  80079f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8007a2:	c9                   	leave
+  8007a3:	c3                   	ret
+
+008007a4 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  8007a4:	55                   	push   %ebp
+  8007a5:	89 e5                	mov    %esp,%ebp
+  8007a7:	53                   	push   %ebx
+  8007a8:	83 ec 10             	sub    $0x10,%esp
+  8007ab:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int len = strlen(dst);
+  8007ae:	53                   	push   %ebx
+  8007af:	e8 91 ff ff ff       	call   800745 <strlen>
+  8007b4:	83 c4 08             	add    $0x8,%esp
+	strcpy(dst + len, src);
+  8007b7:	ff 75 0c             	push   0xc(%ebp)
+  8007ba:	01 d8                	add    %ebx,%eax
+  8007bc:	50                   	push   %eax
+  8007bd:	e8 be ff ff ff       	call   800780 <strcpy>
+	return dst;
+}
+  8007c2:	89 d8                	mov    %ebx,%eax
+  8007c4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8007c7:	c9                   	leave
+  8007c8:	c3                   	ret
+
+008007c9 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  8007c9:	55                   	push   %ebp
+  8007ca:	89 e5                	mov    %esp,%ebp
+  8007cc:	56                   	push   %esi
+  8007cd:	53                   	push   %ebx
+  8007ce:	8b 75 08             	mov    0x8(%ebp),%esi
+  8007d1:	8b 55 0c             	mov    0xc(%ebp),%edx
+	size_t i;
+	char *ret;
+
+	ret = dst;
+	for (i = 0; i < size; i++) {
+  8007d4:	89 f3                	mov    %esi,%ebx
+  8007d6:	03 5d 10             	add    0x10(%ebp),%ebx
+  8007d9:	89 f0                	mov    %esi,%eax
+  8007db:	eb 0f                	jmp    8007ec <strncpy+0x23>
+		*dst++ = *src;
+  8007dd:	83 c0 01             	add    $0x1,%eax
+  8007e0:	0f b6 0a             	movzbl (%edx),%ecx
+  8007e3:	88 48 ff             	mov    %cl,-0x1(%eax)
+		// If strlen(src) < size, null-pad 'dst' out to 'size' chars
+		if (*src != '\0')
+			src++;
+  8007e6:	80 f9 01             	cmp    $0x1,%cl
+  8007e9:	83 da ff             	sbb    $0xffffffff,%edx
+	for (i = 0; i < size; i++) {
+  8007ec:	39 d8                	cmp    %ebx,%eax
+  8007ee:	75 ed                	jne    8007dd <strncpy+0x14>
+	}
+	return ret;
+}
+  8007f0:	89 f0                	mov    %esi,%eax
+  8007f2:	5b                   	pop    %ebx
+  8007f3:	5e                   	pop    %esi
+  8007f4:	5d                   	pop    %ebp
+  8007f5:	c3                   	ret
+
+008007f6 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  8007f6:	55                   	push   %ebp
+  8007f7:	89 e5                	mov    %esp,%ebp
+  8007f9:	56                   	push   %esi
+  8007fa:	53                   	push   %ebx
+  8007fb:	8b 75 08             	mov    0x8(%ebp),%esi
+  8007fe:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800801:	8b 55 10             	mov    0x10(%ebp),%edx
+	char *dst_in;
+
+	dst_in = dst;
+	if (size > 0) {
+  800804:	89 f0                	mov    %esi,%eax
+  800806:	85 d2                	test   %edx,%edx
+  800808:	74 21                	je     80082b <strlcpy+0x35>
+  80080a:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  80080e:	89 f2                	mov    %esi,%edx
+  800810:	eb 09                	jmp    80081b <strlcpy+0x25>
+		while (--size > 0 && *src != '\0')
+			*dst++ = *src++;
+  800812:	83 c1 01             	add    $0x1,%ecx
+  800815:	83 c2 01             	add    $0x1,%edx
+  800818:	88 5a ff             	mov    %bl,-0x1(%edx)
+		while (--size > 0 && *src != '\0')
+  80081b:	39 c2                	cmp    %eax,%edx
+  80081d:	74 09                	je     800828 <strlcpy+0x32>
+  80081f:	0f b6 19             	movzbl (%ecx),%ebx
+  800822:	84 db                	test   %bl,%bl
+  800824:	75 ec                	jne    800812 <strlcpy+0x1c>
+  800826:	89 d0                	mov    %edx,%eax
+		*dst = '\0';
+  800828:	c6 00 00             	movb   $0x0,(%eax)
+	}
+	return dst - dst_in;
+  80082b:	29 f0                	sub    %esi,%eax
+}
+  80082d:	5b                   	pop    %ebx
+  80082e:	5e                   	pop    %esi
+  80082f:	5d                   	pop    %ebp
+  800830:	c3                   	ret
+
+00800831 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800831:	55                   	push   %ebp
+  800832:	89 e5                	mov    %esp,%ebp
+  800834:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800837:	8b 55 0c             	mov    0xc(%ebp),%edx
+	while (*p && *p == *q)
+  80083a:	eb 06                	jmp    800842 <strcmp+0x11>
+		p++, q++;
+  80083c:	83 c1 01             	add    $0x1,%ecx
+  80083f:	83 c2 01             	add    $0x1,%edx
+	while (*p && *p == *q)
+  800842:	0f b6 01             	movzbl (%ecx),%eax
+  800845:	84 c0                	test   %al,%al
+  800847:	74 04                	je     80084d <strcmp+0x1c>
+  800849:	3a 02                	cmp    (%edx),%al
+  80084b:	74 ef                	je     80083c <strcmp+0xb>
+	return (int) ((unsigned char) *p - (unsigned char) *q);
+  80084d:	0f b6 c0             	movzbl %al,%eax
+  800850:	0f b6 12             	movzbl (%edx),%edx
+  800853:	29 d0                	sub    %edx,%eax
+}
+  800855:	5d                   	pop    %ebp
+  800856:	c3                   	ret
+
+00800857 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800857:	55                   	push   %ebp
+  800858:	89 e5                	mov    %esp,%ebp
+  80085a:	53                   	push   %ebx
+  80085b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80085e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800861:	8b 55 10             	mov    0x10(%ebp),%edx
+	while (n > 0 && *p && *p == *q)
+  800864:	eb 09                	jmp    80086f <strncmp+0x18>
+		n--, p++, q++;
+  800866:	83 ea 01             	sub    $0x1,%edx
+  800869:	83 c0 01             	add    $0x1,%eax
+  80086c:	83 c1 01             	add    $0x1,%ecx
+	while (n > 0 && *p && *p == *q)
+  80086f:	85 d2                	test   %edx,%edx
+  800871:	74 18                	je     80088b <strncmp+0x34>
+  800873:	0f b6 18             	movzbl (%eax),%ebx
+  800876:	84 db                	test   %bl,%bl
+  800878:	74 04                	je     80087e <strncmp+0x27>
+  80087a:	3a 19                	cmp    (%ecx),%bl
+  80087c:	74 e8                	je     800866 <strncmp+0xf>
+	if (n == 0)
+		return 0;
+	else
+		return (int) ((unsigned char) *p - (unsigned char) *q);
+  80087e:	0f b6 00             	movzbl (%eax),%eax
+  800881:	0f b6 11             	movzbl (%ecx),%edx
+  800884:	29 d0                	sub    %edx,%eax
+}
+  800886:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800889:	c9                   	leave
+  80088a:	c3                   	ret
+		return 0;
+  80088b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800890:	eb f4                	jmp    800886 <strncmp+0x2f>
+
+00800892 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800892:	55                   	push   %ebp
+  800893:	89 e5                	mov    %esp,%ebp
+  800895:	8b 45 08             	mov    0x8(%ebp),%eax
+  800898:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  80089c:	eb 03                	jmp    8008a1 <strchr+0xf>
+  80089e:	83 c0 01             	add    $0x1,%eax
+  8008a1:	0f b6 10             	movzbl (%eax),%edx
+  8008a4:	84 d2                	test   %dl,%dl
+  8008a6:	74 06                	je     8008ae <strchr+0x1c>
+		if (*s == c)
+  8008a8:	38 ca                	cmp    %cl,%dl
+  8008aa:	75 f2                	jne    80089e <strchr+0xc>
+  8008ac:	eb 05                	jmp    8008b3 <strchr+0x21>
+			return (char *) s;
+	return 0;
+  8008ae:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8008b3:	5d                   	pop    %ebp
+  8008b4:	c3                   	ret
+
+008008b5 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  8008b5:	55                   	push   %ebp
+  8008b6:	89 e5                	mov    %esp,%ebp
+  8008b8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8008bb:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+	for (; *s; s++)
+  8008bf:	0f b6 10             	movzbl (%eax),%edx
+		if (*s == c)
+  8008c2:	38 ca                	cmp    %cl,%dl
+  8008c4:	74 09                	je     8008cf <strfind+0x1a>
+  8008c6:	84 d2                	test   %dl,%dl
+  8008c8:	74 05                	je     8008cf <strfind+0x1a>
+	for (; *s; s++)
+  8008ca:	83 c0 01             	add    $0x1,%eax
+  8008cd:	eb f0                	jmp    8008bf <strfind+0xa>
+			break;
+	return (char *) s;
+}
+  8008cf:	5d                   	pop    %ebp
+  8008d0:	c3                   	ret
+
+008008d1 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  8008d1:	55                   	push   %ebp
+  8008d2:	89 e5                	mov    %esp,%ebp
+  8008d4:	57                   	push   %edi
+  8008d5:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8008d8:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	char *p;
+
+	if (n == 0)
+  8008db:	85 c9                	test   %ecx,%ecx
+  8008dd:	74 20                	je     8008ff <memset+0x2e>
+		return v;
+	if ((int)v%4 == 0 && n%4 == 0) {
+  8008df:	89 f8                	mov    %edi,%eax
+  8008e1:	09 c8                	or     %ecx,%eax
+  8008e3:	a8 03                	test   $0x3,%al
+  8008e5:	75 12                	jne    8008f9 <memset+0x28>
+		c &= 0xFF;
+  8008e7:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  8008eb:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+		c = (c<<24)|(c<<16)|(c<<8)|c;
+		asm volatile("cld; rep stosl\n"
+			:: "D" (v), "a" (c), "c" (n/4)
+  8008f1:	c1 e9 02             	shr    $0x2,%ecx
+		asm volatile("cld; rep stosl\n"
+  8008f4:	fc                   	cld
+  8008f5:	f3 ab                	rep stos %eax,%es:(%edi)
+  8008f7:	eb 06                	jmp    8008ff <memset+0x2e>
+			: "cc", "memory");
+	} else
+		asm volatile("cld; rep stosb\n"
+  8008f9:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8008fc:	fc                   	cld
+  8008fd:	f3 aa                	rep stos %al,%es:(%edi)
+			:: "D" (v), "a" (c), "c" (n)
+			: "cc", "memory");
+	return v;
+}
+  8008ff:	89 f8                	mov    %edi,%eax
+  800901:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800904:	c9                   	leave
+  800905:	c3                   	ret
+
+00800906 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800906:	55                   	push   %ebp
+  800907:	89 e5                	mov    %esp,%ebp
+  800909:	57                   	push   %edi
+  80090a:	56                   	push   %esi
+  80090b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80090e:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800911:	8b 4d 10             	mov    0x10(%ebp),%ecx
+	const char *s;
+	char *d;
+
+	s = src;
+	d = dst;
+	if (s < d && s + n > d) {
+  800914:	39 c6                	cmp    %eax,%esi
+  800916:	73 32                	jae    80094a <memmove+0x44>
+  800918:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  80091b:	39 d0                	cmp    %edx,%eax
+  80091d:	73 2b                	jae    80094a <memmove+0x44>
+		s += n;
+		d += n;
+  80091f:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800922:	89 d6                	mov    %edx,%esi
+  800924:	09 fe                	or     %edi,%esi
+  800926:	09 ce                	or     %ecx,%esi
+  800928:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  80092e:	75 0e                	jne    80093e <memmove+0x38>
+			asm volatile("std; rep movsl\n"
+				:: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800930:	83 ef 04             	sub    $0x4,%edi
+  800933:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800936:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("std; rep movsl\n"
+  800939:	fd                   	std
+  80093a:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  80093c:	eb 09                	jmp    800947 <memmove+0x41>
+		else
+			asm volatile("std; rep movsb\n"
+				:: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  80093e:	83 ef 01             	sub    $0x1,%edi
+  800941:	8d 72 ff             	lea    -0x1(%edx),%esi
+			asm volatile("std; rep movsb\n"
+  800944:	fd                   	std
+  800945:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+		// Some versions of GCC rely on DF being clear
+		asm volatile("cld" ::: "cc");
+  800947:	fc                   	cld
+  800948:	eb 1a                	jmp    800964 <memmove+0x5e>
+	} else {
+		if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  80094a:	89 f2                	mov    %esi,%edx
+  80094c:	09 c2                	or     %eax,%edx
+  80094e:	09 ca                	or     %ecx,%edx
+  800950:	f6 c2 03             	test   $0x3,%dl
+  800953:	75 0a                	jne    80095f <memmove+0x59>
+			asm volatile("cld; rep movsl\n"
+				:: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800955:	c1 e9 02             	shr    $0x2,%ecx
+			asm volatile("cld; rep movsl\n"
+  800958:	89 c7                	mov    %eax,%edi
+  80095a:	fc                   	cld
+  80095b:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  80095d:	eb 05                	jmp    800964 <memmove+0x5e>
+		else
+			asm volatile("cld; rep movsb\n"
+  80095f:	89 c7                	mov    %eax,%edi
+  800961:	fc                   	cld
+  800962:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+				:: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+	}
+	return dst;
+}
+  800964:	5e                   	pop    %esi
+  800965:	5f                   	pop    %edi
+  800966:	5d                   	pop    %ebp
+  800967:	c3                   	ret
+
+00800968 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800968:	55                   	push   %ebp
+  800969:	89 e5                	mov    %esp,%ebp
+  80096b:	83 ec 0c             	sub    $0xc,%esp
+	return memmove(dst, src, n);
+  80096e:	ff 75 10             	push   0x10(%ebp)
+  800971:	ff 75 0c             	push   0xc(%ebp)
+  800974:	ff 75 08             	push   0x8(%ebp)
+  800977:	e8 8a ff ff ff       	call   800906 <memmove>
+}
+  80097c:	c9                   	leave
+  80097d:	c3                   	ret
+
+0080097e <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  80097e:	55                   	push   %ebp
+  80097f:	89 e5                	mov    %esp,%ebp
+  800981:	56                   	push   %esi
+  800982:	53                   	push   %ebx
+  800983:	8b 45 08             	mov    0x8(%ebp),%eax
+  800986:	8b 55 0c             	mov    0xc(%ebp),%edx
+	const uint8_t *s1 = (const uint8_t *) v1;
+	const uint8_t *s2 = (const uint8_t *) v2;
+
+	while (n-- > 0) {
+  800989:	89 c6                	mov    %eax,%esi
+  80098b:	03 75 10             	add    0x10(%ebp),%esi
+  80098e:	eb 06                	jmp    800996 <memcmp+0x18>
+		if (*s1 != *s2)
+			return (int) *s1 - (int) *s2;
+		s1++, s2++;
+  800990:	83 c0 01             	add    $0x1,%eax
+  800993:	83 c2 01             	add    $0x1,%edx
+	while (n-- > 0) {
+  800996:	39 f0                	cmp    %esi,%eax
+  800998:	74 14                	je     8009ae <memcmp+0x30>
+		if (*s1 != *s2)
+  80099a:	0f b6 08             	movzbl (%eax),%ecx
+  80099d:	0f b6 1a             	movzbl (%edx),%ebx
+  8009a0:	38 d9                	cmp    %bl,%cl
+  8009a2:	74 ec                	je     800990 <memcmp+0x12>
+			return (int) *s1 - (int) *s2;
+  8009a4:	0f b6 c1             	movzbl %cl,%eax
+  8009a7:	0f b6 db             	movzbl %bl,%ebx
+  8009aa:	29 d8                	sub    %ebx,%eax
+  8009ac:	eb 05                	jmp    8009b3 <memcmp+0x35>
+	}
+
+	return 0;
+  8009ae:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8009b3:	5b                   	pop    %ebx
+  8009b4:	5e                   	pop    %esi
+  8009b5:	5d                   	pop    %ebp
+  8009b6:	c3                   	ret
+
+008009b7 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  8009b7:	55                   	push   %ebp
+  8009b8:	89 e5                	mov    %esp,%ebp
+  8009ba:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009bd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	const void *ends = (const char *) s + n;
+  8009c0:	89 c2                	mov    %eax,%edx
+  8009c2:	03 55 10             	add    0x10(%ebp),%edx
+	for (; s < ends; s++)
+  8009c5:	eb 03                	jmp    8009ca <memfind+0x13>
+  8009c7:	83 c0 01             	add    $0x1,%eax
+  8009ca:	39 d0                	cmp    %edx,%eax
+  8009cc:	73 04                	jae    8009d2 <memfind+0x1b>
+		if (*(const unsigned char *) s == (unsigned char) c)
+  8009ce:	38 08                	cmp    %cl,(%eax)
+  8009d0:	75 f5                	jne    8009c7 <memfind+0x10>
+			break;
+	return (void *) s;
+}
+  8009d2:	5d                   	pop    %ebp
+  8009d3:	c3                   	ret
+
+008009d4 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  8009d4:	55                   	push   %ebp
+  8009d5:	89 e5                	mov    %esp,%ebp
+  8009d7:	57                   	push   %edi
+  8009d8:	56                   	push   %esi
+  8009d9:	53                   	push   %ebx
+  8009da:	8b 55 08             	mov    0x8(%ebp),%edx
+  8009dd:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int neg = 0;
+	long val = 0;
+
+	// gobble initial whitespace
+	while (*s == ' ' || *s == '\t')
+  8009e0:	eb 03                	jmp    8009e5 <strtol+0x11>
+		s++;
+  8009e2:	83 c2 01             	add    $0x1,%edx
+	while (*s == ' ' || *s == '\t')
+  8009e5:	0f b6 02             	movzbl (%edx),%eax
+  8009e8:	3c 20                	cmp    $0x20,%al
+  8009ea:	74 f6                	je     8009e2 <strtol+0xe>
+  8009ec:	3c 09                	cmp    $0x9,%al
+  8009ee:	74 f2                	je     8009e2 <strtol+0xe>
+
+	// plus/minus sign
+	if (*s == '+')
+  8009f0:	3c 2b                	cmp    $0x2b,%al
+  8009f2:	74 2a                	je     800a1e <strtol+0x4a>
+	int neg = 0;
+  8009f4:	bf 00 00 00 00       	mov    $0x0,%edi
+		s++;
+	else if (*s == '-')
+  8009f9:	3c 2d                	cmp    $0x2d,%al
+  8009fb:	74 2b                	je     800a28 <strtol+0x54>
+		s++, neg = 1;
+
+	// hex or octal base prefix
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  8009fd:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800a03:	75 0f                	jne    800a14 <strtol+0x40>
+  800a05:	80 3a 30             	cmpb   $0x30,(%edx)
+  800a08:	74 28                	je     800a32 <strtol+0x5e>
+		s += 2, base = 16;
+	else if (base == 0 && s[0] == '0')
+		s++, base = 8;
+	else if (base == 0)
+		base = 10;
+  800a0a:	85 db                	test   %ebx,%ebx
+  800a0c:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800a11:	0f 44 d8             	cmove  %eax,%ebx
+  800a14:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800a19:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800a1c:	eb 46                	jmp    800a64 <strtol+0x90>
+		s++;
+  800a1e:	83 c2 01             	add    $0x1,%edx
+	int neg = 0;
+  800a21:	bf 00 00 00 00       	mov    $0x0,%edi
+  800a26:	eb d5                	jmp    8009fd <strtol+0x29>
+		s++, neg = 1;
+  800a28:	83 c2 01             	add    $0x1,%edx
+  800a2b:	bf 01 00 00 00       	mov    $0x1,%edi
+  800a30:	eb cb                	jmp    8009fd <strtol+0x29>
+	if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800a32:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800a36:	74 0e                	je     800a46 <strtol+0x72>
+	else if (base == 0 && s[0] == '0')
+  800a38:	85 db                	test   %ebx,%ebx
+  800a3a:	75 d8                	jne    800a14 <strtol+0x40>
+		s++, base = 8;
+  800a3c:	83 c2 01             	add    $0x1,%edx
+  800a3f:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800a44:	eb ce                	jmp    800a14 <strtol+0x40>
+		s += 2, base = 16;
+  800a46:	83 c2 02             	add    $0x2,%edx
+  800a49:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800a4e:	eb c4                	jmp    800a14 <strtol+0x40>
+	// digits
+	while (1) {
+		int dig;
+
+		if (*s >= '0' && *s <= '9')
+			dig = *s - '0';
+  800a50:	0f be c0             	movsbl %al,%eax
+  800a53:	83 e8 30             	sub    $0x30,%eax
+			dig = *s - 'a' + 10;
+		else if (*s >= 'A' && *s <= 'Z')
+			dig = *s - 'A' + 10;
+		else
+			break;
+		if (dig >= base)
+  800a56:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800a59:	7d 3a                	jge    800a95 <strtol+0xc1>
+			break;
+		s++, val = (val * base) + dig;
+  800a5b:	83 c2 01             	add    $0x1,%edx
+  800a5e:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800a62:	01 c1                	add    %eax,%ecx
+		if (*s >= '0' && *s <= '9')
+  800a64:	0f b6 02             	movzbl (%edx),%eax
+  800a67:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800a6a:	89 f3                	mov    %esi,%ebx
+  800a6c:	80 fb 09             	cmp    $0x9,%bl
+  800a6f:	76 df                	jbe    800a50 <strtol+0x7c>
+		else if (*s >= 'a' && *s <= 'z')
+  800a71:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800a74:	89 f3                	mov    %esi,%ebx
+  800a76:	80 fb 19             	cmp    $0x19,%bl
+  800a79:	77 08                	ja     800a83 <strtol+0xaf>
+			dig = *s - 'a' + 10;
+  800a7b:	0f be c0             	movsbl %al,%eax
+  800a7e:	83 e8 57             	sub    $0x57,%eax
+  800a81:	eb d3                	jmp    800a56 <strtol+0x82>
+		else if (*s >= 'A' && *s <= 'Z')
+  800a83:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800a86:	89 f3                	mov    %esi,%ebx
+  800a88:	80 fb 19             	cmp    $0x19,%bl
+  800a8b:	77 08                	ja     800a95 <strtol+0xc1>
+			dig = *s - 'A' + 10;
+  800a8d:	0f be c0             	movsbl %al,%eax
+  800a90:	83 e8 37             	sub    $0x37,%eax
+  800a93:	eb c1                	jmp    800a56 <strtol+0x82>
+		// we don't properly detect overflow!
+	}
+
+	if (endptr)
+  800a95:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800a99:	74 05                	je     800aa0 <strtol+0xcc>
+		*endptr = (char *) s;
+  800a9b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800a9e:	89 10                	mov    %edx,(%eax)
+	return (neg ? -val : val);
+  800aa0:	89 c8                	mov    %ecx,%eax
+  800aa2:	f7 d8                	neg    %eax
+  800aa4:	85 ff                	test   %edi,%edi
+  800aa6:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800aa9:	89 c8                	mov    %ecx,%eax
+  800aab:	5b                   	pop    %ebx
+  800aac:	5e                   	pop    %esi
+  800aad:	5f                   	pop    %edi
+  800aae:	5d                   	pop    %ebp
+  800aaf:	c3                   	ret
+
+00800ab0 <sys_cputs>:
+	return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800ab0:	55                   	push   %ebp
+  800ab1:	89 e5                	mov    %esp,%ebp
+  800ab3:	57                   	push   %edi
+  800ab4:	56                   	push   %esi
+  800ab5:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800ab6:	b8 00 00 00 00       	mov    $0x0,%eax
+  800abb:	8b 55 08             	mov    0x8(%ebp),%edx
+  800abe:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ac1:	89 c3                	mov    %eax,%ebx
+  800ac3:	89 c7                	mov    %eax,%edi
+  800ac5:	55                   	push   %ebp
+  800ac6:	89 e5                	mov    %esp,%ebp
+  800ac8:	8d 35 d0 0a 80 00    	lea    0x800ad0,%esi
+  800ace:	0f 34                	sysenter
+  800ad0:	5d                   	pop    %ebp
+	syscall2(SYS_cputs, 0, (uint32_t)s, len, 0, 0);
+}
+  800ad1:	5b                   	pop    %ebx
+  800ad2:	5e                   	pop    %esi
+  800ad3:	5f                   	pop    %edi
+  800ad4:	5d                   	pop    %ebp
+  800ad5:	c3                   	ret
+
+00800ad6 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800ad6:	55                   	push   %ebp
+  800ad7:	89 e5                	mov    %esp,%ebp
+  800ad9:	57                   	push   %edi
+  800ada:	56                   	push   %esi
+  800adb:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800adc:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ae1:	b8 01 00 00 00       	mov    $0x1,%eax
+  800ae6:	89 d1                	mov    %edx,%ecx
+  800ae8:	89 d3                	mov    %edx,%ebx
+  800aea:	89 d7                	mov    %edx,%edi
+  800aec:	55                   	push   %ebp
+  800aed:	89 e5                	mov    %esp,%ebp
+  800aef:	8d 35 f7 0a 80 00    	lea    0x800af7,%esi
+  800af5:	0f 34                	sysenter
+  800af7:	5d                   	pop    %ebp
+	return syscall2(SYS_cgetc, 0, 0, 0, 0, 0);
+}
+  800af8:	5b                   	pop    %ebx
+  800af9:	5e                   	pop    %esi
+  800afa:	5f                   	pop    %edi
+  800afb:	5d                   	pop    %ebp
+  800afc:	c3                   	ret
+
+00800afd <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800afd:	55                   	push   %ebp
+  800afe:	89 e5                	mov    %esp,%ebp
+  800b00:	57                   	push   %edi
+  800b01:	56                   	push   %esi
+  800b02:	53                   	push   %ebx
+  800b03:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800b06:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b0b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b0e:	b8 03 00 00 00       	mov    $0x3,%eax
+  800b13:	89 cb                	mov    %ecx,%ebx
+  800b15:	89 cf                	mov    %ecx,%edi
+  800b17:	55                   	push   %ebp
+  800b18:	89 e5                	mov    %esp,%ebp
+  800b1a:	8d 35 22 0b 80 00    	lea    0x800b22,%esi
+  800b20:	0f 34                	sysenter
+  800b22:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800b23:	85 c0                	test   %eax,%eax
+  800b25:	7f 08                	jg     800b2f <sys_env_destroy+0x32>
+	return syscall2(SYS_env_destroy, 1, envid, 0, 0, 0);
+}
+  800b27:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800b2a:	5b                   	pop    %ebx
+  800b2b:	5e                   	pop    %esi
+  800b2c:	5f                   	pop    %edi
+  800b2d:	5d                   	pop    %ebp
+  800b2e:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800b2f:	83 ec 0c             	sub    $0xc,%esp
+  800b32:	50                   	push   %eax
+  800b33:	6a 03                	push   $0x3
+  800b35:	68 47 3b 80 00       	push   $0x803b47
+  800b3a:	6a 3d                	push   $0x3d
+  800b3c:	68 64 3b 80 00       	push   $0x803b64
+  800b41:	e8 02 24 00 00       	call   802f48 <_panic>
+
+00800b46 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800b46:	55                   	push   %ebp
+  800b47:	89 e5                	mov    %esp,%ebp
+  800b49:	57                   	push   %edi
+  800b4a:	56                   	push   %esi
+  800b4b:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800b4c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b51:	b8 02 00 00 00       	mov    $0x2,%eax
+  800b56:	89 d1                	mov    %edx,%ecx
+  800b58:	89 d3                	mov    %edx,%ebx
+  800b5a:	89 d7                	mov    %edx,%edi
+  800b5c:	55                   	push   %ebp
+  800b5d:	89 e5                	mov    %esp,%ebp
+  800b5f:	8d 35 67 0b 80 00    	lea    0x800b67,%esi
+  800b65:	0f 34                	sysenter
+  800b67:	5d                   	pop    %ebp
+	 return syscall2(SYS_getenvid, 0, 0, 0, 0, 0);
+}
+  800b68:	5b                   	pop    %ebx
+  800b69:	5e                   	pop    %esi
+  800b6a:	5f                   	pop    %edi
+  800b6b:	5d                   	pop    %ebp
+  800b6c:	c3                   	ret
+
+00800b6d <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800b6d:	55                   	push   %ebp
+  800b6e:	89 e5                	mov    %esp,%ebp
+  800b70:	57                   	push   %edi
+  800b71:	56                   	push   %esi
+  800b72:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800b73:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b78:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800b7d:	89 d1                	mov    %edx,%ecx
+  800b7f:	89 d3                	mov    %edx,%ebx
+  800b81:	89 d7                	mov    %edx,%edi
+  800b83:	89 d6                	mov    %edx,%esi
+  800b85:	cd 30                	int    $0x30
+	syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800b87:	5b                   	pop    %ebx
+  800b88:	5e                   	pop    %esi
+  800b89:	5f                   	pop    %edi
+  800b8a:	5d                   	pop    %ebp
+  800b8b:	c3                   	ret
+
+00800b8c <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800b8c:	55                   	push   %ebp
+  800b8d:	89 e5                	mov    %esp,%ebp
+  800b8f:	57                   	push   %edi
+  800b90:	56                   	push   %esi
+  800b91:	53                   	push   %ebx
+  800b92:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800b95:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b98:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800b9b:	b8 04 00 00 00       	mov    $0x4,%eax
+  800ba0:	bf 00 00 00 00       	mov    $0x0,%edi
+  800ba5:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800ba8:	55                   	push   %ebp
+  800ba9:	89 e5                	mov    %esp,%ebp
+  800bab:	8d 35 b3 0b 80 00    	lea    0x800bb3,%esi
+  800bb1:	0f 34                	sysenter
+  800bb3:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800bb4:	85 c0                	test   %eax,%eax
+  800bb6:	7f 08                	jg     800bc0 <sys_page_alloc+0x34>
+	return syscall2(SYS_page_alloc, 1, envid, (uint32_t) va, perm, 0);
+}
+  800bb8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800bbb:	5b                   	pop    %ebx
+  800bbc:	5e                   	pop    %esi
+  800bbd:	5f                   	pop    %edi
+  800bbe:	5d                   	pop    %ebp
+  800bbf:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800bc0:	83 ec 0c             	sub    $0xc,%esp
+  800bc3:	50                   	push   %eax
+  800bc4:	6a 04                	push   $0x4
+  800bc6:	68 47 3b 80 00       	push   $0x803b47
+  800bcb:	6a 3d                	push   $0x3d
+  800bcd:	68 64 3b 80 00       	push   $0x803b64
+  800bd2:	e8 71 23 00 00       	call   802f48 <_panic>
+
+00800bd7 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800bd7:	55                   	push   %ebp
+  800bd8:	89 e5                	mov    %esp,%ebp
+  800bda:	57                   	push   %edi
+  800bdb:	56                   	push   %esi
+  800bdc:	53                   	push   %ebx
+  800bdd:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800be0:	8b 55 08             	mov    0x8(%ebp),%edx
+  800be3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800be6:	b8 05 00 00 00       	mov    $0x5,%eax
+  800beb:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800bee:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800bf1:	8b 75 18             	mov    0x18(%ebp),%esi
+  800bf4:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800bf6:	85 c0                	test   %eax,%eax
+  800bf8:	7f 08                	jg     800c02 <sys_page_map+0x2b>
+	return syscall(SYS_page_map, 1, srcenv, (uint32_t) srcva, dstenv, (uint32_t) dstva, perm);
+}
+  800bfa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800bfd:	5b                   	pop    %ebx
+  800bfe:	5e                   	pop    %esi
+  800bff:	5f                   	pop    %edi
+  800c00:	5d                   	pop    %ebp
+  800c01:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800c02:	83 ec 0c             	sub    $0xc,%esp
+  800c05:	50                   	push   %eax
+  800c06:	6a 05                	push   $0x5
+  800c08:	68 47 3b 80 00       	push   $0x803b47
+  800c0d:	6a 23                	push   $0x23
+  800c0f:	68 64 3b 80 00       	push   $0x803b64
+  800c14:	e8 2f 23 00 00       	call   802f48 <_panic>
+
+00800c19 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800c19:	55                   	push   %ebp
+  800c1a:	89 e5                	mov    %esp,%ebp
+  800c1c:	57                   	push   %edi
+  800c1d:	56                   	push   %esi
+  800c1e:	53                   	push   %ebx
+  800c1f:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800c22:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800c27:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c2a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c2d:	b8 06 00 00 00       	mov    $0x6,%eax
+  800c32:	89 df                	mov    %ebx,%edi
+  800c34:	55                   	push   %ebp
+  800c35:	89 e5                	mov    %esp,%ebp
+  800c37:	8d 35 3f 0c 80 00    	lea    0x800c3f,%esi
+  800c3d:	0f 34                	sysenter
+  800c3f:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800c40:	85 c0                	test   %eax,%eax
+  800c42:	7f 08                	jg     800c4c <sys_page_unmap+0x33>
+	return syscall2(SYS_page_unmap, 1, envid, (uint32_t) va, 0, 0);
+}
+  800c44:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c47:	5b                   	pop    %ebx
+  800c48:	5e                   	pop    %esi
+  800c49:	5f                   	pop    %edi
+  800c4a:	5d                   	pop    %ebp
+  800c4b:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800c4c:	83 ec 0c             	sub    $0xc,%esp
+  800c4f:	50                   	push   %eax
+  800c50:	6a 06                	push   $0x6
+  800c52:	68 47 3b 80 00       	push   $0x803b47
+  800c57:	6a 3d                	push   $0x3d
+  800c59:	68 64 3b 80 00       	push   $0x803b64
+  800c5e:	e8 e5 22 00 00       	call   802f48 <_panic>
+
+00800c63 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800c63:	55                   	push   %ebp
+  800c64:	89 e5                	mov    %esp,%ebp
+  800c66:	57                   	push   %edi
+  800c67:	56                   	push   %esi
+  800c68:	53                   	push   %ebx
+  800c69:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800c6c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800c71:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c74:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c77:	b8 08 00 00 00       	mov    $0x8,%eax
+  800c7c:	89 df                	mov    %ebx,%edi
+  800c7e:	55                   	push   %ebp
+  800c7f:	89 e5                	mov    %esp,%ebp
+  800c81:	8d 35 89 0c 80 00    	lea    0x800c89,%esi
+  800c87:	0f 34                	sysenter
+  800c89:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800c8a:	85 c0                	test   %eax,%eax
+  800c8c:	7f 08                	jg     800c96 <sys_env_set_status+0x33>
+	return syscall2(SYS_env_set_status, 1, envid, status, 0, 0);
+}
+  800c8e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c91:	5b                   	pop    %ebx
+  800c92:	5e                   	pop    %esi
+  800c93:	5f                   	pop    %edi
+  800c94:	5d                   	pop    %ebp
+  800c95:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800c96:	83 ec 0c             	sub    $0xc,%esp
+  800c99:	50                   	push   %eax
+  800c9a:	6a 08                	push   $0x8
+  800c9c:	68 47 3b 80 00       	push   $0x803b47
+  800ca1:	6a 3d                	push   $0x3d
+  800ca3:	68 64 3b 80 00       	push   $0x803b64
+  800ca8:	e8 9b 22 00 00       	call   802f48 <_panic>
+
+00800cad <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  800cad:	55                   	push   %ebp
+  800cae:	89 e5                	mov    %esp,%ebp
+  800cb0:	57                   	push   %edi
+  800cb1:	56                   	push   %esi
+  800cb2:	53                   	push   %ebx
+  800cb3:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800cb6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800cbb:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cbe:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800cc1:	b8 09 00 00 00       	mov    $0x9,%eax
+  800cc6:	89 df                	mov    %ebx,%edi
+  800cc8:	55                   	push   %ebp
+  800cc9:	89 e5                	mov    %esp,%ebp
+  800ccb:	8d 35 d3 0c 80 00    	lea    0x800cd3,%esi
+  800cd1:	0f 34                	sysenter
+  800cd3:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800cd4:	85 c0                	test   %eax,%eax
+  800cd6:	7f 08                	jg     800ce0 <sys_env_set_trapframe+0x33>
+	return syscall2(SYS_env_set_trapframe, 1, envid, (uint32_t) tf, 0, 0);
+}
+  800cd8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800cdb:	5b                   	pop    %ebx
+  800cdc:	5e                   	pop    %esi
+  800cdd:	5f                   	pop    %edi
+  800cde:	5d                   	pop    %ebp
+  800cdf:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800ce0:	83 ec 0c             	sub    $0xc,%esp
+  800ce3:	50                   	push   %eax
+  800ce4:	6a 09                	push   $0x9
+  800ce6:	68 47 3b 80 00       	push   $0x803b47
+  800ceb:	6a 3d                	push   $0x3d
+  800ced:	68 64 3b 80 00       	push   $0x803b64
+  800cf2:	e8 51 22 00 00       	call   802f48 <_panic>
+
+00800cf7 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  800cf7:	55                   	push   %ebp
+  800cf8:	89 e5                	mov    %esp,%ebp
+  800cfa:	57                   	push   %edi
+  800cfb:	56                   	push   %esi
+  800cfc:	53                   	push   %ebx
+  800cfd:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("pushl %%ebp\n"
+  800d00:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800d05:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d08:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d0b:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800d10:	89 df                	mov    %ebx,%edi
+  800d12:	55                   	push   %ebp
+  800d13:	89 e5                	mov    %esp,%ebp
+  800d15:	8d 35 1d 0d 80 00    	lea    0x800d1d,%esi
+  800d1b:	0f 34                	sysenter
+  800d1d:	5d                   	pop    %ebp
+	if(check && ret > 0)
+  800d1e:	85 c0                	test   %eax,%eax
+  800d20:	7f 08                	jg     800d2a <sys_env_set_pgfault_upcall+0x33>
+	return syscall2(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t) upcall, 0, 0);
+}
+  800d22:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d25:	5b                   	pop    %ebx
+  800d26:	5e                   	pop    %esi
+  800d27:	5f                   	pop    %edi
+  800d28:	5d                   	pop    %ebp
+  800d29:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800d2a:	83 ec 0c             	sub    $0xc,%esp
+  800d2d:	50                   	push   %eax
+  800d2e:	6a 0a                	push   $0xa
+  800d30:	68 47 3b 80 00       	push   $0x803b47
+  800d35:	6a 3d                	push   $0x3d
+  800d37:	68 64 3b 80 00       	push   $0x803b64
+  800d3c:	e8 07 22 00 00       	call   802f48 <_panic>
+
+00800d41 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+{
+  800d41:	55                   	push   %ebp
+  800d42:	89 e5                	mov    %esp,%ebp
+  800d44:	57                   	push   %edi
+  800d45:	56                   	push   %esi
+  800d46:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800d47:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d4a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d4d:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800d52:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d55:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800d58:	55                   	push   %ebp
+  800d59:	89 e5                	mov    %esp,%ebp
+  800d5b:	8d 35 63 0d 80 00    	lea    0x800d63,%esi
+  800d61:	0f 34                	sysenter
+  800d63:	5d                   	pop    %ebp
+	return syscall2(SYS_ipc_try_send, 0, envid, value, (uint32_t) srcva, perm);
+}
+  800d64:	5b                   	pop    %ebx
+  800d65:	5e                   	pop    %esi
+  800d66:	5f                   	pop    %edi
+  800d67:	5d                   	pop    %ebp
+  800d68:	c3                   	ret
+
+00800d69 <sys_ipc_try_sendv>:
+
+int
+sys_ipc_try_sendv(envid_t envid, uint32_t value, const uintptr_t *pages, int npages)
+{
+  800d69:	55                   	push   %ebp
+  800d6a:	89 e5                	mov    %esp,%ebp
+  800d6c:	57                   	push   %edi
+  800d6d:	56                   	push   %esi
+  800d6e:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800d6f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d72:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d75:	b8 17 00 00 00       	mov    $0x17,%eax
+  800d7a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d7d:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800d80:	55                   	push   %ebp
+  800d81:	89 e5                	mov    %esp,%ebp
+  800d83:	8d 35 8b 0d 80 00    	lea    0x800d8b,%esi
+  800d89:	0f 34                	sysenter
+  800d8b:	5d                   	pop    %ebp
+	return syscall2(SYS_ipc_try_sendv, 0, envid, value, (uint32_t) pages, npages);
+}
+  800d8c:	5b                   	pop    %ebx
+  800d8d:	5e                   	pop    %esi
+  800d8e:	5f                   	pop    %edi
+  800d8f:	5d                   	pop    %ebp
+  800d90:	c3                   	ret
+
+00800d91 <sys_ipc_recvv>:
+	return sys_ipc_recvv(dstva, 1, 0);
+}
+
+int
+sys_ipc_recvv(void *dstva, int npages, int flags)
+{
+  800d91:	55                   	push   %ebp
+  800d92:	89 e5                	mov    %esp,%ebp
+  800d94:	57                   	push   %edi
+  800d95:	56                   	push   %esi
+  800d96:	53                   	push   %ebx
+  800d97:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800d9a:	be 00 00 00 00       	mov    $0x0,%esi
+  800d9f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800da2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800da5:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800daa:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800dad:	89 f7                	mov    %esi,%edi
+  800daf:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800db1:	85 c0                	test   %eax,%eax
+  800db3:	7f 08                	jg     800dbd <sys_ipc_recvv+0x2c>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npages, flags, 0, 0);
+}
+  800db5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800db8:	5b                   	pop    %ebx
+  800db9:	5e                   	pop    %esi
+  800dba:	5f                   	pop    %edi
+  800dbb:	5d                   	pop    %ebp
+  800dbc:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800dbd:	83 ec 0c             	sub    $0xc,%esp
+  800dc0:	50                   	push   %eax
+  800dc1:	6a 0d                	push   $0xd
+  800dc3:	68 47 3b 80 00       	push   $0x803b47
+  800dc8:	6a 23                	push   $0x23
+  800dca:	68 64 3b 80 00       	push   $0x803b64
+  800dcf:	e8 74 21 00 00       	call   802f48 <_panic>
+
+00800dd4 <sys_ipc_recv>:
+{
+  800dd4:	55                   	push   %ebp
+  800dd5:	89 e5                	mov    %esp,%ebp
+  800dd7:	83 ec 0c             	sub    $0xc,%esp
+	return sys_ipc_recvv(dstva, 1, 0);
+  800dda:	6a 00                	push   $0x0
+  800ddc:	6a 01                	push   $0x1
+  800dde:	ff 75 08             	push   0x8(%ebp)
+  800de1:	e8 ab ff ff ff       	call   800d91 <sys_ipc_recvv>
+}
+  800de6:	c9                   	leave
+  800de7:	c3                   	ret
+
+00800de8 <sys_ipc_recv_until>:
+
+int
+sys_ipc_recv_until(void *dstva, int npages, unsigned int deadline)
+{
+  800de8:	55                   	push   %ebp
+  800de9:	89 e5                	mov    %esp,%ebp
+  800deb:	57                   	push   %edi
+  800dec:	56                   	push   %esi
+  800ded:	53                   	push   %ebx
+  800dee:	83 ec 0c             	sub    $0xc,%esp
+	asm volatile("int %1\n"
+  800df1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800df6:	8b 55 08             	mov    0x8(%ebp),%edx
+  800df9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800dfc:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800e01:	8b 7d 10             	mov    0x10(%ebp),%edi
+  800e04:	89 de                	mov    %ebx,%esi
+  800e06:	cd 30                	int    $0x30
+	if(check && ret > 0)
+  800e08:	85 c0                	test   %eax,%eax
+  800e0a:	7f 08                	jg     800e14 <sys_ipc_recv_until+0x2c>
+	return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npages, 0, deadline, 0);
+}
+  800e0c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e0f:	5b                   	pop    %ebx
+  800e10:	5e                   	pop    %esi
+  800e11:	5f                   	pop    %edi
+  800e12:	5d                   	pop    %ebp
+  800e13:	c3                   	ret
+		panic("syscall %d returned %d (> 0)", num, ret);
+  800e14:	83 ec 0c             	sub    $0xc,%esp
+  800e17:	50                   	push   %eax
+  800e18:	6a 0d                	push   $0xd
+  800e1a:	68 47 3b 80 00       	push   $0x803b47
+  800e1f:	6a 23                	push   $0x23
+  800e21:	68 64 3b 80 00       	push   $0x803b64
+  800e26:	e8 1d 21 00 00       	call   802f48 <_panic>
+
+00800e2b <sys_time_msec>:
+
+unsigned int
+sys_time_msec(void)
+{
+  800e2b:	55                   	push   %ebp
+  800e2c:	89 e5                	mov    %esp,%ebp
+  800e2e:	57                   	push   %edi
+  800e2f:	56                   	push   %esi
+  800e30:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800e31:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e36:	b8 0e 00 00 00       	mov    $0xe,%eax
+  800e3b:	89 d1                	mov    %edx,%ecx
+  800e3d:	89 d3                	mov    %edx,%ebx
+  800e3f:	89 d7                	mov    %edx,%edi
+  800e41:	55                   	push   %ebp
+  800e42:	89 e5                	mov    %esp,%ebp
+  800e44:	8d 35 4c 0e 80 00    	lea    0x800e4c,%esi
+  800e4a:	0f 34                	sysenter
+  800e4c:	5d                   	pop    %ebp
+	return (unsigned int) syscall2(SYS_time_msec, 0, 0, 0, 0, 0);
+}
+  800e4d:	5b                   	pop    %ebx
+  800e4e:	5e                   	pop    %esi
+  800e4f:	5f                   	pop    %edi
+  800e50:	5d                   	pop    %ebp
+  800e51:	c3                   	ret
+
+00800e52 <sys_net_try_send>:
+
+size_t
+sys_net_try_send(void *packet, size_t length)
+{
+  800e52:	55                   	push   %ebp
+  800e53:	89 e5                	mov    %esp,%ebp
+  800e55:	57                   	push   %edi
+  800e56:	56                   	push   %esi
+  800e57:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800e58:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e5d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e60:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e63:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800e68:	89 df                	mov    %ebx,%edi
+  800e6a:	55                   	push   %ebp
+  800e6b:	89 e5                	mov    %esp,%ebp
+  800e6d:	8d 35 75 0e 80 00    	lea    0x800e75,%esi
+  800e73:	0f 34                	sysenter
+  800e75:	5d                   	pop    %ebp
+	return syscall2(SYS_net_try_send, 0, (uint32_t) packet, length, 0, 0);
+}
+  800e76:	5b                   	pop    %ebx
+  800e77:	5e                   	pop    %esi
+  800e78:	5f                   	pop    %edi
+  800e79:	5d                   	pop    %ebp
+  800e7a:	c3                   	ret
+
+00800e7b <sys_net_try_recv>:
+
+size_t
+sys_net_try_recv(uint8_t *buffer)
+{
+  800e7b:	55                   	push   %ebp
+  800e7c:	89 e5                	mov    %esp,%ebp
+  800e7e:	57                   	push   %edi
+  800e7f:	56                   	push   %esi
+  800e80:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800e81:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800e86:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e89:	b8 10 00 00 00       	mov    $0x10,%eax
+  800e8e:	89 cb                	mov    %ecx,%ebx
+  800e90:	89 cf                	mov    %ecx,%edi
+  800e92:	55                   	push   %ebp
+  800e93:	89 e5                	mov    %esp,%ebp
+  800e95:	8d 35 9d 0e 80 00    	lea    0x800e9d,%esi
+  800e9b:	0f 34                	sysenter
+  800e9d:	5d                   	pop    %ebp
+	return syscall2(SYS_net_try_recv, 0, (uint32_t) buffer, 0, 0, 0);
+}
+  800e9e:	5b                   	pop    %ebx
+  800e9f:	5e                   	pop    %esi
+  800ea0:	5f                   	pop    %edi
+  800ea1:	5d                   	pop    %ebp
+  800ea2:	c3                   	ret
+
+00800ea3 <sys_net_recv_pages>:
+
+int
+sys_net_recv_pages(void *dstva, int npages)
+{
+  800ea3:	55                   	push   %ebp
+  800ea4:	89 e5                	mov    %esp,%ebp
+  800ea6:	57                   	push   %edi
+  800ea7:	56                   	push   %esi
+  800ea8:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800ea9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800eae:	8b 55 08             	mov    0x8(%ebp),%edx
+  800eb1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800eb4:	b8 12 00 00 00       	mov    $0x12,%eax
+  800eb9:	89 df                	mov    %ebx,%edi
+  800ebb:	55                   	push   %ebp
+  800ebc:	89 e5                	mov    %esp,%ebp
+  800ebe:	8d 35 c6 0e 80 00    	lea    0x800ec6,%esi
+  800ec4:	0f 34                	sysenter
+  800ec6:	5d                   	pop    %ebp
+	return syscall2(SYS_net_recv_pages, 0, (uint32_t) dstva, npages, 0, 0);
+}
+  800ec7:	5b                   	pop    %ebx
+  800ec8:	5e                   	pop    %esi
+  800ec9:	5f                   	pop    %edi
+  800eca:	5d                   	pop    %ebp
+  800ecb:	c3                   	ret
+
+00800ecc <sys_net_send_batch>:
+
+int
+sys_net_send_batch(const struct net_sg *pkts, int n)
+{
+  800ecc:	55                   	push   %ebp
+  800ecd:	89 e5                	mov    %esp,%ebp
+  800ecf:	57                   	push   %edi
+  800ed0:	56                   	push   %esi
+  800ed1:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800ed2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ed7:	8b 55 08             	mov    0x8(%ebp),%edx
+  800eda:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800edd:	b8 14 00 00 00       	mov    $0x14,%eax
+  800ee2:	89 df                	mov    %ebx,%edi
+  800ee4:	55                   	push   %ebp
+  800ee5:	89 e5                	mov    %esp,%ebp
+  800ee7:	8d 35 ef 0e 80 00    	lea    0x800eef,%esi
+  800eed:	0f 34                	sysenter
+  800eef:	5d                   	pop    %ebp
+	return syscall2(SYS_net_send_batch, 0, (uint32_t) pkts, n, 0, 0);
+}
+  800ef0:	5b                   	pop    %ebx
+  800ef1:	5e                   	pop    %esi
+  800ef2:	5f                   	pop    %edi
+  800ef3:	5d                   	pop    %ebp
+  800ef4:	c3                   	ret
+
+00800ef5 <sys_net_send_sg>:
+
+int
+sys_net_send_sg(const struct net_sg *sg, int nsg,
+		const struct net_offload *off, struct net_txinfo *info)
+{
+  800ef5:	55                   	push   %ebp
+  800ef6:	89 e5                	mov    %esp,%ebp
+  800ef8:	57                   	push   %edi
+  800ef9:	56                   	push   %esi
+  800efa:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800efb:	8b 55 08             	mov    0x8(%ebp),%edx
+  800efe:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f01:	b8 13 00 00 00       	mov    $0x13,%eax
+  800f06:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f09:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800f0c:	55                   	push   %ebp
+  800f0d:	89 e5                	mov    %esp,%ebp
+  800f0f:	8d 35 17 0f 80 00    	lea    0x800f17,%esi
+  800f15:	0f 34                	sysenter
+  800f17:	5d                   	pop    %ebp
+	return syscall2(SYS_net_send_sg, 0, (uint32_t) sg, nsg, (uint32_t) off,
+			(uint32_t) info);
+}
+  800f18:	5b                   	pop    %ebx
+  800f19:	5e                   	pop    %esi
+  800f1a:	5f                   	pop    %edi
+  800f1b:	5d                   	pop    %ebp
+  800f1c:	c3                   	ret
+
+00800f1d <sys_net_wait>:
+
+int
+sys_net_wait(uint32_t events)
+{
+  800f1d:	55                   	push   %ebp
+  800f1e:	89 e5                	mov    %esp,%ebp
+  800f20:	57                   	push   %edi
+  800f21:	56                   	push   %esi
+  800f22:	53                   	push   %ebx
+	asm volatile("int %1\n"
+  800f23:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800f28:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f2b:	b8 11 00 00 00       	mov    $0x11,%eax
+  800f30:	89 cb                	mov    %ecx,%ebx
+  800f32:	89 cf                	mov    %ecx,%edi
+  800f34:	89 ce                	mov    %ecx,%esi
+  800f36:	cd 30                	int    $0x30
+	// Blocks, so it has to go through the trap gate.
+	return syscall(SYS_net_wait, 0, events, 0, 0, 0, 0);
+}
+  800f38:	5b                   	pop    %ebx
+  800f39:	5e                   	pop    %esi
+  800f3a:	5f                   	pop    %edi
+  800f3b:	5d                   	pop    %ebp
+  800f3c:	c3                   	ret
+
+00800f3d <sys_net_map>:
+
+int
+sys_net_map(void *va)
+{
+  800f3d:	55                   	push   %ebp
+  800f3e:	89 e5                	mov    %esp,%ebp
+  800f40:	57                   	push   %edi
+  800f41:	56                   	push   %esi
+  800f42:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800f43:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800f48:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f4b:	b8 15 00 00 00       	mov    $0x15,%eax
+  800f50:	89 cb                	mov    %ecx,%ebx
+  800f52:	89 cf                	mov    %ecx,%edi
+  800f54:	55                   	push   %ebp
+  800f55:	89 e5                	mov    %esp,%ebp
+  800f57:	8d 35 5f 0f 80 00    	lea    0x800f5f,%esi
+  800f5d:	0f 34                	sysenter
+  800f5f:	5d                   	pop    %ebp
+	return syscall2(SYS_net_map, 0, (uint32_t) va, 0, 0, 0);
+}
+  800f60:	5b                   	pop    %ebx
+  800f61:	5e                   	pop    %esi
+  800f62:	5f                   	pop    %edi
+  800f63:	5d                   	pop    %ebp
+  800f64:	c3                   	ret
+
+00800f65 <sys_net_sync>:
+
+int
+sys_net_sync(uint32_t rings)
+{
+  800f65:	55                   	push   %ebp
+  800f66:	89 e5                	mov    %esp,%ebp
+  800f68:	57                   	push   %edi
+  800f69:	56                   	push   %esi
+  800f6a:	53                   	push   %ebx
+	asm volatile("pushl %%ebp\n"
+  800f6b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800f70:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f73:	b8 16 00 00 00       	mov    $0x16,%eax
+  800f78:	89 cb                	mov    %ecx,%ebx
+  800f7a:	89 cf                	mov    %ecx,%edi
+  800f7c:	55                   	push   %ebp
+  800f7d:	89 e5                	mov    %esp,%ebp
+  800f7f:	8d 35 87 0f 80 00    	lea    0x800f87,%esi
+  800f85:	0f 34                	sysenter
+  800f87:	5d                   	pop    %ebp
+	return syscall2(SYS_net_sync, 0, rings, 0, 0, 0);
+}
+  800f88:	5b                   	pop    %ebx
+  800f89:	5e                   	pop    %esi
+  800f8a:	5f                   	pop    %edi
+  800f8b:	5d                   	pop    %ebp
+  800f8c:	c3                   	ret
+
+00800f8d <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  800f8d:	55                   	push   %ebp
+  800f8e:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  800f90:	8b 45 08             	mov    0x8(%ebp),%eax
+  800f93:	05 00 00 00 30       	add    $0x30000000,%eax
+  800f98:	c1 e8 0c             	shr    $0xc,%eax
+}
+  800f9b:	5d                   	pop    %ebp
+  800f9c:	c3                   	ret
+
+00800f9d <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  800f9d:	55                   	push   %ebp
+  800f9e:	89 e5                	mov    %esp,%ebp
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  800fa0:	8b 45 08             	mov    0x8(%ebp),%eax
+  800fa3:	05 00 00 00 30       	add    $0x30000000,%eax
+	return INDEX2DATA(fd2num(fd));
+  800fa8:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  800fad:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  800fb2:	5d                   	pop    %ebp
+  800fb3:	c3                   	ret
+
+00800fb4 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  800fb4:	55                   	push   %ebp
+  800fb5:	89 e5                	mov    %esp,%ebp
+	int i;
+	struct Fd *fd;
+
+	for (i = 0; i < MAXFD; i++) {
+  800fb7:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  800fbc:	eb 02                	jmp    800fc0 <fd_alloc+0xc>
+  800fbe:	89 d0                	mov    %edx,%eax
+		fd = INDEX2FD(i);
+		if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  800fc0:	89 c2                	mov    %eax,%edx
+  800fc2:	c1 ea 16             	shr    $0x16,%edx
+  800fc5:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  800fcc:	f6 c2 01             	test   $0x1,%dl
+  800fcf:	74 2b                	je     800ffc <fd_alloc+0x48>
+  800fd1:	89 c2                	mov    %eax,%edx
+  800fd3:	c1 ea 0c             	shr    $0xc,%edx
+  800fd6:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  800fdd:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  800fe3:	f6 c1 01             	test   $0x1,%cl
+  800fe6:	74 14                	je     800ffc <fd_alloc+0x48>
+	for (i = 0; i < MAXFD; i++) {
+  800fe8:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  800fee:	75 ce                	jne    800fbe <fd_alloc+0xa>
+  800ff0:	b8 00 00 00 00       	mov    $0x0,%eax
+			*fd_store = fd;
+			return 0;
+		}
+	}
+	*fd_store = 0;
+	return -E_MAX_OPEN;
+  800ff5:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  800ffa:	eb 05                	jmp    801001 <fd_alloc+0x4d>
+			return 0;
+  800ffc:	b9 00 00 00 00       	mov    $0x0,%ecx
+			*fd_store = fd;
+  801001:	8b 55 08             	mov    0x8(%ebp),%edx
+  801004:	89 02                	mov    %eax,(%edx)
+}
+  801006:	89 c8                	mov    %ecx,%eax
+  801008:	5d                   	pop    %ebp
+  801009:	c3                   	ret
+
+0080100a <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  80100a:	55                   	push   %ebp
+  80100b:	89 e5                	mov    %esp,%ebp
+  80100d:	8b 45 08             	mov    0x8(%ebp),%eax
+	struct Fd *fd;
+
+	if (fdnum < 0 || fdnum >= MAXFD) {
+  801010:	83 f8 1f             	cmp    $0x1f,%eax
+  801013:	77 30                	ja     801045 <fd_lookup+0x3b>
+		if (debug)
+			cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	fd = INDEX2FD(fdnum);
+  801015:	c1 e0 0c             	shl    $0xc,%eax
+  801018:	2d 00 00 00 30       	sub    $0x30000000,%eax
+	if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  80101d:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  801023:	f6 c2 01             	test   $0x1,%dl
+  801026:	74 24                	je     80104c <fd_lookup+0x42>
+  801028:	89 c2                	mov    %eax,%edx
+  80102a:	c1 ea 0c             	shr    $0xc,%edx
+  80102d:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801034:	f6 c2 01             	test   $0x1,%dl
+  801037:	74 1a                	je     801053 <fd_lookup+0x49>
+		if (debug)
+			cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	*fd_store = fd;
+  801039:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80103c:	89 02                	mov    %eax,(%edx)
+	return 0;
+  80103e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801043:	5d                   	pop    %ebp
+  801044:	c3                   	ret
+		return -E_INVAL;
+  801045:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80104a:	eb f7                	jmp    801043 <fd_lookup+0x39>
+		return -E_INVAL;
+  80104c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801051:	eb f0                	jmp    801043 <fd_lookup+0x39>
+  801053:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801058:	eb e9                	jmp    801043 <fd_lookup+0x39>
+
+0080105a <dev_lookup>:
+	0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  80105a:	55                   	push   %ebp
+  80105b:	89 e5                	mov    %esp,%ebp
+  80105d:	53                   	push   %ebx
+  80105e:	83 ec 04             	sub    $0x4,%esp
+  801061:	8b 55 08             	mov    0x8(%ebp),%edx
+	int i;
+	for (i = 0; devtab[i]; i++)
+  801064:	b8 00 00 00 00       	mov    $0x0,%eax
+  801069:	eb 03                	jmp    80106e <dev_lookup+0x14>
+  80106b:	83 c0 01             	add    $0x1,%eax
+  80106e:	8b 1c 85 f0 3b 80 00 	mov    0x803bf0(,%eax,4),%ebx
+  801075:	85 db                	test   %ebx,%ebx
+  801077:	74 0b                	je     801084 <dev_lookup+0x2a>
+		if (devtab[i]->dev_id == dev_id) {
+  801079:	39 13                	cmp    %edx,(%ebx)
+  80107b:	75 ee                	jne    80106b <dev_lookup+0x11>
+			*dev = devtab[i];
+			return 0;
+  80107d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801082:	eb 1f                	jmp    8010a3 <dev_lookup+0x49>
+		}
+	cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801084:	a1 00 50 80 00       	mov    0x805000,%eax
+  801089:	8b 40 48             	mov    0x48(%eax),%eax
+  80108c:	83 ec 04             	sub    $0x4,%esp
+  80108f:	52                   	push   %edx
+  801090:	50                   	push   %eax
+  801091:	68 74 3b 80 00       	push   $0x803b74
+  801096:	e8 f7 f0 ff ff       	call   800192 <cprintf>
+	*dev = 0;
+	return -E_INVAL;
+  80109b:	83 c4 10             	add    $0x10,%esp
+  80109e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+			*dev = devtab[i];
+  8010a3:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8010a6:	89 1a                	mov    %ebx,(%edx)
+}
+  8010a8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8010ab:	c9                   	leave
+  8010ac:	c3                   	ret
+
+008010ad <fd_close>:
+{
+  8010ad:	55                   	push   %ebp
+  8010ae:	89 e5                	mov    %esp,%ebp
+  8010b0:	57                   	push   %edi
+  8010b1:	56                   	push   %esi
+  8010b2:	53                   	push   %ebx
+  8010b3:	83 ec 24             	sub    $0x24,%esp
+  8010b6:	8b 75 08             	mov    0x8(%ebp),%esi
+  8010b9:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8010bc:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8010bf:	50                   	push   %eax
+	return ((uintptr_t) fd - FDTABLE) / PGSIZE;
+  8010c0:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  8010c6:	c1 e8 0c             	shr    $0xc,%eax
+	if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8010c9:	50                   	push   %eax
+  8010ca:	e8 3b ff ff ff       	call   80100a <fd_lookup>
+  8010cf:	89 c3                	mov    %eax,%ebx
+  8010d1:	83 c4 10             	add    $0x10,%esp
+  8010d4:	85 c0                	test   %eax,%eax
+  8010d6:	78 05                	js     8010dd <fd_close+0x30>
+	    || fd != fd2)
+  8010d8:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  8010db:	74 16                	je     8010f3 <fd_close+0x46>
+		return (must_exist ? r : 0);
+  8010dd:	89 f8                	mov    %edi,%eax
+  8010df:	84 c0                	test   %al,%al
+  8010e1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8010e6:	0f 44 d8             	cmove  %eax,%ebx
+}
+  8010e9:	89 d8                	mov    %ebx,%eax
+  8010eb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010ee:	5b                   	pop    %ebx
+  8010ef:	5e                   	pop    %esi
+  8010f0:	5f                   	pop    %edi
+  8010f1:	5d                   	pop    %ebp
+  8010f2:	c3                   	ret
+	if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8010f3:	83 ec 08             	sub    $0x8,%esp
+  8010f6:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  8010f9:	50                   	push   %eax
+  8010fa:	ff 36                	push   (%esi)
+  8010fc:	e8 59 ff ff ff       	call   80105a <dev_lookup>
+  801101:	89 c3                	mov    %eax,%ebx
+  801103:	83 c4 10             	add    $0x10,%esp
+  801106:	85 c0                	test   %eax,%eax
+  801108:	78 1a                	js     801124 <fd_close+0x77>
+		if (dev->dev_close)
+  80110a:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80110d:	8b 40 10             	mov    0x10(%eax),%eax
+			r = 0;
+  801110:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if (dev->dev_close)
+  801115:	85 c0                	test   %eax,%eax
+  801117:	74 0b                	je     801124 <fd_close+0x77>
+			r = (*dev->dev_close)(fd);
+  801119:	83 ec 0c             	sub    $0xc,%esp
+  80111c:	56                   	push   %esi
+  80111d:	ff d0                	call   *%eax
+  80111f:	89 c3                	mov    %eax,%ebx
+  801121:	83 c4 10             	add    $0x10,%esp
+	(void) sys_page_unmap(0, fd);
+  801124:	83 ec 08             	sub    $0x8,%esp
+  801127:	56                   	push   %esi
+  801128:	6a 00                	push   $0x0
+  80112a:	e8 ea fa ff ff       	call   800c19 <sys_page_unmap>
+	return r;
+  80112f:	83 c4 10             	add    $0x10,%esp
+  801132:	eb b5                	jmp    8010e9 <fd_close+0x3c>
+
+00801134 <close>:
+
+int
+close(int fdnum)
+{
+  801134:	55                   	push   %ebp
+  801135:	89 e5                	mov    %esp,%ebp
+  801137:	83 ec 20             	sub    $0x20,%esp
+	struct Fd *fd;
+	int r;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80113a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80113d:	50                   	push   %eax
+  80113e:	ff 75 08             	push   0x8(%ebp)
+  801141:	e8 c4 fe ff ff       	call   80100a <fd_lookup>
+  801146:	83 c4 10             	add    $0x10,%esp
+  801149:	85 c0                	test   %eax,%eax
+  80114b:	79 02                	jns    80114f <close+0x1b>
+		return r;
+	else
+		return fd_close(fd, 1);
+}
+  80114d:	c9                   	leave
+  80114e:	c3                   	ret
+		return fd_close(fd, 1);
+  80114f:	83 ec 08             	sub    $0x8,%esp
+  801152:	6a 01                	push   $0x1
+  801154:	ff 75 f4             	push   -0xc(%ebp)
+  801157:	e8 51 ff ff ff       	call   8010ad <fd_close>
+  80115c:	83 c4 10             	add    $0x10,%esp
+  80115f:	eb ec                	jmp    80114d <close+0x19>
+
+00801161 <close_all>:
+
+void
+close_all(void)
+{
+  801161:	55                   	push   %ebp
+  801162:	89 e5                	mov    %esp,%ebp
+  801164:	53                   	push   %ebx
+  801165:	83 ec 04             	sub    $0x4,%esp
+	int i;
+	for (i = 0; i < MAXFD; i++)
+  801168:	bb 00 00 00 00       	mov    $0x0,%ebx
+		close(i);
+  80116d:	83 ec 0c             	sub    $0xc,%esp
+  801170:	53                   	push   %ebx
+  801171:	e8 be ff ff ff       	call   801134 <close>
+	for (i = 0; i < MAXFD; i++)
+  801176:	83 c3 01             	add    $0x1,%ebx
+  801179:	83 c4 10             	add    $0x10,%esp
+  80117c:	83 fb 20             	cmp    $0x20,%ebx
+  80117f:	75 ec                	jne    80116d <close_all+0xc>
+}
+  801181:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801184:	c9                   	leave
+  801185:	c3                   	ret
+
+00801186 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  801186:	55                   	push   %ebp
+  801187:	89 e5                	mov    %esp,%ebp
+  801189:	57                   	push   %edi
+  80118a:	56                   	push   %esi
+  80118b:	53                   	push   %ebx
+  80118c:	83 ec 34             	sub    $0x34,%esp
+	int r;
+	char *ova, *nva;
+	pte_t pte;
+	struct Fd *oldfd, *newfd;
+
+	if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  80118f:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801192:	50                   	push   %eax
+  801193:	ff 75 08             	push   0x8(%ebp)
+  801196:	e8 6f fe ff ff       	call   80100a <fd_lookup>
+  80119b:	89 c3                	mov    %eax,%ebx
+  80119d:	83 c4 10             	add    $0x10,%esp
+  8011a0:	85 c0                	test   %eax,%eax
+  8011a2:	78 7f                	js     801223 <dup+0x9d>
+		return r;
+	close(newfdnum);
+  8011a4:	83 ec 0c             	sub    $0xc,%esp
+  8011a7:	ff 75 0c             	push   0xc(%ebp)
+  8011aa:	e8 85 ff ff ff       	call   801134 <close>
+
+	newfd = INDEX2FD(newfdnum);
+  8011af:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8011b2:	c1 e6 0c             	shl    $0xc,%esi
+  8011b5:	81 ee 00 00 00 30    	sub    $0x30000000,%esi
+	ova = fd2data(oldfd);
+  8011bb:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8011be:	89 3c 24             	mov    %edi,(%esp)
+  8011c1:	e8 d7 fd ff ff       	call   800f9d <fd2data>
+  8011c6:	89 c3                	mov    %eax,%ebx
+	nva = fd2data(newfd);
+  8011c8:	89 34 24             	mov    %esi,(%esp)
+  8011cb:	e8 cd fd ff ff       	call   800f9d <fd2data>
+  8011d0:	83 c4 10             	add    $0x10,%esp
+  8011d3:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+
+	if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
+  8011d6:	89 d8                	mov    %ebx,%eax
+  8011d8:	c1 e8 16             	shr    $0x16,%eax
+  8011db:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8011e2:	a8 01                	test   $0x1,%al
+  8011e4:	74 11                	je     8011f7 <dup+0x71>
+  8011e6:	89 d8                	mov    %ebx,%eax
+  8011e8:	c1 e8 0c             	shr    $0xc,%eax
+  8011eb:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8011f2:	f6 c2 01             	test   $0x1,%dl
+  8011f5:	75 36                	jne    80122d <dup+0xa7>
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+			goto err;
+	if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  8011f7:	89 f8                	mov    %edi,%eax
+  8011f9:	c1 e8 0c             	shr    $0xc,%eax
+  8011fc:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801203:	83 ec 0c             	sub    $0xc,%esp
+  801206:	25 07 0e 00 00       	and    $0xe07,%eax
+  80120b:	50                   	push   %eax
+  80120c:	56                   	push   %esi
+  80120d:	6a 00                	push   $0x0
+  80120f:	57                   	push   %edi
+  801210:	6a 00                	push   $0x0
+  801212:	e8 c0 f9 ff ff       	call   800bd7 <sys_page_map>
+  801217:	89 c3                	mov    %eax,%ebx
+  801219:	83 c4 20             	add    $0x20,%esp
+  80121c:	85 c0                	test   %eax,%eax
+  80121e:	78 33                	js     801253 <dup+0xcd>
+		goto err;
+
+	return newfdnum;
+  801220:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+
+err:
+	sys_page_unmap(0, newfd);
+	sys_page_unmap(0, nva);
+	return r;
+}
+  801223:	89 d8                	mov    %ebx,%eax
+  801225:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801228:	5b                   	pop    %ebx
+  801229:	5e                   	pop    %esi
+  80122a:	5f                   	pop    %edi
+  80122b:	5d                   	pop    %ebp
+  80122c:	c3                   	ret
+		if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
+  80122d:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801234:	83 ec 0c             	sub    $0xc,%esp
+  801237:	25 07 0e 00 00       	and    $0xe07,%eax
+  80123c:	50                   	push   %eax
+  80123d:	ff 75 d4             	push   -0x2c(%ebp)
+  801240:	6a 00                	push   $0x0
+  801242:	53                   	push   %ebx
+  801243:	6a 00                	push   $0x0
+  801245:	e8 8d f9 ff ff       	call   800bd7 <sys_page_map>
+  80124a:	89 c3                	mov    %eax,%ebx
+  80124c:	83 c4 20             	add    $0x20,%esp
+  80124f:	85 c0                	test   %eax,%eax
+  801251:	79 a4                	jns    8011f7 <dup+0x71>
+	sys_page_unmap(0, newfd);
+  801253:	83 ec 08             	sub    $0x8,%esp
+  801256:	56                   	push   %esi
+  801257:	6a 00                	push   $0x0
+  801259:	e8 bb f9 ff ff       	call   800c19 <sys_page_unmap>
+	sys_page_unmap(0, nva);
+  80125e:	83 c4 08             	add    $0x8,%esp
+  801261:	ff 75 d4             	push   -0x2c(%ebp)
+  801264:	6a 00                	push   $0x0
+  801266:	e8 ae f9 ff ff       	call   800c19 <sys_page_unmap>
+	return r;
+  80126b:	83 c4 10             	add    $0x10,%esp
+  80126e:	eb b3                	jmp    801223 <dup+0x9d>
+
+00801270 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  801270:	55                   	push   %ebp
+  801271:	89 e5                	mov    %esp,%ebp
+  801273:	56                   	push   %esi
+  801274:	53                   	push   %ebx
+  801275:	83 ec 18             	sub    $0x18,%esp
+  801278:	8b 75 08             	mov    0x8(%ebp),%esi
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  80127b:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80127e:	50                   	push   %eax
+  80127f:	56                   	push   %esi
+  801280:	e8 85 fd ff ff       	call   80100a <fd_lookup>
+  801285:	83 c4 10             	add    $0x10,%esp
+  801288:	85 c0                	test   %eax,%eax
+  80128a:	78 3c                	js     8012c8 <read+0x58>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80128c:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  80128f:	83 ec 08             	sub    $0x8,%esp
+  801292:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801295:	50                   	push   %eax
+  801296:	ff 33                	push   (%ebx)
+  801298:	e8 bd fd ff ff       	call   80105a <dev_lookup>
+  80129d:	83 c4 10             	add    $0x10,%esp
+  8012a0:	85 c0                	test   %eax,%eax
+  8012a2:	78 24                	js     8012c8 <read+0x58>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  8012a4:	8b 43 08             	mov    0x8(%ebx),%eax
+  8012a7:	83 e0 03             	and    $0x3,%eax
+  8012aa:	83 f8 01             	cmp    $0x1,%eax
+  8012ad:	74 20                	je     8012cf <read+0x5f>
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_read)
+  8012af:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8012b2:	8b 40 08             	mov    0x8(%eax),%eax
+  8012b5:	85 c0                	test   %eax,%eax
+  8012b7:	74 37                	je     8012f0 <read+0x80>
+		return -E_NOT_SUPP;
+	return (*dev->dev_read)(fd, buf, n);
+  8012b9:	83 ec 04             	sub    $0x4,%esp
+  8012bc:	ff 75 10             	push   0x10(%ebp)
+  8012bf:	ff 75 0c             	push   0xc(%ebp)
+  8012c2:	53                   	push   %ebx
+  8012c3:	ff d0                	call   *%eax
+  8012c5:	83 c4 10             	add    $0x10,%esp
+}
+  8012c8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8012cb:	5b                   	pop    %ebx
+  8012cc:	5e                   	pop    %esi
+  8012cd:	5d                   	pop    %ebp
+  8012ce:	c3                   	ret
+		cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8012cf:	a1 00 50 80 00       	mov    0x805000,%eax
+  8012d4:	8b 40 48             	mov    0x48(%eax),%eax
+  8012d7:	83 ec 04             	sub    $0x4,%esp
+  8012da:	56                   	push   %esi
+  8012db:	50                   	push   %eax
+  8012dc:	68 b5 3b 80 00       	push   $0x803bb5
+  8012e1:	e8 ac ee ff ff       	call   800192 <cprintf>
+		return -E_INVAL;
+  8012e6:	83 c4 10             	add    $0x10,%esp
+  8012e9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8012ee:	eb d8                	jmp    8012c8 <read+0x58>
+		return -E_NOT_SUPP;
+  8012f0:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8012f5:	eb d1                	jmp    8012c8 <read+0x58>
+
+008012f7 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  8012f7:	55                   	push   %ebp
+  8012f8:	89 e5                	mov    %esp,%ebp
+  8012fa:	57                   	push   %edi
+  8012fb:	56                   	push   %esi
+  8012fc:	53                   	push   %ebx
+  8012fd:	83 ec 0c             	sub    $0xc,%esp
+  801300:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801303:	8b 75 10             	mov    0x10(%ebp),%esi
+	int m, tot;
+
+	for (tot = 0; tot < n; tot += m) {
+  801306:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80130b:	eb 02                	jmp    80130f <readn+0x18>
+  80130d:	01 c3                	add    %eax,%ebx
+  80130f:	39 f3                	cmp    %esi,%ebx
+  801311:	73 21                	jae    801334 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801313:	83 ec 04             	sub    $0x4,%esp
+  801316:	89 f0                	mov    %esi,%eax
+  801318:	29 d8                	sub    %ebx,%eax
+  80131a:	50                   	push   %eax
+  80131b:	89 d8                	mov    %ebx,%eax
+  80131d:	03 45 0c             	add    0xc(%ebp),%eax
+  801320:	50                   	push   %eax
+  801321:	57                   	push   %edi
+  801322:	e8 49 ff ff ff       	call   801270 <read>
+		if (m < 0)
+  801327:	83 c4 10             	add    $0x10,%esp
+  80132a:	85 c0                	test   %eax,%eax
+  80132c:	78 04                	js     801332 <readn+0x3b>
+			return m;
+		if (m == 0)
+  80132e:	75 dd                	jne    80130d <readn+0x16>
+  801330:	eb 02                	jmp    801334 <readn+0x3d>
+		m = read(fdnum, (char*)buf + tot, n - tot);
+  801332:	89 c3                	mov    %eax,%ebx
+			break;
+	}
+	return tot;
+}
+  801334:	89 d8                	mov    %ebx,%eax
+  801336:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801339:	5b                   	pop    %ebx
+  80133a:	5e                   	pop    %esi
+  80133b:	5f                   	pop    %edi
+  80133c:	5d                   	pop    %ebp
+  80133d:	c3                   	ret
+
+0080133e <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  80133e:	55                   	push   %ebp
+  80133f:	89 e5                	mov    %esp,%ebp
+  801341:	56                   	push   %esi
+  801342:	53                   	push   %ebx
+  801343:	83 ec 18             	sub    $0x18,%esp
+  801346:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801349:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80134c:	50                   	push   %eax
+  80134d:	53                   	push   %ebx
+  80134e:	e8 b7 fc ff ff       	call   80100a <fd_lookup>
+  801353:	83 c4 10             	add    $0x10,%esp
+  801356:	85 c0                	test   %eax,%eax
+  801358:	78 37                	js     801391 <write+0x53>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80135a:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80135d:	83 ec 08             	sub    $0x8,%esp
+  801360:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801363:	50                   	push   %eax
+  801364:	ff 36                	push   (%esi)
+  801366:	e8 ef fc ff ff       	call   80105a <dev_lookup>
+  80136b:	83 c4 10             	add    $0x10,%esp
+  80136e:	85 c0                	test   %eax,%eax
+  801370:	78 1f                	js     801391 <write+0x53>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801372:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801376:	74 20                	je     801398 <write+0x5a>
+		return -E_INVAL;
+	}
+	if (debug)
+		cprintf("write %d %p %d via dev %s\n",
+			fdnum, buf, n, dev->dev_name);
+	if (!dev->dev_write)
+  801378:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80137b:	8b 40 0c             	mov    0xc(%eax),%eax
+  80137e:	85 c0                	test   %eax,%eax
+  801380:	74 37                	je     8013b9 <write+0x7b>
+		return -E_NOT_SUPP;
+	return (*dev->dev_write)(fd, buf, n);
+  801382:	83 ec 04             	sub    $0x4,%esp
+  801385:	ff 75 10             	push   0x10(%ebp)
+  801388:	ff 75 0c             	push   0xc(%ebp)
+  80138b:	56                   	push   %esi
+  80138c:	ff d0                	call   *%eax
+  80138e:	83 c4 10             	add    $0x10,%esp
+}
+  801391:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801394:	5b                   	pop    %ebx
+  801395:	5e                   	pop    %esi
+  801396:	5d                   	pop    %ebp
+  801397:	c3                   	ret
+		cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801398:	a1 00 50 80 00       	mov    0x805000,%eax
+  80139d:	8b 40 48             	mov    0x48(%eax),%eax
+  8013a0:	83 ec 04             	sub    $0x4,%esp
+  8013a3:	53                   	push   %ebx
+  8013a4:	50                   	push   %eax
+  8013a5:	68 d1 3b 80 00       	push   $0x803bd1
+  8013aa:	e8 e3 ed ff ff       	call   800192 <cprintf>
+		return -E_INVAL;
+  8013af:	83 c4 10             	add    $0x10,%esp
+  8013b2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8013b7:	eb d8                	jmp    801391 <write+0x53>
+		return -E_NOT_SUPP;
+  8013b9:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8013be:	eb d1                	jmp    801391 <write+0x53>
+
+008013c0 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  8013c0:	55                   	push   %ebp
+  8013c1:	89 e5                	mov    %esp,%ebp
+  8013c3:	53                   	push   %ebx
+  8013c4:	83 ec 1c             	sub    $0x1c,%esp
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8013c7:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8013ca:	50                   	push   %eax
+  8013cb:	ff 75 08             	push   0x8(%ebp)
+  8013ce:	e8 37 fc ff ff       	call   80100a <fd_lookup>
+  8013d3:	83 c4 10             	add    $0x10,%esp
+  8013d6:	85 c0                	test   %eax,%eax
+  8013d8:	78 3a                	js     801414 <seek+0x54>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8013da:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  8013dd:	83 ec 08             	sub    $0x8,%esp
+  8013e0:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8013e3:	50                   	push   %eax
+  8013e4:	ff 33                	push   (%ebx)
+  8013e6:	e8 6f fc ff ff       	call   80105a <dev_lookup>
+  8013eb:	83 c4 10             	add    $0x10,%esp
+  8013ee:	85 c0                	test   %eax,%eax
+  8013f0:	78 22                	js     801414 <seek+0x54>
+		return r;
+	// Anything buffered for the old position goes out first.
+	if (dev->dev_sync && (r = (*dev->dev_sync)(fd)) < 0)
+  8013f2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8013f5:	8b 40 1c             	mov    0x1c(%eax),%eax
+  8013f8:	85 c0                	test   %eax,%eax
+  8013fa:	74 0d                	je     801409 <seek+0x49>
+  8013fc:	83 ec 0c             	sub    $0xc,%esp
+  8013ff:	53                   	push   %ebx
+  801400:	ff d0                	call   *%eax
+  801402:	83 c4 10             	add    $0x10,%esp
+  801405:	85 c0                	test   %eax,%eax
+  801407:	78 0b                	js     801414 <seek+0x54>
+		return r;
+	fd->fd_offset = offset;
+  801409:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80140c:	89 43 04             	mov    %eax,0x4(%ebx)
+	return 0;
+  80140f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801414:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801417:	c9                   	leave
+  801418:	c3                   	ret
+
+00801419 <fsync>:
+
+// Push out anything the library has buffered for fdnum.
+int
+fsync(int fdnum)
+{
+  801419:	55                   	push   %ebp
+  80141a:	89 e5                	mov    %esp,%ebp
+  80141c:	53                   	push   %ebx
+  80141d:	83 ec 1c             	sub    $0x1c,%esp
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801420:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801423:	50                   	push   %eax
+  801424:	ff 75 08             	push   0x8(%ebp)
+  801427:	e8 de fb ff ff       	call   80100a <fd_lookup>
+  80142c:	83 c4 10             	add    $0x10,%esp
+  80142f:	85 c0                	test   %eax,%eax
+  801431:	78 2b                	js     80145e <fsync+0x45>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801433:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  801436:	83 ec 08             	sub    $0x8,%esp
+  801439:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80143c:	50                   	push   %eax
+  80143d:	ff 33                	push   (%ebx)
+  80143f:	e8 16 fc ff ff       	call   80105a <dev_lookup>
+  801444:	83 c4 10             	add    $0x10,%esp
+  801447:	85 c0                	test   %eax,%eax
+  801449:	78 13                	js     80145e <fsync+0x45>
+		return r;
+	if (!dev->dev_sync)
+  80144b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80144e:	8b 40 1c             	mov    0x1c(%eax),%eax
+  801451:	85 c0                	test   %eax,%eax
+  801453:	74 0e                	je     801463 <fsync+0x4a>
+		return 0;
+	return (*dev->dev_sync)(fd);
+  801455:	83 ec 0c             	sub    $0xc,%esp
+  801458:	53                   	push   %ebx
+  801459:	ff d0                	call   *%eax
+  80145b:	83 c4 10             	add    $0x10,%esp
+}
+  80145e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801461:	c9                   	leave
+  801462:	c3                   	ret
+		return 0;
+  801463:	b8 00 00 00 00       	mov    $0x0,%eax
+  801468:	eb f4                	jmp    80145e <fsync+0x45>
+
+0080146a <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  80146a:	55                   	push   %ebp
+  80146b:	89 e5                	mov    %esp,%ebp
+  80146d:	56                   	push   %esi
+  80146e:	53                   	push   %ebx
+  80146f:	83 ec 18             	sub    $0x18,%esp
+  801472:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  801475:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801478:	50                   	push   %eax
+  801479:	53                   	push   %ebx
+  80147a:	e8 8b fb ff ff       	call   80100a <fd_lookup>
+  80147f:	83 c4 10             	add    $0x10,%esp
+  801482:	85 c0                	test   %eax,%eax
+  801484:	78 34                	js     8014ba <ftruncate+0x50>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801486:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801489:	83 ec 08             	sub    $0x8,%esp
+  80148c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80148f:	50                   	push   %eax
+  801490:	ff 36                	push   (%esi)
+  801492:	e8 c3 fb ff ff       	call   80105a <dev_lookup>
+  801497:	83 c4 10             	add    $0x10,%esp
+  80149a:	85 c0                	test   %eax,%eax
+  80149c:	78 1c                	js     8014ba <ftruncate+0x50>
+		return r;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80149e:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8014a2:	74 1d                	je     8014c1 <ftruncate+0x57>
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+			thisenv->env_id, fdnum);
+		return -E_INVAL;
+	}
+	if (!dev->dev_trunc)
+  8014a4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8014a7:	8b 40 18             	mov    0x18(%eax),%eax
+  8014aa:	85 c0                	test   %eax,%eax
+  8014ac:	74 34                	je     8014e2 <ftruncate+0x78>
+		return -E_NOT_SUPP;
+	return (*dev->dev_trunc)(fd, newsize);
+  8014ae:	83 ec 08             	sub    $0x8,%esp
+  8014b1:	ff 75 0c             	push   0xc(%ebp)
+  8014b4:	56                   	push   %esi
+  8014b5:	ff d0                	call   *%eax
+  8014b7:	83 c4 10             	add    $0x10,%esp
+}
+  8014ba:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8014bd:	5b                   	pop    %ebx
+  8014be:	5e                   	pop    %esi
+  8014bf:	5d                   	pop    %ebp
+  8014c0:	c3                   	ret
+			thisenv->env_id, fdnum);
+  8014c1:	a1 00 50 80 00       	mov    0x805000,%eax
+  8014c6:	8b 40 48             	mov    0x48(%eax),%eax
+		cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8014c9:	83 ec 04             	sub    $0x4,%esp
+  8014cc:	53                   	push   %ebx
+  8014cd:	50                   	push   %eax
+  8014ce:	68 94 3b 80 00       	push   $0x803b94
+  8014d3:	e8 ba ec ff ff       	call   800192 <cprintf>
+		return -E_INVAL;
+  8014d8:	83 c4 10             	add    $0x10,%esp
+  8014db:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8014e0:	eb d8                	jmp    8014ba <ftruncate+0x50>
+		return -E_NOT_SUPP;
+  8014e2:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8014e7:	eb d1                	jmp    8014ba <ftruncate+0x50>
+
+008014e9 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  8014e9:	55                   	push   %ebp
+  8014ea:	89 e5                	mov    %esp,%ebp
+  8014ec:	56                   	push   %esi
+  8014ed:	53                   	push   %ebx
+  8014ee:	83 ec 18             	sub    $0x18,%esp
+  8014f1:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	int r;
+	struct Dev *dev;
+	struct Fd *fd;
+
+	if ((r = fd_lookup(fdnum, &fd)) < 0
+  8014f4:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8014f7:	50                   	push   %eax
+  8014f8:	ff 75 08             	push   0x8(%ebp)
+  8014fb:	e8 0a fb ff ff       	call   80100a <fd_lookup>
+  801500:	83 c4 10             	add    $0x10,%esp
+  801503:	85 c0                	test   %eax,%eax
+  801505:	78 49                	js     801550 <fstat+0x67>
+	    || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801507:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80150a:	83 ec 08             	sub    $0x8,%esp
+  80150d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801510:	50                   	push   %eax
+  801511:	ff 36                	push   (%esi)
+  801513:	e8 42 fb ff ff       	call   80105a <dev_lookup>
+  801518:	83 c4 10             	add    $0x10,%esp
+  80151b:	85 c0                	test   %eax,%eax
+  80151d:	78 31                	js     801550 <fstat+0x67>
+		return r;
+	if (!dev->dev_stat)
+  80151f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801522:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  801526:	74 2f                	je     801557 <fstat+0x6e>
+		return -E_NOT_SUPP;
+	stat->st_name[0] = 0;
+  801528:	c6 03 00             	movb   $0x0,(%ebx)
+	stat->st_size = 0;
+  80152b:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801532:	00 00 00 
+	stat->st_isdir = 0;
+  801535:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  80153c:	00 00 00 
+	stat->st_dev = dev;
+  80153f:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	return (*dev->dev_stat)(fd, stat);
+  801545:	83 ec 08             	sub    $0x8,%esp
+  801548:	53                   	push   %ebx
+  801549:	56                   	push   %esi
+  80154a:	ff 50 14             	call   *0x14(%eax)
+  80154d:	83 c4 10             	add    $0x10,%esp
+}
+  801550:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801553:	5b                   	pop    %ebx
+  801554:	5e                   	pop    %esi
+  801555:	5d                   	pop    %ebp
+  801556:	c3                   	ret
+		return -E_NOT_SUPP;
+  801557:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80155c:	eb f2                	jmp    801550 <fstat+0x67>
+
+0080155e <stat>:
+
+int
+stat(const char *path, struct Stat *stat)
+{
+  80155e:	55                   	push   %ebp
+  80155f:	89 e5                	mov    %esp,%ebp
+  801561:	56                   	push   %esi
+  801562:	53                   	push   %ebx
+	int fd, r;
+
+	if ((fd = open(path, O_RDONLY | O_NOBUF)) < 0)
+  801563:	83 ec 08             	sub    $0x8,%esp
+  801566:	68 00 10 00 00       	push   $0x1000
+  80156b:	ff 75 08             	push   0x8(%ebp)
+  80156e:	e8 b3 07 00 00       	call   801d26 <open>
+  801573:	89 c3                	mov    %eax,%ebx
+  801575:	83 c4 10             	add    $0x10,%esp
+  801578:	85 c0                	test   %eax,%eax
+  80157a:	78 1b                	js     801597 <stat+0x39>
+		return fd;
+	r = fstat(fd, stat);
+  80157c:	83 ec 08             	sub    $0x8,%esp
+  80157f:	ff 75 0c             	push   0xc(%ebp)
+  801582:	50                   	push   %eax
+  801583:	e8 61 ff ff ff       	call   8014e9 <fstat>
+  801588:	89 c6                	mov    %eax,%esi
+	close(fd);
+  80158a:	89 1c 24             	mov    %ebx,(%esp)
+  80158d:	e8 a2 fb ff ff       	call   801134 <close>
+	return r;
+  801592:	83 c4 10             	add    $0x10,%esp
+  801595:	89 f3                	mov    %esi,%ebx
+}
+  801597:	89 d8                	mov    %ebx,%eax
+  801599:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80159c:	5b                   	pop    %ebx
+  80159d:	5e                   	pop    %esi
+  80159e:	5d                   	pop    %ebp
+  80159f:	c3                   	ret
+
+008015a0 <fsipc_pages>:
+// need not be copied through fsipcbuf.  n must fit in FSBULK_MAXPAGES
+// pages.
+// Returns result from the file server.
+static int
+fsipc_pages(unsigned type, const void *buf, size_t n, int perm)
+{
+  8015a0:	55                   	push   %ebp
+  8015a1:	89 e5                	mov    %esp,%ebp
+  8015a3:	57                   	push   %edi
+  8015a4:	56                   	push   %esi
+  8015a5:	53                   	push   %ebx
+  8015a6:	81 ec 2c 01 00 00    	sub    $0x12c,%esp
+  8015ac:	89 85 d4 fe ff ff    	mov    %eax,-0x12c(%ebp)
+  8015b2:	89 d6                	mov    %edx,%esi
+  8015b4:	89 8d d0 fe ff ff    	mov    %ecx,-0x130(%ebp)
+  8015ba:	8b 7d 08             	mov    0x8(%ebp),%edi
+	uintptr_t pages[1 + FSBULK_MAXPAGES];
+	uintptr_t va, start = ROUNDDOWN((uintptr_t) buf, PGSIZE);
+  8015bd:	89 d3                	mov    %edx,%ebx
+  8015bf:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+	int npages;
+
+	if (fsenv == 0)
+  8015c5:	83 3d c8 70 80 00 00 	cmpl   $0x0,0x8070c8
+  8015cc:	74 1d                	je     8015eb <fsipc_pages+0x4b>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+
+	pages[0] = (uintptr_t) &fsipcbuf | PTE_P | PTE_W | PTE_U;
+  8015ce:	b8 00 60 80 00       	mov    $0x806000,%eax
+  8015d3:	83 c8 07             	or     $0x7,%eax
+  8015d6:	89 85 e4 fe ff ff    	mov    %eax,-0x11c(%ebp)
+	npages = 1;
+  8015dc:	b8 01 00 00 00       	mov    $0x1,%eax
+	for (va = start; va < (uintptr_t) buf + n; va += PGSIZE)
+  8015e1:	8b 8d d0 fe ff ff    	mov    -0x130(%ebp),%ecx
+  8015e7:	01 ce                	add    %ecx,%esi
+  8015e9:	eb 28                	jmp    801613 <fsipc_pages+0x73>
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  8015eb:	83 ec 0c             	sub    $0xc,%esp
+  8015ee:	6a 01                	push   $0x1
+  8015f0:	e8 52 1e 00 00       	call   803447 <ipc_find_env>
+  8015f5:	a3 c8 70 80 00       	mov    %eax,0x8070c8
+  8015fa:	83 c4 10             	add    $0x10,%esp
+  8015fd:	eb cf                	jmp    8015ce <fsipc_pages+0x2e>
+		pages[npages++] = va | perm;
+  8015ff:	83 c0 01             	add    $0x1,%eax
+  801602:	89 fa                	mov    %edi,%edx
+  801604:	09 da                	or     %ebx,%edx
+  801606:	89 94 85 e0 fe ff ff 	mov    %edx,-0x120(%ebp,%eax,4)
+	for (va = start; va < (uintptr_t) buf + n; va += PGSIZE)
+  80160d:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801613:	39 f3                	cmp    %esi,%ebx
+  801615:	72 e8                	jb     8015ff <fsipc_pages+0x5f>
+	assert(npages <= ARRAY_SIZE(pages));
+  801617:	83 f8 41             	cmp    $0x41,%eax
+  80161a:	77 2f                	ja     80164b <fsipc_pages+0xab>
+
+	if (debug)
+		cprintf("[%08x] fsipc_pages %d %08x %d pages\n",
+			thisenv->env_id, type, buf, npages - 1);
+
+	ipc_sendv(fsenv, type, pages, npages);
+  80161c:	50                   	push   %eax
+  80161d:	8d 85 e4 fe ff ff    	lea    -0x11c(%ebp),%eax
+  801623:	50                   	push   %eax
+  801624:	ff b5 d4 fe ff ff    	push   -0x12c(%ebp)
+  80162a:	ff 35 c8 70 80 00    	push   0x8070c8
+  801630:	e8 c4 1d 00 00       	call   8033f9 <ipc_sendv>
+	return ipc_recv(NULL, NULL, NULL);
+  801635:	83 c4 0c             	add    $0xc,%esp
+  801638:	6a 00                	push   $0x0
+  80163a:	6a 00                	push   $0x0
+  80163c:	6a 00                	push   $0x0
+  80163e:	e8 60 1c 00 00       	call   8032a3 <ipc_recv>
+}
+  801643:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801646:	5b                   	pop    %ebx
+  801647:	5e                   	pop    %esi
+  801648:	5f                   	pop    %edi
+  801649:	5d                   	pop    %ebp
+  80164a:	c3                   	ret
+	assert(npages <= ARRAY_SIZE(pages));
+  80164b:	68 04 3c 80 00       	push   $0x803c04
+  801650:	68 20 3c 80 00       	push   $0x803c20
+  801655:	6a 40                	push   $0x40
+  801657:	68 35 3c 80 00       	push   $0x803c35
+  80165c:	e8 e7 18 00 00       	call   802f48 <_panic>
+
+00801661 <fsring_post>:
+
+// Post a request of the given type for n bytes at 'offset' of fdnum,
+// with data page 'slot' already filled in as needed.
+static int
+fsring_post(uint32_t type, struct Fd *fd, off_t offset, size_t n, int slot)
+{
+  801661:	55                   	push   %ebp
+  801662:	89 e5                	mov    %esp,%ebp
+  801664:	57                   	push   %edi
+  801665:	56                   	push   %esi
+  801666:	53                   	push   %ebx
+  801667:	83 ec 1c             	sub    $0x1c,%esp
+  80166a:	89 c3                	mov    %eax,%ebx
+  80166c:	89 d6                	mov    %edx,%esi
+  80166e:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+	struct Fsring_sqe *sqe;
+	uint32_t tail = fsring->r_sqtail;
+  801671:	8b 0d 04 00 00 cf    	mov    0xcf000004,%ecx
+
+	sqe = &fsring->r_sq[tail % FSRING_NSLOTS];
+  801677:	89 ca                	mov    %ecx,%edx
+  801679:	83 e2 0f             	and    $0xf,%edx
+	sqe->sqe_type = type;
+  80167c:	8d 04 95 00 00 00 00 	lea    0x0(,%edx,4),%eax
+  801683:	8d 3c 10             	lea    (%eax,%edx,1),%edi
+  801686:	89 1c bd 10 00 00 cf 	mov    %ebx,-0x30fffff0(,%edi,4)
+	sqe->sqe_fileid = fd->fd_file.id;
+  80168d:	8b 76 0c             	mov    0xc(%esi),%esi
+  801690:	89 fb                	mov    %edi,%ebx
+  801692:	89 34 bd 14 00 00 cf 	mov    %esi,-0x30ffffec(,%edi,4)
+	sqe->sqe_offset = offset;
+  801699:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80169c:	89 3c 9d 18 00 00 cf 	mov    %edi,-0x30ffffe8(,%ebx,4)
+	sqe->sqe_n = n;
+  8016a3:	8b 75 08             	mov    0x8(%ebp),%esi
+  8016a6:	89 34 9d 1c 00 00 cf 	mov    %esi,-0x30ffffe4(,%ebx,4)
+	sqe->sqe_slot = slot;
+  8016ad:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8016b0:	89 14 9d 20 00 00 cf 	mov    %edx,-0x30ffffe0(,%ebx,4)
+	// waking when the ring was empty before this request.  The kick
+	// gets no reply, and the server does not look at its request page.
+	// Publishing the tail with xchg, a full barrier, keeps the load of
+	// r_sqhead below from passing it; serve_ring_kick does the same the
+	// other way around, so one of the two sees the other's update.
+	xchg(&fsring->r_sqtail, tail + 1);
+  8016b7:	8d 41 01             	lea    0x1(%ecx),%eax
+xchg(volatile uint32_t *addr, uint32_t newval)
+{
+	uint32_t result;
+
+	// The + in "+m" denotes a read-modify-write operand.
+	asm volatile("lock; xchgl %0, %1"
+  8016ba:	f0 87 05 04 00 00 cf 	lock xchg %eax,0xcf000004
+	if (fsring->r_sqhead == tail)
+  8016c1:	a1 00 00 00 cf       	mov    0xcf000000,%eax
+  8016c6:	39 c8                	cmp    %ecx,%eax
+  8016c8:	74 0d                	je     8016d7 <fsring_post+0x76>
+		ipc_send(fsenv, FSREQ_RING_KICK, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+	return 0;
+}
+  8016ca:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016cf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8016d2:	5b                   	pop    %ebx
+  8016d3:	5e                   	pop    %esi
+  8016d4:	5f                   	pop    %edi
+  8016d5:	5d                   	pop    %ebp
+  8016d6:	c3                   	ret
+		ipc_send(fsenv, FSREQ_RING_KICK, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  8016d7:	6a 07                	push   $0x7
+  8016d9:	68 00 60 80 00       	push   $0x806000
+  8016de:	6a 0d                	push   $0xd
+  8016e0:	ff 35 c8 70 80 00    	push   0x8070c8
+  8016e6:	e8 23 1c 00 00       	call   80330e <ipc_send>
+  8016eb:	83 c4 10             	add    $0x10,%esp
+  8016ee:	eb da                	jmp    8016ca <fsring_post+0x69>
+
+008016f0 <fsipcv>:
+{
+  8016f0:	55                   	push   %ebp
+  8016f1:	89 e5                	mov    %esp,%ebp
+  8016f3:	57                   	push   %edi
+  8016f4:	56                   	push   %esi
+  8016f5:	53                   	push   %ebx
+  8016f6:	83 ec 0c             	sub    $0xc,%esp
+  8016f9:	89 c7                	mov    %eax,%edi
+  8016fb:	89 d3                	mov    %edx,%ebx
+  8016fd:	89 ce                	mov    %ecx,%esi
+	if (fsenv == 0)
+  8016ff:	83 3d c8 70 80 00 00 	cmpl   $0x0,0x8070c8
+  801706:	74 26                	je     80172e <fsipcv+0x3e>
+	ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  801708:	6a 07                	push   $0x7
+  80170a:	68 00 60 80 00       	push   $0x806000
+  80170f:	57                   	push   %edi
+  801710:	ff 35 c8 70 80 00    	push   0x8070c8
+  801716:	e8 f3 1b 00 00       	call   80330e <ipc_send>
+	return ipc_recvv(NULL, dstva, npages, NULL);
+  80171b:	6a 00                	push   $0x0
+  80171d:	56                   	push   %esi
+  80171e:	53                   	push   %ebx
+  80171f:	6a 00                	push   $0x0
+  801721:	e8 40 1c 00 00       	call   803366 <ipc_recvv>
+}
+  801726:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801729:	5b                   	pop    %ebx
+  80172a:	5e                   	pop    %esi
+  80172b:	5f                   	pop    %edi
+  80172c:	5d                   	pop    %ebp
+  80172d:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  80172e:	83 ec 0c             	sub    $0xc,%esp
+  801731:	6a 01                	push   $0x1
+  801733:	e8 0f 1d 00 00       	call   803447 <ipc_find_env>
+  801738:	a3 c8 70 80 00       	mov    %eax,0x8070c8
+  80173d:	83 c4 10             	add    $0x10,%esp
+  801740:	eb c6                	jmp    801708 <fsipcv+0x18>
+
+00801742 <fsipc>:
+{
+  801742:	55                   	push   %ebp
+  801743:	89 e5                	mov    %esp,%ebp
+  801745:	83 ec 18             	sub    $0x18,%esp
+	int npages = 1;
+  801748:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+	return fsipcv(type, dstva, &npages);
+  80174f:	8d 4d f4             	lea    -0xc(%ebp),%ecx
+  801752:	e8 99 ff ff ff       	call   8016f0 <fsipcv>
+}
+  801757:	c9                   	leave
+  801758:	c3                   	ret
+
+00801759 <file_write_direct>:
+{
+  801759:	55                   	push   %ebp
+  80175a:	89 e5                	mov    %esp,%ebp
+  80175c:	56                   	push   %esi
+  80175d:	53                   	push   %ebx
+  80175e:	89 c3                	mov    %eax,%ebx
+  801760:	89 c8                	mov    %ecx,%eax
+	if (n > sizeof(fsipcbuf.write.req_buf)) {
+  801762:	81 f9 f8 0f 00 00    	cmp    $0xff8,%ecx
+  801768:	77 40                	ja     8017aa <file_write_direct+0x51>
+	n = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  80176a:	b9 f8 0f 00 00       	mov    $0xff8,%ecx
+  80176f:	39 c8                	cmp    %ecx,%eax
+  801771:	0f 47 c1             	cmova  %ecx,%eax
+	fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801774:	8b 4b 0c             	mov    0xc(%ebx),%ecx
+  801777:	89 0d 00 60 80 00    	mov    %ecx,0x806000
+	fsipcbuf.write.req_n = n;
+  80177d:	a3 04 60 80 00       	mov    %eax,0x806004
+	memmove(fsipcbuf.write.req_buf, buf, n);
+  801782:	83 ec 04             	sub    $0x4,%esp
+  801785:	50                   	push   %eax
+  801786:	52                   	push   %edx
+  801787:	68 08 60 80 00       	push   $0x806008
+  80178c:	e8 75 f1 ff ff       	call   800906 <memmove>
+	return fsipc(FSREQ_WRITE, NULL);
+  801791:	ba 00 00 00 00       	mov    $0x0,%edx
+  801796:	b8 04 00 00 00       	mov    $0x4,%eax
+  80179b:	e8 a2 ff ff ff       	call   801742 <fsipc>
+  8017a0:	83 c4 10             	add    $0x10,%esp
+}
+  8017a3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8017a6:	5b                   	pop    %ebx
+  8017a7:	5e                   	pop    %esi
+  8017a8:	5d                   	pop    %ebp
+  8017a9:	c3                   	ret
+		n = MIN(n, FSBULK_MAXPAGES * PGSIZE - PGOFF(buf));
+  8017aa:	89 d6                	mov    %edx,%esi
+  8017ac:	81 e6 ff 0f 00 00    	and    $0xfff,%esi
+  8017b2:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  8017b7:	29 f1                	sub    %esi,%ecx
+  8017b9:	39 c1                	cmp    %eax,%ecx
+  8017bb:	0f 47 c8             	cmova  %eax,%ecx
+	fsipcbuf.bulk.req_fileid = fileid;
+  8017be:	8b 43 0c             	mov    0xc(%ebx),%eax
+  8017c1:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.bulk.req_n = n;
+  8017c6:	89 0d 04 60 80 00    	mov    %ecx,0x806004
+	fsipcbuf.bulk.req_off = PGOFF(buf);
+  8017cc:	89 35 08 60 80 00    	mov    %esi,0x806008
+	return fsipc_pages(type, buf, n, perm);
+  8017d2:	83 ec 0c             	sub    $0xc,%esp
+  8017d5:	6a 05                	push   $0x5
+  8017d7:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8017dc:	e8 bf fd ff ff       	call   8015a0 <fsipc_pages>
+		return fsipc_bulk(FSREQ_WRITE_BULK, fd->fd_file.id, buf, n,
+  8017e1:	83 c4 10             	add    $0x10,%esp
+  8017e4:	eb bd                	jmp    8017a3 <file_write_direct+0x4a>
+
+008017e6 <devfile_sync>:
+{
+  8017e6:	55                   	push   %ebp
+  8017e7:	89 e5                	mov    %esp,%ebp
+  8017e9:	57                   	push   %edi
+  8017ea:	56                   	push   %esi
+  8017eb:	53                   	push   %ebx
+  8017ec:	83 ec 28             	sub    $0x28,%esp
+  8017ef:	8b 75 08             	mov    0x8(%ebp),%esi
+	char *p = fd2data(fd);
+  8017f2:	56                   	push   %esi
+  8017f3:	e8 a5 f7 ff ff       	call   800f9d <fd2data>
+  8017f8:	89 c7                	mov    %eax,%edi
+	off_t pos = fd->fd_offset;
+  8017fa:	8b 4e 04             	mov    0x4(%esi),%ecx
+	ff->buf_rlen = 0;
+  8017fd:	c7 46 18 00 00 00 00 	movl   $0x0,0x18(%esi)
+	if (ff->buf_wlen == 0)
+  801804:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  801807:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (ff->buf_wlen == 0)
+  80180c:	83 7e 1c 00          	cmpl   $0x0,0x1c(%esi)
+  801810:	74 45                	je     801857 <devfile_sync+0x71>
+	fd->fd_offset = ff->buf_base;
+  801812:	8b 46 14             	mov    0x14(%esi),%eax
+  801815:	89 46 04             	mov    %eax,0x4(%esi)
+	for (done = 0, r = 0; done < ff->buf_wlen; done += r)
+  801818:	b8 00 00 00 00       	mov    $0x0,%eax
+  80181d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801822:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  801825:	8b 4e 1c             	mov    0x1c(%esi),%ecx
+  801828:	39 cb                	cmp    %ecx,%ebx
+  80182a:	73 14                	jae    801840 <devfile_sync+0x5a>
+		if ((r = file_write_direct(fd, p + done, ff->buf_wlen - done)) <= 0)
+  80182c:	29 d9                	sub    %ebx,%ecx
+  80182e:	8d 14 1f             	lea    (%edi,%ebx,1),%edx
+  801831:	89 f0                	mov    %esi,%eax
+  801833:	e8 21 ff ff ff       	call   801759 <file_write_direct>
+  801838:	85 c0                	test   %eax,%eax
+  80183a:	7e 04                	jle    801840 <devfile_sync+0x5a>
+	for (done = 0, r = 0; done < ff->buf_wlen; done += r)
+  80183c:	01 c3                	add    %eax,%ebx
+  80183e:	eb e5                	jmp    801825 <devfile_sync+0x3f>
+	ff->buf_wlen = 0;
+  801840:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  801843:	c7 46 1c 00 00 00 00 	movl   $0x0,0x1c(%esi)
+	fd->fd_offset = pos;
+  80184a:	89 4e 04             	mov    %ecx,0x4(%esi)
+	return r < 0 ? r : 0;
+  80184d:	85 c0                	test   %eax,%eax
+  80184f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801854:	0f 4f c2             	cmovg  %edx,%eax
+}
+  801857:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80185a:	5b                   	pop    %ebx
+  80185b:	5e                   	pop    %esi
+  80185c:	5f                   	pop    %edi
+  80185d:	5d                   	pop    %ebp
+  80185e:	c3                   	ret
+
+0080185f <devfile_write>:
+{
+  80185f:	55                   	push   %ebp
+  801860:	89 e5                	mov    %esp,%ebp
+  801862:	57                   	push   %edi
+  801863:	56                   	push   %esi
+  801864:	53                   	push   %ebx
+  801865:	83 ec 28             	sub    $0x28,%esp
+  801868:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80186b:	8b 75 10             	mov    0x10(%ebp),%esi
+	char *p = fd2data(fd);
+  80186e:	53                   	push   %ebx
+  80186f:	e8 29 f7 ff ff       	call   800f9d <fd2data>
+  801874:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	off_t pos = fd->fd_offset;
+  801877:	8b 7b 04             	mov    0x4(%ebx),%edi
+	if (!ff->buffered)
+  80187a:	83 c4 10             	add    $0x10,%esp
+  80187d:	80 7b 10 00          	cmpb   $0x0,0x10(%ebx)
+  801881:	74 43                	je     8018c6 <devfile_write+0x67>
+	ff->buf_rlen = 0;
+  801883:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+	if (ff->buf_wlen > 0
+  80188a:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  80188d:	85 c0                	test   %eax,%eax
+  80188f:	74 43                	je     8018d4 <devfile_write+0x75>
+	    && (pos != ff->buf_base + ff->buf_wlen
+  801891:	89 c2                	mov    %eax,%edx
+  801893:	03 53 14             	add    0x14(%ebx),%edx
+  801896:	39 fa                	cmp    %edi,%edx
+  801898:	75 0b                	jne    8018a5 <devfile_write+0x46>
+		|| ff->buf_wlen + n > FILEBUF_SIZE)
+  80189a:	8d 14 30             	lea    (%eax,%esi,1),%edx
+  80189d:	81 fa 00 10 00 00    	cmp    $0x1000,%edx
+  8018a3:	76 66                	jbe    80190b <devfile_write+0xac>
+	    && (r = devfile_sync(fd)) < 0)
+  8018a5:	83 ec 0c             	sub    $0xc,%esp
+  8018a8:	53                   	push   %ebx
+  8018a9:	e8 38 ff ff ff       	call   8017e6 <devfile_sync>
+  8018ae:	83 c4 10             	add    $0x10,%esp
+  8018b1:	85 c0                	test   %eax,%eax
+  8018b3:	78 4e                	js     801903 <devfile_write+0xa4>
+	if (n >= FILEBUF_SIZE)
+  8018b5:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  8018bb:	77 56                	ja     801913 <devfile_write+0xb4>
+	if (ff->buf_wlen == 0)
+  8018bd:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  8018c0:	85 c0                	test   %eax,%eax
+  8018c2:	75 20                	jne    8018e4 <devfile_write+0x85>
+  8018c4:	eb 16                	jmp    8018dc <devfile_write+0x7d>
+		return file_write_direct(fd, buf, n);
+  8018c6:	89 f1                	mov    %esi,%ecx
+  8018c8:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8018cb:	89 d8                	mov    %ebx,%eax
+  8018cd:	e8 87 fe ff ff       	call   801759 <file_write_direct>
+  8018d2:	eb 2f                	jmp    801903 <devfile_write+0xa4>
+	if (n >= FILEBUF_SIZE)
+  8018d4:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  8018da:	77 37                	ja     801913 <devfile_write+0xb4>
+		ff->buf_base = pos;
+  8018dc:	89 7b 14             	mov    %edi,0x14(%ebx)
+  8018df:	b8 00 00 00 00       	mov    $0x0,%eax
+	memmove(p + ff->buf_wlen, buf, n);
+  8018e4:	83 ec 04             	sub    $0x4,%esp
+  8018e7:	56                   	push   %esi
+  8018e8:	ff 75 0c             	push   0xc(%ebp)
+  8018eb:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8018ee:	01 c1                	add    %eax,%ecx
+  8018f0:	51                   	push   %ecx
+  8018f1:	e8 10 f0 ff ff       	call   800906 <memmove>
+	ff->buf_wlen += n;
+  8018f6:	01 73 1c             	add    %esi,0x1c(%ebx)
+	fd->fd_offset = pos + n;
+  8018f9:	01 f7                	add    %esi,%edi
+  8018fb:	89 7b 04             	mov    %edi,0x4(%ebx)
+	return n;
+  8018fe:	89 f0                	mov    %esi,%eax
+  801900:	83 c4 10             	add    $0x10,%esp
+}
+  801903:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801906:	5b                   	pop    %ebx
+  801907:	5e                   	pop    %esi
+  801908:	5f                   	pop    %edi
+  801909:	5d                   	pop    %ebp
+  80190a:	c3                   	ret
+	if (n >= FILEBUF_SIZE)
+  80190b:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  801911:	76 d1                	jbe    8018e4 <devfile_write+0x85>
+		return file_write_direct(fd, buf, n);
+  801913:	89 f1                	mov    %esi,%ecx
+  801915:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801918:	89 d8                	mov    %ebx,%eax
+  80191a:	e8 3a fe ff ff       	call   801759 <file_write_direct>
+  80191f:	eb e2                	jmp    801903 <devfile_write+0xa4>
+
+00801921 <devfile_trunc>:
+{
+  801921:	55                   	push   %ebp
+  801922:	89 e5                	mov    %esp,%ebp
+  801924:	53                   	push   %ebx
+  801925:	83 ec 10             	sub    $0x10,%esp
+  801928:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if ((r = devfile_sync(fd)) < 0)
+  80192b:	53                   	push   %ebx
+  80192c:	e8 b5 fe ff ff       	call   8017e6 <devfile_sync>
+  801931:	83 c4 10             	add    $0x10,%esp
+  801934:	85 c0                	test   %eax,%eax
+  801936:	78 1f                	js     801957 <devfile_trunc+0x36>
+	fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801938:	8b 43 0c             	mov    0xc(%ebx),%eax
+  80193b:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.set_size.req_size = newsize;
+  801940:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801943:	a3 04 60 80 00       	mov    %eax,0x806004
+	return fsipc(FSREQ_SET_SIZE, NULL);
+  801948:	ba 00 00 00 00       	mov    $0x0,%edx
+  80194d:	b8 02 00 00 00       	mov    $0x2,%eax
+  801952:	e8 eb fd ff ff       	call   801742 <fsipc>
+}
+  801957:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80195a:	c9                   	leave
+  80195b:	c3                   	ret
+
+0080195c <devfile_stat>:
+{
+  80195c:	55                   	push   %ebp
+  80195d:	89 e5                	mov    %esp,%ebp
+  80195f:	56                   	push   %esi
+  801960:	53                   	push   %ebx
+  801961:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801964:	8b 75 0c             	mov    0xc(%ebp),%esi
+	if ((r = devfile_sync(fd)) < 0)
+  801967:	83 ec 0c             	sub    $0xc,%esp
+  80196a:	53                   	push   %ebx
+  80196b:	e8 76 fe ff ff       	call   8017e6 <devfile_sync>
+  801970:	83 c4 10             	add    $0x10,%esp
+  801973:	85 c0                	test   %eax,%eax
+  801975:	78 47                	js     8019be <devfile_stat+0x62>
+	fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801977:	8b 43 0c             	mov    0xc(%ebx),%eax
+  80197a:	a3 00 60 80 00       	mov    %eax,0x806000
+	if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  80197f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801984:	b8 05 00 00 00       	mov    $0x5,%eax
+  801989:	e8 b4 fd ff ff       	call   801742 <fsipc>
+  80198e:	85 c0                	test   %eax,%eax
+  801990:	78 2c                	js     8019be <devfile_stat+0x62>
+	strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801992:	83 ec 08             	sub    $0x8,%esp
+  801995:	68 00 60 80 00       	push   $0x806000
+  80199a:	56                   	push   %esi
+  80199b:	e8 e0 ed ff ff       	call   800780 <strcpy>
+	st->st_size = fsipcbuf.statRet.ret_size;
+  8019a0:	a1 80 60 80 00       	mov    0x806080,%eax
+  8019a5:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+	st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8019ab:	a1 84 60 80 00       	mov    0x806084,%eax
+  8019b0:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+	return 0;
+  8019b6:	83 c4 10             	add    $0x10,%esp
+  8019b9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8019be:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8019c1:	5b                   	pop    %ebx
+  8019c2:	5e                   	pop    %esi
+  8019c3:	5d                   	pop    %ebp
+  8019c4:	c3                   	ret
+
+008019c5 <devfile_flush>:
+{
+  8019c5:	55                   	push   %ebp
+  8019c6:	89 e5                	mov    %esp,%ebp
+  8019c8:	56                   	push   %esi
+  8019c9:	53                   	push   %ebx
+  8019ca:	8b 75 08             	mov    0x8(%ebp),%esi
+	r = devfile_sync(fd);
+  8019cd:	83 ec 0c             	sub    $0xc,%esp
+  8019d0:	56                   	push   %esi
+  8019d1:	e8 10 fe ff ff       	call   8017e6 <devfile_sync>
+  8019d6:	89 c3                	mov    %eax,%ebx
+	if (fd->fd_file.buffered)
+  8019d8:	83 c4 10             	add    $0x10,%esp
+  8019db:	80 7e 10 00          	cmpb   $0x0,0x10(%esi)
+  8019df:	75 25                	jne    801a06 <devfile_flush+0x41>
+	fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  8019e1:	8b 46 0c             	mov    0xc(%esi),%eax
+  8019e4:	a3 00 60 80 00       	mov    %eax,0x806000
+	return fsipc(FSREQ_FLUSH, NULL) ?: r;
+  8019e9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8019ee:	b8 06 00 00 00       	mov    $0x6,%eax
+  8019f3:	e8 4a fd ff ff       	call   801742 <fsipc>
+  8019f8:	85 c0                	test   %eax,%eax
+  8019fa:	0f 45 d8             	cmovne %eax,%ebx
+}
+  8019fd:	89 d8                	mov    %ebx,%eax
+  8019ff:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801a02:	5b                   	pop    %ebx
+  801a03:	5e                   	pop    %esi
+  801a04:	5d                   	pop    %ebp
+  801a05:	c3                   	ret
+		sys_page_unmap(0, fd2data(fd));
+  801a06:	83 ec 0c             	sub    $0xc,%esp
+  801a09:	56                   	push   %esi
+  801a0a:	e8 8e f5 ff ff       	call   800f9d <fd2data>
+  801a0f:	83 c4 08             	add    $0x8,%esp
+  801a12:	50                   	push   %eax
+  801a13:	6a 00                	push   $0x0
+  801a15:	e8 ff f1 ff ff       	call   800c19 <sys_page_unmap>
+  801a1a:	83 c4 10             	add    $0x10,%esp
+  801a1d:	eb c2                	jmp    8019e1 <devfile_flush+0x1c>
+
+00801a1f <fsring_slot>:
+
+// Find a free data page and get fdnum ready for a request on it.
+// Returns the slot number, or < 0 on error.
+static int
+fsring_slot(int fdnum, struct Fd **fd_store)
+{
+  801a1f:	55                   	push   %ebp
+  801a20:	89 e5                	mov    %esp,%ebp
+  801a22:	57                   	push   %edi
+  801a23:	56                   	push   %esi
+  801a24:	53                   	push   %ebx
+  801a25:	83 ec 64             	sub    $0x64,%esp
+  801a28:	89 d7                	mov    %edx,%edi
+	int r, slot;
+
+	if ((r = fd_lookup(fdnum, fd_store)) < 0)
+  801a2a:	52                   	push   %edx
+  801a2b:	50                   	push   %eax
+  801a2c:	e8 d9 f5 ff ff       	call   80100a <fd_lookup>
+  801a31:	89 c1                	mov    %eax,%ecx
+  801a33:	83 c4 10             	add    $0x10,%esp
+  801a36:	85 c0                	test   %eax,%eax
+  801a38:	0f 88 f2 00 00 00    	js     801b30 <fsring_slot+0x111>
+		return r;
+	if ((*fd_store)->fd_dev_id != devfile.dev_id)
+  801a3e:	8b 07                	mov    (%edi),%eax
+  801a40:	8b 15 20 40 80 00    	mov    0x804020,%edx
+  801a46:	39 10                	cmp    %edx,(%eax)
+  801a48:	0f 85 03 01 00 00    	jne    801b51 <fsring_slot+0x132>
+	if (fsring_env == thisenv->env_id)
+  801a4e:	a1 00 50 80 00       	mov    0x805000,%eax
+  801a53:	8b 40 48             	mov    0x48(%eax),%eax
+  801a56:	3b 05 c4 70 80 00    	cmp    0x8070c4,%eax
+  801a5c:	0f 84 96 00 00 00    	je     801af8 <fsring_slot+0xd9>
+	if (fsenv == 0)
+  801a62:	83 3d c8 70 80 00 00 	cmpl   $0x0,0x8070c8
+  801a69:	0f 84 cb 00 00 00    	je     801b3a <fsring_slot+0x11b>
+	pages[0] = (uintptr_t) &fsipcbuf | PTE_P | PTE_W | PTE_U;
+  801a6f:	b8 00 60 80 00       	mov    $0x806000,%eax
+  801a74:	83 c8 07             	or     $0x7,%eax
+  801a77:	89 45 a0             	mov    %eax,-0x60(%ebp)
+	for (i = 0; i < FSRING_NPAGES; i++) {
+  801a7a:	8d 75 a4             	lea    -0x5c(%ebp),%esi
+	pages[0] = (uintptr_t) &fsipcbuf | PTE_P | PTE_W | PTE_U;
+  801a7d:	bb 00 00 00 cf       	mov    $0xcf000000,%ebx
+		if ((r = sys_page_alloc(0, (char *) fsring + i * PGSIZE,
+  801a82:	83 ec 04             	sub    $0x4,%esp
+  801a85:	68 07 04 00 00       	push   $0x407
+  801a8a:	53                   	push   %ebx
+  801a8b:	6a 00                	push   $0x0
+  801a8d:	e8 fa f0 ff ff       	call   800b8c <sys_page_alloc>
+  801a92:	89 c1                	mov    %eax,%ecx
+  801a94:	83 c4 10             	add    $0x10,%esp
+  801a97:	85 c0                	test   %eax,%eax
+  801a99:	0f 88 91 00 00 00    	js     801b30 <fsring_slot+0x111>
+		pages[1 + i] = ((uintptr_t) fsring + i * PGSIZE) | PTE_P | PTE_W | PTE_U;
+  801a9f:	89 d8                	mov    %ebx,%eax
+  801aa1:	83 c8 07             	or     $0x7,%eax
+  801aa4:	89 06                	mov    %eax,(%esi)
+	for (i = 0; i < FSRING_NPAGES; i++) {
+  801aa6:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801aac:	83 c6 04             	add    $0x4,%esi
+  801aaf:	81 fb 00 10 01 cf    	cmp    $0xcf011000,%ebx
+  801ab5:	75 cb                	jne    801a82 <fsring_slot+0x63>
+	ipc_sendv(fsenv, FSREQ_RING_SETUP, pages, ARRAY_SIZE(pages));
+  801ab7:	6a 12                	push   $0x12
+  801ab9:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  801abc:	50                   	push   %eax
+  801abd:	6a 0c                	push   $0xc
+  801abf:	ff 35 c8 70 80 00    	push   0x8070c8
+  801ac5:	e8 2f 19 00 00       	call   8033f9 <ipc_sendv>
+	if ((r = ipc_recv(NULL, NULL, NULL)) < 0)
+  801aca:	83 c4 0c             	add    $0xc,%esp
+  801acd:	6a 00                	push   $0x0
+  801acf:	6a 00                	push   $0x0
+  801ad1:	6a 00                	push   $0x0
+  801ad3:	e8 cb 17 00 00       	call   8032a3 <ipc_recv>
+  801ad8:	89 c1                	mov    %eax,%ecx
+  801ada:	83 c4 10             	add    $0x10,%esp
+  801add:	85 c0                	test   %eax,%eax
+  801adf:	78 4f                	js     801b30 <fsring_slot+0x111>
+	fsring_env = thisenv->env_id;
+  801ae1:	a1 00 50 80 00       	mov    0x805000,%eax
+  801ae6:	8b 40 48             	mov    0x48(%eax),%eax
+  801ae9:	a3 c4 70 80 00       	mov    %eax,0x8070c4
+	fsring_busy = 0;
+  801aee:	c7 05 c0 70 80 00 00 	movl   $0x0,0x8070c0
+  801af5:	00 00 00 
+		return -E_NOT_SUPP;
+	if ((r = fsring_setup()) < 0)
+		return r;
+	// Buffered writes must reach the server ahead of anything posted.
+	if ((r = devfile_sync(*fd_store)) < 0)
+  801af8:	83 ec 0c             	sub    $0xc,%esp
+  801afb:	ff 37                	push   (%edi)
+  801afd:	e8 e4 fc ff ff       	call   8017e6 <devfile_sync>
+  801b02:	89 c1                	mov    %eax,%ecx
+  801b04:	83 c4 10             	add    $0x10,%esp
+  801b07:	85 c0                	test   %eax,%eax
+  801b09:	78 25                	js     801b30 <fsring_slot+0x111>
+		return r;
+	for (slot = 0; slot < FSRING_NSLOTS; slot++)
+		if (!(fsring_busy & (1 << slot)))
+  801b0b:	8b 1d c0 70 80 00    	mov    0x8070c0,%ebx
+	for (slot = 0; slot < FSRING_NSLOTS; slot++)
+  801b11:	b9 00 00 00 00       	mov    $0x0,%ecx
+		if (!(fsring_busy & (1 << slot)))
+  801b16:	ba 01 00 00 00       	mov    $0x1,%edx
+  801b1b:	89 d0                	mov    %edx,%eax
+  801b1d:	d3 e0                	shl    %cl,%eax
+  801b1f:	85 d8                	test   %ebx,%eax
+  801b21:	74 0d                	je     801b30 <fsring_slot+0x111>
+	for (slot = 0; slot < FSRING_NSLOTS; slot++)
+  801b23:	83 c1 01             	add    $0x1,%ecx
+  801b26:	83 f9 10             	cmp    $0x10,%ecx
+  801b29:	75 f0                	jne    801b1b <fsring_slot+0xfc>
+			return slot;
+	return -E_NO_MEM;
+  801b2b:	b9 fc ff ff ff       	mov    $0xfffffffc,%ecx
+}
+  801b30:	89 c8                	mov    %ecx,%eax
+  801b32:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801b35:	5b                   	pop    %ebx
+  801b36:	5e                   	pop    %esi
+  801b37:	5f                   	pop    %edi
+  801b38:	5d                   	pop    %ebp
+  801b39:	c3                   	ret
+		fsenv = ipc_find_env(ENV_TYPE_FS);
+  801b3a:	83 ec 0c             	sub    $0xc,%esp
+  801b3d:	6a 01                	push   $0x1
+  801b3f:	e8 03 19 00 00       	call   803447 <ipc_find_env>
+  801b44:	a3 c8 70 80 00       	mov    %eax,0x8070c8
+  801b49:	83 c4 10             	add    $0x10,%esp
+  801b4c:	e9 1e ff ff ff       	jmp    801a6f <fsring_slot+0x50>
+		return -E_NOT_SUPP;
+  801b51:	b9 f1 ff ff ff       	mov    $0xfffffff1,%ecx
+  801b56:	eb d8                	jmp    801b30 <fsring_slot+0x111>
+
+00801b58 <file_read_direct>:
+{
+  801b58:	55                   	push   %ebp
+  801b59:	89 e5                	mov    %esp,%ebp
+  801b5b:	57                   	push   %edi
+  801b5c:	56                   	push   %esi
+  801b5d:	53                   	push   %ebx
+  801b5e:	83 ec 1c             	sub    $0x1c,%esp
+  801b61:	89 c7                	mov    %eax,%edi
+  801b63:	89 d6                	mov    %edx,%esi
+  801b65:	89 cb                	mov    %ecx,%ebx
+	if (n > PGSIZE) {
+  801b67:	81 f9 00 10 00 00    	cmp    $0x1000,%ecx
+  801b6d:	77 52                	ja     801bc1 <file_read_direct+0x69>
+	fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801b6f:	8b 40 0c             	mov    0xc(%eax),%eax
+  801b72:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.read.req_n = n;
+  801b77:	89 0d 04 60 80 00    	mov    %ecx,0x806004
+	if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  801b7d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b82:	b8 03 00 00 00       	mov    $0x3,%eax
+  801b87:	e8 b6 fb ff ff       	call   801742 <fsipc>
+  801b8c:	89 c7                	mov    %eax,%edi
+  801b8e:	85 c0                	test   %eax,%eax
+  801b90:	78 25                	js     801bb7 <file_read_direct+0x5f>
+	assert(r <= n);
+  801b92:	39 c3                	cmp    %eax,%ebx
+  801b94:	0f 82 87 00 00 00    	jb     801c21 <file_read_direct+0xc9>
+	assert(r <= PGSIZE);
+  801b9a:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  801b9f:	0f 8f 95 00 00 00    	jg     801c3a <file_read_direct+0xe2>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  801ba5:	83 ec 04             	sub    $0x4,%esp
+  801ba8:	50                   	push   %eax
+  801ba9:	68 00 60 80 00       	push   $0x806000
+  801bae:	56                   	push   %esi
+  801baf:	e8 52 ed ff ff       	call   800906 <memmove>
+	return r;
+  801bb4:	83 c4 10             	add    $0x10,%esp
+}
+  801bb7:	89 f8                	mov    %edi,%eax
+  801bb9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801bbc:	5b                   	pop    %ebx
+  801bbd:	5e                   	pop    %esi
+  801bbe:	5f                   	pop    %edi
+  801bbf:	5d                   	pop    %ebp
+  801bc0:	c3                   	ret
+		n = MIN(n, FSBULK_MAXPAGES * PGSIZE - PGOFF(buf));
+  801bc1:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  801bc7:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  801bcc:	29 d1                	sub    %edx,%ecx
+  801bce:	39 d9                	cmp    %ebx,%ecx
+  801bd0:	0f 46 d9             	cmovbe %ecx,%ebx
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  801bd3:	89 f0                	mov    %esi,%eax
+  801bd5:	8d 0c 1e             	lea    (%esi,%ebx,1),%ecx
+  801bd8:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  801bdb:	eb 0f                	jmp    801bec <file_read_direct+0x94>
+		*(volatile char *) p = *(volatile char *) p;
+  801bdd:	0f b6 10             	movzbl (%eax),%edx
+  801be0:	88 10                	mov    %dl,(%eax)
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  801be2:	05 00 10 00 00       	add    $0x1000,%eax
+  801be7:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801bec:	39 c8                	cmp    %ecx,%eax
+  801bee:	72 ed                	jb     801bdd <file_read_direct+0x85>
+	fsipcbuf.bulk.req_fileid = fileid;
+  801bf0:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801bf3:	8b 47 0c             	mov    0xc(%edi),%eax
+  801bf6:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.bulk.req_n = n;
+  801bfb:	89 1d 04 60 80 00    	mov    %ebx,0x806004
+	fsipcbuf.bulk.req_off = PGOFF(buf);
+  801c01:	89 15 08 60 80 00    	mov    %edx,0x806008
+	return fsipc_pages(type, buf, n, perm);
+  801c07:	83 ec 0c             	sub    $0xc,%esp
+  801c0a:	6a 07                	push   $0x7
+  801c0c:	89 d9                	mov    %ebx,%ecx
+  801c0e:	89 f2                	mov    %esi,%edx
+  801c10:	b8 09 00 00 00       	mov    $0x9,%eax
+  801c15:	e8 86 f9 ff ff       	call   8015a0 <fsipc_pages>
+  801c1a:	89 c7                	mov    %eax,%edi
+		return fsipc_bulk(FSREQ_READ_BULK, fd->fd_file.id, buf, n,
+  801c1c:	83 c4 10             	add    $0x10,%esp
+  801c1f:	eb 96                	jmp    801bb7 <file_read_direct+0x5f>
+	assert(r <= n);
+  801c21:	68 40 3c 80 00       	push   $0x803c40
+  801c26:	68 20 3c 80 00       	push   $0x803c20
+  801c2b:	68 dc 00 00 00       	push   $0xdc
+  801c30:	68 35 3c 80 00       	push   $0x803c35
+  801c35:	e8 0e 13 00 00       	call   802f48 <_panic>
+	assert(r <= PGSIZE);
+  801c3a:	68 51 3c 80 00       	push   $0x803c51
+  801c3f:	68 20 3c 80 00       	push   $0x803c20
+  801c44:	68 dd 00 00 00       	push   $0xdd
+  801c49:	68 35 3c 80 00       	push   $0x803c35
+  801c4e:	e8 f5 12 00 00       	call   802f48 <_panic>
+
+00801c53 <devfile_read>:
+{
+  801c53:	55                   	push   %ebp
+  801c54:	89 e5                	mov    %esp,%ebp
+  801c56:	57                   	push   %edi
+  801c57:	56                   	push   %esi
+  801c58:	53                   	push   %ebx
+  801c59:	83 ec 28             	sub    $0x28,%esp
+  801c5c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  801c5f:	8b 75 10             	mov    0x10(%ebp),%esi
+	char *p = fd2data(fd);
+  801c62:	53                   	push   %ebx
+  801c63:	e8 35 f3 ff ff       	call   800f9d <fd2data>
+  801c68:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	off_t pos = fd->fd_offset;
+  801c6b:	8b 7b 04             	mov    0x4(%ebx),%edi
+	if (!ff->buffered)
+  801c6e:	83 c4 10             	add    $0x10,%esp
+  801c71:	80 7b 10 00          	cmpb   $0x0,0x10(%ebx)
+  801c75:	74 7d                	je     801cf4 <devfile_read+0xa1>
+	if (ff->buf_wlen > 0 && (r = devfile_sync(fd)) < 0)
+  801c77:	83 7b 1c 00          	cmpl   $0x0,0x1c(%ebx)
+  801c7b:	0f 85 81 00 00 00    	jne    801d02 <devfile_read+0xaf>
+	if (ff->buf_rlen == 0 || pos < ff->buf_base
+  801c81:	8b 43 18             	mov    0x18(%ebx),%eax
+  801c84:	85 c0                	test   %eax,%eax
+  801c86:	74 0d                	je     801c95 <devfile_read+0x42>
+  801c88:	8b 53 14             	mov    0x14(%ebx),%edx
+  801c8b:	39 fa                	cmp    %edi,%edx
+  801c8d:	7f 06                	jg     801c95 <devfile_read+0x42>
+	    || pos >= ff->buf_base + ff->buf_rlen) {
+  801c8f:	01 c2                	add    %eax,%edx
+  801c91:	39 d7                	cmp    %edx,%edi
+  801c93:	72 28                	jb     801cbd <devfile_read+0x6a>
+		ff->buf_rlen = 0;
+  801c95:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+		if (n >= FILEBUF_SIZE)
+  801c9c:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+  801ca2:	77 74                	ja     801d18 <devfile_read+0xc5>
+		if ((r = file_read_direct(fd, p, FILEBUF_SIZE)) <= 0)
+  801ca4:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  801ca9:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801cac:	89 d8                	mov    %ebx,%eax
+  801cae:	e8 a5 fe ff ff       	call   801b58 <file_read_direct>
+  801cb3:	85 c0                	test   %eax,%eax
+  801cb5:	7e 35                	jle    801cec <devfile_read+0x99>
+		ff->buf_base = pos;
+  801cb7:	89 7b 14             	mov    %edi,0x14(%ebx)
+		ff->buf_rlen = r;
+  801cba:	89 43 18             	mov    %eax,0x18(%ebx)
+	n = MIN(n, ff->buf_base + ff->buf_rlen - pos);
+  801cbd:	8b 53 14             	mov    0x14(%ebx),%edx
+  801cc0:	89 d0                	mov    %edx,%eax
+  801cc2:	03 43 18             	add    0x18(%ebx),%eax
+  801cc5:	29 f8                	sub    %edi,%eax
+  801cc7:	39 f0                	cmp    %esi,%eax
+  801cc9:	0f 46 f0             	cmovbe %eax,%esi
+	memmove(buf, p + (pos - ff->buf_base), n);
+  801ccc:	83 ec 04             	sub    $0x4,%esp
+  801ccf:	56                   	push   %esi
+  801cd0:	89 f8                	mov    %edi,%eax
+  801cd2:	29 d0                	sub    %edx,%eax
+  801cd4:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  801cd7:	01 c1                	add    %eax,%ecx
+  801cd9:	51                   	push   %ecx
+  801cda:	ff 75 0c             	push   0xc(%ebp)
+  801cdd:	e8 24 ec ff ff       	call   800906 <memmove>
+	fd->fd_offset = pos + n;
+  801ce2:	01 f7                	add    %esi,%edi
+  801ce4:	89 7b 04             	mov    %edi,0x4(%ebx)
+	return n;
+  801ce7:	89 f0                	mov    %esi,%eax
+  801ce9:	83 c4 10             	add    $0x10,%esp
+}
+  801cec:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801cef:	5b                   	pop    %ebx
+  801cf0:	5e                   	pop    %esi
+  801cf1:	5f                   	pop    %edi
+  801cf2:	5d                   	pop    %ebp
+  801cf3:	c3                   	ret
+		return file_read_direct(fd, buf, n);
+  801cf4:	89 f1                	mov    %esi,%ecx
+  801cf6:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801cf9:	89 d8                	mov    %ebx,%eax
+  801cfb:	e8 58 fe ff ff       	call   801b58 <file_read_direct>
+  801d00:	eb ea                	jmp    801cec <devfile_read+0x99>
+	if (ff->buf_wlen > 0 && (r = devfile_sync(fd)) < 0)
+  801d02:	83 ec 0c             	sub    $0xc,%esp
+  801d05:	53                   	push   %ebx
+  801d06:	e8 db fa ff ff       	call   8017e6 <devfile_sync>
+  801d0b:	83 c4 10             	add    $0x10,%esp
+  801d0e:	85 c0                	test   %eax,%eax
+  801d10:	0f 89 6b ff ff ff    	jns    801c81 <devfile_read+0x2e>
+  801d16:	eb d4                	jmp    801cec <devfile_read+0x99>
+			return file_read_direct(fd, buf, n);
+  801d18:	89 f1                	mov    %esi,%ecx
+  801d1a:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801d1d:	89 d8                	mov    %ebx,%eax
+  801d1f:	e8 34 fe ff ff       	call   801b58 <file_read_direct>
+  801d24:	eb c6                	jmp    801cec <devfile_read+0x99>
+
+00801d26 <open>:
+{
+  801d26:	55                   	push   %ebp
+  801d27:	89 e5                	mov    %esp,%ebp
+  801d29:	56                   	push   %esi
+  801d2a:	53                   	push   %ebx
+  801d2b:	83 ec 1c             	sub    $0x1c,%esp
+  801d2e:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (strlen(path) >= MAXPATHLEN)
+  801d31:	56                   	push   %esi
+  801d32:	e8 0e ea ff ff       	call   800745 <strlen>
+  801d37:	83 c4 10             	add    $0x10,%esp
+  801d3a:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801d3f:	0f 8f a0 00 00 00    	jg     801de5 <open+0xbf>
+	if ((r = fd_alloc(&fd)) < 0)
+  801d45:	83 ec 0c             	sub    $0xc,%esp
+  801d48:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801d4b:	50                   	push   %eax
+  801d4c:	e8 63 f2 ff ff       	call   800fb4 <fd_alloc>
+  801d51:	89 c3                	mov    %eax,%ebx
+  801d53:	83 c4 10             	add    $0x10,%esp
+  801d56:	85 c0                	test   %eax,%eax
+  801d58:	78 45                	js     801d9f <open+0x79>
+	strcpy(fsipcbuf.open.req_path, path);
+  801d5a:	83 ec 08             	sub    $0x8,%esp
+  801d5d:	56                   	push   %esi
+  801d5e:	68 00 60 80 00       	push   $0x806000
+  801d63:	e8 18 ea ff ff       	call   800780 <strcpy>
+	fsipcbuf.open.req_omode = mode;
+  801d68:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801d6b:	a3 00 64 80 00       	mov    %eax,0x806400
+	if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  801d70:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801d73:	b8 01 00 00 00       	mov    $0x1,%eax
+  801d78:	e8 c5 f9 ff ff       	call   801742 <fsipc>
+  801d7d:	89 c3                	mov    %eax,%ebx
+  801d7f:	83 c4 10             	add    $0x10,%esp
+  801d82:	85 c0                	test   %eax,%eax
+  801d84:	78 22                	js     801da8 <open+0x82>
+	if (!(mode & O_NOBUF)
+  801d86:	f7 45 0c 00 10 00 00 	testl  $0x1000,0xc(%ebp)
+  801d8d:	74 2b                	je     801dba <open+0x94>
+	return fd2num(fd);
+  801d8f:	83 ec 0c             	sub    $0xc,%esp
+  801d92:	ff 75 f4             	push   -0xc(%ebp)
+  801d95:	e8 f3 f1 ff ff       	call   800f8d <fd2num>
+  801d9a:	89 c3                	mov    %eax,%ebx
+  801d9c:	83 c4 10             	add    $0x10,%esp
+}
+  801d9f:	89 d8                	mov    %ebx,%eax
+  801da1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801da4:	5b                   	pop    %ebx
+  801da5:	5e                   	pop    %esi
+  801da6:	5d                   	pop    %ebp
+  801da7:	c3                   	ret
+		fd_close(fd, 0);
+  801da8:	83 ec 08             	sub    $0x8,%esp
+  801dab:	6a 00                	push   $0x0
+  801dad:	ff 75 f4             	push   -0xc(%ebp)
+  801db0:	e8 f8 f2 ff ff       	call   8010ad <fd_close>
+		return r;
+  801db5:	83 c4 10             	add    $0x10,%esp
+  801db8:	eb e5                	jmp    801d9f <open+0x79>
+	    && sys_page_alloc(0, fd2data(fd), PTE_P|PTE_U|PTE_W|PTE_SHARE) == 0)
+  801dba:	83 ec 0c             	sub    $0xc,%esp
+  801dbd:	ff 75 f4             	push   -0xc(%ebp)
+  801dc0:	e8 d8 f1 ff ff       	call   800f9d <fd2data>
+  801dc5:	83 c4 0c             	add    $0xc,%esp
+  801dc8:	68 07 04 00 00       	push   $0x407
+  801dcd:	50                   	push   %eax
+  801dce:	6a 00                	push   $0x0
+  801dd0:	e8 b7 ed ff ff       	call   800b8c <sys_page_alloc>
+  801dd5:	83 c4 10             	add    $0x10,%esp
+  801dd8:	85 c0                	test   %eax,%eax
+  801dda:	75 b3                	jne    801d8f <open+0x69>
+		fd->fd_file.buffered = 1;
+  801ddc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801ddf:	c6 40 10 01          	movb   $0x1,0x10(%eax)
+  801de3:	eb aa                	jmp    801d8f <open+0x69>
+		return -E_BAD_PATH;
+  801de5:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801dea:	eb b3                	jmp    801d9f <open+0x79>
+
+00801dec <readdir>:
+{
+  801dec:	55                   	push   %ebp
+  801ded:	89 e5                	mov    %esp,%ebp
+  801def:	53                   	push   %ebx
+  801df0:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801df3:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801df6:	50                   	push   %eax
+  801df7:	ff 75 08             	push   0x8(%ebp)
+  801dfa:	e8 0b f2 ff ff       	call   80100a <fd_lookup>
+  801dff:	89 c3                	mov    %eax,%ebx
+  801e01:	83 c4 10             	add    $0x10,%esp
+  801e04:	85 c0                	test   %eax,%eax
+  801e06:	78 73                	js     801e7b <readdir+0x8f>
+	if (fd->fd_dev_id != devfile.dev_id)
+  801e08:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801e0b:	8b 0d 20 40 80 00    	mov    0x804020,%ecx
+  801e11:	39 08                	cmp    %ecx,(%eax)
+  801e13:	0f 85 82 00 00 00    	jne    801e9b <readdir+0xaf>
+	if ((r = devfile_sync(fd)) < 0)
+  801e19:	83 ec 0c             	sub    $0xc,%esp
+  801e1c:	50                   	push   %eax
+  801e1d:	e8 c4 f9 ff ff       	call   8017e6 <devfile_sync>
+  801e22:	89 c3                	mov    %eax,%ebx
+  801e24:	83 c4 10             	add    $0x10,%esp
+  801e27:	85 c0                	test   %eax,%eax
+  801e29:	78 50                	js     801e7b <readdir+0x8f>
+	fsipcbuf.readdir.req_fileid = fd->fd_file.id;
+  801e2b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801e2e:	8b 40 0c             	mov    0xc(%eax),%eax
+  801e31:	a3 00 60 80 00       	mov    %eax,0x806000
+	fsipcbuf.readdir.req_n = n;
+  801e36:	8b 45 10             	mov    0x10(%ebp),%eax
+  801e39:	a3 04 60 80 00       	mov    %eax,0x806004
+	fsipcbuf.readdir.req_flags = flags;
+  801e3e:	8b 45 14             	mov    0x14(%ebp),%eax
+  801e41:	a3 08 60 80 00       	mov    %eax,0x806008
+	if ((r = fsipc(FSREQ_READDIR, NULL)) <= 0)
+  801e46:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e4b:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801e50:	e8 ed f8 ff ff       	call   801742 <fsipc>
+  801e55:	89 c3                	mov    %eax,%ebx
+  801e57:	85 c0                	test   %eax,%eax
+  801e59:	7e 20                	jle    801e7b <readdir+0x8f>
+	assert(r <= n && r <= PGSIZE);
+  801e5b:	39 45 10             	cmp    %eax,0x10(%ebp)
+  801e5e:	72 22                	jb     801e82 <readdir+0x96>
+  801e60:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  801e65:	7f 1b                	jg     801e82 <readdir+0x96>
+	memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  801e67:	83 ec 04             	sub    $0x4,%esp
+  801e6a:	50                   	push   %eax
+  801e6b:	68 00 60 80 00       	push   $0x806000
+  801e70:	ff 75 0c             	push   0xc(%ebp)
+  801e73:	e8 8e ea ff ff       	call   800906 <memmove>
+	return r;
+  801e78:	83 c4 10             	add    $0x10,%esp
+}
+  801e7b:	89 d8                	mov    %ebx,%eax
+  801e7d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801e80:	c9                   	leave
+  801e81:	c3                   	ret
+	assert(r <= n && r <= PGSIZE);
+  801e82:	68 47 3c 80 00       	push   $0x803c47
+  801e87:	68 20 3c 80 00       	push   $0x803c20
+  801e8c:	68 86 01 00 00       	push   $0x186
+  801e91:	68 35 3c 80 00       	push   $0x803c35
+  801e96:	e8 ad 10 00 00       	call   802f48 <_panic>
+		return -E_NOT_SUPP;
+  801e9b:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  801ea0:	eb d9                	jmp    801e7b <readdir+0x8f>
+
+00801ea2 <munmap>:
+{
+  801ea2:	55                   	push   %ebp
+  801ea3:	89 e5                	mov    %esp,%ebp
+  801ea5:	56                   	push   %esi
+  801ea6:	53                   	push   %ebx
+  801ea7:	8b 75 08             	mov    0x8(%ebp),%esi
+  801eaa:	8b 55 0c             	mov    0xc(%ebp),%edx
+	if (PGOFF(addr) || (uintptr_t) addr >= UTOP || len > UTOP - (uintptr_t) addr)
+  801ead:	f7 c6 ff 0f 00 00    	test   $0xfff,%esi
+  801eb3:	75 41                	jne    801ef6 <munmap+0x54>
+  801eb5:	81 fe ff ff bf ee    	cmp    $0xeebfffff,%esi
+  801ebb:	77 39                	ja     801ef6 <munmap+0x54>
+  801ebd:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  801ec2:	29 f0                	sub    %esi,%eax
+  801ec4:	39 d0                	cmp    %edx,%eax
+  801ec6:	72 35                	jb     801efd <munmap+0x5b>
+	for (va = (uintptr_t) addr; va < (uintptr_t) addr + len; va += PGSIZE)
+  801ec8:	89 f3                	mov    %esi,%ebx
+  801eca:	01 d6                	add    %edx,%esi
+  801ecc:	39 f3                	cmp    %esi,%ebx
+  801ece:	73 1a                	jae    801eea <munmap+0x48>
+		if ((r = sys_page_unmap(0, (void *) va)) < 0)
+  801ed0:	83 ec 08             	sub    $0x8,%esp
+  801ed3:	53                   	push   %ebx
+  801ed4:	6a 00                	push   $0x0
+  801ed6:	e8 3e ed ff ff       	call   800c19 <sys_page_unmap>
+  801edb:	83 c4 10             	add    $0x10,%esp
+  801ede:	85 c0                	test   %eax,%eax
+  801ee0:	78 0d                	js     801eef <munmap+0x4d>
+	for (va = (uintptr_t) addr; va < (uintptr_t) addr + len; va += PGSIZE)
+  801ee2:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801ee8:	eb e2                	jmp    801ecc <munmap+0x2a>
+	return 0;
+  801eea:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801eef:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801ef2:	5b                   	pop    %ebx
+  801ef3:	5e                   	pop    %esi
+  801ef4:	5d                   	pop    %ebp
+  801ef5:	c3                   	ret
+		return -E_INVAL;
+  801ef6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801efb:	eb f2                	jmp    801eef <munmap+0x4d>
+  801efd:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801f02:	eb eb                	jmp    801eef <munmap+0x4d>
+
+00801f04 <mmap>:
+{
+  801f04:	55                   	push   %ebp
+  801f05:	89 e5                	mov    %esp,%ebp
+  801f07:	57                   	push   %edi
+  801f08:	56                   	push   %esi
+  801f09:	53                   	push   %ebx
+  801f0a:	83 ec 34             	sub    $0x34,%esp
+  801f0d:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801f10:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801f13:	50                   	push   %eax
+  801f14:	ff 75 18             	push   0x18(%ebp)
+  801f17:	e8 ee f0 ff ff       	call   80100a <fd_lookup>
+  801f1c:	89 c3                	mov    %eax,%ebx
+  801f1e:	83 c4 10             	add    $0x10,%esp
+  801f21:	85 c0                	test   %eax,%eax
+  801f23:	0f 88 0e 01 00 00    	js     802037 <mmap+0x133>
+	if (fd->fd_dev_id != devfile.dev_id)
+  801f29:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801f2c:	a1 20 40 80 00       	mov    0x804020,%eax
+  801f31:	39 02                	cmp    %eax,(%edx)
+  801f33:	0f 85 50 01 00 00    	jne    802089 <mmap+0x185>
+	if ((prot & PROT_WRITE) && !(flags & MAP_PRIVATE))
+  801f39:	8b 45 10             	mov    0x10(%ebp),%eax
+  801f3c:	83 e0 02             	and    $0x2,%eax
+  801f3f:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  801f42:	74 0a                	je     801f4e <mmap+0x4a>
+  801f44:	f6 45 14 02          	testb  $0x2,0x14(%ebp)
+  801f48:	0f 84 42 01 00 00    	je     802090 <mmap+0x18c>
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY
+  801f4e:	8b 42 08             	mov    0x8(%edx),%eax
+  801f51:	83 e0 03             	and    $0x3,%eax
+  801f54:	83 f8 01             	cmp    $0x1,%eax
+  801f57:	0f 84 3a 01 00 00    	je     802097 <mmap+0x193>
+	    || PGOFF(addr) || PGOFF(offset) || offset < 0
+  801f5d:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f60:	0b 45 1c             	or     0x1c(%ebp),%eax
+  801f63:	25 ff 0f 00 00       	and    $0xfff,%eax
+  801f68:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  801f6b:	0f 85 2d 01 00 00    	jne    80209e <mmap+0x19a>
+	    || (uintptr_t) addr >= UTOP || len > UTOP - (uintptr_t) addr)
+  801f71:	83 7d 1c 00          	cmpl   $0x0,0x1c(%ebp)
+  801f75:	0f 88 2a 01 00 00    	js     8020a5 <mmap+0x1a1>
+  801f7b:	81 7d 08 ff ff bf ee 	cmpl   $0xeebfffff,0x8(%ebp)
+  801f82:	0f 87 1d 01 00 00    	ja     8020a5 <mmap+0x1a1>
+  801f88:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  801f8d:	2b 45 08             	sub    0x8(%ebp),%eax
+  801f90:	39 f8                	cmp    %edi,%eax
+  801f92:	0f 82 14 01 00 00    	jb     8020ac <mmap+0x1a8>
+	if ((r = devfile_sync(fd)) < 0)
+  801f98:	83 ec 0c             	sub    $0xc,%esp
+  801f9b:	52                   	push   %edx
+  801f9c:	e8 45 f8 ff ff       	call   8017e6 <devfile_sync>
+  801fa1:	89 c3                	mov    %eax,%ebx
+  801fa3:	83 c4 10             	add    $0x10,%esp
+  801fa6:	85 c0                	test   %eax,%eax
+  801fa8:	0f 88 89 00 00 00    	js     802037 <mmap+0x133>
+	len = ROUNDUP(len, PGSIZE);
+  801fae:	81 c7 ff 0f 00 00    	add    $0xfff,%edi
+  801fb4:	81 e7 00 f0 ff ff    	and    $0xfffff000,%edi
+	for (done = 0; done < len; done += n * PGSIZE) {
+  801fba:	be 00 00 00 00       	mov    $0x0,%esi
+  801fbf:	8b 5d 1c             	mov    0x1c(%ebp),%ebx
+  801fc2:	39 fe                	cmp    %edi,%esi
+  801fc4:	73 7b                	jae    802041 <mmap+0x13d>
+		n = MIN((len - done) / PGSIZE, FSBULK_MAXPAGES);
+  801fc6:	89 f8                	mov    %edi,%eax
+  801fc8:	29 f0                	sub    %esi,%eax
+  801fca:	c1 e8 0c             	shr    $0xc,%eax
+  801fcd:	ba 40 00 00 00       	mov    $0x40,%edx
+  801fd2:	39 d0                	cmp    %edx,%eax
+  801fd4:	0f 47 c2             	cmova  %edx,%eax
+  801fd7:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		fsipcbuf.map.req_fileid = fd->fd_file.id;
+  801fda:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801fdd:	8b 52 0c             	mov    0xc(%edx),%edx
+  801fe0:	89 15 00 60 80 00    	mov    %edx,0x806000
+		fsipcbuf.map.req_offset = offset + done;
+  801fe6:	8d 14 33             	lea    (%ebx,%esi,1),%edx
+  801fe9:	89 15 04 60 80 00    	mov    %edx,0x806004
+		fsipcbuf.map.req_npages = n;
+  801fef:	a3 08 60 80 00       	mov    %eax,0x806008
+		if ((r = fsipcv(FSREQ_MAP, addr + done, &n)) <= 0 || n == 0) {
+  801ff4:	89 f2                	mov    %esi,%edx
+  801ff6:	03 55 08             	add    0x8(%ebp),%edx
+  801ff9:	8d 4d e0             	lea    -0x20(%ebp),%ecx
+  801ffc:	b8 0b 00 00 00       	mov    $0xb,%eax
+  802001:	e8 ea f6 ff ff       	call   8016f0 <fsipcv>
+  802006:	85 c0                	test   %eax,%eax
+  802008:	7e 12                	jle    80201c <mmap+0x118>
+  80200a:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80200d:	85 c0                	test   %eax,%eax
+  80200f:	0f 84 9e 00 00 00    	je     8020b3 <mmap+0x1af>
+	for (done = 0; done < len; done += n * PGSIZE) {
+  802015:	c1 e0 0c             	shl    $0xc,%eax
+  802018:	01 c6                	add    %eax,%esi
+  80201a:	eb a6                	jmp    801fc2 <mmap+0xbe>
+			munmap(addr, done);
+  80201c:	89 c3                	mov    %eax,%ebx
+  80201e:	83 ec 08             	sub    $0x8,%esp
+  802021:	56                   	push   %esi
+  802022:	ff 75 08             	push   0x8(%ebp)
+  802025:	e8 78 fe ff ff       	call   801ea2 <munmap>
+			return r < 0 ? r : -E_INVAL;
+  80202a:	83 c4 10             	add    $0x10,%esp
+  80202d:	85 db                	test   %ebx,%ebx
+  80202f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802034:	0f 49 d8             	cmovns %eax,%ebx
+}
+  802037:	89 d8                	mov    %ebx,%eax
+  802039:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80203c:	5b                   	pop    %ebx
+  80203d:	5e                   	pop    %esi
+  80203e:	5f                   	pop    %edi
+  80203f:	5d                   	pop    %ebp
+  802040:	c3                   	ret
+	if (prot & PROT_WRITE)
+  802041:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+	return 0;
+  802044:	89 c3                	mov    %eax,%ebx
+	if (prot & PROT_WRITE)
+  802046:	85 c0                	test   %eax,%eax
+  802048:	74 ed                	je     802037 <mmap+0x133>
+		for (done = 0; done < len; done += PGSIZE)
+  80204a:	be 00 00 00 00       	mov    $0x0,%esi
+  80204f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  802052:	39 fe                	cmp    %edi,%esi
+  802054:	73 2e                	jae    802084 <mmap+0x180>
+			if ((r = cowpage(addr + done)) < 0) {
+  802056:	83 ec 0c             	sub    $0xc,%esp
+  802059:	8d 04 33             	lea    (%ebx,%esi,1),%eax
+  80205c:	50                   	push   %eax
+  80205d:	e8 43 10 00 00       	call   8030a5 <cowpage>
+  802062:	83 c4 10             	add    $0x10,%esp
+  802065:	85 c0                	test   %eax,%eax
+  802067:	78 08                	js     802071 <mmap+0x16d>
+		for (done = 0; done < len; done += PGSIZE)
+  802069:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  80206f:	eb e1                	jmp    802052 <mmap+0x14e>
+				munmap(addr, len);
+  802071:	89 c3                	mov    %eax,%ebx
+  802073:	83 ec 08             	sub    $0x8,%esp
+  802076:	57                   	push   %edi
+  802077:	ff 75 08             	push   0x8(%ebp)
+  80207a:	e8 23 fe ff ff       	call   801ea2 <munmap>
+				return r;
+  80207f:	83 c4 10             	add    $0x10,%esp
+  802082:	eb b3                	jmp    802037 <mmap+0x133>
+	return 0;
+  802084:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  802087:	eb ae                	jmp    802037 <mmap+0x133>
+		return -E_NOT_SUPP;
+  802089:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  80208e:	eb a7                	jmp    802037 <mmap+0x133>
+		return -E_NOT_SUPP;
+  802090:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  802095:	eb a0                	jmp    802037 <mmap+0x133>
+		return -E_INVAL;
+  802097:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  80209c:	eb 99                	jmp    802037 <mmap+0x133>
+  80209e:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  8020a3:	eb 92                	jmp    802037 <mmap+0x133>
+  8020a5:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  8020aa:	eb 8b                	jmp    802037 <mmap+0x133>
+  8020ac:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  8020b1:	eb 84                	jmp    802037 <mmap+0x133>
+			munmap(addr, done);
+  8020b3:	83 ec 08             	sub    $0x8,%esp
+  8020b6:	56                   	push   %esi
+  8020b7:	ff 75 08             	push   0x8(%ebp)
+  8020ba:	e8 e3 fd ff ff       	call   801ea2 <munmap>
+  8020bf:	83 c4 10             	add    $0x10,%esp
+			return r < 0 ? r : -E_INVAL;
+  8020c2:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  8020c7:	e9 6b ff ff ff       	jmp    802037 <mmap+0x133>
+
+008020cc <fsring_read>:
+// buf.  fsring_reap returns 'tag' with the result once done.
+// Returns 0 on success, < 0 on error; -E_NO_MEM means too many requests
+// are outstanding, and some must be reaped first.
+int
+fsring_read(int fdnum, void *buf, size_t n, off_t offset, uint32_t tag)
+{
+  8020cc:	55                   	push   %ebp
+  8020cd:	89 e5                	mov    %esp,%ebp
+  8020cf:	56                   	push   %esi
+  8020d0:	53                   	push   %ebx
+  8020d1:	83 ec 10             	sub    $0x10,%esp
+  8020d4:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	struct Fd *fd;
+	int slot;
+
+	if ((slot = fsring_slot(fdnum, &fd)) < 0)
+  8020d7:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8020da:	8b 45 08             	mov    0x8(%ebp),%eax
+  8020dd:	e8 3d f9 ff ff       	call   801a1f <fsring_slot>
+  8020e2:	85 c0                	test   %eax,%eax
+  8020e4:	78 60                	js     802146 <fsring_read+0x7a>
+		return slot;
+	if ((fd->fd_omode & O_ACCMODE) == O_WRONLY)
+  8020e6:	8b 75 f4             	mov    -0xc(%ebp),%esi
+  8020e9:	8b 56 08             	mov    0x8(%esi),%edx
+  8020ec:	83 e2 03             	and    $0x3,%edx
+  8020ef:	83 fa 01             	cmp    $0x1,%edx
+  8020f2:	74 59                	je     80214d <fsring_read+0x81>
+		return -E_INVAL;
+	fsring_busy |= 1 << slot;
+  8020f4:	ba 01 00 00 00       	mov    $0x1,%edx
+  8020f9:	89 c1                	mov    %eax,%ecx
+  8020fb:	d3 e2                	shl    %cl,%edx
+  8020fd:	09 15 c0 70 80 00    	or     %edx,0x8070c0
+	fsring_slots[slot].s_type = FSREQ_READ;
+  802103:	8d 14 40             	lea    (%eax,%eax,2),%edx
+  802106:	c1 e2 02             	shl    $0x2,%edx
+  802109:	8d 8a 00 70 80 00    	lea    0x807000(%edx),%ecx
+  80210f:	c7 82 00 70 80 00 03 	movl   $0x3,0x807000(%edx)
+  802116:	00 00 00 
+	fsring_slots[slot].s_tag = tag;
+  802119:	8b 55 18             	mov    0x18(%ebp),%edx
+  80211c:	89 51 04             	mov    %edx,0x4(%ecx)
+	fsring_slots[slot].s_buf = buf;
+  80211f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802122:	89 51 08             	mov    %edx,0x8(%ecx)
+	return fsring_post(FSREQ_READ, fd, offset, MIN(n, PGSIZE), slot);
+  802125:	83 ec 08             	sub    $0x8,%esp
+  802128:	50                   	push   %eax
+  802129:	b8 00 10 00 00       	mov    $0x1000,%eax
+  80212e:	39 c3                	cmp    %eax,%ebx
+  802130:	0f 47 d8             	cmova  %eax,%ebx
+  802133:	53                   	push   %ebx
+  802134:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  802137:	89 f2                	mov    %esi,%edx
+  802139:	b8 03 00 00 00       	mov    $0x3,%eax
+  80213e:	e8 1e f5 ff ff       	call   801661 <fsring_post>
+  802143:	83 c4 10             	add    $0x10,%esp
+}
+  802146:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802149:	5b                   	pop    %ebx
+  80214a:	5e                   	pop    %esi
+  80214b:	5d                   	pop    %ebp
+  80214c:	c3                   	ret
+		return -E_INVAL;
+  80214d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802152:	eb f2                	jmp    802146 <fsring_read+0x7a>
+
+00802154 <fsring_write>:
+// Start writing up to n bytes (at most a page) from buf at 'offset' of
+// fdnum.  buf may be reused as soon as this returns.
+// Returns as fsring_read.
+int
+fsring_write(int fdnum, const void *buf, size_t n, off_t offset, uint32_t tag)
+{
+  802154:	55                   	push   %ebp
+  802155:	89 e5                	mov    %esp,%ebp
+  802157:	56                   	push   %esi
+  802158:	53                   	push   %ebx
+  802159:	83 ec 10             	sub    $0x10,%esp
+  80215c:	8b 75 10             	mov    0x10(%ebp),%esi
+	struct Fd *fd;
+	int slot;
+
+	if ((slot = fsring_slot(fdnum, &fd)) < 0)
+  80215f:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802162:	8b 45 08             	mov    0x8(%ebp),%eax
+  802165:	e8 b5 f8 ff ff       	call   801a1f <fsring_slot>
+  80216a:	89 c3                	mov    %eax,%ebx
+  80216c:	85 c0                	test   %eax,%eax
+  80216e:	78 77                	js     8021e7 <fsring_write+0x93>
+		return slot;
+	if ((fd->fd_omode & O_ACCMODE) == O_RDONLY)
+  802170:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802173:	f6 40 08 03          	testb  $0x3,0x8(%eax)
+  802177:	74 77                	je     8021f0 <fsring_write+0x9c>
+		return -E_INVAL;
+	n = MIN(n, PGSIZE);
+  802179:	b8 00 10 00 00       	mov    $0x1000,%eax
+  80217e:	39 c6                	cmp    %eax,%esi
+  802180:	0f 47 f0             	cmova  %eax,%esi
+	memmove((char *) fsring + (1 + slot) * PGSIZE, buf, n);
+  802183:	83 ec 04             	sub    $0x4,%esp
+  802186:	56                   	push   %esi
+  802187:	ff 75 0c             	push   0xc(%ebp)
+  80218a:	89 d8                	mov    %ebx,%eax
+  80218c:	c1 e0 0c             	shl    $0xc,%eax
+  80218f:	8d 80 00 10 00 cf    	lea    -0x30fff000(%eax),%eax
+  802195:	50                   	push   %eax
+  802196:	e8 6b e7 ff ff       	call   800906 <memmove>
+	fsring_busy |= 1 << slot;
+  80219b:	b8 01 00 00 00       	mov    $0x1,%eax
+  8021a0:	89 d9                	mov    %ebx,%ecx
+  8021a2:	d3 e0                	shl    %cl,%eax
+  8021a4:	09 05 c0 70 80 00    	or     %eax,0x8070c0
+	fsring_slots[slot].s_type = FSREQ_WRITE;
+  8021aa:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  8021ad:	c1 e0 02             	shl    $0x2,%eax
+  8021b0:	8d 90 00 70 80 00    	lea    0x807000(%eax),%edx
+  8021b6:	c7 80 00 70 80 00 04 	movl   $0x4,0x807000(%eax)
+  8021bd:	00 00 00 
+	fsring_slots[slot].s_tag = tag;
+  8021c0:	8b 45 18             	mov    0x18(%ebp),%eax
+  8021c3:	89 42 04             	mov    %eax,0x4(%edx)
+	fsring_slots[slot].s_buf = NULL;
+  8021c6:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	return fsring_post(FSREQ_WRITE, fd, offset, n, slot);
+  8021cd:	83 c4 08             	add    $0x8,%esp
+  8021d0:	53                   	push   %ebx
+  8021d1:	56                   	push   %esi
+  8021d2:	8b 4d 14             	mov    0x14(%ebp),%ecx
+  8021d5:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8021d8:	b8 04 00 00 00       	mov    $0x4,%eax
+  8021dd:	e8 7f f4 ff ff       	call   801661 <fsring_post>
+  8021e2:	89 c3                	mov    %eax,%ebx
+  8021e4:	83 c4 10             	add    $0x10,%esp
+}
+  8021e7:	89 d8                	mov    %ebx,%eax
+  8021e9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8021ec:	5b                   	pop    %ebx
+  8021ed:	5e                   	pop    %esi
+  8021ee:	5d                   	pop    %ebp
+  8021ef:	c3                   	ret
+		return -E_INVAL;
+  8021f0:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  8021f5:	eb f0                	jmp    8021e7 <fsring_write+0x93>
+
+008021f7 <fsring_stat>:
+
+// Start a stat of fdnum into *st.  Returns as fsring_read.
+int
+fsring_stat(int fdnum, struct Stat *st, uint32_t tag)
+{
+  8021f7:	55                   	push   %ebp
+  8021f8:	89 e5                	mov    %esp,%ebp
+  8021fa:	83 ec 18             	sub    $0x18,%esp
+	struct Fd *fd;
+	int slot;
+
+	if ((slot = fsring_slot(fdnum, &fd)) < 0)
+  8021fd:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  802200:	8b 45 08             	mov    0x8(%ebp),%eax
+  802203:	e8 17 f8 ff ff       	call   801a1f <fsring_slot>
+  802208:	85 c0                	test   %eax,%eax
+  80220a:	78 4c                	js     802258 <fsring_stat+0x61>
+		return slot;
+	fsring_busy |= 1 << slot;
+  80220c:	ba 01 00 00 00       	mov    $0x1,%edx
+  802211:	89 c1                	mov    %eax,%ecx
+  802213:	d3 e2                	shl    %cl,%edx
+  802215:	09 15 c0 70 80 00    	or     %edx,0x8070c0
+	fsring_slots[slot].s_type = FSREQ_STAT;
+  80221b:	8d 14 40             	lea    (%eax,%eax,2),%edx
+  80221e:	c1 e2 02             	shl    $0x2,%edx
+  802221:	8d 8a 00 70 80 00    	lea    0x807000(%edx),%ecx
+  802227:	c7 82 00 70 80 00 05 	movl   $0x5,0x807000(%edx)
+  80222e:	00 00 00 
+	fsring_slots[slot].s_tag = tag;
+  802231:	8b 55 10             	mov    0x10(%ebp),%edx
+  802234:	89 51 04             	mov    %edx,0x4(%ecx)
+	fsring_slots[slot].s_buf = st;
+  802237:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80223a:	89 51 08             	mov    %edx,0x8(%ecx)
+	return fsring_post(FSREQ_STAT, fd, 0, 0, slot);
+  80223d:	83 ec 08             	sub    $0x8,%esp
+  802240:	50                   	push   %eax
+  802241:	6a 00                	push   $0x0
+  802243:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802248:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80224b:	b8 05 00 00 00       	mov    $0x5,%eax
+  802250:	e8 0c f4 ff ff       	call   801661 <fsring_post>
+  802255:	83 c4 10             	add    $0x10,%esp
+}
+  802258:	c9                   	leave
+  802259:	c3                   	ret
+
+0080225a <fsring_reap>:
+// If none has finished, wait for one if 'wait' is set and any are
+// outstanding.
+// Returns 1 if a result was collected, 0 if not.
+int
+fsring_reap(uint32_t *tag_store, int *result_store, bool wait)
+{
+  80225a:	55                   	push   %ebp
+  80225b:	89 e5                	mov    %esp,%ebp
+  80225d:	57                   	push   %edi
+  80225e:	56                   	push   %esi
+  80225f:	53                   	push   %ebx
+  802260:	83 ec 1c             	sub    $0x1c,%esp
+  802263:	0f b6 5d 10          	movzbl 0x10(%ebp),%ebx
+	struct Fsring_cqe cqe;
+	struct Fsret_stat *ret;
+	struct Stat *st;
+	char *data;
+
+	if (fsring_env != thisenv->env_id)
+  802267:	a1 00 50 80 00       	mov    0x805000,%eax
+  80226c:	8b 40 48             	mov    0x48(%eax),%eax
+  80226f:	3b 05 c4 70 80 00    	cmp    0x8070c4,%eax
+  802275:	74 12                	je     802289 <fsring_reap+0x2f>
+		return 0;
+  802277:	b8 00 00 00 00       	mov    $0x0,%eax
+	}
+	fsring_busy &= ~(1 << cqe.cqe_slot);
+	*tag_store = fsring_slots[cqe.cqe_slot].s_tag;
+	*result_store = cqe.cqe_result;
+	return 1;
+}
+  80227c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80227f:	5b                   	pop    %ebx
+  802280:	5e                   	pop    %esi
+  802281:	5f                   	pop    %edi
+  802282:	5d                   	pop    %ebp
+  802283:	c3                   	ret
+		sys_yield();
+  802284:	e8 e4 e8 ff ff       	call   800b6d <sys_yield>
+	while (fsring->r_cqhead == fsring->r_cqtail) {
+  802289:	8b 15 08 00 00 cf    	mov    0xcf000008,%edx
+  80228f:	a1 0c 00 00 cf       	mov    0xcf00000c,%eax
+  802294:	39 c2                	cmp    %eax,%edx
+  802296:	75 18                	jne    8022b0 <fsring_reap+0x56>
+		if (!wait || fsring_busy == 0)
+  802298:	84 db                	test   %bl,%bl
+  80229a:	0f 84 21 01 00 00    	je     8023c1 <fsring_reap+0x167>
+  8022a0:	83 3d c0 70 80 00 00 	cmpl   $0x0,0x8070c0
+  8022a7:	75 db                	jne    802284 <fsring_reap+0x2a>
+			return 0;
+  8022a9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8022ae:	eb cc                	jmp    80227c <fsring_reap+0x22>
+	cqe = fsring->r_cq[fsring->r_cqhead % FSRING_NSLOTS];
+  8022b0:	a1 08 00 00 cf       	mov    0xcf000008,%eax
+  8022b5:	83 e0 0f             	and    $0xf,%eax
+  8022b8:	83 c0 2a             	add    $0x2a,%eax
+  8022bb:	8b 1c c5 00 00 00 cf 	mov    -0x31000000(,%eax,8),%ebx
+  8022c2:	8b 3c c5 04 00 00 cf 	mov    -0x30fffffc(,%eax,8),%edi
+	fsring->r_cqhead++;
+  8022c9:	a1 08 00 00 cf       	mov    0xcf000008,%eax
+  8022ce:	83 c0 01             	add    $0x1,%eax
+  8022d1:	a3 08 00 00 cf       	mov    %eax,0xcf000008
+	if (cqe.cqe_slot >= FSRING_NSLOTS || !(fsring_busy & (1 << cqe.cqe_slot)))
+  8022d6:	83 fb 0f             	cmp    $0xf,%ebx
+  8022d9:	77 5b                	ja     802336 <fsring_reap+0xdc>
+  8022db:	be 01 00 00 00       	mov    $0x1,%esi
+  8022e0:	89 d9                	mov    %ebx,%ecx
+  8022e2:	d3 e6                	shl    %cl,%esi
+  8022e4:	89 f0                	mov    %esi,%eax
+  8022e6:	23 05 c0 70 80 00    	and    0x8070c0,%eax
+  8022ec:	74 48                	je     802336 <fsring_reap+0xdc>
+	data = (char *) fsring + (1 + cqe.cqe_slot) * PGSIZE;
+  8022ee:	89 d8                	mov    %ebx,%eax
+  8022f0:	c1 e0 0c             	shl    $0xc,%eax
+  8022f3:	8d 80 00 10 00 cf    	lea    -0x30fff000(%eax),%eax
+  8022f9:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	switch (fsring_slots[cqe.cqe_slot].s_type) {
+  8022fc:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  8022ff:	8b 04 85 00 70 80 00 	mov    0x807000(,%eax,4),%eax
+  802306:	83 f8 03             	cmp    $0x3,%eax
+  802309:	74 40                	je     80234b <fsring_reap+0xf1>
+  80230b:	83 f8 05             	cmp    $0x5,%eax
+  80230e:	74 64                	je     802374 <fsring_reap+0x11a>
+	fsring_busy &= ~(1 << cqe.cqe_slot);
+  802310:	f7 d6                	not    %esi
+  802312:	21 35 c0 70 80 00    	and    %esi,0x8070c0
+	*tag_store = fsring_slots[cqe.cqe_slot].s_tag;
+  802318:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  80231b:	8b 14 85 04 70 80 00 	mov    0x807004(,%eax,4),%edx
+  802322:	8b 45 08             	mov    0x8(%ebp),%eax
+  802325:	89 10                	mov    %edx,(%eax)
+	*result_store = cqe.cqe_result;
+  802327:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80232a:	89 38                	mov    %edi,(%eax)
+	return 1;
+  80232c:	b8 01 00 00 00       	mov    $0x1,%eax
+  802331:	e9 46 ff ff ff       	jmp    80227c <fsring_reap+0x22>
+		panic("fsring_reap: bad slot %u", cqe.cqe_slot);
+  802336:	53                   	push   %ebx
+  802337:	68 5d 3c 80 00       	push   $0x803c5d
+  80233c:	68 8f 02 00 00       	push   $0x28f
+  802341:	68 35 3c 80 00       	push   $0x803c35
+  802346:	e8 fd 0b 00 00       	call   802f48 <_panic>
+		if (cqe.cqe_result > 0)
+  80234b:	85 ff                	test   %edi,%edi
+  80234d:	7e c1                	jle    802310 <fsring_reap+0xb6>
+			memmove(fsring_slots[cqe.cqe_slot].s_buf, data,
+  80234f:	83 ec 04             	sub    $0x4,%esp
+				MIN(cqe.cqe_result, PGSIZE));
+  802352:	b8 00 10 00 00       	mov    $0x1000,%eax
+  802357:	39 c7                	cmp    %eax,%edi
+  802359:	0f 4e c7             	cmovle %edi,%eax
+			memmove(fsring_slots[cqe.cqe_slot].s_buf, data,
+  80235c:	50                   	push   %eax
+  80235d:	ff 75 e4             	push   -0x1c(%ebp)
+  802360:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  802363:	ff 34 85 08 70 80 00 	push   0x807008(,%eax,4)
+  80236a:	e8 97 e5 ff ff       	call   800906 <memmove>
+  80236f:	83 c4 10             	add    $0x10,%esp
+  802372:	eb 9c                	jmp    802310 <fsring_reap+0xb6>
+		if (cqe.cqe_result == 0) {
+  802374:	85 ff                	test   %edi,%edi
+  802376:	75 98                	jne    802310 <fsring_reap+0xb6>
+			st = fsring_slots[cqe.cqe_slot].s_buf;
+  802378:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+  80237b:	8b 0c 85 08 70 80 00 	mov    0x807008(,%eax,4),%ecx
+			strcpy(st->st_name, ret->ret_name);
+  802382:	83 ec 08             	sub    $0x8,%esp
+  802385:	ff 75 e4             	push   -0x1c(%ebp)
+  802388:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  80238b:	51                   	push   %ecx
+  80238c:	e8 ef e3 ff ff       	call   800780 <strcpy>
+			st->st_size = ret->ret_size;
+  802391:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802394:	8b 82 80 00 00 00    	mov    0x80(%edx),%eax
+  80239a:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  80239d:	89 81 80 00 00 00    	mov    %eax,0x80(%ecx)
+			st->st_isdir = ret->ret_isdir;
+  8023a3:	8b 82 84 00 00 00    	mov    0x84(%edx),%eax
+  8023a9:	89 81 84 00 00 00    	mov    %eax,0x84(%ecx)
+			st->st_dev = &devfile;
+  8023af:	c7 81 88 00 00 00 20 	movl   $0x804020,0x88(%ecx)
+  8023b6:	40 80 00 
+  8023b9:	83 c4 10             	add    $0x10,%esp
+  8023bc:	e9 4f ff ff ff       	jmp    802310 <fsring_reap+0xb6>
+			return 0;
+  8023c1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8023c6:	e9 b1 fe ff ff       	jmp    80227c <fsring_reap+0x22>
+
+008023cb <file_slurp>:
+// page are copied through fsipcbuf; larger ones go straight into buf's
+// pages, and stop at FSBULK_MAXPAGES of them.
+// Returns the number of bytes read, 0 for directories, or < 0 on error.
+ssize_t
+file_slurp(const char *path, void *buf, size_t n, struct Stat *st)
+{
+  8023cb:	55                   	push   %ebp
+  8023cc:	89 e5                	mov    %esp,%ebp
+  8023ce:	57                   	push   %edi
+  8023cf:	56                   	push   %esi
+  8023d0:	53                   	push   %ebx
+  8023d1:	83 ec 28             	sub    $0x28,%esp
+  8023d4:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8023d7:	8b 7d 10             	mov    0x10(%ebp),%edi
+  8023da:	8b 75 14             	mov    0x14(%ebp),%esi
+	const char *name;
+	int r;
+
+	if (strlen(path) >= MAXPATHLEN)
+  8023dd:	53                   	push   %ebx
+  8023de:	e8 62 e3 ff ff       	call   800745 <strlen>
+  8023e3:	83 c4 10             	add    $0x10,%esp
+  8023e6:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8023eb:	0f 8f 02 01 00 00    	jg     8024f3 <file_slurp+0x128>
+		return -E_BAD_PATH;
+
+	strcpy(fsipcbuf.slurp.req_path, path);
+  8023f1:	83 ec 08             	sub    $0x8,%esp
+  8023f4:	53                   	push   %ebx
+  8023f5:	68 00 60 80 00       	push   $0x806000
+  8023fa:	e8 81 e3 ff ff       	call   800780 <strcpy>
+	if (n > sizeof(fsipcbuf.slurpRet.ret_buf)) {
+  8023ff:	83 c4 10             	add    $0x10,%esp
+  802402:	81 ff f8 0f 00 00    	cmp    $0xff8,%edi
+  802408:	76 69                	jbe    802473 <file_slurp+0xa8>
+		n = MIN(n, FSBULK_MAXPAGES * PGSIZE - PGOFF(buf));
+  80240a:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80240d:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  802413:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  802418:	29 d1                	sub    %edx,%ecx
+  80241a:	39 f9                	cmp    %edi,%ecx
+  80241c:	0f 46 f9             	cmovbe %ecx,%edi
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  80241f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802422:	89 f9                	mov    %edi,%ecx
+  802424:	01 c1                	add    %eax,%ecx
+  802426:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  802429:	eb 0f                	jmp    80243a <file_slurp+0x6f>
+		*(volatile char *) p = *(volatile char *) p;
+  80242b:	0f b6 10             	movzbl (%eax),%edx
+  80242e:	88 10                	mov    %dl,(%eax)
+	for (p = buf; p < (char *) buf + n; p = ROUNDDOWN(p + PGSIZE, PGSIZE))
+  802430:	05 00 10 00 00       	add    $0x1000,%eax
+  802435:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  80243a:	39 c8                	cmp    %ecx,%eax
+  80243c:	72 ed                	jb     80242b <file_slurp+0x60>
+		fsipc_touch(buf, n);
+		fsipcbuf.slurp.req_n = n;
+  80243e:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802441:	89 3d 00 64 80 00    	mov    %edi,0x806400
+		fsipcbuf.slurp.req_off = PGOFF(buf);
+  802447:	89 15 04 64 80 00    	mov    %edx,0x806404
+		r = fsipc_pages(FSREQ_SLURP, buf, n, PTE_P | PTE_W | PTE_U);
+  80244d:	83 ec 0c             	sub    $0xc,%esp
+  802450:	6a 07                	push   $0x7
+  802452:	89 f9                	mov    %edi,%ecx
+  802454:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802457:	b8 0f 00 00 00       	mov    $0xf,%eax
+  80245c:	e8 3f f1 ff ff       	call   8015a0 <fsipc_pages>
+  802461:	89 c7                	mov    %eax,%edi
+  802463:	83 c4 10             	add    $0x10,%esp
+			memmove(buf, fsipcbuf.slurpRet.ret_buf, r);
+	}
+	if (r < 0)
+		return r;
+
+	if (st) {
+  802466:	85 f6                	test   %esi,%esi
+  802468:	74 7f                	je     8024e9 <file_slurp+0x11e>
+  80246a:	8d 43 01             	lea    0x1(%ebx),%eax
+  80246d:	85 ff                	test   %edi,%edi
+  80246f:	79 3c                	jns    8024ad <file_slurp+0xe2>
+  802471:	eb 76                	jmp    8024e9 <file_slurp+0x11e>
+		fsipcbuf.slurp.req_n = n;
+  802473:	89 3d 00 64 80 00    	mov    %edi,0x806400
+		if ((r = fsipc(FSREQ_SLURP, NULL)) > 0)
+  802479:	ba 00 00 00 00       	mov    $0x0,%edx
+  80247e:	b8 0f 00 00 00       	mov    $0xf,%eax
+  802483:	e8 ba f2 ff ff       	call   801742 <fsipc>
+  802488:	89 c7                	mov    %eax,%edi
+  80248a:	85 c0                	test   %eax,%eax
+  80248c:	7e d8                	jle    802466 <file_slurp+0x9b>
+			memmove(buf, fsipcbuf.slurpRet.ret_buf, r);
+  80248e:	83 ec 04             	sub    $0x4,%esp
+  802491:	50                   	push   %eax
+  802492:	68 08 60 80 00       	push   $0x806008
+  802497:	ff 75 0c             	push   0xc(%ebp)
+  80249a:	e8 67 e4 ff ff       	call   800906 <memmove>
+  80249f:	83 c4 10             	add    $0x10,%esp
+  8024a2:	eb c2                	jmp    802466 <file_slurp+0x9b>
+		for (name = path; *path; path++)
+			if (*path == '/')
+				name = path + 1;
+  8024a4:	80 fa 2f             	cmp    $0x2f,%dl
+  8024a7:	0f 44 d9             	cmove  %ecx,%ebx
+		for (name = path; *path; path++)
+  8024aa:	83 c0 01             	add    $0x1,%eax
+  8024ad:	89 c1                	mov    %eax,%ecx
+  8024af:	0f b6 50 ff          	movzbl -0x1(%eax),%edx
+  8024b3:	84 d2                	test   %dl,%dl
+  8024b5:	75 ed                	jne    8024a4 <file_slurp+0xd9>
+		strlcpy(st->st_name, name, sizeof(st->st_name));
+  8024b7:	83 ec 04             	sub    $0x4,%esp
+  8024ba:	68 80 00 00 00       	push   $0x80
+  8024bf:	53                   	push   %ebx
+  8024c0:	56                   	push   %esi
+  8024c1:	e8 30 e3 ff ff       	call   8007f6 <strlcpy>
+		st->st_size = fsipcbuf.slurpRet.ret_size;
+  8024c6:	a1 00 60 80 00       	mov    0x806000,%eax
+  8024cb:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+		st->st_isdir = fsipcbuf.slurpRet.ret_isdir;
+  8024d1:	a1 04 60 80 00       	mov    0x806004,%eax
+  8024d6:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+		st->st_dev = &devfile;
+  8024dc:	c7 86 88 00 00 00 20 	movl   $0x804020,0x88(%esi)
+  8024e3:	40 80 00 
+  8024e6:	83 c4 10             	add    $0x10,%esp
+	}
+	return r;
+}
+  8024e9:	89 f8                	mov    %edi,%eax
+  8024eb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8024ee:	5b                   	pop    %ebx
+  8024ef:	5e                   	pop    %esi
+  8024f0:	5f                   	pop    %edi
+  8024f1:	5d                   	pop    %ebp
+  8024f2:	c3                   	ret
+		return -E_BAD_PATH;
+  8024f3:	bf f4 ff ff ff       	mov    $0xfffffff4,%edi
+  8024f8:	eb ef                	jmp    8024e9 <file_slurp+0x11e>
+
+008024fa <remove>:
+
+// Delete a file
+int
+remove(const char *path)
+{
+  8024fa:	55                   	push   %ebp
+  8024fb:	89 e5                	mov    %esp,%ebp
+  8024fd:	53                   	push   %ebx
+  8024fe:	83 ec 10             	sub    $0x10,%esp
+  802501:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (strlen(path) >= MAXPATHLEN)
+  802504:	53                   	push   %ebx
+  802505:	e8 3b e2 ff ff       	call   800745 <strlen>
+  80250a:	83 c4 10             	add    $0x10,%esp
+  80250d:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802512:	7f 25                	jg     802539 <remove+0x3f>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.remove.req_path, path);
+  802514:	83 ec 08             	sub    $0x8,%esp
+  802517:	53                   	push   %ebx
+  802518:	68 00 60 80 00       	push   $0x806000
+  80251d:	e8 5e e2 ff ff       	call   800780 <strcpy>
+	return fsipc(FSREQ_REMOVE, NULL);
+  802522:	ba 00 00 00 00       	mov    $0x0,%edx
+  802527:	b8 07 00 00 00       	mov    $0x7,%eax
+  80252c:	e8 11 f2 ff ff       	call   801742 <fsipc>
+  802531:	83 c4 10             	add    $0x10,%esp
+}
+  802534:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802537:	c9                   	leave
+  802538:	c3                   	ret
+		return -E_BAD_PATH;
+  802539:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  80253e:	eb f4                	jmp    802534 <remove+0x3a>
+
+00802540 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  802540:	55                   	push   %ebp
+  802541:	89 e5                	mov    %esp,%ebp
+  802543:	83 ec 08             	sub    $0x8,%esp
+	// Ask the file server to update the disk
+	// by writing any dirty blocks in the buffer cache.
+
+	return fsipc(FSREQ_SYNC, NULL);
+  802546:	ba 00 00 00 00       	mov    $0x0,%edx
+  80254b:	b8 08 00 00 00       	mov    $0x8,%eax
+  802550:	e8 ed f1 ff ff       	call   801742 <fsipc>
+}
+  802555:	c9                   	leave
+  802556:	c3                   	ret
+
+00802557 <defrag>:
+// Have the file server lay out the blocks of 'path' contiguously on
+// disk.  Stores the number of extents the file had before and has
+// after in *before and *after, if they are not null.
+int
+defrag(const char *path, uint32_t *before, uint32_t *after)
+{
+  802557:	55                   	push   %ebp
+  802558:	89 e5                	mov    %esp,%ebp
+  80255a:	57                   	push   %edi
+  80255b:	56                   	push   %esi
+  80255c:	53                   	push   %ebx
+  80255d:	83 ec 18             	sub    $0x18,%esp
+  802560:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802563:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802566:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int r;
+
+	if (strlen(path) >= MAXPATHLEN)
+  802569:	57                   	push   %edi
+  80256a:	e8 d6 e1 ff ff       	call   800745 <strlen>
+  80256f:	83 c4 10             	add    $0x10,%esp
+  802572:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802577:	7f 4c                	jg     8025c5 <defrag+0x6e>
+		return -E_BAD_PATH;
+	strcpy(fsipcbuf.defrag.req_path, path);
+  802579:	83 ec 08             	sub    $0x8,%esp
+  80257c:	57                   	push   %edi
+  80257d:	68 00 60 80 00       	push   $0x806000
+  802582:	e8 f9 e1 ff ff       	call   800780 <strcpy>
+	if ((r = fsipc(FSREQ_DEFRAG, NULL)) < 0)
+  802587:	ba 00 00 00 00       	mov    $0x0,%edx
+  80258c:	b8 10 00 00 00       	mov    $0x10,%eax
+  802591:	e8 ac f1 ff ff       	call   801742 <fsipc>
+  802596:	83 c4 10             	add    $0x10,%esp
+  802599:	85 c0                	test   %eax,%eax
+  80259b:	78 20                	js     8025bd <defrag+0x66>
+		return r;
+	if (before)
+  80259d:	85 f6                	test   %esi,%esi
+  80259f:	74 07                	je     8025a8 <defrag+0x51>
+		*before = fsipcbuf.defragRet.ret_before;
+  8025a1:	a1 00 60 80 00       	mov    0x806000,%eax
+  8025a6:	89 06                	mov    %eax,(%esi)
+	if (after)
+		*after = fsipcbuf.defragRet.ret_after;
+	return 0;
+  8025a8:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (after)
+  8025ad:	85 db                	test   %ebx,%ebx
+  8025af:	74 0c                	je     8025bd <defrag+0x66>
+		*after = fsipcbuf.defragRet.ret_after;
+  8025b1:	a1 04 60 80 00       	mov    0x806004,%eax
+  8025b6:	89 03                	mov    %eax,(%ebx)
+	return 0;
+  8025b8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8025bd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8025c0:	5b                   	pop    %ebx
+  8025c1:	5e                   	pop    %esi
+  8025c2:	5f                   	pop    %edi
+  8025c3:	5d                   	pop    %ebp
+  8025c4:	c3                   	ret
+		return -E_BAD_PATH;
+  8025c5:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  8025ca:	eb f1                	jmp    8025bd <defrag+0x66>
+
+008025cc <fs_bcstats>:
+
+// Copy the file server's block cache statistics into *st.
+int
+fs_bcstats(struct BcStats *st)
+{
+  8025cc:	55                   	push   %ebp
+  8025cd:	89 e5                	mov    %esp,%ebp
+  8025cf:	53                   	push   %ebx
+  8025d0:	83 ec 04             	sub    $0x4,%esp
+  8025d3:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	if ((r = fsipc(FSREQ_BCSTATS, NULL)) < 0)
+  8025d6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8025db:	b8 11 00 00 00       	mov    $0x11,%eax
+  8025e0:	e8 5d f1 ff ff       	call   801742 <fsipc>
+  8025e5:	85 c0                	test   %eax,%eax
+  8025e7:	78 34                	js     80261d <fs_bcstats+0x51>
+		return r;
+	*st = fsipcbuf.bcstatsRet;
+  8025e9:	a1 00 60 80 00       	mov    0x806000,%eax
+  8025ee:	89 03                	mov    %eax,(%ebx)
+  8025f0:	a1 04 60 80 00       	mov    0x806004,%eax
+  8025f5:	89 43 04             	mov    %eax,0x4(%ebx)
+  8025f8:	a1 08 60 80 00       	mov    0x806008,%eax
+  8025fd:	89 43 08             	mov    %eax,0x8(%ebx)
+  802600:	a1 0c 60 80 00       	mov    0x80600c,%eax
+  802605:	89 43 0c             	mov    %eax,0xc(%ebx)
+  802608:	a1 10 60 80 00       	mov    0x806010,%eax
+  80260d:	89 43 10             	mov    %eax,0x10(%ebx)
+  802610:	a1 14 60 80 00       	mov    0x806014,%eax
+  802615:	89 43 14             	mov    %eax,0x14(%ebx)
+	return 0;
+  802618:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80261d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802620:	c9                   	leave
+  802621:	c3                   	ret
+
+00802622 <devsock_stat>:
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+}
+
+static int
+devsock_stat(struct Fd *fd, struct Stat *stat)
+{
+  802622:	55                   	push   %ebp
+  802623:	89 e5                	mov    %esp,%ebp
+  802625:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<sock>");
+  802628:	68 76 3c 80 00       	push   $0x803c76
+  80262d:	ff 75 0c             	push   0xc(%ebp)
+  802630:	e8 4b e1 ff ff       	call   800780 <strcpy>
+	return 0;
+}
+  802635:	b8 00 00 00 00       	mov    $0x0,%eax
+  80263a:	c9                   	leave
+  80263b:	c3                   	ret
+
+0080263c <devsock_close>:
+{
+  80263c:	55                   	push   %ebp
+  80263d:	89 e5                	mov    %esp,%ebp
+  80263f:	53                   	push   %ebx
+  802640:	83 ec 10             	sub    $0x10,%esp
+  802643:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (pageref(fd) == 1)
+  802646:	53                   	push   %ebx
+  802647:	e8 3a 0e 00 00       	call   803486 <pageref>
+  80264c:	89 c2                	mov    %eax,%edx
+  80264e:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  802651:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (pageref(fd) == 1)
+  802656:	83 fa 01             	cmp    $0x1,%edx
+  802659:	74 05                	je     802660 <devsock_close+0x24>
+}
+  80265b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80265e:	c9                   	leave
+  80265f:	c3                   	ret
+		return nsipc_close(fd->fd_sock.sockid);
+  802660:	83 ec 0c             	sub    $0xc,%esp
+  802663:	ff 73 0c             	push   0xc(%ebx)
+  802666:	e8 b7 02 00 00       	call   802922 <nsipc_close>
+  80266b:	83 c4 10             	add    $0x10,%esp
+  80266e:	eb eb                	jmp    80265b <devsock_close+0x1f>
+
+00802670 <devsock_write>:
+{
+  802670:	55                   	push   %ebp
+  802671:	89 e5                	mov    %esp,%ebp
+  802673:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_send(fd->fd_sock.sockid, buf, n, 0);
+  802676:	6a 00                	push   $0x0
+  802678:	ff 75 10             	push   0x10(%ebp)
+  80267b:	ff 75 0c             	push   0xc(%ebp)
+  80267e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802681:	ff 70 0c             	push   0xc(%eax)
+  802684:	e8 79 03 00 00       	call   802a02 <nsipc_send>
+}
+  802689:	c9                   	leave
+  80268a:	c3                   	ret
+
+0080268b <devsock_read>:
+{
+  80268b:	55                   	push   %ebp
+  80268c:	89 e5                	mov    %esp,%ebp
+  80268e:	83 ec 08             	sub    $0x8,%esp
+	return nsipc_recv(fd->fd_sock.sockid, buf, n, 0);
+  802691:	6a 00                	push   $0x0
+  802693:	ff 75 10             	push   0x10(%ebp)
+  802696:	ff 75 0c             	push   0xc(%ebp)
+  802699:	8b 45 08             	mov    0x8(%ebp),%eax
+  80269c:	ff 70 0c             	push   0xc(%eax)
+  80269f:	e8 ef 02 00 00       	call   802993 <nsipc_recv>
+}
+  8026a4:	c9                   	leave
+  8026a5:	c3                   	ret
+
+008026a6 <fd2sockid>:
+{
+  8026a6:	55                   	push   %ebp
+  8026a7:	89 e5                	mov    %esp,%ebp
+  8026a9:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fd, &sfd)) < 0)
+  8026ac:	8d 55 f4             	lea    -0xc(%ebp),%edx
+  8026af:	52                   	push   %edx
+  8026b0:	50                   	push   %eax
+  8026b1:	e8 54 e9 ff ff       	call   80100a <fd_lookup>
+  8026b6:	83 c4 10             	add    $0x10,%esp
+  8026b9:	85 c0                	test   %eax,%eax
+  8026bb:	78 10                	js     8026cd <fd2sockid+0x27>
+	if (sfd->fd_dev_id != devsock.dev_id)
+  8026bd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8026c0:	8b 0d 40 40 80 00    	mov    0x804040,%ecx
+  8026c6:	39 08                	cmp    %ecx,(%eax)
+  8026c8:	75 05                	jne    8026cf <fd2sockid+0x29>
+	return sfd->fd_sock.sockid;
+  8026ca:	8b 40 0c             	mov    0xc(%eax),%eax
+}
+  8026cd:	c9                   	leave
+  8026ce:	c3                   	ret
+		return -E_NOT_SUPP;
+  8026cf:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8026d4:	eb f7                	jmp    8026cd <fd2sockid+0x27>
+
+008026d6 <alloc_sockfd>:
+{
+  8026d6:	55                   	push   %ebp
+  8026d7:	89 e5                	mov    %esp,%ebp
+  8026d9:	56                   	push   %esi
+  8026da:	53                   	push   %ebx
+  8026db:	83 ec 1c             	sub    $0x1c,%esp
+  8026de:	89 c6                	mov    %eax,%esi
+	if ((r = fd_alloc(&sfd)) < 0
+  8026e0:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8026e3:	50                   	push   %eax
+  8026e4:	e8 cb e8 ff ff       	call   800fb4 <fd_alloc>
+  8026e9:	89 c3                	mov    %eax,%ebx
+  8026eb:	83 c4 10             	add    $0x10,%esp
+  8026ee:	85 c0                	test   %eax,%eax
+  8026f0:	78 43                	js     802735 <alloc_sockfd+0x5f>
+	    || (r = sys_page_alloc(0, sfd, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0) {
+  8026f2:	83 ec 04             	sub    $0x4,%esp
+  8026f5:	68 07 04 00 00       	push   $0x407
+  8026fa:	ff 75 f4             	push   -0xc(%ebp)
+  8026fd:	6a 00                	push   $0x0
+  8026ff:	e8 88 e4 ff ff       	call   800b8c <sys_page_alloc>
+  802704:	89 c3                	mov    %eax,%ebx
+  802706:	83 c4 10             	add    $0x10,%esp
+  802709:	85 c0                	test   %eax,%eax
+  80270b:	78 28                	js     802735 <alloc_sockfd+0x5f>
+	sfd->fd_dev_id = devsock.dev_id;
+  80270d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802710:	8b 15 40 40 80 00    	mov    0x804040,%edx
+  802716:	89 10                	mov    %edx,(%eax)
+	sfd->fd_omode = O_RDWR;
+  802718:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80271b:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	sfd->fd_sock.sockid = sockid;
+  802722:	89 70 0c             	mov    %esi,0xc(%eax)
+	return fd2num(sfd);
+  802725:	83 ec 0c             	sub    $0xc,%esp
+  802728:	50                   	push   %eax
+  802729:	e8 5f e8 ff ff       	call   800f8d <fd2num>
+  80272e:	89 c3                	mov    %eax,%ebx
+  802730:	83 c4 10             	add    $0x10,%esp
+  802733:	eb 0c                	jmp    802741 <alloc_sockfd+0x6b>
+		nsipc_close(sockid);
+  802735:	83 ec 0c             	sub    $0xc,%esp
+  802738:	56                   	push   %esi
+  802739:	e8 e4 01 00 00       	call   802922 <nsipc_close>
+		return r;
+  80273e:	83 c4 10             	add    $0x10,%esp
+}
+  802741:	89 d8                	mov    %ebx,%eax
+  802743:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802746:	5b                   	pop    %ebx
+  802747:	5e                   	pop    %esi
+  802748:	5d                   	pop    %ebp
+  802749:	c3                   	ret
+
+0080274a <accept>:
+{
+  80274a:	55                   	push   %ebp
+  80274b:	89 e5                	mov    %esp,%ebp
+  80274d:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  802750:	8b 45 08             	mov    0x8(%ebp),%eax
+  802753:	e8 4e ff ff ff       	call   8026a6 <fd2sockid>
+  802758:	85 c0                	test   %eax,%eax
+  80275a:	78 1b                	js     802777 <accept+0x2d>
+	if ((r = nsipc_accept(r, addr, addrlen)) < 0)
+  80275c:	83 ec 04             	sub    $0x4,%esp
+  80275f:	ff 75 10             	push   0x10(%ebp)
+  802762:	ff 75 0c             	push   0xc(%ebp)
+  802765:	50                   	push   %eax
+  802766:	e8 0e 01 00 00       	call   802879 <nsipc_accept>
+  80276b:	83 c4 10             	add    $0x10,%esp
+  80276e:	85 c0                	test   %eax,%eax
+  802770:	78 05                	js     802777 <accept+0x2d>
+	return alloc_sockfd(r);
+  802772:	e8 5f ff ff ff       	call   8026d6 <alloc_sockfd>
+}
+  802777:	c9                   	leave
+  802778:	c3                   	ret
+
+00802779 <bind>:
+{
+  802779:	55                   	push   %ebp
+  80277a:	89 e5                	mov    %esp,%ebp
+  80277c:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  80277f:	8b 45 08             	mov    0x8(%ebp),%eax
+  802782:	e8 1f ff ff ff       	call   8026a6 <fd2sockid>
+  802787:	85 c0                	test   %eax,%eax
+  802789:	78 12                	js     80279d <bind+0x24>
+	return nsipc_bind(r, name, namelen);
+  80278b:	83 ec 04             	sub    $0x4,%esp
+  80278e:	ff 75 10             	push   0x10(%ebp)
+  802791:	ff 75 0c             	push   0xc(%ebp)
+  802794:	50                   	push   %eax
+  802795:	e8 31 01 00 00       	call   8028cb <nsipc_bind>
+  80279a:	83 c4 10             	add    $0x10,%esp
+}
+  80279d:	c9                   	leave
+  80279e:	c3                   	ret
+
+0080279f <shutdown>:
+{
+  80279f:	55                   	push   %ebp
+  8027a0:	89 e5                	mov    %esp,%ebp
+  8027a2:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8027a5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8027a8:	e8 f9 fe ff ff       	call   8026a6 <fd2sockid>
+  8027ad:	85 c0                	test   %eax,%eax
+  8027af:	78 0f                	js     8027c0 <shutdown+0x21>
+	return nsipc_shutdown(r, how);
+  8027b1:	83 ec 08             	sub    $0x8,%esp
+  8027b4:	ff 75 0c             	push   0xc(%ebp)
+  8027b7:	50                   	push   %eax
+  8027b8:	e8 43 01 00 00       	call   802900 <nsipc_shutdown>
+  8027bd:	83 c4 10             	add    $0x10,%esp
+}
+  8027c0:	c9                   	leave
+  8027c1:	c3                   	ret
+
+008027c2 <connect>:
+{
+  8027c2:	55                   	push   %ebp
+  8027c3:	89 e5                	mov    %esp,%ebp
+  8027c5:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8027c8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8027cb:	e8 d6 fe ff ff       	call   8026a6 <fd2sockid>
+  8027d0:	85 c0                	test   %eax,%eax
+  8027d2:	78 12                	js     8027e6 <connect+0x24>
+	return nsipc_connect(r, name, namelen);
+  8027d4:	83 ec 04             	sub    $0x4,%esp
+  8027d7:	ff 75 10             	push   0x10(%ebp)
+  8027da:	ff 75 0c             	push   0xc(%ebp)
+  8027dd:	50                   	push   %eax
+  8027de:	e8 59 01 00 00       	call   80293c <nsipc_connect>
+  8027e3:	83 c4 10             	add    $0x10,%esp
+}
+  8027e6:	c9                   	leave
+  8027e7:	c3                   	ret
+
+008027e8 <listen>:
+{
+  8027e8:	55                   	push   %ebp
+  8027e9:	89 e5                	mov    %esp,%ebp
+  8027eb:	83 ec 08             	sub    $0x8,%esp
+	if ((r = fd2sockid(s)) < 0)
+  8027ee:	8b 45 08             	mov    0x8(%ebp),%eax
+  8027f1:	e8 b0 fe ff ff       	call   8026a6 <fd2sockid>
+  8027f6:	85 c0                	test   %eax,%eax
+  8027f8:	78 0f                	js     802809 <listen+0x21>
+	return nsipc_listen(r, backlog);
+  8027fa:	83 ec 08             	sub    $0x8,%esp
+  8027fd:	ff 75 0c             	push   0xc(%ebp)
+  802800:	50                   	push   %eax
+  802801:	e8 6b 01 00 00       	call   802971 <nsipc_listen>
+  802806:	83 c4 10             	add    $0x10,%esp
+}
+  802809:	c9                   	leave
+  80280a:	c3                   	ret
+
+0080280b <socket>:
+
+int
+socket(int domain, int type, int protocol)
+{
+  80280b:	55                   	push   %ebp
+  80280c:	89 e5                	mov    %esp,%ebp
+  80280e:	83 ec 0c             	sub    $0xc,%esp
+	int r;
+	if ((r = nsipc_socket(domain, type, protocol)) < 0)
+  802811:	ff 75 10             	push   0x10(%ebp)
+  802814:	ff 75 0c             	push   0xc(%ebp)
+  802817:	ff 75 08             	push   0x8(%ebp)
+  80281a:	e8 41 02 00 00       	call   802a60 <nsipc_socket>
+  80281f:	83 c4 10             	add    $0x10,%esp
+  802822:	85 c0                	test   %eax,%eax
+  802824:	78 05                	js     80282b <socket+0x20>
+		return r;
+	return alloc_sockfd(r);
+  802826:	e8 ab fe ff ff       	call   8026d6 <alloc_sockfd>
+}
+  80282b:	c9                   	leave
+  80282c:	c3                   	ret
+
+0080282d <nsipc>:
+// may be written back to nsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// Returns 0 if successful, < 0 on failure.
+static int
+nsipc(unsigned type)
+{
+  80282d:	55                   	push   %ebp
+  80282e:	89 e5                	mov    %esp,%ebp
+  802830:	53                   	push   %ebx
+  802831:	83 ec 04             	sub    $0x4,%esp
+  802834:	89 c3                	mov    %eax,%ebx
+	static envid_t nsenv;
+	if (nsenv == 0)
+  802836:	83 3d 00 90 80 00 00 	cmpl   $0x0,0x809000
+  80283d:	74 26                	je     802865 <nsipc+0x38>
+	static_assert(sizeof(nsipcbuf) == PGSIZE);
+
+	if (debug)
+		cprintf("[%08x] nsipc %d\n", thisenv->env_id, type);
+
+	ipc_send(nsenv, type, &nsipcbuf, PTE_P|PTE_W|PTE_U);
+  80283f:	6a 07                	push   $0x7
+  802841:	68 00 80 80 00       	push   $0x808000
+  802846:	53                   	push   %ebx
+  802847:	ff 35 00 90 80 00    	push   0x809000
+  80284d:	e8 bc 0a 00 00       	call   80330e <ipc_send>
+	return ipc_recv(NULL, NULL, NULL);
+  802852:	83 c4 0c             	add    $0xc,%esp
+  802855:	6a 00                	push   $0x0
+  802857:	6a 00                	push   $0x0
+  802859:	6a 00                	push   $0x0
+  80285b:	e8 43 0a 00 00       	call   8032a3 <ipc_recv>
+}
+  802860:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802863:	c9                   	leave
+  802864:	c3                   	ret
+		nsenv = ipc_find_env(ENV_TYPE_NS);
+  802865:	83 ec 0c             	sub    $0xc,%esp
+  802868:	6a 02                	push   $0x2
+  80286a:	e8 d8 0b 00 00       	call   803447 <ipc_find_env>
+  80286f:	a3 00 90 80 00       	mov    %eax,0x809000
+  802874:	83 c4 10             	add    $0x10,%esp
+  802877:	eb c6                	jmp    80283f <nsipc+0x12>
+
+00802879 <nsipc_accept>:
+
+int
+nsipc_accept(int s, struct sockaddr *addr, socklen_t *addrlen)
+{
+  802879:	55                   	push   %ebp
+  80287a:	89 e5                	mov    %esp,%ebp
+  80287c:	56                   	push   %esi
+  80287d:	53                   	push   %ebx
+  80287e:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.accept.req_s = s;
+  802881:	8b 45 08             	mov    0x8(%ebp),%eax
+  802884:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.accept.req_addrlen = *addrlen;
+  802889:	8b 06                	mov    (%esi),%eax
+  80288b:	a3 04 80 80 00       	mov    %eax,0x808004
+	if ((r = nsipc(NSREQ_ACCEPT)) >= 0) {
+  802890:	b8 01 00 00 00       	mov    $0x1,%eax
+  802895:	e8 93 ff ff ff       	call   80282d <nsipc>
+  80289a:	89 c3                	mov    %eax,%ebx
+  80289c:	85 c0                	test   %eax,%eax
+  80289e:	79 09                	jns    8028a9 <nsipc_accept+0x30>
+		struct Nsret_accept *ret = &nsipcbuf.acceptRet;
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+		*addrlen = ret->ret_addrlen;
+	}
+	return r;
+}
+  8028a0:	89 d8                	mov    %ebx,%eax
+  8028a2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8028a5:	5b                   	pop    %ebx
+  8028a6:	5e                   	pop    %esi
+  8028a7:	5d                   	pop    %ebp
+  8028a8:	c3                   	ret
+		memmove(addr, &ret->ret_addr, ret->ret_addrlen);
+  8028a9:	83 ec 04             	sub    $0x4,%esp
+  8028ac:	ff 35 10 80 80 00    	push   0x808010
+  8028b2:	68 00 80 80 00       	push   $0x808000
+  8028b7:	ff 75 0c             	push   0xc(%ebp)
+  8028ba:	e8 47 e0 ff ff       	call   800906 <memmove>
+		*addrlen = ret->ret_addrlen;
+  8028bf:	a1 10 80 80 00       	mov    0x808010,%eax
+  8028c4:	89 06                	mov    %eax,(%esi)
+  8028c6:	83 c4 10             	add    $0x10,%esp
+	return r;
+  8028c9:	eb d5                	jmp    8028a0 <nsipc_accept+0x27>
+
+008028cb <nsipc_bind>:
+
+int
+nsipc_bind(int s, struct sockaddr *name, socklen_t namelen)
+{
+  8028cb:	55                   	push   %ebp
+  8028cc:	89 e5                	mov    %esp,%ebp
+  8028ce:	53                   	push   %ebx
+  8028cf:	83 ec 08             	sub    $0x8,%esp
+  8028d2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.bind.req_s = s;
+  8028d5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8028d8:	a3 00 80 80 00       	mov    %eax,0x808000
+	memmove(&nsipcbuf.bind.req_name, name, namelen);
+  8028dd:	53                   	push   %ebx
+  8028de:	ff 75 0c             	push   0xc(%ebp)
+  8028e1:	68 04 80 80 00       	push   $0x808004
+  8028e6:	e8 1b e0 ff ff       	call   800906 <memmove>
+	nsipcbuf.bind.req_namelen = namelen;
+  8028eb:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+	return nsipc(NSREQ_BIND);
+  8028f1:	b8 02 00 00 00       	mov    $0x2,%eax
+  8028f6:	e8 32 ff ff ff       	call   80282d <nsipc>
+}
+  8028fb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8028fe:	c9                   	leave
+  8028ff:	c3                   	ret
+
+00802900 <nsipc_shutdown>:
+
+int
+nsipc_shutdown(int s, int how)
+{
+  802900:	55                   	push   %ebp
+  802901:	89 e5                	mov    %esp,%ebp
+  802903:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.shutdown.req_s = s;
+  802906:	8b 45 08             	mov    0x8(%ebp),%eax
+  802909:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.shutdown.req_how = how;
+  80290e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802911:	a3 04 80 80 00       	mov    %eax,0x808004
+	return nsipc(NSREQ_SHUTDOWN);
+  802916:	b8 03 00 00 00       	mov    $0x3,%eax
+  80291b:	e8 0d ff ff ff       	call   80282d <nsipc>
+}
+  802920:	c9                   	leave
+  802921:	c3                   	ret
+
+00802922 <nsipc_close>:
+
+int
+nsipc_close(int s)
+{
+  802922:	55                   	push   %ebp
+  802923:	89 e5                	mov    %esp,%ebp
+  802925:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.close.req_s = s;
+  802928:	8b 45 08             	mov    0x8(%ebp),%eax
+  80292b:	a3 00 80 80 00       	mov    %eax,0x808000
+	return nsipc(NSREQ_CLOSE);
+  802930:	b8 04 00 00 00       	mov    $0x4,%eax
+  802935:	e8 f3 fe ff ff       	call   80282d <nsipc>
+}
+  80293a:	c9                   	leave
+  80293b:	c3                   	ret
+
+0080293c <nsipc_connect>:
+
+int
+nsipc_connect(int s, const struct sockaddr *name, socklen_t namelen)
+{
+  80293c:	55                   	push   %ebp
+  80293d:	89 e5                	mov    %esp,%ebp
+  80293f:	53                   	push   %ebx
+  802940:	83 ec 08             	sub    $0x8,%esp
+  802943:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.connect.req_s = s;
+  802946:	8b 45 08             	mov    0x8(%ebp),%eax
+  802949:	a3 00 80 80 00       	mov    %eax,0x808000
+	memmove(&nsipcbuf.connect.req_name, name, namelen);
+  80294e:	53                   	push   %ebx
+  80294f:	ff 75 0c             	push   0xc(%ebp)
+  802952:	68 04 80 80 00       	push   $0x808004
+  802957:	e8 aa df ff ff       	call   800906 <memmove>
+	nsipcbuf.connect.req_namelen = namelen;
+  80295c:	89 1d 14 80 80 00    	mov    %ebx,0x808014
+	return nsipc(NSREQ_CONNECT);
+  802962:	b8 05 00 00 00       	mov    $0x5,%eax
+  802967:	e8 c1 fe ff ff       	call   80282d <nsipc>
+}
+  80296c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80296f:	c9                   	leave
+  802970:	c3                   	ret
+
+00802971 <nsipc_listen>:
+
+int
+nsipc_listen(int s, int backlog)
+{
+  802971:	55                   	push   %ebp
+  802972:	89 e5                	mov    %esp,%ebp
+  802974:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.listen.req_s = s;
+  802977:	8b 45 08             	mov    0x8(%ebp),%eax
+  80297a:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.listen.req_backlog = backlog;
+  80297f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802982:	a3 04 80 80 00       	mov    %eax,0x808004
+	return nsipc(NSREQ_LISTEN);
+  802987:	b8 06 00 00 00       	mov    $0x6,%eax
+  80298c:	e8 9c fe ff ff       	call   80282d <nsipc>
+}
+  802991:	c9                   	leave
+  802992:	c3                   	ret
+
+00802993 <nsipc_recv>:
+
+int
+nsipc_recv(int s, void *mem, int len, unsigned int flags)
+{
+  802993:	55                   	push   %ebp
+  802994:	89 e5                	mov    %esp,%ebp
+  802996:	56                   	push   %esi
+  802997:	53                   	push   %ebx
+  802998:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	nsipcbuf.recv.req_s = s;
+  80299b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80299e:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.recv.req_len = len;
+  8029a3:	89 35 04 80 80 00    	mov    %esi,0x808004
+	nsipcbuf.recv.req_flags = flags;
+  8029a9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8029ac:	a3 08 80 80 00       	mov    %eax,0x808008
+
+	if ((r = nsipc(NSREQ_RECV)) >= 0) {
+  8029b1:	b8 07 00 00 00       	mov    $0x7,%eax
+  8029b6:	e8 72 fe ff ff       	call   80282d <nsipc>
+  8029bb:	89 c3                	mov    %eax,%ebx
+  8029bd:	85 c0                	test   %eax,%eax
+  8029bf:	78 22                	js     8029e3 <nsipc_recv+0x50>
+		assert(r < 1600 && r <= len);
+  8029c1:	b8 3f 06 00 00       	mov    $0x63f,%eax
+  8029c6:	39 c6                	cmp    %eax,%esi
+  8029c8:	0f 4e c6             	cmovle %esi,%eax
+  8029cb:	39 c3                	cmp    %eax,%ebx
+  8029cd:	7f 1d                	jg     8029ec <nsipc_recv+0x59>
+		memmove(mem, nsipcbuf.recvRet.ret_buf, r);
+  8029cf:	83 ec 04             	sub    $0x4,%esp
+  8029d2:	53                   	push   %ebx
+  8029d3:	68 00 80 80 00       	push   $0x808000
+  8029d8:	ff 75 0c             	push   0xc(%ebp)
+  8029db:	e8 26 df ff ff       	call   800906 <memmove>
+  8029e0:	83 c4 10             	add    $0x10,%esp
+	}
+
+	return r;
+}
+  8029e3:	89 d8                	mov    %ebx,%eax
+  8029e5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8029e8:	5b                   	pop    %ebx
+  8029e9:	5e                   	pop    %esi
+  8029ea:	5d                   	pop    %ebp
+  8029eb:	c3                   	ret
+		assert(r < 1600 && r <= len);
+  8029ec:	68 82 3c 80 00       	push   $0x803c82
+  8029f1:	68 20 3c 80 00       	push   $0x803c20
+  8029f6:	6a 62                	push   $0x62
+  8029f8:	68 97 3c 80 00       	push   $0x803c97
+  8029fd:	e8 46 05 00 00       	call   802f48 <_panic>
+
+00802a02 <nsipc_send>:
+
+int
+nsipc_send(int s, const void *buf, int size, unsigned int flags)
+{
+  802a02:	55                   	push   %ebp
+  802a03:	89 e5                	mov    %esp,%ebp
+  802a05:	53                   	push   %ebx
+  802a06:	83 ec 04             	sub    $0x4,%esp
+  802a09:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	nsipcbuf.send.req_s = s;
+  802a0c:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a0f:	a3 00 80 80 00       	mov    %eax,0x808000
+	assert(size < 1600);
+  802a14:	81 fb 3f 06 00 00    	cmp    $0x63f,%ebx
+  802a1a:	7f 2e                	jg     802a4a <nsipc_send+0x48>
+	memmove(&nsipcbuf.send.req_buf, buf, size);
+  802a1c:	83 ec 04             	sub    $0x4,%esp
+  802a1f:	53                   	push   %ebx
+  802a20:	ff 75 0c             	push   0xc(%ebp)
+  802a23:	68 0c 80 80 00       	push   $0x80800c
+  802a28:	e8 d9 de ff ff       	call   800906 <memmove>
+	nsipcbuf.send.req_size = size;
+  802a2d:	89 1d 04 80 80 00    	mov    %ebx,0x808004
+	nsipcbuf.send.req_flags = flags;
+  802a33:	8b 45 14             	mov    0x14(%ebp),%eax
+  802a36:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_SEND);
+  802a3b:	b8 08 00 00 00       	mov    $0x8,%eax
+  802a40:	e8 e8 fd ff ff       	call   80282d <nsipc>
+}
+  802a45:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802a48:	c9                   	leave
+  802a49:	c3                   	ret
+	assert(size < 1600);
+  802a4a:	68 a3 3c 80 00       	push   $0x803ca3
+  802a4f:	68 20 3c 80 00       	push   $0x803c20
+  802a54:	6a 6d                	push   $0x6d
+  802a56:	68 97 3c 80 00       	push   $0x803c97
+  802a5b:	e8 e8 04 00 00       	call   802f48 <_panic>
+
+00802a60 <nsipc_socket>:
+
+int
+nsipc_socket(int domain, int type, int protocol)
+{
+  802a60:	55                   	push   %ebp
+  802a61:	89 e5                	mov    %esp,%ebp
+  802a63:	83 ec 08             	sub    $0x8,%esp
+	nsipcbuf.socket.req_domain = domain;
+  802a66:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a69:	a3 00 80 80 00       	mov    %eax,0x808000
+	nsipcbuf.socket.req_type = type;
+  802a6e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802a71:	a3 04 80 80 00       	mov    %eax,0x808004
+	nsipcbuf.socket.req_protocol = protocol;
+  802a76:	8b 45 10             	mov    0x10(%ebp),%eax
+  802a79:	a3 08 80 80 00       	mov    %eax,0x808008
+	return nsipc(NSREQ_SOCKET);
+  802a7e:	b8 09 00 00 00       	mov    $0x9,%eax
+  802a83:	e8 a5 fd ff ff       	call   80282d <nsipc>
+}
+  802a88:	c9                   	leave
+  802a89:	c3                   	ret
+
+00802a8a <devpipe_stat>:
+	return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  802a8a:	55                   	push   %ebp
+  802a8b:	89 e5                	mov    %esp,%ebp
+  802a8d:	56                   	push   %esi
+  802a8e:	53                   	push   %ebx
+  802a8f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	struct Pipe *p = (struct Pipe*) fd2data(fd);
+  802a92:	83 ec 0c             	sub    $0xc,%esp
+  802a95:	ff 75 08             	push   0x8(%ebp)
+  802a98:	e8 00 e5 ff ff       	call   800f9d <fd2data>
+  802a9d:	89 c6                	mov    %eax,%esi
+	strcpy(stat->st_name, "<pipe>");
+  802a9f:	83 c4 08             	add    $0x8,%esp
+  802aa2:	68 af 3c 80 00       	push   $0x803caf
+  802aa7:	53                   	push   %ebx
+  802aa8:	e8 d3 dc ff ff       	call   800780 <strcpy>
+	stat->st_size = p->p_wpos - p->p_rpos;
+  802aad:	8b 46 04             	mov    0x4(%esi),%eax
+  802ab0:	2b 06                	sub    (%esi),%eax
+  802ab2:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	stat->st_isdir = 0;
+  802ab8:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  802abf:	00 00 00 
+	stat->st_dev = &devpipe;
+  802ac2:	c7 83 88 00 00 00 60 	movl   $0x804060,0x88(%ebx)
+  802ac9:	40 80 00 
+	return 0;
+}
+  802acc:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ad1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802ad4:	5b                   	pop    %ebx
+  802ad5:	5e                   	pop    %esi
+  802ad6:	5d                   	pop    %ebp
+  802ad7:	c3                   	ret
+
+00802ad8 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  802ad8:	55                   	push   %ebp
+  802ad9:	89 e5                	mov    %esp,%ebp
+  802adb:	53                   	push   %ebx
+  802adc:	83 ec 0c             	sub    $0xc,%esp
+  802adf:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	(void) sys_page_unmap(0, fd);
+  802ae2:	53                   	push   %ebx
+  802ae3:	6a 00                	push   $0x0
+  802ae5:	e8 2f e1 ff ff       	call   800c19 <sys_page_unmap>
+	return sys_page_unmap(0, fd2data(fd));
+  802aea:	89 1c 24             	mov    %ebx,(%esp)
+  802aed:	e8 ab e4 ff ff       	call   800f9d <fd2data>
+  802af2:	83 c4 08             	add    $0x8,%esp
+  802af5:	50                   	push   %eax
+  802af6:	6a 00                	push   $0x0
+  802af8:	e8 1c e1 ff ff       	call   800c19 <sys_page_unmap>
+}
+  802afd:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802b00:	c9                   	leave
+  802b01:	c3                   	ret
+
+00802b02 <_pipeisclosed>:
+{
+  802b02:	55                   	push   %ebp
+  802b03:	89 e5                	mov    %esp,%ebp
+  802b05:	57                   	push   %edi
+  802b06:	56                   	push   %esi
+  802b07:	53                   	push   %ebx
+  802b08:	83 ec 1c             	sub    $0x1c,%esp
+  802b0b:	89 c7                	mov    %eax,%edi
+  802b0d:	89 d6                	mov    %edx,%esi
+		n = thisenv->env_runs;
+  802b0f:	a1 00 50 80 00       	mov    0x805000,%eax
+  802b14:	8b 58 58             	mov    0x58(%eax),%ebx
+		ret = pageref(fd) == pageref(p);
+  802b17:	83 ec 0c             	sub    $0xc,%esp
+  802b1a:	57                   	push   %edi
+  802b1b:	e8 66 09 00 00       	call   803486 <pageref>
+  802b20:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802b23:	89 34 24             	mov    %esi,(%esp)
+  802b26:	e8 5b 09 00 00       	call   803486 <pageref>
+		nn = thisenv->env_runs;
+  802b2b:	8b 15 00 50 80 00    	mov    0x805000,%edx
+  802b31:	8b 4a 58             	mov    0x58(%edx),%ecx
+		if (n == nn)
+  802b34:	83 c4 10             	add    $0x10,%esp
+  802b37:	39 cb                	cmp    %ecx,%ebx
+  802b39:	74 1b                	je     802b56 <_pipeisclosed+0x54>
+		if (n != nn && ret == 1)
+  802b3b:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802b3e:	75 cf                	jne    802b0f <_pipeisclosed+0xd>
+			cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  802b40:	8b 42 58             	mov    0x58(%edx),%eax
+  802b43:	6a 01                	push   $0x1
+  802b45:	50                   	push   %eax
+  802b46:	53                   	push   %ebx
+  802b47:	68 b6 3c 80 00       	push   $0x803cb6
+  802b4c:	e8 41 d6 ff ff       	call   800192 <cprintf>
+  802b51:	83 c4 10             	add    $0x10,%esp
+  802b54:	eb b9                	jmp    802b0f <_pipeisclosed+0xd>
+		ret = pageref(fd) == pageref(p);
+  802b56:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802b59:	0f 94 c0             	sete   %al
+  802b5c:	0f b6 c0             	movzbl %al,%eax
+}
+  802b5f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802b62:	5b                   	pop    %ebx
+  802b63:	5e                   	pop    %esi
+  802b64:	5f                   	pop    %edi
+  802b65:	5d                   	pop    %ebp
+  802b66:	c3                   	ret
+
+00802b67 <devpipe_write>:
+{
+  802b67:	55                   	push   %ebp
+  802b68:	89 e5                	mov    %esp,%ebp
+  802b6a:	57                   	push   %edi
+  802b6b:	56                   	push   %esi
+  802b6c:	53                   	push   %ebx
+  802b6d:	83 ec 28             	sub    $0x28,%esp
+  802b70:	8b 75 08             	mov    0x8(%ebp),%esi
+	p = (struct Pipe*) fd2data(fd);
+  802b73:	56                   	push   %esi
+  802b74:	e8 24 e4 ff ff       	call   800f9d <fd2data>
+  802b79:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  802b7b:	83 c4 10             	add    $0x10,%esp
+  802b7e:	bf 00 00 00 00       	mov    $0x0,%edi
+  802b83:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  802b86:	75 09                	jne    802b91 <devpipe_write+0x2a>
+	return i;
+  802b88:	89 f8                	mov    %edi,%eax
+  802b8a:	eb 23                	jmp    802baf <devpipe_write+0x48>
+			sys_yield();
+  802b8c:	e8 dc df ff ff       	call   800b6d <sys_yield>
+		while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  802b91:	8b 43 04             	mov    0x4(%ebx),%eax
+  802b94:	8b 0b                	mov    (%ebx),%ecx
+  802b96:	8d 51 20             	lea    0x20(%ecx),%edx
+  802b99:	39 d0                	cmp    %edx,%eax
+  802b9b:	72 1a                	jb     802bb7 <devpipe_write+0x50>
+			if (_pipeisclosed(fd, p))
+  802b9d:	89 da                	mov    %ebx,%edx
+  802b9f:	89 f0                	mov    %esi,%eax
+  802ba1:	e8 5c ff ff ff       	call   802b02 <_pipeisclosed>
+  802ba6:	85 c0                	test   %eax,%eax
+  802ba8:	74 e2                	je     802b8c <devpipe_write+0x25>
+				return 0;
+  802baa:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802baf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802bb2:	5b                   	pop    %ebx
+  802bb3:	5e                   	pop    %esi
+  802bb4:	5f                   	pop    %edi
+  802bb5:	5d                   	pop    %ebp
+  802bb6:	c3                   	ret
+		p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  802bb7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802bba:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  802bbe:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  802bc1:	89 c2                	mov    %eax,%edx
+  802bc3:	c1 fa 1f             	sar    $0x1f,%edx
+  802bc6:	89 d1                	mov    %edx,%ecx
+  802bc8:	c1 e9 1b             	shr    $0x1b,%ecx
+  802bcb:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  802bce:	83 e2 1f             	and    $0x1f,%edx
+  802bd1:	29 ca                	sub    %ecx,%edx
+  802bd3:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  802bd7:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+		p->p_wpos++;
+  802bdb:	83 c0 01             	add    $0x1,%eax
+  802bde:	89 43 04             	mov    %eax,0x4(%ebx)
+	for (i = 0; i < n; i++) {
+  802be1:	83 c7 01             	add    $0x1,%edi
+  802be4:	eb 9d                	jmp    802b83 <devpipe_write+0x1c>
+
+00802be6 <devpipe_read>:
+{
+  802be6:	55                   	push   %ebp
+  802be7:	89 e5                	mov    %esp,%ebp
+  802be9:	57                   	push   %edi
+  802bea:	56                   	push   %esi
+  802beb:	53                   	push   %ebx
+  802bec:	83 ec 18             	sub    $0x18,%esp
+  802bef:	8b 7d 08             	mov    0x8(%ebp),%edi
+	p = (struct Pipe*)fd2data(fd);
+  802bf2:	57                   	push   %edi
+  802bf3:	e8 a5 e3 ff ff       	call   800f9d <fd2data>
+  802bf8:	89 c3                	mov    %eax,%ebx
+	for (i = 0; i < n; i++) {
+  802bfa:	83 c4 10             	add    $0x10,%esp
+  802bfd:	be 00 00 00 00       	mov    $0x0,%esi
+  802c02:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802c05:	75 13                	jne    802c1a <devpipe_read+0x34>
+	return i;
+  802c07:	89 f0                	mov    %esi,%eax
+  802c09:	eb 02                	jmp    802c0d <devpipe_read+0x27>
+				return i;
+  802c0b:	89 f0                	mov    %esi,%eax
+}
+  802c0d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802c10:	5b                   	pop    %ebx
+  802c11:	5e                   	pop    %esi
+  802c12:	5f                   	pop    %edi
+  802c13:	5d                   	pop    %ebp
+  802c14:	c3                   	ret
+			sys_yield();
+  802c15:	e8 53 df ff ff       	call   800b6d <sys_yield>
+		while (p->p_rpos == p->p_wpos) {
+  802c1a:	8b 03                	mov    (%ebx),%eax
+  802c1c:	3b 43 04             	cmp    0x4(%ebx),%eax
+  802c1f:	75 18                	jne    802c39 <devpipe_read+0x53>
+			if (i > 0)
+  802c21:	85 f6                	test   %esi,%esi
+  802c23:	75 e6                	jne    802c0b <devpipe_read+0x25>
+			if (_pipeisclosed(fd, p))
+  802c25:	89 da                	mov    %ebx,%edx
+  802c27:	89 f8                	mov    %edi,%eax
+  802c29:	e8 d4 fe ff ff       	call   802b02 <_pipeisclosed>
+  802c2e:	85 c0                	test   %eax,%eax
+  802c30:	74 e3                	je     802c15 <devpipe_read+0x2f>
+				return 0;
+  802c32:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c37:	eb d4                	jmp    802c0d <devpipe_read+0x27>
+		buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  802c39:	99                   	cltd
+  802c3a:	c1 ea 1b             	shr    $0x1b,%edx
+  802c3d:	01 d0                	add    %edx,%eax
+  802c3f:	83 e0 1f             	and    $0x1f,%eax
+  802c42:	29 d0                	sub    %edx,%eax
+  802c44:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  802c49:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802c4c:	88 04 31             	mov    %al,(%ecx,%esi,1)
+		p->p_rpos++;
+  802c4f:	83 03 01             	addl   $0x1,(%ebx)
+	for (i = 0; i < n; i++) {
+  802c52:	83 c6 01             	add    $0x1,%esi
+  802c55:	eb ab                	jmp    802c02 <devpipe_read+0x1c>
+
+00802c57 <pipe>:
+{
+  802c57:	55                   	push   %ebp
+  802c58:	89 e5                	mov    %esp,%ebp
+  802c5a:	56                   	push   %esi
+  802c5b:	53                   	push   %ebx
+  802c5c:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = fd_alloc(&fd0)) < 0
+  802c5f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802c62:	50                   	push   %eax
+  802c63:	e8 4c e3 ff ff       	call   800fb4 <fd_alloc>
+  802c68:	89 c3                	mov    %eax,%ebx
+  802c6a:	83 c4 10             	add    $0x10,%esp
+  802c6d:	85 c0                	test   %eax,%eax
+  802c6f:	0f 88 23 01 00 00    	js     802d98 <pipe+0x141>
+	    || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802c75:	83 ec 04             	sub    $0x4,%esp
+  802c78:	68 07 04 00 00       	push   $0x407
+  802c7d:	ff 75 f4             	push   -0xc(%ebp)
+  802c80:	6a 00                	push   $0x0
+  802c82:	e8 05 df ff ff       	call   800b8c <sys_page_alloc>
+  802c87:	89 c3                	mov    %eax,%ebx
+  802c89:	83 c4 10             	add    $0x10,%esp
+  802c8c:	85 c0                	test   %eax,%eax
+  802c8e:	0f 88 04 01 00 00    	js     802d98 <pipe+0x141>
+	if ((r = fd_alloc(&fd1)) < 0
+  802c94:	83 ec 0c             	sub    $0xc,%esp
+  802c97:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802c9a:	50                   	push   %eax
+  802c9b:	e8 14 e3 ff ff       	call   800fb4 <fd_alloc>
+  802ca0:	89 c3                	mov    %eax,%ebx
+  802ca2:	83 c4 10             	add    $0x10,%esp
+  802ca5:	85 c0                	test   %eax,%eax
+  802ca7:	0f 88 db 00 00 00    	js     802d88 <pipe+0x131>
+	    || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802cad:	83 ec 04             	sub    $0x4,%esp
+  802cb0:	68 07 04 00 00       	push   $0x407
+  802cb5:	ff 75 f0             	push   -0x10(%ebp)
+  802cb8:	6a 00                	push   $0x0
+  802cba:	e8 cd de ff ff       	call   800b8c <sys_page_alloc>
+  802cbf:	89 c3                	mov    %eax,%ebx
+  802cc1:	83 c4 10             	add    $0x10,%esp
+  802cc4:	85 c0                	test   %eax,%eax
+  802cc6:	0f 88 bc 00 00 00    	js     802d88 <pipe+0x131>
+	va = fd2data(fd0);
+  802ccc:	83 ec 0c             	sub    $0xc,%esp
+  802ccf:	ff 75 f4             	push   -0xc(%ebp)
+  802cd2:	e8 c6 e2 ff ff       	call   800f9d <fd2data>
+  802cd7:	89 c6                	mov    %eax,%esi
+	if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802cd9:	83 c4 0c             	add    $0xc,%esp
+  802cdc:	68 07 04 00 00       	push   $0x407
+  802ce1:	50                   	push   %eax
+  802ce2:	6a 00                	push   $0x0
+  802ce4:	e8 a3 de ff ff       	call   800b8c <sys_page_alloc>
+  802ce9:	89 c3                	mov    %eax,%ebx
+  802ceb:	83 c4 10             	add    $0x10,%esp
+  802cee:	85 c0                	test   %eax,%eax
+  802cf0:	0f 88 82 00 00 00    	js     802d78 <pipe+0x121>
+	if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802cf6:	83 ec 0c             	sub    $0xc,%esp
+  802cf9:	ff 75 f0             	push   -0x10(%ebp)
+  802cfc:	e8 9c e2 ff ff       	call   800f9d <fd2data>
+  802d01:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  802d08:	50                   	push   %eax
+  802d09:	6a 00                	push   $0x0
+  802d0b:	56                   	push   %esi
+  802d0c:	6a 00                	push   $0x0
+  802d0e:	e8 c4 de ff ff       	call   800bd7 <sys_page_map>
+  802d13:	89 c3                	mov    %eax,%ebx
+  802d15:	83 c4 20             	add    $0x20,%esp
+  802d18:	85 c0                	test   %eax,%eax
+  802d1a:	78 4e                	js     802d6a <pipe+0x113>
+	fd0->fd_dev_id = devpipe.dev_id;
+  802d1c:	a1 60 40 80 00       	mov    0x804060,%eax
+  802d21:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802d24:	89 02                	mov    %eax,(%edx)
+	fd0->fd_omode = O_RDONLY;
+  802d26:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802d29:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+	fd1->fd_dev_id = devpipe.dev_id;
+  802d30:	8b 55 f0             	mov    -0x10(%ebp),%edx
+  802d33:	89 02                	mov    %eax,(%edx)
+	fd1->fd_omode = O_WRONLY;
+  802d35:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  802d38:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+	pfd[0] = fd2num(fd0);
+  802d3f:	83 ec 0c             	sub    $0xc,%esp
+  802d42:	ff 75 f4             	push   -0xc(%ebp)
+  802d45:	e8 43 e2 ff ff       	call   800f8d <fd2num>
+  802d4a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802d4d:	89 01                	mov    %eax,(%ecx)
+	pfd[1] = fd2num(fd1);
+  802d4f:	83 c4 04             	add    $0x4,%esp
+  802d52:	ff 75 f0             	push   -0x10(%ebp)
+  802d55:	e8 33 e2 ff ff       	call   800f8d <fd2num>
+  802d5a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802d5d:	89 41 04             	mov    %eax,0x4(%ecx)
+	return 0;
+  802d60:	83 c4 10             	add    $0x10,%esp
+  802d63:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802d68:	eb 2e                	jmp    802d98 <pipe+0x141>
+	sys_page_unmap(0, va);
+  802d6a:	83 ec 08             	sub    $0x8,%esp
+  802d6d:	56                   	push   %esi
+  802d6e:	6a 00                	push   $0x0
+  802d70:	e8 a4 de ff ff       	call   800c19 <sys_page_unmap>
+  802d75:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd1);
+  802d78:	83 ec 08             	sub    $0x8,%esp
+  802d7b:	ff 75 f0             	push   -0x10(%ebp)
+  802d7e:	6a 00                	push   $0x0
+  802d80:	e8 94 de ff ff       	call   800c19 <sys_page_unmap>
+  802d85:	83 c4 10             	add    $0x10,%esp
+	sys_page_unmap(0, fd0);
+  802d88:	83 ec 08             	sub    $0x8,%esp
+  802d8b:	ff 75 f4             	push   -0xc(%ebp)
+  802d8e:	6a 00                	push   $0x0
+  802d90:	e8 84 de ff ff       	call   800c19 <sys_page_unmap>
+  802d95:	83 c4 10             	add    $0x10,%esp
+}
+  802d98:	89 d8                	mov    %ebx,%eax
+  802d9a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802d9d:	5b                   	pop    %ebx
+  802d9e:	5e                   	pop    %esi
+  802d9f:	5d                   	pop    %ebp
+  802da0:	c3                   	ret
+
+00802da1 <pipeisclosed>:
+{
+  802da1:	55                   	push   %ebp
+  802da2:	89 e5                	mov    %esp,%ebp
+  802da4:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802da7:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802daa:	50                   	push   %eax
+  802dab:	ff 75 08             	push   0x8(%ebp)
+  802dae:	e8 57 e2 ff ff       	call   80100a <fd_lookup>
+  802db3:	83 c4 10             	add    $0x10,%esp
+  802db6:	85 c0                	test   %eax,%eax
+  802db8:	78 18                	js     802dd2 <pipeisclosed+0x31>
+	p = (struct Pipe*) fd2data(fd);
+  802dba:	83 ec 0c             	sub    $0xc,%esp
+  802dbd:	ff 75 f4             	push   -0xc(%ebp)
+  802dc0:	e8 d8 e1 ff ff       	call   800f9d <fd2data>
+  802dc5:	89 c2                	mov    %eax,%edx
+	return _pipeisclosed(fd, p);
+  802dc7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802dca:	e8 33 fd ff ff       	call   802b02 <_pipeisclosed>
+  802dcf:	83 c4 10             	add    $0x10,%esp
+}
+  802dd2:	c9                   	leave
+  802dd3:	c3                   	ret
+
+00802dd4 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+	USED(fd);
+
+	return 0;
+}
+  802dd4:	b8 00 00 00 00       	mov    $0x0,%eax
+  802dd9:	c3                   	ret
+
+00802dda <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  802dda:	55                   	push   %ebp
+  802ddb:	89 e5                	mov    %esp,%ebp
+  802ddd:	83 ec 10             	sub    $0x10,%esp
+	strcpy(stat->st_name, "<cons>");
+  802de0:	68 ce 3c 80 00       	push   $0x803cce
+  802de5:	ff 75 0c             	push   0xc(%ebp)
+  802de8:	e8 93 d9 ff ff       	call   800780 <strcpy>
+	return 0;
+}
+  802ded:	b8 00 00 00 00       	mov    $0x0,%eax
+  802df2:	c9                   	leave
+  802df3:	c3                   	ret
+
+00802df4 <devcons_write>:
+{
+  802df4:	55                   	push   %ebp
+  802df5:	89 e5                	mov    %esp,%ebp
+  802df7:	57                   	push   %edi
+  802df8:	56                   	push   %esi
+  802df9:	53                   	push   %ebx
+  802dfa:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+	for (tot = 0; tot < n; tot += m) {
+  802e00:	be 00 00 00 00       	mov    $0x0,%esi
+		memmove(buf, (char*)vbuf + tot, m);
+  802e05:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+	for (tot = 0; tot < n; tot += m) {
+  802e0b:	eb 2e                	jmp    802e3b <devcons_write+0x47>
+		m = n - tot;
+  802e0d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802e10:	29 f3                	sub    %esi,%ebx
+		if (m > sizeof(buf) - 1)
+  802e12:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  802e17:	39 c3                	cmp    %eax,%ebx
+  802e19:	0f 47 d8             	cmova  %eax,%ebx
+		memmove(buf, (char*)vbuf + tot, m);
+  802e1c:	83 ec 04             	sub    $0x4,%esp
+  802e1f:	53                   	push   %ebx
+  802e20:	89 f0                	mov    %esi,%eax
+  802e22:	03 45 0c             	add    0xc(%ebp),%eax
+  802e25:	50                   	push   %eax
+  802e26:	57                   	push   %edi
+  802e27:	e8 da da ff ff       	call   800906 <memmove>
+		sys_cputs(buf, m);
+  802e2c:	83 c4 08             	add    $0x8,%esp
+  802e2f:	53                   	push   %ebx
+  802e30:	57                   	push   %edi
+  802e31:	e8 7a dc ff ff       	call   800ab0 <sys_cputs>
+	for (tot = 0; tot < n; tot += m) {
+  802e36:	01 de                	add    %ebx,%esi
+  802e38:	83 c4 10             	add    $0x10,%esp
+  802e3b:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802e3e:	72 cd                	jb     802e0d <devcons_write+0x19>
+}
+  802e40:	89 f0                	mov    %esi,%eax
+  802e42:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802e45:	5b                   	pop    %ebx
+  802e46:	5e                   	pop    %esi
+  802e47:	5f                   	pop    %edi
+  802e48:	5d                   	pop    %ebp
+  802e49:	c3                   	ret
+
+00802e4a <devcons_read>:
+{
+  802e4a:	55                   	push   %ebp
+  802e4b:	89 e5                	mov    %esp,%ebp
+  802e4d:	83 ec 08             	sub    $0x8,%esp
+	if (n == 0)
+  802e50:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e55:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802e59:	75 07                	jne    802e62 <devcons_read+0x18>
+  802e5b:	eb 1f                	jmp    802e7c <devcons_read+0x32>
+		sys_yield();
+  802e5d:	e8 0b dd ff ff       	call   800b6d <sys_yield>
+	while ((c = sys_cgetc()) == 0)
+  802e62:	e8 6f dc ff ff       	call   800ad6 <sys_cgetc>
+  802e67:	85 c0                	test   %eax,%eax
+  802e69:	74 f2                	je     802e5d <devcons_read+0x13>
+	if (c < 0)
+  802e6b:	78 0f                	js     802e7c <devcons_read+0x32>
+	if (c == 0x04)	// ctl-d is eof
+  802e6d:	83 f8 04             	cmp    $0x4,%eax
+  802e70:	74 0c                	je     802e7e <devcons_read+0x34>
+	*(char*)vbuf = c;
+  802e72:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802e75:	88 02                	mov    %al,(%edx)
+	return 1;
+  802e77:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  802e7c:	c9                   	leave
+  802e7d:	c3                   	ret
+		return 0;
+  802e7e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e83:	eb f7                	jmp    802e7c <devcons_read+0x32>
+
+00802e85 <cputchar>:
+{
+  802e85:	55                   	push   %ebp
+  802e86:	89 e5                	mov    %esp,%ebp
+  802e88:	83 ec 20             	sub    $0x20,%esp
+	char c = ch;
+  802e8b:	8b 45 08             	mov    0x8(%ebp),%eax
+  802e8e:	88 45 f7             	mov    %al,-0x9(%ebp)
+	sys_cputs(&c, 1);
+  802e91:	6a 01                	push   $0x1
+  802e93:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802e96:	50                   	push   %eax
+  802e97:	e8 14 dc ff ff       	call   800ab0 <sys_cputs>
+}
+  802e9c:	83 c4 10             	add    $0x10,%esp
+  802e9f:	c9                   	leave
+  802ea0:	c3                   	ret
+
+00802ea1 <getchar>:
+{
+  802ea1:	55                   	push   %ebp
+  802ea2:	89 e5                	mov    %esp,%ebp
+  802ea4:	83 ec 1c             	sub    $0x1c,%esp
+	r = read(0, &c, 1);
+  802ea7:	6a 01                	push   $0x1
+  802ea9:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802eac:	50                   	push   %eax
+  802ead:	6a 00                	push   $0x0
+  802eaf:	e8 bc e3 ff ff       	call   801270 <read>
+	if (r < 0)
+  802eb4:	83 c4 10             	add    $0x10,%esp
+  802eb7:	85 c0                	test   %eax,%eax
+  802eb9:	78 06                	js     802ec1 <getchar+0x20>
+	if (r < 1)
+  802ebb:	74 06                	je     802ec3 <getchar+0x22>
+	return c;
+  802ebd:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  802ec1:	c9                   	leave
+  802ec2:	c3                   	ret
+		return -E_EOF;
+  802ec3:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  802ec8:	eb f7                	jmp    802ec1 <getchar+0x20>
+
+00802eca <iscons>:
+{
+  802eca:	55                   	push   %ebp
+  802ecb:	89 e5                	mov    %esp,%ebp
+  802ecd:	83 ec 20             	sub    $0x20,%esp
+	if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802ed0:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802ed3:	50                   	push   %eax
+  802ed4:	ff 75 08             	push   0x8(%ebp)
+  802ed7:	e8 2e e1 ff ff       	call   80100a <fd_lookup>
+  802edc:	83 c4 10             	add    $0x10,%esp
+  802edf:	85 c0                	test   %eax,%eax
+  802ee1:	78 11                	js     802ef4 <iscons+0x2a>
+	return fd->fd_dev_id == devcons.dev_id;
+  802ee3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802ee6:	8b 15 80 40 80 00    	mov    0x804080,%edx
+  802eec:	39 10                	cmp    %edx,(%eax)
+  802eee:	0f 94 c0             	sete   %al
+  802ef1:	0f b6 c0             	movzbl %al,%eax
+}
+  802ef4:	c9                   	leave
+  802ef5:	c3                   	ret
+
+00802ef6 <opencons>:
+{
+  802ef6:	55                   	push   %ebp
+  802ef7:	89 e5                	mov    %esp,%ebp
+  802ef9:	83 ec 24             	sub    $0x24,%esp
+	if ((r = fd_alloc(&fd)) < 0)
+  802efc:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802eff:	50                   	push   %eax
+  802f00:	e8 af e0 ff ff       	call   800fb4 <fd_alloc>
+  802f05:	83 c4 10             	add    $0x10,%esp
+  802f08:	85 c0                	test   %eax,%eax
+  802f0a:	78 3a                	js     802f46 <opencons+0x50>
+	if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  802f0c:	83 ec 04             	sub    $0x4,%esp
+  802f0f:	68 07 04 00 00       	push   $0x407
+  802f14:	ff 75 f4             	push   -0xc(%ebp)
+  802f17:	6a 00                	push   $0x0
+  802f19:	e8 6e dc ff ff       	call   800b8c <sys_page_alloc>
+  802f1e:	83 c4 10             	add    $0x10,%esp
+  802f21:	85 c0                	test   %eax,%eax
+  802f23:	78 21                	js     802f46 <opencons+0x50>
+	fd->fd_dev_id = devcons.dev_id;
+  802f25:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802f28:	8b 15 80 40 80 00    	mov    0x804080,%edx
+  802f2e:	89 10                	mov    %edx,(%eax)
+	fd->fd_omode = O_RDWR;
+  802f30:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802f33:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+	return fd2num(fd);
+  802f3a:	83 ec 0c             	sub    $0xc,%esp
+  802f3d:	50                   	push   %eax
+  802f3e:	e8 4a e0 ff ff       	call   800f8d <fd2num>
+  802f43:	83 c4 10             	add    $0x10,%esp
+}
+  802f46:	c9                   	leave
+  802f47:	c3                   	ret
+
+00802f48 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  802f48:	55                   	push   %ebp
+  802f49:	89 e5                	mov    %esp,%ebp
+  802f4b:	56                   	push   %esi
+  802f4c:	53                   	push   %ebx
+	va_list ap;
+
+	va_start(ap, fmt);
+  802f4d:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+	// Print the panic message
+	cprintf("[%08x] user panic in %s at %s:%d: ",
+  802f50:	8b 35 00 40 80 00    	mov    0x804000,%esi
+  802f56:	e8 eb db ff ff       	call   800b46 <sys_getenvid>
+  802f5b:	83 ec 0c             	sub    $0xc,%esp
+  802f5e:	ff 75 0c             	push   0xc(%ebp)
+  802f61:	ff 75 08             	push   0x8(%ebp)
+  802f64:	56                   	push   %esi
+  802f65:	50                   	push   %eax
+  802f66:	68 dc 3c 80 00       	push   $0x803cdc
+  802f6b:	e8 22 d2 ff ff       	call   800192 <cprintf>
+		sys_getenvid(), binaryname, file, line);
+	vcprintf(fmt, ap);
+  802f70:	83 c4 18             	add    $0x18,%esp
+  802f73:	53                   	push   %ebx
+  802f74:	ff 75 10             	push   0x10(%ebp)
+  802f77:	e8 c5 d1 ff ff       	call   800141 <vcprintf>
+	cprintf("\n");
+  802f7c:	c7 04 24 c7 3c 80 00 	movl   $0x803cc7,(%esp)
+  802f83:	e8 0a d2 ff ff       	call   800192 <cprintf>
+  802f88:	83 c4 10             	add    $0x10,%esp
+
+	// Cause a breakpoint exception
+	while (1)
+		asm volatile("int3");
+  802f8b:	cc                   	int3
+	while (1)
+  802f8c:	eb fd                	jmp    802f8b <_panic+0x43>
+
+00802f8e <copy_page_to>:
+// The handler cowpage found installed, which gets the faults that are
+// not copy-on-write faults.
+static void (*pgfault_next)(struct UTrapframe *utf);
+
+static int copy_page_to(envid_t envid, void *va, int perm)
+{
+  802f8e:	55                   	push   %ebp
+  802f8f:	89 e5                	mov    %esp,%ebp
+  802f91:	57                   	push   %edi
+  802f92:	56                   	push   %esi
+  802f93:	53                   	push   %ebx
+  802f94:	83 ec 20             	sub    $0x20,%esp
+  802f97:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802f9a:	89 d7                	mov    %edx,%edi
+  802f9c:	89 ce                	mov    %ecx,%esi
+	int r;
+
+	r = sys_page_alloc(0, (void *) PFTEMP, perm);
+  802f9e:	51                   	push   %ecx
+  802f9f:	68 00 f0 7f 00       	push   $0x7ff000
+  802fa4:	6a 00                	push   $0x0
+  802fa6:	e8 e1 db ff ff       	call   800b8c <sys_page_alloc>
+  802fab:	89 c3                	mov    %eax,%ebx
+	if (r < 0)
+  802fad:	83 c4 10             	add    $0x10,%esp
+  802fb0:	85 c0                	test   %eax,%eax
+  802fb2:	78 45                	js     802ff9 <copy_page_to+0x6b>
+		goto exit;
+	memmove((void *) PFTEMP, va, PGSIZE);
+  802fb4:	83 ec 04             	sub    $0x4,%esp
+  802fb7:	68 00 10 00 00       	push   $0x1000
+  802fbc:	57                   	push   %edi
+  802fbd:	68 00 f0 7f 00       	push   $0x7ff000
+  802fc2:	e8 3f d9 ff ff       	call   800906 <memmove>
+	r = sys_page_map(0, (void *) PFTEMP, envid, va, perm);
+  802fc7:	89 34 24             	mov    %esi,(%esp)
+  802fca:	57                   	push   %edi
+  802fcb:	ff 75 e4             	push   -0x1c(%ebp)
+  802fce:	68 00 f0 7f 00       	push   $0x7ff000
+  802fd3:	6a 00                	push   $0x0
+  802fd5:	e8 fd db ff ff       	call   800bd7 <sys_page_map>
+  802fda:	89 c3                	mov    %eax,%ebx
+	if (r < 0)
+  802fdc:	83 c4 20             	add    $0x20,%esp
+  802fdf:	85 c0                	test   %eax,%eax
+  802fe1:	78 16                	js     802ff9 <copy_page_to+0x6b>
+		goto exit;
+	assert(!sys_page_unmap(0, (void *) PFTEMP));
+  802fe3:	83 ec 08             	sub    $0x8,%esp
+  802fe6:	68 00 f0 7f 00       	push   $0x7ff000
+  802feb:	6a 00                	push   $0x0
+  802fed:	e8 27 dc ff ff       	call   800c19 <sys_page_unmap>
+  802ff2:	83 c4 10             	add    $0x10,%esp
+  802ff5:	85 c0                	test   %eax,%eax
+  802ff7:	75 0a                	jne    803003 <copy_page_to+0x75>
+exit:
+	return r;
+}
+  802ff9:	89 d8                	mov    %ebx,%eax
+  802ffb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802ffe:	5b                   	pop    %ebx
+  802fff:	5e                   	pop    %esi
+  803000:	5f                   	pop    %edi
+  803001:	5d                   	pop    %ebp
+  803002:	c3                   	ret
+	assert(!sys_page_unmap(0, (void *) PFTEMP));
+  803003:	68 00 3d 80 00       	push   $0x803d00
+  803008:	68 20 3c 80 00       	push   $0x803c20
+  80300d:	6a 1b                	push   $0x1b
+  80300f:	68 78 3d 80 00       	push   $0x803d78
+  803014:	e8 2f ff ff ff       	call   802f48 <_panic>
+
+00803019 <pgfault>:
+// map in our own private writable copy.  Other faults go to the handler
+// cowpage replaced, if any.
+//
+static void
+pgfault(struct UTrapframe *utf)
+{
+  803019:	55                   	push   %ebp
+  80301a:	89 e5                	mov    %esp,%ebp
+  80301c:	53                   	push   %ebx
+  80301d:	83 ec 04             	sub    $0x4,%esp
+  803020:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	void *addr = (void *) utf->utf_fault_va;
+  803023:	8b 13                	mov    (%ebx),%edx
+	// Hint:
+	//   Use the read-only page table mappings at uvpt
+	//   (see <inc/memlayout.h>).
+
+	// LAB 4: Your code here.
+	if (!(err & FEC_WR) || !(uvpd[PDX(addr)] & PTE_P)
+  803025:	f6 43 04 02          	testb  $0x2,0x4(%ebx)
+  803029:	74 21                	je     80304c <pgfault+0x33>
+  80302b:	89 d0                	mov    %edx,%eax
+  80302d:	c1 e8 16             	shr    $0x16,%eax
+  803030:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  803037:	a8 01                	test   $0x1,%al
+  803039:	74 11                	je     80304c <pgfault+0x33>
+	    || !(uvpt[PGNUM(addr)] & PTE_COW)) {
+  80303b:	89 d0                	mov    %edx,%eax
+  80303d:	c1 e8 0c             	shr    $0xc,%eax
+  803040:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  803047:	f6 c4 08             	test   $0x8,%ah
+  80304a:	75 17                	jne    803063 <pgfault+0x4a>
+		if (pgfault_next) {
+  80304c:	a1 04 90 80 00       	mov    0x809004,%eax
+  803051:	85 c0                	test   %eax,%eax
+  803053:	74 27                	je     80307c <pgfault+0x63>
+			pgfault_next(utf);
+  803055:	83 ec 0c             	sub    $0xc,%esp
+  803058:	53                   	push   %ebx
+  803059:	ff d0                	call   *%eax
+			return;
+  80305b:	83 c4 10             	add    $0x10,%esp
+exit:
+	cprintf("[%08x] pgfault: Can't handle page fault happened at"
+		"0x%08x, eip: 0x%08x. Exiting...\n", thisenv->env_id,
+		utf->utf_fault_va, utf->utf_eip);
+	sys_env_destroy(0);
+}
+  80305e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803061:	c9                   	leave
+  803062:	c3                   	ret
+	if (copy_page_to(0, ROUNDDOWN(addr, PGSIZE), PTE_U | PTE_W | PTE_P) < 0)
+  803063:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+  803069:	b9 07 00 00 00       	mov    $0x7,%ecx
+  80306e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803073:	e8 16 ff ff ff       	call   802f8e <copy_page_to>
+  803078:	85 c0                	test   %eax,%eax
+  80307a:	79 e2                	jns    80305e <pgfault+0x45>
+		"0x%08x, eip: 0x%08x. Exiting...\n", thisenv->env_id,
+  80307c:	a1 00 50 80 00       	mov    0x805000,%eax
+  803081:	8b 40 48             	mov    0x48(%eax),%eax
+	cprintf("[%08x] pgfault: Can't handle page fault happened at"
+  803084:	ff 73 28             	push   0x28(%ebx)
+  803087:	ff 33                	push   (%ebx)
+  803089:	50                   	push   %eax
+  80308a:	68 24 3d 80 00       	push   $0x803d24
+  80308f:	e8 fe d0 ff ff       	call   800192 <cprintf>
+	sys_env_destroy(0);
+  803094:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  80309b:	e8 5d da ff ff       	call   800afd <sys_env_destroy>
+  8030a0:	83 c4 10             	add    $0x10,%esp
+  8030a3:	eb b9                	jmp    80305e <pgfault+0x45>
+
+008030a5 <cowpage>:
+//
+// Returns: 0 on success, < 0 on error.
+//
+int
+cowpage(void *va)
+{
+  8030a5:	55                   	push   %ebp
+  8030a6:	89 e5                	mov    %esp,%ebp
+  8030a8:	53                   	push   %ebx
+  8030a9:	83 ec 04             	sub    $0x4,%esp
+  8030ac:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (_pgfault_handler != pgfault) {
+  8030af:	a1 08 90 80 00       	mov    0x809008,%eax
+  8030b4:	3d 19 30 80 00       	cmp    $0x803019,%eax
+  8030b9:	74 15                	je     8030d0 <cowpage+0x2b>
+		pgfault_next = _pgfault_handler;
+  8030bb:	a3 04 90 80 00       	mov    %eax,0x809004
+		set_pgfault_handler(pgfault);
+  8030c0:	83 ec 0c             	sub    $0xc,%esp
+  8030c3:	68 19 30 80 00       	push   $0x803019
+  8030c8:	e8 fb 03 00 00       	call   8034c8 <set_pgfault_handler>
+  8030cd:	83 c4 10             	add    $0x10,%esp
+	}
+	return sys_page_map(0, va, 0, va, PTE_COW | PTE_U | PTE_P);
+  8030d0:	83 ec 0c             	sub    $0xc,%esp
+  8030d3:	68 05 08 00 00       	push   $0x805
+  8030d8:	53                   	push   %ebx
+  8030d9:	6a 00                	push   $0x0
+  8030db:	53                   	push   %ebx
+  8030dc:	6a 00                	push   $0x0
+  8030de:	e8 f4 da ff ff       	call   800bd7 <sys_page_map>
+}
+  8030e3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8030e6:	c9                   	leave
+  8030e7:	c3                   	ret
+
+008030e8 <fork>:
+//   Neither user exception stack should ever be marked copy-on-write,
+//   so you must allocate a new page for the child's user exception stack.
+//
+envid_t
+fork(void)
+{
+  8030e8:	55                   	push   %ebp
+  8030e9:	89 e5                	mov    %esp,%ebp
+  8030eb:	57                   	push   %edi
+  8030ec:	56                   	push   %esi
+  8030ed:	53                   	push   %ebx
+  8030ee:	83 ec 28             	sub    $0x28,%esp
+	// LAB 4: Your code here.
+	envid_t envid;
+	int r;
+
+	set_pgfault_handler(pgfault);
+  8030f1:	68 19 30 80 00       	push   $0x803019
+  8030f6:	e8 cd 03 00 00       	call   8034c8 <set_pgfault_handler>
+// child pointing to the trashed stack frame.
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+	envid_t ret;
+	asm volatile("int %2"
+  8030fb:	b8 07 00 00 00       	mov    $0x7,%eax
+  803100:	cd 30                	int    $0x30
+  803102:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  803105:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	envid = sys_exofork();
+	if (envid < 0)
+  803108:	83 c4 10             	add    $0x10,%esp
+  80310b:	85 c0                	test   %eax,%eax
+  80310d:	0f 88 6b 01 00 00    	js     80327e <fork+0x196>
+	else if (envid == 0) {
+		thisenv = &envs[ENVX(sys_getenvid())];
+		return 0;
+	}
+
+	for (uintptr_t addr = 0; addr < UTOP; addr += PGSIZE) {
+  803113:	bb 00 00 00 00       	mov    $0x0,%ebx
+	else if (envid == 0) {
+  803118:	75 37                	jne    803151 <fork+0x69>
+		thisenv = &envs[ENVX(sys_getenvid())];
+  80311a:	e8 27 da ff ff       	call   800b46 <sys_getenvid>
+  80311f:	25 ff 03 00 00       	and    $0x3ff,%eax
+  803124:	69 c0 8c 00 00 00    	imul   $0x8c,%eax,%eax
+  80312a:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80312f:	a3 00 50 80 00       	mov    %eax,0x805000
+		return 0;
+  803134:	e9 45 01 00 00       	jmp    80327e <fork+0x196>
+		if (!(uvpd[PDX(addr)] & PTE_P)) {
+			addr += PTSIZE - PGSIZE;
+  803139:	81 c3 00 f0 3f 00    	add    $0x3ff000,%ebx
+	for (uintptr_t addr = 0; addr < UTOP; addr += PGSIZE) {
+  80313f:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  803145:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+  80314b:	0f 87 ba 00 00 00    	ja     80320b <fork+0x123>
+		if (!(uvpd[PDX(addr)] & PTE_P)) {
+  803151:	89 d8                	mov    %ebx,%eax
+  803153:	c1 e8 16             	shr    $0x16,%eax
+  803156:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  80315d:	a8 01                	test   $0x1,%al
+  80315f:	74 d8                	je     803139 <fork+0x51>
+			continue;
+		}
+		if (!(uvpt[PGNUM(addr)] & PTE_P))
+  803161:	89 d8                	mov    %ebx,%eax
+  803163:	c1 e8 0c             	shr    $0xc,%eax
+  803166:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  80316d:	f6 c2 01             	test   $0x1,%dl
+  803170:	74 cd                	je     80313f <fork+0x57>
+			continue;
+		if (addr == USTACKTOP - PGSIZE || addr == UXSTACKTOP - PGSIZE)
+  803172:	89 da                	mov    %ebx,%edx
+  803174:	80 e6 df             	and    $0xdf,%dh
+  803177:	81 fa 00 d0 bf ee    	cmp    $0xeebfd000,%edx
+  80317d:	74 c0                	je     80313f <fork+0x57>
+	void *va = (void *) (pn << PGSHIFT);
+  80317f:	89 df                	mov    %ebx,%edi
+	if ((uvpt[pn] & PTE_SHARE) ||
+  803181:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  803188:	f6 c6 04             	test   $0x4,%dh
+  80318b:	75 53                	jne    8031e0 <fork+0xf8>
+	    (!(uvpt[pn] & PTE_COW) && !(uvpt[pn] & PTE_W)))
+  80318d:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+	if ((uvpt[pn] & PTE_SHARE) ||
+  803194:	f6 c6 08             	test   $0x8,%dh
+  803197:	75 0c                	jne    8031a5 <fork+0xbd>
+	    (!(uvpt[pn] & PTE_COW) && !(uvpt[pn] & PTE_W)))
+  803199:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8031a0:	f6 c2 02             	test   $0x2,%dl
+  8031a3:	74 3b                	je     8031e0 <fork+0xf8>
+	r = sys_page_map(0, va, envid, va, PTE_COW | PTE_U | PTE_P);
+  8031a5:	83 ec 0c             	sub    $0xc,%esp
+  8031a8:	68 05 08 00 00       	push   $0x805
+  8031ad:	57                   	push   %edi
+  8031ae:	ff 75 e4             	push   -0x1c(%ebp)
+  8031b1:	57                   	push   %edi
+  8031b2:	6a 00                	push   $0x0
+  8031b4:	e8 1e da ff ff       	call   800bd7 <sys_page_map>
+  8031b9:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  8031bb:	83 c4 20             	add    $0x20,%esp
+  8031be:	85 c0                	test   %eax,%eax
+  8031c0:	0f 88 a7 00 00 00    	js     80326d <fork+0x185>
+	r = sys_page_map(0, va, 0, va, PTE_COW | PTE_U | PTE_P);
+  8031c6:	83 ec 0c             	sub    $0xc,%esp
+  8031c9:	68 05 08 00 00       	push   $0x805
+  8031ce:	57                   	push   %edi
+  8031cf:	6a 00                	push   $0x0
+  8031d1:	57                   	push   %edi
+  8031d2:	6a 00                	push   $0x0
+  8031d4:	e8 fe d9 ff ff       	call   800bd7 <sys_page_map>
+  8031d9:	89 c6                	mov    %eax,%esi
+	return r;
+  8031db:	83 c4 20             	add    $0x20,%esp
+  8031de:	eb 21                	jmp    803201 <fork+0x119>
+		return sys_page_map(0, va, envid, va, uvpt[pn] & PTE_SYSCALL);
+  8031e0:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8031e7:	83 ec 0c             	sub    $0xc,%esp
+  8031ea:	25 07 0e 00 00       	and    $0xe07,%eax
+  8031ef:	50                   	push   %eax
+  8031f0:	57                   	push   %edi
+  8031f1:	ff 75 e4             	push   -0x1c(%ebp)
+  8031f4:	57                   	push   %edi
+  8031f5:	6a 00                	push   $0x0
+  8031f7:	e8 db d9 ff ff       	call   800bd7 <sys_page_map>
+  8031fc:	89 c6                	mov    %eax,%esi
+  8031fe:	83 c4 20             	add    $0x20,%esp
+			continue;
+		r = duppage(envid, PGNUM(addr));
+		if (r < 0)
+  803201:	85 f6                	test   %esi,%esi
+  803203:	0f 89 36 ff ff ff    	jns    80313f <fork+0x57>
+  803209:	eb 62                	jmp    80326d <fork+0x185>
+			goto exit;
+	}
+
+	r = copy_page_to(envid, (void *) USTACKTOP - PGSIZE, PTE_U | PTE_W | PTE_P);
+  80320b:	b9 07 00 00 00       	mov    $0x7,%ecx
+  803210:	ba 00 d0 bf ee       	mov    $0xeebfd000,%edx
+  803215:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  803218:	89 f8                	mov    %edi,%eax
+  80321a:	e8 6f fd ff ff       	call   802f8e <copy_page_to>
+  80321f:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  803221:	85 c0                	test   %eax,%eax
+  803223:	78 48                	js     80326d <fork+0x185>
+		goto exit;
+	r = sys_page_alloc(envid, (void *) UXSTACKTOP - PGSIZE, PTE_U | PTE_W | PTE_P);
+  803225:	83 ec 04             	sub    $0x4,%esp
+  803228:	6a 07                	push   $0x7
+  80322a:	68 00 f0 bf ee       	push   $0xeebff000
+  80322f:	57                   	push   %edi
+  803230:	e8 57 d9 ff ff       	call   800b8c <sys_page_alloc>
+  803235:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  803237:	83 c4 10             	add    $0x10,%esp
+  80323a:	85 c0                	test   %eax,%eax
+  80323c:	78 2f                	js     80326d <fork+0x185>
+		goto exit;
+	r = sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall);
+  80323e:	a1 00 50 80 00       	mov    0x805000,%eax
+  803243:	8b 40 64             	mov    0x64(%eax),%eax
+  803246:	83 ec 08             	sub    $0x8,%esp
+  803249:	50                   	push   %eax
+  80324a:	57                   	push   %edi
+  80324b:	e8 a7 da ff ff       	call   800cf7 <sys_env_set_pgfault_upcall>
+  803250:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  803252:	83 c4 10             	add    $0x10,%esp
+  803255:	85 c0                	test   %eax,%eax
+  803257:	78 14                	js     80326d <fork+0x185>
+		goto exit;
+	r = sys_env_set_status(envid, ENV_RUNNABLE);
+  803259:	83 ec 08             	sub    $0x8,%esp
+  80325c:	6a 02                	push   $0x2
+  80325e:	57                   	push   %edi
+  80325f:	e8 ff d9 ff ff       	call   800c63 <sys_env_set_status>
+  803264:	89 c6                	mov    %eax,%esi
+	if (r < 0)
+  803266:	83 c4 10             	add    $0x10,%esp
+  803269:	85 c0                	test   %eax,%eax
+  80326b:	79 11                	jns    80327e <fork+0x196>
+		goto exit;
+	return envid;
+exit:
+	sys_env_destroy(envid);
+  80326d:	83 ec 0c             	sub    $0xc,%esp
+  803270:	ff 75 e0             	push   -0x20(%ebp)
+  803273:	e8 85 d8 ff ff       	call   800afd <sys_env_destroy>
+	return r;
+  803278:	83 c4 10             	add    $0x10,%esp
+  80327b:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+}
+  80327e:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803281:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803284:	5b                   	pop    %ebx
+  803285:	5e                   	pop    %esi
+  803286:	5f                   	pop    %edi
+  803287:	5d                   	pop    %ebp
+  803288:	c3                   	ret
+
+00803289 <sfork>:
+
+// Challenge!
+int
+sfork(void)
+{
+  803289:	55                   	push   %ebp
+  80328a:	89 e5                	mov    %esp,%ebp
+  80328c:	83 ec 0c             	sub    $0xc,%esp
+	panic("sfork not implemented");
+  80328f:	68 83 3d 80 00       	push   $0x803d83
+  803294:	68 bf 00 00 00       	push   $0xbf
+  803299:	68 78 3d 80 00       	push   $0x803d78
+  80329e:	e8 a5 fc ff ff       	call   802f48 <_panic>
+
+008032a3 <ipc_recv>:
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  8032a3:	55                   	push   %ebp
+  8032a4:	89 e5                	mov    %esp,%ebp
+  8032a6:	56                   	push   %esi
+  8032a7:	53                   	push   %ebx
+  8032a8:	8b 75 08             	mov    0x8(%ebp),%esi
+  8032ab:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8032ae:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int r;
+
+	if (pg == NULL)
+		pg = (void *) UTOP;
+  8032b1:	85 c0                	test   %eax,%eax
+  8032b3:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  8032b8:	0f 44 c2             	cmove  %edx,%eax
+
+	r = sys_ipc_recv(pg);
+  8032bb:	83 ec 0c             	sub    $0xc,%esp
+  8032be:	50                   	push   %eax
+  8032bf:	e8 10 db ff ff       	call   800dd4 <sys_ipc_recv>
+	if (from_env_store)
+  8032c4:	83 c4 10             	add    $0x10,%esp
+  8032c7:	85 f6                	test   %esi,%esi
+  8032c9:	74 14                	je     8032df <ipc_recv+0x3c>
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  8032cb:	ba 00 00 00 00       	mov    $0x0,%edx
+  8032d0:	85 c0                	test   %eax,%eax
+  8032d2:	75 09                	jne    8032dd <ipc_recv+0x3a>
+  8032d4:	8b 15 00 50 80 00    	mov    0x805000,%edx
+  8032da:	8b 52 74             	mov    0x74(%edx),%edx
+  8032dd:	89 16                	mov    %edx,(%esi)
+	if (perm_store)
+  8032df:	85 db                	test   %ebx,%ebx
+  8032e1:	74 25                	je     803308 <ipc_recv+0x65>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  8032e3:	85 c0                	test   %eax,%eax
+  8032e5:	74 0d                	je     8032f4 <ipc_recv+0x51>
+  8032e7:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+	return r ?: thisenv->env_ipc_value;
+}
+  8032ed:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8032f0:	5b                   	pop    %ebx
+  8032f1:	5e                   	pop    %esi
+  8032f2:	5d                   	pop    %ebp
+  8032f3:	c3                   	ret
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  8032f4:	a1 00 50 80 00       	mov    0x805000,%eax
+  8032f9:	8b 40 78             	mov    0x78(%eax),%eax
+  8032fc:	89 03                	mov    %eax,(%ebx)
+	return r ?: thisenv->env_ipc_value;
+  8032fe:	a1 00 50 80 00       	mov    0x805000,%eax
+  803303:	8b 40 70             	mov    0x70(%eax),%eax
+  803306:	eb e5                	jmp    8032ed <ipc_recv+0x4a>
+  803308:	85 c0                	test   %eax,%eax
+  80330a:	75 e1                	jne    8032ed <ipc_recv+0x4a>
+  80330c:	eb f0                	jmp    8032fe <ipc_recv+0x5b>
+
+0080330e <ipc_send>:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_try_send a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  80330e:	55                   	push   %ebp
+  80330f:	89 e5                	mov    %esp,%ebp
+  803311:	57                   	push   %edi
+  803312:	56                   	push   %esi
+  803313:	53                   	push   %ebx
+  803314:	83 ec 0c             	sub    $0xc,%esp
+  803317:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80331a:	8b 75 0c             	mov    0xc(%ebp),%esi
+  80331d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	// LAB 4: Your code here.
+	int r;
+
+	if (pg == NULL)
+		pg = (void *) UTOP;
+  803320:	85 db                	test   %ebx,%ebx
+  803322:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  803327:	0f 44 d8             	cmove  %eax,%ebx
+
+	while ((r = sys_ipc_try_send(to_env, val, pg, perm))) {
+  80332a:	ff 75 14             	push   0x14(%ebp)
+  80332d:	53                   	push   %ebx
+  80332e:	56                   	push   %esi
+  80332f:	57                   	push   %edi
+  803330:	e8 0c da ff ff       	call   800d41 <sys_ipc_try_send>
+  803335:	83 c4 10             	add    $0x10,%esp
+  803338:	85 c0                	test   %eax,%eax
+  80333a:	74 22                	je     80335e <ipc_send+0x50>
+		assert(r == -E_IPC_NOT_RECV);
+  80333c:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  80333f:	75 07                	jne    803348 <ipc_send+0x3a>
+		sys_yield();
+  803341:	e8 27 d8 ff ff       	call   800b6d <sys_yield>
+  803346:	eb e2                	jmp    80332a <ipc_send+0x1c>
+		assert(r == -E_IPC_NOT_RECV);
+  803348:	68 99 3d 80 00       	push   $0x803d99
+  80334d:	68 20 3c 80 00       	push   $0x803c20
+  803352:	6a 39                	push   $0x39
+  803354:	68 ae 3d 80 00       	push   $0x803dae
+  803359:	e8 ea fb ff ff       	call   802f48 <_panic>
+	}
+}
+  80335e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803361:	5b                   	pop    %ebx
+  803362:	5e                   	pop    %esi
+  803363:	5f                   	pop    %edi
+  803364:	5d                   	pop    %ebp
+  803365:	c3                   	ret
+
+00803366 <ipc_recvv>:
+// Receive a value and up to *npages pages, mapped one after another
+// starting at 'pg'.  Like ipc_recv otherwise; also stores the number
+// of pages actually received in *npages (0 on error).
+int32_t
+ipc_recvv(envid_t *from_env_store, void *pg, int *npages, int *perm_store)
+{
+  803366:	55                   	push   %ebp
+  803367:	89 e5                	mov    %esp,%ebp
+  803369:	57                   	push   %edi
+  80336a:	56                   	push   %esi
+  80336b:	53                   	push   %ebx
+  80336c:	83 ec 10             	sub    $0x10,%esp
+  80336f:	8b 7d 08             	mov    0x8(%ebp),%edi
+  803372:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803375:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  803378:	8b 75 14             	mov    0x14(%ebp),%esi
+	int r;
+
+	if (pg == NULL)
+		pg = (void *) UTOP;
+  80337b:	85 c0                	test   %eax,%eax
+  80337d:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  803382:	0f 44 c2             	cmove  %edx,%eax
+
+	r = sys_ipc_recvv(pg, *npages, 0);
+  803385:	6a 00                	push   $0x0
+  803387:	ff 33                	push   (%ebx)
+  803389:	50                   	push   %eax
+  80338a:	e8 02 da ff ff       	call   800d91 <sys_ipc_recvv>
+	*npages = !r ? thisenv->env_ipc_npages : 0;
+  80338f:	83 c4 10             	add    $0x10,%esp
+  803392:	85 c0                	test   %eax,%eax
+  803394:	75 3c                	jne    8033d2 <ipc_recvv+0x6c>
+  803396:	8b 15 00 50 80 00    	mov    0x805000,%edx
+  80339c:	8b 52 7c             	mov    0x7c(%edx),%edx
+  80339f:	89 13                	mov    %edx,(%ebx)
+	if (from_env_store)
+  8033a1:	85 ff                	test   %edi,%edi
+  8033a3:	74 4e                	je     8033f3 <ipc_recvv+0x8d>
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  8033a5:	8b 15 00 50 80 00    	mov    0x805000,%edx
+  8033ab:	8b 52 74             	mov    0x74(%edx),%edx
+  8033ae:	89 17                	mov    %edx,(%edi)
+	if (perm_store)
+  8033b0:	85 f6                	test   %esi,%esi
+  8033b2:	74 18                	je     8033cc <ipc_recvv+0x66>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  8033b4:	85 c0                	test   %eax,%eax
+  8033b6:	75 2d                	jne    8033e5 <ipc_recvv+0x7f>
+  8033b8:	a1 00 50 80 00       	mov    0x805000,%eax
+  8033bd:	8b 40 78             	mov    0x78(%eax),%eax
+  8033c0:	89 06                	mov    %eax,(%esi)
+	return r ?: thisenv->env_ipc_value;
+  8033c2:	a1 00 50 80 00       	mov    0x805000,%eax
+  8033c7:	8b 40 70             	mov    0x70(%eax),%eax
+  8033ca:	eb 1f                	jmp    8033eb <ipc_recvv+0x85>
+  8033cc:	85 c0                	test   %eax,%eax
+  8033ce:	75 1b                	jne    8033eb <ipc_recvv+0x85>
+  8033d0:	eb f0                	jmp    8033c2 <ipc_recvv+0x5c>
+	*npages = !r ? thisenv->env_ipc_npages : 0;
+  8033d2:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+		*from_env_store = !r ? thisenv->env_ipc_from : 0;
+  8033d8:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (from_env_store)
+  8033dd:	85 ff                	test   %edi,%edi
+  8033df:	75 cd                	jne    8033ae <ipc_recvv+0x48>
+	if (perm_store)
+  8033e1:	85 f6                	test   %esi,%esi
+  8033e3:	74 e7                	je     8033cc <ipc_recvv+0x66>
+		*perm_store = !r ? thisenv->env_ipc_perm : 0;
+  8033e5:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+}
+  8033eb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8033ee:	5b                   	pop    %ebx
+  8033ef:	5e                   	pop    %esi
+  8033f0:	5f                   	pop    %edi
+  8033f1:	5d                   	pop    %ebp
+  8033f2:	c3                   	ret
+	if (perm_store)
+  8033f3:	85 f6                	test   %esi,%esi
+  8033f5:	75 bd                	jne    8033b4 <ipc_recvv+0x4e>
+  8033f7:	eb c9                	jmp    8033c2 <ipc_recvv+0x5c>
+
+008033f9 <ipc_sendv>:
+// Each entry is a page address or'ed with the permissions to send
+// that page with (see sys_ipc_try_sendv).
+// Like ipc_send, keeps trying until it succeeds.
+void
+ipc_sendv(envid_t to_env, uint32_t val, const uintptr_t *pages, int npages)
+{
+  8033f9:	55                   	push   %ebp
+  8033fa:	89 e5                	mov    %esp,%ebp
+  8033fc:	57                   	push   %edi
+  8033fd:	56                   	push   %esi
+  8033fe:	53                   	push   %ebx
+  8033ff:	83 ec 0c             	sub    $0xc,%esp
+  803402:	8b 7d 08             	mov    0x8(%ebp),%edi
+  803405:	8b 75 0c             	mov    0xc(%ebp),%esi
+  803408:	8b 5d 10             	mov    0x10(%ebp),%ebx
+	int r;
+
+	while ((r = sys_ipc_try_sendv(to_env, val, pages, npages))) {
+  80340b:	ff 75 14             	push   0x14(%ebp)
+  80340e:	53                   	push   %ebx
+  80340f:	56                   	push   %esi
+  803410:	57                   	push   %edi
+  803411:	e8 53 d9 ff ff       	call   800d69 <sys_ipc_try_sendv>
+  803416:	83 c4 10             	add    $0x10,%esp
+  803419:	85 c0                	test   %eax,%eax
+  80341b:	74 22                	je     80343f <ipc_sendv+0x46>
+		assert(r == -E_IPC_NOT_RECV);
+  80341d:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  803420:	75 07                	jne    803429 <ipc_sendv+0x30>
+		sys_yield();
+  803422:	e8 46 d7 ff ff       	call   800b6d <sys_yield>
+  803427:	eb e2                	jmp    80340b <ipc_sendv+0x12>
+		assert(r == -E_IPC_NOT_RECV);
+  803429:	68 99 3d 80 00       	push   $0x803d99
+  80342e:	68 20 3c 80 00       	push   $0x803c20
+  803433:	6a 5c                	push   $0x5c
+  803435:	68 ae 3d 80 00       	push   $0x803dae
+  80343a:	e8 09 fb ff ff       	call   802f48 <_panic>
+	}
+}
+  80343f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803442:	5b                   	pop    %ebx
+  803443:	5e                   	pop    %esi
+  803444:	5f                   	pop    %edi
+  803445:	5d                   	pop    %ebp
+  803446:	c3                   	ret
+
+00803447 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  803447:	55                   	push   %ebp
+  803448:	89 e5                	mov    %esp,%ebp
+  80344a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	int i;
+	for (i = 0; i < NENV; i++)
+  80344d:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (envs[i].env_type == type)
+  803452:	69 d0 8c 00 00 00    	imul   $0x8c,%eax,%edx
+  803458:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  80345e:	8b 52 50             	mov    0x50(%edx),%edx
+  803461:	39 ca                	cmp    %ecx,%edx
+  803463:	74 11                	je     803476 <ipc_find_env+0x2f>
+	for (i = 0; i < NENV; i++)
+  803465:	83 c0 01             	add    $0x1,%eax
+  803468:	3d 00 04 00 00       	cmp    $0x400,%eax
+  80346d:	75 e3                	jne    803452 <ipc_find_env+0xb>
+			return envs[i].env_id;
+	return 0;
+  80346f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803474:	eb 0e                	jmp    803484 <ipc_find_env+0x3d>
+			return envs[i].env_id;
+  803476:	69 c0 8c 00 00 00    	imul   $0x8c,%eax,%eax
+  80347c:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803481:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  803484:	5d                   	pop    %ebp
+  803485:	c3                   	ret
+
+00803486 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  803486:	55                   	push   %ebp
+  803487:	89 e5                	mov    %esp,%ebp
+  803489:	8b 45 08             	mov    0x8(%ebp),%eax
+	pte_t pte;
+
+	if (!(uvpd[PDX(v)] & PTE_P))
+  80348c:	89 c2                	mov    %eax,%edx
+  80348e:	c1 ea 16             	shr    $0x16,%edx
+  803491:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+		return 0;
+  803498:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (!(uvpd[PDX(v)] & PTE_P))
+  80349d:	f6 c1 01             	test   $0x1,%cl
+  8034a0:	74 22                	je     8034c4 <pageref+0x3e>
+	pte = uvpt[PGNUM(v)];
+  8034a2:	c1 e8 0c             	shr    $0xc,%eax
+  8034a5:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+	if (!(pte & PTE_P))
+  8034ac:	a8 01                	test   $0x1,%al
+  8034ae:	74 14                	je     8034c4 <pageref+0x3e>
+		return 0;
+	return pages[PGNUM(pte)].pp_ref;
+  8034b0:	c1 e8 0c             	shr    $0xc,%eax
+  8034b3:	8d 04 40             	lea    (%eax,%eax,2),%eax
+  8034b6:	8d 04 85 00 00 00 ef 	lea    -0x11000000(,%eax,4),%eax
+  8034bd:	0f b7 50 08          	movzwl 0x8(%eax),%edx
+  8034c1:	0f b7 d2             	movzwl %dx,%edx
+}
+  8034c4:	89 d0                	mov    %edx,%eax
+  8034c6:	5d                   	pop    %ebp
+  8034c7:	c3                   	ret
+
+008034c8 <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  8034c8:	55                   	push   %ebp
+  8034c9:	89 e5                	mov    %esp,%ebp
+  8034cb:	83 ec 08             	sub    $0x8,%esp
+	if (_pgfault_handler == 0) {
+  8034ce:	83 3d 08 90 80 00 00 	cmpl   $0x0,0x809008
+  8034d5:	74 0a                	je     8034e1 <set_pgfault_handler+0x19>
+				       PTE_U | PTE_W | PTE_P));
+		assert(!sys_env_set_pgfault_upcall(0, _pgfault_upcall));
+	}
+
+	// Save handler pointer for assembly to call.
+	_pgfault_handler = handler;
+  8034d7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8034da:	a3 08 90 80 00       	mov    %eax,0x809008
+}
+  8034df:	c9                   	leave
+  8034e0:	c3                   	ret
+		assert(!sys_page_alloc(0, (void *) UXSTACKTOP - PGSIZE,
+  8034e1:	83 ec 04             	sub    $0x4,%esp
+  8034e4:	6a 07                	push   $0x7
+  8034e6:	68 00 f0 bf ee       	push   $0xeebff000
+  8034eb:	6a 00                	push   $0x0
+  8034ed:	e8 9a d6 ff ff       	call   800b8c <sys_page_alloc>
+  8034f2:	83 c4 10             	add    $0x10,%esp
+  8034f5:	85 c0                	test   %eax,%eax
+  8034f7:	75 2c                	jne    803525 <set_pgfault_handler+0x5d>
+		assert(!sys_env_set_pgfault_upcall(0, _pgfault_upcall));
+  8034f9:	83 ec 08             	sub    $0x8,%esp
+  8034fc:	68 3b 35 80 00       	push   $0x80353b
+  803501:	6a 00                	push   $0x0
+  803503:	e8 ef d7 ff ff       	call   800cf7 <sys_env_set_pgfault_upcall>
+  803508:	83 c4 10             	add    $0x10,%esp
+  80350b:	85 c0                	test   %eax,%eax
+  80350d:	74 c8                	je     8034d7 <set_pgfault_handler+0xf>
+  80350f:	68 00 3e 80 00       	push   $0x803e00
+  803514:	68 20 3c 80 00       	push   $0x803c20
+  803519:	6a 20                	push   $0x20
+  80351b:	68 30 3e 80 00       	push   $0x803e30
+  803520:	e8 23 fa ff ff       	call   802f48 <_panic>
+		assert(!sys_page_alloc(0, (void *) UXSTACKTOP - PGSIZE,
+  803525:	68 b8 3d 80 00       	push   $0x803db8
+  80352a:	68 20 3c 80 00       	push   $0x803c20
+  80352f:	6a 1e                	push   $0x1e
+  803531:	68 30 3e 80 00       	push   $0x803e30
+  803536:	e8 0d fa ff ff       	call   802f48 <_panic>
+
+0080353b <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  80353b:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  80353c:	a1 08 90 80 00       	mov    0x809008,%eax
+	call *%eax
+  803541:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  803543:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+	movl	$-0x4, %ebp
+  803546:	bd fc ff ff ff       	mov    $0xfffffffc,%ebp
+	xadd	%ebp, 0x30(%esp)	# Load trap-time %esp.
+  80354b:	0f c1 6c 24 30       	xadd   %ebp,0x30(%esp)
+
+	movl	0x28(%esp), %eax	# Load trap-time %eip.
+  803550:	8b 44 24 28          	mov    0x28(%esp),%eax
+	movl	%eax, -0x4(%ebp)
+  803554:	89 45 fc             	mov    %eax,-0x4(%ebp)
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+	addl	$0x8, %esp
+  803557:	83 c4 08             	add    $0x8,%esp
+	popal
+  80355a:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+	addl	$0x4, %esp
+  80355b:	83 c4 04             	add    $0x4,%esp
+	popfl
+  80355e:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+	popl	%esp
+  80355f:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+	ret
+  803560:	c3                   	ret
+
+00803561 <dm>:
+  803561:	55                   	push   %ebp
+  803562:	57                   	push   %edi
+  803563:	56                   	push   %esi
+  803564:	53                   	push   %ebx
+  803565:	83 ec 24             	sub    $0x24,%esp
+  803568:	89 44 24 08          	mov    %eax,0x8(%esp)
+  80356c:	89 54 24 0c          	mov    %edx,0xc(%esp)
+  803570:	8b 44 24 38          	mov    0x38(%esp),%eax
+  803574:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  803578:	89 44 24 10          	mov    %eax,0x10(%esp)
+  80357c:	89 54 24 14          	mov    %edx,0x14(%esp)
+  803580:	8b 7c 24 40          	mov    0x40(%esp),%edi
+  803584:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  803589:	b8 00 00 00 00       	mov    $0x0,%eax
+  80358e:	ba 00 00 00 00       	mov    $0x0,%edx
+  803593:	c7 44 24 18 00 00 00 	movl   $0x0,0x18(%esp)
+  80359a:	00 
+  80359b:	c7 44 24 1c 00 00 00 	movl   $0x0,0x1c(%esp)
+  8035a2:	00 
+  8035a3:	89 fb                	mov    %edi,%ebx
+  8035a5:	eb 08                	jmp    8035af <dm+0x4e>
+  8035a7:	83 e9 01             	sub    $0x1,%ecx
+  8035aa:	83 f9 ff             	cmp    $0xffffffff,%ecx
+  8035ad:	74 68                	je     803617 <dm+0xb6>
+  8035af:	0f a4 c2 01          	shld   $0x1,%eax,%edx
+  8035b3:	01 c0                	add    %eax,%eax
+  8035b5:	89 c6                	mov    %eax,%esi
+  8035b7:	89 d7                	mov    %edx,%edi
+  8035b9:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8035bd:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8035c1:	0f ad d0             	shrd   %cl,%edx,%eax
+  8035c4:	d3 ea                	shr    %cl,%edx
+  8035c6:	f6 c1 20             	test   $0x20,%cl
+  8035c9:	74 04                	je     8035cf <dm+0x6e>
+  8035cb:	89 d0                	mov    %edx,%eax
+  8035cd:	31 d2                	xor    %edx,%edx
+  8035cf:	83 e0 01             	and    $0x1,%eax
+  8035d2:	89 04 24             	mov    %eax,(%esp)
+  8035d5:	c7 44 24 04 00 00 00 	movl   $0x0,0x4(%esp)
+  8035dc:	00 
+  8035dd:	8b 04 24             	mov    (%esp),%eax
+  8035e0:	8b 54 24 04          	mov    0x4(%esp),%edx
+  8035e4:	09 f0                	or     %esi,%eax
+  8035e6:	09 fa                	or     %edi,%edx
+  8035e8:	8b 74 24 10          	mov    0x10(%esp),%esi
+  8035ec:	8b 7c 24 14          	mov    0x14(%esp),%edi
+  8035f0:	39 f0                	cmp    %esi,%eax
+  8035f2:	89 d5                	mov    %edx,%ebp
+  8035f4:	19 fd                	sbb    %edi,%ebp
+  8035f6:	72 af                	jb     8035a7 <dm+0x46>
+  8035f8:	29 f0                	sub    %esi,%eax
+  8035fa:	19 fa                	sbb    %edi,%edx
+  8035fc:	89 cf                	mov    %ecx,%edi
+  8035fe:	c1 ef 05             	shr    $0x5,%edi
+  803601:	83 e7 01             	and    $0x1,%edi
+  803604:	89 fe                	mov    %edi,%esi
+  803606:	83 f6 01             	xor    $0x1,%esi
+  803609:	d3 e6                	shl    %cl,%esi
+  80360b:	d3 e7                	shl    %cl,%edi
+  80360d:	09 74 24 18          	or     %esi,0x18(%esp)
+  803611:	09 7c 24 1c          	or     %edi,0x1c(%esp)
+  803615:	eb 90                	jmp    8035a7 <dm+0x46>
+  803617:	85 db                	test   %ebx,%ebx
+  803619:	74 05                	je     803620 <dm+0xbf>
+  80361b:	89 03                	mov    %eax,(%ebx)
+  80361d:	89 53 04             	mov    %edx,0x4(%ebx)
+  803620:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803624:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803628:	83 c4 24             	add    $0x24,%esp
+  80362b:	5b                   	pop    %ebx
+  80362c:	5e                   	pop    %esi
+  80362d:	5f                   	pop    %edi
+  80362e:	5d                   	pop    %ebp
+  80362f:	c3                   	ret
+
+00803630 <__udivdi3>:
+  803630:	83 ec 08             	sub    $0x8,%esp
+  803633:	6a 00                	push   $0x0
+  803635:	ff 74 24 1c          	push   0x1c(%esp)
+  803639:	ff 74 24 1c          	push   0x1c(%esp)
+  80363d:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803641:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803645:	e8 17 ff ff ff       	call   803561 <dm>
+  80364a:	83 c4 14             	add    $0x14,%esp
+  80364d:	c3                   	ret
+
+0080364e <__umoddi3>:
+  80364e:	83 ec 18             	sub    $0x18,%esp
+  803651:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  803655:	50                   	push   %eax
+  803656:	ff 74 24 2c          	push   0x2c(%esp)
+  80365a:	ff 74 24 2c          	push   0x2c(%esp)
+  80365e:	8b 44 24 28          	mov    0x28(%esp),%eax
+  803662:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  803666:	e8 f6 fe ff ff       	call   803561 <dm>
+  80366b:	8b 44 24 18          	mov    0x18(%esp),%eax
+  80366f:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803673:	83 c4 24             	add    $0x24,%esp
+  803676:	c3                   	ret
+
+00803677 <__divdi3>:
+  803677:	53                   	push   %ebx
+  803678:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80367c:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  803680:	8b 4c 24 10          	mov    0x10(%esp),%ecx
+  803684:	8b 5c 24 14          	mov    0x14(%esp),%ebx
+  803688:	85 d2                	test   %edx,%edx
+  80368a:	78 15                	js     8036a1 <__divdi3+0x2a>
+  80368c:	85 db                	test   %ebx,%ebx
+  80368e:	78 34                	js     8036c4 <__divdi3+0x4d>
+  803690:	83 ec 04             	sub    $0x4,%esp
+  803693:	6a 00                	push   $0x0
+  803695:	53                   	push   %ebx
+  803696:	51                   	push   %ecx
+  803697:	e8 c5 fe ff ff       	call   803561 <dm>
+  80369c:	83 c4 10             	add    $0x10,%esp
+  80369f:	eb 21                	jmp    8036c2 <__divdi3+0x4b>
+  8036a1:	f7 d8                	neg    %eax
+  8036a3:	83 d2 00             	adc    $0x0,%edx
+  8036a6:	f7 da                	neg    %edx
+  8036a8:	85 db                	test   %ebx,%ebx
+  8036aa:	78 30                	js     8036dc <__divdi3+0x65>
+  8036ac:	83 ec 04             	sub    $0x4,%esp
+  8036af:	6a 00                	push   $0x0
+  8036b1:	53                   	push   %ebx
+  8036b2:	51                   	push   %ecx
+  8036b3:	e8 a9 fe ff ff       	call   803561 <dm>
+  8036b8:	83 c4 10             	add    $0x10,%esp
+  8036bb:	f7 d8                	neg    %eax
+  8036bd:	83 d2 00             	adc    $0x0,%edx
+  8036c0:	f7 da                	neg    %edx
+  8036c2:	5b                   	pop    %ebx
+  8036c3:	c3                   	ret
+  8036c4:	83 ec 04             	sub    $0x4,%esp
+  8036c7:	6a 00                	push   $0x0
+  8036c9:	f7 d9                	neg    %ecx
+  8036cb:	83 d3 00             	adc    $0x0,%ebx
+  8036ce:	f7 db                	neg    %ebx
+  8036d0:	53                   	push   %ebx
+  8036d1:	51                   	push   %ecx
+  8036d2:	e8 8a fe ff ff       	call   803561 <dm>
+  8036d7:	83 c4 10             	add    $0x10,%esp
+  8036da:	eb df                	jmp    8036bb <__divdi3+0x44>
+  8036dc:	83 ec 04             	sub    $0x4,%esp
+  8036df:	6a 00                	push   $0x0
+  8036e1:	f7 d9                	neg    %ecx
+  8036e3:	83 d3 00             	adc    $0x0,%ebx
+  8036e6:	f7 db                	neg    %ebx
+  8036e8:	53                   	push   %ebx
+  8036e9:	51                   	push   %ecx
+  8036ea:	e8 72 fe ff ff       	call   803561 <dm>
+  8036ef:	83 c4 10             	add    $0x10,%esp
+  8036f2:	eb ce                	jmp    8036c2 <__divdi3+0x4b>
+
+008036f4 <__moddi3>:
+  8036f4:	55                   	push   %ebp
+  8036f5:	57                   	push   %edi
+  8036f6:	56                   	push   %esi
+  8036f7:	53                   	push   %ebx
+  8036f8:	83 ec 24             	sub    $0x24,%esp
+  8036fb:	8b 44 24 38          	mov    0x38(%esp),%eax
+  8036ff:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  803703:	8b 4c 24 40          	mov    0x40(%esp),%ecx
+  803707:	8b 5c 24 44          	mov    0x44(%esp),%ebx
+  80370b:	85 d2                	test   %edx,%edx
+  80370d:	78 3b                	js     80374a <__moddi3+0x56>
+  80370f:	83 ec 04             	sub    $0x4,%esp
+  803712:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  803716:	56                   	push   %esi
+  803717:	89 ce                	mov    %ecx,%esi
+  803719:	f7 de                	neg    %esi
+  80371b:	89 74 24 08          	mov    %esi,0x8(%esp)
+  80371f:	89 de                	mov    %ebx,%esi
+  803721:	83 d6 00             	adc    $0x0,%esi
+  803724:	f7 de                	neg    %esi
+  803726:	89 74 24 14          	mov    %esi,0x14(%esp)
+  80372a:	8b 74 24 08          	mov    0x8(%esp),%esi
+  80372e:	0f 48 f1             	cmovs  %ecx,%esi
+  803731:	0f 49 5c 24 14       	cmovns 0x14(%esp),%ebx
+  803736:	53                   	push   %ebx
+  803737:	56                   	push   %esi
+  803738:	e8 24 fe ff ff       	call   803561 <dm>
+  80373d:	8b 44 24 28          	mov    0x28(%esp),%eax
+  803741:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  803745:	83 c4 10             	add    $0x10,%esp
+  803748:	eb 47                	jmp    803791 <__moddi3+0x9d>
+  80374a:	f7 d8                	neg    %eax
+  80374c:	83 d2 00             	adc    $0x0,%edx
+  80374f:	f7 da                	neg    %edx
+  803751:	83 ec 04             	sub    $0x4,%esp
+  803754:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  803758:	56                   	push   %esi
+  803759:	89 cf                	mov    %ecx,%edi
+  80375b:	f7 df                	neg    %edi
+  80375d:	89 de                	mov    %ebx,%esi
+  80375f:	83 d6 00             	adc    $0x0,%esi
+  803762:	f7 de                	neg    %esi
+  803764:	0f 49 cf             	cmovns %edi,%ecx
+  803767:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  80376b:	0f 49 de             	cmovns %esi,%ebx
+  80376e:	89 5c 24 0c          	mov    %ebx,0xc(%esp)
+  803772:	ff 74 24 0c          	push   0xc(%esp)
+  803776:	ff 74 24 0c          	push   0xc(%esp)
+  80377a:	e8 e2 fd ff ff       	call   803561 <dm>
+  80377f:	8b 44 24 28          	mov    0x28(%esp),%eax
+  803783:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  803787:	f7 d8                	neg    %eax
+  803789:	83 d2 00             	adc    $0x0,%edx
+  80378c:	f7 da                	neg    %edx
+  80378e:	83 c4 10             	add    $0x10,%esp
+  803791:	83 c4 24             	add    $0x24,%esp
+  803794:	5b                   	pop    %ebx
+  803795:	5e                   	pop    %esi
+  803796:	5f                   	pop    %edi
+  803797:	5d                   	pop    %ebp
+  803798:	c3                   	ret
@@ -0,0 +1,16 @@
+// Print the file server's block cache statistics.
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv)
+{
+	struct BcStats st;
+	int r;
+
+	if ((r = fs_bcstats(&st)) < 0)
+		panic("fs_bcstats: %e", r);
+	printf("hits %u misses %u\n", st.bs_hits, st.bs_misses);
+	printf("readahead %u evictions %u\n", st.bs_readahead, st.bs_evictions);
+	printf("writebacks %u in %u writes\n", st.bs_writebacks, st.bs_writes);
+}
@@ -0,0 +1,81 @@
+// Defragment files: have the file server lay out each file's blocks
+// contiguously on disk.  With no arguments, every file on the disk.
+
+#include <inc/lib.h>
+
+bool verbose;
+char dirbuf[PGSIZE];
+
+static void
+usage(void)
+{
+	printf("usage: defrag [-v] [file...]\n");
+	exit();
+}
+
+static void
+defrag1(const char *path)
+{
+	uint32_t before, after;
+	int r;
+
+	if ((r = defrag(path, &before, &after)) < 0)
+		printf("defrag %s: %e\n", path, r);
+	else if (verbose || after != before)
+		printf("%s: %u extents -> %u\n", path, before, after);
+}
+
+// Defragment every regular file under the directory 'path'.
+static void
+defragdir(const char *path)
+{
+	char file[MAXPATHLEN];
+	struct Fsdirent *d;
+	int fd, n, i;
+
+	if ((fd = open(path, O_RDONLY | O_NOBUF)) < 0) {
+		printf("open %s: %e\n", path, fd);
+		return;
+	}
+	while ((n = readdir(fd, dirbuf, sizeof dirbuf, FSREADDIR_RECURSIVE)) > 0)
+		for (i = 0; i < n; i += d->d_reclen) {
+			d = (struct Fsdirent *) (dirbuf + i);
+			if (d->d_type != FTYPE_REG)
+				continue;
+			snprintf(file, sizeof file, "%s%s%s", path,
+				 path[strlen(path) - 1] == '/' ? "" : "/", d->d_name);
+			defrag1(file);
+		}
+	if (n < 0)
+		printf("error reading directory %s: %e\n", path, n);
+	close(fd);
+}
+
+void
+umain(int argc, char **argv)
+{
+	int i;
+	struct Stat st;
+	struct Argstate args;
+
+	argstart(&argc, argv, &args);
+	while ((i = argnext(&args)) >= 0)
+		switch (i) {
+		case 'v':
+			verbose = 1;
+			break;
+		default:
+			usage();
+		}
+
+	if (argc == 1)
+		defragdir("/");
+	for (i = 1; i < argc; i++) {
+		if (stat(argv[i], &st) < 0)
+			printf("stat %s: no such file\n", argv[i]);
+		else if (st.st_isdir)
+			defragdir(argv[i]);
+		else
+			defrag1(argv[i]);
+	}
+}
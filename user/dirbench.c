@@ -0,0 +1,79 @@
+// Directory benchmark: create, look up and remove many files in one
+// directory, to measure how open and create scale with directory size.
+
+#include <inc/lib.h>
+
+static void
+usage(void)
+{
+	printf("usage: dirbench [-n nfiles] [dir]\n");
+	exit();
+}
+
+static void
+name(char *buf, const char *dir, int i)
+{
+	snprintf(buf, MAXPATHLEN, "%s/bench%05d", dir, i);
+}
+
+void
+umain(int argc, char **argv)
+{
+	int i, r, fd, n;
+	unsigned start, end;
+	const char *dir;
+	char path[MAXPATHLEN];
+	struct Stat st;
+	struct Argstate args;
+
+	n = 10000;
+	argstart(&argc, argv, &args);
+	while ((i = argnext(&args)) >= 0)
+		switch (i) {
+		case 'n':
+			n = strtol(argnextvalue(&args), 0, 0);
+			break;
+		default:
+			usage();
+		}
+	if (argc > 2)
+		usage();
+	dir = argc == 2 ? argv[1] : "";
+
+	start = sys_time_msec();
+	for (i = 0; i < n; i++) {
+		name(path, dir, i);
+		if ((fd = open(path, O_WRONLY | O_CREAT | O_EXCL)) < 0)
+			panic("create %s: %e", path, fd);
+		close(fd);
+	}
+	end = sys_time_msec();
+	printf("created %d files in %u ms\n", n, end - start);
+
+	start = sys_time_msec();
+	for (i = 0; i < n; i++) {
+		name(path, dir, (i * 7919) % n);
+		if ((r = stat(path, &st)) < 0)
+			panic("stat %s: %e", path, r);
+	}
+	end = sys_time_msec();
+	printf("looked up %d files in %u ms\n", n, end - start);
+
+	start = sys_time_msec();
+	for (i = 0; i < n; i++) {
+		snprintf(path, sizeof path, "%s/missing%05d", dir, i);
+		if ((r = stat(path, &st)) != -E_NOT_FOUND)
+			panic("stat %s: got %e, wanted not found", path, r);
+	}
+	end = sys_time_msec();
+	printf("missed %d lookups in %u ms\n", n, end - start);
+
+	start = sys_time_msec();
+	for (i = 0; i < n; i++) {
+		name(path, dir, i);
+		if ((r = remove(path)) < 0)
+			panic("remove %s: %e", path, r);
+	}
+	end = sys_time_msec();
+	printf("removed %d files in %u ms\n", n, end - start);
+}
@@ -1,6 +1,7 @@
 #include <inc/lib.h>
 
 int flag[256];
+char dirbuf[PGSIZE];
 
 void lsdir(const char*, const char*);
 void ls1(const char*, bool, off_t, const char*);
@@ -22,18 +23,20 @@ ls(const char *path, const char *prefix)
 void
 lsdir(const char *path, const char *prefix)
 {
-	int fd, n;
-	struct File f;
+	int fd, n, i;
+	struct Fsdirent *d;
 
-	if ((fd = open(path, O_RDONLY)) < 0)
+	if ((fd = open(path, O_RDONLY | O_NOBUF)) < 0)
 		panic("open %s: %e", path, fd);
-	while ((n = readn(fd, &f, sizeof f)) == sizeof f)
-		if (f.f_name[0])
-			ls1(prefix, f.f_type==FTYPE_DIR, f.f_size, f.f_name);
-	if (n > 0)
-		panic("short read in directory %s", path);
+	while ((n = readdir(fd, dirbuf, sizeof dirbuf,
+			    flag['R'] ? FSREADDIR_RECURSIVE : 0)) > 0)
+		for (i = 0; i < n; i += d->d_reclen) {
+			d = (struct Fsdirent *) (dirbuf + i);
+			ls1(prefix, d->d_type == FTYPE_DIR, d->d_size, d->d_name);
+		}
 	if (n < 0)
 		panic("error reading directory %s: %e", path, n);
+	close(fd);
 }
 
 void
@@ -59,7 +62,7 @@ ls1(const char *prefix, bool isdir, off_t size, const char *name)
 void
 usage(void)
 {
-	printf("usage: ls [-dFl] [file...]\n");
+	printf("usage: ls [-dFlR] [file...]\n");
 	exit();
 }
 
@@ -75,6 +78,7 @@ umain(int argc, char **argv)
 		case 'd':
 		case 'F':
 		case 'l':
+		case 'R':
 			flag[i]++;
 			break;
 		default:
@@ -0,0 +1,79 @@
+#include <inc/lib.h>
+
+// Reads and writes of more than a page go through the caller's own
+// buffer pages (FSREQ_READ_BULK and FSREQ_WRITE_BULK).
+
+#define NBIG	(FSBULK_MAXPAGES + 2)
+#define ROVA	((char*)0xCCCCC000)
+
+static char big[NBIG * PGSIZE] __attribute__((aligned(PGSIZE)));
+static char back[NBIG * PGSIZE] __attribute__((aligned(PGSIZE)));
+
+void
+umain(int argc, char **argv)
+{
+	extern union Fsipc fsipcbuf;
+	uintptr_t pages[2];
+	struct Fd *fd;
+	int r, f, i, n;
+
+	for (i = 0; i < sizeof(big); i++)
+		big[i] = i ^ (i >> 9);
+
+	if ((f = open("/bulk", O_RDWR|O_CREAT|O_TRUNC|O_NOBUF)) < 0)
+		panic("open /bulk: %e", f);
+
+	// A few pages, starting and ending in the middle of a page
+	n = 3*PGSIZE + 500;
+	if ((r = write(f, big + 100, n)) != n)
+		panic("bulk write returned %d, wanted %d: %e", r, n, r);
+	cprintf("bulk write is good\n");
+
+	seek(f, 0);
+	memset(back, 0, sizeof(back));
+	if ((r = read(f, back + 100, n)) != n)
+		panic("bulk read returned %d, wanted %d: %e", r, n, r);
+	if (memcmp(back + 100, big + 100, n) != 0)
+		panic("bulk read returned wrong data");
+	if (back[99] != 0 || back[100 + n] != 0)
+		panic("bulk read wrote outside the buffer");
+	cprintf("bulk read is good\n");
+
+	// A single request carries at most FSBULK_MAXPAGES pages
+	seek(f, 0);
+	if ((r = write(f, big, sizeof(big))) != FSBULK_MAXPAGES*PGSIZE)
+		panic("bulk write of %d pages returned %d", NBIG, r);
+	seek(f, 0);
+	memset(back, 0, sizeof(back));
+	if ((r = read(f, back + 100, sizeof(back) - 100)) != FSBULK_MAXPAGES*PGSIZE - 100)
+		panic("bulk read of %d pages returned %d", NBIG, r);
+	if (memcmp(back + 100, big, r) != 0)
+		panic("clipped bulk read returned wrong data");
+	cprintf("bulk clipping is good\n");
+
+	// The server must not read into pages it cannot write, nor past
+	// the pages it was sent
+	if ((r = fd_lookup(f, &fd)) < 0)
+		panic("fd_lookup: %e", r);
+	if ((r = sys_page_alloc(0, ROVA, PTE_P|PTE_U)) < 0)
+		panic("sys_page_alloc: %e", r);
+	pages[0] = (uintptr_t) &fsipcbuf | PTE_P|PTE_W|PTE_U;
+	pages[1] = (uintptr_t) ROVA | PTE_P|PTE_U;
+
+	fsipcbuf.bulk.req_fileid = fd->fd_file.id;
+	fsipcbuf.bulk.req_n = PGSIZE;
+	fsipcbuf.bulk.req_off = 0;
+	ipc_sendv(ipc_find_env(ENV_TYPE_FS), FSREQ_READ_BULK, pages, 2);
+	if ((r = ipc_recv(NULL, NULL, NULL)) != -E_INVAL)
+		panic("bulk read into a read-only page returned %d", r);
+
+	fsipcbuf.bulk.req_fileid = fd->fd_file.id;
+	fsipcbuf.bulk.req_n = PGSIZE;
+	fsipcbuf.bulk.req_off = 100;
+	ipc_sendv(ipc_find_env(ENV_TYPE_FS), FSREQ_WRITE_BULK, pages, 2);
+	if ((r = ipc_recv(NULL, NULL, NULL)) != -E_INVAL)
+		panic("bulk write past the pages sent returned %d", r);
+	cprintf("bulk page checks are good\n");
+
+	close(f);
+}
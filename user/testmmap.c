@@ -0,0 +1,103 @@
+#include <inc/lib.h>
+
+// mmap hands out the file server's cached pages: read-only when shared,
+// copy-on-write when private.  spawn maps program text the same way.
+
+#define VA	((char *) 0xA0000000)
+#define VA2	((char *) 0xA1000000)
+#define VA3	((char *) 0xA2000000)
+#define LEN	(2*PGSIZE + 100)
+
+static char data[LEN];
+static char buf[LEN];
+
+static void childofspawn(char *what);
+
+void
+umain(int argc, char **argv)
+{
+	envid_t waiter, checker;
+	int r, f, i;
+
+	if (argc > 1)
+		childofspawn(argv[1]);
+
+	for (i = 0; i < LEN; i++)
+		data[i] = 'a' + i % 26;
+	if ((f = open("/mmapfile", O_RDWR|O_CREAT|O_TRUNC)) < 0)
+		panic("open /mmapfile: %e", f);
+	if ((r = write(f, data, LEN)) != LEN)
+		panic("write /mmapfile: %e", r);
+	close(f);
+
+	if ((f = open("/mmapfile", O_RDONLY)) < 0)
+		panic("open /mmapfile: %e", f);
+
+	// Shared mappings are read-only, and share the cached pages
+	if ((r = mmap(VA, LEN, PROT_READ|PROT_WRITE, MAP_SHARED, f, 0)) != -E_NOT_SUPP)
+		panic("writable shared mmap returned %d", r);
+	if ((r = mmap(VA, LEN, PROT_READ, MAP_SHARED, f, 0)) < 0)
+		panic("mmap shared: %e", r);
+	if ((r = mmap(VA2, LEN, PROT_READ, MAP_SHARED, f, 0)) < 0)
+		panic("mmap shared 2: %e", r);
+	if (memcmp(VA, data, LEN) != 0)
+		panic("shared mapping holds wrong data");
+	for (i = 0; i < LEN; i += PGSIZE) {
+		if (uvpt[PGNUM(VA + i)] & PTE_W)
+			panic("shared mapping is writable");
+		if (PTE_ADDR(uvpt[PGNUM(VA + i)]) != PTE_ADDR(uvpt[PGNUM(VA2 + i)]))
+			panic("shared mappings do not share pages");
+	}
+	cprintf("mmap shared is good\n");
+
+	// Writes to a private mapping go to a copy, never to the file
+	if ((r = mmap(VA3, LEN, PROT_READ|PROT_WRITE, MAP_PRIVATE, f, 0)) < 0)
+		panic("mmap private: %e", r);
+	if (memcmp(VA3, data, LEN) != 0)
+		panic("private mapping holds wrong data");
+	strcpy(VA3 + PGSIZE, "private");
+	if (strcmp(VA3 + PGSIZE, "private") != 0)
+		panic("private mapping did not take the write");
+	if (PTE_ADDR(uvpt[PGNUM(VA3 + PGSIZE)]) == PTE_ADDR(uvpt[PGNUM(VA + PGSIZE)]))
+		panic("private write went to the shared page");
+	if (memcmp(VA, data, LEN) != 0)
+		panic("private write showed in the shared mapping");
+	munmap(VA3, LEN);
+	seek(f, 0);
+	if ((r = readn(f, buf, LEN)) != LEN)
+		panic("read /mmapfile: %e", r);
+	if (memcmp(buf, data, LEN) != 0)
+		panic("private write changed the file");
+	cprintf("mmap private is good\n");
+
+	munmap(VA, LEN);
+	munmap(VA2, LEN);
+	close(f);
+
+	// Two instances of a program share its text: the waiter keeps
+	// its copy mapped while the checker counts the references.
+	if ((waiter = spawnl("/testmmap", "testmmap", "wait", 0)) < 0)
+		panic("spawn: %e", waiter);
+	if ((checker = spawnl("/testmmap", "testmmap", "check", 0)) < 0)
+		panic("spawn: %e", checker);
+	wait(checker);
+	ipc_send(waiter, 0, NULL, 0);
+	wait(waiter);
+}
+
+static void
+childofspawn(char *what)
+{
+	if (strcmp(what, "wait") == 0) {
+		ipc_recv(NULL, NULL, NULL);
+		exit();
+	}
+
+	// The file server's cached page, the waiter's and ours
+	if (uvpt[PGNUM(umain)] & PTE_W)
+		panic("spawned text is writable");
+	if (pageref((void *) umain) < 3)
+		panic("spawned text has %d references", pageref((void *) umain));
+	cprintf("spawn shares text pages\n");
+	exit();
+}
@@ -0,0 +1,186 @@
+#include <inc/lib.h>
+
+// readdir lists a directory, or with FSREADDIR_RECURSIVE its whole
+// subtree, a reply page at a time; file_slurp reads a file in one go.
+
+#define NTOP	40	// files in /rd
+#define NSUB	30	// files in /rd/sub0 and /rd/sub1
+#define NDEEP	10	// files in /rd/sub0/deep
+#define NENTS	(NTOP + 2 + 2*NSUB + 1 + NDEEP)
+#define LONG	"a-rather-long-name-for-readdir"
+
+static struct Ent {
+	char name[MAXPATHLEN];	// relative to /rd
+	int type;
+	off_t size;
+	int depth;
+	int seen;
+} ents[NENTS];
+static int nents;
+
+static char data[5*PGSIZE];
+static char buf[PGSIZE];
+static char sbuf[5*PGSIZE] __attribute__((aligned(PGSIZE)));
+
+static void
+mk(const char *name, int type, off_t size)
+{
+	char path[MAXPATHLEN];
+	const char *p;
+	struct Ent *e;
+	int f, r;
+
+	snprintf(path, sizeof(path), "/rd/%s", name);
+	if (type == FTYPE_DIR)
+		f = open(path, O_RDONLY|O_CREAT|O_EXCL|O_MKDIR);
+	else
+		f = open(path, O_RDWR|O_CREAT|O_EXCL);
+	if (f < 0)
+		panic("create %s: %e", path, f);
+	if (size && (r = write(f, data, size)) != size)
+		panic("write %s: %e", path, r);
+	close(f);
+
+	e = &ents[nents++];
+	strcpy(e->name, name);
+	e->type = type;
+	e->size = size;
+	for (e->depth = 0, p = name; *p; p++)
+		if (*p == '/')
+			e->depth++;
+}
+
+// Read all of /rd's entries with flags, n bytes at a time, and check
+// them against ents.  Returns the number of readdir calls it took.
+static int
+check(int fd, int flags, size_t n)
+{
+	struct Fsdirent *d;
+	struct Ent *e;
+	int i, r, calls, pos;
+	char *slash;
+
+	for (i = 0; i < nents; i++)
+		ents[i].seen = 0;
+	seek(fd, 0);
+	for (calls = 0; (r = readdir(fd, buf, n, flags)) != 0; calls++) {
+		if (r < 0)
+			panic("readdir: %e", r);
+		for (pos = 0; pos < r; pos += d->d_reclen) {
+			d = (struct Fsdirent *) (buf + pos);
+			if (d->d_reclen == 0 || pos + d->d_reclen > r)
+				panic("readdir: bad d_reclen %d", d->d_reclen);
+			for (e = ents; e < ents + nents; e++)
+				if (strcmp(e->name, d->d_name) == 0)
+					break;
+			if (e == ents + nents)
+				panic("readdir: unexpected entry %s", d->d_name);
+			if (e->seen++)
+				panic("readdir: %s listed twice", d->d_name);
+			if (e->depth > 0 && !(flags & FSREADDIR_RECURSIVE))
+				panic("readdir: %s listed without FSREADDIR_RECURSIVE", d->d_name);
+			if (d->d_type != e->type || d->d_depth != e->depth
+			    || (e->type == FTYPE_REG && d->d_size != e->size))
+				panic("readdir: %s has type %d depth %d size %d",
+				      d->d_name, d->d_type, d->d_depth, d->d_size);
+
+			// A directory's entries come after the directory
+			if (e->depth > 0) {
+				slash = strchr(e->name, '/');
+				while (strchr(slash + 1, '/'))
+					slash = strchr(slash + 1, '/');
+				*slash = 0;
+				for (i = 0; i < nents; i++)
+					if (strcmp(ents[i].name, e->name) == 0)
+						break;
+				*slash = '/';
+				if (i == nents || !ents[i].seen)
+					panic("readdir: %s listed before its directory", d->d_name);
+			}
+		}
+	}
+	for (e = ents; e < ents + nents; e++)
+		if (!e->seen && (e->depth == 0 || (flags & FSREADDIR_RECURSIVE)))
+			panic("readdir: %s missing", e->name);
+	return calls;
+}
+
+void
+umain(int argc, char **argv)
+{
+	char name[MAXPATHLEN];
+	struct Stat st;
+	int i, r, f;
+
+	for (i = 0; i < sizeof(data); i++)
+		data[i] = i % 251;
+
+	if ((r = open("/rd", O_RDONLY|O_CREAT|O_EXCL|O_MKDIR)) < 0)
+		panic("mkdir /rd: %e", r);
+	close(r);
+	mk("sub0", FTYPE_DIR, 0);
+	mk("sub1", FTYPE_DIR, 0);
+	mk("sub0/deep", FTYPE_DIR, 0);
+	for (i = 0; i < NTOP; i++) {
+		snprintf(name, sizeof(name), LONG "-%02d", i);
+		mk(name, FTYPE_REG, i * 10);
+	}
+	for (i = 0; i < NSUB; i++) {
+		snprintf(name, sizeof(name), "sub0/" LONG "-%02d", i);
+		mk(name, FTYPE_REG, i);
+		snprintf(name, sizeof(name), "sub1/" LONG "-%02d", i);
+		mk(name, FTYPE_REG, 2 * i);
+	}
+	for (i = 0; i < NDEEP; i++) {
+		snprintf(name, sizeof(name), "sub0/deep/" LONG "-%02d", i);
+		mk(name, FTYPE_REG, PGSIZE + i);
+	}
+
+	if ((f = open("/rd", O_RDONLY)) < 0)
+		panic("open /rd: %e", f);
+	if ((r = readdir(f, buf, 8, 0)) != -E_INVAL)
+		panic("readdir into 8 bytes returned %d", r);
+
+	// Small replies make every call pick up where the last stopped
+	if ((r = check(f, 0, 256)) < 2)
+		panic("readdir took %d calls", r);
+	check(f, 0, PGSIZE);
+	cprintf("readdir is good\n");
+
+	if ((r = check(f, FSREADDIR_RECURSIVE, PGSIZE)) < 2)
+		panic("recursive readdir took %d calls", r);
+	check(f, FSREADDIR_RECURSIVE, 256);
+	cprintf("readdir recursive is good\n");
+	close(f);
+
+	// Small files come back through the request page
+	memset(buf, 0, sizeof(buf));
+	if ((r = file_slurp("/rd/" LONG "-05", buf, 100, &st)) != 50)
+		panic("file_slurp returned %d, wanted 50", r);
+	if (memcmp(buf, data, 50) != 0)
+		panic("file_slurp returned wrong data");
+	if (st.st_size != 50 || st.st_isdir || strcmp(st.st_name, LONG "-05") != 0)
+		panic("file_slurp stat: %s size %d isdir %d",
+		      st.st_name, st.st_size, st.st_isdir);
+	if ((r = file_slurp("/rd/" LONG "-05", buf, 20, 0)) != 20)
+		panic("short file_slurp returned %d, wanted 20", r);
+
+	// Bigger ones straight into the caller's pages
+	memset(sbuf, 0, sizeof(sbuf));
+	if ((r = file_slurp("/rd/sub0/deep/" LONG "-07", sbuf + 100,
+			    sizeof(sbuf) - 100, &st)) != PGSIZE + 7)
+		panic("file_slurp into pages returned %d, wanted %d", r, PGSIZE + 7);
+	if (memcmp(sbuf + 100, data, PGSIZE + 7) != 0)
+		panic("file_slurp into pages returned wrong data");
+	if (sbuf[99] != 0 || sbuf[100 + PGSIZE + 7] != 0)
+		panic("file_slurp wrote outside the buffer");
+	if (st.st_size != PGSIZE + 7 || st.st_isdir)
+		panic("file_slurp into pages stat: size %d isdir %d",
+		      st.st_size, st.st_isdir);
+
+	if ((r = file_slurp("/rd/sub1", buf, 100, &st)) != 0 || !st.st_isdir)
+		panic("file_slurp of a directory returned %d, isdir %d", r, st.st_isdir);
+	if ((r = file_slurp("/rd/not-found", buf, 100, &st)) != -E_NOT_FOUND)
+		panic("file_slurp /rd/not-found returned %d", r);
+	cprintf("file_slurp is good\n");
+}
@@ -0,0 +1,117 @@
+#include <inc/lib.h>
+
+// Requests posted on the fsring run asynchronously; fsring_reap hands
+// back each one's tag and result.
+
+#define NREPOST	200
+
+static char page[PGSIZE];
+static char rbuf[FSRING_NSLOTS][PGSIZE];
+static struct Stat sts[FSRING_NSLOTS];
+
+static void
+fill(char *p, char c)
+{
+	memset(p, c, PGSIZE);
+}
+
+static void
+check(const char *p, char c, const char *what, int i)
+{
+	int j;
+
+	for (j = 0; j < PGSIZE; j++)
+		if (p[j] != c)
+			panic("%s %d: byte %d is %02x, wanted %02x",
+			      what, i, j, (unsigned char) p[j], (unsigned char) c);
+}
+
+void
+umain(int argc, char **argv)
+{
+	uint32_t tag, seen = 0;
+	int r, f, i, n, result;
+
+	if ((f = open("/ringfile", O_RDWR|O_CREAT|O_TRUNC|O_NOBUF)) < 0)
+		panic("open /ringfile: %e", f);
+	for (i = 0; i < FSRING_NSLOTS; i++) {
+		fill(page, 'a' + i);
+		if ((r = write(f, page, PGSIZE)) != PGSIZE)
+			panic("write /ringfile: %e", r);
+	}
+
+	// Fill every slot with a mix of writes, reads and stats, each
+	// on its own page of the file
+	for (i = 0; i < FSRING_NSLOTS; i++) {
+		switch (i % 3) {
+		case 0:
+			fill(page, 'A' + i);
+			r = fsring_write(f, page, PGSIZE, i * PGSIZE, 100 + i);
+			break;
+		case 1:
+			r = fsring_read(f, rbuf[i], PGSIZE, i * PGSIZE, 100 + i);
+			break;
+		default:
+			r = fsring_stat(f, &sts[i], 100 + i);
+			break;
+		}
+		if (r < 0)
+			panic("fsring post %d: %e", i, r);
+	}
+	if ((r = fsring_stat(f, &sts[0], 99)) != -E_NO_MEM)
+		panic("fsring post on a full ring returned %d", r);
+
+	for (n = 0; n < FSRING_NSLOTS; n++) {
+		if (!fsring_reap(&tag, &result, 1))
+			panic("fsring_reap: nothing after %d results", n);
+		i = tag - 100;
+		if (tag < 100 || i >= FSRING_NSLOTS || (seen & (1 << i)))
+			panic("fsring_reap: bad tag %d", tag);
+		seen |= 1 << i;
+		switch (i % 3) {
+		case 0:
+			if (result != PGSIZE)
+				panic("fsring write %d returned %d", i, result);
+			break;
+		case 1:
+			if (result != PGSIZE)
+				panic("fsring read %d returned %d", i, result);
+			check(rbuf[i], 'a' + i, "fsring read", i);
+			break;
+		default:
+			if (result != 0)
+				panic("fsring stat %d returned %d", i, result);
+			if (sts[i].st_size != FSRING_NSLOTS * PGSIZE)
+				panic("fsring stat %d: size %d", i, sts[i].st_size);
+			break;
+		}
+	}
+	if (fsring_reap(&tag, &result, 1))
+		panic("fsring_reap returned tag %d with nothing outstanding", tag);
+
+	for (i = 0; i < FSRING_NSLOTS; i += 3) {
+		seek(f, i * PGSIZE);
+		if ((r = readn(f, page, PGSIZE)) != PGSIZE)
+			panic("read /ringfile: %e", r);
+		check(page, 'A' + i, "fsring write", i);
+	}
+	cprintf("fsring requests are good\n");
+
+	// Post again as soon as the ring drains, so that the post races
+	// with the server going idle; a lost kick hangs here
+	for (i = 0; i < NREPOST; i++) {
+		fill(page, '0' + i % 10);
+		if ((r = fsring_write(f, page, PGSIZE, 0, i)) < 0)
+			panic("fsring_write: %e", r);
+		if (!fsring_reap(&tag, &result, 1) || tag != i || result != PGSIZE)
+			panic("fsring repost %d: tag %d result %d", i, tag, result);
+		if ((r = fsring_read(f, rbuf[0], PGSIZE, 0, i)) < 0)
+			panic("fsring_read: %e", r);
+		if (!fsring_reap(&tag, &result, 1) || tag != i || result != PGSIZE)
+			panic("fsring repost %d: tag %d result %d", i, tag, result);
+		check(rbuf[0], '0' + i % 10, "fsring repost", i);
+	}
+	cprintf("fsring repost is good\n");
+
+	close(f);
+}